@@ -0,0 +1,1173 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <Core/Enum/DSType.hpp>
+#include <Core/Enum/Game.hpp>
+#include <Core/Enum/Language.hpp>
+#include <Core/Enum/Lead.hpp>
+#include <Core/Enum/Method.hpp>
+#include <Core/Gen3/Searchers/ChannelSeedSearcher.hpp>
+#include <Core/Gen3/Searchers/IDSearcher3.hpp>
+#include <Core/Gen3/Tools/PIDIVCalculator.hpp>
+#include <Core/Gen4/Searchers/IDSearcher4.hpp>
+#include <Core/Gen4/Searchers/StationarySearcher4.hpp>
+#include <Core/Gen4/SpreadIndex4.hpp>
+#include <Core/Gen5/Searchers/IDSearcher5.hpp>
+#include <Core/Gen5/SeedDatabase5.hpp>
+#include <Core/Util/Translator.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace
+{
+    std::atomic<bool> interrupted(false);
+
+    void interrupt(int)
+    {
+        interrupted = true;
+    }
+
+    void usage()
+    {
+        std::fprintf(stderr,
+                     "Usage: PokeFinderCLI pidiv [--wild] [--threads N] [file]\n"
+                     "       PokeFinderCLI id3 --game rs|gc [--threads N] [--initial-advances N] [--max-advances N]\n"
+                     "                         [--tid N]... [--sid N]... [--tsv N]...\n"
+                     "       PokeFinderCLI id4 [--year N] [--min-delay N] [--max-delay N | --infinite] [--tid N]... [--sid N]...\n"
+                     "                         [--tsv N]... [--shard K/N] [--checkpoint file] [--stats]\n"
+                     "                         [--budget N [--policy spill|block|drop] [--spill-file file]]\n"
+                     "       PokeFinderCLI id5 --game b|w|b2|w2 --start YYYY-MM-DD --end YYYY-MM-DD [--mac HEX] [--timer0-min HEX]\n"
+                     "                         [--timer0-max HEX] [--vcount HEX] [--gxstat N] [--vframe N] [--ds-type ds|dsi|3ds]\n"
+                     "                         [--language en|fr|de|it|jp|kr|es] [--keypresses 0123] [--skip-lr] [--soft-reset]\n"
+                     "                         [--memory-link] [--max-advances N] [--tid N]... [--sid N]... [--tsv N]... [--threads N]\n"
+                     "                         [--database file] [--stats]\n"
+                     "       PokeFinderCLI channel [--threads N] [--shard K/N] [--checkpoint file] pattern...\n"
+                     "       PokeFinderCLI merge file...\n"
+                     "       PokeFinderCLI index4 --min-delay N --max-delay N --max-advance N file\n"
+                     "       PokeFinderCLI stationary4 --min-delay N --max-delay N [--min-advance N] [--max-advance N]\n"
+                     "                                 [--min-ivs H/A/B/C/D/S] [--max-ivs H/A/B/C/D/S] [--nature N]... [--tid N] [--sid N]\n"
+                     "                                 [--method 1|j|k] [--index file]\n"
+                     "\n"
+                     "pidiv reverses PIDs read from file, or standard input, one per line as a hex PID\n"
+                     "optionally followed by HP Atk Def SpA SpD Spe to only keep matching results.\n"
+                     "\n"
+                     "id3 searches Ruby/Sapphire or XD/Colo seeds for trainer IDs, results are written as they are found.\n"
+                     "XD/Colo searches need at least one --tid, --sid or --tsv.\n"
+                     "\n"
+                     "id4 searches Gen 4 initial seeds for trainer IDs. With --checkpoint the search resumes from\n"
+                     "and saves its progress to file. With --stats a JSON line of search statistics is written to\n"
+                     "standard error every second. With --budget at most N results are held in memory, the rest are\n"
+                     "written to a temporary file, or --spill-file, and paged back in as they are written out. The\n"
+                     "block policy pauses the search instead and the drop policy discards them.\n"
+                     "\n"
+                     "id5 searches the Gen 5 dates from --start to --end for trainer IDs. The profile defaults to White on\n"
+                     "an original DS, --keypresses lists the number of keys pressed that are searched and defaults to 0.\n"
+                     "With --database the seeds of the dates not yet stored in file are hashed into it first and every\n"
+                     "search with the same profile reads its seeds from file instead of hashing them again.\n"
+                     "\n"
+                     "channel searches XD/Colo seeds for the Channel Jirachi patterns, given in decimal.\n"
+                     "\n"
+                     "Searches given --shard K/N only search shard K of N equal parts and start their output with a line\n"
+                     "naming the shard. merge checks that files are all the shards of the same search and writes their\n"
+                     "results in the order the search without shards would have.\n"
+                     "\n"
+                     "index4 writes the Method 1 spread index of every Gen 4 initial seed in the delay range to file.\n"
+                     "\n"
+                     "stationary4 searches Gen 4 initial seeds for stationary spreads in the IV range, natures are given\n"
+                     "as their index. Method 1 searches given --index answer from a file written by index4 when it covers\n"
+                     "the delays and advances, otherwise they search without it.\n"
+                     "\n"
+                     "Results are written as CSV to standard output.\n");
+    }
+
+    bool parseShard(const char *text, SearchShard &shard)
+    {
+        unsigned int index;
+        unsigned int count;
+        char extra;
+        if (std::sscanf(text, "%u/%u%c", &index, &count, &extra) != 2 || count == 0 || index >= count)
+        {
+            std::fprintf(stderr, "Invalid shard %s, expected K/N with K less than N\n", text);
+            return false;
+        }
+
+        shard.index = index;
+        shard.count = count;
+        return true;
+    }
+
+    // Shards of the same search are identified by their command line without the options that do not change results
+    std::string getJob(const char *command, int argc, char *argv[])
+    {
+        std::string job = command;
+        for (int i = 0; i < argc; i++)
+        {
+            if (std::strcmp(argv[i], "--shard") == 0 || std::strcmp(argv[i], "--checkpoint") == 0 || std::strcmp(argv[i], "--threads") == 0
+                || std::strcmp(argv[i], "--spill-file") == 0)
+            {
+                i++;
+            }
+            else if (std::strcmp(argv[i], "--stats") != 0)
+            {
+                job += ' ';
+                job += argv[i];
+            }
+        }
+        return job;
+    }
+
+    bool parsePolicy(const char *text, ResultPolicy &policy)
+    {
+        if (std::strcmp(text, "spill") == 0)
+        {
+            policy = ResultPolicy::Spill;
+        }
+        else if (std::strcmp(text, "block") == 0)
+        {
+            policy = ResultPolicy::Block;
+        }
+        else if (std::strcmp(text, "drop") == 0)
+        {
+            policy = ResultPolicy::Drop;
+        }
+        else
+        {
+            std::fprintf(stderr, "Invalid policy %s, expected spill, block or drop\n", text);
+            return false;
+        }
+        return true;
+    }
+
+    // Ordered shards are concatenated by merge, sorted shards are merged into one sorted list without duplicates
+    void printShard(const SearchShard &shard, bool sorted, const std::string &job)
+    {
+        std::printf("# shard %u/%u %s %s\n", shard.index, shard.count, sorted ? "sorted" : "ordered", job.c_str());
+    }
+
+    const char *getMethod(Method method, bool wild)
+    {
+        switch (method)
+        {
+        case Method::Method1:
+            return wild ? "Method H1" : "Method 1";
+        case Method::Method2:
+            return wild ? "Method H2" : "Method 2";
+        case Method::Method4:
+            return wild ? "Method H4" : "Method 4";
+        case Method::XDColo:
+            return "XD/Colo";
+        case Method::Channel:
+            return "Channel";
+        default:
+            return "-";
+        }
+    }
+
+    int pidiv(int argc, char *argv[])
+    {
+        bool wild = false;
+        int threads = static_cast<int>(std::thread::hardware_concurrency());
+        const char *fileName = nullptr;
+
+        for (int i = 0; i < argc; i++)
+        {
+            if (std::strcmp(argv[i], "--wild") == 0)
+            {
+                wild = true;
+            }
+            else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            {
+                threads = std::atoi(argv[++i]);
+            }
+            else if (!fileName && argv[i][0] != '-')
+            {
+                fileName = argv[i];
+            }
+            else
+            {
+                usage();
+                return 1;
+            }
+        }
+
+        std::ifstream file;
+        if (fileName)
+        {
+            file.open(fileName);
+            if (!file.is_open())
+            {
+                std::fprintf(stderr, "Unable to open %s\n", fileName);
+                return 1;
+            }
+        }
+        std::istream &input = fileName ? file : std::cin;
+
+        std::vector<u32> pids;
+        std::vector<std::array<u8, 6>> ivs;
+        std::string line;
+        for (size_t number = 1; std::getline(input, line); number++)
+        {
+            std::istringstream stream(line);
+
+            u32 pid;
+            if (!(stream >> std::hex >> pid))
+            {
+                continue;
+            }
+            pids.emplace_back(pid);
+
+            std::array<u8, 6> iv;
+            int count = 0;
+            for (int value; count < 6 && stream >> std::dec >> value; count++)
+            {
+                iv[count] = static_cast<u8>(value);
+            }
+
+            if (count == 6)
+            {
+                ivs.emplace_back(iv);
+            }
+
+            if ((count != 0 && count != 6) || (!ivs.empty() && ivs.size() != pids.size()))
+            {
+                std::fprintf(stderr, "Line %zu: either every line or no line must list all six IVs\n", number);
+                return 1;
+            }
+        }
+
+        std::printf("PID,Method,Seed,HP,Atk,Def,SpA,SpD,Spe\n");
+        PIDIVCalculator::calculateIVs(pids.data(), ivs.empty() ? nullptr : ivs.data(), pids.size(), wild, std::max(threads, 1),
+                                      [&pids, wild](size_t index, const std::vector<PIDIVState> &states) {
+                                          for (const auto &state : states)
+                                          {
+                                              std::printf("%08X,%s,%08X,%u,%u,%u,%u,%u,%u\n", pids[index],
+                                                          getMethod(state.getMethod(), wild), state.getSeed(), state.getIV(0),
+                                                          state.getIV(1), state.getIV(2), state.getIV(3), state.getIV(4),
+                                                          state.getIV(5));
+                                          }
+                                      });
+
+        return 0;
+    }
+
+    int id3(int argc, char *argv[])
+    {
+        int threads = static_cast<int>(std::thread::hardware_concurrency());
+        const char *game = "";
+        u32 initialAdvances = 0;
+        u32 maxAdvances = 1000;
+        std::vector<u16> tids;
+        std::vector<u16> sids;
+        std::vector<u16> tsvs;
+
+        for (int i = 0; i < argc; i++)
+        {
+            bool value = i + 1 < argc;
+            if (std::strcmp(argv[i], "--game") == 0 && value)
+            {
+                game = argv[++i];
+            }
+            else if (std::strcmp(argv[i], "--threads") == 0 && value)
+            {
+                threads = std::atoi(argv[++i]);
+            }
+            else if (std::strcmp(argv[i], "--initial-advances") == 0 && value)
+            {
+                initialAdvances = static_cast<u32>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (std::strcmp(argv[i], "--max-advances") == 0 && value)
+            {
+                maxAdvances = static_cast<u32>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (std::strcmp(argv[i], "--tid") == 0 && value)
+            {
+                tids.emplace_back(static_cast<u16>(std::atoi(argv[++i])));
+            }
+            else if (std::strcmp(argv[i], "--sid") == 0 && value)
+            {
+                sids.emplace_back(static_cast<u16>(std::atoi(argv[++i])));
+            }
+            else if (std::strcmp(argv[i], "--tsv") == 0 && value)
+            {
+                tsvs.emplace_back(static_cast<u16>(std::atoi(argv[++i])));
+            }
+            else
+            {
+                usage();
+                return 1;
+            }
+        }
+
+        if (std::strcmp(game, "rs") != 0 && std::strcmp(game, "gc") != 0)
+        {
+            usage();
+            return 1;
+        }
+
+        if (std::strcmp(game, "gc") == 0 && tids.empty() && sids.empty() && tsvs.empty())
+        {
+            std::fprintf(stderr, "XD/Colo searches need at least one --tid, --sid or --tsv\n");
+            return 1;
+        }
+
+        IDSearcher3 searcher(tids, sids, tsvs, std::strcmp(game, "rs") == 0 ? Game::RS : Game::GC);
+
+        std::signal(SIGINT, interrupt);
+        std::signal(SIGTERM, interrupt);
+
+        auto print = [&searcher] {
+            for (const auto &state : searcher.getResults())
+            {
+                std::printf("%08X,%u,%u,%u\n", state.getSeed(), state.getAdvances(), state.getTID(), state.getSID());
+            }
+            std::fflush(stdout);
+        };
+
+        std::printf("Seed,Advances,TID,SID\n");
+        auto search = std::async(std::launch::async, [&] { searcher.startSearch(std::max(threads, 1), initialAdvances, maxAdvances); });
+        while (search.wait_for(std::chrono::seconds(1)) != std::future_status::ready)
+        {
+            if (interrupted)
+            {
+                searcher.cancelSearch();
+            }
+            print();
+        }
+        print();
+
+        return 0;
+    }
+
+    int id4(int argc, char *argv[])
+    {
+        bool infinite = false;
+        bool stats = false;
+        u16 year = 2000;
+        u32 minDelay = 0;
+        u32 maxDelay = 0;
+        std::vector<u16> tids;
+        std::vector<u16> sids;
+        std::vector<u16> tsvs;
+        std::string checkpoint;
+        SearchShard shard;
+        bool sharded = false;
+        ResultBudget budget;
+
+        for (int i = 0; i < argc; i++)
+        {
+            bool value = i + 1 < argc;
+            if (std::strcmp(argv[i], "--infinite") == 0)
+            {
+                infinite = true;
+            }
+            else if (std::strcmp(argv[i], "--stats") == 0)
+            {
+                stats = true;
+            }
+            else if (std::strcmp(argv[i], "--year") == 0 && value)
+            {
+                year = static_cast<u16>(std::atoi(argv[++i]));
+            }
+            else if (std::strcmp(argv[i], "--min-delay") == 0 && value)
+            {
+                minDelay = static_cast<u32>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (std::strcmp(argv[i], "--max-delay") == 0 && value)
+            {
+                maxDelay = static_cast<u32>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (std::strcmp(argv[i], "--tid") == 0 && value)
+            {
+                tids.emplace_back(static_cast<u16>(std::atoi(argv[++i])));
+            }
+            else if (std::strcmp(argv[i], "--sid") == 0 && value)
+            {
+                sids.emplace_back(static_cast<u16>(std::atoi(argv[++i])));
+            }
+            else if (std::strcmp(argv[i], "--tsv") == 0 && value)
+            {
+                tsvs.emplace_back(static_cast<u16>(std::atoi(argv[++i])));
+            }
+            else if (std::strcmp(argv[i], "--checkpoint") == 0 && value)
+            {
+                checkpoint = argv[++i];
+            }
+            else if (std::strcmp(argv[i], "--shard") == 0 && value)
+            {
+                if (!parseShard(argv[++i], shard))
+                {
+                    return 1;
+                }
+                sharded = true;
+            }
+            else if (std::strcmp(argv[i], "--budget") == 0 && value)
+            {
+                budget.maxResults = static_cast<size_t>(std::strtoull(argv[++i], nullptr, 10));
+            }
+            else if (std::strcmp(argv[i], "--policy") == 0 && value)
+            {
+                if (!parsePolicy(argv[++i], budget.policy))
+                {
+                    return 1;
+                }
+            }
+            else if (std::strcmp(argv[i], "--spill-file") == 0 && value)
+            {
+                budget.spillFile = argv[++i];
+            }
+            else
+            {
+                usage();
+                return 1;
+            }
+        }
+
+        if (!infinite && maxDelay < minDelay)
+        {
+            std::fprintf(stderr, "--max-delay must not be less than --min-delay\n");
+            return 1;
+        }
+
+        IDSearcher4 searcher(IDFilter(tids, sids, tsvs));
+        searcher.setCheckpoint(checkpoint);
+        searcher.setShard(shard);
+        searcher.setResultBudget(budget);
+
+        // Stop cleanly on an interrupt so the checkpoint is written out
+        std::signal(SIGINT, interrupt);
+        std::signal(SIGTERM, interrupt);
+
+        // Each call returns at most one page of the budget, an empty page means nothing is pending
+        auto print = [&searcher] {
+            for (auto states = searcher.getResults(); !states.empty(); states = searcher.getResults())
+            {
+                for (const auto &state : states)
+                {
+                    std::printf("%08X,%u,%u,%u\n", state.getSeed(), state.getDelay(), state.getTID(), state.getSID());
+                }
+            }
+            std::fflush(stdout);
+        };
+
+        if (sharded)
+        {
+            printShard(shard, false, getJob("id4", argc, argv));
+        }
+
+        std::printf("Seed,Delay,TID,SID\n");
+        auto search = std::async(std::launch::async, [&] { searcher.startSearch(infinite, year, minDelay, maxDelay); });
+        while (search.wait_for(std::chrono::seconds(1)) != std::future_status::ready)
+        {
+            if (interrupted)
+            {
+                searcher.cancelSearch();
+            }
+
+            if (stats)
+            {
+                std::fprintf(stderr, "%s\n", searcher.getStats().toJSON().c_str());
+            }
+            print();
+        }
+        print();
+
+        if (stats)
+        {
+            std::fprintf(stderr, "%s\n", searcher.getStats().toJSON().c_str());
+        }
+
+        if (searcher.getDropped() != 0)
+        {
+            std::fprintf(stderr, "%llu results were dropped by the budget\n", static_cast<unsigned long long>(searcher.getDropped()));
+        }
+
+        return 0;
+    }
+
+    bool parseDate(const char *text, Date &date)
+    {
+        int year;
+        int month;
+        int day;
+        char extra;
+        if (std::sscanf(text, "%d-%d-%d%c", &year, &month, &day, &extra) != 3 || year < 2000 || year > 2099 || month < 1 || month > 12
+            || day < 1 || day > Date::daysInMonth(month, year))
+        {
+            std::fprintf(stderr, "Invalid date %s, expected YYYY-MM-DD between 2000 and 2099\n", text);
+            return false;
+        }
+
+        date = Date(year, month, day);
+        return true;
+    }
+
+    int id5(int argc, char *argv[])
+    {
+        int threads = static_cast<int>(std::thread::hardware_concurrency());
+        bool stats = false;
+        Game version = Game::Blank;
+        u64 mac = 0x9BF123456;
+        u16 timer0Min = 0x621;
+        u16 timer0Max = 0;
+        u8 vcount = 0x2f;
+        u8 gxstat = 6;
+        u8 vframe = 5;
+        DSType dsType = DSType::DSOriginal;
+        Language language = Language::English;
+        std::vector<bool> keypresses = { true, false, false, false };
+        bool skipLR = false;
+        bool softReset = false;
+        bool memoryLink = false;
+        u32 maxAdvances = 1000;
+        std::vector<u16> tids;
+        std::vector<u16> sids;
+        std::vector<u16> tsvs;
+        Date start;
+        Date end;
+        bool dates = false;
+        std::string databaseFile;
+
+        for (int i = 0; i < argc; i++)
+        {
+            bool value = i + 1 < argc;
+            if (std::strcmp(argv[i], "--game") == 0 && value)
+            {
+                constexpr std::pair<const char *, Game> games[]
+                    = { { "b", Game::Black }, { "w", Game::White }, { "b2", Game::Black2 }, { "w2", Game::White2 } };
+                auto it = std::find_if(std::begin(games), std::end(games),
+                                       [text = argv[++i]](const auto &game) { return std::strcmp(game.first, text) == 0; });
+                version = it == std::end(games) ? Game::Blank : it->second;
+            }
+            else if ((std::strcmp(argv[i], "--start") == 0 || std::strcmp(argv[i], "--end") == 0) && value)
+            {
+                if (!parseDate(argv[i + 1], argv[i][2] == 's' ? start : end))
+                {
+                    return 1;
+                }
+                dates = true;
+                i++;
+            }
+            else if (std::strcmp(argv[i], "--mac") == 0 && value)
+            {
+                mac = std::strtoull(argv[++i], nullptr, 16);
+            }
+            else if (std::strcmp(argv[i], "--timer0-min") == 0 && value)
+            {
+                timer0Min = static_cast<u16>(std::strtoul(argv[++i], nullptr, 16));
+            }
+            else if (std::strcmp(argv[i], "--timer0-max") == 0 && value)
+            {
+                timer0Max = static_cast<u16>(std::strtoul(argv[++i], nullptr, 16));
+            }
+            else if (std::strcmp(argv[i], "--vcount") == 0 && value)
+            {
+                vcount = static_cast<u8>(std::strtoul(argv[++i], nullptr, 16));
+            }
+            else if (std::strcmp(argv[i], "--gxstat") == 0 && value)
+            {
+                gxstat = static_cast<u8>(std::atoi(argv[++i]));
+            }
+            else if (std::strcmp(argv[i], "--vframe") == 0 && value)
+            {
+                vframe = static_cast<u8>(std::atoi(argv[++i]));
+            }
+            else if (std::strcmp(argv[i], "--ds-type") == 0 && value)
+            {
+                const char *type = argv[++i];
+                dsType = std::strcmp(type, "dsi") == 0 ? DSType::DSi : std::strcmp(type, "3ds") == 0 ? DSType::DS3 : DSType::DSOriginal;
+            }
+            else if (std::strcmp(argv[i], "--language") == 0 && value)
+            {
+                constexpr const char *languages[] = { "en", "fr", "de", "it", "jp", "kr", "es" };
+                auto it = std::find_if(std::begin(languages), std::end(languages),
+                                       [text = argv[++i]](const char *code) { return std::strcmp(code, text) == 0; });
+                if (it == std::end(languages))
+                {
+                    usage();
+                    return 1;
+                }
+                language = static_cast<Language>(it - std::begin(languages));
+            }
+            else if (std::strcmp(argv[i], "--keypresses") == 0 && value)
+            {
+                keypresses = { false, false, false, false };
+                for (const char *count = argv[++i]; *count; count++)
+                {
+                    if (*count < '0' || *count > '3')
+                    {
+                        usage();
+                        return 1;
+                    }
+                    keypresses[*count - '0'] = true;
+                }
+            }
+            else if (std::strcmp(argv[i], "--skip-lr") == 0)
+            {
+                skipLR = true;
+            }
+            else if (std::strcmp(argv[i], "--soft-reset") == 0)
+            {
+                softReset = true;
+            }
+            else if (std::strcmp(argv[i], "--memory-link") == 0)
+            {
+                memoryLink = true;
+            }
+            else if (std::strcmp(argv[i], "--max-advances") == 0 && value)
+            {
+                maxAdvances = static_cast<u32>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (std::strcmp(argv[i], "--tid") == 0 && value)
+            {
+                tids.emplace_back(static_cast<u16>(std::atoi(argv[++i])));
+            }
+            else if (std::strcmp(argv[i], "--sid") == 0 && value)
+            {
+                sids.emplace_back(static_cast<u16>(std::atoi(argv[++i])));
+            }
+            else if (std::strcmp(argv[i], "--tsv") == 0 && value)
+            {
+                tsvs.emplace_back(static_cast<u16>(std::atoi(argv[++i])));
+            }
+            else if (std::strcmp(argv[i], "--threads") == 0 && value)
+            {
+                threads = std::atoi(argv[++i]);
+            }
+            else if (std::strcmp(argv[i], "--database") == 0 && value)
+            {
+                databaseFile = argv[++i];
+            }
+            else if (std::strcmp(argv[i], "--stats") == 0)
+            {
+                stats = true;
+            }
+            else
+            {
+                usage();
+                return 1;
+            }
+        }
+
+        if (version == Game::Blank || !dates || end < start)
+        {
+            usage();
+            return 1;
+        }
+
+        Profile5 profile("CLI", version, 0, 0, mac, keypresses, vcount, gxstat, vframe, skipLR, timer0Min, std::max(timer0Min, timer0Max),
+                         softReset, memoryLink, false, dsType, language);
+
+        // Only the seeds missing from the database are hashed, the search then reads every seed back from it
+        SeedDatabase5 database(databaseFile);
+        if (!databaseFile.empty() && !database.extend(profile, start, end))
+        {
+            std::fprintf(stderr, "Unable to extend %s, it must be a seed database made with the same profile\n", databaseFile.c_str());
+            return 1;
+        }
+
+        IDSearcher5 searcher(profile, 0, false, false);
+        searcher.setSeedDatabase(databaseFile.empty() ? nullptr : &database);
+
+        std::signal(SIGINT, interrupt);
+        std::signal(SIGTERM, interrupt);
+
+        auto print = [&searcher] {
+            for (const auto &state : searcher.getResults())
+            {
+                std::printf("%016llX,%s,%s,%u,%u,%u,%u\n", static_cast<unsigned long long>(state.getSeed()),
+                            state.getDateTime().toString().c_str(), Translator::getKeypresses(state.getKeypress()).c_str(),
+                            state.getInitialAdvances(), state.getAdvances(), state.getTID(), state.getSID());
+            }
+            std::fflush(stdout);
+        };
+
+        std::printf("Seed,Date/Time,Buttons,Initial Advances,Advances,TID,SID\n");
+        IDGenerator5 generator(0, maxAdvances, IDFilter(tids, sids, tsvs));
+        auto search = std::async(std::launch::async, [&] { searcher.startSearch(generator, std::max(threads, 1), start, end); });
+        while (search.wait_for(std::chrono::seconds(1)) != std::future_status::ready)
+        {
+            if (interrupted)
+            {
+                searcher.cancelSearch();
+            }
+
+            if (stats)
+            {
+                std::fprintf(stderr, "%s\n", searcher.getStats().toJSON().c_str());
+            }
+            print();
+        }
+        print();
+
+        if (stats)
+        {
+            std::fprintf(stderr, "%s\n", searcher.getStats().toJSON().c_str());
+        }
+
+        return 0;
+    }
+
+    int channel(int argc, char *argv[])
+    {
+        int threads = static_cast<int>(std::thread::hardware_concurrency());
+        std::vector<u32> criteria;
+        std::string checkpoint;
+        SearchShard shard;
+        bool sharded = false;
+
+        for (int i = 0; i < argc; i++)
+        {
+            bool value = i + 1 < argc;
+            if (std::strcmp(argv[i], "--threads") == 0 && value)
+            {
+                threads = std::atoi(argv[++i]);
+            }
+            else if (std::strcmp(argv[i], "--checkpoint") == 0 && value)
+            {
+                checkpoint = argv[++i];
+            }
+            else if (std::strcmp(argv[i], "--shard") == 0 && value)
+            {
+                if (!parseShard(argv[++i], shard))
+                {
+                    return 1;
+                }
+                sharded = true;
+            }
+            else if (argv[i][0] != '-')
+            {
+                criteria.emplace_back(static_cast<u32>(std::strtoul(argv[i], nullptr, 10)));
+            }
+            else
+            {
+                usage();
+                return 1;
+            }
+        }
+
+        if (criteria.empty())
+        {
+            usage();
+            return 1;
+        }
+
+        ChannelSeedSearcher searcher(criteria);
+        searcher.setCheckpoint(checkpoint);
+        searcher.setShard(shard);
+
+        std::signal(SIGINT, interrupt);
+        std::signal(SIGTERM, interrupt);
+
+        auto search = std::async(std::launch::async, [&] { searcher.startSearch(std::max(threads, 1)); });
+        while (search.wait_for(std::chrono::seconds(1)) != std::future_status::ready)
+        {
+            if (interrupted)
+            {
+                searcher.cancelSearch();
+            }
+        }
+
+        if (sharded)
+        {
+            printShard(shard, true, getJob("channel", argc, argv));
+        }
+
+        std::printf("Seed\n");
+        for (u32 seed : searcher.getResults())
+        {
+            std::printf("%08X\n", seed);
+        }
+
+        return 0;
+    }
+
+    int merge(int argc, char *argv[])
+    {
+        if (argc == 0)
+        {
+            usage();
+            return 1;
+        }
+
+        std::vector<const char *> files;
+        std::string job;
+        std::string header;
+
+        for (int i = 0; i < argc; i++)
+        {
+            std::ifstream file(argv[i]);
+            if (!file.is_open())
+            {
+                std::fprintf(stderr, "Unable to open %s\n", argv[i]);
+                return 1;
+            }
+
+            std::string shardLine;
+            std::string headerLine;
+            std::getline(file, shardLine);
+            std::getline(file, headerLine);
+
+            unsigned int index;
+            unsigned int count;
+            int length = 0;
+            if (std::sscanf(shardLine.c_str(), "# shard %u/%u %n", &index, &count, &length) != 2 || length == 0 || index >= count)
+            {
+                std::fprintf(stderr, "%s is not a shard result file\n", argv[i]);
+                return 1;
+            }
+
+            if (files.empty())
+            {
+                files.resize(count);
+                job = shardLine.substr(length);
+                header = headerLine;
+            }
+            else if (count != files.size() || shardLine.substr(length) != job || headerLine != header)
+            {
+                std::fprintf(stderr, "%s is a shard of a different search\n", argv[i]);
+                return 1;
+            }
+
+            if (files[index])
+            {
+                std::fprintf(stderr, "%s and %s are both shard %u\n", files[index], argv[i], index);
+                return 1;
+            }
+            files[index] = argv[i];
+        }
+
+        auto missing = std::find(files.begin(), files.end(), nullptr);
+        if (missing != files.end())
+        {
+            std::fprintf(stderr, "Shard %zu of %zu is missing\n", static_cast<size_t>(missing - files.begin()), files.size());
+            return 1;
+        }
+
+        bool sorted = job.compare(0, 7, "sorted ") == 0;
+        std::vector<std::string> rows;
+
+        std::printf("%s\n", header.c_str());
+        for (const char *name : files)
+        {
+            std::ifstream file(name);
+            std::string line;
+            std::getline(file, line);
+            std::getline(file, line);
+            while (std::getline(file, line))
+            {
+                if (sorted)
+                {
+                    rows.emplace_back(line);
+                }
+                else
+                {
+                    std::printf("%s\n", line.c_str());
+                }
+            }
+        }
+
+        std::sort(rows.begin(), rows.end());
+        rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+        for (const auto &row : rows)
+        {
+            std::printf("%s\n", row.c_str());
+        }
+
+        return 0;
+    }
+
+    int index4(int argc, char *argv[])
+    {
+        u32 minDelay = 0;
+        u32 maxDelay = 0;
+        u32 maxAdvance = 0;
+        const char *fileName = nullptr;
+
+        for (int i = 0; i < argc; i++)
+        {
+            bool value = i + 1 < argc;
+            if (std::strcmp(argv[i], "--min-delay") == 0 && value)
+            {
+                minDelay = static_cast<u32>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (std::strcmp(argv[i], "--max-delay") == 0 && value)
+            {
+                maxDelay = static_cast<u32>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (std::strcmp(argv[i], "--max-advance") == 0 && value)
+            {
+                maxAdvance = static_cast<u32>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (!fileName && argv[i][0] != '-')
+            {
+                fileName = argv[i];
+            }
+            else
+            {
+                usage();
+                return 1;
+            }
+        }
+
+        if (!fileName)
+        {
+            usage();
+            return 1;
+        }
+
+        if (!SpreadIndex4::build(fileName, minDelay, maxDelay, maxAdvance))
+        {
+            std::fprintf(stderr, "Unable to write %s, the range must be valid and hold fewer than 2^32 spreads\n", fileName);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    bool parseIVs(const char *text, std::array<u8, 6> &ivs)
+    {
+        unsigned int values[6];
+        char extra;
+        if (std::sscanf(text, "%u/%u/%u/%u/%u/%u%c", &values[0], &values[1], &values[2], &values[3], &values[4], &values[5], &extra) != 6
+            || std::any_of(std::begin(values), std::end(values), [](unsigned int iv) { return iv > 31; }))
+        {
+            std::fprintf(stderr, "Invalid IVs %s, expected six values from 0 to 31 separated by /\n", text);
+            return false;
+        }
+
+        std::copy(std::begin(values), std::end(values), ivs.begin());
+        return true;
+    }
+
+    int stationary4(int argc, char *argv[])
+    {
+        u32 minDelay = 0;
+        u32 maxDelay = 0;
+        u32 minAdvance = 0;
+        u32 maxAdvance = 0;
+        std::array<u8, 6> min = { 0, 0, 0, 0, 0, 0 };
+        std::array<u8, 6> max = { 31, 31, 31, 31, 31, 31 };
+        std::vector<bool> natures(25, false);
+        bool anyNature = true;
+        u16 tid = 0;
+        u16 sid = 0;
+        Method method = Method::Method1;
+        const char *indexFile = nullptr;
+
+        for (int i = 0; i < argc; i++)
+        {
+            bool value = i + 1 < argc;
+            if (std::strcmp(argv[i], "--min-delay") == 0 && value)
+            {
+                minDelay = static_cast<u32>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (std::strcmp(argv[i], "--max-delay") == 0 && value)
+            {
+                maxDelay = static_cast<u32>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (std::strcmp(argv[i], "--min-advance") == 0 && value)
+            {
+                minAdvance = static_cast<u32>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (std::strcmp(argv[i], "--max-advance") == 0 && value)
+            {
+                maxAdvance = static_cast<u32>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if ((std::strcmp(argv[i], "--min-ivs") == 0 || std::strcmp(argv[i], "--max-ivs") == 0) && value)
+            {
+                if (!parseIVs(argv[i + 1], argv[i][3] == 'i' ? min : max))
+                {
+                    return 1;
+                }
+                i++;
+            }
+            else if (std::strcmp(argv[i], "--nature") == 0 && value)
+            {
+                int nature = std::atoi(argv[++i]);
+                if (nature < 0 || nature >= 25)
+                {
+                    usage();
+                    return 1;
+                }
+                natures[nature] = true;
+                anyNature = false;
+            }
+            else if (std::strcmp(argv[i], "--tid") == 0 && value)
+            {
+                tid = static_cast<u16>(std::atoi(argv[++i]));
+            }
+            else if (std::strcmp(argv[i], "--sid") == 0 && value)
+            {
+                sid = static_cast<u16>(std::atoi(argv[++i]));
+            }
+            else if (std::strcmp(argv[i], "--method") == 0 && value)
+            {
+                const char *name = argv[++i];
+                if (std::strcmp(name, "1") == 0)
+                {
+                    method = Method::Method1;
+                }
+                else if (std::strcmp(name, "j") == 0)
+                {
+                    method = Method::MethodJ;
+                }
+                else if (std::strcmp(name, "k") == 0)
+                {
+                    method = Method::MethodK;
+                }
+                else
+                {
+                    usage();
+                    return 1;
+                }
+            }
+            else if (std::strcmp(argv[i], "--index") == 0 && value)
+            {
+                indexFile = argv[++i];
+            }
+            else
+            {
+                usage();
+                return 1;
+            }
+        }
+
+        if (maxDelay < minDelay || maxAdvance < minAdvance)
+        {
+            std::fprintf(stderr, "The maximum delay and advance must not be less than the minimum\n");
+            return 1;
+        }
+
+        if (anyNature)
+        {
+            natures.assign(25, true);
+        }
+
+        std::unique_ptr<SpreadIndex4> index;
+        if (indexFile)
+        {
+            index = std::make_unique<SpreadIndex4>(indexFile);
+            if (!index->isOpen())
+            {
+                std::fprintf(stderr, "Unable to open %s, it must be written by index4\n", indexFile);
+                return 1;
+            }
+
+            if (method == Method::Method1 && !index->covers(minDelay, maxDelay, maxAdvance))
+            {
+                std::fprintf(stderr, "%s does not cover the search, searching without it\n", indexFile);
+            }
+        }
+
+        StateFilter filter(255, 255, 255, false, min, max, natures, std::vector<bool>(16, true), {});
+        StationarySearcher4 searcher(tid, sid, 255, method, filter);
+        searcher.setDelay(minDelay, maxDelay);
+        searcher.setState(minAdvance, maxAdvance);
+        searcher.setLead(Lead::None);
+        searcher.setSpreadIndex(index.get());
+
+        std::signal(SIGINT, interrupt);
+        std::signal(SIGTERM, interrupt);
+
+        auto print = [&searcher] {
+            for (auto states = searcher.getResults(); !states.empty(); states = searcher.getResults())
+            {
+                for (const auto &state : states)
+                {
+                    std::printf("%08X,%u,%08X,%u,%u,%u,%u,%u,%u,%u,%u\n", state.getSeed(), state.getAdvances(), state.getPID(),
+                                state.getNature(), state.getShiny(), state.getIV(0), state.getIV(1), state.getIV(2), state.getIV(3),
+                                state.getIV(4), state.getIV(5));
+                }
+            }
+            std::fflush(stdout);
+        };
+
+        std::printf("Seed,Advances,PID,Nature,Shiny,HP,Atk,Def,SpA,SpD,Spe\n");
+        auto search = std::async(std::launch::async, [&] { searcher.startSearch(min, max); });
+        while (search.wait_for(std::chrono::seconds(1)) != std::future_status::ready)
+        {
+            if (interrupted)
+            {
+                searcher.cancelSearch();
+            }
+            print();
+        }
+        print();
+
+        return 0;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc >= 2 && std::strcmp(argv[1], "pidiv") == 0)
+    {
+        return pidiv(argc - 2, argv + 2);
+    }
+
+    if (argc >= 2 && std::strcmp(argv[1], "id3") == 0)
+    {
+        return id3(argc - 2, argv + 2);
+    }
+
+    if (argc >= 2 && std::strcmp(argv[1], "id4") == 0)
+    {
+        return id4(argc - 2, argv + 2);
+    }
+
+    if (argc >= 2 && std::strcmp(argv[1], "id5") == 0)
+    {
+        return id5(argc - 2, argv + 2);
+    }
+
+    if (argc >= 2 && std::strcmp(argv[1], "channel") == 0)
+    {
+        return channel(argc - 2, argv + 2);
+    }
+
+    if (argc >= 2 && std::strcmp(argv[1], "merge") == 0)
+    {
+        return merge(argc - 2, argv + 2);
+    }
+
+    if (argc >= 2 && std::strcmp(argv[1], "index4") == 0)
+    {
+        return index4(argc - 2, argv + 2);
+    }
+
+    if (argc >= 2 && std::strcmp(argv[1], "stationary4") == 0)
+    {
+        return stationary4(argc - 2, argv + 2);
+    }
+
+    usage();
+    return 1;
+}
@@ -22,104 +22,82 @@
 #include <Core/Enum/Game.hpp>
 #include <Core/Gen3/EncounterArea3.hpp>
 #include <Core/Gen3/Profile3.hpp>
+#include <Core/Parents/EncounterTable.hpp>
 #include <Core/Parents/PersonalLoader.hpp>
 #include <Core/Parents/Slot.hpp>
 #include <Core/Resources/Resources.hpp>
 #include <algorithm>
-#include <array>
-#include <cstring>
 #include <iterator>
+#include <mutex>
+#include <unordered_map>
 
 namespace Encounters3
 {
     namespace
     {
-        std::vector<std::array<u8, 120>> getData(Game game)
+        EncounterTable getTable(Game game)
         {
-            const u8 *data;
-            size_t size;
-
             if (game == Game::Emerald)
             {
-                data = emerald.data();
-                size = emerald.size();
+                return EncounterTable(emerald, 120);
             }
             else if (game == Game::FireRed)
             {
-                data = firered.data();
-                size = firered.size();
+                return EncounterTable(firered, 120);
             }
             else if (game == Game::LeafGreen)
             {
-                data = leafgreen.data();
-                size = leafgreen.size();
+                return EncounterTable(leafgreen, 120);
             }
             else if (game == Game::Ruby)
             {
-                data = ruby.data();
-                size = ruby.size();
+                return EncounterTable(ruby, 120);
             }
             else
             {
-                data = sapphire.data();
-                size = sapphire.size();
-            }
-
-            std::vector<std::array<u8, 120>> encounters;
-            for (size_t i = 0; i < size; i += 120)
-            {
-                std::array<u8, 120> entry;
-                std::memcpy(entry.data(), data + i, 120);
-                encounters.emplace_back(entry);
+                return EncounterTable(sapphire, 120);
             }
-
-            return encounters;
-        }
-
-        u16 getValue(const std::array<u8, 120> &data, int offset)
-        {
-            return static_cast<u16>(data[offset] << 8) | data[offset + 1];
         }
 
-        std::vector<EncounterArea3> getArea(const std::array<u8, 120> &data, const PersonalInfo *info)
+        std::vector<EncounterArea3> getArea(const EncounterEntry &data, const PersonalInfo *info)
         {
             std::vector<EncounterArea3> encounters;
 
-            u8 location = data[0];
+            u8 location = data.getByte(0);
 
-            if (data[1] == 1 || data[1] == 2)
+            if (data.getByte(1) == 1 || data.getByte(1) == 2)
             {
                 std::vector<Slot> grass;
                 for (u8 i = 0; i < 12; i++)
                 {
-                    u8 level = data[4 + i * 3];
-                    u16 specie = getValue(data, 5 + i * 3);
+                    u8 level = data.getByte(4 + i * 3);
+                    u16 specie = data.getBigEndian(5 + i * 3);
                     grass.emplace_back(specie, level, info[specie]);
                 }
 
-                u8 val = data[1];
+                u8 val = data.getByte(1);
                 encounters.emplace_back(location, val == 1 ? Encounter::Grass : Encounter::SafariZone, grass);
             }
-            if (data[2] == 1)
+            if (data.getByte(2) == 1)
             {
                 std::vector<Slot> rock;
                 for (u8 i = 0; i < 5; i++)
                 {
-                    u8 minLevel = data[40 + i * 4];
-                    u8 maxLevel = data[41 + i * 4];
-                    u16 specie = getValue(data, 42 + i * 4);
+                    u8 minLevel = data.getByte(40 + i * 4);
+                    u8 maxLevel = data.getByte(41 + i * 4);
+                    u16 specie = data.getBigEndian(42 + i * 4);
                     rock.emplace_back(specie, minLevel, maxLevel, info[specie]);
                 }
                 encounters.emplace_back(location, Encounter::RockSmash, rock);
             }
-            if (data[3] == 1)
+            if (data.getByte(3) == 1)
             {
                 std::vector<Slot> surf;
                 for (u8 i = 0; i < 5; i++)
                 {
-                    u8 minLevel = data[60 + i * 4];
-                    u8 maxLevel = data[61 + i * 4];
-                    u16 specie = getValue(data, 62 + i * 4);
+                    u8 minLevel = data.getByte(60 + i * 4);
+                    u8 maxLevel = data.getByte(61 + i * 4);
+                    u16 specie = data.getBigEndian(62 + i * 4);
                     surf.emplace_back(specie, minLevel, maxLevel, info[specie]);
                 }
                 encounters.emplace_back(location, Encounter::Surfing, surf);
@@ -127,9 +105,9 @@ namespace Encounters3
                 std::vector<Slot> old;
                 for (u8 i = 0; i < 2; i++)
                 {
-                    u8 minLevel = data[80 + i * 4];
-                    u8 maxLevel = data[81 + i * 4];
-                    u16 specie = getValue(data, 82 + i * 4);
+                    u8 minLevel = data.getByte(80 + i * 4);
+                    u8 maxLevel = data.getByte(81 + i * 4);
+                    u16 specie = data.getBigEndian(82 + i * 4);
                     old.emplace_back(specie, minLevel, maxLevel, info[specie]);
                 }
                 encounters.emplace_back(location, Encounter::OldRod, old);
@@ -137,9 +115,9 @@ namespace Encounters3
                 std::vector<Slot> good;
                 for (u8 i = 0; i < 3; i++)
                 {
-                    u8 minLevel = data[88 + i * 4];
-                    u8 maxLevel = data[89 + i * 4];
-                    u16 specie = getValue(data, 90 + i * 4);
+                    u8 minLevel = data.getByte(88 + i * 4);
+                    u8 maxLevel = data.getByte(89 + i * 4);
+                    u16 specie = data.getBigEndian(90 + i * 4);
                     good.emplace_back(specie, minLevel, maxLevel, info[specie]);
                 }
                 encounters.emplace_back(location, Encounter::GoodRod, good);
@@ -147,9 +125,9 @@ namespace Encounters3
                 std::vector<Slot> super;
                 for (u8 i = 0; i < 5; i++)
                 {
-                    u8 minLevel = data[100 + i * 4];
-                    u8 maxLevel = data[101 + i * 4];
-                    u16 specie = getValue(data, 102 + i * 4);
+                    u8 minLevel = data.getByte(100 + i * 4);
+                    u8 maxLevel = data.getByte(101 + i * 4);
+                    u16 specie = data.getBigEndian(102 + i * 4);
                     super.emplace_back(specie, minLevel, maxLevel, info[specie]);
                 }
                 encounters.emplace_back(location, Encounter::SuperRod, super);
@@ -158,18 +136,32 @@ namespace Encounters3
         }
     }
 
-    std::vector<EncounterArea3> getEncounters(Encounter encounter, const Profile3 &profile)
+    const std::vector<EncounterArea3> &getEncounters(Encounter encounter, const Profile3 &profile)
     {
+        static std::unordered_map<u32, std::vector<EncounterArea3>> cache;
+        static std::mutex mutex;
+
+        Game version = profile.getVersion();
+        u32 key = static_cast<u32>(version) | (static_cast<u32>(encounter) << 16);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = cache.find(key);
+        if (it != cache.end())
+        {
+            return it->second;
+        }
+
         std::vector<EncounterArea3> encounters;
         const auto *info = PersonalLoader3::getPersonal();
 
-        for (const auto &data : getData(profile.getVersion()))
+        EncounterTable table = getTable(version);
+        for (size_t i = 0; i < table.size(); i++)
         {
-            auto areas = getArea(data, info);
+            auto areas = getArea(table[i], info);
             std::copy_if(areas.begin(), areas.end(), std::back_inserter(encounters),
                          [&encounter](const EncounterArea3 &area) { return area.getEncounter() == encounter; });
         }
 
-        return encounters;
+        return cache.emplace(key, std::move(encounters)).first->second;
     }
 }
@@ -29,7 +29,7 @@ class Profile3;
 
 namespace Encounters3
 {
-    std::vector<EncounterArea3> getEncounters(Encounter encounter, const Profile3 &profile);
+    const std::vector<EncounterArea3> &getEncounters(Encounter encounter, const Profile3 &profile);
 };
 
 #endif // ENCOUNTERS3_HPP
@@ -23,6 +23,7 @@
 #include <Core/Parents/Filters/StateFilter.hpp>
 #include <Core/RNG/LCRNG.hpp>
 #include <algorithm>
+#include <array>
 
 template <bool broken>
 void setInheritance(const Daycare &daycare, EggState3 &state, const u16 *inh, const u16 *par)
@@ -225,66 +226,111 @@ std::vector<EggState3> EggGenerator3::generateEmeraldPID() const
         }
     }
 
+    if (minRedraw > maxRedraw)
+    {
+        return states;
+    }
+
+    // VBlank at 17 from starting PID generation, a nature found on the last attempt is skipped since the spread is unlikely
+    // to occur. That leaves at most 18 calls per frame: compatibility, everstone and 16 PID attempts.
+    constexpr u8 attempts = 16;
+
+    // The calls after a frame are the same for every redraw, keep the next ones in a ring that moves one call per frame
+    constexpr u32 ringSize = 32;
+    std::array<u16, ringSize> ring;
+
     PokeRNG rng(0);
     rng.advance(initialAdvances);
+    for (u32 i = 0; i < 18; i++)
+    {
+        ring[i] = rng.nextUShort();
+    }
+
+    // The upper PID half comes from a 16 bit seed that moves by 1 each frame and by 3 each redraw, so the same seeds
+    // repeat across frames and redraws. Compute the calls of every seed in range once, along with their part of the
+    // nature so the everstone attempts only compare it against what the lower half of the frame needs.
+    u32 trngCalls = everstone ? attempts : 1;
+    u32 trngFirst = (initialAdvances + 1 - calibration - 3 * maxRedraw) & 0xffff;
+    u32 trngCount = std::min<u64>(0x10000, static_cast<u64>(maxAdvances) + 3 * (maxRedraw - minRedraw) + 1);
+    std::vector<u16> trngTable(trngCount * trngCalls);
+    std::vector<u8> trngNatures(everstone ? trngCount * trngCalls : 0);
+    for (u32 i = 0; i < trngCount; i++)
+    {
+        PokeRNG trng((trngFirst + i) & 0xffff);
+        for (u32 j = 0; j < trngCalls; j++)
+        {
+            u16 high = trng.nextUShort();
+            trngTable[i * trngCalls + j] = high;
+            if (everstone)
+            {
+                trngNatures[i * trngCalls + j] = (static_cast<u32>(high) << 16) % 25;
+            }
+        }
+    }
+
+    u8 nature = everstone ? daycare.getParentNature(parent) : 0;
+    std::array<u8, attempts> highNeeded {};
 
     u32 val = initialAdvances + 1;
-    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, val++, rng.next())
+    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, val++, ring[(cnt + 17) % ringSize] = rng.nextUShort())
     {
-        PokeRNG comp(rng.getSeed());
-        if (((comp.nextUShort() * 100) / 0xFFFF) < compatability)
+        if (((ring[cnt % ringSize] * 100) / 0xFFFF) >= compatability)
         {
-            for (u16 redraw = minRedraw; redraw <= maxRedraw; redraw++)
+            continue;
+        }
+
+        if (everstone)
+        {
+            for (u8 i = 0; i < attempts; i++)
             {
-                PokeRNG go(comp.getSeed());
+                highNeeded[i] = (nature + 25 - ring[(cnt + 2 + i) % ringSize] % 25) % 25;
+            }
+        }
 
-                u16 offset = calibration + 3 * redraw;
-                EggState3 state(cnt + initialAdvances - offset);
+        for (u16 redraw = minRedraw; redraw <= maxRedraw; redraw++)
+        {
+            u16 offset = calibration + 3 * redraw;
+            EggState3 state(cnt + initialAdvances - offset);
 
-                bool flag = everstone ? (go.nextUShort() >> 15) == 0 : false;
+            bool flag = everstone ? (ring[(cnt + 1) % ringSize] >> 15) == 0 : false;
 
-                PokeRNG trng((val - offset) & 0xFFFF);
+            u32 index = ((val - offset - trngFirst) & 0xffff) * trngCalls;
+            const u16 *trng = &trngTable[index];
 
-                u32 pid = 0;
-                if (!flag)
+            u32 pid = 0;
+            if (!flag)
+            {
+                pid = ((ring[(cnt + 1 + everstone) % ringSize] % 0xFFFE) + 1) | (static_cast<u32>(trng[0]) << 16);
+                state.setNature(pid % 25);
+            }
+            else
+            {
+                const u8 *highNatures = &trngNatures[index];
+
+                u8 i = 0;
+                while (i < attempts && highNatures[i] != highNeeded[i])
                 {
-                    pid = ((go.nextUShort() % 0xFFFE) + 1) | (trng.next() & 0xFFFF0000);
-                    state.setNature(pid % 25);
+                    i++;
                 }
-                else
+
+                if (i == attempts)
                 {
-                    u8 i = 2;
-                    do
-                    {
-                        // VBlank at 17 from starting PID generation
-                        // Adjusted i value is 19
-                        // Skip at this point since spread is unlikely to occur
-                        if (i == 19)
-                        {
-                            break;
-                        }
-
-                        pid = go.nextUShort() | (trng.next() & 0xFFFF0000);
-                        i++;
-                    } while (pid % 25 != daycare.getParentNature(parent));
-
-                    if (i == 19)
-                    {
-                        continue;
-                    }
-                    state.setNature(daycare.getParentNature(parent));
+                    continue;
                 }
 
-                state.setPID(pid);
-                state.setAbility(pid & 1);
-                state.setGender(pid & 255, genderRatio);
-                state.setShiny<8>(tsv, (pid >> 16) ^ (pid & 0xffff));
+                pid = ring[(cnt + 2 + i) % ringSize] | (static_cast<u32>(trng[i]) << 16);
+                state.setNature(nature);
+            }
 
-                if (filter.comparePID(state))
-                {
-                    state.setRedraw(redraw);
-                    states.emplace_back(state);
-                }
+            state.setPID(pid);
+            state.setAbility(pid & 1);
+            state.setGender(pid & 255, genderRatio);
+            state.setShiny<8>(tsv, (pid >> 16) ^ (pid & 0xffff));
+
+            if (filter.comparePID(state))
+            {
+                state.setRedraw(redraw);
+                states.emplace_back(state);
             }
         }
     }
@@ -326,7 +372,6 @@ std::vector<EggState3> EggGenerator3::generateEmeraldIVs() const
         u16 par[3] = { par1, par2, par3 };
 
         setInheritance<true>(daycare, state, inh, par);
-        state.calculateHiddenPower();
 
         if (filter.compareIVs(state))
         {
@@ -392,7 +437,6 @@ std::vector<EggState3> EggGenerator3::generateUpper(u32 seed, const std::vector<
         u16 par[3] = { par1, par2, par3 };
 
         setInheritance<false>(daycare, state, inh, par);
-        state.calculateHiddenPower();
 
         if (filter.compareIVs(state))
         {
@@ -85,7 +85,6 @@ std::vector<GameCubeState> GameCubeGenerator::generateXDColo(u32 seed) const
         state.setShiny<8>(tsv, high ^ low);
 
         state.setIVs(iv1, iv2);
-        state.calculateHiddenPower();
 
         if (filter.compareState(state))
         {
@@ -129,7 +128,6 @@ std::vector<GameCubeState> GameCubeGenerator::generateAgeto(u32 seed) const
         state.setShiny<8>(31121 ^ 00000, high ^ low);
 
         state.setIVs(iv1, iv2);
-        state.calculateHiddenPower();
 
         if (filter.compareState(state))
         {
@@ -173,7 +171,6 @@ std::vector<GameCubeState> GameCubeGenerator::generateAgeto0Difference(u32 seed)
         state.setShiny<8>(31121 ^ 00000, high ^ low);
 
         state.setIVs(iv1, iv2);
-        state.calculateHiddenPower();
 
         if (filter.compareState(state))
         {
@@ -247,7 +244,6 @@ std::vector<GameCubeState> GameCubeGenerator::generateXDShadow(u32 seed) const
         u16 iv1 = go.nextUShort();
         u16 iv2 = go.nextUShort();
         state.setIVs(iv1, iv2);
-        state.calculateHiddenPower();
 
         state.setAbility(go.nextUShort() & 1);
 
@@ -320,7 +316,6 @@ std::vector<GameCubeState> GameCubeGenerator::generateColoShadow(u32 seed) const
         if (team.getType() == ShadowType::EReader)
         {
             state.setIVs(0);
-            state.calculateHiddenPower();
 
             state.setPID(pid);
             state.setAbility(ability);
@@ -335,7 +330,6 @@ std::vector<GameCubeState> GameCubeGenerator::generateColoShadow(u32 seed) const
             u16 iv1 = go.nextUShort();
             u16 iv2 = go.nextUShort();
             state.setIVs(iv1, iv2);
-            state.calculateHiddenPower();
 
             state.setAbility(go.nextUShort() & 1);
 
@@ -405,7 +399,6 @@ std::vector<GameCubeState> GameCubeGenerator::generateChannel(u32 seed) const
         u8 spd = go.nextUShort() >> 11;
 
         state.setIVs(hp, atk, def, spa, spd, spe);
-        state.calculateHiddenPower();
 
         if (filter.compareState(state))
         {
@@ -461,7 +454,6 @@ std::vector<GameCubeState> GameCubeGenerator::generatePossibleChannel(u32 seed)
             u8 spd = go.nextUShort() >> 11;
 
             state.setIVs(hp, atk, def, spa, spd, spe);
-            state.calculateHiddenPower();
 
             if (filter.compareState(state))
             {
@@ -78,7 +78,6 @@ std::vector<State> StationaryGenerator3::generateMethod124(u32 seed) const
         state.setShiny<8>(tsv, high ^ low);
 
         state.setIVs(iv1, iv2);
-        state.calculateHiddenPower();
 
         if (filter.compareState(state))
         {
@@ -115,7 +114,6 @@ std::vector<State> StationaryGenerator3::generateMethod1Reverse(u32 seed) const
         state.setShiny<8>(tsv, high ^ low);
 
         state.setIVs(iv1, iv2);
-        state.calculateHiddenPower();
 
         if (filter.compareState(state))
         {
@@ -153,7 +151,6 @@ std::vector<State> StationaryGenerator3::generateLocked16Bit(u32 seed) const
     state.setShiny<8>(tsv, high ^ low);
 
     state.setIVs(iv1, iv2);
-    state.calculateHiddenPower();
 
     if (filter.compareState(state))
     {
@@ -185,7 +182,6 @@ std::vector<State> StationaryGenerator3::generateWishmaker(u32 seed) const
     state.setShiny<8>(20043, high ^ low);
 
     state.setIVs(iv1, iv2);
-    state.calculateHiddenPower();
 
     if (filter.compareState(state))
     {
@@ -150,7 +150,6 @@ std::vector<UnownState> UnownGenerator3::generate(u32 seed, u8 location) const
             iv2 = go.nextUShort();
         }
         state.setIVs(iv1, iv2);
-        state.calculateHiddenPower();
 
         if (filter.compareState(state) && filter.compareLetter(state))
         {
@@ -26,7 +26,6 @@
 #include <Core/Parents/States/WildState.hpp>
 #include <Core/RNG/LCRNG.hpp>
 #include <Core/Util/EncounterSlot.hpp>
-#include <functional>
 
 WildGenerator3::WildGenerator3(u32 initialAdvances, u32 maxAdvances, u16 tid, u16 sid, u8 genderRatio, Method method,
                                const StateFilter &filter) :
@@ -35,6 +34,76 @@ WildGenerator3::WildGenerator3(u32 initialAdvances, u32 maxAdvances, u16 tid, u1
 }
 
 std::vector<WildState> WildGenerator3::generate(u32 seed, const EncounterArea3 &encounterArea) const
+{
+    Kernel kernel;
+    switch (method)
+    {
+    case Method::MethodH1:
+        kernel = getKernel<Method::MethodH1>(encounter, lead);
+        break;
+    case Method::MethodH2:
+        kernel = getKernel<Method::MethodH2>(encounter, lead);
+        break;
+    default:
+        kernel = getKernel<Method::MethodH4>(encounter, lead);
+        break;
+    }
+
+    return (this->*kernel)(seed, encounterArea);
+}
+
+template <Method methodType>
+WildGenerator3::Kernel WildGenerator3::getKernel(Encounter encounter, Lead lead)
+{
+    // Kernels for each encounter and lead that share a code path
+    static constexpr Kernel kernels[5][3]
+        = { { &WildGenerator3::generateMethodH<methodType, Encounter::RockSmash, Lead::None>,
+              &WildGenerator3::generateMethodH<methodType, Encounter::RockSmash, Lead::Synchronize>,
+              &WildGenerator3::generateMethodH<methodType, Encounter::RockSmash, Lead::CuteCharm> },
+            { &WildGenerator3::generateMethodH<methodType, Encounter::SafariZone, Lead::None>,
+              &WildGenerator3::generateMethodH<methodType, Encounter::SafariZone, Lead::Synchronize>,
+              &WildGenerator3::generateMethodH<methodType, Encounter::SafariZone, Lead::CuteCharm> },
+            { &WildGenerator3::generateMethodH<methodType, Encounter::Grass, Lead::None>,
+              &WildGenerator3::generateMethodH<methodType, Encounter::Grass, Lead::Synchronize>,
+              &WildGenerator3::generateMethodH<methodType, Encounter::Grass, Lead::CuteCharm> },
+            { &WildGenerator3::generateMethodH<methodType, Encounter::Surfing, Lead::None>,
+              &WildGenerator3::generateMethodH<methodType, Encounter::Surfing, Lead::Synchronize>,
+              &WildGenerator3::generateMethodH<methodType, Encounter::Surfing, Lead::CuteCharm> },
+            { &WildGenerator3::generateMethodH<methodType, Encounter::Stationary, Lead::None>,
+              &WildGenerator3::generateMethodH<methodType, Encounter::Stationary, Lead::Synchronize>,
+              &WildGenerator3::generateMethodH<methodType, Encounter::Stationary, Lead::CuteCharm> } };
+
+    u8 encounterIndex;
+    switch (encounter)
+    {
+    case Encounter::RockSmash:
+        encounterIndex = 0;
+        break;
+    case Encounter::SafariZone:
+        encounterIndex = 1;
+        break;
+    case Encounter::Grass:
+        encounterIndex = 2;
+        break;
+    case Encounter::Surfing:
+    case Encounter::OldRod:
+    case Encounter::GoodRod:
+    case Encounter::SuperRod:
+        encounterIndex = 3;
+        break;
+    default:
+        encounterIndex = 4;
+        break;
+    }
+
+    // Anything that isn't covered is treated as cute charm
+    u8 leadIndex = lead == Lead::None ? 0 : lead == Lead::Synchronize ? 1 : 2;
+
+    return kernels[encounterIndex][leadIndex];
+}
+
+template <Method methodType, Encounter encounterType, Lead leadType>
+std::vector<WildState> WildGenerator3::generateMethodH(u32 seed, const EncounterArea3 &encounterArea) const
 {
     std::vector<WildState> states;
 
@@ -44,49 +113,55 @@ std::vector<WildState> WildGenerator3::generate(u32 seed, const EncounterArea3 &
     u16 rate = encounterArea.getEncounterRate() * 16;
     bool rock = rate == 2880;
 
-    bool cuteCharmFlag = false;
-    std::function<bool(u32)> cuteCharm;
+    // Cute charm forces the gender value of the PID to be below (female) or at least (male) the threshold
+    u8 cuteCharmThreshold = 0;
+    bool cuteCharmFemale = false;
     switch (lead)
     {
     case Lead::CuteCharm125F:
-        cuteCharm = [](u32 pid) { return (pid & 0xff) < 31; };
+        cuteCharmThreshold = 31;
+        cuteCharmFemale = true;
         break;
     case Lead::CuteCharm875M:
-        cuteCharm = [](u32 pid) { return (pid & 0xff) >= 31; };
+        cuteCharmThreshold = 31;
         break;
     case Lead::CuteCharm25F:
-        cuteCharm = [](u32 pid) { return (pid & 0xff) < 63; };
+        cuteCharmThreshold = 63;
+        cuteCharmFemale = true;
         break;
     case Lead::CuteCharm75M:
-        cuteCharm = [](u32 pid) { return (pid & 0xff) >= 63; };
+        cuteCharmThreshold = 63;
         break;
     case Lead::CuteCharm50F:
-        cuteCharm = [](u32 pid) { return (pid & 0xff) < 127; };
+        cuteCharmThreshold = 127;
+        cuteCharmFemale = true;
         break;
     case Lead::CuteCharm50M:
-        cuteCharm = [](u32 pid) { return (pid & 0xff) >= 127; };
+        cuteCharmThreshold = 127;
         break;
     case Lead::CuteCharm75F:
-        cuteCharm = [](u32 pid) { return (pid & 0xff) < 191; };
+        cuteCharmThreshold = 191;
+        cuteCharmFemale = true;
         break;
     case Lead::CuteCharm25M:
-        cuteCharm = [](u32 pid) { return (pid & 0xff) >= 191; };
+        cuteCharmThreshold = 191;
         break;
     default:
-        cuteCharm = [](u32 pid) {
-            (void)pid;
-            return true;
-        };
+        break;
     }
 
+    auto cuteCharm = [cuteCharmThreshold, cuteCharmFemale](u32 pid) {
+        u8 gender = pid & 0xff;
+        return cuteCharmFemale ? gender < cuteCharmThreshold : gender >= cuteCharmThreshold;
+    };
+
     for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
     {
         WildState state(initialAdvances + cnt);
         PokeRNG go(rng.getSeed());
 
-        switch (encounter)
+        if constexpr (encounterType == Encounter::RockSmash)
         {
-        case Encounter::RockSmash:
             if (!rock)
             {
                 go.next();
@@ -103,8 +178,9 @@ std::vector<WildState> WildGenerator3::generate(u32 seed, const EncounterArea3 &
             }
 
             state.setLevel(encounterArea.calcLevel(state.getEncounterSlot(), go.nextUShort()));
-            break;
-        case Encounter::SafariZone:
+        }
+        else if constexpr (encounterType == Encounter::SafariZone)
+        {
             state.setEncounterSlot(EncounterSlot::hSlot(go.nextUShort(), encounter));
             if (!filter.compareEncounterSlot(state))
             {
@@ -113,8 +189,9 @@ std::vector<WildState> WildGenerator3::generate(u32 seed, const EncounterArea3 &
 
             state.setLevel(encounterArea.calcLevel(state.getEncounterSlot()));
             go.advance(2);
-            break;
-        case Encounter::Grass:
+        }
+        else if constexpr (encounterType == Encounter::Grass)
+        {
             go.next();
             state.setEncounterSlot(EncounterSlot::hSlot(go.nextUShort(), encounter));
             if (!filter.compareEncounterSlot(state))
@@ -124,11 +201,9 @@ std::vector<WildState> WildGenerator3::generate(u32 seed, const EncounterArea3 &
 
             state.setLevel(encounterArea.calcLevel(state.getEncounterSlot()));
             go.advance(1);
-            break;
-        case Encounter::Surfing:
-        case Encounter::OldRod:
-        case Encounter::GoodRod:
-        case Encounter::SuperRod:
+        }
+        else if constexpr (encounterType == Encounter::Surfing) // Covers fishing
+        {
             go.next();
             state.setEncounterSlot(EncounterSlot::hSlot(go.nextUShort(), encounter));
             if (!filter.compareEncounterSlot(state))
@@ -137,16 +212,14 @@ std::vector<WildState> WildGenerator3::generate(u32 seed, const EncounterArea3 &
             }
 
             state.setLevel(encounterArea.calcLevel(state.getEncounterSlot(), go.nextUShort()));
-            break;
-        default:
-            break;
         }
 
-        if (lead == Lead::None)
+        bool cuteCharmFlag = false;
+        if constexpr (leadType == Lead::None)
         {
             state.setNature(go.nextUShort() % 25);
         }
-        else if (lead == Lead::Synchronize)
+        else if constexpr (leadType == Lead::Synchronize)
         {
             if ((go.nextUShort() & 1) == 0) // state is synchable so set nature to synch nature
             {
@@ -185,12 +258,12 @@ std::vector<WildState> WildGenerator3::generate(u32 seed, const EncounterArea3 &
         // Valid PID is found now time to generate IVs
         u16 iv1;
         u16 iv2;
-        if (method == Method::MethodH1)
+        if constexpr (methodType == Method::MethodH1)
         {
             iv1 = go.nextUShort();
             iv2 = go.nextUShort();
         }
-        else if (method == Method::MethodH2)
+        else if constexpr (methodType == Method::MethodH2)
         {
             go.next();
             iv1 = go.nextUShort();
@@ -203,7 +276,6 @@ std::vector<WildState> WildGenerator3::generate(u32 seed, const EncounterArea3 &
             iv2 = go.nextUShort();
         }
         state.setIVs(iv1, iv2);
-        state.calculateHiddenPower();
 
         if (filter.compareState(state))
         {
@@ -31,6 +31,15 @@ public:
     WildGenerator3() = default;
     WildGenerator3(u32 initialAdvances, u32 maxAdvances, u16 tid, u16 sid, u8 genderRatio, Method method, const StateFilter &filter);
     std::vector<WildState> generate(u32 seed, const EncounterArea3 &encounterArea) const;
+
+private:
+    using Kernel = std::vector<WildState> (WildGenerator3::*)(u32, const EncounterArea3 &) const;
+
+    template <Method methodType>
+    static Kernel getKernel(Encounter encounter, Lead lead);
+
+    template <Method methodType, Encounter encounterType, Lead leadType>
+    std::vector<WildState> generateMethodH(u32 seed, const EncounterArea3 &encounterArea) const;
 };
 
 #endif // WILDGENERATOR3_HPP
@@ -21,27 +21,51 @@
 #include <algorithm>
 #include <future>
 
+// Seeds 0x40000001 to 0xfffffffe are searched in chunks of 2^20 seeds
+constexpr u32 firstSeed = 0x40000000;
+constexpr u32 chunkBits = 20;
+constexpr u32 chunkCount = 0xc0000000 >> chunkBits;
+
 ChannelSeedSearcher::ChannelSeedSearcher(const std::vector<u32> &criteria) : SeedSearcher(criteria)
 {
 }
 
+void ChannelSeedSearcher::setCheckpoint(const std::string &fileName)
+{
+    checkpointFile = fileName;
+}
+
+void ChannelSeedSearcher::setShard(const SearchShard &shard)
+{
+    this->shard = shard;
+}
+
 void ChannelSeedSearcher::startSearch(int threads)
 {
     searching = true;
 
+    // A checkpoint written by another shard holds other chunks, so the shard is part of the key
+    std::vector<u64> parameters(criteria.begin(), criteria.end());
+    parameters.insert(parameters.end(), { shard.index, shard.count });
+    SearchCheckpoint checkpoint(checkpointFile, parameters, chunkCount, sizeof(u32));
+
+    // Only search the chunks that belong to this shard, chunks cover increasing seeds so they are kept in chunk order
+    auto range = shard.getRange<u32>(0, chunkCount);
+    chunks = OrderedResults<u32>(range.first, range.second);
+
     std::vector<std::future<void>> threadContainer;
 
-    u32 split = 0xBFFFFFFE / threads;
-    u32 start = 0x40000001;
+    u32 split = (range.second - range.first) / threads;
+    u32 start = range.first;
     for (int i = 0; i < threads; i++)
     {
         if (i == threads - 1)
         {
-            threadContainer.emplace_back(std::async(std::launch::async, [=] { search(start, 0xffffffff); }));
+            threadContainer.emplace_back(std::async(std::launch::async, [=, &checkpoint] { search(start, range.second, checkpoint); }));
         }
         else
         {
-            threadContainer.emplace_back(std::async(std::launch::async, [=] { search(start, start + split); }));
+            threadContainer.emplace_back(std::async(std::launch::async, [=, &checkpoint] { search(start, start + split, checkpoint); }));
         }
         start += split;
     }
@@ -51,8 +75,8 @@ void ChannelSeedSearcher::startSearch(int threads)
         threadContainer[i].wait();
     }
 
-    std::sort(results.begin(), results.end());
-    results.erase(std::unique(results.begin(), results.end()), results.end());
+    chunks.finish();
+    results = chunks.take();
 }
 
 int ChannelSeedSearcher::getProgress() const
@@ -60,23 +84,43 @@ int ChannelSeedSearcher::getProgress() const
     return progress >> 1;
 }
 
-void ChannelSeedSearcher::search(u32 start, u32 end)
+void ChannelSeedSearcher::search(u32 start, u32 end, SearchCheckpoint &checkpoint)
 {
-    for (u32 seed = start; seed < end; seed++)
+    for (u32 chunk = start; chunk < end; chunk++)
     {
-        if (!searching)
+        u32 first = std::max(firstSeed + (chunk << chunkBits), firstSeed + 1);
+        u32 last = chunk == chunkCount - 1 ? 0xffffffff : firstSeed + ((chunk + 1) << chunkBits);
+
+        if (checkpoint.isCompleted(chunk))
         {
-            return;
+            std::lock_guard<std::mutex> lock(mutex);
+            chunks.add(chunk, checkpoint.getResults<u32>(chunk));
+            progress += last - first;
+            continue;
         }
 
-        XDRNG rng(seed);
-        if (searchSeed(rng))
+        std::vector<u32> seeds;
+        for (u32 seed = first; seed < last; seed++)
         {
-            std::lock_guard<std::mutex> lock(mutex);
-            results.emplace_back(rng.getSeed());
+            if (!searching)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                chunks.add(chunk, std::move(seeds));
+                return;
+            }
+
+            XDRNG rng(seed);
+            if (searchSeed(rng))
+            {
+                seeds.emplace_back(rng.getSeed());
+            }
+
+            progress++;
         }
 
-        progress++;
+        std::lock_guard<std::mutex> lock(mutex);
+        checkpoint.complete(chunk, seeds);
+        chunks.add(chunk, std::move(seeds));
     }
 }
 
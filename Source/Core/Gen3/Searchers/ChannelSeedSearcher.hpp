@@ -22,16 +22,24 @@
 
 #include <Core/Gen3/Searchers/SeedSearcher.hpp>
 #include <Core/RNG/LCRNG.hpp>
+#include <Core/Util/SearchCheckpoint.hpp>
+#include <Core/Util/SearchShard.hpp>
+#include <string>
 
 class ChannelSeedSearcher : public SeedSearcher
 {
 public:
     explicit ChannelSeedSearcher(const std::vector<u32> &criteria);
+    void setCheckpoint(const std::string &fileName);
+    void setShard(const SearchShard &shard);
     void startSearch(int threads);
     int getProgress() const override;
 
 private:
-    void search(u32 start, u32 end);
+    std::string checkpointFile;
+    SearchShard shard;
+
+    void search(u32 start, u32 end, SearchCheckpoint &checkpoint);
     bool searchSeed(XDRNG &rng);
 };
 
@@ -32,7 +32,7 @@ public:
 
 private:
     void search(u32 start, u32 end);
-    void search(const std::vector<u32> &seeds);
+    void search(const std::vector<u32> &seeds, u32 start, u32 end);
     bool searchSeed(XDRNG &rng);
     void generatePokemon(XDRNG &rng, u16 tsv, u8 nature, u8 gender, u8 genderRatio);
 };
@@ -33,15 +33,17 @@ void GalesSeedSearcher::startSearch(int threads)
 {
     searching = true;
 
+    startChunks(lowChunks);
+
     std::vector<std::future<void>> threadContainer;
 
-    u32 split = 0x10000 / threads;
+    u32 split = lowChunks / threads;
     u32 start = 0;
     for (int i = 0; i < threads; i++)
     {
         if (i == threads - 1)
         {
-            threadContainer.emplace_back(std::async(std::launch::async, [=] { search(start, 0x10000); }));
+            threadContainer.emplace_back(std::async(std::launch::async, [=] { search(start, lowChunks); }));
         }
         else
         {
@@ -55,34 +57,34 @@ void GalesSeedSearcher::startSearch(int threads)
         threadContainer[i].wait();
     }
 
-    std::sort(results.begin(), results.end());
-    results.erase(std::unique(results.begin(), results.end()), results.end());
+    finishChunks();
 }
 
 void GalesSeedSearcher::startSearch(int threads, const std::vector<u32> &seeds)
 {
     searching = true;
 
-    if (seeds.size() < threads)
+    u32 count = static_cast<u32>((seeds.size() + seedChunkSize - 1) / seedChunkSize);
+    if (count < static_cast<u32>(threads))
     {
-        threads = seeds.size();
+        threads = static_cast<int>(count);
     }
 
+    startChunks(count);
+
     std::vector<std::future<void>> threadContainer;
 
-    u32 split = seeds.size() / threads;
+    u32 split = count / threads;
     u32 start = 0;
     for (int i = 0; i < threads; i++)
     {
         if (i == threads - 1)
         {
-            threadContainer.emplace_back(
-                std::async(std::launch::async, [=] { search(std::vector<u32>(seeds.cbegin() + start, seeds.cend())); }));
+            threadContainer.emplace_back(std::async(std::launch::async, [=, &seeds] { search(seeds, start, count); }));
         }
         else
         {
-            threadContainer.emplace_back(
-                std::async(std::launch::async, [=] { search(std::vector<u32>(seeds.cbegin() + start, seeds.cbegin() + split)); }));
+            threadContainer.emplace_back(std::async(std::launch::async, [=, &seeds] { search(seeds, start, start + split); }));
         }
         start += split;
     }
@@ -92,53 +94,65 @@ void GalesSeedSearcher::startSearch(int threads, const std::vector<u32> &seeds)
         threadContainer[i].wait();
     }
 
-    std::sort(results.begin(), results.end());
-    results.erase(std::unique(results.begin(), results.end()), results.end());
+    finishChunks();
 }
 
 void GalesSeedSearcher::search(u32 start, u32 end)
 {
-    for (u32 low = start; low < end; low++)
+    for (u32 chunk = start; chunk < end; chunk++)
     {
-        for (u32 high = criteria[0]; high < 0x10000; high += 5)
+        std::vector<u32> seeds;
+        for (u32 low = chunk << lowChunkBits; low < (chunk + 1) << lowChunkBits; low++)
         {
-            if (!searching)
+            for (u32 high = criteria[0]; high < 0x10000; high += 5)
             {
-                return;
-            }
+                if (!searching)
+                {
+                    addChunk(chunk, seeds);
+                    return;
+                }
 
-            XDRNGR reverse((high << 16) | low);
-            reverse.next();
+                XDRNGR reverse((high << 16) | low);
+                reverse.next();
 
-            XDRNG rng(reverse.next());
-            if (searchSeed(rng))
-            {
-                std::lock_guard<std::mutex> lock(mutex);
-                results.emplace_back(rng.getSeed());
-            }
+                XDRNG rng(reverse.next());
+                if (searchSeed(rng))
+                {
+                    seeds.emplace_back(rng.getSeed());
+                }
 
-            progress++;
+                progress++;
+            }
         }
+
+        addChunk(chunk, seeds);
     }
 }
 
-void GalesSeedSearcher::search(const std::vector<u32> &seeds)
+void GalesSeedSearcher::search(const std::vector<u32> &seeds, u32 start, u32 end)
 {
-    for (auto seed : seeds)
+    for (u32 chunk = start; chunk < end; chunk++)
     {
-        if (!searching)
+        std::vector<u32> found;
+        size_t last = std::min(seeds.size(), static_cast<size_t>(chunk + 1) * seedChunkSize);
+        for (size_t i = static_cast<size_t>(chunk) * seedChunkSize; i < last; i++)
         {
-            return;
-        }
+            if (!searching)
+            {
+                addChunk(chunk, found);
+                return;
+            }
 
-        XDRNG rng(seed);
-        if (searchSeed(rng))
-        {
-            std::lock_guard<std::mutex> lock(mutex);
-            results.emplace_back(rng.getSeed());
+            XDRNG rng(seeds[i]);
+            if (searchSeed(rng))
+            {
+                found.emplace_back(rng.getSeed());
+            }
+
+            progress++;
         }
 
-        progress++;
+        addChunk(chunk, found);
     }
 }
 
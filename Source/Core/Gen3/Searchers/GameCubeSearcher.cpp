@@ -38,34 +38,13 @@ void GameCubeSearcher::startSearch(const std::array<u8, 6> &min, const std::arra
         return;
     }
 
-    for (u8 hp = min[0]; hp <= max[0]; hp++)
-    {
-        for (u8 atk = min[1]; atk <= max[1]; atk++)
-        {
-            for (u8 def = min[2]; def <= max[2]; def++)
-            {
-                for (u8 spa = min[3]; spa <= max[3]; spa++)
-                {
-                    for (u8 spd = min[4]; spd <= max[4]; spd++)
-                    {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
-                        {
-                            if (!searching)
-                            {
-                                return;
-                            }
-
-                            std::vector<GameCubeState> states = search(hp, atk, def, spa, spd, spe);
-
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
-                        }
-                    }
-                }
-            }
-        }
-    }
+    searchIVs(min, max, searching, progress, [&](u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) {
+        std::vector<GameCubeState> states = search(hp, atk, def, spa, spd, spe);
+
+        std::lock_guard<std::mutex> guard(mutex);
+        results.insert(results.end(), states.begin(), states.end());
+        progress++;
+    });
 }
 
 void GameCubeSearcher::cancelSearch()
@@ -114,7 +93,6 @@ std::vector<GameCubeState> GameCubeSearcher::searchXDColo(u8 hp, u8 atk, u8 def,
 
     GameCubeState state;
     state.setIVs(hp, atk, def, spa, spd, spe);
-    state.calculateHiddenPower();
     if (!filter.compareHiddenPower(state))
     {
         return states;
@@ -160,7 +138,6 @@ std::vector<GameCubeState> GameCubeSearcher::searchAgeto(u8 hp, u8 atk, u8 def,
 
     GameCubeState state;
     state.setIVs(hp, atk, def, spa, spd, spe);
-    state.calculateHiddenPower();
     if (!filter.compareHiddenPower(state))
     {
         return states;
@@ -211,7 +188,6 @@ std::vector<GameCubeState> GameCubeSearcher::searchXDShadow(u8 hp, u8 atk, u8 de
 
     GameCubeState state;
     state.setIVs(hp, atk, def, spa, spd, spe);
-    state.calculateHiddenPower();
     if (!filter.compareHiddenPower(state))
     {
         return states;
@@ -354,7 +330,6 @@ std::vector<GameCubeState> GameCubeSearcher::searchColoShadow(u8 hp, u8 atk, u8
 
     GameCubeState state;
     state.setIVs(hp, atk, def, spa, spd, spe);
-    state.calculateHiddenPower();
     if (!filter.compareHiddenPower(state))
     {
         return states;
@@ -458,7 +433,6 @@ void GameCubeSearcher::searchChannel(u8 minSpD, u8 maxSpD)
 
             GameCubeState state;
             state.setIVs(hp, atk, def, spa, spd, spe);
-            state.calculateHiddenPower();
             if (!filter.compareIVs(state))
             {
                 continue;
@@ -0,0 +1,236 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "IDSearcher3.hpp"
+#include <Core/Enum/Game.hpp>
+#include <Core/RNG/LCRNG.hpp>
+#include <Core/RNG/RNGEuclidean.hpp>
+
+IDSearcher3::IDSearcher3(const std::vector<u16> &tids, const std::vector<u16> &sids, const std::vector<u16> &tsvs, Game version) :
+    filter(tids, sids, tsvs), tids(tids), sids(sids), tsvs(tsvs), version(version), searching(false), progress(0)
+{
+}
+
+void IDSearcher3::startSearch(int threads, u32 initialAdvances, u32 maxAdvances)
+{
+    job.start();
+    searching = true;
+
+    if ((version & Game::GC) && !tids.empty())
+    {
+        if (!sids.empty() || !tsvs.empty())
+        {
+            searchXDColoPairs();
+        }
+        else
+        {
+            for (u16 tid : tids)
+            {
+                searchXDColoTID(tid);
+            }
+        }
+        return;
+    }
+
+    // Every 2^32 seed would be a result
+    if ((version & Game::GC) && sids.empty() && tsvs.empty())
+    {
+        return;
+    }
+
+    // Ruby/Sapphire search every 16 bit seed, XD/Colo every block of 2^16 seeds. Both are split into tasks of the
+    // shared scheduler, threads only limits how many of them run at the same time. Results are released in task
+    // order so they do not depend on which task finished first.
+    constexpr u32 taskSize = 0x100;
+    constexpr u32 tasks = 0x10000 / taskSize;
+    ordered = OrderedResults<IDState3>(0, tasks);
+    job.run(tasks, threads, [&](u32 task, u32) {
+        u32 start = task * taskSize;
+        if (version & Game::GC)
+        {
+            searchXDColo(task, start, start + taskSize);
+        }
+        else
+        {
+            searchRS(task, start, start + taskSize, initialAdvances, maxAdvances);
+        }
+    });
+
+    std::lock_guard<std::mutex> guard(mutex);
+    ordered.finish();
+    auto states = ordered.take();
+    results.insert(results.end(), states.begin(), states.end());
+}
+
+void IDSearcher3::cancelSearch()
+{
+    searching = false;
+    job.cancel();
+}
+
+std::vector<IDState3> IDSearcher3::getResults()
+{
+    std::lock_guard<std::mutex> guard(mutex);
+    auto data = std::move(results);
+    return data;
+}
+
+int IDSearcher3::getProgress() const
+{
+    return progress;
+}
+
+int IDSearcher3::getMaxProgress() const
+{
+    if ((version & Game::GC) && !tids.empty())
+    {
+        if (!sids.empty())
+        {
+            return static_cast<int>(tids.size() * sids.size());
+        }
+        if (!tsvs.empty())
+        {
+            return static_cast<int>(tids.size() * tsvs.size() * 8);
+        }
+        return static_cast<int>(tids.size());
+    }
+    return 0x10000;
+}
+
+void IDSearcher3::searchRS(u32 task, u32 start, u32 end, u32 initialAdvances, u32 maxAdvances)
+{
+    std::vector<IDState3> states;
+    for (u32 seed = start; seed < end && searching; seed++)
+    {
+        PokeRNG rng(seed);
+        rng.advance(initialAdvances);
+
+        for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
+        {
+            PokeRNG go(rng.getSeed());
+
+            u16 sid = go.nextUShort();
+            u16 tid = go.nextUShort();
+
+            IDState3 state(seed, initialAdvances + cnt, tid, sid);
+            if (filter.compare(state))
+            {
+                states.emplace_back(state);
+            }
+        }
+        progress++;
+    }
+
+    addResults(task, std::move(states));
+}
+
+void IDSearcher3::searchXDColo(u32 task, u32 start, u32 end)
+{
+    std::vector<IDState3> states;
+    for (u32 block = start; block < end && searching; block++)
+    {
+        for (u32 low = 0; low < 0x10000; low++)
+        {
+            u32 seed = (block << 16) | low;
+            XDRNG go(seed);
+
+            u16 tid = go.nextUShort();
+            u16 sid = go.nextUShort();
+
+            IDState3 state(seed, 0, tid, sid);
+            if (filter.compare(state))
+            {
+                states.emplace_back(state);
+            }
+        }
+        progress++;
+    }
+
+    addResults(task, std::move(states));
+}
+
+void IDSearcher3::addResults(u32 task, std::vector<IDState3> &&states)
+{
+    std::lock_guard<std::mutex> guard(mutex);
+    ordered.add(task, std::move(states));
+    auto released = ordered.take();
+    results.insert(results.end(), released.begin(), released.end());
+}
+
+void IDSearcher3::searchXDColoTID(u16 tid)
+{
+    // The TID is the top half of the first call, so only the bottom half of it is unknown
+    std::vector<IDState3> states;
+    for (u32 low = 0; low < 0x10000 && searching; low++)
+    {
+        XDRNG rng((tid << 16) | low);
+        u16 sid = rng.nextUShort();
+
+        IDState3 state(XDRNGR((tid << 16) | low).next(), 0, tid, sid);
+        if (filter.compare(state))
+        {
+            states.emplace_back(state);
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(mutex);
+    results.insert(results.end(), states.begin(), states.end());
+    progress++;
+}
+
+void IDSearcher3::searchXDColoPairs()
+{
+    for (u16 tid : tids)
+    {
+        // Without SIDs every SID that gives one of the TSVs is reversed
+        std::vector<u16> pairSIDs = sids;
+        if (pairSIDs.empty())
+        {
+            for (u16 tsv : tsvs)
+            {
+                for (u16 i = 0; i < 8; i++)
+                {
+                    pairSIDs.emplace_back(((tsv << 3) | i) ^ tid);
+                }
+            }
+        }
+
+        std::vector<IDState3> states;
+        for (u16 sid : pairSIDs)
+        {
+            if (!searching)
+            {
+                return;
+            }
+
+            for (const auto &pair : RNGEuclidean::recoverLower16BitsPID((tid << 16) | sid))
+            {
+                IDState3 state(XDRNGR(pair.first).next(), 0, tid, sid);
+                if (filter.compare(state))
+                {
+                    states.emplace_back(state);
+                }
+            }
+        }
+
+        std::lock_guard<std::mutex> guard(mutex);
+        results.insert(results.end(), states.begin(), states.end());
+        progress += static_cast<int>(pairSIDs.size());
+    }
+}
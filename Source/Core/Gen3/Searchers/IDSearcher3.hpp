@@ -0,0 +1,73 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef IDSEARCHER3_HPP
+#define IDSEARCHER3_HPP
+
+#include <Core/Gen3/States/IDState3.hpp>
+#include <Core/Parents/Filters/IDFilter.hpp>
+#include <Core/Util/JobScheduler.hpp>
+#include <Core/Util/OrderedResults.hpp>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+enum Game : u16;
+
+// XD/Colo start from any 32 bit seed: known TID and SID pairs are reversed directly, a known TID leaves 2^16 seeds to
+// check and a SID or TSV alone searches the full seed space. Without any filter nothing is searched.
+class IDSearcher3
+{
+public:
+    IDSearcher3() = default;
+
+    IDSearcher3(const std::vector<u16> &tids, const std::vector<u16> &sids, const std::vector<u16> &tsvs, Game version);
+
+    void startSearch(int threads, u32 initialAdvances, u32 maxAdvances);
+
+    void cancelSearch();
+
+    std::vector<IDState3> getResults();
+
+    int getProgress() const;
+
+    int getMaxProgress() const;
+
+private:
+    IDFilter filter;
+    std::vector<u16> tids;
+    std::vector<u16> sids;
+    std::vector<u16> tsvs;
+    Game version;
+
+    bool searching;
+    std::atomic<int> progress;
+    std::vector<IDState3> results;
+    OrderedResults<IDState3> ordered;
+    std::mutex mutex;
+    JobControl job;
+
+    void searchRS(u32 task, u32 start, u32 end, u32 initialAdvances, u32 maxAdvances);
+    void searchXDColo(u32 task, u32 start, u32 end);
+    void addResults(u32 task, std::vector<IDState3> &&states);
+    void searchXDColoTID(u16 tid);
+    void searchXDColoPairs();
+};
+
+#endif // IDSEARCHER3_HPP
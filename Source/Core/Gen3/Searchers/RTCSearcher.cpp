@@ -19,6 +19,7 @@
 
 #include "RTCSearcher.hpp"
 #include <Core/RNG/LCRNG.hpp>
+#include <algorithm>
 
 RTCSearcher::RTCSearcher() : searching(false)
 {
@@ -119,9 +120,84 @@ void advanceJirachi(XDRNG &rng, u32 &count)
     count += flag ? 1 : 2;
 }
 
+namespace
+{
+    // Multiplicative inverse of an odd number modulo 2^32
+    u32 inverse(u32 value)
+    {
+        u32 result = value;
+        for (int i = 0; i < 5; i++)
+        {
+            result *= 2 - value * result;
+        }
+        return result;
+    }
+
+    // Solves second * step = seed - initialSeed (mod 2^32) for every second before total
+    void solveSeconds(std::vector<std::pair<u32, u32>> &matches, u32 initialSeed, u32 step, u32 seed, u64 total, u32 advances)
+    {
+        u32 diff = seed - initialSeed;
+
+        int shift = 0;
+        while (!((step >> shift) & 1))
+        {
+            shift++;
+        }
+
+        if (diff & ((1u << shift) - 1))
+        {
+            return;
+        }
+
+        u64 period = 1ull << (32 - shift);
+        u64 second = static_cast<u32>((diff >> shift) * inverse(step >> shift)) & (period - 1);
+        for (; second < total; second += period)
+        {
+            matches.emplace_back(static_cast<u32>(second), advances);
+        }
+    }
+
+    // Every seed that advanceMenu moves to seed
+    std::vector<u32> menuPredecessors(u32 seed)
+    {
+        std::vector<u32> predecessors;
+
+        // The menu finishes on the draw that completes the mask, so the final draw can never be 0 or appear earlier
+        u8 target = seed >> 30;
+        if (target == 0)
+        {
+            return predecessors;
+        }
+
+        XDRNGR rng(seed);
+        for (u8 num = 4; num != target;)
+        {
+            u32 prev = rng.next();
+            num = prev >> 30;
+
+            XDRNG go(prev);
+            u32 count = 0;
+            advanceMenu(go, count);
+            if (go.getSeed() == seed)
+            {
+                predecessors.emplace_back(prev);
+            }
+        }
+
+        return predecessors;
+    }
+}
+
 void RTCSearcher::startSearch(u32 initialSeed, u32 targetSeed, u32 initialAdvances, u32 maxAdvances, const Date &end, bool box, bool ageto, bool rumble, bool channel)
 {
     searching = true;
+
+    u64 total = end > Date() ? static_cast<u64>(Date().daysTo(end)) * 86400 : 0;
+
+    // Matching seconds and the advances they match on
+    std::vector<std::pair<u32, u32>> matches;
+    u32 step = 40500000;
+
     if (channel)
     {
         if (!validateJirachi(targetSeed))
@@ -129,128 +205,72 @@ void RTCSearcher::startSearch(u32 initialSeed, u32 targetSeed, u32 initialAdvanc
             return;
         }
 
-        for (Date date; date < end; date = date.addDays(1))
+        // Walk backwards from the target: first the seeds advanceJirachi can start from, then the chain of menu
+        // transitions before them. A chain state at depth x is reachable as the menu state after x menu advances.
+        std::vector<u32> chain;
+        XDRNGR back(targetSeed);
+        back.advance(5);
+        for (u8 advances = 6; advances <= 8; advances++)
         {
-            for (u8 hour = 0; hour < 24; hour++)
+            XDRNG go(back.next());
+            u32 count = 0;
+            advanceJirachi(go, count);
+            if (go.getSeed() == targetSeed)
             {
-                for (u8 minute = 0; minute < 60; minute++)
-                {
-                    for (u8 second = 0; second < 60; second++, initialSeed += 40500000)
-                    {
-                        XDRNG rng(initialSeed);
-                        rng.next();
-                        u32 y = 0;
-                        advanceMenu(rng,y);
-
-                        for (u32 x = 0; x < maxAdvances; advanceMenu(rng,y), x++)
-                        {
-                            if (!searching)
-                            {
-                                return;
-                            }
-                            
-                            XDRNG go(rng.getSeed());
-                            advanceJirachi(go,y);
-
-                            if (go.getSeed() == targetSeed)
-                            {
-                                std::lock_guard<std::mutex> guard(mutex);
-                                results.emplace_back(DateTime(date, Time(hour, minute, second)), initialSeed, x);
-                            }
-                        }
-                    }
-                }
+                chain.emplace_back(back.getSeed());
             }
         }
-    }
-    else if (box)
-    {
-        for (Date date; date < end; date = date.addDays(1))
+
+        for (u32 x = 0; x < maxAdvances && !chain.empty(); x++)
         {
-            for (u8 hour = 0; hour < 24; hour++)
+            if (!searching)
             {
-                for (u8 minute = 0; minute < 60; minute++)
+                return;
+            }
+
+            std::vector<u32> next;
+            for (u32 seed : chain)
+            {
+                for (u32 prev : menuPredecessors(seed))
                 {
-                    for (u8 second = 0; second < 60; second++, initialSeed += 0x269FB20)
-                    {
-                        if (initialSeed == targetSeed)
-                        {
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.emplace_back(DateTime(date, Time(hour, minute, second)), initialSeed, 0);
-                        }
-                    }
+                    // The first menu state is reached from the seed after one advance
+                    solveSeconds(matches, initialSeed, step, XDRNGR(prev).next(), total, x);
+                    next.emplace_back(prev);
                 }
             }
+            chain = std::move(next);
         }
     }
+    else if (box)
+    {
+        step = 0x269FB20;
+        solveSeconds(matches, initialSeed, step, targetSeed, total, 0);
+    }
     else if (ageto)
     {
         XDRNGR back(targetSeed);
         back.advance(29278 + 1018);
 
-        targetSeed = back.getSeed();
-
-        for (Date date; date < end; date = date.addDays(1))
+        for (u32 x = 0; x < maxAdvances; x += 2792, back.advance(2792, true))
         {
-            for (u8 hour = 0; hour < 24; hour++)
-            {
-                for (u8 minute = 0; minute < 60; minute++)
-                {
-                    for (u8 second = 0; second < 60; second++, initialSeed += 40500000)
-                    {
-                        XDRNG rng(initialSeed);
-
-                        for (u32 x = 0; x < maxAdvances; x += 2792, rng.advance(2792, true))
-                        {
-                            if (!searching)
-                            {
-                                return;
-                            }
-
-                            if (rng.getSeed() == targetSeed)
-                            {
-                                std::lock_guard<std::mutex> guard(mutex);
-                                results.emplace_back(DateTime(date, Time(hour, minute, second)), initialSeed, x + 29278 + 1018);
-                            }
-                        }
-                    }
-                }
-            }
+            solveSeconds(matches, initialSeed, step, back.getSeed(), total, x + 29278 + 1018);
         }
     }
     else if (rumble)
     {
+        step = 60750000;
+
         MRNGR back(targetSeed);
         back.advance(initialAdvances);
 
-        targetSeed = back.getSeed();
-
-        for (Date date; date < end; date = date.addDays(1))
+        for (u32 x = 0; x < maxAdvances; x++)
         {
-            for (u8 hour = 0; hour < 24; hour++)
+            if (!searching)
             {
-                for (u8 minute = 0; minute < 60; minute++)
-                {
-                    for (u8 second = 0; second < 60; second++, initialSeed += 60750000)
-                    {
-                        MRNG rng(initialSeed);
-
-                        for (u32 x = 0; x < maxAdvances; x++)
-                        {
-                            if (!searching)
-                            {
-                                return;
-                            }
-
-                            if (rng.next() == targetSeed)
-                            {
-                                std::lock_guard<std::mutex> guard(mutex);
-                                results.emplace_back(DateTime(date, Time(hour, minute, second)), initialSeed, x + 1 + initialAdvances);
-                            }
-                        }
-                    }
-                }
+                return;
             }
+
+            solveSeconds(matches, initialSeed, step, back.next(), total, x + 1 + initialAdvances);
         }
     }
     else
@@ -258,36 +278,27 @@ void RTCSearcher::startSearch(u32 initialSeed, u32 targetSeed, u32 initialAdvanc
         XDRNGR back(targetSeed);
         back.advance(initialAdvances);
 
-        targetSeed = back.getSeed();
-
-        for (Date date; date < end; date = date.addDays(1))
+        for (u32 x = 0; x < maxAdvances; x++)
         {
-            for (u8 hour = 0; hour < 24; hour++)
+            if (!searching)
             {
-                for (u8 minute = 0; minute < 60; minute++)
-                {
-                    for (u8 second = 0; second < 60; second++, initialSeed += 40500000)
-                    {
-                        XDRNG rng(initialSeed);
-
-                        for (u32 x = 0; x < maxAdvances; x++)
-                        {
-                            if (!searching)
-                            {
-                                return;
-                            }
-
-                            if (rng.next() == targetSeed)
-                            {
-                                std::lock_guard<std::mutex> guard(mutex);
-                                results.emplace_back(DateTime(date, Time(hour, minute, second)), initialSeed, x + 1 + initialAdvances);
-                            }
-                        }
-                    }
-                }
+                return;
             }
+
+            solveSeconds(matches, initialSeed, step, back.next(), total, x + 1 + initialAdvances);
         }
     }
+
+    std::sort(matches.begin(), matches.end());
+    matches.erase(std::unique(matches.begin(), matches.end()), matches.end());
+
+    std::lock_guard<std::mutex> guard(mutex);
+    for (const auto &match : matches)
+    {
+        u32 second = match.first;
+        results.emplace_back(DateTime(Date().addDays(static_cast<int>(second / 86400)), Time(static_cast<int>(second % 86400))),
+                             initialSeed + second * step, match.second);
+    }
 }
 
 void RTCSearcher::cancelSearch()
@@ -18,6 +18,7 @@
  */
 
 #include "SeedSearcher.hpp"
+#include <algorithm>
 
 SeedSearcher::SeedSearcher(const std::vector<u32> &criteria) : criteria(criteria), searching(false), progress(0)
 {
@@ -37,3 +38,23 @@ int SeedSearcher::getProgress() const
 {
     return progress;
 }
+
+void SeedSearcher::startChunks(u32 count)
+{
+    chunks = OrderedResults<u32>(0, count, count, [](const u32 &left, const u32 &right) { return left < right; });
+}
+
+void SeedSearcher::addChunk(u32 chunk, std::vector<u32> &seeds)
+{
+    std::sort(seeds.begin(), seeds.end());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    chunks.add(chunk, std::move(seeds));
+}
+
+void SeedSearcher::finishChunks()
+{
+    chunks.finish();
+    results = chunks.take();
+    results.erase(std::unique(results.begin(), results.end()), results.end());
+}
@@ -21,6 +21,7 @@
 #define SEEDSEARCHER_HPP
 
 #include <Core/Util/Global.hpp>
+#include <Core/Util/OrderedResults.hpp>
 #include <atomic>
 #include <mutex>
 #include <vector>
@@ -41,6 +42,17 @@ protected:
     bool searching;
     std::atomic<u32> progress;
     std::mutex mutex;
+    OrderedResults<u32> chunks;
+
+    // Brute force searches split the lower 16 bits into chunks of 256, seed lists are split into chunks of 4096 seeds
+    static constexpr u32 lowChunkBits = 8;
+    static constexpr u32 lowChunks = 0x10000 >> lowChunkBits;
+    static constexpr u32 seedChunkSize = 0x1000;
+
+    void startChunks(u32 count);
+    void addChunk(u32 chunk, std::vector<u32> &seeds);
+    // Merges the chunks into the results without duplicates
+    void finishChunks();
 };
 
 #endif // SEEDSEARCHER_HPP
@@ -30,6 +30,11 @@ StationarySearcher3::StationarySearcher3(u16 tid, u16 sid, u8 genderRatio, Metho
 {
 }
 
+void StationarySearcher3::setResultBudget(const ResultBudget &budget)
+{
+    results.setBudget(budget);
+}
+
 void StationarySearcher3::startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max)
 {
     searching = true;
@@ -44,8 +49,7 @@ void StationarySearcher3::startSearch(const std::array<u8, 6> &min, const std::a
             }
             auto states = searchLocked16Bit(seed);
 
-            std::lock_guard<std::mutex> guard(mutex);
-            results.insert(results.end(), states.begin(), states.end());
+            results.add(states);
             progress++;
         }
     }
@@ -59,54 +63,30 @@ void StationarySearcher3::startSearch(const std::array<u8, 6> &min, const std::a
             }
             auto states = searchWishmaker(seed);
 
-            std::lock_guard<std::mutex> guard(mutex);
-            results.insert(results.end(), states.begin(), states.end());
+            results.add(states);
             progress++;
         }
     }
     else
     {
-        for (u8 hp = min[0]; hp <= max[0]; hp++)
-        {
-            for (u8 atk = min[1]; atk <= max[1]; atk++)
-            {
-                for (u8 def = min[2]; def <= max[2]; def++)
-                {
-                    for (u8 spa = min[3]; spa <= max[3]; spa++)
-                    {
-                        for (u8 spd = min[4]; spd <= max[4]; spd++)
-                        {
-                            for (u8 spe = min[5]; spe <= max[5]; spe++)
-                            {
-                                if (!searching)
-                                {
-                                    return;
-                                }
-
-                                auto states = search(hp, atk, def, spa, spd, spe);
-
-                                std::lock_guard<std::mutex> guard(mutex);
-                                results.insert(results.end(), states.begin(), states.end());
-                                progress++;
-                            }
-                        }
-                    }
-                }
-            }
-        }
+        searchIVs(min, max, searching, progress, [&](u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) {
+            auto states = search(hp, atk, def, spa, spd, spe);
+
+            results.add(states);
+            progress++;
+        });
     }
 }
 
 void StationarySearcher3::cancelSearch()
 {
     searching = false;
+    results.cancel();
 }
 
 std::vector<State> StationarySearcher3::getResults()
 {
-    std::lock_guard<std::mutex> guard(mutex);
-    auto data = std::move(results);
-    return data;
+    return results.take();
 }
 
 int StationarySearcher3::getProgress() const
@@ -135,7 +115,6 @@ std::vector<State> StationarySearcher3::searchMethod124(u8 hp, u8 atk, u8 def, u
     State state;
 
     state.setIVs(hp, atk, def, spa, spd, spe);
-    state.calculateHiddenPower();
 
     if (!filter.compareHiddenPower(state))
     {
@@ -182,7 +161,6 @@ std::vector<State> StationarySearcher3::searchMethod1Reverse(u8 hp, u8 atk, u8 d
     State state;
 
     state.setIVs(hp, atk, def, spa, spd, spe);
-    state.calculateHiddenPower();
 
     if (!filter.compareHiddenPower(state))
     {
@@ -249,7 +227,6 @@ std::vector<State> StationarySearcher3::searchLocked16Bit(u16 seed) const
     state.setShiny<8>(tsv, high ^ low);
     state.setSeed(seed);
     state.setIVs(iv1, iv2);
-    state.calculateHiddenPower();
 
     if (filter.compareState(state))
     {
@@ -279,7 +256,6 @@ std::vector<State> StationarySearcher3::searchWishmaker(u16 seed) const
     state.setShiny<8>(20043, high ^ low);
     state.setSeed(seed);
     state.setIVs(iv1, iv2);
-    state.calculateHiddenPower();
 
     if (filter.compareState(state))
     {
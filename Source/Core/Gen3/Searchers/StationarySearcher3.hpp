@@ -23,13 +23,14 @@
 #include <Core/Parents/Searchers/StationarySearcher.hpp>
 #include <Core/Parents/States/State.hpp>
 #include <Core/RNG/RNGCache.hpp>
-#include <mutex>
+#include <Core/Util/ResultStore.hpp>
 
 class StationarySearcher3 : public StationarySearcher
 {
 public:
     StationarySearcher3() = default;
     StationarySearcher3(u16 tid, u16 sid, u8 genderRatio, Method method, const StateFilter &filter);
+    void setResultBudget(const ResultBudget &budget);
     void startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max);
     void cancelSearch();
     std::vector<State> getResults();
@@ -41,8 +42,7 @@ private:
 
     bool searching;
     int progress;
-    std::vector<State> results;
-    std::mutex mutex;
+    ResultStore<State> results;
 
     std::vector<State> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
     std::vector<State> searchMethod124(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
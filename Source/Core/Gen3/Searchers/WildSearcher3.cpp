@@ -32,50 +32,32 @@ void WildSearcher3::setEncounterArea(const EncounterArea3 &encounterArea)
     this->encounterArea = encounterArea;
 }
 
+void WildSearcher3::setResultBudget(const ResultBudget &budget)
+{
+    results.setBudget(budget);
+}
+
 void WildSearcher3::startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max)
 {
     searching = true;
 
-    for (u8 hp = min[0]; hp <= max[0]; hp++)
-    {
-        for (u8 atk = min[1]; atk <= max[1]; atk++)
-        {
-            for (u8 def = min[2]; def <= max[2]; def++)
-            {
-                for (u8 spa = min[3]; spa <= max[3]; spa++)
-                {
-                    for (u8 spd = min[4]; spd <= max[4]; spd++)
-                    {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
-                        {
-                            if (!searching)
-                            {
-                                return;
-                            }
-
-                            auto states = search(hp, atk, def, spa, spd, spe);
+    searchIVs(min, max, searching, progress, [&](u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) {
+        auto states = search(hp, atk, def, spa, spd, spe);
 
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
-                        }
-                    }
-                }
-            }
-        }
-    }
+        results.add(states);
+        progress++;
+    });
 }
 
 void WildSearcher3::cancelSearch()
 {
     searching = false;
+    results.cancel();
 }
 
 std::vector<WildState> WildSearcher3::getResults()
 {
-    std::lock_guard<std::mutex> guard(mutex);
-    auto data = std::move(results);
-    return data;
+    return results.take();
 }
 
 int WildSearcher3::getProgress() const
@@ -89,7 +71,6 @@ std::vector<WildState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 s
 
     WildState state;
     state.setIVs(hp, atk, def, spa, spd, spe);
-    state.calculateHiddenPower();
     if (!filter.compareHiddenPower(state))
     {
         return states;
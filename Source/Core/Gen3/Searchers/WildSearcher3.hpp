@@ -24,7 +24,7 @@
 #include <Core/Parents/Searchers/WildSearcher.hpp>
 #include <Core/Parents/States/WildState.hpp>
 #include <Core/RNG/RNGCache.hpp>
-#include <mutex>
+#include <Core/Util/ResultStore.hpp>
 
 class WildSearcher3 : public WildSearcher
 {
@@ -32,6 +32,7 @@ public:
     WildSearcher3() = default;
     WildSearcher3(u16 tid, u16 sid, u8 genderRatio, Method method, const StateFilter &filter);
     void setEncounterArea(const EncounterArea3 &encounterArea);
+    void setResultBudget(const ResultBudget &budget);
     void startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max);
     void cancelSearch();
     std::vector<WildState> getResults();
@@ -43,8 +44,7 @@ private:
 
     bool searching;
     int progress;
-    std::vector<WildState> results;
-    std::mutex mutex;
+    ResultStore<WildState> results;
 
     std::vector<WildState> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
 };
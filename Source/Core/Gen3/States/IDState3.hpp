@@ -31,6 +31,19 @@ public:
     {
         tsv = (tid ^ sid) >> 3;
     }
+
+    IDState3(u32 seed, u32 advance, u16 tid, u16 sid) : IDState(advance, tid, sid), seed(seed)
+    {
+        tsv = (tid ^ sid) >> 3;
+    }
+
+    u32 getSeed() const
+    {
+        return seed;
+    }
+
+private:
+    u32 seed;
 };
 
 #endif // IDSTATE3_HPP
@@ -22,6 +22,11 @@
 #include <Core/RNG/LCRNG.hpp>
 #include <Core/RNG/RNGCache.hpp>
 #include <Core/RNG/RNGEuclidean.hpp>
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <map>
+#include <mutex>
 
 namespace PIDIVCalculator
 {
@@ -37,10 +42,8 @@ namespace PIDIVCalculator
             state.setIV(5, iv2 & 0x1f);
         }
 
-        std::vector<PIDIVState> calcMethod124(u32 pid)
+        void calcMethod124(u32 pid, std::vector<PIDIVState> &states)
         {
-            std::vector<PIDIVState> states;
-
             RNGCache cache(Method::Method1);
 
             auto seeds = cache.recoverLower16BitsPID(pid);
@@ -68,14 +71,10 @@ namespace PIDIVCalculator
                 states.emplace_back(state2);
                 states.emplace_back(state3);
             }
-
-            return states;
         }
 
-        std::vector<PIDIVState> calcMethod124Wild(u32 pid)
+        void calcMethod124Wild(u32 pid, std::vector<PIDIVState> &states)
         {
-            std::vector<PIDIVState> states;
-
             RNGCache cache(Method::Method1);
 
             auto seeds = cache.recoverLower16BitsPID(pid);
@@ -118,14 +117,10 @@ namespace PIDIVCalculator
 
                 } while ((testPID % 25) != (pid % 25));  
             }
-
-            return states;
         }
 
-        std::vector<PIDIVState> calcMethodXDColo(u32 pid)
+        void calcMethodXDColo(u32 pid, std::vector<PIDIVState> &states)
         {
-            std::vector<PIDIVState> states;
-
             auto seeds = RNGEuclidean::recoverLower16BitsPID(pid);
             for (const auto &pair : seeds)
             {
@@ -142,86 +137,49 @@ namespace PIDIVCalculator
 
                 states.emplace_back(state);
             }
-
-            return states;
         }
 
-        std::vector<PIDIVState> calcMethodChannel(u32 pid)
+        void calcMethodChannel(u32 pid, std::vector<PIDIVState> &states)
         {
-            std::vector<PIDIVState> states;
-
             // Whether PID is xored or unxored is determined by SID which we don't know by only providing a PID
             // So we have to check both xored and unxored and recalculate the PID to see if we have a match
 
-            auto seeds = RNGEuclidean::recoverLower16BitsPID(pid);
-            for (const auto &pair : seeds)
+            for (u32 search : { pid, pid ^ 0x80000000 })
             {
-                XDRNGR backward(pair.first);
-                u16 sid = backward.nextUShort();
-                u32 seed = backward.next();
-
-                XDRNG forward(seed);
-                forward.advance(1);
-
-                u16 high = forward.nextUShort();
-                u16 low = forward.nextUShort();
-
-                if ((low > 7 ? 0 : 1) != (high ^ 40122 ^ sid))
+                auto seeds = RNGEuclidean::recoverLower16BitsPID(search);
+                for (const auto &pair : seeds)
                 {
-                    high ^= 0x8000;
-                }
+                    XDRNGR backward(pair.first);
+                    u16 sid = backward.nextUShort();
+                    u32 seed = backward.next();
 
-                u32 val = static_cast<u32>((high << 16) | low);
-                if (val == pid) // PID matches based on SID
-                {
-                    forward.advance(3);
+                    XDRNG forward(seed);
+                    forward.advance(1);
 
-                    PIDIVState state(seed, Method::Channel);
+                    u16 high = forward.nextUShort();
+                    u16 low = forward.nextUShort();
 
-                    for (u8 i : { 0, 1, 2, 5, 3, 4 })
+                    if ((low > 7 ? 0 : 1) != (high ^ 40122 ^ sid))
                     {
-                        state.setIV(i, forward.next() >> 27);
+                        high ^= 0x8000;
                     }
 
-                    states.emplace_back(state);
-                }
-            }
-
-            auto seedsXOR = RNGEuclidean::recoverLower16BitsPID(pid ^ 0x80000000);
-            for (const auto &pair : seedsXOR)
-            {
-                XDRNGR backward(pair.first);
-                u16 sid = backward.nextUShort();
-                u32 seed = backward.next();
-
-                XDRNG forward(seed);
-                forward.advance(1);
-
-                u16 high = forward.nextUShort();
-                u16 low = forward.nextUShort();
+                    u32 val = static_cast<u32>((high << 16) | low);
+                    if (val == pid) // PID matches based on SID
+                    {
+                        forward.advance(3);
 
-                if ((low > 7 ? 0 : 1) != (high ^ 40122 ^ sid))
-                {
-                    high ^= 0x8000;
-                }
+                        PIDIVState state(seed, Method::Channel);
 
-                u32 val = static_cast<u32>((high << 16) | low);
-                if (val == pid) // PID matches based on SID
-                {
-                    forward.advance(3);
+                        for (u8 i : { 0, 1, 2, 5, 3, 4 })
+                        {
+                            state.setIV(i, forward.next() >> 27);
+                        }
 
-                    PIDIVState state(seed, Method::Channel);
-
-                    for (u8 i : { 0, 1, 2, 5, 3, 4 })
-                    {
-                        state.setIV(i, forward.next() >> 27);
+                        states.emplace_back(state);
                     }
-
-                    states.emplace_back(state);
                 }
             }
-
-            return states;
         }
     }
 
@@ -229,13 +187,9 @@ namespace PIDIVCalculator
     {
         std::vector<PIDIVState> states;
 
-        auto results1 = calcMethod124(pid);
-        auto results2 = calcMethodXDColo(pid);
-        auto results3 = calcMethodChannel(pid);
-
-        states.insert(states.end(), results1.begin(), results1.end());
-        states.insert(states.end(), results2.begin(), results2.end());
-        states.insert(states.end(), results3.begin(), results3.end());
+        calcMethod124(pid, states);
+        calcMethodXDColo(pid, states);
+        calcMethodChannel(pid, states);
 
         return states;
     }
@@ -244,10 +198,81 @@ namespace PIDIVCalculator
     {
         std::vector<PIDIVState> states;
 
-        auto results = calcMethod124Wild(pid);
-
-        states.insert(states.end(), results.begin(), results.end());
+        calcMethod124Wild(pid, states);
 
         return states;
     }
+
+    void calculateIVs(const u32 *pids, const std::array<u8, 6> *ivs, size_t count, bool wild, int threads,
+                      const std::function<void(size_t, const std::vector<PIDIVState> &)> &callback)
+    {
+        std::atomic<size_t> next(0);
+        std::mutex mutex;
+        size_t delivered = 0;
+        std::map<size_t, std::vector<PIDIVState>> completed;
+
+        auto search = [&] {
+            // Reused between PIDs so each thread only allocates while its result buffer grows
+            std::vector<PIDIVState> states;
+            for (size_t index = next++; index < count; index = next++)
+            {
+                states.clear();
+
+                u32 pid = pids[index];
+                if (wild)
+                {
+                    calcMethod124Wild(pid, states);
+                }
+                else
+                {
+                    calcMethod124(pid, states);
+                    calcMethodXDColo(pid, states);
+                    calcMethodChannel(pid, states);
+                }
+
+                if (ivs)
+                {
+                    const auto &target = ivs[index];
+                    states.erase(std::remove_if(states.begin(), states.end(),
+                                                [&target](const PIDIVState &state) {
+                                                    for (u8 i = 0; i < 6; i++)
+                                                    {
+                                                        if (state.getIV(i) != target[i])
+                                                        {
+                                                            return true;
+                                                        }
+                                                    }
+                                                    return false;
+                                                }),
+                                 states.end());
+                }
+
+                // Results are handed out in PID order, holding back any that finish early
+                std::lock_guard<std::mutex> guard(mutex);
+                if (index != delivered)
+                {
+                    completed.emplace(index, states);
+                    continue;
+                }
+
+                callback(delivered++, states);
+                for (auto it = completed.begin(); it != completed.end() && it->first == delivered; it = completed.erase(it))
+                {
+                    callback(delivered++, it->second);
+                }
+            }
+        };
+
+        std::vector<std::future<void>> threadContainer;
+        for (int i = 1; i < threads; i++)
+        {
+            threadContainer.emplace_back(std::async(std::launch::async, search));
+        }
+        search();
+
+        for (auto &thread : threadContainer)
+        {
+            thread.wait();
+        }
+    }
 }
@@ -21,12 +21,19 @@
 #define PIDIVCALCULATOR_HPP
 
 #include <Core/Gen3/States/PIDIVState.hpp>
+#include <array>
+#include <functional>
 #include <vector>
 
 namespace PIDIVCalculator
 {
     std::vector<PIDIVState> calculateIVs(u32 pid);
     std::vector<PIDIVState> calculateWildIVs(u32 pid);
+
+    // Reverses count PIDs across threads, ivs optionally filters each PID. wild uses the Method H1/H2/H4 slot scan instead
+    // of Method 1/2/4, XD/Colo and Channel. callback is called once per PID, in order, with its index and results.
+    void calculateIVs(const u32 *pids, const std::array<u8, 6> *ivs, size_t count, bool wild, int threads,
+                      const std::function<void(size_t, const std::vector<PIDIVState> &)> &callback);
 };
 
 #endif // PIDIVCALCULATOR_HPP
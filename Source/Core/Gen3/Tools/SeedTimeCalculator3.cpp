@@ -18,35 +18,117 @@
  */
 
 #include "SeedTimeCalculator3.hpp"
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 namespace SeedTimeCalculator3
 {
-    std::vector<SeedTimeState3> calculateTimes(u32 seed, u32 advance, u16 year)
+    namespace
     {
-        std::vector<SeedTimeState3> states;
-
-        constexpr Date start;
-        Date date(year, 1, 1);
-        Date end(year, 12, 31);
+        // Minutes of a year grouped by the seed they produce
+        struct TimeTable
+        {
+            std::array<u32, 0x10001> offsets;
+            std::vector<u32> minutes;
+        };
 
-        for (; date <= end; date = date.addDays(1))
+        TimeTable computeTable(u16 year)
         {
+            constexpr Date start;
+            Date first(year, 1, 1);
+            int count = first.daysTo(Date(year, 12, 31)) + 1;
+
             // The if statement considering the year is to handle a bug the game has
             // If the year is greater then 2000 it does not count the days in that year
-            u16 days = start.daysTo(date) - (year > 2000 ? 366 : 0) + 1;
+            u16 base = start.daysTo(first) - (year > 2000 ? 366 : 0) + 1;
 
-            for (u8 hour = 0; hour < 24; hour++)
+            std::vector<u16> seeds(count * 1440);
+            for (int day = 0; day < count; day++)
             {
-                for (u8 minute = 0; minute < 60; minute++)
+                u16 days = base + day;
+                for (u8 hour = 0; hour < 24; hour++)
                 {
-                    u32 v = 1440 * days + 960 * (hour / 10) + 60 * (hour % 10) + 16 * (minute / 10) + (minute % 10);
-                    v = (v >> 16) ^ (v & 0xffff);
-                    if (v == seed)
+                    for (u8 minute = 0; minute < 60; minute++)
                     {
-                        states.emplace_back(DateTime(date, Time(hour, minute, 0)), advance);
+                        u32 v = 1440 * days + 960 * (hour / 10) + 60 * (hour % 10) + 16 * (minute / 10) + (minute % 10);
+                        seeds[day * 1440 + hour * 60 + minute] = static_cast<u16>((v >> 16) ^ (v & 0xffff));
                     }
                 }
             }
+
+            // Counting sort keeps the minutes of each seed in chronological order
+            TimeTable table {};
+            for (u16 seed : seeds)
+            {
+                table.offsets[seed + 1]++;
+            }
+            for (u32 seed = 0; seed < 0x10000; seed++)
+            {
+                table.offsets[seed + 1] += table.offsets[seed];
+            }
+
+            table.minutes.resize(seeds.size());
+            std::array<u32, 0x10000> next;
+            std::copy(table.offsets.begin(), table.offsets.end() - 1, next.begin());
+            for (u32 minute = 0; minute < seeds.size(); minute++)
+            {
+                table.minutes[next[seeds[minute]]++] = minute;
+            }
+
+            return table;
+        }
+
+        const TimeTable &getTable(u16 year)
+        {
+            static std::unordered_map<u16, std::unique_ptr<TimeTable>> cache;
+            static std::mutex mutex;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = cache.find(year);
+            if (it != cache.end())
+            {
+                return *it->second;
+            }
+
+            return *cache.emplace(year, std::make_unique<TimeTable>(computeTable(year))).first->second;
+        }
+
+        std::vector<SeedTimeState3> getTimes(const TimeTable &table, u32 seed, u32 advance, u16 year)
+        {
+            std::vector<SeedTimeState3> states;
+            if (seed > 0xffff)
+            {
+                return states;
+            }
+
+            Date first(year, 1, 1);
+            for (u32 i = table.offsets[seed]; i < table.offsets[seed + 1]; i++)
+            {
+                u32 minute = table.minutes[i];
+                states.emplace_back(DateTime(first.addDays(minute / 1440), Time((minute / 60) % 24, minute % 60, 0)), advance);
+            }
+
+            return states;
+        }
+    }
+
+    std::vector<SeedTimeState3> calculateTimes(u32 seed, u32 advance, u16 year)
+    {
+        return getTimes(getTable(year), seed, advance, year);
+    }
+
+    std::vector<std::vector<SeedTimeState3>> calculateTimes(const std::vector<std::pair<u32, u32>> &targets, u16 year)
+    {
+        const TimeTable &table = getTable(year);
+
+        std::vector<std::vector<SeedTimeState3>> states;
+        states.reserve(targets.size());
+        for (const auto &target : targets)
+        {
+            states.emplace_back(getTimes(table, target.first, target.second, year));
         }
 
         return states;
@@ -21,11 +21,16 @@
 #define SEEDTIMECALCULATOR3_HPP
 
 #include <Core/Gen3/States/SeedTimeState3.hpp>
+#include <utility>
 #include <vector>
 
 namespace SeedTimeCalculator3
 {
     std::vector<SeedTimeState3> calculateTimes(u32 seed, u32 advance, u16 year);
+
+    // Times of year for many seeds at once, in the order of targets. Each target is a seed and the advances to report.
+    std::vector<std::vector<SeedTimeState3>> calculateTimes(const std::vector<std::pair<u32, u32>> &targets, u16 year);
+
     u16 calculateOriginSeed(u32 seed);
 }
 
@@ -22,83 +22,56 @@
 #include <Core/Enum/Game.hpp>
 #include <Core/Gen4/EncounterArea4.hpp>
 #include <Core/Gen4/Profile4.hpp>
+#include <Core/Parents/EncounterTable.hpp>
 #include <Core/Parents/PersonalLoader.hpp>
 #include <Core/Parents/Slot.hpp>
 #include <Core/Resources/Resources.hpp>
 #include <algorithm>
-#include <cstring>
 #include <iterator>
+#include <mutex>
+#include <unordered_map>
 
 namespace Encounters4
 {
     namespace
     {
-        std::vector<std::vector<u8>> getData(Game game)
+        EncounterTable getTable(Game game)
         {
-            const u8 *data;
-            size_t size;
-            int offset;
-
             if (game == Game::Diamond)
             {
-                data = diamond.data();
-                size = diamond.size();
-                offset = 159;
+                return EncounterTable(diamond, 159);
             }
             else if (game == Game::Pearl)
             {
-                data = pearl.data();
-                size = pearl.size();
-                offset = 159;
+                return EncounterTable(pearl, 159);
             }
             else if (game == Game::Platinum)
             {
-                data = platinum.data();
-                size = platinum.size();
-                offset = 159;
+                return EncounterTable(platinum, 159);
             }
             else if (game == Game::HeartGold)
             {
-                data = heartgold.data();
-                size = heartgold.size();
-                offset = 192;
+                return EncounterTable(heartgold, 192);
             }
             else
             {
-                data = soulsilver.data();
-                size = soulsilver.size();
-                offset = 192;
-            }
-
-            std::vector<std::vector<u8>> encounters;
-            for (size_t i = 0; i < size; i += offset)
-            {
-                std::vector<u8> entry(offset);
-                std::memcpy(entry.data(), data + i, offset);
-                encounters.emplace_back(entry);
+                return EncounterTable(soulsilver, 192);
             }
-
-            return encounters;
-        }
-
-        u16 getValue(const std::vector<u8> &data, int offset)
-        {
-            return static_cast<u16>(data[offset] << 8) | data[offset + 1];
         }
 
-        void modifyRadio(std::vector<Slot> &mons, const std::vector<u8> &data, const PersonalInfo *info, int radio)
+        void modifyRadio(std::vector<Slot> &mons, const EncounterEntry &data, const PersonalInfo *info, int radio)
         {
             u16 specie1;
             u16 specie2;
             if (radio == 1)
             {
-                specie1 = getValue(data, 88);
-                specie2 = getValue(data, 90);
+                specie1 = data.getBigEndian(88);
+                specie2 = data.getBigEndian(90);
             }
             else if (radio == 2)
             {
-                specie1 = getValue(data, 92);
-                specie2 = getValue(data, 94);
+                specie1 = data.getBigEndian(92);
+                specie2 = data.getBigEndian(94);
             }
             else
             {
@@ -111,19 +84,19 @@ namespace Encounters4
             mons[5].setSpecie(specie2, info[specie2]);
         }
 
-        void modifyTime(std::vector<Slot> &mons, const std::vector<u8> &data, const PersonalInfo *info, int time)
+        void modifyTime(std::vector<Slot> &mons, const EncounterEntry &data, const PersonalInfo *info, int time)
         {
             u16 specie1;
             u16 specie2;
             if (time == 1)
             {
-                specie1 = getValue(data, 43);
-                specie2 = getValue(data, 45);
+                specie1 = data.getBigEndian(43);
+                specie2 = data.getBigEndian(45);
             }
             else if (time == 2)
             {
-                specie1 = getValue(data, 47);
-                specie2 = getValue(data, 49);
+                specie1 = data.getBigEndian(47);
+                specie2 = data.getBigEndian(49);
             }
             else
             {
@@ -134,34 +107,34 @@ namespace Encounters4
             mons[3].setSpecie(specie2, info[specie2]);
         }
 
-        void modifyDual(std::vector<Slot> &mons, const std::vector<u8> &data, const PersonalInfo *info, Game dual)
+        void modifyDual(std::vector<Slot> &mons, const EncounterEntry &data, const PersonalInfo *info, Game dual)
         {
             u16 specie1;
             u16 specie2;
             if (dual == Game::Ruby)
             {
-                specie1 = getValue(data, 59);
-                specie2 = getValue(data, 61);
+                specie1 = data.getBigEndian(59);
+                specie2 = data.getBigEndian(61);
             }
             else if (dual == Game::Sapphire)
             {
-                specie1 = getValue(data, 63);
-                specie2 = getValue(data, 65);
+                specie1 = data.getBigEndian(63);
+                specie2 = data.getBigEndian(65);
             }
             else if (dual == Game::Emerald)
             {
-                specie1 = getValue(data, 67);
-                specie2 = getValue(data, 69);
+                specie1 = data.getBigEndian(67);
+                specie2 = data.getBigEndian(69);
             }
             else if (dual == Game::FireRed)
             {
-                specie1 = getValue(data, 71);
-                specie2 = getValue(data, 73);
+                specie1 = data.getBigEndian(71);
+                specie2 = data.getBigEndian(73);
             }
             else if (dual == Game::LeafGreen)
             {
-                specie1 = getValue(data, 75);
-                specie2 = getValue(data, 77);
+                specie1 = data.getBigEndian(75);
+                specie2 = data.getBigEndian(77);
             }
             else
             {
@@ -172,11 +145,11 @@ namespace Encounters4
             mons[9].setSpecie(specie2, info[specie2]);
         }
 
-        void modifyRadar(std::vector<Slot> &mons, const std::vector<u8> &data, const PersonalInfo *info, bool radar)
+        void modifyRadar(std::vector<Slot> &mons, const EncounterEntry &data, const PersonalInfo *info, bool radar)
         {
             if (radar)
             {
-                u16 species[4] = { getValue(data, 51), getValue(data, 53), getValue(data, 55), getValue(data, 57) };
+                u16 species[4] = { data.getBigEndian(51), data.getBigEndian(53), data.getBigEndian(55), data.getBigEndian(57) };
                 mons[4].setSpecie(species[0], info[species[0]]);
                 mons[5].setSpecie(species[1], info[species[1]]);
                 mons[10].setSpecie(species[2], info[species[2]]);
@@ -184,7 +157,7 @@ namespace Encounters4
             }
         }
 
-        void modifySwarmHGSS(std::vector<Slot> &mons, const std::vector<u8> &data, const PersonalInfo *info, Encounter encounter,
+        void modifySwarmHGSS(std::vector<Slot> &mons, const EncounterEntry &data, const PersonalInfo *info, Encounter encounter,
                              bool swarm)
         {
             if (swarm)
@@ -192,19 +165,19 @@ namespace Encounters4
                 u16 specie;
                 if (encounter == Encounter::Grass)
                 {
-                    specie = getValue(data, 184);
+                    specie = data.getBigEndian(184);
                 }
                 else if (encounter == Encounter::Surfing)
                 {
-                    specie = getValue(data, 186);
+                    specie = data.getBigEndian(186);
                 }
                 else if (encounter == Encounter::GoodRod)
                 {
-                    specie = getValue(data, 188);
+                    specie = data.getBigEndian(188);
                 }
                 else if (encounter == Encounter::SuperRod)
                 {
-                    specie = getValue(data, 190);
+                    specie = data.getBigEndian(190);
                 }
                 else
                 {
@@ -216,24 +189,24 @@ namespace Encounters4
             }
         }
 
-        void modifySwarmDPPt(std::vector<Slot> &mons, const std::vector<u8> &data, const PersonalInfo *info, bool swarm)
+        void modifySwarmDPPt(std::vector<Slot> &mons, const EncounterEntry &data, const PersonalInfo *info, bool swarm)
         {
             if (swarm)
             {
-                u16 species[2] = { getValue(data, 39), getValue(data, 41) };
+                u16 species[2] = { data.getBigEndian(39), data.getBigEndian(41) };
                 mons[0].setSpecie(species[0], info[species[0]]);
                 mons[1].setSpecie(species[1], info[species[1]]);
             }
         }
 
-        std::vector<EncounterArea4> getHGSS(const std::vector<u8> &data, const Profile4 &profile, const PersonalInfo *info,
+        std::vector<EncounterArea4> getHGSS(const EncounterEntry &data, const Profile4 &profile, const PersonalInfo *info,
                                             Encounter encounter, int time)
         {
             std::vector<EncounterArea4> encounters;
-            u8 location = data[0];
+            u8 location = data.getByte(0);
 
             // Grass
-            if (data[1] == 1)
+            if (data.getByte(1) == 1)
             {
                 int timeOffset = (time * 2) + 1;
 
@@ -241,8 +214,8 @@ namespace Encounters4
                 std::vector<Slot> bcc;
                 for (int i = 0; i < 12; i++)
                 {
-                    u8 level = data[4 + i * 7];
-                    u16 specie = getValue(data, 4 + timeOffset + i * 7);
+                    u8 level = data.getByte(4 + i * 7);
+                    u16 specie = data.getBigEndian(4 + timeOffset + i * 7);
                     grass.emplace_back(specie, level, info[specie]);
                 }
 
@@ -255,21 +228,21 @@ namespace Encounters4
             }
 
             // Rock Smash
-            if (data[2] == 1)
+            if (data.getByte(2) == 1)
             {
                 std::vector<Slot> rock;
                 for (int i = 0; i < 2; i++)
                 {
-                    u8 min = data[96 + i * 4];
-                    u8 max = data[97 + i * 4];
-                    u16 specie = getValue(data, 98 + i * 4);
+                    u8 min = data.getByte(96 + i * 4);
+                    u8 max = data.getByte(97 + i * 4);
+                    u16 specie = data.getBigEndian(98 + i * 4);
                     rock.emplace_back(specie, min, max, info[specie]);
                 }
                 encounters.emplace_back(location, Encounter::RockSmash, rock);
             }
 
             // Water
-            if (data[3] == 1)
+            if (data.getByte(3) == 1)
             {
                 std::vector<Slot> surf;
                 std::vector<Slot> old;
@@ -277,19 +250,19 @@ namespace Encounters4
                 std::vector<Slot> super;
                 for (int i = 0; i < 5; i++)
                 {
-                    u8 min = data[104 + i * 4];
-                    u8 max = data[105 + i * 4];
-                    u16 specie = getValue(data, 106 + i * 4);
+                    u8 min = data.getByte(104 + i * 4);
+                    u8 max = data.getByte(105 + i * 4);
+                    u16 specie = data.getBigEndian(106 + i * 4);
                     surf.emplace_back(specie, min, max, info[specie]);
 
-                    min = data[124 + i * 4];
-                    max = data[125 + i * 4];
-                    specie = getValue(data, 126 + i * 4);
+                    min = data.getByte(124 + i * 4);
+                    max = data.getByte(125 + i * 4);
+                    specie = data.getBigEndian(126 + i * 4);
                     old.emplace_back(specie, min, max, info[specie]);
 
-                    min = data[144 + i * 4];
-                    max = data[145 + i * 4];
-                    specie = getValue(data, 146 + i * 4);
+                    min = data.getByte(144 + i * 4);
+                    max = data.getByte(145 + i * 4);
+                    specie = data.getBigEndian(146 + i * 4);
 
                     // Replace Corsula with Staryu at night
                     // Replace slot 3 with Gyrados at Mt. Silver 2F at night
@@ -307,9 +280,9 @@ namespace Encounters4
 
                     good.emplace_back(specie, min, max, info[specie]);
 
-                    min = data[164 + i * 4];
-                    max = data[165 + i * 4];
-                    specie = getValue(data, 166 + i * 4);
+                    min = data.getByte(164 + i * 4);
+                    max = data.getByte(165 + i * 4);
+                    specie = data.getBigEndian(166 + i * 4);
 
                     // Replace Corsula with Staryu at night
                     // Replace slot 1 with Gyrados at Mt. Silver 2F at night
@@ -342,19 +315,19 @@ namespace Encounters4
             return encounters;
         }
 
-        std::vector<EncounterArea4> getDPPt(const std::vector<u8> &data, const Profile4 &profile, const PersonalInfo *info, int time)
+        std::vector<EncounterArea4> getDPPt(const EncounterEntry &data, const Profile4 &profile, const PersonalInfo *info, int time)
         {
             std::vector<EncounterArea4> encounters;
-            u8 location = data[0];
+            u8 location = data.getByte(0);
 
             // Grass
-            if (data[1] == 1)
+            if (data.getByte(1) == 1)
             {
                 std::vector<Slot> grass;
                 for (int i = 0; i < 12; i++)
                 {
-                    u8 level = data[3 + i * 3];
-                    u16 specie = getValue(data, 4 + i * 3);
+                    u8 level = data.getByte(3 + i * 3);
+                    u16 specie = data.getBigEndian(4 + i * 3);
                     grass.emplace_back(specie, level, info[specie]);
                 }
 
@@ -367,7 +340,7 @@ namespace Encounters4
             }
 
             // Water
-            if (data[2] == 1)
+            if (data.getByte(2) == 1)
             {
                 std::vector<Slot> surf;
                 std::vector<Slot> old;
@@ -375,24 +348,24 @@ namespace Encounters4
                 std::vector<Slot> super;
                 for (int i = 0; i < 5; i++)
                 {
-                    u8 min = data[79 + i * 4];
-                    u8 max = data[80 + i * 4];
-                    u16 specie = getValue(data, 81 + i * 4);
+                    u8 min = data.getByte(79 + i * 4);
+                    u8 max = data.getByte(80 + i * 4);
+                    u16 specie = data.getBigEndian(81 + i * 4);
                     surf.emplace_back(specie, min, max, info[specie]);
 
-                    min = data[99 + i * 4];
-                    max = data[100 + i * 4];
-                    specie = getValue(data, 101 + i * 4);
+                    min = data.getByte(99 + i * 4);
+                    max = data.getByte(100 + i * 4);
+                    specie = data.getBigEndian(101 + i * 4);
                     old.emplace_back(specie, min, max, info[specie]);
 
-                    min = data[119 + i * 4];
-                    max = data[120 + i * 4];
-                    specie = getValue(data, 121 + i * 4);
+                    min = data.getByte(119 + i * 4);
+                    max = data.getByte(120 + i * 4);
+                    specie = data.getBigEndian(121 + i * 4);
                     good.emplace_back(specie, min, max, info[specie]);
 
-                    min = data[139 + i * 4];
-                    max = data[140 + i * 4];
-                    specie = getValue(data, 141 + i * 4);
+                    min = data.getByte(139 + i * 4);
+                    max = data.getByte(140 + i * 4);
+                    specie = data.getBigEndian(141 + i * 4);
                     super.emplace_back(specie, min, max, info[specie]);
                 }
 
@@ -405,19 +378,35 @@ namespace Encounters4
         }
     }
 
-    std::vector<EncounterArea4> getEncounters(Encounter encounter, int time, const Profile4 &profile)
+    const std::vector<EncounterArea4> &getEncounters(Encounter encounter, int time, const Profile4 &profile)
     {
+        static std::unordered_map<u64, std::vector<EncounterArea4>> cache;
+        static std::mutex mutex;
+
+        Game version = profile.getVersion();
+        u64 key = static_cast<u64>(version) | (static_cast<u64>(encounter) << 16) | (static_cast<u64>(time) << 24)
+            | (static_cast<u64>(profile.getRadio()) << 32) | (static_cast<u64>(profile.getDualSlot()) << 40)
+            | (static_cast<u64>(profile.getRadar()) << 56) | (static_cast<u64>(profile.getSwarm()) << 57);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = cache.find(key);
+        if (it != cache.end())
+        {
+            return it->second;
+        }
+
         std::vector<EncounterArea4> encounters;
         auto info = PersonalLoader4::getPersonal();
 
-        for (const auto &data : getData(profile.getVersion()))
+        EncounterTable table = getTable(version);
+        for (size_t i = 0; i < table.size(); i++)
         {
             auto areas
-                = (profile.getVersion() & Game::HGSS) ? getHGSS(data, profile, info, encounter, time) : getDPPt(data, profile, info, time);
+                = (version & Game::HGSS) ? getHGSS(table[i], profile, info, encounter, time) : getDPPt(table[i], profile, info, time);
             std::copy_if(areas.begin(), areas.end(), std::back_inserter(encounters),
                          [&encounter](const EncounterArea4 &area) { return area.getEncounter() == encounter; });
         }
 
-        return encounters;
+        return cache.emplace(key, std::move(encounters)).first->second;
     }
 }
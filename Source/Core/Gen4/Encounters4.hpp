@@ -29,7 +29,7 @@ class Profile4;
 
 namespace Encounters4
 {
-    std::vector<EncounterArea4> getEncounters(Encounter encounter, int time, const Profile4 &profile);
+    const std::vector<EncounterArea4> &getEncounters(Encounter encounter, int time, const Profile4 &profile);
 }
 
 #endif // ENCOUNTERS4_HPP
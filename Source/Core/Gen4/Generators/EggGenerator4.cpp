@@ -197,7 +197,6 @@ std::vector<EggState4> EggGenerator4::generateDPPtIVs(u32 seed) const
         u16 par[3] = { par1, par2, par3 };
 
         setInheritance<true>(daycare, state, inh, par);
-        state.calculateHiddenPower();
 
         if (filter.compareIVs(state))
         {
@@ -235,7 +234,6 @@ std::vector<EggState4> EggGenerator4::generateHGSSIVs(u32 seed) const
         u16 par[3] = { par1, par2, par3 };
 
         setInheritance<false>(daycare, state, inh, par);
-        state.calculateHiddenPower();
 
         if (filter.compareIVs(state))
         {
@@ -115,7 +115,6 @@ std::vector<PokeWalkerState> PokeWalkerGenerator::generatePokeWalkerIVs(u32 seed
         u16 iv2 = rng.nextUShort();
 
         state.setIVs(iv1, iv2);
-        state.calculateHiddenPower();
 
         if (filter.compareIVs(state))
         {
@@ -23,6 +23,40 @@
 #include <Core/Parents/Filters/StateFilter.hpp>
 #include <Core/RNG/LCRNG.hpp>
 
+namespace
+{
+    // Leads that share a code path in the Method J/K kernels, anything that isn't covered is treated as cute charm
+    u8 getLeadIndex(Lead lead)
+    {
+        if (lead == Lead::None)
+        {
+            return 0;
+        }
+        else if (lead == Lead::Synchronize)
+        {
+            return 1;
+        }
+        return 2;
+    }
+
+    u8 getCuteCharmBuffer(Lead lead)
+    {
+        switch (lead)
+        {
+        case Lead::CuteCharm25M:
+            return 0xC8;
+        case Lead::CuteCharm50M:
+            return 0x96;
+        case Lead::CuteCharm75M:
+            return 0x4B;
+        case Lead::CuteCharm875M:
+            return 0x32;
+        default:
+            return 0;
+        }
+    }
+}
+
 StationaryGenerator4::StationaryGenerator4(u32 initialAdvances, u32 maxAdvances, u16 tid, u16 sid, u8 genderRatio, Method method,
                                            const StateFilter &filter) :
     StationaryGenerator(initialAdvances, maxAdvances, tid, sid, genderRatio, method, filter)
@@ -31,6 +65,16 @@ StationaryGenerator4::StationaryGenerator4(u32 initialAdvances, u32 maxAdvances,
 
 std::vector<State> StationaryGenerator4::generate(u32 seed) const
 {
+    using Kernel = std::vector<State> (StationaryGenerator4::*)(u32) const;
+
+    // Method J/K kernels for each lead, see getLeadIndex
+    static constexpr Kernel methodJ[3] = { &StationaryGenerator4::generateMethodJ<Lead::None>,
+                                           &StationaryGenerator4::generateMethodJ<Lead::Synchronize>,
+                                           &StationaryGenerator4::generateMethodJ<Lead::CuteCharm> };
+    static constexpr Kernel methodK[3] = { &StationaryGenerator4::generateMethodK<Lead::None>,
+                                           &StationaryGenerator4::generateMethodK<Lead::Synchronize>,
+                                           &StationaryGenerator4::generateMethodK<Lead::CuteCharm> };
+
     switch (method)
     {
     case Method::Method1:
@@ -38,9 +82,9 @@ std::vector<State> StationaryGenerator4::generate(u32 seed) const
     case Method::Manaphy:
         return generateManaphy(seed);
     case Method::MethodJ:
-        return generateMethodJ(seed);
+        return (this->*methodJ[getLeadIndex(lead)])(seed);
     case Method::MethodK:
-        return generateMethodK(seed);
+        return (this->*methodK[getLeadIndex(lead)])(seed);
     case Method::WondercardIVs:
         return generateWonderCardIVs(seed);
     default:
@@ -74,7 +118,6 @@ std::vector<State> StationaryGenerator4::generateMethod1(u32 seed) const
         state.setNature(state.getPID() % 25);
 
         state.setIVs(iv1, iv2);
-        state.calculateHiddenPower();
 
         if (filter.compareState(state))
         {
@@ -120,7 +163,6 @@ std::vector<State> StationaryGenerator4::generateManaphy(u32 seed) const
         state.setNature(state.getPID() % 25);
 
         state.setIVs(iv1, iv2);
-        state.calculateHiddenPower();
 
         if (filter.compareState(state))
         {
@@ -132,6 +174,7 @@ std::vector<State> StationaryGenerator4::generateManaphy(u32 seed) const
     return states;
 }
 
+template <Lead leadType>
 std::vector<State> StationaryGenerator4::generateMethodJ(u32 seed) const
 {
     std::vector<State> states;
@@ -139,27 +182,7 @@ std::vector<State> StationaryGenerator4::generateMethodJ(u32 seed) const
     PokeRNG rng(seed);
     rng.advance(initialAdvances + offset);
 
-    u8 buffer = 0;
-    switch (lead)
-    {
-    case Lead::CuteCharmFemale:
-        buffer = 0;
-        break;
-    case Lead::CuteCharm25M:
-        buffer = 0xC8;
-        break;
-    case Lead::CuteCharm50M:
-        buffer = 0x96;
-        break;
-    case Lead::CuteCharm75M:
-        buffer = 0x4B;
-        break;
-    case Lead::CuteCharm875M:
-        buffer = 0x32;
-        break;
-    default:
-        break;
-    }
+    u8 buffer = getCuteCharmBuffer(lead);
 
     for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
     {
@@ -168,9 +191,8 @@ std::vector<State> StationaryGenerator4::generateMethodJ(u32 seed) const
 
         u16 first = go.nextUShort();
         u32 pid = 0;
-        switch (lead)
+        if constexpr (leadType == Lead::None)
         {
-        case Lead::None:
             // Get hunt nature
             state.setNature(first / 0xa3e);
             if (!filter.compareNature(state))
@@ -185,9 +207,9 @@ std::vector<State> StationaryGenerator4::generateMethodJ(u32 seed) const
                 u16 high = go.nextUShort();
                 pid = (high << 16) | low;
             } while (pid % 25 != state.getNature());
-
-            break;
-        case Lead::Synchronize:
+        }
+        else if constexpr (leadType == Lead::Synchronize)
+        {
             if ((first >> 15) == 0) // Successful synch
             {
                 state.setNature(synchNature);
@@ -209,9 +231,9 @@ std::vector<State> StationaryGenerator4::generateMethodJ(u32 seed) const
                 u16 high = go.nextUShort();
                 pid = (high << 16) | low;
             } while (pid % 25 != state.getNature());
-
-            break;
-        default: // Default to cover all cute charm cases
+        }
+        else // Cute charm
+        {
             if ((first / 0x5556) != 0) // Successful cute charm
             {
                 // Get nature
@@ -243,8 +265,6 @@ std::vector<State> StationaryGenerator4::generateMethodJ(u32 seed) const
                     pid = (high << 16) | low;
                 } while (pid % 25 != state.getNature());
             }
-
-            break;
         }
 
         state.setAbility(pid & 1);
@@ -256,7 +276,6 @@ std::vector<State> StationaryGenerator4::generateMethodJ(u32 seed) const
         u16 iv2 = go.nextUShort();
 
         state.setIVs(iv1, iv2);
-        state.calculateHiddenPower();
 
         if (filter.compareState(state))
         {
@@ -268,6 +287,7 @@ std::vector<State> StationaryGenerator4::generateMethodJ(u32 seed) const
     return states;
 }
 
+template <Lead leadType>
 std::vector<State> StationaryGenerator4::generateMethodK(u32 seed) const
 {
     std::vector<State> states;
@@ -275,27 +295,7 @@ std::vector<State> StationaryGenerator4::generateMethodK(u32 seed) const
     PokeRNG rng(seed);
     rng.advance(initialAdvances + offset);
 
-    u8 buffer = 0;
-    switch (lead)
-    {
-    case Lead::CuteCharmFemale:
-        buffer = 0;
-        break;
-    case Lead::CuteCharm25M:
-        buffer = 0xC8;
-        break;
-    case Lead::CuteCharm50M:
-        buffer = 0x96;
-        break;
-    case Lead::CuteCharm75M:
-        buffer = 0x4B;
-        break;
-    case Lead::CuteCharm875M:
-        buffer = 0x32;
-        break;
-    default:
-        break;
-    }
+    u8 buffer = getCuteCharmBuffer(lead);
 
     for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
     {
@@ -304,9 +304,8 @@ std::vector<State> StationaryGenerator4::generateMethodK(u32 seed) const
 
         u16 first = go.nextUShort();
         u32 pid = 0;
-        switch (lead)
+        if constexpr (leadType == Lead::None)
         {
-        case Lead::None:
             // Get hunt nature
             state.setNature(first % 25);
 
@@ -322,9 +321,9 @@ std::vector<State> StationaryGenerator4::generateMethodK(u32 seed) const
                 u16 high = go.nextUShort();
                 pid = (high << 16) | low;
             } while (pid % 25 != state.getNature());
-
-            break;
-        case Lead::Synchronize:
+        }
+        else if constexpr (leadType == Lead::Synchronize)
+        {
             if ((first & 1) == 0) // Successful synch
             {
                 state.setNature(synchNature);
@@ -346,9 +345,9 @@ std::vector<State> StationaryGenerator4::generateMethodK(u32 seed) const
                 u16 high = go.nextUShort();
                 pid = (high << 16) | low;
             } while (pid % 25 != state.getNature());
-
-            break;
-        default: // Default to cover all cute charm cases
+        }
+        else // Cute charm
+        {
             if ((first % 3) != 0) // Successfull cute charm
             {
                 // Get hunt nature
@@ -379,8 +378,6 @@ std::vector<State> StationaryGenerator4::generateMethodK(u32 seed) const
                     pid = (high << 16) | low;
                 } while (pid % 25 != state.getNature());
             }
-
-            break;
         }
 
         state.setAbility(pid & 1);
@@ -392,7 +389,6 @@ std::vector<State> StationaryGenerator4::generateMethodK(u32 seed) const
         u16 iv2 = go.nextUShort();
 
         state.setIVs(iv1, iv2);
-        state.calculateHiddenPower();
 
         if (filter.compareState(state))
         {
@@ -422,7 +418,6 @@ std::vector<State> StationaryGenerator4::generateWonderCardIVs(u32 seed) const
         u16 iv2 = go.nextUShort();
 
         state.setIVs(iv1, iv2);
-        state.calculateHiddenPower();
 
         if (filter.compareIVs(state))
         {
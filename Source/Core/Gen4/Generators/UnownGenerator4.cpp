@@ -194,7 +194,6 @@ std::vector<UnownState4> UnownGenerator4::generateMethodJ(u32 seed) const
         }
 
         state.setIVs(iv1, iv2);
-        state.calculateHiddenPower();
 
         if (filter.compareState(state) && filter.compareLetter(state))
         {
@@ -24,6 +24,65 @@
 #include <Core/Parents/Filters/StateFilter.hpp>
 #include <Core/RNG/LCRNG.hpp>
 #include <Core/Util/EncounterSlot.hpp>
+#include <algorithm>
+
+namespace
+{
+    // Encounters that share a code path in the Method J/K kernels
+    u8 getEncounterIndex(Encounter encounter)
+    {
+        switch (encounter)
+        {
+        case Encounter::Grass:
+            return 0;
+        case Encounter::Surfing:
+            return 1;
+        case Encounter::OldRod:
+        case Encounter::GoodRod:
+        case Encounter::SuperRod:
+            return 2;
+        case Encounter::RockSmash:
+            return 3;
+        case Encounter::BugCatchingContest:
+            return 4;
+        case Encounter::SafariZoneHGSS:
+            return 5;
+        default:
+            return 6;
+        }
+    }
+
+    // Leads that share a code path in the Method J/K kernels, anything that isn't covered is treated as cute charm
+    u8 getLeadIndex(Lead lead, bool hgss)
+    {
+        if (lead == Lead::None || (hgss && lead == Lead::SuctionCups))
+        {
+            return 0;
+        }
+        else if (lead == Lead::Synchronize)
+        {
+            return 1;
+        }
+        return 2;
+    }
+
+    u8 getCuteCharmBuffer(Lead lead)
+    {
+        switch (lead)
+        {
+        case Lead::CuteCharm25M:
+            return 0xC8;
+        case Lead::CuteCharm50M:
+            return 0x96;
+        case Lead::CuteCharm75M:
+            return 0x4B;
+        case Lead::CuteCharm875M:
+            return 0x32;
+        default:
+            return 0;
+        }
+    }
+}
 
 WildGenerator4::WildGenerator4(u32 initialAdvances, u32 maxAdvances, u16 tid, u16 sid, u8 genderRatio, Method method,
                                const StateFilter &filter, bool platinum) :
@@ -34,12 +93,53 @@ WildGenerator4::WildGenerator4(u32 initialAdvances, u32 maxAdvances, u16 tid, u1
 
 std::vector<WildState4> WildGenerator4::generate(u32 seed) const
 {
+    using Kernel = std::vector<WildState4> (WildGenerator4::*)(u32) const;
+
+    // Method J/K kernels for each encounter and lead, see getEncounterIndex and getLeadIndex
+    static constexpr Kernel methodJ[4][3]
+        = { { &WildGenerator4::generateMethodJ<Encounter::Grass, Lead::None>,
+              &WildGenerator4::generateMethodJ<Encounter::Grass, Lead::Synchronize>,
+              &WildGenerator4::generateMethodJ<Encounter::Grass, Lead::CuteCharm> },
+            { &WildGenerator4::generateMethodJ<Encounter::Surfing, Lead::None>,
+              &WildGenerator4::generateMethodJ<Encounter::Surfing, Lead::Synchronize>,
+              &WildGenerator4::generateMethodJ<Encounter::Surfing, Lead::CuteCharm> },
+            { &WildGenerator4::generateMethodJ<Encounter::OldRod, Lead::None>,
+              &WildGenerator4::generateMethodJ<Encounter::OldRod, Lead::Synchronize>,
+              &WildGenerator4::generateMethodJ<Encounter::OldRod, Lead::CuteCharm> },
+            { &WildGenerator4::generateMethodJ<Encounter::HeadButt, Lead::None>,
+              &WildGenerator4::generateMethodJ<Encounter::HeadButt, Lead::Synchronize>,
+              &WildGenerator4::generateMethodJ<Encounter::HeadButt, Lead::CuteCharm> } };
+
+    static constexpr Kernel methodK[7][3]
+        = { { &WildGenerator4::generateMethodK<Encounter::Grass, Lead::None>,
+              &WildGenerator4::generateMethodK<Encounter::Grass, Lead::Synchronize>,
+              &WildGenerator4::generateMethodK<Encounter::Grass, Lead::CuteCharm> },
+            { &WildGenerator4::generateMethodK<Encounter::Surfing, Lead::None>,
+              &WildGenerator4::generateMethodK<Encounter::Surfing, Lead::Synchronize>,
+              &WildGenerator4::generateMethodK<Encounter::Surfing, Lead::CuteCharm> },
+            { &WildGenerator4::generateMethodK<Encounter::OldRod, Lead::None>,
+              &WildGenerator4::generateMethodK<Encounter::OldRod, Lead::Synchronize>,
+              &WildGenerator4::generateMethodK<Encounter::OldRod, Lead::CuteCharm> },
+            { &WildGenerator4::generateMethodK<Encounter::RockSmash, Lead::None>,
+              &WildGenerator4::generateMethodK<Encounter::RockSmash, Lead::Synchronize>,
+              &WildGenerator4::generateMethodK<Encounter::RockSmash, Lead::CuteCharm> },
+            { &WildGenerator4::generateMethodK<Encounter::BugCatchingContest, Lead::None>,
+              &WildGenerator4::generateMethodK<Encounter::BugCatchingContest, Lead::Synchronize>,
+              &WildGenerator4::generateMethodK<Encounter::BugCatchingContest, Lead::CuteCharm> },
+            { &WildGenerator4::generateMethodK<Encounter::SafariZoneHGSS, Lead::None>,
+              &WildGenerator4::generateMethodK<Encounter::SafariZoneHGSS, Lead::Synchronize>,
+              &WildGenerator4::generateMethodK<Encounter::SafariZoneHGSS, Lead::CuteCharm> },
+            { &WildGenerator4::generateMethodK<Encounter::HeadButt, Lead::None>,
+              &WildGenerator4::generateMethodK<Encounter::HeadButt, Lead::Synchronize>,
+              &WildGenerator4::generateMethodK<Encounter::HeadButt, Lead::CuteCharm> } };
+
     switch (method)
     {
     case Method::MethodJ:
-        return generateMethodJ(seed);
+        // Method J only has special cases for grass, surfing and fishing
+        return (this->*methodJ[std::min<u8>(getEncounterIndex(encounter), 3)][getLeadIndex(lead, false)])(seed);
     case Method::MethodK:
-        return generateMethodK(seed);
+        return (this->*methodK[getEncounterIndex(encounter)][getLeadIndex(lead, true)])(seed);
     case Method::ChainedShiny:
         return generateChainedShiny(seed);
     default:
@@ -52,6 +152,7 @@ void WildGenerator4::setEncounterArea(const EncounterArea4 &encounterArea)
     this->encounterArea = encounterArea;
 }
 
+template <Encounter encounterType, Lead leadType>
 std::vector<WildState4> WildGenerator4::generateMethodJ(u32 seed) const
 {
     std::vector<WildState4> states;
@@ -59,30 +160,9 @@ std::vector<WildState4> WildGenerator4::generateMethodJ(u32 seed) const
     PokeRNG rng(seed);
     rng.advance(initialAdvances + offset);
 
-    u8 buffer = 0;
+    u8 buffer = getCuteCharmBuffer(lead);
     u8 thresh = encounter == Encounter::OldRod ? 25 : encounter == Encounter::GoodRod ? 50 : encounter == Encounter::SuperRod ? 75 : 0;
 
-    switch (lead)
-    {
-    case Lead::CuteCharmFemale:
-        buffer = 0;
-        break;
-    case Lead::CuteCharm25M:
-        buffer = 0xC8;
-        break;
-    case Lead::CuteCharm50M:
-        buffer = 0x96;
-        break;
-    case Lead::CuteCharm75M:
-        buffer = 0x4B;
-        break;
-    case Lead::CuteCharm875M:
-        buffer = 0x32;
-        break;
-    default:
-        break;
-    }
-
     for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
     {
         WildState4 state(initialAdvances + cnt);
@@ -92,9 +172,8 @@ std::vector<WildState4> WildGenerator4::generateMethodJ(u32 seed) const
 
         u16 first = go.nextUShort<true>(); // Encounter slot call, nibble call for fishing
 
-        switch (encounter)
+        if constexpr (encounterType == Encounter::Grass)
         {
-        case Encounter::Grass:
             state.setEncounterSlot(EncounterSlot::jSlot(first, encounter));
             if (!filter.compareEncounterSlot(state))
             {
@@ -103,8 +182,9 @@ std::vector<WildState4> WildGenerator4::generateMethodJ(u32 seed) const
 
             state.setLevel(encounterArea.calcLevel(state.getEncounterSlot()));
             occidentary += platinum ? 1 : 5; // Compensate for the game's advances after the battle ends
-            break;
-        case Encounter::Surfing:
+        }
+        else if constexpr (encounterType == Encounter::Surfing)
+        {
             state.setEncounterSlot(EncounterSlot::jSlot(first, encounter));
             if (!filter.compareEncounterSlot(state))
             {
@@ -113,10 +193,9 @@ std::vector<WildState4> WildGenerator4::generateMethodJ(u32 seed) const
 
             state.setLevel(encounterArea.calcLevel(state.getEncounterSlot(), go.nextUShort<true>()));
             occidentary += platinum ? 1 : 5; // Compensate for the game's advances after the battle ends
-            break;
-        case Encounter::OldRod:
-        case Encounter::GoodRod:
-        case Encounter::SuperRod:
+        }
+        else if constexpr (encounterType == Encounter::OldRod)
+        {
             if ((first / 656) >= thresh)
             {
                 continue;
@@ -130,15 +209,11 @@ std::vector<WildState4> WildGenerator4::generateMethodJ(u32 seed) const
 
             state.setLevel(encounterArea.calcLevel(state.getEncounterSlot(), go.nextUShort<true>()));
             occidentary += platinum ? 2 : 6; // Compensate for the game's advances after the battle ends
-            break;
-        default:
-            break;
         }
 
         u32 pid = 0;
-        switch (lead)
+        if constexpr (leadType == Lead::None)
         {
-        case Lead::None:
             // Get hunt nature
             state.setNature(go.nextUShort<true>() / 0xa3e);
 
@@ -154,9 +229,9 @@ std::vector<WildState4> WildGenerator4::generateMethodJ(u32 seed) const
                 u16 high = go.nextUShort<true>();
                 pid = static_cast<u32>((high << 16) | low);
             } while (pid % 25 != state.getNature());
-
-            break;
-        case Lead::Synchronize:
+        }
+        else if constexpr (leadType == Lead::Synchronize)
+        {
             if ((go.nextUShort<true>() >> 15) == 0) // Successful synch
             {
                 state.setNature(synchNature);
@@ -178,9 +253,9 @@ std::vector<WildState4> WildGenerator4::generateMethodJ(u32 seed) const
                 u16 high = go.nextUShort<true>();
                 pid = static_cast<u32>((high << 16) | low);
             } while (pid % 25 != state.getNature());
-
-            break;
-        default: // Default to cover all cute charm cases
+        }
+        else // Cute charm
+        {
             if ((go.nextUShort<true>() / 0x5556) != 0) // Successful cute charm
             {
                 // Get nature
@@ -212,8 +287,6 @@ std::vector<WildState4> WildGenerator4::generateMethodJ(u32 seed) const
                     pid = static_cast<u32>((high << 16) | low);
                 } while (pid % 25 != state.getNature());
             }
-
-            break;
         }
 
         state.setPID(pid);
@@ -225,7 +298,6 @@ std::vector<WildState4> WildGenerator4::generateMethodJ(u32 seed) const
         u16 iv2 = go.nextUShort<true>();
 
         state.setIVs(iv1, iv2);
-        state.calculateHiddenPower();
 
         u8 item = go.nextUShort<true>() % 100;
 
@@ -242,6 +314,7 @@ std::vector<WildState4> WildGenerator4::generateMethodJ(u32 seed) const
     return states;
 }
 
+template <Encounter encounterType, Lead leadType>
 std::vector<WildState4> WildGenerator4::generateMethodK(u32 seed) const
 {
     std::vector<WildState4> states;
@@ -249,7 +322,7 @@ std::vector<WildState4> WildGenerator4::generateMethodK(u32 seed) const
     PokeRNG rng(seed);
     rng.advance(initialAdvances + offset);
 
-    u8 buffer = 0;
+    u8 buffer = getCuteCharmBuffer(lead);
     u8 thresh = 0;
     u16 rate = encounterArea.getEncounterRate();
     if (encounter == Encounter::OldRod)
@@ -265,27 +338,6 @@ std::vector<WildState4> WildGenerator4::generateMethodK(u32 seed) const
         thresh = lead == Lead::SuctionCups ? 100 : 75;
     }
 
-    switch (lead)
-    {
-    case Lead::CuteCharmFemale:
-        buffer = 0;
-        break;
-    case Lead::CuteCharm25M:
-        buffer = 0xC8;
-        break;
-    case Lead::CuteCharm50M:
-        buffer = 0x96;
-        break;
-    case Lead::CuteCharm75M:
-        buffer = 0x4B;
-        break;
-    case Lead::CuteCharm875M:
-        buffer = 0x32;
-        break;
-    default:
-        break;
-    }
-
     for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
     {
         WildState4 state(initialAdvances + cnt);
@@ -296,9 +348,8 @@ std::vector<WildState4> WildGenerator4::generateMethodK(u32 seed) const
         u16 first = go.nextUShort<true>(); // Encounter slot, nibble for fishing, blank or item for rock smash
         u8 loops = 1;
 
-        switch (encounter)
+        if constexpr (encounterType == Encounter::Grass)
         {
-        case Encounter::Grass:
             state.setEncounterSlot(EncounterSlot::kSlot(first, encounter));
             if (!filter.compareEncounterSlot(state))
             {
@@ -307,8 +358,9 @@ std::vector<WildState4> WildGenerator4::generateMethodK(u32 seed) const
 
             state.setLevel(encounterArea.calcLevel(state.getEncounterSlot()));
             occidentary += 1; // Compensate for the game's advances after the battle ends
-            break;
-        case Encounter::Surfing:
+        }
+        else if constexpr (encounterType == Encounter::Surfing)
+        {
             state.setEncounterSlot(EncounterSlot::kSlot(first, encounter));
             if (!filter.compareEncounterSlot(state))
             {
@@ -317,10 +369,9 @@ std::vector<WildState4> WildGenerator4::generateMethodK(u32 seed) const
 
             state.setLevel(encounterArea.calcLevel(state.getEncounterSlot(), go.nextUShort<true>()));
             occidentary += 1; // Compensate for the game's advances after the battle ends
-            break;
-        case Encounter::OldRod:
-        case Encounter::GoodRod:
-        case Encounter::SuperRod:
+        }
+        else if constexpr (encounterType == Encounter::OldRod)
+        {
             if ((first % 100) >= thresh)
             {
                 continue;
@@ -335,8 +386,9 @@ std::vector<WildState4> WildGenerator4::generateMethodK(u32 seed) const
             state.setLevel(encounterArea.calcLevel(state.getEncounterSlot()));
             occidentary += 2; // Compensate for the game's advances after the battle ends
             go.next();
-            break;
-        case Encounter::RockSmash:
+        }
+        else if constexpr (encounterType == Encounter::RockSmash)
+        {
             if (((go.nextUShort<true>()) % 100) >= rate)
             {
                 continue;
@@ -350,8 +402,9 @@ std::vector<WildState4> WildGenerator4::generateMethodK(u32 seed) const
 
             state.setLevel(encounterArea.calcLevel(state.getEncounterSlot(), go.nextUShort<true>()));
             occidentary += 1; // Compensate for the game's advances after the battle ends
-            break;
-        case Encounter::BugCatchingContest:
+        }
+        else if constexpr (encounterType == Encounter::BugCatchingContest)
+        {
             state.setEncounterSlot(EncounterSlot::kSlot(first, encounter));
             if (!filter.compareEncounterSlot(state))
             {
@@ -362,8 +415,9 @@ std::vector<WildState4> WildGenerator4::generateMethodK(u32 seed) const
             occidentary += 1; // Compensate for the game's advances after the battle ends
             go.nextUShort<true>();
             loops = 4;
-            break;
-        case Encounter::SafariZoneHGSS:
+        }
+        else if constexpr (encounterType == Encounter::SafariZoneHGSS)
+        {
             state.setEncounterSlot(EncounterSlot::kSlot(first, encounter));
             if (!filter.compareEncounterSlot(state))
             {
@@ -373,20 +427,14 @@ std::vector<WildState4> WildGenerator4::generateMethodK(u32 seed) const
             state.setLevel(0);
             occidentary += 1; // Compensate for the game's advances after the battle ends
             loops = 4;
-            break;
-        case Encounter::HeadButt: // TODO
-        default:
-            break;
         }
 
         u32 pid = 0;
         for (u8 loop = 0; loop < loops; loop++)
         {
             pid = 0;
-            switch (lead)
+            if constexpr (leadType == Lead::None)
             {
-            case Lead::None:
-            case Lead::SuctionCups:
                 // Get hunt nature
                 state.setNature(go.nextUShort<true>() % 25);
 
@@ -402,9 +450,9 @@ std::vector<WildState4> WildGenerator4::generateMethodK(u32 seed) const
                     u16 high = go.nextUShort<true>();
                     pid = static_cast<u32>((high << 16) | low);
                 } while (pid % 25 != state.getNature());
-
-                break;
-            case Lead::Synchronize:
+            }
+            else if constexpr (leadType == Lead::Synchronize)
+            {
                 if ((go.nextUShort<true>() & 1) == 0) // Successful synch
                 {
                     state.setNature(synchNature);
@@ -426,9 +474,9 @@ std::vector<WildState4> WildGenerator4::generateMethodK(u32 seed) const
                     u16 high = go.nextUShort<true>();
                     pid = static_cast<u32>((high << 16) | low);
                 } while (pid % 25 != state.getNature());
-
-                break;
-            default: // Default to cover all cute charm cases
+            }
+            else // Cute charm
+            {
                 if ((go.nextUShort<true>() % 3) != 0) // Successfull cute charm
                 {
                     // Get hunt nature
@@ -459,8 +507,6 @@ std::vector<WildState4> WildGenerator4::generateMethodK(u32 seed) const
                         pid = static_cast<u32>((high << 16) | low);
                     } while (pid % 25 != state.getNature());
                 }
-
-                break;
             }
 
             state.setPID(pid);
@@ -472,7 +518,6 @@ std::vector<WildState4> WildGenerator4::generateMethodK(u32 seed) const
             u16 iv2 = go.nextUShort<true>();
 
             state.setIVs(iv1, iv2);
-            state.calculateHiddenPower();
 
             bool skip = true;
             for (u8 in = 0; in < 6; in++)
@@ -537,7 +582,6 @@ std::vector<WildState4> WildGenerator4::generateChainedShiny(u32 seed) const
         state.setShiny<8>(tsv, high ^ low);
 
         state.setIVs(iv1, iv2);
-        state.calculateHiddenPower();
 
         if (filter.compareState(state))
         {
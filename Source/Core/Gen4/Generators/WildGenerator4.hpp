@@ -34,8 +34,12 @@ public:
     void setEncounterArea(const EncounterArea4 &encounterArea);
 
 private:
+    template <Encounter encounterType, Lead leadType>
     std::vector<WildState4> generateMethodJ(u32 seed) const;
+
+    template <Encounter encounterType, Lead leadType>
     std::vector<WildState4> generateMethodK(u32 seed) const;
+
     std::vector<WildState4> generateChainedShiny(u32 seed) const;
 
     EncounterArea4 encounterArea;
@@ -19,100 +19,138 @@
 
 #include "EggSearcher4.hpp"
 #include <Core/Gen4/Generators/EggGenerator4.hpp>
+#include <algorithm>
 
-EggSearcher4::EggSearcher4(u16 tid, u16 sid, u8 genderRatio, Method method, const StateFilter &filter) :
-    Searcher(tid, sid, genderRatio, method, filter), searching(false), progress(0)
+namespace
 {
-}
+    // Delays searched per chunk, bounds the results a worker holds before handing them out
+    constexpr u32 delayBlock = 1000;
 
-void EggSearcher4::startSearch(u32 minDelay, u32 maxDelay, int type, const EggGenerator4 &generatorIV, const EggGenerator4 &generatorPID)
-{
-    searching = true;
-    u16 total = 0;
-
-    for (u16 ab = 0; ab < 256; ab++)
+    // Every IV state of a seed pairs with every PID state of it, so the join has no key to match on
+    void join(std::vector<EggState4> &states, const std::vector<EggState4> &statesPID, const std::vector<EggState4> &statesIV)
     {
-        for (u8 cd = 0; cd < 24; cd++)
+        for (auto statePID : statesPID)
         {
-            for (u32 efgh = minDelay; efgh <= maxDelay; efgh++)
+            for (const auto &stateIV : statesIV)
             {
-                if (!searching)
-                {
-                    return;
-                }
+                statePID.setIVs(stateIV.getIV(0), stateIV.getIV(1), stateIV.getIV(2), stateIV.getIV(3), stateIV.getIV(4),
+                                stateIV.getIV(5));
 
-                if (total > 10000)
+                for (u8 i = 0; i < 6; i++)
                 {
-                    progress = static_cast<int>(256 * 24 * (maxDelay - minDelay + 1));
-                    return;
+                    statePID.setInheritance(i, stateIV.getInheritance(i));
                 }
+                statePID.setSecondaryAdvance(stateIV.getAdvances());
 
-                std::vector<EggState4> states;
-                u32 seed = static_cast<u32>((ab << 24) | (cd << 16)) + efgh;
+                states.emplace_back(statePID);
+            }
+        }
+    }
+}
 
-                if (type == 0)
-                {
-                    states = generatorIV.generate(seed);
-                }
-                else if (type == 1)
-                {
-                    states = generatorPID.generate(seed);
-                }
-                else
-                {
-                    auto statesIV = generatorIV.generate(seed);
-                    auto statesPID = generatorPID.generate(seed);
-
-                    if (!statesIV.empty() && !statesPID.empty())
-                    {
-                        for (auto statePID : statesPID)
-                        {
-                            for (const auto &stateIV : statesIV)
-                            {
-                                statePID.setIVs(stateIV.getIV(0), stateIV.getIV(1), stateIV.getIV(2), stateIV.getIV(3), stateIV.getIV(4),
-                                                stateIV.getIV(5));
-                                statePID.calculateHiddenPower();
-
-                                for (u8 i = 0; i < 6; i++)
-                                {
-                                    statePID.setInheritance(i, stateIV.getInheritance(i));
-                                }
-                                statePID.setSecondaryAdvance(stateIV.getAdvances());
-
-                                states.emplace_back(statePID);
-                            }
-                        }
-                    }
-                }
+EggSearcher4::EggSearcher4(u16 tid, u16 sid, u8 genderRatio, Method method, const StateFilter &filter) :
+    Searcher(tid, sid, genderRatio, method, filter), searching(false), progress(0)
+{
+    // Results are only taken periodically, spill them instead of letting them grow without a bound. Blocking would stall
+    // the shared workers for every other search as well.
+    results.setBudget({ 10000, ResultPolicy::Spill, "" });
+}
 
-                for (EggState4 &state : states)
-                {
-                    state.setInitialSeed(seed);
-                }
+void EggSearcher4::setResultBudget(const ResultBudget &budget)
+{
+    results.setBudget(budget);
+}
+
+void EggSearcher4::startSearch(u32 minDelay, u32 maxDelay, int type, const EggGenerator4 &generatorIV, const EggGenerator4 &generatorPID,
+                               int threads)
+{
+    job.start();
+    searching = true;
 
-                total += states.size();
+    // Each chunk is a block of delays of one ab and cd, run as a task of the shared scheduler. Tasks start in order and
+    // chunks are released in order, so at most a few chunks per thread wait on an earlier one and the results do not
+    // depend on which thread finishes first.
+    u32 blocks = (maxDelay - minDelay) / delayBlock + 1;
+    u32 chunks = 256 * 24 * blocks;
+    ordered = OrderedResults<EggState4>(0, chunks);
 
-                std::lock_guard<std::mutex> guard(mutex);
-                results.insert(results.end(), states.begin(), states.end());
-                progress++;
-            }
-        }
-    }
+    job.run(chunks, threads, [&](u32 chunk, u32) { search(chunk, blocks, minDelay, maxDelay, type, generatorIV, generatorPID); });
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ordered.finish();
+    results.append(ordered.take());
 }
 
 void EggSearcher4::cancelSearch()
 {
     searching = false;
+    results.cancel();
+    job.cancel();
 }
 
 std::vector<EggState4> EggSearcher4::getResults()
 {
-    std::lock_guard<std::mutex> guard(mutex);
-    auto data = std::move(results);
-    return data;
+    return results.take();
 }
 
 int EggSearcher4::getProgress() const
 {
     return progress;
 }
+
+void EggSearcher4::search(u32 chunk, u32 blocks, u32 minDelay, u32 maxDelay, int type, const EggGenerator4 &generatorIV,
+                          const EggGenerator4 &generatorPID)
+{
+    u32 hour = chunk / blocks;
+    u32 ab = hour / 24;
+    u32 cd = hour % 24;
+    u32 start = minDelay + chunk % blocks * delayBlock;
+    u32 end = std::min(maxDelay, start + delayBlock - 1);
+
+    std::vector<EggState4> states;
+    for (u32 efgh = start; efgh <= end; efgh++)
+    {
+        if (!searching)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ordered.add(chunk, std::move(states));
+            return;
+        }
+
+        u32 seed = static_cast<u32>((ab << 24) | (cd << 16)) + efgh;
+        size_t first = states.size();
+
+        if (type == 0)
+        {
+            auto statesIV = generatorIV.generate(seed);
+            states.insert(states.end(), statesIV.begin(), statesIV.end());
+        }
+        else if (type == 1)
+        {
+            auto statesPID = generatorPID.generate(seed);
+            states.insert(states.end(), statesPID.begin(), statesPID.end());
+        }
+        else
+        {
+            // Both sides are already filtered by their generator, skip the PID side when no IV state passed
+            auto statesIV = generatorIV.generate(seed);
+            if (!statesIV.empty())
+            {
+                join(states, generatorPID.generate(seed), statesIV);
+            }
+        }
+
+        for (size_t i = first; i < states.size(); i++)
+        {
+            states[i].setInitialSeed(seed);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ordered.add(chunk, std::move(states));
+        results.append(ordered.take());
+        progress += static_cast<int>(end - start + 1);
+    }
+    results.wait();
+}
@@ -20,27 +20,38 @@
 #ifndef EGGSEARCHER4_HPP
 #define EGGSEARCHER4_HPP
 
+#include <Core/Gen4/States/EggState4.hpp>
 #include <Core/Parents/Searchers/Searcher.hpp>
+#include <Core/Util/JobScheduler.hpp>
+#include <Core/Util/OrderedResults.hpp>
+#include <Core/Util/ResultStore.hpp>
+#include <atomic>
 #include <mutex>
 
 class EggGenerator4;
-class EggState4;
 
 class EggSearcher4 : public Searcher
 {
 public:
     EggSearcher4() = default;
     EggSearcher4(u16 tid, u16 sid, u8 genderRatio, Method method, const StateFilter &filter);
-    void startSearch(u32 minDelay, u32 maxDelay, int type, const EggGenerator4 &generatorIV, const EggGenerator4 &generatorPID);
+    void setResultBudget(const ResultBudget &budget);
+    void startSearch(u32 minDelay, u32 maxDelay, int type, const EggGenerator4 &generatorIV, const EggGenerator4 &generatorPID,
+                     int threads);
     void cancelSearch();
     std::vector<EggState4> getResults();
     int getProgress() const;
 
 private:
     bool searching;
-    int progress;
-    std::vector<EggState4> results;
+    std::atomic<int> progress;
+    OrderedResults<EggState4> ordered;
+    ResultStore<EggState4> results;
     std::mutex mutex;
+    JobControl job;
+
+    void search(u32 chunk, u32 blocks, u32 minDelay, u32 maxDelay, int type, const EggGenerator4 &generatorIV,
+                const EggGenerator4 &generatorPID);
 };
 
 #endif // EGGSEARCHER4_HPP
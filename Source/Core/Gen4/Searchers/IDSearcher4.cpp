@@ -19,63 +19,128 @@
 
 #include "IDSearcher4.hpp"
 #include <Core/RNG/MTFast.hpp>
+#include <Core/Util/SearchCheckpoint.hpp>
+#include <algorithm>
 
 IDSearcher4::IDSearcher4(const IDFilter &filter) : filter(filter), searching(false), progress(0)
 {
 }
 
+void IDSearcher4::setCheckpoint(const std::string &fileName)
+{
+    checkpointFile = fileName;
+}
+
+void IDSearcher4::setShard(const SearchShard &shard)
+{
+    this->shard = shard;
+}
+
+void IDSearcher4::setResultBudget(const ResultBudget &budget)
+{
+    results.setBudget(budget);
+}
+
 void IDSearcher4::startSearch(bool infinite, u16 year, u32 minDelay, u32 maxDelay)
 {
     searching = true;
     maxDelay = infinite ? 0xe8ffff : maxDelay;
 
-    for (u32 efgh = minDelay; efgh <= maxDelay; efgh++)
+    // Only search the delays that belong to this shard
+    auto range = shard.getRange<u64>(minDelay, static_cast<u64>(maxDelay) + 1);
+    if (range.first == range.second)
     {
-        for (u16 ab = 0; ab < 256; ab++)
+        return;
+    }
+    minDelay = static_cast<u32>(range.first);
+    maxDelay = static_cast<u32>(range.second - 1);
+
+    // Each chunk is a block of 64 delays
+    u32 chunks = (maxDelay - minDelay) / 64 + 1;
+    std::vector<u64> parameters = { year, minDelay, maxDelay };
+    filter.addParameters(parameters);
+    SearchCheckpoint checkpoint(checkpointFile, parameters, chunks, sizeof(IDState4));
+    stats.start(static_cast<u64>(maxDelay - minDelay + 1) * 256 * 24, 1);
+    auto worker = stats.addWorker();
+
+    for (u32 chunk = 0; chunk < chunks; chunk++)
+    {
+        u32 first = minDelay + chunk * 64;
+        u32 last = std::min(first + 63, maxDelay);
+
+        // Restored results are added in chunk order, the same order an uninterrupted search finds them
+        if (checkpoint.isCompleted(chunk))
         {
-            for (u16 cd = 0; cd < 24; cd++)
+            results.add(checkpoint.getResults<IDState4>(chunk));
+            stats.addSkipped((last - first + 1) * 256 * 24);
+            progress += (last - first + 1) * 256 * 24;
+            continue;
+        }
+
+        std::vector<IDState4> states;
+        for (u32 efgh = first; efgh <= last; efgh++)
+        {
+            for (u16 ab = 0; ab < 256; ab++)
             {
-                if (!searching)
+                for (u16 cd = 0; cd < 24; cd++)
                 {
-                    return;
-                }
+                    if (!searching)
+                    {
+                        results.add(states);
+                        return;
+                    }
 
-                u32 seed = static_cast<u32>((ab << 24) | (cd << 16)) + efgh;
-                MTFast<2> mt(seed, 1);
+                    u32 seed = static_cast<u32>((ab << 24) | (cd << 16)) + efgh;
+                    MTFast<2> mt(seed, 1);
 
-                u32 sidtid = mt.next();
+                    u32 sidtid = mt.next();
 
-                u16 tid = sidtid & 0xffff;
-                u16 sid = sidtid >> 16;
+                    u16 tid = sidtid & 0xffff;
+                    u16 sid = sidtid >> 16;
 
-                IDState4 state(seed, tid, sid);
-                if (filter.compare(state))
-                {
-                    state.setDelay(efgh + 2000 - year);
+                    IDState4 state(seed, tid, sid);
+                    if (filter.compare(state))
+                    {
+                        state.setDelay(efgh + 2000 - year);
+                        states.emplace_back(state);
+                        worker.addPassed(1);
+                    }
 
-                    std::lock_guard<std::mutex> guard(mutex);
-                    results.emplace_back(state);
+                    progress++;
                 }
-
-                progress++;
             }
+
+            worker.addHashed(256 * 24);
+            worker.addGenerated(256 * 24);
         }
+
+        results.add(states);
+        checkpoint.complete(chunk, states);
     }
 }
 
 void IDSearcher4::cancelSearch()
 {
     searching = false;
+    results.cancel();
 }
 
 std::vector<IDState4> IDSearcher4::getResults()
 {
-    std::lock_guard<std::mutex> guard(mutex);
-    auto data = std::move(results);
-    return data;
+    return results.take();
 }
 
 int IDSearcher4::getProgress() const
 {
     return progress;
 }
+
+u64 IDSearcher4::getDropped() const
+{
+    return results.getDropped();
+}
+
+SearchStats IDSearcher4::getStats() const
+{
+    return stats.getStats();
+}
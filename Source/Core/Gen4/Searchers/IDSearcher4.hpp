@@ -22,7 +22,10 @@
 
 #include <Core/Gen4/States/IDState4.hpp>
 #include <Core/Parents/Filters/IDFilter.hpp>
-#include <mutex>
+#include <Core/Util/ResultStore.hpp>
+#include <Core/Util/SearchShard.hpp>
+#include <Core/Util/SearchStats.hpp>
+#include <string>
 #include <vector>
 
 class IDSearcher4
@@ -30,18 +33,25 @@ class IDSearcher4
 public:
     IDSearcher4() = default;
     explicit IDSearcher4(const IDFilter &filter);
+    void setCheckpoint(const std::string &fileName);
+    void setShard(const SearchShard &shard);
+    void setResultBudget(const ResultBudget &budget);
     void startSearch(bool infinite, u16 year, u32 minDelay, u32 maxDelay);
     void cancelSearch();
     std::vector<IDState4> getResults();
     int getProgress() const;
+    u64 getDropped() const;
+    SearchStats getStats() const;
 
 private:
     IDFilter filter;
+    std::string checkpointFile;
+    SearchShard shard;
 
     bool searching;
     int progress;
-    std::vector<IDState4> results;
-    std::mutex mutex;
+    ResultStore<IDState4> results;
+    SearchCounters stats;
 };
 
 #endif // IDSEARCHER4_HPP
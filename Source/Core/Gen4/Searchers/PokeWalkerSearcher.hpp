@@ -21,26 +21,37 @@
 #define POKEWALKERSEARCHER4_HPP
 
 #include <Core/Parents/Searchers/Searcher.hpp>
+#include <Core/Parents/States/PokeWalkerState.hpp>
+#include <Core/Util/JobScheduler.hpp>
+#include <Core/Util/OrderedResults.hpp>
+#include <Core/Util/ResultStore.hpp>
+#include <atomic>
 #include <mutex>
 
 class PokeWalkerGenerator;
-class PokeWalkerState;
 
 class PokeWalkerSearcher : public Searcher
 {
 public:
     PokeWalkerSearcher() = default;
     PokeWalkerSearcher(u16 tid, u16 sid, u8 genderRatio, Method method, const StateFilter &filter);
-    void startSearch(u32 minDelay, u32 maxDelay, int type, const PokeWalkerGenerator &generatorIV, const PokeWalkerGenerator &generatorPID);
+    void setResultBudget(const ResultBudget &budget);
+    void startSearch(u32 minDelay, u32 maxDelay, int type, const PokeWalkerGenerator &generatorIV, const PokeWalkerGenerator &generatorPID,
+                     int threads);
     void cancelSearch();
     std::vector<PokeWalkerState> getResults();
     int getProgress() const;
 
 private:
     bool searching;
-    int progress;
-    std::vector<PokeWalkerState> results;
+    std::atomic<int> progress;
+    OrderedResults<PokeWalkerState> ordered;
+    ResultStore<PokeWalkerState> results;
     std::mutex mutex;
+    JobControl job;
+
+    void search(u32 chunk, u32 blocks, u32 minDelay, u32 maxDelay, int type, const PokeWalkerGenerator &generatorIV,
+                const PokeWalkerGenerator &generatorPID);
 };
 
 #endif // POKEWALKERSEARCHER4_HPP
@@ -41,50 +41,37 @@ void StationarySearcher4::setState(u32 minAdvance, u32 maxAdvance)
     this->maxAdvance = maxAdvance;
 }
 
+void StationarySearcher4::setSpreadIndex(const SpreadIndex4 *index)
+{
+    this->index = index;
+}
+
+void StationarySearcher4::setResultBudget(const ResultBudget &budget)
+{
+    results.setBudget(budget);
+}
+
 void StationarySearcher4::startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max)
 {
     searching = true;
 
-    for (u8 hp = min[0]; hp <= max[0]; hp++)
-    {
-        for (u8 atk = min[1]; atk <= max[1]; atk++)
-        {
-            for (u8 def = min[2]; def <= max[2]; def++)
-            {
-                for (u8 spa = min[3]; spa <= max[3]; spa++)
-                {
-                    for (u8 spd = min[4]; spd <= max[4]; spd++)
-                    {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
-                        {
-                            if (!searching)
-                            {
-                                return;
-                            }
-
-                            auto states = search(hp, atk, def, spa, spd, spe);
-
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
-                        }
-                    }
-                }
-            }
-        }
-    }
+    searchIVs(min, max, searching, progress, [&](u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) {
+        auto states = search(hp, atk, def, spa, spd, spe);
+
+        results.add(states);
+        progress++;
+    });
 }
 
 void StationarySearcher4::cancelSearch()
 {
     searching = false;
+    results.cancel();
 }
 
 std::vector<StationaryState> StationarySearcher4::getResults()
 {
-    std::lock_guard<std::mutex> guard(mutex);
-    auto data = std::move(results);
-    return data;
+    return results.take();
 }
 
 int StationarySearcher4::getProgress() const
@@ -94,6 +81,12 @@ int StationarySearcher4::getProgress() const
 
 std::vector<StationaryState> StationarySearcher4::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const
 {
+    // The index already knows the initial seed of every spread, so the results skip searchInitialSeeds
+    if (method == Method::Method1 && index && index->covers(minDelay, maxDelay, maxAdvance))
+    {
+        return searchMethod1Index(hp, atk, def, spa, spd, spe);
+    }
+
     std::vector<StationaryState> states;
 
     if (method == Method::Method1)
@@ -126,7 +119,6 @@ std::vector<StationaryState> StationarySearcher4::searchMethod1(u8 hp, u8 atk, u
 
     StationaryState state;
     state.setIVs(hp, atk, def, spa, spd, spe);
-    state.calculateHiddenPower();
 
     if (!filter.compareHiddenPower(state))
     {
@@ -165,13 +157,61 @@ std::vector<StationaryState> StationarySearcher4::searchMethod1(u8 hp, u8 atk, u
     return states;
 }
 
+std::vector<StationaryState> StationarySearcher4::searchMethod1Index(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const
+{
+    std::vector<StationaryState> states;
+
+    StationaryState state;
+    state.setIVs(hp, atk, def, spa, spd, spe);
+
+    if (!filter.compareHiddenPower(state))
+    {
+        return states;
+    }
+
+    for (u8 nature = 0; nature < 25; nature++)
+    {
+        state.setNature(nature);
+        if (!filter.compareNature(state))
+        {
+            continue;
+        }
+
+        for (const auto &entry : index->find(nature, hp, atk, def, spa, spd, spe))
+        {
+            u16 delay = entry.seed & 0xffff;
+            if (entry.advance < minAdvance || entry.advance > maxAdvance || delay < minDelay || delay > maxDelay)
+            {
+                continue;
+            }
+
+            PokeRNG rng(entry.seed);
+            rng.advance(entry.advance);
+            u16 low = rng.nextUShort();
+            u16 high = rng.nextUShort();
+
+            state.setSeed(entry.seed);
+            state.setAdvances(entry.advance);
+            state.setPID(high, low);
+            state.setAbility(low & 1);
+            state.setGender(low & 255, genderRatio);
+            state.setShiny<8>(tsv, high ^ low);
+            if (filter.comparePID(state))
+            {
+                states.emplace_back(state);
+            }
+        }
+    }
+
+    return states;
+}
+
 std::vector<StationaryState> StationarySearcher4::searchManaphy(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const
 {
     std::vector<StationaryState> states;
 
     StationaryState state;
     state.setIVs(hp, atk, def, spa, spd, spe);
-    state.calculateHiddenPower();
 
     if (!filter.compareHiddenPower(state))
     {
@@ -238,7 +278,6 @@ std::vector<StationaryState> StationarySearcher4::searchMethodJ(u8 hp, u8 atk, u
 
     StationaryState state;
     state.setIVs(hp, atk, def, spa, spd, spe);
-    state.calculateHiddenPower();
 
     if (!filter.compareHiddenPower(state))
     {
@@ -316,7 +355,6 @@ std::vector<StationaryState> StationarySearcher4::searchMethodK(u8 hp, u8 atk, u
 
     StationaryState state;
     state.setIVs(hp, atk, def, spa, spd, spe);
-    state.calculateHiddenPower();
 
     if (!filter.compareHiddenPower(state))
     {
@@ -394,7 +432,6 @@ std::vector<StationaryState> StationarySearcher4::searchWondercardIVs(u8 hp, u8
 
     StationaryState state;
     state.setIVs(hp, atk, def, spa, spd, spe);
-    state.calculateHiddenPower();
 
     if (!filter.compareHiddenPower(state))
     {
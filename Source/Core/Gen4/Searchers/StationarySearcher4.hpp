@@ -20,10 +20,11 @@
 #ifndef STATIONARYSEARCHER4_HPP
 #define STATIONARYSEARCHER4_HPP
 
+#include <Core/Gen4/SpreadIndex4.hpp>
 #include <Core/Parents/Searchers/StationarySearcher.hpp>
 #include <Core/Parents/States/StationaryState.hpp>
 #include <Core/RNG/RNGCache.hpp>
-#include <mutex>
+#include <Core/Util/ResultStore.hpp>
 
 class StationarySearcher4 : public StationarySearcher
 {
@@ -32,6 +33,8 @@ public:
     StationarySearcher4(u16 tid, u16 sid, u8 genderRatio, Method method, const StateFilter &filter);
     void setDelay(u32 minDelay, u32 maxDelay);
     void setState(u32 minAdvance, u32 maxAdvance);
+    void setSpreadIndex(const SpreadIndex4 *index);
+    void setResultBudget(const ResultBudget &budget);
     void startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max);
     void cancelSearch();
     std::vector<StationaryState> getResults();
@@ -39,6 +42,7 @@ public:
 
 private:
     RNGCache cache;
+    const SpreadIndex4 *index = nullptr;
     u32 minDelay;
     u32 maxDelay;
     u32 minAdvance;
@@ -46,11 +50,11 @@ private:
 
     bool searching;
     int progress;
-    std::vector<StationaryState> results;
-    std::mutex mutex;
+    ResultStore<StationaryState> results;
 
     std::vector<StationaryState> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
     std::vector<StationaryState> searchMethod1(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
+    std::vector<StationaryState> searchMethod1Index(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
     std::vector<StationaryState> searchManaphy(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
     std::vector<StationaryState> searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
     std::vector<StationaryState> searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
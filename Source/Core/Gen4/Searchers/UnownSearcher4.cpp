@@ -51,34 +51,13 @@ void UnownSearcher4::setState(u32 minAdvance, u32 maxAdvance)
 void UnownSearcher4::startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max)
 {
     searching = true;
-    for (u8 hp = min[0]; hp <= max[0]; hp++)
-    {
-        for (u8 atk = min[1]; atk <= max[1]; atk++)
-        {
-            for (u8 def = min[2]; def <= max[2]; def++)
-            {
-                for (u8 spa = min[3]; spa <= max[3]; spa++)
-                {
-                    for (u8 spd = min[4]; spd <= max[4]; spd++)
-                    {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
-                        {
-                            if (!searching)
-                            {
-                                return;
-                            }
-
-                            auto states = search(hp, atk, def, spa, spd, spe);
-
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
-                        }
-                    }
-                }
-            }
-        }
-    }
+    searchIVs(min, max, searching, progress, [&](u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) {
+        auto states = search(hp, atk, def, spa, spd, spe);
+
+        std::lock_guard<std::mutex> guard(mutex);
+        results.insert(results.end(), states.begin(), states.end());
+        progress++;
+    });
 }
 
 void UnownSearcher4::cancelSearch()
@@ -113,7 +92,6 @@ std::vector<UnownState4> UnownSearcher4::searchMethodJ(u8 hp, u8 atk, u8 def, u8
 
     UnownState4 state;
     state.setIVs(hp, atk, def, spa, spd, spe);
-    state.calculateHiddenPower();
 
     if (!filter.compareHiddenPower(state))
     {
@@ -48,6 +48,11 @@ void WildSearcher4::setState(u32 minAdvance, u32 maxAdvance)
     this->maxAdvance = maxAdvance;
 }
 
+void WildSearcher4::setResultBudget(const ResultBudget &budget)
+{
+    results.setBudget(budget);
+}
+
 void WildSearcher4::startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max)
 {
     searching = true;
@@ -59,46 +64,23 @@ void WildSearcher4::startSearch(const std::array<u8, 6> &min, const std::array<u
                                                       : 0;
     rock = encounterArea.getEncounterRate();
 
-    for (u8 hp = min[0]; hp <= max[0]; hp++)
-    {
-        for (u8 atk = min[1]; atk <= max[1]; atk++)
-        {
-            for (u8 def = min[2]; def <= max[2]; def++)
-            {
-                for (u8 spa = min[3]; spa <= max[3]; spa++)
-                {
-                    for (u8 spd = min[4]; spd <= max[4]; spd++)
-                    {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
-                        {
-                            if (!searching)
-                            {
-                                return;
-                            }
-
-                            auto states = search(hp, atk, def, spa, spd, spe);
-
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
-                        }
-                    }
-                }
-            }
-        }
-    }
+    searchIVs(min, max, searching, progress, [&](u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) {
+        auto states = search(hp, atk, def, spa, spd, spe);
+
+        results.add(states);
+        progress++;
+    });
 }
 
 void WildSearcher4::cancelSearch()
 {
     searching = false;
+    results.cancel();
 }
 
 std::vector<WildState> WildSearcher4::getResults()
 {
-    std::lock_guard<std::mutex> guard(mutex);
-    auto data = std::move(results);
-    return data;
+    return results.take();
 }
 
 int WildSearcher4::getProgress() const
@@ -132,7 +114,6 @@ std::vector<WildState> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 def, u8 sp
 
     WildState state;
     state.setIVs(hp, atk, def, spa, spd, spe);
-    state.calculateHiddenPower();
 
     if (!filter.compareHiddenPower(state))
     {
@@ -216,7 +197,6 @@ std::vector<WildState> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 def, u8 sp
 
     WildState state;
     state.setIVs(hp, atk, def, spa, spd, spe);
-    state.calculateHiddenPower();
 
     if (!filter.compareHiddenPower(state))
     {
@@ -300,7 +280,6 @@ std::vector<WildState> WildSearcher4::searchChainedShiny(u8 hp, u8 atk, u8 def,
 
     WildState state;
     state.setIVs(hp, atk, def, spa, spd, spe);
-    state.calculateHiddenPower();
 
     if (!filter.compareHiddenPower(state))
     {
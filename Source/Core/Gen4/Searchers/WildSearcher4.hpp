@@ -24,7 +24,7 @@
 #include <Core/Parents/Searchers/WildSearcher.hpp>
 #include <Core/Parents/States/WildState.hpp>
 #include <Core/RNG/RNGCache.hpp>
-#include <mutex>
+#include <Core/Util/ResultStore.hpp>
 
 class WildSearcher4 : public WildSearcher
 {
@@ -34,6 +34,7 @@ public:
     void setEncounterArea(const EncounterArea4 &encounterArea);
     void setDelay(u32 minDelay, u32 maxDelay);
     void setState(u32 minAdvance, u32 maxAdvance);
+    void setResultBudget(const ResultBudget &budget);
     void startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max);
     void cancelSearch();
     std::vector<WildState> getResults();
@@ -51,8 +52,7 @@ private:
 
     bool searching;
     int progress;
-    std::vector<WildState> results;
-    std::mutex mutex;
+    ResultStore<WildState> results;
 
     std::vector<WildState> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
     std::vector<WildState> searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
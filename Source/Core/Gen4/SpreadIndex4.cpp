@@ -0,0 +1,182 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SpreadIndex4.hpp"
+#include <Core/RNG/LCRNG.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+constexpr u32 indexMagic = 0x58495350; // PSIX
+constexpr u32 indexVersion = 1;
+
+namespace
+{
+    u32 getKey(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe)
+    {
+        u32 iv1 = hp | (atk << 5) | (def << 10);
+        u32 iv2 = spe | (spa << 5) | (spd << 10);
+        return (iv1 << 15) | iv2;
+    }
+}
+
+SpreadIndex4::SpreadIndex4(const std::string &fileName) :
+    file(fileName), header(), ivIndex(nullptr), natureOffsets(nullptr), natureIndex(nullptr)
+{
+    if (file.getSize() < sizeof(Header))
+    {
+        return;
+    }
+
+    std::memcpy(&header, file.getData(), sizeof(Header));
+    if (header.magic != indexMagic || header.version != indexVersion
+        || file.getSize() != sizeof(Header) + (header.count * 2 + 26) * sizeof(u64))
+    {
+        return;
+    }
+
+    ivIndex = reinterpret_cast<const u64 *>(file.getData() + sizeof(Header));
+    natureOffsets = ivIndex + header.count;
+    natureIndex = natureOffsets + 26;
+}
+
+bool SpreadIndex4::build(const std::string &fileName, u32 minDelay, u32 maxDelay, u32 maxAdvance)
+{
+    // Entries are numbered with 32 bits and delays above 0xffff carry into the hour
+    u64 delays = static_cast<u64>(maxDelay) - minDelay + 1;
+    u64 advances = static_cast<u64>(maxAdvance) + 1;
+    u64 count = 256 * 24 * delays * advances;
+    if (minDelay > maxDelay || maxDelay > 0xffff || count > 0xffffffff)
+    {
+        return false;
+    }
+
+    std::vector<u64> ivs(count);
+    std::vector<u8> natures(count);
+    std::vector<u64> offsets(26);
+    std::vector<u16> calls(advances + 4);
+
+    u64 entry = 0;
+    for (u32 ab = 0; ab < 256; ab++)
+    {
+        for (u32 hour = 0; hour < 24; hour++)
+        {
+            for (u32 delay = minDelay; delay <= maxDelay; delay++)
+            {
+                PokeRNG rng((ab << 24) | (hour << 16) | delay);
+                for (u16 &call : calls)
+                {
+                    call = rng.nextUShort();
+                }
+
+                // Method 1 [SEED] [PID] [PID] [IVS] [IVS]
+                for (u32 advance = 0; advance < advances; advance++, entry++)
+                {
+                    u32 pid = (calls[advance + 1] << 16) | calls[advance];
+                    u32 key = ((calls[advance + 2] & 0x7fff) << 15) | (calls[advance + 3] & 0x7fff);
+                    u32 nature = pid % 25;
+
+                    ivs[entry] = (static_cast<u64>(key) << 32) | entry;
+                    natures[entry] = static_cast<u8>(nature);
+                    offsets[nature + 1]++;
+                }
+            }
+        }
+    }
+
+    std::sort(ivs.begin(), ivs.end());
+
+    // Split the IV index into one group per nature, each stays sorted by IVs
+    for (u8 nature = 0; nature < 25; nature++)
+    {
+        offsets[nature + 1] += offsets[nature];
+    }
+
+    std::vector<u64> natureIndex(count);
+    std::vector<u64> next(offsets.begin(), offsets.end() - 1);
+    for (u64 value : ivs)
+    {
+        natureIndex[next[natures[value & 0xffffffff]]++] = value;
+    }
+
+    FILE *out = std::fopen(fileName.c_str(), "wb");
+    if (!out)
+    {
+        return false;
+    }
+
+    Header header = { indexMagic, indexVersion, minDelay, maxDelay, maxAdvance, 0, count };
+    bool written = std::fwrite(&header, sizeof(Header), 1, out) == 1 && std::fwrite(ivs.data(), sizeof(u64), count, out) == count
+        && std::fwrite(offsets.data(), sizeof(u64), offsets.size(), out) == offsets.size()
+        && std::fwrite(natureIndex.data(), sizeof(u64), count, out) == count;
+    return std::fclose(out) == 0 && written;
+}
+
+bool SpreadIndex4::isOpen() const
+{
+    return ivIndex != nullptr;
+}
+
+bool SpreadIndex4::covers(u32 minDelay, u32 maxDelay, u32 maxAdvance) const
+{
+    return isOpen() && minDelay >= header.minDelay && maxDelay <= header.maxDelay && maxAdvance <= header.maxAdvance;
+}
+
+std::vector<SpreadIndex4::Entry> SpreadIndex4::find(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const
+{
+    return find(ivIndex, ivIndex + header.count, getKey(hp, atk, def, spa, spd, spe));
+}
+
+std::vector<SpreadIndex4::Entry> SpreadIndex4::find(u8 nature, u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const
+{
+    if (!isOpen() || nature >= 25)
+    {
+        return std::vector<Entry>();
+    }
+
+    return find(natureIndex + natureOffsets[nature], natureIndex + natureOffsets[nature + 1], getKey(hp, atk, def, spa, spd, spe));
+}
+
+std::vector<SpreadIndex4::Entry> SpreadIndex4::find(const u64 *begin, const u64 *end, u32 key) const
+{
+    std::vector<Entry> entries;
+    if (!isOpen())
+    {
+        return entries;
+    }
+
+    u32 delays = header.maxDelay - header.minDelay + 1;
+    u32 advances = header.maxAdvance + 1;
+
+    auto it = std::lower_bound(begin, end, key, [](u64 value, u32 key) { return (value >> 32) < key; });
+    for (; it != end && (*it >> 32) == key; ++it)
+    {
+        u32 entry = *it & 0xffffffff;
+        u32 advance = entry % advances;
+        entry /= advances;
+        u32 delay = header.minDelay + entry % delays;
+        entry /= delays;
+        u32 hour = entry % 24;
+        u32 ab = entry / 24;
+
+        entries.emplace_back(Entry { (ab << 24) | (hour << 16) | delay, advance });
+    }
+
+    return entries;
+}
@@ -0,0 +1,69 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SPREADINDEX4_HPP
+#define SPREADINDEX4_HPP
+
+#include <Core/Util/Global.hpp>
+#include <Core/Util/MappedFile.hpp>
+#include <string>
+#include <vector>
+
+// On disk index of the Method 1 spread of the first advances of every Gen 4 initial seed in a delay range. Spreads are
+// stored sorted by IVs, and grouped by nature then sorted by IVs, and memory mapped so a query is a binary search.
+class SpreadIndex4
+{
+public:
+    struct Entry
+    {
+        u32 seed;
+        u32 advance;
+    };
+
+    explicit SpreadIndex4(const std::string &fileName);
+    // Fails if the range is too large or the file could not be written
+    static bool build(const std::string &fileName, u32 minDelay, u32 maxDelay, u32 maxAdvance);
+    bool isOpen() const;
+    // Whether a search can be answered from the index
+    bool covers(u32 minDelay, u32 maxDelay, u32 maxAdvance) const;
+    std::vector<Entry> find(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
+    std::vector<Entry> find(u8 nature, u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
+
+private:
+    struct Header
+    {
+        u32 magic;
+        u32 version;
+        u32 minDelay;
+        u32 maxDelay;
+        u32 maxAdvance;
+        u32 padding;
+        u64 count;
+    };
+
+    MappedFile file;
+    Header header;
+    const u64 *ivIndex;
+    const u64 *natureOffsets;
+    const u64 *natureIndex;
+
+    std::vector<Entry> find(const u64 *begin, const u64 *end, u32 key) const;
+};
+
+#endif // SPREADINDEX4_HPP
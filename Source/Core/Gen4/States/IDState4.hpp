@@ -63,9 +63,9 @@ public:
     }
 
 private:
+    u8 seconds;
     u32 seed;
     u32 delay;
-    u8 seconds;
 };
 
 #endif // IDSTATE4_HPP
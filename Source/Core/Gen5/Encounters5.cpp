@@ -21,11 +21,13 @@
 #include <Core/Enum/Encounter.hpp>
 #include <Core/Enum/Game.hpp>
 #include <Core/Gen5/EncounterArea5.hpp>
+#include <Core/Parents/EncounterTable.hpp>
 #include <Core/Parents/PersonalLoader.hpp>
 #include <Core/Resources/Resources.hpp>
 #include <algorithm>
-#include <cstring>
 #include <iterator>
+#include <mutex>
+#include <unordered_map>
 
 namespace Encounters5
 {
@@ -34,74 +36,31 @@ namespace Encounters5
         constexpr u8 bwLocations[12] = { 2, 44, 45, 46, 47, 48, 49, 73, 84, 88, 93, 94 };
         constexpr u8 bw2Locations[13] = { 2, 23, 24, 25, 26, 27, 28, 43, 107, 111, 116, 117, 129 };
 
-        std::vector<std::vector<u8>> getData(Game game)
+        std::pair<const u8 *, size_t> getData(Game game)
         {
-            const u8 *data;
-            size_t size;
-
             if (game == Game::Black)
             {
-                data = black.data();
-                size = black.size();
+                return std::make_pair(black.data(), black.size());
             }
             else if (game == Game::Black2)
             {
-                data = black2.data();
-                size = black2.size();
+                return std::make_pair(black2.data(), black2.size());
             }
             else if (game == Game::White)
             {
-                data = white.data();
-                size = white.size();
+                return std::make_pair(white.data(), white.size());
             }
             else
             {
-                data = white2.data();
-                size = white2.size();
+                return std::make_pair(white2.data(), white2.size());
             }
-
-            std::vector<std::vector<u8>> encounters;
-            int count = 0;
-            for (size_t i = 0; i < size;)
-            {
-                int length;
-                if (game & Game::BW)
-                {
-                    if (std::binary_search(std::begin(bwLocations), std::end(bwLocations), count))
-                    {
-                        length = 928;
-                    }
-                    else
-                    {
-                        length = 232;
-                    }
-                }
-                else
-                {
-                    if (std::binary_search(std::begin(bw2Locations), std::end(bw2Locations), count))
-                    {
-                        length = 928;
-                    }
-                    else
-                    {
-                        length = 232;
-                    }
-                }
-
-                std::vector<u8> entry(length);
-                std::memcpy(entry.data(), data + i, size);
-                encounters.emplace_back(entry);
-
-                i += size;
-                count++;
-            }
-
-            return encounters;
         }
 
-        u16 getValue(const std::vector<u8> &data, int offset)
+        u16 getLength(Game game, u8 location)
         {
-            return static_cast<u16>(data[offset + 1] << 8) | data[offset];
+            bool seasons = (game & Game::BW) ? std::binary_search(std::begin(bwLocations), std::end(bwLocations), location)
+                                             : std::binary_search(std::begin(bw2Locations), std::end(bw2Locations), location);
+            return seasons ? 928 : 232;
         }
 
         PersonalInfo getInfo(const PersonalInfo *info, u16 species, u8 form)
@@ -114,7 +73,7 @@ namespace Encounters5
             return personal;
         }
 
-        std::vector<EncounterArea5> getAreas(const std::vector<u8> &data, Encounter encounter, const PersonalInfo *info, u8 location,
+        std::vector<EncounterArea5> getAreas(const EncounterEntry &data, Encounter encounter, const PersonalInfo *info, u8 location,
                                              u8 season)
         {
             std::vector<EncounterArea5> encounters;
@@ -126,98 +85,98 @@ namespace Encounters5
             }
 
             // Grass
-            if (data[offset] != 0 && encounter == Encounter::Grass)
+            if (data.getByte(offset) != 0 && encounter == Encounter::Grass)
             {
                 std::vector<Slot> grass;
                 for (int i = 0; i < 12; i++)
                 {
-                    u16 species = getValue(data, offset + 8 + i * 4);
-                    u8 min = data[offset + 10 + i * 4];
-                    u8 max = data[offset + 11 + i * 4];
+                    u16 species = data.getLittleEndian(offset + 8 + i * 4);
+                    u8 min = data.getByte(offset + 10 + i * 4);
+                    u8 max = data.getByte(offset + 11 + i * 4);
                     grass.emplace_back(species & 0x7ff, min, max, getInfo(info, species & 0x7ff, species >> 11));
                 }
                 encounters.emplace_back(location, Encounter::Grass, grass);
             }
 
             // Double Grass
-            if (data[offset + 1] != 0 && encounter == Encounter::DoubleGrass)
+            if (data.getByte(offset + 1) != 0 && encounter == Encounter::DoubleGrass)
             {
                 std::vector<Slot> doubleGrass;
                 for (int i = 0; i < 12; i++)
                 {
-                    u16 species = getValue(data, offset + 56 + i * 4);
-                    u8 min = data[offset + 58 + i * 4];
-                    u8 max = data[offset + 59 + i * 4];
+                    u16 species = data.getLittleEndian(offset + 56 + i * 4);
+                    u8 min = data.getByte(offset + 58 + i * 4);
+                    u8 max = data.getByte(offset + 59 + i * 4);
                     doubleGrass.emplace_back(species & 0x7ff, min, max, getInfo(info, species & 0x7ff, species >> 11));
                 }
                 encounters.emplace_back(location, Encounter::DoubleGrass, doubleGrass);
             }
 
             // Special Grass
-            if (data[offset + 2] != 0 && encounter == Encounter::SpecialGrass)
+            if (data.getByte(offset + 2) != 0 && encounter == Encounter::SpecialGrass)
             {
                 std::vector<Slot> specialGrass;
                 for (int i = 0; i < 12; i++)
                 {
-                    u16 species = getValue(data, offset + 104 + i * 4);
-                    u8 min = data[offset + 106 + i * 4];
-                    u8 max = data[offset + 107 + i * 4];
+                    u16 species = data.getLittleEndian(offset + 104 + i * 4);
+                    u8 min = data.getByte(offset + 106 + i * 4);
+                    u8 max = data.getByte(offset + 107 + i * 4);
                     specialGrass.emplace_back(species & 0x7ff, min, max, getInfo(info, species & 0x7ff, species >> 11));
                 }
                 encounters.emplace_back(location, Encounter::SpecialGrass, specialGrass);
             }
 
             // Surf
-            if (data[offset + 3] != 0 && encounter == Encounter::Surfing)
+            if (data.getByte(offset + 3) != 0 && encounter == Encounter::Surfing)
             {
                 std::vector<Slot> surf;
                 for (int i = 0; i < 5; i++)
                 {
-                    u16 species = getValue(data, offset + 152 + i * 4);
-                    u8 min = data[offset + 154 + i * 4];
-                    u8 max = data[offset + 155 + i * 4];
+                    u16 species = data.getLittleEndian(offset + 152 + i * 4);
+                    u8 min = data.getByte(offset + 154 + i * 4);
+                    u8 max = data.getByte(offset + 155 + i * 4);
                     surf.emplace_back(species & 0x7ff, min, max, getInfo(info, species & 0x7ff, species >> 11));
                 }
                 encounters.emplace_back(location, Encounter::Surfing, surf);
             }
 
             // Special Surf
-            if (data[offset + 4] != 0 && encounter == Encounter::SpecialSurf)
+            if (data.getByte(offset + 4) != 0 && encounter == Encounter::SpecialSurf)
             {
                 std::vector<Slot> specialSurf;
                 for (int i = 0; i < 5; i++)
                 {
-                    u16 species = getValue(data, offset + 172 + i * 4);
-                    u8 min = data[offset + 174 + i * 4];
-                    u8 max = data[offset + 175 + i * 4];
+                    u16 species = data.getLittleEndian(offset + 172 + i * 4);
+                    u8 min = data.getByte(offset + 174 + i * 4);
+                    u8 max = data.getByte(offset + 175 + i * 4);
                     specialSurf.emplace_back(species & 0x7ff, min, max, getInfo(info, species & 0x7ff, species >> 11));
                 }
                 encounters.emplace_back(location, Encounter::SpecialSurf, specialSurf);
             }
 
             // Fish
-            if (data[offset + 5] != 0 && encounter == Encounter::SuperRod)
+            if (data.getByte(offset + 5) != 0 && encounter == Encounter::SuperRod)
             {
                 std::vector<Slot> fish;
                 for (int i = 0; i < 5; i++)
                 {
-                    u16 species = getValue(data, offset + 192 + i * 4);
-                    u8 min = data[offset + 194 + i * 4];
-                    u8 max = data[offset + 195 + i * 4];
+                    u16 species = data.getLittleEndian(offset + 192 + i * 4);
+                    u8 min = data.getByte(offset + 194 + i * 4);
+                    u8 max = data.getByte(offset + 195 + i * 4);
                     fish.emplace_back(species & 0x7ff, min, max, getInfo(info, species & 0x7ff, species >> 11));
                 }
                 encounters.emplace_back(location, Encounter::SuperRod, fish);
             }
 
             // Special Fish
-            if (data[offset + 6] != 0 && encounter == Encounter::SpecialSuperRod)
+            if (data.getByte(offset + 6) != 0 && encounter == Encounter::SpecialSuperRod)
             {
                 std::vector<Slot> specialFish;
                 for (int i = 0; i < 5; i++)
                 {
-                    u16 species = getValue(data, offset + 212 + i * 4);
-                    u8 min = data[offset + 214 + i * 4];
-                    u8 max = data[offset + 215 + i * 4];
+                    u16 species = data.getLittleEndian(offset + 212 + i * 4);
+                    u8 min = data.getByte(offset + 214 + i * 4);
+                    u8 max = data.getByte(offset + 215 + i * 4);
                     specialFish.emplace_back(species & 0x7ff, min, max, getInfo(info, species & 0x7ff, species >> 11));
                 }
                 encounters.emplace_back(location, Encounter::SpecialSuperRod, specialFish);
@@ -227,18 +186,33 @@ namespace Encounters5
         }
     }
 
-    std::vector<EncounterArea5> getEncounters(Encounter encounter, u8 season, Game version)
+    const std::vector<EncounterArea5> &getEncounters(Encounter encounter, u8 season, Game version)
     {
+        static std::unordered_map<u32, std::vector<EncounterArea5>> cache;
+        static std::mutex mutex;
+
+        u32 key = static_cast<u32>(version) | (static_cast<u32>(encounter) << 16) | (static_cast<u32>(season) << 24);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = cache.find(key);
+        if (it != cache.end())
+        {
+            return it->second;
+        }
+
         std::vector<EncounterArea5> encounters;
         auto info = PersonalLoader5::getPersonal();
 
-        const auto &encounterData = getData(version);
-        for (size_t i = 0; i < encounterData.size(); i++)
+        auto [data, size] = getData(version);
+        u8 location = 0;
+        for (size_t offset = 0; offset < size; location++)
         {
-            auto areas = getAreas(encounterData[i], encounter, info, i, season);
+            u16 length = getLength(version, location);
+            auto areas = getAreas(EncounterEntry(data + offset, length), encounter, info, location, season);
             encounters.insert(encounters.end(), areas.begin(), areas.end());
+            offset += length;
         }
 
-        return encounters;
+        return cache.emplace(key, std::move(encounters)).first->second;
     }
 }
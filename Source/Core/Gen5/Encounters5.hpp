@@ -29,7 +29,7 @@ enum Game : u16;
 
 namespace Encounters5
 {
-    std::vector<EncounterArea5> getEncounters(Encounter encounter, u8 season, Game version);
+    const std::vector<EncounterArea5> &getEncounters(Encounter encounter, u8 season, Game version);
 }
 
 #endif // ENCOUNTERS5_HPP
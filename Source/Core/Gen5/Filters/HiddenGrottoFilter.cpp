@@ -45,3 +45,12 @@ bool HiddenGrottoFilter::compareState(const HiddenGrottoState &state) const
 
     return true;
 }
+
+void HiddenGrottoFilter::addParameters(std::vector<u64> &parameters) const
+{
+    for (const auto &flags : { groups, encounterSlots, genders })
+    {
+        parameters.emplace_back(flags.size());
+        parameters.insert(parameters.end(), flags.begin(), flags.end());
+    }
+}
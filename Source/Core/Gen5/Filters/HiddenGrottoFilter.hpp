@@ -30,6 +30,7 @@ class HiddenGrottoFilter
 public:
     HiddenGrottoFilter(const std::vector<bool> &groups, const std::vector<bool> &encounterSlots, const std::vector<bool> &genders);
     bool compareState(const HiddenGrottoState &state) const;
+    void addParameters(std::vector<u64> &parameters) const;
 
 private:
     std::vector<bool> groups;
@@ -76,7 +76,6 @@ std::vector<DreamRadarState> DreamRadarGenerator::generate(u64 seed, bool memory
         {
             state.setIVs(i, rngList.getValue());
         }
-        state.calculateHiddenPower();
 
         go.next(); // Advance skip ???
         u32 pid = go.nextUInt();
@@ -22,6 +22,7 @@
 #include <Core/Enum/Method.hpp>
 #include <Core/RNG/LCRNG64.hpp>
 #include <Core/RNG/MTFast.hpp>
+#include <Core/RNG/RNGList.hpp>
 #include <algorithm>
 
 inline bool isShiny(u32 pid, u16 tsv)
@@ -53,6 +54,12 @@ std::vector<EggState> EggGenerator5::generate(u64 seed) const
     }
 }
 
+void EggGenerator5::addParameters(std::vector<u64> &parameters) const
+{
+    EggGenerator::addParameters(parameters);
+    parameters.emplace_back(rolls);
+}
+
 std::vector<EggState> EggGenerator5::generateBW(u64 seed) const
 {
     std::vector<EggState> states;
@@ -65,33 +72,34 @@ std::vector<EggState> EggGenerator5::generateBW(u64 seed) const
     BWRNG rng(seed);
     rng.advance(initialAdvances + offset);
 
-    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
+    RNGList64<BWRNG, 32> rngList(rng.getSeed());
+
+    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rngList.advanceState())
     {
         EggState state(cnt + initialAdvances);
 
-        BWRNG go(rng.getSeed());
-        state.setSeed(go.nextUInt(0x1fff)); // Chatot pitch
+        state.setSeed(rngList.nextUInt(0x1fff)); // Chatot pitch
 
-        go.advance(1);
+        rngList.advance(1);
 
         // False: Nidoran-F / Volbeat
         // True: Nidoran-M / Illumise
         if (daycare.getNidoranVolbeat())
         {
             // TODO
-            go.nextUInt(2);
+            rngList.nextUInt(2);
         }
 
-        u8 nature = go.nextUInt(25);
+        u8 nature = rngList.nextUInt(25);
         // Everstone
         if (everstone != 0)
         {
-            if ((go.nextUInt(2)) == 1)
+            if ((rngList.nextUInt(2)) == 1)
             {
                 // 0->parent1 / 1->parent2
                 if (everstone == 2)
                 {
-                    nature = daycare.getParentNature(go.nextUInt(2));
+                    nature = daycare.getParentNature(rngList.nextUInt(2));
                 }
                 else
                 {
@@ -103,11 +111,11 @@ std::vector<EggState> EggGenerator5::generateBW(u64 seed) const
         state.setNature(nature);
 
         // Add check for mother having HA
-        bool hiddenAbility = go.nextUInt(100) >= 40 && parentAbility == 2;
+        bool hiddenAbility = rngList.nextUInt(100) >= 40 && parentAbility == 2;
 
         // Ability inheritance doesn't get used outside of hidden ability
         /*u8 ability;
-        u8 abilityRand = go.nextUInt(100);
+        u8 abilityRand = rngList.nextUInt(100);
         if (parentAbility == 0)
         {
             ability = abilityRand < 80 ? 0 : 1;
@@ -124,8 +132,8 @@ std::vector<EggState> EggGenerator5::generateBW(u64 seed) const
         // Reroll ability to remove HA
         if (ditto)
         {
-            // ability = go.nextUInt(2);
-            go.advance(1);
+            // ability = rngList.nextUInt(2);
+            rngList.advance(1);
             hiddenAbility = false;
         }
 
@@ -136,10 +144,10 @@ std::vector<EggState> EggGenerator5::generateBW(u64 seed) const
             inheritance = 1;
 
             // If both parents holding power item
-            // go.nextUInt(2) to determine which parent
+            // rngList.nextUInt(2) to determine which parent
             if (poweritem == 2)
             {
-                u8 parent = go.nextUInt(2);
+                u8 parent = rngList.nextUInt(2);
                 u8 item = daycare.getParentItem(parent);
 
                 state.setIVs(item - 2, daycare.getParentIV(parent, item - 2));
@@ -158,8 +166,8 @@ std::vector<EggState> EggGenerator5::generateBW(u64 seed) const
         // IV Inheritance
         for (; inheritance < 3;)
         {
-            u8 index = go.nextUInt(6);
-            u8 parent = go.nextUInt(2);
+            u8 index = rngList.nextUInt(6);
+            u8 parent = rngList.nextUInt(2);
 
             // Assign stat inheritance
             if (state.getInheritance(index) == 0)
@@ -177,12 +185,11 @@ std::vector<EggState> EggGenerator5::generateBW(u64 seed) const
                 state.setIVs(i, ivs[i]);
             }
         }
-        state.calculateHiddenPower();
 
-        u32 pid = go.nextUInt(0xffffffff);
+        u32 pid = rngList.nextUInt(0xffffffff);
         for (u8 i = 0; i < rolls && !isShiny(pid, tsv); i++)
         {
-            pid = go.nextUInt(0xffffffff);
+            pid = rngList.nextUInt(0xffffffff);
         }
 
         state.setPID(pid);
@@ -351,7 +358,6 @@ EggState EggGenerator5::generateBW2Egg(u64 seed) const
             state.setIVs(i, rng.nextUInt(32));
         }
     }
-    state.calculateHiddenPower();
 
     return state;
 }
@@ -31,6 +31,7 @@ public:
     EggGenerator5(u32 initialAdvances, u32 maxAdvances, u16 tid, u16 sid, u8 genderRatio, Method method, const StateFilter &filter,
                   const Daycare &daycare, bool shinyCharm);
     std::vector<EggState> generate(u64 seed) const;
+    void addParameters(std::vector<u64> &parameters) const;
 
 private:
     u8 rolls;
@@ -63,7 +63,6 @@ std::vector<State> EventGenerator5::generate(u64 seed) const
                 state.setIVs(i, parameterIV);
             }
         }
-        state.calculateHiddenPower();
 
         // 2 blanks
         go.advance(2);
@@ -138,3 +137,18 @@ std::vector<State> EventGenerator5::generate(u64 seed) const
 
     return states;
 }
+
+void EventGenerator5::addParameters(std::vector<u64> &parameters) const
+{
+    Generator::addParameters(parameters);
+
+    // The member holding the wondercard is shadowed by the argument here
+    const PGF &pgf = this->parameters;
+    parameters.insert(parameters.end(),
+                      { pgf.getTID(), pgf.getSID(), pgf.getSpecies(), pgf.getNature(), pgf.getGender(), pgf.getAbilityType(),
+                        pgf.getPIDType(), pgf.isEgg(), wondercardAdvances });
+    for (u8 i = 0; i < 6; i++)
+    {
+        parameters.emplace_back(pgf.getIV(i));
+    }
+}
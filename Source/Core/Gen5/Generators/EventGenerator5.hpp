@@ -31,6 +31,7 @@ public:
     EventGenerator5(u32 initialAdvances, u32 maxAdvances, u16 tid, u16 sid, u8 genderRatio, Method method, const StateFilter &filter,
                     const PGF &parameters);
     std::vector<State> generate(u64 seed) const;
+    void addParameters(std::vector<u64> &parameters) const;
 
 private:
     PGF parameters;
@@ -19,6 +19,7 @@
 
 #include "HiddenGrottoGenerator.hpp"
 #include <Core/RNG/LCRNG64.hpp>
+#include <Core/RNG/RNGList.hpp>
 #include <Core/Util/Utilities.hpp>
 
 // Game has all of these + 1, removed for simplicity
@@ -35,6 +36,12 @@ void HiddenGrottoGenerator::setInitialAdvances(u32 initialAdvances)
     this->initialAdvances = initialAdvances;
 }
 
+void HiddenGrottoGenerator::addParameters(std::vector<u64> &parameters) const
+{
+    parameters.insert(parameters.end(), { initialAdvances, maxAdvances, genderRatio, powerLevel });
+    filter.addParameters(parameters);
+}
+
 std::vector<HiddenGrottoState> HiddenGrottoGenerator::generate(u64 seed) const
 {
     std::vector<HiddenGrottoState> states;
@@ -42,23 +49,24 @@ std::vector<HiddenGrottoState> HiddenGrottoGenerator::generate(u64 seed) const
     BWRNG rng(seed);
     rng.advance(initialAdvances);
 
-    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
+    RNGList64<BWRNG, 8> rngList(rng.getSeed());
+
+    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rngList.advanceState())
     {
-        BWRNG go(rng.getSeed());
-        u32 seed = ((go.getSeed() >> 32) * 0x1FFF) >> 32;
-        if (go.nextUInt(100) < powerLevel)
+        u32 seed = ((rngList.getSeed() >> 32) * 0x1FFF) >> 32;
+        if (rngList.nextUInt(100) < powerLevel)
         {
-            u8 group = go.nextUInt(4);
+            u8 group = rngList.nextUInt(4);
 
             // Game does slot + 1, removed for simplicity
-            u8 slotRand = go.nextUInt(100);
+            u8 slotRand = rngList.nextUInt(100);
             u8 slot = 0;
             while (slotRand > grottoSlots[slot])
             {
                 slot++;
             }
 
-            u8 gender = go.nextUInt(100) < genderRatio;
+            u8 gender = rngList.nextUInt(100) < genderRatio;
 
             HiddenGrottoState state(seed, initialAdvances + cnt, group, slot, gender);
             if (filter.compareState(state))
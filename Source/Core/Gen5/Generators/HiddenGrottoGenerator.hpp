@@ -32,6 +32,7 @@ public:
     HiddenGrottoGenerator(u32 initialAdvances, u32 maxAdvances, u8 genderRatio, u8 powerLevel, const HiddenGrottoFilter &filter);
     std::vector<HiddenGrottoState> generate(u64 seed) const;
     void setInitialAdvances(u32 initialAdvances);
+    void addParameters(std::vector<u64> &parameters) const;
 
 private:
     u32 initialAdvances;
@@ -84,6 +84,12 @@ std::vector<StationaryState> StationaryGenerator5::generate(u64 seed) const
     return std::vector<StationaryState>();
 }
 
+void StationaryGenerator5::addParameters(std::vector<u64> &parameters) const
+{
+    StationaryGenerator::addParameters(parameters);
+    parameters.insert(parameters.end(), { idBit, static_cast<u64>(encounter), gender });
+}
+
 std::vector<StationaryState> StationaryGenerator5::generateRoamerIVs(u64 seed) const
 {
     std::vector<StationaryState> states;
@@ -106,7 +112,6 @@ std::vector<StationaryState> StationaryGenerator5::generateRoamerIVs(u64 seed) c
         u8 spa = rngList.getValue();
 
         state.setIVs(hp, atk, def, spa, spd, spe);
-        state.calculateHiddenPower();
 
         if (filter.compareIVs(state))
         {
@@ -138,7 +143,6 @@ std::vector<StationaryState> StationaryGenerator5::generateIVs(u64 seed) const
         u8 spe = rngList.getValue();
 
         state.setIVs(hp, atk, def, spa, spd, spe);
-        state.calculateHiddenPower();
 
         if (filter.compareIVs(state))
         {
@@ -172,7 +176,6 @@ std::vector<StationaryState> StationaryGenerator5::generateRoamerCGear(u64 seed)
         u8 spa = rngList.getValue();
 
         state.setIVs(hp, atk, def, spa, spd, spe);
-        state.calculateHiddenPower();
 
         if (filter.compareIVs(state))
         {
@@ -205,7 +208,6 @@ std::vector<StationaryState> StationaryGenerator5::generateCGear(u64 seed) const
         u8 spe = rngList.getValue();
 
         state.setIVs(hp, atk, def, spa, spd, spe);
-        state.calculateHiddenPower();
 
         if (filter.compareIVs(state))
         {
@@ -223,16 +225,17 @@ std::vector<StationaryState> StationaryGenerator5::generateStationary(u64 seed)
     BWRNG rng(seed);
     rng.advance(initialAdvances + offset);
 
-    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
+    RNGList64<BWRNG, 8> rngList(rng.getSeed());
+
+    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rngList.advanceState())
     {
         StationaryState state(initialAdvances + cnt);
-        BWRNG go(rng.getSeed());
 
         u32 pid;
         if (lead == Lead::Synchronize)
         {
-            bool synch = (go.nextUInt() >> 31) == 1;
-            pid = go.nextUInt() ^ 0x10000;
+            bool synch = (rngList.nextUInt() >> 31) == 1;
+            pid = rngList.nextUInt() ^ 0x10000;
 
             if (synch)
             {
@@ -240,23 +243,23 @@ std::vector<StationaryState> StationaryGenerator5::generateStationary(u64 seed)
             }
             else
             {
-                state.setNature(go.nextUInt(25));
+                state.setNature(rngList.nextUInt(25));
             }
         }
         else if (lead >= Lead::CuteCharm && lead <= Lead::CuteCharmFemale)
         {
-            bool charm = (go.nextUInt(0xffff) / 656) < 67;
-            pid = go.nextUInt() ^ 0x10000;
+            bool charm = (rngList.nextUInt(0xffff) / 656) < 67;
+            pid = rngList.nextUInt() ^ 0x10000;
 
             if (!charm)
             {
-                state.setNature(go.nextUInt(25));
+                state.setNature(rngList.nextUInt(25));
             }
             else
             {
                 // TODO: fix hard coded gender
-                pid = Utilities::forceGender(pid, go.next(), 0, genderRatio);
-                state.setNature(go.nextUInt(25));
+                pid = Utilities::forceGender(pid, rngList.next(), 0, genderRatio);
+                state.setNature(rngList.nextUInt(25));
             }
         }
         // else if (lead == Lead::Search)
@@ -265,9 +268,9 @@ std::vector<StationaryState> StationaryGenerator5::generateStationary(u64 seed)
         //}
         else // No lead
         {
-            go.advance(1);
-            pid = go.nextUInt() ^ 0x10000;
-            state.setNature(go.nextUInt(25));
+            rngList.advance(1);
+            pid = rngList.nextUInt() ^ 0x10000;
+            state.setNature(rngList.nextUInt(25));
         }
 
         u8 val = idBit ^ (pid & 1) ^ (pid >> 31);
@@ -297,13 +300,14 @@ std::vector<StationaryState> StationaryGenerator5::generateRoamer(u64 seed) cons
     BWRNG rng(seed);
     rng.advance(initialAdvances + offset);
 
-    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
+    RNGList64<BWRNG, 8> rngList(rng.getSeed());
+
+    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rngList.advanceState())
     {
         StationaryState state(initialAdvances + cnt);
-        BWRNG go(rng.getSeed());
 
-        u32 pid = go.nextUInt();
-        state.setNature(go.nextUInt(25));
+        u32 pid = rngList.nextUInt();
+        state.setNature(rngList.nextUInt(25));
 
         state.setPID(pid);
         state.setAbility((pid >> 16) & 1);
@@ -326,13 +330,14 @@ std::vector<StationaryState> StationaryGenerator5::generateGift(u64 seed) const
     BWRNG rng(seed);
     rng.advance(initialAdvances + offset);
 
-    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
+    RNGList64<BWRNG, 8> rngList(rng.getSeed());
+
+    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rngList.advanceState())
     {
         StationaryState state(initialAdvances + cnt);
-        BWRNG go(rng.getSeed());
 
-        u32 pid = go.nextUInt() ^ 0x10000;
-        state.setNature(go.nextUInt(25));
+        u32 pid = rngList.nextUInt() ^ 0x10000;
+        state.setNature(rngList.nextUInt(25));
 
         state.setPID(pid);
         state.setAbility((pid >> 16) & 1);
@@ -355,10 +360,11 @@ std::vector<StationaryState> StationaryGenerator5::generateEntraLink(u64 seed) c
     BWRNG rng(seed);
     rng.advance(initialAdvances + offset);
 
-    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
+    RNGList64<BWRNG, 8> rngList(rng.getSeed());
+
+    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rngList.advanceState())
     {
         StationaryState state(initialAdvances + cnt);
-        BWRNG go(rng.getSeed());
 
         // TODO
     }
@@ -373,14 +379,15 @@ std::vector<StationaryState> StationaryGenerator5::generateLarvestaEgg(u64 seed)
     BWRNG rng(seed);
     rng.advance(initialAdvances + offset);
 
-    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
+    RNGList64<BWRNG, 8> rngList(rng.getSeed());
+
+    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rngList.advanceState())
     {
         StationaryState state(initialAdvances + cnt);
-        BWRNG go(rng.getSeed());
 
-        u32 pid = go.nextUInt();
-        go.advance(1);
-        state.setNature(go.nextUInt(25));
+        u32 pid = rngList.nextUInt();
+        rngList.advance(1);
+        state.setNature(rngList.nextUInt(25));
 
         state.setPID(pid);
         state.setAbility((pid >> 16) & 1);
@@ -403,40 +410,41 @@ std::vector<StationaryState> StationaryGenerator5::generateHiddenGrotto(u64 seed
     BWRNG rng(seed);
     rng.advance(initialAdvances + offset);
 
-    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rng.next())
+    RNGList64<BWRNG, 8> rngList(rng.getSeed());
+
+    for (u32 cnt = 0; cnt <= maxAdvances; cnt++, rngList.advanceState())
     {
         StationaryState state(initialAdvances + cnt);
-        BWRNG go(rng.getSeed());
-        state.setSeed(go.nextUInt(0x1FFF));
+        state.setSeed(rngList.nextUInt(0x1FFF));
 
         bool leadAffects = false;
         if (lead == Lead::Synchronize)
         {
-            leadAffects = (go.nextUInt() >> 31) == 1;
+            leadAffects = (rngList.nextUInt() >> 31) == 1;
         }
         else if (lead >= Lead::CuteCharm && lead <= Lead::CuteCharmFemale)
         {
             // PIDRNG frame is 'skipped' if cute charm would not have affected the frame
-            leadAffects = (go.nextUInt(0xffff) / 656) < 67;
+            leadAffects = (rngList.nextUInt(0xffff) / 656) < 67;
             if (!leadAffects)
             {
-                go.advance(1);
+                rngList.advance(1);
             }
         }
         else
         {
-            go.advance(1);
+            rngList.advance(1);
         }
-        u32 pid = go.nextUInt();
+        u32 pid = rngList.nextUInt();
 
         if (genderRatio == 255)
         {
-            state.setNature(go.nextUInt(25));
+            state.setNature(rngList.nextUInt(25));
         }
         else
         {
-            pid = Utilities::forceGender(pid, go.nextUInt(), gender, genderRatio);
-            state.setNature(go.nextUInt(25));
+            pid = Utilities::forceGender(pid, rngList.nextUInt(), gender, genderRatio);
+            state.setNature(rngList.nextUInt(25));
         }
 
         if (lead == Lead::Synchronize && leadAffects)
@@ -32,6 +32,7 @@ public:
     StationaryGenerator5(u32 initialAdvances, u32 maxAdvances, u16 tid, u16 sid, u8 gender, u8 genderRatio, Method method,
                          Encounter encounter, const StateFilter &filter);
     std::vector<StationaryState> generate(u64 seed) const;
+    void addParameters(std::vector<u64> &parameters) const;
 
 private:
     u8 idBit;
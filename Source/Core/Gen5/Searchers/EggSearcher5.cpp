@@ -22,55 +22,99 @@
 #include <Core/Gen5/Keypresses.hpp>
 #include <Core/RNG/SHA1.hpp>
 #include <Core/Util/Utilities.hpp>
-#include <future>
+#include <algorithm>
 
 EggSearcher5::EggSearcher5(const Profile5 &profile) : profile(profile), searching(false), progress(0)
 {
 }
 
-void EggSearcher5::startSearch(const EggGenerator5 &generator, int threads, Date start, const Date &end)
+void EggSearcher5::setCheckpoint(const std::string &fileName)
 {
-    searching = true;
+    checkpointFile = fileName;
+}
 
-    auto days = start.daysTo(end) + 1;
-    if (days < threads)
-    {
-        threads = days;
-    }
+void EggSearcher5::setShard(const SearchShard &shard)
+{
+    this->shard = shard;
+}
 
-    std::vector<std::future<void>> threadContainer;
+void EggSearcher5::setResultBudget(const ResultBudget &budget)
+{
+    results.setBudget(budget);
+}
 
-    auto daysSplit = days / threads;
-    for (int i = 0; i < threads; i++)
+void EggSearcher5::setSeedDatabase(const SeedDatabase5 *database)
+{
+    this->database = database;
+}
+
+void EggSearcher5::setPriority(int priority)
+{
+    job.setPriority(priority);
+}
+
+void EggSearcher5::startSearch(const EggGenerator5 &generator, int threads, Date start, Date end)
+{
+    job.start();
+    searching = true;
+
+    // Only search the dates that belong to this shard
+    auto range = shard.getRange(0, start.daysTo(end) + 1);
+    if (range.first == range.second)
     {
-        if (i == threads - 1)
-        {
-            threadContainer.emplace_back(std::async([=] { search(generator, start, end); }));
-        }
-        else
-        {
-            Date mid = start.addDays(daysSplit - 1);
-            threadContainer.emplace_back(std::async([=] { search(generator, start, mid); }));
-        }
-        start = start.addDays(daysSplit);
+        return;
     }
+    end = start.addDays(range.second - 1);
+    start = start.addDays(range.first);
 
-    for (int i = 0; i < threads; i++)
+    auto days = start.daysTo(end) + 1;
+    if (days < threads)
     {
-        threadContainer[i].wait();
+        threads = days;
     }
+
+    // Each chunk is a single date, timer0 and keypress
+    u32 timer0Count = profile.getTimer0Max() - profile.getTimer0Min() + 1;
+    u32 buttonCount = static_cast<u32>(Keypresses::getKeyPresses(profile.getKeypresses(), profile.getSkipLR()).size());
+    std::vector<u64> parameters = SeedDatabase5::getParameters(profile);
+    parameters.insert(parameters.end(), { profile.getMemoryLink(), profile.getShinyCharm(), buttonCount,
+                                          static_cast<u64>(Date().daysTo(start)), static_cast<u64>(days) });
+    generator.addParameters(parameters);
+    SearchCheckpoint checkpoint(checkpointFile, parameters, days * timer0Count * buttonCount, sizeof(SearcherState5<EggState>));
+    results.add(checkpoint.getResults<SearcherState5<EggState>>());
+    stats.start(static_cast<u64>(days) * timer0Count * buttonCount * 86400, threads);
+
+    Date first = start;
+
+    // Every date is a task of the shared scheduler, threads only limits how many of them run at the same time
+    stats.startJob();
+    job.run(static_cast<u32>(days), threads, [&](u32 day, u32 slot) {
+        Date date = first.addDays(static_cast<int>(day));
+        search(generator, date, date, first, slot, checkpoint);
+    });
+    stats.finishJob();
 }
 
 void EggSearcher5::cancelSearch()
 {
     searching = false;
+    results.cancel();
+    job.cancel();
+}
+
+void EggSearcher5::pauseSearch()
+{
+    job.pause();
+}
+
+void EggSearcher5::resumeSearch()
+{
+    job.resume();
 }
 
 std::vector<SearcherState5<EggState>> EggSearcher5::getResults()
 {
-    std::lock_guard<std::mutex> lock(mutex);
-    auto data = std::move(results);
-    return data;
+    return results.take();
 }
 
 int EggSearcher5::getProgress() const
@@ -78,13 +122,23 @@ int EggSearcher5::getProgress() const
     return progress;
 }
 
-void EggSearcher5::search(EggGenerator5 generator, const Date &start, const Date &end)
+SearchStats EggSearcher5::getStats() const
+{
+    return stats.getStats();
+}
+
+void EggSearcher5::search(EggGenerator5 generator, const Date &start, const Date &end, const Date &first, u32 slot,
+                          SearchCheckpoint &checkpoint)
 {
     bool flag = profile.getVersion() & Game::BW;
 
     SHA1 sha(profile);
     auto buttons = Keypresses::getKeyPresses(profile.getKeypresses(), profile.getSkipLR());
     auto values = Keypresses::getValues(buttons);
+    std::vector<u64> seeds(60);
+    bool useDatabase = database && database->matches(profile);
+    auto worker = stats.addWorker(slot);
+    u32 timer0Count = profile.getTimer0Max() - profile.getTimer0Min() + 1;
 
     for (u16 timer0 = profile.getTimer0Min(); timer0 <= profile.getTimer0Max(); timer0++)
     {
@@ -95,45 +149,75 @@ void EggSearcher5::search(EggGenerator5 generator, const Date &start, const Date
             sha.precompute();
             for (size_t i = 0; i < values.size(); i++)
             {
+                auto chunk = static_cast<u32>((first.daysTo(date) * timer0Count + timer0 - profile.getTimer0Min()) * values.size() + i);
+                if (checkpoint.isCompleted(chunk))
+                {
+                    stats.addSkipped(86400);
+                    progress++;
+                    continue;
+                }
+
                 sha.setButton(values[i]);
+                const u64 *stored = useDatabase ? database->getSeeds(date, timer0, i) : nullptr;
+                std::vector<SearcherState5<EggState>> chunkStates;
 
                 for (u8 hour = 0; hour < 24; hour++)
                 {
                     for (u8 minute = 0; minute < 60; minute++)
                     {
+                        if (stored)
+                        {
+                            std::copy_n(stored + hour * 3600 + minute * 60, 60, seeds.begin());
+                            worker.addLoaded(60);
+                        }
+                        else
+                        {
+                            for (u8 second = 0; second < 60; second++)
+                            {
+                                sha.setTime(hour, minute, second, profile.getDSType());
+                                seeds[second] = sha.hashSeed();
+                            }
+                            worker.addHashed(60);
+                        }
+
+                        auto advances = flag ? Utilities::initialAdvancesBW(seeds)
+                                             : Utilities::initialAdvancesBW2(seeds, profile.getMemoryLink());
+                        worker.addAdvanced(60);
+
                         for (u8 second = 0; second < 60; second++)
                         {
                             if (!searching)
                             {
+                                auto lock = worker.lock(mutex);
+                                results.append(chunkStates);
                                 return;
                             }
 
-                            sha.setTime(hour, minute, second, profile.getDSType());
-                            u64 seed = sha.hashSeed();
+                            u64 seed = seeds[second];
 
-                            generator.setInitialAdvances(flag ? Utilities::initialAdvancesBW(seed)
-                                                              : Utilities::initialAdvancesBW2(seed, profile.getMemoryLink()));
+                            generator.setInitialAdvances(advances[second]);
                             auto states = generator.generate(seed);
+                            worker.addGenerated(1);
+                            worker.addPassed(states.size());
 
                             if (!states.empty())
                             {
-                                std::vector<SearcherState5<EggState>> displayStates;
-                                displayStates.reserve(states.size());
-
                                 DateTime dt(date, Time(hour, minute, second));
                                 for (const auto &state : states)
                                 {
-                                    displayStates.emplace_back(dt, seed, buttons[i], timer0, state);
+                                    chunkStates.emplace_back(dt, seed, buttons[i], timer0, state);
                                 }
-
-                                std::lock_guard<std::mutex> lock(mutex);
-                                results.insert(results.end(), displayStates.begin(), displayStates.end());
                             }
                         }
                     }
                 }
 
+                auto lock = worker.lock(mutex);
+                results.append(chunkStates);
+                checkpoint.complete(chunk, chunkStates);
                 progress++;
+                lock.unlock();
+                results.wait();
             }
         }
     }
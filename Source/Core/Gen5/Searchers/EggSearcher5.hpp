@@ -22,30 +22,50 @@
 
 #include <Core/Gen5/Generators/EggGenerator5.hpp>
 #include <Core/Gen5/Profile5.hpp>
+#include <Core/Gen5/SeedDatabase5.hpp>
 #include <Core/Gen5/States/SearcherState5.hpp>
 #include <Core/Util/Global.hpp>
+#include <Core/Util/JobScheduler.hpp>
+#include <Core/Util/ResultStore.hpp>
+#include <Core/Util/SearchCheckpoint.hpp>
+#include <Core/Util/SearchShard.hpp>
+#include <Core/Util/SearchStats.hpp>
 #include <atomic>
 #include <mutex>
+#include <string>
 
 class EggSearcher5
 {
 public:
     EggSearcher5() = default;
     explicit EggSearcher5(const Profile5 &profile);
-    void startSearch(const EggGenerator5 &generator, int threads, Date start, const Date &end);
+    void setCheckpoint(const std::string &fileName);
+    void setShard(const SearchShard &shard);
+    void setResultBudget(const ResultBudget &budget);
+    void setSeedDatabase(const SeedDatabase5 *database);
+    void setPriority(int priority);
+    void startSearch(const EggGenerator5 &generator, int threads, Date start, Date end);
     void cancelSearch();
+    void pauseSearch();
+    void resumeSearch();
     std::vector<SearcherState5<EggState>> getResults();
     int getProgress() const;
+    SearchStats getStats() const;
 
 private:
     Profile5 profile;
+    std::string checkpointFile;
+    SearchShard shard;
+    const SeedDatabase5 *database = nullptr;
 
     bool searching;
     std::atomic<int> progress;
-    std::vector<SearcherState5<EggState>> results;
+    ResultStore<SearcherState5<EggState>> results;
     std::mutex mutex;
+    SearchCounters stats;
+    JobControl job;
 
-    void search(EggGenerator5 generator, const Date &start, const Date &end);
+    void search(EggGenerator5 generator, const Date &start, const Date &end, const Date &first, u32 slot, SearchCheckpoint &checkpoint);
 };
 
 #endif // EGGSEARCHER5_HPP
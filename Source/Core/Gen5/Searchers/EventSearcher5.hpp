@@ -22,30 +22,50 @@
 
 #include <Core/Gen5/Generators/EventGenerator5.hpp>
 #include <Core/Gen5/Profile5.hpp>
+#include <Core/Gen5/SeedDatabase5.hpp>
 #include <Core/Gen5/States/SearcherState5.hpp>
 #include <Core/Util/Global.hpp>
+#include <Core/Util/JobScheduler.hpp>
+#include <Core/Util/ResultStore.hpp>
+#include <Core/Util/SearchCheckpoint.hpp>
+#include <Core/Util/SearchShard.hpp>
+#include <Core/Util/SearchStats.hpp>
 #include <atomic>
 #include <mutex>
+#include <string>
 
 class EventSearcher5
 {
 public:
     EventSearcher5() = default;
     explicit EventSearcher5(const Profile5 &profile);
-    void startSearch(const EventGenerator5 &generator, int threads, Date start, const Date &end);
+    void setCheckpoint(const std::string &fileName);
+    void setShard(const SearchShard &shard);
+    void setResultBudget(const ResultBudget &budget);
+    void setSeedDatabase(const SeedDatabase5 *database);
+    void setPriority(int priority);
+    void startSearch(const EventGenerator5 &generator, int threads, Date start, Date end);
     void cancelSearch();
+    void pauseSearch();
+    void resumeSearch();
     std::vector<SearcherState5<State>> getResults();
     int getProgress() const;
+    SearchStats getStats() const;
 
 private:
     Profile5 profile;
+    std::string checkpointFile;
+    SearchShard shard;
+    const SeedDatabase5 *database = nullptr;
 
     bool searching;
     std::atomic<int> progress;
-    std::vector<SearcherState5<State>> results;
+    ResultStore<SearcherState5<State>> results;
     std::mutex mutex;
+    SearchCounters stats;
+    JobControl job;
 
-    void search(EventGenerator5 generator, const Date &start, const Date &end);
+    void search(EventGenerator5 generator, const Date &start, const Date &end, const Date &first, u32 slot, SearchCheckpoint &checkpoint);
 };
 
 #endif // EVENTSEARCHER5_HPP
@@ -21,55 +21,99 @@
 #include <Core/Gen5/Keypresses.hpp>
 #include <Core/RNG/SHA1.hpp>
 #include <Core/Util/Utilities.hpp>
-#include <future>
+#include <algorithm>
 
 HiddenGrottoSearcher::HiddenGrottoSearcher(const Profile5 &profile) : profile(profile)
 {
 }
 
-void HiddenGrottoSearcher::startSearch(const HiddenGrottoGenerator &generator, int threads, Date start, const Date &end)
+void HiddenGrottoSearcher::setCheckpoint(const std::string &fileName)
 {
-    searching = true;
+    checkpointFile = fileName;
+}
 
-    auto days = start.daysTo(end) + 1;
-    if (days < threads)
-    {
-        threads = days;
-    }
+void HiddenGrottoSearcher::setShard(const SearchShard &shard)
+{
+    this->shard = shard;
+}
+
+void HiddenGrottoSearcher::setResultBudget(const ResultBudget &budget)
+{
+    results.setBudget(budget);
+}
+
+void HiddenGrottoSearcher::setSeedDatabase(const SeedDatabase5 *database)
+{
+    this->database = database;
+}
 
-    std::vector<std::future<void>> threadContainer;
+void HiddenGrottoSearcher::setPriority(int priority)
+{
+    job.setPriority(priority);
+}
+
+void HiddenGrottoSearcher::startSearch(const HiddenGrottoGenerator &generator, int threads, Date start, Date end)
+{
+    job.start();
+    searching = true;
 
-    auto daysSplit = days / threads;
-    for (int i = 0; i < threads; i++)
+    // Only search the dates that belong to this shard
+    auto range = shard.getRange(0, start.daysTo(end) + 1);
+    if (range.first == range.second)
     {
-        if (i == threads - 1)
-        {
-            threadContainer.emplace_back(std::async(std::launch::async, [=] { search(generator, start, end); }));
-        }
-        else
-        {
-            Date mid = start.addDays(daysSplit - 1);
-            threadContainer.emplace_back(std::async(std::launch::async, [=] { search(generator, start, mid); }));
-        }
-        start = start.addDays(daysSplit);
+        return;
     }
+    end = start.addDays(range.second - 1);
+    start = start.addDays(range.first);
 
-    for (int i = 0; i < threads; i++)
+    auto days = start.daysTo(end) + 1;
+    if (days < threads)
     {
-        threadContainer[i].wait();
+        threads = days;
     }
+
+    // Each chunk is a single date, timer0 and keypress
+    u32 timer0Count = profile.getTimer0Max() - profile.getTimer0Min() + 1;
+    u32 buttonCount = static_cast<u32>(Keypresses::getKeyPresses(profile.getKeypresses(), profile.getSkipLR()).size());
+    std::vector<u64> parameters = SeedDatabase5::getParameters(profile);
+    parameters.insert(parameters.end(), { profile.getMemoryLink(), profile.getShinyCharm(), buttonCount,
+                                          static_cast<u64>(Date().daysTo(start)), static_cast<u64>(days) });
+    generator.addParameters(parameters);
+    SearchCheckpoint checkpoint(checkpointFile, parameters, days * timer0Count * buttonCount, sizeof(SearcherState5<HiddenGrottoState>));
+    results.add(checkpoint.getResults<SearcherState5<HiddenGrottoState>>());
+    stats.start(static_cast<u64>(days) * timer0Count * buttonCount * 86400, threads);
+
+    Date first = start;
+
+    // Every date is a task of the shared scheduler, threads only limits how many of them run at the same time
+    stats.startJob();
+    job.run(static_cast<u32>(days), threads, [&](u32 day, u32 slot) {
+        Date date = first.addDays(static_cast<int>(day));
+        search(generator, date, date, first, slot, checkpoint);
+    });
+    stats.finishJob();
 }
 
 void HiddenGrottoSearcher::cancelSearch()
 {
     searching = false;
+    results.cancel();
+    job.cancel();
+}
+
+void HiddenGrottoSearcher::pauseSearch()
+{
+    job.pause();
+}
+
+void HiddenGrottoSearcher::resumeSearch()
+{
+    job.resume();
 }
 
 std::vector<SearcherState5<HiddenGrottoState>> HiddenGrottoSearcher::getResults()
 {
-    std::lock_guard<std::mutex> lock(mutex);
-    auto data = std::move(results);
-    return data;
+    return results.take();
 }
 
 int HiddenGrottoSearcher::getProgress() const
@@ -77,11 +121,21 @@ int HiddenGrottoSearcher::getProgress() const
     return progress;
 }
 
-void HiddenGrottoSearcher::search(HiddenGrottoGenerator generator, const Date &start, const Date &end)
+SearchStats HiddenGrottoSearcher::getStats() const
+{
+    return stats.getStats();
+}
+
+void HiddenGrottoSearcher::search(HiddenGrottoGenerator generator, const Date &start, const Date &end, const Date &first, u32 slot,
+                                  SearchCheckpoint &checkpoint)
 {
     SHA1 sha(profile);
     auto buttons = Keypresses::getKeyPresses(profile.getKeypresses(), profile.getSkipLR());
     auto values = Keypresses::getValues(buttons);
+    std::vector<u64> seeds(60);
+    bool useDatabase = database && database->matches(profile);
+    auto worker = stats.addWorker(slot);
+    u32 timer0Count = profile.getTimer0Max() - profile.getTimer0Min() + 1;
 
     for (u16 timer0 = profile.getTimer0Min(); timer0 <= profile.getTimer0Max(); timer0++)
     {
@@ -92,43 +146,74 @@ void HiddenGrottoSearcher::search(HiddenGrottoGenerator generator, const Date &s
             sha.precompute();
             for (size_t i = 0; i < values.size(); i++)
             {
+                auto chunk = static_cast<u32>((first.daysTo(date) * timer0Count + timer0 - profile.getTimer0Min()) * values.size() + i);
+                if (checkpoint.isCompleted(chunk))
+                {
+                    stats.addSkipped(86400);
+                    progress++;
+                    continue;
+                }
+
                 sha.setButton(values[i]);
+                const u64 *stored = useDatabase ? database->getSeeds(date, timer0, i) : nullptr;
+                std::vector<SearcherState5<HiddenGrottoState>> chunkStates;
 
                 for (u8 hour = 0; hour < 24; hour++)
                 {
                     for (u8 minute = 0; minute < 60; minute++)
                     {
+                        if (stored)
+                        {
+                            std::copy_n(stored + hour * 3600 + minute * 60, 60, seeds.begin());
+                            worker.addLoaded(60);
+                        }
+                        else
+                        {
+                            for (u8 second = 0; second < 60; second++)
+                            {
+                                sha.setTime(hour, minute, second, profile.getDSType());
+                                seeds[second] = sha.hashSeed();
+                            }
+                            worker.addHashed(60);
+                        }
+
+                        auto advances = Utilities::initialAdvancesBW2(seeds, profile.getMemoryLink());
+                        worker.addAdvanced(60);
+
                         for (u8 second = 0; second < 60; second++)
                         {
                             if (!searching)
                             {
+                                auto lock = worker.lock(mutex);
+                                results.append(chunkStates);
                                 return;
                             }
-                            sha.setTime(hour, minute, second, profile.getDSType());
-                            u64 seed = sha.hashSeed();
 
-                            generator.setInitialAdvances(Utilities::initialAdvancesBW2(seed, profile.getMemoryLink()));
+                            u64 seed = seeds[second];
+
+                            generator.setInitialAdvances(advances[second]);
 
                             auto states = generator.generate(seed);
+                            worker.addGenerated(1);
+                            worker.addPassed(states.size());
                             if (!states.empty())
                             {
-                                std::vector<SearcherState5<HiddenGrottoState>> displayStates;
-                                displayStates.reserve(states.size());
-
                                 DateTime dt(date, Time(hour, minute, second));
                                 for (const auto &state : states)
                                 {
-                                    displayStates.emplace_back(dt, seed, buttons[i], timer0, state);
+                                    chunkStates.emplace_back(dt, seed, buttons[i], timer0, state);
                                 }
-
-                                std::lock_guard<std::mutex> lock(mutex);
-                                results.insert(results.end(), displayStates.begin(), displayStates.end());
                             }
                         }
                     }
                 }
 
+                auto lock = worker.lock(mutex);
+                results.append(chunkStates);
+                checkpoint.complete(chunk, chunkStates);
                 progress++;
+                lock.unlock();
+                results.wait();
             }
         }
     }
@@ -23,56 +23,102 @@
 #include <Core/Gen5/Keypresses.hpp>
 #include <Core/RNG/SHA1.hpp>
 #include <Core/Util/Utilities.hpp>
-#include <future>
+#include <algorithm>
 
 IDSearcher5::IDSearcher5(const Profile5 &profile, u32 pid, bool checkPID, bool checkXOR) :
     profile(profile), pid(pid), checkPID(checkPID), checkXOR(checkXOR), searching(false), progress(0)
 {
 }
 
-void IDSearcher5::startSearch(const IDGenerator5 &generator, int threads, Date start, const Date &end)
+void IDSearcher5::setCheckpoint(const std::string &fileName)
 {
+    checkpointFile = fileName;
+}
+
+void IDSearcher5::setShard(const SearchShard &shard)
+{
+    this->shard = shard;
+}
+
+void IDSearcher5::setResultBudget(const ResultBudget &budget)
+{
+    results.setBudget(budget);
+}
+
+void IDSearcher5::setSeedDatabase(const SeedDatabase5 *database)
+{
+    this->database = database;
+}
+
+void IDSearcher5::setPriority(int priority)
+{
+    job.setPriority(priority);
+}
+
+void IDSearcher5::startSearch(const IDGenerator5 &generator, int threads, Date start, Date end)
+{
+    job.start();
     searching = true;
 
+    // Only search the dates that belong to this shard
+    auto range = shard.getRange(0, start.daysTo(end) + 1);
+    if (range.first == range.second)
+    {
+        return;
+    }
+    end = start.addDays(range.second - 1);
+    start = start.addDays(range.first);
+
     auto days = start.daysTo(end) + 1;
     if (days < threads)
     {
         threads = days;
     }
 
-    std::vector<std::future<void>> threadContainer;
+    // Each chunk is a single date and keypress
+    u32 buttonCount = static_cast<u32>(Keypresses::getKeyPresses(profile.getKeypresses(), profile.getSkipLR()).size());
+    std::vector<u64> parameters = SeedDatabase5::getParameters(profile);
+    parameters.insert(parameters.end(), { profile.getMemoryLink(), profile.getShinyCharm(), pid, checkPID, checkXOR, buttonCount,
+                                          static_cast<u64>(Date().daysTo(start)), static_cast<u64>(days) });
+    generator.addParameters(parameters);
+    SearchCheckpoint checkpoint(checkpointFile, parameters, days * buttonCount, sizeof(IDState5));
+    stats.start(static_cast<u64>(days) * buttonCount * 86400, threads);
+
+    // Every chunk of a date is merged by time and seed before it is handed out
+    ordered = OrderedResults<IDState5>(0, days * buttonCount, buttonCount, [](const IDState5 &left, const IDState5 &right) {
+        return left.getDateTime() < right.getDateTime() || (left.getDateTime() == right.getDateTime() && left.getSeed() < right.getSeed());
+    });
+
+    // Every date is a task of the shared scheduler, threads only limits how many of them run at the same time
+    stats.startJob();
+    job.run(static_cast<u32>(days), threads, [&](u32 day, u32 slot) { search(generator, start, static_cast<int>(day), slot, checkpoint); });
+    stats.finishJob();
 
-    auto daysSplit = days / threads;
-    for (int i = 0; i < threads; i++)
-    {
-        if (i == threads - 1)
-        {
-            threadContainer.emplace_back(std::async(std::launch::async, [=] { search(generator, start, end); }));
-        }
-        else
-        {
-            Date mid = start.addDays(daysSplit - 1);
-            threadContainer.emplace_back(std::async(std::launch::async, [=] { search(generator, start, mid); }));
-        }
-        start = start.addDays(daysSplit);
-    }
-
-    for (int i = 0; i < threads; i++)
-    {
-        threadContainer[i].wait();
-    }
+    std::lock_guard<std::mutex> lock(mutex);
+    ordered.finish();
+    results.append(ordered.take());
 }
 
 void IDSearcher5::cancelSearch()
 {
     searching = false;
+    job.cancel();
+    results.cancel();
+}
+
+void IDSearcher5::pauseSearch()
+{
+    job.pause();
+}
+
+void IDSearcher5::resumeSearch()
+{
+    job.resume();
 }
 
 std::vector<IDState5> IDSearcher5::getResults()
 {
-    std::lock_guard<std::mutex> lock(mutex);
-    auto data = std::move(results);
-    return data;
+    return results.take();
 }
 
 int IDSearcher5::getProgress() const
@@ -80,59 +126,107 @@ int IDSearcher5::getProgress() const
     return progress;
 }
 
-void IDSearcher5::search(IDGenerator5 generator, const Date &start, const Date &end)
+SearchStats IDSearcher5::getStats() const
+{
+    return stats.getStats();
+}
+
+void IDSearcher5::search(IDGenerator5 generator, const Date &first, int day, u32 slot, SearchCheckpoint &checkpoint)
 {
     bool flag = profile.getVersion() & Game::BW;
 
     SHA1 sha(profile);
     auto buttons = Keypresses::getKeyPresses(profile.getKeypresses(), profile.getSkipLR());
     auto values = Keypresses::getValues(buttons);
+    std::vector<u64> seeds(60);
+    bool useDatabase = database && database->matches(profile);
+    auto worker = stats.addWorker(slot);
 
     // IDs only uses minimum Timer0
     sha.setTimer0(profile.getTimer0Min(), profile.getVCount());
 
-    for (Date date = start; date <= end; date = date.addDays(1))
+    Date date = first.addDays(day);
+    sha.setDate(date);
+    sha.precompute();
+    for (size_t i = 0; i < values.size(); i++)
     {
-        sha.setDate(date);
-        sha.precompute();
-        for (size_t i = 0; i < values.size(); i++)
+        auto chunk = static_cast<u32>(day * values.size() + i);
+        if (checkpoint.isCompleted(chunk))
         {
-            sha.setButton(values[i]);
+            auto lock = worker.lock(mutex);
+            ordered.add(chunk, checkpoint.getResults<IDState5>(chunk));
+            results.append(ordered.take());
+            stats.addSkipped(86400);
+            progress++;
+            lock.unlock();
+            results.wait();
+            continue;
+        }
 
-            for (u8 hour = 0; hour < 24; hour++)
+        sha.setButton(values[i]);
+        const u64 *stored = useDatabase ? database->getSeeds(date, profile.getTimer0Min(), i) : nullptr;
+        std::vector<IDState5> chunkStates;
+
+        for (u8 hour = 0; hour < 24; hour++)
+        {
+            for (u8 minute = 0; minute < 60; minute++)
             {
-                for (u8 minute = 0; minute < 60; minute++)
+                if (stored)
+                {
+                    std::copy_n(stored + hour * 3600 + minute * 60, 60, seeds.begin());
+                    worker.addLoaded(60);
+                }
+                else
                 {
                     for (u8 second = 0; second < 60; second++)
                     {
-                        if (!searching)
-                        {
-                            return;
-                        }
-
                         sha.setTime(hour, minute, second, profile.getDSType());
-                        u64 seed = sha.hashSeed();
+                        seeds[second] = sha.hashSeed();
+                    }
+                    worker.addHashed(60);
+                }
 
-                        generator.setInitialAdvances(flag ? Utilities::initialAdvancesBWID(seed) : Utilities::initialAdvancesBW2ID(seed));
-                        auto states = generator.generate(seed, pid, checkPID, checkXOR);
+                auto advances = flag ? Utilities::initialAdvancesBWID(seeds) : Utilities::initialAdvancesBW2ID(seeds);
+                worker.addAdvanced(60);
+
+                for (u8 second = 0; second < 60; second++)
+                {
+                    if (!searching)
+                    {
+                        auto lock = worker.lock(mutex);
+                        ordered.add(chunk, std::move(chunkStates));
+                        results.append(ordered.take());
+                        return;
+                    }
 
-                        if (!states.empty())
+                    u64 seed = seeds[second];
+
+                    generator.setInitialAdvances(advances[second]);
+                    auto states = generator.generate(seed, pid, checkPID, checkXOR);
+                    worker.addGenerated(1);
+                    worker.addPassed(states.size());
+
+                    if (!states.empty())
+                    {
+                        DateTime dt(date, Time(hour, minute, second));
+                        for (auto &state : states)
                         {
-                            DateTime dt(date, Time(hour, minute, second));
-                            for (auto &state : states)
-                            {
-                                state.setDateTime(dt);
-                                state.setKeypress(buttons[i]);
-                            }
-
-                            std::lock_guard<std::mutex> lock(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
+                            state.setDateTime(dt);
+                            state.setKeypress(buttons[i]);
                         }
+
+                        chunkStates.insert(chunkStates.end(), states.begin(), states.end());
                     }
                 }
             }
-
-            progress++;
         }
+
+        auto lock = worker.lock(mutex);
+        checkpoint.complete(chunk, chunkStates);
+        ordered.add(chunk, std::move(chunkStates));
+        results.append(ordered.take());
+        progress++;
+        lock.unlock();
+        results.wait();
     }
 }
@@ -22,32 +22,54 @@
 
 #include <Core/Gen5/Generators/IDGenerator5.hpp>
 #include <Core/Gen5/Profile5.hpp>
+#include <Core/Gen5/SeedDatabase5.hpp>
 #include <Core/Util/Global.hpp>
+#include <Core/Util/JobScheduler.hpp>
+#include <Core/Util/OrderedResults.hpp>
+#include <Core/Util/ResultStore.hpp>
+#include <Core/Util/SearchCheckpoint.hpp>
+#include <Core/Util/SearchShard.hpp>
+#include <Core/Util/SearchStats.hpp>
 #include <atomic>
 #include <mutex>
+#include <string>
 
 class IDSearcher5
 {
 public:
     IDSearcher5() = default;
     explicit IDSearcher5(const Profile5 &profile, u32 pid, bool checkPID, bool checkXOR);
-    void startSearch(const IDGenerator5 &generator, int threads, Date start, const Date &end);
+    void setCheckpoint(const std::string &fileName);
+    void setShard(const SearchShard &shard);
+    void setResultBudget(const ResultBudget &budget);
+    void setSeedDatabase(const SeedDatabase5 *database);
+    void setPriority(int priority);
+    void startSearch(const IDGenerator5 &generator, int threads, Date start, Date end);
     void cancelSearch();
+    void pauseSearch();
+    void resumeSearch();
     std::vector<IDState5> getResults();
     int getProgress() const;
+    SearchStats getStats() const;
 
 private:
     Profile5 profile;
+    std::string checkpointFile;
+    SearchShard shard;
+    const SeedDatabase5 *database = nullptr;
     u32 pid;
     bool checkPID;
     bool checkXOR;
 
     bool searching;
     std::atomic<int> progress;
-    std::vector<IDState5> results;
+    OrderedResults<IDState5> ordered;
+    ResultStore<IDState5> results;
     std::mutex mutex;
+    SearchCounters stats;
+    JobControl job;
 
-    void search(IDGenerator5 generator, const Date &start, const Date &end);
+    void search(IDGenerator5 generator, const Date &first, int day, u32 slot, SearchCheckpoint &checkpoint);
 };
 
 #endif // IDSEARCHER5_HPP
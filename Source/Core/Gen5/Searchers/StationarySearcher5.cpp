@@ -23,17 +23,52 @@
 #include <Core/Gen5/Keypresses.hpp>
 #include <Core/RNG/SHA1.hpp>
 #include <Core/Util/Utilities.hpp>
-#include <future>
+#include <algorithm>
 
 StationarySearcher5::StationarySearcher5(const Profile5 &profile, Method method) :
     profile(profile), method(method), searching(false), progress(0)
 {
 }
 
-void StationarySearcher5::startSearch(const StationaryGenerator5 &generator, int threads, Date start, const Date &end)
+void StationarySearcher5::setCheckpoint(const std::string &fileName)
 {
+    checkpointFile = fileName;
+}
+
+void StationarySearcher5::setShard(const SearchShard &shard)
+{
+    this->shard = shard;
+}
+
+void StationarySearcher5::setResultBudget(const ResultBudget &budget)
+{
+    results.setBudget(budget);
+}
+
+void StationarySearcher5::setSeedDatabase(const SeedDatabase5 *database)
+{
+    this->database = database;
+}
+
+void StationarySearcher5::setPriority(int priority)
+{
+    job.setPriority(priority);
+}
+
+void StationarySearcher5::startSearch(const StationaryGenerator5 &generator, int threads, Date start, Date end)
+{
+    job.start();
     searching = true;
 
+    // Only search the dates that belong to this shard
+    auto range = shard.getRange(0, start.daysTo(end) + 1);
+    if (range.first == range.second)
+    {
+        return;
+    }
+    end = start.addDays(range.second - 1);
+    start = start.addDays(range.first);
+
     auto days = start.daysTo(end) + 1;
     if (days < threads)
     {
@@ -45,39 +80,54 @@ void StationarySearcher5::startSearch(const StationaryGenerator5 &generator, int
         threads = 1;
     }
 
-    std::vector<std::future<void>> threadContainer;
+    // Each chunk is a single date, timer0 and keypress
+    u32 timer0Count = profile.getTimer0Max() - profile.getTimer0Min() + 1;
+    u32 buttonCount = static_cast<u32>(Keypresses::getKeyPresses(profile.getKeypresses(), profile.getSkipLR()).size());
+    std::vector<u64> parameters = SeedDatabase5::getParameters(profile);
+    parameters.insert(parameters.end(), { profile.getMemoryLink(), profile.getShinyCharm(), static_cast<u64>(method), buttonCount,
+                                          static_cast<u64>(Date().daysTo(start)), static_cast<u64>(days) });
+    generator.addParameters(parameters);
+    SearchCheckpoint checkpoint(checkpointFile, parameters, days * timer0Count * buttonCount, sizeof(SearcherState5<StationaryState>));
+    stats.start(static_cast<u64>(days) * timer0Count * buttonCount * 86400, threads);
+
+    // Every chunk of a date is merged by time and seed before it is handed out
+    ordered = OrderedResults<SearcherState5<StationaryState>>(
+        0, days * timer0Count * buttonCount, timer0Count * buttonCount,
+        [](const SearcherState5<StationaryState> &left, const SearcherState5<StationaryState> &right) {
+            return left.getDateTime() < right.getDateTime()
+                || (left.getDateTime() == right.getDateTime() && left.getInitialSeed() < right.getInitialSeed());
+        });
+
+    // Every date is a task of the shared scheduler, threads only limits how many of them run at the same time
+    stats.startJob();
+    job.run(static_cast<u32>(days), threads, [&](u32 day, u32 slot) { search(generator, start, static_cast<int>(day), slot, checkpoint); });
+    stats.finishJob();
 
-    auto daysSplit = days / threads;
-    for (int i = 0; i < threads; i++)
-    {
-        if (i == threads - 1)
-        {
-            threadContainer.emplace_back(std::async([=] { search(generator, start, end); }));
-        }
-        else
-        {
-            Date mid = start.addDays(daysSplit - 1);
-            threadContainer.emplace_back(std::async([=] { search(generator, start, mid); }));
-        }
-        start = start.addDays(daysSplit);
-    }
-
-    for (int i = 0; i < threads; i++)
-    {
-        threadContainer[i].wait();
-    }
+    std::lock_guard<std::mutex> lock(mutex);
+    ordered.finish();
+    results.append(ordered.take());
 }
 
 void StationarySearcher5::cancelSearch()
 {
     searching = false;
+    job.cancel();
+    results.cancel();
+}
+
+void StationarySearcher5::pauseSearch()
+{
+    job.pause();
+}
+
+void StationarySearcher5::resumeSearch()
+{
+    job.resume();
 }
 
 std::vector<SearcherState5<StationaryState>> StationarySearcher5::getResults()
 {
-    std::lock_guard<std::mutex> lock(mutex);
-    auto data = std::move(results);
-    return data;
+    return results.take();
 }
 
 int StationarySearcher5::getProgress() const
@@ -85,73 +135,121 @@ int StationarySearcher5::getProgress() const
     return progress;
 }
 
-void StationarySearcher5::search(StationaryGenerator5 generator, const Date &start, const Date &end)
+SearchStats StationarySearcher5::getStats() const
+{
+    return stats.getStats();
+}
+
+void StationarySearcher5::search(StationaryGenerator5 generator, const Date &first, int day, u32 slot, SearchCheckpoint &checkpoint)
 {
     bool flag = profile.getVersion() & Game::BW;
 
     SHA1 sha(profile);
     auto buttons = Keypresses::getKeyPresses(profile.getKeypresses(), profile.getSkipLR());
     auto values = Keypresses::getValues(buttons);
+    std::vector<u64> seeds(60);
+    bool useDatabase = database && database->matches(profile);
+    auto worker = stats.addWorker(slot);
+    u32 timer0Count = profile.getTimer0Max() - profile.getTimer0Min() + 1;
+
+    Date date = first.addDays(day);
 
     for (u16 timer0 = profile.getTimer0Min(); timer0 <= profile.getTimer0Max(); timer0++)
     {
         sha.setTimer0(timer0, profile.getVCount());
+        sha.setDate(date);
+        sha.precompute();
 
-        for (Date date = start; date <= end; date = date.addDays(1))
+        for (size_t i = 0; i < values.size(); i++)
         {
-            sha.setDate(date);
-            sha.precompute();
-
-            for (size_t i = 0; i < values.size(); i++)
+            auto chunk = static_cast<u32>((day * timer0Count + timer0 - profile.getTimer0Min()) * values.size() + i);
+            if (checkpoint.isCompleted(chunk))
             {
-                sha.setButton(values[i]);
+                auto lock = worker.lock(mutex);
+                ordered.add(chunk, checkpoint.getResults<SearcherState5<StationaryState>>(chunk));
+                results.append(ordered.take());
+                stats.addSkipped(86400);
+                progress++;
+                lock.unlock();
+                results.wait();
+                continue;
+            }
+
+            sha.setButton(values[i]);
+            const u64 *stored = useDatabase ? database->getSeeds(date, timer0, i) : nullptr;
+            std::vector<SearcherState5<StationaryState>> chunkStates;
 
-                for (u8 hour = 0; hour < 24; hour++)
+            for (u8 hour = 0; hour < 24; hour++)
+            {
+                for (u8 minute = 0; minute < 60; minute++)
                 {
-                    for (u8 minute = 0; minute < 60; minute++)
+                    if (stored)
+                    {
+                        std::copy_n(stored + hour * 3600 + minute * 60, 60, seeds.begin());
+                        worker.addLoaded(60);
+                    }
+                    else
                     {
                         for (u8 second = 0; second < 60; second++)
                         {
-                            if (!searching)
-                            {
-                                return;
-                            }
-
                             sha.setTime(hour, minute, second, profile.getDSType());
-                            u64 seed = sha.hashSeed();
+                            seeds[second] = sha.hashSeed();
+                        }
+                        worker.addHashed(60);
+                    }
 
-                            if (method == Method::Method5)
-                            {
-                                generator.setInitialAdvances(flag ? Utilities::initialAdvancesBW(seed)
-                                                                  : Utilities::initialAdvancesBW2(seed, profile.getMemoryLink()));
-                            }
-                            else
-                            {
-                                generator.setOffset(flag ? 0 : 2);
-                            }
+                    std::vector<u32> advances;
+                    if (method == Method::Method5)
+                    {
+                        advances = flag ? Utilities::initialAdvancesBW(seeds)
+                                        : Utilities::initialAdvancesBW2(seeds, profile.getMemoryLink());
+                        worker.addAdvanced(60);
+                    }
 
-                            auto states = generator.generate(seed);
+                    for (u8 second = 0; second < 60; second++)
+                    {
+                        if (!searching)
+                        {
+                            auto lock = worker.lock(mutex);
+                            ordered.add(chunk, std::move(chunkStates));
+                            results.append(ordered.take());
+                            return;
+                        }
 
-                            if (!states.empty())
-                            {
-                                std::vector<SearcherState5<StationaryState>> displayStates;
-                                displayStates.reserve(states.size());
+                        u64 seed = seeds[second];
 
-                                DateTime dt(date, Time(hour, minute, second));
-                                for (const auto &state : states)
-                                {
-                                    displayStates.emplace_back(dt, seed, buttons[i], timer0, state);
-                                }
+                        if (method == Method::Method5)
+                        {
+                            generator.setInitialAdvances(advances[second]);
+                        }
+                        else
+                        {
+                            generator.setOffset(flag ? 0 : 2);
+                        }
 
-                                std::lock_guard<std::mutex> lock(mutex);
-                                results.insert(results.end(), displayStates.begin(), displayStates.end());
+                        auto states = generator.generate(seed);
+                        worker.addGenerated(1);
+                        worker.addPassed(states.size());
+
+                        if (!states.empty())
+                        {
+                            DateTime dt(date, Time(hour, minute, second));
+                            for (const auto &state : states)
+                            {
+                                chunkStates.emplace_back(dt, seed, buttons[i], timer0, state);
                             }
                         }
                     }
                 }
-
-                progress++;
             }
+
+            auto lock = worker.lock(mutex);
+            checkpoint.complete(chunk, chunkStates);
+            ordered.add(chunk, std::move(chunkStates));
+            results.append(ordered.take());
+            progress++;
+            lock.unlock();
+            results.wait();
         }
     }
 }
@@ -22,10 +22,18 @@
 
 #include <Core/Gen5/Generators/StationaryGenerator5.hpp>
 #include <Core/Gen5/Profile5.hpp>
+#include <Core/Gen5/SeedDatabase5.hpp>
 #include <Core/Gen5/States/SearcherState5.hpp>
 #include <Core/Gen5/States/StationaryState5.hpp>
+#include <Core/Util/JobScheduler.hpp>
+#include <Core/Util/OrderedResults.hpp>
+#include <Core/Util/ResultStore.hpp>
+#include <Core/Util/SearchCheckpoint.hpp>
+#include <Core/Util/SearchShard.hpp>
+#include <Core/Util/SearchStats.hpp>
 #include <atomic>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 
 class StationarySearcher5
@@ -33,21 +41,35 @@ class StationarySearcher5
 public:
     StationarySearcher5() = default;
     explicit StationarySearcher5(const Profile5 &profile, Method method);
-    void startSearch(const StationaryGenerator5 &generator, int threads, Date start, const Date &end);
+    void setCheckpoint(const std::string &fileName);
+    void setShard(const SearchShard &shard);
+    void setResultBudget(const ResultBudget &budget);
+    void setSeedDatabase(const SeedDatabase5 *database);
+    void setPriority(int priority);
+    void startSearch(const StationaryGenerator5 &generator, int threads, Date start, Date end);
     void cancelSearch();
+    void pauseSearch();
+    void resumeSearch();
     std::vector<SearcherState5<StationaryState>> getResults();
     int getProgress() const;
+    SearchStats getStats() const;
 
 private:
     Profile5 profile;
+    std::string checkpointFile;
+    SearchShard shard;
+    const SeedDatabase5 *database = nullptr;
 
     Method method;
     bool searching;
     std::atomic<int> progress;
-    std::vector<SearcherState5<StationaryState>> results;
+    OrderedResults<SearcherState5<StationaryState>> ordered;
+    ResultStore<SearcherState5<StationaryState>> results;
     std::mutex mutex;
+    SearchCounters stats;
+    JobControl job;
 
-    void search(StationaryGenerator5 generator, const Date &start, const Date &end);
+    void search(StationaryGenerator5 generator, const Date &first, int day, u32 slot, SearchCheckpoint &checkpoint);
 };
 
 #endif // STATIONARYSEARCHER5_HPP
@@ -0,0 +1,316 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SeedDatabase5.hpp"
+#include <Core/Enum/Buttons.hpp>
+#include <Core/Gen5/Keypresses.hpp>
+#include <Core/Gen5/Profile5.hpp>
+#include <Core/RNG/SHA1.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <numeric>
+
+constexpr u32 databaseMagic = 0x44534650; // PFSD
+constexpr u32 databaseVersion = 1;
+constexpr u64 maxSegmentSeeds = 1 << 24;
+constexpr u32 secondsPerDay = 86400;
+
+namespace
+{
+    struct SegmentHeader
+    {
+        u32 day;
+        u32 days;
+        u64 count;
+    };
+
+    u64 align(u64 size)
+    {
+        return (size + 7) & ~7ULL;
+    }
+}
+
+SeedDatabase5::SeedDatabase5(const std::string &fileName) : fileName(fileName), header(), size(0)
+{
+    load();
+}
+
+bool SeedDatabase5::isOpen() const
+{
+    return !segments.empty();
+}
+
+bool SeedDatabase5::matches(const Profile5 &profile) const
+{
+    Header expected = getHeader(profile);
+    return size != 0 && std::memcmp(&header, &expected, sizeof(Header)) == 0;
+}
+
+bool SeedDatabase5::extend(const Profile5 &profile, const Date &start, const Date &end)
+{
+    // Never overwrite a file that is not a database, or extend one made for another profile
+    if ((size == 0 && file.isOpen()) || (size != 0 && !matches(profile)))
+    {
+        return false;
+    }
+
+    // Find the runs of dates that are not stored yet
+    std::vector<std::pair<u32, u32>> runs;
+    u32 first = static_cast<u32>(Date().daysTo(start));
+    u32 last = static_cast<u32>(Date().daysTo(end));
+    for (u32 day = first; day <= last; day++)
+    {
+        bool stored = std::any_of(segments.begin(), segments.end(),
+                                  [day](const Segment &segment) { return day >= segment.day && day < segment.day + segment.days; });
+        if (stored)
+        {
+            continue;
+        }
+
+        if (!runs.empty() && runs.back().first + runs.back().second == day)
+        {
+            runs.back().second++;
+        }
+        else
+        {
+            runs.emplace_back(day, 1);
+        }
+    }
+
+    if (runs.empty())
+    {
+        return true;
+    }
+
+    Header fileHeader = getHeader(profile);
+    auto keypresses = Keypresses::getKeyPresses(profile.getKeypresses(), profile.getSkipLR());
+    auto values = Keypresses::getValues(keypresses);
+    u64 timer0Count = fileHeader.timer0Max - fileHeader.timer0Min + 1;
+    u64 daySeeds = timer0Count * keypresses.size() * secondsPerDay;
+    u32 segmentDays = static_cast<u32>(std::max<u64>(1, maxSegmentSeeds / daySeeds));
+
+    // Drop anything after the last complete segment before appending
+    bool exists = size != 0;
+    file = MappedFile();
+    if (exists)
+    {
+        std::error_code error;
+        std::filesystem::resize_file(fileName, size, error);
+        if (error)
+        {
+            load();
+            return false;
+        }
+    }
+
+    FILE *out = std::fopen(fileName.c_str(), exists ? "ab" : "wb");
+    if (!out)
+    {
+        load();
+        return false;
+    }
+
+    bool written = exists || std::fwrite(&fileHeader, sizeof(Header), 1, out) == 1;
+
+    SHA1 sha(profile);
+    for (const auto &run : runs)
+    {
+        for (u32 offset = 0; written && offset < run.second; offset += segmentDays)
+        {
+            SegmentHeader segment = { run.first + offset, std::min(segmentDays, run.second - offset), 0 };
+            segment.count = segment.days * daySeeds;
+
+            std::vector<u64> seeds(segment.count);
+            u64 *seed = seeds.data();
+            for (u32 day = 0; day < segment.days; day++)
+            {
+                Date date = Date().addDays(segment.day + day);
+                for (u16 timer0 = fileHeader.timer0Min; timer0 <= fileHeader.timer0Max; timer0++)
+                {
+                    sha.setTimer0(timer0, fileHeader.vcount);
+                    sha.setDate(date);
+                    sha.precompute();
+                    for (u32 value : values)
+                    {
+                        sha.setButton(value);
+                        for (u8 hour = 0; hour < 24; hour++)
+                        {
+                            for (u8 minute = 0; minute < 60; minute++)
+                            {
+                                for (u8 second = 0; second < 60; second++)
+                                {
+                                    sha.setTime(hour, minute, second, profile.getDSType());
+                                    *seed++ = sha.hashSeed();
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            std::vector<u32> index(segment.count);
+            std::iota(index.begin(), index.end(), 0);
+            std::sort(index.begin(), index.end(), [&seeds](u32 left, u32 right) {
+                return seeds[left] < seeds[right] || (seeds[left] == seeds[right] && left < right);
+            });
+
+            u32 padding = 0;
+            written = std::fwrite(&segment, sizeof(SegmentHeader), 1, out) == 1
+                && std::fwrite(seeds.data(), sizeof(u64), seeds.size(), out) == seeds.size()
+                && std::fwrite(index.data(), sizeof(u32), index.size(), out) == index.size()
+                && (segment.count % 2 == 0 || std::fwrite(&padding, sizeof(u32), 1, out) == 1);
+        }
+    }
+
+    written = std::fclose(out) == 0 && written;
+    load();
+    return written;
+}
+
+std::vector<SeedDatabase5::Entry> SeedDatabase5::find(u64 seed) const
+{
+    std::vector<Entry> entries;
+
+    u32 timer0Count = header.timer0Max - header.timer0Min + 1;
+    for (const auto &segment : segments)
+    {
+        auto it = std::lower_bound(segment.index, segment.index + segment.count, seed,
+                                   [&segment](u32 index, u64 value) { return segment.seeds[index] < value; });
+        for (; it != segment.index + segment.count && segment.seeds[*it] == seed; ++it)
+        {
+            u64 index = *it;
+            u32 second = index % secondsPerDay;
+            index /= secondsPerDay;
+            size_t button = index % buttons.size();
+            index /= buttons.size();
+            auto timer0 = static_cast<u16>(header.timer0Min + index % timer0Count);
+            u32 day = segment.day + static_cast<u32>(index / timer0Count);
+
+            entries.emplace_back(Entry { DateTime(Date().addDays(day), Time(second)), timer0, buttons[button] });
+        }
+    }
+
+    return entries;
+}
+
+const u64 *SeedDatabase5::getSeeds(const Date &date, u16 timer0, size_t button) const
+{
+    if (timer0 < header.timer0Min || timer0 > header.timer0Max || button >= buttons.size())
+    {
+        return nullptr;
+    }
+
+    auto day = static_cast<u32>(Date().daysTo(date));
+    for (const auto &segment : segments)
+    {
+        if (day >= segment.day && day < segment.day + segment.days)
+        {
+            u64 timer0Count = header.timer0Max - header.timer0Min + 1;
+            u64 offset = ((day - segment.day) * timer0Count + timer0 - header.timer0Min) * buttons.size() + button;
+            return segment.seeds + offset * secondsPerDay;
+        }
+    }
+
+    return nullptr;
+}
+
+SeedDatabase5::Header SeedDatabase5::getHeader(const Profile5 &profile)
+{
+    Header header {};
+    header.magic = databaseMagic;
+    header.version = databaseVersion;
+    header.mac = profile.getMac();
+    header.game = profile.getVersion();
+    header.timer0Min = profile.getTimer0Min();
+    header.timer0Max = profile.getTimer0Max();
+    header.language = profile.getLanguage();
+    header.dsType = profile.getDSType();
+    header.vcount = profile.getVCount();
+    header.gxstat = profile.getGxStat();
+    header.vframe = profile.getVFrame();
+    header.softReset = profile.getSoftReset();
+    header.skipLR = profile.getSkipLR();
+
+    auto keypresses = profile.getKeypresses();
+    for (size_t i = 0; i < keypresses.size(); i++)
+    {
+        header.keypresses |= keypresses[i] << i;
+    }
+
+    return header;
+}
+
+std::vector<u64> SeedDatabase5::getParameters(const Profile5 &profile)
+{
+    Header header = getHeader(profile);
+    return { header.mac,    header.game,   header.timer0Min, header.timer0Max, header.language,   header.dsType,
+             header.vcount, header.gxstat, header.vframe,    header.softReset, header.keypresses, header.skipLR };
+}
+
+void SeedDatabase5::load()
+{
+    file = MappedFile(fileName);
+    segments.clear();
+    buttons.clear();
+    size = 0;
+
+    const u8 *data = file.getData();
+    if (file.getSize() < sizeof(Header))
+    {
+        return;
+    }
+
+    std::memcpy(&header, data, sizeof(Header));
+    if (header.magic != databaseMagic || header.version != databaseVersion)
+    {
+        return;
+    }
+
+    std::vector<bool> keypresses(4);
+    for (size_t i = 0; i < keypresses.size(); i++)
+    {
+        keypresses[i] = (header.keypresses >> i) & 1;
+    }
+    buttons = Keypresses::getKeyPresses(keypresses, header.skipLR);
+
+    u64 daySeeds = static_cast<u64>(header.timer0Max - header.timer0Min + 1) * buttons.size() * secondsPerDay;
+
+    // A segment cut short by an interrupted extend is ignored and overwritten by the next one
+    u64 offset = sizeof(Header);
+    while (offset + sizeof(SegmentHeader) <= file.getSize())
+    {
+        SegmentHeader segment;
+        std::memcpy(&segment, data + offset, sizeof(SegmentHeader));
+
+        u64 length = sizeof(SegmentHeader) + segment.count * sizeof(u64) + align(segment.count * sizeof(u32));
+        if (segment.count != segment.days * daySeeds || offset + length > file.getSize())
+        {
+            break;
+        }
+
+        auto seeds = reinterpret_cast<const u64 *>(data + offset + sizeof(SegmentHeader));
+        auto index = reinterpret_cast<const u32 *>(seeds + segment.count);
+        segments.emplace_back(Segment { segment.day, segment.days, segment.count, seeds, index });
+        offset += length;
+    }
+
+    size = offset;
+}
@@ -0,0 +1,100 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEEDDATABASE5_HPP
+#define SEEDDATABASE5_HPP
+
+#include <Core/Util/DateTime.hpp>
+#include <Core/Util/Global.hpp>
+#include <Core/Util/MappedFile.hpp>
+#include <string>
+#include <vector>
+
+enum Buttons : u16;
+class Profile5;
+
+// Initial seeds of a Gen 5 profile for a range of dates, memory mapped. Every segment holds the seeds of its dates,
+// timer0s, keypresses and seconds in that order and an index of them sorted by value for find().
+class SeedDatabase5
+{
+public:
+    struct Entry
+    {
+        DateTime dateTime;
+        u16 timer0;
+        Buttons buttons;
+    };
+
+    explicit SeedDatabase5(const std::string &fileName);
+
+    bool isOpen() const;
+
+    bool matches(const Profile5 &profile) const;
+
+    bool extend(const Profile5 &profile, const Date &start, const Date &end);
+
+    std::vector<Entry> find(u64 seed) const;
+
+    // 86400 seeds starting at midnight, or nullptr if they are not stored. button indexes Keypresses::getKeyPresses.
+    const u64 *getSeeds(const Date &date, u16 timer0, size_t button) const;
+
+    // The profile parameters the initial seed depends on
+    static std::vector<u64> getParameters(const Profile5 &profile);
+
+private:
+    struct Header
+    {
+        u32 magic;
+        u32 version;
+        u64 mac;
+        u16 game;
+        u16 timer0Min;
+        u16 timer0Max;
+        u8 language;
+        u8 dsType;
+        u8 vcount;
+        u8 gxstat;
+        u8 vframe;
+        u8 softReset;
+        u8 keypresses;
+        u8 skipLR;
+        u8 padding[2];
+    };
+
+    struct Segment
+    {
+        u32 day;
+        u32 days;
+        u64 count;
+        const u64 *seeds;
+        const u32 *index;
+    };
+
+    std::string fileName;
+    MappedFile file;
+    Header header;
+    std::vector<Segment> segments;
+    std::vector<Buttons> buttons;
+    size_t size;
+
+    static Header getHeader(const Profile5 &profile);
+    void load();
+};
+
+#endif // SEEDDATABASE5_HPP
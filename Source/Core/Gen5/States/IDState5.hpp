@@ -35,12 +35,12 @@ public:
 
     void setDateTime(const DateTime &dt)
     {
-        this->dt = dt;
+        this->dt = dt.toSeconds();
     }
 
     DateTime getDateTime() const
     {
-        return dt;
+        return DateTime::fromSeconds(dt);
     }
 
     void setInitialAdvances(u32 initialAdvances)
@@ -74,9 +74,9 @@ public:
     }
 
 private:
-    DateTime dt;
-    u32 initialAdvances;
     u16 keypress;
+    u32 dt; // See DateTime::toSeconds
+    u32 initialAdvances;
     u64 seed;
 };
 
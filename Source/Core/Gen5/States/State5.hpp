@@ -29,13 +29,13 @@ public:
     State5() = default;
 
     State5(const DateTime &dt, u64 initialSeed, u16 buttons, u16 timer0) :
-        dt(dt), initialSeed(initialSeed), buttons(buttons), timer0(timer0)
+        initialSeed(initialSeed), dt(dt.toSeconds()), buttons(buttons), timer0(timer0)
     {
     }
 
     DateTime getDateTime() const
     {
-        return dt;
+        return DateTime::fromSeconds(dt);
     }
 
     u64 getInitialSeed() const
@@ -54,8 +54,8 @@ public:
     }
 
 protected:
-    DateTime dt;
     u64 initialSeed;
+    u32 dt; // See DateTime::toSeconds
     u16 buttons;
     u16 timer0;
 };
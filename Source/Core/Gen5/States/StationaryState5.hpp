@@ -20,10 +20,10 @@
 #ifndef STATIONARYSTATE5_HPP
 #define STATIONARYSTATE5_HPP
 
-#include <Core/Gen5/States/State5.hpp>
 #include <Core/Parents/States/StationaryState.hpp>
 
-class StationaryState5 : public State5, public StationaryState
+// Searcher results wrap this in SearcherState5, which already holds the initial seed, date/time, timer0 and buttons
+class StationaryState5 : public StationaryState
 {
 public:
     StationaryState5() = default;
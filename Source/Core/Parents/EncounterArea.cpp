@@ -37,7 +37,7 @@ u8 EncounterArea::getLocation() const
     return location;
 }
 
-std::vector<Slot> EncounterArea::getPokemon() const
+const std::vector<Slot> &EncounterArea::getPokemon() const
 {
     return pokemon;
 }
@@ -80,7 +80,7 @@ std::pair<u8, u8> EncounterArea::getLevelRange(u16 specie) const
     return range;
 }
 
-std::vector<std::string> EncounterArea::getSpecieNames() const
+std::vector<std::string_view> EncounterArea::getSpecieNames() const
 {
     return Translator::getSpecies(getUniqueSpecies());
 }
@@ -22,7 +22,7 @@
 
 #include <Core/Parents/Slot.hpp>
 #include <Core/Util/Global.hpp>
-#include <string>
+#include <string_view>
 #include <vector>
 
 enum Encounter : u8;
@@ -34,11 +34,11 @@ public:
     EncounterArea(u8 location, Encounter encounter, const std::vector<Slot> &pokemon);
     Encounter getEncounter() const;
     u8 getLocation() const;
-    std::vector<Slot> getPokemon() const;
+    const std::vector<Slot> &getPokemon() const;
     std::vector<u16> getUniqueSpecies() const;
     std::vector<bool> getSlots(u16 num) const;
     std::pair<u8, u8> getLevelRange(u16 specie) const;
-    std::vector<std::string> getSpecieNames() const;
+    std::vector<std::string_view> getSpecieNames() const;
 
 protected:
     std::vector<Slot> pokemon;
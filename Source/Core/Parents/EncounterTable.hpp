@@ -0,0 +1,84 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef ENCOUNTERTABLE_HPP
+#define ENCOUNTERTABLE_HPP
+
+#include <Core/Util/Global.hpp>
+#include <cstddef>
+
+// Read-only view of a single location inside an embedded encounter table
+class EncounterEntry
+{
+public:
+    constexpr EncounterEntry(const u8 *data, u16 length) : data(data), length(length)
+    {
+    }
+
+    constexpr u8 getByte(u16 offset) const
+    {
+        return data[offset];
+    }
+
+    constexpr u16 getBigEndian(u16 offset) const
+    {
+        return static_cast<u16>(data[offset] << 8) | data[offset + 1];
+    }
+
+    constexpr u16 getLittleEndian(u16 offset) const
+    {
+        return static_cast<u16>(data[offset + 1] << 8) | data[offset];
+    }
+
+    constexpr u16 size() const
+    {
+        return length;
+    }
+
+private:
+    const u8 *data;
+    u16 length;
+};
+
+// Read-only view over an embedded encounter table made up of fixed length location entries
+class EncounterTable
+{
+public:
+    template <class Table>
+    EncounterTable(const Table &table, u16 length) : data(table.data()), count(table.size() / length), length(length)
+    {
+    }
+
+    constexpr EncounterEntry operator[](size_t index) const
+    {
+        return EncounterEntry(data + index * length, length);
+    }
+
+    constexpr size_t size() const
+    {
+        return count;
+    }
+
+private:
+    const u8 *data;
+    size_t count;
+    u16 length;
+};
+
+#endif // ENCOUNTERTABLE_HPP
@@ -45,3 +45,12 @@ bool IDFilter::compare(const IDState &state) const
 
     return true;
 }
+
+void IDFilter::addParameters(std::vector<u64> &parameters) const
+{
+    for (const auto &ids : { tidFilter, sidFilter, tsvFilter })
+    {
+        parameters.emplace_back(ids.size());
+        parameters.insert(parameters.end(), ids.begin(), ids.end());
+    }
+}
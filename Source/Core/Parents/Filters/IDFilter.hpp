@@ -31,6 +31,7 @@ public:
     IDFilter() = default;
     IDFilter(const std::vector<u16> &tidFilter, const std::vector<u16> &sidFilter, const std::vector<u16> &tsvFilter);
     bool compare(const IDState &state) const;
+    void addParameters(std::vector<u64> &parameters) const;
 
 private:
     std::vector<u16> tidFilter;
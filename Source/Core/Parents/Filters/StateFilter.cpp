@@ -85,7 +85,12 @@ bool StateFilter::compareIV(const State &state) const
 
 bool StateFilter::compareHiddenPower(const State &state) const
 {
-    return skip || powers[state.getHidden()];
+    return compareHiddenPower(state.getHidden());
+}
+
+bool StateFilter::compareHiddenPower(u8 hidden) const
+{
+    return skip || powers[hidden];
 }
 
 bool StateFilter::compareEncounterSlot(const WildState &state) const
@@ -97,3 +102,15 @@ bool StateFilter::compareLetter(const UnownState &state) const
 {
     return skip || encounters[state.getLetterIndex()];
 }
+
+void StateFilter::addParameters(std::vector<u64> &parameters) const
+{
+    parameters.insert(parameters.end(), min.begin(), min.end());
+    parameters.insert(parameters.end(), max.begin(), max.end());
+    parameters.insert(parameters.end(), { gender, ability, shiny, skip });
+    for (const auto &flags : { natures, powers, encounters })
+    {
+        parameters.emplace_back(flags.size());
+        parameters.insert(parameters.end(), flags.begin(), flags.end());
+    }
+}
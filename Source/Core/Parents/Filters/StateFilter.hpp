@@ -43,8 +43,10 @@ public:
     bool compareShiny(const State &state) const;
     bool compareIV(const State &state) const;
     bool compareHiddenPower(const State &state) const;
+    bool compareHiddenPower(u8 hidden) const;
     bool compareEncounterSlot(const WildState &state) const;
     bool compareLetter(const UnownState &state) const;
+    void addParameters(std::vector<u64> &parameters) const;
 
 private:
     std::array<u8, 6> min;
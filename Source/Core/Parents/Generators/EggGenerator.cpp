@@ -25,3 +25,19 @@ EggGenerator::EggGenerator(u32 initialAdvances, u32 maxAdvances, u16 tid, u16 si
     daycare(daycare)
 {
 }
+
+void EggGenerator::addParameters(std::vector<u64> &parameters) const
+{
+    Generator::addParameters(parameters);
+    for (u8 parent = 0; parent < 2; parent++)
+    {
+        for (u8 i = 0; i < 6; i++)
+        {
+            parameters.emplace_back(daycare.getParentIV(parent, i));
+        }
+        parameters.insert(parameters.end(),
+                          { daycare.getParentAbility(parent), daycare.getParentGender(parent), daycare.getParentItem(parent),
+                            daycare.getParentNature(parent) });
+    }
+    parameters.insert(parameters.end(), { daycare.getMasuda(), daycare.getNidoranVolbeat() });
+}
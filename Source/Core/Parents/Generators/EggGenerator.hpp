@@ -29,6 +29,7 @@ public:
     EggGenerator() = default;
     EggGenerator(u32 initialAdvances, u32 maxAdvances, u16 tid, u16 sid, u8 genderRatio, Method method, const StateFilter &filter,
                  const Daycare &daycare);
+    void addParameters(std::vector<u64> &parameters) const;
 
 protected:
     Daycare daycare;
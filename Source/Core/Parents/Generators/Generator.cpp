@@ -22,6 +22,7 @@
 Generator::Generator(u32 initialAdvances, u32 maxAdvances, u16 tid, u16 sid, u8 genderRatio, Method method, const StateFilter &filter) :
     initialAdvances(initialAdvances),
     maxAdvances(maxAdvances),
+    offset(0),
     tid(tid),
     sid(sid),
     tsv(tid ^ sid),
@@ -45,3 +46,9 @@ void Generator::setInitialAdvances(u32 initialAdvances)
 {
     this->initialAdvances = initialAdvances;
 }
+
+void Generator::addParameters(std::vector<u64> &parameters) const
+{
+    parameters.insert(parameters.end(), { initialAdvances, maxAdvances, offset, tid, sid, genderRatio, static_cast<u64>(method) });
+    filter.addParameters(parameters);
+}
@@ -36,6 +36,7 @@ public:
     StateFilter getFilter() const;
     void setOffset(u32 offset);
     void setInitialAdvances(u32 initialAdvances);
+    void addParameters(std::vector<u64> &parameters) const;
 
 protected:
     u32 initialAdvances;
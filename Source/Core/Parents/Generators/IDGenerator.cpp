@@ -23,3 +23,9 @@ IDGenerator::IDGenerator(u32 initialAdvances, u32 maxAdvances, const IDFilter &f
     initialAdvances(initialAdvances), maxAdvances(maxAdvances), filter(filter)
 {
 }
+
+void IDGenerator::addParameters(std::vector<u64> &parameters) const
+{
+    parameters.insert(parameters.end(), { initialAdvances, maxAdvances });
+    filter.addParameters(parameters);
+}
@@ -29,6 +29,7 @@ class IDGenerator
 public:
     IDGenerator() = default;
     IDGenerator(u32 initialAdvances, u32 maxAdvances, const IDFilter &filter);
+    void addParameters(std::vector<u64> &parameters) const;
 
 protected:
     u32 initialAdvances;
@@ -35,3 +35,13 @@ void StationaryGenerator::setSynchNature(u8 synchNature)
 {
     this->synchNature = synchNature;
 }
+
+void StationaryGenerator::addParameters(std::vector<u64> &parameters) const
+{
+    Generator::addParameters(parameters);
+    parameters.emplace_back(static_cast<u64>(lead));
+    if (lead == Lead::Synchronize)
+    {
+        parameters.emplace_back(synchNature);
+    }
+}
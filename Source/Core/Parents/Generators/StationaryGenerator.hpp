@@ -29,6 +29,7 @@ public:
     StationaryGenerator(u32 initialAdvances, u32 maxAdvances, u16 tid, u16 sid, u8 genderRatio, Method method, const StateFilter &filter);
     void setLead(Lead lead);
     void setSynchNature(u8 synchNature);
+    void addParameters(std::vector<u64> &parameters) const;
 
 protected:
     Lead lead;
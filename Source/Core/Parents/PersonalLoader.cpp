@@ -18,13 +18,41 @@
  */
 
 #include "PersonalLoader.hpp"
+#include <Core/Parents/PersonalInfo.hpp>
 #include <Core/Resources/Resources.hpp>
+#include <vector>
+
+namespace
+{
+    u16 getValue(const u8 *data, int offset)
+    {
+        return static_cast<u16>(data[offset + 1] << 8) | data[offset];
+    }
+
+    // Entries are packed by embed.py in the same order as the PersonalInfo constructor
+    std::vector<PersonalInfo> loadPersonal(const Resource &resource)
+    {
+        std::vector<PersonalInfo> personal;
+
+        const u8 *data = resource.data();
+        personal.reserve(resource.size() / 16);
+        for (size_t i = 0; i < resource.size(); i += 16)
+        {
+            const u8 *entry = data + i;
+            personal.emplace_back(entry[0], entry[1], entry[2], entry[3], entry[4], entry[5], entry[6], getValue(entry, 7),
+                                  getValue(entry, 9), getValue(entry, 11), entry[13], getValue(entry, 14));
+        }
+
+        return personal;
+    }
+}
 
 namespace PersonalLoader3
 {
     const PersonalInfo *getPersonal()
     {
-        return personal3.data();
+        static const std::vector<PersonalInfo> personal = loadPersonal(personal3);
+        return personal.data();
     }
 }
 
@@ -32,7 +60,8 @@ namespace PersonalLoader4
 {
     const PersonalInfo *getPersonal()
     {
-        return personal4.data();
+        static const std::vector<PersonalInfo> personal = loadPersonal(personal4);
+        return personal.data();
     }
 }
 
@@ -40,6 +69,7 @@ namespace PersonalLoader5
 {
     const PersonalInfo *getPersonal()
     {
-        return personal5.data();
+        static const std::vector<PersonalInfo> personal = loadPersonal(personal5);
+        return personal.data();
     }
 }
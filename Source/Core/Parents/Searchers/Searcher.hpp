@@ -22,6 +22,7 @@
 
 #include <Core/Parents/Filters/StateFilter.hpp>
 #include <Core/Util/Global.hpp>
+#include <array>
 #include <vector>
 
 enum Method : u8;
@@ -33,6 +34,103 @@ public:
     Searcher(u16 tid, u16 sid, u8 genderRatio, Method method, const StateFilter &filter);
 
 protected:
+    // Calls search for every IV spread between min and max, in ascending order, whose hidden power type passes the
+    // filter. Spreads that are skipped still count towards progress.
+    template <class Search>
+    void searchIVs(const std::array<u8, 6> &min, const std::array<u8, 6> &max, const bool &searching, int &progress,
+                   Search search) const
+    {
+        // Hidden power type only depends on the parity of each IV, so it is one of 64 parity patterns.
+        // Track the patterns still allowed by the IVs picked so far and skip any IV that leaves none.
+        constexpr u8 bit[6] = { 0, 1, 2, 4, 5, 3 };
+
+        u64 allowed = 0;
+        for (u8 pattern = 0; pattern < 64; pattern++)
+        {
+            if (filter.compareHiddenPower(pattern * 15 / 63))
+            {
+                allowed |= 1ull << pattern;
+            }
+        }
+
+        u64 parity[6][2] = {};
+        int remaining[6];
+        for (int i = 5; i >= 0; i--)
+        {
+            for (u8 pattern = 0; pattern < 64; pattern++)
+            {
+                parity[i][(pattern >> bit[i]) & 1] |= 1ull << pattern;
+            }
+            remaining[i] = i == 5 ? 1 : remaining[i + 1] * (max[i + 1] - min[i + 1] + 1);
+        }
+
+        for (u8 hp = min[0]; hp <= max[0]; hp++)
+        {
+            u64 mask0 = allowed & parity[0][hp & 1];
+            if (mask0 == 0)
+            {
+                progress += remaining[0];
+                continue;
+            }
+
+            for (u8 atk = min[1]; atk <= max[1]; atk++)
+            {
+                u64 mask1 = mask0 & parity[1][atk & 1];
+                if (mask1 == 0)
+                {
+                    progress += remaining[1];
+                    continue;
+                }
+
+                for (u8 def = min[2]; def <= max[2]; def++)
+                {
+                    u64 mask2 = mask1 & parity[2][def & 1];
+                    if (mask2 == 0)
+                    {
+                        progress += remaining[2];
+                        continue;
+                    }
+
+                    for (u8 spa = min[3]; spa <= max[3]; spa++)
+                    {
+                        u64 mask3 = mask2 & parity[3][spa & 1];
+                        if (mask3 == 0)
+                        {
+                            progress += remaining[3];
+                            continue;
+                        }
+
+                        for (u8 spd = min[4]; spd <= max[4]; spd++)
+                        {
+                            u64 mask4 = mask3 & parity[4][spd & 1];
+                            if (mask4 == 0)
+                            {
+                                progress += remaining[4];
+                                continue;
+                            }
+
+                            for (u8 spe = min[5]; spe <= max[5]; spe++)
+                            {
+                                if ((mask4 & parity[5][spe & 1]) == 0)
+                                {
+                                    progress++;
+                                    continue;
+                                }
+
+                                if (!searching)
+                                {
+                                    return;
+                                }
+
+                                search(hp, atk, def, spa, spd, spe);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
     u16 tid;
     u16 sid;
     u16 tsv;
@@ -68,45 +68,29 @@ public:
 
     u8 getIV(u8 index) const
     {
-        return ivs[index];
+        return (ivs >> (index * 5)) & 0x1f;
     }
 
     void setIVs(u8 index, u8 iv)
     {
-        this->ivs[index] = iv;
+        ivs = (ivs & ~(0x1f << (index * 5))) | ((iv & 0x1f) << (index * 5));
     }
 
     void setIVs(u16 iv1, u16 iv2)
     {
-        ivs[0] = iv1 & 0x1f;
-        ivs[1] = (iv1 >> 5) & 0x1f;
-        ivs[2] = (iv1 >> 10) & 0x1f;
-        ivs[3] = (iv2 >> 5) & 0x1f;
-        ivs[4] = (iv2 >> 10) & 0x1f;
-        ivs[5] = iv2 & 0x1f;
+        setIVs(iv1 & 0x1f, (iv1 >> 5) & 0x1f, (iv1 >> 10) & 0x1f, (iv2 >> 5) & 0x1f, (iv2 >> 10) & 0x1f, iv2 & 0x1f);
     }
 
     void setIVs(u32 iv)
     {
         u16 iv1 = iv >> 16;
-        ivs[0] = iv1 >> 10;
-        ivs[1] = (iv1 >> 5) & 0x1f;
-        ivs[2] = iv1 & 0x1f;
-
         u16 iv2 = iv & 0xffff;
-        ivs[3] = iv2 >> 10;
-        ivs[4] = (iv2 >> 5) & 0x1f;
-        ivs[5] = iv2 & 0x1f;
+        setIVs((iv1 >> 10) & 0x1f, (iv1 >> 5) & 0x1f, iv1 & 0x1f, (iv2 >> 10) & 0x1f, (iv2 >> 5) & 0x1f, iv2 & 0x1f);
     }
 
     void setIVs(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe)
     {
-        ivs[0] = hp;
-        ivs[1] = atk;
-        ivs[2] = def;
-        ivs[3] = spa;
-        ivs[4] = spd;
-        ivs[5] = spe;
+        ivs = hp | (atk << 5) | (def << 10) | (spa << 15) | (spd << 20) | (spe << 25) | (ivs & 0xc0000000);
     }
 
     u8 getAbility() const
@@ -151,12 +135,12 @@ public:
 
     u8 getHidden() const
     {
-        return hidden;
+        return hiddenPowerBits(0) * 15 / 63;
     }
 
     u8 getPower() const
     {
-        return power;
+        return 30 + (hiddenPowerBits(1) * 40 / 63);
     }
 
     u8 getNature() const
@@ -181,12 +165,12 @@ public:
 
     u8 getShiny() const
     {
-        return shiny;
+        return ivs >> 30;
     }
 
     void setShiny(u8 shiny)
     {
-        this->shiny = shiny;
+        ivs = (ivs & 0x3fffffff) | (static_cast<u32>(shiny) << 30);
     }
 
     template <u8 compare>
@@ -196,46 +180,41 @@ public:
 
         if (tsv == psv)
         {
-            shiny = 2; // Square
+            setShiny(2); // Square
         }
         else if ((tsv ^ psv) < compare)
         {
-            shiny = 1; // Star
+            setShiny(1); // Star
         }
         else
         {
-            shiny = 0;
+            setShiny(0);
         }
     }
 
-    void calculateHiddenPower()
-    {
-        constexpr int order[6] = { 0, 1, 2, 5, 3, 4 };
-
-        u8 h = 0;
-        u8 p = 0;
-        for (int i = 0; i < 6; i++)
+protected:
+    u32 seed = 0;
+    u32 advances = 0;
+    u32 pid = 0;
+    u32 ivs = 0; // 5 bits per IV in stat order starting from the low bits, shiny in the top 2 bits
+    u8 ability = 0;
+    u8 gender = 0;
+    u8 nature = 0;
+    u8 level = 0;
+
+private:
+    // Gathers the hidden power type (bit 0) or power (bit 1) bit of each IV in hidden power order
+    u8 hiddenPowerBits(u8 bit) const
+    {
+        constexpr u8 order[6] = { 0, 1, 2, 5, 3, 4 };
+
+        u8 bits = 0;
+        for (u8 i = 0; i < 6; i++)
         {
-            h += (ivs[order[i]] & 1) << i;
-            p += ((ivs[order[i]] >> 1) & 1) << i;
+            bits |= ((getIV(order[i]) >> bit) & 1) << i;
         }
-
-        hidden = h * 15 / 63;
-        power = 30 + (p * 40 / 63);
+        return bits;
     }
-
-protected:
-    u32 seed;
-    u32 advances;
-    u32 pid;
-    u8 ivs[6];
-    u8 ability;
-    u8 gender;
-    u8 hidden;
-    u8 power;
-    u8 nature;
-    u8 level;
-    u8 shiny;
 };
 
 #endif // STATE_HPP
@@ -19,10 +19,48 @@
 
 #include "RNGCache.hpp"
 #include <Core/Enum/Method.hpp>
-#include <cstring>
 
 // See https://crypto.stackexchange.com/a/10609 for how the following math works
-// Uses a brute force meet in the middle attack using precomputated data
+// Uses a brute force meet in the middle attack using precomputated data, generated at compile time
+
+struct RNGCacheTable
+{
+    u32 flags[0x10000 / 32];
+    u8 low[0x10000];
+
+    constexpr bool contains(u32 seed) const
+    {
+        u16 val = seed >> 16;
+        return (flags[val >> 5] >> (val & 31)) & 1;
+    }
+
+    constexpr u8 getLow(u32 seed) const
+    {
+        return low[seed >> 16];
+    }
+};
+
+namespace
+{
+    constexpr RNGCacheTable computeTable(u32 mult, u32 add)
+    {
+        RNGCacheTable table {};
+        for (u16 i = 0; i < 256; i++)
+        {
+            u32 right = mult * i + add;
+            u16 val = right >> 16;
+
+            table.flags[val >> 5] |= 1u << (val & 31);
+            table.low[val--] = static_cast<u8>(i);
+            table.flags[val >> 5] |= 1u << (val & 31);
+            table.low[val] = static_cast<u8>(i);
+        }
+        return table;
+    }
+
+    constexpr RNGCacheTable method1 = computeTable(0x41c64e6d, 0x6073);
+    constexpr RNGCacheTable method4 = computeTable(0xc2a29a69, 0xe97e7b6a);
+}
 
 RNGCache::RNGCache(Method method)
 {
@@ -31,6 +69,7 @@ RNGCache::RNGCache(Method method)
         k = 0xa29a6900; // Mult * Mult << 8
         mult = 0xc2a29a69; // Mult * Mult
         add = 0xe97e7b6a; // Add * (Mult + 1)
+        table = &method4;
     }
     // Method 1/2
     else
@@ -38,19 +77,7 @@ RNGCache::RNGCache(Method method)
         k = 0xc64e6d00; // Mult << 8
         mult = 0x41c64e6d; // pokerng constant
         add = 0x6073; // pokerng constant
-    }
-
-    std::memset(low, 0, sizeof(low));
-    std::memset(flags, false, sizeof(flags));
-    for (u16 i = 0; i < 256; i++)
-    {
-        u32 right = mult * i + add;
-        u16 val = right >> 16;
-
-        flags[val] = true;
-        low[val--] = static_cast<u8>(i);
-        flags[val] = true;
-        low[val] = static_cast<u8>(i);
+        table = &method1;
     }
 }
 
@@ -70,9 +97,9 @@ std::vector<u32> RNGCache::recoverLower16BitsIV(u8 hp, u8 atk, u8 def, u8 spa, u
 
     for (u16 i = 0; i < 256; i++, search1 -= k, search2 -= k)
     {
-        if (flags[search1 >> 16])
+        if (table->contains(search1))
         {
-            u32 test = first | static_cast<u32>(i << 8) | low[search1 >> 16];
+            u32 test = first | static_cast<u32>(i << 8) | table->getLow(search1);
             // Verify IV calls line up
             if (((test * mult + add) & 0x7fff0000) == second)
             {
@@ -80,9 +107,9 @@ std::vector<u32> RNGCache::recoverLower16BitsIV(u8 hp, u8 atk, u8 def, u8 spa, u
             }
         }
 
-        if (flags[search2 >> 16])
+        if (table->contains(search2))
         {
-            u32 test = first | static_cast<u32>(i << 8) | low[search2 >> 16];
+            u32 test = first | static_cast<u32>(i << 8) | table->getLow(search2);
             // Verify IV calls line up
             if (((test * mult + add) & 0x7fff0000) == second)
             {
@@ -105,9 +132,9 @@ std::vector<u32> RNGCache::recoverLower16BitsPID(u32 pid) const
 
     for (u16 i = 0; i < 256; i++, search -= k)
     {
-        if (flags[search >> 16])
+        if (table->contains(search))
         {
-            u32 test = first | static_cast<u32>(i << 8) | low[search >> 16];
+            u32 test = first | static_cast<u32>(i << 8) | table->getLow(search);
             // Verify PID calls line up
             if (((test * mult + add) & 0xffff0000) == second)
             {
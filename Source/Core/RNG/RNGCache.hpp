@@ -24,7 +24,9 @@
 #include <vector>
 
 enum Method : u8;
+struct RNGCacheTable;
 
+// Handle to the precomputed Method 1/4 lookup tables used to recover seeds from PIDs and IVs
 class RNGCache
 {
 public:
@@ -37,8 +39,7 @@ private:
     u32 add;
     u32 k;
     u32 mult;
-    u8 low[0x10000];
-    bool flags[0x10000];
+    const RNGCacheTable *table;
 };
 
 #endif // RNGCACHE_HPP
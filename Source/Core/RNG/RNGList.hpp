@@ -80,4 +80,93 @@ private:
     u16 head, pointer;
 };
 
+template <class RNG, u16 size>
+class RNGList64
+{
+public:
+    explicit RNGList64(u64 seed) : rng(seed), seed(seed), current(seed), head(0), pointer(0), count(0)
+    {
+        static_assert(size && ((size & (size - 1)) == 0), "Number is not a perfect multiple of two");
+
+        for (u64 &x : list)
+        {
+            x = rng.next();
+        }
+    }
+
+    RNGList64(const RNGList64 &) = delete;
+
+    void operator=(const RNGList64 &) = delete;
+
+    void advanceStates(u32 advances)
+    {
+        for (u32 i = 0; i < advances; i++)
+        {
+            advanceState();
+        }
+    }
+
+    void advanceState()
+    {
+        seed = list[head];
+        list[head++] = rng.next();
+        head &= size - 1;
+
+        resetState();
+    }
+
+    void advance(u32 advances)
+    {
+        for (u32 i = 0; i < advances; i++)
+        {
+            next();
+        }
+    }
+
+    u64 next()
+    {
+        // Reading past the window continues from the last value
+        if (count < size)
+        {
+            count++;
+            current = list[pointer++];
+            pointer &= size - 1;
+        }
+        else
+        {
+            RNG go(current);
+            current = go.next();
+        }
+        return current;
+    }
+
+    u32 nextUInt(u32 max)
+    {
+        return ((next() >> 32) * max) >> 32;
+    }
+
+    u32 nextUInt()
+    {
+        return next() >> 32;
+    }
+
+    u64 getSeed() const
+    {
+        return current;
+    }
+
+    void resetState()
+    {
+        pointer = head;
+        count = 0;
+        current = seed;
+    }
+
+private:
+    RNG rng;
+    u64 list[size];
+    u64 seed, current;
+    u16 head, pointer, count;
+};
+
 #endif // RNGLIST_HPP
@@ -0,0 +1,4222 @@
+#include "I18n.hpp"
+
+const Resource i18n[8][8] = {
+    // German
+    {
+        // characteristic_de
+        {
+            "\xf2\xac\x1f\x00\x00\x00\x84\x00\x00\x00\x89\x00\x00\x00\x9b\x00\x00\x00\xa9\x00\x00\x00\xb7\x00\x00\x00\xcb\x00\x00\x00\xe0\x00"
+            "\x00\x00\xf8\x00\x00\x00\x0b\x01\x00\x00\x1e\x01\x00\x00\x2c\x01\x00\x00\x35\x01\x00\x00\x4a\x01\x00\x00\x66\x01\x00\x00\x7b\x01"
+            "\x00\x00\x92\x01\x00\x00\xa1\x01\x00\x00\xb4\x01\x00\x00\xca\x01\x00\x00\xe3\x01\x00\x00\xfa\x01\x00\x00\x0c\x02\x00\x00\x1b\x02"
+            "\x00\x00\x29\x02\x00\x00\x3c\x02\x00\x00\x50\x02\x00\x00\x60\x02\x00\x00\x77\x02\x00\x00\x87\x02\x00\x00\x97\x02\x00\x00\xa9\x02"
+            "\x00\x00\xb5\x02\x00\x00\x4e\x6f\x6e\x65\x00\x4c\x69\x65\x62\x74\x20\x65\x73\x20\x7a\x75\x20\x65\x73\x73\x65\x6e\x00\x4e\x69\x63"
+            "\x6b\x74\x20\x6f\x66\x74\x20\x65\x69\x6e\x00\x53\x63\x68\x6c\xc3\xa4\x66\x74\x20\x67\x65\x72\x6e\x00\x4d\x61\x63\x68\x1c\x00\xd4"
+            "\x55\x6e\x6f\x72\x64\x6e\x75\x6e\x67\x00\x4d\x61\x67\x40\x00\xf2\x20\x6e\x74\x73\x70\x61\x6e\x6e\x65\x6e\x00\x53\x74\x6f\x6c\x7a"
+            "\x20\x61\x75\x66\x20\x73\x65\x69\x6e\x65\x20\x53\x74\xc3\xa4\x72\x6b\x65\x00\x50\x72\xc3\xbc\x67\x65\x6c\x74\x20\x73\x69\x63\x68"
+            "\x54\x00\xf3\x03\x42\x65\x73\x69\x74\x7a\x74\x20\x54\x65\x6d\x65\x72\x61\x6d\x65\x6e\x74\x95\x00\xf1\x47\x4b\xc3\xa4\x6d\x70\x66"
+            "\x65\x00\x49\x6d\x70\x75\x6c\x73\x69\x76\x00\x48\x61\x74\x20\x72\x6f\x62\x75\x73\x74\x65\x6e\x20\x4b\xc3\xb6\x72\x70\x65\x72\x00"
+            "\x4b\x61\x6e\x6e\x20\x54\x72\x65\x66\x66\x65\x72\x20\x67\x75\x74\x20\x76\x65\x72\x6b\x72\x61\x66\x74\x65\x6e\x00\xc3\x84\x75\xc3"
+            "\x9f\x65\x72\x73\x74\x20\x61\x75\x73\x64\x61\x75\x65\x72\x6e\x64\x46\x00\x01\x94\x00\x63\x67\x75\x74\x65\x20\x41\x19\x00\xf9\x00"
+            "\x00\x49\x73\x74\x20\x62\x65\x68\x61\x72\x72\x6c\x69\x63\x68\x18\x01\x21\x72\x65\xd4\x00\x50\x41\x63\x68\x74\x65\x4b\x00\xf0\x0b"
+            "\x66\x20\x47\x65\x72\xc3\xa4\x75\x73\x63\x68\x65\x00\x55\x6e\x67\x65\x73\x74\xc3\xbc\x6d\x20\x75\x6e\x64\x59\x00\x71\x66\xc3\xa4"
+            "\x6c\x74\x69\x67\x51\x00\x80\x66\x61\x73\x74\x20\x77\x69\x65\x18\x00\xb2\x20\x43\x6c\x6f\x77\x6e\x00\x46\x6c\xc3\xbc\x49\x00\xf3"
+            "\x0f\x73\x63\x68\x6e\x65\x6c\x6c\x00\x53\x65\x68\x72\x20\x6e\x65\x75\x67\x69\x65\x72\x69\x67\x00\x48\x69\x6e\x74\x65\x72\x68\x46"
+            "\x00\x51\xc3\x84\x75\x73\x73\xc3\x00\x41\x67\x65\x72\x69\xa1\x01\x00\x59\x00\x00\x83\x01\x90\x69\x6e\x20\x47\x65\x64\x61\x6e\x6b"
+            "\x70\x01\x00\x44\x00\x10\x70\x0e\x00\x55\x74\x69\x73\x63\x68\x55\x01\xc0\x73\x74\x61\x72\x6b\x65\x6e\x20\x57\x69\x6c\x6c\x3b\x00"
+            "\x52\x72\x67\x65\x6e\x64\x91\x00\x23\x74\x65\x7b\x00\x80\x61\x75\x66\x73\xc3\xa4\x73\x73\x7c\x00\xf0\x0e\x61\x73\x73\x74\x20\x4e"
+            "\x69\x65\x64\x65\x72\x6c\x61\x67\x65\x6e\x00\x44\x69\x63\x6b\x6b\xc3\xb6\x70\x66\x69\x67\x00",
+            631, 693
+        },
+        // dppt_de
+        {
+            "\xf2\xff\xd2\x71\x00\x00\x00\xcc\x01\x00\x00\xda\x01\x00\x00\xe6\x01\x00\x00\xf4\x01\x00\x00\x03\x02\x00\x00\x13\x02\x00\x00\x24"
+            "\x02\x00\x00\x36\x02\x00\x00\x47\x02\x00\x00\x55\x02\x00\x00\x65\x02\x00\x00\x8a\x02\x00\x00\x99\x02\x00\x00\xa8\x02\x00\x00\xb9"
+            "\x02\x00\x00\xc8\x02\x00\x00\xd7\x02\x00\x00\xe6\x02\x00\x00\xf5\x02\x00\x00\x0a\x03\x00\x00\x2b\x03\x00\x00\x4c\x03\x00\x00\x5c"
+            "\x03\x00\x00\x6f\x03\x00\x00\x82\x03\x00\x00\x95\x03\x00\x00\xa8\x03\x00\x00\xbb\x03\x00\x00\xce\x03\x00\x00\xdd\x03\x00\x00\xed"
+            "\x03\x00\x00\xfd\x03\x00\x00\x0e\x04\x00\x00\x27\x04\x00\x00\x40\x04\x00\x00\x59\x04\x00\x00\x66\x04\x00\x00\x77\x04\x00\x00\x89"
+            "\x04\x00\x00\x98\x04\x00\x00\xb0\x04\x00\x00\xc8\x04\x00\x00\xd7\x04\x00\x00\xee\x04\x00\x00\x07\x05\x00\x00\x20\x05\x00\x00\x34"
+            "\x05\x00\x00\x49\x05\x00\x00\x5e\x05\x00\x00\x73\x05\x00\x00\x88\x05\x00\x00\x9d\x05\x00\x00\xaa\x05\x00\x00\xc0\x05\x00\x00\xde"
+            "\x05\x00\x00\xfc\x05\x00\x00\x0a\x06\x00\x00\x18\x06\x00\x00\x24\x06\x00\x00\x33\x06\x00\x00\x43\x06\x00\x00\x5a\x06\x00\x00\x72"
+            "\x06\x00\x00\x82\x06\x00\x00\x8e\x06\x00\x00\xa1\x06\x00\x00\xad\x06\x00\x00\xb8\x06\x00\x00\xc4\x06\x00\x00\xd4\x06\x00\x00\xe5"
+            "\x06\x00\x00\xef\x06\x00\x00\xf9\x06\x00\x00\x03\x07\x00\x00\x15\x07\x00\x00\x27\x07\x00\x00\x39\x07\x00\x00\x4b\x07\x00\x00\x55"
+            "\x07\x00\x00\x5f\x07\x00\x00\x69\x07\x00\x00\x73\x07\x00\x00\x81\x07\x00\x00\x8f\x07\x00\x00\x9d\x07\x00\x00\xab\x07\x00\x00\xb9"
+            "\x07\x00\x00\xcb\x07\x00\x00\xdd\x07\x00\x00\xee\x07\x00\x00\xff\x07\x00\x00\x11\x08\x00\x00\x23\x08\x00\x00\x2d\x08\x00\x00\x37"
+            "\x08\x00\x00\x41\x08\x00\x00\x4b\x08\x00\x00\x55\x08\x00\x00\x5f\x08\x00\x00\x69\x08\x00\x00\x73\x08\x00\x00\x7d\x08\x00\x00\x87"
+            "\x08\x00\x00\x91\x08\x00\x00\x9b\x08\x00\x00\xa5\x08\x00\x00\xaf\x08\x00\x00\xbd\x08\x00\x00\xcb\x08\x00\x00\xd7\x08\x00\x00\xe1"
+            "\x08\x00\x00\xeb\x08\x00\x00\xf5\x08\x00\x00\xff\x08\x00\x00\x43\x61\x6e\x61\x6c\x61\x76\x65\x20\x43\x69\x74\x79\x00\x45\x74\x65"
+            "\x72\x6e\x61\x0c\x00\x73\x50\x61\x73\x74\x6f\x72\x69\x0e\x00\x83\x53\x75\x6e\x79\x73\x68\x6f\x72\x29\x00\xfb\x11\x50\x6f\x6b\xc3"
+            "\xa9\x6d\x6f\x6e\x20\x4c\x65\x61\x67\x75\x65\x00\x4f\x72\x65\x62\x75\x72\x67\x68\x20\x4d\x69\x6e\x65\x20\x31\x46\x11\x00\xf4\x05"
+            "\x42\x31\x46\x00\x56\x61\x6c\x6c\x65\x79\x20\x57\x69\x6e\x64\x77\x6f\x72\x6b\x73\x6d\x00\xf2\x02\x46\x6f\x72\x65\x73\x74\x00\x46"
+            "\x75\x65\x67\x6f\x20\x49\x72\x6f\x6e\x1e\x00\xf9\x15\x4d\x74\x2e\x20\x43\x6f\x72\x6f\x6e\x65\x74\x20\x28\x52\x6f\x75\x74\x65\x20"
+            "\x32\x30\x37\x2f\x32\x30\x38\x20\x45\x6e\x74\x72\x61\x6e\x63\x65\x29\x25\x00\x29\x32\x46\x0f\x00\x1a\x33\x0f\x00\x49\x53\x6e\x6f"
+            "\x77\x11\x00\x1a\x34\x20\x00\x1a\x35\x0f\x00\x1a\x36\x0f\x00\x1a\x37\x0f\x00\x8f\x54\x6f\x70\x20\x43\x61\x76\x65\xa5\x00\x02\x2f"
+            "\x31\x36\xa1\x00\x04\x05\x21\x00\x1f\x31\x21\x00\x04\x00\x26\x01\xfe\x03\x47\x72\x65\x61\x74\x20\x4d\x61\x72\x73\x68\x20\x41\x72"
+            "\x65\x61\x20\x31\x13\x00\x1e\x32\x13\x00\x1e\x33\x13\x00\x1e\x34\x13\x00\x1e\x35\x13\x00\xf0\x0e\x36\x00\x53\x6f\x6c\x61\x63\x65"
+            "\x6f\x6e\x20\x52\x75\x69\x6e\x73\x00\x56\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\xc9\x01\x09\x10\x00\x1b\x32\x10\x00\x01\xd8"
+            "\x01\x09\x11\x00\xaf\x61\x63\x6b\x20\x52\x6f\x6f\x6d\x20\x31\x19\x00\x05\x1f\x32\x19\x00\x05\xe6\x33\x00\x52\x61\x76\x61\x67\x65"
+            "\x64\x20\x50\x61\x74\x68\x42\x02\x3a\x47\x61\x74\x53\x02\x01\x11\x00\x00\x7b\x00\xeb\x53\x74\x61\x72\x6b\x20\x4d\x6f\x75\x6e\x74"
+            "\x61\x69\x6e\x0f\x00\x05\x65\x01\x0c\x18\x00\xf0\x0e\x49\x6e\x74\x65\x72\x69\x6f\x72\x00\x53\x65\x6e\x64\x6f\x66\x66\x20\x53\x70"
+            "\x72\x69\x6e\x67\x00\x54\x75\x72\x6e\x62\x8e\x00\x00\xdb\x01\x06\x3e\x00\x0a\x17\x00\xab\x31\x73\x74\x20\x50\x69\x6c\x6c\x61\x72"
+            "\x19\x00\x34\x32\x6e\x64\x19\x00\x00\x6c\x02\xb1\x70\x6f\x69\x6e\x74\x20\x54\x65\x6d\x70\x6c\xbd\x00\x0d\x14\x00\x01\xc0\x00\x0d"
+            "\x15\x00\x1f\x32\x15\x00\x01\x1f\x33\x15\x00\x01\x1f\x34\x15\x00\x01\xa2\x35\x46\x00\x57\x61\x79\x77\x61\x72\x64\xa0\x02\x08\x0d"
+            "\x00\xa0\x20\x28\x53\x65\x63\x72\x65\x74\x29\x00\xe9\x01\x73\x20\x4d\x61\x6e\x69\x61\x63\x1a\x00\xaf\x3c\x20\x31\x30\x20\x55\x6e"
+            "\x6f\x77\x6e\x1e\x00\x01\x17\x3e\x1e\x00\x03\x19\x00\xf0\x06\x54\x75\x6e\x6e\x65\x6c\x00\x54\x72\x6f\x70\x68\x79\x20\x47\x61\x72"
+            "\x64\x65\x6e\x00\xbd\x03\x78\x20\x49\x73\x6c\x61\x6e\x64\x0c\x00\x00\xff\x00\x08\x0f\x00\x00\xfa\x00\x09\x10\x00\x9e\x32\x46\x20"
+            "\x28\x4c\x65\x66\x74\x29\x17\x00\x4c\x52\x69\x67\x68\x18\x00\xe8\x33\x46\x00\x4f\x6c\x64\x20\x43\x68\x61\x74\x65\x61\x75\x0c\x00"
+            "\x02\x48\x02\xa0\x35\x00\x4c\x61\x6b\x65\x20\x56\x65\x72\xaa\x04\x02\x0c\x00\x42\x61\x6c\x6f\x72\x0b\x00\x30\x41\x63\x75\x17\x00"
+            "\x01\x12\x00\x10\x20\x12\x00\x62\x66\x72\x6f\x6e\x74\x00\x17\x00\x07\x11\x00\x04\x73\x04\x15\x31\x0a\x00\x15\x32\x0a\x00\x15\x33"
+            "\x0a\x00\x98\x34\x20\x28\x53\x6f\x75\x74\x68\x29\x12\x00\x38\x4e\x6f\x72\x12\x00\x1d\x35\x24\x00\x1d\x35\x24\x00\x15\x36\x0a\x00"
+            "\x15\x37\x0a\x00\x15\x38\x0a\x00\x50\x39\x00\x4c\x6f\x73\x77\x04\x30\x77\x65\x72\x4e\x01\x07\x0e\x00\x19\x32\x0e\x00\x19\x33\x0e"
+            "\x00\x19\x34\x0e\x00\x24\x35\x46\x50\x00\x2c\x31\x30\x92\x00\x00\x12\x00\x0a\x92\x00\x70\x31\x31\x20\x28\x57\x65\x73\x2e\x02\x06"
+            "\x11\x00\x28\x45\x61\x11\x00\x1d\x32\x34\x00\x1d\x32\x58\x00\x05\x2a\x01\x25\x31\x34\x0a\x00\x15\x35\x0a\x00\x05\xf6\x00\x15\x31"
+            "\xf6\x00\x15\x31\xf6\x00\x24\x31\x39\x0a\x00\x15\x32\x84\x01\x15\x32\x84\x01\x15\x32\x50\x00\x15\x32\x50\x00\x15\x32\x46\x00\x15"
+            "\x32\x46\x00\xb0\x32\x39\x00\x54\x77\x69\x6e\x6c\x65\x61\x66\x08\x01\xa2\x6e\x00\x43\x65\x6c\x65\x73\x74\x69\x63\x0e\x00\x61\x52"
+            "\x65\x73\x6f\x72\x74\x0b\x05\x05\x32\x00\x15\x30\x0a\x00\x05\xbe\x00\x15\x32\xaa\x00\x30\x33\x30\x00",
+            1369, 2303
+        },
+        // frlg_de
+        {
+            "\xf4\xff\xc6\x6b\x00\x00\x00\xb4\x01\x00\x00\xc0\x01\x00\x00\xce\x01\x00\x00\xdc\x01\x00\x00\xeb\x01\x00\x00\xf8\x01\x00\x00\x05"
+            "\x02\x00\x00\x15\x02\x00\x00\x1d\x02\x00\x00\x25\x02\x00\x00\x2d\x02\x00\x00\x35\x02\x00\x00\x3d\x02\x00\x00\x45\x02\x00\x00\x4d"
+            "\x02\x00\x00\x55\x02\x00\x00\x5d\x02\x00\x00\x66\x02\x00\x00\x6f\x02\x00\x00\x78\x02\x00\x00\x81\x02\x00\x00\x8a\x02\x00\x00\x93"
+            "\x02\x00\x00\x9c\x02\x00\x00\xa5\x02\x00\x00\xae\x02\x00\x00\xb7\x02\x00\x00\xc0\x02\x00\x00\xc9\x02\x00\x00\xd2\x02\x00\x00\xdb"
+            "\x02\x00\x00\xe4\x02\x00\x00\xed\x02\x00\x00\xfd\x02\x00\x00\x09\x03\x00\x00\x16\x03\x00\x00\x23\x03\x00\x00\x2d\x03\x00\x00\x3c"
+            "\x03\x00\x00\x4c\x03\x00\x00\x5c\x03\x00\x00\x6c\x03\x00\x00\x83\x03\x00\x00\x98\x03\x00\x00\xab\x03\x00\x00\xbe\x03\x00\x00\xd1"
+            "\x03\x00\x00\xe4\x03\x00\x00\xf3\x03\x00\x00\x03\x04\x00\x00\x16\x04\x00\x00\x2a\x04\x00\x00\x3e\x04\x00\x00\x52\x04\x00\x00\x66"
+            "\x04\x00\x00\x78\x04\x00\x00\x8a\x04\x00\x00\x9c\x04\x00\x00\xae\x04\x00\x00\xc0\x04\x00\x00\xd1\x04\x00\x00\xe2\x04\x00\x00\xf4"
+            "\x04\x00\x00\x00\x05\x00\x00\x0b\x05\x00\x00\x17\x05\x00\x00\x23\x05\x00\x00\x2f\x05\x00\x00\x3e\x05\x00\x00\x49\x05\x00\x00\x55"
+            "\x05\x00\x00\x65\x05\x00\x00\x75\x05\x00\x00\x85\x05\x00\x00\x96\x05\x00\x00\xa6\x05\x00\x00\xb5\x05\x00\x00\xc0\x05\x00\x00\xcb"
+            "\x05\x00\x00\xd7\x05\x00\x00\xf0\x05\x00\x00\x00\x06\x00\x00\x0f\x06\x00\x00\x1c\x06\x00\x00\x26\x06\x00\x00\x37\x06\x00\x00\x48"
+            "\x06\x00\x00\x59\x06\x00\x00\x66\x06\x00\x00\x74\x06\x00\x00\x82\x06\x00\x00\x90\x06\x00\x00\x9e\x06\x00\x00\xac\x06\x00\x00\xb9"
+            "\x06\x00\x00\xc6\x06\x00\x00\xd6\x06\x00\x00\xe7\x06\x00\x00\xf9\x06\x00\x00\x06\x07\x00\x00\x14\x07\x00\x00\x23\x07\x00\x00\x32"
+            "\x07\x00\x00\x41\x07\x00\x00\x51\x07\x00\x00\x60\x07\x00\x00\x6d\x07\x00\x00\x7d\x07\x00\x00\x50\x61\x6c\x6c\x65\x74\x20\x54\x6f"
+            "\x77\x6e\x00\x56\x69\x72\x69\x64\x69\x61\x6e\x20\x43\x69\x74\x79\x00\x43\x65\x72\x75\x6c\x65\x0e\x00\x85\x56\x65\x72\x6d\x69\x6c"
+            "\x69\x6f\x1d\x00\x34\x6c\x61\x64\x0d\x00\x73\x46\x75\x63\x68\x73\x69\x61\x1a\x00\xf3\x07\x69\x6e\x6e\x61\x62\x61\x72\x20\x49\x73"
+            "\x6c\x61\x6e\x64\x00\x52\x6f\x75\x74\x65\x20\x31\x08\x00\x13\x32\x08\x00\x13\x33\x08\x00\x13\x34\x08\x00\x13\x35\x08\x00\x13\x36"
+            "\x08\x00\x13\x37\x08\x00\x13\x38\x08\x00\x14\x39\x48\x00\x14\x30\x09\x00\x04\x52\x00\x14\x31\x53\x00\x14\x31\x54\x00\x14\x31\x55"
+            "\x00\x14\x31\x56\x00\x14\x31\x57\x00\x14\x31\x58\x00\x14\x31\x59\x00\x14\x31\x5a\x00\x14\x32\x5a\x00\x15\x32\xac\x00\x04\x5a\x00"
+            "\x14\x32\x5a\x00\x14\x32\x5a\x00\x26\x32\x35\x2d\x01\xf6\x03\x46\x6f\x72\x65\x73\x74\x00\x4d\x74\x2e\x20\x4d\x6f\x6f\x6e\x20\x31"
+            "\x46\x0c\x00\x19\x42\x0d\x00\xf0\x19\x32\x46\x00\x53\x2e\x53\x2e\x20\x41\x6e\x6e\x65\x00\x44\x69\x67\x6c\x65\x74\x74\x27\x73\x20"
+            "\x43\x61\x76\x65\x00\x56\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\x43\x00\x09\x10\x00\x1b\x32\x10\x00\xf0\x01\x33\x46\x00\x50"
+            "\x6f\x6b\xc3\xa9\x6d\x6f\x6e\x20\x4d\x61\x6e\x73\x97\x01\x3f\x31\x46\x2d\x17\x00\x01\x00\x82\x00\xf9\x03\x53\x61\x66\x61\x72\x69"
+            "\x20\x5a\x6f\x6e\x65\x20\x43\x65\x6e\x74\x65\x72\x13\x00\x6e\x41\x72\x65\x61\x20\x31\x13\x00\x1e\x32\x13\x00\x00\x09\x01\x90\x63"
+            "\x6b\x20\x54\x75\x6e\x6e\x65\x6c\xa7\x00\x08\x0f\x00\x01\x6b\x00\x63\x65\x61\x66\x6f\x61\x6d\xfd\x01\x10\x73\x23\x00\x0c\x13\x00"
+            "\x0f\x27\x00\x01\x01\x1b\x01\x0c\x14\x00\x1f\x33\x14\x00\x00\x17\x34\xe3\x00\x59\x54\x6f\x77\x65\x72\x0c\x01\x02\x12\x00\x0e\x24"
+            "\x00\x1d\x35\x12\x00\x1d\x36\x12\x00\x27\x37\x46\xf2\x02\x30\x61\x76\x65\xbb\x00\x0a\x11\x00\x1c\x32\x11\x00\x00\xca\x00\x11\x50"
+            "\x3d\x00\x94\x50\x6c\x61\x6e\x74\x00\x4f\x6e\x65\xf6\x02\x35\x46\x6f\x75\x02\x03\x35\x46\x69\x76\x18\x00\x61\x4b\x69\x6e\x64\x6c"
+            "\x65\xc6\x01\xf0\x10\x00\x54\x72\x65\x61\x73\x75\x72\x65\x20\x42\x65\x61\x63\x68\x00\x43\x61\x70\x65\x20\x42\x72\x69\x6e\x6b\x00"
+            "\x42\x6f\x6e\x64\x0b\x00\x81\x64\x67\x65\x00\x54\x68\x72\x65\x3f\x00\xf5\x17\x65\x20\x50\x6f\x72\x74\x00\x52\x65\x73\x6f\x72\x74"
+            "\x20\x47\x6f\x72\x67\x65\x6f\x75\x73\x00\x57\x61\x74\x65\x72\x20\x4c\x61\x62\x79\x72\x69\x6e\x74\x68\x6e\x00\xf4\x11\x65\x20\x4d"
+            "\x65\x61\x64\x6f\x77\x00\x4d\x65\x6d\x6f\x72\x69\x61\x6c\x20\x50\x69\x6c\x6c\x61\x72\x00\x4f\x75\x74\x63\x61\x73\x74\x92\x00\xa3"
+            "\x47\x72\x65\x65\x6e\x20\x50\x61\x74\x68\x4b\x00\x01\x0b\x00\x60\x52\x75\x69\x6e\x20\x56\x1c\x04\x93\x79\x00\x54\x72\x61\x69\x6e"
+            "\x65\x72\x28\x01\xf2\x14\x28\x65\x78\x74\x65\x72\x69\x6f\x72\x29\x00\x43\x61\x6e\x79\x6f\x6e\x20\x45\x6e\x74\x72\x61\x6e\x63\x65"
+            "\x00\x53\x65\x76\x61\x75\x6c\x74\x20\x18\x00\x80\x00\x54\x61\x6e\x6f\x62\x79\x20\x4b\x00\x11\x73\x06\x03\x56\x45\x6d\x62\x65\x72"
+            "\x0a\x00\x7c\x20\x52\x6f\x6f\x6d\x20\x31\x11\x00\x1c\x32\x11\x00\x17\x33\x11\x00\x03\x50\x03\x02\x0d\x00\x04\x5e\x03\x03\x0e\x00"
+            "\x19\x32\x0e\x00\x19\x33\x0e\x00\x19\x34\x0e\x00\x84\x35\x46\x00\x42\x65\x72\x72\x79\xbc\x03\x72\x49\x63\x65\x66\x61\x6c\x6c\x8a"
+            "\x03\x08\x0d\x00\x00\x70\x00\x09\x10\x00\x00\x73\x00\x0a\x11\x00\xf0\x04\x61\x63\x6b\x00\x50\x61\x74\x74\x65\x72\x6e\x20\x42\x75"
+            "\x73\x68\x00\x41\x6c\x20\x01\x22\x6e\x67\x4e\x00\x31\x4d\x6f\x6e\x30\x02\x21\x68\x61\xfd\x00\x65\x4c\x69\x70\x74\x6f\x6f\x0f\x00"
+            "\x65\x57\x65\x65\x70\x74\x68\x0f\x00\x75\x44\x69\x6c\x66\x6f\x72\x64\x10\x00\x65\x53\x63\x75\x66\x69\x62\x0f\x00\x45\x52\x69\x78"
+            "\x79\x0d\x00\x75\x56\x69\x61\x70\x6f\x69\x73\x10\x00\x00",
+            1294, 1917
+        },
+        // hgss_de
+        {
+            "\xf3\xff\xff\x02\x78\x00\x00\x00\xe8\x01\x00\x00\xf6\x01\x00\x00\xff\x01\x00\x00\x10\x02\x00\x00\x19\x02\x00\x00\x22\x02\x00\x00"
+            "\x2e\x02\x00\x00\x3b\x02\x00\x00\x44\x02\x00\x00\x5c\x02\x00\x00\x73\x02\x00\x00\x81\x02\x00\x00\x90\x02\x00\x00\x9f\x02\x00\x00"
+            "\xa8\x02\x00\x00\xb9\x02\x00\x00\xcb\x02\x00\x00\xd7\x02\x00\x00\xe0\x02\x00\x00\xe9\x02\x00\x00\xf7\x02\x00\x00\x00\x03\x00\x00"
+            "\x09\x03\x00\x00\x17\x03\x00\x00\x27\x03\x00\x00\x38\x03\x00\x00\x43\x03\x00\x00\x4c\x03\x00\x00\x55\x03\x00\x00\x62\x03\x00\x00"
+            "\x6b\x03\x00\x00\x74\x03\x00\x00\x85\x03\x00\x00\x97\x03\x00\x00\xa9\x03\x00\x00\xbb\x03\x00\x00\xc9\x03\x00\x00\xd2\x03\x00\x00"
+            "\xe0\x03\x00\x00\xf5\x03\x00\x00\x03\x04\x00\x00\x12\x04\x00\x00\x1b\x04\x00\x00\x28\x04\x00\x00\x31\x04\x00\x00\x3d\x04\x00\x00"
+            "\x4a\x04\x00\x00\x57\x04\x00\x00\x64\x04\x00\x00\x74\x04\x00\x00\x83\x04\x00\x00\x8c\x04\x00\x00\x95\x04\x00\x00\xaa\x04\x00\x00"
+            "\xbf\x04\x00\x00\xc8\x04\x00\x00\xd1\x04\x00\x00\xe5\x04\x00\x00\xf8\x04\x00\x00\x0c\x05\x00\x00\x20\x05\x00\x00\x34\x05\x00\x00"
+            "\x48\x05\x00\x00\x56\x05\x00\x00\x6d\x05\x00\x00\x7b\x05\x00\x00\x8b\x05\x00\x00\x96\x05\x00\x00\xa1\x05\x00\x00\xaf\x05\x00\x00"
+            "\xcc\x05\x00\x00\xdf\x05\x00\x00\xee\x05\x00\x00\xf7\x05\x00\x00\x00\x06\x00\x00\x09\x06\x00\x00\x15\x06\x00\x00\x23\x06\x00\x00"
+            "\x31\x06\x00\x00\x40\x06\x00\x00\x4d\x06\x00\x00\x5a\x06\x00\x00\x6a\x06\x00\x00\x73\x06\x00\x00\x7c\x06\x00\x00\x85\x06\x00\x00"
+            "\x8e\x06\x00\x00\x97\x06\x00\x00\xa6\x06\x00\x00\xb5\x06\x00\x00\xc5\x06\x00\x00\xcd\x06\x00\x00\xdd\x06\x00\x00\xe5\x06\x00\x00"
+            "\xed\x06\x00\x00\xf5\x06\x00\x00\xfd\x06\x00\x00\x05\x07\x00\x00\x0d\x07\x00\x00\x15\x07\x00\x00\x1e\x07\x00\x00\x27\x07\x00\x00"
+            "\x30\x07\x00\x00\x39\x07\x00\x00\x42\x07\x00\x00\x4b\x07\x00\x00\x54\x07\x00\x00\x5d\x07\x00\x00\x66\x07\x00\x00\x6f\x07\x00\x00"
+            "\x78\x07\x00\x00\x81\x07\x00\x00\x8d\x07\x00\x00\x9e\x07\x00\x00\xae\x07\x00\x00\xbe\x07\x00\x00\xce\x07\x00\x00\xde\x07\x00\x00"
+            "\xef\x07\x00\x00\x00\x08\x00\x00\x12\x08\x00\x00\x4e\x65\x77\x20\x42\x61\x72\x6b\x20\x54\x6f\x77\x6e\x00\x52\x6f\x75\x74\x65\x20"
+            "\x32\x39\x00\x43\x68\x65\x72\x72\x79\x67\x72\x6f\x76\x65\x20\x43\x69\x74\x79\x1a\x00\x24\x33\x30\x09\x00\x82\x31\x00\x56\x69\x6f"
+            "\x6c\x65\x74\x1e\x00\x60\x53\x70\x72\x6f\x75\x74\x44\x00\x24\x65\x72\x22\x00\xfc\x0a\x32\x00\x52\x75\x69\x6e\x73\x20\x6f\x66\x20"
+            "\x41\x6c\x70\x68\x20\x28\x4f\x75\x74\x73\x69\x64\x65\x29\x18\x00\x22\x49\x6e\x17\x00\xd8\x55\x6e\x69\x6f\x6e\x20\x43\x61\x76\x65"
+            "\x20\x31\x46\x0e\x00\x1b\x42\x0f\x00\x24\x32\x46\x64\x00\xf0\x00\x33\x00\x53\x4c\x4f\x57\x50\x4f\x4b\x45\x20\x57\x65\x6c\x6c\x38"
+            "\x00\x0a\x11\x00\x00\x3b\x00\xb4\x49\x6c\x65\x78\x20\x46\x6f\x72\x65\x73\x74\x38\x00\x14\x34\x09\x00\xf4\x00\x35\x00\x4e\x61\x74"
+            "\x69\x6f\x6e\x61\x6c\x20\x50\x61\x72\x6b\x17\x00\x14\x36\x09\x00\xa2\x37\x00\x45\x63\x72\x75\x74\x65\x61\x6b\xe9\x00\x62\x42\x75"
+            "\x72\x6e\x65\x64\xe9\x00\x00\x6e\x00\x09\x10\x00\x00\x6d\x00\x10\x42\x76\x00\x09\x08\x01\x14\x38\x09\x00\x89\x39\x00\x4f\x6c\x69"
+            "\x76\x69\x6e\x52\x01\x14\x34\x52\x01\xf0\x01\x34\x31\x00\x57\x68\x69\x72\x6c\x20\x49\x73\x6c\x61\x6e\x64\x73\x5e\x00\x0a\x11\x00"
+            "\x00\x5f\x00\x0b\x12\x00\x1d\x32\x12\x00\xb9\x33\x46\x00\x43\x69\x61\x6e\x77\x6f\x6f\x64\x67\x00\xb1\x32\x00\x4d\x74\x2e\x20\x4d"
+            "\x6f\x72\x74\x61\xb9\x00\x09\x0e\x00\x78\x20\x28\x42\x61\x63\x6b\x29\x15\x00\x19\x32\x23\x00\x00\x7b\x00\x03\x49\x00\x60\x33\x00"
+            "\x4c\x61\x6b\x65\xbe\x01\x44\x52\x61\x67\x65\x16\x00\xa0\x34\x00\x49\x63\x65\x20\x50\x61\x74\x68\x5d\x00\x05\x0c\x00\x01\x7f\x01"
+            "\x05\x0d\x00\x18\x32\x0d\x00\xd2\x33\x46\x00\x42\x6c\x61\x63\x6b\x74\x68\x6f\x72\x6e\xab\x00\xd4\x44\x72\x61\x67\x6f\x6e\xe2\x80"
+            "\x99\x73\x20\x44\x65\x8d\x02\x24\x34\x35\x09\x00\x30\x36\x00\x44\xa9\x02\x01\x04\x02\x14\x28\x87\x02\x1e\x29\x15\x00\x34\x34\x35"
+            "\x29\x33\x00\x13\x37\xc5\x00\x25\x6f\x6e\x09\x00\xf8\x04\x20\x28\x43\x6c\x65\x66\x61\x69\x72\x79\x29\x00\x53\x65\x61\x66\x6f\x61"
+            "\x6d\x73\x01\x0c\x13\x00\x00\xc2\x00\x0d\x14\x00\x1f\x32\x14\x00\x00\x1f\x33\x14\x00\x00\x12\x34\x45\x01\x42\x53\x69\x6c\x76\x2f"
+            "\x02\x07\x0e\x00\x03\xe8\x02\x48\x20\x54\x6f\x70\x17\x00\xf3\x03\x34\x46\x00\x43\x6c\x69\x66\x66\x20\x45\x64\x67\x65\x20\x47\x61"
+            "\x74\x65\x10\x00\x00\x30\x00\x07\x29\x00\x08\x34\x00\x03\xac\x01\x08\x59\x00\x71\x4d\x6f\x75\x6e\x74\x61\x69\x5a\x03\x0d\x1d\x00"
+            "\x19\x33\x30\x00\x00\x81\x00\x02\x2f\x01\x24\x31\x32\x09\x00\x14\x39\x0a\x04\x50\x30\x00\x50\x61\x6c\xe7\x03\x01\x1f\x04\x73\x56"
+            "\x69\x72\x69\x64\x69\x61\xaf\x01\x64\x43\x65\x72\x75\x6c\x65\x0e\x00\x61\x56\x65\x72\x6d\x69\x6c\xa5\x03\x02\x1d\x00\x34\x6c\x61"
+            "\x64\x0d\x00\x73\x46\x75\x63\x68\x73\x69\x61\x1a\x00\x73\x69\x6e\x6e\x61\x62\x61\x72\x27\x01\x04\xab\x01\x04\x27\x03\x14\x32\x7c"
+            "\x03\x24\x32\x37\x09\x00\x16\x38\xc6\x01\xa1\x52\x6f\x63\x6b\x20\x54\x75\x6e\x6e\x65\xed\x03\x08\x0f\x00\xf2\x00\x32\x46\x00\x56"
+            "\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\x1f\x00\x01\xce\x00\x04\x48\x00\x74\x20\x28\x53\x6f\x75\x74\x68\x1e\x02\x14\x33\x7b"
+            "\x00\x03\x08\x00\x04\x69\x02\x04\x81\x00\x04\x80\x00\x04\x9a\x00\x04\x15\x01\x14\x31\xb3\x03\x14\x31\x5a\x00\x14\x31\x4b\x00\x14"
+            "\x31\x4c\x00\x14\x31\x4d\x00\x14\x31\x4e\x00\x14\x31\x4f\x00\x15\x31\xea\x00\x05\x99\x00\x04\x78\x01\x14\x32\x3f\x00\xf1\x07\x32"
+            "\x35\x00\x54\x6f\x68\x6a\x6f\x20\x46\x61\x6c\x6c\x73\x00\x44\x49\x47\x4c\x45\x54\x54\x1a\x03\x01\x08\x02\x09\xe9\x00\x0c\xf9\x00"
+            "\x14\x33\xf9\x00\x60\x32\x20\x28\x4e\x6f\x72\xf1\x00\x05\xb9\x01\x03\x07\x05\x06\xbb\x01\x03\x6e\x05\x0a\x11\x00\x1c\x32\x11\x00"
+            "\x00\x06\x03\x00",
+            1348, 2066
+        },
+        // natures_de
+        {
+            "\xf0\xa4\x19\x00\x00\x00\x6c\x00\x00\x00\x73\x00\x00\x00\x78\x00\x00\x00\x7e\x00\x00\x00\x83\x00\x00\x00\x89\x00\x00\x00\x8f\x00"
+            "\x00\x00\x95\x00\x00\x00\x9c\x00\x00\x00\xa4\x00\x00\x00\xaa\x00\x00\x00\xb0\x00\x00\x00\xb7\x00\x00\x00\xbd\x00\x00\x00\xc2\x00"
+            "\x00\x00\xc7\x00\x00\x00\xcf\x00\x00\x00\xd4\x00\x00\x00\xda\x00\x00\x00\xe2\x00\x00\x00\xe9\x00\x00\x00\xef\x00\x00\x00\xf4\x00"
+            "\x00\x00\xfb\x00\x00\x00\x01\x01\x00\x00\x08\x01\x00\x00\x52\x6f\x62\x75\x73\x74\x00\x53\x6f\x6c\x6f\x00\x4d\x75\x74\x69\x67\x00"
+            "\x48\x61\x72\x74\x00\x46\x72\x65\x63\x68\x00\x4b\xc3\xbc\x68\x6e\x00\x53\x61\x6e\x66\x74\x00\x4c\x6f\x63\x6b\x65\x72\x00\x50\x66"
+            "\x69\x66\x66\x69\x67\x00\x4c\x61\x73\x63\x68\x00\x53\x63\x68\x65\x75\x00\x48\x61\x73\x39\x00\x40\x45\x72\x6e\x73\x3a\x00\xf1\x22"
+            "\x6f\x68\x00\x4e\x61\x69\x76\x00\x4d\xc3\xa4\xc3\x9f\x69\x67\x00\x4d\x69\x6c\x64\x00\x52\x75\x68\x69\x67\x00\x5a\x61\x67\x68\x61"
+            "\x66\x74\x00\x48\x69\x74\x7a\x69\x67\x00\x53\x74\x69\x6c\x6c\x00\x5a\x71\x00\x21\x6f\x72\x51\x00\x80\x61\x63\x68\x74\x00\x4b\x61"
+            "\x75\x1f\x00\x00",
+            260, 264
+        },
+        // powers_de
+        {
+            "\xf0\xa1\x10\x00\x00\x00\x48\x00\x00\x00\x4e\x00\x00\x00\x53\x00\x00\x00\x58\x00\x00\x00\x5e\x00\x00\x00\x66\x00\x00\x00\x6d\x00"
+            "\x00\x00\x73\x00\x00\x00\x79\x00\x00\x00\x7f\x00\x00\x00\x86\x00\x00\x00\x8e\x00\x00\x00\x96\x00\x00\x00\x9d\x00\x00\x00\xa1\x00"
+            "\x00\x00\xa8\x00\x00\x00\xb0\x00\x00\x00\x4b\x61\x6d\x70\x66\x00\x46\x6c\x75\x67\x00\x47\x69\x66\x74\x00\x42\x6f\x64\x65\x6e\x00"
+            "\x47\x65\x73\x74\x65\x69\x6e\x00\x4b\xc3\xa4\x66\x65\x72\x00\x47\x65\x69\x73\x74\x00\x53\x74\x61\x68\x6c\x00\x46\x65\x75\x65\x72"
+            "\x00\x57\x61\x73\x73\x65\x72\x00\x50\x66\x6c\x61\x6e\x7a\x65\x00\x45\x6c\x65\x6b\x74\x72\x6f\x00\x50\x73\x79\x63\x68\x6f\x00\x45"
+            "\x69\x73\x00\x44\x72\x61\x63\x68\x65\x00\x55\x6e\x6c\x69\x63\x68\x74\x00",
+            178, 176
+        },
+        // rse_de
+        {
+            "\xf3\xff\x69\x56\x00\x00\x00\x60\x01\x00\x00\x6d\x01\x00\x00\x7d\x01\x00\x00\x8c\x01\x00\x00\x9b\x01\x00\x00\xa9\x01\x00\x00\xb7"
+            "\x01\x00\x00\xc7\x01\x00\x00\xd8\x01\x00\x00\xe2\x01\x00\x00\xec\x01\x00\x00\xf6\x01\x00\x00\x00\x02\x00\x00\x0a\x02\x00\x00\x14"
+            "\x02\x00\x00\x1e\x02\x00\x00\x28\x02\x00\x00\x32\x02\x00\x00\x3c\x02\x00\x00\x46\x02\x00\x00\x50\x02\x00\x00\x5a\x02\x00\x00\x64"
+            "\x02\x00\x00\x6e\x02\x00\x00\x78\x02\x00\x00\x82\x02\x00\x00\x8c\x02\x00\x00\x96\x02\x00\x00\xa0\x02\x00\x00\xaa\x02\x00\x00\xb4"
+            "\x02\x00\x00\xbe\x02\x00\x00\xc8\x02\x00\x00\xd2\x02\x00\x00\xdc\x02\x00\x00\xe6\x02\x00\x00\xf0\x02\x00\x00\xfa\x02\x00\x00\x04"
+            "\x03\x00\x00\x0e\x03\x00\x00\x18\x03\x00\x00\x22\x03\x00\x00\x2c\x03\x00\x00\x43\x03\x00\x00\x5a\x03\x00\x00\x6a\x03\x00\x00\x85"
+            "\x03\x00\x00\x96\x03\x00\x00\xa7\x03\x00\x00\xba\x03\x00\x00\xcd\x03\x00\x00\xe0\x03\x00\x00\xf3\x03\x00\x00\x06\x04\x00\x00\x19"
+            "\x04\x00\x00\x29\x04\x00\x00\x38\x04\x00\x00\x47\x04\x00\x00\x5f\x04\x00\x00\x77\x04\x00\x00\x8a\x04\x00\x00\x9d\x04\x00\x00\xb1"
+            "\x04\x00\x00\xc5\x04\x00\x00\xe0\x04\x00\x00\xef\x04\x00\x00\xfe\x04\x00\x00\x10\x05\x00\x00\x20\x05\x00\x00\x2b\x05\x00\x00\x3f"
+            "\x05\x00\x00\x4f\x05\x00\x00\x5f\x05\x00\x00\x70\x05\x00\x00\x81\x05\x00\x00\x99\x05\x00\x00\xa8\x05\x00\x00\xb3\x05\x00\x00\xbf"
+            "\x05\x00\x00\xcd\x05\x00\x00\xdb\x05\x00\x00\xe9\x05\x00\x00\xf7\x05\x00\x00\x04\x06\x00\x00\x11\x06\x00\x00\x22\x06\x00\x00\x30"
+            "\x06\x00\x00\x44\x65\x77\x66\x6f\x72\x64\x20\x54\x6f\x77\x6e\x00\x50\x61\x63\x69\x66\x69\x64\x6c\x6f\x67\x10\x00\xf2\x08\x65\x74"
+            "\x61\x6c\x62\x75\x72\x67\x20\x43\x69\x74\x79\x00\x53\x6c\x61\x74\x65\x70\x6f\x72\x74\x0f\x00\x82\x4c\x69\x6c\x79\x63\x6f\x76\x65"
+            "\x0e\x00\x83\x4d\x6f\x73\x73\x64\x65\x65\x70\x2b\x00\x92\x6f\x6f\x74\x6f\x70\x6f\x6c\x69\x73\x10\x00\xa3\x45\x76\x65\x72\x20\x47"
+            "\x72\x61\x6e\x64\x2f\x00\x95\x52\x6f\x75\x74\x65\x20\x31\x30\x31\x0a\x00\x15\x32\x0a\x00\x15\x33\x0a\x00\x15\x34\x0a\x00\x15\x35"
+            "\x0a\x00\x15\x36\x0a\x00\x15\x37\x0a\x00\x15\x38\x0a\x00\x14\x39\x0a\x00\x25\x31\x30\x0a\x00\x05\x64\x00\x15\x31\x64\x00\x15\x31"
+            "\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x32\x64\x00\x15\x32"
+            "\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32"
+            "\x64\x00\x15\x33\x64\x00\x15\x33\x64\x00\x15\x33\x64\x00\x15\x33\x64\x00\xf5\x00\x33\x34\x00\x55\x6e\x64\x65\x72\x77\x61\x74\x65"
+            "\x72\x20\x28\x7a\x00\x1f\x29\x17\x00\x02\x30\x36\x29\x00\x8e\x01\xba\x69\x74\x65\x20\x43\x61\x76\x65\x20\x31\x46\x10\x00\xda\x53"
+            "\x74\x65\x76\x65\x6e\x27\x73\x20\x52\x6f\x6f\x6d\x1b\x00\x1c\x42\x2c\x00\xfe\x07\x42\x32\x46\x00\x53\x61\x66\x61\x72\x69\x20\x5a"
+            "\x6f\x6e\x65\x20\x41\x72\x65\x61\x20\x31\x13\x00\x1e\x32\x13\x00\x1e\x33\x13\x00\x1e\x34\x13\x00\x1e\x35\x13\x00\x17\x36\x9c\x02"
+            "\xfb\x2c\x57\x6f\x6f\x64\x73\x00\x52\x75\x73\x74\x75\x72\x66\x20\x54\x75\x6e\x6e\x65\x6c\x00\x41\x62\x61\x6e\x64\x6f\x6e\x65\x64"
+            "\x20\x53\x68\x69\x70\x00\x4e\x65\x77\x20\x4d\x61\x75\x76\x69\x6c\x6c\x65\x20\x28\x45\x6e\x74\x72\x61\x6e\x63\x65\x29\x18\x00\xfd"
+            "\x0d\x42\x61\x73\x65\x6d\x65\x6e\x74\x29\x00\x4d\x65\x74\x65\x6f\x72\x20\x46\x61\x6c\x6c\x73\x20\x31\x46\x20\x31\x52\x13\x00\x1b"
+            "\x32\x13\x00\x1f\x42\x27\x00\x00\x00\x14\x00\x0c\x28\x00\x05\x5b\x01\x00\x3d\x01\x80\x00\x4d\x74\x2e\x20\x50\x79\x72\x82\x01\x36"
+            "\x2d\x33\x46\x0f\x00\x47\x34\x46\x2d\x36\x0f\x00\x86\x45\x78\x74\x65\x72\x69\x6f\x72\x12\x00\xc2\x53\x75\x6d\x6d\x69\x74\x00\x53"
+            "\x68\x6f\x61\x6c\x4b\x00\x06\x0b\x00\x42\x20\x49\x63\x65\xba\x01\x81\x53\x65\x61\x66\x6c\x6f\x6f\x72\x17\x00\xf0\x00\x72\x6e\x00"
+            "\x56\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\xf5\x01\x09\x10\x00\x00\xda\x01\x0a\x11\x00\x31\x32\x46\x00\x50\x00\xa4\x6f\x66"
+            "\x20\x4f\x72\x69\x67\x69\x6e\x20\x3b\x01\x0b\x18\x00\xf0\x13\x00\x46\x69\x65\x72\x79\x20\x50\x61\x74\x68\x00\x4a\x61\x67\x67\x65"
+            "\x64\x20\x50\x61\x73\x73\x00\x53\x6b\x79\x20\x50\x69\x6c\x6c\x61\x72\x6e\x00\x07\x0e\x00\x19\x33\x0e\x00\xf0\x08\x35\x46\x00\x4d"
+            "\x61\x67\x6d\x61\x20\x48\x69\x64\x65\x6f\x75\x74\x00\x4d\x69\x72\x61\x67\x65\x86\x04\xa2\x65\x72\x00\x41\x72\x74\x69\x73\x61\x6e"
+            "\xe6\x00\x71\x44\x65\x73\x65\x72\x74\x20\xd5\x02\x10\x70\x63\x00\x20\x41\x6c\x1b\x01\x22\x6e\x67\x1f\x00\x00",
+            1051, 1584
+        },
+        // species_de
+        {
+            "\xf1\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xa8\x27\x03\x00\x00\xa4\x0c\x00\x00\xac\x0c\x00\x00\xb6\x0c\x00\x00\xbf\x0c"
+            "\x00\x00\xc8\x0c\x00\x00\xd0\x0c\x00\x00\xd7\x0c\x00\x00\xdf\x0c\x00\x00\xe8\x0c\x00\x00\xef\x0c\x00\x00\xf5\x0c\x00\x00\xfc\x0c"
+            "\x00\x00\x04\x0d\x00\x00\x0c\x0d\x00\x00\x13\x0d\x00\x00\x19\x0d\x00\x00\x20\x0d\x00\x00\x28\x0d\x00\x00\x30\x0d\x00\x00\x3a\x0d"
+            "\x00\x00\x44\x0d\x00\x00\x4c\x0d\x00\x00\x53\x0d\x00\x00\x5a\x0d\x00\x00\x60\x0d\x00\x00\x68\x0d\x00\x00\x6f\x0d\x00\x00\x76\x0d"
+            "\x00\x00\x7f\x0d\x00\x00\x8a\x0d\x00\x00\x93\x0d\x00\x00\x9d\x0d\x00\x00\xa8\x0d\x00\x00\xb1\x0d\x00\x00\xba\x0d\x00\x00\xc0\x0d"
+            "\x00\x00\xc5\x0d\x00\x00\xcc\x0d\x00\x00\xd4\x0d\x00\x00\xde\x0d\x00\x00\xe9\x0d\x00\x00\xef\x0d\x00\x00\xf6\x0d\x00\x00\xfe\x0d"
+            "\x00\x00\x05\x0e\x00\x00\x0c\x0e\x00\x00\x12\x0e\x00\x00\x1a\x0e\x00\x00\x21\x0e\x00\x00\x26\x0e\x00\x00\x2c\x0e\x00\x00\x33\x0e"
+            "\x00\x00\x39\x0e\x00\x00\x44\x0e\x00\x00\x4a\x0e\x00\x00\x52\x0e\x00\x00\x58\x0e\x00\x00\x5f\x0e\x00\x00\x66\x0e\x00\x00\x6d\x0e"
+            "\x00\x00\x75\x0e\x00\x00\x7e\x0e\x00\x00\x85\x0e\x00\x00\x8a\x0e\x00\x00\x92\x0e\x00\x00\x9a\x0e\x00\x00\xa3\x0e\x00\x00\xac\x0e"
+            "\x00\x00\xb5\x0e\x00\x00\xbe\x0e\x00\x00\xc9\x0e\x00\x00\xd2\x0e\x00\x00\xdb\x0e\x00\x00\xe3\x0e\x00\x00\xee\x0e\x00\x00\xf5\x0e"
+            "\x00\x00\xfc\x0e\x00\x00\x03\x0f\x00\x00\x0b\x0f\x00\x00\x13\x0f\x00\x00\x1a\x0f\x00\x00\x24\x0f\x00\x00\x2d\x0f\x00\x00\x35\x0f"
+            "\x00\x00\x3a\x0f\x00\x00\x40\x0f\x00\x00\x46\x0f\x00\x00\x4d\x0f\x00\x00\x54\x0f\x00\x00\x5c\x0f\x00\x00\x64\x0f\x00\x00\x6b\x0f"
+            "\x00\x00\x73\x0f\x00\x00\x7b\x0f\x00\x00\x82\x0f\x00\x00\x87\x0f\x00\x00\x90\x0f\x00\x00\x96\x0f\x00\x00\x9d\x0f\x00\x00\xa5\x0f"
+            "\x00\x00\xae\x0f\x00\x00\xb8\x0f\x00\x00\xbd\x0f\x00\x00\xc5\x0f\x00\x00\xce\x0f\x00\x00\xd5\x0f\x00\x00\xdd\x0f\x00\x00\xe6\x0f"
+            "\x00\x00\xee\x0f\x00\x00\xf5\x0f\x00\x00\xfd\x0f\x00\x00\x04\x10\x00\x00\x0c\x10\x00\x00\x15\x10\x00\x00\x1d\x10\x00\x00\x25\x10"
+            "\x00\x00\x2c\x10\x00\x00\x33\x10\x00\x00\x3b\x10\x00\x00\x43\x10\x00\x00\x4b\x10\x00\x00\x53\x10\x00\x00\x5c\x10\x00\x00\x64\x10"
+            "\x00\x00\x6c\x10\x00\x00\x74\x10\x00\x00\x7b\x10\x00\x00\x82\x10\x00\x00\x89\x10\x00\x00\x92\x10\x00\x00\x9a\x10\x00\x00\xa1\x10"
+            "\x00\x00\xa7\x10\x00\x00\xad\x10\x00\x00\xb4\x10\x00\x00\xbb\x10\x00\x00\xc3\x10\x00\x00\xcb\x10\x00\x00\xd4\x10\x00\x00\xdc\x10"
+            "\x00\x00\xe3\x10\x00\x00\xec\x10\x00\x00\xf7\x10\x00\x00\xfe\x10\x00\x00\x05\x11\x00\x00\x0c\x11\x00\x00\x14\x11\x00\x00\x1c\x11"
+            "\x00\x00\x25\x11\x00\x00\x2e\x11\x00\x00\x34\x11\x00\x00\x38\x11\x00\x00\x40\x11\x00\x00\x49\x11\x00\x00\x51\x11\x00\x00\x5a\x11"
+            "\x00\x00\x63\x11\x00\x00\x6c\x11\x00\x00\x76\x11\x00\x00\x7f\x11\x00\x00\x8a\x11\x00\x00\x91\x11\x00\x00\x9b\x11\x00\x00\xa4\x11"
+            "\x00\x00\xab\x11\x00\x00\xb2\x11\x00\x00\xb9\x11\x00\x00\xc1\x11\x00\x00\xc9\x11\x00\x00\xd0\x11\x00\x00\xd6\x11\x00\x00\xde\x11"
+            "\x00\x00\xe4\x11\x00\x00\xe8\x11\x00\x00\xf3\x11\x00\x00\xfa\x11\x00\x00\x02\x12\x00\x00\x07\x12\x00\x00\x0c\x12\x00\x00\x16\x12"
+            "\x00\x00\x1c\x12\x00\x00\x25\x12\x00\x00\x2e\x12\x00\x00\x35\x12\x00\x00\x3f\x12\x00\x00\x49\x12\x00\x00\x4f\x12\x00\x00\x5a\x12"
+            "\x00\x00\x63\x12\x00\x00\x6c\x12\x00\x00\x74\x12\x00\x00\x7d\x12\x00\x00\x87\x12\x00\x00\x8d\x12\x00\x00\x94\x12\x00\x00\x9c\x12"
+            "\x00\x00\xa3\x12\x00\x00\xac\x12\x00\x00\xb4\x12\x00\x00\xbf\x12\x00\x00\xca\x12\x00\x00\xd3\x12\x00\x00\xdd\x12\x00\x00\xe7\x12"
+            "\x00\x00\xee\x12\x00\x00\xf9\x12\x00\x00\x02\x13\x00\x00\x0a\x13\x00\x00\x12\x13\x00\x00\x1b\x13\x00\x00\x24\x13\x00\x00\x2f\x13"
+            "\x00\x00\x37\x13\x00\x00\x40\x13\x00\x00\x4a\x13\x00\x00\x52\x13\x00\x00\x5c\x13\x00\x00\x65\x13\x00\x00\x70\x13\x00\x00\x79\x13"
+            "\x00\x00\x81\x13\x00\x00\x88\x13\x00\x00\x91\x13\x00\x00\x9a\x13\x00\x00\xa4\x13\x00\x00\xac\x13\x00\x00\xb3\x13\x00\x00\xbd\x13"
+            "\x00\x00\xc7\x13\x00\x00\xd0\x13\x00\x00\xdb\x13\x00\x00\xe2\x13\x00\x00\xea\x13\x00\x00\xf3\x13\x00\x00\xfe\x13\x00\x00\x08\x14"
+            "\x00\x00\x0f\x14\x00\x00\x17\x14\x00\x00\x20\x14\x00\x00\x27\x14\x00\x00\x2d\x14\x00\x00\x35\x14\x00\x00\x3e\x14\x00\x00\x45\x14"
+            "\x00\x00\x4b\x14\x00\x00\x53\x14\x00\x00\x5c\x14\x00\x00\x64\x14\x00\x00\x6d\x14\x00\x00\x73\x14\x00\x00\x79\x14\x00\x00\x80\x14"
+            "\x00\x00\x8a\x14\x00\x00\x92\x14\x00\x00\x9b\x14\x00\x00\xa3\x14\x00\x00\xac\x14\x00\x00\xb4\x14\x00\x00\xbc\x14\x00\x00\xc6\x14"
+            "\x00\x00\xcd\x14\x00\x00\xd5\x14\x00\x00\xde\x14\x00\x00\xe7\x14\x00\x00\xf0\x14\x00\x00\xf8\x14\x00\x00\x01\x15\x00\x00\x0b\x15"
+            "\x00\x00\x13\x15\x00\x00\x19\x15\x00\x00\x22\x15\x00\x00\x2b\x15\x00\x00\x36\x15\x00\x00\x3f\x15\x00\x00\x46\x15\x00\x00\x50\x15"
+            "\x00\x00\x5b\x15\x00\x00\x66\x15\x00\x00\x6e\x15\x00\x00\x77\x15\x00\x00\x7e\x15\x00\x00\x85\x15\x00\x00\x90\x15\x00\x00\x9a\x15"
+            "\x00\x00\xa5\x15\x00\x00\xab\x15\x00\x00\xb2\x15\x00\x00\xba\x15\x00\x00\xc2\x15\x00\x00\xcc\x15\x00\x00\xd4\x15\x00\x00\xdc\x15"
+            "\x00\x00\xe5\x15\x00\x00\xed\x15\x00\x00\xf6\x15\x00\x00\xff\x15\x00\x00\x08\x16\x00\x00\x11\x16\x00\x00\x19\x16\x00\x00\x21\x16"
+            "\x00\x00\x27\x16\x00\x00\x2f\x16\x00\x00\x37\x16\x00\x00\x41\x16\x00\x00\x4c\x16\x00\x00\x55\x16\x00\x00\x5e\x16\x00\x00\x66\x16"
+            "\x00\x00\x70\x16\x00\x00\x7b\x16\x00\x00\x84\x16\x00\x00\x8b\x16\x00\x00\x91\x16\x00\x00\x99\x16\x00\x00\xa2\x16\x00\x00\xaa\x16"
+            "\x00\x00\xb5\x16\x00\x00\xc0\x16\x00\x00\xca\x16\x00\x00\xd2\x16\x00\x00\xda\x16\x00\x00\xe2\x16\x00\x00\xe9\x16\x00\x00\xf2\x16"
+            "\x00\x00\xf9\x16\x00\x00\x00\x17\x00\x00\x07\x17\x00\x00\x0e\x17\x00\x00\x18\x17\x00\x00\x20\x17\x00\x00\x2a\x17\x00\x00\x30\x17"
+            "\x00\x00\x39\x17\x00\x00\x3f\x17\x00\x00\x47\x17\x00\x00\x4d\x17\x00\x00\x55\x17\x00\x00\x5f\x17\x00\x00\x67\x17\x00\x00\x70\x17"
+            "\x00\x00\x77\x17\x00\x00\x82\x17\x00\x00\x8c\x17\x00\x00\x95\x17\x00\x00\xa0\x17\x00\x00\xa7\x17\x00\x00\xae\x17\x00\x00\xb6\x17"
+            "\x00\x00\xbe\x17\x00\x00\xc7\x17\x00\x00\xcf\x17\x00\x00\xd6\x17\x00\x00\xde\x17\x00\x00\xe6\x17\x00\x00\xee\x17\x00\x00\xf9\x17"
+            "\x00\x00\x03\x18\x00\x00\x0b\x18\x00\x00\x16\x18\x00\x00\x1c\x18\x00\x00\x21\x18\x00\x00\x2b\x18\x00\x00\x35\x18\x00\x00\x3d\x18"
+            "\x00\x00\x45\x18\x00\x00\x4e\x18\x00\x00\x54\x18\x00\x00\x5d\x18\x00\x00\x68\x18\x00\x00\x72\x18\x00\x00\x7c\x18\x00\x00\x85\x18"
+            "\x00\x00\x8e\x18\x00\x00\x99\x18\x00\x00\xa0\x18\x00\x00\xa7\x18\x00\x00\xb1\x18\x00\x00\xba\x18\x00\x00\xc1\x18\x00\x00\xcb\x18"
+            "\x00\x00\xd2\x18\x00\x00\xd9\x18\x00\x00\xe0\x18\x00\x00\xe8\x18\x00\x00\xf1\x18\x00\x00\xf9\x18\x00\x00\x00\x19\x00\x00\x08\x19"
+            "\x00\x00\x13\x19\x00\x00\x1e\x19\x00\x00\x26\x19\x00\x00\x2e\x19\x00\x00\x37\x19\x00\x00\x3e\x19\x00\x00\x46\x19\x00\x00\x4f\x19"
+            "\x00\x00\x59\x19\x00\x00\x62\x19\x00\x00\x6c\x19\x00\x00\x73\x19\x00\x00\x7b\x19\x00\x00\x84\x19\x00\x00\x8d\x19\x00\x00\x95\x19"
+            "\x00\x00\x9b\x19\x00\x00\xa2\x19\x00\x00\xa9\x19\x00\x00\xb2\x19\x00\x00\xbb\x19\x00\x00\xc4\x19\x00\x00\xcf\x19\x00\x00\xd9\x19"
+            "\x00\x00\xdf\x19\x00\x00\xe9\x19\x00\x00\xf2\x19\x00\x00\xfb\x19\x00\x00\x05\x1a\x00\x00\x0f\x1a\x00\x00\x17\x1a\x00\x00\x1f\x1a"
+            "\x00\x00\x26\x1a\x00\x00\x2d\x1a\x00\x00\x38\x1a\x00\x00\x42\x1a\x00\x00\x4d\x1a\x00\x00\x56\x1a\x00\x00\x61\x1a\x00\x00\x6a\x1a"
+            "\x00\x00\x73\x1a\x00\x00\x7e\x1a\x00\x00\x87\x1a\x00\x00\x90\x1a\x00\x00\x9b\x1a\x00\x00\xa5\x1a\x00\x00\xaf\x1a\x00\x00\xb8\x1a"
+            "\x00\x00\xc0\x1a\x00\x00\xc9\x1a\x00\x00\xcf\x1a\x00\x00\xd9\x1a\x00\x00\xe2\x1a\x00\x00\xec\x1a\x00\x00\xf4\x1a\x00\x00\xfd\x1a"
+            "\x00\x00\x06\x1b\x00\x00\x0f\x1b\x00\x00\x18\x1b\x00\x00\x1e\x1b\x00\x00\x26\x1b\x00\x00\x31\x1b\x00\x00\x3c\x1b\x00\x00\x46\x1b"
+            "\x00\x00\x50\x1b\x00\x00\x5a\x1b\x00\x00\x63\x1b\x00\x00\x6e\x1b\x00\x00\x76\x1b\x00\x00\x7f\x1b\x00\x00\x88\x1b\x00\x00\x93\x1b"
+            "\x00\x00\x9d\x1b\x00\x00\xa6\x1b\x00\x00\xb0\x1b\x00\x00\xbb\x1b\x00\x00\xc5\x1b\x00\x00\xcf\x1b\x00\x00\xd9\x1b\x00\x00\xe2\x1b"
+            "\x00\x00\xeb\x1b\x00\x00\xf3\x1b\x00\x00\xfd\x1b\x00\x00\x06\x1c\x00\x00\x0e\x1c\x00\x00\x16\x1c\x00\x00\x20\x1c\x00\x00\x2a\x1c"
+            "\x00\x00\x34\x1c\x00\x00\x3f\x1c\x00\x00\x49\x1c\x00\x00\x4f\x1c\x00\x00\x55\x1c\x00\x00\x5d\x1c\x00\x00\x64\x1c\x00\x00\x6b\x1c"
+            "\x00\x00\x72\x1c\x00\x00\x7a\x1c\x00\x00\x84\x1c\x00\x00\x8d\x1c\x00\x00\x97\x1c\x00\x00\x9e\x1c\x00\x00\xa6\x1c\x00\x00\xae\x1c"
+            "\x00\x00\xb6\x1c\x00\x00\xbd\x1c\x00\x00\xc5\x1c\x00\x00\xce\x1c\x00\x00\xd6\x1c\x00\x00\xe1\x1c\x00\x00\xe8\x1c\x00\x00\xf1\x1c"
+            "\x00\x00\xfb\x1c\x00\x00\x02\x1d\x00\x00\x0d\x1d\x00\x00\x15\x1d\x00\x00\x1e\x1d\x00\x00\x27\x1d\x00\x00\x30\x1d\x00\x00\x3a\x1d"
+            "\x00\x00\x43\x1d\x00\x00\x4b\x1d\x00\x00\x55\x1d\x00\x00\x5d\x1d\x00\x00\x67\x1d\x00\x00\x70\x1d\x00\x00\x7b\x1d\x00\x00\x83\x1d"
+            "\x00\x00\x8d\x1d\x00\x00\x95\x1d\x00\x00\x9f\x1d\x00\x00\xaa\x1d\x00\x00\xb3\x1d\x00\x00\xbc\x1d\x00\x00\xc4\x1d\x00\x00\xcc\x1d"
+            "\x00\x00\xd5\x1d\x00\x00\xe0\x1d\x00\x00\xeb\x1d\x00\x00\xf4\x1d\x00\x00\xfd\x1d\x00\x00\x06\x1e\x00\x00\x0f\x1e\x00\x00\x17\x1e"
+            "\x00\x00\x22\x1e\x00\x00\x2b\x1e\x00\x00\x36\x1e\x00\x00\x41\x1e\x00\x00\x49\x1e\x00\x00\x53\x1e\x00\x00\x5c\x1e\x00\x00\x66\x1e"
+            "\x00\x00\x70\x1e\x00\x00\x78\x1e\x00\x00\x81\x1e\x00\x00\x89\x1e\x00\x00\x90\x1e\x00\x00\x9b\x1e\x00\x00\xa4\x1e\x00\x00\xaa\x1e"
+            "\x00\x00\xb3\x1e\x00\x00\xbd\x1e\x00\x00\xc7\x1e\x00\x00\xcf\x1e\x00\x00\xd9\x1e\x00\x00\xe3\x1e\x00\x00\xec\x1e\x00\x00\xf7\x1e"
+            "\x00\x00\x01\x1f\x00\x00\x0b\x1f\x00\x00\x16\x1f\x00\x00\x1f\x1f\x00\x00\x26\x1f\x00\x00\x30\x1f\x00\x00\x39\x1f\x00\x00\x43\x1f"
+            "\x00\x00\x4e\x1f\x00\x00\x57\x1f\x00\x00\x61\x1f\x00\x00\x6c\x1f\x00\x00\x77\x1f\x00\x00\x81\x1f\x00\x00\x87\x1f\x00\x00\x8f\x1f"
+            "\x00\x00\x9a\x1f\x00\x00\xa5\x1f\x00\x00\xb0\x1f\x00\x00\xbb\x1f\x00\x00\xc6\x1f\x00\x00\xcf\x1f\x00\x00\xd7\x1f\x00\x00\xe0\x1f"
+            "\x00\x00\xeb\x1f\x00\x00\xf5\x1f\x00\x00\xfe\x1f\x00\x00\x09\x20\x00\x00\x13\x20\x00\x00\x1c\x20\x00\x00\x27\x20\x00\x00\x2e\x20"
+            "\x00\x00\x36\x20\x00\x00\x41\x20\x00\x00\x4c\x20\x00\x00\x55\x20\x00\x00\x5d\x20\x00\x00\x68\x20\x00\x00\x71\x20\x00\x00\x7a\x20"
+            "\x00\x00\x82\x20\x00\x00\x8b\x20\x00\x00\x95\x20\x00\x00\x9b\x20\x00\x00\xa3\x20\x00\x00\xae\x20\x00\x00\xb9\x20\x00\x00\xc3\x20"
+            "\x00\x00\xce\x20\x00\x00\xd8\x20\x00\x00\xe0\x20\x00\x00\xe8\x20\x00\x00\xf3\x20\x00\x00\xfc\x20\x00\x00\x02\x21\x00\x00\x0a\x21"
+            "\x00\x00\x10\x21\x00\x00\x19\x21\x00\x00\x21\x21\x00\x00\x2c\x21\x00\x00\x37\x21\x00\x00\x40\x21\x00\x00\x4b\x21\x00\x00\x52\x21"
+            "\x00\x00\x5a\x21\x00\x00\x64\x21\x00\x00\x6b\x21\x00\x00\x75\x21\x00\x00\x80\x21\x00\x00\x89\x21\x00\x00\x92\x21\x00\x00\x9d\x21"
+            "\x00\x00\xa7\x21\x00\x00\xaf\x21\x00\x00\xba\x21\x00\x00\xc5\x21\x00\x00\xcf\x21\x00\x00\xd6\x21\x00\x00\xde\x21\x00\x00\xe9\x21"
+            "\x00\x00\xf1\x21\x00\x00\xf8\x21\x00\x00\x01\x22\x00\x00\x0b\x22\x00\x00\x14\x22\x00\x00\x1b\x22\x00\x00\x24\x22\x00\x00\x2d\x22"
+            "\x00\x00\x34\x22\x00\x00\x3e\x22\x00\x00\x45\x22\x00\x00\x4c\x22\x00\x00\x55\x22\x00\x00\x5e\x22\x00\x00\x66\x22\x00\x00\x72\x22"
+            "\x00\x00\x7b\x22\x00\x00\x80\x22\x00\x00\x87\x22\x00\x00\x90\x22\x00\x00\x96\x22\x00\x00\x9f\x22\x00\x00\xa8\x22\x00\x00\xb0\x22"
+            "\x00\x00\xb8\x22\x00\x00\xc0\x22\x00\x00\xca\x22\x00\x00\xd0\x22\x00\x00\xd7\x22\x00\x00\xe0\x22\x00\x00\xe9\x22\x00\x00\xf0\x22"
+            "\x00\x00\xf8\x22\x00\x00\x02\x23\x00\x00\x0a\x23\x00\x00\x12\x23\x00\x00\x1b\x23\x00\x00\x24\x23\x00\x00\x2c\x23\x00\x00\x35\x23"
+            "\x00\x00\x3f\x23\x00\x00\x45\x23\x00\x00\x4e\x23\x00\x00\x58\x23\x00\x00\x60\x23\x00\x00\x6a\x23\x00\x00\x70\x23\x00\x00\x7b\x23"
+            "\x00\x00\x87\x23\x00\x00\x91\x23\x00\x00\x99\x23\x00\x00\xa4\x23\x00\x00\xac\x23\x00\x00\xb7\x23\x00\x00\xbe\x23\x00\x00\xc6\x23"
+            "\x00\x00\xd0\x23\x00\x00\xd7\x23\x00\x00\xde\x23\x00\x00\xe6\x23\x00\x00\xef\x23\x00\x00\xfa\x23\x00\x00\x02\x24\x00\x00\x0b\x24"
+            "\x00\x00\x15\x24\x00\x00\x1f\x24\x00\x00\x27\x24\x00\x00\x2e\x24\x00\x00\x36\x24\x00\x00\x40\x24\x00\x00\x49\x24\x00\x00\x51\x24"
+            "\x00\x00\x5a\x24\x00\x00\x63\x24\x00\x00\x6a\x24\x00\x00\x74\x24\x00\x00\x7b\x24\x00\x00\x84\x24\x00\x00\x8a\x24\x00\x00\x92\x24"
+            "\x00\x00\x9a\x24\x00\x00\xa2\x24\x00\x00\xaa\x24\x00\x00\xb2\x24\x00\x00\xb8\x24\x00\x00\xc2\x24\x00\x00\xc7\x24\x00\x00\xd2\x24"
+            "\x00\x00\xdb\x24\x00\x00\xe3\x24\x00\x00\xed\x24\x00\x00\xf4\x24\x00\x00\xfc\x24\x00\x00\x05\x25\x00\x00\x0f\x25\x00\x00\x17\x25"
+            "\x00\x00\x20\x25\x00\x00\x28\x25\x00\x00\x32\x25\x00\x00\x3f\x25\x00\x00\x46\x25\x00\x00\x4c\x25\x00\x00\x55\x25\x00\x00\x5d\x25"
+            "\x00\x00\x65\x25\x00\x00\x6f\x25\x00\x00\x76\x25\x00\x00\x7f\x25\x00\x00\x87\x25\x00\x00\x91\x25\x00\x00\x9a\x25\x00\x00\xa4\x25"
+            "\x00\x00\xb0\x25\x00\x00\xb8\x25\x00\x00\xc1\x25\x00\x00\xc8\x25\x00\x00\xd2\x25\x00\x00\xda\x25\x00\x00\xe3\x25\x00\x00\xec\x25"
+            "\x00\x00\xf5\x25\x00\x00\xfc\x25\x00\x00\x03\x26\x00\x00\x0b\x26\x00\x00\x14\x26\x00\x00\x1d\x26\x00\x00\x26\x26\x00\x00\x2d\x26"
+            "\x00\x00\x35\x26\x00\x00\x41\x26\x00\x00\x4c\x26\x00\x00\x56\x26\x00\x00\x5e\x26\x00\x00\x67\x26\x00\x00\x71\x26\x00\x00\x76\x26"
+            "\x00\x00\x7f\x26\x00\x00\x88\x26\x00\x00\x8f\x26\x00\x00\x97\x26\x00\x00\xa2\x26\x00\x00\xad\x26\x00\x00\xb5\x26\x00\x00\xbe\x26"
+            "\x00\x00\xc7\x26\x00\x00\xce\x26\x00\x00\xd6\x26\x00\x00\xde\x26\x00\x00\xe8\x26\x00\x00\xf2\x26\x00\x00\xfc\x26\x00\x00\x06\x27"
+            "\x00\x00\x10\x27\x00\x00\x17\x27\x00\x00\x20\x27\x00\x00\x29\x27\x00\x00\x30\x27\x00\x00\x36\x27\x00\x00\x3f\x27\x00\x00\x49\x27"
+            "\x00\x00\x53\x27\x00\x00\x5b\x27\x00\x00\x64\x27\x00\x00\x70\x27\x00\x00\x79\x27\x00\x00\x82\x27\x00\x00\x8c\x27\x00\x00\x94\x27"
+            "\x00\x00\x9b\x27\x00\x00\xa4\x27\x00\x00\xae\x27\x00\x00\xb6\x27\x00\x00\x42\x69\x73\x61\x73\x61\x6d\x08\x00\x51\x6b\x6e\x6f\x73"
+            "\x70\x0a\x00\xd0\x66\x6c\x6f\x72\x00\x47\x6c\x75\x6d\x61\x6e\x64\x61\x09\x00\x40\x74\x65\x78\x6f\x08\x00\xb1\x72\x61\x6b\x00\x53"
+            "\x63\x68\x69\x67\x67\x79\x08\x00\xf1\x2d\x6c\x6c\x6f\x6b\x00\x54\x75\x72\x74\x6f\x6b\x00\x52\x61\x75\x70\x79\x00\x53\x61\x66\x63"
+            "\x6f\x6e\x00\x53\x6d\x65\x74\x74\x62\x6f\x00\x48\x6f\x72\x6e\x6c\x69\x75\x00\x4b\x6f\x6b\x75\x6e\x61\x00\x42\x69\x62\x6f\x72\x00"
+            "\x54\x61\x75\x62\x73\x69\x07\x00\x32\x6f\x67\x61\x08\x00\xc1\x73\x73\x00\x52\x61\x74\x74\x66\x72\x61\x74\x7a\x0a\x00\xf2\x00\x69"
+            "\x6b\x61\x72\x6c\x00\x48\x61\x62\x69\x74\x61\x6b\x00\x49\x07\x00\xf0\x09\x52\x65\x74\x74\x61\x6e\x00\x41\x72\x62\x6f\x6b\x00\x50"
+            "\x69\x6b\x61\x63\x68\x75\x00\x52\x61\x69\x07\x00\x10\x53\xad\x00\x12\x6e\x07\x00\xe2\x6d\x65\x72\x00\x4e\x69\x64\x6f\x72\x61\x6e"
+            "\xe2\x99\x80\x0b\x00\x31\x69\x6e\x61\x09\x00\x56\x71\x75\x65\x65\x6e\x1e\x00\x14\x82\x1e\x00\x11\x6f\x09\x00\xf0\x07\x6b\x69\x6e"
+            "\x67\x00\x50\x69\x65\x70\x69\x00\x50\x69\x78\x69\x00\x56\x75\x6c\x70\x69\x78\x07\x00\xf2\x05\x6e\x6f\x6e\x61\x00\x50\x75\x6d\x6d"
+            "\x65\x6c\x75\x66\x66\x00\x4b\x6e\x75\x64\x64\x0b\x00\x90\x5a\x75\x62\x61\x74\x00\x47\x6f\x6c\x07\x00\xa2\x4d\x79\x72\x61\x70\x6c"
+            "\x61\x00\x44\x75\x46\x01\x11\x69\x07\x00\x52\x50\x61\x72\x61\x73\x06\x00\xf1\x05\x65\x6b\x00\x42\x6c\x75\x7a\x75\x6b\x00\x4f\x6d"
+            "\x6f\x74\x00\x44\x69\x67\x64\x61\x06\x00\xf1\x0a\x72\x69\x00\x4d\x61\x75\x7a\x69\x00\x53\x6e\x6f\x62\x69\x6c\x69\x6b\x61\x74\x00"
+            "\x45\x6e\x74\x6f\x6e\x06\x00\xf1\x17\x72\x6f\x6e\x00\x4d\x65\x6e\x6b\x69\x00\x52\x61\x73\x61\x66\x66\x00\x46\x75\x6b\x61\x6e\x6f"
+            "\x00\x41\x72\x6b\x61\x6e\x69\x00\x51\x75\x61\x70\x73\x65\x6c\x08\x00\x32\x75\x74\x7a\x11\x00\xc0\x70\x6f\x00\x41\x62\x72\x61\x00"
+            "\x4b\x61\x64\x61\x08\x00\xf2\x0a\x53\x69\x6d\x73\x61\x6c\x61\x00\x4d\x61\x63\x68\x6f\x6c\x6c\x6f\x00\x4d\x61\x73\x63\x68\x6f\x63"
+            "\x6b\x12\x00\xf2\x19\x6d\x65\x69\x00\x4b\x6e\x6f\x66\x65\x6e\x73\x61\x00\x55\x6c\x74\x72\x69\x67\x61\x72\x69\x61\x00\x53\x61\x72"
+            "\x7a\x65\x6e\x69\x61\x00\x54\x65\x6e\x74\x61\x63\x68\x09\x00\xf0\x06\x6f\x78\x61\x00\x4b\x6c\x65\x69\x6e\x73\x74\x65\x69\x6e\x00"
+            "\x47\x65\x6f\x72\x6f\x6b\x07\x00\xf1\x1a\x77\x61\x7a\x00\x50\x6f\x6e\x69\x74\x61\x00\x47\x61\x6c\x6c\x6f\x70\x61\x00\x46\x6c\x65"
+            "\x67\x6d\x6f\x6e\x00\x4c\x61\x68\x6d\x75\x73\x00\x4d\x61\x67\x6e\x65\x74\x69\x81\x00\x00\x0a\x00\x60\x6f\x6e\x00\x50\x6f\x72\x5d"
+            "\x00\x50\x00\x44\x6f\x64\x75\x05\x00\xf2\x07\x72\x69\x00\x4a\x75\x72\x6f\x62\x00\x4a\x75\x67\x6f\x6e\x67\x00\x53\x6c\x65\x69\x6d"
+            "\x61\x07\x00\xf1\x0e\x6f\x6b\x00\x4d\x75\x73\x63\x68\x61\x73\x00\x41\x75\x73\x74\x6f\x73\x00\x4e\x65\x62\x75\x6c\x61\x6b\x00\x41"
+            "\x6c\x70\xd8\x00\xf1\x29\x47\x65\x6e\x67\x61\x72\x00\x4f\x6e\x69\x78\x00\x54\x72\x61\x75\x6d\x61\x74\x6f\x00\x48\x79\x70\x6e\x6f"
+            "\x00\x4b\x72\x61\x62\x62\x79\x00\x4b\x69\x6e\x67\x6c\x65\x72\x00\x56\x6f\x6c\x74\x6f\x62\x61\x6c\x00\x4c\x65\x6b\x74\x72\x0a\x00"
+            "\x20\x4f\x77\x08\x01\x30\x6f\x6b\x6f\x08\x00\x80\x54\x72\x61\x67\x6f\x73\x73\x6f\x19\x01\xf0\x03\x67\x67\x61\x00\x4b\x69\x63\x6b"
+            "\x6c\x65\x65\x00\x4e\x6f\x63\x6b\x63\x68\x70\x02\xb1\x63\x68\x6c\x75\x72\x70\x00\x53\x6d\x6f\x67\xf9\x02\xf0\x0d\x6f\x67\x6d\x6f"
+            "\x67\x00\x52\x69\x68\x6f\x72\x6e\x00\x52\x69\x7a\x65\x72\x6f\x73\x00\x43\x68\x61\x6e\x65\x69\x72\xed\x02\x40\x6e\x67\x65\x6c\x93"
+            "\x01\x30\x6e\x67\x61\xd1\x00\x50\x65\x65\x70\x65\x72\x07\x00\x00\x20\x01\x70\x47\x6f\x6c\x64\x69\x6e\x69\x08\x00\x01\x89\x02\xf0"
+            "\x0e\x53\x74\x65\x72\x6e\x64\x75\x00\x53\x74\x61\x72\x6d\x69\x65\x00\x50\x61\x6e\x74\x69\x6d\x6f\x73\x00\x53\x69\x63\x68\x58\x02"
+            "\xe0\x52\x6f\x73\x73\x61\x6e\x61\x00\x45\x6c\x65\x6b\x74\x65\xc8\x01\xa1\x67\x6d\x61\x72\x00\x50\x69\x6e\x73\x69\x69\x03\x00\x7d"
+            "\x00\x60\x4b\x61\x72\x70\x61\x64\x8d\x02\xa0\x61\x72\x61\x64\x6f\x73\x00\x4c\x61\x70\x8f\x02\xf0\x00\x44\x69\x74\x74\x6f\x00\x45"
+            "\x76\x6f\x6c\x69\x00\x41\x71\x75\x48\x00\x50\x42\x6c\x69\x74\x7a\xb0\x01\x50\x61\x6d\x61\x72\x61\x96\x01\x10\x79\xd6\x00\x21\x41"
+            "\x6d\xd0\x01\x10\x73\x09\x00\x20\x72\x6f\x0e\x01\x44\x61\x62\x75\x74\x07\x00\xf1\x04\x70\x73\x00\x41\x65\x72\x6f\x64\x61\x63\x74"
+            "\x79\x6c\x00\x52\x65\x6c\x61\x78\x98\x02\x00\x9a\x01\x32\x5a\x61\x70\x72\x00\x11\x76\x7a\x00\x40\x44\x72\x61\x74\xe1\x00\x10\x44"
+            "\x57\x01\x32\x6e\x69\x72\x09\x00\x20\x72\x61\xdc\x02\x30\x77\x74\x75\x06\x00\xf0\x15\x00\x45\x6e\x64\x69\x76\x69\x65\x00\x4c\x6f"
+            "\x72\x62\x6c\x61\x74\x74\x00\x4d\x65\x67\x61\x6e\x69\x65\x00\x46\x65\x75\x72\x69\x67\x65\x6c\x00\x49\x43\x01\xa1\x76\x61\x72\x00"
+            "\x54\x6f\x72\x6e\x75\x70\x89\x00\x40\x72\x6e\x69\x6d\x09\x03\xf3\x09\x54\x79\x72\x61\x63\x72\x6f\x63\x00\x49\x6d\x70\x65\x72\x67"
+            "\x61\x74\x6f\x72\x00\x57\x69\x65\x73\x07\x00\xe0\x65\x6e\x69\x6f\x72\x00\x48\x6f\x6f\x74\x68\x6f\x6f\x74\xc7\x01\xa0\x74\x75\x68"
+            "\x00\x4c\x65\x64\x79\x62\x61\x07\x00\x80\x69\x61\x6e\x00\x57\x65\x62\x61\xea\x04\x31\x41\x72\x69\xb5\x00\x30\x49\x6b\x73\xda\x03"
+            "\xf1\x00\x4c\x61\x6d\x70\x69\x00\x4c\x61\x6e\x74\x75\x72\x6e\x00\x50\x75\x04\x50\x50\x69\x69\x00\x46\x05\x04\x02\x0a\x04\x30\x54"
+            "\x6f\x67\x3a\x04\x00\x07\x00\xa0\x74\x69\x63\x00\x4e\x61\x74\x75\x00\x58\x05\x00\x00\x67\x02\xf0\x02\x69\x6c\x61\x6d\x6d\x00\x57"
+            "\x61\x61\x74\x79\x00\x41\x6d\x70\x68\x61\x9c\x01\x61\x42\x6c\x75\x62\x65\x6c\x94\x03\x92\x72\x69\x6c\x6c\x00\x41\x7a\x75\x6d\x0a"
+            "\x00\x90\x4d\x6f\x67\x65\x6c\x62\x61\x75\x6d\xcb\x03\x10\x78\x4b\x05\x50\x70\x70\x73\x70\x72\x2a\x05\x10\x48\x34\x00\xf0\x01\x75"
+            "\x70\x66\x00\x50\x61\x70\x75\x6e\x67\x68\x61\x00\x47\x72\x69\x84\x00\x91\x00\x53\x6f\x6e\x6e\x6b\x65\x72\x6e\x09\x00\x00\x7a\x04"
+            "\xb0\x61\x00\x59\x61\x6e\x6d\x61\x00\x46\x65\x6c\xe3\x04\xb0\x4d\x6f\x72\x6c\x6f\x72\x64\x00\x50\x73\x69\xef\x01\x50\x4e\x61\x63"
+            "\x68\x74\xe9\x01\x91\x4b\x72\x61\x6d\x75\x72\x78\x00\x4c\x11\x04\x01\x7c\x02\x00\x38\x03\xf0\x14\x6e\x66\x75\x67\x69\x6c\x00\x49"
+            "\x63\x6f\x67\x6e\x69\x74\x6f\x00\x57\x6f\x69\x6e\x67\x65\x6e\x61\x75\x00\x47\x69\x72\x61\x66\x61\x72\x69\x67\xd2\x02\x10\x6e\x33"
+            "\x02\x80\x6f\x72\x73\x74\x65\x6c\x6c\x6b\xfb\x04\x30\x6d\x6d\x69\x8d\x04\x70\x53\x6b\x6f\x72\x67\x6c\x61\xbf\x02\x20\x68\x6c\xb6"
+            "\x02\xc1\x6e\x75\x62\x62\x75\x6c\x6c\x00\x47\x72\x61\x6e\x09\x00\xa0\x42\x61\x6c\x64\x6f\x72\x66\x69\x73\x68\x49\x03\xf0\x05\x65"
+            "\x72\x6f\x78\x00\x50\x6f\x74\x74\x72\x6f\x74\x74\x00\x53\x6b\x61\x72\x61\x62\x46\x03\xf0\x00\x53\x6e\x69\x65\x62\x65\x6c\x00\x54"
+            "\x65\x64\x64\x69\x75\x72\x9e\x04\x41\x72\x73\x61\x72\x22\x03\x90\x63\x68\x6e\x65\x63\x6b\x6d\x61\x67\xfc\x02\xf0\x02\x63\x61\x72"
+            "\x67\x6f\x00\x51\x75\x69\x65\x6b\x65\x6c\x00\x4b\x65\x69\x14\x01\xf0\x10\x43\x6f\x72\x61\x73\x6f\x6e\x6e\x00\x52\x65\x6d\x6f\x72"
+            "\x61\x69\x64\x00\x4f\x63\x74\x69\x6c\x6c\x65\x72\x79\x00\x42\x6f\x74\x67\x01\x70\x00\x4d\x61\x6e\x74\x61\x78\x60\x03\x30\x7a\x61"
+            "\x65\x6b\x05\x91\x48\x75\x6e\x64\x75\x73\x74\x65\x72\x0a\x00\x01\x9d\x03\x62\x53\x65\x65\x64\x72\x61\x21\x06\xa0\x68\x61\x6e\x70"
+            "\x79\x00\x44\x6f\x6e\x70\x04\x04\x03\x27\x03\xf0\x14\x32\x00\x44\x61\x6d\x68\x69\x72\x70\x6c\x65\x78\x00\x46\x61\x72\x62\x65\x61"
+            "\x67\x6c\x65\x00\x52\x61\x62\x61\x75\x7a\x00\x4b\x61\x70\x6f\x65\x6b\x01\x40\x75\x73\x73\x69\xf2\x01\x00\xb4\x03\x20\x69\x64\xb7"
+            "\x00\xf1\x00\x62\x79\x00\x4d\x69\x6c\x74\x61\x6e\x6b\x00\x48\x65\x69\x74\x29\x04\x60\x52\x61\x69\x6b\x6f\x75\xfb\x05\xf0\x02\x65"
+            "\x69\x00\x53\x75\x69\x63\x75\x6e\x65\x00\x4c\x61\x72\x76\x69\x74\xe1\x03\x21\x75\x70\x08\x00\x50\x44\x65\x73\x70\x6f\x09\x00\xf0"
+            "\x0a\x4c\x75\x67\x69\x61\x00\x48\x6f\x2d\x4f\x68\x00\x43\x65\x6c\x65\x62\x69\x00\x47\x65\x63\x6b\x61\x72\x71\x07\x51\x52\x65\x70"
+            "\x74\x61\xa4\x05\x60\x77\x61\x6c\x64\x72\x6f\x90\x05\x30\x6d\x6d\x6c\x63\x05\xb0\x6e\x67\x67\x6c\x75\x74\x00\x4c\x6f\x68\x67\x08"
+            "\x06\xb0\x48\x79\x64\x72\x6f\x70\x69\x00\x4d\x6f\x6f\x28\x05\x00\xc4\x01\x30\x75\x6d\x70\xcf\x00\x61\x69\x66\x66\x79\x65\x6e\xb1"
+            "\x05\x10\x61\x09\x00\xf0\x05\x5a\x69\x67\x7a\x61\x63\x68\x73\x00\x47\x65\x72\x61\x64\x61\x6b\x73\x00\x57\x61\x2b\x00\x10\x6c\x93"
+            "\x01\x50\x61\x6c\x6f\x6b\x6f\x9e\x02\x21\x69\x6e\xdd\x02\x50\x50\x61\x6e\x65\x6b\xe6\x05\xf0\x06\x75\x64\x6f\x78\x00\x4c\x6f\x74"
+            "\x75\x72\x7a\x65\x6c\x00\x4c\x6f\x6d\x62\x72\x65\x72\xbf\x03\xa0\x70\x70\x61\x6c\x6f\x72\x65\x73\x00\x53\x89\x02\x00\x1d\x00\x60"
+            "\x42\x6c\x61\x6e\x61\x73\x6b\x06\x60\x67\x75\x6c\x69\x73\x74\x58\x00\x40\x77\x61\x6c\x62\x3f\x04\x03\x0b\x00\x00\x0c\x03\x20\x57"
+            "\x69\x20\x00\x70\x6c\x00\x50\x65\x6c\x69\x70\x4b\x05\x40\x54\x72\x61\x73\x61\x05\xf0\x0b\x69\x72\x6c\x69\x61\x00\x47\x75\x61\x72"
+            "\x64\x65\x76\x6f\x69\x72\x00\x47\x65\x68\x77\x65\x69\x68\x65\x72\xf7\x06\xc1\x6b\x65\x72\x65\x67\x65\x6e\x00\x4b\x6e\x69\x6c\x9c"
+            "\x01\x00\x07\x00\x11\x42\xde\x07\xf1\x00\x7a\x00\x4d\x75\x6e\x74\x69\x65\x72\x00\x4c\x65\x74\x61\x72\xf1\x01\x60\x4e\x69\x6e\x63"
+            "\x61\x64\x41\x08\x52\x6e\x6a\x61\x73\x6b\x08\x00\x30\x74\x6f\x6d\xfd\x03\x20\x72\x6d\x6c\x02\x61\x72\x61\x6b\x65\x65\x6c\x60\x06"
+            "\x40\x77\x75\x6d\x6d\xe5\x06\x30\x6b\x75\x68\x05\x07\x50\x48\x61\x72\x69\x79\xec\x05\x31\x41\x7a\x75\xda\x03\x30\x4e\x61\x73\xf6"
+            "\x06\x60\x00\x45\x6e\x65\x63\x6f\x06\x00\xc0\x6b\x6f\x72\x6f\x00\x5a\x6f\x62\x69\x72\x69\x73\x52\x00\x40\x6e\x6b\x69\x66\x15\x06"
+            "\x51\x74\x6f\x6c\x6c\x75\xb1\x04\x01\x0b\x00\x01\x7e\x09\x00\x09\x00\x00\xf8\x00\x72\x4d\x65\x64\x69\x74\x69\x65\x08\x00\x20\x61"
+            "\x6c\x39\x00\x91\x72\x69\x7a\x65\x6c\x62\x6c\x69\x7a\x6f\x04\xf0\x02\x65\x6e\x73\x6f\x00\x50\x6c\x75\x73\x6c\x65\x00\x4d\x69\x6e"
+            "\x75\x6e\x16\x00\x90\x62\x65\x61\x74\x00\x49\x6c\x6c\x75\xa1\x03\x00\x3e\x06\x10\x65\x25\x01\x01\xc4\x06\x41\x70\x70\x75\x63\xde"
+            "\x09\x70\x6c\x75\x6b\x77\x65\x63\x68\xa3\x06\x40\x69\x76\x61\x6e\xef\x07\xb0\x6f\x68\x61\x69\x64\x6f\x00\x57\x61\x69\x6c\x5b\x09"
+            "\x00\x08\x00\x00\x46\x04\x60\x43\x61\x6d\x61\x75\x62\x07\x00\xa0\x65\x72\x75\x70\x74\x00\x51\x75\x72\x74\x01\x02\x81\x70\x6f\x69"
+            "\x6e\x6b\x00\x47\x72\x07\x00\xf0\x0c\x50\x61\x6e\x64\x69\x72\x00\x4b\x6e\x61\x63\x6b\x6c\x69\x6f\x6e\x00\x56\x69\x62\x72\x61\x76"
+            "\x61\x00\x4c\x69\xfa\x04\x10\x64\x15\x07\x91\x75\x73\x6b\x61\x00\x4e\x6f\x6b\x74\x09\x00\x92\x57\x61\x62\x6c\x75\x00\x41\x6c\x74"
+            "\x7e\x08\xf2\x02\x65\x6e\x67\x6f\x00\x56\x69\x70\x69\x74\x69\x73\x00\x4c\x75\x6e\x61\x71\x08\x01\xe2\x04\x02\x6f\x02\xf1\x08\x6d"
+            "\x65\x72\x62\x65\x00\x57\x65\x6c\x73\x61\x72\x00\x4b\x72\x65\x62\x73\x63\x6f\x72\x70\x73\x0b\x00\x50\x75\x74\x61\x63\x6b\x30\x03"
+            "\xb0\x70\x61\x6e\x63\x65\x00\x4c\x65\x70\x75\x6d\x6a\x08\x80\x73\x00\x4c\x69\x6c\x69\x65\x70\x16\x06\xf0\x00\x6c\x69\x65\x00\x41"
+            "\x6e\x6f\x72\x69\x74\x68\x00\x41\x72\x6d\x94\x04\x50\x00\x42\x61\x72\x73\x66\x02\x00\x9a\x03\x10\x6f\xcd\x05\xc0\x46\x6f\x72\x6d"
+            "\x65\x6f\x00\x4b\x65\x63\x6c\x65\x0e\x04\xf2\x0a\x68\x75\x70\x70\x65\x74\x00\x42\x61\x6e\x65\x74\x74\x65\x00\x5a\x77\x69\x72\x72"
+            "\x6c\x69\x63\x68\x74\x0b\x00\x60\x6b\x6c\x6f\x70\x00\x54\x4d\x03\x10\x75\xf9\x09\x40\x6c\x69\x6d\x70\x05\x00\x80\x00\x41\x62\x73"
+            "\x6f\x6c\x00\x49\x53\x08\x01\xbc\x04\xa0\x70\x70\x6b\x65\x00\x46\x69\x72\x6e\x6f\xe5\x09\x02\x09\x08\x20\x70\x73\x08\x00\x10\x6a"
+            "\xf8\x08\xc0\x57\x61\x6c\x72\x61\x69\x73\x61\x00\x50\x65\x72\x15\x01\x60\x61\x6c\x61\x62\x79\x73\x27\x03\x32\x67\x61\x6e\x0b\x00"
+            "\xf0\x04\x52\x65\x6c\x69\x63\x61\x6e\x74\x68\x00\x4c\x69\x65\x62\x69\x73\x6b\x75\x73\xdf\x08\x50\x64\x77\x75\x72\x6d\x60\x07\x30"
+            "\x73\x63\x68\x4f\x03\x51\x72\x75\x74\x61\x6c\xd1\x0b\x30\x54\x61\x6e\x12\x00\x61\x4d\x65\x74\x61\x6e\x67\x07\x00\x11\x67\x57\x06"
+            "\x50\x52\x65\x67\x69\x72\x06\x04\x00\x09\x00\x21\x63\x65\x07\x00\x30\x73\x74\x65\xa9\x03\x30\x61\x74\x69\x32\x01\x30\x61\x74\x69"
+            "\x50\x08\x50\x79\x6f\x67\x72\x65\xe0\x01\xf0\x0c\x75\x64\x6f\x6e\x00\x52\x61\x79\x71\x75\x61\x7a\x61\x00\x4a\x69\x72\x61\x63\x68"
+            "\x69\x00\x44\x65\x6f\x78\x79\xf4\x08\x51\x65\x6c\x61\x73\x74\x08\x00\x30\x63\x61\x72\x81\x04\x00\x0b\x00\x40\x74\x65\x72\x72\xc2"
+            "\x04\x60\x61\x6e\x66\x6c\x61\x6d\x08\x00\x30\x70\x79\x72\x2d\x04\x50\x6e\x66\x65\x72\x6e\xb3\x02\x40\x69\x6e\x66\x61\x07\x00\x40"
+            "\x70\x72\x69\x6e\xc7\x07\x12\x6f\x71\x01\x00\xa9\x06\x42\x6c\x69\x6c\x69\x0a\x00\x10\x76\x1b\x02\x00\x09\x00\x10\x70\x37\x01\x50"
+            "\x42\x69\x64\x69\x7a\x60\x0c\xa0\x64\x69\x66\x61\x73\x00\x5a\x69\x72\x70\x46\x04\x01\x09\x00\x10\x65\xeb\x02\xd0\x53\x68\x65\x69"
+            "\x6e\x75\x78\x00\x4c\x75\x78\x69\x6f\x06\x00\x10\x74\x8b\x05\x00\xf2\x0c\x11\x69\x07\x03\x40\x72\x61\x64\x65\xf5\x09\x22\x6e\x6f"
+            "\xd3\x00\x30\x6d\x65\x69\x09\x00\x01\xe5\x0c\x94\x74\x65\x72\x75\x73\x00\x42\x6f\x6c\x0a\x00\x41\x75\x72\x6d\x79\x06\x00\x10\x61"
+            "\x6b\x0c\x60\x00\x4d\x6f\x74\x65\x72\xfa\x04\xd0\x57\x61\x64\x72\x69\x62\x69\x65\x00\x48\x6f\x6e\x77\x77\x00\x30\x6c\x00\x50\x12"
+            "\x01\x80\x72\x69\x73\x75\x00\x42\x61\x6d\x84\x07\x41\x00\x42\x6f\x6a\x08\x00\x60\x4b\x69\x6b\x75\x67\x69\xaa\x01\x00\x51\x09\x01"
+            "\x35\x05\x10\x65\xdb\x03\x61\x00\x47\x61\x73\x74\x72\x87\x00\x30\x41\x6d\x62\xd1\x00\x00\xe6\x02\x81\x44\x72\x69\x66\x74\x6c\x6f"
+            "\x6e\x09\x00\xd0\x7a\x65\x70\x65\x6c\x69\x00\x48\x61\x73\x70\x69\x72\x35\x02\x50\x63\x68\x6c\x61\x70\x5a\x0d\x00\xb4\x07\x20\x6d"
+            "\x61\xb4\x07\x00\xd2\x07\x40\x73\x68\x65\x66\x7b\x0a\x20\x72\x6d\xd7\x08\xf0\x02\x53\x68\x6e\x75\x72\x67\x61\x72\x73\x74\x00\x4b"
+            "\x6c\x69\x6e\x67\x70\x8f\x02\x91\x53\x6b\x75\x6e\x6b\x61\x70\x75\x68\x0a\x00\x01\x83\x06\x41\x42\x72\x6f\x6e\x81\x05\x00\x08\x00"
+            "\x00\x84\x02\x53\x4d\x6f\x62\x61\x69\x7c\x0a\x72\x69\x6d\x69\x00\x57\x6f\x6e\xcd\x0a\x70\x50\x6c\x61\x75\x64\x61\x67\x2f\x0b\x80"
+            "\x72\x79\x70\x70\x75\x6b\x00\x4b\x6c\x0b\x30\x6c\x61\x74\xef\x03\x20\x72\x6b\x01\x01\x50\x4b\x6e\x61\x6b\x72\x83\x03\x50\x4d\x61"
+            "\x6d\x70\x66\xc9\x08\xf0\x04\x52\x69\x6f\x6c\x75\x00\x4c\x75\x63\x61\x72\x69\x6f\x00\x48\x69\x70\x70\x6f\xc4\x06\x12\x73\x0b\x00"
+            "\x02\x63\x01\x60\x50\x69\x6f\x6e\x73\x6b\xbf\x08\x00\x0a\x00\xc0\x64\x72\x61\x67\x69\x00\x47\x6c\x69\x62\x75\x6e\xd9\x07\xf0\x02"
+            "\x54\x6f\x78\x69\x71\x75\x61\x6b\x00\x56\x65\x6e\x75\x66\x6c\x69\x62\xfe\x04\x30\x69\x6e\x6e\x27\x02\x41\x4c\x75\x6d\x69\x09\x00"
+            "\x00\xd3\x07\x10\x69\x06\x04\x81\x53\x68\x6e\x65\x62\x65\x64\x65\xd9\x02\x40\x78\x62\x6c\x69\x26\x04\x20\x53\x6e\x4d\x00\x10\x6e"
+            "\x78\x09\x74\x67\x6e\x65\x7a\x6f\x6e\x65\xca\x0b\x33\x6c\x65\x6b\xbe\x0b\x00\x79\x05\x00\xb0\x0b\x11\x6f\x71\x05\x40\x45\x6c\x65"
+            "\x76\x57\x05\x01\x65\x0b\x51\x62\x72\x61\x6e\x74\xe8\x09\x41\x6b\x69\x73\x73\x64\x09\x20\x65\x67\x05\x09\x60\x6c\x69\x70\x75\x72"
+            "\x62\x35\x0f\x40\x61\x7a\x69\x6f\xfc\x08\x00\x04\x09\x10\x72\xea\x0c\x20\x6d\x75\x1d\x05\x03\x2c\x08\x20\x2d\x5a\x1d\x0d\x60\x61"
+            "\x67\x6c\x61\x64\x69\x99\x05\x00\xb6\x00\x00\xb9\x02\x00\x3b\x04\x10\x66\x54\x0d\x90\x00\x46\x72\x6f\x73\x64\x65\x64\x6a\xa7\x05"
+            "\x00\x6a\x06\xc0\x53\x65\x6c\x66\x65\x00\x56\x65\x73\x70\x72\x69\x7b\x00\xa0\x62\x75\x74\x7a\x00\x44\x69\x61\x6c\x67\x60\x07\x20"
+            "\x6c\x6b\xff\x07\x30\x65\x61\x74\x4c\x0b\x00\xb9\x03\x51\x67\x69\x67\x61\x73\xa7\x09\x10\x74\xfa\x0e\x42\x43\x72\x65\x73\xed\x05"
+            "\x30\x50\x68\x69\xee\x00\xf0\x07\x4d\x61\x6e\x61\x70\x68\x79\x00\x44\x61\x72\x6b\x72\x61\x69\x00\x53\x68\x61\x79\x6d\x69\x5c\x0f"
+            "\x81\x63\x65\x75\x73\x00\x56\x69\x63\xa9\x0b\xb0\x53\x65\x72\x70\x69\x66\x65\x75\x00\x45\x66\x26\x03\x12\x70\x11\x00\x81\x72\x6f"
+            "\x79\x61\x6c\x00\x46\x6c\xe1\x05\x50\x46\x65\x72\x6b\x6f\x97\x01\x00\x36\x0c\xa0\x62\x69\x72\x65\x78\x00\x4f\x74\x74\x61\xd3\x06"
+            "\x11\x77\xcc\x09\x10\x6e\x57\x00\x30\x64\x6d\x75\x67\x00\xf0\x09\x4e\x61\x67\x65\x6c\x6f\x74\x7a\x00\x4b\x75\x6b\x6d\x61\x72\x64"
+            "\x61\x00\x59\x6f\x72\x6b\x6c\x65\x3d\x0b\x80\x65\x72\x72\x69\x62\x61\x72\x6b\x84\x10\x11\x73\x09\x00\x00\xb6\x0a\x30\x6c\x6f\x75"
+            "\x68\x0e\x21\x6f\x70\x2e\x00\x51\x56\x65\x67\x69\x6d\xfa\x01\x31\x67\x69\x63\x5f\x07\x10\x47\x54\x07\x00\x13\x00\x01\x09\x00\x02"
+            "\x14\x00\x40\x53\x6f\x64\x61\x13\x00\x00\x08\x00\x04\x12\x00\x52\x6d\x6e\x69\x61\x6d\x08\x00\x10\x76\x59\x02\x20\x44\x75\x11\x01"
+            "\x70\x67\x75\x72\x72\x00\x4e\x61\x56\x09\xb0\x75\x62\x00\x46\x61\x73\x61\x73\x6e\x6f\x62\xed\x01\xa0\x7a\x65\x62\x61\x00\x5a\x65"
+            "\x62\x72\x69\xae\x00\x30\x69\x65\x73\x34\x03\x40\x00\x53\x65\x64\x68\x0c\x30\x74\x75\x72\x20\x03\x22\x63\x6b\x1c\x02\x70\x46\x6c"
+            "\x65\x6b\x6e\x6f\x69\x03\x01\x62\x65\x74\x69\x61\x6d\x6f\xb4\x01\x30\x75\x72\x66\xa4\x04\x20\x6c\x6f\x85\x09\xf0\x02\x4f\x68\x72"
+            "\x64\x6f\x63\x68\x00\x50\x72\x61\x6b\x74\x69\x62\x61\x6c\xcd\x07\x30\x72\x65\x70\x7e\x0d\x40\x4d\x65\x69\x73\x86\x05\x22\x69\x66"
+            "\x09\x04\x80\x6c\x71\x75\x61\x70\x00\x4d\x65\x67\x02\x30\x61\x00\x42\x06\x00\xb2\x77\x61\x72\x7a\x00\x4a\x69\x75\x74\x65\x73\xf0"
+            "\x0c\x60\x61\x64\x6f\x6e\x69\x73\x44\x00\x20\x61\x77\x95\x0e\x01\x7d\x02\x00\x65\x09\x72\x4d\x61\x74\x72\x69\x66\x6f\x27\x03\x50"
+            "\x70\x65\x64\x00\x52\x47\x08\x80\x6d\x00\x43\x65\x72\x61\x70\x65\x4d\x03\x01\xab\x09\xa0\x62\x6f\x6c\x6c\x00\x45\x6c\x66\x75\x6e"
+            "\x0a\x07\x72\x6d\x69\x6e\x69\x70\x00\x44\x26\x02\x23\x6c\x61\xff\x06\xf0\x02\x75\x66\x74\x00\x47\x61\x6e\x6f\x76\x69\x6c\x00\x52"
+            "\x6f\x6b\x6b\x61\xfc\x00\x00\xd1\x0a\x12\x69\x59\x0d\x00\xf2\x01\x10\x70\xd4\x07\x02\x09\x00\x10\x76\x67\x04\x70\x4d\x61\x72\x61"
+            "\x63\x61\x6d\x4f\x0d\x50\x69\x74\x68\x6f\x6d\x55\x07\x10\x43\xb4\x07\x20\x6c\x6c\x0b\x00\xa2\x5a\x75\x72\x72\x6f\x6b\x65\x78\x00"
+            "\x49\x07\x00\x60\x53\x79\x6d\x76\x6f\x6c\x84\x0c\xe0\x4d\x61\x6b\x61\x62\x61\x6a\x61\x00\x45\x63\x68\x6e\x61\xe8\x08\x01\x23\x03"
+            "\x10\x70\x8f\x12\x01\xc5\x0e\x40\x69\x70\x70\x61\x6c\x01\x71\x61\x70\x74\x65\x72\x79\x78\x75\x0e\x03\x0b\x00\xe0\x55\x6e\x72\x61"
+            "\x74\xc3\xbc\x74\x6f\x78\x00\x44\x65\x70\xad\x0e\x80\x6f\x78\x00\x5a\x6f\x72\x75\x61\x06\x00\x10\x6f\x4c\x02\x41\x50\x69\x63\x6f"
+            "\xb3\x12\x31\x61\x00\x43\x07\x00\x00\x7e\x08\x80\x00\x4d\x6f\x6c\x6c\x69\x6d\x6f\xb3\x03\x01\x20\x10\x02\x0b\x00\x60\x4d\x6f\x72"
+            "\x62\x69\x74\x0c\x01\xe0\x00\x4d\x6f\x6e\x6f\x7a\x79\x74\x6f\x00\x4d\x69\x74\x6f\x0e\x0e\x41\x5a\x79\x74\x6f\xed\x03\xf0\x04\x50"
+            "\x69\x63\x63\x6f\x6c\x65\x6e\x74\x65\x00\x53\x77\x61\x72\x6f\x6e\x65\x73\x0e\x0b\x12\x6c\xe2\x0e\x01\x09\x00\x20\x72\x6f\x84\x11"
+            "\x01\x0b\x00\x10\x77\x7f\x0d\x51\x53\x65\x73\x6f\x6b\x50\x02\xd0\x72\x6f\x6e\x6a\x75\x77\x69\x6c\x64\x00\x45\x6d\x6f\xc3\x03\xb0"
+            "\x4c\x61\x75\x6b\x61\x70\x73\x00\x43\x61\x76\xa7\x07\x10\x7a\xfb\x0a\x71\x61\x72\x6e\x70\x69\x67\x6e\x8f\x0c\x60\x74\x73\x61\x73"
+            "\x73\x61\x0c\x0e\x01\x97\x0b\xa0\x41\x70\x6f\x71\x75\x61\x6c\x6c\x79\x70\x5a\x04\x40\x6f\x6c\x69\x64\xd6\x01\x61\x74\x74\x7a\x61"
+            "\x70\x66\xff\x09\x11\x75\x65\x10\x62\x73\x74\x61\x64\x75\x72\xb9\x11\x10\x6e\x7f\x04\x51\x4b\x6c\x69\x6b\x6b\x06\x00\x00\x30\x11"
+            "\x00\x08\x00\x12\x64\x0b\x00\xa3\x5a\x61\x70\x70\x6c\x61\x72\x64\x69\x6e\x0b\x00\x00\x08\x05\x03\x15\x00\x00\x27\x08\x60\x50\x79"
+            "\x67\x72\x61\x75\x82\x06\x00\x8f\x0f\x00\x08\x00\x10\x4c\xed\x08\x02\x1d\x08\xc1\x65\x72\x6e\x65\x63\x74\x6f\x00\x53\x6b\x65\x6c"
+            "\x6a\x12\x50\x4d\x69\x6c\x7a\x61\x54\x04\x80\x72\x66\x61\x78\x00\x4d\x61\x78\x5d\x0d\xc0\x65\x74\x7a\x6e\x69\x65\x66\x00\x53\x69"
+            "\x62\x65\xfb\x05\x91\x46\x72\x69\x67\x6f\x6d\x65\x74\x72\xd1\x0b\x71\x6e\x75\x74\x68\x65\x6c\x6d\x83\x0c\x01\xc2\x06\x00\x09\x0b"
+            "\xd0\x73\x63\x68\x6c\x69\x6b\x00\x4c\x69\x6e\x2d\x46\x75\xab\x09\x20\x2d\x53\xeb\x13\x30\x68\x61\x72\x25\x00\x11\x6f\x75\x13\x11"
+            "\x69\x7c\x13\x10\x67\xe0\x00\x10\x73\x78\x05\x00\xc4\x0f\x00\x54\x00\x50\x43\x61\x65\x73\x75\x68\x00\x50\x42\x69\x73\x6f\x66\xda"
+            "\x06\x10\x47\xdb\x0d\x20\x69\x6d\x63\x14\x80\x57\x61\x73\x68\x61\x6b\x77\x69\xa5\x0e\x00\x47\x01\x00\x3f\x04\x60\x79\x70\x68\x65"
+            "\x6c\x64\x4c\x06\x90\x75\x72\x6e\x69\x66\x72\x61\xc3\x9f\xdd\x04\x32\x6d\x69\x63\x4d\x01\x90\x70\x75\x6e\x6f\x00\x44\x75\x6f\x64"
+            "\xcb\x01\x60\x54\x72\x69\x6b\x65\x70\xea\x0c\x31\x00\x49\x67\x53\x04\x00\x36\x08\x50\x6f\x74\x68\x00\x4b\x46\x12\x31\x69\x75\x6d"
+            "\xd1\x04\x20\x61\x6b\x0a\x00\x50\x56\x69\x72\x69\x64\x09\x00\x62\x42\x6f\x72\x65\x6f\x73\x76\x12\x00\xd6\x02\xf1\x06\x52\x65\x73"
+            "\x68\x69\x72\x61\x6d\x00\x5a\x65\x6b\x72\x6f\x6d\x00\x44\x65\x6d\x65\x74\x32\x12\xf0\x03\x4b\x79\x75\x72\x65\x6d\x00\x4b\x65\x6c"
+            "\x64\x65\x6f\x00\x4d\x65\x6c\x6f\xfc\x14\x00\xda\x12\x70\x65\x73\x65\x63\x74\x00\x49\x3f\x12\x10\x72\x7d\x00\x00\xe5\x01\x20\x72"
+            "\x6e\x43\x0f\x11\x42\xb2\x13\x00\x8f\x03\x90\x79\x6e\x78\x00\x52\x75\x74\x65\x6e\xfa\x0f\x41\x6e\x6e\x65\x78\x20\x0c\x22\x6f\x78"
+            "\x7a\x10\x00\x28\x0c\x00\x4a\x02\xa0\x6a\x75\x74\x73\x75\x00\x53\x63\x6f\x70\xbe\x08\x40\x47\x72\x65\x62\x4d\x01\x72\x44\x61\x72"
+            "\x74\x69\x72\x69\x08\x00\x10\x67\x64\x04\x20\x46\x69\x6a\x00\x12\x50\xea\x0c\x70\x50\x75\x70\x6f\x6e\x63\x68\x93\x0b\x10\x76\x01"
+            "\x16\xc0\x6e\x00\x4c\x65\x75\x66\x65\x6f\x00\x50\x79\x72\xaa\x09\x00\xa1\x03\x60\x62\xc3\xa9\x62\xc3\xa9\x21\x06\x01\x1c\x0b\xd0"
+            "\x46\x6c\x6f\x72\x67\x65\x73\x00\x4d\xc3\xa4\x68\x69\x2a\x06\x70\x43\x68\x65\x76\x72\x75\x6d\xfe\x09\x32\x6d\x2d\x50\x06\x0a\x10"
+            "\x64\x86\x0a\x70\x00\x43\x6f\x69\x66\x66\x77\xe0\x14\x00\xa3\x10\x12\x75\x06\x00\x00\x83\x12\x90\x47\x72\x61\x6d\x6f\x6b\x6c\x65"
+            "\x73\x82\x01\x03\x08\x00\x11\x72\xe7\x13\x10\x64\x58\x15\x10\x66\xa1\x08\x00\x3a\x07\x01\xb5\x03\x30\x46\x6c\x61\x21\x14\x02\xb2"
+            "\x05\x41\x61\x62\x62\x61\xf3\x06\xa0\x49\x73\x63\x61\x6c\x61\x72\x00\x43\x61\xdf\x12\x10\x6e\x79\x0e\x10\x42\xa3\x04\x00\x82\x0c"
+            "\x42\x68\x61\x6e\x61\x0b\x00\x60\x41\x6c\x67\x69\x74\x74\xf9\x07\x00\xee\x0f\x30\x00\x53\x63\xda\x04\x00\x74\x05\x10\x57\x1e\x0e"
+            "\x41\x72\x00\x45\x67\x2a\x13\x00\x22\x06\x00\x7c\x00\x30\x42\x61\x6c\xc1\x12\x10\x73\x29\x04\x00\x7e\x10\x00\x0b\x00\x10\x41\xc3"
+            "\x11\x00\x9c\x15\x50\x6d\x61\x67\x61\x72\x18\x08\x10\x65\xf3\x09\x00\xe5\x04\x60\x52\x65\x73\x6c\x61\x64\x7b\x00\x30\x44\x65\x64"
+            "\x9a\x01\x30\x00\x52\x6f\x1d\x0b\x30\x00\x56\x69\xb5\x0c\x02\x08\x00\x00\x48\x00\x12\x74\x12\x00\x00\xfb\x00\x40\x43\x6c\x61\x76"
+            "\x65\x05\x00\x3f\x16\x00\x36\x13\x00\x57\x0c\x90\x6d\x62\x6f\x72\x6b\x00\x49\x72\x72\xfc\x08\x80\x50\x75\x6d\x70\x64\x6a\x69\x6e"
+            "\xbe\x07\x42\x6b\x74\x69\x70\x07\x00\xe0\x6c\x61\x73\x00\x65\x46\x2d\x65\x4d\x00\x55\x48\x61\x46\x6d\x13\x10\x58\xa8\x03\xd0\x61"
+            "\x73\x00\x59\x76\x65\x6c\x74\x61\x6c\x00\x5a\x79\x3f\x01\x10\x65\x46\x08\x21\x6e\x63\xb7\x0a\x00\xad\x15\x60\x56\x6f\x6c\x63\x61"
+            "\x6e\x71\x00\x10\x42\xb8\x10\x00\x6d\x17\x30\x72\x65\x74\xe7\x06\x61\x53\x69\x6c\x76\x61\x72\x40\x10\x20\x61\x6d\x9e\x01\x40\x4d"
+            "\x69\x65\x7a\x1f\x11\x50\x72\x00\x46\x75\x65\xbf\x01\x50\x52\x6f\x62\x62\x61\x57\x05\x10\x61\x1f\x03\x00\x79\x0d\xd0\x72\x69\x6d"
+            "\x61\x72\x65\x6e\x65\x00\x50\x65\x70\x70\x12\x00\x00\xbd\x00\x02\x09\x00\x01\xc1\x16\x01\xa9\x09\x12\x67\xe6\x0e\x01\x0a\x00\x40"
+            "\x73\x70\x65\x6b\x5c\x06\x20\x4d\x61\xd4\x15\x60\x00\x41\x6b\x6b\x75\x70\x6a\x11\x00\x2e\x0a\x12\x6e\xbf\x15\x21\x6f\x78\x67\x0f"
+            "\x00\xc0\x05\x20\x43\x68\x52\x03\x00\xc3\x11\x20\x57\x6f\xbd\x0f\x00\x90\x0d\x71\x64\x65\x6c\x62\x79\x00\x57\x96\x13\x71\x73\x00"
+            "\x57\x6f\x6c\x77\x65\xd7\x0c\x32\x4c\x75\x73\xe1\x04\x10\x47\x05\x0b\x01\xe7\x06\x20\x41\x67\xfb\x0c\x02\x0c\x00\x60\x50\x61\x6d"
+            "\x70\x75\x6c\x48\x02\x12\x6d\x67\x13\x60\x41\x72\x61\x71\x75\x61\x07\x00\x20\x6e\x65\x93\x0b\x20\x00\x49\xfa\x07\x10\x69\xdb\x0f"
+            "\xb0\x6e\x74\x69\x64\x65\x61\x00\x42\x75\x62\x75\xb3\x00\x00\x1c\x14\x50\x65\x6c\x6c\x75\x78\x50\x06\x70\x75\x6e\x6b\x00\x41\x6d"
+            "\x66\x21\x0b\x60\x56\x65\x6c\x75\x72\x73\x4e\x16\x50\x73\x74\x75\x72\x73\xf3\x04\x61\x75\x62\x62\x65\x72\x6c\x09\x00\x40\x61\x69"
+            "\x6c\x61\x09\x00\x00\x4c\x09\x51\x43\x75\x72\x65\x6c\x78\x16\x10\x6d\x76\x19\x10\x75\xe7\x18\x70\x51\x75\x61\x72\x74\x65\x72\xc9"
+            "\x08\x50\x52\x65\x69\xc3\x9f\xd5\x02\x61\x00\x54\x65\x63\x74\x61\x01\x0e\x81\x6e\x6b\x61\x62\x75\x68\x00\x43\x83\x08\xe0\x61\x6e"
+            "\x64\x00\x47\x75\x66\x61\x00\x54\x79\x70\x3a\x4e\x11\x11\x40\x41\x6d\x69\x67\xa7\x17\x00\xe1\x0d\x10\x65\xf9\x16\x10\x6f\x61\x0c"
+            "\x10\x75\x34\x15\x20\x74\x75\x60\x07\x00\x3f\x15\x70\x67\x65\x64\x65\x6d\x61\x72\xca\x01\x40\x6d\x69\x67\x6d\x13\x0d\x13\x69\x8f"
+            "\x13\x42\x65\x6e\x2d\x4c\xfe\x0b\x30\x72\x75\x64\xd2\x05\x21\x6e\x69\xe7\x02\x21\x65\x64\x08\x00\x00\xc3\x13\x02\x0a\x00\x00\x19"
+            "\x05\x52\x2d\x52\x69\x6b\x69\x0a\x00\x10\x46\x62\x18\x01\x0a\x00\x10\x54\xd7\x10\x01\x0a\x00\x80\x4b\x69\x6d\x65\x00\x43\x6f\x73"
+            "\x1a\x17\x01\x07\x00\x20\x76\x75\x8b\x09\x30\x6c\x67\x61\x31\x04\x00\xd4\x0f\x00\x8c\x01\x31\x6e\x65\x67\x93\x18\x20\x73\x6b\x6c"
+            "\x14\x00\x09\x09\x00\xa3\x07\x11\x65\x2e\x05\x10\x72\xd5\x05\x50\x00\x4b\x61\x67\x75\xe0\x04\x71\x4b\x61\x74\x61\x67\x61\x6d\x38"
+            "\x06\x00\xe5\x03\x02\xa4\x11\x61\x65\x63\x72\x6f\x7a\x6d\xd3\x0b\x31\x65\x61\x72\xdc\x0b\x70\x72\x73\x68\x61\x64\x6f\x77\x29\x0c"
+            "\x90\x69\x63\x72\x6f\x00\x41\x67\x6f\x79\x73\x02\x11\x75\xf0\x14\xf0\x01\x61\x00\x4b\x6f\x70\x70\x6c\x6f\x73\x69\x6f\x00\x5a\x65"
+            "\x72\x61\x80\x03\x00",
+            9189, 10166
+        },
+    },
+    // English
+    {
+        // characteristic_en
+        {
+            "\xf3\x96\x1f\x00\x00\x00\x84\x00\x00\x00\x89\x00\x00\x00\x96\x00\x00\x00\xa6\x00\x00\x00\xbc\x00\x00\x00\xd2\x00\x00\x00\xe1\x00"
+            "\x00\x00\xf4\x00\x00\x00\x0a\x01\x00\x00\x22\x01\x00\x00\x31\x01\x00\x00\x40\x01\x00\x00\x4c\x01\x00\x00\x63\x01\x00\x00\x75\x01"
+            "\x00\x00\x84\x01\x00\x00\x96\x01\x00\x00\xa3\x01\x00\x00\xb3\x01\x00\x00\xc7\x01\x00\x00\xdb\x01\x00\x00\xe9\x01\x00\x00\xf8\x01"
+            "\x00\x00\x04\x02\x00\x00\x17\x02\x00\x00\x2d\x02\x00\x00\x3a\x02\x00\x00\x48\x02\x00\x00\x56\x02\x00\x00\x67\x02\x00\x00\x75\x02"
+            "\x00\x00\x87\x02\x00\x00\x4e\x6f\x6e\x65\x00\x4c\x6f\x76\x65\x73\x20\x74\x6f\x20\x65\x61\x74\x00\x4f\x66\x74\x65\x6e\x20\x64\x6f"
+            "\x7a\x65\x73\x20\x6f\x66\x66\x10\x00\xfa\x02\x73\x63\x61\x74\x74\x65\x72\x73\x20\x74\x68\x69\x6e\x67\x73\x00\x53\x10\x00\x20\x20"
+            "\x6f\x26\x00\x42\x00\x4c\x69\x6b\x49\x00\xf6\x09\x72\x65\x6c\x61\x78\x00\x50\x72\x6f\x75\x64\x20\x6f\x66\x20\x69\x74\x73\x20\x70"
+            "\x6f\x77\x65\x72\x22\x00\xf6\x15\x74\x68\x72\x61\x73\x68\x20\x61\x62\x6f\x75\x74\x00\x41\x20\x6c\x69\x74\x74\x6c\x65\x20\x71\x75"
+            "\x69\x63\x6b\x20\x74\x65\x6d\x70\x65\x72\x65\x64\x2e\x00\x7a\x66\x69\x67\x68\x74\x00\x51\x1e\x00\xf0\x04\x53\x74\x75\x72\x64\x79"
+            "\x20\x62\x6f\x64\x79\x00\x43\x61\x70\x61\x62\x6c\x65\x6d\x00\xf2\x1d\x74\x61\x6b\x69\x6e\x67\x20\x68\x69\x74\x73\x00\x48\x69\x67"
+            "\x68\x6c\x79\x20\x70\x65\x72\x73\x69\x73\x74\x65\x6e\x74\x00\x47\x6f\x6f\x64\x20\x65\x6e\x64\x75\x72\x61\x6e\x63\x65\x0f\x00\x00"
+            "\x1f\x00\x50\x65\x76\x65\x72\x65\x12\x00\x06\xc4\x00\x80\x75\x6e\x00\x41\x6c\x65\x72\x74\x0d\x00\xf0\x14\x73\x6f\x75\x6e\x64\x73"
+            "\x00\x49\x6d\x70\x65\x74\x75\x6f\x75\x73\x20\x61\x6e\x64\x20\x73\x69\x6c\x6c\x79\x00\x53\x6f\x6d\x65\x77\x68\x61\x74\x7c\x00\x74"
+            "\x61\x20\x63\x6c\x6f\x77\x6e\xaa\x00\x64\x6f\x20\x66\x6c\x65\x65\x86\x00\xf0\x01\x63\x75\x72\x69\x6f\x75\x73\x00\x4d\x69\x73\x63"
+            "\x68\x69\x65\x76\x0c\x00\x63\x54\x68\x6f\x72\x6f\x75\x1f\x00\x53\x6e\x6e\x69\x6e\x67\x71\x01\xa0\x6c\x6f\x73\x74\x20\x69\x6e\x20"
+            "\x74\x68\x1f\x00\xf0\x0b\x74\x00\x56\x65\x72\x79\x20\x66\x69\x6e\x69\x63\x6b\x79\x00\x53\x74\x72\x6f\x6e\x67\x20\x77\x69\x6c\x6c"
+            "\x08\x01\x04\x81\x00\x43\x76\x61\x69\x6e\x1c\x00\xe2\x6c\x79\x20\x64\x65\x66\x69\x61\x6e\x74\x00\x48\x61\x74\xd1\x00\x46\x6c\x6f"
+            "\x73\x65\x2d\x00\x90\x73\x74\x75\x62\x62\x6f\x72\x6e\x00",
+            558, 647
+        },
+        // dppt_en
+        {
+            "\xf2\xff\xd2\x71\x00\x00\x00\xcc\x01\x00\x00\xda\x01\x00\x00\xe6\x01\x00\x00\xf4\x01\x00\x00\x03\x02\x00\x00\x13\x02\x00\x00\x24"
+            "\x02\x00\x00\x36\x02\x00\x00\x47\x02\x00\x00\x55\x02\x00\x00\x65\x02\x00\x00\x8a\x02\x00\x00\x99\x02\x00\x00\xa8\x02\x00\x00\xb9"
+            "\x02\x00\x00\xc8\x02\x00\x00\xd7\x02\x00\x00\xe6\x02\x00\x00\xf5\x02\x00\x00\x0a\x03\x00\x00\x2b\x03\x00\x00\x4c\x03\x00\x00\x5c"
+            "\x03\x00\x00\x6f\x03\x00\x00\x82\x03\x00\x00\x95\x03\x00\x00\xa8\x03\x00\x00\xbb\x03\x00\x00\xce\x03\x00\x00\xdd\x03\x00\x00\xed"
+            "\x03\x00\x00\xfd\x03\x00\x00\x0e\x04\x00\x00\x27\x04\x00\x00\x40\x04\x00\x00\x59\x04\x00\x00\x66\x04\x00\x00\x77\x04\x00\x00\x89"
+            "\x04\x00\x00\x98\x04\x00\x00\xb0\x04\x00\x00\xc8\x04\x00\x00\xd7\x04\x00\x00\xee\x04\x00\x00\x07\x05\x00\x00\x20\x05\x00\x00\x34"
+            "\x05\x00\x00\x49\x05\x00\x00\x5e\x05\x00\x00\x73\x05\x00\x00\x88\x05\x00\x00\x9d\x05\x00\x00\xaa\x05\x00\x00\xc0\x05\x00\x00\xde"
+            "\x05\x00\x00\xfc\x05\x00\x00\x0a\x06\x00\x00\x18\x06\x00\x00\x24\x06\x00\x00\x33\x06\x00\x00\x43\x06\x00\x00\x5a\x06\x00\x00\x72"
+            "\x06\x00\x00\x82\x06\x00\x00\x8e\x06\x00\x00\xa1\x06\x00\x00\xad\x06\x00\x00\xb8\x06\x00\x00\xc4\x06\x00\x00\xd4\x06\x00\x00\xe5"
+            "\x06\x00\x00\xef\x06\x00\x00\xf9\x06\x00\x00\x03\x07\x00\x00\x15\x07\x00\x00\x27\x07\x00\x00\x39\x07\x00\x00\x4b\x07\x00\x00\x55"
+            "\x07\x00\x00\x5f\x07\x00\x00\x69\x07\x00\x00\x73\x07\x00\x00\x81\x07\x00\x00\x8f\x07\x00\x00\x9d\x07\x00\x00\xab\x07\x00\x00\xb9"
+            "\x07\x00\x00\xcb\x07\x00\x00\xdd\x07\x00\x00\xee\x07\x00\x00\xff\x07\x00\x00\x11\x08\x00\x00\x23\x08\x00\x00\x2d\x08\x00\x00\x37"
+            "\x08\x00\x00\x41\x08\x00\x00\x4b\x08\x00\x00\x55\x08\x00\x00\x5f\x08\x00\x00\x69\x08\x00\x00\x73\x08\x00\x00\x7d\x08\x00\x00\x87"
+            "\x08\x00\x00\x91\x08\x00\x00\x9b\x08\x00\x00\xa5\x08\x00\x00\xaf\x08\x00\x00\xbd\x08\x00\x00\xcb\x08\x00\x00\xd7\x08\x00\x00\xe1"
+            "\x08\x00\x00\xeb\x08\x00\x00\xf5\x08\x00\x00\xff\x08\x00\x00\x43\x61\x6e\x61\x6c\x61\x76\x65\x20\x43\x69\x74\x79\x00\x45\x74\x65"
+            "\x72\x6e\x61\x0c\x00\x73\x50\x61\x73\x74\x6f\x72\x69\x0e\x00\x83\x53\x75\x6e\x79\x73\x68\x6f\x72\x29\x00\xfb\x11\x50\x6f\x6b\xc3"
+            "\xa9\x6d\x6f\x6e\x20\x4c\x65\x61\x67\x75\x65\x00\x4f\x72\x65\x62\x75\x72\x67\x68\x20\x4d\x69\x6e\x65\x20\x31\x46\x11\x00\xf4\x05"
+            "\x42\x31\x46\x00\x56\x61\x6c\x6c\x65\x79\x20\x57\x69\x6e\x64\x77\x6f\x72\x6b\x73\x6d\x00\xf2\x02\x46\x6f\x72\x65\x73\x74\x00\x46"
+            "\x75\x65\x67\x6f\x20\x49\x72\x6f\x6e\x1e\x00\xf9\x15\x4d\x74\x2e\x20\x43\x6f\x72\x6f\x6e\x65\x74\x20\x28\x52\x6f\x75\x74\x65\x20"
+            "\x32\x30\x37\x2f\x32\x30\x38\x20\x45\x6e\x74\x72\x61\x6e\x63\x65\x29\x25\x00\x29\x32\x46\x0f\x00\x1a\x33\x0f\x00\x49\x53\x6e\x6f"
+            "\x77\x11\x00\x1a\x34\x20\x00\x1a\x35\x0f\x00\x1a\x36\x0f\x00\x1a\x37\x0f\x00\x8f\x54\x6f\x70\x20\x43\x61\x76\x65\xa5\x00\x02\x2f"
+            "\x31\x36\xa1\x00\x04\x05\x21\x00\x1f\x31\x21\x00\x04\x00\x26\x01\xfe\x03\x47\x72\x65\x61\x74\x20\x4d\x61\x72\x73\x68\x20\x41\x72"
+            "\x65\x61\x20\x31\x13\x00\x1e\x32\x13\x00\x1e\x33\x13\x00\x1e\x34\x13\x00\x1e\x35\x13\x00\xf0\x0e\x36\x00\x53\x6f\x6c\x61\x63\x65"
+            "\x6f\x6e\x20\x52\x75\x69\x6e\x73\x00\x56\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\xc9\x01\x09\x10\x00\x1b\x32\x10\x00\x01\xd8"
+            "\x01\x09\x11\x00\xaf\x61\x63\x6b\x20\x52\x6f\x6f\x6d\x20\x31\x19\x00\x05\x1f\x32\x19\x00\x05\xe6\x33\x00\x52\x61\x76\x61\x67\x65"
+            "\x64\x20\x50\x61\x74\x68\x42\x02\x3a\x47\x61\x74\x53\x02\x01\x11\x00\x00\x7b\x00\xeb\x53\x74\x61\x72\x6b\x20\x4d\x6f\x75\x6e\x74"
+            "\x61\x69\x6e\x0f\x00\x05\x65\x01\x0c\x18\x00\xf0\x0e\x49\x6e\x74\x65\x72\x69\x6f\x72\x00\x53\x65\x6e\x64\x6f\x66\x66\x20\x53\x70"
+            "\x72\x69\x6e\x67\x00\x54\x75\x72\x6e\x62\x8e\x00\x00\xdb\x01\x06\x3e\x00\x0a\x17\x00\xab\x31\x73\x74\x20\x50\x69\x6c\x6c\x61\x72"
+            "\x19\x00\x34\x32\x6e\x64\x19\x00\x00\x6c\x02\xb1\x70\x6f\x69\x6e\x74\x20\x54\x65\x6d\x70\x6c\xbd\x00\x0d\x14\x00\x01\xc0\x00\x0d"
+            "\x15\x00\x1f\x32\x15\x00\x01\x1f\x33\x15\x00\x01\x1f\x34\x15\x00\x01\xa2\x35\x46\x00\x57\x61\x79\x77\x61\x72\x64\xa0\x02\x08\x0d"
+            "\x00\xa0\x20\x28\x53\x65\x63\x72\x65\x74\x29\x00\xe9\x01\x73\x20\x4d\x61\x6e\x69\x61\x63\x1a\x00\xaf\x3c\x20\x31\x30\x20\x55\x6e"
+            "\x6f\x77\x6e\x1e\x00\x01\x17\x3e\x1e\x00\x03\x19\x00\xf0\x06\x54\x75\x6e\x6e\x65\x6c\x00\x54\x72\x6f\x70\x68\x79\x20\x47\x61\x72"
+            "\x64\x65\x6e\x00\xbd\x03\x78\x20\x49\x73\x6c\x61\x6e\x64\x0c\x00\x00\xff\x00\x08\x0f\x00\x00\xfa\x00\x09\x10\x00\x9e\x32\x46\x20"
+            "\x28\x4c\x65\x66\x74\x29\x17\x00\x4c\x52\x69\x67\x68\x18\x00\xe8\x33\x46\x00\x4f\x6c\x64\x20\x43\x68\x61\x74\x65\x61\x75\x0c\x00"
+            "\x02\x48\x02\xa0\x35\x00\x4c\x61\x6b\x65\x20\x56\x65\x72\xaa\x04\x02\x0c\x00\x42\x61\x6c\x6f\x72\x0b\x00\x30\x41\x63\x75\x17\x00"
+            "\x01\x12\x00\x10\x20\x12\x00\x62\x66\x72\x6f\x6e\x74\x00\x17\x00\x07\x11\x00\x04\x73\x04\x15\x31\x0a\x00\x15\x32\x0a\x00\x15\x33"
+            "\x0a\x00\x98\x34\x20\x28\x53\x6f\x75\x74\x68\x29\x12\x00\x38\x4e\x6f\x72\x12\x00\x1d\x35\x24\x00\x1d\x35\x24\x00\x15\x36\x0a\x00"
+            "\x15\x37\x0a\x00\x15\x38\x0a\x00\x50\x39\x00\x4c\x6f\x73\x77\x04\x30\x77\x65\x72\x4e\x01\x07\x0e\x00\x19\x32\x0e\x00\x19\x33\x0e"
+            "\x00\x19\x34\x0e\x00\x24\x35\x46\x50\x00\x2c\x31\x30\x92\x00\x00\x12\x00\x0a\x92\x00\x70\x31\x31\x20\x28\x57\x65\x73\x2e\x02\x06"
+            "\x11\x00\x28\x45\x61\x11\x00\x1d\x32\x34\x00\x1d\x32\x58\x00\x05\x2a\x01\x25\x31\x34\x0a\x00\x15\x35\x0a\x00\x05\xf6\x00\x15\x31"
+            "\xf6\x00\x15\x31\xf6\x00\x24\x31\x39\x0a\x00\x15\x32\x84\x01\x15\x32\x84\x01\x15\x32\x50\x00\x15\x32\x50\x00\x15\x32\x46\x00\x15"
+            "\x32\x46\x00\xb0\x32\x39\x00\x54\x77\x69\x6e\x6c\x65\x61\x66\x08\x01\xa2\x6e\x00\x43\x65\x6c\x65\x73\x74\x69\x63\x0e\x00\x61\x52"
+            "\x65\x73\x6f\x72\x74\x0b\x05\x05\x32\x00\x15\x30\x0a\x00\x05\xbe\x00\x15\x32\xaa\x00\x30\x33\x30\x00",
+            1369, 2303
+        },
+        // frlg_en
+        {
+            "\xf4\xff\xc6\x6b\x00\x00\x00\xb4\x01\x00\x00\xc0\x01\x00\x00\xce\x01\x00\x00\xdc\x01\x00\x00\xeb\x01\x00\x00\xf8\x01\x00\x00\x05"
+            "\x02\x00\x00\x15\x02\x00\x00\x1d\x02\x00\x00\x25\x02\x00\x00\x2d\x02\x00\x00\x35\x02\x00\x00\x3d\x02\x00\x00\x45\x02\x00\x00\x4d"
+            "\x02\x00\x00\x55\x02\x00\x00\x5d\x02\x00\x00\x66\x02\x00\x00\x6f\x02\x00\x00\x78\x02\x00\x00\x81\x02\x00\x00\x8a\x02\x00\x00\x93"
+            "\x02\x00\x00\x9c\x02\x00\x00\xa5\x02\x00\x00\xae\x02\x00\x00\xb7\x02\x00\x00\xc0\x02\x00\x00\xc9\x02\x00\x00\xd2\x02\x00\x00\xdb"
+            "\x02\x00\x00\xe4\x02\x00\x00\xed\x02\x00\x00\xfd\x02\x00\x00\x09\x03\x00\x00\x16\x03\x00\x00\x23\x03\x00\x00\x2d\x03\x00\x00\x3c"
+            "\x03\x00\x00\x4c\x03\x00\x00\x5c\x03\x00\x00\x6c\x03\x00\x00\x83\x03\x00\x00\x98\x03\x00\x00\xab\x03\x00\x00\xbe\x03\x00\x00\xd1"
+            "\x03\x00\x00\xe4\x03\x00\x00\xf3\x03\x00\x00\x03\x04\x00\x00\x16\x04\x00\x00\x2a\x04\x00\x00\x3e\x04\x00\x00\x52\x04\x00\x00\x66"
+            "\x04\x00\x00\x78\x04\x00\x00\x8a\x04\x00\x00\x9c\x04\x00\x00\xae\x04\x00\x00\xc0\x04\x00\x00\xd1\x04\x00\x00\xe2\x04\x00\x00\xf4"
+            "\x04\x00\x00\x00\x05\x00\x00\x0b\x05\x00\x00\x17\x05\x00\x00\x23\x05\x00\x00\x2f\x05\x00\x00\x3e\x05\x00\x00\x49\x05\x00\x00\x55"
+            "\x05\x00\x00\x65\x05\x00\x00\x75\x05\x00\x00\x85\x05\x00\x00\x96\x05\x00\x00\xa6\x05\x00\x00\xb5\x05\x00\x00\xc0\x05\x00\x00\xcb"
+            "\x05\x00\x00\xd7\x05\x00\x00\xf0\x05\x00\x00\x00\x06\x00\x00\x0f\x06\x00\x00\x1c\x06\x00\x00\x26\x06\x00\x00\x37\x06\x00\x00\x48"
+            "\x06\x00\x00\x59\x06\x00\x00\x66\x06\x00\x00\x74\x06\x00\x00\x82\x06\x00\x00\x90\x06\x00\x00\x9e\x06\x00\x00\xac\x06\x00\x00\xb9"
+            "\x06\x00\x00\xc6\x06\x00\x00\xd6\x06\x00\x00\xe7\x06\x00\x00\xf9\x06\x00\x00\x06\x07\x00\x00\x14\x07\x00\x00\x23\x07\x00\x00\x32"
+            "\x07\x00\x00\x41\x07\x00\x00\x51\x07\x00\x00\x60\x07\x00\x00\x6d\x07\x00\x00\x7d\x07\x00\x00\x50\x61\x6c\x6c\x65\x74\x20\x54\x6f"
+            "\x77\x6e\x00\x56\x69\x72\x69\x64\x69\x61\x6e\x20\x43\x69\x74\x79\x00\x43\x65\x72\x75\x6c\x65\x0e\x00\x85\x56\x65\x72\x6d\x69\x6c"
+            "\x69\x6f\x1d\x00\x34\x6c\x61\x64\x0d\x00\x73\x46\x75\x63\x68\x73\x69\x61\x1a\x00\xf3\x07\x69\x6e\x6e\x61\x62\x61\x72\x20\x49\x73"
+            "\x6c\x61\x6e\x64\x00\x52\x6f\x75\x74\x65\x20\x31\x08\x00\x13\x32\x08\x00\x13\x33\x08\x00\x13\x34\x08\x00\x13\x35\x08\x00\x13\x36"
+            "\x08\x00\x13\x37\x08\x00\x13\x38\x08\x00\x14\x39\x48\x00\x14\x30\x09\x00\x04\x52\x00\x14\x31\x53\x00\x14\x31\x54\x00\x14\x31\x55"
+            "\x00\x14\x31\x56\x00\x14\x31\x57\x00\x14\x31\x58\x00\x14\x31\x59\x00\x14\x31\x5a\x00\x14\x32\x5a\x00\x15\x32\xac\x00\x04\x5a\x00"
+            "\x14\x32\x5a\x00\x14\x32\x5a\x00\x26\x32\x35\x2d\x01\xf6\x03\x46\x6f\x72\x65\x73\x74\x00\x4d\x74\x2e\x20\x4d\x6f\x6f\x6e\x20\x31"
+            "\x46\x0c\x00\x19\x42\x0d\x00\xf0\x19\x32\x46\x00\x53\x2e\x53\x2e\x20\x41\x6e\x6e\x65\x00\x44\x69\x67\x6c\x65\x74\x74\x27\x73\x20"
+            "\x43\x61\x76\x65\x00\x56\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\x43\x00\x09\x10\x00\x1b\x32\x10\x00\xf0\x01\x33\x46\x00\x50"
+            "\x6f\x6b\xc3\xa9\x6d\x6f\x6e\x20\x4d\x61\x6e\x73\x97\x01\x3f\x31\x46\x2d\x17\x00\x01\x00\x82\x00\xf9\x03\x53\x61\x66\x61\x72\x69"
+            "\x20\x5a\x6f\x6e\x65\x20\x43\x65\x6e\x74\x65\x72\x13\x00\x6e\x41\x72\x65\x61\x20\x31\x13\x00\x1e\x32\x13\x00\x00\x09\x01\x90\x63"
+            "\x6b\x20\x54\x75\x6e\x6e\x65\x6c\xa7\x00\x08\x0f\x00\x01\x6b\x00\x63\x65\x61\x66\x6f\x61\x6d\xfd\x01\x10\x73\x23\x00\x0c\x13\x00"
+            "\x0f\x27\x00\x01\x01\x1b\x01\x0c\x14\x00\x1f\x33\x14\x00\x00\x17\x34\xe3\x00\x59\x54\x6f\x77\x65\x72\x0c\x01\x02\x12\x00\x0e\x24"
+            "\x00\x1d\x35\x12\x00\x1d\x36\x12\x00\x27\x37\x46\xf2\x02\x30\x61\x76\x65\xbb\x00\x0a\x11\x00\x1c\x32\x11\x00\x00\xca\x00\x11\x50"
+            "\x3d\x00\x94\x50\x6c\x61\x6e\x74\x00\x4f\x6e\x65\xf6\x02\x35\x46\x6f\x75\x02\x03\x35\x46\x69\x76\x18\x00\x61\x4b\x69\x6e\x64\x6c"
+            "\x65\xc6\x01\xf0\x10\x00\x54\x72\x65\x61\x73\x75\x72\x65\x20\x42\x65\x61\x63\x68\x00\x43\x61\x70\x65\x20\x42\x72\x69\x6e\x6b\x00"
+            "\x42\x6f\x6e\x64\x0b\x00\x81\x64\x67\x65\x00\x54\x68\x72\x65\x3f\x00\xf5\x17\x65\x20\x50\x6f\x72\x74\x00\x52\x65\x73\x6f\x72\x74"
+            "\x20\x47\x6f\x72\x67\x65\x6f\x75\x73\x00\x57\x61\x74\x65\x72\x20\x4c\x61\x62\x79\x72\x69\x6e\x74\x68\x6e\x00\xf4\x11\x65\x20\x4d"
+            "\x65\x61\x64\x6f\x77\x00\x4d\x65\x6d\x6f\x72\x69\x61\x6c\x20\x50\x69\x6c\x6c\x61\x72\x00\x4f\x75\x74\x63\x61\x73\x74\x92\x00\xa3"
+            "\x47\x72\x65\x65\x6e\x20\x50\x61\x74\x68\x4b\x00\x01\x0b\x00\x60\x52\x75\x69\x6e\x20\x56\x1c\x04\x93\x79\x00\x54\x72\x61\x69\x6e"
+            "\x65\x72\x28\x01\xf2\x14\x28\x65\x78\x74\x65\x72\x69\x6f\x72\x29\x00\x43\x61\x6e\x79\x6f\x6e\x20\x45\x6e\x74\x72\x61\x6e\x63\x65"
+            "\x00\x53\x65\x76\x61\x75\x6c\x74\x20\x18\x00\x80\x00\x54\x61\x6e\x6f\x62\x79\x20\x4b\x00\x11\x73\x06\x03\x56\x45\x6d\x62\x65\x72"
+            "\x0a\x00\x7c\x20\x52\x6f\x6f\x6d\x20\x31\x11\x00\x1c\x32\x11\x00\x17\x33\x11\x00\x03\x50\x03\x02\x0d\x00\x04\x5e\x03\x03\x0e\x00"
+            "\x19\x32\x0e\x00\x19\x33\x0e\x00\x19\x34\x0e\x00\x84\x35\x46\x00\x42\x65\x72\x72\x79\xbc\x03\x72\x49\x63\x65\x66\x61\x6c\x6c\x8a"
+            "\x03\x08\x0d\x00\x00\x70\x00\x09\x10\x00\x00\x73\x00\x0a\x11\x00\xf0\x04\x61\x63\x6b\x00\x50\x61\x74\x74\x65\x72\x6e\x20\x42\x75"
+            "\x73\x68\x00\x41\x6c\x20\x01\x22\x6e\x67\x4e\x00\x31\x4d\x6f\x6e\x30\x02\x21\x68\x61\xfd\x00\x65\x4c\x69\x70\x74\x6f\x6f\x0f\x00"
+            "\x65\x57\x65\x65\x70\x74\x68\x0f\x00\x75\x44\x69\x6c\x66\x6f\x72\x64\x10\x00\x65\x53\x63\x75\x66\x69\x62\x0f\x00\x45\x52\x69\x78"
+            "\x79\x0d\x00\x75\x56\x69\x61\x70\x6f\x69\x73\x10\x00\x00",
+            1294, 1917
+        },
+        // hgss_en
+        {
+            "\xf3\xff\xff\x02\x78\x00\x00\x00\xe8\x01\x00\x00\xf6\x01\x00\x00\xff\x01\x00\x00\x10\x02\x00\x00\x19\x02\x00\x00\x22\x02\x00\x00"
+            "\x2e\x02\x00\x00\x3b\x02\x00\x00\x44\x02\x00\x00\x5c\x02\x00\x00\x73\x02\x00\x00\x81\x02\x00\x00\x90\x02\x00\x00\x9f\x02\x00\x00"
+            "\xa8\x02\x00\x00\xb9\x02\x00\x00\xcb\x02\x00\x00\xd7\x02\x00\x00\xe0\x02\x00\x00\xe9\x02\x00\x00\xf7\x02\x00\x00\x00\x03\x00\x00"
+            "\x09\x03\x00\x00\x17\x03\x00\x00\x27\x03\x00\x00\x38\x03\x00\x00\x43\x03\x00\x00\x4c\x03\x00\x00\x55\x03\x00\x00\x62\x03\x00\x00"
+            "\x6b\x03\x00\x00\x74\x03\x00\x00\x85\x03\x00\x00\x97\x03\x00\x00\xa9\x03\x00\x00\xbb\x03\x00\x00\xc9\x03\x00\x00\xd2\x03\x00\x00"
+            "\xe0\x03\x00\x00\xf5\x03\x00\x00\x03\x04\x00\x00\x12\x04\x00\x00\x1b\x04\x00\x00\x28\x04\x00\x00\x31\x04\x00\x00\x3d\x04\x00\x00"
+            "\x4a\x04\x00\x00\x57\x04\x00\x00\x64\x04\x00\x00\x74\x04\x00\x00\x83\x04\x00\x00\x8c\x04\x00\x00\x95\x04\x00\x00\xaa\x04\x00\x00"
+            "\xbf\x04\x00\x00\xc8\x04\x00\x00\xd1\x04\x00\x00\xe5\x04\x00\x00\xf8\x04\x00\x00\x0c\x05\x00\x00\x20\x05\x00\x00\x34\x05\x00\x00"
+            "\x48\x05\x00\x00\x56\x05\x00\x00\x6d\x05\x00\x00\x7b\x05\x00\x00\x8b\x05\x00\x00\x96\x05\x00\x00\xa1\x05\x00\x00\xaf\x05\x00\x00"
+            "\xcc\x05\x00\x00\xdf\x05\x00\x00\xee\x05\x00\x00\xf7\x05\x00\x00\x00\x06\x00\x00\x09\x06\x00\x00\x15\x06\x00\x00\x23\x06\x00\x00"
+            "\x31\x06\x00\x00\x40\x06\x00\x00\x4d\x06\x00\x00\x5a\x06\x00\x00\x6a\x06\x00\x00\x73\x06\x00\x00\x7c\x06\x00\x00\x85\x06\x00\x00"
+            "\x8e\x06\x00\x00\x97\x06\x00\x00\xa6\x06\x00\x00\xb5\x06\x00\x00\xc5\x06\x00\x00\xcd\x06\x00\x00\xdd\x06\x00\x00\xe5\x06\x00\x00"
+            "\xed\x06\x00\x00\xf5\x06\x00\x00\xfd\x06\x00\x00\x05\x07\x00\x00\x0d\x07\x00\x00\x15\x07\x00\x00\x1e\x07\x00\x00\x27\x07\x00\x00"
+            "\x30\x07\x00\x00\x39\x07\x00\x00\x42\x07\x00\x00\x4b\x07\x00\x00\x54\x07\x00\x00\x5d\x07\x00\x00\x66\x07\x00\x00\x6f\x07\x00\x00"
+            "\x78\x07\x00\x00\x81\x07\x00\x00\x8d\x07\x00\x00\x9e\x07\x00\x00\xae\x07\x00\x00\xbe\x07\x00\x00\xce\x07\x00\x00\xde\x07\x00\x00"
+            "\xef\x07\x00\x00\x00\x08\x00\x00\x12\x08\x00\x00\x4e\x65\x77\x20\x42\x61\x72\x6b\x20\x54\x6f\x77\x6e\x00\x52\x6f\x75\x74\x65\x20"
+            "\x32\x39\x00\x43\x68\x65\x72\x72\x79\x67\x72\x6f\x76\x65\x20\x43\x69\x74\x79\x1a\x00\x24\x33\x30\x09\x00\x82\x31\x00\x56\x69\x6f"
+            "\x6c\x65\x74\x1e\x00\x60\x53\x70\x72\x6f\x75\x74\x44\x00\x24\x65\x72\x22\x00\xfc\x0a\x32\x00\x52\x75\x69\x6e\x73\x20\x6f\x66\x20"
+            "\x41\x6c\x70\x68\x20\x28\x4f\x75\x74\x73\x69\x64\x65\x29\x18\x00\x22\x49\x6e\x17\x00\xd8\x55\x6e\x69\x6f\x6e\x20\x43\x61\x76\x65"
+            "\x20\x31\x46\x0e\x00\x1b\x42\x0f\x00\x24\x32\x46\x64\x00\xf0\x00\x33\x00\x53\x4c\x4f\x57\x50\x4f\x4b\x45\x20\x57\x65\x6c\x6c\x38"
+            "\x00\x0a\x11\x00\x00\x3b\x00\xb4\x49\x6c\x65\x78\x20\x46\x6f\x72\x65\x73\x74\x38\x00\x14\x34\x09\x00\xf4\x00\x35\x00\x4e\x61\x74"
+            "\x69\x6f\x6e\x61\x6c\x20\x50\x61\x72\x6b\x17\x00\x14\x36\x09\x00\xa2\x37\x00\x45\x63\x72\x75\x74\x65\x61\x6b\xe9\x00\x62\x42\x75"
+            "\x72\x6e\x65\x64\xe9\x00\x00\x6e\x00\x09\x10\x00\x00\x6d\x00\x10\x42\x76\x00\x09\x08\x01\x14\x38\x09\x00\x89\x39\x00\x4f\x6c\x69"
+            "\x76\x69\x6e\x52\x01\x14\x34\x52\x01\xf0\x01\x34\x31\x00\x57\x68\x69\x72\x6c\x20\x49\x73\x6c\x61\x6e\x64\x73\x5e\x00\x0a\x11\x00"
+            "\x00\x5f\x00\x0b\x12\x00\x1d\x32\x12\x00\xb9\x33\x46\x00\x43\x69\x61\x6e\x77\x6f\x6f\x64\x67\x00\xb1\x32\x00\x4d\x74\x2e\x20\x4d"
+            "\x6f\x72\x74\x61\xb9\x00\x09\x0e\x00\x78\x20\x28\x42\x61\x63\x6b\x29\x15\x00\x19\x32\x23\x00\x00\x7b\x00\x03\x49\x00\x60\x33\x00"
+            "\x4c\x61\x6b\x65\xbe\x01\x44\x52\x61\x67\x65\x16\x00\xa0\x34\x00\x49\x63\x65\x20\x50\x61\x74\x68\x5d\x00\x05\x0c\x00\x01\x7f\x01"
+            "\x05\x0d\x00\x18\x32\x0d\x00\xd2\x33\x46\x00\x42\x6c\x61\x63\x6b\x74\x68\x6f\x72\x6e\xab\x00\xd4\x44\x72\x61\x67\x6f\x6e\xe2\x80"
+            "\x99\x73\x20\x44\x65\x8d\x02\x24\x34\x35\x09\x00\x30\x36\x00\x44\xa9\x02\x01\x04\x02\x14\x28\x87\x02\x1e\x29\x15\x00\x34\x34\x35"
+            "\x29\x33\x00\x13\x37\xc5\x00\x25\x6f\x6e\x09\x00\xf8\x04\x20\x28\x43\x6c\x65\x66\x61\x69\x72\x79\x29\x00\x53\x65\x61\x66\x6f\x61"
+            "\x6d\x73\x01\x0c\x13\x00\x00\xc2\x00\x0d\x14\x00\x1f\x32\x14\x00\x00\x1f\x33\x14\x00\x00\x12\x34\x45\x01\x42\x53\x69\x6c\x76\x2f"
+            "\x02\x07\x0e\x00\x03\xe8\x02\x48\x20\x54\x6f\x70\x17\x00\xf3\x03\x34\x46\x00\x43\x6c\x69\x66\x66\x20\x45\x64\x67\x65\x20\x47\x61"
+            "\x74\x65\x10\x00\x00\x30\x00\x07\x29\x00\x08\x34\x00\x03\xac\x01\x08\x59\x00\x71\x4d\x6f\x75\x6e\x74\x61\x69\x5a\x03\x0d\x1d\x00"
+            "\x19\x33\x30\x00\x00\x81\x00\x02\x2f\x01\x24\x31\x32\x09\x00\x14\x39\x0a\x04\x50\x30\x00\x50\x61\x6c\xe7\x03\x01\x1f\x04\x73\x56"
+            "\x69\x72\x69\x64\x69\x61\xaf\x01\x64\x43\x65\x72\x75\x6c\x65\x0e\x00\x61\x56\x65\x72\x6d\x69\x6c\xa5\x03\x02\x1d\x00\x34\x6c\x61"
+            "\x64\x0d\x00\x73\x46\x75\x63\x68\x73\x69\x61\x1a\x00\x73\x69\x6e\x6e\x61\x62\x61\x72\x27\x01\x04\xab\x01\x04\x27\x03\x14\x32\x7c"
+            "\x03\x24\x32\x37\x09\x00\x16\x38\xc6\x01\xa1\x52\x6f\x63\x6b\x20\x54\x75\x6e\x6e\x65\xed\x03\x08\x0f\x00\xf2\x00\x32\x46\x00\x56"
+            "\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\x1f\x00\x01\xce\x00\x04\x48\x00\x74\x20\x28\x53\x6f\x75\x74\x68\x1e\x02\x14\x33\x7b"
+            "\x00\x03\x08\x00\x04\x69\x02\x04\x81\x00\x04\x80\x00\x04\x9a\x00\x04\x15\x01\x14\x31\xb3\x03\x14\x31\x5a\x00\x14\x31\x4b\x00\x14"
+            "\x31\x4c\x00\x14\x31\x4d\x00\x14\x31\x4e\x00\x14\x31\x4f\x00\x15\x31\xea\x00\x05\x99\x00\x04\x78\x01\x14\x32\x3f\x00\xf1\x07\x32"
+            "\x35\x00\x54\x6f\x68\x6a\x6f\x20\x46\x61\x6c\x6c\x73\x00\x44\x49\x47\x4c\x45\x54\x54\x1a\x03\x01\x08\x02\x09\xe9\x00\x0c\xf9\x00"
+            "\x14\x33\xf9\x00\x60\x32\x20\x28\x4e\x6f\x72\xf1\x00\x05\xb9\x01\x03\x07\x05\x06\xbb\x01\x03\x6e\x05\x0a\x11\x00\x1c\x32\x11\x00"
+            "\x00\x06\x03\x00",
+            1348, 2066
+        },
+        // natures_en
+        {
+            "\xf0\xf4\x19\x00\x00\x00\x6c\x00\x00\x00\x72\x00\x00\x00\x79\x00\x00\x00\x7f\x00\x00\x00\x87\x00\x00\x00\x8f\x00\x00\x00\x94\x00"
+            "\x00\x00\x9b\x00\x00\x00\xa3\x00\x00\x00\xaa\x00\x00\x00\xae\x00\x00\x00\xb4\x00\x00\x00\xba\x00\x00\x00\xc2\x00\x00\x00\xc8\x00"
+            "\x00\x00\xce\x00\x00\x00\xd5\x00\x00\x00\xda\x00\x00\x00\xe0\x00\x00\x00\xe8\x00\x00\x00\xed\x00\x00\x00\xf2\x00\x00\x00\xf9\x00"
+            "\x00\x00\xff\x00\x00\x00\x07\x01\x00\x00\x0e\x01\x00\x00\x48\x61\x72\x64\x79\x00\x4c\x6f\x6e\x65\x6c\x79\x00\x42\x72\x61\x76\x65"
+            "\x00\x41\x64\x61\x6d\x61\x6e\x74\x00\x4e\x61\x75\x67\x68\x74\x79\x00\x42\x6f\x6c\x64\x00\x44\x6f\x63\x69\x6c\x65\x00\x52\x65\x6c"
+            "\x61\x78\x65\x64\x00\x49\x6d\x70\x69\x73\x68\x00\x4c\x61\x78\x00\x54\x69\x6d\x69\x64\x00\x48\x61\x73\x74\x79\x00\x53\x65\x72\x69"
+            "\x6f\x75\x73\x00\x4a\x6f\x6c\x6c\x79\x00\x4e\x61\x69\x76\x65\x00\x4d\x6f\x64\x65\x73\x74\x00\x4d\x69\x6c\x64\x00\x51\x75\x69\x65"
+            "\x74\x00\x42\x61\x73\x68\x66\x75\x6c\x00\x52\x61\x73\x68\x00\x43\x61\x6c\x6d\x00\x47\x65\x6e\x74\x6c\x65\x00\x53\x61\x73\x73\x79"
+            "\x00\x43\x61\x72\x65\x1f\x00\x70\x51\x75\x69\x72\x6b\x79\x00",
+            271, 270
+        },
+        // powers_en
+        {
+            "\xf0\x45\x10\x00\x00\x00\x48\x00\x00\x00\x51\x00\x00\x00\x58\x00\x00\x00\x5f\x00\x00\x00\x66\x00\x00\x00\x6b\x00\x00\x00\x6f\x00"
+            "\x00\x00\x75\x00\x00\x00\x7b\x00\x00\x00\x80\x00\x00\x00\x86\x00\x00\x00\x8c\x00\x00\x00\x95\x00\x00\x00\x9d\x00\x00\x00\xa1\x00"
+            "\x00\x00\xa8\x00\x00\x00\xad\x00\x00\x00\x46\x69\x67\x68\x74\x69\x6e\x67\x00\x46\x6c\x79\x07\x00\xf0\x46\x50\x6f\x69\x73\x6f\x6e"
+            "\x00\x47\x72\x6f\x75\x6e\x64\x00\x52\x6f\x63\x6b\x00\x42\x75\x67\x00\x47\x68\x6f\x73\x74\x00\x53\x74\x65\x65\x6c\x00\x46\x69\x72"
+            "\x65\x00\x57\x61\x74\x65\x72\x00\x47\x72\x61\x73\x73\x00\x45\x6c\x65\x63\x74\x72\x69\x63\x00\x50\x73\x79\x63\x68\x69\x63\x00\x49"
+            "\x63\x65\x00\x44\x72\x61\x67\x6f\x6e\x00\x44\x61\x72\x6b\x00",
+            175, 173
+        },
+        // rse_en
+        {
+            "\xf3\xff\x69\x56\x00\x00\x00\x60\x01\x00\x00\x6d\x01\x00\x00\x7d\x01\x00\x00\x8c\x01\x00\x00\x9b\x01\x00\x00\xa9\x01\x00\x00\xb7"
+            "\x01\x00\x00\xc7\x01\x00\x00\xd8\x01\x00\x00\xe2\x01\x00\x00\xec\x01\x00\x00\xf6\x01\x00\x00\x00\x02\x00\x00\x0a\x02\x00\x00\x14"
+            "\x02\x00\x00\x1e\x02\x00\x00\x28\x02\x00\x00\x32\x02\x00\x00\x3c\x02\x00\x00\x46\x02\x00\x00\x50\x02\x00\x00\x5a\x02\x00\x00\x64"
+            "\x02\x00\x00\x6e\x02\x00\x00\x78\x02\x00\x00\x82\x02\x00\x00\x8c\x02\x00\x00\x96\x02\x00\x00\xa0\x02\x00\x00\xaa\x02\x00\x00\xb4"
+            "\x02\x00\x00\xbe\x02\x00\x00\xc8\x02\x00\x00\xd2\x02\x00\x00\xdc\x02\x00\x00\xe6\x02\x00\x00\xf0\x02\x00\x00\xfa\x02\x00\x00\x04"
+            "\x03\x00\x00\x0e\x03\x00\x00\x18\x03\x00\x00\x22\x03\x00\x00\x2c\x03\x00\x00\x43\x03\x00\x00\x5a\x03\x00\x00\x6a\x03\x00\x00\x85"
+            "\x03\x00\x00\x96\x03\x00\x00\xa7\x03\x00\x00\xba\x03\x00\x00\xcd\x03\x00\x00\xe0\x03\x00\x00\xf3\x03\x00\x00\x06\x04\x00\x00\x19"
+            "\x04\x00\x00\x29\x04\x00\x00\x38\x04\x00\x00\x47\x04\x00\x00\x5f\x04\x00\x00\x77\x04\x00\x00\x8a\x04\x00\x00\x9d\x04\x00\x00\xb1"
+            "\x04\x00\x00\xc5\x04\x00\x00\xe0\x04\x00\x00\xef\x04\x00\x00\xfe\x04\x00\x00\x10\x05\x00\x00\x20\x05\x00\x00\x2b\x05\x00\x00\x3f"
+            "\x05\x00\x00\x4f\x05\x00\x00\x5f\x05\x00\x00\x70\x05\x00\x00\x81\x05\x00\x00\x99\x05\x00\x00\xa8\x05\x00\x00\xb3\x05\x00\x00\xbf"
+            "\x05\x00\x00\xcd\x05\x00\x00\xdb\x05\x00\x00\xe9\x05\x00\x00\xf7\x05\x00\x00\x04\x06\x00\x00\x11\x06\x00\x00\x22\x06\x00\x00\x30"
+            "\x06\x00\x00\x44\x65\x77\x66\x6f\x72\x64\x20\x54\x6f\x77\x6e\x00\x50\x61\x63\x69\x66\x69\x64\x6c\x6f\x67\x10\x00\xf2\x08\x65\x74"
+            "\x61\x6c\x62\x75\x72\x67\x20\x43\x69\x74\x79\x00\x53\x6c\x61\x74\x65\x70\x6f\x72\x74\x0f\x00\x82\x4c\x69\x6c\x79\x63\x6f\x76\x65"
+            "\x0e\x00\x83\x4d\x6f\x73\x73\x64\x65\x65\x70\x2b\x00\x92\x6f\x6f\x74\x6f\x70\x6f\x6c\x69\x73\x10\x00\xa3\x45\x76\x65\x72\x20\x47"
+            "\x72\x61\x6e\x64\x2f\x00\x95\x52\x6f\x75\x74\x65\x20\x31\x30\x31\x0a\x00\x15\x32\x0a\x00\x15\x33\x0a\x00\x15\x34\x0a\x00\x15\x35"
+            "\x0a\x00\x15\x36\x0a\x00\x15\x37\x0a\x00\x15\x38\x0a\x00\x14\x39\x0a\x00\x25\x31\x30\x0a\x00\x05\x64\x00\x15\x31\x64\x00\x15\x31"
+            "\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x32\x64\x00\x15\x32"
+            "\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32"
+            "\x64\x00\x15\x33\x64\x00\x15\x33\x64\x00\x15\x33\x64\x00\x15\x33\x64\x00\xf5\x00\x33\x34\x00\x55\x6e\x64\x65\x72\x77\x61\x74\x65"
+            "\x72\x20\x28\x7a\x00\x1f\x29\x17\x00\x02\x30\x36\x29\x00\x8e\x01\xba\x69\x74\x65\x20\x43\x61\x76\x65\x20\x31\x46\x10\x00\xda\x53"
+            "\x74\x65\x76\x65\x6e\x27\x73\x20\x52\x6f\x6f\x6d\x1b\x00\x1c\x42\x2c\x00\xfe\x07\x42\x32\x46\x00\x53\x61\x66\x61\x72\x69\x20\x5a"
+            "\x6f\x6e\x65\x20\x41\x72\x65\x61\x20\x31\x13\x00\x1e\x32\x13\x00\x1e\x33\x13\x00\x1e\x34\x13\x00\x1e\x35\x13\x00\x17\x36\x9c\x02"
+            "\xfb\x2c\x57\x6f\x6f\x64\x73\x00\x52\x75\x73\x74\x75\x72\x66\x20\x54\x75\x6e\x6e\x65\x6c\x00\x41\x62\x61\x6e\x64\x6f\x6e\x65\x64"
+            "\x20\x53\x68\x69\x70\x00\x4e\x65\x77\x20\x4d\x61\x75\x76\x69\x6c\x6c\x65\x20\x28\x45\x6e\x74\x72\x61\x6e\x63\x65\x29\x18\x00\xfd"
+            "\x0d\x42\x61\x73\x65\x6d\x65\x6e\x74\x29\x00\x4d\x65\x74\x65\x6f\x72\x20\x46\x61\x6c\x6c\x73\x20\x31\x46\x20\x31\x52\x13\x00\x1b"
+            "\x32\x13\x00\x1f\x42\x27\x00\x00\x00\x14\x00\x0c\x28\x00\x05\x5b\x01\x00\x3d\x01\x80\x00\x4d\x74\x2e\x20\x50\x79\x72\x82\x01\x36"
+            "\x2d\x33\x46\x0f\x00\x47\x34\x46\x2d\x36\x0f\x00\x86\x45\x78\x74\x65\x72\x69\x6f\x72\x12\x00\xc2\x53\x75\x6d\x6d\x69\x74\x00\x53"
+            "\x68\x6f\x61\x6c\x4b\x00\x06\x0b\x00\x42\x20\x49\x63\x65\xba\x01\x81\x53\x65\x61\x66\x6c\x6f\x6f\x72\x17\x00\xf0\x00\x72\x6e\x00"
+            "\x56\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\xf5\x01\x09\x10\x00\x00\xda\x01\x0a\x11\x00\x31\x32\x46\x00\x50\x00\xa4\x6f\x66"
+            "\x20\x4f\x72\x69\x67\x69\x6e\x20\x3b\x01\x0b\x18\x00\xf0\x13\x00\x46\x69\x65\x72\x79\x20\x50\x61\x74\x68\x00\x4a\x61\x67\x67\x65"
+            "\x64\x20\x50\x61\x73\x73\x00\x53\x6b\x79\x20\x50\x69\x6c\x6c\x61\x72\x6e\x00\x07\x0e\x00\x19\x33\x0e\x00\xf0\x08\x35\x46\x00\x4d"
+            "\x61\x67\x6d\x61\x20\x48\x69\x64\x65\x6f\x75\x74\x00\x4d\x69\x72\x61\x67\x65\x86\x04\xa2\x65\x72\x00\x41\x72\x74\x69\x73\x61\x6e"
+            "\xe6\x00\x71\x44\x65\x73\x65\x72\x74\x20\xd5\x02\x10\x70\x63\x00\x20\x41\x6c\x1b\x01\x22\x6e\x67\x1f\x00\x00",
+            1051, 1584
+        },
+        // species_en
+        {
+            "\xf1\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xae\x27\x03\x00\x00\xa4\x0c\x00\x00\xae\x0c\x00\x00\xb6\x0c\x00\x00\xbf\x0c"
+            "\x00\x00\xca\x0c\x00\x00\xd5\x0c\x00\x00\xdf\x0c\x00\x00\xe8\x0c\x00\x00\xf2\x0c\x00\x00\xfc\x0c\x00\x00\x05\x0d\x00\x00\x0d\x0d"
+            "\x00\x00\x18\x0d\x00\x00\x1f\x0d\x00\x00\x26\x0d\x00\x00\x2f\x0d\x00\x00\x36\x0d\x00\x00\x40\x0d\x00\x00\x48\x0d\x00\x00\x50\x0d"
+            "\x00\x00\x59\x0d\x00\x00\x61\x0d\x00\x00\x68\x0d\x00\x00\x6e\x0d\x00\x00\x74\x0d\x00\x00\x7c\x0d\x00\x00\x83\x0d\x00\x00\x8d\x0d"
+            "\x00\x00\x97\x0d\x00\x00\xa2\x0d\x00\x00\xab\x0d\x00\x00\xb5\x0d\x00\x00\xc0\x0d\x00\x00\xc9\x0d\x00\x00\xd2\x0d\x00\x00\xdb\x0d"
+            "\x00\x00\xe4\x0d\x00\x00\xeb\x0d\x00\x00\xf5\x0d\x00\x00\x00\x0e\x00\x00\x0b\x0e\x00\x00\x11\x0e\x00\x00\x18\x0e\x00\x00\x1f\x0e"
+            "\x00\x00\x25\x0e\x00\x00\x2f\x0e\x00\x00\x35\x0e\x00\x00\x3e\x0e\x00\x00\x46\x0e\x00\x00\x4f\x0e\x00\x00\x57\x0e\x00\x00\x5f\x0e"
+            "\x00\x00\x66\x0e\x00\x00\x6e\x0e\x00\x00\x76\x0e\x00\x00\x7e\x0e\x00\x00\x85\x0e\x00\x00\x8e\x0e\x00\x00\x98\x0e\x00\x00\xa1\x0e"
+            "\x00\x00\xa9\x0e\x00\x00\xb3\x0e\x00\x00\xbd\x0e\x00\x00\xc2\x0e\x00\x00\xca\x0e\x00\x00\xd3\x0e\x00\x00\xda\x0e\x00\x00\xe2\x0e"
+            "\x00\x00\xea\x0e\x00\x00\xf5\x0e\x00\x00\x00\x0f\x00\x00\x0b\x0f\x00\x00\x15\x0f\x00\x00\x20\x0f\x00\x00\x28\x0f\x00\x00\x31\x0f"
+            "\x00\x00\x37\x0f\x00\x00\x3e\x0f\x00\x00\x47\x0f\x00\x00\x50\x0f\x00\x00\x58\x0f\x00\x00\x62\x0f\x00\x00\x6b\x0f\x00\x00\x78\x0f"
+            "\x00\x00\x7e\x0f\x00\x00\x85\x0f\x00\x00\x8a\x0f\x00\x00\x92\x0f\x00\x00\x99\x0f\x00\x00\x9d\x0f\x00\x00\xa6\x0f\x00\x00\xaf\x0f"
+            "\x00\x00\xb6\x0f\x00\x00\xbe\x0f\x00\x00\xc5\x0f\x00\x00\xca\x0f\x00\x00\xd2\x0f\x00\x00\xd8\x0f\x00\x00\xdf\x0f\x00\x00\xe7\x0f"
+            "\x00\x00\xef\x0f\x00\x00\xf9\x0f\x00\x00\x03\x10\x00\x00\x0d\x10\x00\x00\x14\x10\x00\x00\x1c\x10\x00\x00\x26\x10\x00\x00\x31\x10"
+            "\x00\x00\x3b\x10\x00\x00\x43\x10\x00\x00\x4b\x10\x00\x00\x53\x10\x00\x00\x5a\x10\x00\x00\x62\x10\x00\x00\x6a\x10\x00\x00\x75\x10"
+            "\x00\x00\x7c\x10\x00\x00\x83\x10\x00\x00\x8b\x10\x00\x00\x93\x10\x00\x00\x9a\x10\x00\x00\xa2\x10\x00\x00\xab\x10\x00\x00\xb3\x10"
+            "\x00\x00\xb8\x10\x00\x00\xc3\x10\x00\x00\xca\x10\x00\x00\xd1\x10\x00\x00\xd8\x10\x00\x00\xe1\x10\x00\x00\xea\x10\x00\x00\xf1\x10"
+            "\x00\x00\xf7\x10\x00\x00\xfd\x10\x00\x00\x06\x11\x00\x00\x0e\x11\x00\x00\x16\x11\x00\x00\x1e\x11\x00\x00\x26\x11\x00\x00\x2e\x11"
+            "\x00\x00\x35\x11\x00\x00\x3e\x11\x00\x00\x49\x11\x00\x00\x51\x11\x00\x00\x5a\x11\x00\x00\x61\x11\x00\x00\x69\x11\x00\x00\x71\x11"
+            "\x00\x00\x7b\x11\x00\x00\x85\x11\x00\x00\x8c\x11\x00\x00\x90\x11\x00\x00\x9a\x11\x00\x00\xa2\x11\x00\x00\xab\x11\x00\x00\xb5\x11"
+            "\x00\x00\xbd\x11\x00\x00\xc8\x11\x00\x00\xd1\x11\x00\x00\xda\x11\x00\x00\xe5\x11\x00\x00\xed\x11\x00\x00\xf4\x11\x00\x00\xfd\x11"
+            "\x00\x00\x05\x12\x00\x00\x0c\x12\x00\x00\x13\x12\x00\x00\x1c\x12\x00\x00\x24\x12\x00\x00\x2b\x12\x00\x00\x34\x12\x00\x00\x3c\x12"
+            "\x00\x00\x42\x12\x00\x00\x49\x12\x00\x00\x53\x12\x00\x00\x5a\x12\x00\x00\x62\x12\x00\x00\x67\x12\x00\x00\x6c\x12\x00\x00\x73\x12"
+            "\x00\x00\x7b\x12\x00\x00\x84\x12\x00\x00\x8e\x12\x00\x00\x95\x12\x00\x00\x9f\x12\x00\x00\xa9\x12\x00\x00\xb2\x12\x00\x00\xb9\x12"
+            "\x00\x00\xc2\x12\x00\x00\xcb\x12\x00\x00\xd1\x12\x00\x00\xd9\x12\x00\x00\xe2\x12\x00\x00\xe8\x12\x00\x00\xef\x12\x00\x00\xf8\x12"
+            "\x00\x00\xff\x12\x00\x00\x07\x13\x00\x00\x0f\x13\x00\x00\x18\x13\x00\x00\x23\x13\x00\x00\x29\x13\x00\x00\x33\x13\x00\x00\x3d\x13"
+            "\x00\x00\x44\x13\x00\x00\x4f\x13\x00\x00\x59\x13\x00\x00\x60\x13\x00\x00\x68\x13\x00\x00\x71\x13\x00\x00\x7a\x13\x00\x00\x83\x13"
+            "\x00\x00\x8a\x13\x00\x00\x92\x13\x00\x00\x9c\x13\x00\x00\xa4\x13\x00\x00\xae\x13\x00\x00\xb7\x13\x00\x00\xbe\x13\x00\x00\xc7\x13"
+            "\x00\x00\xce\x13\x00\x00\xd8\x13\x00\x00\xe0\x13\x00\x00\xe9\x13\x00\x00\xf3\x13\x00\x00\xfc\x13\x00\x00\x04\x14\x00\x00\x0d\x14"
+            "\x00\x00\x16\x14\x00\x00\x1f\x14\x00\x00\x27\x14\x00\x00\x2e\x14\x00\x00\x36\x14\x00\x00\x3f\x14\x00\x00\x48\x14\x00\x00\x51\x14"
+            "\x00\x00\x59\x14\x00\x00\x63\x14\x00\x00\x6c\x14\x00\x00\x73\x14\x00\x00\x79\x14\x00\x00\x81\x14\x00\x00\x89\x14\x00\x00\x90\x14"
+            "\x00\x00\x96\x14\x00\x00\x9e\x14\x00\x00\xa7\x14\x00\x00\xaf\x14\x00\x00\xb9\x14\x00\x00\xbf\x14\x00\x00\xc5\x14\x00\x00\xcc\x14"
+            "\x00\x00\xd4\x14\x00\x00\xdc\x14\x00\x00\xe5\x14\x00\x00\xed\x14\x00\x00\xf7\x14\x00\x00\x00\x15\x00\x00\x07\x15\x00\x00\x11\x15"
+            "\x00\x00\x1a\x15\x00\x00\x24\x15\x00\x00\x2e\x15\x00\x00\x38\x15\x00\x00\x40\x15\x00\x00\x48\x15\x00\x00\x50\x15\x00\x00\x5a\x15"
+            "\x00\x00\x62\x15\x00\x00\x69\x15\x00\x00\x6f\x15\x00\x00\x76\x15\x00\x00\x7f\x15\x00\x00\x86\x15\x00\x00\x8e\x15\x00\x00\x96\x15"
+            "\x00\x00\x9e\x15\x00\x00\xa6\x15\x00\x00\xae\x15\x00\x00\xb7\x15\x00\x00\xbd\x15\x00\x00\xc4\x15\x00\x00\xce\x15\x00\x00\xd6\x15"
+            "\x00\x00\xe1\x15\x00\x00\xeb\x15\x00\x00\xf3\x15\x00\x00\xfb\x15\x00\x00\x04\x16\x00\x00\x0c\x16\x00\x00\x14\x16\x00\x00\x1c\x16"
+            "\x00\x00\x25\x16\x00\x00\x2d\x16\x00\x00\x35\x16\x00\x00\x3d\x16\x00\x00\x46\x16\x00\x00\x4f\x16\x00\x00\x57\x16\x00\x00\x60\x16"
+            "\x00\x00\x67\x16\x00\x00\x70\x16\x00\x00\x78\x16\x00\x00\x7f\x16\x00\x00\x84\x16\x00\x00\x8b\x16\x00\x00\x92\x16\x00\x00\x9b\x16"
+            "\x00\x00\xa4\x16\x00\x00\xae\x16\x00\x00\xb8\x16\x00\x00\xbf\x16\x00\x00\xc5\x16\x00\x00\xcd\x16\x00\x00\xd6\x16\x00\x00\xde\x16"
+            "\x00\x00\xe5\x16\x00\x00\xec\x16\x00\x00\xf5\x16\x00\x00\xfe\x16\x00\x00\x06\x17\x00\x00\x0e\x17\x00\x00\x14\x17\x00\x00\x1d\x17"
+            "\x00\x00\x25\x17\x00\x00\x2c\x17\x00\x00\x34\x17\x00\x00\x3b\x17\x00\x00\x44\x17\x00\x00\x4c\x17\x00\x00\x53\x17\x00\x00\x5a\x17"
+            "\x00\x00\x63\x17\x00\x00\x6a\x17\x00\x00\x72\x17\x00\x00\x7b\x17\x00\x00\x83\x17\x00\x00\x8c\x17\x00\x00\x94\x17\x00\x00\x9d\x17"
+            "\x00\x00\xa6\x17\x00\x00\xaf\x17\x00\x00\xb9\x17\x00\x00\xc0\x17\x00\x00\xc8\x17\x00\x00\xcf\x17\x00\x00\xd7\x17\x00\x00\xdf\x17"
+            "\x00\x00\xe7\x17\x00\x00\xee\x17\x00\x00\xf6\x17\x00\x00\xff\x17\x00\x00\x07\x18\x00\x00\x0f\x18\x00\x00\x17\x18\x00\x00\x1f\x18"
+            "\x00\x00\x28\x18\x00\x00\x30\x18\x00\x00\x39\x18\x00\x00\x3f\x18\x00\x00\x46\x18\x00\x00\x4e\x18\x00\x00\x55\x18\x00\x00\x5c\x18"
+            "\x00\x00\x63\x18\x00\x00\x6b\x18\x00\x00\x74\x18\x00\x00\x7c\x18\x00\x00\x85\x18\x00\x00\x8f\x18\x00\x00\x97\x18\x00\x00\x9d\x18"
+            "\x00\x00\xa5\x18\x00\x00\xaf\x18\x00\x00\xb6\x18\x00\x00\xbd\x18\x00\x00\xc7\x18\x00\x00\xd0\x18\x00\x00\xd7\x18\x00\x00\xe1\x18"
+            "\x00\x00\xe8\x18\x00\x00\xef\x18\x00\x00\xf6\x18\x00\x00\xfe\x18\x00\x00\x07\x19\x00\x00\x0f\x19\x00\x00\x16\x19\x00\x00\x1e\x19"
+            "\x00\x00\x25\x19\x00\x00\x2e\x19\x00\x00\x37\x19\x00\x00\x40\x19\x00\x00\x4a\x19\x00\x00\x51\x19\x00\x00\x5a\x19\x00\x00\x63\x19"
+            "\x00\x00\x6a\x19\x00\x00\x73\x19\x00\x00\x7d\x19\x00\x00\x84\x19\x00\x00\x8c\x19\x00\x00\x96\x19\x00\x00\xa1\x19\x00\x00\xa7\x19"
+            "\x00\x00\xad\x19\x00\x00\xb4\x19\x00\x00\xba\x19\x00\x00\xc3\x19\x00\x00\xcc\x19\x00\x00\xd6\x19\x00\x00\xdf\x19\x00\x00\xe9\x19"
+            "\x00\x00\xef\x19\x00\x00\xf8\x19\x00\x00\xff\x19\x00\x00\x06\x1a\x00\x00\x10\x1a\x00\x00\x1a\x1a\x00\x00\x21\x1a\x00\x00\x2a\x1a"
+            "\x00\x00\x32\x1a\x00\x00\x3a\x1a\x00\x00\x42\x1a\x00\x00\x4c\x1a\x00\x00\x54\x1a\x00\x00\x5d\x1a\x00\x00\x66\x1a\x00\x00\x6e\x1a"
+            "\x00\x00\x76\x1a\x00\x00\x80\x1a\x00\x00\x8a\x1a\x00\x00\x92\x1a\x00\x00\x9a\x1a\x00\x00\xa4\x1a\x00\x00\xab\x1a\x00\x00\xb4\x1a"
+            "\x00\x00\xbc\x1a\x00\x00\xc5\x1a\x00\x00\xcc\x1a\x00\x00\xd5\x1a\x00\x00\xdd\x1a\x00\x00\xe4\x1a\x00\x00\xee\x1a\x00\x00\xf4\x1a"
+            "\x00\x00\xfb\x1a\x00\x00\x04\x1b\x00\x00\x0d\x1b\x00\x00\x13\x1b\x00\x00\x1b\x1b\x00\x00\x26\x1b\x00\x00\x30\x1b\x00\x00\x38\x1b"
+            "\x00\x00\x40\x1b\x00\x00\x49\x1b\x00\x00\x53\x1b\x00\x00\x5d\x1b\x00\x00\x65\x1b\x00\x00\x6e\x1b\x00\x00\x76\x1b\x00\x00\x7d\x1b"
+            "\x00\x00\x87\x1b\x00\x00\x8f\x1b\x00\x00\x99\x1b\x00\x00\xa4\x1b\x00\x00\xae\x1b\x00\x00\xb8\x1b\x00\x00\xc3\x1b\x00\x00\xcd\x1b"
+            "\x00\x00\xd6\x1b\x00\x00\xde\x1b\x00\x00\xe6\x1b\x00\x00\xee\x1b\x00\x00\xf6\x1b\x00\x00\x00\x1c\x00\x00\x0a\x1c\x00\x00\x12\x1c"
+            "\x00\x00\x1c\x1c\x00\x00\x25\x1c\x00\x00\x2e\x1c\x00\x00\x34\x1c\x00\x00\x39\x1c\x00\x00\x41\x1c\x00\x00\x47\x1c\x00\x00\x4e\x1c"
+            "\x00\x00\x55\x1c\x00\x00\x5d\x1c\x00\x00\x67\x1c\x00\x00\x70\x1c\x00\x00\x7a\x1c\x00\x00\x81\x1c\x00\x00\x89\x1c\x00\x00\x91\x1c"
+            "\x00\x00\x99\x1c\x00\x00\xa0\x1c\x00\x00\xa8\x1c\x00\x00\xae\x1c\x00\x00\xb6\x1c\x00\x00\xc0\x1c\x00\x00\xc6\x1c\x00\x00\xce\x1c"
+            "\x00\x00\xd5\x1c\x00\x00\xde\x1c\x00\x00\xe5\x1c\x00\x00\xee\x1c\x00\x00\xf5\x1c\x00\x00\xfd\x1c\x00\x00\x06\x1d\x00\x00\x0e\x1d"
+            "\x00\x00\x18\x1d\x00\x00\x21\x1d\x00\x00\x29\x1d\x00\x00\x31\x1d\x00\x00\x3a\x1d\x00\x00\x42\x1d\x00\x00\x4b\x1d\x00\x00\x53\x1d"
+            "\x00\x00\x5c\x1d\x00\x00\x62\x1d\x00\x00\x6b\x1d\x00\x00\x72\x1d\x00\x00\x7c\x1d\x00\x00\x85\x1d\x00\x00\x8d\x1d\x00\x00\x97\x1d"
+            "\x00\x00\xa2\x1d\x00\x00\xaa\x1d\x00\x00\xb3\x1d\x00\x00\xba\x1d\x00\x00\xc2\x1d\x00\x00\xca\x1d\x00\x00\xd4\x1d\x00\x00\xdb\x1d"
+            "\x00\x00\xe3\x1d\x00\x00\xeb\x1d\x00\x00\xf6\x1d\x00\x00\xfe\x1d\x00\x00\x08\x1e\x00\x00\x13\x1e\x00\x00\x19\x1e\x00\x00\x1e\x1e"
+            "\x00\x00\x27\x1e\x00\x00\x30\x1e\x00\x00\x39\x1e\x00\x00\x42\x1e\x00\x00\x4d\x1e\x00\x00\x57\x1e\x00\x00\x60\x1e\x00\x00\x6b\x1e"
+            "\x00\x00\x73\x1e\x00\x00\x7d\x1e\x00\x00\x86\x1e\x00\x00\x8e\x1e\x00\x00\x97\x1e\x00\x00\xa2\x1e\x00\x00\xab\x1e\x00\x00\xb6\x1e"
+            "\x00\x00\xbf\x1e\x00\x00\xc7\x1e\x00\x00\xcf\x1e\x00\x00\xd7\x1e\x00\x00\xdf\x1e\x00\x00\xe8\x1e\x00\x00\xef\x1e\x00\x00\xfa\x1e"
+            "\x00\x00\x03\x1f\x00\x00\x0e\x1f\x00\x00\x15\x1f\x00\x00\x1e\x1f\x00\x00\x27\x1f\x00\x00\x30\x1f\x00\x00\x36\x1f\x00\x00\x3e\x1f"
+            "\x00\x00\x47\x1f\x00\x00\x50\x1f\x00\x00\x58\x1f\x00\x00\x62\x1f\x00\x00\x6d\x1f\x00\x00\x75\x1f\x00\x00\x7d\x1f\x00\x00\x87\x1f"
+            "\x00\x00\x90\x1f\x00\x00\x97\x1f\x00\x00\xa1\x1f\x00\x00\xab\x1f\x00\x00\xb5\x1f\x00\x00\xbe\x1f\x00\x00\xc7\x1f\x00\x00\xce\x1f"
+            "\x00\x00\xd9\x1f\x00\x00\xe4\x1f\x00\x00\xec\x1f\x00\x00\xf6\x1f\x00\x00\xff\x1f\x00\x00\x09\x20\x00\x00\x13\x20\x00\x00\x1a\x20"
+            "\x00\x00\x25\x20\x00\x00\x2f\x20\x00\x00\x3a\x20\x00\x00\x40\x20\x00\x00\x46\x20\x00\x00\x50\x20\x00\x00\x57\x20\x00\x00\x61\x20"
+            "\x00\x00\x6c\x20\x00\x00\x73\x20\x00\x00\x7c\x20\x00\x00\x84\x20\x00\x00\x8c\x20\x00\x00\x97\x20\x00\x00\x9c\x20\x00\x00\xa4\x20"
+            "\x00\x00\xac\x20\x00\x00\xb4\x20\x00\x00\xbc\x20\x00\x00\xc6\x20\x00\x00\xce\x20\x00\x00\xd7\x20\x00\x00\xe0\x20\x00\x00\xe8\x20"
+            "\x00\x00\xf1\x20\x00\x00\xfb\x20\x00\x00\x02\x21\x00\x00\x09\x21\x00\x00\x12\x21\x00\x00\x1a\x21\x00\x00\x25\x21\x00\x00\x2d\x21"
+            "\x00\x00\x36\x21\x00\x00\x3e\x21\x00\x00\x48\x21\x00\x00\x50\x21\x00\x00\x57\x21\x00\x00\x5d\x21\x00\x00\x66\x21\x00\x00\x70\x21"
+            "\x00\x00\x79\x21\x00\x00\x83\x21\x00\x00\x8c\x21\x00\x00\x96\x21\x00\x00\x9f\x21\x00\x00\xa8\x21\x00\x00\xb2\x21\x00\x00\xbb\x21"
+            "\x00\x00\xc2\x21\x00\x00\xcb\x21\x00\x00\xd2\x21\x00\x00\xd9\x21\x00\x00\xe2\x21\x00\x00\xeb\x21\x00\x00\xf3\x21\x00\x00\xfd\x21"
+            "\x00\x00\x08\x22\x00\x00\x11\x22\x00\x00\x19\x22\x00\x00\x21\x22\x00\x00\x29\x22\x00\x00\x33\x22\x00\x00\x3c\x22\x00\x00\x45\x22"
+            "\x00\x00\x4f\x22\x00\x00\x5a\x22\x00\x00\x66\x22\x00\x00\x71\x22\x00\x00\x7c\x22\x00\x00\x83\x22\x00\x00\x8c\x22\x00\x00\x93\x22"
+            "\x00\x00\x9a\x22\x00\x00\xa4\x22\x00\x00\xac\x22\x00\x00\xb4\x22\x00\x00\xbb\x22\x00\x00\xc2\x22\x00\x00\xca\x22\x00\x00\xd2\x22"
+            "\x00\x00\xda\x22\x00\x00\xe1\x22\x00\x00\xea\x22\x00\x00\xf2\x22\x00\x00\xfb\x22\x00\x00\x05\x23\x00\x00\x0e\x23\x00\x00\x19\x23"
+            "\x00\x00\x21\x23\x00\x00\x2a\x23\x00\x00\x30\x23\x00\x00\x38\x23\x00\x00\x40\x23\x00\x00\x4b\x23\x00\x00\x52\x23\x00\x00\x5b\x23"
+            "\x00\x00\x65\x23\x00\x00\x6f\x23\x00\x00\x7a\x23\x00\x00\x84\x23\x00\x00\x8b\x23\x00\x00\x95\x23\x00\x00\x9c\x23\x00\x00\xa4\x23"
+            "\x00\x00\xac\x23\x00\x00\xb5\x23\x00\x00\xbd\x23\x00\x00\xc5\x23\x00\x00\xcb\x23\x00\x00\xd3\x23\x00\x00\xda\x23\x00\x00\xe1\x23"
+            "\x00\x00\xea\x23\x00\x00\xf4\x23\x00\x00\xfe\x23\x00\x00\x08\x24\x00\x00\x11\x24\x00\x00\x19\x24\x00\x00\x20\x24\x00\x00\x28\x24"
+            "\x00\x00\x30\x24\x00\x00\x38\x24\x00\x00\x40\x24\x00\x00\x48\x24\x00\x00\x4e\x24\x00\x00\x58\x24\x00\x00\x5f\x24\x00\x00\x67\x24"
+            "\x00\x00\x71\x24\x00\x00\x78\x24\x00\x00\x81\x24\x00\x00\x8c\x24\x00\x00\x94\x24\x00\x00\x9c\x24\x00\x00\xa6\x24\x00\x00\xae\x24"
+            "\x00\x00\xb7\x24\x00\x00\xc1\x24\x00\x00\xc9\x24\x00\x00\xd2\x24\x00\x00\xda\x24\x00\x00\xe4\x24\x00\x00\xed\x24\x00\x00\xf8\x24"
+            "\x00\x00\x05\x25\x00\x00\x0e\x25\x00\x00\x17\x25\x00\x00\x20\x25\x00\x00\x29\x25\x00\x00\x32\x25\x00\x00\x3d\x25\x00\x00\x46\x25"
+            "\x00\x00\x4e\x25\x00\x00\x56\x25\x00\x00\x5f\x25\x00\x00\x68\x25\x00\x00\x72\x25\x00\x00\x7b\x25\x00\x00\x84\x25\x00\x00\x8d\x25"
+            "\x00\x00\x97\x25\x00\x00\xa0\x25\x00\x00\xa9\x25\x00\x00\xb1\x25\x00\x00\xb8\x25\x00\x00\xc2\x25\x00\x00\xca\x25\x00\x00\xd3\x25"
+            "\x00\x00\xda\x25\x00\x00\xe3\x25\x00\x00\xed\x25\x00\x00\xf4\x25\x00\x00\xfe\x25\x00\x00\x08\x26\x00\x00\x12\x26\x00\x00\x1c\x26"
+            "\x00\x00\x27\x26\x00\x00\x30\x26\x00\x00\x37\x26\x00\x00\x3e\x26\x00\x00\x49\x26\x00\x00\x54\x26\x00\x00\x5c\x26\x00\x00\x64\x26"
+            "\x00\x00\x6b\x26\x00\x00\x74\x26\x00\x00\x7d\x26\x00\x00\x86\x26\x00\x00\x8e\x26\x00\x00\x98\x26\x00\x00\xa2\x26\x00\x00\xac\x26"
+            "\x00\x00\xb6\x26\x00\x00\xbd\x26\x00\x00\xc5\x26\x00\x00\xce\x26\x00\x00\xd5\x26\x00\x00\xde\x26\x00\x00\xe7\x26\x00\x00\xf1\x26"
+            "\x00\x00\xfb\x26\x00\x00\x06\x27\x00\x00\x0e\x27\x00\x00\x17\x27\x00\x00\x20\x27\x00\x00\x29\x27\x00\x00\x33\x27\x00\x00\x3b\x27"
+            "\x00\x00\x45\x27\x00\x00\x4f\x27\x00\x00\x5b\x27\x00\x00\x63\x27\x00\x00\x42\x75\x6c\x62\x61\x73\x61\x75\x72\x00\x49\x76\x79\x08"
+            "\x00\x41\x56\x65\x6e\x75\x09\x00\x93\x43\x68\x61\x72\x6d\x61\x6e\x64\x65\x0b\x00\x51\x65\x6c\x65\x6f\x6e\x0b\x00\xf1\x05\x69\x7a"
+            "\x61\x72\x64\x00\x53\x71\x75\x69\x72\x74\x6c\x65\x00\x57\x61\x72\x74\x6f\x0a\x00\xf2\x34\x42\x6c\x61\x73\x74\x6f\x69\x73\x65\x00"
+            "\x43\x61\x74\x65\x72\x70\x69\x65\x00\x4d\x65\x74\x61\x70\x6f\x64\x00\x42\x75\x74\x74\x65\x72\x66\x72\x65\x65\x00\x57\x65\x65\x64"
+            "\x6c\x65\x00\x4b\x61\x6b\x75\x6e\x61\x00\x42\x65\x65\x64\x72\x69\x6c\x6c\x00\x50\x69\x64\x67\x65\x79\x07\x00\x44\x6f\x74\x74\x6f"
+            "\x0a\x00\x80\x00\x52\x61\x74\x74\x61\x74\x61\x08\x00\xf2\x00\x69\x63\x61\x74\x65\x00\x53\x70\x65\x61\x72\x6f\x77\x00\x46\x07\x00"
+            "\xf0\x08\x45\x6b\x61\x6e\x73\x00\x41\x72\x62\x6f\x6b\x00\x50\x69\x6b\x61\x63\x68\x75\x00\x52\x61\x69\x07\x00\x92\x53\x61\x6e\x64"
+            "\x73\x68\x72\x65\x77\x0a\x00\xf2\x00\x6c\x61\x73\x68\x00\x4e\x69\x64\x6f\x72\x61\x6e\xe2\x99\x80\x0b\x00\x31\x69\x6e\x61\x09\x00"
+            "\x56\x71\x75\x65\x65\x6e\x1e\x00\x14\x82\x1e\x00\x11\x6f\x09\x00\xd2\x6b\x69\x6e\x67\x00\x43\x6c\x65\x66\x61\x69\x72\x79\x09\x00"
+            "\xf1\x12\x62\x6c\x65\x00\x56\x75\x6c\x70\x69\x78\x00\x4e\x69\x6e\x65\x74\x61\x6c\x65\x73\x00\x4a\x69\x67\x67\x6c\x79\x70\x75\x66"
+            "\x66\x00\x57\x0b\x00\x10\x74\x0b\x00\x90\x5a\x75\x62\x61\x74\x00\x47\x6f\x6c\x07\x00\xf2\x0d\x4f\x64\x64\x69\x73\x68\x00\x47\x6c"
+            "\x6f\x6f\x6d\x00\x56\x69\x6c\x65\x70\x6c\x75\x6d\x65\x00\x50\x61\x72\x61\x73\x06\x00\x30\x65\x63\x74\x88\x01\x32\x6f\x6e\x61\x08"
+            "\x00\xf0\x1c\x6d\x6f\x74\x68\x00\x44\x69\x67\x6c\x65\x74\x74\x00\x44\x75\x67\x74\x72\x69\x6f\x00\x4d\x65\x6f\x77\x74\x68\x00\x50"
+            "\x65\x72\x73\x69\x61\x6e\x00\x50\x73\x79\x64\x75\x63\x6b\x65\x00\x01\x08\x00\x40\x4d\x61\x6e\x6b\x4f\x01\xf2\x13\x72\x69\x6d\x65"
+            "\x61\x70\x65\x00\x47\x72\x6f\x77\x6c\x69\x74\x68\x65\x00\x41\x72\x63\x61\x6e\x69\x6e\x65\x00\x50\x6f\x6c\x69\x77\x61\x67\x08\x00"
+            "\x42\x68\x69\x72\x6c\x0a\x00\xe0\x72\x61\x74\x68\x00\x41\x62\x72\x61\x00\x4b\x61\x64\x61\x08\x00\xf2\x00\x41\x6c\x61\x6b\x61\x7a"
+            "\x61\x6d\x00\x4d\x61\x63\x68\x6f\x70\x07\x00\x21\x6b\x65\x08\x00\xe0\x61\x6d\x70\x00\x42\x65\x6c\x6c\x73\x70\x72\x6f\x75\x74\xdd"
+            "\x01\xf4\x0c\x70\x69\x6e\x62\x65\x6c\x6c\x00\x56\x69\x63\x74\x72\x65\x65\x62\x65\x6c\x00\x54\x65\x6e\x74\x61\x63\x6f\x6f\x0a\x00"
+            "\xb0\x72\x75\x65\x6c\x00\x47\x65\x6f\x64\x75\x64\x9a\x00\x60\x61\x76\x65\x6c\x65\x72\xbb\x00\x71\x65\x6d\x00\x50\x6f\x6e\x79\xee"
+            "\x01\x30\x70\x69\x64\xb0\x01\x50\x53\x6c\x6f\x77\x70\x6e\x00\x00\x09\x00\xc0\x62\x72\x6f\x00\x4d\x61\x67\x6e\x65\x6d\x69\x74\x80"
+            "\x00\xf0\x0a\x67\x6e\x65\x74\x6f\x6e\x00\x46\x61\x72\x66\x65\x74\x63\x68\xe2\x80\x99\x64\x00\x44\x6f\x64\x75\x6f\x06\x00\x00\x26"
+            "\x01\xe0\x53\x65\x65\x6c\x00\x44\x65\x77\x67\x6f\x6e\x67\x00\x47\x0d\x01\xb1\x72\x00\x4d\x75\x6b\x00\x53\x68\x65\x6c\x6c\xdc\x02"
+            "\x50\x6c\x6f\x79\x73\x74\x7e\x00\xa1\x61\x73\x74\x6c\x79\x00\x48\x61\x75\x6e\x0f\x00\xf0\x15\x65\x6e\x67\x61\x72\x00\x4f\x6e\x69"
+            "\x78\x00\x44\x72\x6f\x77\x7a\x65\x65\x00\x48\x79\x70\x6e\x6f\x00\x4b\x72\x61\x62\x62\x79\x00\x4b\x69\x6e\x67\xb6\x00\xf3\x0b\x56"
+            "\x6f\x6c\x74\x6f\x72\x62\x00\x45\x6c\x65\x63\x74\x72\x6f\x64\x65\x00\x45\x78\x65\x67\x67\x63\x75\x74\x0a\x00\xa0\x75\x74\x6f\x72"
+            "\x00\x43\x75\x62\x6f\x6e\xb2\x00\xd0\x72\x6f\x77\x61\x6b\x00\x48\x69\x74\x6d\x6f\x6e\x6c\x54\x00\x01\x0a\x00\xf0\x04\x63\x68\x61"
+            "\x6e\x00\x4c\x69\x63\x6b\x69\x74\x75\x6e\x67\x00\x4b\x6f\x66\x66\x71\x02\x40\x57\x65\x65\x7a\x08\x00\x70\x52\x68\x79\x68\x6f\x72"
+            "\x6e\x08\x00\x12\x64\x85\x03\xb0\x6e\x73\x65\x79\x00\x54\x61\x6e\x67\x65\x6c\xa8\x01\x50\x6e\x67\x61\x73\x6b\x44\x00\xd1\x48\x6f"
+            "\x72\x73\x65\x61\x00\x53\x65\x61\x64\x72\x61\x0d\x02\x00\xd6\x02\x31\x53\x65\x61\xc1\x02\x61\x53\x74\x61\x72\x79\x75\x07\x00\x10"
+            "\x6d\x9d\x03\xf2\x05\x72\x2e\x20\x4d\x69\x6d\x65\x00\x53\x63\x79\x74\x68\x65\x72\x00\x4a\x79\x6e\x78\xc9\x00\x50\x61\x62\x75\x7a"
+            "\x7a\x61\x01\xf0\x02\x6d\x61\x72\x00\x50\x69\x6e\x73\x69\x72\x00\x54\x61\x75\x72\x6f\x73\x15\x00\xf0\x03\x69\x6b\x61\x72\x70\x00"
+            "\x47\x79\x61\x72\x61\x64\x6f\x73\x00\x4c\x61\x70\xbc\x02\x20\x44\x69\xb7\x03\xb0\x45\x65\x76\x65\x65\x00\x56\x61\x70\x6f\x72\x31"
+            "\x04\x40\x4a\x6f\x6c\x74\x08\x00\x31\x46\x6c\x61\x10\x00\xf0\x00\x50\x6f\x72\x79\x67\x6f\x6e\x00\x4f\x6d\x61\x6e\x79\x74\x65\x08"
+            "\x00\xb3\x73\x74\x61\x72\x00\x4b\x61\x62\x75\x74\x6f\x07\x00\xf0\x13\x70\x73\x00\x41\x65\x72\x6f\x64\x61\x63\x74\x79\x6c\x00\x53"
+            "\x6e\x6f\x72\x6c\x61\x78\x00\x41\x72\x74\x69\x63\x75\x6e\x6f\x00\x5a\x61\x70\x77\x00\xf0\x00\x4d\x6f\x6c\x74\x72\x65\x73\x00\x44"
+            "\x72\x61\x74\x69\x6e\x69\x08\x00\x63\x67\x6f\x6e\x61\x69\x72\x0a\x00\x01\x23\x02\x40\x65\x77\x74\x77\x2d\x03\xf0\x3b\x77\x00\x43"
+            "\x68\x69\x6b\x6f\x72\x69\x74\x61\x00\x42\x61\x79\x6c\x65\x65\x66\x00\x4d\x65\x67\x61\x6e\x69\x75\x6d\x00\x43\x79\x6e\x64\x61\x71"
+            "\x75\x69\x6c\x00\x51\x75\x69\x6c\x61\x76\x61\x00\x54\x79\x70\x68\x6c\x6f\x73\x69\x6f\x6e\x00\x54\x6f\x74\x6f\x64\x69\x6c\x65\x00"
+            "\x43\x72\x6f\x63\x6f\x6e\x61\x79\x04\xf0\x05\x72\x61\x6c\x69\x67\x61\x74\x72\x00\x53\x65\x6e\x74\x72\x65\x74\x00\x46\x75\x72\x07"
+            "\x00\xf0\x08\x48\x6f\x6f\x74\x68\x6f\x6f\x74\x00\x4e\x6f\x63\x74\x6f\x77\x6c\x00\x4c\x65\x64\x79\x62\x61\x07\x00\x00\xa5\x03\xc1"
+            "\x53\x70\x69\x6e\x61\x72\x61\x6b\x00\x41\x72\x69\x3a\x01\x30\x43\x72\x6f\x13\x04\xf1\x03\x43\x68\x69\x6e\x63\x68\x6f\x75\x00\x4c"
+            "\x61\x6e\x74\x75\x72\x6e\x00\x50\xbf\x04\x00\x67\x04\x40\x66\x61\x00\x49\x48\x04\x10\x62\x48\x04\x61\x54\x6f\x67\x65\x70\x69\x07"
+            "\x00\xa0\x74\x69\x63\x00\x4e\x61\x74\x75\x00\x58\x05\x00\x60\x4d\x61\x72\x65\x65\x70\x65\x01\xa0\x61\x66\x66\x79\x00\x41\x6d\x70"
+            "\x68\x61\xac\x01\x00\x9a\x03\x40\x6f\x73\x73\x6f\xbb\x03\x01\x66\x05\x42\x41\x7a\x75\x6d\x0a\x00\x91\x53\x75\x64\x6f\x77\x6f\x6f"
+            "\x64\x6f\xf6\x03\xf1\x01\x74\x6f\x65\x64\x00\x48\x6f\x70\x70\x69\x70\x00\x53\x6b\x69\x70\x9d\x04\x50\x4a\x75\x6d\x70\x6c\x78\x00"
+            "\xd0\x41\x69\x70\x6f\x6d\x00\x53\x75\x6e\x6b\x65\x72\x6e\x08\x00\xf0\x10\x66\x6c\x6f\x72\x61\x00\x59\x61\x6e\x6d\x61\x00\x57\x6f"
+            "\x6f\x70\x65\x72\x00\x51\x75\x61\x67\x73\x69\x72\x65\x00\x45\x73\x70\xe9\x01\x31\x55\x6d\x62\xf1\x01\x40\x4d\x75\x72\x6b\xa7\x05"
+            "\x00\xbf\x03\x01\x85\x02\xf0\x05\x4d\x69\x73\x64\x72\x65\x61\x76\x75\x73\x00\x55\x6e\x6f\x77\x6e\x00\x57\x6f\x62\xde\x00\xc0\x65"
+            "\x74\x00\x47\x69\x72\x61\x66\x61\x72\x69\x67\x73\x02\x60\x65\x63\x6f\x00\x46\x6f\x57\x01\xf0\x01\x72\x65\x73\x73\x00\x44\x75\x6e"
+            "\x73\x70\x61\x72\x63\x65\x00\x47\x7c\x01\xf0\x03\x72\x00\x53\x74\x65\x65\x6c\x69\x78\x00\x53\x6e\x75\x62\x62\x75\x6c\x6c\x49\x04"
+            "\x11\x6e\x09\x00\x50\x51\x77\x69\x6c\x66\x64\x05\xf1\x0f\x53\x63\x69\x7a\x6f\x72\x00\x53\x68\x75\x63\x6b\x6c\x65\x00\x48\x65\x72"
+            "\x61\x63\x72\x6f\x73\x73\x00\x53\x6e\x65\x61\x73\x99\x04\xd1\x64\x64\x69\x75\x72\x73\x61\x00\x55\x72\x73\x61\x72\x24\x03\x50\x6c"
+            "\x75\x67\x6d\x61\xe6\x02\xf0\x04\x63\x61\x72\x67\x6f\x00\x53\x77\x69\x6e\x75\x62\x00\x50\x69\x6c\x6f\x73\x77\x37\x05\xf0\x14\x43"
+            "\x6f\x72\x73\x6f\x6c\x61\x00\x52\x65\x6d\x6f\x72\x61\x69\x64\x00\x4f\x63\x74\x69\x6c\x6c\x65\x72\x79\x00\x44\x65\x6c\x69\x62\x69"
+            "\x72\x64\x7e\x05\x10\x74\x2c\x00\xf3\x02\x53\x6b\x61\x72\x6d\x6f\x72\x79\x00\x48\x6f\x75\x6e\x64\x6f\x75\x72\x09\x00\x21\x6f\x6d"
+            "\x40\x04\x00\xa4\x03\xb0\x50\x68\x61\x6e\x70\x79\x00\x44\x6f\x6e\x70\xc1\x03\x03\x20\x03\x10\x32\xa5\x03\x20\x6e\x74\x61\x04\xf4"
+            "\x00\x53\x6d\x65\x61\x72\x67\x6c\x65\x00\x54\x79\x72\x6f\x67\x75\x33\x04\xc0\x74\x6f\x70\x00\x53\x6d\x6f\x6f\x63\x68\x75\x6d\xb4"
+            "\x03\x20\x6b\x69\x77\x00\xf0\x01\x67\x62\x79\x00\x4d\x69\x6c\x74\x61\x6e\x6b\x00\x42\x6c\x69\x73\x27\x04\xf0\x00\x52\x61\x69\x6b"
+            "\x6f\x75\x00\x45\x6e\x74\x65\x69\x00\x53\x75\x44\x03\x70\x65\x00\x4c\x61\x72\x76\x69\x79\x03\x31\x50\x75\x70\x08\x00\x51\x54\x79"
+            "\x72\x61\x6e\x0a\x00\xf0\x0b\x4c\x75\x67\x69\x61\x00\x48\x6f\x2d\x4f\x68\x00\x43\x65\x6c\x65\x62\x69\x00\x54\x72\x65\x65\x63\x6b"
+            "\x6f\x46\x06\x30\x76\x79\x6c\x31\x04\x30\x65\x70\x74\x14\x03\xf0\x02\x54\x6f\x72\x63\x68\x69\x63\x00\x43\x6f\x6d\x62\x75\x73\x6b"
+            "\x65\x6e\x05\x08\x20\x7a\x69\x09\x00\x50\x4d\x75\x64\x6b\x69\x2d\x06\xf0\x03\x72\x73\x68\x74\x6f\x6d\x70\x00\x53\x77\x61\x6d\x70"
+            "\x65\x72\x74\x00\x50\xb6\x00\xa1\x79\x65\x6e\x61\x00\x4d\x69\x67\x68\x74\x0a\x00\x80\x5a\x69\x67\x7a\x61\x67\x6f\x6f\x07\x05\x20"
+            "\x6e\x6f\x2c\x05\x50\x57\x75\x72\x6d\x70\x6c\x00\x30\x69\x6c\x63\x18\x00\xd1\x42\x65\x61\x75\x74\x69\x66\x6c\x79\x00\x43\x61\x73"
+            "\x12\x00\xf0\x00\x44\x75\x73\x74\x6f\x78\x00\x4c\x6f\x74\x61\x64\x00\x4c\x6f\x71\x02\x81\x00\x4c\x75\x64\x69\x63\x6f\x6c\xfa\x05"
+            "\x10\x64\x89\x03\xd0\x75\x7a\x6c\x65\x61\x66\x00\x53\x68\x69\x66\x74\x72\x34\x05\x30\x69\x6c\x6c\x8f\x02\x10\x77\x1b\x03\x60\x77"
+            "\x00\x57\x69\x6e\x67\x34\x02\x50\x50\x65\x6c\x69\x70\xc8\x02\xf0\x21\x52\x61\x6c\x74\x73\x00\x4b\x69\x72\x6c\x69\x61\x00\x47\x61"
+            "\x72\x64\x65\x76\x6f\x69\x72\x00\x53\x75\x72\x73\x6b\x69\x74\x00\x4d\x61\x73\x71\x75\x65\x72\x61\x69\x6e\x00\x53\x68\x72\x6f\x6f"
+            "\x6d\x68\x02\x31\x42\x72\x65\x31\x03\x40\x53\x6c\x61\x6b\xac\x07\x50\x56\x69\x67\x6f\x72\x09\x00\x00\x11\x00\x00\x55\x02\x60\x4e"
+            "\x69\x6e\x63\x61\x64\x69\x08\x41\x6e\x6a\x61\x73\x7f\x06\x10\x64\x0b\x00\xf0\x08\x00\x57\x68\x69\x73\x6d\x75\x72\x00\x4c\x6f\x75"
+            "\x64\x72\x65\x64\x00\x45\x78\x70\x6c\x6f\x75\xca\x01\x30\x6b\x75\x68\xac\x04\x80\x48\x61\x72\x69\x79\x61\x6d\x61\xba\x03\x01\xb8"
+            "\x03\x60\x4e\x6f\x73\x65\x70\x61\xc4\x02\x41\x6b\x69\x74\x74\x74\x02\x20\x63\x61\x09\x00\x10\x53\x92\x08\x10\x79\x64\x06\x10\x77"
+            "\x9a\x01\x20\x41\x72\x4c\x01\x20\x61\x69\x07\x00\x30\x41\x67\x67\x07\x00\x52\x4d\x65\x64\x69\x74\x16\x05\x20\x64\x69\xbb\x07\x03"
+            "\xb5\x06\x11\x69\xcc\x07\x11\x6e\x0b\x00\xe0\x63\x00\x50\x6c\x75\x73\x6c\x65\x00\x4d\x69\x6e\x75\x6e\xde\x06\xa0\x62\x65\x61\x74"
+            "\x00\x49\x6c\x6c\x75\x6d\xda\x09\x41\x52\x6f\x73\x65\x1a\x01\x00\xfa\x08\x10\x6e\xd4\x01\xf0\x0b\x6c\x6f\x74\x00\x43\x61\x72\x76"
+            "\x61\x6e\x68\x61\x00\x53\x68\x61\x72\x70\x65\x64\x6f\x00\x57\x61\x69\x6c\x6d\x07\x00\x08\x00\xf0\x03\x6f\x72\x64\x00\x4e\x75\x6d"
+            "\x65\x6c\x00\x43\x61\x6d\x65\x72\x75\x70\x74\x38\x02\xf1\x04\x6b\x6f\x61\x6c\x00\x53\x70\x6f\x69\x6e\x6b\x00\x47\x72\x75\x6d\x70"
+            "\x69\x67\x21\x05\x70\x64\x61\x00\x54\x72\x61\x70\x12\x05\x50\x00\x56\x69\x62\x72\x8f\x05\x21\x46\x6c\x35\x06\x60\x43\x61\x63\x6e"
+            "\x65\x61\x07\x00\x00\x26\x05\x10\x65\x7e\x00\xf0\x0a\x62\x6c\x75\x00\x41\x6c\x74\x61\x72\x69\x61\x00\x5a\x61\x6e\x67\x6f\x6f\x73"
+            "\x65\x00\x53\x65\x76\x69\xcc\x01\x50\x4c\x75\x6e\x61\x74\x4c\x02\xf1\x01\x53\x6f\x6c\x72\x6f\x63\x6b\x00\x42\x61\x72\x62\x6f\x61"
+            "\x63\x68\x78\x01\x10\x63\x5f\x08\x50\x43\x6f\x72\x70\x68\xc4\x01\x50\x43\x72\x61\x77\x64\xfd\x07\x60\x00\x42\x61\x6c\x74\x6f\xe5"
+            "\x09\x90\x61\x79\x64\x6f\x6c\x00\x4c\x69\x6c\x5c\x05\xa0\x43\x72\x61\x64\x69\x6c\x79\x00\x41\x6e\x45\x06\xf0\x01\x68\x00\x41\x72"
+            "\x6d\x61\x6c\x64\x6f\x00\x46\x65\x65\x62\x61\x73\x75\x03\x10\x6f\x94\x05\xc1\x43\x61\x73\x74\x66\x6f\x72\x6d\x00\x4b\x65\x63\x32"
+            "\x0b\x60\x53\x68\x75\x70\x70\x65\x56\x00\x50\x6e\x65\x74\x74\x65\xb5\x02\x10\x6b\x71\x02\x50\x44\x75\x73\x63\x6c\xea\x06\x70\x54"
+            "\x72\x6f\x70\x69\x75\x73\x05\x06\xf1\x03\x6d\x65\x63\x68\x6f\x00\x41\x62\x73\x6f\x6c\x00\x57\x79\x6e\x61\x75\x74\xfd\x06\x00\x95"
+            "\x00\x50\x47\x6c\x61\x6c\x69\xfc\x0a\x20\x68\x65\x37\x01\x40\x65\x61\x6c\x65\x65\x01\x50\x6c\x72\x65\x69\x6e\xab\x00\x00\x5a\x03"
+            "\xf0\x17\x6c\x00\x48\x75\x6e\x74\x61\x69\x6c\x00\x47\x6f\x72\x65\x62\x79\x73\x73\x00\x52\x65\x6c\x69\x63\x61\x6e\x74\x68\x00\x4c"
+            "\x75\x76\x64\x69\x73\x63\x00\x42\x1b\x07\x01\x00\x09\x01\x08\x00\x80\x61\x6c\x61\x6d\x65\x6e\x63\x65\x2b\x06\x31\x64\x75\x6d\xb1"
+            "\x0b\x00\xa5\x05\x41\x65\x74\x61\x67\x2b\x05\x41\x52\x65\x67\x69\x3c\x01\x00\x09\x00\x21\x63\x65\x07\x00\x10\x73\x7b\x05\x60\x00"
+            "\x4c\x61\x74\x69\x61\xfe\x07\xa1\x74\x69\x6f\x73\x00\x4b\x79\x6f\x67\x72\x68\x0a\x10\x75\xa4\x08\xf0\x0f\x52\x61\x79\x71\x75\x61"
+            "\x7a\x61\x00\x4a\x69\x72\x61\x63\x68\x69\x00\x44\x65\x6f\x78\x79\x73\x00\x54\x75\x72\x74\x77\x69\x8c\x09\x10\x6f\x33\x0c\x81\x54"
+            "\x6f\x72\x74\x65\x72\x72\x61\xfe\x00\xf1\x00\x63\x68\x61\x72\x00\x4d\x6f\x6e\x66\x65\x72\x6e\x6f\x00\x49\x08\x00\x00\xbc\x0a\x60"
+            "\x50\x69\x70\x6c\x75\x70\xcc\x0a\x11\x6e\x09\x00\x42\x45\x6d\x70\x6f\x5c\x01\x51\x74\x61\x72\x6c\x79\x07\x00\x42\x61\x76\x69\x61"
+            "\x09\x00\x10\x70\x70\x09\xf4\x09\x42\x69\x64\x6f\x6f\x66\x00\x42\x69\x62\x61\x72\x65\x6c\x00\x4b\x72\x69\x63\x6b\x65\x74\x6f\x74"
+            "\x0a\x00\x00\x03\x05\xb0\x53\x68\x69\x6e\x78\x00\x4c\x75\x78\x69\x6f\x06\x00\x91\x72\x61\x79\x00\x42\x75\x64\x65\x77\xe4\x02\x30"
+            "\x72\x61\x64\xf2\x07\x30\x61\x6e\x69\xa8\x07\x60\x52\x61\x6d\x70\x61\x72\x0a\x00\x50\x53\x68\x69\x65\x6c\xe1\x00\x61\x42\x61\x73"
+            "\x74\x69\x6f\x0a\x00\xb0\x75\x72\x6d\x79\x00\x57\x6f\x72\x6d\x61\x64\x25\x0b\x51\x6f\x74\x68\x69\x6d\x12\x05\x00\x09\x09\xa0\x65"
+            "\x73\x70\x69\x71\x75\x65\x6e\x00\x50\x07\x01\xf0\x02\x72\x69\x73\x75\x00\x42\x75\x69\x7a\x65\x6c\x00\x46\x6c\x6f\x61\x74\x09\x00"
+            "\x71\x43\x68\x65\x72\x75\x62\x69\x08\x00\x32\x72\x69\x6d\x9d\x0a\x21\x6f\x73\x93\x0a\x11\x72\x63\x00\x31\x41\x6d\x62\x83\x07\x51"
+            "\x44\x72\x69\x66\x6c\xfb\x04\xf0\x07\x72\x69\x66\x62\x6c\x69\x6d\x00\x42\x75\x6e\x65\x61\x72\x79\x00\x4c\x6f\x70\x75\x6e\x6e\xfd"
+            "\x05\x40\x73\x6d\x61\x67\x50\x02\x10\x48\x57\x0a\x01\x7b\x07\x10\x47\xe4\x01\x80\x6f\x77\x00\x50\x75\x72\x75\x67\x40\x05\x10\x68"
+            "\xbc\x0a\x02\x11\x0a\x70\x75\x6e\x6b\x79\x00\x53\x6b\x38\x02\x00\x33\x06\x30\x72\x6f\x6e\x32\x07\x02\x08\x00\x80\x6e\x67\x00\x42"
+            "\x6f\x6e\x73\x6c\x56\x00\xd0\x6d\x65\x20\x4a\x72\x2e\x00\x48\x61\x70\x70\x69\x6e\x43\x00\x10\x61\x4e\x01\xc0\x53\x70\x69\x72\x69"
+            "\x74\x6f\x6d\x62\x00\x47\x69\x10\x0d\x30\x47\x61\x62\x60\x04\x50\x47\x61\x72\x63\x68\xf3\x05\x50\x4d\x75\x6e\x63\x68\xbc\x09\xa0"
+            "\x52\x69\x6f\x6c\x75\x00\x4c\x75\x63\x61\x96\x0b\xa2\x48\x69\x70\x70\x6f\x70\x6f\x74\x61\x73\x0b\x00\x10\x77\xe4\x00\x61\x53\x6b"
+            "\x6f\x72\x75\x70\xc7\x09\x10\x70\x78\x09\xf0\x03\x43\x72\x6f\x61\x67\x75\x6e\x6b\x00\x54\x6f\x78\x69\x63\x72\x6f\x61\x6b\x67\x04"
+            "\x30\x6e\x69\x76\x59\x07\x40\x46\x69\x6e\x6e\x02\x02\x41\x4c\x75\x6d\x69\x09\x00\x00\x72\x07\x10\x79\x26\x0c\xd0\x6e\x6f\x76\x65"
+            "\x72\x00\x41\x62\x6f\x6d\x61\x73\x6e\xe1\x05\x30\x65\x61\x76\x10\x05\x01\x2d\x0c\x10\x7a\x0d\x04\x01\x68\x0b\x50\x6c\x69\x63\x6b"
+            "\x79\x51\x0b\x50\x70\x65\x72\x69\x6f\xdd\x0a\x31\x6e\x67\x72\x52\x0d\x01\x14\x05\x20\x69\x76\xcb\x08\x00\x00\x0b\x21\x6f\x72\x1e"
+            "\x07\x71\x6f\x67\x65\x6b\x69\x73\x73\xf4\x08\x20\x65\x67\xd2\x09\x20\x61\x66\x78\x00\x42\x47\x6c\x61\x63\x08\x00\x93\x69\x73\x63"
+            "\x6f\x72\x00\x4d\x61\x6d\x28\x08\x03\xca\x07\x70\x2d\x5a\x00\x47\x61\x6c\x6c\x4f\x02\x51\x50\x72\x6f\x62\x6f\xbc\x05\x00\x05\x04"
+            "\x10\x6e\x57\x06\x30\x46\x72\x6f\x97\x0e\xa1\x73\x00\x52\x6f\x74\x6f\x6d\x00\x55\x78\x34\x0f\xf0\x08\x73\x70\x72\x69\x74\x00\x41"
+            "\x7a\x65\x6c\x66\x00\x44\x69\x61\x6c\x67\x61\x00\x50\x61\x6c\x6b\x96\x07\x61\x65\x61\x74\x72\x61\x6e\x86\x03\x51\x67\x69\x67\x61"
+            "\x73\x34\x09\x10\x74\xc5\x0e\x10\x43\x27\x09\x01\x9c\x05\x32\x50\x68\x69\x6d\x0c\xd0\x6e\x61\x70\x68\x79\x00\x44\x61\x72\x6b\x72"
+            "\x61\x69\x9c\x05\x40\x79\x6d\x69\x6e\x01\x0e\x31\x65\x75\x73\xa0\x0d\x00\x37\x0b\x91\x53\x6e\x69\x76\x79\x00\x53\x65\x72\x59\x01"
+            "\x34\x53\x65\x72\x12\x01\x10\x65\x92\x05\x31\x50\x69\x67\x49\x0b\x40\x45\x6d\x62\x6f\x10\x0d\x50\x73\x68\x61\x77\x6f\x87\x0e\x11"
+            "\x65\x07\x00\x50\x53\x61\x6d\x75\x72\x09\x00\x10\x50\x98\x00\x90\x74\x00\x57\x61\x74\x63\x68\x6f\x67\x35\x05\x50\x6c\x69\x70\x75"
+            "\x70\x74\x09\x20\x64\x69\xc6\x08\x80\x74\x6f\x75\x74\x6c\x61\x6e\x64\x86\x02\x40\x72\x6c\x6f\x69\xe9\x07\x10\x65\x55\x03\x70\x00"
+            "\x50\x61\x6e\x73\x61\x67\xe9\x07\x21\x6d\x69\x09\x00\x00\x11\x00\x10\x65\xe2\x09\x00\x11\x00\x00\x09\x00\x40\x50\x61\x6e\x70\x3d"
+            "\x09\x00\x11\x00\x01\x09\x00\x30\x4d\x75\x6e\x3e\x08\x70\x75\x73\x68\x61\x72\x6e\x61\x2b\x10\x30\x6f\x76\x65\x37\x06\x10\x6e\xc6"
+            "\x0b\x80\x6c\x00\x55\x6e\x66\x65\x7a\x61\xcc\x05\xb0\x6c\x69\x74\x7a\x6c\x65\x00\x5a\x65\x62\x73\xe9\x06\x90\x61\x00\x52\x6f\x67"
+            "\x67\x65\x6e\x72\xc2\x09\x50\x42\x6f\x6c\x64\x6f\xb4\x04\x30\x69\x67\x61\x1c\x0f\x00\xcb\x0a\x00\x8f\x0b\x22\x53\x77\x08\x00\xc2"
+            "\x44\x72\x69\x6c\x62\x75\x72\x00\x45\x78\x63\x61\xa5\x10\x30\x41\x75\x64\x12\x10\xc0\x54\x69\x6d\x62\x75\x72\x72\x00\x47\x75\x72"
+            "\x64\x08\x00\x40\x43\x6f\x6e\x6b\x3f\x05\x10\x72\x47\x09\x01\x9d\x04\x00\xb0\x01\xc2\x70\x69\x74\x6f\x61\x64\x00\x53\x65\x69\x73"
+            "\x6d\x0b\x00\xf0\x01\x54\x68\x72\x6f\x68\x00\x53\x61\x77\x6b\x00\x53\x65\x77\x61\x64\x08\x11\x41\x53\x77\x61\x64\xd3\x03\x50\x4c"
+            "\x65\x61\x76\x61\xc3\x03\x80\x56\x65\x6e\x69\x70\x65\x64\x65\xa5\x06\x22\x72\x6c\x0b\x00\x33\x53\x63\x6f\x0a\x00\x10\x43\x1d\x11"
+            "\x10\x6e\x48\x11\x61\x68\x69\x6d\x73\x69\x63\x7d\x01\x51\x65\x74\x69\x6c\x69\xab\x06\x00\x1c\x0b\x01\xc4\x06\x40\x73\x63\x75\x6c"
+            "\xa1\x07\x21\x61\x6e\xbd\x0c\x80\x4b\x72\x6f\x6b\x6f\x72\x6f\x6b\x09\x00\x22\x6f\x6b\xd1\x0c\x80\x44\x61\x72\x75\x6d\x61\x6b\x61"
+            "\x09\x00\x11\x6d\xfd\x09\x00\x48\x03\x10\x72\x5e\x07\x60\x73\x00\x44\x77\x65\x62\xd3\x03\x40\x43\x72\x75\x73\xaa\x05\x71\x53\x63"
+            "\x72\x61\x67\x67\x79\x08\x00\x10\x66\x6f\x08\xb0\x69\x67\x69\x6c\x79\x70\x68\x00\x59\x61\x6d\xd3\x08\xf0\x03\x43\x6f\x66\x61\x67"
+            "\x72\x69\x67\x75\x73\x00\x54\x69\x72\x74\x6f\x75\x67\xa9\x07\x80\x72\x72\x61\x63\x6f\x73\x74\x61\x75\x02\x21\x68\x65\x7c\x02\x22"
+            "\x68\x65\xf6\x06\x31\x75\x62\x62\x08\x11\x00\x93\x07\x90\x64\x6f\x72\x00\x5a\x6f\x72\x75\x61\x06\x00\x40\x6f\x61\x72\x6b\x7f\x08"
+            "\x20\x63\x63\x6c\x01\x14\x43\x09\x00\x10\x47\x58\x05\x10\x74\xd5\x0e\x22\x74\x68\xc8\x0d\x02\x12\x00\x20\x65\x6c\x9e\x00\x10\x6f"
+            "\xae\x0d\x00\x59\x03\x02\xb5\x0d\x70\x52\x65\x75\x6e\x69\x63\x6c\xc8\x00\x01\xfc\x0b\x00\xab\x02\x20\x77\x61\x35\x02\x30\x56\x61"
+            "\x6e\x26\x01\x10\x74\xa4\x0e\x01\x0a\x00\x23\x73\x68\x0a\x00\x82\x75\x78\x65\x00\x44\x65\x65\x72\x1a\x05\x40\x61\x77\x73\x62\x49"
+            "\x11\x30\x45\x6d\x6f\x80\x03\x10\x4b\xcb\x00\x10\x62\xe1\x12\x60\x00\x45\x73\x63\x61\x76\x8e\x07\x60\x72\x00\x46\x6f\x6f\x6e\xf2"
+            "\x00\x22\x41\x6d\x09\x00\x30\x73\x00\x46\x28\x02\x00\x54\x00\xf0\x01\x4a\x65\x6c\x6c\x69\x63\x65\x6e\x74\x00\x41\x6c\x6f\x6d\x6f"
+            "\x6d\x71\x02\x00\x0d\x0f\x20\x69\x6b\x10\x04\x10\x76\xe9\x0d\x20\x6c\x61\x4b\x0e\x62\x72\x6f\x73\x65\x65\x64\x0a\x00\x00\xda\x00"
+            "\x40\x6e\x00\x4b\x6c\x14\x09\x20\x4b\x6c\x89\x07\x01\x0c\x00\x01\x0a\x00\x50\x54\x79\x6e\x61\x6d\x60\x0f\x30\x6c\x65\x6b\xcb\x02"
+            "\x04\x0a\x00\x00\xa5\x07\xc0\x45\x6c\x67\x79\x65\x6d\x00\x42\x65\x68\x65\x65\x09\x00\x90\x4c\x69\x74\x77\x69\x63\x6b\x00\x4c\x18"
+            "\x08\x10\x6e\x61\x0e\x00\xca\x13\xe0\x6c\x75\x72\x65\x00\x41\x78\x65\x77\x00\x46\x72\x61\x78\x0d\x00\x50\x48\x61\x78\x6f\x72\x7c"
+            "\x08\x60\x75\x62\x63\x68\x6f\x6f\x64\x0b\x00\x65\x0f\x50\x00\x43\x72\x79\x6f\x4c\x0f\x11\x6c\x8c\x06\x70\x6d\x65\x74\x00\x41\x63"
+            "\x63\x32\x08\x00\xc9\x03\x50\x75\x6e\x66\x69\x73\xa2\x01\x51\x65\x6e\x66\x6f\x6f\x08\x00\xb0\x73\x68\x61\x6f\x00\x44\x72\x75\x64"
+            "\x64\x69\x56\x08\x00\xca\x11\x11\x74\xf1\x12\x90\x75\x72\x6b\x00\x50\x61\x77\x6e\x69\xe9\x03\x20\x42\x69\xb0\x03\x90\x70\x00\x42"
+            "\x6f\x75\x66\x66\x61\x6c\xa8\x02\x50\x52\x75\x66\x66\x6c\x1e\x09\x01\xc1\x07\x20\x72\x79\x52\x13\x20\x6c\x61\xc5\x0c\x00\xb8\x02"
+            "\x01\x85\x10\x00\xf3\x04\x70\x6d\x6f\x72\x00\x44\x75\x72\x32\x00\x20\x44\x65\x0d\x02\x60\x5a\x77\x65\x69\x6c\x6f\xe6\x06\x41\x79"
+            "\x64\x72\x65\x75\x00\x00\xd2\x0c\x10\x65\x6b\x02\x70\x56\x6f\x6c\x63\x61\x72\x6f\x13\x05\x41\x6f\x62\x61\x6c\xc4\x0f\x00\x64\x08"
+            "\x10\x6b\x0a\x00\x52\x56\x69\x72\x69\x7a\xd7\x0f\x40\x72\x6e\x61\x64\xae\x02\x50\x68\x75\x6e\x64\x75\x06\x01\xf0\x00\x52\x65\x73"
+            "\x68\x69\x72\x61\x6d\x00\x5a\x65\x6b\x72\x6f\x6d\x8e\x0f\x11\x64\x1f\x01\x50\x4b\x79\x75\x72\x65\xd3\x09\x30\x6c\x64\x65\x4d\x10"
+            "\x40\x6c\x6f\x65\x74\x80\x02\x31\x65\x6e\x65\xad\x13\x20\x43\x68\xe6\x07\x11\x6e\x3e\x10\x30\x6c\x61\x64\x92\x09\xf0\x03\x68\x65"
+            "\x73\x6e\x61\x75\x67\x68\x74\x00\x46\x65\x6e\x6e\x65\x6b\x69\x6e\xe4\x00\x40\x69\x78\x65\x6e\xb2\x0b\x40\x70\x68\x6f\x78\xfc\x05"
+            "\x40\x61\x6b\x69\x65\x08\x00\x21\x67\x61\x25\x05\x41\x47\x72\x65\x6e\x17\x0c\x80\x42\x75\x6e\x6e\x65\x6c\x62\x79\xf6\x13\x90\x67"
+            "\x65\x72\x73\x62\x79\x00\x46\x6c\xe2\x12\x01\x9c\x02\x02\x0b\x00\x11\x69\x9c\x15\x60\x54\x61\x6c\x6f\x6e\x66\xe1\x07\x20\x00\x53"
+            "\x08\x0c\x40\x65\x72\x62\x75\x48\x0b\x80\x65\x77\x70\x61\x00\x56\x69\x76\xee\x0c\x00\x6b\x05\x10\x74\x30\x0a\x20\x50\x79\x5d\x03"
+            "\x00\x27\x10\x60\x62\xc3\xa9\x62\xc3\xa9\x83\x08\x01\x95\x0a\x61\x46\x6c\x6f\x72\x67\x65\x54\x0c\x20\x64\x64\x6b\x03\x30\x67\x6f"
+            "\x61\xd4\x05\x00\x99\x12\x10\x6d\x08\x00\x00\xd0\x0c\x00\xe5\x10\x20\x66\x72\x4a\x0e\x20\x73\x70\xeb\x04\x00\x82\x14\x10\x73\x2e"
+            "\x02\xc1\x48\x6f\x6e\x65\x64\x67\x65\x00\x44\x6f\x75\x62\xe9\x06\x10\x41\x24\x0a\x01\x6e\x15\x10\x53\xca\x06\x00\x3c\x13\x60\x41"
+            "\x72\x6f\x6d\x61\x74\x91\x0e\x00\x52\x0f\x11\x72\xb9\x0f\x31\x6c\x75\x72\x2a\x15\x40\x49\x6e\x6b\x61\xf2\x01\x20\x6c\x61\x6e\x12"
+            "\x50\x42\x69\x6e\x61\x63\x4e\x16\x30\x61\x72\x62\x8d\x04\x00\xde\x03\x51\x6b\x72\x65\x6c\x70\xd7\x11\x40\x61\x6c\x67\x65\xf0\x0a"
+            "\x00\x59\x08\x01\xbf\x13\x20\x61\x77\x61\x00\x72\x72\x00\x48\x65\x6c\x69\x6f\x95\x0e\x01\x0b\x00\x10\x6c\xa4\x02\x21\x54\x79\x3d"
+            "\x0b\x01\xdc\x0e\x90\x74\x72\x75\x6d\x00\x41\x6d\x61\x75\xd2\x14\x21\x75\x72\xd9\x01\x40\x53\x79\x6c\x76\xbe\x07\xc0\x48\x61\x77"
+            "\x6c\x75\x63\x68\x61\x00\x44\x65\x64\xaf\x01\x00\xba\x04\x11\x62\x99\x0c\xb0\x6f\x6f\x6d\x79\x00\x53\x6c\x69\x67\x67\x6f\x18\x01"
+            "\x10\x6f\xb3\x0f\x61\x4b\x6c\x65\x66\x6b\x69\xba\x0f\x40\x74\x75\x6d\x70\x1e\x0f\x30\x76\x65\x6e\x9d\x02\x71\x50\x75\x6d\x70\x6b"
+            "\x61\x62\x2b\x00\xc1\x75\x72\x67\x65\x69\x73\x74\x00\x42\x65\x72\x67\xaf\x14\xb0\x41\x76\x61\x6c\x75\x67\x67\x00\x4e\x6f\x69\x5e"
+            "\x06\x40\x4e\x6f\x69\x76\x4f\x11\x30\x58\x65\x72\x8e\x10\xc0\x00\x59\x76\x65\x6c\x74\x61\x6c\x00\x5a\x79\x67\x76\x0e\x00\xf9\x07"
+            "\x40\x6e\x63\x69\x65\x54\x12\x00\xcb\x01\x00\xd5\x02\x11\x6e\xdb\x04\x20\x6f\x77\x32\x03\x50\x44\x61\x72\x74\x72\x9d\x14\x50\x65"
+            "\x63\x69\x64\x75\xf9\x0d\x51\x4c\x69\x74\x74\x65\xd9\x02\x30\x72\x61\x63\xb4\x0d\x51\x6e\x63\x69\x6e\x65\xf2\x01\xc0\x50\x6f\x70"
+            "\x70\x6c\x69\x6f\x00\x42\x72\x69\x6f\xdf\x00\x00\x17\x16\x00\xef\x10\x00\x3b\x07\x50\x6b\x69\x70\x65\x6b\x90\x05\x40\x6d\x62\x65"
+            "\x61\x6e\x09\xa1\x75\x63\x61\x6e\x6e\x6f\x6e\x00\x59\x75\x4f\x0d\x61\x00\x47\x75\x6d\x73\x68\x09\x00\x01\xb4\x05\x02\x05\x18\x20"
+            "\x6a\x61\x68\x02\x80\x56\x69\x6b\x61\x76\x6f\x6c\x74\x2a\x0b\x40\x62\x72\x61\x77\xb0\x10\x00\x0b\x00\x41\x6f\x6d\x69\x6e\x21\x17"
+            "\x50\x4f\x72\x69\x63\x6f\xf3\x09\x50\x43\x75\x74\x69\x65\xbd\x0f\x32\x52\x69\x62\x1a\x0b\x50\x52\x6f\x63\x6b\x72\xff\x01\xf1\x04"
+            "\x4c\x79\x63\x61\x6e\x72\x6f\x63\x00\x57\x69\x73\x68\x69\x77\x61\x73\x68\x69\xd1\x12\x30\x61\x6e\x69\x21\x0c\x50\x78\x61\x70\x65"
+            "\x78\x4e\x10\x10\x62\xa2\x0b\x60\x4d\x75\x64\x73\x64\x61\xbd\x06\x40\x65\x77\x70\x69\x02\x03\x50\x41\x72\x61\x71\x75\xa8\x0b\x40"
+            "\x00\x46\x6f\x6d\x78\x11\x31\x73\x00\x4c\x2b\x04\x10\x69\x23\x14\x30\x72\x65\x6c\x6e\x0d\x51\x53\x68\x69\x69\x6e\xa1\x0d\x00\xf2"
+            "\x0c\x30\x6e\x64\x69\xbb\x08\x30\x6c\x61\x7a\x1c\x08\x10\x53\xa4\x17\x60\x75\x6c\x00\x42\x65\x77\x6d\x08\x91\x42\x6f\x75\x6e\x73"
+            "\x77\x65\x65\x74\x62\x12\x00\x6a\x07\x20\x54\x73\x5f\x13\x01\x50\x04\xf0\x05\x6d\x66\x65\x79\x00\x4f\x72\x61\x6e\x67\x75\x72\x75"
+            "\x00\x50\x61\x73\x73\x69\x6d\xda\x13\x30\x57\x69\x6d\xe7\x18\x10\x47\x77\x02\x10\x6f\x0a\x00\x00\x78\x07\x20\x79\x67\x2f\x06\x20"
+            "\x50\x61\x83\x13\x01\xfa\x08\x80\x79\x75\x6b\x75\x6d\x75\x6b\x75\x5f\x14\x41\x65\x3a\x20\x4e\x9a\x00\x51\x69\x6c\x76\x61\x6c\x64"
+            "\x0b\x10\x6e\x77\x09\x61\x4b\x6f\x6d\x61\x6c\x61\x28\x0d\x00\x01\x18\x00\x89\x09\x90\x6f\x67\x65\x64\x65\x6d\x61\x72\x75\x88\x0b"
+            "\x90\x69\x6b\x79\x75\x00\x42\x72\x75\x78\x65\x06\x20\x44\x72\x99\x0c\x20\x00\x44\xa5\x05\x00\x9e\x0f\xd1\x4a\x61\x6e\x67\x6d\x6f"
+            "\x2d\x6f\x00\x48\x61\x6b\x61\x09\x00\x31\x4b\x6f\x6d\x08\x00\x83\x54\x61\x70\x75\x20\x4b\x6f\x6b\x0a\x00\x20\x4c\x65\x7d\x0d\x00"
+            "\x0a\x00\x42\x42\x75\x6c\x75\x0a\x00\x10\x46\x0e\x0a\x62\x43\x6f\x73\x6d\x6f\x67\x07\x00\x20\x65\x6d\x58\x07\x11\x67\x6b\x0e\x00"
+            "\x4b\x0f\x10\x6c\xc1\x10\xc1\x68\x69\x6c\x65\x67\x6f\x00\x42\x75\x7a\x7a\x77\xe9\x08\xe0\x68\x65\x72\x6f\x6d\x6f\x73\x61\x00\x58"
+            "\x75\x72\x6b\x69\xf3\x17\x01\x36\x12\x01\x24\x0e\x01\x38\x07\x30\x74\x61\x6e\x30\x10\x22\x7a\x7a\x09\x10\x52\x65\x63\x72\x6f\x7a"
+            "\x62\x13\x11\x65\xbe\x09\x01\x22\x12\x20\x61\x64\xa1\x0c\x21\x6f\x69\x3d\x09\x90\x4e\x61\x67\x61\x6e\x61\x64\x65\x6c\xd2\x0d\x20"
+            "\x6b\x61\x04\x00\x00\x58\x12\x40\x63\x65\x70\x68\xef\x04\x50\x00\x5a\x65\x72\x61\x81\x14\x00",
+            9175, 10083
+        },
+    },
+    // Spanish
+    {
+        // characteristic_es
+        {
+            "\xf1\xa2\x1f\x00\x00\x00\x84\x00\x00\x00\x8c\x00\x00\x00\x9d\x00\x00\x00\xb0\x00\x00\x00\xbd\x00\x00\x00\xd4\x00\x00\x00\xe7\x00"
+            "\x00\x00\xfe\x00\x00\x00\x12\x01\x00\x00\x24\x01\x00\x00\x34\x01\x00\x00\x44\x01\x00\x00\x56\x01\x00\x00\x66\x01\x00\x00\x76\x01"
+            "\x00\x00\x85\x01\x00\x00\x96\x01\x00\x00\xa6\x01\x00\x00\xc4\x01\x00\x00\xd5\x01\x00\x00\xe7\x01\x00\x00\xf4\x01\x00\x00\x0b\x02"
+            "\x00\x00\x25\x02\x00\x00\x30\x02\x00\x00\x48\x02\x00\x00\x57\x02\x00\x00\x64\x02\x00\x00\x76\x02\x00\x00\x84\x02\x00\x00\x90\x02"
+            "\x00\x00\xa1\x02\x00\x00\x4e\x69\x6e\x67\x75\x6e\x6f\x00\x4c\x65\x20\x65\x6e\x63\x61\x6e\x74\x61\x20\x63\x6f\x6d\x65\x72\x00\x41"
+            "\x20\x6d\x65\x6e\x75\x64\x6f\x20\x73\x65\x20\x64\x75\x65\x72\x6d\x65\x00\x44\x07\x00\xf0\x0e\x20\x6d\x75\x63\x68\x6f\x00\x53\x75"
+            "\x65\x6c\x65\x20\x64\x65\x73\x6f\x72\x64\x65\x6e\x61\x72\x20\x63\x6f\x73\x61\x73\x48\x00\xf8\x17\x67\x75\x73\x74\x61\x20\x72\x65"
+            "\x6c\x61\x6a\x61\x72\x73\x65\x00\x4f\x72\x67\x75\x6c\x6c\x6f\x73\x6f\x20\x64\x65\x20\x73\x75\x20\x66\x75\x65\x72\x7a\x61\x2a\x00"
+            "\x50\x76\x6f\x6c\x76\x65\x2b\x00\x70\x41\x20\x76\x65\x63\x65\x73\x74\x00\x57\x65\x6e\x66\x61\x64\x26\x00\xf5\x31\x6c\x75\x63\x68"
+            "\x61\x72\x00\x54\x69\x65\x6e\x65\x20\x6d\x61\x6c\x20\x67\x65\x6e\x69\x6f\x00\x43\x75\x65\x72\x70\x6f\x20\x72\x65\x73\x69\x73\x74"
+            "\x65\x6e\x74\x65\x00\x45\x73\x20\x62\x75\x65\x6e\x20\x66\x61\x6a\x61\x64\x6f\x72\x00\x4d\x75\x79\x20\x70\x65\x72\x20\x00\x00\x10"
+            "\x00\x07\x2f\x00\x04\x1f\x00\x50\x65\x76\x65\x72\x61\x11\x00\x05\x72\x00\xf1\x01\x63\x6f\x72\x72\x65\x72\x00\x53\x69\x65\x6d\x70"
+            "\x72\x65\x20\x74\x7a\x00\xf0\x07\x65\x6c\x20\x6f\xc3\xad\x64\x6f\x20\x61\x6c\x65\x72\x74\x61\x00\x49\x6d\x70\x65\x74\x75\xdd\x00"
+            "\x60\x79\x20\x62\x6f\x62\x6f\x7f\x00\xf0\x17\x75\x6e\x20\x70\x6f\x63\x6f\x20\x70\x61\x79\x61\x73\x6f\x00\x48\x75\x79\x65\x20\x72"
+            "\xc3\xa1\x70\x69\x64\x6f\x00\x45\x78\x74\x72\x65\x6d\x61\x64\x61\x6d\x7e\x00\x71\x20\x63\x75\x72\x69\x6f\x73\x7f\x01\x02\x75\x00"
+            "\xf1\x01\x68\x61\x63\x65\x72\x20\x74\x72\x61\x76\x65\x73\x75\x72\x61\x73\xa0\x00\x66\x61\x73\x74\x75\x74\x6f\x93\x01\xe1\x65\x73"
+            "\x74\xc3\xa1\x20\x65\x6e\x20\x42\x61\x62\x69\x61\x23\x00\x70\x6d\x65\x6c\x69\x6e\x64\x72\x4c\x00\x72\x56\x6f\x6c\x75\x6e\x74\x61"
+            "\x59\x00\x94\x45\x73\x20\x61\x6c\x67\x6f\x20\x6f\x85\x01\x01\x2e\x00\x51\x69\x6e\x73\x6f\x6c\xff\x00\x40\x4f\x64\x69\x61\x00\x01"
+            "\x53\x64\x65\x72\x00\x55\xb8\x00\x90\x63\x61\x62\x65\x7a\x6f\x74\x61\x00",
+            594, 673
+        },
+        // dppt_es
+        {
+            "\xf4\xff\xca\x71\x00\x00\x00\xcc\x01\x00\x00\xd9\x01\x00\x00\xe8\x01\x00\x00\xf7\x01\x00\x00\x05\x02\x00\x00\x13\x02\x00\x00\x2b"
+            "\x02\x00\x00\x3f\x02\x00\x00\x4d\x02\x00\x00\x5c\x02\x00\x00\x68\x02\x00\x00\x8c\x02\x00\x00\xa5\x02\x00\x00\xbf\x02\x00\x00\xeb"
+            "\x02\x00\x00\x04\x03\x00\x00\x1d\x03\x00\x00\x36\x03\x00\x00\x4e\x03\x00\x00\x64\x03\x00\x00\x84\x03\x00\x00\xa4\x03\x00\x00\xb9"
+            "\x03\x00\x00\xcd\x03\x00\x00\xe1\x03\x00\x00\xf5\x03\x00\x00\x09\x04\x00\x00\x1d\x04\x00\x00\x31\x04\x00\x00\x40\x04\x00\x00\x57"
+            "\x04\x00\x00\x6d\x04\x00\x00\x84\x04\x00\x00\xaf\x04\x00\x00\xcf\x04\x00\x00\xfa\x04\x00\x00\x09\x05\x00\x00\x23\x05\x00\x00\x39"
+            "\x05\x00\x00\x47\x05\x00\x00\x5d\x05\x00\x00\x74\x05\x00\x00\x85\x05\x00\x00\x9b\x05\x00\x00\xb6\x05\x00\x00\xd2\x05\x00\x00\xea"
+            "\x05\x00\x00\x05\x06\x00\x00\x20\x06\x00\x00\x3b\x06\x00\x00\x56\x06\x00\x00\x79\x06\x00\x00\x95\x06\x00\x00\xb2\x06\x00\x00\xe3"
+            "\x06\x00\x00\x13\x07\x00\x00\x23\x07\x00\x00\x32\x07\x00\x00\x4c\x07\x00\x00\x64\x07\x00\x00\x7a\x07\x00\x00\x9a\x07\x00\x00\xb8"
+            "\x07\x00\x00\xce\x07\x00\x00\xdd\x07\x00\x00\xf7\x07\x00\x00\x02\x08\x00\x00\x0d\x08\x00\x00\x1a\x08\x00\x00\x27\x08\x00\x00\x36"
+            "\x08\x00\x00\x3f\x08\x00\x00\x48\x08\x00\x00\x51\x08\x00\x00\x60\x08\x00\x00\x71\x08\x00\x00\x80\x08\x00\x00\x91\x08\x00\x00\x9a"
+            "\x08\x00\x00\xa3\x08\x00\x00\xac\x08\x00\x00\xb5\x08\x00\x00\xc3\x08\x00\x00\xd1\x08\x00\x00\xdf\x08\x00\x00\xed\x08\x00\x00\xfb"
+            "\x08\x00\x00\x0a\x09\x00\x00\x1b\x09\x00\x00\x2c\x09\x00\x00\x3c\x09\x00\x00\x4d\x09\x00\x00\x5c\x09\x00\x00\x65\x09\x00\x00\x6e"
+            "\x09\x00\x00\x77\x09\x00\x00\x80\x09\x00\x00\x89\x09\x00\x00\x92\x09\x00\x00\x9b\x09\x00\x00\xa4\x09\x00\x00\xad\x09\x00\x00\xb6"
+            "\x09\x00\x00\xbf\x09\x00\x00\xc8\x09\x00\x00\xd1\x09\x00\x00\xda\x09\x00\x00\xeb\x09\x00\x00\xfc\x09\x00\x00\x0a\x0a\x00\x00\x13"
+            "\x0a\x00\x00\x1c\x0a\x00\x00\x25\x0a\x00\x00\x2e\x0a\x00\x00\x43\x69\x75\x64\x61\x64\x20\x43\x61\x6e\x61\x6c\x0d\x00\x74\x56\x65"
+            "\x74\x75\x73\x74\x61\x0f\x00\x65\x50\x72\x61\x64\x65\x72\x0f\x00\xf9\x1d\x4d\x61\x72\x69\x6e\x61\x00\x4c\x69\x67\x61\x20\x50\x6f"
+            "\x6b\xc3\xa9\x6d\x6f\x6e\x00\x4d\x69\x6e\x61\x20\x50\x69\x72\x69\x74\x61\x20\x50\x72\x69\x6d\x65\x72\x20\x70\x69\x73\x6f\x18\x00"
+            "\xf3\x0d\x53\xc3\xb3\x74\x61\x6e\x6f\x00\x56\x61\x6c\x6c\x65\x20\x45\xc3\xb3\x6c\x69\x63\x6f\x00\x42\x6f\x73\x71\x75\x65\x74\x00"
+            "\xfa\x22\x6f\x00\x46\x6f\x72\x6a\x61\x20\x46\x75\x65\x67\x6f\x00\x4d\x6f\x6e\x74\x65\x20\x43\x6f\x72\x6f\x6e\x61\x20\x28\x45\x6e"
+            "\x74\x72\x61\x64\x61\x20\x52\x75\x74\x61\x20\x32\x30\x37\x2f\x32\x30\x38\x29\x24\x00\x09\x7a\x00\x08\x19\x00\x7f\x53\x65\x67\x75"
+            "\x6e\x64\x6f\x1a\x00\x00\xf0\x02\x45\x6e\x20\x65\x6c\x20\x65\x78\x74\x65\x72\x69\x6f\x72\x20\x28\x7a\x15\x00\x8b\x64\x65\x20\x6e"
+            "\x69\x65\x76\x65\x5f\x00\x4f\x54\x65\x72\x63\x5f\x00\x02\x5f\x43\x75\x61\x72\x74\x5e\x00\x01\x4f\x51\x75\x69\x6e\x19\x00\x02\x3f"
+            "\x53\x65\x78\x18\x00\x02\x13\x45\x89\x00\x0f\xfc\x00\x0a\x2b\x31\x36\x99\x00\x0c\x20\x00\x1b\x31\x20\x00\x04\x7a\x01\x80\x47\x72"
+            "\x61\x6e\x20\x50\x61\x6e\x0d\x00\x20\x20\x5a\x1a\x00\x1f\x31\x14\x00\x00\x1f\x32\x14\x00\x00\x1f\x33\x14\x00\x00\x1f\x34\x14\x00"
+            "\x00\x1f\x35\x14\x00\x00\xd0\x36\x00\x52\x75\x69\x6e\x61\x73\x20\x53\x6f\x73\x69\xd8\x01\x11\x43\x01\x02\x70\x56\x69\x63\x74\x6f"
+            "\x72\x69\x83\x01\x01\xbd\x00\x0c\x17\x00\x6c\x50\x69\x73\x6f\x20\x31\x16\x00\x04\xcb\x00\x0f\x44\x00\x03\x52\x20\x61\x6c\x20\x73"
+            "\x22\x00\x50\x20\x70\x72\x6f\x66\xf5\x01\x0f\x42\x00\x04\x0f\x20\x00\x07\x40\x61\x6c\x69\x64\x04\x02\x0f\x4b\x00\x00\xb0\x53\x65"
+            "\x6e\x64\x61\x20\x44\x65\x73\x6f\x6c\xb2\x00\x40\x50\x75\x65\x72\xf1\x02\x0e\xf8\x02\x0a\x1a\x00\x04\xb5\x00\x00\x95\x01\x9a\x61"
+            "\xc3\xb1\x61\x20\x44\x75\x72\x61\x0e\x00\x05\x06\x01\x0a\x16\x00\x23\x49\x6e\x10\x02\x30\x46\x75\x65\xd1\x01\x70\x44\x65\x73\x70"
+            "\x65\x64\x69\x2e\x01\xc6\x75\x65\x76\x61\x20\x52\x65\x74\x6f\x72\x6e\x6f\x44\x01\x09\x16\x00\x03\x92\x00\x5b\x50\x69\x6c\x61\x72"
+            "\x1b\x00\x04\x12\x03\x02\x1c\x00\x90\x54\x65\x6d\x70\x6c\x6f\x20\x50\x75\xb7\x01\x00\x27\x00\x30\x53\x61\x6c\x1d\x02\x0e\x18\x00"
+            "\x03\x12\x01\x0f\x1b\x00\x08\x1f\x32\x1b\x00\x07\x1f\x33\x1b\x00\x07\x1f\x34\x84\x00\x04\xc3\x64\x65\x20\x52\x65\x67\x69\x67\x69"
+            "\x67\x61\x73\xc3\x00\x83\x45\x78\x74\x72\x61\x76\xc3\xad\x5f\x02\x30\x6f\x73\x63\x4e\x01\x0f\x1c\x00\x02\x72\x73\x65\x63\x72\x65"
+            "\x74\x61\x87\x04\x01\x86\x02\xf0\x00\x6d\x61\x6e\xc3\xad\x61\x63\x6f\x20\x28\x6d\x65\x6e\x6f\x73\x60\x00\xff\x04\x31\x30\x20\x55"
+            "\x6e\x6f\x77\x6e\x20\x41\x74\x72\x61\x70\x61\x64\x6f\x73\x29\x31\x00\x03\x2f\xc3\xa1\x30\x00\x06\x83\x54\xc3\xba\x6e\x65\x6c\x20"
+            "\x4d\x2d\x00\xf3\x0b\x00\x4a\x61\x72\x64\xc3\xad\x6e\x20\x54\x72\x6f\x66\x65\x6f\x00\x49\x73\x6c\x61\x20\x48\x69\x65\x72\x72\x99"
+            "\x00\x04\x71\x04\x09\x1a\x00\x20\x50\x6c\x37\x03\x59\x20\x62\x61\x6a\x61\x18\x00\x06\x75\x01\x0f\x16\x00\x01\xaa\x32\x20\x69\x7a"
+            "\x71\x75\x69\x65\x72\x64\x68\x00\x06\x20\x00\x6f\x64\x65\x72\x65\x63\x68\x1e\x00\x03\x70\x33\x00\x56\x69\x65\x6a\x61\xba\x00\x5b"
+            "\x73\x69\xc3\xb3\x6e\x0f\x00\x43\x20\x35\x74\x6f\xdf\x04\xb3\x00\x4c\x61\x67\x6f\x20\x56\x65\x72\x61\x7a\x0b\x00\x42\x61\x6c\x6f"
+            "\x72\x0b\x00\xe3\x41\x67\x75\x64\x65\x7a\x61\x00\x4f\x72\x69\x6c\x6c\x61\x1a\x00\x03\x0d\x00\x04\x1c\x00\x03\xb8\x05\x14\x31\x09"
+            "\x00\x14\x32\x09\x00\x14\x33\x09\x00\x77\x34\x20\x28\x53\x75\x72\x29\x0f\x00\x55\x4e\x6f\x72\x74\x65\x11\x00\x1a\x35\x20\x00\x1c"
+            "\x35\x20\x00\x00\x69\x04\x02\x1c\x06\x04\x09\x00\x14\x38\x09\x00\xf8\x00\x39\x00\x4c\x6f\x73\x74\x20\x54\x6f\x77\x65\x72\x20\x31"
+            "\x46\x0e\x00\x19\x32\x0e\x00\x19\x33\x0e\x00\x19\x34\x0e\x00\x23\x35\x46\x4f\x00\x29\x31\x30\x8a\x00\x00\x0f\x00\x09\x8a\x00\x7a"
+            "\x31\x31\x20\x28\x4f\x65\x73\x11\x00\x18\x45\x10\x00\x1c\x32\x32\x00\x1a\x32\x52\x00\x04\x14\x01\x24\x31\x34\x09\x00\x14\x35\x09"
+            "\x00\x04\xe6\x00\x14\x31\xe6\x00\x14\x31\xe6\x00\x23\x31\x39\x09\x00\x14\x32\x65\x01\x14\x32\x65\x01\x14\x32\x48\x00\x14\x32\x48"
+            "\x00\x14\x32\x3f\x00\x14\x32\x3f\x00\x20\x32\x39\xb7\x04\xd4\x62\x6c\x6f\x20\x48\x6f\x6a\x61\x76\x65\x72\x64\x65\x11\x00\xa1\x43"
+            "\x61\x65\x6c\x65\x73\x74\x69\x73\x00\xbe\x02\x84\x44\x65\x73\x63\x61\x6e\x73\x6f\x39\x00\x14\x30\x09\x00\x04\xb7\x00\x14\x32\xa5"
+            "\x00\x30\x33\x30\x00",
+            1509, 2606
+        },
+        // frlg_es
+        {
+            "\xf4\xff\xce\x6b\x00\x00\x00\xb4\x01\x00\x00\xc2\x01\x00\x00\xd0\x01\x00\x00\xdd\x01\x00\x00\xec\x01\x00\x00\xfb\x01\x00\x00\x09"
+            "\x02\x00\x00\x15\x02\x00\x00\x1c\x02\x00\x00\x23\x02\x00\x00\x2a\x02\x00\x00\x31\x02\x00\x00\x38\x02\x00\x00\x3f\x02\x00\x00\x46"
+            "\x02\x00\x00\x4d\x02\x00\x00\x54\x02\x00\x00\x5c\x02\x00\x00\x64\x02\x00\x00\x6c\x02\x00\x00\x74\x02\x00\x00\x7c\x02\x00\x00\x84"
+            "\x02\x00\x00\x8c\x02\x00\x00\x94\x02\x00\x00\x9c\x02\x00\x00\xa4\x02\x00\x00\xac\x02\x00\x00\xb4\x02\x00\x00\xbc\x02\x00\x00\xc4"
+            "\x02\x00\x00\xcc\x02\x00\x00\xd4\x02\x00\x00\xe1\x02\x00\x00\xf8\x02\x00\x00\x0d\x03\x00\x00\x22\x03\x00\x00\x2c\x03\x00\x00\x3a"
+            "\x03\x00\x00\x55\x03\x00\x00\x73\x03\x00\x00\x91\x03\x00\x00\xbd\x03\x00\x00\xd7\x03\x00\x00\xf1\x03\x00\x00\x05\x04\x00\x00\x19"
+            "\x04\x00\x00\x2d\x04\x00\x00\x45\x04\x00\x00\x59\x04\x00\x00\x72\x04\x00\x00\x89\x04\x00\x00\xa0\x04\x00\x00\xb7\x04\x00\x00\xce"
+            "\x04\x00\x00\xe4\x04\x00\x00\xfb\x04\x00\x00\x12\x05\x00\x00\x29\x05\x00\x00\x40\x05\x00\x00\x5a\x05\x00\x00\x74\x05\x00\x00\x8a"
+            "\x05\x00\x00\x9e\x05\x00\x00\xa9\x05\x00\x00\xb5\x05\x00\x00\xbf\x05\x00\x00\xcf\x05\x00\x00\xdc\x05\x00\x00\xe9\x05\x00\x00\xf7"
+            "\x05\x00\x00\x08\x06\x00\x00\x18\x06\x00\x00\x22\x06\x00\x00\x32\x06\x00\x00\x41\x06\x00\x00\x4e\x06\x00\x00\x59\x06\x00\x00\x68"
+            "\x06\x00\x00\x75\x06\x00\x00\x8f\x06\x00\x00\xa2\x06\x00\x00\xb2\x06\x00\x00\xbe\x06\x00\x00\xd2\x06\x00\x00\xf6\x06\x00\x00\x0f"
+            "\x07\x00\x00\x33\x07\x00\x00\x4c\x07\x00\x00\x63\x07\x00\x00\x7a\x07\x00\x00\x91\x07\x00\x00\xa8\x07\x00\x00\xbf\x07\x00\x00\xcb"
+            "\x07\x00\x00\xef\x07\x00\x00\x13\x08\x00\x00\x2a\x08\x00\x00\x4e\x08\x00\x00\x57\x08\x00\x00\x67\x08\x00\x00\x78\x08\x00\x00\x89"
+            "\x08\x00\x00\x9a\x08\x00\x00\xab\x08\x00\x00\xbb\x08\x00\x00\xca\x08\x00\x00\xda\x08\x00\x00\x50\x75\x65\x62\x6c\x6f\x20\x50\x61"
+            "\x6c\x65\x74\x61\x00\x56\x69\x72\x69\x64\x69\x61\x6e\x20\x43\x69\x74\x79\x00\x43\x69\x75\x64\x61\x64\x20\x56\x65\x72\x64\x65\x0d"
+            "\x00\x74\x43\x61\x72\x6d\xc3\xad\x6e\x0f\x00\x74\x41\x7a\x75\x6c\x6f\x6e\x61\x0f\x00\xf2\x0a\x46\x75\x63\x73\x69\x61\x00\x49\x73"
+            "\x6c\x61\x20\x43\x61\x6e\x65\x6c\x61\x00\x52\x75\x74\x61\x20\x31\x07\x00\x12\x32\x07\x00\x12\x33\x07\x00\x12\x34\x07\x00\x12\x35"
+            "\x07\x00\x12\x36\x07\x00\x12\x37\x07\x00\x12\x38\x07\x00\x13\x39\x3f\x00\x13\x30\x08\x00\x03\x48\x00\x13\x31\x49\x00\x13\x31\x4a"
+            "\x00\x13\x31\x4b\x00\x13\x31\x4c\x00\x13\x31\x4d\x00\x13\x31\x4e\x00\x13\x31\x4f\x00\x13\x31\x50\x00\x13\x32\x50\x00\x14\x32\x98"
+            "\x00\x03\x50\x00\x13\x32\x50\x00\x13\x32\x50\x00\x93\x32\x35\x00\x42\x6f\x73\x71\x75\x65\x04\x01\xf8\x07\x4d\x6f\x6e\x74\x65\x20"
+            "\x4d\x6f\x6f\x6e\x20\x50\x6c\x61\x6e\x74\x61\x20\x62\x61\x6a\x61\x17\x00\x9f\x53\xc3\xb3\x74\x61\x6e\x6f\x20\x31\x15\x00\x01\xf9"
+            "\x19\x32\x00\x53\x2e\x53\x2e\x20\x41\x6e\x6e\x65\x00\x43\x75\x65\x76\x61\x20\x44\x69\x67\x6c\x65\x74\x74\x00\x43\x61\x6c\x6c\x65"
+            "\x20\x56\x69\x63\x74\x6f\x72\x69\x61\x5d\x00\x0b\x1b\x00\x91\x53\x65\x67\x75\x6e\x64\x61\x20\x70\x23\x00\x0d\x39\x00\x55\x72\x69"
+            "\x6d\x65\x72\x1e\x00\xfa\x00\x4d\x61\x6e\x73\x69\xc3\xb3\x6e\x20\x50\x6f\x6b\xc3\xa9\x6d\xb7\x00\xef\x20\x79\x20\x70\x69\x73\x6f"
+            "\x73\x20\x31\x20\x79\x20\x32\x2c\x00\x00\x03\xb7\x00\xe1\x00\x5a\x6f\x6e\x61\x20\x53\x61\x66\x61\x72\x69\x2c\x20\x0d\x00\x7f\x63"
+            "\x65\x6e\x74\x72\x61\x6c\x1a\x00\x00\x1f\x31\x14\x00\x00\x1f\x32\x14\x00\x00\xca\x33\x00\x54\xc3\xba\x6e\x65\x6c\x20\x52\x6f\x63"
+            "\xf0\x00\x08\x18\x00\x04\x82\x00\x00\x50\x02\x7a\x73\x20\x45\x73\x70\x75\x6d\x2d\x00\x09\x19\x00\x06\x7c\x01\x0f\x17\x00\x02\x1f"
+            "\x32\x17\x00\x03\x1f\x33\x17\x00\x03\x77\x34\x00\x54\x6f\x72\x72\x65\x3a\x01\x20\x69\x73\x44\x00\x0f\x16\x00\x00\x10\x73\xce\x00"
+            "\x0f\x17\x00\x01\x0f\x44\x00\x02\x3f\x73\x20\x35\x17\x00\x03\x13\x36\x14\x02\x7a\x43\x65\x6c\x65\x73\x74\x65\x05\x02\x0a\x1a\x00"
+            "\x01\xe6\x01\x01\xbe\x01\x0b\x1a\x00\x04\x31\x01\x12\x43\xa1\x01\xb3\x20\x64\x65\x20\x45\x6e\x65\x72\x67\xc3\xad\x95\x03\x00\x3b"
+            "\x00\x03\x0b\x00\x53\x51\x75\x61\x72\x74\x0c\x00\x12\x49\x4c\x02\x40\x6d\x69\x6e\x6f\xb8\x03\xf0\x10\x64\x65\x6e\x74\x65\x00\x50"
+            "\x6c\x61\x79\x61\x20\x54\x65\x73\x6f\x72\x6f\x00\x43\x61\x62\x6f\x20\x45\x78\x74\x72\x65\x6d\x6f\x35\x04\x00\xdd\x02\x20\x55\x6e"
+            "\x31\x02\x00\x0e\x00\x41\x72\x74\x6f\x20\x49\x00\xa0\x54\x65\x72\x61\x00\x4c\x75\x67\x61\x72\x7c\x00\xf3\x06\x52\x65\x63\x72\x65"
+            "\x6f\x00\x41\x71\x75\x61\x72\x69\x6e\x74\x6f\x00\x50\x72\x61\x64\x2a\x00\x01\x73\x00\x50\x50\x69\x6c\x61\x72\x27\x00\x42\x75\x65"
+            "\x72\x64\xe8\x01\xd3\x20\x41\x69\x73\x6c\x61\x64\x61\x00\x56\xc3\xad\x61\x78\x03\x01\x0b\x00\xb1\x41\x63\x75\xc3\xa1\x74\x69\x63"
+            "\x61\x00\x56\xf5\x02\x63\x52\x75\x69\x6e\x61\x73\x4c\x01\xf0\x06\x44\x65\x73\x61\x66\xc3\xad\x6f\x20\x28\x45\x78\x74\x65\x72\x69"
+            "\x6f\x72\x29\x00\x45\x04\x01\xa0\x64\x61\x20\x61\x6c\x20\x43\x61\xc3\xb1\xab\x00\x03\x08\x00\x41\x20\x53\xc3\xa9\x28\x01\x02\x44"
+            "\x00\x44\x20\x53\x65\x74\xdd\x03\xa0\x41\x73\x63\x75\x61\x73\x20\x4c\x61\x64\xca\x00\x09\x14\x00\x07\x50\x00\x60\x64\x65\x73\x66"
+            "\x69\x6c\x24\x00\x1a\x6f\x24\x00\x1f\x44\x19\x00\x05\x9f\x53\x61\x6c\x69\x64\x61\x20\x64\x65\x3d\x00\x08\x0e\x54\x04\x04\x3d\x00"
+            "\x0b\x56\x04\x0b\x17\x00\x1f\x32\x17\x00\x03\x1f\x33\x17\x00\x03\x1f\x34\x17\x00\x03\x05\xeb\x04\x34\x42\x61\x79\x71\x02\x50\x47"
+            "\x6c\x61\x63\x69\xf3\x00\x08\x37\x04\x8f\x28\x73\x61\x6c\x61\x20\x31\x29\x24\x00\x0f\x1d\x32\x24\x00\x05\xa0\x02\x0f\x3b\x00\x0d"
+            "\x23\x33\x29\x8f\x00\x15\x6a\xe3\x02\x50\x61\x6d\x62\x69\x61\x98\x02\xe0\x43\xc3\xa1\x6d\x61\x72\x61\x20\x41\x6e\xc3\xa9\x6d\x75"
+            "\x7d\x06\x03\x11\x00\x86\x54\x75\x6c\x69\x70\x64\x6f\x73\x11\x00\x39\x72\x69\x73\x33\x00\x00\xf4\x02\x11\x63\x37\x03\x03\x11\x00"
+            "\x66\x48\x69\x62\x69\x6e\x63\x43\x00\x56\x53\x65\x69\x72\x69\x41\x00\x40\x50\x61\x73\x69\x1c\x02\x00",
+            1401, 2266
+        },
+        // hgss_es
+        {
+            "\xf2\xff\xff\x01\x78\x00\x00\x00\xe8\x01\x00\x00\xf9\x01\x00\x00\x01\x02\x00\x00\x0f\x02\x00\x00\x17\x02\x00\x00\x1f\x02\x00\x00"
+            "\x2c\x02\x00\x00\x3d\x02\x00\x00\x45\x02\x00\x00\x5c\x02\x00\x00\x73\x02\x00\x00\x8c\x02\x00\x00\xa3\x02\x00\x00\xba\x02\x00\x00"
+            "\xc2\x02\x00\x00\xdc\x02\x00\x00\xf2\x02\x00\x00\xfa\x02\x00\x00\x02\x03\x00\x00\x0a\x03\x00\x00\x1a\x03\x00\x00\x22\x03\x00\x00"
+            "\x2a\x03\x00\x00\x36\x03\x00\x00\x50\x03\x00\x00\x66\x03\x00\x00\x74\x03\x00\x00\x7c\x03\x00\x00\x84\x03\x00\x00\x91\x03\x00\x00"
+            "\x99\x03\x00\x00\xa1\x03\x00\x00\xbc\x03\x00\x00\xd5\x03\x00\x00\xee\x03\x00\x00\x07\x04\x00\x00\x18\x04\x00\x00\x20\x04\x00\x00"
+            "\x44\x04\x00\x00\x69\x04\x00\x00\x86\x04\x00\x00\x9c\x04\x00\x00\xa4\x04\x00\x00\xb5\x04\x00\x00\xbd\x04\x00\x00\xd5\x04\x00\x00"
+            "\xeb\x04\x00\x00\x01\x05\x00\x00\x17\x05\x00\x00\x26\x05\x00\x00\x36\x05\x00\x00\x3e\x05\x00\x00\x46\x05\x00\x00\x5d\x05\x00\x00"
+            "\x74\x05\x00\x00\x7c\x05\x00\x00\x90\x05\x00\x00\xb7\x05\x00\x00\xd4\x05\x00\x00\xeb\x05\x00\x00\x02\x06\x00\x00\x19\x06\x00\x00"
+            "\x30\x06\x00\x00\x54\x06\x00\x00\x70\x06\x00\x00\x90\x06\x00\x00\xa0\x06\x00\x00\xb1\x06\x00\x00\xc9\x06\x00\x00\xe8\x06\x00\x00"
+            "\x05\x07\x00\x00\x22\x07\x00\x00\x44\x07\x00\x00\x4c\x07\x00\x00\x54\x07\x00\x00\x5c\x07\x00\x00\x6a\x07\x00\x00\x77\x07\x00\x00"
+            "\x86\x07\x00\x00\x95\x07\x00\x00\xa4\x07\x00\x00\xb2\x07\x00\x00\xbe\x07\x00\x00\xc6\x07\x00\x00\xce\x07\x00\x00\xd6\x07\x00\x00"
+            "\xde\x07\x00\x00\xe9\x07\x00\x00\x01\x08\x00\x00\x15\x08\x00\x00\x2c\x08\x00\x00\x33\x08\x00\x00\x40\x08\x00\x00\x47\x08\x00\x00"
+            "\x4e\x08\x00\x00\x55\x08\x00\x00\x5c\x08\x00\x00\x63\x08\x00\x00\x6a\x08\x00\x00\x71\x08\x00\x00\x79\x08\x00\x00\x81\x08\x00\x00"
+            "\x89\x08\x00\x00\x91\x08\x00\x00\x99\x08\x00\x00\xa1\x08\x00\x00\xa9\x08\x00\x00\xb1\x08\x00\x00\xb9\x08\x00\x00\xc1\x08\x00\x00"
+            "\xc9\x08\x00\x00\xd1\x08\x00\x00\xe1\x08\x00\x00\xef\x08\x00\x00\x05\x09\x00\x00\x1b\x09\x00\x00\x2a\x09\x00\x00\x37\x09\x00\x00"
+            "\x51\x09\x00\x00\x6b\x09\x00\x00\x81\x09\x00\x00\x50\x75\x65\x62\x6c\x6f\x20\x50\x72\x69\x6d\x61\x76\x65\x72\x61\x00\x52\x75\x74"
+            "\x61\x20\x32\x39\x00\x43\x69\x75\x64\x61\x64\x20\x43\x65\x72\x65\x7a\x6f\x16\x00\x23\x33\x30\x08\x00\x14\x31\x1e\x00\xf3\x07\x4d"
+            "\x61\x6c\x76\x61\x00\x54\x6f\x72\x72\x65\x20\x42\x65\x6c\x6c\x73\x70\x72\x6f\x75\x74\x26\x00\xfa\x09\x32\x00\x52\x75\x69\x6e\x61"
+            "\x73\x20\x41\x6c\x66\x61\x20\x28\x45\x78\x74\x65\x72\x69\x6f\x72\x29\x17\x00\x24\x49\x6e\x17\x00\xfa\x09\x43\x75\x65\x76\x61\x20"
+            "\x55\x6e\x69\xc3\xb3\x6e\x20\x50\x6c\x61\x6e\x74\x61\x20\x62\x61\x6a\x61\x19\x00\x9f\x53\xc3\xb3\x74\x61\x6e\x6f\x20\x31\x17\x00"
+            "\x03\x00\x75\x00\x00\x7d\x00\xf9\x00\x33\x00\x50\x6f\x7a\x6f\x20\x53\x6c\x6f\x77\x70\x6f\x6b\x65\x50\x00\x0a\x1a\x00\x03\x3a\x00"
+            "\x83\x00\x45\x6e\x63\x69\x6e\x61\x72\x40\x00\x13\x34\x08\x00\xf3\x02\x35\x00\x50\x61\x72\x71\x75\x65\x20\x4e\x61\x63\x69\x6f\x6e"
+            "\x61\x6c\x18\x00\x13\x36\x08\x00\x14\x37\x0b\x01\x43\x49\x72\x69\x73\x0a\x01\x79\x51\x75\x65\x6d\x61\x64\x61\x74\x00\x0a\x1a\x00"
+            "\x04\x74\x00\x02\x16\x00\x63\x43\x61\x6d\x70\x61\x6e\x7b\x01\x23\x33\x38\x08\x00\x05\x83\x01\x43\x4f\x6c\x69\x76\x82\x01\x13\x34"
+            "\x82\x01\xf9\x02\x34\x31\x00\x49\x73\x6c\x61\x73\x20\x52\x65\x6d\x6f\x6c\x69\x6e\x6f\x6c\x00\x0b\x1b\x00\x06\x32\x01\x0f\x19\x00"
+            "\x04\x1f\x32\x19\x00\x05\x15\x33\x83\x00\x73\x72\x71\x75\xc3\xad\x64\x65\xa4\x00\xf9\x00\x34\x32\x00\x4d\x6f\x6e\x74\x65\x20\x4d"
+            "\x6f\x72\x74\x65\x72\x7e\x00\xaf\x20\x28\x65\x6e\x74\x72\x61\x64\x61\x29\x24\x00\x09\x15\x69\xf6\x01\x0b\x25\x00\x81\x72\x69\x6d"
+            "\x65\x72\x61\x20\x70\x2d\x00\x0b\x1d\x00\x04\x36\x01\x02\x84\x00\xf4\x02\x33\x00\x4c\x61\x67\x6f\x20\x64\x65\x20\x6c\x61\x20\x46"
+            "\x75\x72\x69\x9d\x00\x03\xbb\x01\x3c\x48\x65\x6c\x85\x01\x08\x18\x00\x06\x16\x01\x0f\x16\x00\x01\x03\x47\x02\x0b\x16\x00\x05\x10"
+            "\x01\xf3\x08\x45\x6e\x64\x72\x69\x6e\x6f\x00\x47\x75\x61\x72\x69\x64\x61\x20\x44\x72\x61\x67\xc3\xb3\x6e\x81\x00\x13\x35\x08\x00"
+            "\x13\x36\xa3\x02\x83\x4f\x73\x63\x75\x72\x61\x20\x28\x3d\x03\x04\xea\x02\x09\x17\x00\x20\x34\x35\x18\x03\x00\x09\x00\x15\x37\xf6"
+            "\x00\x34\x6f\x6e\x20\x1e\x03\x08\x14\x00\x04\x49\x03\x86\x20\x28\x50\x6c\x61\x7a\x61\x20\x1b\x00\x13\x29\xc9\x01\x90\x45\x73\x70"
+            "\x75\x6d\x61\x20\x5a\x6f\x67\x03\x9a\x64\x65\x20\x61\x63\x63\x65\x73\x6f\x1d\x00\x0c\x16\x02\x0b\x17\x00\x04\x14\x02\x0b\x17\x00"
+            "\x1f\x33\x17\x00\x03\x13\x34\xd3\x00\x10\x4d\x6f\x01\x62\x74\x65\x61\x64\x6f\x20\x11\x00\xc3\x63\x6f\x6e\x20\x63\x61\x73\x63\x61"
+            "\x64\x61\x73\xc4\x00\x05\x22\x00\x30\x4c\x61\x64\xeb\x01\x5f\x76\x65\x72\x64\x65\x40\x00\x05\xf3\x09\x70\x65\x71\x75\x65\xc3\xb1"
+            "\x61\x00\x50\x61\x73\x6f\x20\x41\x63\x61\x6e\x74\x69\x6c\x61\x64\x6f\x30\x00\x07\x11\x00\x0b\x5d\x00\x04\x25\x01\x0f\x59\x00\x05"
+            "\x7f\x65\x73\x70\x69\x72\x61\x6c\x94\x00\x04\x54\x6e\x65\x76\x61\x64\x79\x04\x0d\x3c\x00\x20\x66\x69\x08\x04\x0f\x1d\x00\x04\x10"
+            "\x64\x8b\x01\x52\x6c\x74\x72\x65\x73\xd0\x01\x13\x31\x4b\x02\x23\x31\x39\x5b\x05\x15\x30\x74\x05\x54\x61\x6c\x65\x74\x61\x53\x02"
+            "\x12\x56\x07\x01\x04\x76\x05\x46\x6c\x65\x73\x74\x0f\x00\x64\x61\x72\x6d\xc3\xad\x6e\x0f\x00\x65\x41\x7a\x75\x6c\x6f\x6e\x3a\x00"
+            "\x52\x46\x75\x63\x73\x69\xf6\x03\x64\x20\x43\x61\x6e\x65\x6c\x09\x03\x03\x4a\x04\x13\x32\xac\x04\x23\x32\x37\x08\x00\x17\x38\x4e"
+            "\x02\xbb\x00\x54\xc3\xba\x6e\x65\x6c\x20\x52\x6f\x63\xb1\x04\x07\x18\x00\x04\x79\x03\xf2\x01\x43\x61\x6c\x6c\x65\x20\x56\x69\x63"
+            "\x74\x6f\x72\x69\x61\x20\x45\xe9\x03\x03\xe0\x00\x03\x5d\x00\x41\x20\x28\x53\x75\xe4\x05\x00\xec\x02\x03\x89\x00\x02\x07\x00\x03"
+            "\x17\x03\x03\x8e\x00\x03\x8d\x00\x03\xa4\x00\x03\x1d\x01\x13\x31\xe0\x04\x13\x31\x4e\x00\x13\x31\x42\x00\x13\x31\x43\x00\x13\x31"
+            "\x44\x00\x13\x31\x45\x00\x13\x31\x46\x00\x14\x31\xeb\x00\x04\x86\x00\x03\x75\x01\x13\x32\x38\x00\xf4\x02\x32\x35\x00\x43\x61\x74"
+            "\x61\x72\x61\x74\x61\x73\x20\x54\x6f\x68\x6a\x41\x02\x7c\x44\x69\x67\x6c\x65\x74\x74\xda\x00\x31\x50\x69\x73\x62\x06\x0f\x16\x00"
+            "\x00\x04\x5a\x00\x30\x20\x28\x4e\x97\x04\x50\x29\x00\x42\x6f\x73\x20\x06\x03\xc0\x01\xba\x65\x72\x75\x6c\x65\x61\x6e\x20\x43\x61"
+            "\x76\x75\x06\x0b\x1a\x00\x01\xe8\x04\x5b\x20\x70\x69\x73\x6f\x1a\x00\x04\x6c\x01\x00",
+            1493, 2433
+        },
+        // natures_es
+        {
+            "\xf0\x9a\x19\x00\x00\x00\x6c\x00\x00\x00\x73\x00\x00\x00\x7b\x00\x00\x00\x81\x00\x00\x00\x87\x00\x00\x00\x8f\x00\x00\x00\x95\x00"
+            "\x00\x00\x9c\x00\x00\x00\xa5\x00\x00\x00\xad\x00\x00\x00\xb3\x00\x00\x00\xbb\x00\x00\x00\xc2\x00\x00\x00\xc8\x00\x00\x00\xcf\x00"
+            "\x00\x00\xd7\x00\x00\x00\xdf\x00\x00\x00\xe6\x00\x00\x00\xec\x00\x00\x00\xf4\x00\x00\x00\xfc\x00\x00\x00\x03\x01\x00\x00\x0a\x01"
+            "\x00\x00\x12\x01\x00\x00\x18\x01\x00\x00\x1d\x01\x00\x00\x46\x75\x65\x72\x74\x65\x00\x48\x75\x72\x61\xc3\xb1\x61\x00\x41\x75\x64"
+            "\x61\x7a\x00\x46\x69\x72\x6d\x65\x00\x50\xc3\xad\x63\x61\x72\x61\x00\x4f\x73\x61\x64\x61\x00\x44\xc3\xb3\x63\x69\x6c\x00\x50\x6c"
+            "\xc3\xa1\x63\x69\x64\x61\x00\x41\x67\x69\x74\x18\x00\xf1\x34\x46\x6c\x6f\x6a\x61\x00\x4d\x69\x65\x64\x6f\x73\x61\x00\x41\x63\x74"
+            "\x69\x76\x61\x00\x53\x65\x72\x69\x61\x00\x41\x6c\x65\x67\x72\x65\x00\x49\x6e\x67\x65\x6e\x75\x61\x00\x4d\x6f\x64\x65\x73\x74\x61"
+            "\x00\x41\x66\x61\x62\x6c\x65\x00\x4d\x61\x6e\x73\x61\x00\x54\xc3\xad\x6d\x4f\x00\x30\x6c\x6f\x63\x4f\x00\x91\x53\x65\x72\x65\x6e"
+            "\x61\x00\x41\x6d\x24\x00\xf0\x00\x47\x72\x6f\x73\x65\x72\x61\x00\x43\x61\x75\x74\x61\x00\x52\x8e\x00\x00",
+            282, 285
+        },
+        // powers_es
+        {
+            "\xf0\x7c\x10\x00\x00\x00\x48\x00\x00\x00\x4e\x00\x00\x00\x56\x00\x00\x00\x5d\x00\x00\x00\x64\x00\x00\x00\x69\x00\x00\x00\x6f\x00"
+            "\x00\x00\x78\x00\x00\x00\x7e\x00\x00\x00\x84\x00\x00\x00\x89\x00\x00\x00\x90\x00\x00\x00\x9b\x00\x00\x00\xa5\x00\x00\x00\xab\x00"
+            "\x00\x00\xb3\x00\x00\x00\xbd\x00\x00\x00\x4c\x75\x63\x68\x61\x00\x56\x6f\x6c\x61\x64\x6f\x72\x00\x56\x65\x6e\x65\x6e\x6f\x00\x54"
+            "\x69\x65\x72\x72\x61\x00\x52\x6f\x63\x61\x00\x42\x69\x63\x68\x6f\x00\x46\x61\x6e\x74\x61\x73\x6d\x61\x00\x41\x63\x65\x72\x6f\x00"
+            "\x46\x75\x65\x67\x6f\x00\x41\x67\x75\x61\x00\x50\x6c\x1b\x00\xf0\x03\x00\x45\x6c\xc3\xa9\x63\x74\x72\x69\x63\x6f\x00\x50\x73\xc3"
+            "\xad\x71\x75\x0a\x00\xf0\x09\x48\x69\x65\x6c\x6f\x00\x44\x72\x61\x67\xc3\xb3\x6e\x00\x53\x69\x6e\x69\x65\x73\x74\x72\x6f\x00",
+            191, 189
+        },
+        // rse_es
+        {
+            "\xf0\xff\x4f\x56\x00\x00\x00\x60\x01\x00\x00\x6f\x01\x00\x00\x7d\x01\x00\x00\x8c\x01\x00\x00\x9b\x01\x00\x00\xaa\x01\x00\x00\xb9"
+            "\x01\x00\x00\xc6\x01\x00\x00\xd7\x01\x00\x00\xe0\x01\x00\x00\xe9\x01\x00\x00\xf2\x01\x00\x00\xfb\x01\x00\x00\x04\x02\x00\x00\x0d"
+            "\x02\x00\x00\x16\x02\x00\x00\x1f\x02\x00\x00\x28\x02\x00\x00\x31\x02\x00\x00\x3a\x02\x00\x00\x43\x02\x00\x00\x4c\x02\x00\x00\x55"
+            "\x02\x00\x00\x5e\x02\x00\x00\x67\x02\x00\x00\x70\x02\x00\x00\x79\x02\x00\x00\x82\x02\x00\x00\x8b\x02\x00\x00\x94\x02\x00\x00\x9d"
+            "\x02\x00\x00\xa6\x02\x00\x00\xaf\x02\x00\x00\xb8\x02\x00\x00\xc1\x02\x00\x00\xca\x02\x00\x00\xd3\x02\x00\x00\xdc\x02\x00\x00\xe5"
+            "\x02\x00\x00\xee\x02\x00\x00\xf7\x02\x00\x00\x00\x03\x00\x00\x09\x03\x00\x00\x1d\x03\x00\x00\x31\x03\x00\x00\x54\x03\x00\x00\x77"
+            "\x03\x00\x00\x8f\x03\x00\x00\xa7\x03\x00\x00\xc5\x03\x00\x00\xda\x03\x00\x00\xef\x03\x00\x00\x03\x04\x00\x00\x20\x04\x00\x00\x3b"
+            "\x04\x00\x00\x4a\x04\x00\x00\x5b\x04\x00\x00\x6a\x04\x00\x00\x80\x04\x00\x00\x96\x04\x00\x00\xb7\x04\x00\x00\xe5\x04\x00\x00\x1d"
+            "\x05\x00\x00\x4f\x05\x00\x00\x76\x05\x00\x00\xaa\x05\x00\x00\xd4\x05\x00\x00\xe9\x05\x00\x00\xfc\x05\x00\x00\x0b\x06\x00\x00\x26"
+            "\x06\x00\x00\x35\x06\x00\x00\x50\x06\x00\x00\x69\x06\x00\x00\x82\x06\x00\x00\x9e\x06\x00\x00\xbe\x06\x00\x00\xcb\x06\x00\x00\xd7"
+            "\x06\x00\x00\xf1\x06\x00\x00\x0b\x07\x00\x00\x25\x07\x00\x00\x33\x07\x00\x00\x43\x07\x00\x00\x50\x07\x00\x00\x61\x07\x00\x00\x71"
+            "\x0c\x00\xd4\x75\x65\x62\x6c\x6f\x20\x41\x7a\x75\x6c\x69\x7a\x61\x0f\x00\xf5\x06\x4f\x72\x6f\x6d\x61\x72\x00\x43\x69\x75\x64\x61"
+            "\x64\x20\x50\x65\x74\x61\x6c\x69\x61\x0f\x00\x64\x6f\x72\x74\x75\x61\x6c\x0f\x00\x65\x43\x61\x6c\x61\x67\x75\x1e\x00\xf5\x05\x41"
+            "\x6c\x67\x61\x72\x69\x61\x00\x41\x72\x72\x65\x63\xc3\xad\x70\x6f\x6c\x69\x73\x2b\x00\x41\x6f\x6c\x6f\x73\x4b\x00\x84\x52\x75\x74"
+            "\x61\x20\x31\x30\x31\x09\x00\x14\x32\x09\x00\x14\x33\x09\x00\x14\x34\x09\x00\x14\x35\x09\x00\x14\x36\x09\x00\x14\x37\x09\x00\x14"
+            "\x38\x09\x00\x13\x39\x09\x00\x24\x31\x30\x09\x00\x04\x5a\x00\x14\x31\x5a\x00\x14\x31\x5a\x00\x14\x31\x5a\x00\x14\x31\x5a\x00\x14"
+            "\x31\x5a\x00\x14\x31\x5a\x00\x14\x31\x5a\x00\x14\x31\x5a\x00\x14\x32\x5a\x00\x14\x32\x5a\x00\x14\x32\x5a\x00\x14\x32\x5a\x00\x14"
+            "\x32\x5a\x00\x14\x32\x5a\x00\x14\x32\x5a\x00\x14\x32\x5a\x00\x14\x32\x5a\x00\x14\x32\x5a\x00\x14\x33\x5a\x00\x14\x33\x5a\x00\x14"
+            "\x33\x5a\x00\x14\x33\x5a\x00\xd4\x33\x34\x00\x42\x75\x63\x65\x61\x6e\x64\x6f\x20\x28\x6d\x00\x1e\x29\x14\x00\xff\x15\x36\x29\x00"
+            "\x43\x75\x65\x76\x61\x20\x47\x72\x61\x6e\x69\x74\x6f\x20\x50\x6c\x61\x6e\x74\x61\x20\x62\x61\x6a\x61\x20\x28\x7a\x6f\x6e\x61\x20"
+            "\x31\x23\x00\x0f\x1c\x32\x23\x00\x9f\x53\xc3\xb3\x74\x61\x6e\x6f\x20\x31\x18\x00\x04\x30\x32\x00\x5a\x38\x00\xfc\x09\x53\x61\x66"
+            "\x61\x72\x69\x20\x53\x75\x72\x65\x73\x74\x65\x20\x28\x65\x6e\x74\x72\x61\x64\x61\x29\x1e\x00\x10\x6f\x1f\x00\x09\x15\x00\x2f\x4e"
+            "\x6f\x15\x00\x03\x0d\x14\x00\xa0\x45\x78\x74\x65\x6e\x73\x69\xc3\xb3\x6e\x1f\x00\x0f\x1d\x00\x07\xa5\x53\x75\x72\x00\x42\x6f\x73"
+            "\x71\x75\x65\xbe\x02\xf0\x08\x54\xc3\xba\x6e\x65\x6c\x20\x46\x65\x72\x76\x65\x72\x67\x61\x6c\x00\x4e\x61\x6f\x20\x41\x62\x40\x01"
+            "\xf4\x04\x6e\x61\x64\x61\x00\x4d\x61\x6c\x76\x61\x6c\x61\x6e\x6f\x76\x61\x20\x28\x45\xbb\x00\x09\x16\x00\x03\xf0\x00\xf3\x03\x29"
+            "\x00\x43\x61\x73\x63\x61\x64\x61\x20\x4d\x65\x74\x65\x6f\x72\x6f\x20\x2f\x00\x07\x63\x01\x0b\x21\x00\xf1\x01\x49\x6e\x74\x65\x72"
+            "\x69\x6f\x72\x20\x64\x65\x20\x6c\x61\x20\x63\x47\x01\x06\x6e\x01\x0b\x2e\x00\x05\x70\x01\x0f\x38\x00\x09\x0f\x66\x00\x00\x05\x90"
+            "\x01\xff\x00\x20\x43\x75\x61\x72\x74\x6f\x20\x74\x72\x61\x73\x65\x72\x6f\x6a\x00\x08\x30\x61\x6c\x61\x5c\x00\xf9\x0c\x4d\xc3\xa1"
+            "\x78\x69\x6d\x6f\x20\x50\x65\xc3\xb1\x61\x73\x00\x4d\x6f\x6e\x74\x65\x20\x50\xc3\xad\x72\x69\x63\x22\x02\xf2\x04\x2c\x20\x70\x69"
+            "\x73\x6f\x73\x20\x31\x20\x79\x20\x32\x20\x28\x63\x65\x6d\x65\xa2\x00\x1c\x29\x34\x00\x01\x27\x00\x8f\x33\x2c\x20\x34\x20\x79\x20"
+            "\x35\x2a\x00\x09\x6b\x4c\x61\x64\x65\x72\x61\x15\x00\x43\x43\x69\x6d\x61\x6d\x02\x8b\x43\x61\x72\x64\x75\x6d\x65\x6e\x0f\x00\x02"
+            "\xbb\x00\x30\x68\x65\x6c\xbc\x01\xc0\x43\x61\x76\x65\x72\x6e\x61\x20\x41\x62\x69\x73\x9a\x04\xd8\x61\x6c\x6c\x65\x20\x56\x69\x63"
+            "\x74\x6f\x72\x69\x61\xc0\x00\x0c\x1b\x00\x07\xda\x02\x0f\x19\x00\x03\x13\x32\x77\x00\x9a\x41\x6e\x63\x65\x73\x74\x72\x61\x6c\x4e"
+            "\x00\x0b\x1c\x00\x03\x36\x00\x00\x20\x01\xf0\x09\x61\x6c\x20\x35\x00\x53\x65\x6e\x64\x61\x20\xc3\x8d\x67\x6e\x65\x61\x00\x44\x65"
+            "\x73\x66\x69\x6c\xee\x00\xb1\x6f\x00\x50\x69\x6c\x61\x72\x20\x43\x65\x6c\x2a\x03\x08\x53\x00\x0b\x1a\x00\x06\x6e\x01\x0f\x1a\x00"
+            "\x02\xb0\x33\x20\x79\x20\x34\x00\x47\x75\x61\x72\x69\xd6\x01\xf3\x05\x61\x67\x6d\x61\x00\x54\x6f\x72\x72\x65\x20\x45\x73\x70\x65"
+            "\x6a\x69\x73\x6d\x6f\xa5\x00\x10\x54\xe0\x00\x40\x72\x00\x47\x72\x2a\x04\x96\x44\x65\x73\xc3\xa9\x72\x74\x69\x63\x65\x01\x80\x6d"
+            "\x62\x69\x61\x6e\x74\x65\x00",
+            1191, 1905
+        },
+        // species_es
+        {
+            "\xf1\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xae\x27\x03\x00\x00\xa4\x0c\x00\x00\xae\x0c\x00\x00\xb6\x0c\x00\x00\xbf\x0c"
+            "\x00\x00\xca\x0c\x00\x00\xd5\x0c\x00\x00\xdf\x0c\x00\x00\xe8\x0c\x00\x00\xf2\x0c\x00\x00\xfc\x0c\x00\x00\x05\x0d\x00\x00\x0d\x0d"
+            "\x00\x00\x18\x0d\x00\x00\x1f\x0d\x00\x00\x26\x0d\x00\x00\x2f\x0d\x00\x00\x36\x0d\x00\x00\x40\x0d\x00\x00\x48\x0d\x00\x00\x50\x0d"
+            "\x00\x00\x59\x0d\x00\x00\x61\x0d\x00\x00\x68\x0d\x00\x00\x6e\x0d\x00\x00\x74\x0d\x00\x00\x7c\x0d\x00\x00\x83\x0d\x00\x00\x8d\x0d"
+            "\x00\x00\x97\x0d\x00\x00\xa2\x0d\x00\x00\xab\x0d\x00\x00\xb5\x0d\x00\x00\xc0\x0d\x00\x00\xc9\x0d\x00\x00\xd2\x0d\x00\x00\xdb\x0d"
+            "\x00\x00\xe4\x0d\x00\x00\xeb\x0d\x00\x00\xf5\x0d\x00\x00\x00\x0e\x00\x00\x0b\x0e\x00\x00\x11\x0e\x00\x00\x18\x0e\x00\x00\x1f\x0e"
+            "\x00\x00\x25\x0e\x00\x00\x2f\x0e\x00\x00\x35\x0e\x00\x00\x3e\x0e\x00\x00\x46\x0e\x00\x00\x4f\x0e\x00\x00\x57\x0e\x00\x00\x5f\x0e"
+            "\x00\x00\x66\x0e\x00\x00\x6e\x0e\x00\x00\x76\x0e\x00\x00\x7e\x0e\x00\x00\x85\x0e\x00\x00\x8e\x0e\x00\x00\x98\x0e\x00\x00\xa1\x0e"
+            "\x00\x00\xa9\x0e\x00\x00\xb3\x0e\x00\x00\xbd\x0e\x00\x00\xc2\x0e\x00\x00\xca\x0e\x00\x00\xd3\x0e\x00\x00\xda\x0e\x00\x00\xe2\x0e"
+            "\x00\x00\xea\x0e\x00\x00\xf5\x0e\x00\x00\x00\x0f\x00\x00\x0b\x0f\x00\x00\x15\x0f\x00\x00\x20\x0f\x00\x00\x28\x0f\x00\x00\x31\x0f"
+            "\x00\x00\x37\x0f\x00\x00\x3e\x0f\x00\x00\x47\x0f\x00\x00\x50\x0f\x00\x00\x58\x0f\x00\x00\x62\x0f\x00\x00\x6b\x0f\x00\x00\x78\x0f"
+            "\x00\x00\x7e\x0f\x00\x00\x85\x0f\x00\x00\x8a\x0f\x00\x00\x92\x0f\x00\x00\x99\x0f\x00\x00\x9d\x0f\x00\x00\xa6\x0f\x00\x00\xaf\x0f"
+            "\x00\x00\xb6\x0f\x00\x00\xbe\x0f\x00\x00\xc5\x0f\x00\x00\xca\x0f\x00\x00\xd2\x0f\x00\x00\xd8\x0f\x00\x00\xdf\x0f\x00\x00\xe7\x0f"
+            "\x00\x00\xef\x0f\x00\x00\xf9\x0f\x00\x00\x03\x10\x00\x00\x0d\x10\x00\x00\x14\x10\x00\x00\x1c\x10\x00\x00\x26\x10\x00\x00\x31\x10"
+            "\x00\x00\x3b\x10\x00\x00\x43\x10\x00\x00\x4b\x10\x00\x00\x53\x10\x00\x00\x5a\x10\x00\x00\x62\x10\x00\x00\x6a\x10\x00\x00\x75\x10"
+            "\x00\x00\x7c\x10\x00\x00\x83\x10\x00\x00\x8b\x10\x00\x00\x93\x10\x00\x00\x9a\x10\x00\x00\xa2\x10\x00\x00\xab\x10\x00\x00\xb3\x10"
+            "\x00\x00\xb8\x10\x00\x00\xc3\x10\x00\x00\xca\x10\x00\x00\xd1\x10\x00\x00\xd8\x10\x00\x00\xe1\x10\x00\x00\xea\x10\x00\x00\xf1\x10"
+            "\x00\x00\xf7\x10\x00\x00\xfd\x10\x00\x00\x06\x11\x00\x00\x0e\x11\x00\x00\x16\x11\x00\x00\x1e\x11\x00\x00\x26\x11\x00\x00\x2e\x11"
+            "\x00\x00\x35\x11\x00\x00\x3e\x11\x00\x00\x49\x11\x00\x00\x51\x11\x00\x00\x5a\x11\x00\x00\x61\x11\x00\x00\x69\x11\x00\x00\x71\x11"
+            "\x00\x00\x7b\x11\x00\x00\x85\x11\x00\x00\x8c\x11\x00\x00\x90\x11\x00\x00\x9a\x11\x00\x00\xa2\x11\x00\x00\xab\x11\x00\x00\xb5\x11"
+            "\x00\x00\xbd\x11\x00\x00\xc8\x11\x00\x00\xd1\x11\x00\x00\xda\x11\x00\x00\xe5\x11\x00\x00\xed\x11\x00\x00\xf4\x11\x00\x00\xfd\x11"
+            "\x00\x00\x05\x12\x00\x00\x0c\x12\x00\x00\x13\x12\x00\x00\x1c\x12\x00\x00\x24\x12\x00\x00\x2b\x12\x00\x00\x34\x12\x00\x00\x3c\x12"
+            "\x00\x00\x42\x12\x00\x00\x49\x12\x00\x00\x53\x12\x00\x00\x5a\x12\x00\x00\x62\x12\x00\x00\x67\x12\x00\x00\x6c\x12\x00\x00\x73\x12"
+            "\x00\x00\x7b\x12\x00\x00\x84\x12\x00\x00\x8e\x12\x00\x00\x95\x12\x00\x00\x9f\x12\x00\x00\xa9\x12\x00\x00\xb2\x12\x00\x00\xb9\x12"
+            "\x00\x00\xc2\x12\x00\x00\xcb\x12\x00\x00\xd1\x12\x00\x00\xd9\x12\x00\x00\xe2\x12\x00\x00\xe8\x12\x00\x00\xef\x12\x00\x00\xf8\x12"
+            "\x00\x00\xff\x12\x00\x00\x07\x13\x00\x00\x0f\x13\x00\x00\x18\x13\x00\x00\x23\x13\x00\x00\x29\x13\x00\x00\x33\x13\x00\x00\x3d\x13"
+            "\x00\x00\x44\x13\x00\x00\x4f\x13\x00\x00\x59\x13\x00\x00\x60\x13\x00\x00\x68\x13\x00\x00\x71\x13\x00\x00\x7a\x13\x00\x00\x83\x13"
+            "\x00\x00\x8a\x13\x00\x00\x92\x13\x00\x00\x9c\x13\x00\x00\xa4\x13\x00\x00\xae\x13\x00\x00\xb7\x13\x00\x00\xbe\x13\x00\x00\xc7\x13"
+            "\x00\x00\xce\x13\x00\x00\xd8\x13\x00\x00\xe0\x13\x00\x00\xe9\x13\x00\x00\xf3\x13\x00\x00\xfc\x13\x00\x00\x04\x14\x00\x00\x0d\x14"
+            "\x00\x00\x16\x14\x00\x00\x1f\x14\x00\x00\x27\x14\x00\x00\x2e\x14\x00\x00\x36\x14\x00\x00\x3f\x14\x00\x00\x48\x14\x00\x00\x51\x14"
+            "\x00\x00\x59\x14\x00\x00\x63\x14\x00\x00\x6c\x14\x00\x00\x73\x14\x00\x00\x79\x14\x00\x00\x81\x14\x00\x00\x89\x14\x00\x00\x90\x14"
+            "\x00\x00\x96\x14\x00\x00\x9e\x14\x00\x00\xa7\x14\x00\x00\xaf\x14\x00\x00\xb9\x14\x00\x00\xbf\x14\x00\x00\xc5\x14\x00\x00\xcc\x14"
+            "\x00\x00\xd4\x14\x00\x00\xdc\x14\x00\x00\xe5\x14\x00\x00\xed\x14\x00\x00\xf7\x14\x00\x00\x00\x15\x00\x00\x07\x15\x00\x00\x11\x15"
+            "\x00\x00\x1a\x15\x00\x00\x24\x15\x00\x00\x2e\x15\x00\x00\x38\x15\x00\x00\x40\x15\x00\x00\x48\x15\x00\x00\x50\x15\x00\x00\x5a\x15"
+            "\x00\x00\x62\x15\x00\x00\x69\x15\x00\x00\x6f\x15\x00\x00\x76\x15\x00\x00\x7f\x15\x00\x00\x86\x15\x00\x00\x8e\x15\x00\x00\x96\x15"
+            "\x00\x00\x9e\x15\x00\x00\xa6\x15\x00\x00\xae\x15\x00\x00\xb7\x15\x00\x00\xbd\x15\x00\x00\xc4\x15\x00\x00\xce\x15\x00\x00\xd6\x15"
+            "\x00\x00\xe1\x15\x00\x00\xeb\x15\x00\x00\xf3\x15\x00\x00\xfb\x15\x00\x00\x04\x16\x00\x00\x0c\x16\x00\x00\x14\x16\x00\x00\x1c\x16"
+            "\x00\x00\x25\x16\x00\x00\x2d\x16\x00\x00\x35\x16\x00\x00\x3d\x16\x00\x00\x46\x16\x00\x00\x4f\x16\x00\x00\x57\x16\x00\x00\x60\x16"
+            "\x00\x00\x67\x16\x00\x00\x70\x16\x00\x00\x78\x16\x00\x00\x7f\x16\x00\x00\x84\x16\x00\x00\x8b\x16\x00\x00\x92\x16\x00\x00\x9b\x16"
+            "\x00\x00\xa4\x16\x00\x00\xae\x16\x00\x00\xb8\x16\x00\x00\xbf\x16\x00\x00\xc5\x16\x00\x00\xcd\x16\x00\x00\xd6\x16\x00\x00\xde\x16"
+            "\x00\x00\xe5\x16\x00\x00\xec\x16\x00\x00\xf5\x16\x00\x00\xfe\x16\x00\x00\x06\x17\x00\x00\x0e\x17\x00\x00\x14\x17\x00\x00\x1d\x17"
+            "\x00\x00\x25\x17\x00\x00\x2c\x17\x00\x00\x34\x17\x00\x00\x3b\x17\x00\x00\x44\x17\x00\x00\x4c\x17\x00\x00\x53\x17\x00\x00\x5a\x17"
+            "\x00\x00\x63\x17\x00\x00\x6a\x17\x00\x00\x72\x17\x00\x00\x7b\x17\x00\x00\x83\x17\x00\x00\x8c\x17\x00\x00\x94\x17\x00\x00\x9d\x17"
+            "\x00\x00\xa6\x17\x00\x00\xaf\x17\x00\x00\xb9\x17\x00\x00\xc0\x17\x00\x00\xc8\x17\x00\x00\xcf\x17\x00\x00\xd7\x17\x00\x00\xdf\x17"
+            "\x00\x00\xe7\x17\x00\x00\xee\x17\x00\x00\xf6\x17\x00\x00\xff\x17\x00\x00\x07\x18\x00\x00\x0f\x18\x00\x00\x17\x18\x00\x00\x1f\x18"
+            "\x00\x00\x28\x18\x00\x00\x30\x18\x00\x00\x39\x18\x00\x00\x3f\x18\x00\x00\x46\x18\x00\x00\x4e\x18\x00\x00\x55\x18\x00\x00\x5c\x18"
+            "\x00\x00\x63\x18\x00\x00\x6b\x18\x00\x00\x74\x18\x00\x00\x7c\x18\x00\x00\x85\x18\x00\x00\x8f\x18\x00\x00\x97\x18\x00\x00\x9d\x18"
+            "\x00\x00\xa5\x18\x00\x00\xaf\x18\x00\x00\xb6\x18\x00\x00\xbd\x18\x00\x00\xc7\x18\x00\x00\xd0\x18\x00\x00\xd7\x18\x00\x00\xe1\x18"
+            "\x00\x00\xe8\x18\x00\x00\xef\x18\x00\x00\xf6\x18\x00\x00\xfe\x18\x00\x00\x07\x19\x00\x00\x0f\x19\x00\x00\x16\x19\x00\x00\x1e\x19"
+            "\x00\x00\x25\x19\x00\x00\x2e\x19\x00\x00\x37\x19\x00\x00\x40\x19\x00\x00\x4a\x19\x00\x00\x51\x19\x00\x00\x5a\x19\x00\x00\x63\x19"
+            "\x00\x00\x6a\x19\x00\x00\x73\x19\x00\x00\x7d\x19\x00\x00\x84\x19\x00\x00\x8c\x19\x00\x00\x96\x19\x00\x00\xa1\x19\x00\x00\xa7\x19"
+            "\x00\x00\xad\x19\x00\x00\xb4\x19\x00\x00\xba\x19\x00\x00\xc3\x19\x00\x00\xcc\x19\x00\x00\xd6\x19\x00\x00\xdf\x19\x00\x00\xe9\x19"
+            "\x00\x00\xef\x19\x00\x00\xf8\x19\x00\x00\xff\x19\x00\x00\x06\x1a\x00\x00\x10\x1a\x00\x00\x1a\x1a\x00\x00\x21\x1a\x00\x00\x2a\x1a"
+            "\x00\x00\x32\x1a\x00\x00\x3a\x1a\x00\x00\x42\x1a\x00\x00\x4c\x1a\x00\x00\x54\x1a\x00\x00\x5d\x1a\x00\x00\x66\x1a\x00\x00\x6e\x1a"
+            "\x00\x00\x76\x1a\x00\x00\x80\x1a\x00\x00\x8a\x1a\x00\x00\x92\x1a\x00\x00\x9a\x1a\x00\x00\xa4\x1a\x00\x00\xab\x1a\x00\x00\xb4\x1a"
+            "\x00\x00\xbc\x1a\x00\x00\xc5\x1a\x00\x00\xcc\x1a\x00\x00\xd5\x1a\x00\x00\xdd\x1a\x00\x00\xe4\x1a\x00\x00\xee\x1a\x00\x00\xf4\x1a"
+            "\x00\x00\xfb\x1a\x00\x00\x04\x1b\x00\x00\x0d\x1b\x00\x00\x13\x1b\x00\x00\x1b\x1b\x00\x00\x26\x1b\x00\x00\x30\x1b\x00\x00\x38\x1b"
+            "\x00\x00\x40\x1b\x00\x00\x49\x1b\x00\x00\x53\x1b\x00\x00\x5d\x1b\x00\x00\x65\x1b\x00\x00\x6e\x1b\x00\x00\x76\x1b\x00\x00\x7d\x1b"
+            "\x00\x00\x87\x1b\x00\x00\x8f\x1b\x00\x00\x99\x1b\x00\x00\xa4\x1b\x00\x00\xae\x1b\x00\x00\xb8\x1b\x00\x00\xc3\x1b\x00\x00\xcd\x1b"
+            "\x00\x00\xd6\x1b\x00\x00\xde\x1b\x00\x00\xe6\x1b\x00\x00\xee\x1b\x00\x00\xf6\x1b\x00\x00\x00\x1c\x00\x00\x0a\x1c\x00\x00\x12\x1c"
+            "\x00\x00\x1c\x1c\x00\x00\x25\x1c\x00\x00\x2e\x1c\x00\x00\x34\x1c\x00\x00\x39\x1c\x00\x00\x41\x1c\x00\x00\x47\x1c\x00\x00\x4e\x1c"
+            "\x00\x00\x55\x1c\x00\x00\x5d\x1c\x00\x00\x67\x1c\x00\x00\x70\x1c\x00\x00\x7a\x1c\x00\x00\x81\x1c\x00\x00\x89\x1c\x00\x00\x91\x1c"
+            "\x00\x00\x99\x1c\x00\x00\xa0\x1c\x00\x00\xa8\x1c\x00\x00\xae\x1c\x00\x00\xb6\x1c\x00\x00\xc0\x1c\x00\x00\xc6\x1c\x00\x00\xce\x1c"
+            "\x00\x00\xd5\x1c\x00\x00\xde\x1c\x00\x00\xe5\x1c\x00\x00\xee\x1c\x00\x00\xf5\x1c\x00\x00\xfd\x1c\x00\x00\x06\x1d\x00\x00\x0e\x1d"
+            "\x00\x00\x18\x1d\x00\x00\x21\x1d\x00\x00\x29\x1d\x00\x00\x31\x1d\x00\x00\x3a\x1d\x00\x00\x42\x1d\x00\x00\x4b\x1d\x00\x00\x53\x1d"
+            "\x00\x00\x5c\x1d\x00\x00\x62\x1d\x00\x00\x6b\x1d\x00\x00\x72\x1d\x00\x00\x7c\x1d\x00\x00\x85\x1d\x00\x00\x8d\x1d\x00\x00\x97\x1d"
+            "\x00\x00\xa2\x1d\x00\x00\xaa\x1d\x00\x00\xb3\x1d\x00\x00\xba\x1d\x00\x00\xc2\x1d\x00\x00\xca\x1d\x00\x00\xd4\x1d\x00\x00\xdb\x1d"
+            "\x00\x00\xe3\x1d\x00\x00\xeb\x1d\x00\x00\xf6\x1d\x00\x00\xfe\x1d\x00\x00\x08\x1e\x00\x00\x13\x1e\x00\x00\x19\x1e\x00\x00\x1e\x1e"
+            "\x00\x00\x27\x1e\x00\x00\x30\x1e\x00\x00\x39\x1e\x00\x00\x42\x1e\x00\x00\x4d\x1e\x00\x00\x57\x1e\x00\x00\x60\x1e\x00\x00\x6b\x1e"
+            "\x00\x00\x73\x1e\x00\x00\x7d\x1e\x00\x00\x86\x1e\x00\x00\x8e\x1e\x00\x00\x97\x1e\x00\x00\xa2\x1e\x00\x00\xab\x1e\x00\x00\xb6\x1e"
+            "\x00\x00\xbf\x1e\x00\x00\xc7\x1e\x00\x00\xcf\x1e\x00\x00\xd7\x1e\x00\x00\xdf\x1e\x00\x00\xe8\x1e\x00\x00\xef\x1e\x00\x00\xfa\x1e"
+            "\x00\x00\x03\x1f\x00\x00\x0e\x1f\x00\x00\x15\x1f\x00\x00\x1e\x1f\x00\x00\x27\x1f\x00\x00\x30\x1f\x00\x00\x36\x1f\x00\x00\x3e\x1f"
+            "\x00\x00\x47\x1f\x00\x00\x50\x1f\x00\x00\x58\x1f\x00\x00\x62\x1f\x00\x00\x6d\x1f\x00\x00\x75\x1f\x00\x00\x7d\x1f\x00\x00\x87\x1f"
+            "\x00\x00\x90\x1f\x00\x00\x97\x1f\x00\x00\xa1\x1f\x00\x00\xab\x1f\x00\x00\xb5\x1f\x00\x00\xbe\x1f\x00\x00\xc7\x1f\x00\x00\xce\x1f"
+            "\x00\x00\xd9\x1f\x00\x00\xe4\x1f\x00\x00\xec\x1f\x00\x00\xf6\x1f\x00\x00\xff\x1f\x00\x00\x09\x20\x00\x00\x13\x20\x00\x00\x1a\x20"
+            "\x00\x00\x25\x20\x00\x00\x2f\x20\x00\x00\x3a\x20\x00\x00\x40\x20\x00\x00\x46\x20\x00\x00\x50\x20\x00\x00\x57\x20\x00\x00\x61\x20"
+            "\x00\x00\x6c\x20\x00\x00\x73\x20\x00\x00\x7c\x20\x00\x00\x84\x20\x00\x00\x8c\x20\x00\x00\x97\x20\x00\x00\x9c\x20\x00\x00\xa4\x20"
+            "\x00\x00\xac\x20\x00\x00\xb4\x20\x00\x00\xbc\x20\x00\x00\xc6\x20\x00\x00\xce\x20\x00\x00\xd7\x20\x00\x00\xe0\x20\x00\x00\xe8\x20"
+            "\x00\x00\xf1\x20\x00\x00\xfb\x20\x00\x00\x02\x21\x00\x00\x09\x21\x00\x00\x12\x21\x00\x00\x1a\x21\x00\x00\x25\x21\x00\x00\x2d\x21"
+            "\x00\x00\x36\x21\x00\x00\x3e\x21\x00\x00\x48\x21\x00\x00\x50\x21\x00\x00\x57\x21\x00\x00\x5d\x21\x00\x00\x66\x21\x00\x00\x70\x21"
+            "\x00\x00\x79\x21\x00\x00\x83\x21\x00\x00\x8c\x21\x00\x00\x96\x21\x00\x00\x9f\x21\x00\x00\xa8\x21\x00\x00\xb2\x21\x00\x00\xbb\x21"
+            "\x00\x00\xc2\x21\x00\x00\xcb\x21\x00\x00\xd2\x21\x00\x00\xd9\x21\x00\x00\xe2\x21\x00\x00\xeb\x21\x00\x00\xf3\x21\x00\x00\xfd\x21"
+            "\x00\x00\x08\x22\x00\x00\x11\x22\x00\x00\x19\x22\x00\x00\x21\x22\x00\x00\x29\x22\x00\x00\x33\x22\x00\x00\x3c\x22\x00\x00\x45\x22"
+            "\x00\x00\x4f\x22\x00\x00\x5a\x22\x00\x00\x66\x22\x00\x00\x71\x22\x00\x00\x7c\x22\x00\x00\x83\x22\x00\x00\x8c\x22\x00\x00\x93\x22"
+            "\x00\x00\x9a\x22\x00\x00\xa4\x22\x00\x00\xac\x22\x00\x00\xb4\x22\x00\x00\xbb\x22\x00\x00\xc2\x22\x00\x00\xca\x22\x00\x00\xd2\x22"
+            "\x00\x00\xda\x22\x00\x00\xe1\x22\x00\x00\xea\x22\x00\x00\xf2\x22\x00\x00\xfb\x22\x00\x00\x05\x23\x00\x00\x0e\x23\x00\x00\x19\x23"
+            "\x00\x00\x21\x23\x00\x00\x2a\x23\x00\x00\x30\x23\x00\x00\x38\x23\x00\x00\x40\x23\x00\x00\x4b\x23\x00\x00\x52\x23\x00\x00\x5b\x23"
+            "\x00\x00\x65\x23\x00\x00\x6f\x23\x00\x00\x7a\x23\x00\x00\x84\x23\x00\x00\x8b\x23\x00\x00\x95\x23\x00\x00\x9c\x23\x00\x00\xa4\x23"
+            "\x00\x00\xac\x23\x00\x00\xb5\x23\x00\x00\xbd\x23\x00\x00\xc5\x23\x00\x00\xcb\x23\x00\x00\xd3\x23\x00\x00\xda\x23\x00\x00\xe1\x23"
+            "\x00\x00\xea\x23\x00\x00\xf4\x23\x00\x00\xfe\x23\x00\x00\x08\x24\x00\x00\x11\x24\x00\x00\x19\x24\x00\x00\x20\x24\x00\x00\x28\x24"
+            "\x00\x00\x30\x24\x00\x00\x38\x24\x00\x00\x40\x24\x00\x00\x48\x24\x00\x00\x4e\x24\x00\x00\x58\x24\x00\x00\x5f\x24\x00\x00\x67\x24"
+            "\x00\x00\x71\x24\x00\x00\x78\x24\x00\x00\x81\x24\x00\x00\x8c\x24\x00\x00\x94\x24\x00\x00\x9c\x24\x00\x00\xa6\x24\x00\x00\xae\x24"
+            "\x00\x00\xb7\x24\x00\x00\xc1\x24\x00\x00\xc9\x24\x00\x00\xd2\x24\x00\x00\xda\x24\x00\x00\xe4\x24\x00\x00\xed\x24\x00\x00\xf8\x24"
+            "\x00\x00\x05\x25\x00\x00\x0e\x25\x00\x00\x17\x25\x00\x00\x20\x25\x00\x00\x29\x25\x00\x00\x32\x25\x00\x00\x3d\x25\x00\x00\x46\x25"
+            "\x00\x00\x4e\x25\x00\x00\x56\x25\x00\x00\x5f\x25\x00\x00\x68\x25\x00\x00\x72\x25\x00\x00\x7b\x25\x00\x00\x84\x25\x00\x00\x8d\x25"
+            "\x00\x00\x97\x25\x00\x00\xa0\x25\x00\x00\xa9\x25\x00\x00\xb1\x25\x00\x00\xb8\x25\x00\x00\xc2\x25\x00\x00\xca\x25\x00\x00\xd3\x25"
+            "\x00\x00\xda\x25\x00\x00\xe3\x25\x00\x00\xed\x25\x00\x00\xf4\x25\x00\x00\xfe\x25\x00\x00\x08\x26\x00\x00\x12\x26\x00\x00\x1c\x26"
+            "\x00\x00\x29\x26\x00\x00\x32\x26\x00\x00\x39\x26\x00\x00\x40\x26\x00\x00\x4b\x26\x00\x00\x56\x26\x00\x00\x5e\x26\x00\x00\x66\x26"
+            "\x00\x00\x6d\x26\x00\x00\x76\x26\x00\x00\x7f\x26\x00\x00\x88\x26\x00\x00\x90\x26\x00\x00\x9a\x26\x00\x00\xa4\x26\x00\x00\xae\x26"
+            "\x00\x00\xb8\x26\x00\x00\xbf\x26\x00\x00\xc7\x26\x00\x00\xd0\x26\x00\x00\xd7\x26\x00\x00\xe0\x26\x00\x00\xe9\x26\x00\x00\xf3\x26"
+            "\x00\x00\xfd\x26\x00\x00\x08\x27\x00\x00\x10\x27\x00\x00\x19\x27\x00\x00\x22\x27\x00\x00\x2b\x27\x00\x00\x35\x27\x00\x00\x3d\x27"
+            "\x00\x00\x47\x27\x00\x00\x51\x27\x00\x00\x5d\x27\x00\x00\x65\x27\x00\x00\x42\x75\x6c\x62\x61\x73\x61\x75\x72\x00\x49\x76\x79\x08"
+            "\x00\x41\x56\x65\x6e\x75\x09\x00\x93\x43\x68\x61\x72\x6d\x61\x6e\x64\x65\x0b\x00\x51\x65\x6c\x65\x6f\x6e\x0b\x00\xf1\x05\x69\x7a"
+            "\x61\x72\x64\x00\x53\x71\x75\x69\x72\x74\x6c\x65\x00\x57\x61\x72\x74\x6f\x0a\x00\xf2\x34\x42\x6c\x61\x73\x74\x6f\x69\x73\x65\x00"
+            "\x43\x61\x74\x65\x72\x70\x69\x65\x00\x4d\x65\x74\x61\x70\x6f\x64\x00\x42\x75\x74\x74\x65\x72\x66\x72\x65\x65\x00\x57\x65\x65\x64"
+            "\x6c\x65\x00\x4b\x61\x6b\x75\x6e\x61\x00\x42\x65\x65\x64\x72\x69\x6c\x6c\x00\x50\x69\x64\x67\x65\x79\x07\x00\x44\x6f\x74\x74\x6f"
+            "\x0a\x00\x80\x00\x52\x61\x74\x74\x61\x74\x61\x08\x00\xf2\x00\x69\x63\x61\x74\x65\x00\x53\x70\x65\x61\x72\x6f\x77\x00\x46\x07\x00"
+            "\xf0\x08\x45\x6b\x61\x6e\x73\x00\x41\x72\x62\x6f\x6b\x00\x50\x69\x6b\x61\x63\x68\x75\x00\x52\x61\x69\x07\x00\x92\x53\x61\x6e\x64"
+            "\x73\x68\x72\x65\x77\x0a\x00\xf2\x00\x6c\x61\x73\x68\x00\x4e\x69\x64\x6f\x72\x61\x6e\xe2\x99\x80\x0b\x00\x31\x69\x6e\x61\x09\x00"
+            "\x56\x71\x75\x65\x65\x6e\x1e\x00\x14\x82\x1e\x00\x11\x6f\x09\x00\xd2\x6b\x69\x6e\x67\x00\x43\x6c\x65\x66\x61\x69\x72\x79\x09\x00"
+            "\xf1\x12\x62\x6c\x65\x00\x56\x75\x6c\x70\x69\x78\x00\x4e\x69\x6e\x65\x74\x61\x6c\x65\x73\x00\x4a\x69\x67\x67\x6c\x79\x70\x75\x66"
+            "\x66\x00\x57\x0b\x00\x10\x74\x0b\x00\x90\x5a\x75\x62\x61\x74\x00\x47\x6f\x6c\x07\x00\xf2\x0d\x4f\x64\x64\x69\x73\x68\x00\x47\x6c"
+            "\x6f\x6f\x6d\x00\x56\x69\x6c\x65\x70\x6c\x75\x6d\x65\x00\x50\x61\x72\x61\x73\x06\x00\x30\x65\x63\x74\x88\x01\x32\x6f\x6e\x61\x08"
+            "\x00\xf0\x1c\x6d\x6f\x74\x68\x00\x44\x69\x67\x6c\x65\x74\x74\x00\x44\x75\x67\x74\x72\x69\x6f\x00\x4d\x65\x6f\x77\x74\x68\x00\x50"
+            "\x65\x72\x73\x69\x61\x6e\x00\x50\x73\x79\x64\x75\x63\x6b\x65\x00\x01\x08\x00\x40\x4d\x61\x6e\x6b\x4f\x01\xf2\x13\x72\x69\x6d\x65"
+            "\x61\x70\x65\x00\x47\x72\x6f\x77\x6c\x69\x74\x68\x65\x00\x41\x72\x63\x61\x6e\x69\x6e\x65\x00\x50\x6f\x6c\x69\x77\x61\x67\x08\x00"
+            "\x42\x68\x69\x72\x6c\x0a\x00\xe0\x72\x61\x74\x68\x00\x41\x62\x72\x61\x00\x4b\x61\x64\x61\x08\x00\xf2\x00\x41\x6c\x61\x6b\x61\x7a"
+            "\x61\x6d\x00\x4d\x61\x63\x68\x6f\x70\x07\x00\x21\x6b\x65\x08\x00\xe0\x61\x6d\x70\x00\x42\x65\x6c\x6c\x73\x70\x72\x6f\x75\x74\xdd"
+            "\x01\xf4\x0c\x70\x69\x6e\x62\x65\x6c\x6c\x00\x56\x69\x63\x74\x72\x65\x65\x62\x65\x6c\x00\x54\x65\x6e\x74\x61\x63\x6f\x6f\x0a\x00"
+            "\xb0\x72\x75\x65\x6c\x00\x47\x65\x6f\x64\x75\x64\x9a\x00\x60\x61\x76\x65\x6c\x65\x72\xbb\x00\x71\x65\x6d\x00\x50\x6f\x6e\x79\xee"
+            "\x01\x30\x70\x69\x64\xb0\x01\x50\x53\x6c\x6f\x77\x70\x6e\x00\x00\x09\x00\xc0\x62\x72\x6f\x00\x4d\x61\x67\x6e\x65\x6d\x69\x74\x80"
+            "\x00\xf0\x0a\x67\x6e\x65\x74\x6f\x6e\x00\x46\x61\x72\x66\x65\x74\x63\x68\xe2\x80\x99\x64\x00\x44\x6f\x64\x75\x6f\x06\x00\x00\x26"
+            "\x01\xe0\x53\x65\x65\x6c\x00\x44\x65\x77\x67\x6f\x6e\x67\x00\x47\x0d\x01\xb1\x72\x00\x4d\x75\x6b\x00\x53\x68\x65\x6c\x6c\xdc\x02"
+            "\x50\x6c\x6f\x79\x73\x74\x7e\x00\xa1\x61\x73\x74\x6c\x79\x00\x48\x61\x75\x6e\x0f\x00\xf0\x15\x65\x6e\x67\x61\x72\x00\x4f\x6e\x69"
+            "\x78\x00\x44\x72\x6f\x77\x7a\x65\x65\x00\x48\x79\x70\x6e\x6f\x00\x4b\x72\x61\x62\x62\x79\x00\x4b\x69\x6e\x67\xb6\x00\xf3\x0b\x56"
+            "\x6f\x6c\x74\x6f\x72\x62\x00\x45\x6c\x65\x63\x74\x72\x6f\x64\x65\x00\x45\x78\x65\x67\x67\x63\x75\x74\x0a\x00\xa0\x75\x74\x6f\x72"
+            "\x00\x43\x75\x62\x6f\x6e\xb2\x00\xd0\x72\x6f\x77\x61\x6b\x00\x48\x69\x74\x6d\x6f\x6e\x6c\x54\x00\x01\x0a\x00\xf0\x04\x63\x68\x61"
+            "\x6e\x00\x4c\x69\x63\x6b\x69\x74\x75\x6e\x67\x00\x4b\x6f\x66\x66\x71\x02\x40\x57\x65\x65\x7a\x08\x00\x70\x52\x68\x79\x68\x6f\x72"
+            "\x6e\x08\x00\x12\x64\x85\x03\xb0\x6e\x73\x65\x79\x00\x54\x61\x6e\x67\x65\x6c\xa8\x01\x50\x6e\x67\x61\x73\x6b\x44\x00\xd1\x48\x6f"
+            "\x72\x73\x65\x61\x00\x53\x65\x61\x64\x72\x61\x0d\x02\x00\xd6\x02\x31\x53\x65\x61\xc1\x02\x61\x53\x74\x61\x72\x79\x75\x07\x00\x10"
+            "\x6d\x9d\x03\xf2\x05\x72\x2e\x20\x4d\x69\x6d\x65\x00\x53\x63\x79\x74\x68\x65\x72\x00\x4a\x79\x6e\x78\xc9\x00\x50\x61\x62\x75\x7a"
+            "\x7a\x61\x01\xf0\x02\x6d\x61\x72\x00\x50\x69\x6e\x73\x69\x72\x00\x54\x61\x75\x72\x6f\x73\x15\x00\xf0\x03\x69\x6b\x61\x72\x70\x00"
+            "\x47\x79\x61\x72\x61\x64\x6f\x73\x00\x4c\x61\x70\xbc\x02\x20\x44\x69\xb7\x03\xb0\x45\x65\x76\x65\x65\x00\x56\x61\x70\x6f\x72\x31"
+            "\x04\x40\x4a\x6f\x6c\x74\x08\x00\x31\x46\x6c\x61\x10\x00\xf0\x00\x50\x6f\x72\x79\x67\x6f\x6e\x00\x4f\x6d\x61\x6e\x79\x74\x65\x08"
+            "\x00\xb3\x73\x74\x61\x72\x00\x4b\x61\x62\x75\x74\x6f\x07\x00\xf0\x13\x70\x73\x00\x41\x65\x72\x6f\x64\x61\x63\x74\x79\x6c\x00\x53"
+            "\x6e\x6f\x72\x6c\x61\x78\x00\x41\x72\x74\x69\x63\x75\x6e\x6f\x00\x5a\x61\x70\x77\x00\xf0\x00\x4d\x6f\x6c\x74\x72\x65\x73\x00\x44"
+            "\x72\x61\x74\x69\x6e\x69\x08\x00\x63\x67\x6f\x6e\x61\x69\x72\x0a\x00\x01\x23\x02\x40\x65\x77\x74\x77\x2d\x03\xf0\x3b\x77\x00\x43"
+            "\x68\x69\x6b\x6f\x72\x69\x74\x61\x00\x42\x61\x79\x6c\x65\x65\x66\x00\x4d\x65\x67\x61\x6e\x69\x75\x6d\x00\x43\x79\x6e\x64\x61\x71"
+            "\x75\x69\x6c\x00\x51\x75\x69\x6c\x61\x76\x61\x00\x54\x79\x70\x68\x6c\x6f\x73\x69\x6f\x6e\x00\x54\x6f\x74\x6f\x64\x69\x6c\x65\x00"
+            "\x43\x72\x6f\x63\x6f\x6e\x61\x79\x04\xf0\x05\x72\x61\x6c\x69\x67\x61\x74\x72\x00\x53\x65\x6e\x74\x72\x65\x74\x00\x46\x75\x72\x07"
+            "\x00\xf0\x08\x48\x6f\x6f\x74\x68\x6f\x6f\x74\x00\x4e\x6f\x63\x74\x6f\x77\x6c\x00\x4c\x65\x64\x79\x62\x61\x07\x00\x00\xa5\x03\xc1"
+            "\x53\x70\x69\x6e\x61\x72\x61\x6b\x00\x41\x72\x69\x3a\x01\x30\x43\x72\x6f\x13\x04\xf1\x03\x43\x68\x69\x6e\x63\x68\x6f\x75\x00\x4c"
+            "\x61\x6e\x74\x75\x72\x6e\x00\x50\xbf\x04\x00\x67\x04\x40\x66\x61\x00\x49\x48\x04\x10\x62\x48\x04\x61\x54\x6f\x67\x65\x70\x69\x07"
+            "\x00\xa0\x74\x69\x63\x00\x4e\x61\x74\x75\x00\x58\x05\x00\x60\x4d\x61\x72\x65\x65\x70\x65\x01\xa0\x61\x66\x66\x79\x00\x41\x6d\x70"
+            "\x68\x61\xac\x01\x00\x9a\x03\x40\x6f\x73\x73\x6f\xbb\x03\x01\x66\x05\x42\x41\x7a\x75\x6d\x0a\x00\x91\x53\x75\x64\x6f\x77\x6f\x6f"
+            "\x64\x6f\xf6\x03\xf1\x01\x74\x6f\x65\x64\x00\x48\x6f\x70\x70\x69\x70\x00\x53\x6b\x69\x70\x9d\x04\x50\x4a\x75\x6d\x70\x6c\x78\x00"
+            "\xd0\x41\x69\x70\x6f\x6d\x00\x53\x75\x6e\x6b\x65\x72\x6e\x08\x00\xf0\x10\x66\x6c\x6f\x72\x61\x00\x59\x61\x6e\x6d\x61\x00\x57\x6f"
+            "\x6f\x70\x65\x72\x00\x51\x75\x61\x67\x73\x69\x72\x65\x00\x45\x73\x70\xe9\x01\x31\x55\x6d\x62\xf1\x01\x40\x4d\x75\x72\x6b\xa7\x05"
+            "\x00\xbf\x03\x01\x85\x02\xf0\x05\x4d\x69\x73\x64\x72\x65\x61\x76\x75\x73\x00\x55\x6e\x6f\x77\x6e\x00\x57\x6f\x62\xde\x00\xc0\x65"
+            "\x74\x00\x47\x69\x72\x61\x66\x61\x72\x69\x67\x73\x02\x60\x65\x63\x6f\x00\x46\x6f\x57\x01\xf0\x01\x72\x65\x73\x73\x00\x44\x75\x6e"
+            "\x73\x70\x61\x72\x63\x65\x00\x47\x7c\x01\xf0\x03\x72\x00\x53\x74\x65\x65\x6c\x69\x78\x00\x53\x6e\x75\x62\x62\x75\x6c\x6c\x49\x04"
+            "\x11\x6e\x09\x00\x50\x51\x77\x69\x6c\x66\x64\x05\xf1\x0f\x53\x63\x69\x7a\x6f\x72\x00\x53\x68\x75\x63\x6b\x6c\x65\x00\x48\x65\x72"
+            "\x61\x63\x72\x6f\x73\x73\x00\x53\x6e\x65\x61\x73\x99\x04\xd1\x64\x64\x69\x75\x72\x73\x61\x00\x55\x72\x73\x61\x72\x24\x03\x50\x6c"
+            "\x75\x67\x6d\x61\xe6\x02\xf0\x04\x63\x61\x72\x67\x6f\x00\x53\x77\x69\x6e\x75\x62\x00\x50\x69\x6c\x6f\x73\x77\x37\x05\xf0\x14\x43"
+            "\x6f\x72\x73\x6f\x6c\x61\x00\x52\x65\x6d\x6f\x72\x61\x69\x64\x00\x4f\x63\x74\x69\x6c\x6c\x65\x72\x79\x00\x44\x65\x6c\x69\x62\x69"
+            "\x72\x64\x7e\x05\x10\x74\x2c\x00\xf3\x02\x53\x6b\x61\x72\x6d\x6f\x72\x79\x00\x48\x6f\x75\x6e\x64\x6f\x75\x72\x09\x00\x21\x6f\x6d"
+            "\x40\x04\x00\xa4\x03\xb0\x50\x68\x61\x6e\x70\x79\x00\x44\x6f\x6e\x70\xc1\x03\x03\x20\x03\x10\x32\xa5\x03\x20\x6e\x74\x61\x04\xf4"
+            "\x00\x53\x6d\x65\x61\x72\x67\x6c\x65\x00\x54\x79\x72\x6f\x67\x75\x33\x04\xc0\x74\x6f\x70\x00\x53\x6d\x6f\x6f\x63\x68\x75\x6d\xb4"
+            "\x03\x20\x6b\x69\x77\x00\xf0\x01\x67\x62\x79\x00\x4d\x69\x6c\x74\x61\x6e\x6b\x00\x42\x6c\x69\x73\x27\x04\xf0\x00\x52\x61\x69\x6b"
+            "\x6f\x75\x00\x45\x6e\x74\x65\x69\x00\x53\x75\x44\x03\x70\x65\x00\x4c\x61\x72\x76\x69\x79\x03\x31\x50\x75\x70\x08\x00\x51\x54\x79"
+            "\x72\x61\x6e\x0a\x00\xf0\x0b\x4c\x75\x67\x69\x61\x00\x48\x6f\x2d\x4f\x68\x00\x43\x65\x6c\x65\x62\x69\x00\x54\x72\x65\x65\x63\x6b"
+            "\x6f\x46\x06\x30\x76\x79\x6c\x31\x04\x30\x65\x70\x74\x14\x03\xf0\x02\x54\x6f\x72\x63\x68\x69\x63\x00\x43\x6f\x6d\x62\x75\x73\x6b"
+            "\x65\x6e\x05\x08\x20\x7a\x69\x09\x00\x50\x4d\x75\x64\x6b\x69\x2d\x06\xf0\x03\x72\x73\x68\x74\x6f\x6d\x70\x00\x53\x77\x61\x6d\x70"
+            "\x65\x72\x74\x00\x50\xb6\x00\xa1\x79\x65\x6e\x61\x00\x4d\x69\x67\x68\x74\x0a\x00\x80\x5a\x69\x67\x7a\x61\x67\x6f\x6f\x07\x05\x20"
+            "\x6e\x6f\x2c\x05\x50\x57\x75\x72\x6d\x70\x6c\x00\x30\x69\x6c\x63\x18\x00\xd1\x42\x65\x61\x75\x74\x69\x66\x6c\x79\x00\x43\x61\x73"
+            "\x12\x00\xf0\x00\x44\x75\x73\x74\x6f\x78\x00\x4c\x6f\x74\x61\x64\x00\x4c\x6f\x71\x02\x81\x00\x4c\x75\x64\x69\x63\x6f\x6c\xfa\x05"
+            "\x10\x64\x89\x03\xd0\x75\x7a\x6c\x65\x61\x66\x00\x53\x68\x69\x66\x74\x72\x34\x05\x30\x69\x6c\x6c\x8f\x02\x10\x77\x1b\x03\x60\x77"
+            "\x00\x57\x69\x6e\x67\x34\x02\x50\x50\x65\x6c\x69\x70\xc8\x02\xf0\x21\x52\x61\x6c\x74\x73\x00\x4b\x69\x72\x6c\x69\x61\x00\x47\x61"
+            "\x72\x64\x65\x76\x6f\x69\x72\x00\x53\x75\x72\x73\x6b\x69\x74\x00\x4d\x61\x73\x71\x75\x65\x72\x61\x69\x6e\x00\x53\x68\x72\x6f\x6f"
+            "\x6d\x68\x02\x31\x42\x72\x65\x31\x03\x40\x53\x6c\x61\x6b\xac\x07\x50\x56\x69\x67\x6f\x72\x09\x00\x00\x11\x00\x00\x55\x02\x60\x4e"
+            "\x69\x6e\x63\x61\x64\x69\x08\x41\x6e\x6a\x61\x73\x7f\x06\x10\x64\x0b\x00\xf0\x08\x00\x57\x68\x69\x73\x6d\x75\x72\x00\x4c\x6f\x75"
+            "\x64\x72\x65\x64\x00\x45\x78\x70\x6c\x6f\x75\xca\x01\x30\x6b\x75\x68\xac\x04\x80\x48\x61\x72\x69\x79\x61\x6d\x61\xba\x03\x01\xb8"
+            "\x03\x60\x4e\x6f\x73\x65\x70\x61\xc4\x02\x41\x6b\x69\x74\x74\x74\x02\x20\x63\x61\x09\x00\x10\x53\x92\x08\x10\x79\x64\x06\x10\x77"
+            "\x9a\x01\x20\x41\x72\x4c\x01\x20\x61\x69\x07\x00\x30\x41\x67\x67\x07\x00\x52\x4d\x65\x64\x69\x74\x16\x05\x20\x64\x69\xbb\x07\x03"
+            "\xb5\x06\x11\x69\xcc\x07\x11\x6e\x0b\x00\xe0\x63\x00\x50\x6c\x75\x73\x6c\x65\x00\x4d\x69\x6e\x75\x6e\xde\x06\xa0\x62\x65\x61\x74"
+            "\x00\x49\x6c\x6c\x75\x6d\xda\x09\x41\x52\x6f\x73\x65\x1a\x01\x00\xfa\x08\x10\x6e\xd4\x01\xf0\x0b\x6c\x6f\x74\x00\x43\x61\x72\x76"
+            "\x61\x6e\x68\x61\x00\x53\x68\x61\x72\x70\x65\x64\x6f\x00\x57\x61\x69\x6c\x6d\x07\x00\x08\x00\xf0\x03\x6f\x72\x64\x00\x4e\x75\x6d"
+            "\x65\x6c\x00\x43\x61\x6d\x65\x72\x75\x70\x74\x38\x02\xf1\x04\x6b\x6f\x61\x6c\x00\x53\x70\x6f\x69\x6e\x6b\x00\x47\x72\x75\x6d\x70"
+            "\x69\x67\x21\x05\x70\x64\x61\x00\x54\x72\x61\x70\x12\x05\x50\x00\x56\x69\x62\x72\x8f\x05\x21\x46\x6c\x35\x06\x60\x43\x61\x63\x6e"
+            "\x65\x61\x07\x00\x00\x26\x05\x10\x65\x7e\x00\xf0\x0a\x62\x6c\x75\x00\x41\x6c\x74\x61\x72\x69\x61\x00\x5a\x61\x6e\x67\x6f\x6f\x73"
+            "\x65\x00\x53\x65\x76\x69\xcc\x01\x50\x4c\x75\x6e\x61\x74\x4c\x02\xf1\x01\x53\x6f\x6c\x72\x6f\x63\x6b\x00\x42\x61\x72\x62\x6f\x61"
+            "\x63\x68\x78\x01\x10\x63\x5f\x08\x50\x43\x6f\x72\x70\x68\xc4\x01\x50\x43\x72\x61\x77\x64\xfd\x07\x60\x00\x42\x61\x6c\x74\x6f\xe5"
+            "\x09\x90\x61\x79\x64\x6f\x6c\x00\x4c\x69\x6c\x5c\x05\xa0\x43\x72\x61\x64\x69\x6c\x79\x00\x41\x6e\x45\x06\xf0\x01\x68\x00\x41\x72"
+            "\x6d\x61\x6c\x64\x6f\x00\x46\x65\x65\x62\x61\x73\x75\x03\x10\x6f\x94\x05\xc1\x43\x61\x73\x74\x66\x6f\x72\x6d\x00\x4b\x65\x63\x32"
+            "\x0b\x60\x53\x68\x75\x70\x70\x65\x56\x00\x50\x6e\x65\x74\x74\x65\xb5\x02\x10\x6b\x71\x02\x50\x44\x75\x73\x63\x6c\xea\x06\x70\x54"
+            "\x72\x6f\x70\x69\x75\x73\x05\x06\xf1\x03\x6d\x65\x63\x68\x6f\x00\x41\x62\x73\x6f\x6c\x00\x57\x79\x6e\x61\x75\x74\xfd\x06\x00\x95"
+            "\x00\x50\x47\x6c\x61\x6c\x69\xfc\x0a\x20\x68\x65\x37\x01\x40\x65\x61\x6c\x65\x65\x01\x50\x6c\x72\x65\x69\x6e\xab\x00\x00\x5a\x03"
+            "\xf0\x17\x6c\x00\x48\x75\x6e\x74\x61\x69\x6c\x00\x47\x6f\x72\x65\x62\x79\x73\x73\x00\x52\x65\x6c\x69\x63\x61\x6e\x74\x68\x00\x4c"
+            "\x75\x76\x64\x69\x73\x63\x00\x42\x1b\x07\x01\x00\x09\x01\x08\x00\x80\x61\x6c\x61\x6d\x65\x6e\x63\x65\x2b\x06\x31\x64\x75\x6d\xb1"
+            "\x0b\x00\xa5\x05\x41\x65\x74\x61\x67\x2b\x05\x41\x52\x65\x67\x69\x3c\x01\x00\x09\x00\x21\x63\x65\x07\x00\x10\x73\x7b\x05\x60\x00"
+            "\x4c\x61\x74\x69\x61\xfe\x07\xa1\x74\x69\x6f\x73\x00\x4b\x79\x6f\x67\x72\x68\x0a\x10\x75\xa4\x08\xf0\x0f\x52\x61\x79\x71\x75\x61"
+            "\x7a\x61\x00\x4a\x69\x72\x61\x63\x68\x69\x00\x44\x65\x6f\x78\x79\x73\x00\x54\x75\x72\x74\x77\x69\x8c\x09\x10\x6f\x33\x0c\x81\x54"
+            "\x6f\x72\x74\x65\x72\x72\x61\xfe\x00\xf1\x00\x63\x68\x61\x72\x00\x4d\x6f\x6e\x66\x65\x72\x6e\x6f\x00\x49\x08\x00\x00\xbc\x0a\x60"
+            "\x50\x69\x70\x6c\x75\x70\xcc\x0a\x11\x6e\x09\x00\x42\x45\x6d\x70\x6f\x5c\x01\x51\x74\x61\x72\x6c\x79\x07\x00\x42\x61\x76\x69\x61"
+            "\x09\x00\x10\x70\x70\x09\xf4\x09\x42\x69\x64\x6f\x6f\x66\x00\x42\x69\x62\x61\x72\x65\x6c\x00\x4b\x72\x69\x63\x6b\x65\x74\x6f\x74"
+            "\x0a\x00\x00\x03\x05\xb0\x53\x68\x69\x6e\x78\x00\x4c\x75\x78\x69\x6f\x06\x00\x91\x72\x61\x79\x00\x42\x75\x64\x65\x77\xe4\x02\x30"
+            "\x72\x61\x64\xf2\x07\x30\x61\x6e\x69\xa8\x07\x60\x52\x61\x6d\x70\x61\x72\x0a\x00\x50\x53\x68\x69\x65\x6c\xe1\x00\x61\x42\x61\x73"
+            "\x74\x69\x6f\x0a\x00\xb0\x75\x72\x6d\x79\x00\x57\x6f\x72\x6d\x61\x64\x25\x0b\x51\x6f\x74\x68\x69\x6d\x12\x05\x00\x09\x09\xa0\x65"
+            "\x73\x70\x69\x71\x75\x65\x6e\x00\x50\x07\x01\xf0\x02\x72\x69\x73\x75\x00\x42\x75\x69\x7a\x65\x6c\x00\x46\x6c\x6f\x61\x74\x09\x00"
+            "\x71\x43\x68\x65\x72\x75\x62\x69\x08\x00\x32\x72\x69\x6d\x9d\x0a\x21\x6f\x73\x93\x0a\x11\x72\x63\x00\x31\x41\x6d\x62\x83\x07\x51"
+            "\x44\x72\x69\x66\x6c\xfb\x04\xf0\x07\x72\x69\x66\x62\x6c\x69\x6d\x00\x42\x75\x6e\x65\x61\x72\x79\x00\x4c\x6f\x70\x75\x6e\x6e\xfd"
+            "\x05\x40\x73\x6d\x61\x67\x50\x02\x10\x48\x57\x0a\x01\x7b\x07\x10\x47\xe4\x01\x80\x6f\x77\x00\x50\x75\x72\x75\x67\x40\x05\x10\x68"
+            "\xbc\x0a\x02\x11\x0a\x70\x75\x6e\x6b\x79\x00\x53\x6b\x38\x02\x00\x33\x06\x30\x72\x6f\x6e\x32\x07\x02\x08\x00\x80\x6e\x67\x00\x42"
+            "\x6f\x6e\x73\x6c\x56\x00\xd0\x6d\x65\x20\x4a\x72\x2e\x00\x48\x61\x70\x70\x69\x6e\x43\x00\x10\x61\x4e\x01\xc0\x53\x70\x69\x72\x69"
+            "\x74\x6f\x6d\x62\x00\x47\x69\x10\x0d\x30\x47\x61\x62\x60\x04\x50\x47\x61\x72\x63\x68\xf3\x05\x50\x4d\x75\x6e\x63\x68\xbc\x09\xa0"
+            "\x52\x69\x6f\x6c\x75\x00\x4c\x75\x63\x61\x96\x0b\xa2\x48\x69\x70\x70\x6f\x70\x6f\x74\x61\x73\x0b\x00\x10\x77\xe4\x00\x61\x53\x6b"
+            "\x6f\x72\x75\x70\xc7\x09\x10\x70\x78\x09\xf0\x03\x43\x72\x6f\x61\x67\x75\x6e\x6b\x00\x54\x6f\x78\x69\x63\x72\x6f\x61\x6b\x67\x04"
+            "\x30\x6e\x69\x76\x59\x07\x40\x46\x69\x6e\x6e\x02\x02\x41\x4c\x75\x6d\x69\x09\x00\x00\x72\x07\x10\x79\x26\x0c\xd0\x6e\x6f\x76\x65"
+            "\x72\x00\x41\x62\x6f\x6d\x61\x73\x6e\xe1\x05\x30\x65\x61\x76\x10\x05\x01\x2d\x0c\x10\x7a\x0d\x04\x01\x68\x0b\x50\x6c\x69\x63\x6b"
+            "\x79\x51\x0b\x50\x70\x65\x72\x69\x6f\xdd\x0a\x31\x6e\x67\x72\x52\x0d\x01\x14\x05\x20\x69\x76\xcb\x08\x00\x00\x0b\x21\x6f\x72\x1e"
+            "\x07\x71\x6f\x67\x65\x6b\x69\x73\x73\xf4\x08\x20\x65\x67\xd2\x09\x20\x61\x66\x78\x00\x42\x47\x6c\x61\x63\x08\x00\x93\x69\x73\x63"
+            "\x6f\x72\x00\x4d\x61\x6d\x28\x08\x03\xca\x07\x70\x2d\x5a\x00\x47\x61\x6c\x6c\x4f\x02\x51\x50\x72\x6f\x62\x6f\xbc\x05\x00\x05\x04"
+            "\x10\x6e\x57\x06\x30\x46\x72\x6f\x97\x0e\xa1\x73\x00\x52\x6f\x74\x6f\x6d\x00\x55\x78\x34\x0f\xf0\x08\x73\x70\x72\x69\x74\x00\x41"
+            "\x7a\x65\x6c\x66\x00\x44\x69\x61\x6c\x67\x61\x00\x50\x61\x6c\x6b\x96\x07\x61\x65\x61\x74\x72\x61\x6e\x86\x03\x51\x67\x69\x67\x61"
+            "\x73\x34\x09\x10\x74\xc5\x0e\x10\x43\x27\x09\x01\x9c\x05\x32\x50\x68\x69\x6d\x0c\xd0\x6e\x61\x70\x68\x79\x00\x44\x61\x72\x6b\x72"
+            "\x61\x69\x9c\x05\x40\x79\x6d\x69\x6e\x01\x0e\x31\x65\x75\x73\xa0\x0d\x00\x37\x0b\x91\x53\x6e\x69\x76\x79\x00\x53\x65\x72\x59\x01"
+            "\x34\x53\x65\x72\x12\x01\x10\x65\x92\x05\x31\x50\x69\x67\x49\x0b\x40\x45\x6d\x62\x6f\x10\x0d\x50\x73\x68\x61\x77\x6f\x87\x0e\x11"
+            "\x65\x07\x00\x50\x53\x61\x6d\x75\x72\x09\x00\x10\x50\x98\x00\x90\x74\x00\x57\x61\x74\x63\x68\x6f\x67\x35\x05\x50\x6c\x69\x70\x75"
+            "\x70\x74\x09\x20\x64\x69\xc6\x08\x80\x74\x6f\x75\x74\x6c\x61\x6e\x64\x86\x02\x40\x72\x6c\x6f\x69\xe9\x07\x10\x65\x55\x03\x70\x00"
+            "\x50\x61\x6e\x73\x61\x67\xe9\x07\x21\x6d\x69\x09\x00\x00\x11\x00\x10\x65\xe2\x09\x00\x11\x00\x00\x09\x00\x40\x50\x61\x6e\x70\x3d"
+            "\x09\x00\x11\x00\x01\x09\x00\x30\x4d\x75\x6e\x3e\x08\x70\x75\x73\x68\x61\x72\x6e\x61\x2b\x10\x30\x6f\x76\x65\x37\x06\x10\x6e\xc6"
+            "\x0b\x80\x6c\x00\x55\x6e\x66\x65\x7a\x61\xcc\x05\xb0\x6c\x69\x74\x7a\x6c\x65\x00\x5a\x65\x62\x73\xe9\x06\x90\x61\x00\x52\x6f\x67"
+            "\x67\x65\x6e\x72\xc2\x09\x50\x42\x6f\x6c\x64\x6f\xb4\x04\x30\x69\x67\x61\x1c\x0f\x00\xcb\x0a\x00\x8f\x0b\x22\x53\x77\x08\x00\xc2"
+            "\x44\x72\x69\x6c\x62\x75\x72\x00\x45\x78\x63\x61\xa5\x10\x30\x41\x75\x64\x12\x10\xc0\x54\x69\x6d\x62\x75\x72\x72\x00\x47\x75\x72"
+            "\x64\x08\x00\x40\x43\x6f\x6e\x6b\x3f\x05\x10\x72\x47\x09\x01\x9d\x04\x00\xb0\x01\xc2\x70\x69\x74\x6f\x61\x64\x00\x53\x65\x69\x73"
+            "\x6d\x0b\x00\xf0\x01\x54\x68\x72\x6f\x68\x00\x53\x61\x77\x6b\x00\x53\x65\x77\x61\x64\x08\x11\x41\x53\x77\x61\x64\xd3\x03\x50\x4c"
+            "\x65\x61\x76\x61\xc3\x03\x80\x56\x65\x6e\x69\x70\x65\x64\x65\xa5\x06\x22\x72\x6c\x0b\x00\x33\x53\x63\x6f\x0a\x00\x10\x43\x1d\x11"
+            "\x10\x6e\x48\x11\x61\x68\x69\x6d\x73\x69\x63\x7d\x01\x51\x65\x74\x69\x6c\x69\xab\x06\x00\x1c\x0b\x01\xc4\x06\x40\x73\x63\x75\x6c"
+            "\xa1\x07\x21\x61\x6e\xbd\x0c\x80\x4b\x72\x6f\x6b\x6f\x72\x6f\x6b\x09\x00\x22\x6f\x6b\xd1\x0c\x80\x44\x61\x72\x75\x6d\x61\x6b\x61"
+            "\x09\x00\x11\x6d\xfd\x09\x00\x48\x03\x10\x72\x5e\x07\x60\x73\x00\x44\x77\x65\x62\xd3\x03\x40\x43\x72\x75\x73\xaa\x05\x71\x53\x63"
+            "\x72\x61\x67\x67\x79\x08\x00\x10\x66\x6f\x08\xb0\x69\x67\x69\x6c\x79\x70\x68\x00\x59\x61\x6d\xd3\x08\xf0\x03\x43\x6f\x66\x61\x67"
+            "\x72\x69\x67\x75\x73\x00\x54\x69\x72\x74\x6f\x75\x67\xa9\x07\x80\x72\x72\x61\x63\x6f\x73\x74\x61\x75\x02\x21\x68\x65\x7c\x02\x22"
+            "\x68\x65\xf6\x06\x31\x75\x62\x62\x08\x11\x00\x93\x07\x90\x64\x6f\x72\x00\x5a\x6f\x72\x75\x61\x06\x00\x40\x6f\x61\x72\x6b\x7f\x08"
+            "\x20\x63\x63\x6c\x01\x14\x43\x09\x00\x10\x47\x58\x05\x10\x74\xd5\x0e\x22\x74\x68\xc8\x0d\x02\x12\x00\x20\x65\x6c\x9e\x00\x10\x6f"
+            "\xae\x0d\x00\x59\x03\x02\xb5\x0d\x70\x52\x65\x75\x6e\x69\x63\x6c\xc8\x00\x01\xfc\x0b\x00\xab\x02\x20\x77\x61\x35\x02\x30\x56\x61"
+            "\x6e\x26\x01\x10\x74\xa4\x0e\x01\x0a\x00\x23\x73\x68\x0a\x00\x82\x75\x78\x65\x00\x44\x65\x65\x72\x1a\x05\x40\x61\x77\x73\x62\x49"
+            "\x11\x30\x45\x6d\x6f\x80\x03\x10\x4b\xcb\x00\x10\x62\xe1\x12\x60\x00\x45\x73\x63\x61\x76\x8e\x07\x60\x72\x00\x46\x6f\x6f\x6e\xf2"
+            "\x00\x22\x41\x6d\x09\x00\x30\x73\x00\x46\x28\x02\x00\x54\x00\xf0\x01\x4a\x65\x6c\x6c\x69\x63\x65\x6e\x74\x00\x41\x6c\x6f\x6d\x6f"
+            "\x6d\x71\x02\x00\x0d\x0f\x20\x69\x6b\x10\x04\x10\x76\xe9\x0d\x20\x6c\x61\x4b\x0e\x62\x72\x6f\x73\x65\x65\x64\x0a\x00\x00\xda\x00"
+            "\x40\x6e\x00\x4b\x6c\x14\x09\x20\x4b\x6c\x89\x07\x01\x0c\x00\x01\x0a\x00\x50\x54\x79\x6e\x61\x6d\x60\x0f\x30\x6c\x65\x6b\xcb\x02"
+            "\x04\x0a\x00\x00\xa5\x07\xc0\x45\x6c\x67\x79\x65\x6d\x00\x42\x65\x68\x65\x65\x09\x00\x90\x4c\x69\x74\x77\x69\x63\x6b\x00\x4c\x18"
+            "\x08\x10\x6e\x61\x0e\x00\xca\x13\xe0\x6c\x75\x72\x65\x00\x41\x78\x65\x77\x00\x46\x72\x61\x78\x0d\x00\x50\x48\x61\x78\x6f\x72\x7c"
+            "\x08\x60\x75\x62\x63\x68\x6f\x6f\x64\x0b\x00\x65\x0f\x50\x00\x43\x72\x79\x6f\x4c\x0f\x11\x6c\x8c\x06\x70\x6d\x65\x74\x00\x41\x63"
+            "\x63\x32\x08\x00\xc9\x03\x50\x75\x6e\x66\x69\x73\xa2\x01\x51\x65\x6e\x66\x6f\x6f\x08\x00\xb0\x73\x68\x61\x6f\x00\x44\x72\x75\x64"
+            "\x64\x69\x56\x08\x00\xca\x11\x11\x74\xf1\x12\x90\x75\x72\x6b\x00\x50\x61\x77\x6e\x69\xe9\x03\x20\x42\x69\xb0\x03\x90\x70\x00\x42"
+            "\x6f\x75\x66\x66\x61\x6c\xa8\x02\x50\x52\x75\x66\x66\x6c\x1e\x09\x01\xc1\x07\x20\x72\x79\x52\x13\x20\x6c\x61\xc5\x0c\x00\xb8\x02"
+            "\x01\x85\x10\x00\xf3\x04\x70\x6d\x6f\x72\x00\x44\x75\x72\x32\x00\x20\x44\x65\x0d\x02\x60\x5a\x77\x65\x69\x6c\x6f\xe6\x06\x41\x79"
+            "\x64\x72\x65\x75\x00\x00\xd2\x0c\x10\x65\x6b\x02\x70\x56\x6f\x6c\x63\x61\x72\x6f\x13\x05\x41\x6f\x62\x61\x6c\xc4\x0f\x00\x64\x08"
+            "\x10\x6b\x0a\x00\x52\x56\x69\x72\x69\x7a\xd7\x0f\x40\x72\x6e\x61\x64\xae\x02\x50\x68\x75\x6e\x64\x75\x06\x01\xf0\x00\x52\x65\x73"
+            "\x68\x69\x72\x61\x6d\x00\x5a\x65\x6b\x72\x6f\x6d\x8e\x0f\x11\x64\x1f\x01\x50\x4b\x79\x75\x72\x65\xd3\x09\x30\x6c\x64\x65\x4d\x10"
+            "\x40\x6c\x6f\x65\x74\x80\x02\x31\x65\x6e\x65\xad\x13\x20\x43\x68\xe6\x07\x11\x6e\x3e\x10\x30\x6c\x61\x64\x92\x09\xf0\x03\x68\x65"
+            "\x73\x6e\x61\x75\x67\x68\x74\x00\x46\x65\x6e\x6e\x65\x6b\x69\x6e\xe4\x00\x40\x69\x78\x65\x6e\xb2\x0b\x40\x70\x68\x6f\x78\xfc\x05"
+            "\x40\x61\x6b\x69\x65\x08\x00\x21\x67\x61\x25\x05\x41\x47\x72\x65\x6e\x17\x0c\x80\x42\x75\x6e\x6e\x65\x6c\x62\x79\xf6\x13\x90\x67"
+            "\x65\x72\x73\x62\x79\x00\x46\x6c\xe2\x12\x01\x9c\x02\x02\x0b\x00\x11\x69\x9c\x15\x60\x54\x61\x6c\x6f\x6e\x66\xe1\x07\x20\x00\x53"
+            "\x08\x0c\x40\x65\x72\x62\x75\x48\x0b\x80\x65\x77\x70\x61\x00\x56\x69\x76\xee\x0c\x00\x6b\x05\x10\x74\x30\x0a\x20\x50\x79\x5d\x03"
+            "\x00\x27\x10\x60\x62\xc3\xa9\x62\xc3\xa9\x83\x08\x01\x95\x0a\x61\x46\x6c\x6f\x72\x67\x65\x54\x0c\x20\x64\x64\x6b\x03\x30\x67\x6f"
+            "\x61\xd4\x05\x00\x99\x12\x10\x6d\x08\x00\x00\xd0\x0c\x00\xe5\x10\x20\x66\x72\x4a\x0e\x20\x73\x70\xeb\x04\x00\x82\x14\x10\x73\x2e"
+            "\x02\xc1\x48\x6f\x6e\x65\x64\x67\x65\x00\x44\x6f\x75\x62\xe9\x06\x10\x41\x24\x0a\x01\x6e\x15\x10\x53\xca\x06\x00\x3c\x13\x60\x41"
+            "\x72\x6f\x6d\x61\x74\x91\x0e\x00\x52\x0f\x11\x72\xb9\x0f\x31\x6c\x75\x72\x2a\x15\x40\x49\x6e\x6b\x61\xf2\x01\x20\x6c\x61\x6e\x12"
+            "\x50\x42\x69\x6e\x61\x63\x4e\x16\x30\x61\x72\x62\x8d\x04\x00\xde\x03\x51\x6b\x72\x65\x6c\x70\xd7\x11\x40\x61\x6c\x67\x65\xf0\x0a"
+            "\x00\x59\x08\x01\xbf\x13\x20\x61\x77\x61\x00\x72\x72\x00\x48\x65\x6c\x69\x6f\x95\x0e\x01\x0b\x00\x10\x6c\xa4\x02\x21\x54\x79\x3d"
+            "\x0b\x01\xdc\x0e\x90\x74\x72\x75\x6d\x00\x41\x6d\x61\x75\xd2\x14\x21\x75\x72\xd9\x01\x40\x53\x79\x6c\x76\xbe\x07\xc0\x48\x61\x77"
+            "\x6c\x75\x63\x68\x61\x00\x44\x65\x64\xaf\x01\x00\xba\x04\x11\x62\x99\x0c\xb0\x6f\x6f\x6d\x79\x00\x53\x6c\x69\x67\x67\x6f\x18\x01"
+            "\x10\x6f\xb3\x0f\x61\x4b\x6c\x65\x66\x6b\x69\xba\x0f\x40\x74\x75\x6d\x70\x1e\x0f\x30\x76\x65\x6e\x9d\x02\x71\x50\x75\x6d\x70\x6b"
+            "\x61\x62\x2b\x00\xc1\x75\x72\x67\x65\x69\x73\x74\x00\x42\x65\x72\x67\xaf\x14\xb0\x41\x76\x61\x6c\x75\x67\x67\x00\x4e\x6f\x69\x5e"
+            "\x06\x40\x4e\x6f\x69\x76\x4f\x11\x30\x58\x65\x72\x8e\x10\xc0\x00\x59\x76\x65\x6c\x74\x61\x6c\x00\x5a\x79\x67\x76\x0e\x00\xf9\x07"
+            "\x40\x6e\x63\x69\x65\x54\x12\x00\xcb\x01\x00\xd5\x02\x11\x6e\xdb\x04\x20\x6f\x77\x32\x03\x50\x44\x61\x72\x74\x72\x9d\x14\x50\x65"
+            "\x63\x69\x64\x75\xf9\x0d\x51\x4c\x69\x74\x74\x65\xd9\x02\x30\x72\x61\x63\xb4\x0d\x51\x6e\x63\x69\x6e\x65\xf2\x01\xc0\x50\x6f\x70"
+            "\x70\x6c\x69\x6f\x00\x42\x72\x69\x6f\xdf\x00\x00\x17\x16\x00\xef\x10\x00\x3b\x07\x50\x6b\x69\x70\x65\x6b\x90\x05\x40\x6d\x62\x65"
+            "\x61\x6e\x09\xa1\x75\x63\x61\x6e\x6e\x6f\x6e\x00\x59\x75\x4f\x0d\x61\x00\x47\x75\x6d\x73\x68\x09\x00\x01\xb4\x05\x02\x05\x18\x20"
+            "\x6a\x61\x68\x02\x80\x56\x69\x6b\x61\x76\x6f\x6c\x74\x2a\x0b\x40\x62\x72\x61\x77\xb0\x10\x00\x0b\x00\x41\x6f\x6d\x69\x6e\x21\x17"
+            "\x50\x4f\x72\x69\x63\x6f\xf3\x09\x50\x43\x75\x74\x69\x65\xbd\x0f\x32\x52\x69\x62\x1a\x0b\x50\x52\x6f\x63\x6b\x72\xff\x01\xf1\x04"
+            "\x4c\x79\x63\x61\x6e\x72\x6f\x63\x00\x57\x69\x73\x68\x69\x77\x61\x73\x68\x69\xd1\x12\x30\x61\x6e\x69\x21\x0c\x50\x78\x61\x70\x65"
+            "\x78\x4e\x10\x10\x62\xa2\x0b\x60\x4d\x75\x64\x73\x64\x61\xbd\x06\x40\x65\x77\x70\x69\x02\x03\x50\x41\x72\x61\x71\x75\xa8\x0b\x40"
+            "\x00\x46\x6f\x6d\x78\x11\x31\x73\x00\x4c\x2b\x04\x10\x69\x23\x14\x30\x72\x65\x6c\x6e\x0d\x51\x53\x68\x69\x69\x6e\xa1\x0d\x00\xf2"
+            "\x0c\x30\x6e\x64\x69\xbb\x08\x30\x6c\x61\x7a\x1c\x08\x10\x53\xa4\x17\x60\x75\x6c\x00\x42\x65\x77\x6d\x08\x91\x42\x6f\x75\x6e\x73"
+            "\x77\x65\x65\x74\x62\x12\x00\x6a\x07\x20\x54\x73\x5f\x13\x01\x50\x04\xf0\x05\x6d\x66\x65\x79\x00\x4f\x72\x61\x6e\x67\x75\x72\x75"
+            "\x00\x50\x61\x73\x73\x69\x6d\xda\x13\x30\x57\x69\x6d\xe7\x18\x10\x47\x77\x02\x10\x6f\x0a\x00\x00\x78\x07\x20\x79\x67\x2f\x06\x20"
+            "\x50\x61\x83\x13\x01\xfa\x08\xc0\x79\x75\x6b\x75\x6d\x75\x6b\x75\x00\x43\xc3\xb3\x2a\x05\x50\x20\x43\x65\x72\x6f\xe1\x10\x31\x76"
+            "\x61\x6c\x66\x0b\x10\x6e\x79\x09\x61\x4b\x6f\x6d\x61\x6c\x61\x2a\x0d\x00\x03\x18\x00\x8b\x09\x90\x6f\x67\x65\x64\x65\x6d\x61\x72"
+            "\x75\x8a\x0b\x90\x69\x6b\x79\x75\x00\x42\x72\x75\x78\x67\x06\x20\x44\x72\x9b\x0c\x20\x00\x44\xa7\x05\x00\xa0\x0f\xd1\x4a\x61\x6e"
+            "\x67\x6d\x6f\x2d\x6f\x00\x48\x61\x6b\x61\x09\x00\x31\x4b\x6f\x6d\x08\x00\x83\x54\x61\x70\x75\x20\x4b\x6f\x6b\x0a\x00\x20\x4c\x65"
+            "\x7f\x0d\x00\x0a\x00\x42\x42\x75\x6c\x75\x0a\x00\x10\x46\x10\x0a\x62\x43\x6f\x73\x6d\x6f\x67\x07\x00\x20\x65\x6d\x5a\x07\x11\x67"
+            "\x6d\x0e\x00\x4d\x0f\x10\x6c\xc3\x10\xc1\x68\x69\x6c\x65\x67\x6f\x00\x42\x75\x7a\x7a\x77\xeb\x08\xe0\x68\x65\x72\x6f\x6d\x6f\x73"
+            "\x61\x00\x58\x75\x72\x6b\x69\xf5\x17\x01\x38\x12\x01\x26\x0e\x01\x3a\x07\x30\x74\x61\x6e\x32\x10\x22\x7a\x7a\x0b\x10\x52\x65\x63"
+            "\x72\x6f\x7a\x64\x13\x11\x65\xc0\x09\x01\x24\x12\x20\x61\x64\xa3\x0c\x21\x6f\x69\x3f\x09\x90\x4e\x61\x67\x61\x6e\x61\x64\x65\x6c"
+            "\xd4\x0d\x20\x6b\x61\x04\x00\x00\x5a\x12\x40\x63\x65\x70\x68\xf1\x04\x50\x00\x5a\x65\x72\x61\x83\x14\x00",
+            9178, 10085
+        },
+    },
+    // French
+    {
+        // characteristic_fr
+        {
+            "\xf8\xe6\x1f\x00\x00\x00\x84\x00\x00\x00\x89\x00\x00\x00\x96\x00\x00\x00\xa9\x00\x00\x00\xb7\x00\x00\x00\xcd\x00\x00\x00\xdf\x00"
+            "\x00\x00\xf6\x00\x00\x00\x07\x01\x00\x00\x18\x01\x00\x00\x27\x01\x00\x00\x3c\x01\x00\x00\x4a\x01\x00\x00\x63\x01\x00\x00\x73\x01"
+            "\x00\x00\x83\x01\x00\x00\x91\x01\x00\x00\x9d\x01\x00\x00\xaf\x01\x00\x00\xc1\x01\x00\x00\xd5\x01\x00\x00\xe5\x01\x00\x00\xfa\x01"
+            "\x00\x00\x01\x02\x00\x00\x10\x02\x00\x00\x25\x02\x00\x00\x37\x02\x00\x00\x48\x02\x00\x00\x58\x02\x00\x00\x67\x02\x00\x00\x7b\x02"
+            "\x00\x00\x8a\x02\x00\x00\x4e\x6f\x6e\x65\x00\x41\x64\x6f\x72\x65\x20\x6d\x61\x6e\x67\x65\x72\x00\x53\x27\x61\x73\x73\x6f\x75\x70"
+            "\x69\x74\x20\x73\x6f\x75\x76\x65\x6e\x74\x00\x44\x6f\x72\x74\x20\x62\x65\x61\x75\x63\x6f\x75\x70\x00\xc3\x89\x70\x61\x72\x70\x69"
+            "\x6c\x6c\x65\x20\x6c\x65\x73\x20\x63\x68\x6f\x73\x65\x73\x00\x41\x69\x6d\x65\x20\x73\x65\x20\x64\xc3\xa9\x74\x65\x6e\x64\x72\x65"
+            "\x00\x46\x69\xc3\xa8\x72\x65\x20\x64\x65\x20\x73\x61\x20\x70\x75\x69\x73\x73\x61\x6e\x63\x65\x29\x00\xf2\x07\x6d\x65\x6e\x65\x72"
+            "\x00\x55\x6e\x20\x70\x65\x75\x20\x63\x6f\x6c\xc3\xa9\x72\x65\x75\x78\x22\x00\xf0\x0c\x63\x6f\x6d\x62\x61\x74\x74\x72\x65\x00\x53"
+            "\x27\x65\x6d\x70\x6f\x72\x74\x65\x20\x66\x61\x63\x69\x6c\x65\x6d\x93\x00\xf2\x0d\x43\x6f\x72\x70\x73\x20\x72\x6f\x62\x75\x73\x74"
+            "\x65\x00\x53\x61\x69\x74\x20\x65\x6e\x63\x61\x69\x73\x73\x65\x72\x97\x00\xf0\x02\x6f\x75\x70\x73\x00\x54\x72\xc3\xa8\x73\x20\x61"
+            "\x73\x74\x75\x63\x69\x5b\x00\xb1\x42\x6f\x6e\x6e\x65\x20\x65\x6e\x64\x75\x72\x8d\x00\xd4\x50\x65\x72\x73\xc3\xa9\x76\xc3\xa9\x72"
+            "\x61\x6e\x74\x79\x00\xf2\x19\x75\x72\x69\x72\x00\x41\x74\x74\x65\x6e\x74\x69\x66\x20\x61\x75\x78\x20\x73\x6f\x6e\x73\x00\x42\xc3"
+            "\xaa\x74\x65\x20\x65\x74\x20\x69\x6d\x70\x75\x6c\x73\x69\x66\x30\x00\x40\x66\x61\x69\x72\x0a\x01\x30\x20\x70\x69\xae\x00\xa2\x46"
+            "\x75\x69\x74\x20\x72\x61\x70\x69\x64\xa9\x00\x71\x45\x78\x74\x72\xc3\xaa\x6d\x0d\x00\x41\x20\x63\x75\x72\x87\x00\x63\x43\x6f\x71"
+            "\x75\x69\x6e\x9e\x00\xa2\x6f\x62\x73\x74\x69\x6e\xc3\xa9\x00\x53\x6f\x01\xd3\x20\x64\x61\x6e\x73\x20\x6c\x61\x20\x6c\x75\x6e\x65"
+            "\x24\x00\xb3\x70\x61\x72\x74\x69\x63\x75\x6c\x69\x65\x72\x12\x00\x60\x76\x6f\x6c\x6f\x6e\x74\x7c\x00\x04\x41\x01\x50\x76\x61\x6e"
+            "\x69\x74\x5e\x00\x40\x45\x73\x70\x72\x85\x00\xf0\x01\x65\x62\x65\x6c\x6c\x65\x00\x41\x20\x68\x6f\x72\x72\x65\x75\x72\x8b\x01\x30"
+            "\x70\x65\x72\x9c\x01\xf0\x00\x41\x73\x73\x65\x7a\x20\x65\x6e\x74\xc3\xaa\x74\xc3\xa9\x00",
+            598, 650
+        },
+        // dppt_fr
+        {
+            "\xf2\xff\xd2\x71\x00\x00\x00\xcc\x01\x00\x00\xda\x01\x00\x00\xe6\x01\x00\x00\xf4\x01\x00\x00\x03\x02\x00\x00\x13\x02\x00\x00\x24"
+            "\x02\x00\x00\x36\x02\x00\x00\x47\x02\x00\x00\x55\x02\x00\x00\x65\x02\x00\x00\x8a\x02\x00\x00\x99\x02\x00\x00\xa8\x02\x00\x00\xb9"
+            "\x02\x00\x00\xc8\x02\x00\x00\xd7\x02\x00\x00\xe6\x02\x00\x00\xf5\x02\x00\x00\x0a\x03\x00\x00\x2b\x03\x00\x00\x4c\x03\x00\x00\x5c"
+            "\x03\x00\x00\x6f\x03\x00\x00\x82\x03\x00\x00\x95\x03\x00\x00\xa8\x03\x00\x00\xbb\x03\x00\x00\xce\x03\x00\x00\xdd\x03\x00\x00\xed"
+            "\x03\x00\x00\xfd\x03\x00\x00\x0e\x04\x00\x00\x27\x04\x00\x00\x40\x04\x00\x00\x59\x04\x00\x00\x66\x04\x00\x00\x77\x04\x00\x00\x89"
+            "\x04\x00\x00\x98\x04\x00\x00\xb0\x04\x00\x00\xc8\x04\x00\x00\xd7\x04\x00\x00\xee\x04\x00\x00\x07\x05\x00\x00\x20\x05\x00\x00\x34"
+            "\x05\x00\x00\x49\x05\x00\x00\x5e\x05\x00\x00\x73\x05\x00\x00\x88\x05\x00\x00\x9d\x05\x00\x00\xaa\x05\x00\x00\xc0\x05\x00\x00\xde"
+            "\x05\x00\x00\xfc\x05\x00\x00\x0a\x06\x00\x00\x18\x06\x00\x00\x24\x06\x00\x00\x33\x06\x00\x00\x43\x06\x00\x00\x5a\x06\x00\x00\x72"
+            "\x06\x00\x00\x82\x06\x00\x00\x8e\x06\x00\x00\xa1\x06\x00\x00\xad\x06\x00\x00\xb8\x06\x00\x00\xc4\x06\x00\x00\xd4\x06\x00\x00\xe5"
+            "\x06\x00\x00\xef\x06\x00\x00\xf9\x06\x00\x00\x03\x07\x00\x00\x15\x07\x00\x00\x27\x07\x00\x00\x39\x07\x00\x00\x4b\x07\x00\x00\x55"
+            "\x07\x00\x00\x5f\x07\x00\x00\x69\x07\x00\x00\x73\x07\x00\x00\x81\x07\x00\x00\x8f\x07\x00\x00\x9d\x07\x00\x00\xab\x07\x00\x00\xb9"
+            "\x07\x00\x00\xcb\x07\x00\x00\xdd\x07\x00\x00\xee\x07\x00\x00\xff\x07\x00\x00\x11\x08\x00\x00\x23\x08\x00\x00\x2d\x08\x00\x00\x37"
+            "\x08\x00\x00\x41\x08\x00\x00\x4b\x08\x00\x00\x55\x08\x00\x00\x5f\x08\x00\x00\x69\x08\x00\x00\x73\x08\x00\x00\x7d\x08\x00\x00\x87"
+            "\x08\x00\x00\x91\x08\x00\x00\x9b\x08\x00\x00\xa5\x08\x00\x00\xaf\x08\x00\x00\xbd\x08\x00\x00\xcb\x08\x00\x00\xd7\x08\x00\x00\xe1"
+            "\x08\x00\x00\xeb\x08\x00\x00\xf5\x08\x00\x00\xff\x08\x00\x00\x43\x61\x6e\x61\x6c\x61\x76\x65\x20\x43\x69\x74\x79\x00\x45\x74\x65"
+            "\x72\x6e\x61\x0c\x00\x73\x50\x61\x73\x74\x6f\x72\x69\x0e\x00\x83\x53\x75\x6e\x79\x73\x68\x6f\x72\x29\x00\xfb\x11\x50\x6f\x6b\xc3"
+            "\xa9\x6d\x6f\x6e\x20\x4c\x65\x61\x67\x75\x65\x00\x4f\x72\x65\x62\x75\x72\x67\x68\x20\x4d\x69\x6e\x65\x20\x31\x46\x11\x00\xf4\x05"
+            "\x42\x31\x46\x00\x56\x61\x6c\x6c\x65\x79\x20\x57\x69\x6e\x64\x77\x6f\x72\x6b\x73\x6d\x00\xf2\x02\x46\x6f\x72\x65\x73\x74\x00\x46"
+            "\x75\x65\x67\x6f\x20\x49\x72\x6f\x6e\x1e\x00\xf9\x15\x4d\x74\x2e\x20\x43\x6f\x72\x6f\x6e\x65\x74\x20\x28\x52\x6f\x75\x74\x65\x20"
+            "\x32\x30\x37\x2f\x32\x30\x38\x20\x45\x6e\x74\x72\x61\x6e\x63\x65\x29\x25\x00\x29\x32\x46\x0f\x00\x1a\x33\x0f\x00\x49\x53\x6e\x6f"
+            "\x77\x11\x00\x1a\x34\x20\x00\x1a\x35\x0f\x00\x1a\x36\x0f\x00\x1a\x37\x0f\x00\x8f\x54\x6f\x70\x20\x43\x61\x76\x65\xa5\x00\x02\x2f"
+            "\x31\x36\xa1\x00\x04\x05\x21\x00\x1f\x31\x21\x00\x04\x00\x26\x01\xfe\x03\x47\x72\x65\x61\x74\x20\x4d\x61\x72\x73\x68\x20\x41\x72"
+            "\x65\x61\x20\x31\x13\x00\x1e\x32\x13\x00\x1e\x33\x13\x00\x1e\x34\x13\x00\x1e\x35\x13\x00\xf0\x0e\x36\x00\x53\x6f\x6c\x61\x63\x65"
+            "\x6f\x6e\x20\x52\x75\x69\x6e\x73\x00\x56\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\xc9\x01\x09\x10\x00\x1b\x32\x10\x00\x01\xd8"
+            "\x01\x09\x11\x00\xaf\x61\x63\x6b\x20\x52\x6f\x6f\x6d\x20\x31\x19\x00\x05\x1f\x32\x19\x00\x05\xe6\x33\x00\x52\x61\x76\x61\x67\x65"
+            "\x64\x20\x50\x61\x74\x68\x42\x02\x3a\x47\x61\x74\x53\x02\x01\x11\x00\x00\x7b\x00\xeb\x53\x74\x61\x72\x6b\x20\x4d\x6f\x75\x6e\x74"
+            "\x61\x69\x6e\x0f\x00\x05\x65\x01\x0c\x18\x00\xf0\x0e\x49\x6e\x74\x65\x72\x69\x6f\x72\x00\x53\x65\x6e\x64\x6f\x66\x66\x20\x53\x70"
+            "\x72\x69\x6e\x67\x00\x54\x75\x72\x6e\x62\x8e\x00\x00\xdb\x01\x06\x3e\x00\x0a\x17\x00\xab\x31\x73\x74\x20\x50\x69\x6c\x6c\x61\x72"
+            "\x19\x00\x34\x32\x6e\x64\x19\x00\x00\x6c\x02\xb1\x70\x6f\x69\x6e\x74\x20\x54\x65\x6d\x70\x6c\xbd\x00\x0d\x14\x00\x01\xc0\x00\x0d"
+            "\x15\x00\x1f\x32\x15\x00\x01\x1f\x33\x15\x00\x01\x1f\x34\x15\x00\x01\xa2\x35\x46\x00\x57\x61\x79\x77\x61\x72\x64\xa0\x02\x08\x0d"
+            "\x00\xa0\x20\x28\x53\x65\x63\x72\x65\x74\x29\x00\xe9\x01\x73\x20\x4d\x61\x6e\x69\x61\x63\x1a\x00\xaf\x3c\x20\x31\x30\x20\x55\x6e"
+            "\x6f\x77\x6e\x1e\x00\x01\x17\x3e\x1e\x00\x03\x19\x00\xf0\x06\x54\x75\x6e\x6e\x65\x6c\x00\x54\x72\x6f\x70\x68\x79\x20\x47\x61\x72"
+            "\x64\x65\x6e\x00\xbd\x03\x78\x20\x49\x73\x6c\x61\x6e\x64\x0c\x00\x00\xff\x00\x08\x0f\x00\x00\xfa\x00\x09\x10\x00\x9e\x32\x46\x20"
+            "\x28\x4c\x65\x66\x74\x29\x17\x00\x4c\x52\x69\x67\x68\x18\x00\xe8\x33\x46\x00\x4f\x6c\x64\x20\x43\x68\x61\x74\x65\x61\x75\x0c\x00"
+            "\x02\x48\x02\xa0\x35\x00\x4c\x61\x6b\x65\x20\x56\x65\x72\xaa\x04\x02\x0c\x00\x42\x61\x6c\x6f\x72\x0b\x00\x30\x41\x63\x75\x17\x00"
+            "\x01\x12\x00\x10\x20\x12\x00\x62\x66\x72\x6f\x6e\x74\x00\x17\x00\x07\x11\x00\x04\x73\x04\x15\x31\x0a\x00\x15\x32\x0a\x00\x15\x33"
+            "\x0a\x00\x98\x34\x20\x28\x53\x6f\x75\x74\x68\x29\x12\x00\x38\x4e\x6f\x72\x12\x00\x1d\x35\x24\x00\x1d\x35\x24\x00\x15\x36\x0a\x00"
+            "\x15\x37\x0a\x00\x15\x38\x0a\x00\x50\x39\x00\x4c\x6f\x73\x77\x04\x30\x77\x65\x72\x4e\x01\x07\x0e\x00\x19\x32\x0e\x00\x19\x33\x0e"
+            "\x00\x19\x34\x0e\x00\x24\x35\x46\x50\x00\x2c\x31\x30\x92\x00\x00\x12\x00\x0a\x92\x00\x70\x31\x31\x20\x28\x57\x65\x73\x2e\x02\x06"
+            "\x11\x00\x28\x45\x61\x11\x00\x1d\x32\x34\x00\x1d\x32\x58\x00\x05\x2a\x01\x25\x31\x34\x0a\x00\x15\x35\x0a\x00\x05\xf6\x00\x15\x31"
+            "\xf6\x00\x15\x31\xf6\x00\x24\x31\x39\x0a\x00\x15\x32\x84\x01\x15\x32\x84\x01\x15\x32\x50\x00\x15\x32\x50\x00\x15\x32\x46\x00\x15"
+            "\x32\x46\x00\xb0\x32\x39\x00\x54\x77\x69\x6e\x6c\x65\x61\x66\x08\x01\xa2\x6e\x00\x43\x65\x6c\x65\x73\x74\x69\x63\x0e\x00\x61\x52"
+            "\x65\x73\x6f\x72\x74\x0b\x05\x05\x32\x00\x15\x30\x0a\x00\x05\xbe\x00\x15\x32\xaa\x00\x30\x33\x30\x00",
+            1369, 2303
+        },
+        // frlg_fr
+        {
+            "\xf4\xff\xc6\x6b\x00\x00\x00\xb4\x01\x00\x00\xc0\x01\x00\x00\xce\x01\x00\x00\xdc\x01\x00\x00\xeb\x01\x00\x00\xf8\x01\x00\x00\x05"
+            "\x02\x00\x00\x15\x02\x00\x00\x1d\x02\x00\x00\x25\x02\x00\x00\x2d\x02\x00\x00\x35\x02\x00\x00\x3d\x02\x00\x00\x45\x02\x00\x00\x4d"
+            "\x02\x00\x00\x55\x02\x00\x00\x5d\x02\x00\x00\x66\x02\x00\x00\x6f\x02\x00\x00\x78\x02\x00\x00\x81\x02\x00\x00\x8a\x02\x00\x00\x93"
+            "\x02\x00\x00\x9c\x02\x00\x00\xa5\x02\x00\x00\xae\x02\x00\x00\xb7\x02\x00\x00\xc0\x02\x00\x00\xc9\x02\x00\x00\xd2\x02\x00\x00\xdb"
+            "\x02\x00\x00\xe4\x02\x00\x00\xed\x02\x00\x00\xfd\x02\x00\x00\x09\x03\x00\x00\x16\x03\x00\x00\x23\x03\x00\x00\x2d\x03\x00\x00\x3c"
+            "\x03\x00\x00\x4c\x03\x00\x00\x5c\x03\x00\x00\x6c\x03\x00\x00\x83\x03\x00\x00\x98\x03\x00\x00\xab\x03\x00\x00\xbe\x03\x00\x00\xd1"
+            "\x03\x00\x00\xe4\x03\x00\x00\xf3\x03\x00\x00\x03\x04\x00\x00\x16\x04\x00\x00\x2a\x04\x00\x00\x3e\x04\x00\x00\x52\x04\x00\x00\x66"
+            "\x04\x00\x00\x78\x04\x00\x00\x8a\x04\x00\x00\x9c\x04\x00\x00\xae\x04\x00\x00\xc0\x04\x00\x00\xd1\x04\x00\x00\xe2\x04\x00\x00\xf4"
+            "\x04\x00\x00\x00\x05\x00\x00\x0b\x05\x00\x00\x17\x05\x00\x00\x23\x05\x00\x00\x2f\x05\x00\x00\x3e\x05\x00\x00\x49\x05\x00\x00\x55"
+            "\x05\x00\x00\x65\x05\x00\x00\x75\x05\x00\x00\x85\x05\x00\x00\x96\x05\x00\x00\xa6\x05\x00\x00\xb5\x05\x00\x00\xc0\x05\x00\x00\xcb"
+            "\x05\x00\x00\xd7\x05\x00\x00\xf0\x05\x00\x00\x00\x06\x00\x00\x0f\x06\x00\x00\x1c\x06\x00\x00\x26\x06\x00\x00\x37\x06\x00\x00\x48"
+            "\x06\x00\x00\x59\x06\x00\x00\x66\x06\x00\x00\x74\x06\x00\x00\x82\x06\x00\x00\x90\x06\x00\x00\x9e\x06\x00\x00\xac\x06\x00\x00\xb9"
+            "\x06\x00\x00\xc6\x06\x00\x00\xd6\x06\x00\x00\xe7\x06\x00\x00\xf9\x06\x00\x00\x06\x07\x00\x00\x14\x07\x00\x00\x23\x07\x00\x00\x32"
+            "\x07\x00\x00\x41\x07\x00\x00\x51\x07\x00\x00\x60\x07\x00\x00\x6d\x07\x00\x00\x7d\x07\x00\x00\x50\x61\x6c\x6c\x65\x74\x20\x54\x6f"
+            "\x77\x6e\x00\x56\x69\x72\x69\x64\x69\x61\x6e\x20\x43\x69\x74\x79\x00\x43\x65\x72\x75\x6c\x65\x0e\x00\x85\x56\x65\x72\x6d\x69\x6c"
+            "\x69\x6f\x1d\x00\x34\x6c\x61\x64\x0d\x00\x73\x46\x75\x63\x68\x73\x69\x61\x1a\x00\xf3\x07\x69\x6e\x6e\x61\x62\x61\x72\x20\x49\x73"
+            "\x6c\x61\x6e\x64\x00\x52\x6f\x75\x74\x65\x20\x31\x08\x00\x13\x32\x08\x00\x13\x33\x08\x00\x13\x34\x08\x00\x13\x35\x08\x00\x13\x36"
+            "\x08\x00\x13\x37\x08\x00\x13\x38\x08\x00\x14\x39\x48\x00\x14\x30\x09\x00\x04\x52\x00\x14\x31\x53\x00\x14\x31\x54\x00\x14\x31\x55"
+            "\x00\x14\x31\x56\x00\x14\x31\x57\x00\x14\x31\x58\x00\x14\x31\x59\x00\x14\x31\x5a\x00\x14\x32\x5a\x00\x15\x32\xac\x00\x04\x5a\x00"
+            "\x14\x32\x5a\x00\x14\x32\x5a\x00\x26\x32\x35\x2d\x01\xf6\x03\x46\x6f\x72\x65\x73\x74\x00\x4d\x74\x2e\x20\x4d\x6f\x6f\x6e\x20\x31"
+            "\x46\x0c\x00\x19\x42\x0d\x00\xf0\x19\x32\x46\x00\x53\x2e\x53\x2e\x20\x41\x6e\x6e\x65\x00\x44\x69\x67\x6c\x65\x74\x74\x27\x73\x20"
+            "\x43\x61\x76\x65\x00\x56\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\x43\x00\x09\x10\x00\x1b\x32\x10\x00\xf0\x01\x33\x46\x00\x50"
+            "\x6f\x6b\xc3\xa9\x6d\x6f\x6e\x20\x4d\x61\x6e\x73\x97\x01\x3f\x31\x46\x2d\x17\x00\x01\x00\x82\x00\xf9\x03\x53\x61\x66\x61\x72\x69"
+            "\x20\x5a\x6f\x6e\x65\x20\x43\x65\x6e\x74\x65\x72\x13\x00\x6e\x41\x72\x65\x61\x20\x31\x13\x00\x1e\x32\x13\x00\x00\x09\x01\x90\x63"
+            "\x6b\x20\x54\x75\x6e\x6e\x65\x6c\xa7\x00\x08\x0f\x00\x01\x6b\x00\x63\x65\x61\x66\x6f\x61\x6d\xfd\x01\x10\x73\x23\x00\x0c\x13\x00"
+            "\x0f\x27\x00\x01\x01\x1b\x01\x0c\x14\x00\x1f\x33\x14\x00\x00\x17\x34\xe3\x00\x59\x54\x6f\x77\x65\x72\x0c\x01\x02\x12\x00\x0e\x24"
+            "\x00\x1d\x35\x12\x00\x1d\x36\x12\x00\x27\x37\x46\xf2\x02\x30\x61\x76\x65\xbb\x00\x0a\x11\x00\x1c\x32\x11\x00\x00\xca\x00\x11\x50"
+            "\x3d\x00\x94\x50\x6c\x61\x6e\x74\x00\x4f\x6e\x65\xf6\x02\x35\x46\x6f\x75\x02\x03\x35\x46\x69\x76\x18\x00\x61\x4b\x69\x6e\x64\x6c"
+            "\x65\xc6\x01\xf0\x10\x00\x54\x72\x65\x61\x73\x75\x72\x65\x20\x42\x65\x61\x63\x68\x00\x43\x61\x70\x65\x20\x42\x72\x69\x6e\x6b\x00"
+            "\x42\x6f\x6e\x64\x0b\x00\x81\x64\x67\x65\x00\x54\x68\x72\x65\x3f\x00\xf5\x17\x65\x20\x50\x6f\x72\x74\x00\x52\x65\x73\x6f\x72\x74"
+            "\x20\x47\x6f\x72\x67\x65\x6f\x75\x73\x00\x57\x61\x74\x65\x72\x20\x4c\x61\x62\x79\x72\x69\x6e\x74\x68\x6e\x00\xf4\x11\x65\x20\x4d"
+            "\x65\x61\x64\x6f\x77\x00\x4d\x65\x6d\x6f\x72\x69\x61\x6c\x20\x50\x69\x6c\x6c\x61\x72\x00\x4f\x75\x74\x63\x61\x73\x74\x92\x00\xa3"
+            "\x47\x72\x65\x65\x6e\x20\x50\x61\x74\x68\x4b\x00\x01\x0b\x00\x60\x52\x75\x69\x6e\x20\x56\x1c\x04\x93\x79\x00\x54\x72\x61\x69\x6e"
+            "\x65\x72\x28\x01\xf2\x14\x28\x65\x78\x74\x65\x72\x69\x6f\x72\x29\x00\x43\x61\x6e\x79\x6f\x6e\x20\x45\x6e\x74\x72\x61\x6e\x63\x65"
+            "\x00\x53\x65\x76\x61\x75\x6c\x74\x20\x18\x00\x80\x00\x54\x61\x6e\x6f\x62\x79\x20\x4b\x00\x11\x73\x06\x03\x56\x45\x6d\x62\x65\x72"
+            "\x0a\x00\x7c\x20\x52\x6f\x6f\x6d\x20\x31\x11\x00\x1c\x32\x11\x00\x17\x33\x11\x00\x03\x50\x03\x02\x0d\x00\x04\x5e\x03\x03\x0e\x00"
+            "\x19\x32\x0e\x00\x19\x33\x0e\x00\x19\x34\x0e\x00\x84\x35\x46\x00\x42\x65\x72\x72\x79\xbc\x03\x72\x49\x63\x65\x66\x61\x6c\x6c\x8a"
+            "\x03\x08\x0d\x00\x00\x70\x00\x09\x10\x00\x00\x73\x00\x0a\x11\x00\xf0\x04\x61\x63\x6b\x00\x50\x61\x74\x74\x65\x72\x6e\x20\x42\x75"
+            "\x73\x68\x00\x41\x6c\x20\x01\x22\x6e\x67\x4e\x00\x31\x4d\x6f\x6e\x30\x02\x21\x68\x61\xfd\x00\x65\x4c\x69\x70\x74\x6f\x6f\x0f\x00"
+            "\x65\x57\x65\x65\x70\x74\x68\x0f\x00\x75\x44\x69\x6c\x66\x6f\x72\x64\x10\x00\x65\x53\x63\x75\x66\x69\x62\x0f\x00\x45\x52\x69\x78"
+            "\x79\x0d\x00\x75\x56\x69\x61\x70\x6f\x69\x73\x10\x00\x00",
+            1294, 1917
+        },
+        // hgss_fr
+        {
+            "\xf3\xff\xff\x02\x78\x00\x00\x00\xe8\x01\x00\x00\xf6\x01\x00\x00\xff\x01\x00\x00\x10\x02\x00\x00\x19\x02\x00\x00\x22\x02\x00\x00"
+            "\x2e\x02\x00\x00\x3b\x02\x00\x00\x44\x02\x00\x00\x5c\x02\x00\x00\x73\x02\x00\x00\x81\x02\x00\x00\x90\x02\x00\x00\x9f\x02\x00\x00"
+            "\xa8\x02\x00\x00\xb9\x02\x00\x00\xcb\x02\x00\x00\xd7\x02\x00\x00\xe0\x02\x00\x00\xe9\x02\x00\x00\xf7\x02\x00\x00\x00\x03\x00\x00"
+            "\x09\x03\x00\x00\x17\x03\x00\x00\x27\x03\x00\x00\x38\x03\x00\x00\x43\x03\x00\x00\x4c\x03\x00\x00\x55\x03\x00\x00\x62\x03\x00\x00"
+            "\x6b\x03\x00\x00\x74\x03\x00\x00\x85\x03\x00\x00\x97\x03\x00\x00\xa9\x03\x00\x00\xbb\x03\x00\x00\xc9\x03\x00\x00\xd2\x03\x00\x00"
+            "\xe0\x03\x00\x00\xf5\x03\x00\x00\x03\x04\x00\x00\x12\x04\x00\x00\x1b\x04\x00\x00\x28\x04\x00\x00\x31\x04\x00\x00\x3d\x04\x00\x00"
+            "\x4a\x04\x00\x00\x57\x04\x00\x00\x64\x04\x00\x00\x74\x04\x00\x00\x83\x04\x00\x00\x8c\x04\x00\x00\x95\x04\x00\x00\xaa\x04\x00\x00"
+            "\xbf\x04\x00\x00\xc8\x04\x00\x00\xd1\x04\x00\x00\xe5\x04\x00\x00\xf8\x04\x00\x00\x0c\x05\x00\x00\x20\x05\x00\x00\x34\x05\x00\x00"
+            "\x48\x05\x00\x00\x56\x05\x00\x00\x6d\x05\x00\x00\x7b\x05\x00\x00\x8b\x05\x00\x00\x96\x05\x00\x00\xa1\x05\x00\x00\xaf\x05\x00\x00"
+            "\xcc\x05\x00\x00\xdf\x05\x00\x00\xee\x05\x00\x00\xf7\x05\x00\x00\x00\x06\x00\x00\x09\x06\x00\x00\x15\x06\x00\x00\x23\x06\x00\x00"
+            "\x31\x06\x00\x00\x40\x06\x00\x00\x4d\x06\x00\x00\x5a\x06\x00\x00\x6a\x06\x00\x00\x73\x06\x00\x00\x7c\x06\x00\x00\x85\x06\x00\x00"
+            "\x8e\x06\x00\x00\x97\x06\x00\x00\xa6\x06\x00\x00\xb5\x06\x00\x00\xc5\x06\x00\x00\xcd\x06\x00\x00\xdd\x06\x00\x00\xe5\x06\x00\x00"
+            "\xed\x06\x00\x00\xf5\x06\x00\x00\xfd\x06\x00\x00\x05\x07\x00\x00\x0d\x07\x00\x00\x15\x07\x00\x00\x1e\x07\x00\x00\x27\x07\x00\x00"
+            "\x30\x07\x00\x00\x39\x07\x00\x00\x42\x07\x00\x00\x4b\x07\x00\x00\x54\x07\x00\x00\x5d\x07\x00\x00\x66\x07\x00\x00\x6f\x07\x00\x00"
+            "\x78\x07\x00\x00\x81\x07\x00\x00\x8d\x07\x00\x00\x9e\x07\x00\x00\xae\x07\x00\x00\xbe\x07\x00\x00\xce\x07\x00\x00\xde\x07\x00\x00"
+            "\xef\x07\x00\x00\x00\x08\x00\x00\x12\x08\x00\x00\x4e\x65\x77\x20\x42\x61\x72\x6b\x20\x54\x6f\x77\x6e\x00\x52\x6f\x75\x74\x65\x20"
+            "\x32\x39\x00\x43\x68\x65\x72\x72\x79\x67\x72\x6f\x76\x65\x20\x43\x69\x74\x79\x1a\x00\x24\x33\x30\x09\x00\x82\x31\x00\x56\x69\x6f"
+            "\x6c\x65\x74\x1e\x00\x60\x53\x70\x72\x6f\x75\x74\x44\x00\x24\x65\x72\x22\x00\xfc\x0a\x32\x00\x52\x75\x69\x6e\x73\x20\x6f\x66\x20"
+            "\x41\x6c\x70\x68\x20\x28\x4f\x75\x74\x73\x69\x64\x65\x29\x18\x00\x22\x49\x6e\x17\x00\xd8\x55\x6e\x69\x6f\x6e\x20\x43\x61\x76\x65"
+            "\x20\x31\x46\x0e\x00\x1b\x42\x0f\x00\x24\x32\x46\x64\x00\xf0\x00\x33\x00\x53\x4c\x4f\x57\x50\x4f\x4b\x45\x20\x57\x65\x6c\x6c\x38"
+            "\x00\x0a\x11\x00\x00\x3b\x00\xb4\x49\x6c\x65\x78\x20\x46\x6f\x72\x65\x73\x74\x38\x00\x14\x34\x09\x00\xf4\x00\x35\x00\x4e\x61\x74"
+            "\x69\x6f\x6e\x61\x6c\x20\x50\x61\x72\x6b\x17\x00\x14\x36\x09\x00\xa2\x37\x00\x45\x63\x72\x75\x74\x65\x61\x6b\xe9\x00\x62\x42\x75"
+            "\x72\x6e\x65\x64\xe9\x00\x00\x6e\x00\x09\x10\x00\x00\x6d\x00\x10\x42\x76\x00\x09\x08\x01\x14\x38\x09\x00\x89\x39\x00\x4f\x6c\x69"
+            "\x76\x69\x6e\x52\x01\x14\x34\x52\x01\xf0\x01\x34\x31\x00\x57\x68\x69\x72\x6c\x20\x49\x73\x6c\x61\x6e\x64\x73\x5e\x00\x0a\x11\x00"
+            "\x00\x5f\x00\x0b\x12\x00\x1d\x32\x12\x00\xb9\x33\x46\x00\x43\x69\x61\x6e\x77\x6f\x6f\x64\x67\x00\xb1\x32\x00\x4d\x74\x2e\x20\x4d"
+            "\x6f\x72\x74\x61\xb9\x00\x09\x0e\x00\x78\x20\x28\x42\x61\x63\x6b\x29\x15\x00\x19\x32\x23\x00\x00\x7b\x00\x03\x49\x00\x60\x33\x00"
+            "\x4c\x61\x6b\x65\xbe\x01\x44\x52\x61\x67\x65\x16\x00\xa0\x34\x00\x49\x63\x65\x20\x50\x61\x74\x68\x5d\x00\x05\x0c\x00\x01\x7f\x01"
+            "\x05\x0d\x00\x18\x32\x0d\x00\xd2\x33\x46\x00\x42\x6c\x61\x63\x6b\x74\x68\x6f\x72\x6e\xab\x00\xd4\x44\x72\x61\x67\x6f\x6e\xe2\x80"
+            "\x99\x73\x20\x44\x65\x8d\x02\x24\x34\x35\x09\x00\x30\x36\x00\x44\xa9\x02\x01\x04\x02\x14\x28\x87\x02\x1e\x29\x15\x00\x34\x34\x35"
+            "\x29\x33\x00\x13\x37\xc5\x00\x25\x6f\x6e\x09\x00\xf8\x04\x20\x28\x43\x6c\x65\x66\x61\x69\x72\x79\x29\x00\x53\x65\x61\x66\x6f\x61"
+            "\x6d\x73\x01\x0c\x13\x00\x00\xc2\x00\x0d\x14\x00\x1f\x32\x14\x00\x00\x1f\x33\x14\x00\x00\x12\x34\x45\x01\x42\x53\x69\x6c\x76\x2f"
+            "\x02\x07\x0e\x00\x03\xe8\x02\x48\x20\x54\x6f\x70\x17\x00\xf3\x03\x34\x46\x00\x43\x6c\x69\x66\x66\x20\x45\x64\x67\x65\x20\x47\x61"
+            "\x74\x65\x10\x00\x00\x30\x00\x07\x29\x00\x08\x34\x00\x03\xac\x01\x08\x59\x00\x71\x4d\x6f\x75\x6e\x74\x61\x69\x5a\x03\x0d\x1d\x00"
+            "\x19\x33\x30\x00\x00\x81\x00\x02\x2f\x01\x24\x31\x32\x09\x00\x14\x39\x0a\x04\x50\x30\x00\x50\x61\x6c\xe7\x03\x01\x1f\x04\x73\x56"
+            "\x69\x72\x69\x64\x69\x61\xaf\x01\x64\x43\x65\x72\x75\x6c\x65\x0e\x00\x61\x56\x65\x72\x6d\x69\x6c\xa5\x03\x02\x1d\x00\x34\x6c\x61"
+            "\x64\x0d\x00\x73\x46\x75\x63\x68\x73\x69\x61\x1a\x00\x73\x69\x6e\x6e\x61\x62\x61\x72\x27\x01\x04\xab\x01\x04\x27\x03\x14\x32\x7c"
+            "\x03\x24\x32\x37\x09\x00\x16\x38\xc6\x01\xa1\x52\x6f\x63\x6b\x20\x54\x75\x6e\x6e\x65\xed\x03\x08\x0f\x00\xf2\x00\x32\x46\x00\x56"
+            "\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\x1f\x00\x01\xce\x00\x04\x48\x00\x74\x20\x28\x53\x6f\x75\x74\x68\x1e\x02\x14\x33\x7b"
+            "\x00\x03\x08\x00\x04\x69\x02\x04\x81\x00\x04\x80\x00\x04\x9a\x00\x04\x15\x01\x14\x31\xb3\x03\x14\x31\x5a\x00\x14\x31\x4b\x00\x14"
+            "\x31\x4c\x00\x14\x31\x4d\x00\x14\x31\x4e\x00\x14\x31\x4f\x00\x15\x31\xea\x00\x05\x99\x00\x04\x78\x01\x14\x32\x3f\x00\xf1\x07\x32"
+            "\x35\x00\x54\x6f\x68\x6a\x6f\x20\x46\x61\x6c\x6c\x73\x00\x44\x49\x47\x4c\x45\x54\x54\x1a\x03\x01\x08\x02\x09\xe9\x00\x0c\xf9\x00"
+            "\x14\x33\xf9\x00\x60\x32\x20\x28\x4e\x6f\x72\xf1\x00\x05\xb9\x01\x03\x07\x05\x06\xbb\x01\x03\x6e\x05\x0a\x11\x00\x1c\x32\x11\x00"
+            "\x00\x06\x03\x00",
+            1348, 2066
+        },
+        // natures_fr
+        {
+            "\xf0\xa2\x19\x00\x00\x00\x6c\x00\x00\x00\x72\x00\x00\x00\x77\x00\x00\x00\x7d\x00\x00\x00\x84\x00\x00\x00\x8c\x00\x00\x00\x94\x00"
+            "\x00\x00\x9b\x00\x00\x00\xa1\x00\x00\x00\xa7\x00\x00\x00\xae\x00\x00\x00\xb5\x00\x00\x00\xbd\x00\x00\x00\xc6\x00\x00\x00\xcd\x00"
+            "\x00\x00\xd3\x00\x00\x00\xdb\x00\x00\x00\xe0\x00\x00\x00\xe8\x00\x00\x00\xf0\x00\x00\x00\xf7\x00\x00\x00\xfd\x00\x00\x00\x04\x01"
+            "\x00\x00\x0c\x01\x00\x00\x14\x01\x00\x00\x1c\x01\x00\x00\x48\x61\x72\x64\x69\x00\x53\x6f\x6c\x6f\x00\x42\x72\x61\x76\x65\x00\x52"
+            "\x69\x67\x69\x64\x65\x00\x4d\x61\x75\x76\x61\x69\x73\x00\x41\x73\x73\x75\x72\xc3\xa9\x00\x44\x6f\x63\x69\x6c\x65\x00\x52\x65\x6c"
+            "\x61\x78\x00\x4d\x61\x6c\x69\x6e\x00\x4c\xc3\xa2\x63\x68\x65\x00\x54\x69\x6d\x31\x00\xf0\x3f\x50\x72\x65\x73\x73\xc3\xa9\x00\x53"
+            "\xc3\xa9\x72\x69\x65\x75\x78\x00\x4a\x6f\x76\x69\x61\x6c\x00\x4e\x61\xc3\xaf\x66\x00\x4d\x6f\x64\x65\x73\x74\x65\x00\x44\x6f\x75"
+            "\x78\x00\x44\x69\x73\x63\x72\x65\x74\x00\x50\x75\x64\x69\x71\x75\x65\x00\x46\x6f\x75\x66\x6f\x75\x00\x43\x61\x6c\x6d\x65\x00\x47"
+            "\x65\x6e\x74\x69\x6c\x63\x00\xf0\x06\x70\x6f\x6c\x69\x00\x50\x72\x75\x64\x65\x6e\x74\x00\x42\x69\x7a\x61\x72\x72\x65\x00",
+            286, 284
+        },
+        // powers_fr
+        {
+            "\xf0\x7d\x10\x00\x00\x00\x48\x00\x00\x00\x4f\x00\x00\x00\x53\x00\x00\x00\x5a\x00\x00\x00\x5e\x00\x00\x00\x64\x00\x00\x00\x6c\x00"
+            "\x00\x00\x74\x00\x00\x00\x7a\x00\x00\x00\x7e\x00\x00\x00\x82\x00\x00\x00\x89\x00\x00\x00\x93\x00\x00\x00\x97\x00\x00\x00\x9d\x00"
+            "\x00\x00\xa4\x00\x00\x00\xaf\x00\x00\x00\x43\x6f\x6d\x62\x61\x74\x00\x56\x6f\x6c\x00\x50\x6f\x69\x73\x6f\x6e\x00\x53\x6f\x6c\x00"
+            "\x52\x6f\x63\x68\x65\x00\x49\x6e\x73\x65\x63\x74\x65\x00\x53\x70\x65\x63\x74\x72\x65\x00\x41\x63\x69\x65\x72\x00\x46\x65\x75\x00"
+            "\x45\x61\x75\x00\x50\x6c\x61\x6e\x74\x65\x00\xc3\x89\x6c\x1e\x00\xf0\x10\x69\x6b\x00\x50\x73\x79\x00\x47\x6c\x61\x63\x65\x00\x44"
+            "\x72\x61\x67\x6f\x6e\x00\x54\xc3\xa9\x6e\xc3\xa8\x62\x72\x65\x73\x00",
+            177, 175
+        },
+        // rse_fr
+        {
+            "\xf3\xff\x69\x56\x00\x00\x00\x60\x01\x00\x00\x6d\x01\x00\x00\x7d\x01\x00\x00\x8c\x01\x00\x00\x9b\x01\x00\x00\xa9\x01\x00\x00\xb7"
+            "\x01\x00\x00\xc7\x01\x00\x00\xd8\x01\x00\x00\xe2\x01\x00\x00\xec\x01\x00\x00\xf6\x01\x00\x00\x00\x02\x00\x00\x0a\x02\x00\x00\x14"
+            "\x02\x00\x00\x1e\x02\x00\x00\x28\x02\x00\x00\x32\x02\x00\x00\x3c\x02\x00\x00\x46\x02\x00\x00\x50\x02\x00\x00\x5a\x02\x00\x00\x64"
+            "\x02\x00\x00\x6e\x02\x00\x00\x78\x02\x00\x00\x82\x02\x00\x00\x8c\x02\x00\x00\x96\x02\x00\x00\xa0\x02\x00\x00\xaa\x02\x00\x00\xb4"
+            "\x02\x00\x00\xbe\x02\x00\x00\xc8\x02\x00\x00\xd2\x02\x00\x00\xdc\x02\x00\x00\xe6\x02\x00\x00\xf0\x02\x00\x00\xfa\x02\x00\x00\x04"
+            "\x03\x00\x00\x0e\x03\x00\x00\x18\x03\x00\x00\x22\x03\x00\x00\x2c\x03\x00\x00\x43\x03\x00\x00\x5a\x03\x00\x00\x6a\x03\x00\x00\x85"
+            "\x03\x00\x00\x96\x03\x00\x00\xa7\x03\x00\x00\xba\x03\x00\x00\xcd\x03\x00\x00\xe0\x03\x00\x00\xf3\x03\x00\x00\x06\x04\x00\x00\x19"
+            "\x04\x00\x00\x29\x04\x00\x00\x38\x04\x00\x00\x47\x04\x00\x00\x5f\x04\x00\x00\x77\x04\x00\x00\x8a\x04\x00\x00\x9d\x04\x00\x00\xb1"
+            "\x04\x00\x00\xc5\x04\x00\x00\xe0\x04\x00\x00\xef\x04\x00\x00\xfe\x04\x00\x00\x10\x05\x00\x00\x20\x05\x00\x00\x2b\x05\x00\x00\x3f"
+            "\x05\x00\x00\x4f\x05\x00\x00\x5f\x05\x00\x00\x70\x05\x00\x00\x81\x05\x00\x00\x99\x05\x00\x00\xa8\x05\x00\x00\xb3\x05\x00\x00\xbf"
+            "\x05\x00\x00\xcd\x05\x00\x00\xdb\x05\x00\x00\xe9\x05\x00\x00\xf7\x05\x00\x00\x04\x06\x00\x00\x11\x06\x00\x00\x22\x06\x00\x00\x30"
+            "\x06\x00\x00\x44\x65\x77\x66\x6f\x72\x64\x20\x54\x6f\x77\x6e\x00\x50\x61\x63\x69\x66\x69\x64\x6c\x6f\x67\x10\x00\xf2\x08\x65\x74"
+            "\x61\x6c\x62\x75\x72\x67\x20\x43\x69\x74\x79\x00\x53\x6c\x61\x74\x65\x70\x6f\x72\x74\x0f\x00\x82\x4c\x69\x6c\x79\x63\x6f\x76\x65"
+            "\x0e\x00\x83\x4d\x6f\x73\x73\x64\x65\x65\x70\x2b\x00\x92\x6f\x6f\x74\x6f\x70\x6f\x6c\x69\x73\x10\x00\xa3\x45\x76\x65\x72\x20\x47"
+            "\x72\x61\x6e\x64\x2f\x00\x95\x52\x6f\x75\x74\x65\x20\x31\x30\x31\x0a\x00\x15\x32\x0a\x00\x15\x33\x0a\x00\x15\x34\x0a\x00\x15\x35"
+            "\x0a\x00\x15\x36\x0a\x00\x15\x37\x0a\x00\x15\x38\x0a\x00\x14\x39\x0a\x00\x25\x31\x30\x0a\x00\x05\x64\x00\x15\x31\x64\x00\x15\x31"
+            "\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x32\x64\x00\x15\x32"
+            "\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32"
+            "\x64\x00\x15\x33\x64\x00\x15\x33\x64\x00\x15\x33\x64\x00\x15\x33\x64\x00\xf5\x00\x33\x34\x00\x55\x6e\x64\x65\x72\x77\x61\x74\x65"
+            "\x72\x20\x28\x7a\x00\x1f\x29\x17\x00\x02\x30\x36\x29\x00\x8e\x01\xba\x69\x74\x65\x20\x43\x61\x76\x65\x20\x31\x46\x10\x00\xda\x53"
+            "\x74\x65\x76\x65\x6e\x27\x73\x20\x52\x6f\x6f\x6d\x1b\x00\x1c\x42\x2c\x00\xfe\x07\x42\x32\x46\x00\x53\x61\x66\x61\x72\x69\x20\x5a"
+            "\x6f\x6e\x65\x20\x41\x72\x65\x61\x20\x31\x13\x00\x1e\x32\x13\x00\x1e\x33\x13\x00\x1e\x34\x13\x00\x1e\x35\x13\x00\x17\x36\x9c\x02"
+            "\xfb\x2c\x57\x6f\x6f\x64\x73\x00\x52\x75\x73\x74\x75\x72\x66\x20\x54\x75\x6e\x6e\x65\x6c\x00\x41\x62\x61\x6e\x64\x6f\x6e\x65\x64"
+            "\x20\x53\x68\x69\x70\x00\x4e\x65\x77\x20\x4d\x61\x75\x76\x69\x6c\x6c\x65\x20\x28\x45\x6e\x74\x72\x61\x6e\x63\x65\x29\x18\x00\xfd"
+            "\x0d\x42\x61\x73\x65\x6d\x65\x6e\x74\x29\x00\x4d\x65\x74\x65\x6f\x72\x20\x46\x61\x6c\x6c\x73\x20\x31\x46\x20\x31\x52\x13\x00\x1b"
+            "\x32\x13\x00\x1f\x42\x27\x00\x00\x00\x14\x00\x0c\x28\x00\x05\x5b\x01\x00\x3d\x01\x80\x00\x4d\x74\x2e\x20\x50\x79\x72\x82\x01\x36"
+            "\x2d\x33\x46\x0f\x00\x47\x34\x46\x2d\x36\x0f\x00\x86\x45\x78\x74\x65\x72\x69\x6f\x72\x12\x00\xc2\x53\x75\x6d\x6d\x69\x74\x00\x53"
+            "\x68\x6f\x61\x6c\x4b\x00\x06\x0b\x00\x42\x20\x49\x63\x65\xba\x01\x81\x53\x65\x61\x66\x6c\x6f\x6f\x72\x17\x00\xf0\x00\x72\x6e\x00"
+            "\x56\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\xf5\x01\x09\x10\x00\x00\xda\x01\x0a\x11\x00\x31\x32\x46\x00\x50\x00\xa4\x6f\x66"
+            "\x20\x4f\x72\x69\x67\x69\x6e\x20\x3b\x01\x0b\x18\x00\xf0\x13\x00\x46\x69\x65\x72\x79\x20\x50\x61\x74\x68\x00\x4a\x61\x67\x67\x65"
+            "\x64\x20\x50\x61\x73\x73\x00\x53\x6b\x79\x20\x50\x69\x6c\x6c\x61\x72\x6e\x00\x07\x0e\x00\x19\x33\x0e\x00\xf0\x08\x35\x46\x00\x4d"
+            "\x61\x67\x6d\x61\x20\x48\x69\x64\x65\x6f\x75\x74\x00\x4d\x69\x72\x61\x67\x65\x86\x04\xa2\x65\x72\x00\x41\x72\x74\x69\x73\x61\x6e"
+            "\xe6\x00\x71\x44\x65\x73\x65\x72\x74\x20\xd5\x02\x10\x70\x63\x00\x20\x41\x6c\x1b\x01\x22\x6e\x67\x1f\x00\x00",
+            1051, 1584
+        },
+        // species_fr
+        {
+            "\xf4\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xaf\x27\x03\x00\x00\xa4\x0c\x00\x00\xaf\x0c\x00\x00\xba\x0c\x00\x00\xc5\x0c"
+            "\x00\x00\xd0\x0c\x00\x00\xda\x0c\x00\x00\xe4\x0c\x00\x00\xed\x0c\x00\x00\xf7\x0c\x00\x00\xff\x0c\x00\x00\x08\x0d\x00\x00\x13\x0d"
+            "\x00\x00\x1e\x0d\x00\x00\x26\x0d\x00\x00\x30\x0d\x00\x00\x3b\x0d\x00\x00\x43\x0d\x00\x00\x4c\x0d\x00\x00\x57\x0d\x00\x00\x5f\x0d"
+            "\x00\x00\x68\x0d\x00\x00\x71\x0d\x00\x00\x7c\x0d\x00\x00\x80\x0d\x00\x00\x86\x0d\x00\x00\x8e\x0d\x00\x00\x95\x0d\x00\x00\x9f\x0d"
+            "\x00\x00\xaa\x0d\x00\x00\xb5\x0d\x00\x00\xbe\x0d\x00\x00\xc8\x0d\x00\x00\xd3\x0d\x00\x00\xdc\x0d\x00\x00\xe5\x0d\x00\x00\xef\x0d"
+            "\x00\x00\xfa\x0d\x00\x00\x01\x0e\x00\x00\x09\x0e\x00\x00\x13\x0e\x00\x00\x1d\x0e\x00\x00\x28\x0e\x00\x00\x33\x0e\x00\x00\x3d\x0e"
+            "\x00\x00\x44\x0e\x00\x00\x4e\x0e\x00\x00\x54\x0e\x00\x00\x5d\x0e\x00\x00\x66\x0e\x00\x00\x70\x0e\x00\x00\x7b\x0e\x00\x00\x86\x0e"
+            "\x00\x00\x8e\x0e\x00\x00\x96\x0e\x00\x00\xa0\x0e\x00\x00\xa9\x0e\x00\x00\xb4\x0e\x00\x00\xbf\x0e\x00\x00\xc7\x0e\x00\x00\xcf\x0e"
+            "\x00\x00\xd7\x0e\x00\x00\xe0\x0e\x00\x00\xe8\x0e\x00\x00\xed\x0e\x00\x00\xf5\x0e\x00\x00\xfe\x0e\x00\x00\x05\x0f\x00\x00\x0f\x0f"
+            "\x00\x00\x1a\x0f\x00\x00\x25\x0f\x00\x00\x30\x0f\x00\x00\x39\x0f\x00\x00\x43\x0f\x00\x00\x4e\x0f\x00\x00\x58\x0f\x00\x00\x63\x0f"
+            "\x00\x00\x6a\x0f\x00\x00\x71\x0f\x00\x00\x78\x0f\x00\x00\x81\x0f\x00\x00\x8b\x0f\x00\x00\x94\x0f\x00\x00\x9e\x0f\x00\x00\xa9\x0f"
+            "\x00\x00\xaf\x0f\x00\x00\xb6\x0f\x00\x00\xbd\x0f\x00\x00\xc7\x0f\x00\x00\xcf\x0f\x00\x00\xda\x0f\x00\x00\xe2\x0f\x00\x00\xec\x0f"
+            "\x00\x00\xf7\x0f\x00\x00\x00\x10\x00\x00\x0b\x10\x00\x00\x10\x10\x00\x00\x1a\x10\x00\x00\x24\x10\x00\x00\x2b\x10\x00\x00\x34\x10"
+            "\x00\x00\x3d\x10\x00\x00\x48\x10\x00\x00\x52\x10\x00\x00\x5b\x10\x00\x00\x64\x10\x00\x00\x6e\x10\x00\x00\x76\x10\x00\x00\x7d\x10"
+            "\x00\x00\x88\x10\x00\x00\x8e\x10\x00\x00\x96\x10\x00\x00\xa1\x10\x00\x00\xad\x10\x00\x00\xb7\x10\x00\x00\xc2\x10\x00\x00\xcc\x10"
+            "\x00\x00\xd7\x10\x00\x00\xe1\x10\x00\x00\xed\x10\x00\x00\xf7\x10\x00\x00\xfd\x10\x00\x00\x05\x11\x00\x00\x0d\x11\x00\x00\x19\x11"
+            "\x00\x00\x23\x11\x00\x00\x2c\x11\x00\x00\x33\x11\x00\x00\x3e\x11\x00\x00\x45\x11\x00\x00\x4f\x11\x00\x00\x59\x11\x00\x00\x62\x11"
+            "\x00\x00\x6d\x11\x00\x00\x74\x11\x00\x00\x7b\x11\x00\x00\x83\x11\x00\x00\x8a\x11\x00\x00\x92\x11\x00\x00\x9a\x11\x00\x00\xa4\x11"
+            "\x00\x00\xab\x11\x00\x00\xb4\x11\x00\x00\xbb\x11\x00\x00\xc3\x11\x00\x00\xcd\x11\x00\x00\xd7\x11\x00\x00\xdf\x11\x00\x00\xe9\x11"
+            "\x00\x00\xef\x11\x00\x00\xfa\x11\x00\x00\x01\x12\x00\x00\x05\x12\x00\x00\x0f\x12\x00\x00\x19\x12\x00\x00\x23\x12\x00\x00\x2f\x12"
+            "\x00\x00\x39\x12\x00\x00\x44\x12\x00\x00\x4d\x12\x00\x00\x57\x12\x00\x00\x62\x12\x00\x00\x6c\x12\x00\x00\x74\x12\x00\x00\x7d\x12"
+            "\x00\x00\x86\x12\x00\x00\x8b\x12\x00\x00\x96\x12\x00\x00\x9e\x12\x00\x00\xa6\x12\x00\x00\xb0\x12\x00\x00\xb7\x12\x00\x00\xbf\x12"
+            "\x00\x00\xc5\x12\x00\x00\xcb\x12\x00\x00\xd5\x12\x00\x00\xdc\x12\x00\x00\xe4\x12\x00\x00\xe9\x12\x00\x00\xee\x12\x00\x00\xf7\x12"
+            "\x00\x00\x01\x13\x00\x00\x09\x13\x00\x00\x12\x13\x00\x00\x19\x13\x00\x00\x23\x13\x00\x00\x2e\x13\x00\x00\x36\x13\x00\x00\x3f\x13"
+            "\x00\x00\x48\x13\x00\x00\x50\x13\x00\x00\x59\x13\x00\x00\x64\x13\x00\x00\x70\x13\x00\x00\x76\x13\x00\x00\x7e\x13\x00\x00\x87\x13"
+            "\x00\x00\x8f\x13\x00\x00\x97\x13\x00\x00\xa1\x13\x00\x00\xa9\x13\x00\x00\xb4\x13\x00\x00\xba\x13\x00\x00\xc5\x13\x00\x00\xcf\x13"
+            "\x00\x00\xd8\x13\x00\x00\xe2\x13\x00\x00\xed\x13\x00\x00\xf7\x13\x00\x00\xff\x13\x00\x00\x08\x14\x00\x00\x11\x14\x00\x00\x1a\x14"
+            "\x00\x00\x22\x14\x00\x00\x2b\x14\x00\x00\x34\x14\x00\x00\x3d\x14\x00\x00\x47\x14\x00\x00\x50\x14\x00\x00\x58\x14\x00\x00\x63\x14"
+            "\x00\x00\x6d\x14\x00\x00\x77\x14\x00\x00\x7f\x14\x00\x00\x89\x14\x00\x00\x93\x14\x00\x00\x9b\x14\x00\x00\xa4\x14\x00\x00\xac\x14"
+            "\x00\x00\xb4\x14\x00\x00\xbf\x14\x00\x00\xc7\x14\x00\x00\xce\x14\x00\x00\xd6\x14\x00\x00\xdf\x14\x00\x00\xea\x14\x00\x00\xf5\x14"
+            "\x00\x00\xfe\x14\x00\x00\x06\x15\x00\x00\x0f\x15\x00\x00\x17\x15\x00\x00\x1d\x15\x00\x00\x28\x15\x00\x00\x32\x15\x00\x00\x39\x15"
+            "\x00\x00\x3f\x15\x00\x00\x47\x15\x00\x00\x50\x15\x00\x00\x58\x15\x00\x00\x62\x15\x00\x00\x68\x15\x00\x00\x6e\x15\x00\x00\x75\x15"
+            "\x00\x00\x7b\x15\x00\x00\x82\x15\x00\x00\x89\x15\x00\x00\x93\x15\x00\x00\x9b\x15\x00\x00\xa6\x15\x00\x00\xac\x15\x00\x00\xb3\x15"
+            "\x00\x00\xbb\x15\x00\x00\xc5\x15\x00\x00\xcf\x15\x00\x00\xd8\x15\x00\x00\xe0\x15\x00\x00\xeb\x15\x00\x00\xf3\x15\x00\x00\xfe\x15"
+            "\x00\x00\x08\x16\x00\x00\x10\x16\x00\x00\x1a\x16\x00\x00\x21\x16\x00\x00\x2a\x16\x00\x00\x35\x16\x00\x00\x3d\x16\x00\x00\x47\x16"
+            "\x00\x00\x52\x16\x00\x00\x5e\x16\x00\x00\x67\x16\x00\x00\x6f\x16\x00\x00\x76\x16\x00\x00\x7d\x16\x00\x00\x87\x16\x00\x00\x8e\x16"
+            "\x00\x00\x97\x16\x00\x00\xa0\x16\x00\x00\xaa\x16\x00\x00\xb3\x16\x00\x00\xbc\x16\x00\x00\xc8\x16\x00\x00\xd0\x16\x00\x00\xd8\x16"
+            "\x00\x00\xde\x16\x00\x00\xe7\x16\x00\x00\xef\x16\x00\x00\xf9\x16\x00\x00\x02\x17\x00\x00\x0b\x17\x00\x00\x13\x17\x00\x00\x1b\x17"
+            "\x00\x00\x22\x17\x00\x00\x2b\x17\x00\x00\x35\x17\x00\x00\x3f\x17\x00\x00\x47\x17\x00\x00\x4f\x17\x00\x00\x58\x17\x00\x00\x63\x17"
+            "\x00\x00\x6c\x17\x00\x00\x75\x17\x00\x00\x81\x17\x00\x00\x88\x17\x00\x00\x90\x17\x00\x00\x98\x17\x00\x00\xa1\x17\x00\x00\xaa\x17"
+            "\x00\x00\xb2\x17\x00\x00\xbb\x17\x00\x00\xc4\x17\x00\x00\xcd\x17\x00\x00\xd5\x17\x00\x00\xdd\x17\x00\x00\xe7\x17\x00\x00\xf1\x17"
+            "\x00\x00\xf9\x17\x00\x00\x00\x18\x00\x00\x07\x18\x00\x00\x0e\x18\x00\x00\x17\x18\x00\x00\x21\x18\x00\x00\x2a\x18\x00\x00\x31\x18"
+            "\x00\x00\x3a\x18\x00\x00\x41\x18\x00\x00\x49\x18\x00\x00\x52\x18\x00\x00\x5b\x18\x00\x00\x65\x18\x00\x00\x6d\x18\x00\x00\x76\x18"
+            "\x00\x00\x7f\x18\x00\x00\x8a\x18\x00\x00\x94\x18\x00\x00\x9c\x18\x00\x00\xa4\x18\x00\x00\xaa\x18\x00\x00\xb2\x18\x00\x00\xba\x18"
+            "\x00\x00\xc2\x18\x00\x00\xc9\x18\x00\x00\xd4\x18\x00\x00\xdd\x18\x00\x00\xe5\x18\x00\x00\xf0\x18\x00\x00\xf9\x18\x00\x00\x03\x19"
+            "\x00\x00\x0e\x19\x00\x00\x16\x19\x00\x00\x1c\x19\x00\x00\x22\x19\x00\x00\x2b\x19\x00\x00\x35\x19\x00\x00\x3e\x19\x00\x00\x45\x19"
+            "\x00\x00\x4e\x19\x00\x00\x57\x19\x00\x00\x61\x19\x00\x00\x69\x19\x00\x00\x72\x19\x00\x00\x7c\x19\x00\x00\x84\x19\x00\x00\x8a\x19"
+            "\x00\x00\x94\x19\x00\x00\x9c\x19\x00\x00\xa3\x19\x00\x00\xab\x19\x00\x00\xb6\x19\x00\x00\xbf\x19\x00\x00\xc6\x19\x00\x00\xd0\x19"
+            "\x00\x00\xd7\x19\x00\x00\xde\x19\x00\x00\xe5\x19\x00\x00\xed\x19\x00\x00\xf6\x19\x00\x00\xfe\x19\x00\x00\x05\x1a\x00\x00\x10\x1a"
+            "\x00\x00\x18\x1a\x00\x00\x21\x1a\x00\x00\x2c\x1a\x00\x00\x37\x1a\x00\x00\x41\x1a\x00\x00\x49\x1a\x00\x00\x53\x1a\x00\x00\x5e\x1a"
+            "\x00\x00\x67\x1a\x00\x00\x71\x1a\x00\x00\x7d\x1a\x00\x00\x86\x1a\x00\x00\x8f\x1a\x00\x00\x97\x1a\x00\x00\xa1\x1a\x00\x00\xa6\x1a"
+            "\x00\x00\xac\x1a\x00\x00\xb3\x1a\x00\x00\xbd\x1a\x00\x00\xc6\x1a\x00\x00\xcf\x1a\x00\x00\xd7\x1a\x00\x00\xe1\x1a\x00\x00\xeb\x1a"
+            "\x00\x00\xf3\x1a\x00\x00\xfe\x1a\x00\x00\x07\x1b\x00\x00\x10\x1b\x00\x00\x19\x1b\x00\x00\x23\x1b\x00\x00\x30\x1b\x00\x00\x3c\x1b"
+            "\x00\x00\x44\x1b\x00\x00\x4d\x1b\x00\x00\x55\x1b\x00\x00\x5e\x1b\x00\x00\x69\x1b\x00\x00\x72\x1b\x00\x00\x7b\x1b\x00\x00\x86\x1b"
+            "\x00\x00\x8e\x1b\x00\x00\x98\x1b\x00\x00\xa0\x1b\x00\x00\xa8\x1b\x00\x00\xb2\x1b\x00\x00\xbb\x1b\x00\x00\xc6\x1b\x00\x00\xd0\x1b"
+            "\x00\x00\xdc\x1b\x00\x00\xe8\x1b\x00\x00\xf0\x1b\x00\x00\xf9\x1b\x00\x00\x01\x1c\x00\x00\x08\x1c\x00\x00\x12\x1c\x00\x00\x1a\x1c"
+            "\x00\x00\x23\x1c\x00\x00\x2e\x1c\x00\x00\x37\x1c\x00\x00\x3d\x1c\x00\x00\x45\x1c\x00\x00\x50\x1c\x00\x00\x5b\x1c\x00\x00\x62\x1c"
+            "\x00\x00\x6b\x1c\x00\x00\x75\x1c\x00\x00\x7c\x1c\x00\x00\x85\x1c\x00\x00\x8d\x1c\x00\x00\x97\x1c\x00\x00\xa1\x1c\x00\x00\xa8\x1c"
+            "\x00\x00\xb2\x1c\x00\x00\xba\x1c\x00\x00\xc5\x1c\x00\x00\xd0\x1c\x00\x00\xda\x1c\x00\x00\xe4\x1c\x00\x00\xee\x1c\x00\x00\xf6\x1c"
+            "\x00\x00\xff\x1c\x00\x00\x07\x1d\x00\x00\x10\x1d\x00\x00\x18\x1d\x00\x00\x20\x1d\x00\x00\x2a\x1d\x00\x00\x34\x1d\x00\x00\x3c\x1d"
+            "\x00\x00\x46\x1d\x00\x00\x50\x1d\x00\x00\x59\x1d\x00\x00\x61\x1d\x00\x00\x6a\x1d\x00\x00\x75\x1d\x00\x00\x7f\x1d\x00\x00\x86\x1d"
+            "\x00\x00\x8d\x1d\x00\x00\x95\x1d\x00\x00\x9f\x1d\x00\x00\xa8\x1d\x00\x00\xb2\x1d\x00\x00\xb9\x1d\x00\x00\xc1\x1d\x00\x00\xc9\x1d"
+            "\x00\x00\xd1\x1d\x00\x00\xd8\x1d\x00\x00\xe0\x1d\x00\x00\xec\x1d\x00\x00\xf4\x1d\x00\x00\xfd\x1d\x00\x00\x05\x1e\x00\x00\x0f\x1e"
+            "\x00\x00\x19\x1e\x00\x00\x24\x1e\x00\x00\x2f\x1e\x00\x00\x38\x1e\x00\x00\x41\x1e\x00\x00\x49\x1e\x00\x00\x52\x1e\x00\x00\x5b\x1e"
+            "\x00\x00\x65\x1e\x00\x00\x6f\x1e\x00\x00\x7a\x1e\x00\x00\x85\x1e\x00\x00\x90\x1e\x00\x00\x99\x1e\x00\x00\xa3\x1e\x00\x00\xac\x1e"
+            "\x00\x00\xb6\x1e\x00\x00\xbc\x1e\x00\x00\xc4\x1e\x00\x00\xcf\x1e\x00\x00\xd9\x1e\x00\x00\xe4\x1e\x00\x00\xee\x1e\x00\x00\xf7\x1e"
+            "\x00\x00\x01\x1f\x00\x00\x0b\x1f\x00\x00\x15\x1f\x00\x00\x20\x1f\x00\x00\x2a\x1f\x00\x00\x34\x1f\x00\x00\x3e\x1f\x00\x00\x4a\x1f"
+            "\x00\x00\x54\x1f\x00\x00\x5e\x1f\x00\x00\x68\x1f\x00\x00\x71\x1f\x00\x00\x7b\x1f\x00\x00\x86\x1f\x00\x00\x8f\x1f\x00\x00\x99\x1f"
+            "\x00\x00\xa4\x1f\x00\x00\xaf\x1f\x00\x00\xb9\x1f\x00\x00\xc3\x1f\x00\x00\xcd\x1f\x00\x00\xd7\x1f\x00\x00\xe1\x1f\x00\x00\xec\x1f"
+            "\x00\x00\xf7\x1f\x00\x00\x01\x20\x00\x00\x0b\x20\x00\x00\x16\x20\x00\x00\x1e\x20\x00\x00\x29\x20\x00\x00\x34\x20\x00\x00\x3e\x20"
+            "\x00\x00\x48\x20\x00\x00\x53\x20\x00\x00\x5e\x20\x00\x00\x69\x20\x00\x00\x72\x20\x00\x00\x7c\x20\x00\x00\x84\x20\x00\x00\x8f\x20"
+            "\x00\x00\x99\x20\x00\x00\xa4\x20\x00\x00\xae\x20\x00\x00\xbb\x20\x00\x00\xc5\x20\x00\x00\xcd\x20\x00\x00\xd3\x20\x00\x00\xdb\x20"
+            "\x00\x00\xe6\x20\x00\x00\xf0\x20\x00\x00\xfa\x20\x00\x00\x06\x21\x00\x00\x11\x21\x00\x00\x1a\x21\x00\x00\x21\x21\x00\x00\x29\x21"
+            "\x00\x00\x33\x21\x00\x00\x3f\x21\x00\x00\x49\x21\x00\x00\x51\x21\x00\x00\x5c\x21\x00\x00\x66\x21\x00\x00\x6e\x21\x00\x00\x75\x21"
+            "\x00\x00\x7e\x21\x00\x00\x89\x21\x00\x00\x94\x21\x00\x00\x9b\x21\x00\x00\xa3\x21\x00\x00\xaa\x21\x00\x00\xb2\x21\x00\x00\xbb\x21"
+            "\x00\x00\xc4\x21\x00\x00\xcc\x21\x00\x00\xd4\x21\x00\x00\xd8\x21\x00\x00\xdd\x21\x00\x00\xe7\x21\x00\x00\xf0\x21\x00\x00\xfb\x21"
+            "\x00\x00\x06\x22\x00\x00\x0d\x22\x00\x00\x15\x22\x00\x00\x1f\x22\x00\x00\x2b\x22\x00\x00\x35\x22\x00\x00\x40\x22\x00\x00\x4a\x22"
+            "\x00\x00\x55\x22\x00\x00\x5f\x22\x00\x00\x6a\x22\x00\x00\x72\x22\x00\x00\x7d\x22\x00\x00\x87\x22\x00\x00\x8f\x22\x00\x00\x9a\x22"
+            "\x00\x00\xa5\x22\x00\x00\xb0\x22\x00\x00\xba\x22\x00\x00\xc5\x22\x00\x00\xce\x22\x00\x00\xd8\x22\x00\x00\xdf\x22\x00\x00\xe9\x22"
+            "\x00\x00\xf4\x22\x00\x00\xfe\x22\x00\x00\x09\x23\x00\x00\x14\x23\x00\x00\x1c\x23\x00\x00\x24\x23\x00\x00\x2b\x23\x00\x00\x36\x23"
+            "\x00\x00\x40\x23\x00\x00\x46\x23\x00\x00\x50\x23\x00\x00\x5a\x23\x00\x00\x63\x23\x00\x00\x6b\x23\x00\x00\x74\x23\x00\x00\x7d\x23"
+            "\x00\x00\x84\x23\x00\x00\x91\x23\x00\x00\x98\x23\x00\x00\x9f\x23\x00\x00\xa8\x23\x00\x00\xb1\x23\x00\x00\xba\x23\x00\x00\xc6\x23"
+            "\x00\x00\xd3\x23\x00\x00\xdb\x23\x00\x00\xe3\x23\x00\x00\xec\x23\x00\x00\xf6\x23\x00\x00\x01\x24\x00\x00\x0b\x24\x00\x00\x14\x24"
+            "\x00\x00\x20\x24\x00\x00\x2b\x24\x00\x00\x36\x24\x00\x00\x41\x24\x00\x00\x4e\x24\x00\x00\x5a\x24\x00\x00\x65\x24\x00\x00\x71\x24"
+            "\x00\x00\x7c\x24\x00\x00\x86\x24\x00\x00\x8e\x24\x00\x00\x96\x24\x00\x00\xa2\x24\x00\x00\xab\x24\x00\x00\xb9\x24\x00\x00\xc4\x24"
+            "\x00\x00\xce\x24\x00\x00\xd8\x24\x00\x00\xe2\x24\x00\x00\xec\x24\x00\x00\xf6\x24\x00\x00\xfe\x24\x00\x00\x07\x25\x00\x00\x10\x25"
+            "\x00\x00\x1a\x25\x00\x00\x26\x25\x00\x00\x2f\x25\x00\x00\x3a\x25\x00\x00\x43\x25\x00\x00\x4e\x25\x00\x00\x57\x25\x00\x00\x61\x25"
+            "\x00\x00\x6c\x25\x00\x00\x75\x25\x00\x00\x7e\x25\x00\x00\x86\x25\x00\x00\x91\x25\x00\x00\x9b\x25\x00\x00\xa3\x25\x00\x00\xac\x25"
+            "\x00\x00\xb5\x25\x00\x00\xc1\x25\x00\x00\xc9\x25\x00\x00\xd2\x25\x00\x00\xdc\x25\x00\x00\xe6\x25\x00\x00\xf1\x25\x00\x00\xfc\x25"
+            "\x00\x00\x08\x26\x00\x00\x15\x26\x00\x00\x20\x26\x00\x00\x2d\x26\x00\x00\x37\x26\x00\x00\x42\x26\x00\x00\x4e\x26\x00\x00\x58\x26"
+            "\x00\x00\x60\x26\x00\x00\x68\x26\x00\x00\x70\x26\x00\x00\x78\x26\x00\x00\x7e\x26\x00\x00\x88\x26\x00\x00\x92\x26\x00\x00\x9c\x26"
+            "\x00\x00\xa6\x26\x00\x00\xaf\x26\x00\x00\xb8\x26\x00\x00\xc4\x26\x00\x00\xcc\x26\x00\x00\xd6\x26\x00\x00\xdf\x26\x00\x00\xe9\x26"
+            "\x00\x00\xf3\x26\x00\x00\xfc\x26\x00\x00\x07\x27\x00\x00\x10\x27\x00\x00\x1a\x27\x00\x00\x25\x27\x00\x00\x2d\x27\x00\x00\x38\x27"
+            "\x00\x00\x45\x27\x00\x00\x4f\x27\x00\x00\x58\x27\x00\x00\x63\x27\x00\x00\x6b\x27\x00\x00\x74\x27\x00\x00\x81\x27\x00\x00\x8d\x27"
+            "\x00\x00\x9b\x27\x00\x00\xa4\x27\x00\x00\xae\x27\x00\x00\xb5\x27\x00\x00\xc0\x27\x00\x00\xc9\x27\x00\x00\xd5\x27\x00\x00\xdd\x27"
+            "\x00\x00\xe7\x27\x00\x00\xee\x27\x00\x00\xf9\x27\x00\x00\x04\x28\x00\x00\x0d\x28\x00\x00\x16\x28\x00\x00\x1e\x28\x00\x00\x27\x28"
+            "\x00\x00\x33\x28\x00\x00\x3d\x28\x00\x00\x48\x28\x00\x00\x51\x28\x00\x00\x5b\x28\x00\x00\x64\x28\x00\x00\x71\x28\x00\x00\x7d\x28"
+            "\x00\x00\x84\x28\x00\x00\x8f\x28\x00\x00\x98\x28\x00\x00\xa0\x28\x00\x00\xa8\x28\x00\x00\xb3\x28\x00\x00\xbb\x28\x00\x00\xc7\x28"
+            "\x00\x00\xd0\x28\x00\x00\xdb\x28\x00\x00\xe8\x28\x00\x00\xf0\x28\x00\x00\xfa\x28\x00\x00\x03\x29\x00\x00\x0d\x29\x00\x00\x16\x29"
+            "\x00\x00\x20\x29\x00\x00\x27\x29\x00\x00\x30\x29\x00\x00\x39\x29\x00\x00\x40\x29\x00\x00\x49\x29\x00\x00\x52\x29\x00\x00\x5d\x29"
+            "\x00\x00\x69\x29\x00\x00\x75\x29\x00\x00\x7e\x29\x00\x00\x8a\x29\x00\x00\x93\x29\x00\x00\x9c\x29\x00\x00\xa6\x29\x00\x00\xae\x29"
+            "\x00\x00\xb9\x29\x00\x00\xc1\x29\x00\x00\xce\x29\x00\x00\xd6\x29\x00\x00\x42\x75\x6c\x62\x69\x7a\x61\x72\x72\x65\x00\x48\x65\x72"
+            "\x0b\x00\x43\x46\x6c\x6f\x72\x0b\x00\xf1\x18\x53\x61\x6c\x61\x6d\xc3\xa8\x63\x68\x65\x00\x52\x65\x70\x74\x69\x6e\x63\x65\x6c\x00"
+            "\x44\x72\x61\x63\x61\x75\x66\x65\x75\x00\x43\x61\x72\x61\x70\x75\x63\x65\x09\x00\xf2\x42\x62\x61\x66\x66\x65\x00\x54\x6f\x72\x74"
+            "\x61\x6e\x6b\x00\x43\x68\x65\x6e\x69\x70\x61\x6e\x00\x43\x68\x72\x79\x73\x61\x63\x69\x65\x72\x00\x50\x61\x70\x69\x6c\x75\x73\x69"
+            "\x6f\x6e\x00\x41\x73\x70\x69\x63\x6f\x74\x00\x43\x6f\x63\x6f\x6e\x66\x6f\x72\x74\x00\x44\x61\x72\x64\x61\x72\x67\x6e\x61\x6e\x00"
+            "\x52\x6f\x75\x63\x6f\x6f\x6c\x08\x00\x31\x75\x70\x73\x09\x00\xe4\x61\x72\x6e\x61\x67\x65\x00\x52\x61\x74\x74\x61\x74\x61\x08\x00"
+            "\xf0\x1c\x63\x00\x50\x69\x61\x66\x61\x62\x65\x63\x00\x52\x61\x70\x61\x73\x64\x65\x70\x69\x63\x00\x41\x62\x6f\x00\x41\x72\x62\x6f"
+            "\x6b\x00\x50\x69\x6b\x61\x63\x68\x75\x00\x52\x61\x69\x07\x00\x80\x53\x61\x62\x65\x6c\x65\x74\x74\xda\x00\xf2\x04\x62\x6c\x61\x69"
+            "\x72\x65\x61\x75\x00\x4e\x69\x64\x6f\x72\x61\x6e\xe2\x99\x80\x0b\x00\x31\x69\x6e\x61\x09\x00\x56\x71\x75\x65\x65\x6e\x1e\x00\x14"
+            "\x82\x1e\x00\x11\x6f\x09\x00\xe2\x6b\x69\x6e\x67\x00\x4d\xc3\xa9\x6c\x6f\x66\xc3\xa9\x65\x0a\x00\xf3\x13\x64\x65\x6c\x66\x65\x00"
+            "\x47\x6f\x75\x70\x69\x78\x00\x46\x65\x75\x6e\x61\x72\x64\x00\x52\x6f\x6e\x64\x6f\x75\x64\x6f\x75\x00\x47\x72\x6f\x0a\x00\xa4\x4e"
+            "\x6f\x73\x66\x65\x72\x61\x70\x74\x69\x0b\x00\xf0\x04\x6c\x74\x6f\x00\x4d\x79\x73\x74\x68\x65\x72\x62\x65\x00\x4f\x72\x74\x69\x64"
+            "\xed\x00\xd2\x66\x66\x6c\x65\x73\x69\x61\x00\x50\x61\x72\x61\x73\x06\x00\xf0\x1a\x65\x63\x74\x00\x4d\x69\x6d\x69\x74\x6f\x73\x73"
+            "\x00\x41\xc3\xa9\x72\x6f\x6d\x69\x74\x65\x00\x54\x61\x75\x70\x69\x71\x75\x65\x75\x72\x00\x54\x72\x69\x6f\x70\x69\x6b\x0b\x00\xf0"
+            "\x0c\x4d\x69\x61\x6f\x75\x73\x73\x00\x50\x65\x72\x73\x69\x61\x6e\x00\x50\x73\x79\x6b\x6f\x6b\x77\x61\x6b\x00\x41\x06\x00\x00\x09"
+            "\x00\x10\x46\x43\x00\xb3\x73\x69\x6e\x67\x65\x00\x43\x6f\x6c\x6f\x73\x0b\x00\xa0\x61\x6e\x69\x6e\x6f\x73\x00\x41\x72\x63\x0a\x00"
+            "\x50\x00\x50\x74\x69\x74\xce\x00\x61\x54\xc3\xaa\x74\x61\x72\x70\x00\x11\x72\x11\x00\x90\x41\x62\x72\x61\x00\x4b\x61\x64\x61\x08"
+            "\x00\xf2\x00\x41\x6c\x61\x6b\x61\x7a\x61\x6d\x00\x4d\x61\x63\x68\x6f\x63\x07\x00\x11\x70\x89\x00\x60\x61\x63\x6b\x6f\x67\x6e\x0b"
+            "\x00\xf3\x00\x43\x68\xc3\xa9\x74\x69\x66\x6c\x6f\x72\x00\x42\x6f\x75\x73\x0b\x00\x32\x45\x6d\x70\x09\x00\x51\x54\x65\x6e\x74\x61"
+            "\x00\x02\x02\x0a\x00\xc1\x72\x75\x65\x6c\x00\x52\x61\x63\x61\x69\x6c\x6c\x45\x01\x80\x61\x76\x61\x6c\x61\x6e\x63\x68\x50\x01\xf0"
+            "\x01\x6c\x65\x6d\x00\x50\x6f\x6e\x79\x74\x61\x00\x47\x61\x6c\x6f\x70\x19\x02\x11\x6d\xc6\x00\x70\x00\x46\x6c\x61\x67\x61\x64\x0a"
+            "\x00\x40\x4d\x61\x67\x6e\x73\x00\x04\x09\x00\x20\x6f\x6e\xdf\x00\xc1\x61\x72\x74\x69\x63\x68\x6f\x00\x44\x6f\x64\x75\x06\x00\xf0"
+            "\x04\x72\x69\x6f\x00\x4f\x74\x61\x72\x69\x61\x00\x4c\x61\x6d\x61\x6e\x74\x69\x6e\xe7\x00\x50\x64\x6d\x6f\x72\x76\x6c\x00\x13\x74"
+            "\x0b\x00\xf2\x41\x4b\x6f\x6b\x69\x79\x61\x73\x00\x43\x72\x75\x73\x74\x61\x62\x72\x69\x00\x46\x61\x6e\x74\x6f\x6d\x69\x6e\x75\x73"
+            "\x00\x53\x70\x65\x63\x74\x72\x75\x6d\x00\x45\x63\x74\x6f\x70\x6c\x61\x73\x6d\x61\x00\x4f\x6e\x69\x78\x00\x53\x6f\x70\x6f\x72\x69"
+            "\x66\x69\x6b\x00\x48\x79\x70\x6e\x6f\x6d\x61\x64\x65\x00\x4b\x72\x61\x62\x62\x79\x07\x00\x00\xa9\x00\x50\x56\x6f\x6c\x74\x6f\x00"
+            "\x02\x30\xc3\x89\x6c\x47\x00\xf0\x10\x6f\x64\x65\x00\x4e\x6f\x65\x75\x6e\x6f\x65\x75\x66\x00\x4e\x6f\x61\x64\x6b\x6f\x6b\x6f\x00"
+            "\x4f\x73\x73\x65\x6c\x61\x69\x74\x09\x00\x21\x61\x74\xf3\x01\xf2\x10\x4b\x69\x63\x6b\x6c\x65\x65\x00\x54\x79\x67\x6e\x6f\x6e\x00"
+            "\x45\x78\x63\x65\x6c\x61\x6e\x67\x75\x65\x00\x53\x6d\x6f\x67\x6f\x06\x00\xd2\x67\x6f\x00\x52\x68\x69\x6e\x6f\x63\x6f\x72\x6e\x65"
+            "\x0b\x00\x11\x66\xfd\x01\x61\x00\x4c\x65\x76\x65\x69\xae\x02\xf0\x05\x53\x61\x71\x75\x65\x64\x65\x6e\x65\x75\x00\x4b\x61\x6e\x67"
+            "\x6f\x75\x72\x65\x78\xb2\x00\x71\x6f\x74\x72\x65\x6d\x70\x65\x0b\x00\x30\x63\xc3\xa9\x4b\x02\xa2\x6f\x69\x73\x73\x69\x72\xc3\xa8"
+            "\x6e\x65\x0c\x00\x60\x6f\x72\x6f\x79\x00\x53\x41\x01\x01\x06\x00\x01\x7a\x01\xf0\x00\x2e\x20\x4d\x69\x6d\x65\x00\x49\x6e\x73\xc3"
+            "\xa9\x63\x61\x74\xab\x00\x91\x4c\x69\x70\x70\x6f\x75\x74\x6f\x75\xe6\x00\x40\x6b\x74\x65\x6b\x98\x01\x60\x6d\x61\x72\x00\x53\x63"
+            "\x47\x04\x22\x72\x75\xce\x02\x00\x98\x00\xf0\x0b\x4d\x61\x67\x69\x63\x61\x72\x70\x65\x00\x4c\xc3\xa9\x76\x69\x61\x74\x6f\x72\x00"
+            "\x4c\x6f\x6b\x68\x6c\x61\x5d\x00\xf1\x08\xc3\xa9\x74\x61\x6d\x6f\x72\x70\x68\x00\xc3\x89\x76\x6f\x6c\x69\x00\x41\x71\x75\x61\x6c"
+            "\x69\x47\x01\x00\x08\x00\x30\x50\x79\x72\x16\x00\x50\x50\x6f\x72\x79\x67\x74\x04\x62\x6d\x6f\x6e\x69\x74\x61\x08\x00\xb3\x73\x74"
+            "\x61\x72\x00\x4b\x61\x62\x75\x74\x6f\x07\x00\x90\x70\x73\x00\x50\x74\xc3\xa9\x72\x61\xb2\x03\xe3\x66\x6c\x65\x78\x00\x41\x72\x74"
+            "\x69\x6b\x6f\x64\x69\x6e\x90\x01\xf1\x06\x68\x6f\x72\x00\x53\x75\x6c\x66\x75\x72\x61\x00\x4d\x69\x6e\x69\x64\x72\x61\x63\x6f\x0f"
+            "\x05\x03\x06\x00\x00\x78\x02\x80\x65\x00\x4d\x65\x77\x74\x77\x6f\x07\x00\x61\x00\x47\x65\x72\x6d\x69\x92\x01\x90\x4d\x61\x63\x72"
+            "\x6f\x6e\x69\x75\x6d\xb7\x00\x21\x67\x61\x0a\x00\x90\x48\xc3\xa9\x72\x69\x63\x65\x6e\x64\x75\x05\x30\x65\x75\x72\x44\x01\x81\x6e"
+            "\x00\x54\x79\x70\x68\x6c\x6f\x26\x05\x32\x4b\x61\x69\x56\x02\xe3\x43\x72\x6f\x63\x72\x6f\x64\x69\x6c\x00\x41\x6c\x69\x67\xf4\x01"
+            "\x51\x46\x6f\x75\x69\x6e\xcd\x04\x01\x0a\x00\xb0\x61\x72\x00\x48\x6f\x6f\x74\x68\x6f\x6f\x74\x2b\x02\xa1\x72\x66\x61\x6e\x67\x00"
+            "\x43\x6f\x78\x79\x05\x00\x20\x63\x6c\xd9\x01\x01\x39\x04\x50\x67\x61\x6c\x00\x4d\x06\x00\x20\x6f\x73\x7e\x04\x50\x74\x65\x6e\x66"
+            "\x65\x57\x01\xe1\x75\x70\x69\x6f\x00\x4c\x61\x6e\x74\x75\x72\x6e\x00\x50\x30\x05\x01\xd6\x04\x21\x00\x54\xb5\x04\x00\xb8\x04\x61"
+            "\x54\x6f\x67\x65\x70\x69\x07\x00\xa0\x74\x69\x63\x00\x4e\x61\x74\x75\x00\x58\x05\x00\xf2\x0f\x57\x61\x74\x74\x6f\x75\x61\x74\x00"
+            "\x4c\x61\x69\x6e\x65\x72\x67\x69\x65\x00\x50\x68\x61\x72\x61\x6d\x70\x00\x4a\x6f\x6c\xd9\x03\xb2\x4d\x61\x72\x69\x6c\x6c\x00\x41"
+            "\x7a\x75\x6d\x0a\x00\x91\x53\x69\x6d\x75\x6c\x61\x72\x62\x72\x4e\x04\x40\x70\x61\x75\x64\xde\x03\x51\x6e\x69\x76\x6f\x6c\x85\x06"
+            "\x10\x61\x09\x00\x41\x43\x6f\x74\x6f\x08\x00\x70\x61\x70\x75\x6d\x61\x69\x6e\x8e\x00\x70\x72\x6e\x65\x67\x72\x69\x6e\x41\x01\xf0"
+            "\x05\x6c\x69\x61\x74\x72\x6f\x6e\x63\x00\x59\x61\x6e\x6d\x61\x00\x41\x78\x6f\x6c\x6f\x4b\x05\x60\x61\x72\x61\x69\x73\x74\x8d\x01"
+            "\x11\x6e\x0c\x02\x31\x4e\x6f\x63\x08\x00\x60\x43\x6f\x72\x6e\xc3\xa8\x73\x00\x70\x52\x6f\x69\x67\x61\x64\x61\x7a\x01\xf0\x02\x66"
+            "\x6f\x72\xc3\xaa\x76\x65\x00\x5a\x61\x72\x62\x69\x00\x51\x75\x6c\x10\x02\xf0\x02\x6b\xc3\xa9\x00\x47\x69\x72\x61\x66\x61\x72\x69"
+            "\x67\x00\x50\x6f\x6d\x5c\x06\xb0\x6b\x00\x46\x6f\x72\x65\x74\x72\x65\x73\x73\xd5\x02\xf0\x08\x6f\x6c\x6f\x75\x72\x64\x6f\x00\x53"
+            "\x63\x6f\x72\x70\x6c\x61\x6e\x65\x00\x53\x74\x65\x65\x6c\xef\x03\x71\x6e\x75\x62\x62\x75\x6c\x6c\xd2\x00\x01\x09\x00\xf1\x01\x51"
+            "\x77\x69\x6c\x66\x69\x73\x68\x00\x43\x69\x7a\x61\x79\x6f\x78\x35\x07\x41\x74\x72\x6f\x63\xf8\x02\x00\x8d\x03\xf0\x0a\x00\x46\x61"
+            "\x72\x66\x75\x72\x65\x74\x00\x54\x65\x64\x64\x69\x75\x72\x73\x61\x00\x55\x72\x73\x61\x72\x6b\x06\x30\x4c\x69\x6d\x26\x03\x00\xdd"
+            "\x02\x70\x63\x61\x72\x6f\x70\x6f\x64\xe5\x00\x30\x63\x61\x63\x09\x01\x42\x43\x6f\x63\x68\x68\x02\xf0\x18\x43\x6f\x72\x61\x79\x6f"
+            "\x6e\x00\x52\xc3\xa9\x6d\x6f\x72\x61\x69\x64\x00\x4f\x63\x74\x69\x6c\x6c\x65\x72\x79\x00\x43\x61\x64\x6f\x69\x7a\x6f\x00\x44\xc3"
+            "\xa9\xdf\x04\xb0\x61\x00\x41\x69\x72\x6d\x75\x72\x65\x00\x4d\x0c\x02\x21\x73\x65\x19\x00\x03\xc5\x02\x00\xe8\x03\x30\x72\x6f\x69"
+            "\xc6\x01\x91\x6e\x70\x79\x00\x44\x6f\x6e\x70\x68\xf5\x03\x01\x4c\x03\x70\x32\x00\x43\x65\x72\x66\x72\x5b\x06\x60\x65\x00\x51\x75"
+            "\x65\x75\x33\x08\xf4\x04\x6f\x72\x00\x44\x65\x62\x75\x67\x61\x6e\x74\x00\x4b\x61\x70\x6f\x65\x72\x61\xed\x03\x12\x69\xec\x03\x10"
+            "\x69\xb4\x00\xf0\x08\x67\x62\x79\x00\xc3\x89\x63\x72\xc3\xa9\x6d\x65\x75\x68\x00\x4c\x65\x75\x70\x68\x6f\x72\x69\xee\x06\xf0\x09"
+            "\x69\x6b\x6f\x75\x00\x45\x6e\x74\x65\x69\x00\x53\x75\x69\x63\x75\x6e\x65\x00\x45\x6d\x62\x72\x79\x8d\x03\x40\x59\x6d\x70\x68\xfb"
+            "\x06\xf0\x0d\x54\x79\x72\x61\x6e\x6f\x63\x69\x66\x00\x4c\x75\x67\x69\x61\x00\x48\x6f\x2d\x4f\x68\x00\x43\x65\x6c\x65\x62\x69\xae"
+            "\x06\x10\x6b\xfd\x01\xd0\x73\x73\x6b\x6f\x00\x4a\x75\x6e\x67\x6b\x6f\x00\x50\xa6\x00\x10\x69\xaf\x08\x31\x47\x61\x6c\x08\x00\x40"
+            "\x42\x72\x61\x73\x85\x03\x80\x6c\x69\x00\x47\x6f\x62\x6f\x75\x6d\x02\x11\x62\xfc\x02\x30\x67\x67\x72\xac\x03\x80\x65\x64\x68\x79"
+            "\xc3\xa8\x6e\x61\xbd\x01\x03\x0a\x00\x50\x5a\x69\x67\x7a\x61\x3a\x06\x50\x4c\x69\x6e\xc3\xa9\x69\x01\x01\xe1\x08\x10\x6f\x7f\x03"
+            "\xd0\x41\x72\x6d\x75\x6c\x79\x73\x00\x43\x68\x61\x72\x6d\xa6\x06\x80\x6e\x00\x42\x6c\x69\x6e\x64\x61\x15\x00\x00\xf5\x08\x80\x6e"
+            "\x6f\x78\x00\x4e\xc3\xa9\x6e\x62\x03\x50\x74\x00\x4c\x6f\x6d\x80\x02\x40\x4c\x75\x64\x69\x33\x04\x00\x65\x00\x31\x69\x6e\x69\x1b"
+            "\x00\x10\x50\xa0\x00\x11\x69\xfa\x06\x00\x9f\x00\xd1\x63\x65\x00\x4e\x69\x72\x6f\x6e\x64\x65\x6c\x6c\x65\xee\x02\x22\xc3\xa9\x0c"
+            "\x00\x20\x47\x6f\xfb\x02\x61\x73\x65\x00\x42\x65\x6b\x67\x09\xc0\x54\x61\x72\x73\x61\x6c\x00\x4b\x69\x72\x6c\x69\x0c\x07\xd1\x72"
+            "\x64\x65\x76\x6f\x69\x72\x00\x41\x72\x61\x6b\x64\x13\x01\x93\x6b\x61\x64\x72\x61\x00\x42\x61\x6c\x29\x02\x32\x68\x61\x70\x0a\x00"
+            "\x41\x50\x61\x72\x65\x70\x07\xf0\x08\x56\x69\x67\x6f\x72\x6f\x74\x68\x00\x4d\x6f\x6e\x61\x66\x6c\xc3\xa8\x6d\x69\x74\x00\x4e\x69"
+            "\x8b\x00\x00\x89\x00\xf0\x05\x6e\x6a\x61\x73\x6b\x00\x4d\x75\x6e\x6a\x61\x00\x43\x68\x75\x63\x68\x6d\x75\x72\x6f\x07\xc1\x62\x6f"
+            "\x75\x6d\x00\x42\x72\x6f\x75\x68\x61\x62\xfb\x07\x30\x6b\x75\x68\x68\x05\x60\x48\x61\x72\x69\x79\x61\x95\x03\x21\x7a\x75\xf0\x03"
+            "\x10\x54\xca\x02\x00\x44\x05\xb0\x6b\x69\x74\x74\x79\x00\x44\x65\x6c\x63\x61\x09\x00\x90\x54\xc3\xa9\x6e\xc3\xa9\x66\x69\x78\x02"
+            "\x09\x40\x64\x69\x62\x75\xe1\x00\x12\x61\x30\x02\x00\x08\x00\x00\xbd\x05\x02\x10\x00\x02\x73\x09\x60\x64\x69\x74\x69\x6b\x6b\x85"
+            "\x00\x00\x70\x01\x60\x6e\x61\x00\x44\x79\x6e\x2c\x04\x12\x74\xa8\x05\xd0\x73\x70\x72\x69\x6e\x74\x00\x50\x6f\x73\x69\x70\x69\x78"
+            "\x01\xb0\x67\x61\x70\x69\x00\x4d\x75\x63\x69\x6f\x6c\x77\x01\x10\x6d\x61\x04\x00\x00\x04\x11\x73\x3f\x04\x50\x00\x47\x6c\x6f\x75"
+            "\x8a\x09\x20\x41\x76\x86\x09\x20\x75\x74\x99\x03\x80\x76\x61\x6e\x68\x61\x00\x53\x68\x7c\x06\xa1\x64\x6f\x00\x57\x61\x69\x6c\x6d"
+            "\x65\x72\x08\x00\x30\x6f\x72\x64\x7a\x00\x40\x6d\x61\x6c\x6c\xc1\x0a\x81\x61\x6d\xc3\xa9\x72\x75\x70\x74\x8e\x00\x00\xa0\x06\x60"
+            "\x53\x70\x6f\x69\x6e\x6b\x31\x08\x00\xca\x03\x20\x53\x70\x09\x02\x00\xe3\x07\x90\x6b\x6e\x6f\x69\x78\x00\x56\x69\x62\xe3\x04\x80"
+            "\x6e\x66\x00\x4c\x69\x62\xc3\xa9\xdb\x00\x60\x43\x61\x63\x6e\x65\x61\x07\x00\x00\x7a\x05\x00\xc4\x07\x10\x6c\x69\x02\x22\x41\x6c"
+            "\x8c\x08\xa0\x4d\x61\x6e\x67\x72\x69\x66\x66\x00\x53\x03\x07\x30\x70\x65\x72\x09\x00\x10\x6c\xb8\x07\x60\x63\x00\x53\x6f\x6c\x61"
+            "\x08\x00\x50\x42\x61\x72\x6c\x6f\xa6\x0b\x10\x42\xc2\x04\x31\x63\x68\x61\x62\x03\x00\x7a\x02\x00\x9d\x0b\x50\x6f\x6c\x68\x6f\x6d"
+            "\xdd\x07\x21\x42\x61\xda\x04\x30\x00\x4b\x61\xc8\x0a\x40\x65\x00\x4c\x69\x00\x01\x40\x56\x61\x63\x69\xaa\x02\x70\x41\x6e\x6f\x72"
+            "\x69\x74\x68\xcf\x02\x40\x61\x6c\x64\x6f\x4c\x00\xf0\x01\x70\x61\x75\x00\x4d\x69\x6c\x6f\x62\x65\x6c\x6c\x75\x73\x00\x4d\x6d\x07"
+            "\x90\xc3\xa9\x6f\x00\x4b\x65\x63\x6c\x65\x3b\x02\x20\x6f\x6c\x44\x09\x30\x6d\x62\x72\x55\x03\x02\x8d\x06\x60\x53\x6b\x65\x6c\xc3"
+            "\xa9\xf3\x02\x10\x54\x4e\x07\xf0\x01\x63\x6c\x6f\x70\x65\x00\x54\x72\x6f\x70\x69\x75\x73\x00\xc3\x89\xc1\x08\xa1\x41\x62\x73\x6f"
+            "\x6c\x00\x4f\x6b\xc3\xa9\x66\x05\x90\x53\x74\x61\x6c\x67\x61\x6d\x69\x6e\x2a\x09\x20\x67\x6c\x98\x03\x41\x4f\x62\x61\x6c\x44\x06"
+            "\x31\x6f\x67\x6c\xe0\x08\x60\x61\x69\x6d\x6f\x72\x73\xcd\x00\x20\x71\x75\x05\x01\x60\x6c\x00\x53\x65\x72\x70\xe3\x06\xf0\x0b\x52"
+            "\x6f\x73\x61\x62\x79\x73\x73\x00\x52\x65\x6c\x69\x63\x61\x6e\x74\x68\x00\x4c\x6f\x76\x64\x69\x73\x63\x95\x07\x21\x62\x79\x9b\x07"
+            "\x50\x6b\x68\x61\x75\x73\x0a\x00\x90\x74\x74\x61\x6b\x00\x54\x65\x72\x68\x05\x07\x00\x41\x08\x02\x53\x02\x13\x74\x02\x05\x81\x52"
+            "\x65\x67\x69\x72\x6f\x63\x6b\x09\x00\x12\x63\x10\x00\x10\x73\xd3\x05\x71\x00\x4c\x61\x74\x69\x61\x73\x07\x00\x90\x6f\x73\x00\x4b"
+            "\x79\x6f\x67\x72\x65\xe5\x01\x20\x75\x64\x6e\x05\xf1\x07\x61\x79\x71\x75\x61\x7a\x61\x00\x4a\x69\x72\x61\x63\x68\x69\x00\x44\x65"
+            "\x6f\x78\x79\x73\x0e\x0d\x21\x69\x70\x82\x0b\x71\x42\x6f\x73\x6b\x61\x72\x61\x13\x00\xf0\x06\x65\x72\x72\x61\x00\x4f\x75\x69\x73"
+            "\x74\x69\x63\x72\x61\x6d\x00\x43\x68\x69\x6d\x70\x87\x07\x10\x75\x14\x07\x10\x69\x4b\x0b\xe3\x7a\x00\x54\x69\x70\x6c\x6f\x75\x66"
+            "\x00\x50\x72\x69\x6e\x0a\x00\x51\x69\x6e\x67\x6f\x6c\x7e\x04\x70\xc3\x89\x74\x6f\x75\x72\x6d\x58\x05\x00\x09\x00\x00\x21\x07\x02"
+            "\x0a\x00\x20\x61\x70\x84\x02\x10\x4b\x34\x0a\x00\x09\x00\xf2\x01\x43\x61\x73\x74\x6f\x72\x6e\x6f\x00\x43\x72\x69\x6b\x7a\x69\x6b"
+            "\xd2\x07\xd0\x6b\x72\x69\x6b\x00\x4c\x69\x78\x79\x00\x4c\x75\x78\xf9\x04\xa0\x75\x78\x72\x61\x79\x00\x52\x6f\x7a\x62\x9a\x09\x00"
+            "\x82\x0d\x33\x73\x65\x72\xa2\x0a\x42\x6e\x69\x64\x6f\xdc\x04\x50\x6b\x6f\x73\x00\x44\x40\x0a\x10\x6c\xce\x0d\x60\x42\x61\x73\x74"
+            "\x69\x6f\xfe\x00\x01\x0b\x05\x22\x74\x69\x08\x00\x11\x73\xa0\x04\x01\xeb\x0d\x00\x2a\x03\x80\x41\x70\x69\x74\x72\x69\x6e\x69\x09"
+            "\x00\x20\x72\x65\x75\x02\x10\x50\x21\x01\xe1\x72\x69\x73\x75\x00\x4d\x75\x73\x74\xc3\xa9\x62\x6f\x75\x41\x0d\x01\x0d\x00\x50\x66"
+            "\x6c\x6f\x74\x74\x5d\x06\x10\x69\x98\x05\x00\x08\x00\x01\x3b\x08\x70\x53\x61\x6e\x63\x6f\x6b\x69\xda\x0c\x31\x74\x6f\x73\xd8\x00"
+            "\x70\x70\x69\x64\x65\x78\x74\x72\xf3\x02\x51\x75\x64\x72\x69\x76\x8d\x01\x02\x09\x00\x60\x4c\x61\x70\x6f\x72\x65\xf5\x06\x70\x00"
+            "\x4c\x6f\x63\x6b\x70\x69\x7f\x09\x22\x67\x69\xe4\x07\x31\x43\x6f\x72\x6c\x0b\x51\x43\x68\x61\x67\x6c\x7c\x01\xa0\x61\x66\x66\x72"
+            "\x65\x75\x78\x00\x4b\x6f\xa6\x04\x00\x00\x06\x51\x6f\x75\x66\x6f\x75\xcd\x02\x00\x0b\x00\x10\x66\x29\x0e\x00\x5b\x06\x00\xfb\x02"
+            "\x30\x6d\x69\x72\xf1\x05\x01\x0c\x00\x20\x64\x6f\x3d\x02\x60\x61\x6e\x7a\x61\xc3\xaf\x5a\x09\x50\x65\x20\x4a\x72\x2e\x2a\x0d\xb0"
+            "\x72\x61\x76\x69\x00\x50\x69\x6a\x61\x6b\x6f\x01\x04\x00\xb5\x00\x81\x6d\x62\x00\x47\x72\x69\x6b\x6e\x33\x04\x30\x72\x6d\x61\xad"
+            "\x03\x50\x43\x61\x72\x63\x68\x18\x0a\x70\x6b\x00\x47\x6f\x69\x6e\x66\x6b\x0b\x70\x52\x69\x6f\x6c\x75\x00\x4c\xf0\x0e\x40\x69\x6f"
+            "\x00\x48\x3f\x07\x52\x70\x6f\x74\x61\x73\x0b\x00\x50\x64\x6f\x63\x75\x73\xea\x0e\x00\x1e\x0a\xe1\x44\x72\x61\x73\x63\x6f\x72\x65"
+            "\x00\x43\x72\x61\x64\x6f\x3f\x09\x80\x43\x6f\x61\x74\x6f\x78\x00\x56\x64\x02\x20\x6e\x74\x48\x0c\x11\x63\x0e\x08\x00\xf5\x04\x02"
+            "\xb7\x06\x42\x42\x61\x62\x69\xfd\x07\x62\x42\x6c\x69\x7a\x7a\x69\x07\x00\x10\x61\xeb\x07\x10\x44\x63\x03\x23\x65\x74\x26\x0d\x30"
+            "\x7a\x6f\x6e\x2d\x01\x23\x75\x64\x48\x0c\x00\x2f\x0c\x00\x4d\x02\x10\x63\xb5\x0d\x12\x6c\x22\x0c\x01\xd5\x07\x30\x61\x62\x6c\x42"
+            "\x08\x20\x67\x61\x4c\x06\x00\x1a\x0a\x41\x6b\x69\x73\x73\x8f\x09\x81\x65\x67\x61\x00\x50\x68\x79\x6c\xd2\x03\x40\x47\x69\x76\x72"
+            "\x08\x00\x00\x2b\x09\x00\xaf\x02\x71\x4d\x61\x6d\x6d\x6f\x63\x68\x45\x04\x01\x54\x08\x20\x2d\x5a\xe5\x05\x31\x6c\x61\x6d\x0e\x0a"
+            "\x00\x29\x06\x10\x6d\xfe\x0c\x40\x63\x74\x75\x6e\xc9\x06\x10\x4d\xc3\x04\x10\x74\xc2\x02\x30\x6f\x74\x69\x56\x0d\x81\x43\x72\xc3"
+            "\xa9\x68\x65\x6c\x66\x09\x00\x62\x66\x6f\x6c\x6c\x65\x74\x0b\x00\x70\x61\x64\x65\x74\x00\x44\x69\x54\x04\x50\x00\x50\x61\x6c\x6b"
+            "\x25\x08\x40\x65\x61\x74\x72\x5a\x10\x81\x65\x67\x69\x67\x69\x67\x61\x73\xda\x09\x10\x74\x3c\x06\x10\x43\xcc\x09\x10\x65\x08\x05"
+            "\x30\x50\x68\x69\xf4\x00\x70\x4d\x61\x6e\x61\x70\x68\x79\x91\x10\x40\x6b\x72\x61\x69\x05\x06\x10\x79\x9c\x04\xb0\x41\x72\x63\x65"
+            "\x75\x73\x00\x56\x69\x63\x74\xd0\x02\x30\x56\x69\x70\x3f\x06\x10\x65\x27\x11\x60\x4c\x69\x61\x6e\x61\x6a\xab\x05\x20\x6a\x61\xd9"
+            "\x10\x81\x00\x47\x72\x75\x69\x6b\x75\x69\x36\x0e\x00\x21\x05\x00\x52\x03\x10\x69\xe9\x0e\x00\x20\x07\x01\xf4\x0e\x02\x69\x02\x60"
+            "\x61\x74\x65\x6c\x6f\x75\xc6\x02\x70\x43\x6c\x61\x6d\x69\x72\x61\xea\x0e\x00\xbb\x01\xa0\x69\x66\x00\x4d\x69\x72\x61\x64\x61\x72"
+            "\xdf\x0e\x21\x63\x68\x1d\x08\x01\x09\x00\x10\x65\x37\x00\x20\x73\x74\x98\x02\x10\x65\xbd\x02\x21\x63\x72\x00\x08\xa0\x4c\xc3\xa9"
+            "\x6f\x70\x61\x72\x64\x75\x73\xd1\x0a\x50\x69\x6c\x6c\x61\x6a\xd9\x08\x00\x0b\x00\x50\x6f\x75\x74\x61\x6e\x0f\x0f\x12\x6d\x14\x00"
+            "\x34\x6c\x61\x6d\x13\x00\x23\x6f\x74\x13\x00\x10\x6f\xf9\x06\x20\x61\x6e\xde\x07\x20\x6e\x61\x8c\x03\x40\x68\x61\x6e\x61\xd7\x0d"
+            "\x00\x58\x0a\x00\xea\x05\x00\x1b\x10\x20\x6d\x62\x2f\x11\x10\x44\xa6\x03\xc0\x61\x69\x73\x61\x6e\x00\x5a\xc3\xa9\x62\x69\x62\x33"
+            "\x09\x00\x0a\x00\xf3\x04\x6c\x69\x74\x7a\x00\x4e\x6f\x64\x75\x6c\x69\x74\x68\x65\x00\x47\xc3\xa9\x6f\x0a\x00\x00\x6d\x0c\x01\x0a"
+            "\x00\xa2\x43\x68\x6f\x76\x73\x6f\x75\x72\x69\x72\x7f\x0e\x30\x6c\x6f\x76\x89\x07\x60\x74\x6f\x74\x61\x75\x70\x9e\x0c\x13\x6e\x0a"
+            "\x00\xa1\x4e\x61\x6e\x6d\xc3\xa9\x6f\x75\xc3\xaf\xe5\x00\x20\x72\x70\x14\x01\x40\x00\x4f\x75\x76\x43\x0f\x00\x7d\x04\x00\xc7\x0f"
+            "\x42\x63\x68\x65\x66\x13\x04\x20\x6e\x64\x08\x04\x70\x74\x72\x61\x63\x6e\xc3\xa9\x10\x03\x40\x70\x75\x73\x74\x47\x08\xb0\x4a\x75"
+            "\x64\x6f\x6b\x72\x61\x6b\x00\x4b\x61\x8b\x06\x00\x69\x04\x61\x4c\x61\x72\x76\x65\x79\xde\x03\x72\x43\x6f\x75\x76\x65\x72\x64\x03"
+            "\x0b\x91\x6e\x74\x65\x72\x6e\x65\x6c\x00\x56\xb9\x12\x01\xca\x06\x50\x63\x6f\x62\x6f\x6c\x89\x11\x60\x42\x72\x75\x74\x61\x70\x8f"
+            "\x0f\x11\x44\x09\x0d\x31\x76\x65\x74\xad\x0b\x21\x61\x64\x0b\x00\x61\x43\x68\x6c\x6f\x72\x6f\xb8\x08\x90\x46\x72\x61\x67\x69\x6c"
+            "\x61\x64\x79\x3f\x07\x00\x0b\x0b\x10\x75\x17\x02\xf0\x00\x73\x63\x61\xc3\xaf\x6d\x61\x6e\x00\x45\x73\x63\x72\x6f\x63\x8f\x05\x00"
+            "\x86\x0f\x10\x69\x3b\x03\x30\x44\x61\x72\x11\x0d\x33\x6f\x6e\x64\x0b\x00\x00\x95\x10\x00\xc0\x0c\x11\x63\x4a\x06\x60\x43\x72\x61"
+            "\x62\x69\x63\x8d\x12\x01\x0b\x00\x21\x61\x72\xc8\x0d\x70\x42\x61\x67\x67\x69\x67\x75\x72\x0c\x00\x0b\x00\x90\x61\xc3\xaf\x64\x00"
+            "\x43\x72\x79\x70\xc1\x0e\x91\x6f\x00\x54\x75\x74\x61\x66\x65\x68\x08\x00\x30\x6e\x6b\x61\xdf\x0d\x01\xab\x13\x20\x61\x67\x54\x0f"
+            "\x01\x11\x09\x01\x0b\x00\x51\x41\x72\x6b\xc3\xa9\x86\x12\x01\x48\x12\x01\x3e\x00\x20\x79\x78\x35\x12\x50\x6d\x69\x61\x73\x6d\x91"
+            "\x01\x00\xc1\x10\x70\x78\x00\x5a\x6f\x72\x75\x61\x06\x00\x30\x6f\x61\x72\xdc\x13\x10\x69\x8a\x02\x00\x11\x0e\x40\x50\x61\x73\x68"
+            "\xf3\x0a\x40\x61\x00\x53\x63\xb9\x0f\x00\x0a\x00\x30\x4d\x65\x73\x14\x09\x01\x0c\x00\x34\x53\x69\x64\x0b\x00\x20\x4e\x75\x80\x01"
+            "\x02\x81\x00\x00\x43\x07\x40\x53\x79\x6d\x62\x08\x00\x20\x43\x6f\xc7\x00\x01\x5b\x0b\x80\x61\x6b\x6d\xc3\xa9\x63\x79\x67\x48\x0d"
+            "\x60\x6f\x72\x62\xc3\xa9\x62\x1e\x08\x00\xb1\x05\x23\x75\x6c\x08\x00\x01\x0b\x00\xd1\x56\x69\x76\x61\x6c\x64\x61\x69\x6d\x00\x48"
+            "\x61\x79\x08\x00\x30\x45\x6d\x6f\xef\x03\x01\x88\x14\x01\x2e\x0d\x90\x61\x6e\xc3\xa7\x61\x72\x67\x6f\x74\x7b\x08\x13\x6d\xea\x0a"
+            "\x30\x47\x61\x75\x26\x04\x50\x56\x69\x73\x6b\x75\xa9\x0f\x20\x6f\x79\xe4\x06\x10\x4d\xed\x11\x20\x62\x6f\x87\x08\x10\x74\x5a\x0a"
+            "\x42\x00\x4d\x79\x67\x4f\x0a\x70\x47\x72\x69\x6e\x64\x75\x72\x4f\x0f\x01\xc1\x14\x62\x54\x69\x63\x00\x43\x6c\x05\x00\x30\x74\x69"
+            "\x63\x0a\x00\x70\x41\x6e\x63\x68\x77\x61\x74\xf9\x0e\x20\x6d\x70\x45\x01\xb0\x69\x65\x00\x4f\x68\x6d\x61\x73\x73\x61\x63\x1a\x04"
+            "\x20\x65\x77\xaf\x06\x40\x4e\x65\x69\x74\xe9\x07\x60\x46\x75\x6e\xc3\xa9\x63\x43\x06\x00\x88\x07\x00\xd5\x06\x30\x6c\x75\x78\xc9"
+            "\x0c\x30\x75\x6c\x61\x14\x0c\x61\x43\x6f\x75\x70\x65\x6e\x55\x0c\x51\x49\x6e\x63\x69\x73\x27\x06\x20\x54\x72\xee\x12\x01\x6a\x07"
+            "\x10\x50\xf0\x09\x30\x68\x75\x6d\x72\x11\x21\x6c\x61\x17\x0a\x00\xbb\x15\x50\x78\x61\x67\x65\x6c\x5c\x02\x00\x73\x02\x00\x1e\x00"
+            "\x00\x2d\x0e\x50\x73\x70\x65\x65\x64\x0a\x00\x01\x1e\x03\x51\x4b\x75\x6e\x67\x66\x31\x10\x00\xd1\x04\x13\x6f\x0b\x00\x51\x44\x72"
+            "\x61\x6b\x6b\x45\x0b\x01\xec\x00\x11\x67\x50\x13\x10\x47\x06\x00\x02\xeb\x05\x41\x53\x63\x61\x6c\x6c\x06\x01\x09\x00\x01\xdd\x00"
+            "\x30\x46\x72\x69\xa6\x10\x60\x46\x75\x72\x61\x69\x67\xc5\x04\x50\x47\x75\x65\x72\x69\x0c\x00\x40\x65\x00\x56\x6f\x99\x04\x00\x6f"
+            "\x08\x60\x56\x61\x75\x74\x75\x74\xde\x10\x20\x00\x41\xf6\x04\x11\x61\xc4\x05\x10\x46\x0f\x11\x00\x59\x03\x10\x6f\xae\x0a\x00\x72"
+            "\x06\x30\x61\x6d\x61\xa2\x01\x50\x69\x6f\x78\x68\x79\x07\x11\x00\xb3\x11\x11\x6e\xba\x07\xc0\x50\x79\x72\x61\x78\x00\x43\x6f\x62"
+            "\x61\x6c\x74\x2d\x11\x10\x54\x35\x09\x10\x6b\x0a\x00\x50\x56\x69\x72\x69\x64\x09\x00\xc0\x42\x6f\x72\xc3\xa9\x61\x73\x00\x46\x75"
+            "\x6c\x67\x3e\x11\x60\x00\x52\x65\x73\x68\x69\x68\x01\x61\x5a\x65\x6b\x72\x6f\x6d\xd0\x0e\x21\xc3\xa9\x14\x03\x00\xb3\x09\xa0\x75"
+            "\x72\x65\x6d\x00\x4b\x65\x6c\x64\x65\x9e\x11\x40\x6c\x6f\x65\x74\x37\x14\x32\x65\x6e\x65\x54\x15\x13\x61\x81\x11\x40\x42\x6f\x67"
+            "\x75\x9a\x11\x00\x10\x0a\x01\xc8\x0d\x21\xc3\xa9\x5a\x15\x01\xd2\x15\x10\x6e\x6a\x16\x01\x52\x0e\x11\x6c\xe9\x15\x21\x65\x6c\x3c"
+            "\x01\x22\x65\x6e\x0c\x0f\x70\x43\x72\x6f\xc3\xa2\x70\x6f\xc9\x05\x30\x41\x6d\x70\xe3\x04\x71\x62\x69\x00\x53\x61\x70\x65\x6a\x16"
+            "\x91\x45\x78\x63\x61\x76\x61\x72\x65\x6e\x07\x09\x70\x73\x73\x65\x72\x6f\x75\x67\x5e\x04\x32\x61\x69\x73\x12\x06\x00\x9d\x05\x30"
+            "\x62\x75\x73\xad\x0b\x10\x4c\x77\x00\x14\x64\x0e\x01\x60\xc3\xa9\x72\xc3\xa9\x67\x2a\x0e\x00\x11\x0a\x13\x73\x67\x0e\x01\x01\x11"
+            "\x31\x6f\x6e\x63\xc7\x16\x01\xed\x00\x10\x6c\x53\x03\x33\x46\x6c\x61\x3d\x03\x11\x46\xe6\x00\x02\xd4\x17\x50\x67\x65\x73\x00\x43"
+            "\xb0\x14\x20\x6f\x6c\xa5\x11\x00\xaf\x09\x20\x76\x72\xbc\x0d\xa0\x50\x61\x6e\x64\x65\x73\x70\x69\xc3\xa8\xc5\x01\x00\x0e\x00\x42"
+            "\x61\x72\x62\x61\x8f\x02\x00\xff\x10\x20\x65\x6c\x38\x16\x80\x73\x74\x69\x67\x72\x69\x00\x4d\xb6\x0a\x20\x67\x72\xad\x0d\x50\x6f"
+            "\x6e\x6f\x72\x70\x1c\x0e\x00\x3a\x08\xa0\x63\x6c\xc3\xa8\x73\x00\x45\x78\x61\x67\x31\x05\x20\x46\x6c\x19\x05\x02\x9a\x10\x11\x6f"
+            "\x49\x15\x40\x53\x75\x63\x72\xbc\x0b\x80\x6e\x00\x43\x75\x70\x63\x61\x6e\xcf\x15\x50\x65\x00\x53\x65\x70\xd6\x13\x13\x70\x09\x00"
+            "\x70\x72\x6f\x63\x65\x00\x4f\x70\x27\x02\x10\x6e\xe5\x0e\x50\x6c\x67\x6f\x70\x61\x39\x06\x50\x56\x65\x6e\x61\x6c\x87\x08\x10\x4b"
+            "\xff\x15\x70\x72\x65\x63\x68\x00\x46\x6c\xb1\x02\x10\x75\xe5\x11\x80\x47\x61\x6d\x62\x6c\x61\x73\x74\x41\x08\x20\x76\x61\xe9\x07"
+            "\x30\x49\x67\x75\x05\x14\x30\x00\x50\x74\x2f\x10\x10\x69\xc5\x03\x60\x52\x65\x78\x69\x6c\x6c\x85\x0c\x40\x41\x6d\x61\x67\x8b\x0b"
+            "\x21\x44\x72\x78\x14\x70\x61\x00\x4e\x79\x6d\x70\x68\x9d\x08\x01\xe8\x05\x80\x6c\x69\x62\x72\xc3\xa9\x00\x44\x07\x15\x01\xd2\x11"
+            "\x50\x72\x61\x73\x73\x69\xa2\x0a\x40\x63\x75\x73\x63\xe5\x05\x50\x43\x6f\x6c\x69\x6d\x0e\x00\x53\x00\x4d\x75\x70\x6c\x96\x09\x12"
+            "\x54\x0f\x11\x00\x10\x02\x20\x42\x72\x24\x15\x92\x6c\xc3\xb4\x6d\x65\x00\x44\x65\x73\x68\x0e\x00\x86\x03\x50\x50\x69\x74\x72\x6f"
+            "\x9e\x07\x00\xb7\x05\x31\x6e\x73\x68\x0f\x00\x10\x79\xbb\x0a\x50\x65\x6c\x61\xc3\xa7\x69\x03\x01\x34\x0d\x30\x72\x61\x77\xf1\x04"
+            "\x00\xa7\x14\x00\x3d\x05\x01\x81\x06\x20\x79\x76\xa0\x06\x20\x00\x58\x06\x00\x60\x61\x73\x00\x59\x76\x65\xe6\x14\x40\x00\x5a\x79"
+            "\x67\xed\x0f\x00\x4c\x03\x40\x6e\x63\x69\x65\x04\x14\x13\x70\x26\x12\x10\x6e\xba\x03\x10\x42\xc4\x04\x01\x4e\x0b\x20\x45\x66\xd4"
+            "\x0f\x00\x52\x04\x02\xc0\x0a\x31\x64\x75\x63\x70\x02\x00\x23\x18\x00\x8b\x08\x11\x6f\xd4\x19\x10\x46\xad\x00\x00\x12\x14\x11\x6e"
+            "\x0e\x17\x01\xb2\x01\x00\x16\x17\x02\x37\x19\x20\x4f\x72\x84\x15\x00\x2d\x09\x20\x69\x63\xe4\x04\x10\x75\xb4\x10\x10\x63\x21\x0b"
+            "\x01\x5c\x0a\x10\x7a\xa9\x19\x00\xa1\x08\x20\x6e\x67\x77\x08\x00\xc6\x0e\x13\x72\xa4\x01\x00\x77\x07\x02\xdb\x0f\x02\x12\x1a\x21"
+            "\x70\x69\x8d\x0f\x11\x63\x37\x0a\x01\xda\x06\x11\x67\x73\x1a\x00\x0b\x00\x00\x4c\x17\x01\x57\x0a\x40\x50\x6c\x75\x6d\x52\x01\x70"
+            "\x65\x00\x42\x6f\x6d\x62\x79\x72\x06\x30\x52\x75\x62\x89\x08\x00\x15\x01\x51\x52\x6f\x63\x61\x62\x51\x11\x21\x75\x67\x07\x0f\x11"
+            "\x46\x83\x01\x30\x61\x72\x64\x32\x00\x40\x56\x6f\x72\x61\x53\x0c\x00\x5b\x12\x55\x50\x72\xc3\xa9\x64\x0e\x00\x10\x54\x0f\x01\x00"
+            "\x25\x0a\x40\x42\x6f\x75\x72\x6a\x0a\x00\x0a\x07\x40\x61\x71\x75\x61\x79\x0a\x11\x65\xae\x13\x01\x2a\x15\x00\x03\x18\x00\x4d\x03"
+            "\x22\x6f\x72\x0f\x18\x00\xde\x17\x40\x6f\x64\x6f\x64\x2a\x12\x04\x53\x06\x01\x7f\x08\x10\x78\x42\x13\x00\x24\x00\x00\xc3\x04\x70"
+            "\x4e\x6f\x75\x6e\x6f\x75\x72\x4a\x04\x20\x43\x68\xdf\x09\x11\x72\xc0\x15\x00\x49\x01\x01\x57\x19\x01\x9d\x00\x00\x0e\x03\x01\x0e"
+            "\x0d\x11\x47\x6b\x04\x11\x6c\x1e\x02\x42\x47\x6f\x75\x72\x87\x09\x20\x51\x75\x64\x19\x00\x27\x0c\x50\x00\x53\x6f\x76\x6b\x43\x0e"
+            "\x30\x00\x53\x61\xad\x13\x00\x6b\x0c\x20\x42\x61\xf8\x00\x80\x75\x68\x00\x54\x72\xc3\xa9\x70\x87\x01\x00\x2c\x01\x63\x43\x6f\x6e"
+            "\x63\x6f\x6d\x86\x1b\xf1\x01\x79\x70\x65\x3a\x30\x00\x53\x69\x6c\x76\x61\x6c\x6c\x69\xc3\xa9\xe4\x0e\x00\x96\x0f\x00\xe9\x18\x40"
+            "\x6f\x61\x6c\x61\xfc\x00\x10\x6d\x49\x1b\x00\xb2\x0b\x50\x64\x65\x6d\x61\x72\xea\x0f\x40\x6d\x69\x71\x75\xbd\x0e\x10\x6e\x99\x0e"
+            "\x01\x01\x05\x10\x44\x72\x00\x10\x65\x7f\x07\x11\x69\x8e\x02\x30\x61\x69\x6c\x7d\x09\x10\x62\xcf\x17\x01\xc8\x02\x00\x63\x0c\x00"
+            "\x7e\x08\x70\xc3\x89\x6b\x61\xc3\xaf\x73\x26\x07\x60\x6f\x6b\x6f\x72\x69\x63\x38\x16\x40\x6b\x6f\x70\x69\x80\x0c\x00\x0a\x00\x20"
+            "\x74\x6f\x9a\x08\x01\x13\x00\x10\x73\x02\x09\x40\x6f\x73\x6d\x6f\xa1\x16\x60\x73\x6d\x6f\x76\x75\x6d\x14\x06\x00\x68\x12\x00\x8d"
+            "\x0e\x10\x6e\xa0\x00\x10\x5a\xb6\x05\x00\x59\x00\x00\x30\x0b\x10\x63\xd4\x15\x61\x43\x61\x6e\x63\x72\x65\x33\x0a\x91\x43\xc3\xa2"
+            "\x62\x6c\x69\x66\xc3\xa8\x00\x0e\x33\x6d\x62\x6f\x77\x0e\x40\x4b\x61\x74\x61\x4a\x10\x22\x00\x45\x81\x02\x00\xfd\x03\x80\x00\x4e"
+            "\x65\x63\x72\x6f\x7a\x6d\x88\x09\x20\x67\x65\x47\x1c\x00\xeb\x05\xb0\x73\x68\x61\x64\x6f\x77\x00\x56\xc3\xa9\x6d\xce\x0b\x10\x4d"
+            "\xbc\x01\x02\x54\x05\x60\x41\x6d\x61\x2d\x41\x6d\xe2\x02\xf0\x04\x65\x72\x72\x6f\x74\x65\x6b\x6e\x69\x6b\x00\x5a\x65\x72\x61\x6f"
+            "\x72\x61\x00",
+            9475, 10710
+        },
+    },
+    // Italian
+    {
+        // characteristic_it
+        {
+            "\xf0\xa2\x1f\x00\x00\x00\x84\x00\x00\x00\x8c\x00\x00\x00\x9b\x00\x00\x00\xb0\x00\x00\x00\xbe\x00\x00\x00\xd2\x00\x00\x00\xe3\x00"
+            "\x00\x00\xfc\x00\x00\x00\x0c\x01\x00\x00\x23\x01\x00\x00\x34\x01\x00\x00\x4a\x01\x00\x00\x5e\x01\x00\x00\x6f\x01\x00\x00\x7e\x01"
+            "\x00\x00\x8d\x01\x00\x00\x9a\x01\x00\x00\xa8\x01\x00\x00\xbf\x01\x00\x00\xd3\x01\x00\x00\xe9\x01\x00\x00\x00\x02\x00\x00\x11\x02"
+            "\x00\x00\x21\x02\x00\x00\x35\x02\x00\x00\x4c\x02\x00\x00\x5b\x02\x00\x00\x6b\x02\x00\x00\x83\x02\x00\x00\x93\x02\x00\x00\xa8\x02"
+            "\x00\x00\xb8\x02\x00\x00\x4e\x65\x73\x73\x75\x6e\x61\x00\x41\x64\x6f\x72\x61\x20\x6d\x61\x6e\x67\x69\x61\x72\x65\x00\x53\x69\x20"
+            "\x61\x64\x64\x6f\x72\x6d\x65\x6e\x74\x61\x20\x73\x70\x65\x73\x73\x6f\x00\x44\x10\x00\xf3\x0d\x20\x61\x20\x6c\x75\x6e\x67\x6f\x00"
+            "\x4c\x61\x73\x63\x69\x61\x20\x63\x6f\x73\x65\x20\x69\x6e\x20\x67\x69\x72\x6f\x46\x00\xf4\x13\x72\x69\x6c\x61\x73\x73\x61\x72\x73"
+            "\x69\x00\x4c\x61\x20\x66\x6f\x72\x7a\x61\x20\xc3\xa8\x20\x69\x6c\x20\x73\x75\x6f\x20\x76\x61\x6e\x74\x2a\x00\x51\x64\x69\x6d\x65"
+            "\x6e\x29\x00\x00\x71\x00\xd0\x72\x72\x61\x62\x62\x69\x61\x20\x66\x61\x63\x69\x6c\x7a\x00\x13\x65\x27\x00\xc5\x63\x6f\x6d\x62\x61"
+            "\x74\x74\x65\x72\x65\x00\x46\x1c\x00\xf0\x14\x20\x69\x72\x72\x69\x74\x61\x62\x69\x6c\x65\x00\x48\x61\x20\x75\x6e\x20\x63\x6f\x72"
+            "\x70\x6f\x20\x72\x6f\x62\x75\x73\x74\x6f\x00\x46\x6f\x72\x25\x00\xf4\x08\x6e\x20\x61\x74\x74\x61\x63\x63\x6f\x00\x4d\x6f\x6c\x74"
+            "\x6f\x20\x6f\x73\x74\x69\x6e\x61\x74\x0f\x00\x41\x70\x61\x7a\x69\x6a\x00\x02\x0f\x00\x56\x74\x65\x6e\x61\x63\x77\x00\x22\x72\x72"
+            "\x74\x00\x00\x44\x00\xa0\x65\x6e\x7a\x69\x6f\x6e\x65\x20\x61\x69\xc7\x00\x71\x6e\x69\x00\x49\x72\x72\x75\x89\x00\xd1\x65\x20\x73"
+            "\x65\x6d\x70\x6c\x69\x63\x65\x00\x55\x6e\x2e\x01\xf2\x11\x63\x69\x65\x20\x64\x69\x20\x62\x75\x66\x66\x6f\x6e\x65\x00\x53\x61\x20"
+            "\x66\x75\x67\x67\x69\x72\x65\x20\x76\x65\x6c\x6f\x63\x65\xdd\x00\xf0\x06\x47\x72\x61\x6e\x64\x65\x20\x66\x69\x63\x63\x61\x6e\x61"
+            "\x73\x6f\x00\x41\x6c\x71\x75\x1e\x01\x40\x20\x76\x69\x76\x87\x00\x72\x45\x73\x74\x72\x65\x6d\x61\xef\x00\x30\x73\x61\x67\x14\x00"
+            "\xb2\x53\x69\x20\x70\x65\x72\x64\x65\x20\x6e\x65\x50\x01\x44\x6d\x6f\x6e\x64\xce\x00\x41\x65\x73\x69\x67\x5b\x00\x20\x53\x61\x6f"
+            "\x01\x50\x66\x61\x74\x74\x6f\x25\x00\xf4\x08\x00\x41\x62\x62\x61\x73\x74\x61\x6e\x7a\x61\x20\x73\x75\x70\x65\x72\x66\x69\x63\x69"
+            "\x61\x6c\xf6\x00\x51\x69\x6e\x73\x6f\x6c\x38\x00\xc2\x4e\x6f\x6e\x20\x73\x6f\x70\x70\x6f\x72\x74\x61\x68\x00\x10\x72\xd5\x00\xe0"
+            "\x20\x70\x6f\x27\x20\x74\x65\x73\x74\x61\x72\x64\x6f\x00",
+            622, 696
+        },
+        // dppt_it
+        {
+            "\xf1\xff\xcc\x71\x00\x00\x00\xcc\x01\x00\x00\xd7\x01\x00\x00\xdf\x01\x00\x00\xe9\x01\x00\x00\xf3\x01\x00\x00\x01\x02\x00\x00\x14"
+            "\x02\x00\x00\x28\x02\x00\x00\x39\x02\x00\x00\x47\x02\x00\x00\x56\x02\x00\x00\x7e\x02\x00\x00\x8e\x02\x00\x00\x9e\x02\x00\x00\xb2"
+            "\x02\x00\x00\xc2\x02\x00\x00\xd2\x02\x00\x00\xe2\x02\x00\x00\xf2\x02\x00\x00\x10\x03\x00\x00\x34\x03\x00\x00\x58\x03\x00\x00\x69"
+            "\x03\x00\x00\x7e\x03\x00\x00\x93\x03\x00\x00\xa8\x03\x00\x00\xbd\x03\x00\x00\xd2\x03\x00\x00\xe7\x03\x00\x00\xf8\x03\x00\x00\x0a"
+            "\x04\x00\x00\x1c\x04\x00\x00\x2f\x04\x00\x00\x51\x04\x00\x00\x73\x04\x00\x00\x95\x04\x00\x00\xa6\x04\x00\x00\xba\x04\x00\x00\xcf"
+            "\x04\x00\x00\xdc\x04\x00\x00\xf3\x04\x00\x00\x0a\x05\x00\x00\x17\x05\x00\x00\x30\x05\x00\x00\x4c\x05\x00\x00\x68\x05\x00\x00\x7b"
+            "\x05\x00\x00\x8f\x05\x00\x00\xa3\x05\x00\x00\xb7\x05\x00\x00\xcb\x05\x00\x00\xdf\x05\x00\x00\xf0\x05\x00\x00\x0b\x06\x00\x00\x26"
+            "\x06\x00\x00\x41\x06\x00\x00\x4f\x06\x00\x00\x5f\x06\x00\x00\x6d\x06\x00\x00\x7e\x06\x00\x00\x90\x06\x00\x00\xad\x06\x00\x00\xc8"
+            "\x06\x00\x00\xda\x06\x00\x00\xe9\x06\x00\x00\x03\x07\x00\x00\x10\x07\x00\x00\x1c\x07\x00\x00\x29\x07\x00\x00\x35\x07\x00\x00\x42"
+            "\x07\x00\x00\x4f\x07\x00\x00\x5c\x07\x00\x00\x69\x07\x00\x00\x7c\x07\x00\x00\x90\x07\x00\x00\xa3\x07\x00\x00\xb7\x07\x00\x00\xc4"
+            "\x07\x00\x00\xd1\x07\x00\x00\xde\x07\x00\x00\xeb\x07\x00\x00\xfc\x07\x00\x00\x0d\x08\x00\x00\x1e\x08\x00\x00\x2f\x08\x00\x00\x40"
+            "\x08\x00\x00\x53\x08\x00\x00\x67\x08\x00\x00\x7c\x08\x00\x00\x8f\x08\x00\x00\xa3\x08\x00\x00\xb6\x08\x00\x00\xc3\x08\x00\x00\xd0"
+            "\x08\x00\x00\xdd\x08\x00\x00\xea\x08\x00\x00\xf7\x08\x00\x00\x04\x09\x00\x00\x11\x09\x00\x00\x1e\x09\x00\x00\x2b\x09\x00\x00\x38"
+            "\x09\x00\x00\x45\x09\x00\x00\x52\x09\x00\x00\x5f\x09\x00\x00\x6c\x09\x00\x00\x76\x09\x00\x00\x7f\x09\x00\x00\x8a\x09\x00\x00\x97"
+            "\x09\x00\x00\xa4\x09\x00\x00\xb1\x09\x00\x00\xbe\x09\x00\x00\x43\x61\x6e\x61\x6c\x69\x70\x6f\x6c\x69\x00\x45\x76\x6f\x08\x00\x42"
+            "\x50\x72\x61\x74\x0a\x00\x42\x41\x72\x65\x6e\x1c\x00\xf1\x09\x4c\x65\x67\x61\x20\x50\x6f\x6b\xc3\xa9\x6d\x6f\x6e\x00\x43\x61\x76"
+            "\x61\x20\x4d\x69\x6e\x65\x72\x28\x00\x3f\x20\x50\x31\x13\x00\x00\xf4\x0a\x53\x00\x49\x6d\x70\x69\x61\x6e\x74\x6f\x20\x54\x75\x72"
+            "\x62\x69\x6e\x65\x00\x42\x6f\x73\x63\x6f\x20\x68\x00\xfa\x27\x46\x6f\x6e\x64\x65\x72\x69\x65\x20\x46\x75\x65\x67\x6f\x00\x4d\x6f"
+            "\x6e\x74\x65\x20\x43\x6f\x72\x6f\x6e\x61\x20\x28\x45\x6e\x74\x72\x61\x74\x61\x20\x50\x65\x72\x63\x6f\x72\x73\x6f\x20\x32\x30\x37"
+            "\x2f\x32\x30\x38\x29\x28\x00\x2b\x50\x32\x10\x00\x1a\x33\x10\x00\x6b\x2d\x20\x4e\x65\x76\x65\x24\x00\x1b\x34\x10\x00\x1b\x35\x10"
+            "\x00\x1b\x36\x10\x00\x1c\x37\x54\x00\xef\x47\x72\x6f\x74\x74\x61\x20\x69\x6e\x20\x43\x69\x6d\x61\xba\x00\x0e\x2b\x31\x36\xb6\x00"
+            "\x0f\x24\x00\x01\x1c\x31\xda\x00\xff\x08\x31\x53\x00\x47\x72\x61\x6e\x20\x50\x61\x6c\x75\x64\x65\x20\x2d\x20\x41\x72\x65\x61\x20"
+            "\x31\x15\x00\x01\x1f\x32\x15\x00\x01\x1f\x33\x15\x00\x01\x1f\x34\x15\x00\x01\x1f\x35\x15\x00\x01\xf0\x0f\x36\x00\x52\x6f\x76\x69"
+            "\x6e\x65\x20\x46\x6c\x65\x6d\x6d\x69\x6e\x69\x61\x00\x56\x69\x61\x20\x56\x69\x74\x74\x6f\x72\x69\x06\x01\x2d\x50\x31\x12\x00\x1e"
+            "\x32\x24\x00\x1c\x53\x13\x00\xfd\x02\x53\x74\x61\x6e\x7a\x61\x20\x73\x75\x6c\x20\x52\x65\x74\x72\x6f\x20\x47\x00\x0d\x22\x00\x0d"
+            "\x57\x00\x0d\x22\x00\x40\x33\x00\x43\x61\xa6\x00\xfb\x01\x6f\x20\x52\x6f\x63\x63\x69\x6f\x73\x6f\x00\x56\x61\x72\x63\x6f\xa6\x02"
+            "\x0f\x14\x00\x00\x13\x53\x77\x01\x54\x4f\x73\x74\x69\x6c\x2a\x02\x02\x0d\x00\x33\x20\x2d\x20\xa9\x01\x0c\x17\x00\x70\x49\x6e\x74"
+            "\x65\x72\x6e\x6f\xc3\x02\xa3\x74\x65\x20\x53\x61\x6c\x75\x74\x6f\x00\x16\x02\x77\x52\x69\x74\x6f\x72\x6e\x6f\x3d\x00\x0d\x19\x00"
+            "\x52\x50\x69\x6c\x61\x73\xfb\x00\x0f\x1c\x00\x07\x81\x32\x00\x54\x65\x6d\x70\x69\x6f\xc2\x02\x04\xc1\x00\x0e\x13\x00\x1e\x53\x14"
+            "\x00\x1f\x32\x14\x00\x00\x1f\x33\x14\x00\x00\x1f\x34\x14\x00\x00\x10\x35\x76\x02\x01\x93\x00\x76\x4c\x61\x62\x69\x72\x69\x6e\xd9"
+            "\x00\x05\x11\x00\xa5\x20\x28\x53\x65\x67\x72\x65\x74\x6f\x29\xbf\x00\x02\x2b\x02\xbd\x28\x3c\x20\x31\x30\x20\x55\x6e\x6f\x77\x6e"
+            "\x1b\x00\x17\x3e\x1b\x00\x63\x54\x75\x6e\x6e\x65\x6c\x1b\x00\x60\x00\x47\x69\x61\x72\x64\xbb\x01\xfa\x05\x54\x72\x6f\x66\x65\x6f"
+            "\x00\x49\x73\x6f\x6c\x61\x20\x46\x65\x72\x72\x6f\x73\x61\x0e\x00\x00\x03\x01\x0c\x11\x00\x1c\x53\x12\x00\xdf\x32\x53\x20\x28\x53"
+            "\x69\x6e\x69\x73\x74\x72\x61\x29\x1d\x00\x01\x2f\x44\x65\x1b\x00\x02\xfb\x02\x33\x53\x00\x41\x6e\x74\x69\x63\x6f\x20\x43\x68\x61"
+            "\x74\x65\x61\x75\x0f\x00\x06\x78\x02\xe3\x35\x00\x4c\x61\x67\x6f\x20\x56\x65\x72\x69\x74\xc3\xa0\x0d\x00\x52\x61\x6c\x6f\x72\x65"
+            "\x0c\x00\xc4\x41\x72\x67\x75\x7a\x69\x61\x00\x52\x69\x76\x61\x19\x00\x01\x0c\x00\x04\x19\x00\x07\xd6\x04\x18\x31\x0d\x00\x18\x32"
+            "\x0d\x00\x18\x33\x0d\x00\x7b\x34\x20\x28\x53\x75\x64\x29\x13\x00\x3a\x4e\x6f\x72\x14\x00\x1e\x35\x27\x00\x1f\x35\x27\x00\x00\x18"
+            "\x36\x0d\x00\x18\x37\x0d\x00\x18\x38\x0d\x00\xb1\x39\x00\x54\x6f\x72\x72\x65\x20\x4d\x65\x6d\x79\x03\x00\x81\x02\x0a\x11\x00\x1c"
+            "\x32\x11\x00\x1c\x33\x11\x00\x1c\x34\x11\x00\x17\x35\x62\x00\x2d\x31\x30\xb0\x00\x00\x13\x00\x0c\xb0\x00\x9c\x31\x31\x20\x28\x4f"
+            "\x76\x65\x73\x74\x15\x00\x1b\x45\x13\x00\x1f\x32\x3c\x00\x00\x1e\x32\x63\x00\x08\x5a\x01\x28\x31\x34\x0d\x00\x09\x9d\x00\x08\x26"
+            "\x01\x18\x31\x26\x01\x18\x31\x26\x01\x27\x31\x39\x0d\x00\x18\x32\xcf\x01\x18\x32\xcf\x01\x18\x32\x68\x00\x18\x32\x68\x00\x18\x32"
+            "\x5b\x00\x18\x32\x5b\x00\xd2\x32\x39\x00\x44\x75\x65\x66\x6f\x67\x6c\x69\x65\x00\x41\x01\x20\x64\x65\x96\x07\x78\x61\x20\x53\x76"
+            "\x61\x67\x6f\x2b\x00\x18\x30\x0d\x00\x08\xe1\x00\x18\x32\xc7\x00\x30\x33\x30\x00",
+            1364, 2494
+        },
+        // frlg_it
+        {
+            "\xf2\xff\xc5\x6b\x00\x00\x00\xb4\x01\x00\x00\xc0\x01\x00\x00\xcd\x01\x00\x00\xd9\x01\x00\x00\xe5\x01\x00\x00\xf1\x01\x00\x00\xfc"
+            "\x01\x00\x00\x0b\x02\x00\x00\x16\x02\x00\x00\x21\x02\x00\x00\x2c\x02\x00\x00\x37\x02\x00\x00\x42\x02\x00\x00\x4d\x02\x00\x00\x58"
+            "\x02\x00\x00\x63\x02\x00\x00\x6e\x02\x00\x00\x7a\x02\x00\x00\x86\x02\x00\x00\x92\x02\x00\x00\x9e\x02\x00\x00\xaa\x02\x00\x00\xb6"
+            "\x02\x00\x00\xc2\x02\x00\x00\xce\x02\x00\x00\xda\x02\x00\x00\xe6\x02\x00\x00\xf2\x02\x00\x00\xfe\x02\x00\x00\x0a\x03\x00\x00\x16"
+            "\x03\x00\x00\x22\x03\x00\x00\x2e\x03\x00\x00\x3d\x03\x00\x00\x4b\x03\x00\x00\x5a\x03\x00\x00\x69\x03\x00\x00\x72\x03\x00\x00\x81"
+            "\x03\x00\x00\x91\x03\x00\x00\xa1\x03\x00\x00\xb1\x03\x00\x00\xc6\x03\x00\x00\xd9\x03\x00\x00\xee\x03\x00\x00\x03\x04\x00\x00\x18"
+            "\x04\x00\x00\x2d\x04\x00\x00\x40\x04\x00\x00\x54\x04\x00\x00\x67\x04\x00\x00\x7b\x04\x00\x00\x8f\x04\x00\x00\xa3\x04\x00\x00\xb7"
+            "\x04\x00\x00\xc9\x04\x00\x00\xdb\x04\x00\x00\xed\x04\x00\x00\xff\x04\x00\x00\x11\x05\x00\x00\x23\x05\x00\x00\x35\x05\x00\x00\x48"
+            "\x05\x00\x00\x5b\x05\x00\x00\x65\x05\x00\x00\x70\x05\x00\x00\x7b\x05\x00\x00\x89\x05\x00\x00\x99\x05\x00\x00\xa6\x05\x00\x00\xb6"
+            "\x05\x00\x00\xc6\x05\x00\x00\xd5\x05\x00\x00\xe6\x05\x00\x00\xf7\x05\x00\x00\x08\x06\x00\x00\x18\x06\x00\x00\x22\x06\x00\x00\x2d"
+            "\x06\x00\x00\x3a\x06\x00\x00\x55\x06\x00\x00\x65\x06\x00\x00\x74\x06\x00\x00\x85\x06\x00\x00\x91\x06\x00\x00\xa8\x06\x00\x00\xbf"
+            "\x06\x00\x00\xd6\x06\x00\x00\xe5\x06\x00\x00\xf5\x06\x00\x00\x05\x07\x00\x00\x15\x07\x00\x00\x25\x07\x00\x00\x35\x07\x00\x00\x43"
+            "\x07\x00\x00\x51\x07\x00\x00\x62\x07\x00\x00\x74\x07\x00\x00\x8a\x07\x00\x00\x9a\x07\x00\x00\xaa\x07\x00\x00\xb5\x07\x00\x00\xc3"
+            "\x07\x00\x00\xd3\x07\x00\x00\xdf\x07\x00\x00\xeb\x07\x00\x00\xf7\x07\x00\x00\x06\x08\x00\x00\x42\x69\x61\x6e\x63\x61\x76\x69\x6c"
+            "\x6c\x61\x00\x53\x6d\x65\x72\x61\x6c\x64\x6f\x70\x6f\x6c\x69\x00\x43\x65\x6c\x65\x73\x74\x0c\x00\x63\x41\x72\x61\x6e\x63\x69\x0c"
+            "\x00\x52\x7a\x7a\x75\x72\x72\x0c\x00\x61\x46\x75\x63\x73\x69\x61\x0b\x00\xb0\x49\x73\x6f\x6c\x61\x20\x43\x61\x6e\x6e\x65\x4b\x00"
+            "\xa6\x50\x65\x72\x63\x6f\x72\x73\x6f\x20\x31\x0b\x00\x16\x32\x0b\x00\x16\x33\x0b\x00\x16\x34\x0b\x00\x16\x35\x0b\x00\x16\x36\x0b"
+            "\x00\x16\x37\x0b\x00\x16\x38\x0b\x00\x17\x39\x63\x00\x17\x30\x0c\x00\x07\x70\x00\x17\x31\x71\x00\x17\x31\x72\x00\x17\x31\x73\x00"
+            "\x17\x31\x74\x00\x17\x31\x75\x00\x17\x31\x76\x00\x17\x31\x77\x00\x17\x31\x78\x00\x17\x32\x78\x00\x18\x32\xe8\x00\x07\x78\x00\x17"
+            "\x32\x78\x00\x17\x32\x78\x00\x94\x32\x35\x00\x42\x6f\x73\x63\x6f\x20\x74\x01\xea\x00\x4d\x6f\x6e\x74\x65\x20\x4c\x75\x6e\x61\x20"
+            "\x50\x31\x0e\x00\x19\x53\x0f\x00\xf1\x17\x32\x53\x00\x4d\x2f\x4e\x20\x41\x6e\x6e\x61\x00\x47\x72\x6f\x74\x74\x61\x20\x44\x69\x67"
+            "\x6c\x65\x74\x74\x00\x56\x69\x61\x20\x56\x69\x74\x74\x6f\x72\x69\x46\x00\x0a\x10\x00\x1b\x32\x10\x00\x30\x33\x00\x56\xf7\x01\xdf"
+            "\x20\x50\x6f\x6b\xc3\xa9\x6d\x6f\x6e\x20\x50\x31\x2d\x15\x00\x01\xfb\x07\x53\x00\x5a\x6f\x6e\x61\x20\x53\x61\x66\x61\x72\x69\x20"
+            "\x2d\x20\x43\x65\x6e\x74\x72\x6f\x15\x00\x6f\x41\x72\x65\x61\x20\x31\x15\x00\x01\x1f\x32\x15\x00\x01\x40\x33\x00\x54\x75\x2b\x02"
+            "\x90\x20\x52\x6f\x63\x63\x69\x6f\x73\x6f\xaf\x00\x0e\x13\x00\x11\x53\x58\x02\xb0\x65\x20\x53\x70\x75\x6d\x61\x72\x69\x6e\x65\x27"
+            "\x00\x0e\x13\x00\x0f\x27\x00\x00\x1f\x32\x14\x00\x00\x1f\x33\x14\x00\x00\x87\x34\x53\x00\x54\x6f\x72\x72\x65\xf1\x00\x1d\x33\x12"
+            "\x00\x1d\x34\x12\x00\x1d\x35\x12\x00\x1d\x36\x12\x00\x14\x37\x9f\x01\x02\x4b\x03\x01\xbc\x00\x0c\x12\x00\x1e\x32\x24\x00\x21\x53"
+            "\x00\x61\x01\x50\x61\x6c\x65\x20\x45\xd6\x01\xa0\x72\x69\x63\x61\x00\x50\x72\x69\x6d\x69\x63\x03\x64\x00\x51\x75\x61\x72\x74\x0b"
+            "\x00\x23\x69\x6e\x0b\x00\x01\xda\x01\x50\x75\x6c\x63\x61\x6e\x2e\x00\xf1\x0f\x52\x69\x76\x61\x20\x64\x65\x6c\x20\x54\x65\x73\x6f"
+            "\x72\x6f\x00\x43\x61\x70\x6f\x20\x45\x73\x74\x72\x65\x6d\x6f\x00\x50\x4c\x02\x50\x41\x62\x62\x72\x61\x68\x01\xb2\x00\x50\x6f\x72"
+            "\x74\x6f\x20\x54\x65\x72\x7a\x4b\x00\x40\x50\x65\x72\x6c\x3e\x00\xf1\x01\x69\x20\x4d\x61\x72\x69\x00\x4c\x61\x62\x69\x72\x69\x6e"
+            "\x74\x6f\x0f\x00\x97\x6e\x6f\x00\x50\x72\x61\x74\x6f\x20\x7c\x00\x74\x43\x6f\x6c\x6f\x6e\x6e\x61\xb8\x01\x13\x61\x0c\x04\x83\x53"
+            "\x6f\x6c\x69\x74\x61\x72\x69\x9d\x00\x41\x65\x72\x64\x65\x0a\x00\x01\x47\x00\xb0\x61\x00\x56\x61\x6c\x6c\x65\x20\x41\x6e\x74\xb1"
+            "\x00\x02\x3b\x01\x60\x41\x6c\x6c\x65\x6e\x61\x9e\x02\xf0\x04\x20\x28\x45\x73\x74\x65\x72\x6e\x6f\x29\x00\x49\x6e\x67\x72\x65\x73"
+            "\x73\x6f\x5c\x04\x42\x79\x6f\x6e\x00\x07\x00\xc0\x20\x53\x65\x70\x74\x69\x6f\x6e\x00\x52\x6f\x76\xc8\x01\x84\x46\x6c\x6f\x72\x61"
+            "\x62\x65\x74\x48\x03\x58\x42\x72\x61\x63\x65\x0c\x00\x80\x20\x2d\x20\x53\x74\x61\x6e\x7a\xa5\x02\x0f\x17\x00\x02\x1f\x32\x17\x00"
+            "\x03\x19\x33\x17\x00\x05\x9a\x03\x04\x0f\x00\x04\x9b\x03\x03\x10\x00\x00\x9c\x03\x08\x10\x00\x1b\x33\x10\x00\x1b\x34\x10\x00\x23"
+            "\x35\x53\x07\x04\x74\x42\x61\x63\x63\x6f\x73\x6f\x0e\x02\x55\x47\x65\x6c\x61\x74\xdf\x03\x02\x0e\x00\x07\x3f\x02\x05\x11\x00\x1b"
+            "\x53\x12\x00\x40\x2d\x20\x52\x65\x9c\x03\x02\x55\x00\x50\x44\x69\x73\x65\x67\x51\x01\x04\x26\x00\xf3\x03\x4d\x75\x74\x65\x76\x6f"
+            "\x6c\x65\x00\x53\x61\x6c\x61\x20\x41\x2d\x6c\x6f\x0b\x00\x51\x42\x2d\x65\x74\x75\x03\x06\x00\x0e\x00\x70\x43\x2d\x69\x63\x6c\x61"
+            "\x6d\xed\x01\x01\x10\x00\x53\x44\x2d\x61\x66\x6e\x2a\x00\x53\x45\x2d\x64\x65\x72\x28\x00\x53\x46\x2d\x65\x6c\x63\x18\x00\xa0\x47"
+            "\x2d\x61\x72\x64\x65\x6e\x69\x61\x00",
+            1321, 2054
+        },
+        // hgss_it
+        {
+            "\xf6\xff\xff\x05\x78\x00\x00\x00\xe8\x01\x00\x00\xf9\x01\x00\x00\x05\x02\x00\x00\x13\x02\x00\x00\x1f\x02\x00\x00\x2b\x02\x00\x00"
+            "\x35\x02\x00\x00\x42\x02\x00\x00\x4e\x02\x00\x00\x66\x02\x00\x00\x7d\x02\x00\x00\x90\x02\x00\x00\xa4\x02\x00\x00\xb8\x02\x00\x00"
+            "\xc4\x02\x00\x00\xd6\x02\x00\x00\xe9\x02\x00\x00\xf8\x02\x00\x00\x04\x03\x00\x00\x10\x03\x00\x00\x20\x03\x00\x00\x2c\x03\x00\x00"
+            "\x38\x03\x00\x00\x45\x03\x00\x00\x57\x03\x00\x00\x6a\x03\x00\x00\x78\x03\x00\x00\x84\x03\x00\x00\x90\x03\x00\x00\x9c\x03\x00\x00"
+            "\xa8\x03\x00\x00\xb4\x03\x00\x00\xc7\x03\x00\x00\xdb\x03\x00\x00\xef\x03\x00\x00\x03\x04\x00\x00\x10\x04\x00\x00\x1c\x04\x00\x00"
+            "\x2e\x04\x00\x00\x48\x04\x00\x00\x5a\x04\x00\x00\x6d\x04\x00\x00\x79\x04\x00\x00\x84\x04\x00\x00\x90\x04\x00\x00\x9e\x04\x00\x00"
+            "\xad\x04\x00\x00\xbc\x04\x00\x00\xcb\x04\x00\x00\xd5\x04\x00\x00\xe4\x04\x00\x00\xf0\x04\x00\x00\xfc\x04\x00\x00\x17\x05\x00\x00"
+            "\x32\x05\x00\x00\x3e\x05\x00\x00\x49\x05\x00\x00\x5f\x05\x00\x00\x72\x05\x00\x00\x86\x05\x00\x00\x9a\x05\x00\x00\xae\x05\x00\x00"
+            "\xc2\x05\x00\x00\xd4\x05\x00\x00\xf7\x05\x00\x00\x09\x06\x00\x00\x1a\x06\x00\x00\x29\x06\x00\x00\x38\x06\x00\x00\x4a\x06\x00\x00"
+            "\x77\x06\x00\x00\x92\x06\x00\x00\xa8\x06\x00\x00\xb4\x06\x00\x00\xc0\x06\x00\x00\xcc\x06\x00\x00\xd8\x06\x00\x00\xe5\x06\x00\x00"
+            "\xf1\x06\x00\x00\xfd\x06\x00\x00\x09\x07\x00\x00\x14\x07\x00\x00\x23\x07\x00\x00\x2f\x07\x00\x00\x3b\x07\x00\x00\x47\x07\x00\x00"
+            "\x53\x07\x00\x00\x5e\x07\x00\x00\x71\x07\x00\x00\x84\x07\x00\x00\x94\x07\x00\x00\x9f\x07\x00\x00\xb0\x07\x00\x00\xbb\x07\x00\x00"
+            "\xc6\x07\x00\x00\xd1\x07\x00\x00\xdc\x07\x00\x00\xe7\x07\x00\x00\xf2\x07\x00\x00\xfd\x07\x00\x00\x09\x08\x00\x00\x15\x08\x00\x00"
+            "\x21\x08\x00\x00\x2d\x08\x00\x00\x39\x08\x00\x00\x45\x08\x00\x00\x51\x08\x00\x00\x5d\x08\x00\x00\x69\x08\x00\x00\x75\x08\x00\x00"
+            "\x81\x08\x00\x00\x8d\x08\x00\x00\x9b\x08\x00\x00\xaa\x08\x00\x00\xba\x08\x00\x00\xca\x08\x00\x00\xdc\x08\x00\x00\xeb\x08\x00\x00"
+            "\xfd\x08\x00\x00\x0f\x09\x00\x00\x22\x09\x00\x00\x42\x6f\x72\x67\x6f\x20\x46\x6f\x67\x6c\x69\x61\x6e\x6f\x76\x61\x00\x50\x65\x72"
+            "\x63\x6f\x72\x73\x6f\x20\x32\x39\x00\x46\x69\x6f\x72\x70\x65\x73\x63\x6f\x70\x6f\x6c\x69\x1a\x00\x27\x33\x30\x0c\x00\x71\x31\x00"
+            "\x56\x69\x6f\x6c\x61\x22\x00\xc7\x54\x6f\x72\x72\x65\x20\x53\x70\x72\x6f\x75\x74\x23\x00\xfc\x0a\x32\x00\x52\x6f\x76\x69\x6e\x65"
+            "\x20\x64\x27\x41\x6c\x66\x61\x20\x28\x45\x73\x74\x65\x72\x6e\x6f\x29\x18\x00\xff\x0b\x49\x6e\x73\x69\x64\x65\x29\x00\x47\x72\x6f"
+            "\x74\x74\x61\x20\x64\x69\x20\x6d\x65\x7a\x7a\x6f\x20\x50\x31\x13\x00\x00\x1e\x53\x14\x00\x27\x32\x53\x76\x00\x40\x33\x00\x50\x6f"
+            "\x16\x00\x80\x53\x4c\x4f\x57\x50\x4f\x4b\x45\x46\x00\x0d\x12\x00\x70\x53\x00\x42\x6f\x73\x63\x6f\x44\x00\x48\x4c\x65\x63\x63\xe5"
+            "\x00\x17\x34\x0c\x00\xf7\x02\x35\x00\x50\x61\x72\x63\x6f\x20\x4e\x61\x7a\x69\x6f\x6e\x61\x6c\x65\x1c\x00\x17\x36\x0c\x00\x92\x37"
+            "\x00\x41\x6d\x61\x72\x61\x6e\x74\x32\x01\x02\x10\x01\x80\x42\x72\x75\x63\x69\x61\x74\x61\x81\x00\x0d\x12\x00\x13\x53\x13\x00\x67"
+            "\x43\x61\x6d\x70\x61\x6e\x7f\x01\x27\x33\x38\x0c\x00\x8b\x39\x00\x4f\x6c\x69\x76\x69\x6e\x89\x01\x17\x34\x89\x01\xf0\x03\x34\x31"
+            "\x00\x49\x73\x6f\x6c\x65\x20\x56\x6f\x72\x74\x69\x63\x6f\x73\x65\x70\x00\x0e\x13\x00\x1e\x53\x14\x00\x1f\x32\x14\x00\x00\x21\x33"
+            "\x53\xfe\x01\x3c\x6c\x69\x73\x74\x00\xf1\x00\x32\x00\x4d\x6f\x6e\x74\x65\x20\x53\x63\x6f\x64\x65\x6c\x6c\xd7\x00\x0d\x12\x00\x8d"
+            "\x20\x28\x52\x65\x74\x72\x6f\x29\x1a\x00\x0f\x3e\x00\x00\x07\xb5\x01\xc7\x34\x33\x00\x4c\x61\x67\x6f\x20\x64\x27\x49\x72\x0c\x01"
+            "\xa3\x34\x34\x00\x56\x69\x61\x20\x47\x65\x6c\x47\x01\x09\x0e\x00\x19\x53\x0f\x00\x1a\x32\x0f\x00\x63\x33\x53\x00\x45\x62\x61\x39"
+            "\x01\xe7\x54\x61\x6e\x61\x20\x64\x65\x6c\x20\x44\x72\x61\x67\x6f\x60\x00\x17\x35\x0c\x00\x14\x36\x58\x02\x77\x53\x63\x75\x72\x61"
+            "\x20\x28\xeb\x02\x05\x9a\x02\x0c\x1b\x00\x37\x34\x35\x29\x42\x00\x13\x37\xe4\x00\x47\x4c\x75\x6e\x61\x0b\x00\xb3\x20\x28\x43\x6c"
+            "\x65\x66\x61\x69\x72\x79\x29\x70\x01\x60\x53\x70\x75\x6d\x61\x72\x02\x03\x05\xab\x01\x08\x13\x00\x04\x97\x01\x07\x14\x00\x05\xab"
+            "\x01\x07\x14\x00\x1f\x33\x14\x00\x00\x15\x34\x1e\x03\x68\x41\x72\x67\x65\x6e\x74\x44\x03\x04\x12\x00\x23\x2d\x20\x11\x00\x61\x69"
+            "\x6e\x20\x43\x69\x6d\x59\x01\x0c\x35\x00\xf4\x03\x34\x00\x49\x6e\x67\x72\x65\x73\x73\x6f\x20\x46\x61\x6c\x65\x73\x69\x61\x23\x00"
+            "\x0b\x0f\x00\x03\x32\x00\x0d\x41\x00\x1f\x32\x76\x00\x06\xa1\x6e\x65\x6c\x20\x50\x65\x6e\x64\x69\x6f\x93\x01\x01\x28\x01\x0f\x2d"
+            "\x00\x06\x2e\x50\x33\x1b\x00\x00\xb4\x00\x06\x76\x01\x27\x31\x32\x0c\x00\x17\x39\xc7\x04\xf2\x06\x30\x00\x42\x69\x61\x6e\x63\x61"
+            "\x76\x69\x6c\x6c\x61\x00\x53\x6d\x65\x72\x61\x6c\x64\x10\x02\x53\x43\x65\x6c\x65\x73\xac\x03\x63\x41\x72\x61\x6e\x63\x69\x0c\x00"
+            "\x52\x7a\x7a\x75\x72\x72\x0c\x00\x52\x46\x75\x63\x73\x69\xdf\x04\x00\x66\x01\x60\x61\x20\x43\x61\x6e\x6e\xba\x02\x07\xf1\x01\x07"
+            "\xab\x03\x17\x32\x0f\x04\x27\x32\x37\x0c\x00\x18\x38\x15\x02\x20\x54\x75\x44\x00\x81\x20\x52\x6f\x63\x63\x69\x6f\x73\x9d\x01\x0d"
+            "\x13\x00\x11\x32\xc8\x02\x71\x56\x69\x74\x74\x6f\x72\x69\x9d\x01\x06\xe0\x00\x07\x58\x00\x57\x20\x28\x53\x75\x64\x7e\x02\x17\x33"
+            "\x98\x00\x06\x0b\x00\x07\xe1\x02\x07\xa1\x00\x07\xa0\x00\x07\xc3\x00\x07\x3d\x01\x17\x31\x61\x04\x18\x31\x81\x00\x07\x66\x00\x17"
+            "\x31\x67\x00\x17\x31\x68\x00\x17\x31\x69\x00\x17\x31\x6a\x00\x18\x31\x2e\x01\x08\xca\x00\x07\xc1\x01\x17\x32\x54\x00\xf5\x00\x32"
+            "\x35\x00\x43\x61\x73\x63\x61\x74\x65\x20\x54\x6f\x68\x6a\x63\x02\x7b\x44\x49\x47\x4c\x45\x54\x54\x26\x01\x0c\x36\x01\x07\xa9\x00"
+            "\x83\x32\x20\x28\x4e\x6f\x72\x64\x29\xf3\x05\x04\x0a\x02\x04\x50\x00\x02\x0d\x02\x01\x8b\x03\x0c\x12\x00\x05\xc5\x02\x06\x24\x00"
+            "\x20\x53\x00",
+            1379, 2338
+        },
+        // natures_it
+        {
+            "\xf0\x95\x19\x00\x00\x00\x6c\x00\x00\x00\x73\x00\x00\x00\x7a\x00\x00\x00\x81\x00\x00\x00\x88\x00\x00\x00\x90\x00\x00\x00\x97\x00"
+            "\x00\x00\x9e\x00\x00\x00\xa6\x00\x00\x00\xae\x00\x00\x00\xb5\x00\x00\x00\xbc\x00\x00\x00\xc2\x00\x00\x00\xc8\x00\x00\x00\xd0\x00"
+            "\x00\x00\xd8\x00\x00\x00\xe0\x00\x00\x00\xe5\x00\x00\x00\xec\x00\x00\x00\xf4\x00\x00\x00\xfc\x00\x00\x00\x02\x01\x00\x00\x0a\x01"
+            "\x00\x00\x11\x01\x00\x00\x17\x01\x00\x00\x1d\x01\x00\x00\x41\x72\x64\x69\x74\x61\x00\x53\x63\x68\x69\x76\x61\x00\x41\x75\x64\x61"
+            "\x63\x65\x00\x44\x65\x63\x69\x73\x61\x00\x42\x69\x72\x62\x6f\x6e\x61\x00\x53\x69\x63\x75\x72\x61\x00\x44\x6f\x63\x69\x6c\x65\x00"
+            "\x50\x6c\x61\x63\x69\x64\x33\x00\xf0\x01\x61\x6c\x74\x72\x61\x00\x46\x69\x61\x63\x63\x61\x00\x54\x69\x6d\x16\x00\x30\x4c\x65\x73"
+            "\x4f\x00\xf1\x09\x65\x72\x69\x61\x00\x41\x6c\x6c\x65\x67\x72\x61\x00\x49\x6e\x67\x65\x6e\x75\x61\x00\x4d\x6f\x64\x1e\x00\xf0\x04"
+            "\x4d\x69\x74\x65\x00\x51\x75\x69\x65\x74\x61\x00\x52\x69\x74\x72\x6f\x73\x61\x88\x00\xf0\x00\x65\x6e\x74\x65\x00\x43\x61\x6c\x6d"
+            "\x61\x00\x47\x65\x6e\x74\x6c\x00\x30\x56\x69\x76\x90\x00\xc0\x43\x61\x75\x74\x61\x00\x46\x75\x72\x62\x61\x00",
+            283, 285
+        },
+        // powers_it
+        {
+            "\xf0\x6f\x10\x00\x00\x00\x48\x00\x00\x00\x4e\x00\x00\x00\x56\x00\x00\x00\x5d\x00\x00\x00\x63\x00\x00\x00\x6a\x00\x00\x00\x75\x00"
+            "\x00\x00\x7d\x00\x00\x00\x85\x00\x00\x00\x8b\x00\x00\x00\x91\x00\x00\x00\x96\x00\x00\x00\x9e\x00\x00\x00\xa4\x00\x00\x00\xad\x00"
+            "\x00\x00\xb3\x00\x00\x00\xb8\x00\x00\x00\x4c\x6f\x74\x74\x61\x00\x56\x6f\x6c\x61\x6e\x74\x65\x00\x56\x65\x6c\x65\x6e\x6f\x00\x54"
+            "\x65\x72\x72\x61\x00\x52\x6f\x63\x63\x69\x61\x00\x43\x6f\x6c\x65\x6f\x74\x74\x65\x72\x6f\x00\x53\x70\x65\x74\x74\x72\x6f\x00\x41"
+            "\x19\x00\x70\x69\x6f\x00\x46\x75\x6f\x63\x0e\x00\xb2\x71\x75\x61\x00\x45\x72\x62\x61\x00\x45\x6c\x21\x00\xf0\x0b\x50\x73\x69\x63"
+            "\x6f\x00\x47\x68\x69\x61\x63\x63\x69\x6f\x00\x44\x72\x61\x67\x6f\x00\x42\x75\x69\x6f\x00",
+            182, 184
+        },
+        // rse_it
+        {
+            "\xf7\xff\x78\x56\x00\x00\x00\x60\x01\x00\x00\x69\x01\x00\x00\x70\x01\x00\x00\x7b\x01\x00\x00\x8b\x01\x00\x00\x9b\x01\x00\x00\xa9"
+            "\x01\x00\x00\xb2\x01\x00\x00\xbc\x01\x00\x00\xc9\x01\x00\x00\xd6\x01\x00\x00\xe3\x01\x00\x00\xf0\x01\x00\x00\xfd\x01\x00\x00\x0a"
+            "\x02\x00\x00\x17\x02\x00\x00\x24\x02\x00\x00\x31\x02\x00\x00\x3e\x02\x00\x00\x4b\x02\x00\x00\x58\x02\x00\x00\x65\x02\x00\x00\x72"
+            "\x02\x00\x00\x7f\x02\x00\x00\x8c\x02\x00\x00\x99\x02\x00\x00\xa6\x02\x00\x00\xb3\x02\x00\x00\xc0\x02\x00\x00\xcd\x02\x00\x00\xda"
+            "\x02\x00\x00\xe7\x02\x00\x00\xf4\x02\x00\x00\x01\x03\x00\x00\x0e\x03\x00\x00\x1b\x03\x00\x00\x28\x03\x00\x00\x35\x03\x00\x00\x42"
+            "\x03\x00\x00\x4f\x03\x00\x00\x5c\x03\x00\x00\x69\x03\x00\x00\x76\x03\x00\x00\x90\x03\x00\x00\xaa\x03\x00\x00\xbd\x03\x00\x00\xdf"
+            "\x03\x00\x00\xf3\x03\x00\x00\x07\x04\x00\x00\x1c\x04\x00\x00\x31\x04\x00\x00\x46\x04\x00\x00\x5b\x04\x00\x00\x70\x04\x00\x00\x85"
+            "\x04\x00\x00\x92\x04\x00\x00\xa2\x04\x00\x00\xaf\x04\x00\x00\xc3\x04\x00\x00\xdb\x04\x00\x00\xf1\x04\x00\x00\x07\x05\x00\x00\x1e"
+            "\x05\x00\x00\x35\x05\x00\x00\x57\x05\x00\x00\x68\x05\x00\x00\x79\x05\x00\x00\x8e\x05\x00\x00\xa0\x05\x00\x00\xae\x05\x00\x00\xd0"
+            "\x05\x00\x00\xdf\x05\x00\x00\xef\x05\x00\x00\x00\x06\x00\x00\x11\x06\x00\x00\x2c\x06\x00\x00\x3d\x06\x00\x00\x4d\x06\x00\x00\x5d"
+            "\x06\x00\x00\x70\x06\x00\x00\x83\x06\x00\x00\x96\x06\x00\x00\xa4\x06\x00\x00\xb3\x06\x00\x00\xc4\x06\x00\x00\xd5\x06\x00\x00\xe5"
+            "\x06\x00\x00\x42\x6c\x75\x72\x75\x76\x69\x61\x00\x4f\x72\x6f\x63\x65\x61\x00\x50\x65\x74\x61\x6c\x69\x70\x6f\x6c\x69\x00\x50\x6f"
+            "\x72\x74\x6f\x20\x53\x65\x6c\x63\x65\x10\x00\x42\x41\x6c\x67\x68\x10\x00\x91\x56\x65\x72\x64\x65\x61\x7a\x7a\x75\x0e\x00\xe2\x43"
+            "\x65\x6e\x65\x72\x69\x64\x65\x00\x49\x72\x69\x64\x6f\x31\x00\xb8\x65\x72\x63\x6f\x72\x73\x6f\x20\x31\x30\x31\x0d\x00\x18\x32\x0d"
+            "\x00\x18\x33\x0d\x00\x18\x34\x0d\x00\x18\x35\x0d\x00\x18\x36\x0d\x00\x18\x37\x0d\x00\x18\x38\x0d\x00\x17\x39\x0d\x00\x28\x31\x30"
+            "\x0d\x00\x08\x82\x00\x18\x31\x82\x00\x18\x31\x82\x00\x18\x31\x82\x00\x18\x31\x82\x00\x18\x31\x82\x00\x18\x31\x82\x00\x18\x31\x82"
+            "\x00\x18\x31\x82\x00\x18\x32\x82\x00\x18\x32\x82\x00\x18\x32\x82\x00\x18\x32\x82\x00\x18\x32\x82\x00\x18\x32\x82\x00\x18\x32\x82"
+            "\x00\x18\x32\x82\x00\x18\x32\x82\x00\x18\x32\x82\x00\x18\x33\x82\x00\x18\x33\x82\x00\x18\x33\x82\x00\x18\x33\x82\x00\xf8\x00\x33"
+            "\x34\x00\x53\x6f\x74\x74\x27\x61\x63\x71\x75\x61\x20\x28\x9b\x00\x1f\x29\x1a\x00\x05\xfd\x06\x36\x29\x00\x47\x72\x6f\x74\x74\x61"
+            "\x20\x50\x69\x65\x74\x72\x6f\x73\x61\x20\x50\x31\x13\x00\xff\x02\x2d\x20\x53\x74\x61\x6e\x7a\x61\x20\x64\x69\x20\x52\x6f\x63\x63"
+            "\x6f\x35\x00\x00\x1e\x53\x14\x00\xff\x08\x32\x53\x00\x53\x61\x66\x61\x72\x69\x20\x5a\x6f\x6e\x65\x20\x2d\x20\x41\x72\x65\x61\x20"
+            "\x31\x15\x00\x01\x1f\x32\x15\x00\x01\x1f\x33\x15\x00\x01\x1f\x34\x15\x00\x01\x1f\x35\x15\x00\x01\x81\x36\x00\x42\x6f\x73\x63\x6f"
+            "\x20\x1b\x03\xf8\x23\x6f\x00\x54\x75\x6e\x6e\x65\x6c\x20\x4d\x65\x6e\x66\x65\x72\x72\x6f\x00\x56\x65\x63\x63\x68\x69\x61\x20\x4e"
+            "\x61\x76\x65\x00\x43\x69\x63\x6c\x61\x6e\x6f\x76\x61\x20\x28\x45\x6e\x74\x72\x61\x74\x61\x29\x14\x00\x00\x3e\x01\xf0\x08\x65\x72"
+            "\x72\x61\x6e\x65\x69\x29\x00\x43\x61\x73\x63\x61\x74\x65\x20\x4d\x65\x74\x65\x6f\x72\xfc\x00\x3f\x20\x31\x53\x16\x00\x01\x1f\x32"
+            "\x16\x00\x01\x1f\x53\x2d\x00\x03\x1f\x53\x2e\x00\x01\x0e\x78\x01\x81\x4d\x6f\x6e\x74\x65\x20\x50\x69\x34\x00\x39\x2d\x50\x33\x11"
+            "\x00\x48\x34\x2d\x50\x36\x11\x00\x89\x2d\x20\x45\x73\x74\x65\x72\x6e\x37\x00\x64\x2d\x20\x43\x69\x6d\x61\xad\x01\x5b\x4f\x6e\x64"
+            "\x6f\x73\x0e\x00\x06\x77\x00\xf1\x16\x47\x68\x69\x61\x63\x63\x69\x61\x74\x61\x00\x41\x6e\x74\x72\x6f\x20\x41\x62\x69\x73\x73\x61"
+            "\x6c\x65\x00\x56\x69\x61\x20\x56\x69\x74\x74\x6f\x72\x69\x32\x02\x0b\x10\x00\x1b\x53\x11\x00\x15\x32\x1e\x02\x90\x64\x65\x69\x20"
+            "\x54\x65\x6d\x70\x69\x9e\x00\x02\x6a\x01\x0d\x1b\x00\xf1\x06\x00\x43\x61\x6d\x6d\x69\x6e\x6f\x20\x41\x72\x64\x65\x6e\x74\x65\x00"
+            "\x50\x61\x73\x73\xd2\x04\xc1\x76\x61\x67\x67\x69\x6f\x00\x54\x6f\x72\x72\x65\x30\x00\x50\x43\x69\x65\x6c\x69\x81\x00\x0d\x13\x00"
+            "\x1e\x33\x13\x00\xf3\x00\x35\x00\x52\x69\x66\x75\x67\x69\x6f\x20\x4d\x61\x67\x6d\x61\x21\x00\x32\x4d\x69\x72\x56\x00\x03\x87\x00"
+            "\xf0\x00\x41\x72\x74\x69\x73\x74\x69\x63\x61\x00\x47\x61\x6c\x6c\x65\xc0\x00\x65\x44\x65\x73\x65\x72\x74\x22\x00\x90\x4d\x75\x74"
+            "\x65\x76\x6f\x6c\x65\x00",
+            1062, 1765
+        },
+        // species_it
+        {
+            "\xf1\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xae\x27\x03\x00\x00\xa4\x0c\x00\x00\xae\x0c\x00\x00\xb6\x0c\x00\x00\xbf\x0c"
+            "\x00\x00\xca\x0c\x00\x00\xd5\x0c\x00\x00\xdf\x0c\x00\x00\xe8\x0c\x00\x00\xf2\x0c\x00\x00\xfc\x0c\x00\x00\x05\x0d\x00\x00\x0d\x0d"
+            "\x00\x00\x18\x0d\x00\x00\x1f\x0d\x00\x00\x26\x0d\x00\x00\x2f\x0d\x00\x00\x36\x0d\x00\x00\x40\x0d\x00\x00\x48\x0d\x00\x00\x50\x0d"
+            "\x00\x00\x59\x0d\x00\x00\x61\x0d\x00\x00\x68\x0d\x00\x00\x6e\x0d\x00\x00\x74\x0d\x00\x00\x7c\x0d\x00\x00\x83\x0d\x00\x00\x8d\x0d"
+            "\x00\x00\x97\x0d\x00\x00\xa2\x0d\x00\x00\xab\x0d\x00\x00\xb5\x0d\x00\x00\xc0\x0d\x00\x00\xc9\x0d\x00\x00\xd2\x0d\x00\x00\xdb\x0d"
+            "\x00\x00\xe4\x0d\x00\x00\xeb\x0d\x00\x00\xf5\x0d\x00\x00\x00\x0e\x00\x00\x0b\x0e\x00\x00\x11\x0e\x00\x00\x18\x0e\x00\x00\x1f\x0e"
+            "\x00\x00\x25\x0e\x00\x00\x2f\x0e\x00\x00\x35\x0e\x00\x00\x3e\x0e\x00\x00\x46\x0e\x00\x00\x4f\x0e\x00\x00\x57\x0e\x00\x00\x5f\x0e"
+            "\x00\x00\x66\x0e\x00\x00\x6e\x0e\x00\x00\x76\x0e\x00\x00\x7e\x0e\x00\x00\x85\x0e\x00\x00\x8e\x0e\x00\x00\x98\x0e\x00\x00\xa1\x0e"
+            "\x00\x00\xa9\x0e\x00\x00\xb3\x0e\x00\x00\xbd\x0e\x00\x00\xc2\x0e\x00\x00\xca\x0e\x00\x00\xd3\x0e\x00\x00\xda\x0e\x00\x00\xe2\x0e"
+            "\x00\x00\xea\x0e\x00\x00\xf5\x0e\x00\x00\x00\x0f\x00\x00\x0b\x0f\x00\x00\x15\x0f\x00\x00\x20\x0f\x00\x00\x28\x0f\x00\x00\x31\x0f"
+            "\x00\x00\x37\x0f\x00\x00\x3e\x0f\x00\x00\x47\x0f\x00\x00\x50\x0f\x00\x00\x58\x0f\x00\x00\x62\x0f\x00\x00\x6b\x0f\x00\x00\x78\x0f"
+            "\x00\x00\x7e\x0f\x00\x00\x85\x0f\x00\x00\x8a\x0f\x00\x00\x92\x0f\x00\x00\x99\x0f\x00\x00\x9d\x0f\x00\x00\xa6\x0f\x00\x00\xaf\x0f"
+            "\x00\x00\xb6\x0f\x00\x00\xbe\x0f\x00\x00\xc5\x0f\x00\x00\xca\x0f\x00\x00\xd2\x0f\x00\x00\xd8\x0f\x00\x00\xdf\x0f\x00\x00\xe7\x0f"
+            "\x00\x00\xef\x0f\x00\x00\xf9\x0f\x00\x00\x03\x10\x00\x00\x0d\x10\x00\x00\x14\x10\x00\x00\x1c\x10\x00\x00\x26\x10\x00\x00\x31\x10"
+            "\x00\x00\x3b\x10\x00\x00\x43\x10\x00\x00\x4b\x10\x00\x00\x53\x10\x00\x00\x5a\x10\x00\x00\x62\x10\x00\x00\x6a\x10\x00\x00\x75\x10"
+            "\x00\x00\x7c\x10\x00\x00\x83\x10\x00\x00\x8b\x10\x00\x00\x93\x10\x00\x00\x9a\x10\x00\x00\xa2\x10\x00\x00\xab\x10\x00\x00\xb3\x10"
+            "\x00\x00\xb8\x10\x00\x00\xc3\x10\x00\x00\xca\x10\x00\x00\xd1\x10\x00\x00\xd8\x10\x00\x00\xe1\x10\x00\x00\xea\x10\x00\x00\xf1\x10"
+            "\x00\x00\xf7\x10\x00\x00\xfd\x10\x00\x00\x06\x11\x00\x00\x0e\x11\x00\x00\x16\x11\x00\x00\x1e\x11\x00\x00\x26\x11\x00\x00\x2e\x11"
+            "\x00\x00\x35\x11\x00\x00\x3e\x11\x00\x00\x49\x11\x00\x00\x51\x11\x00\x00\x5a\x11\x00\x00\x61\x11\x00\x00\x69\x11\x00\x00\x71\x11"
+            "\x00\x00\x7b\x11\x00\x00\x85\x11\x00\x00\x8c\x11\x00\x00\x90\x11\x00\x00\x9a\x11\x00\x00\xa2\x11\x00\x00\xab\x11\x00\x00\xb5\x11"
+            "\x00\x00\xbd\x11\x00\x00\xc8\x11\x00\x00\xd1\x11\x00\x00\xda\x11\x00\x00\xe5\x11\x00\x00\xed\x11\x00\x00\xf4\x11\x00\x00\xfd\x11"
+            "\x00\x00\x05\x12\x00\x00\x0c\x12\x00\x00\x13\x12\x00\x00\x1c\x12\x00\x00\x24\x12\x00\x00\x2b\x12\x00\x00\x34\x12\x00\x00\x3c\x12"
+            "\x00\x00\x42\x12\x00\x00\x49\x12\x00\x00\x53\x12\x00\x00\x5a\x12\x00\x00\x62\x12\x00\x00\x67\x12\x00\x00\x6c\x12\x00\x00\x73\x12"
+            "\x00\x00\x7b\x12\x00\x00\x84\x12\x00\x00\x8e\x12\x00\x00\x95\x12\x00\x00\x9f\x12\x00\x00\xa9\x12\x00\x00\xb2\x12\x00\x00\xb9\x12"
+            "\x00\x00\xc2\x12\x00\x00\xcb\x12\x00\x00\xd1\x12\x00\x00\xd9\x12\x00\x00\xe2\x12\x00\x00\xe8\x12\x00\x00\xef\x12\x00\x00\xf8\x12"
+            "\x00\x00\xff\x12\x00\x00\x07\x13\x00\x00\x0f\x13\x00\x00\x18\x13\x00\x00\x23\x13\x00\x00\x29\x13\x00\x00\x33\x13\x00\x00\x3d\x13"
+            "\x00\x00\x44\x13\x00\x00\x4f\x13\x00\x00\x59\x13\x00\x00\x60\x13\x00\x00\x68\x13\x00\x00\x71\x13\x00\x00\x7a\x13\x00\x00\x83\x13"
+            "\x00\x00\x8a\x13\x00\x00\x92\x13\x00\x00\x9c\x13\x00\x00\xa4\x13\x00\x00\xae\x13\x00\x00\xb7\x13\x00\x00\xbe\x13\x00\x00\xc7\x13"
+            "\x00\x00\xce\x13\x00\x00\xd8\x13\x00\x00\xe0\x13\x00\x00\xe9\x13\x00\x00\xf3\x13\x00\x00\xfc\x13\x00\x00\x04\x14\x00\x00\x0d\x14"
+            "\x00\x00\x16\x14\x00\x00\x1f\x14\x00\x00\x27\x14\x00\x00\x2e\x14\x00\x00\x36\x14\x00\x00\x3f\x14\x00\x00\x48\x14\x00\x00\x51\x14"
+            "\x00\x00\x59\x14\x00\x00\x63\x14\x00\x00\x6c\x14\x00\x00\x73\x14\x00\x00\x79\x14\x00\x00\x81\x14\x00\x00\x89\x14\x00\x00\x90\x14"
+            "\x00\x00\x96\x14\x00\x00\x9e\x14\x00\x00\xa7\x14\x00\x00\xaf\x14\x00\x00\xb9\x14\x00\x00\xbf\x14\x00\x00\xc5\x14\x00\x00\xcc\x14"
+            "\x00\x00\xd4\x14\x00\x00\xdc\x14\x00\x00\xe5\x14\x00\x00\xed\x14\x00\x00\xf7\x14\x00\x00\x00\x15\x00\x00\x07\x15\x00\x00\x11\x15"
+            "\x00\x00\x1a\x15\x00\x00\x24\x15\x00\x00\x2e\x15\x00\x00\x38\x15\x00\x00\x40\x15\x00\x00\x48\x15\x00\x00\x50\x15\x00\x00\x5a\x15"
+            "\x00\x00\x62\x15\x00\x00\x69\x15\x00\x00\x6f\x15\x00\x00\x76\x15\x00\x00\x7f\x15\x00\x00\x86\x15\x00\x00\x8e\x15\x00\x00\x96\x15"
+            "\x00\x00\x9e\x15\x00\x00\xa6\x15\x00\x00\xae\x15\x00\x00\xb7\x15\x00\x00\xbd\x15\x00\x00\xc4\x15\x00\x00\xce\x15\x00\x00\xd6\x15"
+            "\x00\x00\xe1\x15\x00\x00\xeb\x15\x00\x00\xf3\x15\x00\x00\xfb\x15\x00\x00\x04\x16\x00\x00\x0c\x16\x00\x00\x14\x16\x00\x00\x1c\x16"
+            "\x00\x00\x25\x16\x00\x00\x2d\x16\x00\x00\x35\x16\x00\x00\x3d\x16\x00\x00\x46\x16\x00\x00\x4f\x16\x00\x00\x57\x16\x00\x00\x60\x16"
+            "\x00\x00\x67\x16\x00\x00\x70\x16\x00\x00\x78\x16\x00\x00\x7f\x16\x00\x00\x84\x16\x00\x00\x8b\x16\x00\x00\x92\x16\x00\x00\x9b\x16"
+            "\x00\x00\xa4\x16\x00\x00\xae\x16\x00\x00\xb8\x16\x00\x00\xbf\x16\x00\x00\xc5\x16\x00\x00\xcd\x16\x00\x00\xd6\x16\x00\x00\xde\x16"
+            "\x00\x00\xe5\x16\x00\x00\xec\x16\x00\x00\xf5\x16\x00\x00\xfe\x16\x00\x00\x06\x17\x00\x00\x0e\x17\x00\x00\x14\x17\x00\x00\x1d\x17"
+            "\x00\x00\x25\x17\x00\x00\x2c\x17\x00\x00\x34\x17\x00\x00\x3b\x17\x00\x00\x44\x17\x00\x00\x4c\x17\x00\x00\x53\x17\x00\x00\x5a\x17"
+            "\x00\x00\x63\x17\x00\x00\x6a\x17\x00\x00\x72\x17\x00\x00\x7b\x17\x00\x00\x83\x17\x00\x00\x8c\x17\x00\x00\x94\x17\x00\x00\x9d\x17"
+            "\x00\x00\xa6\x17\x00\x00\xaf\x17\x00\x00\xb9\x17\x00\x00\xc0\x17\x00\x00\xc8\x17\x00\x00\xcf\x17\x00\x00\xd7\x17\x00\x00\xdf\x17"
+            "\x00\x00\xe7\x17\x00\x00\xee\x17\x00\x00\xf6\x17\x00\x00\xff\x17\x00\x00\x07\x18\x00\x00\x0f\x18\x00\x00\x17\x18\x00\x00\x1f\x18"
+            "\x00\x00\x28\x18\x00\x00\x30\x18\x00\x00\x39\x18\x00\x00\x3f\x18\x00\x00\x46\x18\x00\x00\x4e\x18\x00\x00\x55\x18\x00\x00\x5c\x18"
+            "\x00\x00\x63\x18\x00\x00\x6b\x18\x00\x00\x74\x18\x00\x00\x7c\x18\x00\x00\x85\x18\x00\x00\x8f\x18\x00\x00\x97\x18\x00\x00\x9d\x18"
+            "\x00\x00\xa5\x18\x00\x00\xaf\x18\x00\x00\xb6\x18\x00\x00\xbd\x18\x00\x00\xc7\x18\x00\x00\xd0\x18\x00\x00\xd7\x18\x00\x00\xe1\x18"
+            "\x00\x00\xe8\x18\x00\x00\xef\x18\x00\x00\xf6\x18\x00\x00\xfe\x18\x00\x00\x07\x19\x00\x00\x0f\x19\x00\x00\x16\x19\x00\x00\x1e\x19"
+            "\x00\x00\x25\x19\x00\x00\x2e\x19\x00\x00\x37\x19\x00\x00\x40\x19\x00\x00\x4a\x19\x00\x00\x51\x19\x00\x00\x5a\x19\x00\x00\x63\x19"
+            "\x00\x00\x6a\x19\x00\x00\x73\x19\x00\x00\x7d\x19\x00\x00\x84\x19\x00\x00\x8c\x19\x00\x00\x96\x19\x00\x00\xa1\x19\x00\x00\xa7\x19"
+            "\x00\x00\xad\x19\x00\x00\xb4\x19\x00\x00\xba\x19\x00\x00\xc3\x19\x00\x00\xcc\x19\x00\x00\xd6\x19\x00\x00\xdf\x19\x00\x00\xe9\x19"
+            "\x00\x00\xef\x19\x00\x00\xf8\x19\x00\x00\xff\x19\x00\x00\x06\x1a\x00\x00\x10\x1a\x00\x00\x1a\x1a\x00\x00\x21\x1a\x00\x00\x2a\x1a"
+            "\x00\x00\x32\x1a\x00\x00\x3a\x1a\x00\x00\x42\x1a\x00\x00\x4c\x1a\x00\x00\x54\x1a\x00\x00\x5d\x1a\x00\x00\x66\x1a\x00\x00\x6e\x1a"
+            "\x00\x00\x76\x1a\x00\x00\x80\x1a\x00\x00\x8a\x1a\x00\x00\x92\x1a\x00\x00\x9a\x1a\x00\x00\xa4\x1a\x00\x00\xab\x1a\x00\x00\xb4\x1a"
+            "\x00\x00\xbc\x1a\x00\x00\xc5\x1a\x00\x00\xcc\x1a\x00\x00\xd5\x1a\x00\x00\xdd\x1a\x00\x00\xe4\x1a\x00\x00\xee\x1a\x00\x00\xf4\x1a"
+            "\x00\x00\xfb\x1a\x00\x00\x04\x1b\x00\x00\x0d\x1b\x00\x00\x13\x1b\x00\x00\x1b\x1b\x00\x00\x26\x1b\x00\x00\x30\x1b\x00\x00\x38\x1b"
+            "\x00\x00\x40\x1b\x00\x00\x49\x1b\x00\x00\x53\x1b\x00\x00\x5d\x1b\x00\x00\x65\x1b\x00\x00\x6e\x1b\x00\x00\x76\x1b\x00\x00\x7d\x1b"
+            "\x00\x00\x87\x1b\x00\x00\x8f\x1b\x00\x00\x99\x1b\x00\x00\xa4\x1b\x00\x00\xae\x1b\x00\x00\xb8\x1b\x00\x00\xc3\x1b\x00\x00\xcd\x1b"
+            "\x00\x00\xd6\x1b\x00\x00\xde\x1b\x00\x00\xe6\x1b\x00\x00\xee\x1b\x00\x00\xf6\x1b\x00\x00\x00\x1c\x00\x00\x0a\x1c\x00\x00\x12\x1c"
+            "\x00\x00\x1c\x1c\x00\x00\x25\x1c\x00\x00\x2e\x1c\x00\x00\x34\x1c\x00\x00\x39\x1c\x00\x00\x41\x1c\x00\x00\x47\x1c\x00\x00\x4e\x1c"
+            "\x00\x00\x55\x1c\x00\x00\x5d\x1c\x00\x00\x67\x1c\x00\x00\x70\x1c\x00\x00\x7a\x1c\x00\x00\x81\x1c\x00\x00\x89\x1c\x00\x00\x91\x1c"
+            "\x00\x00\x99\x1c\x00\x00\xa0\x1c\x00\x00\xa8\x1c\x00\x00\xae\x1c\x00\x00\xb6\x1c\x00\x00\xc0\x1c\x00\x00\xc6\x1c\x00\x00\xce\x1c"
+            "\x00\x00\xd5\x1c\x00\x00\xde\x1c\x00\x00\xe5\x1c\x00\x00\xee\x1c\x00\x00\xf5\x1c\x00\x00\xfd\x1c\x00\x00\x06\x1d\x00\x00\x0e\x1d"
+            "\x00\x00\x18\x1d\x00\x00\x21\x1d\x00\x00\x29\x1d\x00\x00\x31\x1d\x00\x00\x3a\x1d\x00\x00\x42\x1d\x00\x00\x4b\x1d\x00\x00\x53\x1d"
+            "\x00\x00\x5c\x1d\x00\x00\x62\x1d\x00\x00\x6b\x1d\x00\x00\x72\x1d\x00\x00\x7c\x1d\x00\x00\x85\x1d\x00\x00\x8d\x1d\x00\x00\x97\x1d"
+            "\x00\x00\xa2\x1d\x00\x00\xaa\x1d\x00\x00\xb3\x1d\x00\x00\xba\x1d\x00\x00\xc2\x1d\x00\x00\xca\x1d\x00\x00\xd4\x1d\x00\x00\xdb\x1d"
+            "\x00\x00\xe3\x1d\x00\x00\xeb\x1d\x00\x00\xf6\x1d\x00\x00\xfe\x1d\x00\x00\x08\x1e\x00\x00\x13\x1e\x00\x00\x19\x1e\x00\x00\x1e\x1e"
+            "\x00\x00\x27\x1e\x00\x00\x30\x1e\x00\x00\x39\x1e\x00\x00\x42\x1e\x00\x00\x4d\x1e\x00\x00\x57\x1e\x00\x00\x60\x1e\x00\x00\x6b\x1e"
+            "\x00\x00\x73\x1e\x00\x00\x7d\x1e\x00\x00\x86\x1e\x00\x00\x8e\x1e\x00\x00\x97\x1e\x00\x00\xa2\x1e\x00\x00\xab\x1e\x00\x00\xb6\x1e"
+            "\x00\x00\xbf\x1e\x00\x00\xc7\x1e\x00\x00\xcf\x1e\x00\x00\xd7\x1e\x00\x00\xdf\x1e\x00\x00\xe8\x1e\x00\x00\xef\x1e\x00\x00\xfa\x1e"
+            "\x00\x00\x03\x1f\x00\x00\x0e\x1f\x00\x00\x15\x1f\x00\x00\x1e\x1f\x00\x00\x27\x1f\x00\x00\x30\x1f\x00\x00\x36\x1f\x00\x00\x3e\x1f"
+            "\x00\x00\x47\x1f\x00\x00\x50\x1f\x00\x00\x58\x1f\x00\x00\x62\x1f\x00\x00\x6d\x1f\x00\x00\x75\x1f\x00\x00\x7d\x1f\x00\x00\x87\x1f"
+            "\x00\x00\x90\x1f\x00\x00\x97\x1f\x00\x00\xa1\x1f\x00\x00\xab\x1f\x00\x00\xb5\x1f\x00\x00\xbe\x1f\x00\x00\xc7\x1f\x00\x00\xce\x1f"
+            "\x00\x00\xd9\x1f\x00\x00\xe4\x1f\x00\x00\xec\x1f\x00\x00\xf6\x1f\x00\x00\xff\x1f\x00\x00\x09\x20\x00\x00\x13\x20\x00\x00\x1a\x20"
+            "\x00\x00\x25\x20\x00\x00\x2f\x20\x00\x00\x3a\x20\x00\x00\x40\x20\x00\x00\x46\x20\x00\x00\x50\x20\x00\x00\x57\x20\x00\x00\x61\x20"
+            "\x00\x00\x6c\x20\x00\x00\x73\x20\x00\x00\x7c\x20\x00\x00\x84\x20\x00\x00\x8c\x20\x00\x00\x97\x20\x00\x00\x9c\x20\x00\x00\xa4\x20"
+            "\x00\x00\xac\x20\x00\x00\xb4\x20\x00\x00\xbc\x20\x00\x00\xc6\x20\x00\x00\xce\x20\x00\x00\xd7\x20\x00\x00\xe0\x20\x00\x00\xe8\x20"
+            "\x00\x00\xf1\x20\x00\x00\xfb\x20\x00\x00\x02\x21\x00\x00\x09\x21\x00\x00\x12\x21\x00\x00\x1a\x21\x00\x00\x25\x21\x00\x00\x2d\x21"
+            "\x00\x00\x36\x21\x00\x00\x3e\x21\x00\x00\x48\x21\x00\x00\x50\x21\x00\x00\x57\x21\x00\x00\x5d\x21\x00\x00\x66\x21\x00\x00\x70\x21"
+            "\x00\x00\x79\x21\x00\x00\x83\x21\x00\x00\x8c\x21\x00\x00\x96\x21\x00\x00\x9f\x21\x00\x00\xa8\x21\x00\x00\xb2\x21\x00\x00\xbb\x21"
+            "\x00\x00\xc2\x21\x00\x00\xcb\x21\x00\x00\xd2\x21\x00\x00\xd9\x21\x00\x00\xe2\x21\x00\x00\xeb\x21\x00\x00\xf3\x21\x00\x00\xfd\x21"
+            "\x00\x00\x08\x22\x00\x00\x11\x22\x00\x00\x19\x22\x00\x00\x21\x22\x00\x00\x29\x22\x00\x00\x33\x22\x00\x00\x3c\x22\x00\x00\x45\x22"
+            "\x00\x00\x4f\x22\x00\x00\x5a\x22\x00\x00\x66\x22\x00\x00\x71\x22\x00\x00\x7c\x22\x00\x00\x83\x22\x00\x00\x8c\x22\x00\x00\x93\x22"
+            "\x00\x00\x9a\x22\x00\x00\xa4\x22\x00\x00\xac\x22\x00\x00\xb4\x22\x00\x00\xbb\x22\x00\x00\xc2\x22\x00\x00\xca\x22\x00\x00\xd2\x22"
+            "\x00\x00\xda\x22\x00\x00\xe1\x22\x00\x00\xea\x22\x00\x00\xf2\x22\x00\x00\xfb\x22\x00\x00\x05\x23\x00\x00\x0e\x23\x00\x00\x19\x23"
+            "\x00\x00\x21\x23\x00\x00\x2a\x23\x00\x00\x30\x23\x00\x00\x38\x23\x00\x00\x40\x23\x00\x00\x4b\x23\x00\x00\x52\x23\x00\x00\x5b\x23"
+            "\x00\x00\x65\x23\x00\x00\x6f\x23\x00\x00\x7a\x23\x00\x00\x84\x23\x00\x00\x8b\x23\x00\x00\x95\x23\x00\x00\x9c\x23\x00\x00\xa4\x23"
+            "\x00\x00\xac\x23\x00\x00\xb5\x23\x00\x00\xbd\x23\x00\x00\xc5\x23\x00\x00\xcb\x23\x00\x00\xd3\x23\x00\x00\xda\x23\x00\x00\xe1\x23"
+            "\x00\x00\xea\x23\x00\x00\xf4\x23\x00\x00\xfe\x23\x00\x00\x08\x24\x00\x00\x11\x24\x00\x00\x19\x24\x00\x00\x20\x24\x00\x00\x28\x24"
+            "\x00\x00\x30\x24\x00\x00\x38\x24\x00\x00\x40\x24\x00\x00\x48\x24\x00\x00\x4e\x24\x00\x00\x58\x24\x00\x00\x5f\x24\x00\x00\x67\x24"
+            "\x00\x00\x71\x24\x00\x00\x78\x24\x00\x00\x81\x24\x00\x00\x8c\x24\x00\x00\x94\x24\x00\x00\x9c\x24\x00\x00\xa6\x24\x00\x00\xae\x24"
+            "\x00\x00\xb7\x24\x00\x00\xc1\x24\x00\x00\xc9\x24\x00\x00\xd2\x24\x00\x00\xda\x24\x00\x00\xe4\x24\x00\x00\xed\x24\x00\x00\xf8\x24"
+            "\x00\x00\x05\x25\x00\x00\x0e\x25\x00\x00\x17\x25\x00\x00\x20\x25\x00\x00\x29\x25\x00\x00\x32\x25\x00\x00\x3d\x25\x00\x00\x46\x25"
+            "\x00\x00\x4e\x25\x00\x00\x56\x25\x00\x00\x5f\x25\x00\x00\x68\x25\x00\x00\x72\x25\x00\x00\x7b\x25\x00\x00\x84\x25\x00\x00\x8d\x25"
+            "\x00\x00\x97\x25\x00\x00\xa0\x25\x00\x00\xa9\x25\x00\x00\xb1\x25\x00\x00\xb8\x25\x00\x00\xc2\x25\x00\x00\xca\x25\x00\x00\xd3\x25"
+            "\x00\x00\xda\x25\x00\x00\xe3\x25\x00\x00\xed\x25\x00\x00\xf4\x25\x00\x00\xfe\x25\x00\x00\x08\x26\x00\x00\x12\x26\x00\x00\x1c\x26"
+            "\x00\x00\x26\x26\x00\x00\x2f\x26\x00\x00\x36\x26\x00\x00\x3d\x26\x00\x00\x48\x26\x00\x00\x53\x26\x00\x00\x5b\x26\x00\x00\x63\x26"
+            "\x00\x00\x6a\x26\x00\x00\x73\x26\x00\x00\x7c\x26\x00\x00\x85\x26\x00\x00\x8d\x26\x00\x00\x97\x26\x00\x00\xa1\x26\x00\x00\xab\x26"
+            "\x00\x00\xb5\x26\x00\x00\xbc\x26\x00\x00\xc4\x26\x00\x00\xcd\x26\x00\x00\xd4\x26\x00\x00\xdd\x26\x00\x00\xe6\x26\x00\x00\xf0\x26"
+            "\x00\x00\xfa\x26\x00\x00\x05\x27\x00\x00\x0d\x27\x00\x00\x16\x27\x00\x00\x1f\x27\x00\x00\x28\x27\x00\x00\x32\x27\x00\x00\x3a\x27"
+            "\x00\x00\x44\x27\x00\x00\x4e\x27\x00\x00\x5a\x27\x00\x00\x62\x27\x00\x00\x42\x75\x6c\x62\x61\x73\x61\x75\x72\x00\x49\x76\x79\x08"
+            "\x00\x41\x56\x65\x6e\x75\x09\x00\x93\x43\x68\x61\x72\x6d\x61\x6e\x64\x65\x0b\x00\x51\x65\x6c\x65\x6f\x6e\x0b\x00\xf1\x05\x69\x7a"
+            "\x61\x72\x64\x00\x53\x71\x75\x69\x72\x74\x6c\x65\x00\x57\x61\x72\x74\x6f\x0a\x00\xf2\x34\x42\x6c\x61\x73\x74\x6f\x69\x73\x65\x00"
+            "\x43\x61\x74\x65\x72\x70\x69\x65\x00\x4d\x65\x74\x61\x70\x6f\x64\x00\x42\x75\x74\x74\x65\x72\x66\x72\x65\x65\x00\x57\x65\x65\x64"
+            "\x6c\x65\x00\x4b\x61\x6b\x75\x6e\x61\x00\x42\x65\x65\x64\x72\x69\x6c\x6c\x00\x50\x69\x64\x67\x65\x79\x07\x00\x44\x6f\x74\x74\x6f"
+            "\x0a\x00\x80\x00\x52\x61\x74\x74\x61\x74\x61\x08\x00\xf2\x00\x69\x63\x61\x74\x65\x00\x53\x70\x65\x61\x72\x6f\x77\x00\x46\x07\x00"
+            "\xf0\x08\x45\x6b\x61\x6e\x73\x00\x41\x72\x62\x6f\x6b\x00\x50\x69\x6b\x61\x63\x68\x75\x00\x52\x61\x69\x07\x00\x92\x53\x61\x6e\x64"
+            "\x73\x68\x72\x65\x77\x0a\x00\xf2\x00\x6c\x61\x73\x68\x00\x4e\x69\x64\x6f\x72\x61\x6e\xe2\x99\x80\x0b\x00\x31\x69\x6e\x61\x09\x00"
+            "\x56\x71\x75\x65\x65\x6e\x1e\x00\x14\x82\x1e\x00\x11\x6f\x09\x00\xd2\x6b\x69\x6e\x67\x00\x43\x6c\x65\x66\x61\x69\x72\x79\x09\x00"
+            "\xf1\x12\x62\x6c\x65\x00\x56\x75\x6c\x70\x69\x78\x00\x4e\x69\x6e\x65\x74\x61\x6c\x65\x73\x00\x4a\x69\x67\x67\x6c\x79\x70\x75\x66"
+            "\x66\x00\x57\x0b\x00\x10\x74\x0b\x00\x90\x5a\x75\x62\x61\x74\x00\x47\x6f\x6c\x07\x00\xf2\x0d\x4f\x64\x64\x69\x73\x68\x00\x47\x6c"
+            "\x6f\x6f\x6d\x00\x56\x69\x6c\x65\x70\x6c\x75\x6d\x65\x00\x50\x61\x72\x61\x73\x06\x00\x30\x65\x63\x74\x88\x01\x32\x6f\x6e\x61\x08"
+            "\x00\xf0\x1c\x6d\x6f\x74\x68\x00\x44\x69\x67\x6c\x65\x74\x74\x00\x44\x75\x67\x74\x72\x69\x6f\x00\x4d\x65\x6f\x77\x74\x68\x00\x50"
+            "\x65\x72\x73\x69\x61\x6e\x00\x50\x73\x79\x64\x75\x63\x6b\x65\x00\x01\x08\x00\x40\x4d\x61\x6e\x6b\x4f\x01\xf2\x13\x72\x69\x6d\x65"
+            "\x61\x70\x65\x00\x47\x72\x6f\x77\x6c\x69\x74\x68\x65\x00\x41\x72\x63\x61\x6e\x69\x6e\x65\x00\x50\x6f\x6c\x69\x77\x61\x67\x08\x00"
+            "\x42\x68\x69\x72\x6c\x0a\x00\xe0\x72\x61\x74\x68\x00\x41\x62\x72\x61\x00\x4b\x61\x64\x61\x08\x00\xf2\x00\x41\x6c\x61\x6b\x61\x7a"
+            "\x61\x6d\x00\x4d\x61\x63\x68\x6f\x70\x07\x00\x21\x6b\x65\x08\x00\xe0\x61\x6d\x70\x00\x42\x65\x6c\x6c\x73\x70\x72\x6f\x75\x74\xdd"
+            "\x01\xf4\x0c\x70\x69\x6e\x62\x65\x6c\x6c\x00\x56\x69\x63\x74\x72\x65\x65\x62\x65\x6c\x00\x54\x65\x6e\x74\x61\x63\x6f\x6f\x0a\x00"
+            "\xb0\x72\x75\x65\x6c\x00\x47\x65\x6f\x64\x75\x64\x9a\x00\x60\x61\x76\x65\x6c\x65\x72\xbb\x00\x71\x65\x6d\x00\x50\x6f\x6e\x79\xee"
+            "\x01\x30\x70\x69\x64\xb0\x01\x50\x53\x6c\x6f\x77\x70\x6e\x00\x00\x09\x00\xc0\x62\x72\x6f\x00\x4d\x61\x67\x6e\x65\x6d\x69\x74\x80"
+            "\x00\xf0\x0a\x67\x6e\x65\x74\x6f\x6e\x00\x46\x61\x72\x66\x65\x74\x63\x68\xe2\x80\x99\x64\x00\x44\x6f\x64\x75\x6f\x06\x00\x00\x26"
+            "\x01\xe0\x53\x65\x65\x6c\x00\x44\x65\x77\x67\x6f\x6e\x67\x00\x47\x0d\x01\xb1\x72\x00\x4d\x75\x6b\x00\x53\x68\x65\x6c\x6c\xdc\x02"
+            "\x50\x6c\x6f\x79\x73\x74\x7e\x00\xa1\x61\x73\x74\x6c\x79\x00\x48\x61\x75\x6e\x0f\x00\xf0\x15\x65\x6e\x67\x61\x72\x00\x4f\x6e\x69"
+            "\x78\x00\x44\x72\x6f\x77\x7a\x65\x65\x00\x48\x79\x70\x6e\x6f\x00\x4b\x72\x61\x62\x62\x79\x00\x4b\x69\x6e\x67\xb6\x00\xf3\x0b\x56"
+            "\x6f\x6c\x74\x6f\x72\x62\x00\x45\x6c\x65\x63\x74\x72\x6f\x64\x65\x00\x45\x78\x65\x67\x67\x63\x75\x74\x0a\x00\xa0\x75\x74\x6f\x72"
+            "\x00\x43\x75\x62\x6f\x6e\xb2\x00\xd0\x72\x6f\x77\x61\x6b\x00\x48\x69\x74\x6d\x6f\x6e\x6c\x54\x00\x01\x0a\x00\xf0\x04\x63\x68\x61"
+            "\x6e\x00\x4c\x69\x63\x6b\x69\x74\x75\x6e\x67\x00\x4b\x6f\x66\x66\x71\x02\x40\x57\x65\x65\x7a\x08\x00\x70\x52\x68\x79\x68\x6f\x72"
+            "\x6e\x08\x00\x12\x64\x85\x03\xb0\x6e\x73\x65\x79\x00\x54\x61\x6e\x67\x65\x6c\xa8\x01\x50\x6e\x67\x61\x73\x6b\x44\x00\xd1\x48\x6f"
+            "\x72\x73\x65\x61\x00\x53\x65\x61\x64\x72\x61\x0d\x02\x00\xd6\x02\x31\x53\x65\x61\xc1\x02\x61\x53\x74\x61\x72\x79\x75\x07\x00\x10"
+            "\x6d\x9d\x03\xf2\x05\x72\x2e\x20\x4d\x69\x6d\x65\x00\x53\x63\x79\x74\x68\x65\x72\x00\x4a\x79\x6e\x78\xc9\x00\x50\x61\x62\x75\x7a"
+            "\x7a\x61\x01\xf0\x02\x6d\x61\x72\x00\x50\x69\x6e\x73\x69\x72\x00\x54\x61\x75\x72\x6f\x73\x15\x00\xf0\x03\x69\x6b\x61\x72\x70\x00"
+            "\x47\x79\x61\x72\x61\x64\x6f\x73\x00\x4c\x61\x70\xbc\x02\x20\x44\x69\xb7\x03\xb0\x45\x65\x76\x65\x65\x00\x56\x61\x70\x6f\x72\x31"
+            "\x04\x40\x4a\x6f\x6c\x74\x08\x00\x31\x46\x6c\x61\x10\x00\xf0\x00\x50\x6f\x72\x79\x67\x6f\x6e\x00\x4f\x6d\x61\x6e\x79\x74\x65\x08"
+            "\x00\xb3\x73\x74\x61\x72\x00\x4b\x61\x62\x75\x74\x6f\x07\x00\xf0\x13\x70\x73\x00\x41\x65\x72\x6f\x64\x61\x63\x74\x79\x6c\x00\x53"
+            "\x6e\x6f\x72\x6c\x61\x78\x00\x41\x72\x74\x69\x63\x75\x6e\x6f\x00\x5a\x61\x70\x77\x00\xf0\x00\x4d\x6f\x6c\x74\x72\x65\x73\x00\x44"
+            "\x72\x61\x74\x69\x6e\x69\x08\x00\x63\x67\x6f\x6e\x61\x69\x72\x0a\x00\x01\x23\x02\x40\x65\x77\x74\x77\x2d\x03\xf0\x3b\x77\x00\x43"
+            "\x68\x69\x6b\x6f\x72\x69\x74\x61\x00\x42\x61\x79\x6c\x65\x65\x66\x00\x4d\x65\x67\x61\x6e\x69\x75\x6d\x00\x43\x79\x6e\x64\x61\x71"
+            "\x75\x69\x6c\x00\x51\x75\x69\x6c\x61\x76\x61\x00\x54\x79\x70\x68\x6c\x6f\x73\x69\x6f\x6e\x00\x54\x6f\x74\x6f\x64\x69\x6c\x65\x00"
+            "\x43\x72\x6f\x63\x6f\x6e\x61\x79\x04\xf0\x05\x72\x61\x6c\x69\x67\x61\x74\x72\x00\x53\x65\x6e\x74\x72\x65\x74\x00\x46\x75\x72\x07"
+            "\x00\xf0\x08\x48\x6f\x6f\x74\x68\x6f\x6f\x74\x00\x4e\x6f\x63\x74\x6f\x77\x6c\x00\x4c\x65\x64\x79\x62\x61\x07\x00\x00\xa5\x03\xc1"
+            "\x53\x70\x69\x6e\x61\x72\x61\x6b\x00\x41\x72\x69\x3a\x01\x30\x43\x72\x6f\x13\x04\xf1\x03\x43\x68\x69\x6e\x63\x68\x6f\x75\x00\x4c"
+            "\x61\x6e\x74\x75\x72\x6e\x00\x50\xbf\x04\x00\x67\x04\x40\x66\x61\x00\x49\x48\x04\x10\x62\x48\x04\x61\x54\x6f\x67\x65\x70\x69\x07"
+            "\x00\xa0\x74\x69\x63\x00\x4e\x61\x74\x75\x00\x58\x05\x00\x60\x4d\x61\x72\x65\x65\x70\x65\x01\xa0\x61\x66\x66\x79\x00\x41\x6d\x70"
+            "\x68\x61\xac\x01\x00\x9a\x03\x40\x6f\x73\x73\x6f\xbb\x03\x01\x66\x05\x42\x41\x7a\x75\x6d\x0a\x00\x91\x53\x75\x64\x6f\x77\x6f\x6f"
+            "\x64\x6f\xf6\x03\xf1\x01\x74\x6f\x65\x64\x00\x48\x6f\x70\x70\x69\x70\x00\x53\x6b\x69\x70\x9d\x04\x50\x4a\x75\x6d\x70\x6c\x78\x00"
+            "\xd0\x41\x69\x70\x6f\x6d\x00\x53\x75\x6e\x6b\x65\x72\x6e\x08\x00\xf0\x10\x66\x6c\x6f\x72\x61\x00\x59\x61\x6e\x6d\x61\x00\x57\x6f"
+            "\x6f\x70\x65\x72\x00\x51\x75\x61\x67\x73\x69\x72\x65\x00\x45\x73\x70\xe9\x01\x31\x55\x6d\x62\xf1\x01\x40\x4d\x75\x72\x6b\xa7\x05"
+            "\x00\xbf\x03\x01\x85\x02\xf0\x05\x4d\x69\x73\x64\x72\x65\x61\x76\x75\x73\x00\x55\x6e\x6f\x77\x6e\x00\x57\x6f\x62\xde\x00\xc0\x65"
+            "\x74\x00\x47\x69\x72\x61\x66\x61\x72\x69\x67\x73\x02\x60\x65\x63\x6f\x00\x46\x6f\x57\x01\xf0\x01\x72\x65\x73\x73\x00\x44\x75\x6e"
+            "\x73\x70\x61\x72\x63\x65\x00\x47\x7c\x01\xf0\x03\x72\x00\x53\x74\x65\x65\x6c\x69\x78\x00\x53\x6e\x75\x62\x62\x75\x6c\x6c\x49\x04"
+            "\x11\x6e\x09\x00\x50\x51\x77\x69\x6c\x66\x64\x05\xf1\x0f\x53\x63\x69\x7a\x6f\x72\x00\x53\x68\x75\x63\x6b\x6c\x65\x00\x48\x65\x72"
+            "\x61\x63\x72\x6f\x73\x73\x00\x53\x6e\x65\x61\x73\x99\x04\xd1\x64\x64\x69\x75\x72\x73\x61\x00\x55\x72\x73\x61\x72\x24\x03\x50\x6c"
+            "\x75\x67\x6d\x61\xe6\x02\xf0\x04\x63\x61\x72\x67\x6f\x00\x53\x77\x69\x6e\x75\x62\x00\x50\x69\x6c\x6f\x73\x77\x37\x05\xf0\x14\x43"
+            "\x6f\x72\x73\x6f\x6c\x61\x00\x52\x65\x6d\x6f\x72\x61\x69\x64\x00\x4f\x63\x74\x69\x6c\x6c\x65\x72\x79\x00\x44\x65\x6c\x69\x62\x69"
+            "\x72\x64\x7e\x05\x10\x74\x2c\x00\xf3\x02\x53\x6b\x61\x72\x6d\x6f\x72\x79\x00\x48\x6f\x75\x6e\x64\x6f\x75\x72\x09\x00\x21\x6f\x6d"
+            "\x40\x04\x00\xa4\x03\xb0\x50\x68\x61\x6e\x70\x79\x00\x44\x6f\x6e\x70\xc1\x03\x03\x20\x03\x10\x32\xa5\x03\x20\x6e\x74\x61\x04\xf4"
+            "\x00\x53\x6d\x65\x61\x72\x67\x6c\x65\x00\x54\x79\x72\x6f\x67\x75\x33\x04\xc0\x74\x6f\x70\x00\x53\x6d\x6f\x6f\x63\x68\x75\x6d\xb4"
+            "\x03\x20\x6b\x69\x77\x00\xf0\x01\x67\x62\x79\x00\x4d\x69\x6c\x74\x61\x6e\x6b\x00\x42\x6c\x69\x73\x27\x04\xf0\x00\x52\x61\x69\x6b"
+            "\x6f\x75\x00\x45\x6e\x74\x65\x69\x00\x53\x75\x44\x03\x70\x65\x00\x4c\x61\x72\x76\x69\x79\x03\x31\x50\x75\x70\x08\x00\x51\x54\x79"
+            "\x72\x61\x6e\x0a\x00\xf0\x0b\x4c\x75\x67\x69\x61\x00\x48\x6f\x2d\x4f\x68\x00\x43\x65\x6c\x65\x62\x69\x00\x54\x72\x65\x65\x63\x6b"
+            "\x6f\x46\x06\x30\x76\x79\x6c\x31\x04\x30\x65\x70\x74\x14\x03\xf0\x02\x54\x6f\x72\x63\x68\x69\x63\x00\x43\x6f\x6d\x62\x75\x73\x6b"
+            "\x65\x6e\x05\x08\x20\x7a\x69\x09\x00\x50\x4d\x75\x64\x6b\x69\x2d\x06\xf0\x03\x72\x73\x68\x74\x6f\x6d\x70\x00\x53\x77\x61\x6d\x70"
+            "\x65\x72\x74\x00\x50\xb6\x00\xa1\x79\x65\x6e\x61\x00\x4d\x69\x67\x68\x74\x0a\x00\x80\x5a\x69\x67\x7a\x61\x67\x6f\x6f\x07\x05\x20"
+            "\x6e\x6f\x2c\x05\x50\x57\x75\x72\x6d\x70\x6c\x00\x30\x69\x6c\x63\x18\x00\xd1\x42\x65\x61\x75\x74\x69\x66\x6c\x79\x00\x43\x61\x73"
+            "\x12\x00\xf0\x00\x44\x75\x73\x74\x6f\x78\x00\x4c\x6f\x74\x61\x64\x00\x4c\x6f\x71\x02\x81\x00\x4c\x75\x64\x69\x63\x6f\x6c\xfa\x05"
+            "\x10\x64\x89\x03\xd0\x75\x7a\x6c\x65\x61\x66\x00\x53\x68\x69\x66\x74\x72\x34\x05\x30\x69\x6c\x6c\x8f\x02\x10\x77\x1b\x03\x60\x77"
+            "\x00\x57\x69\x6e\x67\x34\x02\x50\x50\x65\x6c\x69\x70\xc8\x02\xf0\x21\x52\x61\x6c\x74\x73\x00\x4b\x69\x72\x6c\x69\x61\x00\x47\x61"
+            "\x72\x64\x65\x76\x6f\x69\x72\x00\x53\x75\x72\x73\x6b\x69\x74\x00\x4d\x61\x73\x71\x75\x65\x72\x61\x69\x6e\x00\x53\x68\x72\x6f\x6f"
+            "\x6d\x68\x02\x31\x42\x72\x65\x31\x03\x40\x53\x6c\x61\x6b\xac\x07\x50\x56\x69\x67\x6f\x72\x09\x00\x00\x11\x00\x00\x55\x02\x60\x4e"
+            "\x69\x6e\x63\x61\x64\x69\x08\x41\x6e\x6a\x61\x73\x7f\x06\x10\x64\x0b\x00\xf0\x08\x00\x57\x68\x69\x73\x6d\x75\x72\x00\x4c\x6f\x75"
+            "\x64\x72\x65\x64\x00\x45\x78\x70\x6c\x6f\x75\xca\x01\x30\x6b\x75\x68\xac\x04\x80\x48\x61\x72\x69\x79\x61\x6d\x61\xba\x03\x01\xb8"
+            "\x03\x60\x4e\x6f\x73\x65\x70\x61\xc4\x02\x41\x6b\x69\x74\x74\x74\x02\x20\x63\x61\x09\x00\x10\x53\x92\x08\x10\x79\x64\x06\x10\x77"
+            "\x9a\x01\x20\x41\x72\x4c\x01\x20\x61\x69\x07\x00\x30\x41\x67\x67\x07\x00\x52\x4d\x65\x64\x69\x74\x16\x05\x20\x64\x69\xbb\x07\x03"
+            "\xb5\x06\x11\x69\xcc\x07\x11\x6e\x0b\x00\xe0\x63\x00\x50\x6c\x75\x73\x6c\x65\x00\x4d\x69\x6e\x75\x6e\xde\x06\xa0\x62\x65\x61\x74"
+            "\x00\x49\x6c\x6c\x75\x6d\xda\x09\x41\x52\x6f\x73\x65\x1a\x01\x00\xfa\x08\x10\x6e\xd4\x01\xf0\x0b\x6c\x6f\x74\x00\x43\x61\x72\x76"
+            "\x61\x6e\x68\x61\x00\x53\x68\x61\x72\x70\x65\x64\x6f\x00\x57\x61\x69\x6c\x6d\x07\x00\x08\x00\xf0\x03\x6f\x72\x64\x00\x4e\x75\x6d"
+            "\x65\x6c\x00\x43\x61\x6d\x65\x72\x75\x70\x74\x38\x02\xf1\x04\x6b\x6f\x61\x6c\x00\x53\x70\x6f\x69\x6e\x6b\x00\x47\x72\x75\x6d\x70"
+            "\x69\x67\x21\x05\x70\x64\x61\x00\x54\x72\x61\x70\x12\x05\x50\x00\x56\x69\x62\x72\x8f\x05\x21\x46\x6c\x35\x06\x60\x43\x61\x63\x6e"
+            "\x65\x61\x07\x00\x00\x26\x05\x10\x65\x7e\x00\xf0\x0a\x62\x6c\x75\x00\x41\x6c\x74\x61\x72\x69\x61\x00\x5a\x61\x6e\x67\x6f\x6f\x73"
+            "\x65\x00\x53\x65\x76\x69\xcc\x01\x50\x4c\x75\x6e\x61\x74\x4c\x02\xf1\x01\x53\x6f\x6c\x72\x6f\x63\x6b\x00\x42\x61\x72\x62\x6f\x61"
+            "\x63\x68\x78\x01\x10\x63\x5f\x08\x50\x43\x6f\x72\x70\x68\xc4\x01\x50\x43\x72\x61\x77\x64\xfd\x07\x60\x00\x42\x61\x6c\x74\x6f\xe5"
+            "\x09\x90\x61\x79\x64\x6f\x6c\x00\x4c\x69\x6c\x5c\x05\xa0\x43\x72\x61\x64\x69\x6c\x79\x00\x41\x6e\x45\x06\xf0\x01\x68\x00\x41\x72"
+            "\x6d\x61\x6c\x64\x6f\x00\x46\x65\x65\x62\x61\x73\x75\x03\x10\x6f\x94\x05\xc1\x43\x61\x73\x74\x66\x6f\x72\x6d\x00\x4b\x65\x63\x32"
+            "\x0b\x60\x53\x68\x75\x70\x70\x65\x56\x00\x50\x6e\x65\x74\x74\x65\xb5\x02\x10\x6b\x71\x02\x50\x44\x75\x73\x63\x6c\xea\x06\x70\x54"
+            "\x72\x6f\x70\x69\x75\x73\x05\x06\xf1\x03\x6d\x65\x63\x68\x6f\x00\x41\x62\x73\x6f\x6c\x00\x57\x79\x6e\x61\x75\x74\xfd\x06\x00\x95"
+            "\x00\x50\x47\x6c\x61\x6c\x69\xfc\x0a\x20\x68\x65\x37\x01\x40\x65\x61\x6c\x65\x65\x01\x50\x6c\x72\x65\x69\x6e\xab\x00\x00\x5a\x03"
+            "\xf0\x17\x6c\x00\x48\x75\x6e\x74\x61\x69\x6c\x00\x47\x6f\x72\x65\x62\x79\x73\x73\x00\x52\x65\x6c\x69\x63\x61\x6e\x74\x68\x00\x4c"
+            "\x75\x76\x64\x69\x73\x63\x00\x42\x1b\x07\x01\x00\x09\x01\x08\x00\x80\x61\x6c\x61\x6d\x65\x6e\x63\x65\x2b\x06\x31\x64\x75\x6d\xb1"
+            "\x0b\x00\xa5\x05\x41\x65\x74\x61\x67\x2b\x05\x41\x52\x65\x67\x69\x3c\x01\x00\x09\x00\x21\x63\x65\x07\x00\x10\x73\x7b\x05\x60\x00"
+            "\x4c\x61\x74\x69\x61\xfe\x07\xa1\x74\x69\x6f\x73\x00\x4b\x79\x6f\x67\x72\x68\x0a\x10\x75\xa4\x08\xf0\x0f\x52\x61\x79\x71\x75\x61"
+            "\x7a\x61\x00\x4a\x69\x72\x61\x63\x68\x69\x00\x44\x65\x6f\x78\x79\x73\x00\x54\x75\x72\x74\x77\x69\x8c\x09\x10\x6f\x33\x0c\x81\x54"
+            "\x6f\x72\x74\x65\x72\x72\x61\xfe\x00\xf1\x00\x63\x68\x61\x72\x00\x4d\x6f\x6e\x66\x65\x72\x6e\x6f\x00\x49\x08\x00\x00\xbc\x0a\x60"
+            "\x50\x69\x70\x6c\x75\x70\xcc\x0a\x11\x6e\x09\x00\x42\x45\x6d\x70\x6f\x5c\x01\x51\x74\x61\x72\x6c\x79\x07\x00\x42\x61\x76\x69\x61"
+            "\x09\x00\x10\x70\x70\x09\xf4\x09\x42\x69\x64\x6f\x6f\x66\x00\x42\x69\x62\x61\x72\x65\x6c\x00\x4b\x72\x69\x63\x6b\x65\x74\x6f\x74"
+            "\x0a\x00\x00\x03\x05\xb0\x53\x68\x69\x6e\x78\x00\x4c\x75\x78\x69\x6f\x06\x00\x91\x72\x61\x79\x00\x42\x75\x64\x65\x77\xe4\x02\x30"
+            "\x72\x61\x64\xf2\x07\x30\x61\x6e\x69\xa8\x07\x60\x52\x61\x6d\x70\x61\x72\x0a\x00\x50\x53\x68\x69\x65\x6c\xe1\x00\x61\x42\x61\x73"
+            "\x74\x69\x6f\x0a\x00\xb0\x75\x72\x6d\x79\x00\x57\x6f\x72\x6d\x61\x64\x25\x0b\x51\x6f\x74\x68\x69\x6d\x12\x05\x00\x09\x09\xa0\x65"
+            "\x73\x70\x69\x71\x75\x65\x6e\x00\x50\x07\x01\xf0\x02\x72\x69\x73\x75\x00\x42\x75\x69\x7a\x65\x6c\x00\x46\x6c\x6f\x61\x74\x09\x00"
+            "\x71\x43\x68\x65\x72\x75\x62\x69\x08\x00\x32\x72\x69\x6d\x9d\x0a\x21\x6f\x73\x93\x0a\x11\x72\x63\x00\x31\x41\x6d\x62\x83\x07\x51"
+            "\x44\x72\x69\x66\x6c\xfb\x04\xf0\x07\x72\x69\x66\x62\x6c\x69\x6d\x00\x42\x75\x6e\x65\x61\x72\x79\x00\x4c\x6f\x70\x75\x6e\x6e\xfd"
+            "\x05\x40\x73\x6d\x61\x67\x50\x02\x10\x48\x57\x0a\x01\x7b\x07\x10\x47\xe4\x01\x80\x6f\x77\x00\x50\x75\x72\x75\x67\x40\x05\x10\x68"
+            "\xbc\x0a\x02\x11\x0a\x70\x75\x6e\x6b\x79\x00\x53\x6b\x38\x02\x00\x33\x06\x30\x72\x6f\x6e\x32\x07\x02\x08\x00\x80\x6e\x67\x00\x42"
+            "\x6f\x6e\x73\x6c\x56\x00\xd0\x6d\x65\x20\x4a\x72\x2e\x00\x48\x61\x70\x70\x69\x6e\x43\x00\x10\x61\x4e\x01\xc0\x53\x70\x69\x72\x69"
+            "\x74\x6f\x6d\x62\x00\x47\x69\x10\x0d\x30\x47\x61\x62\x60\x04\x50\x47\x61\x72\x63\x68\xf3\x05\x50\x4d\x75\x6e\x63\x68\xbc\x09\xa0"
+            "\x52\x69\x6f\x6c\x75\x00\x4c\x75\x63\x61\x96\x0b\xa2\x48\x69\x70\x70\x6f\x70\x6f\x74\x61\x73\x0b\x00\x10\x77\xe4\x00\x61\x53\x6b"
+            "\x6f\x72\x75\x70\xc7\x09\x10\x70\x78\x09\xf0\x03\x43\x72\x6f\x61\x67\x75\x6e\x6b\x00\x54\x6f\x78\x69\x63\x72\x6f\x61\x6b\x67\x04"
+            "\x30\x6e\x69\x76\x59\x07\x40\x46\x69\x6e\x6e\x02\x02\x41\x4c\x75\x6d\x69\x09\x00\x00\x72\x07\x10\x79\x26\x0c\xd0\x6e\x6f\x76\x65"
+            "\x72\x00\x41\x62\x6f\x6d\x61\x73\x6e\xe1\x05\x30\x65\x61\x76\x10\x05\x01\x2d\x0c\x10\x7a\x0d\x04\x01\x68\x0b\x50\x6c\x69\x63\x6b"
+            "\x79\x51\x0b\x50\x70\x65\x72\x69\x6f\xdd\x0a\x31\x6e\x67\x72\x52\x0d\x01\x14\x05\x20\x69\x76\xcb\x08\x00\x00\x0b\x21\x6f\x72\x1e"
+            "\x07\x71\x6f\x67\x65\x6b\x69\x73\x73\xf4\x08\x20\x65\x67\xd2\x09\x20\x61\x66\x78\x00\x42\x47\x6c\x61\x63\x08\x00\x93\x69\x73\x63"
+            "\x6f\x72\x00\x4d\x61\x6d\x28\x08\x03\xca\x07\x70\x2d\x5a\x00\x47\x61\x6c\x6c\x4f\x02\x51\x50\x72\x6f\x62\x6f\xbc\x05\x00\x05\x04"
+            "\x10\x6e\x57\x06\x30\x46\x72\x6f\x97\x0e\xa1\x73\x00\x52\x6f\x74\x6f\x6d\x00\x55\x78\x34\x0f\xf0\x08\x73\x70\x72\x69\x74\x00\x41"
+            "\x7a\x65\x6c\x66\x00\x44\x69\x61\x6c\x67\x61\x00\x50\x61\x6c\x6b\x96\x07\x61\x65\x61\x74\x72\x61\x6e\x86\x03\x51\x67\x69\x67\x61"
+            "\x73\x34\x09\x10\x74\xc5\x0e\x10\x43\x27\x09\x01\x9c\x05\x32\x50\x68\x69\x6d\x0c\xd0\x6e\x61\x70\x68\x79\x00\x44\x61\x72\x6b\x72"
+            "\x61\x69\x9c\x05\x40\x79\x6d\x69\x6e\x01\x0e\x31\x65\x75\x73\xa0\x0d\x00\x37\x0b\x91\x53\x6e\x69\x76\x79\x00\x53\x65\x72\x59\x01"
+            "\x34\x53\x65\x72\x12\x01\x10\x65\x92\x05\x31\x50\x69\x67\x49\x0b\x40\x45\x6d\x62\x6f\x10\x0d\x50\x73\x68\x61\x77\x6f\x87\x0e\x11"
+            "\x65\x07\x00\x50\x53\x61\x6d\x75\x72\x09\x00\x10\x50\x98\x00\x90\x74\x00\x57\x61\x74\x63\x68\x6f\x67\x35\x05\x50\x6c\x69\x70\x75"
+            "\x70\x74\x09\x20\x64\x69\xc6\x08\x80\x74\x6f\x75\x74\x6c\x61\x6e\x64\x86\x02\x40\x72\x6c\x6f\x69\xe9\x07\x10\x65\x55\x03\x70\x00"
+            "\x50\x61\x6e\x73\x61\x67\xe9\x07\x21\x6d\x69\x09\x00\x00\x11\x00\x10\x65\xe2\x09\x00\x11\x00\x00\x09\x00\x40\x50\x61\x6e\x70\x3d"
+            "\x09\x00\x11\x00\x01\x09\x00\x30\x4d\x75\x6e\x3e\x08\x70\x75\x73\x68\x61\x72\x6e\x61\x2b\x10\x30\x6f\x76\x65\x37\x06\x10\x6e\xc6"
+            "\x0b\x80\x6c\x00\x55\x6e\x66\x65\x7a\x61\xcc\x05\xb0\x6c\x69\x74\x7a\x6c\x65\x00\x5a\x65\x62\x73\xe9\x06\x90\x61\x00\x52\x6f\x67"
+            "\x67\x65\x6e\x72\xc2\x09\x50\x42\x6f\x6c\x64\x6f\xb4\x04\x30\x69\x67\x61\x1c\x0f\x00\xcb\x0a\x00\x8f\x0b\x22\x53\x77\x08\x00\xc2"
+            "\x44\x72\x69\x6c\x62\x75\x72\x00\x45\x78\x63\x61\xa5\x10\x30\x41\x75\x64\x12\x10\xc0\x54\x69\x6d\x62\x75\x72\x72\x00\x47\x75\x72"
+            "\x64\x08\x00\x40\x43\x6f\x6e\x6b\x3f\x05\x10\x72\x47\x09\x01\x9d\x04\x00\xb0\x01\xc2\x70\x69\x74\x6f\x61\x64\x00\x53\x65\x69\x73"
+            "\x6d\x0b\x00\xf0\x01\x54\x68\x72\x6f\x68\x00\x53\x61\x77\x6b\x00\x53\x65\x77\x61\x64\x08\x11\x41\x53\x77\x61\x64\xd3\x03\x50\x4c"
+            "\x65\x61\x76\x61\xc3\x03\x80\x56\x65\x6e\x69\x70\x65\x64\x65\xa5\x06\x22\x72\x6c\x0b\x00\x33\x53\x63\x6f\x0a\x00\x10\x43\x1d\x11"
+            "\x10\x6e\x48\x11\x61\x68\x69\x6d\x73\x69\x63\x7d\x01\x51\x65\x74\x69\x6c\x69\xab\x06\x00\x1c\x0b\x01\xc4\x06\x40\x73\x63\x75\x6c"
+            "\xa1\x07\x21\x61\x6e\xbd\x0c\x80\x4b\x72\x6f\x6b\x6f\x72\x6f\x6b\x09\x00\x22\x6f\x6b\xd1\x0c\x80\x44\x61\x72\x75\x6d\x61\x6b\x61"
+            "\x09\x00\x11\x6d\xfd\x09\x00\x48\x03\x10\x72\x5e\x07\x60\x73\x00\x44\x77\x65\x62\xd3\x03\x40\x43\x72\x75\x73\xaa\x05\x71\x53\x63"
+            "\x72\x61\x67\x67\x79\x08\x00\x10\x66\x6f\x08\xb0\x69\x67\x69\x6c\x79\x70\x68\x00\x59\x61\x6d\xd3\x08\xf0\x03\x43\x6f\x66\x61\x67"
+            "\x72\x69\x67\x75\x73\x00\x54\x69\x72\x74\x6f\x75\x67\xa9\x07\x80\x72\x72\x61\x63\x6f\x73\x74\x61\x75\x02\x21\x68\x65\x7c\x02\x22"
+            "\x68\x65\xf6\x06\x31\x75\x62\x62\x08\x11\x00\x93\x07\x90\x64\x6f\x72\x00\x5a\x6f\x72\x75\x61\x06\x00\x40\x6f\x61\x72\x6b\x7f\x08"
+            "\x20\x63\x63\x6c\x01\x14\x43\x09\x00\x10\x47\x58\x05\x10\x74\xd5\x0e\x22\x74\x68\xc8\x0d\x02\x12\x00\x20\x65\x6c\x9e\x00\x10\x6f"
+            "\xae\x0d\x00\x59\x03\x02\xb5\x0d\x70\x52\x65\x75\x6e\x69\x63\x6c\xc8\x00\x01\xfc\x0b\x00\xab\x02\x20\x77\x61\x35\x02\x30\x56\x61"
+            "\x6e\x26\x01\x10\x74\xa4\x0e\x01\x0a\x00\x23\x73\x68\x0a\x00\x82\x75\x78\x65\x00\x44\x65\x65\x72\x1a\x05\x40\x61\x77\x73\x62\x49"
+            "\x11\x30\x45\x6d\x6f\x80\x03\x10\x4b\xcb\x00\x10\x62\xe1\x12\x60\x00\x45\x73\x63\x61\x76\x8e\x07\x60\x72\x00\x46\x6f\x6f\x6e\xf2"
+            "\x00\x22\x41\x6d\x09\x00\x30\x73\x00\x46\x28\x02\x00\x54\x00\xf0\x01\x4a\x65\x6c\x6c\x69\x63\x65\x6e\x74\x00\x41\x6c\x6f\x6d\x6f"
+            "\x6d\x71\x02\x00\x0d\x0f\x20\x69\x6b\x10\x04\x10\x76\xe9\x0d\x20\x6c\x61\x4b\x0e\x62\x72\x6f\x73\x65\x65\x64\x0a\x00\x00\xda\x00"
+            "\x40\x6e\x00\x4b\x6c\x14\x09\x20\x4b\x6c\x89\x07\x01\x0c\x00\x01\x0a\x00\x50\x54\x79\x6e\x61\x6d\x60\x0f\x30\x6c\x65\x6b\xcb\x02"
+            "\x04\x0a\x00\x00\xa5\x07\xc0\x45\x6c\x67\x79\x65\x6d\x00\x42\x65\x68\x65\x65\x09\x00\x90\x4c\x69\x74\x77\x69\x63\x6b\x00\x4c\x18"
+            "\x08\x10\x6e\x61\x0e\x00\xca\x13\xe0\x6c\x75\x72\x65\x00\x41\x78\x65\x77\x00\x46\x72\x61\x78\x0d\x00\x50\x48\x61\x78\x6f\x72\x7c"
+            "\x08\x60\x75\x62\x63\x68\x6f\x6f\x64\x0b\x00\x65\x0f\x50\x00\x43\x72\x79\x6f\x4c\x0f\x11\x6c\x8c\x06\x70\x6d\x65\x74\x00\x41\x63"
+            "\x63\x32\x08\x00\xc9\x03\x50\x75\x6e\x66\x69\x73\xa2\x01\x51\x65\x6e\x66\x6f\x6f\x08\x00\xb0\x73\x68\x61\x6f\x00\x44\x72\x75\x64"
+            "\x64\x69\x56\x08\x00\xca\x11\x11\x74\xf1\x12\x90\x75\x72\x6b\x00\x50\x61\x77\x6e\x69\xe9\x03\x20\x42\x69\xb0\x03\x90\x70\x00\x42"
+            "\x6f\x75\x66\x66\x61\x6c\xa8\x02\x50\x52\x75\x66\x66\x6c\x1e\x09\x01\xc1\x07\x20\x72\x79\x52\x13\x20\x6c\x61\xc5\x0c\x00\xb8\x02"
+            "\x01\x85\x10\x00\xf3\x04\x70\x6d\x6f\x72\x00\x44\x75\x72\x32\x00\x20\x44\x65\x0d\x02\x60\x5a\x77\x65\x69\x6c\x6f\xe6\x06\x41\x79"
+            "\x64\x72\x65\x75\x00\x00\xd2\x0c\x10\x65\x6b\x02\x70\x56\x6f\x6c\x63\x61\x72\x6f\x13\x05\x41\x6f\x62\x61\x6c\xc4\x0f\x00\x64\x08"
+            "\x10\x6b\x0a\x00\x52\x56\x69\x72\x69\x7a\xd7\x0f\x40\x72\x6e\x61\x64\xae\x02\x50\x68\x75\x6e\x64\x75\x06\x01\xf0\x00\x52\x65\x73"
+            "\x68\x69\x72\x61\x6d\x00\x5a\x65\x6b\x72\x6f\x6d\x8e\x0f\x11\x64\x1f\x01\x50\x4b\x79\x75\x72\x65\xd3\x09\x30\x6c\x64\x65\x4d\x10"
+            "\x40\x6c\x6f\x65\x74\x80\x02\x31\x65\x6e\x65\xad\x13\x20\x43\x68\xe6\x07\x11\x6e\x3e\x10\x30\x6c\x61\x64\x92\x09\xf0\x03\x68\x65"
+            "\x73\x6e\x61\x75\x67\x68\x74\x00\x46\x65\x6e\x6e\x65\x6b\x69\x6e\xe4\x00\x40\x69\x78\x65\x6e\xb2\x0b\x40\x70\x68\x6f\x78\xfc\x05"
+            "\x40\x61\x6b\x69\x65\x08\x00\x21\x67\x61\x25\x05\x41\x47\x72\x65\x6e\x17\x0c\x80\x42\x75\x6e\x6e\x65\x6c\x62\x79\xf6\x13\x90\x67"
+            "\x65\x72\x73\x62\x79\x00\x46\x6c\xe2\x12\x01\x9c\x02\x02\x0b\x00\x11\x69\x9c\x15\x60\x54\x61\x6c\x6f\x6e\x66\xe1\x07\x20\x00\x53"
+            "\x08\x0c\x40\x65\x72\x62\x75\x48\x0b\x80\x65\x77\x70\x61\x00\x56\x69\x76\xee\x0c\x00\x6b\x05\x10\x74\x30\x0a\x20\x50\x79\x5d\x03"
+            "\x00\x27\x10\x60\x62\xc3\xa9\x62\xc3\xa9\x83\x08\x01\x95\x0a\x61\x46\x6c\x6f\x72\x67\x65\x54\x0c\x20\x64\x64\x6b\x03\x30\x67\x6f"
+            "\x61\xd4\x05\x00\x99\x12\x10\x6d\x08\x00\x00\xd0\x0c\x00\xe5\x10\x20\x66\x72\x4a\x0e\x20\x73\x70\xeb\x04\x00\x82\x14\x10\x73\x2e"
+            "\x02\xc1\x48\x6f\x6e\x65\x64\x67\x65\x00\x44\x6f\x75\x62\xe9\x06\x10\x41\x24\x0a\x01\x6e\x15\x10\x53\xca\x06\x00\x3c\x13\x60\x41"
+            "\x72\x6f\x6d\x61\x74\x91\x0e\x00\x52\x0f\x11\x72\xb9\x0f\x31\x6c\x75\x72\x2a\x15\x40\x49\x6e\x6b\x61\xf2\x01\x20\x6c\x61\x6e\x12"
+            "\x50\x42\x69\x6e\x61\x63\x4e\x16\x30\x61\x72\x62\x8d\x04\x00\xde\x03\x51\x6b\x72\x65\x6c\x70\xd7\x11\x40\x61\x6c\x67\x65\xf0\x0a"
+            "\x00\x59\x08\x01\xbf\x13\x20\x61\x77\x61\x00\x72\x72\x00\x48\x65\x6c\x69\x6f\x95\x0e\x01\x0b\x00\x10\x6c\xa4\x02\x21\x54\x79\x3d"
+            "\x0b\x01\xdc\x0e\x90\x74\x72\x75\x6d\x00\x41\x6d\x61\x75\xd2\x14\x21\x75\x72\xd9\x01\x40\x53\x79\x6c\x76\xbe\x07\xc0\x48\x61\x77"
+            "\x6c\x75\x63\x68\x61\x00\x44\x65\x64\xaf\x01\x00\xba\x04\x11\x62\x99\x0c\xb0\x6f\x6f\x6d\x79\x00\x53\x6c\x69\x67\x67\x6f\x18\x01"
+            "\x10\x6f\xb3\x0f\x61\x4b\x6c\x65\x66\x6b\x69\xba\x0f\x40\x74\x75\x6d\x70\x1e\x0f\x30\x76\x65\x6e\x9d\x02\x71\x50\x75\x6d\x70\x6b"
+            "\x61\x62\x2b\x00\xc1\x75\x72\x67\x65\x69\x73\x74\x00\x42\x65\x72\x67\xaf\x14\xb0\x41\x76\x61\x6c\x75\x67\x67\x00\x4e\x6f\x69\x5e"
+            "\x06\x40\x4e\x6f\x69\x76\x4f\x11\x30\x58\x65\x72\x8e\x10\xc0\x00\x59\x76\x65\x6c\x74\x61\x6c\x00\x5a\x79\x67\x76\x0e\x00\xf9\x07"
+            "\x40\x6e\x63\x69\x65\x54\x12\x00\xcb\x01\x00\xd5\x02\x11\x6e\xdb\x04\x20\x6f\x77\x32\x03\x50\x44\x61\x72\x74\x72\x9d\x14\x50\x65"
+            "\x63\x69\x64\x75\xf9\x0d\x51\x4c\x69\x74\x74\x65\xd9\x02\x30\x72\x61\x63\xb4\x0d\x51\x6e\x63\x69\x6e\x65\xf2\x01\xc0\x50\x6f\x70"
+            "\x70\x6c\x69\x6f\x00\x42\x72\x69\x6f\xdf\x00\x00\x17\x16\x00\xef\x10\x00\x3b\x07\x50\x6b\x69\x70\x65\x6b\x90\x05\x40\x6d\x62\x65"
+            "\x61\x6e\x09\xa1\x75\x63\x61\x6e\x6e\x6f\x6e\x00\x59\x75\x4f\x0d\x61\x00\x47\x75\x6d\x73\x68\x09\x00\x01\xb4\x05\x02\x05\x18\x20"
+            "\x6a\x61\x68\x02\x80\x56\x69\x6b\x61\x76\x6f\x6c\x74\x2a\x0b\x40\x62\x72\x61\x77\xb0\x10\x00\x0b\x00\x41\x6f\x6d\x69\x6e\x21\x17"
+            "\x50\x4f\x72\x69\x63\x6f\xf3\x09\x50\x43\x75\x74\x69\x65\xbd\x0f\x32\x52\x69\x62\x1a\x0b\x50\x52\x6f\x63\x6b\x72\xff\x01\xf1\x04"
+            "\x4c\x79\x63\x61\x6e\x72\x6f\x63\x00\x57\x69\x73\x68\x69\x77\x61\x73\x68\x69\xd1\x12\x30\x61\x6e\x69\x21\x0c\x50\x78\x61\x70\x65"
+            "\x78\x4e\x10\x10\x62\xa2\x0b\x60\x4d\x75\x64\x73\x64\x61\xbd\x06\x40\x65\x77\x70\x69\x02\x03\x50\x41\x72\x61\x71\x75\xa8\x0b\x40"
+            "\x00\x46\x6f\x6d\x78\x11\x31\x73\x00\x4c\x2b\x04\x10\x69\x23\x14\x30\x72\x65\x6c\x6e\x0d\x51\x53\x68\x69\x69\x6e\xa1\x0d\x00\xf2"
+            "\x0c\x30\x6e\x64\x69\xbb\x08\x30\x6c\x61\x7a\x1c\x08\x10\x53\xa4\x17\x60\x75\x6c\x00\x42\x65\x77\x6d\x08\x91\x42\x6f\x75\x6e\x73"
+            "\x77\x65\x65\x74\x62\x12\x00\x6a\x07\x20\x54\x73\x5f\x13\x01\x50\x04\xf0\x05\x6d\x66\x65\x79\x00\x4f\x72\x61\x6e\x67\x75\x72\x75"
+            "\x00\x50\x61\x73\x73\x69\x6d\xda\x13\x30\x57\x69\x6d\xe7\x18\x10\x47\x77\x02\x10\x6f\x0a\x00\x00\x78\x07\x20\x79\x67\x2f\x06\x20"
+            "\x50\x61\x83\x13\x01\xfa\x08\xf0\x03\x79\x75\x6b\x75\x6d\x75\x6b\x75\x00\x54\x69\x70\x6f\x20\x5a\x65\x72\x6f\xde\x10\x31\x76\x61"
+            "\x6c\x63\x0b\x10\x6e\x76\x09\x61\x4b\x6f\x6d\x61\x6c\x61\x27\x0d\x00\x00\x18\x00\x88\x09\x90\x6f\x67\x65\x64\x65\x6d\x61\x72\x75"
+            "\x87\x0b\x90\x69\x6b\x79\x75\x00\x42\x72\x75\x78\x64\x06\x20\x44\x72\x98\x0c\x20\x00\x44\xa4\x05\x00\x9d\x0f\xd1\x4a\x61\x6e\x67"
+            "\x6d\x6f\x2d\x6f\x00\x48\x61\x6b\x61\x09\x00\x31\x4b\x6f\x6d\x08\x00\x83\x54\x61\x70\x75\x20\x4b\x6f\x6b\x0a\x00\x20\x4c\x65\x7c"
+            "\x0d\x00\x0a\x00\x42\x42\x75\x6c\x75\x0a\x00\x10\x46\x0d\x0a\x62\x43\x6f\x73\x6d\x6f\x67\x07\x00\x20\x65\x6d\x57\x07\x11\x67\x6a"
+            "\x0e\x00\x4a\x0f\x10\x6c\xc0\x10\xc1\x68\x69\x6c\x65\x67\x6f\x00\x42\x75\x7a\x7a\x77\xe8\x08\xe0\x68\x65\x72\x6f\x6d\x6f\x73\x61"
+            "\x00\x58\x75\x72\x6b\x69\xf2\x17\x01\x35\x12\x01\x23\x0e\x01\x37\x07\x30\x74\x61\x6e\x2f\x10\x22\x7a\x7a\x08\x10\x52\x65\x63\x72"
+            "\x6f\x7a\x61\x13\x11\x65\xbd\x09\x01\x21\x12\x20\x61\x64\xa0\x0c\x21\x6f\x69\x3c\x09\x90\x4e\x61\x67\x61\x6e\x61\x64\x65\x6c\xd1"
+            "\x0d\x20\x6b\x61\x04\x00\x00\x57\x12\x40\x63\x65\x70\x68\xee\x04\x50\x00\x5a\x65\x72\x61\x80\x14\x00",
+            9177, 10082
+        },
+    },
+    // Japanese
+    {
+        // characteristic_ja
+        {
+            "\xf1\x99\x1f\x00\x00\x00\x84\x00\x00\x00\x89\x00\x00\x00\xa5\x00\x00\x00\xbe\x00\x00\x00\xd7\x00\x00\x00\xf3\x00\x00\x00\x12\x01"
+            "\x00\x00\x28\x01\x00\x00\x44\x01\x00\x00\x63\x01\x00\x00\x82\x01\x00\x00\x98\x01\x00\x00\xb1\x01\x00\x00\xc4\x01\x00\x00\xd7\x01"
+            "\x00\x00\xed\x01\x00\x00\x00\x02\x00\x00\x16\x02\x00\x00\x32\x02\x00\x00\x4b\x02\x00\x00\x6a\x02\x00\x00\x83\x02\x00\x00\x9f\x02"
+            "\x00\x00\xb5\x02\x00\x00\xc8\x02\x00\x00\xe7\x02\x00\x00\x03\x03\x00\x00\x13\x03\x00\x00\x32\x03\x00\x00\x4b\x03\x00\x00\x5e\x03"
+            "\x00\x00\x7d\x03\x00\x00\x4e\x6f\x6e\x65\x00\xe3\x81\x9f\xe3\x81\xb9\xe3\x82\x8b\xe3\x81\xae\xe3\x81\x8c\xe3\x81\xa0\xe3\x81\x84"
+            "\xe3\x81\x99\xe3\x81\x8d\x00\xe3\x81\xb2\x19\x00\xa0\xad\xe3\x82\x92\xe3\x82\x88\xe3\x81\x8f\x19\x00\x31\x82\x8b\x00\x23\x00\x71"
+            "\xad\xe3\x82\x80\xe3\x82\x8a\x35\x00\x11\x8a\x03\x00\x50\x84\x00\xe3\x82\x82\x48\x00\x06\x2f\x00\xb1\xa1\xe3\x82\x89\xe3\x81\x8b"
+            "\xe3\x81\x99\x00\x19\x00\x41\x93\xe3\x81\xb3\x35\x00\x00\x48\x00\x04\x73\x00\x03\x6d\x00\x10\xa1\x29\x00\x00\x2f\x00\xf1\x05\x8c"
+            "\xe3\x81\x98\xe3\x81\xbe\xe3\x82\x93\x00\xe3\x81\x82\xe3\x81\xb0\xe3\x82\x8c\x2f\x00\x4a\x93\xe3\x81\xa8\x32\x00\x51\x82\x87\xe3"
+            "\x81\xa3\x16\x00\x10\x8a\x1f\x00\x00\x5a\x00\x42\xa3\xe3\x81\xbd\x8c\x00\x70\xb1\xe3\x83\xb3\xe3\x82\xab\x8f\x00\x0f\x70\x00\x04"
+            "\x4a\xae\xe3\x81\x91\xc1\x00\x03\x83\x00\x13\xa0\x86\x00\x00\x60\x00\x51\x86\xe3\x81\xb6\x00\x07\x00\x10\x9f\x89\x00\x21\x81\xa5"
+            "\xdd\x00\x00\x2c\x00\x11\xad\x9c\x00\x18\x8a\x13\x00\x11\x97\xe4\x00\x11\xbc\x2f\x00\x06\x16\x00\x12\x8c\xcf\x00\x08\x13\x00\x11"
+            "\x8b\x7b\x00\x11\xa3\xd5\x00\x05\x94\x00\x02\x3f\x01\x00\x8b\x00\x41\xa8\xe3\x81\xab\x2c\x01\x11\x93\x93\x00\x00\x0a\x01\x02\xdc"
+            "\x00\x02\xf4\x00\x14\x93\x09\x00\x00\x4b\x00\x11\x99\x10\x00\x11\x97\x22\x00\x02\x16\x00\x11\x86\x89\x00\x00\x4d\x00\x11\x00\x48"
+            "\x00\x17\x92\xfe\x00\x42\xaf\xe3\x82\x84\x38\x00\x11\x93\x29\x00\x14\x8d\xb5\x00\x44\x8c\xe3\x81\xa4\x9f\x00\xb8\x82\xa4\xe3\x82"
+            "\xbf\xe3\x82\xba\xe3\x83\xa9\x33\x01\x10\xac\xb5\x00\x21\x82\x81\x13\x00\x15\xaa\x30\x01\x02\x3c\x00\x44\x88\xe3\x81\x94\xa0\x01"
+            "\x06\x4f\x01\x41\xa8\xe3\x81\xa6\x8a\x00\x16\x8d\x9c\x00\x22\x82\x81\xd1\x00\x1a\x8d\x74\x00\x06\xcf\x01\x11\xb4\x55\x01\x11\xbf"
+            "\x54\x00\x80\xa3\xe3\x81\xb1\xe3\x82\x8a\x00\x42\x01\x00\x7d\x00\x1e\x93\x38\x00\x01\x19\x00\x51\x81\x9a\xe3\x81\x8e\xbc\x01\x0f"
+            "\x4b\x00\x00\x11\x94\xea\x00\x03\xcf\x01\x10\x00",
+            588, 893
+        },
+        // dppt_ja
+        {
+            "\xf2\xff\xd2\x71\x00\x00\x00\xcc\x01\x00\x00\xda\x01\x00\x00\xe6\x01\x00\x00\xf4\x01\x00\x00\x03\x02\x00\x00\x13\x02\x00\x00\x24"
+            "\x02\x00\x00\x36\x02\x00\x00\x47\x02\x00\x00\x55\x02\x00\x00\x65\x02\x00\x00\x8a\x02\x00\x00\x99\x02\x00\x00\xa8\x02\x00\x00\xb9"
+            "\x02\x00\x00\xc8\x02\x00\x00\xd7\x02\x00\x00\xe6\x02\x00\x00\xf5\x02\x00\x00\x0a\x03\x00\x00\x2b\x03\x00\x00\x4c\x03\x00\x00\x5c"
+            "\x03\x00\x00\x6f\x03\x00\x00\x82\x03\x00\x00\x95\x03\x00\x00\xa8\x03\x00\x00\xbb\x03\x00\x00\xce\x03\x00\x00\xdd\x03\x00\x00\xed"
+            "\x03\x00\x00\xfd\x03\x00\x00\x0e\x04\x00\x00\x27\x04\x00\x00\x40\x04\x00\x00\x59\x04\x00\x00\x66\x04\x00\x00\x77\x04\x00\x00\x89"
+            "\x04\x00\x00\x98\x04\x00\x00\xb0\x04\x00\x00\xc8\x04\x00\x00\xd7\x04\x00\x00\xee\x04\x00\x00\x07\x05\x00\x00\x20\x05\x00\x00\x34"
+            "\x05\x00\x00\x49\x05\x00\x00\x5e\x05\x00\x00\x73\x05\x00\x00\x88\x05\x00\x00\x9d\x05\x00\x00\xaa\x05\x00\x00\xc0\x05\x00\x00\xde"
+            "\x05\x00\x00\xfc\x05\x00\x00\x0a\x06\x00\x00\x18\x06\x00\x00\x24\x06\x00\x00\x33\x06\x00\x00\x43\x06\x00\x00\x5a\x06\x00\x00\x72"
+            "\x06\x00\x00\x82\x06\x00\x00\x8e\x06\x00\x00\xa1\x06\x00\x00\xad\x06\x00\x00\xb8\x06\x00\x00\xc4\x06\x00\x00\xd4\x06\x00\x00\xe5"
+            "\x06\x00\x00\xef\x06\x00\x00\xf9\x06\x00\x00\x03\x07\x00\x00\x15\x07\x00\x00\x27\x07\x00\x00\x39\x07\x00\x00\x4b\x07\x00\x00\x55"
+            "\x07\x00\x00\x5f\x07\x00\x00\x69\x07\x00\x00\x73\x07\x00\x00\x81\x07\x00\x00\x8f\x07\x00\x00\x9d\x07\x00\x00\xab\x07\x00\x00\xb9"
+            "\x07\x00\x00\xcb\x07\x00\x00\xdd\x07\x00\x00\xee\x07\x00\x00\xff\x07\x00\x00\x11\x08\x00\x00\x23\x08\x00\x00\x2d\x08\x00\x00\x37"
+            "\x08\x00\x00\x41\x08\x00\x00\x4b\x08\x00\x00\x55\x08\x00\x00\x5f\x08\x00\x00\x69\x08\x00\x00\x73\x08\x00\x00\x7d\x08\x00\x00\x87"
+            "\x08\x00\x00\x91\x08\x00\x00\x9b\x08\x00\x00\xa5\x08\x00\x00\xaf\x08\x00\x00\xbd\x08\x00\x00\xcb\x08\x00\x00\xd7\x08\x00\x00\xe1"
+            "\x08\x00\x00\xeb\x08\x00\x00\xf5\x08\x00\x00\xff\x08\x00\x00\x43\x61\x6e\x61\x6c\x61\x76\x65\x20\x43\x69\x74\x79\x00\x45\x74\x65"
+            "\x72\x6e\x61\x0c\x00\x73\x50\x61\x73\x74\x6f\x72\x69\x0e\x00\x83\x53\x75\x6e\x79\x73\x68\x6f\x72\x29\x00\xfb\x11\x50\x6f\x6b\xc3"
+            "\xa9\x6d\x6f\x6e\x20\x4c\x65\x61\x67\x75\x65\x00\x4f\x72\x65\x62\x75\x72\x67\x68\x20\x4d\x69\x6e\x65\x20\x31\x46\x11\x00\xf4\x05"
+            "\x42\x31\x46\x00\x56\x61\x6c\x6c\x65\x79\x20\x57\x69\x6e\x64\x77\x6f\x72\x6b\x73\x6d\x00\xf2\x02\x46\x6f\x72\x65\x73\x74\x00\x46"
+            "\x75\x65\x67\x6f\x20\x49\x72\x6f\x6e\x1e\x00\xf9\x15\x4d\x74\x2e\x20\x43\x6f\x72\x6f\x6e\x65\x74\x20\x28\x52\x6f\x75\x74\x65\x20"
+            "\x32\x30\x37\x2f\x32\x30\x38\x20\x45\x6e\x74\x72\x61\x6e\x63\x65\x29\x25\x00\x29\x32\x46\x0f\x00\x1a\x33\x0f\x00\x49\x53\x6e\x6f"
+            "\x77\x11\x00\x1a\x34\x20\x00\x1a\x35\x0f\x00\x1a\x36\x0f\x00\x1a\x37\x0f\x00\x8f\x54\x6f\x70\x20\x43\x61\x76\x65\xa5\x00\x02\x2f"
+            "\x31\x36\xa1\x00\x04\x05\x21\x00\x1f\x31\x21\x00\x04\x00\x26\x01\xfe\x03\x47\x72\x65\x61\x74\x20\x4d\x61\x72\x73\x68\x20\x41\x72"
+            "\x65\x61\x20\x31\x13\x00\x1e\x32\x13\x00\x1e\x33\x13\x00\x1e\x34\x13\x00\x1e\x35\x13\x00\xf0\x0e\x36\x00\x53\x6f\x6c\x61\x63\x65"
+            "\x6f\x6e\x20\x52\x75\x69\x6e\x73\x00\x56\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\xc9\x01\x09\x10\x00\x1b\x32\x10\x00\x01\xd8"
+            "\x01\x09\x11\x00\xaf\x61\x63\x6b\x20\x52\x6f\x6f\x6d\x20\x31\x19\x00\x05\x1f\x32\x19\x00\x05\xe6\x33\x00\x52\x61\x76\x61\x67\x65"
+            "\x64\x20\x50\x61\x74\x68\x42\x02\x3a\x47\x61\x74\x53\x02\x01\x11\x00\x00\x7b\x00\xeb\x53\x74\x61\x72\x6b\x20\x4d\x6f\x75\x6e\x74"
+            "\x61\x69\x6e\x0f\x00\x05\x65\x01\x0c\x18\x00\xf0\x0e\x49\x6e\x74\x65\x72\x69\x6f\x72\x00\x53\x65\x6e\x64\x6f\x66\x66\x20\x53\x70"
+            "\x72\x69\x6e\x67\x00\x54\x75\x72\x6e\x62\x8e\x00\x00\xdb\x01\x06\x3e\x00\x0a\x17\x00\xab\x31\x73\x74\x20\x50\x69\x6c\x6c\x61\x72"
+            "\x19\x00\x34\x32\x6e\x64\x19\x00\x00\x6c\x02\xb1\x70\x6f\x69\x6e\x74\x20\x54\x65\x6d\x70\x6c\xbd\x00\x0d\x14\x00\x01\xc0\x00\x0d"
+            "\x15\x00\x1f\x32\x15\x00\x01\x1f\x33\x15\x00\x01\x1f\x34\x15\x00\x01\xa2\x35\x46\x00\x57\x61\x79\x77\x61\x72\x64\xa0\x02\x08\x0d"
+            "\x00\xa0\x20\x28\x53\x65\x63\x72\x65\x74\x29\x00\xe9\x01\x73\x20\x4d\x61\x6e\x69\x61\x63\x1a\x00\xaf\x3c\x20\x31\x30\x20\x55\x6e"
+            "\x6f\x77\x6e\x1e\x00\x01\x17\x3e\x1e\x00\x03\x19\x00\xf0\x06\x54\x75\x6e\x6e\x65\x6c\x00\x54\x72\x6f\x70\x68\x79\x20\x47\x61\x72"
+            "\x64\x65\x6e\x00\xbd\x03\x78\x20\x49\x73\x6c\x61\x6e\x64\x0c\x00\x00\xff\x00\x08\x0f\x00\x00\xfa\x00\x09\x10\x00\x9e\x32\x46\x20"
+            "\x28\x4c\x65\x66\x74\x29\x17\x00\x4c\x52\x69\x67\x68\x18\x00\xe8\x33\x46\x00\x4f\x6c\x64\x20\x43\x68\x61\x74\x65\x61\x75\x0c\x00"
+            "\x02\x48\x02\xa0\x35\x00\x4c\x61\x6b\x65\x20\x56\x65\x72\xaa\x04\x02\x0c\x00\x42\x61\x6c\x6f\x72\x0b\x00\x30\x41\x63\x75\x17\x00"
+            "\x01\x12\x00\x10\x20\x12\x00\x62\x66\x72\x6f\x6e\x74\x00\x17\x00\x07\x11\x00\x04\x73\x04\x15\x31\x0a\x00\x15\x32\x0a\x00\x15\x33"
+            "\x0a\x00\x98\x34\x20\x28\x53\x6f\x75\x74\x68\x29\x12\x00\x38\x4e\x6f\x72\x12\x00\x1d\x35\x24\x00\x1d\x35\x24\x00\x15\x36\x0a\x00"
+            "\x15\x37\x0a\x00\x15\x38\x0a\x00\x50\x39\x00\x4c\x6f\x73\x77\x04\x30\x77\x65\x72\x4e\x01\x07\x0e\x00\x19\x32\x0e\x00\x19\x33\x0e"
+            "\x00\x19\x34\x0e\x00\x24\x35\x46\x50\x00\x2c\x31\x30\x92\x00\x00\x12\x00\x0a\x92\x00\x70\x31\x31\x20\x28\x57\x65\x73\x2e\x02\x06"
+            "\x11\x00\x28\x45\x61\x11\x00\x1d\x32\x34\x00\x1d\x32\x58\x00\x05\x2a\x01\x25\x31\x34\x0a\x00\x15\x35\x0a\x00\x05\xf6\x00\x15\x31"
+            "\xf6\x00\x15\x31\xf6\x00\x24\x31\x39\x0a\x00\x15\x32\x84\x01\x15\x32\x84\x01\x15\x32\x50\x00\x15\x32\x50\x00\x15\x32\x46\x00\x15"
+            "\x32\x46\x00\xb0\x32\x39\x00\x54\x77\x69\x6e\x6c\x65\x61\x66\x08\x01\xa2\x6e\x00\x43\x65\x6c\x65\x73\x74\x69\x63\x0e\x00\x61\x52"
+            "\x65\x73\x6f\x72\x74\x0b\x05\x05\x32\x00\x15\x30\x0a\x00\x05\xbe\x00\x15\x32\xaa\x00\x30\x33\x30\x00",
+            1369, 2303
+        },
+        // frlg_ja
+        {
+            "\xf4\xff\xc6\x6b\x00\x00\x00\xb4\x01\x00\x00\xc0\x01\x00\x00\xce\x01\x00\x00\xdc\x01\x00\x00\xeb\x01\x00\x00\xf8\x01\x00\x00\x05"
+            "\x02\x00\x00\x15\x02\x00\x00\x1d\x02\x00\x00\x25\x02\x00\x00\x2d\x02\x00\x00\x35\x02\x00\x00\x3d\x02\x00\x00\x45\x02\x00\x00\x4d"
+            "\x02\x00\x00\x55\x02\x00\x00\x5d\x02\x00\x00\x66\x02\x00\x00\x6f\x02\x00\x00\x78\x02\x00\x00\x81\x02\x00\x00\x8a\x02\x00\x00\x93"
+            "\x02\x00\x00\x9c\x02\x00\x00\xa5\x02\x00\x00\xae\x02\x00\x00\xb7\x02\x00\x00\xc0\x02\x00\x00\xc9\x02\x00\x00\xd2\x02\x00\x00\xdb"
+            "\x02\x00\x00\xe4\x02\x00\x00\xed\x02\x00\x00\xfd\x02\x00\x00\x09\x03\x00\x00\x16\x03\x00\x00\x23\x03\x00\x00\x2d\x03\x00\x00\x3c"
+            "\x03\x00\x00\x4c\x03\x00\x00\x5c\x03\x00\x00\x6c\x03\x00\x00\x83\x03\x00\x00\x98\x03\x00\x00\xab\x03\x00\x00\xbe\x03\x00\x00\xd1"
+            "\x03\x00\x00\xe4\x03\x00\x00\xf3\x03\x00\x00\x03\x04\x00\x00\x16\x04\x00\x00\x2a\x04\x00\x00\x3e\x04\x00\x00\x52\x04\x00\x00\x66"
+            "\x04\x00\x00\x78\x04\x00\x00\x8a\x04\x00\x00\x9c\x04\x00\x00\xae\x04\x00\x00\xc0\x04\x00\x00\xd1\x04\x00\x00\xe2\x04\x00\x00\xf4"
+            "\x04\x00\x00\x00\x05\x00\x00\x0b\x05\x00\x00\x17\x05\x00\x00\x23\x05\x00\x00\x2f\x05\x00\x00\x3e\x05\x00\x00\x49\x05\x00\x00\x55"
+            "\x05\x00\x00\x65\x05\x00\x00\x75\x05\x00\x00\x85\x05\x00\x00\x96\x05\x00\x00\xa6\x05\x00\x00\xb5\x05\x00\x00\xc0\x05\x00\x00\xcb"
+            "\x05\x00\x00\xd7\x05\x00\x00\xf0\x05\x00\x00\x00\x06\x00\x00\x0f\x06\x00\x00\x1c\x06\x00\x00\x26\x06\x00\x00\x37\x06\x00\x00\x48"
+            "\x06\x00\x00\x59\x06\x00\x00\x66\x06\x00\x00\x74\x06\x00\x00\x82\x06\x00\x00\x90\x06\x00\x00\x9e\x06\x00\x00\xac\x06\x00\x00\xb9"
+            "\x06\x00\x00\xc6\x06\x00\x00\xd6\x06\x00\x00\xe7\x06\x00\x00\xf9\x06\x00\x00\x06\x07\x00\x00\x14\x07\x00\x00\x23\x07\x00\x00\x32"
+            "\x07\x00\x00\x41\x07\x00\x00\x51\x07\x00\x00\x60\x07\x00\x00\x6d\x07\x00\x00\x7d\x07\x00\x00\x50\x61\x6c\x6c\x65\x74\x20\x54\x6f"
+            "\x77\x6e\x00\x56\x69\x72\x69\x64\x69\x61\x6e\x20\x43\x69\x74\x79\x00\x43\x65\x72\x75\x6c\x65\x0e\x00\x85\x56\x65\x72\x6d\x69\x6c"
+            "\x69\x6f\x1d\x00\x34\x6c\x61\x64\x0d\x00\x73\x46\x75\x63\x68\x73\x69\x61\x1a\x00\xf3\x07\x69\x6e\x6e\x61\x62\x61\x72\x20\x49\x73"
+            "\x6c\x61\x6e\x64\x00\x52\x6f\x75\x74\x65\x20\x31\x08\x00\x13\x32\x08\x00\x13\x33\x08\x00\x13\x34\x08\x00\x13\x35\x08\x00\x13\x36"
+            "\x08\x00\x13\x37\x08\x00\x13\x38\x08\x00\x14\x39\x48\x00\x14\x30\x09\x00\x04\x52\x00\x14\x31\x53\x00\x14\x31\x54\x00\x14\x31\x55"
+            "\x00\x14\x31\x56\x00\x14\x31\x57\x00\x14\x31\x58\x00\x14\x31\x59\x00\x14\x31\x5a\x00\x14\x32\x5a\x00\x15\x32\xac\x00\x04\x5a\x00"
+            "\x14\x32\x5a\x00\x14\x32\x5a\x00\x26\x32\x35\x2d\x01\xf6\x03\x46\x6f\x72\x65\x73\x74\x00\x4d\x74\x2e\x20\x4d\x6f\x6f\x6e\x20\x31"
+            "\x46\x0c\x00\x19\x42\x0d\x00\xf0\x19\x32\x46\x00\x53\x2e\x53\x2e\x20\x41\x6e\x6e\x65\x00\x44\x69\x67\x6c\x65\x74\x74\x27\x73\x20"
+            "\x43\x61\x76\x65\x00\x56\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\x43\x00\x09\x10\x00\x1b\x32\x10\x00\xf0\x01\x33\x46\x00\x50"
+            "\x6f\x6b\xc3\xa9\x6d\x6f\x6e\x20\x4d\x61\x6e\x73\x97\x01\x3f\x31\x46\x2d\x17\x00\x01\x00\x82\x00\xf9\x03\x53\x61\x66\x61\x72\x69"
+            "\x20\x5a\x6f\x6e\x65\x20\x43\x65\x6e\x74\x65\x72\x13\x00\x6e\x41\x72\x65\x61\x20\x31\x13\x00\x1e\x32\x13\x00\x00\x09\x01\x90\x63"
+            "\x6b\x20\x54\x75\x6e\x6e\x65\x6c\xa7\x00\x08\x0f\x00\x01\x6b\x00\x63\x65\x61\x66\x6f\x61\x6d\xfd\x01\x10\x73\x23\x00\x0c\x13\x00"
+            "\x0f\x27\x00\x01\x01\x1b\x01\x0c\x14\x00\x1f\x33\x14\x00\x00\x17\x34\xe3\x00\x59\x54\x6f\x77\x65\x72\x0c\x01\x02\x12\x00\x0e\x24"
+            "\x00\x1d\x35\x12\x00\x1d\x36\x12\x00\x27\x37\x46\xf2\x02\x30\x61\x76\x65\xbb\x00\x0a\x11\x00\x1c\x32\x11\x00\x00\xca\x00\x11\x50"
+            "\x3d\x00\x94\x50\x6c\x61\x6e\x74\x00\x4f\x6e\x65\xf6\x02\x35\x46\x6f\x75\x02\x03\x35\x46\x69\x76\x18\x00\x61\x4b\x69\x6e\x64\x6c"
+            "\x65\xc6\x01\xf0\x10\x00\x54\x72\x65\x61\x73\x75\x72\x65\x20\x42\x65\x61\x63\x68\x00\x43\x61\x70\x65\x20\x42\x72\x69\x6e\x6b\x00"
+            "\x42\x6f\x6e\x64\x0b\x00\x81\x64\x67\x65\x00\x54\x68\x72\x65\x3f\x00\xf5\x17\x65\x20\x50\x6f\x72\x74\x00\x52\x65\x73\x6f\x72\x74"
+            "\x20\x47\x6f\x72\x67\x65\x6f\x75\x73\x00\x57\x61\x74\x65\x72\x20\x4c\x61\x62\x79\x72\x69\x6e\x74\x68\x6e\x00\xf4\x11\x65\x20\x4d"
+            "\x65\x61\x64\x6f\x77\x00\x4d\x65\x6d\x6f\x72\x69\x61\x6c\x20\x50\x69\x6c\x6c\x61\x72\x00\x4f\x75\x74\x63\x61\x73\x74\x92\x00\xa3"
+            "\x47\x72\x65\x65\x6e\x20\x50\x61\x74\x68\x4b\x00\x01\x0b\x00\x60\x52\x75\x69\x6e\x20\x56\x1c\x04\x93\x79\x00\x54\x72\x61\x69\x6e"
+            "\x65\x72\x28\x01\xf2\x14\x28\x65\x78\x74\x65\x72\x69\x6f\x72\x29\x00\x43\x61\x6e\x79\x6f\x6e\x20\x45\x6e\x74\x72\x61\x6e\x63\x65"
+            "\x00\x53\x65\x76\x61\x75\x6c\x74\x20\x18\x00\x80\x00\x54\x61\x6e\x6f\x62\x79\x20\x4b\x00\x11\x73\x06\x03\x56\x45\x6d\x62\x65\x72"
+            "\x0a\x00\x7c\x20\x52\x6f\x6f\x6d\x20\x31\x11\x00\x1c\x32\x11\x00\x17\x33\x11\x00\x03\x50\x03\x02\x0d\x00\x04\x5e\x03\x03\x0e\x00"
+            "\x19\x32\x0e\x00\x19\x33\x0e\x00\x19\x34\x0e\x00\x84\x35\x46\x00\x42\x65\x72\x72\x79\xbc\x03\x72\x49\x63\x65\x66\x61\x6c\x6c\x8a"
+            "\x03\x08\x0d\x00\x00\x70\x00\x09\x10\x00\x00\x73\x00\x0a\x11\x00\xf0\x04\x61\x63\x6b\x00\x50\x61\x74\x74\x65\x72\x6e\x20\x42\x75"
+            "\x73\x68\x00\x41\x6c\x20\x01\x22\x6e\x67\x4e\x00\x31\x4d\x6f\x6e\x30\x02\x21\x68\x61\xfd\x00\x65\x4c\x69\x70\x74\x6f\x6f\x0f\x00"
+            "\x65\x57\x65\x65\x70\x74\x68\x0f\x00\x75\x44\x69\x6c\x66\x6f\x72\x64\x10\x00\x65\x53\x63\x75\x66\x69\x62\x0f\x00\x45\x52\x69\x78"
+            "\x79\x0d\x00\x75\x56\x69\x61\x70\x6f\x69\x73\x10\x00\x00",
+            1294, 1917
+        },
+        // hgss_ja
+        {
+            "\xf3\xff\xff\x02\x78\x00\x00\x00\xe8\x01\x00\x00\xf6\x01\x00\x00\xff\x01\x00\x00\x10\x02\x00\x00\x19\x02\x00\x00\x22\x02\x00\x00"
+            "\x2e\x02\x00\x00\x3b\x02\x00\x00\x44\x02\x00\x00\x5c\x02\x00\x00\x73\x02\x00\x00\x81\x02\x00\x00\x90\x02\x00\x00\x9f\x02\x00\x00"
+            "\xa8\x02\x00\x00\xb9\x02\x00\x00\xcb\x02\x00\x00\xd7\x02\x00\x00\xe0\x02\x00\x00\xe9\x02\x00\x00\xf7\x02\x00\x00\x00\x03\x00\x00"
+            "\x09\x03\x00\x00\x17\x03\x00\x00\x27\x03\x00\x00\x38\x03\x00\x00\x43\x03\x00\x00\x4c\x03\x00\x00\x55\x03\x00\x00\x62\x03\x00\x00"
+            "\x6b\x03\x00\x00\x74\x03\x00\x00\x85\x03\x00\x00\x97\x03\x00\x00\xa9\x03\x00\x00\xbb\x03\x00\x00\xc9\x03\x00\x00\xd2\x03\x00\x00"
+            "\xe0\x03\x00\x00\xf5\x03\x00\x00\x03\x04\x00\x00\x12\x04\x00\x00\x1b\x04\x00\x00\x28\x04\x00\x00\x31\x04\x00\x00\x3d\x04\x00\x00"
+            "\x4a\x04\x00\x00\x57\x04\x00\x00\x64\x04\x00\x00\x74\x04\x00\x00\x83\x04\x00\x00\x8c\x04\x00\x00\x95\x04\x00\x00\xaa\x04\x00\x00"
+            "\xbf\x04\x00\x00\xc8\x04\x00\x00\xd1\x04\x00\x00\xe5\x04\x00\x00\xf8\x04\x00\x00\x0c\x05\x00\x00\x20\x05\x00\x00\x34\x05\x00\x00"
+            "\x48\x05\x00\x00\x56\x05\x00\x00\x6d\x05\x00\x00\x7b\x05\x00\x00\x8b\x05\x00\x00\x96\x05\x00\x00\xa1\x05\x00\x00\xaf\x05\x00\x00"
+            "\xcc\x05\x00\x00\xdf\x05\x00\x00\xee\x05\x00\x00\xf7\x05\x00\x00\x00\x06\x00\x00\x09\x06\x00\x00\x15\x06\x00\x00\x23\x06\x00\x00"
+            "\x31\x06\x00\x00\x40\x06\x00\x00\x4d\x06\x00\x00\x5a\x06\x00\x00\x6a\x06\x00\x00\x73\x06\x00\x00\x7c\x06\x00\x00\x85\x06\x00\x00"
+            "\x8e\x06\x00\x00\x97\x06\x00\x00\xa6\x06\x00\x00\xb5\x06\x00\x00\xc5\x06\x00\x00\xcd\x06\x00\x00\xdd\x06\x00\x00\xe5\x06\x00\x00"
+            "\xed\x06\x00\x00\xf5\x06\x00\x00\xfd\x06\x00\x00\x05\x07\x00\x00\x0d\x07\x00\x00\x15\x07\x00\x00\x1e\x07\x00\x00\x27\x07\x00\x00"
+            "\x30\x07\x00\x00\x39\x07\x00\x00\x42\x07\x00\x00\x4b\x07\x00\x00\x54\x07\x00\x00\x5d\x07\x00\x00\x66\x07\x00\x00\x6f\x07\x00\x00"
+            "\x78\x07\x00\x00\x81\x07\x00\x00\x8d\x07\x00\x00\x9e\x07\x00\x00\xae\x07\x00\x00\xbe\x07\x00\x00\xce\x07\x00\x00\xde\x07\x00\x00"
+            "\xef\x07\x00\x00\x00\x08\x00\x00\x12\x08\x00\x00\x4e\x65\x77\x20\x42\x61\x72\x6b\x20\x54\x6f\x77\x6e\x00\x52\x6f\x75\x74\x65\x20"
+            "\x32\x39\x00\x43\x68\x65\x72\x72\x79\x67\x72\x6f\x76\x65\x20\x43\x69\x74\x79\x1a\x00\x24\x33\x30\x09\x00\x82\x31\x00\x56\x69\x6f"
+            "\x6c\x65\x74\x1e\x00\x60\x53\x70\x72\x6f\x75\x74\x44\x00\x24\x65\x72\x22\x00\xfc\x0a\x32\x00\x52\x75\x69\x6e\x73\x20\x6f\x66\x20"
+            "\x41\x6c\x70\x68\x20\x28\x4f\x75\x74\x73\x69\x64\x65\x29\x18\x00\x22\x49\x6e\x17\x00\xd8\x55\x6e\x69\x6f\x6e\x20\x43\x61\x76\x65"
+            "\x20\x31\x46\x0e\x00\x1b\x42\x0f\x00\x24\x32\x46\x64\x00\xf0\x00\x33\x00\x53\x4c\x4f\x57\x50\x4f\x4b\x45\x20\x57\x65\x6c\x6c\x38"
+            "\x00\x0a\x11\x00\x00\x3b\x00\xb4\x49\x6c\x65\x78\x20\x46\x6f\x72\x65\x73\x74\x38\x00\x14\x34\x09\x00\xf4\x00\x35\x00\x4e\x61\x74"
+            "\x69\x6f\x6e\x61\x6c\x20\x50\x61\x72\x6b\x17\x00\x14\x36\x09\x00\xa2\x37\x00\x45\x63\x72\x75\x74\x65\x61\x6b\xe9\x00\x62\x42\x75"
+            "\x72\x6e\x65\x64\xe9\x00\x00\x6e\x00\x09\x10\x00\x00\x6d\x00\x10\x42\x76\x00\x09\x08\x01\x14\x38\x09\x00\x89\x39\x00\x4f\x6c\x69"
+            "\x76\x69\x6e\x52\x01\x14\x34\x52\x01\xf0\x01\x34\x31\x00\x57\x68\x69\x72\x6c\x20\x49\x73\x6c\x61\x6e\x64\x73\x5e\x00\x0a\x11\x00"
+            "\x00\x5f\x00\x0b\x12\x00\x1d\x32\x12\x00\xb9\x33\x46\x00\x43\x69\x61\x6e\x77\x6f\x6f\x64\x67\x00\xb1\x32\x00\x4d\x74\x2e\x20\x4d"
+            "\x6f\x72\x74\x61\xb9\x00\x09\x0e\x00\x78\x20\x28\x42\x61\x63\x6b\x29\x15\x00\x19\x32\x23\x00\x00\x7b\x00\x03\x49\x00\x60\x33\x00"
+            "\x4c\x61\x6b\x65\xbe\x01\x44\x52\x61\x67\x65\x16\x00\xa0\x34\x00\x49\x63\x65\x20\x50\x61\x74\x68\x5d\x00\x05\x0c\x00\x01\x7f\x01"
+            "\x05\x0d\x00\x18\x32\x0d\x00\xd2\x33\x46\x00\x42\x6c\x61\x63\x6b\x74\x68\x6f\x72\x6e\xab\x00\xd4\x44\x72\x61\x67\x6f\x6e\xe2\x80"
+            "\x99\x73\x20\x44\x65\x8d\x02\x24\x34\x35\x09\x00\x30\x36\x00\x44\xa9\x02\x01\x04\x02\x14\x28\x87\x02\x1e\x29\x15\x00\x34\x34\x35"
+            "\x29\x33\x00\x13\x37\xc5\x00\x25\x6f\x6e\x09\x00\xf8\x04\x20\x28\x43\x6c\x65\x66\x61\x69\x72\x79\x29\x00\x53\x65\x61\x66\x6f\x61"
+            "\x6d\x73\x01\x0c\x13\x00\x00\xc2\x00\x0d\x14\x00\x1f\x32\x14\x00\x00\x1f\x33\x14\x00\x00\x12\x34\x45\x01\x42\x53\x69\x6c\x76\x2f"
+            "\x02\x07\x0e\x00\x03\xe8\x02\x48\x20\x54\x6f\x70\x17\x00\xf3\x03\x34\x46\x00\x43\x6c\x69\x66\x66\x20\x45\x64\x67\x65\x20\x47\x61"
+            "\x74\x65\x10\x00\x00\x30\x00\x07\x29\x00\x08\x34\x00\x03\xac\x01\x08\x59\x00\x71\x4d\x6f\x75\x6e\x74\x61\x69\x5a\x03\x0d\x1d\x00"
+            "\x19\x33\x30\x00\x00\x81\x00\x02\x2f\x01\x24\x31\x32\x09\x00\x14\x39\x0a\x04\x50\x30\x00\x50\x61\x6c\xe7\x03\x01\x1f\x04\x73\x56"
+            "\x69\x72\x69\x64\x69\x61\xaf\x01\x64\x43\x65\x72\x75\x6c\x65\x0e\x00\x61\x56\x65\x72\x6d\x69\x6c\xa5\x03\x02\x1d\x00\x34\x6c\x61"
+            "\x64\x0d\x00\x73\x46\x75\x63\x68\x73\x69\x61\x1a\x00\x73\x69\x6e\x6e\x61\x62\x61\x72\x27\x01\x04\xab\x01\x04\x27\x03\x14\x32\x7c"
+            "\x03\x24\x32\x37\x09\x00\x16\x38\xc6\x01\xa1\x52\x6f\x63\x6b\x20\x54\x75\x6e\x6e\x65\xed\x03\x08\x0f\x00\xf2\x00\x32\x46\x00\x56"
+            "\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\x1f\x00\x01\xce\x00\x04\x48\x00\x74\x20\x28\x53\x6f\x75\x74\x68\x1e\x02\x14\x33\x7b"
+            "\x00\x03\x08\x00\x04\x69\x02\x04\x81\x00\x04\x80\x00\x04\x9a\x00\x04\x15\x01\x14\x31\xb3\x03\x14\x31\x5a\x00\x14\x31\x4b\x00\x14"
+            "\x31\x4c\x00\x14\x31\x4d\x00\x14\x31\x4e\x00\x14\x31\x4f\x00\x15\x31\xea\x00\x05\x99\x00\x04\x78\x01\x14\x32\x3f\x00\xf1\x07\x32"
+            "\x35\x00\x54\x6f\x68\x6a\x6f\x20\x46\x61\x6c\x6c\x73\x00\x44\x49\x47\x4c\x45\x54\x54\x1a\x03\x01\x08\x02\x09\xe9\x00\x0c\xf9\x00"
+            "\x14\x33\xf9\x00\x60\x32\x20\x28\x4e\x6f\x72\xf1\x00\x05\xb9\x01\x03\x07\x05\x06\xbb\x01\x03\x6e\x05\x0a\x11\x00\x1c\x32\x11\x00"
+            "\x00\x06\x03\x00",
+            1348, 2066
+        },
+        // natures_ja
+        {
+            "\xf1\x76\x19\x00\x00\x00\x6c\x00\x00\x00\x7c\x00\x00\x00\x8c\x00\x00\x00\x99\x00\x00\x00\xa9\x00\x00\x00\xb6\x00\x00\x00\xc3\x00"
+            "\x00\x00\xcd\x00\x00\x00\xd7\x00\x00\x00\xe4\x00\x00\x00\xf4\x00\x00\x00\x04\x01\x00\x00\x11\x01\x00\x00\x1b\x01\x00\x00\x25\x01"
+            "\x00\x00\x32\x01\x00\x00\x3f\x01\x00\x00\x4c\x01\x00\x00\x59\x01\x00\x00\x63\x01\x00\x00\x73\x01\x00\x00\x80\x01\x00\x00\x90\x01"
+            "\x00\x00\x9d\x01\x00\x00\xad\x01\x00\x00\xba\x01\x00\x00\xe3\x81\x8c\xe3\x82\x93\xe3\x81\xb0\xe3\x82\x8a\xe3\x82\x84\x00\xe3\x81"
+            "\x95\xe3\x81\xbf\xe3\x81\x97\x19\x00\xf2\x0c\x8a\x00\xe3\x82\x86\xe3\x81\x86\xe3\x81\x8b\xe3\x82\x93\x00\xe3\x81\x84\xe3\x81\x98"
+            "\xe3\x81\xa3\xe3\x81\xb1\x1d\x00\x11\x84\x3d\x00\xf0\x01\xa1\xe3\x82\x83\x00\xe3\x81\x9a\xe3\x81\xb6\xe3\x81\xa8\xe3\x81\x47\x00"
+            "\xb1\x99\xe3\x81\xaa\xe3\x81\x8a\x00\xe3\x81\xae\x24\x00\x51\x8d\x00\xe3\x82\x8f\x0a\x00\x41\xb1\xe3\x81\x8f\x17\x00\x00\x58\x00"
+            "\x14\xa6\x1d\x00\xf1\x03\x81\x8a\xe3\x81\x8f\xe3\x81\xb3\xe3\x82\x87\xe3\x81\x86\x00\xe3\x81\x9b\x68\x00\x80\x8b\xe3\x81\xa1\x00"
+            "\xe3\x81\xbe\x78\x00\x61\x82\x81\x00\xe3\x82\x88\x37\x00\x00\x4e\x00\x11\x80\x14\x00\x12\x83\x3e\x00\x11\xb2\x2b\x00\x11\x88\x24"
+            "\x00\x00\x4b\x00\x10\xa3\x89\x00\x01\xa3\x00\x11\x8c\xb6\x00\x12\x9b\x96\x00\x10\xa6\x10\x00\x01\xe7\x00\x13\x86\x5f\x00\x04\xf7"
+            "\x00\x40\x8a\xe3\x81\xa0\xd0\x00\x22\x81\x8b\x0d\x00\x11\xa8\xc0\x00\x12\x97\x37\x00\x11\xaa\x82\x00\x12\x84\x6b\x00\x14\x97\xf4"
+            "\x00\x03\xa9\x00\x11\x8d\x1d\x00\x50\x90\xe3\x82\x8c\x00",
+            366, 442
+        },
+        // powers_ja
+        {
+            "\xf2\x4c\x10\x00\x00\x00\x48\x00\x00\x00\x55\x00\x00\x00\x5f\x00\x00\x00\x66\x00\x00\x00\x70\x00\x00\x00\x77\x00\x00\x00\x7e\x00"
+            "\x00\x00\x8b\x00\x00\x00\x95\x00\x00\x00\x9f\x00\x00\x00\xa6\x00\x00\x00\xad\x00\x00\x00\xb7\x00\x00\x00\xc4\x00\x00\x00\xce\x00"
+            "\x00\x00\xdb\x00\x00\x00\xe2\x00\x00\x00\xe3\x81\x8b\xe3\x81\x8f\xe3\x81\xa8\xe3\x81\x86\x00\xe3\x81\xb2\xe3\x81\x93\x0a\x00\xf1"
+            "\x36\xa9\xe3\x81\x8f\x00\xe3\x81\x98\xe3\x82\x81\xe3\x82\x93\x00\xe3\x81\x84\xe3\x82\x8f\x00\xe3\x82\x80\xe3\x81\x97\x00\xe3\x82"
+            "\xb4\xe3\x83\xbc\xe3\x82\xb9\xe3\x83\x88\x00\xe3\x81\xaf\xe3\x81\x8c\xe3\x81\xad\x00\xe3\x81\xbb\xe3\x81\xae\xe3\x81\x8a\x00\xe3"
+            "\x81\xbf\xe3\x81\x9a\x00\x5b\x00\xf1\x00\x95\x00\xe3\x81\xa7\xe3\x82\x93\xe3\x81\x8d\x00\xe3\x82\xa8\x36\x00\x51\x91\xe3\x83\xbc"
+            "\x00\x6c\x00\xb1\x8a\xe3\x82\x8a\x00\xe3\x83\x89\xe3\x83\xa9\x56\x00\x50\xb3\x00\xe3\x81\x82\x7c\x00\x00",
+            218, 226
+        },
+        // rse_ja
+        {
+            "\xf3\xff\x69\x56\x00\x00\x00\x60\x01\x00\x00\x6d\x01\x00\x00\x7d\x01\x00\x00\x8c\x01\x00\x00\x9b\x01\x00\x00\xa9\x01\x00\x00\xb7"
+            "\x01\x00\x00\xc7\x01\x00\x00\xd8\x01\x00\x00\xe2\x01\x00\x00\xec\x01\x00\x00\xf6\x01\x00\x00\x00\x02\x00\x00\x0a\x02\x00\x00\x14"
+            "\x02\x00\x00\x1e\x02\x00\x00\x28\x02\x00\x00\x32\x02\x00\x00\x3c\x02\x00\x00\x46\x02\x00\x00\x50\x02\x00\x00\x5a\x02\x00\x00\x64"
+            "\x02\x00\x00\x6e\x02\x00\x00\x78\x02\x00\x00\x82\x02\x00\x00\x8c\x02\x00\x00\x96\x02\x00\x00\xa0\x02\x00\x00\xaa\x02\x00\x00\xb4"
+            "\x02\x00\x00\xbe\x02\x00\x00\xc8\x02\x00\x00\xd2\x02\x00\x00\xdc\x02\x00\x00\xe6\x02\x00\x00\xf0\x02\x00\x00\xfa\x02\x00\x00\x04"
+            "\x03\x00\x00\x0e\x03\x00\x00\x18\x03\x00\x00\x22\x03\x00\x00\x2c\x03\x00\x00\x43\x03\x00\x00\x5a\x03\x00\x00\x6a\x03\x00\x00\x85"
+            "\x03\x00\x00\x96\x03\x00\x00\xa7\x03\x00\x00\xba\x03\x00\x00\xcd\x03\x00\x00\xe0\x03\x00\x00\xf3\x03\x00\x00\x06\x04\x00\x00\x19"
+            "\x04\x00\x00\x29\x04\x00\x00\x38\x04\x00\x00\x47\x04\x00\x00\x5f\x04\x00\x00\x77\x04\x00\x00\x8a\x04\x00\x00\x9d\x04\x00\x00\xb1"
+            "\x04\x00\x00\xc5\x04\x00\x00\xe0\x04\x00\x00\xef\x04\x00\x00\xfe\x04\x00\x00\x10\x05\x00\x00\x20\x05\x00\x00\x2b\x05\x00\x00\x3f"
+            "\x05\x00\x00\x4f\x05\x00\x00\x5f\x05\x00\x00\x70\x05\x00\x00\x81\x05\x00\x00\x99\x05\x00\x00\xa8\x05\x00\x00\xb3\x05\x00\x00\xbf"
+            "\x05\x00\x00\xcd\x05\x00\x00\xdb\x05\x00\x00\xe9\x05\x00\x00\xf7\x05\x00\x00\x04\x06\x00\x00\x11\x06\x00\x00\x22\x06\x00\x00\x30"
+            "\x06\x00\x00\x44\x65\x77\x66\x6f\x72\x64\x20\x54\x6f\x77\x6e\x00\x50\x61\x63\x69\x66\x69\x64\x6c\x6f\x67\x10\x00\xf2\x08\x65\x74"
+            "\x61\x6c\x62\x75\x72\x67\x20\x43\x69\x74\x79\x00\x53\x6c\x61\x74\x65\x70\x6f\x72\x74\x0f\x00\x82\x4c\x69\x6c\x79\x63\x6f\x76\x65"
+            "\x0e\x00\x83\x4d\x6f\x73\x73\x64\x65\x65\x70\x2b\x00\x92\x6f\x6f\x74\x6f\x70\x6f\x6c\x69\x73\x10\x00\xa3\x45\x76\x65\x72\x20\x47"
+            "\x72\x61\x6e\x64\x2f\x00\x95\x52\x6f\x75\x74\x65\x20\x31\x30\x31\x0a\x00\x15\x32\x0a\x00\x15\x33\x0a\x00\x15\x34\x0a\x00\x15\x35"
+            "\x0a\x00\x15\x36\x0a\x00\x15\x37\x0a\x00\x15\x38\x0a\x00\x14\x39\x0a\x00\x25\x31\x30\x0a\x00\x05\x64\x00\x15\x31\x64\x00\x15\x31"
+            "\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x32\x64\x00\x15\x32"
+            "\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32"
+            "\x64\x00\x15\x33\x64\x00\x15\x33\x64\x00\x15\x33\x64\x00\x15\x33\x64\x00\xf5\x00\x33\x34\x00\x55\x6e\x64\x65\x72\x77\x61\x74\x65"
+            "\x72\x20\x28\x7a\x00\x1f\x29\x17\x00\x02\x30\x36\x29\x00\x8e\x01\xba\x69\x74\x65\x20\x43\x61\x76\x65\x20\x31\x46\x10\x00\xda\x53"
+            "\x74\x65\x76\x65\x6e\x27\x73\x20\x52\x6f\x6f\x6d\x1b\x00\x1c\x42\x2c\x00\xfe\x07\x42\x32\x46\x00\x53\x61\x66\x61\x72\x69\x20\x5a"
+            "\x6f\x6e\x65\x20\x41\x72\x65\x61\x20\x31\x13\x00\x1e\x32\x13\x00\x1e\x33\x13\x00\x1e\x34\x13\x00\x1e\x35\x13\x00\x17\x36\x9c\x02"
+            "\xfb\x2c\x57\x6f\x6f\x64\x73\x00\x52\x75\x73\x74\x75\x72\x66\x20\x54\x75\x6e\x6e\x65\x6c\x00\x41\x62\x61\x6e\x64\x6f\x6e\x65\x64"
+            "\x20\x53\x68\x69\x70\x00\x4e\x65\x77\x20\x4d\x61\x75\x76\x69\x6c\x6c\x65\x20\x28\x45\x6e\x74\x72\x61\x6e\x63\x65\x29\x18\x00\xfd"
+            "\x0d\x42\x61\x73\x65\x6d\x65\x6e\x74\x29\x00\x4d\x65\x74\x65\x6f\x72\x20\x46\x61\x6c\x6c\x73\x20\x31\x46\x20\x31\x52\x13\x00\x1b"
+            "\x32\x13\x00\x1f\x42\x27\x00\x00\x00\x14\x00\x0c\x28\x00\x05\x5b\x01\x00\x3d\x01\x80\x00\x4d\x74\x2e\x20\x50\x79\x72\x82\x01\x36"
+            "\x2d\x33\x46\x0f\x00\x47\x34\x46\x2d\x36\x0f\x00\x86\x45\x78\x74\x65\x72\x69\x6f\x72\x12\x00\xc2\x53\x75\x6d\x6d\x69\x74\x00\x53"
+            "\x68\x6f\x61\x6c\x4b\x00\x06\x0b\x00\x42\x20\x49\x63\x65\xba\x01\x81\x53\x65\x61\x66\x6c\x6f\x6f\x72\x17\x00\xf0\x00\x72\x6e\x00"
+            "\x56\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\xf5\x01\x09\x10\x00\x00\xda\x01\x0a\x11\x00\x31\x32\x46\x00\x50\x00\xa4\x6f\x66"
+            "\x20\x4f\x72\x69\x67\x69\x6e\x20\x3b\x01\x0b\x18\x00\xf0\x13\x00\x46\x69\x65\x72\x79\x20\x50\x61\x74\x68\x00\x4a\x61\x67\x67\x65"
+            "\x64\x20\x50\x61\x73\x73\x00\x53\x6b\x79\x20\x50\x69\x6c\x6c\x61\x72\x6e\x00\x07\x0e\x00\x19\x33\x0e\x00\xf0\x08\x35\x46\x00\x4d"
+            "\x61\x67\x6d\x61\x20\x48\x69\x64\x65\x6f\x75\x74\x00\x4d\x69\x72\x61\x67\x65\x86\x04\xa2\x65\x72\x00\x41\x72\x74\x69\x73\x61\x6e"
+            "\xe6\x00\x71\x44\x65\x73\x65\x72\x74\x20\xd5\x02\x10\x70\x63\x00\x20\x41\x6c\x1b\x01\x22\x6e\x67\x1f\x00\x00",
+            1051, 1584
+        },
+        // species_ja
+        {
+            "\xf7\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xb0\x27\x03\x00\x00\xa4\x0c\x00\x00\xb4\x0c\x00\x00\xc4\x0c\x00\x00\xd4\x0c"
+            "\x00\x00\xe1\x0c\x00\x00\xee\x0c\x00\x00\xfe\x0c\x00\x00\x0b\x0d\x00\x00\x18\x0d\x00\x00\x28\x0d\x00\x00\x38\x0d\x00\x00\x48\x0d"
+            "\x00\x00\x58\x0d\x00\x00\x65\x0d\x00\x00\x72\x0d\x00\x00\x7f\x0d\x00\x00\x89\x0d\x00\x00\x96\x0d\x00\x00\xa6\x0d\x00\x00\xb3\x0d"
+            "\x00\x00\xbd\x0d\x00\x00\xcd\x0d\x00\x00\xdd\x0d\x00\x00\xe7\x0d\x00\x00\xf7\x0d\x00\x00\x07\x0e\x00\x00\x17\x0e\x00\x00\x21\x0e"
+            "\x00\x00\x31\x0e\x00\x00\x41\x0e\x00\x00\x51\x0e\x00\x00\x61\x0e\x00\x00\x71\x0e\x00\x00\x81\x0e\x00\x00\x91\x0e\x00\x00\x9b\x0e"
+            "\x00\x00\xa8\x0e\x00\x00\xb2\x0e\x00\x00\xc2\x0e\x00\x00\xcc\x0e\x00\x00\xd9\x0e\x00\x00\xe6\x0e\x00\x00\xf6\x0e\x00\x00\x06\x0f"
+            "\x00\x00\x16\x0f\x00\x00\x26\x0f\x00\x00\x30\x0f\x00\x00\x40\x0f\x00\x00\x4d\x0f\x00\x00\x5d\x0f\x00\x00\x6a\x0f\x00\x00\x7a\x0f"
+            "\x00\x00\x87\x0f\x00\x00\x97\x0f\x00\x00\xa4\x0f\x00\x00\xb4\x0f\x00\x00\xc1\x0f\x00\x00\xd1\x0f\x00\x00\xde\x0f\x00\x00\xee\x0f"
+            "\x00\x00\xfb\x0f\x00\x00\x08\x10\x00\x00\x18\x10\x00\x00\x25\x10\x00\x00\x35\x10\x00\x00\x45\x10\x00\x00\x55\x10\x00\x00\x65\x10"
+            "\x00\x00\x75\x10\x00\x00\x85\x10\x00\x00\x92\x10\x00\x00\xa2\x10\x00\x00\xb2\x10\x00\x00\xc2\x10\x00\x00\xd2\x10\x00\x00\xdf\x10"
+            "\x00\x00\xef\x10\x00\x00\xfc\x10\x00\x00\x0c\x11\x00\x00\x16\x11\x00\x00\x23\x11\x00\x00\x2d\x11\x00\x00\x3d\x11\x00\x00\x4a\x11"
+            "\x00\x00\x57\x11\x00\x00\x67\x11\x00\x00\x74\x11\x00\x00\x81\x11\x00\x00\x91\x11\x00\x00\xa1\x11\x00\x00\xb1\x11\x00\x00\xc1\x11"
+            "\x00\x00\xcb\x11\x00\x00\xd8\x11\x00\x00\xe5\x11\x00\x00\xf2\x11\x00\x00\xff\x11\x00\x00\x0f\x12\x00\x00\x19\x12\x00\x00\x29\x12"
+            "\x00\x00\x39\x12\x00\x00\x49\x12\x00\x00\x56\x12\x00\x00\x63\x12\x00\x00\x70\x12\x00\x00\x7d\x12\x00\x00\x8d\x12\x00\x00\x9d\x12"
+            "\x00\x00\xad\x12\x00\x00\xba\x12\x00\x00\xca\x12\x00\x00\xda\x12\x00\x00\xe7\x12\x00\x00\xf4\x12\x00\x00\x04\x13\x00\x00\x11\x13"
+            "\x00\x00\x1e\x13\x00\x00\x2b\x13\x00\x00\x3b\x13\x00\x00\x4b\x13\x00\x00\x5b\x13\x00\x00\x6b\x13\x00\x00\x7b\x13\x00\x00\x8b\x13"
+            "\x00\x00\x9b\x13\x00\x00\xa8\x13\x00\x00\xb5\x13\x00\x00\xc2\x13\x00\x00\xd2\x13\x00\x00\xe2\x13\x00\x00\xf2\x13\x00\x00\xff\x13"
+            "\x00\x00\x0c\x14\x00\x00\x19\x14\x00\x00\x29\x14\x00\x00\x39\x14\x00\x00\x49\x14\x00\x00\x56\x14\x00\x00\x66\x14\x00\x00\x76\x14"
+            "\x00\x00\x80\x14\x00\x00\x90\x14\x00\x00\x9a\x14\x00\x00\xa7\x14\x00\x00\xb7\x14\x00\x00\xc4\x14\x00\x00\xd4\x14\x00\x00\xe4\x14"
+            "\x00\x00\xf4\x14\x00\x00\x04\x15\x00\x00\x14\x15\x00\x00\x1e\x15\x00\x00\x2e\x15\x00\x00\x3e\x15\x00\x00\x4e\x15\x00\x00\x5e\x15"
+            "\x00\x00\x6e\x15\x00\x00\x7e\x15\x00\x00\x8b\x15\x00\x00\x9b\x15\x00\x00\xab\x15\x00\x00\xb5\x15\x00\x00\xc2\x15\x00\x00\xcf\x15"
+            "\x00\x00\xdf\x15\x00\x00\xec\x15\x00\x00\xfc\x15\x00\x00\x09\x16\x00\x00\x19\x16\x00\x00\x29\x16\x00\x00\x39\x16\x00\x00\x49\x16"
+            "\x00\x00\x56\x16\x00\x00\x5d\x16\x00\x00\x6a\x16\x00\x00\x77\x16\x00\x00\x87\x16\x00\x00\x94\x16\x00\x00\xa4\x16\x00\x00\xb1\x16"
+            "\x00\x00\xbb\x16\x00\x00\xcb\x16\x00\x00\xdb\x16\x00\x00\xe5\x16\x00\x00\xf2\x16\x00\x00\x02\x17\x00\x00\x12\x17\x00\x00\x1f\x17"
+            "\x00\x00\x2c\x17\x00\x00\x39\x17\x00\x00\x46\x17\x00\x00\x56\x17\x00\x00\x63\x17\x00\x00\x73\x17\x00\x00\x7d\x17\x00\x00\x87\x17"
+            "\x00\x00\x94\x17\x00\x00\xa4\x17\x00\x00\xb4\x17\x00\x00\xc4\x17\x00\x00\xce\x17\x00\x00\xde\x17\x00\x00\xee\x17\x00\x00\xfe\x17"
+            "\x00\x00\x0e\x18\x00\x00\x1e\x18\x00\x00\x2b\x18\x00\x00\x3b\x18\x00\x00\x4b\x18\x00\x00\x55\x18\x00\x00\x65\x18\x00\x00\x75\x18"
+            "\x00\x00\x82\x18\x00\x00\x8f\x18\x00\x00\x9f\x18\x00\x00\xac\x18\x00\x00\xb9\x18\x00\x00\xc6\x18\x00\x00\xd6\x18\x00\x00\xe6\x18"
+            "\x00\x00\xf3\x18\x00\x00\x00\x19\x00\x00\x0d\x19\x00\x00\x1d\x19\x00\x00\x2a\x19\x00\x00\x3a\x19\x00\x00\x4a\x19\x00\x00\x5a\x19"
+            "\x00\x00\x67\x19\x00\x00\x74\x19\x00\x00\x84\x19\x00\x00\x91\x19\x00\x00\xa1\x19\x00\x00\xb1\x19\x00\x00\xbe\x19\x00\x00\xcb\x19"
+            "\x00\x00\xd8\x19\x00\x00\xe8\x19\x00\x00\xf8\x19\x00\x00\x08\x1a\x00\x00\x12\x1a\x00\x00\x22\x1a\x00\x00\x2f\x1a\x00\x00\x3c\x1a"
+            "\x00\x00\x49\x1a\x00\x00\x56\x1a\x00\x00\x66\x1a\x00\x00\x76\x1a\x00\x00\x86\x1a\x00\x00\x90\x1a\x00\x00\x9d\x1a\x00\x00\xaa\x1a"
+            "\x00\x00\xb4\x1a\x00\x00\xc4\x1a\x00\x00\xd4\x1a\x00\x00\xe1\x1a\x00\x00\xf1\x1a\x00\x00\x01\x1b\x00\x00\x11\x1b\x00\x00\x21\x1b"
+            "\x00\x00\x31\x1b\x00\x00\x3e\x1b\x00\x00\x4b\x1b\x00\x00\x5b\x1b\x00\x00\x6b\x1b\x00\x00\x78\x1b\x00\x00\x88\x1b\x00\x00\x98\x1b"
+            "\x00\x00\xa5\x1b\x00\x00\xb5\x1b\x00\x00\xc2\x1b\x00\x00\xd2\x1b\x00\x00\xe2\x1b\x00\x00\xef\x1b\x00\x00\xfc\x1b\x00\x00\x0c\x1c"
+            "\x00\x00\x16\x1c\x00\x00\x26\x1c\x00\x00\x33\x1c\x00\x00\x43\x1c\x00\x00\x50\x1c\x00\x00\x5d\x1c\x00\x00\x6d\x1c\x00\x00\x7a\x1c"
+            "\x00\x00\x8a\x1c\x00\x00\x97\x1c\x00\x00\xa7\x1c\x00\x00\xb4\x1c\x00\x00\xc4\x1c\x00\x00\xd4\x1c\x00\x00\xe1\x1c\x00\x00\xf1\x1c"
+            "\x00\x00\xfe\x1c\x00\x00\x0e\x1d\x00\x00\x1b\x1d\x00\x00\x2b\x1d\x00\x00\x3b\x1d\x00\x00\x4b\x1d\x00\x00\x55\x1d\x00\x00\x62\x1d"
+            "\x00\x00\x6c\x1d\x00\x00\x7c\x1d\x00\x00\x89\x1d\x00\x00\x96\x1d\x00\x00\xa3\x1d\x00\x00\xad\x1d\x00\x00\xbd\x1d\x00\x00\xca\x1d"
+            "\x00\x00\xda\x1d\x00\x00\xe7\x1d\x00\x00\xf7\x1d\x00\x00\x04\x1e\x00\x00\x11\x1e\x00\x00\x21\x1e\x00\x00\x31\x1e\x00\x00\x3e\x1e"
+            "\x00\x00\x4b\x1e\x00\x00\x5b\x1e\x00\x00\x68\x1e\x00\x00\x78\x1e\x00\x00\x85\x1e\x00\x00\x95\x1e\x00\x00\xa2\x1e\x00\x00\xaf\x1e"
+            "\x00\x00\xbc\x1e\x00\x00\xc9\x1e\x00\x00\xd9\x1e\x00\x00\xe9\x1e\x00\x00\xf9\x1e\x00\x00\x09\x1f\x00\x00\x19\x1f\x00\x00\x26\x1f"
+            "\x00\x00\x33\x1f\x00\x00\x40\x1f\x00\x00\x50\x1f\x00\x00\x60\x1f\x00\x00\x70\x1f\x00\x00\x80\x1f\x00\x00\x90\x1f\x00\x00\xa0\x1f"
+            "\x00\x00\xad\x1f\x00\x00\xba\x1f\x00\x00\xca\x1f\x00\x00\xd7\x1f\x00\x00\xe7\x1f\x00\x00\xf4\x1f\x00\x00\x04\x20\x00\x00\x11\x20"
+            "\x00\x00\x21\x20\x00\x00\x2e\x20\x00\x00\x3e\x20\x00\x00\x4b\x20\x00\x00\x5b\x20\x00\x00\x6b\x20\x00\x00\x7b\x20\x00\x00\x88\x20"
+            "\x00\x00\x98\x20\x00\x00\xa8\x20\x00\x00\xb5\x20\x00\x00\xc2\x20\x00\x00\xcf\x20\x00\x00\xdf\x20\x00\x00\xef\x20\x00\x00\xff\x20"
+            "\x00\x00\x0f\x21\x00\x00\x1f\x21\x00\x00\x2c\x21\x00\x00\x3c\x21\x00\x00\x4c\x21\x00\x00\x5c\x21\x00\x00\x69\x21\x00\x00\x76\x21"
+            "\x00\x00\x83\x21\x00\x00\x93\x21\x00\x00\xa0\x21\x00\x00\xad\x21\x00\x00\xbd\x21\x00\x00\xcd\x21\x00\x00\xdd\x21\x00\x00\xed\x21"
+            "\x00\x00\xfd\x21\x00\x00\x0d\x22\x00\x00\x1d\x22\x00\x00\x2d\x22\x00\x00\x3d\x22\x00\x00\x4a\x22\x00\x00\x5a\x22\x00\x00\x67\x22"
+            "\x00\x00\x77\x22\x00\x00\x87\x22\x00\x00\x94\x22\x00\x00\xa4\x22\x00\x00\xb4\x22\x00\x00\xc4\x22\x00\x00\xd4\x22\x00\x00\xe4\x22"
+            "\x00\x00\xf1\x22\x00\x00\x01\x23\x00\x00\x11\x23\x00\x00\x1b\x23\x00\x00\x28\x23\x00\x00\x38\x23\x00\x00\x48\x23\x00\x00\x55\x23"
+            "\x00\x00\x62\x23\x00\x00\x72\x23\x00\x00\x7f\x23\x00\x00\x8f\x23\x00\x00\x9f\x23\x00\x00\xaf\x23\x00\x00\xbf\x23\x00\x00\xcf\x23"
+            "\x00\x00\xdf\x23\x00\x00\xef\x23\x00\x00\xff\x23\x00\x00\x0f\x24\x00\x00\x1f\x24\x00\x00\x2c\x24\x00\x00\x39\x24\x00\x00\x49\x24"
+            "\x00\x00\x59\x24\x00\x00\x66\x24\x00\x00\x76\x24\x00\x00\x86\x24\x00\x00\x96\x24\x00\x00\xa3\x24\x00\x00\xb3\x24\x00\x00\xc0\x24"
+            "\x00\x00\xd0\x24\x00\x00\xe0\x24\x00\x00\xf0\x24\x00\x00\x00\x25\x00\x00\x10\x25\x00\x00\x20\x25\x00\x00\x30\x25\x00\x00\x40\x25"
+            "\x00\x00\x50\x25\x00\x00\x60\x25\x00\x00\x6d\x25\x00\x00\x77\x25\x00\x00\x84\x25\x00\x00\x91\x25\x00\x00\x9e\x25\x00\x00\xab\x25"
+            "\x00\x00\xb8\x25\x00\x00\xc8\x25\x00\x00\xd2\x25\x00\x00\xdc\x25\x00\x00\xe9\x25\x00\x00\xf9\x25\x00\x00\x09\x26\x00\x00\x16\x26"
+            "\x00\x00\x26\x26\x00\x00\x36\x26\x00\x00\x46\x26\x00\x00\x56\x26\x00\x00\x66\x26\x00\x00\x76\x26\x00\x00\x83\x26\x00\x00\x93\x26"
+            "\x00\x00\xa3\x26\x00\x00\xb3\x26\x00\x00\xc3\x26\x00\x00\xd3\x26\x00\x00\xe3\x26\x00\x00\xf3\x26\x00\x00\x03\x27\x00\x00\x13\x27"
+            "\x00\x00\x23\x27\x00\x00\x33\x27\x00\x00\x43\x27\x00\x00\x53\x27\x00\x00\x63\x27\x00\x00\x70\x27\x00\x00\x80\x27\x00\x00\x90\x27"
+            "\x00\x00\xa0\x27\x00\x00\xb0\x27\x00\x00\xc0\x27\x00\x00\xca\x27\x00\x00\xd7\x27\x00\x00\xe7\x27\x00\x00\xf4\x27\x00\x00\x04\x28"
+            "\x00\x00\x11\x28\x00\x00\x21\x28\x00\x00\x31\x28\x00\x00\x41\x28\x00\x00\x51\x28\x00\x00\x5e\x28\x00\x00\x6b\x28\x00\x00\x7b\x28"
+            "\x00\x00\x88\x28\x00\x00\x98\x28\x00\x00\xa8\x28\x00\x00\xb8\x28\x00\x00\xc8\x28\x00\x00\xd8\x28\x00\x00\xe2\x28\x00\x00\xf2\x28"
+            "\x00\x00\x02\x29\x00\x00\x12\x29\x00\x00\x22\x29\x00\x00\x32\x29\x00\x00\x3f\x29\x00\x00\x4f\x29\x00\x00\x5f\x29\x00\x00\x6f\x29"
+            "\x00\x00\x7f\x29\x00\x00\x8f\x29\x00\x00\x9f\x29\x00\x00\xac\x29\x00\x00\xbc\x29\x00\x00\xc9\x29\x00\x00\xd9\x29\x00\x00\xe6\x29"
+            "\x00\x00\xf6\x29\x00\x00\x00\x2a\x00\x00\x10\x2a\x00\x00\x1d\x2a\x00\x00\x2d\x2a\x00\x00\x3d\x2a\x00\x00\x47\x2a\x00\x00\x57\x2a"
+            "\x00\x00\x64\x2a\x00\x00\x71\x2a\x00\x00\x81\x2a\x00\x00\x8e\x2a\x00\x00\x9e\x2a\x00\x00\xae\x2a\x00\x00\xbe\x2a\x00\x00\xcb\x2a"
+            "\x00\x00\xdb\x2a\x00\x00\xeb\x2a\x00\x00\xfb\x2a\x00\x00\x08\x2b\x00\x00\x15\x2b\x00\x00\x25\x2b\x00\x00\x2f\x2b\x00\x00\x39\x2b"
+            "\x00\x00\x46\x2b\x00\x00\x53\x2b\x00\x00\x63\x2b\x00\x00\x6d\x2b\x00\x00\x7a\x2b\x00\x00\x8a\x2b\x00\x00\x97\x2b\x00\x00\xa7\x2b"
+            "\x00\x00\xb4\x2b\x00\x00\xc4\x2b\x00\x00\xd1\x2b\x00\x00\xde\x2b\x00\x00\xeb\x2b\x00\x00\xfb\x2b\x00\x00\x0b\x2c\x00\x00\x1b\x2c"
+            "\x00\x00\x2b\x2c\x00\x00\x3b\x2c\x00\x00\x4b\x2c\x00\x00\x58\x2c\x00\x00\x68\x2c\x00\x00\x78\x2c\x00\x00\x85\x2c\x00\x00\x95\x2c"
+            "\x00\x00\xa5\x2c\x00\x00\xb5\x2c\x00\x00\xc2\x2c\x00\x00\xd2\x2c\x00\x00\xe2\x2c\x00\x00\xf2\x2c\x00\x00\xfc\x2c\x00\x00\x0c\x2d"
+            "\x00\x00\x1c\x2d\x00\x00\x2c\x2d\x00\x00\x36\x2d\x00\x00\x43\x2d\x00\x00\x53\x2d\x00\x00\x60\x2d\x00\x00\x6d\x2d\x00\x00\x7d\x2d"
+            "\x00\x00\x8d\x2d\x00\x00\x9a\x2d\x00\x00\xaa\x2d\x00\x00\xba\x2d\x00\x00\xca\x2d\x00\x00\xd7\x2d\x00\x00\xe7\x2d\x00\x00\xf4\x2d"
+            "\x00\x00\x01\x2e\x00\x00\x11\x2e\x00\x00\x21\x2e\x00\x00\x31\x2e\x00\x00\x3e\x2e\x00\x00\x4e\x2e\x00\x00\x5e\x2e\x00\x00\x6b\x2e"
+            "\x00\x00\x7b\x2e\x00\x00\x8b\x2e\x00\x00\x9b\x2e\x00\x00\xa5\x2e\x00\x00\xb2\x2e\x00\x00\xc2\x2e\x00\x00\xd2\x2e\x00\x00\xe2\x2e"
+            "\x00\x00\xf2\x2e\x00\x00\xff\x2e\x00\x00\x0c\x2f\x00\x00\x19\x2f\x00\x00\x29\x2f\x00\x00\x39\x2f\x00\x00\x43\x2f\x00\x00\x50\x2f"
+            "\x00\x00\x60\x2f\x00\x00\x70\x2f\x00\x00\x80\x2f\x00\x00\x90\x2f\x00\x00\xa0\x2f\x00\x00\xb0\x2f\x00\x00\xbd\x2f\x00\x00\xcd\x2f"
+            "\x00\x00\xdd\x2f\x00\x00\xed\x2f\x00\x00\xfa\x2f\x00\x00\x07\x30\x00\x00\x14\x30\x00\x00\x24\x30\x00\x00\x34\x30\x00\x00\x41\x30"
+            "\x00\x00\x51\x30\x00\x00\x61\x30\x00\x00\x71\x30\x00\x00\x81\x30\x00\x00\x91\x30\x00\x00\x9b\x30\x00\x00\xa8\x30\x00\x00\xb8\x30"
+            "\x00\x00\xc5\x30\x00\x00\xd5\x30\x00\x00\xe5\x30\x00\x00\xf5\x30\x00\x00\x05\x31\x00\x00\x15\x31\x00\x00\x25\x31\x00\x00\x32\x31"
+            "\x00\x00\x3f\x31\x00\x00\x4f\x31\x00\x00\x5c\x31\x00\x00\x6c\x31\x00\x00\x7c\x31\x00\x00\x8c\x31\x00\x00\x9c\x31\x00\x00\xac\x31"
+            "\x00\x00\xbc\x31\x00\x00\xc9\x31\x00\x00\xd9\x31\x00\x00\xec\x31\x00\x00\xf9\x31\x00\x00\x09\x32\x00\x00\x19\x32\x00\x00\x26\x32"
+            "\x00\x00\x33\x32\x00\x00\x40\x32\x00\x00\x50\x32\x00\x00\x63\x32\x00\x00\x73\x32\x00\x00\x83\x32\x00\x00\x90\x32\x00\x00\x9a\x32"
+            "\x00\x00\xaa\x32\x00\x00\xb7\x32\x00\x00\xc7\x32\x00\x00\xda\x32\x00\x00\xea\x32\x00\x00\xfa\x32\x00\x00\x0a\x33\x00\x00\x17\x33"
+            "\x00\x00\x27\x33\x00\x00\x37\x33\x00\x00\x4a\x33\x00\x00\x57\x33\x00\x00\x67\x33\x00\x00\x77\x33\x00\x00\x87\x33\x00\x00\x97\x33"
+            "\x00\x00\xa7\x33\x00\x00\xb7\x33\x00\x00\xc7\x33\x00\x00\xd7\x33\x00\x00\xe4\x33\x00\x00\xf4\x33\x00\x00\x01\x34\x00\x00\x11\x34"
+            "\x00\x00\x21\x34\x00\x00\x31\x34\x00\x00\x41\x34\x00\x00\x51\x34\x00\x00\x5e\x34\x00\x00\x6e\x34\x00\x00\x7b\x34\x00\x00\x8b\x34"
+            "\x00\x00\x9b\x34\x00\x00\xab\x34\x00\x00\xb8\x34\x00\x00\xc5\x34\x00\x00\xcf\x34\x00\x00\xdc\x34\x00\x00\xec\x34\x00\x00\xfc\x34"
+            "\x00\x00\x09\x35\x00\x00\x19\x35\x00\x00\x29\x35\x00\x00\x39\x35\x00\x00\x49\x35\x00\x00\x59\x35\x00\x00\x69\x35\x00\x00\x79\x35"
+            "\x00\x00\x89\x35\x00\x00\x99\x35\x00\x00\xa6\x35\x00\x00\xb9\x35\x00\x00\xc3\x35\x00\x00\xd6\x35\x00\x00\xe3\x35\x00\x00\xf3\x35"
+            "\x00\x00\x06\x36\x00\x00\x13\x36\x00\x00\x23\x36\x00\x00\x33\x36\x00\x00\x40\x36\x00\x00\x50\x36\x00\x00\x60\x36\x00\x00\x6d\x36"
+            "\x00\x00\x7d\x36\x00\x00\x8d\x36\x00\x00\x9d\x36\x00\x00\xad\x36\x00\x00\xbd\x36\x00\x00\xcd\x36\x00\x00\xdd\x36\x00\x00\xed\x36"
+            "\x00\x00\xfd\x36\x00\x00\x0d\x37\x00\x00\x1a\x37\x00\x00\x2a\x37\x00\x00\x37\x37\x00\x00\x47\x37\x00\x00\x51\x37\x00\x00\x5e\x37"
+            "\x00\x00\x6e\x37\x00\x00\x7e\x37\x00\x00\x8e\x37\x00\x00\x9b\x37\x00\x00\xae\x37\x00\x00\xbb\x37\x00\x00\xcb\x37\x00\x00\xd8\x37"
+            "\x00\x00\xe8\x37\x00\x00\xf8\x37\x00\x00\x0b\x38\x00\x00\x1b\x38\x00\x00\x2b\x38\x00\x00\x38\x38\x00\x00\x48\x38\x00\x00\x58\x38"
+            "\x00\x00\x68\x38\x00\x00\x7b\x38\x00\x00\x8e\x38\x00\x00\x9e\x38\x00\x00\xb1\x38\x00\x00\xbe\x38\x00\x00\xce\x38\x00\x00\xde\x38"
+            "\x00\x00\xf1\x38\x00\x00\x04\x39\x00\x00\x0e\x39\x00\x00\x1e\x39\x00\x00\x2e\x39\x00\x00\x3e\x39\x00\x00\x4e\x39\x00\x00\x5e\x39"
+            "\x00\x00\x6e\x39\x00\x00\x7b\x39\x00\x00\x88\x39\x00\x00\x98\x39\x00\x00\xab\x39\x00\x00\xbe\x39\x00\x00\xd1\x39\x00\x00\xe4\x39"
+            "\x00\x00\xf7\x39\x00\x00\x07\x3a\x00\x00\x17\x3a\x00\x00\x27\x3a\x00\x00\x37\x3a\x00\x00\x47\x3a\x00\x00\x5a\x3a\x00\x00\x6d\x3a"
+            "\x00\x00\x80\x3a\x00\x00\x90\x3a\x00\x00\xa0\x3a\x00\x00\xb3\x3a\x00\x00\xc3\x3a\x00\x00\xd0\x3a\x00\x00\xe3\x3a\x00\x00\xf0\x3a"
+            "\x00\x00\x00\x3b\x00\x00\x13\x3b\x00\x00\x23\x3b\x00\x00\x30\x3b\x00\x00\xe3\x83\x95\xe3\x82\xb7\xe3\x82\xae\xe3\x83\x80\xe3\x83"
+            "\x8d\x10\x00\x58\x82\xbd\xe3\x82\xa6\x20\x00\xf9\x0f\x90\xe3\x83\x8a\x00\xe3\x83\x92\xe3\x83\x88\xe3\x82\xab\xe3\x82\xb2\x00\xe3"
+            "\x83\xaa\xe3\x82\xb6\xe3\x83\xbc\xe3\x83\x89\x0d\x00\xf0\x02\xe3\x83\xb3\x00\xe3\x82\xbc\xe3\x83\x8b\xe3\x82\xac\xe3\x83\xa1\x00"
+            "\x31\x00\x21\x83\xa1\x1d\x00\x15\xab\x0d\x00\xf0\x09\x83\xe3\x82\xaf\xe3\x82\xb9\x00\xe3\x82\xad\xe3\x83\xa3\xe3\x82\xbf\xe3\x83"
+            "\x94\xe3\x83\xbc\x00\x61\x00\x81\x83\xa9\xe3\x83\xb3\xe3\x82\xbb\x30\x00\x21\x83\x90\x1d\x00\x10\x95\x63\x00\x01\x20\x00\x14\x93"
+            "\x67\x00\x00\x4d\x00\x10\xb3\x47\x00\x00\x10\x00\x00\x74\x00\x10\xb9\x44\x00\x22\x82\xa2\x27\x00\x10\x9d\x64\x00\x31\x83\x9d\x00"
+            "\x14\x00\x41\xb8\xe3\x83\xa7\x24\x00\x06\x0d\x00\x41\x83\xe3\x83\x88\x41\x00\x00\x6e\x00\x57\x83\xe3\x82\xbf\x00\x0a\x00\x21\x82"
+            "\xaa\xbf\x00\x42\xb9\xe3\x82\xba\xc2\x00\x01\x10\x00\x00\x75\x00\x12\xaa\x78\x00\x00\x65\x00\x36\xe3\x83\x9c\x0a\x00\x02\xd2\x00"
+            "\x02\x61\x00\x72\xab\xe3\x83\x81\xe3\x83\xa5\x43\x01\x47\xa9\xe3\x82\xa4\x10\x00\x20\x82\xb5\xdc\x00\x00\x33\x01\x04\x0a\x00\x32"
+            "\xe3\x83\x91\x9b\x00\x02\x61\x00\x00\xfc\x00\x35\xe2\x99\x80\x10\x00\x00\xf6\x00\x02\x7d\x01\x01\x10\x00\x00\x36\x01\x1e\xa4\x30"
+            "\x00\x1b\x82\x30\x00\x15\x8e\x30\x00\x11\xad\x4c\x01\x11\xb0\x9a\x00\x00\xf5\x00\x12\x94\xa4\x00\x10\xaf\xda\x01\x01\x29\x01\x11"
+            "\xad\x05\x01\x00\x40\x01\x12\xad\xa5\x00\x04\x10\x00\x21\x83\x97\x4e\x00\x02\x0a\x00\x00\x67\x01\x02\x0d\x00\x00\x13\x01\x15\x90"
+            "\x40\x01\x47\xb4\xe3\x83\xab\x10\x00\x81\x83\x8a\xe3\x82\xbe\xe3\x83\x8e\x61\x00\x22\xb5\x00\x07\x00\x01\xb2\x00\x12\x8f\xc5\x00"
+            "\x11\xa9\xcb\x01\x11\xac\x58\x02\x21\xa2\x00\xfc\x00\x11\xa9\x08\x02\x03\x0a\x00\x11\xbb\x6a\x00\x03\x9a\x01\x15\xb3\x1c\x01\x11"
+            "\xa2\x67\x00\x30\x95\xe3\x82\xef\x00\xc0\x00\xe3\x83\x87\xe3\x82\xa3\xe3\x82\xb0\xe3\x83\x29\x01\x11\x80\x0a\x00\x11\x88\x85\x02"
+            "\x12\xaa\xf9\x00\x10\xa3\x06\x01\x01\x57\x00\x10\x9a\x3a\x00\x01\x6e\x00\x02\xbe\x00\x11\xb3\xed\x02\x02\xad\x01\x03\xbe\x00\x05"
+            "\x10\x00\x21\x83\x9e\x2d\x01\x11\xad\x19\x01\x21\x82\xaa\x2d\x00\x02\xd9\x02\x00\xf4\x01\x11\xac\x5a\x01\x00\x7a\x00\x11\x00\x26"
+            "\x01\x00\x87\x01\x04\x10\x00\x00\x74\x00\x10\xa7\x4c\x01\x10\x83\xd5\x00\x04\x0d\x00\x28\x82\xbe\x1a\x00\x12\x9c\x81\x00\x11\xb1"
+            "\x9b\x00\x12\xb7\x37\x00\x11\xa6\x71\x00\x11\xb2\x18\x01\x00\x8d\x01\x15\x95\x64\x00\x02\xe8\x00\x11\xaf\x64\x00\x15\xaa\x94\x00"
+            "\x11\xb4\x20\x00\x06\x10\x00\x11\xab\x87\x00\x05\x10\x00\x00\xc1\x00\x41\x80\xe3\x83\x84\x6d\x00\x11\x9f\xa7\x00\x00\x0d\x00\x03"
+            "\x94\x03\x02\x0d\x00\x01\xab\x02\x01\xac\x01\x13\xa1\xa9\x01\x00\x78\x01\x00\xd1\x03\x02\x5e\x02\x05\x10\x00\x21\x82\xa4\x24\x02"
+            "\x72\x84\xe3\x83\x96\xe3\x83\x86\x7d\x00\x00\x67\x00\x02\x4d\x00\x05\x0d\x00\x00\x6e\x01\x02\x70\x03\x11\x8b\xda\x00\x00\x3f\x03"
+            "\x11\xae\x82\x01\x11\xad\x6a\x00\x54\x97\x00\xe3\x83\xa4\x84\x00\x03\x0a\x00\x02\xc6\x01\x00\xbe\x03\x12\xa4\xe5\x03\x10\xac\xa0"
+            "\x01\x06\x10\x00\x00\x43\x03\x71\xa2\xe3\x83\x8d\xe3\x82\xae\x98\x00\x03\xf2\x03\x00\xe2\x00\x05\x0d\x00\x03\xed\x01\x11\x91\xd8"
+            "\x00\x12\xaf\x5d\x03\x11\xb8\xc2\x02\x12\xb4\x6b\x00\x11\x99\x14\x02\x11\x99\x3f\x04\x00\x3a\x00\x04\x10\x00\x00\x06\x00\x00\x7e"
+            "\x00\x44\xb7\xe3\x82\xa7\x00\x02\x00\x20\x00\x14\x91\x2a\x02\x02\x2b\x04\x02\x6c\x01\x01\xa3\x04\x03\x0a\x00\x02\x98\x02\x11\xb2"
+            "\xb3\x01\x00\x0d\x02\x01\x23\x01\x00\xa3\x01\x12\xbc\x4e\x02\x14\xb9\x7e\x03\x18\x97\x0d\x00\x12\x91\x2a\x00\x01\x57\x01\x22\x83"
+            "\x96\x67\x03\x00\x92\x03\x05\xf4\x01\x11\x93\x2a\x00\x11\xaa\x88\x00\x12\x9e\xc4\x01\x10\xab\x06\x00\x03\xe8\x03\x00\xbf\x00\x12"
+            "\x9e\x06\x00\x01\x60\x03\x00\xac\x02\x02\xbb\x03\x00\x26\x01\x12\xa9\x06\x00\x02\x9f\x02\x12\xa9\x06\x00\x02\x5c\x04\x44\xaf\xe3"
+            "\x83\xa0\x64\x00\x21\x82\xa8\x67\x00\x02\x84\x00\x03\x0c\x01\x12\xad\xd1\x03\x32\xe3\x82\xac\xfb\x01\x01\xdf\x02\x01\x33\x03\x02"
+            "\x6e\x00\x01\x13\x00\x01\xff\x00\x02\xc1\x03\x15\x9b\xfb\x01\x02\x10\x00\x03\xd1\x01\x02\x34\x05\x03\x7f\x02\x00\x64\x03\x01\x86"
+            "\x01\x15\xa3\x94\x00\x11\xab\x37\x00\x00\x0d\x00\x11\xbf\x0f\x02\x12\x84\x91\x00\x00\xc2\x00\x02\x0b\x02\x01\xf3\x05\x00\x54\x00"
+            "\x01\x18\x01\x01\x63\x01\x11\xa2\x65\x04\x11\x9e\x83\x03\x00\x44\x05\x01\x77\x06\x22\x83\x87\xa0\x03\x01\x5c\x01\x01\xd4\x01\x32"
+            "\xe3\x83\x9f\x77\x00\x11\x90\xcb\x00\x14\xa4\x8d\x06\x01\xaa\x01\x03\x7a\x05\x01\xd7\x03\x01\x84\x00\x02\x1d\x02\x01\x8a\x00\x10"
+            "\xa8\x71\x02\x00\xd6\x02\x00\x3d\x00\x00\x07\x00\x01\x43\x00\x06\x50\x03\x12\xad\xf8\x00\x11\xb1\xce\x00\x15\xbf\x10\x00\x01\x9f"
+            "\x02\x06\x51\x05\x03\xe6\x02\x11\xa9\x2b\x01\x00\x38\x01\x11\xa9\x33\x05\x03\xcf\x04\x11\xa1\x3a\x00\x03\x75\x04\x02\x9b\x00\x42"
+            "\x96\xe3\x82\xa4\xfb\x00\x14\xa3\x37\x02\x15\xba\x08\x06\x00\x85\x02\x02\x3a\x00\x01\x91\x00\x04\xe4\x00\x02\x5a\x03\x14\xaa\xd5"
+            "\x02\x00\x89\x06\x11\xa0\x66\x05\x12\xa4\x2b\x01\x01\x10\x00\x06\x2d\x00\x00\x0d\x02\x12\x96\x1a\x00\x03\x0a\x00\x01\xbd\x05\x00"
+            "\x57\x00\x42\x97\xe3\x83\x86\xff\x00\x10\xab\x0d\x02\x04\x26\x03\x03\x59\x07\x02\xbf\x07\x09\x8e\x00\x02\x00\x08\x11\xa1\x6b\x00"
+            "\x00\xc1\x00\x11\x00\x70\x01\x11\x8b\x30\x00\x03\xdd\x06\x14\x8f\x18\x06\x1a\xa5\x8f\x04\x03\x10\x00\x00\x30\x00\x01\x52\x06\x03"
+            "\xf6\x01\x04\x10\x00\x10\x00\x11\x07\x02\x5d\x05\x03\x32\x04\x00\xa7\x03\x02\x3a\x00\x42\xbc\xe3\x83\x95\x3f\x01\x11\xac\x84\x07"
+            "\x42\xa6\xe3\x83\xa0\x03\x02\x11\x8e\xc4\x05\x42\xa9\xe3\x82\xb7\xa4\x02\x11\xb0\x10\x02\x03\x10\x00\x11\x90\x8a\x00\x02\x3f\x05"
+            "\x03\x39\x05\x11\x8b\x33\x00\x00\x35\x01\x11\xa2\x42\x01\x11\xb2\x63\x00\x12\x84\x35\x01\x11\xbc\x37\x06\x03\x6e\x04\x11\xaa\x3f"
+            "\x01\x12\x81\x0a\x00\x05\x0d\x00\x03\xf2\x02\x00\x06\x00\x41\x00\xe3\x83\xa8\x47\x02\x10\x8e\x9a\x02\x01\x54\x02\x14\xac\xa7\x05"
+            "\x17\x90\x0d\x00\x04\x65\x06\x00\x9d\x01\x02\xc9\x03\x05\x7e\x00\x14\xa2\x27\x02\x00\xa8\x00\x18\xad\x33\x07\x12\x81\x9d\x08\x01"
+            "\x09\x00\x00\x6a\x00\x02\xfe\x08\x02\xe1\x02\x02\xb3\x08\x02\x3f\x08\x01\x1d\x00\x12\x94\x38\x06\x18\x97\x9e\x07\x11\x88\x95\x04"
+            "\x05\x3f\x09\x00\x0d\x00\x15\x81\xd3\x06\x11\x8d\x8e\x00\x12\x86\x37\x00\x06\x0d\x00\x02\x3d\x05\x17\xa1\xb2\x04\x12\x83\x81\x05"
+            "\x02\x5e\x07\x02\x76\x06\x04\xb4\x08\x11\xad\xa1\x05\x06\xc5\x07\x14\x9e\x08\x09\x04\x0a\x00\x32\xe3\x83\xaa\x14\x07\x18\xbd\x0e"
+            "\x04\x05\xfa\x06\x12\x88\x91\x08\x10\x8f\x81\x00\x00\x20\x00\x00\x64\x00\x13\x9d\xa3\x09\x01\x0d\x00\x13\xaf\x1e\x04\x01\xae\x01"
+            "\x11\xa8\x6b\x00\x15\x91\xf8\x01\x13\x9e\xf6\x04\x01\xbb\x01\x11\xad\x10\x00\x00\x75\x02\x02\x4d\x06\x14\xb3\x06\x00\x12\x9e\xe1"
+            "\x06\x02\x6e\x05\x22\x83\x8c\xe5\x01\x02\xec\x03\x00\x53\x02\x02\x00\x01\x1b\x96\xb0\x04\x10\xa4\x93\x02\x03\x47\x05\x00\x24\x03"
+            "\x01\xd7\x04\x07\x33\x09\x11\xa0\x54\x00\x00\x5b\x00\x01\xda\x04\x25\x83\x8e\x04\x05\x11\xbd\x0a\x00\x11\x8a\x2a\x00\x03\xc6\x0a"
+            "\x01\x4e\x05\x01\x8c\x07\x02\xe5\x01\x14\x8c\x5a\x0b\x00\xb8\x05\x02\xbb\x08\x11\xac\xa0\x01\x00\x6a\x00\x00\x9a\x02\x01\xd5\x00"
+            "\x00\x76\x02\x01\x0c\x06\x00\x5c\x04\x02\x56\x06\x00\x57\x03\x11\xac\x2c\x01\x02\x33\x0b\x00\xb7\x00\x00\xc3\x04\x04\x2a\x00\x00"
+            "\x67\x00\x00\x13\x00\x02\x53\x01\x02\x44\x03\x12\xbb\x0b\x02\x11\x8f\xde\x00\x12\xb5\x3c\x01\x02\xed\x07\x00\x06\x00\x41\x00\xe3"
+            "\x83\x98\x64\x00\x01\x7c\x02\x01\x81\x00\x12\x8b\x53\x02\x02\x81\x05\x11\x92\x71\x03\x00\x51\x03\x01\xcb\x0b\x03\xa0\x06\x02\x8d"
+            "\x06\x03\x68\x03\x12\x83\x12\x01\x01\x10\x00\x00\x32\x01\x42\xab\xe3\x82\xb4\x73\x01\x02\x93\x04\x03\x0e\x07\x15\x8e\x0d\x00\x14"
+            "\xb5\x11\x08\x21\xb4\x00\x7a\x04\x00\x8e\x0b\x01\x24\x02\x00\x2b\x02\x11\xaa\x6b\x08\x14\xbf\xcd\x09\x00\x44\x00\x00\x82\x05\x02"
+            "\x4c\x0c\x02\x86\x09\x15\xbf\x01\x07\x14\xa8\x66\x0b\x12\xa0\x20\x00\x11\x87\x0f\x01\x12\x93\x02\x01\x11\x98\x8b\x00\x03\x8f\x07"
+            "\x05\x5b\x07\x02\x59\x06\x00\xe4\x04\x10\x9e\x91\x0a\x01\x73\x04\x00\xb1\x06\x03\xd3\x04\x01\x77\x00\x06\x58\x05\x32\xef\xbc\x92"
+            "\x16\x04\x11\x89\x00\x08\x00\x50\x04\x02\x67\x08\x03\x66\x01\x11\x90\x64\x00\x05\x73\x09\x00\xc8\x00\x15\xa8\x4b\x07\x15\xa0\x9f"
+            "\x03\x02\xef\x03\x01\x5d\x06\x00\x2d\x00\x12\x83\xae\x00\x11\x96\x6e\x05\x00\x7e\x02\x11\x9f\x47\x00\x00\xf5\x00\x02\x9b\x03\x11"
+            "\x8f\xb5\x03\x14\x8a\x3d\x06\x00\x01\x02\x12\xb3\x71\x03\x11\xa8\xab\x00\x12\x86\x30\x06\x12\xb9\xc8\x06\x02\xb5\x00\x01\xcf\x02"
+            "\x00\x58\x02\x02\xb2\x02\x00\x66\x01\x17\x8a\x10\x00\x00\xab\x00\x18\xb3\x10\x00\x11\xab\xcf\x0d\x00\x95\x0a\x12\x9b\x7d\x01\x02"
+            "\x61\x00\x11\xbb\x8c\x02\x02\x98\x00\x00\xac\x00\x00\xa4\x04\x04\x40\x09\x00\x5a\x04\x12\x88\xcc\x00\x02\x50\x09\x02\xd6\x05\x03"
+            "\x49\x05\x11\x81\xbe\x06\x00\x51\x00\x11\xaf\x1a\x00\x02\xce\x06\x00\x10\x00\x14\x90\x0d\x00\x12\xbc\x10\x00\x11\x9f\x2c\x05\x01"
+            "\x28\x0a\x01\x80\x01\x11\x8c\x8d\x01\x02\xfe\x04\x02\xe8\x04\x04\x05\x09\x32\xe3\x82\xb8\x90\x01\x11\x81\xfb\x00\x15\x8a\x13\x03"
+            "\x03\x0d\x00\x11\xb8\x75\x02\x17\xb6\x95\x02\x00\x8f\x02\x14\xb9\x10\x00\x00\xa9\x07\x11\xa0\x13\x00\x15\xbd\x15\x09\x11\xb5\xdd"
+            "\x01\x00\x22\x01\x11\xa2\x11\x05\x14\x8f\x5d\x08\x00\x3d\x00\x11\xa6\x41\x02\x00\x9d\x01\x02\xf3\x0a\x15\xb1\x88\x0a\x11\x8f\x3d"
+            "\x08\x15\x9c\x87\x03\x11\xb9\xc0\x01\x42\xac\xe3\x83\xad\x47\x08\x02\x92\x0c\x42\x83\xe3\x83\x91\xd1\x08\x14\x8d\x2d\x00\x00\xce"
+            "\x03\x15\x8e\x21\x05\x01\xcd\x07\x00\xf5\x02\x03\x2a\x08\x11\xb9\x99\x01\x02\x49\x0e\x00\x03\x00\x06\x10\x00\x01\xfe\x0e\x00\x7f"
+            "\x01\x12\xa1\xac\x0c\x12\xaa\x5e\x00\x05\x0a\x06\x14\xab\x32\x04\x00\x2a\x00\x00\x68\x05\x01\xcd\x01\x00\xdf\x00\x01\x7f\x04\x04"
+            "\x07\x08\x00\x41\x00\x04\x24\x0a\x02\x0d\x00\x00\x54\x00\x03\xbf\x0a\x13\xad\x6f\x04\x01\x5e\x05\x02\x0d\x00\x12\xac\x28\x04\x02"
+            "\x51\x0a\x11\x9e\x42\x01\x00\xe2\x00\x00\x06\x01\x04\x10\x02\x12\x8e\x59\x01\x02\x2d\x05\x03\x10\x05\x11\x84\x00\x02\x12\x8b\x8b"
+            "\x02\x01\xd4\x03\x00\x6f\x01\x03\x10\x00\x11\x8c\x30\x00\x02\x0d\x00\x00\xf7\x01\x02\xff\x05\x00\x06\x00\x02\x69\x01\x02\xbc\x0c"
+            "\x00\x99\x04\x01\xad\x07\x00\x70\x03\x03\x57\x00\x02\x17\x02\x11\x8e\x7d\x03\x00\x0d\x08\x02\xd6\x04\x11\x86\x90\x00\x00\xf0\x01"
+            "\x01\xf8\x00\x01\xf2\x05\x01\x80\x07\x00\xf4\x0b\x00\xd8\x00\x11\xa8\xd1\x06\x02\x22\x04\x01\x0a\x00\x01\x5b\x02\x03\xc8\x00\x11"
+            "\x9f\x3f\x01\x00\x04\x0d\x12\xaf\x5a\x07\x04\x56\x0e\x00\x27\x00\x03\x1f\x04\x05\x0a\x00\x21\x83\x9c\x4f\x02\x15\xb4\x1a\x00\x13"
+            "\xa2\x5a\x03\x01\xd9\x00\x02\xf3\x02\x11\xbc\x08\x02\x00\xbf\x00\x02\x48\x05\x00\xb1\x03\x05\xe0\x0f\x12\x9c\xaa\x01\x02\x9a\x07"
+            "\x00\x7b\x03\x04\x1f\x07\x00\x1d\x00\x03\x47\x00\x01\x46\x04\x03\xbf\x10\x00\x8b\x00\x01\x6d\x01\x01\xc3\x0a\x23\xe3\x82\x89\x0f"
+            "\x02\xdc\x0d\x00\xe1\x01\x17\xb4\x72\x0f\x03\x12\x0c\x02\x7d\x06\x12\xa0\xc4\x01\x11\x90\x1d\x09\x03\x0b\x02\x11\xa1\x33\x01\x03"
+            "\xb4\x09\x11\x9b\x0f\x01\x12\xab\x59\x07\x05\x0d\x00\x03\x3d\x11\x02\x04\x05\x15\xa1\x5a\x11\x02\x3d\x11\x12\x80\x0c\x01\x00\x8b"
+            "\x09\x05\x46\x04\x1b\x8d\x21\x0b\x01\x3e\x10\x01\xae\x01\x02\x01\x03\x02\x53\x01\x00\x47\x00\x02\x93\x0c\x06\x5c\x0c\x14\x93\x68"
+            "\x07\x00\x57\x0b\x02\x62\x0a\x02\xdd\x04\x03\xc3\x0a\x11\xb5\x2f\x01\x12\x8d\x96\x04\x02\x2a\x10\x03\x77\x00\x11\x81\xe8\x00\x06"
+            "\x17\x09\x02\x2e\x05\x03\xc8\x03\x14\xb6\xdc\x05\x03\x27\x0b\x11\x8f\x67\x00\x01\x25\x07\x04\xe5\x0b\x11\x8a\xb9\x04\x06\xa2\x07"
+            "\x13\xab\x84\x0e\x01\x20\x00\x17\x89\xfa\x11\x00\xde\x09\x02\xf9\x02\x12\xba\x62\x01\x14\x98\x7f\x07\x12\x8b\x19\x0e\x11\xb6\x77"
+            "\x00\x03\x8f\x07\x11\xa4\x3a\x00\x00\x06\x03\x01\x43\x09\x03\xb6\x11\x03\xfe\x00\x02\xbb\x0d\x03\x48\x07\x14\xa6\x29\x09\x03\x9f"
+            "\x12\x00\x47\x03\x04\x81\x0b\x03\xc4\x06\x02\xcc\x01\x00\x7c\x04\x11\x92\x4a\x00\x12\x90\xce\x00\x11\x9f\x00\x02\x01\xb1\x00\x01"
+            "\x10\x00\x11\x9d\xe5\x08\x00\x72\x04\x02\x57\x0b\x11\xaf\x5a\x00\x03\x82\x11\x00\x81\x13\x01\xb4\x02\x12\xa6\x42\x0c\x02\xb7\x05"
+            "\x11\x9a\xeb\x00\x00\x40\x03\x14\xa8\x25\x09\x00\x84\x00\x11\xb5\x0d\x00\x02\x07\x09\x00\xb1\x00\x11\x88\xcb\x00\x11\x94\x3d\x00"
+            "\x03\x75\x01\x02\xc1\x00\x03\xe1\x05\x12\x96\x3b\x01\x08\xe4\x08\x00\xbd\x09\x11\xa6\x77\x02\x02\xf8\x02\x15\xb7\x22\x13\x03\x90"
+            "\x10\x05\xa6\x0e\x15\xb6\x91\x0b\x11\x88\x72\x01\x06\xe6\x0e\x02\x10\x00\x00\x84\x00\x02\x72\x0e\x00\xe3\x04\x01\xe1\x00\x03\xc7"
+            "\x08\x01\xf0\x06\x04\x44\x07\x14\xb5\x50\x02\x12\x93\x3b\x01\x12\xb8\x62\x01\x04\x6e\x09\x01\x4a\x0f\x01\x07\x01\x00\x1d\x00\x11"
+            "\xbf\x98\x04\x00\x41\x0c\x02\xc7\x02\x02\x2c\x12\x00\x74\x00\x00\x9b\x05\x03\x4f\x08\x03\x29\x12\x02\x72\x01\x01\x74\x00\x02\x30"
+            "\x05\x03\x82\x04\x01\x0d\x00\x00\xae\x00\x03\x7f\x01\x14\xac\xf3\x01\x03\x3d\x02\x01\x10\x00\x00\x16\x04\x17\xa4\x20\x00\x00\xe6"
+            "\x03\x00\xa6\x02\x02\x91\x00\x02\x56\x0b\x15\xa2\xa1\x00\x03\x66\x0b\x02\xa4\x00\x01\x43\x07\x02\x78\x0c\x00\xfe\x00\x05\xf9\x06"
+            "\x04\x46\x0f\x02\x90\x05\x00\xc6\x10\x32\xe3\x82\xb6\xf1\x00\x02\x20\x00\x00\xaa\x02\x11\x87\x47\x00\x11\xad\x99\x02\x00\x5d\x00"
+            "\x11\x8a\xd5\x03\x02\xa3\x07\x00\x3b\x01\x01\xa8\x11\x03\x6c\x15\x00\x51\x00\x02\xd9\x0c\x03\x69\x0a\x11\x92\xf4\x04\x02\xc3\x12"
+            "\x00\xe3\x0b\x11\xa6\x8d\x00\x03\xd3\x12\x1a\xb4\x10\x00\x03\x35\x15\x02\xf0\x04\x00\x79\x05\x02\xa2\x0b\x01\x8a\x09\x01\xf5\x01"
+            "\x02\x98\x08\x01\x53\x13\x01\xa4\x03\x02\x76\x07\x02\x69\x02\x00\x2d\x0b\x18\xaf\xc7\x09\x02\x10\x00\x01\x45\x0d\x01\x44\x01\x14"
+            "\x93\x39\x07\x03\x04\x05\x14\x80\xc3\x15\x03\x1d\x13\x00\x16\x13\x05\x10\x00\x14\x88\x7b\x01\x03\x27\x0e\x03\x33\x09\x01\x0a\x03"
+            "\x00\xee\x00\x00\x0d\x06\x12\xac\xd4\x07\x04\x63\x02\x03\xba\x07\x03\x14\x10\x11\xad\xdc\x03\x03\x8e\x03\x01\xb6\x14\x00\xcf\x10"
+            "\x02\xe1\x0b\x03\xa2\x01\x13\xa0\xf4\x11\x01\x20\x00\x11\xbf\x80\x02\x06\x2f\x0f\x01\x4f\x14\x00\x6b\x0a\x03\x10\x00\x14\x9f\xdc"
+            "\x0a\x03\x3f\x04\x02\x10\x00\x02\x70\x13\x00\x94\x05\x02\x1e\x14\x02\x2e\x0f\x00\x0e\x01\x11\x9f\x96\x02\x12\x8f\x05\x0b\x04\xf4"
+            "\x00\x07\xbe\x15\x13\x91\x7a\x03\x01\x5d\x00\x00\x1a\x10\x02\x1d\x03\x02\x30\x05\x01\x5a\x13\x04\x10\x00\x11\x81\x92\x12\x02\x5e"
+            "\x0c\x00\xca\x0b\x05\x10\x00\x00\x77\x00\x01\xee\x08\x00\x12\x02\x00\x17\x01\x05\xb7\x00\x01\x6d\x03\x03\x3c\x0b\x00\xd7\x00\x02"
+            "\x5e\x01\x00\x6a\x00\x14\x95\x54\x14\x15\x86\x0d\x00\x02\xc2\x06\x00\xb2\x01\x13\x9f\x88\x04\x04\xc1\x00\x02\x0d\x00\x03\xc4\x13"
+            "\x03\x0c\x0d\x01\x4a\x00\x00\xaf\x09\x01\x4b\x06\x07\x3c\x0d\x02\x76\x15\x01\xba\x12\x04\x37\x06\x02\x13\x00\x03\xd0\x05\x02\xfd"
+            "\x02\x02\x22\x0a\x03\xc5\x11\x02\x51\x09\x14\x97\xbe\x01\x00\x89\x02\x06\x1e\x0b\x02\x63\x05\x02\xc7\x07\x03\xbb\x06\x02\xa1\x06"
+            "\x02\x0a\x0b\x03\x6e\x0e\x12\x8f\x8e\x01\x11\x9e\x99\x05\x00\xc3\x18\x13\x94\x54\x00\x01\x44\x00\x11\x9a\x3e\x00\x03\xc1\x00\x02"
+            "\xea\x0d\x03\xbd\x18\x11\x95\x0d\x00\x03\xa2\x0f\x11\xac\x87\x05\x03\x4b\x09\x02\x1a\x12\x01\xb2\x0f\x01\xbb\x03\x00\xb6\x06\x32"
+            "\xe3\x83\x99\xe4\x18\x03\xf7\x0e\x11\xab\x3e\x00\x03\x82\x14\x13\x92\xcd\x0e\x03\xc6\x06\x00\x1a\x00\x02\xeb\x07\x03\x83\x01\x11"
+            "\xb9\xc4\x02\x12\xab\x7b\x17\x02\xfd\x14\x15\x94\xcb\x05\x14\xb0\xfc\x03\x12\xb0\x5a\x00\x01\x91\x0a\x03\x79\x04\x03\x1b\x09\x14"
+            "\xb9\x4e\x0c\x00\x74\x0a\x01\xab\x0a\x01\x27\x0c\x02\x7d\x00\x11\x8d\x4a\x00\x02\x14\x0e\x00\xbe\x00\x01\x87\x05\x01\x3f\x0d\x04"
+            "\xb4\x05\x03\x09\x12\x00\x2d\x00\x02\xc4\x05\x15\x8e\x0e\x08\x1a\x9e\x07\x0e\x00\x76\x04\x18\x90\x96\x15\x02\x26\x14\x15\x99\xef"
+            "\x03\x1b\x89\xfc\x13\x14\xa2\xec\x13\x02\x9a\x02\x06\xfb\x0c\x03\x38\x0d\x06\x5b\x13\x07\xa9\x10\x02\xcd\x00\x01\x33\x02\x02\xe5"
+            "\x11\x05\xc0\x0f\x04\xff\x11\x02\x49\x05\x04\x1d\x01\x02\x87\x16\x04\x10\x00\x02\x4a\x08\x06\x18\x09\x14\xb3\x70\x0e\x09\xcf\x0d"
+            "\x00\x15\x07\x02\xb1\x11\x05\x01\x04\x03\x16\x05\x01\x45\x09\x00\x35\x07\x00\x12\x07\x13\x8e\x87\x13\x01\xad\x00\x02\x1d\x01\x02"
+            "\x14\x17\x00\x5d\x00\x02\x85\x04\x00\xf0\x09\x13\xa6\x75\x04\x04\x50\x10\x14\xa0\xa7\x0b\x03\xac\x14\x12\xb0\x1b\x04\x05\x97\x18"
+            "\x01\x81\x06\x04\xe5\x06\x01\x50\x0b\x01\xeb\x08\x14\x92\xf1\x05\x03\xc4\x18\x02\x44\x06\x15\xae\x67\x15\x01\xb5\x0d\x02\x37\x06"
+            "\x01\xf6\x0c\x02\xf3\x07\x14\xbb\x13\x0a\x03\x18\x01\x12\xaa\xe7\x02\x02\x15\x11\x03\xd7\x10\x02\x3c\x14\x05\x94\x0a\x02\xc4\x16"
+            "\x00\xee\x00\x00\xff\x0a\x02\x8e\x00\x15\xbb\xf0\x07\x11\x93\x2a\x00\x02\x67\x00\x11\x8b\xd4\x0b\x02\x6c\x12\x01\xcb\x01\x02\x05"
+            "\x02\x11\xa3\xd1\x00\x00\xb2\x04\x05\x10\x00\x02\xec\x17\x00\x45\x07\x12\x9d\x52\x02\x04\x18\x0b\x00\x91\x00\x02\x29\x0a\x03\x1e"
+            "\x06\x15\x96\x5f\x02\x14\x9f\x9a\x08\x02\x67\x03\x00\xae\x00\x00\x5a\x13\x05\x10\x00\x01\x92\x01\x03\x66\x15\x00\xb6\x0b\x11\x9f"
+            "\xcf\x02\x11\xba\xb7\x00\x02\x2d\x0f\x00\x3e\x06\x03\x09\x03\x02\xc1\x08\x12\x86\x25\x02\x02\xf8\x06\x01\x2a\x19\x04\x1e\x01\x00"
+            "\x06\x02\x04\x09\x03\x00\xef\x01\x02\x56\x13\x14\xad\x23\x0c\x00\x66\x03\x02\xed\x05\x12\x80\x07\x01\x02\x98\x0b\x06\xa0\x18\x02"
+            "\xc6\x0a\x03\x9b\x0e\x11\x90\xc4\x00\x03\x1d\x00\x04\x0d\x00\x04\x1d\x00\x11\x92\x30\x00\x03\x1d\x00\x04\x0d\x00\x04\x1d\x00\x11"
+            "\xa0\x81\x00\x00\x04\x0e\x17\xa0\x0f\x0f\x03\x35\x13\x11\xa1\x84\x00\x00\x4a\x03\x14\x8f\xaa\x0a\x03\x3e\x0e\x01\x05\x01\x00\xee"
+            "\x00\x02\x2c\x0f\x00\x3a\x00\x12\x9e\xcd\x0d\x02\x86\x10\x02\xf7\x02\x02\x35\x01\x00\x2f\x01\x00\x56\x0f\x02\xac\x04\x02\x02\x07"
+            "\x00\xc6\x04\x02\x4a\x02\x15\xa4\xb9\x04\x02\x49\x07\x03\xda\x0f\x02\xf8\x0c\x05\x10\x00\x00\xbb\x03\x11\xb0\x4c\x01\x03\x58\x14"
+            "\x02\x3a\x1c\x02\xff\x1b\x00\x3e\x03\x11\xbf\x77\x00\x12\xb3\x6d\x02\x11\x89\xe2\x00\x02\x2b\x1d\x03\x2d\x00\x02\xfd\x0d\x11\xb3"
+            "\x95\x13\x03\x1d\x02\x11\x96\xb7\x00\x02\xa5\x16\x03\x88\x04\x03\xa4\x00\x12\x9e\x0a\x18\x05\x0d\x00\x11\xb2\xe8\x00\x00\x87\x05"
+            "\x12\x8a\x12\x04\x02\x0d\x02\x02\x0a\x00\x01\x4f\x08\x02\x00\x02\x05\x0d\x00\x00\xb4\x0f\x02\x36\x01\x14\x8f\xe3\x09\x00\xc5\x00"
+            "\x01\x9f\x1e\x22\x83\x87\xe8\x0c\x01\x64\x17\x01\x76\x03\x14\x9a\xa3\x0b\x03\xaf\x00\x02\xbc\x13\x02\xf6\x11\x03\x17\x04\x06\x29"
+            "\x16\x02\xbc\x11\x03\x56\x03\x18\x89\xcb\x15\x02\xfb\x01\x11\xb9\x7d\x01\x02\x2d\x15\x03\x21\x0a\x03\x60\x16\x06\x84\x12\x04\x0d"
+            "\x00\x01\x6c\x03\x02\xa4\x01\x02\xb5\x00\x00\x20\x0f\x02\x25\x02\x15\x92\x16\x00\x02\x0b\x02\x02\xb8\x19\x03\x00\x14\x02\xe2\x04"
+            "\x02\xf3\x18\x00\xc0\x03\x02\x56\x1a\x11\x91\x00\x04\x00\xca\x01\x13\xba\x18\x0d\x01\x4c\x10\x01\x0d\x00\x00\xcf\x08\x02\x91\x0c"
+            "\x01\x74\x01\x01\x48\x02\x03\xee\x00\x11\x87\xb4\x00\x00\x38\x06\x04\x0d\x00\x00\x6a\x00\x03\xee\x00\x14\x97\xd8\x04\x03\x88\x0a"
+            "\x11\xa2\xe4\x00\x02\xc6\x0b\x02\xf8\x0e\x00\x1a\x00\x00\x8e\x02\x07\x0d\x00\x03\xc5\x0a\x00\xe9\x02\x14\x96\x9f\x06\x00\x4d\x00"
+            "\x00\x4a\x03\x01\x4d\x00\x02\x53\x03\x00\xf9\x1d\x02\xeb\x04\x04\x0a\x00\x02\x97\x04\x02\x65\x01\x02\xcf\x0a\x12\x9f\xb1\x04\x02"
+            "\x10\x00\x02\x43\x0e\x00\x68\x10\x11\xb4\x0d\x00\x00\xd0\x08\x02\x0a\x00\x03\xfd\x01\x02\x0d\x00\x15\xab\x0a\x09\x11\xa6\xb0\x06"
+            "\x03\x3f\x05\x14\x80\x67\x0e\x00\x0d\x00\x02\x1b\x0c\x01\x88\x01\x03\xfc\x02\x02\xf8\x04\x01\x75\x05\x02\x1b\x0a\x02\xf7\x08\x00"
+            "\x8a\x03\x01\x3c\x0f\x00\x0b\x01\x03\xcb\x09\x02\x10\x00\x02\xf1\x03\x02\x10\x00\x00\x82\x01\x02\x16\x00\x00\x15\x01\x11\xb7\xc3"
+            "\x05\x12\xb8\xcc\x01\x11\xa1\x05\x01\x05\x10\x00\x00\x50\x02\x02\xf6\x1a\x00\x4f\x01\x02\x6b\x07\x00\xbd\x1c\x02\x99\x01\x14\xa5"
+            "\x3c\x14\x00\x2b\x15\x02\x22\x0d\x11\xb2\x28\x08\x12\xb1\x97\x02\x02\xc9\x0f\x02\x1c\x03\x00\x91\x00\x02\xe9\x10\x03\x3b\x07\x01"
+            "\x1e\x09\x00\x2c\x03\x02\x4a\x10\x03\xee\x06\x00\xf6\x0d\x02\xb4\x00\x02\xba\x02\x00\x1d\x00\x02\xb0\x17\x02\x10\x00\x00\x87\x0e"
+            "\x02\x9d\x03\x03\x63\x1b\x04\xa2\x0f\x00\xa9\x01\x00\x20\x04\x02\x2a\x04\x02\xaa\x02\x00\x0a\x00\x0c\x0d\x00\x06\x10\x00\x11\xb7"
+            "\xd4\x02\x14\xb7\xe2\x09\x02\x10\x00\x03\xbd\x0b\x05\x20\x00\x06\xe9\x08\x00\x8a\x05\x02\xcf\x08\x02\x3e\x1f\x00\x27\x00\x15\x99"
+            "\xc6\x17\x11\x88\x74\x04\x00\xa3\x0a\x02\xa4\x05\x01\x28\x11\x01\x2a\x00\x03\x13\x0a\x01\xc7\x00\x00\x6f\x01\x01\x15\x01\x01\x32"
+            "\x01\x11\xaa\x88\x06\x03\x2f\x21\x02\x0d\x00\x02\x30\x10\x03\x47\x19\x14\x9e\x65\x01\x00\x7e\x00\x12\x84\xa8\x09\x02\x77\x02\x08"
+            "\xd9\x1a\x12\xb8\xbf\x03\x02\x11\x06\x11\x9c\x36\x00\x00\x67\x04\x11\xa2\x72\x07\x06\xff\x1d\x02\xaf\x03\x11\xae\xaf\x12\x00\x40"
+            "\x02\x02\x2d\x10\x00\x29\x04\x08\x10\x00\x03\x8d\x00\x02\x9c\x11\x12\xa0\x82\x05\x02\xaa\x02\x02\xdf\x0c\x06\x14\x21\x12\xbc\xaf"
+            "\x03\x00\xdb\x08\x01\xfc\x01\x00\xd3\x07\x01\x26\x18\x00\x3d\x02\x00\xcd\x10\x02\xc6\x01\x14\x83\xf1\x0b\x03\x08\x19\x15\xb7\x29"
+            "\x20\x11\xa6\x33\x18\x00\x47\x00\x02\xe6\x01\x02\x55\x0a\x02\x75\x07\x00\x7a\x12\x02\x5a\x02\x02\x1b\x0f\x02\x30\x08\x00\x49\x04"
+            "\x14\xbf\x14\x03\x03\xae\x0e\x02\xfd\x04\x00\x74\x06\x01\x8d\x10\x04\x30\x10\x11\x98\x7a\x00\x02\x87\x22\x02\x5b\x11\x04\x0b\x13"
+            "\x11\xa1\x41\x00\x00\xc5\x0a\x02\xdf\x17\x02\x5e\x17\x06\x54\x06\x02\x77\x00\x03\x82\x09\x00\x52\x1c\x01\xd1\x00\x03\x10\x00\x01"
+            "\xcc\x1e\x01\x72\x01\x04\xf2\x09\x00\x4a\x00\x15\x8d\x58\x0f\x03\x28\x13\x08\x68\x0f\x01\x60\x02\x01\xfc\x03\x02\xc4\x08\x14\xad"
+            "\x65\x13\x03\x94\x00\x03\x7d\x1d\x01\x9d\x22\x03\x82\x13\x00\xa1\x04\x14\xab\xa8\x05\x03\xc8\x1a\x11\xad\x8b\x03\x03\xbf\x23\x11"
+            "\xb2\xeb\x00\x05\x4c\x22\x03\x51\x14\x00\x91\x06\x02\x97\x00\x02\x10\x00\x02\x16\x0d\x00\x5d\x08\x02\xf1\x0b\x00\xe7\x15\x02\x20"
+            "\x00\x02\xae\x19\x03\x9d\x1a\x03\x97\x10\x01\x47\x03\x03\x29\x02\x01\x20\x00\x07\x15\x0a\x00\x3f\x15\x01\x19\x00\x00\xa3\x1a\x11"
+            "\xb2\x2f\x02\x03\xda\x00\x02\x8d\x00\x01\x2b\x07\x00\xd1\x01\x00\x9f\x06\x14\x9b\x3b\x06\x02\xae\x13\x02\x2c\x02\x01\xa8\x03\x01"
+            "\x69\x1d\x01\x32\x02\x04\xf2\x1c\x07\x10\x00\x04\x8c\x1d\x00\xd2\x01\x03\x8b\x18\x02\xcf\x18\x00\x31\x01\x05\x3b\x0f\x02\xd9\x06"
+            "\x03\x9c\x14\x02\xae\x03\x00\x97\x09\x02\xc6\x04\x12\xb7\x2e\x15\x13\xab\xab\x09\x00\xa8\x01\x00\x91\x03\x01\xa1\x13\x00\xab\x03"
+            "\x00\xe5\x0c\x02\xae\x13\x01\x4b\x01\x04\x24\x0e\x03\xa3\x17\x01\x55\x0a\x03\xb7\x0b\x14\xa7\x72\x0a\x03\xa7\x05\x00\xe7\x19\x01"
+            "\x7a\x00\x00\x6e\x01\x02\xd1\x0b\x02\x46\x10\x03\xd4\x05\x02\xdc\x1f\x00\x3f\x0a\x02\xa1\x0e\x12\x9f\x99\x02\x04\x37\x0e\x00\xa0"
+            "\x05\x03\xf4\x16\x02\x10\x00\x02\x5e\x12\x02\xea\x03\x03\x3e\x04\x12\x84\x28\x08\x14\x8b\x03\x09\x00\xbd\x03\x02\x36\x0b\x02\xa2"
+            "\x02\x03\xc8\x0f\x01\x11\x04\x03\x17\x04\x00\xa1\x09\x01\x6e\x24\x04\xf7\x0e\x02\x1d\x08\x03\x4e\x0d\x02\x69\x1e\x02\x10\x00\x02"
+            "\xae\x04\x00\x78\x02\x02\xe1\x0e\x02\x4d\x08\x03\x8a\x22\x14\xa9\x60\x0e\x00\x37\x04\x02\xbf\x26\x12\x86\x12\x23\x00\x74\x11\x01"
+            "\xa7\x01\x00\x68\x07\x02\x83\x03\x12\xba\x7a\x17\x05\xeb\x0d\x12\x9f\xc5\x02\x02\x4c\x03\x11\x87\x7a\x00\x00\x07\x1b\x02\x75\x02"
+            "\x00\xdc\x02\x05\xbb\x1f\x13\xa8\x1d\x04\x00\x5d\x00\x06\x49\x1a\x06\x63\x27\x11\x81\x4a\x01\x03\x8c\x05\x1b\xac\x10\x00\x12\xa2"
+            "\x56\x0b\x0a\x0d\x00\x04\x87\x0c\x00\x94\x17\x07\x58\x0d\x05\x47\x04\x04\xa8\x0d\x14\x87\x43\x06\x00\x04\x09\x14\xa1\x96\x03\x00"
+            "\xc4\x00\x12\x8c\x10\x04\x04\x0a\x00\x04\x19\x0e\x02\x17\x00\x00\xd8\x06\x02\x5c\x02\x01\xab\x0c\x02\xcb\x04\x01\xe0\x07\x14\x9c"
+            "\x13\x00\x06\x0a\x06\x02\x75\x01\x00\x1f\x02\x13\x90\x58\x18\x01\x84\x00\x02\x25\x0d\x02\xb2\x0f\x12\xb8\x4d\x00\x01\x9e\x00\x02"
+            "\x90\x16\x04\x03\x0a\x11\xac\x9f\x02\x03\xcf\x18\x02\x0a\x11\x06\x83\x26\x05\x10\x00\x03\xc4\x14\x02\xad\x03\x00\x60\x16\x02\x30"
+            "\x00\x13\xa4\xc3\x0e\x00\x68\x01\x02\xd5\x1a\x03\x2f\x02\x00\x39\x0a\x06\xb7\x1f\x05\xf4\x00\x02\x43\x03\x00\xa8\x12\x01\xae\x04"
+            "\x02\xd5\x18\x04\xd1\x04\x14\xa2\xa4\x04\x02\x2a\x00\x01\xa3\x02\x05\x90\x03\x02\xee\x0c\x02\x96\x19\x08\xcf\x02\x04\xed\x03\x02"
+            "\x0d\x00\x02\x08\x0e\x02\x6b\x10\x00\x5b\x09\x12\xac\x8f\x03\x02\xb2\x05\x02\xf9\x0b\x03\x23\x1d\x02\x1a\x07\x03\x10\x00\x02\x1d"
+            "\x00\x02\x67\x12\x12\x8c\xf0\x06\x11\x84\x9d\x00\x00\x64\x04\x00\x07\x00\x01\x03\x00\x03\x62\x13\x11\x89\xda\x00\x01\x8a\x10\x01"
+            "\xe3\x03\x01\x93\x03\x07\x3d\x17\x01\x1d\x00\x06\x10\x00\x00\x5d\x00\x11\xb4\xc0\x00\x02\x4a\x04\x03\x0f\x02\x15\x82\x5a\x04\x11"
+            "\xaf\x9c\x06\x12\xac\x90\x07\x02\x97\x10\x02\xb8\x0d\x00\xff\x19\x02\x97\x10\x09\x10\x00\x01\x4c\x1d\x00\x56\x03\x00\x06\x00\x04"
+            "\x58\x16\x03\xbb\x0d\x06\x0d\x00\x03\xe9\x06\x02\xef\x0a\x03\x7c\x20\x04\xcd\x03\x03\x5a\x07\x00\xbe\x04\x03\xdb\x12\x11\x92\x81"
+            "\x10\x12\xa4\xb8\x01\x1e\x89\x10\x00\x02\x4d\x09\x03\x47\x00\x01\x0a\x00\x00\x06\x00\x03\x7d\x03\x01\x60\x0b\x00\xc7\x00\x00\x9a"
+            "\x09\x02\x5e\x04\x09\x13\x00\x02\xcf\x11\x00\x0a\x04\x02\x7c\x06\x02\x7f\x06\x12\x86\x2e\x01\x15\x8d\x6b\x08\x02\xfb\x00\x02\x24"
+            "\x26\x06\xb5\x05\x11\x88\xdd\x03\x03\x6a\x0d\x02\x06\x0f\x05\x58\x11\x00\xf2\x02\x14\x8c\xb5\x11\x03\xb0\x1c\x03\xe4\x03\x05\x10"
+            "\x00\x01\xb0\x03\x00\x91\x01\x15\xb8\xbd\x03\x01\x3a\x1a\x04\xbd\x22\x03\x75\x13\x02\x9b\x08\x02\x09\x07\x01\x91\x01\x01\x55\x02"
+            "\x11\xa4\x15\x02\x11\xa6\x23\x00\x03\x51\x1f\x01\x56\x0d\x02\x1e\x02\x00\xff\x17\x03\x29\x2b\x11\xbd\xed\x00\x03\xd1\x01\x18\xb0"
+            "\x10\x00\x02\xf9\x0f\x11\xb9\xe2\x06\x30\x90\xe3\x82\x98\x1c\x11\xb7\x50\x01\x02\x4c\x0c\x00\x34\x0b\x02\x2e\x19\x02\xdf\x0f\x00"
+            "\x40\x00\x02\x9e\x1f\x41\x97\xef\xbc\x9a\x0e\x04\x03\x0f\x0a\x41\xab\xe3\x83\xb4\x60\x1f\x03\x16\x29\x02\x2a\x05\x00\x3f\x18\x03"
+            "\xf9\x21\x01\xcf\x00\x00\x4f\x04\x02\x03\x1c\x01\x40\x05\x01\x63\x01\x02\xb7\x22\x02\xe3\x25\x06\x7e\x14\x02\x58\x0f\x00\x76\x01"
+            "\x14\x8f\x9c\x0a\x14\xb7\xaa\x1e\x03\xfa\x08\x05\x8c\x0c\x00\x03\x00\x03\x55\x13\x03\x81\x26\x02\x40\x01\x04\x0d\x00\x01\x37\x0f"
+            "\x08\x10\x00\x02\x13\x00\x03\xb7\x0b\x41\x97\xe3\x83\xbb\xa0\x00\x14\xb1\x24\x07\x02\x13\x00\x01\xea\x05\x01\x2a\x06\x06\x13\x00"
+            "\x02\x9c\x0b\x03\x1d\x06\x02\x13\x00\x11\xac\x8f\x02\x00\x4c\x00\x00\xa2\x18\x01\x0c\x02\x03\xaf\x0d\x04\x10\x00\x03\xc9\x24\x02"
+            "\x97\x1a\x00\xf9\x00\x00\xfd\x03\x04\xb7\x1a\x03\x1c\x1a\x00\xca\x03\x02\x2d\x25\x15\xad\xb7\x12\x02\x97\x0a\x14\xb7\x4d\x13\x03"
+            "\x9e\x08\x02\xdb\x10\x00\x20\x18\x20\xe3\x82\x5f\x1d\x01\xb0\x03\x03\x80\x04\x00\xa3\x04\x07\x9f\x1d\x00\x65\x02\x00\xf5\x0b\x02"
+            "\x54\x0f\x11\x84\x7f\x00\x12\xae\xf3\x03\x11\xaf\x48\x01\x06\xdf\x1d\x13\x8d\xdd\x04\x01\x8b\x0e\x02\xeb\x02\x02\x0e\x0c\x03\xc0"
+            "\x10\x05\xc0\x15\x03\x8c\x29\x00\x33\x08\x04\xfc\x12\x03\xee\x0d\x14\xb4\x70\x08\x03\x90\x0b\x15\x87\x09\x00\x04\x84\x17\x03\xd9"
+            "\x15\x03\xaa\x05\x00\x5c\x0f\x00\xf9\x00\x00",
+            9515, 15152
+        },
+    },
+    // Korean
+    {
+        // characteristic_ko
+        {
+            "\xf1\x9f\x1f\x00\x00\x00\x84\x00\x00\x00\x89\x00\x00\x00\xa8\x00\x00\x00\xba\x00\x00\x00\xce\x00\x00\x00\xe6\x00\x00\x00\x03\x01"
+            "\x00\x00\x1a\x01\x00\x00\x37\x01\x00\x00\x4c\x01\x00\x00\x60\x01\x00\x00\x74\x01\x00\x00\x85\x01\x00\x00\x96\x01\x00\x00\xa0\x01"
+            "\x00\x00\xb4\x01\x00\x00\xbf\x01\x00\x00\xd6\x01\x00\x00\xf1\x01\x00\x00\x08\x02\x00\x00\x1f\x02\x00\x00\x36\x02\x00\x00\x4a\x02"
+            "\x00\x00\x5e\x02\x00\x00\x6f\x02\x00\x00\x86\x02\x00\x00\x97\x02\x00\x00\xac\x02\x00\x00\xca\x02\x00\x00\xe2\x02\x00\x00\xf3\x02"
+            "\x00\x00\x0a\x03\x00\x00\x4e\x6f\x6e\x65\x00\xeb\xa8\xb9\xeb\x8a\x94\x20\xea\xb2\x83\xec\x9d\x84\x20\xec\xa0\x9c\xec\x9d\xbc\x20"
+            "\xec\xa2\x8b\xec\x95\x84\xed\x95\xa8\x00\xeb\x82\xae\xec\x9e\xa0\x1b\x00\xd1\x9e\x98\x20\xec\x9e\xa0\x00\xeb\xa7\x90\xeb\x9a\x9d"
+            "\x15\x00\xf5\x00\xb4\x20\xeb\xa7\x8e\xec\x9d\x8c\x00\xeb\xac\xbc\xea\xb1\xb4\x26\x00\xc0\x96\xb4\xec\xa7\x80\xeb\xa6\x84\x00\xec"
+            "\x9c\xa0\x03\x00\x81\x9e\x90\xec\xa0\x81\xed\x95\xa8\x21\x00\x05\x5b\x00\x90\xed\x9e\x98\xec\x9e\x90\xeb\x9e\x91\x49\x00\xf8\x0c"
+            "\xed\x8a\xb9\xea\xb8\xb0\xec\x9e\x84\x00\xeb\x82\x9c\xeb\x8f\x99\xeb\xb6\x80\xeb\xa6\xac\xea\xb8\xb0\xeb\xa5\x8f\x00\xa1\xec\xa1"
+            "\xb0\xea\xb8\x88\x20\xed\x99\x94\x18\x00\xcb\x9e\x98\xeb\x83\x84\x00\xec\x8b\xb8\xec\x9b\x80\x5d\x00\xf1\x00\x98\x88\xea\xb8\xb0"
+            "\xea\xb0\x80\x20\xec\x99\x95\xec\x84\xb1\xcc\x00\x22\xaa\xb8\x6b\x00\x10\xbc\x03\x00\x00\x11\x00\x41\xa7\xb7\xec\xa7\x7f\x00\x31"
+            "\xea\xb0\x95\x11\x00\xf7\x03\x81\x88\xec\xa7\x88\xea\xb9\x80\x00\xec\x9d\xb8\xeb\x82\xb4\xec\x8b\xac\x1e\x00\x01\xdc\x00\x21\xb0"
+            "\xb8\xf1\x00\x2f\x8b\xac\x9f\x00\x02\xf1\x07\xa3\xbc\xec\x9c\x84\x20\xec\x86\x8c\xeb\xa6\xac\xec\x97\x90\x20\xeb\xaf\xbc\xea\xb0"
+            "\x90\x1b\x00\x10\xb4\xeb\x00\x30\xeb\x8c\x80\x6e\x01\x60\xec\x84\xb1\xea\xb2\xa9\xee\x00\xf1\x04\xec\x95\xbd\xea\xb0\x84\x20\xec"
+            "\x9a\xb0\xec\xad\x90\xec\x9f\x81\xec\x9d\xb4\x05\x01\x82\x8f\x84\xeb\xa7\x9d\xec\x97\x90\x2e\x00\x40\xa0\xec\x88\x98\x17\x00\x30"
+            "\xed\x98\xb8\x26\x01\x0b\x96\x00\x4a\xa5\xeb\x82\x9c\xfe\x00\x60\xeb\xb9\x88\xed\x8b\x88\x25\x00\x30\xec\x97\x86\xb0\x00\x90\xea"
+            "\xb1\xb1\xec\xa0\x95\xea\xb1\xb0\xb6\x00\x25\xb0\x80\xb8\x01\xb1\xa7\xa4\xec\x9a\xb0\x20\xea\xbc\xbc\xea\xbc\x12\x01\x04\x34\x01"
+            "\x28\x84\xbc\xa4\x00\x02\x75\x01\x9b\xea\xb2\x89\xec\xb9\x98\xeb\xa0\x88\xf4\x00\x2f\x98\xa4\x36\x00\x03\xc7\xa7\x80\xea\xb8\xb0"
+            "\x20\xec\x8b\xab\xec\x96\xb4\xbc\x01\x93\xea\xb3\xa0\xec\xa7\x91\xed\x86\xb5\xeb\x00\x00",
+            598, 778
+        },
+        // dppt_ko
+        {
+            "\xf2\xff\xd2\x71\x00\x00\x00\xcc\x01\x00\x00\xda\x01\x00\x00\xe6\x01\x00\x00\xf4\x01\x00\x00\x03\x02\x00\x00\x13\x02\x00\x00\x24"
+            "\x02\x00\x00\x36\x02\x00\x00\x47\x02\x00\x00\x55\x02\x00\x00\x65\x02\x00\x00\x8a\x02\x00\x00\x99\x02\x00\x00\xa8\x02\x00\x00\xb9"
+            "\x02\x00\x00\xc8\x02\x00\x00\xd7\x02\x00\x00\xe6\x02\x00\x00\xf5\x02\x00\x00\x0a\x03\x00\x00\x2b\x03\x00\x00\x4c\x03\x00\x00\x5c"
+            "\x03\x00\x00\x6f\x03\x00\x00\x82\x03\x00\x00\x95\x03\x00\x00\xa8\x03\x00\x00\xbb\x03\x00\x00\xce\x03\x00\x00\xdd\x03\x00\x00\xed"
+            "\x03\x00\x00\xfd\x03\x00\x00\x0e\x04\x00\x00\x27\x04\x00\x00\x40\x04\x00\x00\x59\x04\x00\x00\x66\x04\x00\x00\x77\x04\x00\x00\x89"
+            "\x04\x00\x00\x98\x04\x00\x00\xb0\x04\x00\x00\xc8\x04\x00\x00\xd7\x04\x00\x00\xee\x04\x00\x00\x07\x05\x00\x00\x20\x05\x00\x00\x34"
+            "\x05\x00\x00\x49\x05\x00\x00\x5e\x05\x00\x00\x73\x05\x00\x00\x88\x05\x00\x00\x9d\x05\x00\x00\xaa\x05\x00\x00\xc0\x05\x00\x00\xde"
+            "\x05\x00\x00\xfc\x05\x00\x00\x0a\x06\x00\x00\x18\x06\x00\x00\x24\x06\x00\x00\x33\x06\x00\x00\x43\x06\x00\x00\x5a\x06\x00\x00\x72"
+            "\x06\x00\x00\x82\x06\x00\x00\x8e\x06\x00\x00\xa1\x06\x00\x00\xad\x06\x00\x00\xb8\x06\x00\x00\xc4\x06\x00\x00\xd4\x06\x00\x00\xe5"
+            "\x06\x00\x00\xef\x06\x00\x00\xf9\x06\x00\x00\x03\x07\x00\x00\x15\x07\x00\x00\x27\x07\x00\x00\x39\x07\x00\x00\x4b\x07\x00\x00\x55"
+            "\x07\x00\x00\x5f\x07\x00\x00\x69\x07\x00\x00\x73\x07\x00\x00\x81\x07\x00\x00\x8f\x07\x00\x00\x9d\x07\x00\x00\xab\x07\x00\x00\xb9"
+            "\x07\x00\x00\xcb\x07\x00\x00\xdd\x07\x00\x00\xee\x07\x00\x00\xff\x07\x00\x00\x11\x08\x00\x00\x23\x08\x00\x00\x2d\x08\x00\x00\x37"
+            "\x08\x00\x00\x41\x08\x00\x00\x4b\x08\x00\x00\x55\x08\x00\x00\x5f\x08\x00\x00\x69\x08\x00\x00\x73\x08\x00\x00\x7d\x08\x00\x00\x87"
+            "\x08\x00\x00\x91\x08\x00\x00\x9b\x08\x00\x00\xa5\x08\x00\x00\xaf\x08\x00\x00\xbd\x08\x00\x00\xcb\x08\x00\x00\xd7\x08\x00\x00\xe1"
+            "\x08\x00\x00\xeb\x08\x00\x00\xf5\x08\x00\x00\xff\x08\x00\x00\x43\x61\x6e\x61\x6c\x61\x76\x65\x20\x43\x69\x74\x79\x00\x45\x74\x65"
+            "\x72\x6e\x61\x0c\x00\x73\x50\x61\x73\x74\x6f\x72\x69\x0e\x00\x83\x53\x75\x6e\x79\x73\x68\x6f\x72\x29\x00\xfb\x11\x50\x6f\x6b\xc3"
+            "\xa9\x6d\x6f\x6e\x20\x4c\x65\x61\x67\x75\x65\x00\x4f\x72\x65\x62\x75\x72\x67\x68\x20\x4d\x69\x6e\x65\x20\x31\x46\x11\x00\xf4\x05"
+            "\x42\x31\x46\x00\x56\x61\x6c\x6c\x65\x79\x20\x57\x69\x6e\x64\x77\x6f\x72\x6b\x73\x6d\x00\xf2\x02\x46\x6f\x72\x65\x73\x74\x00\x46"
+            "\x75\x65\x67\x6f\x20\x49\x72\x6f\x6e\x1e\x00\xf9\x15\x4d\x74\x2e\x20\x43\x6f\x72\x6f\x6e\x65\x74\x20\x28\x52\x6f\x75\x74\x65\x20"
+            "\x32\x30\x37\x2f\x32\x30\x38\x20\x45\x6e\x74\x72\x61\x6e\x63\x65\x29\x25\x00\x29\x32\x46\x0f\x00\x1a\x33\x0f\x00\x49\x53\x6e\x6f"
+            "\x77\x11\x00\x1a\x34\x20\x00\x1a\x35\x0f\x00\x1a\x36\x0f\x00\x1a\x37\x0f\x00\x8f\x54\x6f\x70\x20\x43\x61\x76\x65\xa5\x00\x02\x2f"
+            "\x31\x36\xa1\x00\x04\x05\x21\x00\x1f\x31\x21\x00\x04\x00\x26\x01\xfe\x03\x47\x72\x65\x61\x74\x20\x4d\x61\x72\x73\x68\x20\x41\x72"
+            "\x65\x61\x20\x31\x13\x00\x1e\x32\x13\x00\x1e\x33\x13\x00\x1e\x34\x13\x00\x1e\x35\x13\x00\xf0\x0e\x36\x00\x53\x6f\x6c\x61\x63\x65"
+            "\x6f\x6e\x20\x52\x75\x69\x6e\x73\x00\x56\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\xc9\x01\x09\x10\x00\x1b\x32\x10\x00\x01\xd8"
+            "\x01\x09\x11\x00\xaf\x61\x63\x6b\x20\x52\x6f\x6f\x6d\x20\x31\x19\x00\x05\x1f\x32\x19\x00\x05\xe6\x33\x00\x52\x61\x76\x61\x67\x65"
+            "\x64\x20\x50\x61\x74\x68\x42\x02\x3a\x47\x61\x74\x53\x02\x01\x11\x00\x00\x7b\x00\xeb\x53\x74\x61\x72\x6b\x20\x4d\x6f\x75\x6e\x74"
+            "\x61\x69\x6e\x0f\x00\x05\x65\x01\x0c\x18\x00\xf0\x0e\x49\x6e\x74\x65\x72\x69\x6f\x72\x00\x53\x65\x6e\x64\x6f\x66\x66\x20\x53\x70"
+            "\x72\x69\x6e\x67\x00\x54\x75\x72\x6e\x62\x8e\x00\x00\xdb\x01\x06\x3e\x00\x0a\x17\x00\xab\x31\x73\x74\x20\x50\x69\x6c\x6c\x61\x72"
+            "\x19\x00\x34\x32\x6e\x64\x19\x00\x00\x6c\x02\xb1\x70\x6f\x69\x6e\x74\x20\x54\x65\x6d\x70\x6c\xbd\x00\x0d\x14\x00\x01\xc0\x00\x0d"
+            "\x15\x00\x1f\x32\x15\x00\x01\x1f\x33\x15\x00\x01\x1f\x34\x15\x00\x01\xa2\x35\x46\x00\x57\x61\x79\x77\x61\x72\x64\xa0\x02\x08\x0d"
+            "\x00\xa0\x20\x28\x53\x65\x63\x72\x65\x74\x29\x00\xe9\x01\x73\x20\x4d\x61\x6e\x69\x61\x63\x1a\x00\xaf\x3c\x20\x31\x30\x20\x55\x6e"
+            "\x6f\x77\x6e\x1e\x00\x01\x17\x3e\x1e\x00\x03\x19\x00\xf0\x06\x54\x75\x6e\x6e\x65\x6c\x00\x54\x72\x6f\x70\x68\x79\x20\x47\x61\x72"
+            "\x64\x65\x6e\x00\xbd\x03\x78\x20\x49\x73\x6c\x61\x6e\x64\x0c\x00\x00\xff\x00\x08\x0f\x00\x00\xfa\x00\x09\x10\x00\x9e\x32\x46\x20"
+            "\x28\x4c\x65\x66\x74\x29\x17\x00\x4c\x52\x69\x67\x68\x18\x00\xe8\x33\x46\x00\x4f\x6c\x64\x20\x43\x68\x61\x74\x65\x61\x75\x0c\x00"
+            "\x02\x48\x02\xa0\x35\x00\x4c\x61\x6b\x65\x20\x56\x65\x72\xaa\x04\x02\x0c\x00\x42\x61\x6c\x6f\x72\x0b\x00\x30\x41\x63\x75\x17\x00"
+            "\x01\x12\x00\x10\x20\x12\x00\x62\x66\x72\x6f\x6e\x74\x00\x17\x00\x07\x11\x00\x04\x73\x04\x15\x31\x0a\x00\x15\x32\x0a\x00\x15\x33"
+            "\x0a\x00\x98\x34\x20\x28\x53\x6f\x75\x74\x68\x29\x12\x00\x38\x4e\x6f\x72\x12\x00\x1d\x35\x24\x00\x1d\x35\x24\x00\x15\x36\x0a\x00"
+            "\x15\x37\x0a\x00\x15\x38\x0a\x00\x50\x39\x00\x4c\x6f\x73\x77\x04\x30\x77\x65\x72\x4e\x01\x07\x0e\x00\x19\x32\x0e\x00\x19\x33\x0e"
+            "\x00\x19\x34\x0e\x00\x24\x35\x46\x50\x00\x2c\x31\x30\x92\x00\x00\x12\x00\x0a\x92\x00\x70\x31\x31\x20\x28\x57\x65\x73\x2e\x02\x06"
+            "\x11\x00\x28\x45\x61\x11\x00\x1d\x32\x34\x00\x1d\x32\x58\x00\x05\x2a\x01\x25\x31\x34\x0a\x00\x15\x35\x0a\x00\x05\xf6\x00\x15\x31"
+            "\xf6\x00\x15\x31\xf6\x00\x24\x31\x39\x0a\x00\x15\x32\x84\x01\x15\x32\x84\x01\x15\x32\x50\x00\x15\x32\x50\x00\x15\x32\x46\x00\x15"
+            "\x32\x46\x00\xb0\x32\x39\x00\x54\x77\x69\x6e\x6c\x65\x61\x66\x08\x01\xa2\x6e\x00\x43\x65\x6c\x65\x73\x74\x69\x63\x0e\x00\x61\x52"
+            "\x65\x73\x6f\x72\x74\x0b\x05\x05\x32\x00\x15\x30\x0a\x00\x05\xbe\x00\x15\x32\xaa\x00\x30\x33\x30\x00",
+            1369, 2303
+        },
+        // frlg_ko
+        {
+            "\xf4\xff\xc6\x6b\x00\x00\x00\xb4\x01\x00\x00\xc0\x01\x00\x00\xce\x01\x00\x00\xdc\x01\x00\x00\xeb\x01\x00\x00\xf8\x01\x00\x00\x05"
+            "\x02\x00\x00\x15\x02\x00\x00\x1d\x02\x00\x00\x25\x02\x00\x00\x2d\x02\x00\x00\x35\x02\x00\x00\x3d\x02\x00\x00\x45\x02\x00\x00\x4d"
+            "\x02\x00\x00\x55\x02\x00\x00\x5d\x02\x00\x00\x66\x02\x00\x00\x6f\x02\x00\x00\x78\x02\x00\x00\x81\x02\x00\x00\x8a\x02\x00\x00\x93"
+            "\x02\x00\x00\x9c\x02\x00\x00\xa5\x02\x00\x00\xae\x02\x00\x00\xb7\x02\x00\x00\xc0\x02\x00\x00\xc9\x02\x00\x00\xd2\x02\x00\x00\xdb"
+            "\x02\x00\x00\xe4\x02\x00\x00\xed\x02\x00\x00\xfd\x02\x00\x00\x09\x03\x00\x00\x16\x03\x00\x00\x23\x03\x00\x00\x2d\x03\x00\x00\x3c"
+            "\x03\x00\x00\x4c\x03\x00\x00\x5c\x03\x00\x00\x6c\x03\x00\x00\x83\x03\x00\x00\x98\x03\x00\x00\xab\x03\x00\x00\xbe\x03\x00\x00\xd1"
+            "\x03\x00\x00\xe4\x03\x00\x00\xf3\x03\x00\x00\x03\x04\x00\x00\x16\x04\x00\x00\x2a\x04\x00\x00\x3e\x04\x00\x00\x52\x04\x00\x00\x66"
+            "\x04\x00\x00\x78\x04\x00\x00\x8a\x04\x00\x00\x9c\x04\x00\x00\xae\x04\x00\x00\xc0\x04\x00\x00\xd1\x04\x00\x00\xe2\x04\x00\x00\xf4"
+            "\x04\x00\x00\x00\x05\x00\x00\x0b\x05\x00\x00\x17\x05\x00\x00\x23\x05\x00\x00\x2f\x05\x00\x00\x3e\x05\x00\x00\x49\x05\x00\x00\x55"
+            "\x05\x00\x00\x65\x05\x00\x00\x75\x05\x00\x00\x85\x05\x00\x00\x96\x05\x00\x00\xa6\x05\x00\x00\xb5\x05\x00\x00\xc0\x05\x00\x00\xcb"
+            "\x05\x00\x00\xd7\x05\x00\x00\xf0\x05\x00\x00\x00\x06\x00\x00\x0f\x06\x00\x00\x1c\x06\x00\x00\x26\x06\x00\x00\x37\x06\x00\x00\x48"
+            "\x06\x00\x00\x59\x06\x00\x00\x66\x06\x00\x00\x74\x06\x00\x00\x82\x06\x00\x00\x90\x06\x00\x00\x9e\x06\x00\x00\xac\x06\x00\x00\xb9"
+            "\x06\x00\x00\xc6\x06\x00\x00\xd6\x06\x00\x00\xe7\x06\x00\x00\xf9\x06\x00\x00\x06\x07\x00\x00\x14\x07\x00\x00\x23\x07\x00\x00\x32"
+            "\x07\x00\x00\x41\x07\x00\x00\x51\x07\x00\x00\x60\x07\x00\x00\x6d\x07\x00\x00\x7d\x07\x00\x00\x50\x61\x6c\x6c\x65\x74\x20\x54\x6f"
+            "\x77\x6e\x00\x56\x69\x72\x69\x64\x69\x61\x6e\x20\x43\x69\x74\x79\x00\x43\x65\x72\x75\x6c\x65\x0e\x00\x85\x56\x65\x72\x6d\x69\x6c"
+            "\x69\x6f\x1d\x00\x34\x6c\x61\x64\x0d\x00\x73\x46\x75\x63\x68\x73\x69\x61\x1a\x00\xf3\x07\x69\x6e\x6e\x61\x62\x61\x72\x20\x49\x73"
+            "\x6c\x61\x6e\x64\x00\x52\x6f\x75\x74\x65\x20\x31\x08\x00\x13\x32\x08\x00\x13\x33\x08\x00\x13\x34\x08\x00\x13\x35\x08\x00\x13\x36"
+            "\x08\x00\x13\x37\x08\x00\x13\x38\x08\x00\x14\x39\x48\x00\x14\x30\x09\x00\x04\x52\x00\x14\x31\x53\x00\x14\x31\x54\x00\x14\x31\x55"
+            "\x00\x14\x31\x56\x00\x14\x31\x57\x00\x14\x31\x58\x00\x14\x31\x59\x00\x14\x31\x5a\x00\x14\x32\x5a\x00\x15\x32\xac\x00\x04\x5a\x00"
+            "\x14\x32\x5a\x00\x14\x32\x5a\x00\x26\x32\x35\x2d\x01\xf6\x03\x46\x6f\x72\x65\x73\x74\x00\x4d\x74\x2e\x20\x4d\x6f\x6f\x6e\x20\x31"
+            "\x46\x0c\x00\x19\x42\x0d\x00\xf0\x19\x32\x46\x00\x53\x2e\x53\x2e\x20\x41\x6e\x6e\x65\x00\x44\x69\x67\x6c\x65\x74\x74\x27\x73\x20"
+            "\x43\x61\x76\x65\x00\x56\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\x43\x00\x09\x10\x00\x1b\x32\x10\x00\xf0\x01\x33\x46\x00\x50"
+            "\x6f\x6b\xc3\xa9\x6d\x6f\x6e\x20\x4d\x61\x6e\x73\x97\x01\x3f\x31\x46\x2d\x17\x00\x01\x00\x82\x00\xf9\x03\x53\x61\x66\x61\x72\x69"
+            "\x20\x5a\x6f\x6e\x65\x20\x43\x65\x6e\x74\x65\x72\x13\x00\x6e\x41\x72\x65\x61\x20\x31\x13\x00\x1e\x32\x13\x00\x00\x09\x01\x90\x63"
+            "\x6b\x20\x54\x75\x6e\x6e\x65\x6c\xa7\x00\x08\x0f\x00\x01\x6b\x00\x63\x65\x61\x66\x6f\x61\x6d\xfd\x01\x10\x73\x23\x00\x0c\x13\x00"
+            "\x0f\x27\x00\x01\x01\x1b\x01\x0c\x14\x00\x1f\x33\x14\x00\x00\x17\x34\xe3\x00\x59\x54\x6f\x77\x65\x72\x0c\x01\x02\x12\x00\x0e\x24"
+            "\x00\x1d\x35\x12\x00\x1d\x36\x12\x00\x27\x37\x46\xf2\x02\x30\x61\x76\x65\xbb\x00\x0a\x11\x00\x1c\x32\x11\x00\x00\xca\x00\x11\x50"
+            "\x3d\x00\x94\x50\x6c\x61\x6e\x74\x00\x4f\x6e\x65\xf6\x02\x35\x46\x6f\x75\x02\x03\x35\x46\x69\x76\x18\x00\x61\x4b\x69\x6e\x64\x6c"
+            "\x65\xc6\x01\xf0\x10\x00\x54\x72\x65\x61\x73\x75\x72\x65\x20\x42\x65\x61\x63\x68\x00\x43\x61\x70\x65\x20\x42\x72\x69\x6e\x6b\x00"
+            "\x42\x6f\x6e\x64\x0b\x00\x81\x64\x67\x65\x00\x54\x68\x72\x65\x3f\x00\xf5\x17\x65\x20\x50\x6f\x72\x74\x00\x52\x65\x73\x6f\x72\x74"
+            "\x20\x47\x6f\x72\x67\x65\x6f\x75\x73\x00\x57\x61\x74\x65\x72\x20\x4c\x61\x62\x79\x72\x69\x6e\x74\x68\x6e\x00\xf4\x11\x65\x20\x4d"
+            "\x65\x61\x64\x6f\x77\x00\x4d\x65\x6d\x6f\x72\x69\x61\x6c\x20\x50\x69\x6c\x6c\x61\x72\x00\x4f\x75\x74\x63\x61\x73\x74\x92\x00\xa3"
+            "\x47\x72\x65\x65\x6e\x20\x50\x61\x74\x68\x4b\x00\x01\x0b\x00\x60\x52\x75\x69\x6e\x20\x56\x1c\x04\x93\x79\x00\x54\x72\x61\x69\x6e"
+            "\x65\x72\x28\x01\xf2\x14\x28\x65\x78\x74\x65\x72\x69\x6f\x72\x29\x00\x43\x61\x6e\x79\x6f\x6e\x20\x45\x6e\x74\x72\x61\x6e\x63\x65"
+            "\x00\x53\x65\x76\x61\x75\x6c\x74\x20\x18\x00\x80\x00\x54\x61\x6e\x6f\x62\x79\x20\x4b\x00\x11\x73\x06\x03\x56\x45\x6d\x62\x65\x72"
+            "\x0a\x00\x7c\x20\x52\x6f\x6f\x6d\x20\x31\x11\x00\x1c\x32\x11\x00\x17\x33\x11\x00\x03\x50\x03\x02\x0d\x00\x04\x5e\x03\x03\x0e\x00"
+            "\x19\x32\x0e\x00\x19\x33\x0e\x00\x19\x34\x0e\x00\x84\x35\x46\x00\x42\x65\x72\x72\x79\xbc\x03\x72\x49\x63\x65\x66\x61\x6c\x6c\x8a"
+            "\x03\x08\x0d\x00\x00\x70\x00\x09\x10\x00\x00\x73\x00\x0a\x11\x00\xf0\x04\x61\x63\x6b\x00\x50\x61\x74\x74\x65\x72\x6e\x20\x42\x75"
+            "\x73\x68\x00\x41\x6c\x20\x01\x22\x6e\x67\x4e\x00\x31\x4d\x6f\x6e\x30\x02\x21\x68\x61\xfd\x00\x65\x4c\x69\x70\x74\x6f\x6f\x0f\x00"
+            "\x65\x57\x65\x65\x70\x74\x68\x0f\x00\x75\x44\x69\x6c\x66\x6f\x72\x64\x10\x00\x65\x53\x63\x75\x66\x69\x62\x0f\x00\x45\x52\x69\x78"
+            "\x79\x0d\x00\x75\x56\x69\x61\x70\x6f\x69\x73\x10\x00\x00",
+            1294, 1917
+        },
+        // hgss_ko
+        {
+            "\xf3\xff\xff\x02\x78\x00\x00\x00\xe8\x01\x00\x00\xf6\x01\x00\x00\xff\x01\x00\x00\x10\x02\x00\x00\x19\x02\x00\x00\x22\x02\x00\x00"
+            "\x2e\x02\x00\x00\x3b\x02\x00\x00\x44\x02\x00\x00\x5c\x02\x00\x00\x73\x02\x00\x00\x81\x02\x00\x00\x90\x02\x00\x00\x9f\x02\x00\x00"
+            "\xa8\x02\x00\x00\xb9\x02\x00\x00\xcb\x02\x00\x00\xd7\x02\x00\x00\xe0\x02\x00\x00\xe9\x02\x00\x00\xf7\x02\x00\x00\x00\x03\x00\x00"
+            "\x09\x03\x00\x00\x17\x03\x00\x00\x27\x03\x00\x00\x38\x03\x00\x00\x43\x03\x00\x00\x4c\x03\x00\x00\x55\x03\x00\x00\x62\x03\x00\x00"
+            "\x6b\x03\x00\x00\x74\x03\x00\x00\x85\x03\x00\x00\x97\x03\x00\x00\xa9\x03\x00\x00\xbb\x03\x00\x00\xc9\x03\x00\x00\xd2\x03\x00\x00"
+            "\xe0\x03\x00\x00\xf5\x03\x00\x00\x03\x04\x00\x00\x12\x04\x00\x00\x1b\x04\x00\x00\x28\x04\x00\x00\x31\x04\x00\x00\x3d\x04\x00\x00"
+            "\x4a\x04\x00\x00\x57\x04\x00\x00\x64\x04\x00\x00\x74\x04\x00\x00\x83\x04\x00\x00\x8c\x04\x00\x00\x95\x04\x00\x00\xaa\x04\x00\x00"
+            "\xbf\x04\x00\x00\xc8\x04\x00\x00\xd1\x04\x00\x00\xe5\x04\x00\x00\xf8\x04\x00\x00\x0c\x05\x00\x00\x20\x05\x00\x00\x34\x05\x00\x00"
+            "\x48\x05\x00\x00\x56\x05\x00\x00\x6d\x05\x00\x00\x7b\x05\x00\x00\x8b\x05\x00\x00\x96\x05\x00\x00\xa1\x05\x00\x00\xaf\x05\x00\x00"
+            "\xcc\x05\x00\x00\xdf\x05\x00\x00\xee\x05\x00\x00\xf7\x05\x00\x00\x00\x06\x00\x00\x09\x06\x00\x00\x15\x06\x00\x00\x23\x06\x00\x00"
+            "\x31\x06\x00\x00\x40\x06\x00\x00\x4d\x06\x00\x00\x5a\x06\x00\x00\x6a\x06\x00\x00\x73\x06\x00\x00\x7c\x06\x00\x00\x85\x06\x00\x00"
+            "\x8e\x06\x00\x00\x97\x06\x00\x00\xa6\x06\x00\x00\xb5\x06\x00\x00\xc5\x06\x00\x00\xcd\x06\x00\x00\xdd\x06\x00\x00\xe5\x06\x00\x00"
+            "\xed\x06\x00\x00\xf5\x06\x00\x00\xfd\x06\x00\x00\x05\x07\x00\x00\x0d\x07\x00\x00\x15\x07\x00\x00\x1e\x07\x00\x00\x27\x07\x00\x00"
+            "\x30\x07\x00\x00\x39\x07\x00\x00\x42\x07\x00\x00\x4b\x07\x00\x00\x54\x07\x00\x00\x5d\x07\x00\x00\x66\x07\x00\x00\x6f\x07\x00\x00"
+            "\x78\x07\x00\x00\x81\x07\x00\x00\x8d\x07\x00\x00\x9e\x07\x00\x00\xae\x07\x00\x00\xbe\x07\x00\x00\xce\x07\x00\x00\xde\x07\x00\x00"
+            "\xef\x07\x00\x00\x00\x08\x00\x00\x12\x08\x00\x00\x4e\x65\x77\x20\x42\x61\x72\x6b\x20\x54\x6f\x77\x6e\x00\x52\x6f\x75\x74\x65\x20"
+            "\x32\x39\x00\x43\x68\x65\x72\x72\x79\x67\x72\x6f\x76\x65\x20\x43\x69\x74\x79\x1a\x00\x24\x33\x30\x09\x00\x82\x31\x00\x56\x69\x6f"
+            "\x6c\x65\x74\x1e\x00\x60\x53\x70\x72\x6f\x75\x74\x44\x00\x24\x65\x72\x22\x00\xfc\x0a\x32\x00\x52\x75\x69\x6e\x73\x20\x6f\x66\x20"
+            "\x41\x6c\x70\x68\x20\x28\x4f\x75\x74\x73\x69\x64\x65\x29\x18\x00\x22\x49\x6e\x17\x00\xd8\x55\x6e\x69\x6f\x6e\x20\x43\x61\x76\x65"
+            "\x20\x31\x46\x0e\x00\x1b\x42\x0f\x00\x24\x32\x46\x64\x00\xf0\x00\x33\x00\x53\x4c\x4f\x57\x50\x4f\x4b\x45\x20\x57\x65\x6c\x6c\x38"
+            "\x00\x0a\x11\x00\x00\x3b\x00\xb4\x49\x6c\x65\x78\x20\x46\x6f\x72\x65\x73\x74\x38\x00\x14\x34\x09\x00\xf4\x00\x35\x00\x4e\x61\x74"
+            "\x69\x6f\x6e\x61\x6c\x20\x50\x61\x72\x6b\x17\x00\x14\x36\x09\x00\xa2\x37\x00\x45\x63\x72\x75\x74\x65\x61\x6b\xe9\x00\x62\x42\x75"
+            "\x72\x6e\x65\x64\xe9\x00\x00\x6e\x00\x09\x10\x00\x00\x6d\x00\x10\x42\x76\x00\x09\x08\x01\x14\x38\x09\x00\x89\x39\x00\x4f\x6c\x69"
+            "\x76\x69\x6e\x52\x01\x14\x34\x52\x01\xf0\x01\x34\x31\x00\x57\x68\x69\x72\x6c\x20\x49\x73\x6c\x61\x6e\x64\x73\x5e\x00\x0a\x11\x00"
+            "\x00\x5f\x00\x0b\x12\x00\x1d\x32\x12\x00\xb9\x33\x46\x00\x43\x69\x61\x6e\x77\x6f\x6f\x64\x67\x00\xb1\x32\x00\x4d\x74\x2e\x20\x4d"
+            "\x6f\x72\x74\x61\xb9\x00\x09\x0e\x00\x78\x20\x28\x42\x61\x63\x6b\x29\x15\x00\x19\x32\x23\x00\x00\x7b\x00\x03\x49\x00\x60\x33\x00"
+            "\x4c\x61\x6b\x65\xbe\x01\x44\x52\x61\x67\x65\x16\x00\xa0\x34\x00\x49\x63\x65\x20\x50\x61\x74\x68\x5d\x00\x05\x0c\x00\x01\x7f\x01"
+            "\x05\x0d\x00\x18\x32\x0d\x00\xd2\x33\x46\x00\x42\x6c\x61\x63\x6b\x74\x68\x6f\x72\x6e\xab\x00\xd4\x44\x72\x61\x67\x6f\x6e\xe2\x80"
+            "\x99\x73\x20\x44\x65\x8d\x02\x24\x34\x35\x09\x00\x30\x36\x00\x44\xa9\x02\x01\x04\x02\x14\x28\x87\x02\x1e\x29\x15\x00\x34\x34\x35"
+            "\x29\x33\x00\x13\x37\xc5\x00\x25\x6f\x6e\x09\x00\xf8\x04\x20\x28\x43\x6c\x65\x66\x61\x69\x72\x79\x29\x00\x53\x65\x61\x66\x6f\x61"
+            "\x6d\x73\x01\x0c\x13\x00\x00\xc2\x00\x0d\x14\x00\x1f\x32\x14\x00\x00\x1f\x33\x14\x00\x00\x12\x34\x45\x01\x42\x53\x69\x6c\x76\x2f"
+            "\x02\x07\x0e\x00\x03\xe8\x02\x48\x20\x54\x6f\x70\x17\x00\xf3\x03\x34\x46\x00\x43\x6c\x69\x66\x66\x20\x45\x64\x67\x65\x20\x47\x61"
+            "\x74\x65\x10\x00\x00\x30\x00\x07\x29\x00\x08\x34\x00\x03\xac\x01\x08\x59\x00\x71\x4d\x6f\x75\x6e\x74\x61\x69\x5a\x03\x0d\x1d\x00"
+            "\x19\x33\x30\x00\x00\x81\x00\x02\x2f\x01\x24\x31\x32\x09\x00\x14\x39\x0a\x04\x50\x30\x00\x50\x61\x6c\xe7\x03\x01\x1f\x04\x73\x56"
+            "\x69\x72\x69\x64\x69\x61\xaf\x01\x64\x43\x65\x72\x75\x6c\x65\x0e\x00\x61\x56\x65\x72\x6d\x69\x6c\xa5\x03\x02\x1d\x00\x34\x6c\x61"
+            "\x64\x0d\x00\x73\x46\x75\x63\x68\x73\x69\x61\x1a\x00\x73\x69\x6e\x6e\x61\x62\x61\x72\x27\x01\x04\xab\x01\x04\x27\x03\x14\x32\x7c"
+            "\x03\x24\x32\x37\x09\x00\x16\x38\xc6\x01\xa1\x52\x6f\x63\x6b\x20\x54\x75\x6e\x6e\x65\xed\x03\x08\x0f\x00\xf2\x00\x32\x46\x00\x56"
+            "\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\x1f\x00\x01\xce\x00\x04\x48\x00\x74\x20\x28\x53\x6f\x75\x74\x68\x1e\x02\x14\x33\x7b"
+            "\x00\x03\x08\x00\x04\x69\x02\x04\x81\x00\x04\x80\x00\x04\x9a\x00\x04\x15\x01\x14\x31\xb3\x03\x14\x31\x5a\x00\x14\x31\x4b\x00\x14"
+            "\x31\x4c\x00\x14\x31\x4d\x00\x14\x31\x4e\x00\x14\x31\x4f\x00\x15\x31\xea\x00\x05\x99\x00\x04\x78\x01\x14\x32\x3f\x00\xf1\x07\x32"
+            "\x35\x00\x54\x6f\x68\x6a\x6f\x20\x46\x61\x6c\x6c\x73\x00\x44\x49\x47\x4c\x45\x54\x54\x1a\x03\x01\x08\x02\x09\xe9\x00\x0c\xf9\x00"
+            "\x14\x33\xf9\x00\x60\x32\x20\x28\x4e\x6f\x72\xf1\x00\x05\xb9\x01\x03\x07\x05\x06\xbb\x01\x03\x6e\x05\x0a\x11\x00\x1c\x32\x11\x00"
+            "\x00\x06\x03\x00",
+            1348, 2066
+        },
+        // natures_ko
+        {
+            "\xf3\xbe\x19\x00\x00\x00\x6c\x00\x00\x00\x73\x00\x00\x00\x7d\x00\x00\x00\x84\x00\x00\x00\x8b\x00\x00\x00\x98\x00\x00\x00\x9f\x00"
+            "\x00\x00\xa6\x00\x00\x00\xb3\x00\x00\x00\xc3\x00\x00\x00\xca\x00\x00\x00\xd4\x00\x00\x00\xdb\x00\x00\x00\xe2\x00\x00\x00\xe9\x00"
+            "\x00\x00\xf6\x00\x00\x00\xfd\x00\x00\x00\x04\x01\x00\x00\x0b\x01\x00\x00\x15\x01\x00\x00\x1c\x01\x00\x00\x23\x01\x00\x00\x2a\x01"
+            "\x00\x00\x31\x01\x00\x00\x38\x01\x00\x00\x3f\x01\x00\x00\xeb\x85\xb8\xeb\xa0\xa5\x00\xec\x99\xb8\xeb\xa1\x9c\xec\x9b\x80\x00\xec"
+            "\x9a\xa9\xea\xb0\x90\x00\xea\xb3\xa0\xec\xa7\x91\x00\xea\xb0\x9c\xea\xb5\xac\xec\x9f\x81\xec\x9d\xb4\x00\xeb\x8c\x80\xeb\x8b\xb4"
+            "\x00\xec\x98\xa8\xec\x88\x9c\x00\xeb\xac\xb4\xec\x82\xac\xed\x83\x9c\xed\x8f\x89\x00\xec\x9e\xa5\xeb\x82\x9c\xea\xbe\xb8\xeb\x9f"
+            "\xac\xea\xb8\xb0\x00\xec\xb4\x90\xeb\x9e\x91\x00\xea\xb2\x81\x3c\x00\x60\xec\x84\xb1\xea\xb8\x89\x07\x00\x70\xec\x8b\xa4\x00\xeb"
+            "\xaa\x85\x1f\x00\xf0\x47\xec\xb2\x9c\xec\xa7\x84\xeb\x82\x9c\xeb\xa7\x8c\x00\xec\xa1\xb0\xec\x8b\xac\x00\xec\x9d\x98\xec\xa0\x93"
+            "\x00\xeb\x83\x89\xec\xa0\x95\x00\xec\x88\x98\xec\xa4\x8d\xec\x9d\x8c\x00\xeb\x8d\x9c\xeb\xa0\x81\x00\xec\xb0\xa8\xeb\xb6\x84\x00"
+            "\xec\x96\x8c\xec\xa0\x84\x00\xea\xb1\xb4\xeb\xb0\xa9\x00\xec\x8b\xa0\xec\xa4\x91\x00\xeb\xb3\x80\xeb\x8d\x95\x00",
+            316, 319
+        },
+        // powers_ko
+        {
+            "\xf0\x87\x10\x00\x00\x00\x48\x00\x00\x00\x4f\x00\x00\x00\x56\x00\x00\x00\x5a\x00\x00\x00\x5e\x00\x00\x00\x65\x00\x00\x00\x6c\x00"
+            "\x00\x00\x76\x00\x00\x00\x7d\x00\x00\x00\x84\x00\x00\x00\x88\x00\x00\x00\x8c\x00\x00\x00\x93\x00\x00\x00\x9d\x00\x00\x00\xa4\x00"
+            "\x00\x00\xae\x00\x00\x00\xb2\x00\x00\x00\xea\xb2\xa9\xed\x88\xac\x00\xeb\xb9\x84\xed\x96\x89\x00\xeb\x8f\x85\x00\xeb\x95\x85\x00"
+            "\xeb\xb0\x94\xec\x9c\x84\x00\xeb\xb2\x8c\xeb\xa0\x88\x00\xea\xb3\xa0\xec\x8a\xa4\xed\x8a\xb8\x00\xea\xb0\x95\xec\xb2\xa0\x00\xeb"
+            "\xb6\x88\xea\xbd\x83\x00\xeb\xac\xbc\x00\xed\x92\x80\x00\xec\xa0\x84\xea\xb8\xb0\x00\xec\x97\x90\x27\x00\xf0\x09\x8d\xbc\x00\xec"
+            "\x96\xbc\xec\x9d\x8c\x00\xeb\x93\x9c\xeb\x9e\x98\xea\xb3\xa4\x00\xec\x95\x85\x00",
+            180, 178
+        },
+        // rse_ko
+        {
+            "\xf3\xff\x69\x56\x00\x00\x00\x60\x01\x00\x00\x6d\x01\x00\x00\x7d\x01\x00\x00\x8c\x01\x00\x00\x9b\x01\x00\x00\xa9\x01\x00\x00\xb7"
+            "\x01\x00\x00\xc7\x01\x00\x00\xd8\x01\x00\x00\xe2\x01\x00\x00\xec\x01\x00\x00\xf6\x01\x00\x00\x00\x02\x00\x00\x0a\x02\x00\x00\x14"
+            "\x02\x00\x00\x1e\x02\x00\x00\x28\x02\x00\x00\x32\x02\x00\x00\x3c\x02\x00\x00\x46\x02\x00\x00\x50\x02\x00\x00\x5a\x02\x00\x00\x64"
+            "\x02\x00\x00\x6e\x02\x00\x00\x78\x02\x00\x00\x82\x02\x00\x00\x8c\x02\x00\x00\x96\x02\x00\x00\xa0\x02\x00\x00\xaa\x02\x00\x00\xb4"
+            "\x02\x00\x00\xbe\x02\x00\x00\xc8\x02\x00\x00\xd2\x02\x00\x00\xdc\x02\x00\x00\xe6\x02\x00\x00\xf0\x02\x00\x00\xfa\x02\x00\x00\x04"
+            "\x03\x00\x00\x0e\x03\x00\x00\x18\x03\x00\x00\x22\x03\x00\x00\x2c\x03\x00\x00\x43\x03\x00\x00\x5a\x03\x00\x00\x6a\x03\x00\x00\x85"
+            "\x03\x00\x00\x96\x03\x00\x00\xa7\x03\x00\x00\xba\x03\x00\x00\xcd\x03\x00\x00\xe0\x03\x00\x00\xf3\x03\x00\x00\x06\x04\x00\x00\x19"
+            "\x04\x00\x00\x29\x04\x00\x00\x38\x04\x00\x00\x47\x04\x00\x00\x5f\x04\x00\x00\x77\x04\x00\x00\x8a\x04\x00\x00\x9d\x04\x00\x00\xb1"
+            "\x04\x00\x00\xc5\x04\x00\x00\xe0\x04\x00\x00\xef\x04\x00\x00\xfe\x04\x00\x00\x10\x05\x00\x00\x20\x05\x00\x00\x2b\x05\x00\x00\x3f"
+            "\x05\x00\x00\x4f\x05\x00\x00\x5f\x05\x00\x00\x70\x05\x00\x00\x81\x05\x00\x00\x99\x05\x00\x00\xa8\x05\x00\x00\xb3\x05\x00\x00\xbf"
+            "\x05\x00\x00\xcd\x05\x00\x00\xdb\x05\x00\x00\xe9\x05\x00\x00\xf7\x05\x00\x00\x04\x06\x00\x00\x11\x06\x00\x00\x22\x06\x00\x00\x30"
+            "\x06\x00\x00\x44\x65\x77\x66\x6f\x72\x64\x20\x54\x6f\x77\x6e\x00\x50\x61\x63\x69\x66\x69\x64\x6c\x6f\x67\x10\x00\xf2\x08\x65\x74"
+            "\x61\x6c\x62\x75\x72\x67\x20\x43\x69\x74\x79\x00\x53\x6c\x61\x74\x65\x70\x6f\x72\x74\x0f\x00\x82\x4c\x69\x6c\x79\x63\x6f\x76\x65"
+            "\x0e\x00\x83\x4d\x6f\x73\x73\x64\x65\x65\x70\x2b\x00\x92\x6f\x6f\x74\x6f\x70\x6f\x6c\x69\x73\x10\x00\xa3\x45\x76\x65\x72\x20\x47"
+            "\x72\x61\x6e\x64\x2f\x00\x95\x52\x6f\x75\x74\x65\x20\x31\x30\x31\x0a\x00\x15\x32\x0a\x00\x15\x33\x0a\x00\x15\x34\x0a\x00\x15\x35"
+            "\x0a\x00\x15\x36\x0a\x00\x15\x37\x0a\x00\x15\x38\x0a\x00\x14\x39\x0a\x00\x25\x31\x30\x0a\x00\x05\x64\x00\x15\x31\x64\x00\x15\x31"
+            "\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x32\x64\x00\x15\x32"
+            "\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32"
+            "\x64\x00\x15\x33\x64\x00\x15\x33\x64\x00\x15\x33\x64\x00\x15\x33\x64\x00\xf5\x00\x33\x34\x00\x55\x6e\x64\x65\x72\x77\x61\x74\x65"
+            "\x72\x20\x28\x7a\x00\x1f\x29\x17\x00\x02\x30\x36\x29\x00\x8e\x01\xba\x69\x74\x65\x20\x43\x61\x76\x65\x20\x31\x46\x10\x00\xda\x53"
+            "\x74\x65\x76\x65\x6e\x27\x73\x20\x52\x6f\x6f\x6d\x1b\x00\x1c\x42\x2c\x00\xfe\x07\x42\x32\x46\x00\x53\x61\x66\x61\x72\x69\x20\x5a"
+            "\x6f\x6e\x65\x20\x41\x72\x65\x61\x20\x31\x13\x00\x1e\x32\x13\x00\x1e\x33\x13\x00\x1e\x34\x13\x00\x1e\x35\x13\x00\x17\x36\x9c\x02"
+            "\xfb\x2c\x57\x6f\x6f\x64\x73\x00\x52\x75\x73\x74\x75\x72\x66\x20\x54\x75\x6e\x6e\x65\x6c\x00\x41\x62\x61\x6e\x64\x6f\x6e\x65\x64"
+            "\x20\x53\x68\x69\x70\x00\x4e\x65\x77\x20\x4d\x61\x75\x76\x69\x6c\x6c\x65\x20\x28\x45\x6e\x74\x72\x61\x6e\x63\x65\x29\x18\x00\xfd"
+            "\x0d\x42\x61\x73\x65\x6d\x65\x6e\x74\x29\x00\x4d\x65\x74\x65\x6f\x72\x20\x46\x61\x6c\x6c\x73\x20\x31\x46\x20\x31\x52\x13\x00\x1b"
+            "\x32\x13\x00\x1f\x42\x27\x00\x00\x00\x14\x00\x0c\x28\x00\x05\x5b\x01\x00\x3d\x01\x80\x00\x4d\x74\x2e\x20\x50\x79\x72\x82\x01\x36"
+            "\x2d\x33\x46\x0f\x00\x47\x34\x46\x2d\x36\x0f\x00\x86\x45\x78\x74\x65\x72\x69\x6f\x72\x12\x00\xc2\x53\x75\x6d\x6d\x69\x74\x00\x53"
+            "\x68\x6f\x61\x6c\x4b\x00\x06\x0b\x00\x42\x20\x49\x63\x65\xba\x01\x81\x53\x65\x61\x66\x6c\x6f\x6f\x72\x17\x00\xf0\x00\x72\x6e\x00"
+            "\x56\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\xf5\x01\x09\x10\x00\x00\xda\x01\x0a\x11\x00\x31\x32\x46\x00\x50\x00\xa4\x6f\x66"
+            "\x20\x4f\x72\x69\x67\x69\x6e\x20\x3b\x01\x0b\x18\x00\xf0\x13\x00\x46\x69\x65\x72\x79\x20\x50\x61\x74\x68\x00\x4a\x61\x67\x67\x65"
+            "\x64\x20\x50\x61\x73\x73\x00\x53\x6b\x79\x20\x50\x69\x6c\x6c\x61\x72\x6e\x00\x07\x0e\x00\x19\x33\x0e\x00\xf0\x08\x35\x46\x00\x4d"
+            "\x61\x67\x6d\x61\x20\x48\x69\x64\x65\x6f\x75\x74\x00\x4d\x69\x72\x61\x67\x65\x86\x04\xa2\x65\x72\x00\x41\x72\x74\x69\x73\x61\x6e"
+            "\xe6\x00\x71\x44\x65\x73\x65\x72\x74\x20\xd5\x02\x10\x70\x63\x00\x20\x41\x6c\x1b\x01\x22\x6e\x67\x1f\x00\x00",
+            1051, 1584
+        },
+        // species_ko
+        {
+            "\xf6\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xad\x27\x03\x00\x00\xa4\x0c\x00\x00\xb1\x0c\x00\x00\xbe\x0c\x00\x00\xcb\x0c"
+            "\x00\x00\xd5\x0c\x00\x00\xdf\x0c\x00\x00\xe9\x0c\x00\x00\xf3\x0c\x00\x00\x00\x0d\x00\x00\x0a\x0d\x00\x00\x14\x0d\x00\x00\x1e\x0d"
+            "\x00\x00\x28\x0d\x00\x00\x32\x0d\x00\x00\x3c\x0d\x00\x00\x46\x0d\x00\x00\x4d\x0d\x00\x00\x54\x0d\x00\x00\x5e\x0d\x00\x00\x65\x0d"
+            "\x00\x00\x6f\x0d\x00\x00\x79\x0d\x00\x00\x89\x0d\x00\x00\x90\x0d\x00\x00\x9a\x0d\x00\x00\xa4\x0d\x00\x00\xae\x0d\x00\x00\xbb\x0d"
+            "\x00\x00\xc2\x0d\x00\x00\xcf\x0d\x00\x00\xdc\x0d\x00\x00\xe6\x0d\x00\x00\xf3\x0d\x00\x00\x00\x0e\x00\x00\x0a\x0e\x00\x00\x11\x0e"
+            "\x00\x00\x18\x0e\x00\x00\x25\x0e\x00\x00\x32\x0e\x00\x00\x39\x0e\x00\x00\x43\x0e\x00\x00\x4a\x0e\x00\x00\x51\x0e\x00\x00\x5b\x0e"
+            "\x00\x00\x65\x0e\x00\x00\x75\x0e\x00\x00\x7f\x0e\x00\x00\x8c\x0e\x00\x00\x93\x0e\x00\x00\x9d\x0e\x00\x00\xa7\x0e\x00\x00\xb4\x0e"
+            "\x00\x00\xbb\x0e\x00\x00\xc8\x0e\x00\x00\xd5\x0e\x00\x00\xdc\x0e\x00\x00\xe3\x0e\x00\x00\xed\x0e\x00\x00\xf4\x0e\x00\x00\xfb\x0e"
+            "\x00\x00\x05\x0f\x00\x00\x12\x0f\x00\x00\x1c\x0f\x00\x00\x26\x0f\x00\x00\x30\x0f\x00\x00\x37\x0f\x00\x00\x41\x0f\x00\x00\x4b\x0f"
+            "\x00\x00\x55\x0f\x00\x00\x5f\x0f\x00\x00\x69\x0f\x00\x00\x76\x0f\x00\x00\x80\x0f\x00\x00\x8a\x0f\x00\x00\x94\x0f\x00\x00\x9e\x0f"
+            "\x00\x00\xa8\x0f\x00\x00\xb2\x0f\x00\x00\xbc\x0f\x00\x00\xc3\x0f\x00\x00\xcd\x0f\x00\x00\xd4\x0f\x00\x00\xe1\x0f\x00\x00\xeb\x0f"
+            "\x00\x00\xf2\x0f\x00\x00\xff\x0f\x00\x00\x06\x10\x00\x00\x10\x10\x00\x00\x1a\x10\x00\x00\x24\x10\x00\x00\x2b\x10\x00\x00\x35\x10"
+            "\x00\x00\x3f\x10\x00\x00\x4c\x10\x00\x00\x53\x10\x00\x00\x5d\x10\x00\x00\x67\x10\x00\x00\x71\x10\x00\x00\x78\x10\x00\x00\x82\x10"
+            "\x00\x00\x8f\x10\x00\x00\x96\x10\x00\x00\xa0\x10\x00\x00\xa7\x10\x00\x00\xb1\x10\x00\x00\xbb\x10\x00\x00\xc8\x10\x00\x00\xd2\x10"
+            "\x00\x00\xdc\x10\x00\x00\xe6\x10\x00\x00\xf3\x10\x00\x00\xfd\x10\x00\x00\x07\x11\x00\x00\x0e\x11\x00\x00\x18\x11\x00\x00\x1f\x11"
+            "\x00\x00\x29\x11\x00\x00\x33\x11\x00\x00\x3a\x11\x00\x00\x44\x11\x00\x00\x51\x11\x00\x00\x5e\x11\x00\x00\x68\x11\x00\x00\x72\x11"
+            "\x00\x00\x7c\x11\x00\x00\x86\x11\x00\x00\x90\x11\x00\x00\x9d\x11\x00\x00\xaa\x11\x00\x00\xb4\x11\x00\x00\xc1\x11\x00\x00\xce\x11"
+            "\x00\x00\xd8\x11\x00\x00\xe2\x11\x00\x00\xec\x11\x00\x00\xf9\x11\x00\x00\x03\x12\x00\x00\x0d\x12\x00\x00\x1a\x12\x00\x00\x24\x12"
+            "\x00\x00\x2b\x12\x00\x00\x38\x12\x00\x00\x42\x12\x00\x00\x4c\x12\x00\x00\x56\x12\x00\x00\x5d\x12\x00\x00\x67\x12\x00\x00\x6e\x12"
+            "\x00\x00\x75\x12\x00\x00\x7f\x12\x00\x00\x86\x12\x00\x00\x8a\x12\x00\x00\x97\x12\x00\x00\xa4\x12\x00\x00\xb1\x12\x00\x00\xbb\x12"
+            "\x00\x00\xc8\x12\x00\x00\xd5\x12\x00\x00\xdf\x12\x00\x00\xec\x12\x00\x00\xfc\x12\x00\x00\x06\x13\x00\x00\x10\x13\x00\x00\x1a\x13"
+            "\x00\x00\x24\x13\x00\x00\x2e\x13\x00\x00\x38\x13\x00\x00\x42\x13\x00\x00\x52\x13\x00\x00\x5c\x13\x00\x00\x66\x13\x00\x00\x6d\x13"
+            "\x00\x00\x74\x13\x00\x00\x78\x13\x00\x00\x82\x13\x00\x00\x8c\x13\x00\x00\x96\x13\x00\x00\xa0\x13\x00\x00\xad\x13\x00\x00\xb7\x13"
+            "\x00\x00\xc1\x13\x00\x00\xc8\x13\x00\x00\xd2\x13\x00\x00\xd9\x13\x00\x00\xe3\x13\x00\x00\xed\x13\x00\x00\xf7\x13\x00\x00\x01\x14"
+            "\x00\x00\x08\x14\x00\x00\x12\x14\x00\x00\x1c\x14\x00\x00\x26\x14\x00\x00\x30\x14\x00\x00\x3a\x14\x00\x00\x41\x14\x00\x00\x48\x14"
+            "\x00\x00\x52\x14\x00\x00\x5c\x14\x00\x00\x66\x14\x00\x00\x70\x14\x00\x00\x7a\x14\x00\x00\x81\x14\x00\x00\x8b\x14\x00\x00\x95\x14"
+            "\x00\x00\x9c\x14\x00\x00\xa3\x14\x00\x00\xad\x14\x00\x00\xba\x14\x00\x00\xc4\x14\x00\x00\xcb\x14\x00\x00\xd8\x14\x00\x00\xe2\x14"
+            "\x00\x00\xe9\x14\x00\x00\xf3\x14\x00\x00\x03\x15\x00\x00\x0d\x15\x00\x00\x17\x15\x00\x00\x1e\x15\x00\x00\x2b\x15\x00\x00\x3b\x15"
+            "\x00\x00\x45\x15\x00\x00\x4f\x15\x00\x00\x59\x15\x00\x00\x60\x15\x00\x00\x6d\x15\x00\x00\x7a\x15\x00\x00\x84\x15\x00\x00\x8e\x15"
+            "\x00\x00\x95\x15\x00\x00\x9c\x15\x00\x00\xa6\x15\x00\x00\xb0\x15\x00\x00\xba\x15\x00\x00\xc5\x15\x00\x00\xcf\x15\x00\x00\xd9\x15"
+            "\x00\x00\xe3\x15\x00\x00\xf0\x15\x00\x00\xfa\x15\x00\x00\x07\x16\x00\x00\x11\x16\x00\x00\x1b\x16\x00\x00\x28\x16\x00\x00\x32\x16"
+            "\x00\x00\x3c\x16\x00\x00\x46\x16\x00\x00\x53\x16\x00\x00\x60\x16\x00\x00\x6d\x16\x00\x00\x77\x16\x00\x00\x81\x16\x00\x00\x8b\x16"
+            "\x00\x00\x98\x16\x00\x00\xa5\x16\x00\x00\xaf\x16\x00\x00\xb9\x16\x00\x00\xc3\x16\x00\x00\xcd\x16\x00\x00\xd7\x16\x00\x00\xe1\x16"
+            "\x00\x00\xeb\x16\x00\x00\xf5\x16\x00\x00\x02\x17\x00\x00\x12\x17\x00\x00\x1c\x17\x00\x00\x26\x17\x00\x00\x2d\x17\x00\x00\x3d\x17"
+            "\x00\x00\x47\x17\x00\x00\x51\x17\x00\x00\x5b\x17\x00\x00\x65\x17\x00\x00\x6f\x17\x00\x00\x79\x17\x00\x00\x83\x17\x00\x00\x8d\x17"
+            "\x00\x00\x97\x17\x00\x00\xa1\x17\x00\x00\xab\x17\x00\x00\xb5\x17\x00\x00\xbf\x17\x00\x00\xc9\x17\x00\x00\xd3\x17\x00\x00\xdd\x17"
+            "\x00\x00\xe7\x17\x00\x00\xf1\x17\x00\x00\xfb\x17\x00\x00\x05\x18\x00\x00\x0f\x18\x00\x00\x19\x18\x00\x00\x23\x18\x00\x00\x30\x18"
+            "\x00\x00\x3a\x18\x00\x00\x44\x18\x00\x00\x4e\x18\x00\x00\x58\x18\x00\x00\x62\x18\x00\x00\x6c\x18\x00\x00\x76\x18\x00\x00\x83\x18"
+            "\x00\x00\x8d\x18\x00\x00\x97\x18\x00\x00\xa1\x18\x00\x00\xab\x18\x00\x00\xb5\x18\x00\x00\xbf\x18\x00\x00\xcc\x18\x00\x00\xd6\x18"
+            "\x00\x00\xe0\x18\x00\x00\xed\x18\x00\x00\xfa\x18\x00\x00\x04\x19\x00\x00\x0e\x19\x00\x00\x18\x19\x00\x00\x25\x19\x00\x00\x32\x19"
+            "\x00\x00\x3c\x19\x00\x00\x46\x19\x00\x00\x53\x19\x00\x00\x60\x19\x00\x00\x6d\x19\x00\x00\x77\x19\x00\x00\x7e\x19\x00\x00\x85\x19"
+            "\x00\x00\x8f\x19\x00\x00\x9c\x19\x00\x00\xa6\x19\x00\x00\xb0\x19\x00\x00\xb7\x19\x00\x00\xc4\x19\x00\x00\xd1\x19\x00\x00\xdb\x19"
+            "\x00\x00\xe5\x19\x00\x00\xef\x19\x00\x00\xfc\x19\x00\x00\x03\x1a\x00\x00\x0d\x1a\x00\x00\x17\x1a\x00\x00\x1e\x1a\x00\x00\x28\x1a"
+            "\x00\x00\x2f\x1a\x00\x00\x39\x1a\x00\x00\x46\x1a\x00\x00\x50\x1a\x00\x00\x5d\x1a\x00\x00\x64\x1a\x00\x00\x6e\x1a\x00\x00\x7b\x1a"
+            "\x00\x00\x85\x1a\x00\x00\x8f\x1a\x00\x00\x99\x1a\x00\x00\xa3\x1a\x00\x00\xad\x1a\x00\x00\xba\x1a\x00\x00\xc4\x1a\x00\x00\xce\x1a"
+            "\x00\x00\xd8\x1a\x00\x00\xe8\x1a\x00\x00\xef\x1a\x00\x00\xf6\x1a\x00\x00\xfd\x1a\x00\x00\x07\x1b\x00\x00\x14\x1b\x00\x00\x21\x1b"
+            "\x00\x00\x2b\x1b\x00\x00\x38\x1b\x00\x00\x42\x1b\x00\x00\x4c\x1b\x00\x00\x59\x1b\x00\x00\x63\x1b\x00\x00\x70\x1b\x00\x00\x7a\x1b"
+            "\x00\x00\x81\x1b\x00\x00\x8b\x1b\x00\x00\x92\x1b\x00\x00\x9c\x1b\x00\x00\xac\x1b\x00\x00\xb6\x1b\x00\x00\xc6\x1b\x00\x00\xd3\x1b"
+            "\x00\x00\xe0\x1b\x00\x00\xed\x1b\x00\x00\xfa\x1b\x00\x00\x04\x1c\x00\x00\x0e\x1c\x00\x00\x18\x1c\x00\x00\x25\x1c\x00\x00\x2f\x1c"
+            "\x00\x00\x3c\x1c\x00\x00\x49\x1c\x00\x00\x56\x1c\x00\x00\x63\x1c\x00\x00\x6d\x1c\x00\x00\x77\x1c\x00\x00\x81\x1c\x00\x00\x8e\x1c"
+            "\x00\x00\x98\x1c\x00\x00\xa5\x1c\x00\x00\xb2\x1c\x00\x00\xbc\x1c\x00\x00\xc6\x1c\x00\x00\xd3\x1c\x00\x00\xe0\x1c\x00\x00\xea\x1c"
+            "\x00\x00\xf4\x1c\x00\x00\xfe\x1c\x00\x00\x08\x1d\x00\x00\x18\x1d\x00\x00\x25\x1d\x00\x00\x2f\x1d\x00\x00\x3c\x1d\x00\x00\x49\x1d"
+            "\x00\x00\x56\x1d\x00\x00\x63\x1d\x00\x00\x6d\x1d\x00\x00\x7a\x1d\x00\x00\x81\x1d\x00\x00\x8e\x1d\x00\x00\x98\x1d\x00\x00\xa2\x1d"
+            "\x00\x00\xac\x1d\x00\x00\xb6\x1d\x00\x00\xc0\x1d\x00\x00\xcd\x1d\x00\x00\xda\x1d\x00\x00\xe7\x1d\x00\x00\xf7\x1d\x00\x00\x01\x1e"
+            "\x00\x00\x0b\x1e\x00\x00\x18\x1e\x00\x00\x25\x1e\x00\x00\x2f\x1e\x00\x00\x39\x1e\x00\x00\x43\x1e\x00\x00\x4d\x1e\x00\x00\x5a\x1e"
+            "\x00\x00\x64\x1e\x00\x00\x6e\x1e\x00\x00\x78\x1e\x00\x00\x82\x1e\x00\x00\x89\x1e\x00\x00\x93\x1e\x00\x00\x9d\x1e\x00\x00\xaa\x1e"
+            "\x00\x00\xb7\x1e\x00\x00\xc7\x1e\x00\x00\xd1\x1e\x00\x00\xdb\x1e\x00\x00\xe8\x1e\x00\x00\xf8\x1e\x00\x00\x02\x1f\x00\x00\x0c\x1f"
+            "\x00\x00\x19\x1f\x00\x00\x26\x1f\x00\x00\x30\x1f\x00\x00\x3d\x1f\x00\x00\x47\x1f\x00\x00\x57\x1f\x00\x00\x61\x1f\x00\x00\x6b\x1f"
+            "\x00\x00\x75\x1f\x00\x00\x82\x1f\x00\x00\x8f\x1f\x00\x00\x9c\x1f\x00\x00\xac\x1f\x00\x00\xb9\x1f\x00\x00\xc6\x1f\x00\x00\xd3\x1f"
+            "\x00\x00\xe0\x1f\x00\x00\xed\x1f\x00\x00\xf7\x1f\x00\x00\x07\x20\x00\x00\x14\x20\x00\x00\x21\x20\x00\x00\x2c\x20\x00\x00\x39\x20"
+            "\x00\x00\x46\x20\x00\x00\x56\x20\x00\x00\x60\x20\x00\x00\x6a\x20\x00\x00\x74\x20\x00\x00\x81\x20\x00\x00\x8b\x20\x00\x00\x98\x20"
+            "\x00\x00\xa2\x20\x00\x00\xac\x20\x00\x00\xbc\x20\x00\x00\xc9\x20\x00\x00\xd9\x20\x00\x00\xe3\x20\x00\x00\xed\x20\x00\x00\xfa\x20"
+            "\x00\x00\x04\x21\x00\x00\x14\x21\x00\x00\x21\x21\x00\x00\x2e\x21\x00\x00\x35\x21\x00\x00\x3f\x21\x00\x00\x49\x21\x00\x00\x53\x21"
+            "\x00\x00\x5d\x21\x00\x00\x67\x21\x00\x00\x74\x21\x00\x00\x7e\x21\x00\x00\x88\x21\x00\x00\x92\x21\x00\x00\x9c\x21\x00\x00\xa9\x21"
+            "\x00\x00\xb3\x21\x00\x00\xbd\x21\x00\x00\xcd\x21\x00\x00\xd7\x21\x00\x00\xe1\x21\x00\x00\xeb\x21\x00\x00\xf5\x21\x00\x00\xff\x21"
+            "\x00\x00\x09\x22\x00\x00\x10\x22\x00\x00\x1a\x22\x00\x00\x24\x22\x00\x00\x2e\x22\x00\x00\x3b\x22\x00\x00\x45\x22\x00\x00\x55\x22"
+            "\x00\x00\x5c\x22\x00\x00\x66\x22\x00\x00\x76\x22\x00\x00\x83\x22\x00\x00\x8d\x22\x00\x00\x97\x22\x00\x00\xa1\x22\x00\x00\xab\x22"
+            "\x00\x00\xb5\x22\x00\x00\xbf\x22\x00\x00\xc9\x22\x00\x00\xd3\x22\x00\x00\xdd\x22\x00\x00\xe7\x22\x00\x00\xf1\x22\x00\x00\xfb\x22"
+            "\x00\x00\x05\x23\x00\x00\x0f\x23\x00\x00\x19\x23\x00\x00\x23\x23\x00\x00\x2a\x23\x00\x00\x34\x23\x00\x00\x3e\x23\x00\x00\x45\x23"
+            "\x00\x00\x4f\x23\x00\x00\x5c\x23\x00\x00\x69\x23\x00\x00\x73\x23\x00\x00\x7d\x23\x00\x00\x8a\x23\x00\x00\x94\x23\x00\x00\xa1\x23"
+            "\x00\x00\xae\x23\x00\x00\xb8\x23\x00\x00\xc5\x23\x00\x00\xcf\x23\x00\x00\xdc\x23\x00\x00\xe6\x23\x00\x00\xf3\x23\x00\x00\x00\x24"
+            "\x00\x00\x0d\x24\x00\x00\x17\x24\x00\x00\x1e\x24\x00\x00\x2b\x24\x00\x00\x35\x24\x00\x00\x42\x24\x00\x00\x4c\x24\x00\x00\x59\x24"
+            "\x00\x00\x63\x24\x00\x00\x70\x24\x00\x00\x7a\x24\x00\x00\x87\x24\x00\x00\x97\x24\x00\x00\xa1\x24\x00\x00\xa8\x24\x00\x00\xb5\x24"
+            "\x00\x00\xc2\x24\x00\x00\xcc\x24\x00\x00\xd9\x24\x00\x00\xe6\x24\x00\x00\xf3\x24\x00\x00\xfd\x24\x00\x00\x0a\x25\x00\x00\x14\x25"
+            "\x00\x00\x1e\x25\x00\x00\x2b\x25\x00\x00\x38\x25\x00\x00\x42\x25\x00\x00\x4c\x25\x00\x00\x56\x25\x00\x00\x60\x25\x00\x00\x6a\x25"
+            "\x00\x00\x74\x25\x00\x00\x7e\x25\x00\x00\x88\x25\x00\x00\x92\x25\x00\x00\x9f\x25\x00\x00\xaf\x25\x00\x00\xb9\x25\x00\x00\xc3\x25"
+            "\x00\x00\xd0\x25\x00\x00\xda\x25\x00\x00\xe1\x25\x00\x00\xeb\x25\x00\x00\xf5\x25\x00\x00\xff\x25\x00\x00\x09\x26\x00\x00\x13\x26"
+            "\x00\x00\x23\x26\x00\x00\x2d\x26\x00\x00\x37\x26\x00\x00\x44\x26\x00\x00\x4e\x26\x00\x00\x5b\x26\x00\x00\x62\x26\x00\x00\x6c\x26"
+            "\x00\x00\x76\x26\x00\x00\x80\x26\x00\x00\x8a\x26\x00\x00\x94\x26\x00\x00\x9e\x26\x00\x00\xa8\x26\x00\x00\xb2\x26\x00\x00\xbf\x26"
+            "\x00\x00\xc6\x26\x00\x00\xd0\x26\x00\x00\xdd\x26\x00\x00\xe7\x26\x00\x00\xf4\x26\x00\x00\xfe\x26\x00\x00\x08\x27\x00\x00\x15\x27"
+            "\x00\x00\x22\x27\x00\x00\x2f\x27\x00\x00\x3c\x27\x00\x00\x49\x27\x00\x00\x56\x27\x00\x00\x63\x27\x00\x00\x70\x27\x00\x00\x7d\x27"
+            "\x00\x00\x8a\x27\x00\x00\x97\x27\x00\x00\xa1\x27\x00\x00\xae\x27\x00\x00\xbb\x27\x00\x00\xcb\x27\x00\x00\xd8\x27\x00\x00\xe5\x27"
+            "\x00\x00\xf2\x27\x00\x00\xfc\x27\x00\x00\x06\x28\x00\x00\x10\x28\x00\x00\x1d\x28\x00\x00\x2a\x28\x00\x00\x37\x28\x00\x00\x41\x28"
+            "\x00\x00\x4b\x28\x00\x00\x58\x28\x00\x00\x65\x28\x00\x00\x72\x28\x00\x00\x7f\x28\x00\x00\x8c\x28\x00\x00\x96\x28\x00\x00\xa0\x28"
+            "\x00\x00\xad\x28\x00\x00\xba\x28\x00\x00\xc7\x28\x00\x00\xd4\x28\x00\x00\xde\x28\x00\x00\xe8\x28\x00\x00\xef\x28\x00\x00\xf9\x28"
+            "\x00\x00\x06\x29\x00\x00\x10\x29\x00\x00\x1d\x29\x00\x00\x27\x29\x00\x00\x31\x29\x00\x00\x3e\x29\x00\x00\x45\x29\x00\x00\x55\x29"
+            "\x00\x00\x62\x29\x00\x00\x6c\x29\x00\x00\x79\x29\x00\x00\x89\x29\x00\x00\x96\x29\x00\x00\xa6\x29\x00\x00\xb0\x29\x00\x00\xba\x29"
+            "\x00\x00\xc4\x29\x00\x00\xd1\x29\x00\x00\xe1\x29\x00\x00\xf4\x29\x00\x00\x01\x2a\x00\x00\x0e\x2a\x00\x00\x1b\x2a\x00\x00\x2b\x2a"
+            "\x00\x00\x35\x2a\x00\x00\x3f\x2a\x00\x00\x49\x2a\x00\x00\x53\x2a\x00\x00\x60\x2a\x00\x00\x6d\x2a\x00\x00\x7a\x2a\x00\x00\x84\x2a"
+            "\x00\x00\x8e\x2a\x00\x00\x98\x2a\x00\x00\xa2\x2a\x00\x00\xac\x2a\x00\x00\xb6\x2a\x00\x00\xc6\x2a\x00\x00\xcd\x2a\x00\x00\xd4\x2a"
+            "\x00\x00\xe4\x2a\x00\x00\xf1\x2a\x00\x00\xfe\x2a\x00\x00\x08\x2b\x00\x00\x0f\x2b\x00\x00\x1c\x2b\x00\x00\x29\x2b\x00\x00\x39\x2b"
+            "\x00\x00\x49\x2b\x00\x00\x53\x2b\x00\x00\x60\x2b\x00\x00\x6a\x2b\x00\x00\x74\x2b\x00\x00\x7e\x2b\x00\x00\x8b\x2b\x00\x00\x98\x2b"
+            "\x00\x00\xa2\x2b\x00\x00\xaf\x2b\x00\x00\xb9\x2b\x00\x00\xc6\x2b\x00\x00\xd3\x2b\x00\x00\xe0\x2b\x00\x00\xed\x2b\x00\x00\xfa\x2b"
+            "\x00\x00\x07\x2c\x00\x00\x11\x2c\x00\x00\x1b\x2c\x00\x00\x25\x2c\x00\x00\x2f\x2c\x00\x00\x3c\x2c\x00\x00\x46\x2c\x00\x00\x53\x2c"
+            "\x00\x00\x63\x2c\x00\x00\x70\x2c\x00\x00\x7a\x2c\x00\x00\x84\x2c\x00\x00\x94\x2c\x00\x00\x9e\x2c\x00\x00\xab\x2c\x00\x00\xb5\x2c"
+            "\x00\x00\xc2\x2c\x00\x00\xcc\x2c\x00\x00\xd6\x2c\x00\x00\xe0\x2c\x00\x00\xea\x2c\x00\x00\xf4\x2c\x00\x00\x01\x2d\x00\x00\x0b\x2d"
+            "\x00\x00\x15\x2d\x00\x00\x22\x2d\x00\x00\x2f\x2d\x00\x00\x39\x2d\x00\x00\x46\x2d\x00\x00\x50\x2d\x00\x00\x60\x2d\x00\x00\x6a\x2d"
+            "\x00\x00\x75\x2d\x00\x00\x7f\x2d\x00\x00\x89\x2d\x00\x00\x93\x2d\x00\x00\xa0\x2d\x00\x00\xb0\x2d\x00\x00\xba\x2d\x00\x00\xc4\x2d"
+            "\x00\x00\xce\x2d\x00\x00\xd8\x2d\x00\x00\xe2\x2d\x00\x00\xef\x2d\x00\x00\xff\x2d\x00\x00\x0f\x2e\x00\x00\x1f\x2e\x00\x00\x2f\x2e"
+            "\x00\x00\x3f\x2e\x00\x00\x4c\x2e\x00\x00\x59\x2e\x00\x00\x66\x2e\x00\x00\x73\x2e\x00\x00\x7d\x2e\x00\x00\x87\x2e\x00\x00\x94\x2e"
+            "\x00\x00\x9e\x2e\x00\x00\xab\x2e\x00\x00\xb8\x2e\x00\x00\xc2\x2e\x00\x00\xd2\x2e\x00\x00\xdf\x2e\x00\x00\xe9\x2e\x00\x00\xf3\x2e"
+            "\x00\x00\xfd\x2e\x00\x00\x0a\x2f\x00\x00\x14\x2f\x00\x00\x21\x2f\x00\x00\xec\x9d\xb4\xec\x83\x81\xed\x95\xb4\xec\x94\xa8\x0d\x00"
+            "\x36\xed\x92\x80\x0d\x00\xf4\x08\xea\xbd\x83\x00\xed\x8c\x8c\xec\x9d\xb4\xeb\xa6\xac\x00\xeb\xa6\xac\xec\x9e\x90\xeb\x93\x9c\x0a"
+            "\x00\xf3\x04\xaa\xbd\x00\xea\xbc\xac\xeb\xb6\x80\xea\xb8\xb0\x00\xec\x96\xb4\xeb\x8b\x88\x0d\x00\xf0\x0b\xea\xb1\xb0\xeb\xb6\x81"
+            "\xec\x99\x95\x00\xec\xba\x90\xed\x84\xb0\xed\x94\xbc\x00\xeb\x8b\xa8\xeb\x8d\xb0\x1e\x00\x31\xeb\xb2\x84\x14\x00\xf4\x00\x8c\x00"
+            "\xeb\xbf\x94\xec\xb6\xa9\xec\x9d\xb4\x00\xeb\x94\xb1\x0a\x00\xf3\x07\x8f\x85\xec\xb9\xa8\xeb\xb6\x95\x00\xea\xb5\xac\xea\xb5\xac"
+            "\x00\xed\x94\xbc\xec\xa3\xa4\x07\x00\x31\xed\x88\xac\x75\x00\xf3\x07\xa0\x9b\x00\xeb\xa0\x88\xed\x8a\xb8\xeb\x9d\xbc\x00\xea\xb9"
+            "\xa8\xeb\xb9\x84\xec\xb0\xb8\x0a\x00\xf3\x01\xeb\x93\x9c\xeb\xa6\xb4\xec\xa1\xb0\x00\xec\x95\x84\xeb\xb3\xb4\x07\x00\x22\xed\x81"
+            "\x4d\x00\x90\xb9\xb4\xec\xb8\x84\x00\xeb\x9d\xbc\xe9\x00\x00\x0a\x00\xf0\x00\xaa\xa8\xeb\x9e\x98\xeb\x91\x90\xec\xa7\x80\x00\xea"
+            "\xb3\xa0\x07\x00\x00\xcc\x00\x75\x93\x9c\xeb\x9f\xb0\xe2\x99\x0d\x00\x53\xa6\xac\xeb\x82\x98\x0d\x00\x38\xed\x80\xb8\x24\x00\x17"
+            "\x82\x24\x00\x14\x85\x1a\x00\xf3\x16\xed\x82\xb9\x00\xec\x82\x90\xec\x82\x90\x00\xed\x94\xbd\xec\x8b\x9c\x00\xec\x8b\x9d\xec\x8a"
+            "\xa4\xed\x85\x8c\xec\x9d\xbc\x00\xeb\x82\x98\xec\x9d\xb8\x0d\x00\x60\xed\x91\xb8\xeb\xa6\xb0\x07\x00\x30\xed\x81\xac\x0a\x00\xa0"
+            "\xec\xa3\xbc\xeb\xb1\x83\x00\xea\xb3\xa8\x07\x00\xf0\x04\xeb\x9a\x9c\xeb\xb2\x85\xec\xb5\xb8\x00\xeb\x83\x84\xec\x83\x88\xea\xbc"
+            "\xac\xc1\x00\xc0\xed\x94\x8c\xeb\xa0\x88\xec\x8b\x9c\xec\x95\x84\xaa\x01\x00\xd4\x00\x24\x8a\xa4\x0a\x00\xf1\x04\x84\xb9\xed\x8a"
+            "\xb8\x00\xec\xbd\x98\xed\x8c\xa1\x00\xeb\x8f\x84\xeb\x82\x98\xc8\x01\xc0\x94\x94\xea\xb7\xb8\xeb\x8b\xa4\x00\xeb\x8b\xa5\x42\x01"
+            "\x51\xa6\xac\xec\x98\xa4\x8f\x00\x90\x98\xb9\x00\xed\x8e\x98\xeb\xa5\xb4\x53\x00\x20\x98\xa8\x0d\x01\x00\x66\x00\x51\x8c\x8c\xeb"
+            "\x8d\x95\x8b\x00\xf0\x0f\x8d\x95\x00\xeb\xa7\x9d\xed\x82\xa4\x00\xec\x84\xb1\xec\x9b\x90\xec\x88\xad\x00\xea\xb0\x80\xeb\x94\x94"
+            "\x00\xec\x9c\x88\x07\x00\x60\xeb\xb0\x9c\xec\xb1\x99\xc9\x01\x63\xec\x8a\x88\xeb\xa5\x99\x0d\x00\x34\xea\xb0\x95\x17\x00\x20\xba"
+            "\x90\x78\x01\x00\x0e\x01\x50\x9c\xa4\xea\xb2\x94\xc1\x01\xf1\x08\xed\x9b\x84\xeb\x94\x98\x00\xec\x95\x8c\xed\x86\xb5\xeb\xaa\xac"
+            "\x00\xea\xb7\xbc\xec\x9c\xa1\x0a\x00\x50\xb4\xb4\xeb\xa0\xa5\x0a\x00\x00\xa7\x01\x20\x8b\xa4\x4b\x02\x94\xec\x9a\xb0\xec\xb8\xa0"
+            "\xeb\x8f\x99\x0a\x00\x21\xb3\xb4\xea\x00\x71\x99\x95\xeb\x88\x88\xed\x95\x44\x02\x00\xb5\x00\x12\xa6\x2c\x02\x60\xa7\x88\xeb\x8f"
+            "\x8c\x00\x7d\x02\x22\xb5\xac\x01\x01\x13\xb1\x0a\x00\xf3\x0a\xed\x8f\xac\xeb\x8b\x88\xed\x83\x80\x00\xeb\x82\xa0\xec\x8c\xa9\xeb"
+            "\xa7\x88\x00\xec\x95\xbc\xeb\x8f\x07\x00\x81\x84\xeb\x9e\x80\x00\xec\xbd\x94\xaf\x01\x53\xa0\x88\xec\x96\xb4\x0d\x00\x00\x16\x03"
+            "\x21\x98\xa4\x4d\x00\x50\x91\x90\xeb\x91\x90\x07\x00\x06\x4b\x01\x60\xec\xa5\xac\xec\xa5\xac\x07\x00\xd1\xeb\xa0\x88\xea\xb3\xa4"
+            "\x00\xec\xa7\x88\xed\x8d\xbd\xfe\x00\x51\xa7\x88\xeb\xbb\x90\x31\x03\x51\x85\x80\xeb\x9f\xac\xac\x01\x42\xa5\xb4\xec\x85\x7a\x02"
+            "\x20\x98\xa4\xc0\x01\x00\x0a\x00\x20\x9a\xb0\x2a\x02\xd0\x8a\xb8\x00\xed\x8c\xac\xed\x85\x80\x00\xeb\xa1\xb1\x11\x00\x50\x86\xa4"
+            "\x00\xec\x8a\xbc\x00\x34\xed\x94\x84\x0a\x00\x30\x8d\xbc\x00\x35\x02\x63\x9e\xa9\x00\xed\x82\xb9\x0a\x00\x20\xec\xb0\xff\x00\xd1"
+            "\xeb\xa6\xac\xea\xb3\xb5\x00\xeb\xb6\x90\xeb\xb3\xbc\x06\x03\x21\x9d\xbc\xb5\x00\x20\x82\x98\x81\x01\x34\xed\x83\x95\x09\x01\x23"
+            "\x85\x85\x0a\x00\x30\xec\x8b\x9c\x3c\x02\x20\x86\x8c\x73\x01\x61\xed\x99\x8d\xec\x88\x98\x7d\x01\xf0\x00\x82\xb4\xeb\xa3\xa8\xeb"
+            "\xaf\xb8\x00\xeb\x98\x90\xea\xb0\x80\xa7\x00\x64\xeb\x98\x90\xeb\x8f\x84\x0d\x00\x50\xbf\x94\xec\xb9\xb4\xfd\x02\x51\xec\xbd\x94"
+            "\xeb\xbf\x7d\x01\x30\xeb\x9f\xad\x2b\x02\x61\xeb\x8d\xa9\xec\xbf\xa0\x5d\x00\x90\xba\xa5\xec\xb9\xb4\x00\xec\x8f\x98\x2c\x03\x21"
+            "\x9d\xbc\x6e\x00\x03\x0a\x00\x50\xbd\x98\xec\xb9\x98\xc4\x01\x03\x0a\x00\x21\xeb\xb3\x5b\x00\x12\x82\x96\x00\x50\x95\x84\xec\xbf"
+            "\xa0\x01\x01\x00\xac\x01\xc0\xa7\x88\xec\x9e\x84\xeb\xa7\xa8\x00\xec\x8a\xa4\xa0\x02\x60\x81\xac\x00\xeb\xa3\xa8\x32\x03\x00\x49"
+            "\x00\x80\x97\x90\xeb\xa0\x88\xeb\xb8\x8c\x28\x00\x00\xe9\x02\x00\xd4\x01\x50\x81\x98\xec\x82\xac\x77\x02\xc0\xa0\x80\x00\xec\xbc"
+            "\x84\xed\x83\x80\xeb\xa1\x9c\xb7\x00\x60\xec\x9e\x89\xec\x96\xb4\xaa\x03\x20\xea\xb0\x4c\x04\x31\xeb\x8f\x84\xce\x00\x00\x5c\x03"
+            "\x00\x2e\x01\x01\x0d\x00\x20\xa9\x94\x31\x00\x20\xaa\xbd\x1a\x05\x20\xeb\xb8\x10\x05\x70\x00\xec\x83\xa4\xeb\xaf\xb8\x0d\x05\x30"
+            "\xec\xa5\xac\x55\x04\x80\x8d\xac\xeb\x8d\x94\x00\xeb\xb6\x0d\x01\x60\xed\x84\xb0\x00\xed\x8f\x35\x05\x01\xfd\x01\x21\x95\x94\xeb"
+            "\x03\x02\xa4\x02\x23\x95\x94\xc6\x00\x22\xed\x88\xde\x04\x01\x07\x00\x31\xed\x91\xb8\xb9\x03\x40\x94\x84\xed\x85\xbc\x03\x70\x00"
+            "\xec\x9e\xa0\xeb\xa7\x8c\xbc\x04\x00\x88\x00\x63\xa6\xac\xec\xa0\xb8\x00\x64\x00\x02\x92\x05\x40\xec\x96\xb4\x00\x82\x00\x60\x87"
+            "\xbd\x00\xec\x8b\xa0\x07\x00\x30\xeb\xa7\x9d\xe2\x03\x00\x0a\x00\x50\xae\xa4\xec\xb8\xa0\x07\x00\x40\x00\xec\xb9\x98\x90\x01\x21"
+            "\xa6\xac\x39\x01\x22\xb2\xa0\xcc\x05\x00\x3d\x02\x30\xeb\xa9\x94\xba\x03\x60\x8b\x88\xec\x9b\x80\x00\xd6\x00\x53\xbc\x80\xec\x9d"
+            "\xb8\x35\x01\x04\x0d\x00\x20\xb8\x94\xf7\x02\x51\x9d\xb4\xeb\xb2\x94\xf6\x05\x80\x95\x84\xec\xbd\x94\x00\xec\x97\x49\x04\x22\xea"
+            "\xb2\x0a\x01\x20\x9e\xa5\x74\x02\x50\xa1\x9c\xeb\x8b\xa4\x1b\x03\x00\x72\x03\x92\xa6\xac\xec\x84\xa0\x00\xeb\x8b\xa4\x0d\x00\x01"
+            "\x17\x01\x51\x9a\xb0\xeb\xb6\x80\x57\x03\x50\xb6\x80\xec\x97\x89\x50\x03\x63\xeb\x94\x94\xeb\xb0\x94\x0a\x00\x30\xec\x95\x88\x7d"
+            "\x04\x50\xec\x9d\xb4\xea\xb2\x28\x00\x01\xf6\x00\x23\x95\x84\x91\x01\x03\x63\x00\x91\xb1\x83\x00\xec\xb4\x88\xeb\x9d\xbc\x48\x06"
+            "\x40\x9e\x9c\xed\x84\x21\x01\x10\xbc\xc6\x05\x01\x67\x05\x24\x91\xb8\x49\x05\x50\x86\xa0\xea\xb2\x8c\x2d\x04\x03\x0a\x00\x60\x8b"
+            "\xb1\x00\xeb\x84\xa4\x86\x01\x26\x8b\xb0\x0a\x00\x01\xf9\x04\x11\xa9\x20\x01\x00\x13\x01\xf1\x00\xb3\xb4\xec\x86\xa1\xec\x86\xa1"
+            "\x00\xec\xa0\x84\xeb\xa3\xa1\x86\x00\x10\xa5\xf4\x03\x00\x17\x01\x33\xeb\xa6\xb4\x07\x00\x03\x59\x04\x60\xec\xa7\x80\xeb\xaa\xa8"
+            "\xb3\x02\x04\x46\x03\x51\x86\xb5\xed\x86\xb5\x2f\x00\x21\x91\x90\x29\x01\x20\x86\x9c\x03\x00\x01\x33\x01\x00\xf6\x04\xa0\xed\x8c"
+            "\x9c\x00\xed\x95\xb4\xeb\x84\x88\xa0\x01\x00\x0a\x00\x02\x54\x03\x00\xf6\x02\x21\x9e\x90\xe9\x02\x91\x9a\xb0\xed\x8c\x8c\x00\xeb"
+            "\x88\x84\x49\x04\x23\x97\x90\x70\x02\x00\x8a\x01\x21\x9e\x98\x4e\x03\x20\x8b\x88\xbc\x02\x10\x9a\xdd\x06\x00\xaf\x02\x00\xbc\x02"
+            "\x30\xeb\xac\xb4\x60\x01\x01\xbe\x04\x42\x88\xeb\x86\x8d\x23\x03\x30\x90\xec\x9a\x13\x04\x40\xa4\xeb\xa7\x81\x39\x00\x00\x28\x01"
+            "\x20\xbd\x98\x7d\x03\x00\x07\x00\x30\xeb\x85\xb8\x67\x04\x62\xb9\x98\x00\xea\xb8\x80\x0c\x07\x31\xea\xb1\xb0\xa8\x05\x20\xb2\xa0"
+            "\x67\x04\x00\x72\x00\x30\xa3\xa8\x00\x42\x03\x23\x9e\x91\x0d\x00\x00\x99\x07\x11\xb0\x0a\x00\x52\xed\x95\xab\xec\x82\xd5\x07\x20"
+            "\x8b\xa8\x31\x07\x23\xed\x97\x8b\x03\x03\x59\x03\x20\xed\x8f\xd5\x02\xf2\x02\xeb\x8b\x88\x00\xea\xb9\x9c\xec\xa7\x80\xea\xb3\xb0"
+            "\x00\xeb\xa7\x81\x07\x00\x03\x98\x03\x25\xea\xb7\x70\x02\xe0\xb9\xb4\xeb\xa5\xb4\xea\xb3\xa0\x00\xea\xbe\xb8\xea\xbe\x49\x05\x01"
+            "\xa1\x02\x02\x0a\x00\x00\x75\x05\x91\x82\xb0\xed\x98\xb8\x00\xec\xb4\x9d\xf9\x02\x20\x8c\x80\xbb\x05\x11\xac\x70\x04\x21\xeb\x94"
+            "\x77\x07\x10\xb2\xf7\x07\x62\x00\xeb\xa7\x8c\xed\x83\xbc\x02\x50\xac\xb4\xec\x9e\xa5\x05\x08\xd0\xeb\x8d\xb8\xeb\xb9\x8c\x00\xed"
+            "\x97\xac\xea\xb0\x80\x24\x05\x05\x73\x04\x12\x94\x1c\x03\x01\xb3\x04\x56\xa6\xac\xea\xb0\x91\xb7\x03\x10\x32\x22\x01\x00\xd2\x00"
+            "\x00\x73\x01\xf1\x00\xa3\xa8\xeb\xb8\x8c\xeb\x8f\x84\x00\xeb\xb0\xb0\xeb\xa3\xa8\x00\x07\x50\xb9\xb4\xed\x8f\xac\xa1\x01\x00\x1c"
+            "\x06\x20\xbd\x80\x03\x00\x05\x7e\x04\x00\x75\x01\x01\x8d\x00\x01\xe9\x00\x10\xb9\x38\x00\x41\x80\xed\x83\xb1\x81\x08\x50\x95\xb4"
+            "\xed\x94\xbc\x02\x02\x02\x67\x04\x00\xcb\x03\x00\x20\x02\x12\x95\x17\x08\x00\x37\x07\x00\x9c\x02\x20\xec\xbf\x39\x04\x10\xa0\xd6"
+            "\x00\x03\x85\x04\x01\x3c\x09\x04\x0d\x00\x27\xa7\x88\x0d\x00\x50\xa3\xa8\xea\xb8\xb0\x02\x08\x61\xec\xb9\xa0\xec\x83\x89\xf8\x08"
+            "\x20\x84\xb8\x56\x03\x00\x7a\x00\x20\x82\x98\x0a\x01\x11\xa7\x98\x09\x02\x0d\x00\x22\xeb\x8f\x53\x02\x01\x0d\x00\x01\xa5\x08\x51"
+            "\x95\x84\xec\xb0\xa8\xcc\x02\x22\x98\x81\x32\x04\x44\x00\xeb\xb2\x88\x0a\x00\x51\xac\xbc\xec\xa7\xb1\x32\x00\x24\x8a\xaa\x0a\x00"
+            "\x23\x8c\x80\x0a\x00\x00\x05\x01\x20\xb1\xa0\x19\x09\x00\xeb\x00\x20\x9d\xbc\x01\x01\x30\x82\x98\x00\x71\x00\x54\xb7\xb8\xec\xa0"
+            "\x9c\x57\x06\x23\xa7\x81\x0a\x00\x30\xea\xb0\x9c\x91\x00\x60\x86\x8c\x00\xec\x8b\xa4\xe7\x00\x50\xeb\xb7\xb0\xed\x8b\x0f\x0a\x02"
+            "\x0e\x01\x00\x5a\x01\x00\x04\x01\x00\x1a\x00\x21\x8f\x85\x89\x04\x00\x57\x01\x41\xb0\xea\xbd\x83\x89\x06\x40\xa1\x9c\xed\x86\x0a"
+            "\x06\x01\x0a\x00\x21\x8c\x8c\x2e\x03\xf1\x00\x8f\x84\xed\x86\xa0\xeb\xa7\x81\x00\xec\x9e\x8e\xec\x83\x88\xb6\x00\x40\x8b\xa4\xed"
+            "\x83\xe8\x07\x12\x00\x62\x09\x31\xeb\xa1\x9c\x5b\x01\x10\x99\x3e\x03\x40\x00\xea\xb0\x88\x4f\x08\x10\xa7\x2c\x09\x13\xa8\x44\x07"
+            "\x20\xeb\x9e\x46\x00\x01\xbc\x02\x01\x75\x06\x00\x52\x01\x02\xdc\x08\x00\x9b\x04\x90\xeb\xb9\x84\xea\xb5\xac\xec\x88\xa0\x0a\x00"
+            "\x00\x3b\x01\x20\xb0\xa9\xc9\x0a\x31\xec\x84\xaf\x8c\x09\x01\x0a\x00\x00\x42\x01\x01\x16\x05\x10\x84\x64\x00\x30\xeb\xb0\x9c\x2d"
+            "\x03\x00\x6e\x00\x01\x14\x00\x00\x6a\x01\x00\x61\x00\x20\xa4\x91\xc8\x00\x00\x74\x01\x10\x9d\xe9\x00\x00\x15\x02\x30\xea\xbb\x8d"
+            "\x19\x08\x00\x17\x00\x50\x86\x8c\xea\xb3\xa4\x7c\x04\x01\xa1\x03\x10\xb5\x0a\x00\x61\xed\x8f\xad\xec\x9d\x8c\x14\x00\xb0\xa7\x88"
+            "\xed\x81\xac\xed\x83\x95\x00\xed\x95\x83\x05\x31\xeb\xad\x89\x9d\x02\x01\xea\x07\x03\xd0\x02\x00\x1f\x06\x00\xd9\x06\x01\x88\x01"
+            "\x01\x02\x02\x10\x8d\xcf\x05\x00\xf7\x04\x61\xea\xb9\x9c\xea\xb9\x8c\x71\x04\x50\x9e\x85\xec\xb9\x98\x91\x06\x00\xe2\x00\x12\xb3"
+            "\xd2\x04\x20\xb0\xb1\xf2\x08\x00\xcf\x02\x10\xb3\x99\x00\x00\x70\x05\x00\x7b\x01\x11\x9a\x28\x06\x25\x9e\x91\x0a\x00\x13\xa8\x8a"
+            "\x06\x04\xb0\x01\x02\x0d\x00\x21\xb3\xbc\xae\x08\x50\x94\x8c\xeb\x9f\xac\x5d\x08\x00\x83\x04\x21\x9d\xb4\x8d\x04\x50\xb3\xbc\xeb"
+            "\xb9\x84\x1e\x00\x00\x78\x05\x24\x98\xa4\x0d\x00\x40\xa1\x9c\xec\xa0\x44\x09\x01\x69\x01\x51\xbc\xb4\xea\xb9\x8d\xf1\x09\x51\xbf"
+            "\x80\xea\xba\xbd\x0c\x01\x20\x83\xa4\xfd\x06\x21\x8b\x88\xdc\x02\x10\x83\x2a\x01\x03\x0d\x00\x00\x98\x0a\x22\x9e\x98\x36\x05\x06"
+            "\x0d\x00\x30\x00\xeb\x91\xa9\x07\x00\x30\x01\x00\x07\x00\x00\x0c\x01\x10\x84\x46\x09\x00\xfa\x04\x01\x8d\x02\x10\x90\xe5\x05\x02"
+            "\x0d\x00\x01\xf7\x02\x22\x96\xbc\x3c\x03\x41\x00\xed\x86\xb1\x73\x08\x20\xb9\x84\xe8\x03\x20\x9d\xbc\x96\x06\x05\x91\x02\x01\xc4"
+            "\x07\x51\x84\xa0\xec\x9d\xb8\x64\x00\x22\xb0\xa4\x0d\x00\x01\xba\x09\x11\xb9\x10\x07\x05\x0a\x00\x01\x86\x01\x20\x9f\x9d\xc8\x04"
+            "\x00\x82\x03\x21\xb9\x84\x58\x02\x51\xa3\xa8\xeb\x82\x98\xba\x09\x50\x86\x94\xeb\xa1\x9d\xb7\x07\x07\xe3\x04\x20\xb9\x85\x84\x01"
+            "\x50\xec\x9e\xac\xea\xb5\x7f\x05\x00\x0a\x00\x30\xec\x9e\xa5\x0d\x00\x00\x2b\x01\x21\x9a\x9d\x0a\x00\x20\xa0\x90\xe1\x02\x10\x8f"
+            "\x14\x07\x10\x00\x81\x06\x21\xa7\x81\x07\x00\x40\xa6\xac\xec\x9a\x3c\x04\x10\x84\xac\x04\x21\x94\xa5\xf8\x01\x40\x95\x84\xeb\xa7"
+            "\x98\x09\x71\x00\xeb\xb9\x88\xed\x8b\xb0\xb3\x0c\x10\xb0\xef\x08\x00\x03\x07\x00\x7d\x0b\x90\x8a\xa4\xed\x90\x81\x00\xec\xbc\x88"
+            "\x37\x02\x00\x67\x01\x50\x96\xb4\xeb\x91\xa0\xd2\x03\x11\x8b\xb4\x07\x00\x62\x02\x20\x8e\xab\xa9\x04\x00\xf2\x0b\x21\xaa\xbd\x67"
+            "\x08\x20\x9d\xbc\x0a\x00\x00\xe3\x0a\x20\xa1\x9c\x49\x06\x01\x9f\x0a\x00\x5e\x08\x91\xeb\xa0\x81\x00\xec\x95\xb1\xec\x86\x24\x07"
+            "\x00\x90\x01\x20\xeb\x88\x9f\x0c\x01\x8d\x06\x72\x96\xbc\xec\x9d\x8c\xea\xb7\x5a\x00\x50\x8c\x80\xea\xb5\xb4\x4f\x08\x00\xd9\x06"
+            "\x26\x94\xa8\x0a\x00\x00\xf1\x03\x03\x9b\x09\x20\xa7\x84\xc6\x09\x00\x6a\x00\x24\x97\x8c\x27\x0d\x20\xb6\x84\x87\x0a\x21\x9e\xa5"
+            "\x6c\x02\x02\x9e\x0a\x30\xb9\xb8\x00\x19\x0a\x42\x9e\x91\xeb\x8f\x54\x0c\x51\x95\x84\xea\xb3\xb5\x0a\x00\x20\x89\x98\xb0\x01\x00"
+            "\xd3\x02\x21\xa7\x8c\xe4\x0c\x00\xbd\x09\x13\x95\x07\x00\x00\x0f\x04\x02\xce\x09\x00\xad\x04\x02\xa9\x06\x00\x88\x00\x53\xa7\x80"
+            "\xeb\x9d\xbd\x0a\x00\x05\x99\x03\x04\x10\x00\x51\x8a\xa4\xed\x8b\xb8\x12\x0a\x10\x8b\x66\x05\x04\x1f\x0a\x01\x3d\x08\x01\xae\x0b"
+            "\x20\xb0\x80\x31\x00\x20\x98\xa4\x5e\x06\x01\x2f\x07\x10\x80\x41\x0c\x00\x3e\x00\x50\xbf\xa0\xec\x9f\x88\x0c\x05\x01\xb5\x00\x11"
+            "\x98\x8b\x04\x41\x98\xa4\xed\x82\x38\x00\x00\x81\x04\x03\x3c\x0f\x53\x88\x98\xed\x92\x80\x0d\x00\x00\xe9\x01\x14\x8c\x0d\x00\x91"
+            "\xeb\xb6\x88\xea\xbd\x83\xec\x88\xad\x6b\x05\x02\xf9\x09\x02\x0d\x00\x52\xec\xb4\x88\xec\x97\x2b\x01\x23\x8c\xbd\x1a\x02\x60\xed"
+            "\x8c\xbd\xed\x83\x9c\x84\x01\x32\xec\x97\xa0\xc9\x0d\x01\x74\x0a\x10\xb0\x63\x0c\x00\xa7\x04\x02\x0a\x00\x03\x2b\x07\x02\x0d\x00"
+            "\x20\xed\x98\x72\x0e\x01\xfb\x02\x10\xb2\x6c\x03\x03\x0a\x00\xd1\xed\x86\xb5\x00\xea\xb7\x80\xeb\x9a\xa4\xeb\x9a\x9c\xd3\x0f\x01"
+            "\x0d\x00\x31\xed\x86\xa1\xb0\x04\x00\xe0\x01\x11\x81\x38\x00\x21\x9f\xad\x2c\x0e\x00\x2e\x01\x14\x8c\x8f\x0f\x72\xbc\xac\xeb\xaa"
+            "\xbd\xec\x9a\xe3\x03\x23\xa6\x88\x43\x0a\x00\x11\x07\x20\x91\x90\xff\x05\x03\x64\x0b\x42\x9e\xa8\xed\x8e\xb5\x07\x50\xb0\xa9\xed"
+            "\x8c\xa8\x85\x03\x00\x17\x00\x11\xb0\x8f\x09\x03\x0d\x00\x20\x8f\x84\xf9\x0c\x04\x1a\x10\x00\x0d\x00\x00\x83\x09\x12\x8b\xbe\x06"
+            "\x11\xa9\x8c\x0d\x60\xec\x84\xb8\xea\xbf\x80\xbe\x00\x00\x1d\x03\x20\xb9\x84\x9b\x0f\x00\x2b\x01\x10\xb9\x22\x05\x01\x45\x00\x01"
+            "\x43\x09\x20\xec\xa0\x09\x04\x12\x8c\x76\x04\x30\x00\xec\xb2\x3e\x03\x33\xeb\xb2\x84\x0a\x00\x00\x1e\x01\x30\xea\xb9\x9d\x86\x05"
+            "\x21\xac\xb4\xe8\x02\x00\x84\x00\x10\xa0\xc9\x01\x60\xea\xb2\x9f\xed\x95\xb8\x14\x05\xe0\x88\xad\x00\xed\x9d\x94\xeb\x93\xa4\xed"
+            "\x92\x8d\xec\x86\xf5\x0d\x30\xa5\xec\x8b\xf7\x08\x03\xdf\x00\x02\x97\x0b\x35\xeb\xa1\xa4\x0a\x00\x16\xad\x9b\x09\x10\xec\xb4\x03"
+            "\x10\x8f\xc0\x05\x03\xbf\x09\x02\x71\x0f\x00\x28\x03\x51\xeb\xaa\xac\xeb\x83\xe0\x02\x00\xd3\x02\x10\x94\x71\x09\x01\xac\x06\x53"
+            "\xbb\xb9\xeb\xbf\xa1\x0a\x00\x03\x3f\x08\x30\xeb\x8f\x99\x8f\x03\x11\x9f\x0a\x00\x31\xed\x83\x81\x35\x04\x01\x8b\x0a\x01\x85\x09"
+            "\x20\x9d\x89\xa9\x0d\x91\x82\xb4\x00\xed\x95\x91\xeb\xb3\xb5\xce\x0f\xc1\x9d\xbc\xed\x8e\x98\x00\xed\x99\x94\xea\xb0\x95\x09\x0f"
+            "\x50\x94\xa5\xec\x83\x81\x9f\x00\x50\x8f\x99\x00\xed\x95\xa5\x06\x03\x9d\x0c\x30\xed\x95\x9c\x89\x09\x02\xe8\x0b\x00\x39\x01\x20"
+            "\xa8\xb9\x24\x0a\x00\xd4\x03\x01\xd9\x0e\x31\xeb\xa5\xb4\x69\x0d\x02\x24\x00\x60\x98\xa4\x00\xed\x9e\x88\xe8\x09\x10\x8f\x5e\x0c"
+            "\x01\x69\x05\x21\x95\x98\x6e\x0f\x11\x88\xb5\x00\x10\xbd\x2a\x04\x10\x00\x6d\x09\x20\x9e\x98\x34\x04\x20\x98\xa8\xa5\x0b\x06\x7e"
+            "\x0f\x91\xeb\x8f\x85\xea\xb0\x9c\xea\xb5\xb4\x25\x01\x00\x67\x03\x10\x88\x81\x02\x61\xed\x98\x95\xea\xb4\x91\xe7\x09\x02\x2f\x06"
+            "\x01\x60\x01\x01\xa0\x00\x22\x83\x80\xe0\x09\x00\x64\x04\x61\xec\x93\xb0\xea\xb0\x9c\x0a\x00\x20\x84\xa4\x9a\x05\x05\x72\x0a\x02"
+            "\x40\x0d\x10\x90\x9a\x08\x03\xbb\x0f\x00\xbd\x0e\x41\xb8\xeb\xb2\xa8\xf1\x06\x20\xb1\xb0\xec\x04\x06\xa5\x0e\x03\x9e\x0e\x11\xbc"
+            "\x29\x12\x05\xbf\x09\x11\xb8\xd0\x04\x02\xa8\x0a\x34\xeb\xb2\x88\x47\x0c\x03\xbb\x03\x01\x3c\x0d\x03\xb3\x0b\x01\x3d\x0c\x11\xbc"
+            "\x97\x06\x22\xb8\x80\xec\x02\x03\x92\x11\x05\x5a\x0b\x00\xfb\x00\x63\xeb\xa7\x98\xeb\xaa\xa8\xf9\x05\x05\x67\x0a\x11\x5a\x4d\x0d"
+            "\x06\x21\x03\x01\x9a\x00\x04\xc3\x07\x80\x95\xbc\xeb\x8a\x90\xec\x99\x80\xb4\x03\x00\x88\x05\x41\x88\x88\xec\x97\x2e\x07\x02\x05"
+            "\x09\x00\xaa\x02\x51\xec\x9c\xa0\xed\x81\x70\x07\x20\xec\x97\xac\x11\x05\x67\x0e\x10\x84\xbb\x00\x20\x86\x88\xee\x11\x00\x13\x06"
+            "\x21\xa3\xa8\xfc\x0a\x23\x8e\x84\x2b\x0a\x23\xed\x9e\xbc\x12\x03\xe6\x04\x33\xea\xb8\xb0\xc9\x0f\x02\x59\x0a\x03\x3a\x06\x00\xae"
+            "\x02\x20\xa0\x88\xcc\x06\x02\xa7\x07\x01\xc7\x01\x31\xa4\xeb\x84\x83\x0a\x00\xd6\x06\x01\xd9\x13\x01\x9a\x07\x03\x0d\x08\x10\x89"
+            "\xe8\x0c\x01\x63\x08\x02\x3c\x0d\x23\x84\xb8\x2c\x06\x00\x9a\x03\x20\x81\xac\x58\x00\x21\x8b\x88\xde\x12\x20\xa6\xac\x35\x07\x21"
+            "\x96\x80\x4c\x0f\x11\xb9\xe2\x07\x02\x46\x0e\x00\xee\x12\x04\xfa\x0b\x20\xb0\xa8\x59\x05\x30\xbf\x80\x00\xed\x04\x21\xac\xb4\x53"
+            "\x14\x51\x88\x98\xeb\x8c\x95\x6d\x00\x41\x8c\x8d\xea\xb2\x87\x01\x00\xe7\x08\x81\x8c\x80\xea\xb2\x80\xea\xb7\x80\xfd\x05\x53\xa5"
+            "\xb4\xec\xa5\x90\x0a\x00\x00\x67\x0c\x30\xec\x9a\x94\x5a\x0f\x00\x7b\x01\x50\x95\x98\xeb\x8d\xb0\xd0\x00\x00\x62\x02\x40\xb0\x94"
+            "\xeb\x9e\x83\x10\x40\x00\xec\x8c\x94\xfa\x04\x21\x83\xa5\x58\x14\x01\x95\x11\x00\xd1\x0e\x03\x87\x01\x00\xea\x00\x14\x84\x0a\x00"
+            "\x00\x12\x0c\x20\xb0\x94\xc9\x05\x00\x34\x0e\x02\x0a\x00\x00\x12\x0c\x52\x95\x97\xec\xb0\xa8\x28\x00\x01\x0a\x00\x00\x28\x00\x21"
+            "\xaa\xbd\x81\x07\x51\xaa\xbd\xec\x96\x8c\x18\x0b\x51\xbd\xa9\xeb\x91\x98\xf5\x05\x20\x9c\xa0\xc4\x01\x21\xb8\x8c\x91\x10\x11\x98"
+            "\x8f\x06\x00\xd5\x0d\x51\xa4\x84\xeb\xae\xa4\x3e\x07\x22\xa0\x9c\x8e\x08\x00\x41\x02\x20\xb9\xb4\x6c\x0d\x00\x2c\x03\x30\xec\x95"
+            "\x94\x9f\x04\x20\xa5\xb4\xaa\x01\x03\x7c\x06\x12\x96\xb0\x06\x20\x98\x90\xb6\x00\x21\xb0\x95\xfb\x00\x24\xa7\x98\x0a\x00\x20\x91"
+            "\x90\xa0\x09\x10\xa5\x87\x00\x10\xb0\xf5\x01\x00\x0a\x00\x40\x8b\xa4\xeb\xb6\xfd\x0f\xa1\x00\xec\x9c\xbc\xeb\x9e\x8f\xec\xb0\xa8"
+            "\x9c\x0a\x51\x87\xa0\xea\xb3\xa8\xfa\x0c\x50\xb3\xb4\xec\xb2\xad\x65\x04\x03\xb7\x13\x00\xbb\x05\x10\xb9\xe7\x08\x01\x50\x00\x21"
+            "\xb9\x85\xb7\x03\x20\x8d\x98\xdc\x06\x11\xaf\x9a\x03\x31\xea\xb2\xa9\x7d\x01\x11\x91\x85\x00\x11\xb3\x32\x00\x00\x87\x01\x00\xc8"
+            "\x0b\x20\xaa\xa8\x0e\x02\x11\xa8\xee\x0d\x00\xf5\x0f\x61\x84\xa4\x00\xed\x9c\xa0\x9d\x0b\x15\x8e\x01\x12\x10\x86\x9a\x0a\x00\x6b"
+            "\x0b\x61\xec\x97\x98\xed\x92\x8d\x5d\x08\x02\x6c\x0f\x00\x22\x00\x02\x24\x10\x01\xb3\x01\x30\xb0\xec\x93\x9d\x02\x01\x57\x14\x20"
+            "\xb9\x9c\xf3\x13\x10\x81\x50\x0b\x10\x85\xc0\x01\x10\xa5\x21\x01\x00\x0a\x00\x02\x7f\x02\x90\x00\xeb\x8b\xac\xeb\xa7\x89\xed\x99"
+            "\x9b\x11\x00\x10\x0d\x01\x10\x00\x11\x88\x88\x00\x00\x93\x07\x11\xb4\xf7\x09\x40\x8f\x8c\xec\x82\x83\x08\x01\x5c\x01\x11\x8c\x1c"
+            "\x02\x01\x86\x13\x73\xa4\xec\x9c\xa8\xeb\x9e\xad\x0a\x00\x00\x39\x04\x00\x31\x01\x20\x8b\xac\x57\x02\x00\x82\x05\x10\x8d\xd9\x02"
+            "\x00\xdb\x05\x02\xa0\x0d\x00\x0d\x00\x20\x8b\x88\x9d\x08\x00\xb7\x0a\x01\xa3\x03\x00\x75\x03\x30\xeb\x8a\x91\x49\x09\x00\xe3\x00"
+            "\x40\x95\x84\xec\xbc\x1f\x02\x10\x84\xd7\x0c\x03\x3e\x08\x51\xb9\xa8\xeb\xb4\x89\x62\x01\x11\x8d\x1b\x12\x21\x8a\xb8\x28\x02\x20"
+            "\xa1\xb0\x11\x02\x00\xf9\x0a\x04\x0a\x00\x01\xe6\x00\x10\xb9\xd0\x05\x01\x5f\x03\x01\x0a\x00\x00\x06\x00\x21\x85\xb8\x03\x0b\x53"
+            "\x94\x94\xed\x83\xb1\x0a\x00\x00\xa1\x00\x14\xaf\x17\x00\x02\x7e\x01\x01\xf5\x06\x20\x9c\xa0\x1f\x05\x61\x9e\x80\x00\xeb\x93\x80"
+            "\x07\x00\x50\x9e\x80\xec\xbf\xa8\xd3\x05\x00\x8a\x00\x02\xd2\x10\x02\x0d\x0c\x01\x2b\x0d\x00\xe8\x0c\x01\x23\x03\x10\x8b\x3a\x0b"
+            "\x01\x39\x11\x01\x0d\x00\x00\x21\x01\x00\x38\x01\x23\xb0\xb0\x10\x00\x00\xdc\x00\x51\x82\xac\xec\xb2\xa0\xdf\x0a\x11\xb0\x1a\x0c"
+            "\x02\x0d\x00\x00\x51\x05\x21\xaa\xbd\x07\x01\x51\x94\xb1\xec\xa0\x95\x4d\x0b\x20\x8a\x88\x24\x00\x03\xf0\x0f\x40\xb9\x9c\xeb\x86"
+            "\xbe\x07\x31\xec\x8a\xac\x48\x0f\x10\xa1\xc6\x12\x10\x00\xbc\x0d\x20\xb7\xb8\x73\x11\x00\xf9\x06\x30\x83\xb1\xea\x81\x12\x51\xa7"
+            "\x98\xeb\xb3\xb5\x48\x09\x80\x8c\x8c\xec\xaa\xbc\xec\x98\xa5\xa9\x11\x31\xed\x88\xb4\x81\x00\x22\xb2\xa0\x4e\x14\x31\x00\xeb\x84"
+            "\x19\x18\x20\xa0\xb9\x22\x03\x00\xe8\x06\x03\x2c\x03\x0b\x0d\x00\x06\x10\x00\x33\xec\xa0\x80\x10\x04\x02\x0a\x00\x00\x77\x00\x03"
+            "\x0a\x00\x21\x8d\x94\xe5\x03\x20\xa6\xac\x8e\x00\x61\xa0\x88\x00\xeb\xb2\xb0\x87\x07\x51\xb6\x88\xec\xbc\x9c\x0f\x15\x10\x9e\xf3"
+            "\x03\x01\x81\x00\x20\x83\xb9\x6a\x10\x00\x1e\x16\x42\x84\xb0\xea\xb2\x5e\x03\x50\x95\xa1\xec\x8a\xa8\x8e\x0b\x01\x0a\x00\x03\xcc"
+            "\x06\x30\xec\xa6\x88\x9e\x0c\x00\x9f\x01\x00\x3c\x03\x20\x88\xb0\x99\x13\x15\x96\xeb\x13\x10\xa7\x1c\x02\x41\x00\xec\xaa\xbc\x6e"
+            "\x12\x01\xa1\x0b\x00\x99\x01\x01\x8e\x00\x01\xae\x12\x00\x07\x00\x83\xb9\x84\xec\xa1\xb0\xed\x91\xb8\x0a\x00\x00\x63\x00\x01\x3a"
+            "\x18\x41\xac\xeb\xa7\x8c\xab\x17\x42\xb9\x84\xeb\x9e\x0a\x00\x21\xa3\xa8\x02\x05\xf0\x00\x9e\x90\xeb\xa7\x9d\xec\xb9\xbc\x00\xec"
+            "\xa0\x88\xea\xb0\x81\x2f\x19\x00\xe9\x09\x00\xab\x02\x11\xa0\x55\x05\x51\xa6\xac\xeb\x91\xa5\x06\x07\x40\x9b\x8c\xea\xb8\x2f\x14"
+            "\x10\x8c\x80\x05\x00\x9b\x02\x40\xb2\x84\xeb\x9e\xc6\x11\x01\x9b\x02\x50\x95\xa4\xed\x8b\xb0\x28\x04\x03\x2b\x0b\x11\x95\xa8\x16"
+            "\x00\xcf\x0a\x21\x85\xb8\x0c\x17\x20\x94\x94\x0e\x12\x00\x55\x05\x52\x82\xbc\xec\x82\xbc\x02\x08\x60\x00\xed\x99\x9c\xed\x99\xf7"
+            "\x01\x01\xf4\x13\x20\xb6\x88\x47\x08\x11\xaa\x7a\x02\x00\x8d\x07\x01\x11\x02\x00\x28\x07\x02\x01\x15\x00\x69\x07\x00\x35\x07\x10"
+            "\xb9\x12\x01\x00\xfa\x03\x00\x1a\x00\x40\x86\xa0\xeb\x84\x24\x06\x01\x70\x03\x01\x70\x0e\x07\xc4\x0b\x01\x1a\x0c\x01\x13\x07\x23"
+            "\xa0\x9c\x2e\x14\x10\xac\x51\x09\x01\x60\x04\x03\x94\x12\x11\x81\x1b\x16\x00\x24\x00\x11\xbc\x55\x07\x00\x58\x00\x02\x01\x14\x50"
+            "\xa1\x9c\xec\x97\xa3\x5a\x08\x80\xea\xb2\x8c\xeb\x85\xb8\xec\x84\x16\x0b\x01\xd7\x00\x20\x8f\x84\x65\x03\x20\xa7\x88\x26\x01\x03"
+            "\x0d\x00\x21\xb3\xb4\x49\x0c\x10\xb8\x50\x06\x00\x12\x0f\x21\xa1\xa0\x7a\x14\x20\x98\xb8\x46\x0a\x00\xc0\x00\x21\xa5\xb4\x3a\x03"
+            "\x20\xa7\x88\xbb\x0f\x10\x8b\x6f\x10\x01\x08\x11\x21\xa7\x88\x7e\x02\x01\xf4\x08\x64\xeb\xb0\x98\xec\x9e\xa5\x0d\x00\x20\x8b\x8c"
+            "\x66\x09\x03\x77\x06\x23\xb9\x97\x0a\x00\x30\xed\x86\xa0\xb8\x09\x20\xec\x82\xbd\x0b\x30\xeb\xb9\x88\x36\x01\x02\x10\x00\x00\x0d"
+            "\x00\x05\x08\x16\x01\x6d\x10\x10\xb6\x8b\x01\x20\xeb\xb2\x10\x1a\x00\x0d\x00\x25\xeb\x96\x2f\x0e\x20\xb9\x84\x23\x02\x21\x9a\xa9"
+            "\x26\x01\x10\x98\x93\x15\x01\x55\x00\x23\x97\xbc\x82\x0d\x02\xe9\x0e\x64\xeb\xb2\xa0\xeb\xb2\xa0\xf6\x0e\x54\x97\xa3\xed\x85\x8c"
+            "\x0d\x00\x12\xa0\x64\x01\x00\x6e\x0b\x40\xb4\xed\x81\xb4\x57\x04\x32\xea\xb3\xa0\x9c\x18\x40\x90\xec\xa7\xb1\xdf\x15\x00\xf5\x0c"
+            "\x23\x8b\xa4\x39\x0b\x01\xc8\x05\x41\x99\x00\xeb\x83\x6d\x0e\x00\x03\x0f\x20\x83\x90\x37\x08\x21\x8b\x89\x49\x00\x83\x8b\xa8\xec"
+            "\xb9\xbc\xeb\xb9\x99\xc0\x07\x30\xed\x82\xac\x72\x11\x00\x49\x01\x21\xa5\xb4\x2b\x03\x51\x8a\x88\xec\x81\x98\x0e\x03\x22\xa0\x88"
+            "\x79\x04\x01\xcb\x05\x70\x82\x98\xeb\xa3\xb8\xed\x8d\x9a\x17\x02\x0d\x00\x40\xa8\xeb\xa6\xbc\x26\x0f\x01\x25\x12\x50\xb4\xec\xa7"
+            "\x95\x00\x59\x00\x11\x9d\x38\x03\x01\x29\x02\x04\x89\x1c\x20\x86\x90\xaf\x0b\x05\x0d\x00\x02\xac\x05\x01\xf4\x02\x10\xa0\x49\x13"
+            "\x03\xa4\x0a\x70\xec\xba\x84\x00\xec\x99\x84\x00\x15\x10\x8f\xdf\x01\x01\x16\x02\x02\xce\x17\x32\xeb\xaa\xa9\x4f\x01\x70\xed\x82"
+            "\xa4\xed\x85\x94\x00\x51\x12\x22\xa0\x88\x13\x00\x03\x15\x1d\x01\x14\x03\x01\x83\x09\x00\x4c\x05\x26\xb2\xac\x0d\x00\x01\x93\x0f"
+            "\x13\x88\x66\x05\x05\x0d\x00\x00\x00\x05\x00\x17\x05\x11\x8b\x1c\x0b\x00\xd5\x09\x20\xa3\xa8\x86\x13\x20\xb6\x88\x4c\x06\x31\xeb"
+            "\x8d\xb4\x66\x09\x10\xa9\xdc\x14\x01\x4f\x11\x50\xaf\xb8\xeb\x81\x84\xab\x02\x00\xd1\x0a\x02\x0d\x00\x00\xc6\x16\x05\x0d\x00\x11"
+            "\x9e\xf9\x0e\x20\xed\x81\x63\x0f\x01\x97\x09\x20\x82\x98\xb6\x00\x20\xa0\xb9\x1a\x09\x00\x8e\x06\x00\xb0\x01\x50\x98\xb8\xeb\xb0"
+            "\x94\xa7\x07\x60\xed\x8e\x8c\xed\x82\xa8\xc7\x10\x21\xea\xbd\x0c\x0c\x12\xa6\x40\x04\x22\xa0\x88\x25\x18\x01\xab\x00\x21\x9d\x8c"
+            "\x71\x17\x20\x9d\x8c\x01\x0b\x00\x8f\x08\x10\xa5\x95\x00\x03\x1d\x0c\x01\x6f\x02\x10\xa8\x93\x0b\x00\x42\x05\x23\xa7\x80\xc0\x01"
+            "\x22\x8d\xb0\x73\x0a\x00\x91\x03\x00\xd8\x1b\x01\xa0\x13\x20\xb3\xbc\x71\x03\x21\x8b\x88\xd3\x03\x00\x98\x00\x31\xb0\xeb\xb9\xc6"
+            "\x06\x02\x07\x00\x02\x6d\x12\x01\x14\x0d\x20\xaa\xa8\x86\x00\x02\x2f\x19\x06\x39\x02\x00\x14\x01\x01\x0a\x00\x00\x71\x0c\x00\xdf"
+            "\x0a\x80\x96\xb4\xed\x9d\xa5\xec\x97\xbc\x29\x17\x03\xe5\x1a\x00\x32\x04\x21\x9a\x94\xef\x1a\x01\x14\x00\x00\xcb\x00\x60\x8a\x90"
+            "\x00\xec\xbd\x95\x6b\x05\x03\xa1\x17\x01\xa8\x0a\x00\x93\x00\x50\xec\x99\x95\xed\x81\x92\x18\x01\x61\x05\x10\x98\x9d\x14\x01\x22"
+            "\x04\x40\x98\x95\xec\x82\x91\x19\x01\x0d\x00\x20\x84\xb1\x8c\x05\x02\x7d\x0e\x36\xec\xa0\x84\x0d\x00\x02\xb5\x19\x00\x41\x0c\x11"
+            "\x85\x81\x02\x00\x4b\x06\x52\xa7\x80\xea\xb2\x8c\xa5\x1c\x00\x03\x00\x00\x0d\x00\x80\xec\xb6\xa4\xec\xb6\x94\xec\x83\xd3\x08\x10"
+            "\x90\x50\x02\x00\x6c\x00\x10\x97\x3f\x07\x21\xeb\xb3\x0b\x1a\x31\xeb\xa9\x8d\x5f\x05\x01\x9e\x0b\x00\x00\x02\x10\x95\xce\x11\x11"
+            "\xbd\x90\x01\x02\x8b\x1b\x23\xa7\x88\x02\x1b\x00\x1e\x08\x09\x10\x00\x10\xa8\x7e\x1a\x21\xeb\x82\x4c\x0a\x00\xec\x10\x10\xa7\xd1"
+            "\x0b\x00\xad\x15\x00\xe7\x02\x00\xfd\x07\x02\x0b\x1f\x05\x10\x00\x30\xec\xa7\x9c\x5e\x0e\x20\x9e\x91\xbe\x10\x20\xeb\x9e\x11\x14"
+            "\x01\xc7\x01\x00\x17\x06\x31\x88\xec\x8a\x14\x09\x34\xec\x85\xb0\xcb\x0e\x02\xff\x1c\x00\x5e\x1a\x42\x97\xbc\xeb\x89\x7f\x0d\x50"
+            "\x8f\xac\xea\xb3\xb0\xc2\x17\x01\x08\x1b\x11\x90\xcc\x17\x40\x8b\xac\xec\xbd\x13\x02\x01\x6a\x09\x11\xac\x55\x0f\x01\x25\x1f\x00"
+            "\x7c\x0d\x01\x8a\x0f\x21\x81\x90\xf3\x02\x11\x81\x79\x0b\x20\x9e\x91\xe1\x18\x10\x83\xc0\x03\x10\xb4\x3e\x0a\x02\xcc\x10\x00\x7a"
+            "\x08\x10\x8b\xe3\x09\x40\x00\xea\xb0\x91\x1b\x0c\x42\xac\xb4\xec\x82\xf1\x1d\x53\x9e\x98\xea\xbf\x8d\x0a\x00\x00\x73\x1e\x51\x9d"
+            "\xb4\xeb\x8b\xb9\x3a\x19\x21\xac\xb4\x2e\x11\x90\x83\x80\xec\x9e\x85\x3a\xeb\x84\x90\x4f\x16\x00\xa8\x06\x00\x84\x1e\x11\xa9\xed"
+            "\x0b\x00\x8c\x1c\x00\xde\x00\x01\xa0\x08\x33\xed\x8f\xad\x00\x04\x00\xda\x01\x01\xcd\x0d\x00\x67\x03\x01\x8b\x03\x31\x00\xeb\x94"
+            "\xf4\x0c\x20\x81\x90\x57\x09\x21\xea\xb0\x14\x04\x30\xed\x95\xa0\x40\x01\x20\xa1\xb1\x64\x00\x01\xe7\x02\x13\x9c\x44\x01\x01\x4a"
+            "\x11\x02\x0a\x00\x01\xa9\x1d\x09\x0d\x00\x00\x45\x19\x00\x1c\x18\x10\x91\x0d\x06\x01\x03\x00\x13\xad\x10\x00\x02\x8f\x15\x01\x42"
+            "\x07\x02\x10\x00\x20\xb8\x8c\x07\x04\x01\x57\x19\x01\x10\x00\x10\x8a\x81\x20\x02\xb4\x02\x00\x0a\x0a\x00\x2e\x0e\x00\xb8\x07\x04"
+            "\x0d\x00\x00\xa8\x1b\x21\xec\x86\x83\x15\x02\xb9\x05\x02\x59\x14\x02\xd6\x1d\x00\xc2\x1d\x02\xfa\x20\x40\x00\xeb\xa7\xa4\x4e\x01"
+            "\x21\xb6\x95\xfe\x0f\x10\xa1\x7f\x1a\x22\xec\xb2\xc1\x02\x00\xcc\x1d\x10\xa9\x2a\x09\x00\x0e\x10\x91\xb5\xac\xec\x95\xbc\x00\xec"
+            "\xa2\x85\xb1\x0e\x00\x2f\x06\x00\x3b\x0b\x31\xec\x8b\x9d\x52\x1a\x11\x84\xd5\x0d\x02\xc0\x11\x02\x31\x0b\x02\x3a\x0e\x03\xd9\x06"
+            "\x00\xad\x0d\x00\x64\x14\x01\x36\x06\x00\x68\x0e\x01\x83\x13\x10\xa0\x67\x06\x62\xec\xb0\xa8\xea\xb3\xa1\x06\x00\x01\x18\x1f\x00"
+            "\xa5\x17\x00\x53\x1b\x01\xbb\x13\x01\xd0\x0f\x10\x00",
+            9581, 12065
+        },
+    },
+    // Chinese
+    {
+        // characteristic_zh
+        {
+            "\xf3\x96\x1f\x00\x00\x00\x84\x00\x00\x00\x89\x00\x00\x00\x96\x00\x00\x00\xa6\x00\x00\x00\xbc\x00\x00\x00\xd2\x00\x00\x00\xe1\x00"
+            "\x00\x00\xf4\x00\x00\x00\x0a\x01\x00\x00\x22\x01\x00\x00\x31\x01\x00\x00\x40\x01\x00\x00\x4c\x01\x00\x00\x63\x01\x00\x00\x75\x01"
+            "\x00\x00\x84\x01\x00\x00\x96\x01\x00\x00\xa3\x01\x00\x00\xb3\x01\x00\x00\xc7\x01\x00\x00\xdb\x01\x00\x00\xe9\x01\x00\x00\xf8\x01"
+            "\x00\x00\x04\x02\x00\x00\x17\x02\x00\x00\x2d\x02\x00\x00\x3a\x02\x00\x00\x48\x02\x00\x00\x56\x02\x00\x00\x67\x02\x00\x00\x75\x02"
+            "\x00\x00\x87\x02\x00\x00\x4e\x6f\x6e\x65\x00\x4c\x6f\x76\x65\x73\x20\x74\x6f\x20\x65\x61\x74\x00\x4f\x66\x74\x65\x6e\x20\x64\x6f"
+            "\x7a\x65\x73\x20\x6f\x66\x66\x10\x00\xfa\x02\x73\x63\x61\x74\x74\x65\x72\x73\x20\x74\x68\x69\x6e\x67\x73\x00\x53\x10\x00\x20\x20"
+            "\x6f\x26\x00\x42\x00\x4c\x69\x6b\x49\x00\xf6\x09\x72\x65\x6c\x61\x78\x00\x50\x72\x6f\x75\x64\x20\x6f\x66\x20\x69\x74\x73\x20\x70"
+            "\x6f\x77\x65\x72\x22\x00\xf6\x15\x74\x68\x72\x61\x73\x68\x20\x61\x62\x6f\x75\x74\x00\x41\x20\x6c\x69\x74\x74\x6c\x65\x20\x71\x75"
+            "\x69\x63\x6b\x20\x74\x65\x6d\x70\x65\x72\x65\x64\x2e\x00\x7a\x66\x69\x67\x68\x74\x00\x51\x1e\x00\xf0\x04\x53\x74\x75\x72\x64\x79"
+            "\x20\x62\x6f\x64\x79\x00\x43\x61\x70\x61\x62\x6c\x65\x6d\x00\xf2\x1d\x74\x61\x6b\x69\x6e\x67\x20\x68\x69\x74\x73\x00\x48\x69\x67"
+            "\x68\x6c\x79\x20\x70\x65\x72\x73\x69\x73\x74\x65\x6e\x74\x00\x47\x6f\x6f\x64\x20\x65\x6e\x64\x75\x72\x61\x6e\x63\x65\x0f\x00\x00"
+            "\x1f\x00\x50\x65\x76\x65\x72\x65\x12\x00\x06\xc4\x00\x80\x75\x6e\x00\x41\x6c\x65\x72\x74\x0d\x00\xf0\x14\x73\x6f\x75\x6e\x64\x73"
+            "\x00\x49\x6d\x70\x65\x74\x75\x6f\x75\x73\x20\x61\x6e\x64\x20\x73\x69\x6c\x6c\x79\x00\x53\x6f\x6d\x65\x77\x68\x61\x74\x7c\x00\x74"
+            "\x61\x20\x63\x6c\x6f\x77\x6e\xaa\x00\x64\x6f\x20\x66\x6c\x65\x65\x86\x00\xf0\x01\x63\x75\x72\x69\x6f\x75\x73\x00\x4d\x69\x73\x63"
+            "\x68\x69\x65\x76\x0c\x00\x63\x54\x68\x6f\x72\x6f\x75\x1f\x00\x53\x6e\x6e\x69\x6e\x67\x71\x01\xa0\x6c\x6f\x73\x74\x20\x69\x6e\x20"
+            "\x74\x68\x1f\x00\xf0\x0b\x74\x00\x56\x65\x72\x79\x20\x66\x69\x6e\x69\x63\x6b\x79\x00\x53\x74\x72\x6f\x6e\x67\x20\x77\x69\x6c\x6c"
+            "\x08\x01\x04\x81\x00\x43\x76\x61\x69\x6e\x1c\x00\xe2\x6c\x79\x20\x64\x65\x66\x69\x61\x6e\x74\x00\x48\x61\x74\xd1\x00\x46\x6c\x6f"
+            "\x73\x65\x2d\x00\x90\x73\x74\x75\x62\x62\x6f\x72\x6e\x00",
+            558, 647
+        },
+        // dppt_zh
+        {
+            "\xf2\xff\xd2\x71\x00\x00\x00\xcc\x01\x00\x00\xda\x01\x00\x00\xe6\x01\x00\x00\xf4\x01\x00\x00\x03\x02\x00\x00\x13\x02\x00\x00\x24"
+            "\x02\x00\x00\x36\x02\x00\x00\x47\x02\x00\x00\x55\x02\x00\x00\x65\x02\x00\x00\x8a\x02\x00\x00\x99\x02\x00\x00\xa8\x02\x00\x00\xb9"
+            "\x02\x00\x00\xc8\x02\x00\x00\xd7\x02\x00\x00\xe6\x02\x00\x00\xf5\x02\x00\x00\x0a\x03\x00\x00\x2b\x03\x00\x00\x4c\x03\x00\x00\x5c"
+            "\x03\x00\x00\x6f\x03\x00\x00\x82\x03\x00\x00\x95\x03\x00\x00\xa8\x03\x00\x00\xbb\x03\x00\x00\xce\x03\x00\x00\xdd\x03\x00\x00\xed"
+            "\x03\x00\x00\xfd\x03\x00\x00\x0e\x04\x00\x00\x27\x04\x00\x00\x40\x04\x00\x00\x59\x04\x00\x00\x66\x04\x00\x00\x77\x04\x00\x00\x89"
+            "\x04\x00\x00\x98\x04\x00\x00\xb0\x04\x00\x00\xc8\x04\x00\x00\xd7\x04\x00\x00\xee\x04\x00\x00\x07\x05\x00\x00\x20\x05\x00\x00\x34"
+            "\x05\x00\x00\x49\x05\x00\x00\x5e\x05\x00\x00\x73\x05\x00\x00\x88\x05\x00\x00\x9d\x05\x00\x00\xaa\x05\x00\x00\xc0\x05\x00\x00\xde"
+            "\x05\x00\x00\xfc\x05\x00\x00\x0a\x06\x00\x00\x18\x06\x00\x00\x24\x06\x00\x00\x33\x06\x00\x00\x43\x06\x00\x00\x5a\x06\x00\x00\x72"
+            "\x06\x00\x00\x82\x06\x00\x00\x8e\x06\x00\x00\xa1\x06\x00\x00\xad\x06\x00\x00\xb8\x06\x00\x00\xc4\x06\x00\x00\xd4\x06\x00\x00\xe5"
+            "\x06\x00\x00\xef\x06\x00\x00\xf9\x06\x00\x00\x03\x07\x00\x00\x15\x07\x00\x00\x27\x07\x00\x00\x39\x07\x00\x00\x4b\x07\x00\x00\x55"
+            "\x07\x00\x00\x5f\x07\x00\x00\x69\x07\x00\x00\x73\x07\x00\x00\x81\x07\x00\x00\x8f\x07\x00\x00\x9d\x07\x00\x00\xab\x07\x00\x00\xb9"
+            "\x07\x00\x00\xcb\x07\x00\x00\xdd\x07\x00\x00\xee\x07\x00\x00\xff\x07\x00\x00\x11\x08\x00\x00\x23\x08\x00\x00\x2d\x08\x00\x00\x37"
+            "\x08\x00\x00\x41\x08\x00\x00\x4b\x08\x00\x00\x55\x08\x00\x00\x5f\x08\x00\x00\x69\x08\x00\x00\x73\x08\x00\x00\x7d\x08\x00\x00\x87"
+            "\x08\x00\x00\x91\x08\x00\x00\x9b\x08\x00\x00\xa5\x08\x00\x00\xaf\x08\x00\x00\xbd\x08\x00\x00\xcb\x08\x00\x00\xd7\x08\x00\x00\xe1"
+            "\x08\x00\x00\xeb\x08\x00\x00\xf5\x08\x00\x00\xff\x08\x00\x00\x43\x61\x6e\x61\x6c\x61\x76\x65\x20\x43\x69\x74\x79\x00\x45\x74\x65"
+            "\x72\x6e\x61\x0c\x00\x73\x50\x61\x73\x74\x6f\x72\x69\x0e\x00\x83\x53\x75\x6e\x79\x73\x68\x6f\x72\x29\x00\xfb\x11\x50\x6f\x6b\xc3"
+            "\xa9\x6d\x6f\x6e\x20\x4c\x65\x61\x67\x75\x65\x00\x4f\x72\x65\x62\x75\x72\x67\x68\x20\x4d\x69\x6e\x65\x20\x31\x46\x11\x00\xf4\x05"
+            "\x42\x31\x46\x00\x56\x61\x6c\x6c\x65\x79\x20\x57\x69\x6e\x64\x77\x6f\x72\x6b\x73\x6d\x00\xf2\x02\x46\x6f\x72\x65\x73\x74\x00\x46"
+            "\x75\x65\x67\x6f\x20\x49\x72\x6f\x6e\x1e\x00\xf9\x15\x4d\x74\x2e\x20\x43\x6f\x72\x6f\x6e\x65\x74\x20\x28\x52\x6f\x75\x74\x65\x20"
+            "\x32\x30\x37\x2f\x32\x30\x38\x20\x45\x6e\x74\x72\x61\x6e\x63\x65\x29\x25\x00\x29\x32\x46\x0f\x00\x1a\x33\x0f\x00\x49\x53\x6e\x6f"
+            "\x77\x11\x00\x1a\x34\x20\x00\x1a\x35\x0f\x00\x1a\x36\x0f\x00\x1a\x37\x0f\x00\x8f\x54\x6f\x70\x20\x43\x61\x76\x65\xa5\x00\x02\x2f"
+            "\x31\x36\xa1\x00\x04\x05\x21\x00\x1f\x31\x21\x00\x04\x00\x26\x01\xfe\x03\x47\x72\x65\x61\x74\x20\x4d\x61\x72\x73\x68\x20\x41\x72"
+            "\x65\x61\x20\x31\x13\x00\x1e\x32\x13\x00\x1e\x33\x13\x00\x1e\x34\x13\x00\x1e\x35\x13\x00\xf0\x0e\x36\x00\x53\x6f\x6c\x61\x63\x65"
+            "\x6f\x6e\x20\x52\x75\x69\x6e\x73\x00\x56\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\xc9\x01\x09\x10\x00\x1b\x32\x10\x00\x01\xd8"
+            "\x01\x09\x11\x00\xaf\x61\x63\x6b\x20\x52\x6f\x6f\x6d\x20\x31\x19\x00\x05\x1f\x32\x19\x00\x05\xe6\x33\x00\x52\x61\x76\x61\x67\x65"
+            "\x64\x20\x50\x61\x74\x68\x42\x02\x3a\x47\x61\x74\x53\x02\x01\x11\x00\x00\x7b\x00\xeb\x53\x74\x61\x72\x6b\x20\x4d\x6f\x75\x6e\x74"
+            "\x61\x69\x6e\x0f\x00\x05\x65\x01\x0c\x18\x00\xf0\x0e\x49\x6e\x74\x65\x72\x69\x6f\x72\x00\x53\x65\x6e\x64\x6f\x66\x66\x20\x53\x70"
+            "\x72\x69\x6e\x67\x00\x54\x75\x72\x6e\x62\x8e\x00\x00\xdb\x01\x06\x3e\x00\x0a\x17\x00\xab\x31\x73\x74\x20\x50\x69\x6c\x6c\x61\x72"
+            "\x19\x00\x34\x32\x6e\x64\x19\x00\x00\x6c\x02\xb1\x70\x6f\x69\x6e\x74\x20\x54\x65\x6d\x70\x6c\xbd\x00\x0d\x14\x00\x01\xc0\x00\x0d"
+            "\x15\x00\x1f\x32\x15\x00\x01\x1f\x33\x15\x00\x01\x1f\x34\x15\x00\x01\xa2\x35\x46\x00\x57\x61\x79\x77\x61\x72\x64\xa0\x02\x08\x0d"
+            "\x00\xa0\x20\x28\x53\x65\x63\x72\x65\x74\x29\x00\xe9\x01\x73\x20\x4d\x61\x6e\x69\x61\x63\x1a\x00\xaf\x3c\x20\x31\x30\x20\x55\x6e"
+            "\x6f\x77\x6e\x1e\x00\x01\x17\x3e\x1e\x00\x03\x19\x00\xf0\x06\x54\x75\x6e\x6e\x65\x6c\x00\x54\x72\x6f\x70\x68\x79\x20\x47\x61\x72"
+            "\x64\x65\x6e\x00\xbd\x03\x78\x20\x49\x73\x6c\x61\x6e\x64\x0c\x00\x00\xff\x00\x08\x0f\x00\x00\xfa\x00\x09\x10\x00\x9e\x32\x46\x20"
+            "\x28\x4c\x65\x66\x74\x29\x17\x00\x4c\x52\x69\x67\x68\x18\x00\xe8\x33\x46\x00\x4f\x6c\x64\x20\x43\x68\x61\x74\x65\x61\x75\x0c\x00"
+            "\x02\x48\x02\xa0\x35\x00\x4c\x61\x6b\x65\x20\x56\x65\x72\xaa\x04\x02\x0c\x00\x42\x61\x6c\x6f\x72\x0b\x00\x30\x41\x63\x75\x17\x00"
+            "\x01\x12\x00\x10\x20\x12\x00\x62\x66\x72\x6f\x6e\x74\x00\x17\x00\x07\x11\x00\x04\x73\x04\x15\x31\x0a\x00\x15\x32\x0a\x00\x15\x33"
+            "\x0a\x00\x98\x34\x20\x28\x53\x6f\x75\x74\x68\x29\x12\x00\x38\x4e\x6f\x72\x12\x00\x1d\x35\x24\x00\x1d\x35\x24\x00\x15\x36\x0a\x00"
+            "\x15\x37\x0a\x00\x15\x38\x0a\x00\x50\x39\x00\x4c\x6f\x73\x77\x04\x30\x77\x65\x72\x4e\x01\x07\x0e\x00\x19\x32\x0e\x00\x19\x33\x0e"
+            "\x00\x19\x34\x0e\x00\x24\x35\x46\x50\x00\x2c\x31\x30\x92\x00\x00\x12\x00\x0a\x92\x00\x70\x31\x31\x20\x28\x57\x65\x73\x2e\x02\x06"
+            "\x11\x00\x28\x45\x61\x11\x00\x1d\x32\x34\x00\x1d\x32\x58\x00\x05\x2a\x01\x25\x31\x34\x0a\x00\x15\x35\x0a\x00\x05\xf6\x00\x15\x31"
+            "\xf6\x00\x15\x31\xf6\x00\x24\x31\x39\x0a\x00\x15\x32\x84\x01\x15\x32\x84\x01\x15\x32\x50\x00\x15\x32\x50\x00\x15\x32\x46\x00\x15"
+            "\x32\x46\x00\xb0\x32\x39\x00\x54\x77\x69\x6e\x6c\x65\x61\x66\x08\x01\xa2\x6e\x00\x43\x65\x6c\x65\x73\x74\x69\x63\x0e\x00\x61\x52"
+            "\x65\x73\x6f\x72\x74\x0b\x05\x05\x32\x00\x15\x30\x0a\x00\x05\xbe\x00\x15\x32\xaa\x00\x30\x33\x30\x00",
+            1369, 2303
+        },
+        // frlg_zh
+        {
+            "\xf4\xff\xc6\x6b\x00\x00\x00\xb4\x01\x00\x00\xc0\x01\x00\x00\xce\x01\x00\x00\xdc\x01\x00\x00\xeb\x01\x00\x00\xf8\x01\x00\x00\x05"
+            "\x02\x00\x00\x15\x02\x00\x00\x1d\x02\x00\x00\x25\x02\x00\x00\x2d\x02\x00\x00\x35\x02\x00\x00\x3d\x02\x00\x00\x45\x02\x00\x00\x4d"
+            "\x02\x00\x00\x55\x02\x00\x00\x5d\x02\x00\x00\x66\x02\x00\x00\x6f\x02\x00\x00\x78\x02\x00\x00\x81\x02\x00\x00\x8a\x02\x00\x00\x93"
+            "\x02\x00\x00\x9c\x02\x00\x00\xa5\x02\x00\x00\xae\x02\x00\x00\xb7\x02\x00\x00\xc0\x02\x00\x00\xc9\x02\x00\x00\xd2\x02\x00\x00\xdb"
+            "\x02\x00\x00\xe4\x02\x00\x00\xed\x02\x00\x00\xfd\x02\x00\x00\x09\x03\x00\x00\x16\x03\x00\x00\x23\x03\x00\x00\x2d\x03\x00\x00\x3c"
+            "\x03\x00\x00\x4c\x03\x00\x00\x5c\x03\x00\x00\x6c\x03\x00\x00\x83\x03\x00\x00\x98\x03\x00\x00\xab\x03\x00\x00\xbe\x03\x00\x00\xd1"
+            "\x03\x00\x00\xe4\x03\x00\x00\xf3\x03\x00\x00\x03\x04\x00\x00\x16\x04\x00\x00\x2a\x04\x00\x00\x3e\x04\x00\x00\x52\x04\x00\x00\x66"
+            "\x04\x00\x00\x78\x04\x00\x00\x8a\x04\x00\x00\x9c\x04\x00\x00\xae\x04\x00\x00\xc0\x04\x00\x00\xd1\x04\x00\x00\xe2\x04\x00\x00\xf4"
+            "\x04\x00\x00\x00\x05\x00\x00\x0b\x05\x00\x00\x17\x05\x00\x00\x23\x05\x00\x00\x2f\x05\x00\x00\x3e\x05\x00\x00\x49\x05\x00\x00\x55"
+            "\x05\x00\x00\x65\x05\x00\x00\x75\x05\x00\x00\x85\x05\x00\x00\x96\x05\x00\x00\xa6\x05\x00\x00\xb5\x05\x00\x00\xc0\x05\x00\x00\xcb"
+            "\x05\x00\x00\xd7\x05\x00\x00\xf0\x05\x00\x00\x00\x06\x00\x00\x0f\x06\x00\x00\x1c\x06\x00\x00\x26\x06\x00\x00\x37\x06\x00\x00\x48"
+            "\x06\x00\x00\x59\x06\x00\x00\x66\x06\x00\x00\x74\x06\x00\x00\x82\x06\x00\x00\x90\x06\x00\x00\x9e\x06\x00\x00\xac\x06\x00\x00\xb9"
+            "\x06\x00\x00\xc6\x06\x00\x00\xd6\x06\x00\x00\xe7\x06\x00\x00\xf9\x06\x00\x00\x06\x07\x00\x00\x14\x07\x00\x00\x23\x07\x00\x00\x32"
+            "\x07\x00\x00\x41\x07\x00\x00\x51\x07\x00\x00\x60\x07\x00\x00\x6d\x07\x00\x00\x7d\x07\x00\x00\x50\x61\x6c\x6c\x65\x74\x20\x54\x6f"
+            "\x77\x6e\x00\x56\x69\x72\x69\x64\x69\x61\x6e\x20\x43\x69\x74\x79\x00\x43\x65\x72\x75\x6c\x65\x0e\x00\x85\x56\x65\x72\x6d\x69\x6c"
+            "\x69\x6f\x1d\x00\x34\x6c\x61\x64\x0d\x00\x73\x46\x75\x63\x68\x73\x69\x61\x1a\x00\xf3\x07\x69\x6e\x6e\x61\x62\x61\x72\x20\x49\x73"
+            "\x6c\x61\x6e\x64\x00\x52\x6f\x75\x74\x65\x20\x31\x08\x00\x13\x32\x08\x00\x13\x33\x08\x00\x13\x34\x08\x00\x13\x35\x08\x00\x13\x36"
+            "\x08\x00\x13\x37\x08\x00\x13\x38\x08\x00\x14\x39\x48\x00\x14\x30\x09\x00\x04\x52\x00\x14\x31\x53\x00\x14\x31\x54\x00\x14\x31\x55"
+            "\x00\x14\x31\x56\x00\x14\x31\x57\x00\x14\x31\x58\x00\x14\x31\x59\x00\x14\x31\x5a\x00\x14\x32\x5a\x00\x15\x32\xac\x00\x04\x5a\x00"
+            "\x14\x32\x5a\x00\x14\x32\x5a\x00\x26\x32\x35\x2d\x01\xf6\x03\x46\x6f\x72\x65\x73\x74\x00\x4d\x74\x2e\x20\x4d\x6f\x6f\x6e\x20\x31"
+            "\x46\x0c\x00\x19\x42\x0d\x00\xf0\x19\x32\x46\x00\x53\x2e\x53\x2e\x20\x41\x6e\x6e\x65\x00\x44\x69\x67\x6c\x65\x74\x74\x27\x73\x20"
+            "\x43\x61\x76\x65\x00\x56\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\x43\x00\x09\x10\x00\x1b\x32\x10\x00\xf0\x01\x33\x46\x00\x50"
+            "\x6f\x6b\xc3\xa9\x6d\x6f\x6e\x20\x4d\x61\x6e\x73\x97\x01\x3f\x31\x46\x2d\x17\x00\x01\x00\x82\x00\xf9\x03\x53\x61\x66\x61\x72\x69"
+            "\x20\x5a\x6f\x6e\x65\x20\x43\x65\x6e\x74\x65\x72\x13\x00\x6e\x41\x72\x65\x61\x20\x31\x13\x00\x1e\x32\x13\x00\x00\x09\x01\x90\x63"
+            "\x6b\x20\x54\x75\x6e\x6e\x65\x6c\xa7\x00\x08\x0f\x00\x01\x6b\x00\x63\x65\x61\x66\x6f\x61\x6d\xfd\x01\x10\x73\x23\x00\x0c\x13\x00"
+            "\x0f\x27\x00\x01\x01\x1b\x01\x0c\x14\x00\x1f\x33\x14\x00\x00\x17\x34\xe3\x00\x59\x54\x6f\x77\x65\x72\x0c\x01\x02\x12\x00\x0e\x24"
+            "\x00\x1d\x35\x12\x00\x1d\x36\x12\x00\x27\x37\x46\xf2\x02\x30\x61\x76\x65\xbb\x00\x0a\x11\x00\x1c\x32\x11\x00\x00\xca\x00\x11\x50"
+            "\x3d\x00\x94\x50\x6c\x61\x6e\x74\x00\x4f\x6e\x65\xf6\x02\x35\x46\x6f\x75\x02\x03\x35\x46\x69\x76\x18\x00\x61\x4b\x69\x6e\x64\x6c"
+            "\x65\xc6\x01\xf0\x10\x00\x54\x72\x65\x61\x73\x75\x72\x65\x20\x42\x65\x61\x63\x68\x00\x43\x61\x70\x65\x20\x42\x72\x69\x6e\x6b\x00"
+            "\x42\x6f\x6e\x64\x0b\x00\x81\x64\x67\x65\x00\x54\x68\x72\x65\x3f\x00\xf5\x17\x65\x20\x50\x6f\x72\x74\x00\x52\x65\x73\x6f\x72\x74"
+            "\x20\x47\x6f\x72\x67\x65\x6f\x75\x73\x00\x57\x61\x74\x65\x72\x20\x4c\x61\x62\x79\x72\x69\x6e\x74\x68\x6e\x00\xf4\x11\x65\x20\x4d"
+            "\x65\x61\x64\x6f\x77\x00\x4d\x65\x6d\x6f\x72\x69\x61\x6c\x20\x50\x69\x6c\x6c\x61\x72\x00\x4f\x75\x74\x63\x61\x73\x74\x92\x00\xa3"
+            "\x47\x72\x65\x65\x6e\x20\x50\x61\x74\x68\x4b\x00\x01\x0b\x00\x60\x52\x75\x69\x6e\x20\x56\x1c\x04\x93\x79\x00\x54\x72\x61\x69\x6e"
+            "\x65\x72\x28\x01\xf2\x14\x28\x65\x78\x74\x65\x72\x69\x6f\x72\x29\x00\x43\x61\x6e\x79\x6f\x6e\x20\x45\x6e\x74\x72\x61\x6e\x63\x65"
+            "\x00\x53\x65\x76\x61\x75\x6c\x74\x20\x18\x00\x80\x00\x54\x61\x6e\x6f\x62\x79\x20\x4b\x00\x11\x73\x06\x03\x56\x45\x6d\x62\x65\x72"
+            "\x0a\x00\x7c\x20\x52\x6f\x6f\x6d\x20\x31\x11\x00\x1c\x32\x11\x00\x17\x33\x11\x00\x03\x50\x03\x02\x0d\x00\x04\x5e\x03\x03\x0e\x00"
+            "\x19\x32\x0e\x00\x19\x33\x0e\x00\x19\x34\x0e\x00\x84\x35\x46\x00\x42\x65\x72\x72\x79\xbc\x03\x72\x49\x63\x65\x66\x61\x6c\x6c\x8a"
+            "\x03\x08\x0d\x00\x00\x70\x00\x09\x10\x00\x00\x73\x00\x0a\x11\x00\xf0\x04\x61\x63\x6b\x00\x50\x61\x74\x74\x65\x72\x6e\x20\x42\x75"
+            "\x73\x68\x00\x41\x6c\x20\x01\x22\x6e\x67\x4e\x00\x31\x4d\x6f\x6e\x30\x02\x21\x68\x61\xfd\x00\x65\x4c\x69\x70\x74\x6f\x6f\x0f\x00"
+            "\x65\x57\x65\x65\x70\x74\x68\x0f\x00\x75\x44\x69\x6c\x66\x6f\x72\x64\x10\x00\x65\x53\x63\x75\x66\x69\x62\x0f\x00\x45\x52\x69\x78"
+            "\x79\x0d\x00\x75\x56\x69\x61\x70\x6f\x69\x73\x10\x00\x00",
+            1294, 1917
+        },
+        // hgss_zh
+        {
+            "\xf3\xff\xff\x02\x78\x00\x00\x00\xe8\x01\x00\x00\xf6\x01\x00\x00\xff\x01\x00\x00\x10\x02\x00\x00\x19\x02\x00\x00\x22\x02\x00\x00"
+            "\x2e\x02\x00\x00\x3b\x02\x00\x00\x44\x02\x00\x00\x5c\x02\x00\x00\x73\x02\x00\x00\x81\x02\x00\x00\x90\x02\x00\x00\x9f\x02\x00\x00"
+            "\xa8\x02\x00\x00\xb9\x02\x00\x00\xcb\x02\x00\x00\xd7\x02\x00\x00\xe0\x02\x00\x00\xe9\x02\x00\x00\xf7\x02\x00\x00\x00\x03\x00\x00"
+            "\x09\x03\x00\x00\x17\x03\x00\x00\x27\x03\x00\x00\x38\x03\x00\x00\x43\x03\x00\x00\x4c\x03\x00\x00\x55\x03\x00\x00\x62\x03\x00\x00"
+            "\x6b\x03\x00\x00\x74\x03\x00\x00\x85\x03\x00\x00\x97\x03\x00\x00\xa9\x03\x00\x00\xbb\x03\x00\x00\xc9\x03\x00\x00\xd2\x03\x00\x00"
+            "\xe0\x03\x00\x00\xf5\x03\x00\x00\x03\x04\x00\x00\x12\x04\x00\x00\x1b\x04\x00\x00\x28\x04\x00\x00\x31\x04\x00\x00\x3d\x04\x00\x00"
+            "\x4a\x04\x00\x00\x57\x04\x00\x00\x64\x04\x00\x00\x74\x04\x00\x00\x83\x04\x00\x00\x8c\x04\x00\x00\x95\x04\x00\x00\xaa\x04\x00\x00"
+            "\xbf\x04\x00\x00\xc8\x04\x00\x00\xd1\x04\x00\x00\xe5\x04\x00\x00\xf8\x04\x00\x00\x0c\x05\x00\x00\x20\x05\x00\x00\x34\x05\x00\x00"
+            "\x48\x05\x00\x00\x56\x05\x00\x00\x6d\x05\x00\x00\x7b\x05\x00\x00\x8b\x05\x00\x00\x96\x05\x00\x00\xa1\x05\x00\x00\xaf\x05\x00\x00"
+            "\xcc\x05\x00\x00\xdf\x05\x00\x00\xee\x05\x00\x00\xf7\x05\x00\x00\x00\x06\x00\x00\x09\x06\x00\x00\x15\x06\x00\x00\x23\x06\x00\x00"
+            "\x31\x06\x00\x00\x40\x06\x00\x00\x4d\x06\x00\x00\x5a\x06\x00\x00\x6a\x06\x00\x00\x73\x06\x00\x00\x7c\x06\x00\x00\x85\x06\x00\x00"
+            "\x8e\x06\x00\x00\x97\x06\x00\x00\xa6\x06\x00\x00\xb5\x06\x00\x00\xc5\x06\x00\x00\xcd\x06\x00\x00\xdd\x06\x00\x00\xe5\x06\x00\x00"
+            "\xed\x06\x00\x00\xf5\x06\x00\x00\xfd\x06\x00\x00\x05\x07\x00\x00\x0d\x07\x00\x00\x15\x07\x00\x00\x1e\x07\x00\x00\x27\x07\x00\x00"
+            "\x30\x07\x00\x00\x39\x07\x00\x00\x42\x07\x00\x00\x4b\x07\x00\x00\x54\x07\x00\x00\x5d\x07\x00\x00\x66\x07\x00\x00\x6f\x07\x00\x00"
+            "\x78\x07\x00\x00\x81\x07\x00\x00\x8d\x07\x00\x00\x9e\x07\x00\x00\xae\x07\x00\x00\xbe\x07\x00\x00\xce\x07\x00\x00\xde\x07\x00\x00"
+            "\xef\x07\x00\x00\x00\x08\x00\x00\x12\x08\x00\x00\x4e\x65\x77\x20\x42\x61\x72\x6b\x20\x54\x6f\x77\x6e\x00\x52\x6f\x75\x74\x65\x20"
+            "\x32\x39\x00\x43\x68\x65\x72\x72\x79\x67\x72\x6f\x76\x65\x20\x43\x69\x74\x79\x1a\x00\x24\x33\x30\x09\x00\x82\x31\x00\x56\x69\x6f"
+            "\x6c\x65\x74\x1e\x00\x60\x53\x70\x72\x6f\x75\x74\x44\x00\x24\x65\x72\x22\x00\xfc\x0a\x32\x00\x52\x75\x69\x6e\x73\x20\x6f\x66\x20"
+            "\x41\x6c\x70\x68\x20\x28\x4f\x75\x74\x73\x69\x64\x65\x29\x18\x00\x22\x49\x6e\x17\x00\xd8\x55\x6e\x69\x6f\x6e\x20\x43\x61\x76\x65"
+            "\x20\x31\x46\x0e\x00\x1b\x42\x0f\x00\x24\x32\x46\x64\x00\xf0\x00\x33\x00\x53\x4c\x4f\x57\x50\x4f\x4b\x45\x20\x57\x65\x6c\x6c\x38"
+            "\x00\x0a\x11\x00\x00\x3b\x00\xb4\x49\x6c\x65\x78\x20\x46\x6f\x72\x65\x73\x74\x38\x00\x14\x34\x09\x00\xf4\x00\x35\x00\x4e\x61\x74"
+            "\x69\x6f\x6e\x61\x6c\x20\x50\x61\x72\x6b\x17\x00\x14\x36\x09\x00\xa2\x37\x00\x45\x63\x72\x75\x74\x65\x61\x6b\xe9\x00\x62\x42\x75"
+            "\x72\x6e\x65\x64\xe9\x00\x00\x6e\x00\x09\x10\x00\x00\x6d\x00\x10\x42\x76\x00\x09\x08\x01\x14\x38\x09\x00\x89\x39\x00\x4f\x6c\x69"
+            "\x76\x69\x6e\x52\x01\x14\x34\x52\x01\xf0\x01\x34\x31\x00\x57\x68\x69\x72\x6c\x20\x49\x73\x6c\x61\x6e\x64\x73\x5e\x00\x0a\x11\x00"
+            "\x00\x5f\x00\x0b\x12\x00\x1d\x32\x12\x00\xb9\x33\x46\x00\x43\x69\x61\x6e\x77\x6f\x6f\x64\x67\x00\xb1\x32\x00\x4d\x74\x2e\x20\x4d"
+            "\x6f\x72\x74\x61\xb9\x00\x09\x0e\x00\x78\x20\x28\x42\x61\x63\x6b\x29\x15\x00\x19\x32\x23\x00\x00\x7b\x00\x03\x49\x00\x60\x33\x00"
+            "\x4c\x61\x6b\x65\xbe\x01\x44\x52\x61\x67\x65\x16\x00\xa0\x34\x00\x49\x63\x65\x20\x50\x61\x74\x68\x5d\x00\x05\x0c\x00\x01\x7f\x01"
+            "\x05\x0d\x00\x18\x32\x0d\x00\xd2\x33\x46\x00\x42\x6c\x61\x63\x6b\x74\x68\x6f\x72\x6e\xab\x00\xd4\x44\x72\x61\x67\x6f\x6e\xe2\x80"
+            "\x99\x73\x20\x44\x65\x8d\x02\x24\x34\x35\x09\x00\x30\x36\x00\x44\xa9\x02\x01\x04\x02\x14\x28\x87\x02\x1e\x29\x15\x00\x34\x34\x35"
+            "\x29\x33\x00\x13\x37\xc5\x00\x25\x6f\x6e\x09\x00\xf8\x04\x20\x28\x43\x6c\x65\x66\x61\x69\x72\x79\x29\x00\x53\x65\x61\x66\x6f\x61"
+            "\x6d\x73\x01\x0c\x13\x00\x00\xc2\x00\x0d\x14\x00\x1f\x32\x14\x00\x00\x1f\x33\x14\x00\x00\x12\x34\x45\x01\x42\x53\x69\x6c\x76\x2f"
+            "\x02\x07\x0e\x00\x03\xe8\x02\x48\x20\x54\x6f\x70\x17\x00\xf3\x03\x34\x46\x00\x43\x6c\x69\x66\x66\x20\x45\x64\x67\x65\x20\x47\x61"
+            "\x74\x65\x10\x00\x00\x30\x00\x07\x29\x00\x08\x34\x00\x03\xac\x01\x08\x59\x00\x71\x4d\x6f\x75\x6e\x74\x61\x69\x5a\x03\x0d\x1d\x00"
+            "\x19\x33\x30\x00\x00\x81\x00\x02\x2f\x01\x24\x31\x32\x09\x00\x14\x39\x0a\x04\x50\x30\x00\x50\x61\x6c\xe7\x03\x01\x1f\x04\x73\x56"
+            "\x69\x72\x69\x64\x69\x61\xaf\x01\x64\x43\x65\x72\x75\x6c\x65\x0e\x00\x61\x56\x65\x72\x6d\x69\x6c\xa5\x03\x02\x1d\x00\x34\x6c\x61"
+            "\x64\x0d\x00\x73\x46\x75\x63\x68\x73\x69\x61\x1a\x00\x73\x69\x6e\x6e\x61\x62\x61\x72\x27\x01\x04\xab\x01\x04\x27\x03\x14\x32\x7c"
+            "\x03\x24\x32\x37\x09\x00\x16\x38\xc6\x01\xa1\x52\x6f\x63\x6b\x20\x54\x75\x6e\x6e\x65\xed\x03\x08\x0f\x00\xf2\x00\x32\x46\x00\x56"
+            "\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\x1f\x00\x01\xce\x00\x04\x48\x00\x74\x20\x28\x53\x6f\x75\x74\x68\x1e\x02\x14\x33\x7b"
+            "\x00\x03\x08\x00\x04\x69\x02\x04\x81\x00\x04\x80\x00\x04\x9a\x00\x04\x15\x01\x14\x31\xb3\x03\x14\x31\x5a\x00\x14\x31\x4b\x00\x14"
+            "\x31\x4c\x00\x14\x31\x4d\x00\x14\x31\x4e\x00\x14\x31\x4f\x00\x15\x31\xea\x00\x05\x99\x00\x04\x78\x01\x14\x32\x3f\x00\xf1\x07\x32"
+            "\x35\x00\x54\x6f\x68\x6a\x6f\x20\x46\x61\x6c\x6c\x73\x00\x44\x49\x47\x4c\x45\x54\x54\x1a\x03\x01\x08\x02\x09\xe9\x00\x0c\xf9\x00"
+            "\x14\x33\xf9\x00\x60\x32\x20\x28\x4e\x6f\x72\xf1\x00\x05\xb9\x01\x03\x07\x05\x06\xbb\x01\x03\x6e\x05\x0a\x11\x00\x1c\x32\x11\x00"
+            "\x00\x06\x03\x00",
+            1348, 2066
+        },
+        // natures_zh
+        {
+            "\xf0\xc5\x19\x00\x00\x00\x6c\x00\x00\x00\x73\x00\x00\x00\x7d\x00\x00\x00\x84\x00\x00\x00\x8b\x00\x00\x00\x92\x00\x00\x00\x99\x00"
+            "\x00\x00\xa0\x00\x00\x00\xa7\x00\x00\x00\xae\x00\x00\x00\xb5\x00\x00\x00\xbc\x00\x00\x00\xc3\x00\x00\x00\xca\x00\x00\x00\xd1\x00"
+            "\x00\x00\xd8\x00\x00\x00\xdf\x00\x00\x00\xe9\x00\x00\x00\xf0\x00\x00\x00\xf7\x00\x00\x00\xfe\x00\x00\x00\x05\x01\x00\x00\x0c\x01"
+            "\x00\x00\x13\x01\x00\x00\x1a\x01\x00\x00\x21\x01\x00\x00\xe5\x8b\xa4\xe5\xa5\x8b\x00\xe6\x80\x95\xe5\xaf\x82\xe5\xaf\x9e\x00\xe5"
+            "\x8b\x87\xe6\x95\xa2\x00\xe5\x9b\xba\xe6\x89\xa7\x00\xe9\xa1\xbd\xe7\x9a\xae\x00\xe5\xa4\xa7\xe8\x83\x86\x00\xe5\x9d\xa6\xe7\x8e"
+            "\x87\x00\xe6\x82\xa0\xe9\x97\xb2\x00\xe6\xb7\x98\xe6\xb0\x94\x00\xe4\xb9\x90\xe5\xa4\xa9\x00\xe8\x83\x86\xe5\xb0\x8f\x00\xe6\x80"
+            "\xa5\xe8\xba\x81\x00\xe8\xae\xa4\xe7\x9c\x9f\x00\xe7\x88\xbd\xe6\x9c\x97\x00\xe5\xa4\xa9\x0e\x00\xf0\x1d\xe5\x86\x85\xe6\x95\x9b"
+            "\x00\xe6\x85\xa2\xe5\x90\x9e\xe5\x90\x9e\x00\xe5\x86\xb7\xe9\x9d\x99\x00\xe5\xae\xb3\xe7\xbe\x9e\x00\xe9\xa9\xac\xe8\x99\x8e\x00"
+            "\xe6\xb8\xa9\xe5\x92\x8c\x07\x00\xf0\x06\xe9\xa1\xba\x00\xe8\x87\xaa\xe5\xa4\xa7\x00\xe6\x85\x8e\xe9\x87\x8d\x00\xe6\xb5\xae\x5e"
+            "\x00\x00",
+            290, 289
+        },
+        // powers_zh
+        {
+            "\xf0\x8e\x10\x00\x00\x00\x48\x00\x00\x00\x4f\x00\x00\x00\x56\x00\x00\x00\x5a\x00\x00\x00\x61\x00\x00\x00\x68\x00\x00\x00\x6c\x00"
+            "\x00\x00\x73\x00\x00\x00\x77\x00\x00\x00\x7b\x00\x00\x00\x7f\x00\x00\x00\x83\x00\x00\x00\x87\x00\x00\x00\x91\x00\x00\x00\x95\x00"
+            "\x00\x00\x99\x00\x00\x00\x9d\x00\x00\x00\xe6\xa0\xbc\xe6\x96\x97\x00\xe9\xa3\x9e\xe8\xa1\x8c\x00\xe6\xaf\x92\x00\xe5\x9c\xb0\xe9"
+            "\x9d\xa2\x00\xe5\xb2\xa9\xe7\x9f\xb3\x00\xe8\x99\xab\x00\xe5\xb9\xbd\xe7\x81\xb5\x00\xe9\x92\xa2\x00\xe7\x81\xab\x00\xe6\xb0\xb4"
+            "\x00\xe8\x8d\x89\x00\xe7\x94\xb5\x00\xe8\xb6\x85\xe8\x83\xbd\xe5\x8a\x9b\x00\xe5\x86\xb0\x00\xe9\xbe\x99\x00\xe6\x81\xb6\x00",
+            159, 157
+        },
+        // rse_zh
+        {
+            "\xf3\xff\x69\x56\x00\x00\x00\x60\x01\x00\x00\x6d\x01\x00\x00\x7d\x01\x00\x00\x8c\x01\x00\x00\x9b\x01\x00\x00\xa9\x01\x00\x00\xb7"
+            "\x01\x00\x00\xc7\x01\x00\x00\xd8\x01\x00\x00\xe2\x01\x00\x00\xec\x01\x00\x00\xf6\x01\x00\x00\x00\x02\x00\x00\x0a\x02\x00\x00\x14"
+            "\x02\x00\x00\x1e\x02\x00\x00\x28\x02\x00\x00\x32\x02\x00\x00\x3c\x02\x00\x00\x46\x02\x00\x00\x50\x02\x00\x00\x5a\x02\x00\x00\x64"
+            "\x02\x00\x00\x6e\x02\x00\x00\x78\x02\x00\x00\x82\x02\x00\x00\x8c\x02\x00\x00\x96\x02\x00\x00\xa0\x02\x00\x00\xaa\x02\x00\x00\xb4"
+            "\x02\x00\x00\xbe\x02\x00\x00\xc8\x02\x00\x00\xd2\x02\x00\x00\xdc\x02\x00\x00\xe6\x02\x00\x00\xf0\x02\x00\x00\xfa\x02\x00\x00\x04"
+            "\x03\x00\x00\x0e\x03\x00\x00\x18\x03\x00\x00\x22\x03\x00\x00\x2c\x03\x00\x00\x43\x03\x00\x00\x5a\x03\x00\x00\x6a\x03\x00\x00\x85"
+            "\x03\x00\x00\x96\x03\x00\x00\xa7\x03\x00\x00\xba\x03\x00\x00\xcd\x03\x00\x00\xe0\x03\x00\x00\xf3\x03\x00\x00\x06\x04\x00\x00\x19"
+            "\x04\x00\x00\x29\x04\x00\x00\x38\x04\x00\x00\x47\x04\x00\x00\x5f\x04\x00\x00\x77\x04\x00\x00\x8a\x04\x00\x00\x9d\x04\x00\x00\xb1"
+            "\x04\x00\x00\xc5\x04\x00\x00\xe0\x04\x00\x00\xef\x04\x00\x00\xfe\x04\x00\x00\x10\x05\x00\x00\x20\x05\x00\x00\x2b\x05\x00\x00\x3f"
+            "\x05\x00\x00\x4f\x05\x00\x00\x5f\x05\x00\x00\x70\x05\x00\x00\x81\x05\x00\x00\x99\x05\x00\x00\xa8\x05\x00\x00\xb3\x05\x00\x00\xbf"
+            "\x05\x00\x00\xcd\x05\x00\x00\xdb\x05\x00\x00\xe9\x05\x00\x00\xf7\x05\x00\x00\x04\x06\x00\x00\x11\x06\x00\x00\x22\x06\x00\x00\x30"
+            "\x06\x00\x00\x44\x65\x77\x66\x6f\x72\x64\x20\x54\x6f\x77\x6e\x00\x50\x61\x63\x69\x66\x69\x64\x6c\x6f\x67\x10\x00\xf2\x08\x65\x74"
+            "\x61\x6c\x62\x75\x72\x67\x20\x43\x69\x74\x79\x00\x53\x6c\x61\x74\x65\x70\x6f\x72\x74\x0f\x00\x82\x4c\x69\x6c\x79\x63\x6f\x76\x65"
+            "\x0e\x00\x83\x4d\x6f\x73\x73\x64\x65\x65\x70\x2b\x00\x92\x6f\x6f\x74\x6f\x70\x6f\x6c\x69\x73\x10\x00\xa3\x45\x76\x65\x72\x20\x47"
+            "\x72\x61\x6e\x64\x2f\x00\x95\x52\x6f\x75\x74\x65\x20\x31\x30\x31\x0a\x00\x15\x32\x0a\x00\x15\x33\x0a\x00\x15\x34\x0a\x00\x15\x35"
+            "\x0a\x00\x15\x36\x0a\x00\x15\x37\x0a\x00\x15\x38\x0a\x00\x14\x39\x0a\x00\x25\x31\x30\x0a\x00\x05\x64\x00\x15\x31\x64\x00\x15\x31"
+            "\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x31\x64\x00\x15\x32\x64\x00\x15\x32"
+            "\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32\x64\x00\x15\x32"
+            "\x64\x00\x15\x33\x64\x00\x15\x33\x64\x00\x15\x33\x64\x00\x15\x33\x64\x00\xf5\x00\x33\x34\x00\x55\x6e\x64\x65\x72\x77\x61\x74\x65"
+            "\x72\x20\x28\x7a\x00\x1f\x29\x17\x00\x02\x30\x36\x29\x00\x8e\x01\xba\x69\x74\x65\x20\x43\x61\x76\x65\x20\x31\x46\x10\x00\xda\x53"
+            "\x74\x65\x76\x65\x6e\x27\x73\x20\x52\x6f\x6f\x6d\x1b\x00\x1c\x42\x2c\x00\xfe\x07\x42\x32\x46\x00\x53\x61\x66\x61\x72\x69\x20\x5a"
+            "\x6f\x6e\x65\x20\x41\x72\x65\x61\x20\x31\x13\x00\x1e\x32\x13\x00\x1e\x33\x13\x00\x1e\x34\x13\x00\x1e\x35\x13\x00\x17\x36\x9c\x02"
+            "\xfb\x2c\x57\x6f\x6f\x64\x73\x00\x52\x75\x73\x74\x75\x72\x66\x20\x54\x75\x6e\x6e\x65\x6c\x00\x41\x62\x61\x6e\x64\x6f\x6e\x65\x64"
+            "\x20\x53\x68\x69\x70\x00\x4e\x65\x77\x20\x4d\x61\x75\x76\x69\x6c\x6c\x65\x20\x28\x45\x6e\x74\x72\x61\x6e\x63\x65\x29\x18\x00\xfd"
+            "\x0d\x42\x61\x73\x65\x6d\x65\x6e\x74\x29\x00\x4d\x65\x74\x65\x6f\x72\x20\x46\x61\x6c\x6c\x73\x20\x31\x46\x20\x31\x52\x13\x00\x1b"
+            "\x32\x13\x00\x1f\x42\x27\x00\x00\x00\x14\x00\x0c\x28\x00\x05\x5b\x01\x00\x3d\x01\x80\x00\x4d\x74\x2e\x20\x50\x79\x72\x82\x01\x36"
+            "\x2d\x33\x46\x0f\x00\x47\x34\x46\x2d\x36\x0f\x00\x86\x45\x78\x74\x65\x72\x69\x6f\x72\x12\x00\xc2\x53\x75\x6d\x6d\x69\x74\x00\x53"
+            "\x68\x6f\x61\x6c\x4b\x00\x06\x0b\x00\x42\x20\x49\x63\x65\xba\x01\x81\x53\x65\x61\x66\x6c\x6f\x6f\x72\x17\x00\xf0\x00\x72\x6e\x00"
+            "\x56\x69\x63\x74\x6f\x72\x79\x20\x52\x6f\x61\x64\xf5\x01\x09\x10\x00\x00\xda\x01\x0a\x11\x00\x31\x32\x46\x00\x50\x00\xa4\x6f\x66"
+            "\x20\x4f\x72\x69\x67\x69\x6e\x20\x3b\x01\x0b\x18\x00\xf0\x13\x00\x46\x69\x65\x72\x79\x20\x50\x61\x74\x68\x00\x4a\x61\x67\x67\x65"
+            "\x64\x20\x50\x61\x73\x73\x00\x53\x6b\x79\x20\x50\x69\x6c\x6c\x61\x72\x6e\x00\x07\x0e\x00\x19\x33\x0e\x00\xf0\x08\x35\x46\x00\x4d"
+            "\x61\x67\x6d\x61\x20\x48\x69\x64\x65\x6f\x75\x74\x00\x4d\x69\x72\x61\x67\x65\x86\x04\xa2\x65\x72\x00\x41\x72\x74\x69\x73\x61\x6e"
+            "\xe6\x00\x71\x44\x65\x73\x65\x72\x74\x20\xd5\x02\x10\x70\x63\x00\x20\x41\x6c\x1b\x01\x22\x6e\x67\x1f\x00\x00",
+            1051, 1584
+        },
+        // species_zh
+        {
+            "\xf0\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\x2c\x27\x03\x00\x00\xa4\x0c\x00\x00\xb1\x0c\x00\x00\xbb\x0c\x00\x00\xc5\x0c\x00\x00"
+            "\xcf\x0c\x00\x00\xd9\x0c\x00\x00\xe3\x0c\x00\x00\xed\x0c\x00\x00\xf7\x0c\x00\x00\x01\x0d\x00\x00\x0b\x0d\x00\x00\x15\x0d\x00\x00"
+            "\x1f\x0d\x00\x00\x29\x0d\x00\x00\x33\x0d\x00\x00\x3d\x0d\x00\x00\x44\x0d\x00\x00\x4e\x0d\x00\x00\x58\x0d\x00\x00\x62\x0d\x00\x00"
+            "\x69\x0d\x00\x00\x70\x0d\x00\x00\x7a\x0d\x00\x00\x84\x0d\x00\x00\x8e\x0d\x00\x00\x98\x0d\x00\x00\x9f\x0d\x00\x00\xa9\x0d\x00\x00"
+            "\xb3\x0d\x00\x00\xbd\x0d\x00\x00\xc7\x0d\x00\x00\xd1\x0d\x00\x00\xdb\x0d\x00\x00\xe8\x0d\x00\x00\xf2\x0d\x00\x00\xf9\x0d\x00\x00"
+            "\x03\x0e\x00\x00\x0a\x0e\x00\x00\x11\x0e\x00\x00\x18\x0e\x00\x00\x22\x0e\x00\x00\x2c\x0e\x00\x00\x36\x0e\x00\x00\x40\x0e\x00\x00"
+            "\x4a\x0e\x00\x00\x54\x0e\x00\x00\x5e\x0e\x00\x00\x6b\x0e\x00\x00\x72\x0e\x00\x00\x7c\x0e\x00\x00\x83\x0e\x00\x00\x8d\x0e\x00\x00"
+            "\x94\x0e\x00\x00\x9e\x0e\x00\x00\xa8\x0e\x00\x00\xb2\x0e\x00\x00\xb9\x0e\x00\x00\xc3\x0e\x00\x00\xcd\x0e\x00\x00\xd7\x0e\x00\x00"
+            "\xe4\x0e\x00\x00\xee\x0e\x00\x00\xfb\x0e\x00\x00\x02\x0f\x00\x00\x0c\x0f\x00\x00\x13\x0f\x00\x00\x1a\x0f\x00\x00\x21\x0f\x00\x00"
+            "\x28\x0f\x00\x00\x32\x0f\x00\x00\x3c\x0f\x00\x00\x46\x0f\x00\x00\x53\x0f\x00\x00\x60\x0f\x00\x00\x6a\x0f\x00\x00\x74\x0f\x00\x00"
+            "\x7e\x0f\x00\x00\x88\x0f\x00\x00\x92\x0f\x00\x00\x9c\x0f\x00\x00\xa6\x0f\x00\x00\xb0\x0f\x00\x00\xc0\x0f\x00\x00\xca\x0f\x00\x00"
+            "\xd1\x0f\x00\x00\xdb\x0f\x00\x00\xe5\x0f\x00\x00\xef\x0f\x00\x00\xf6\x0f\x00\x00\x00\x10\x00\x00\x0a\x10\x00\x00\x14\x10\x00\x00"
+            "\x1b\x10\x00\x00\x25\x10\x00\x00\x2c\x10\x00\x00\x36\x10\x00\x00\x40\x10\x00\x00\x4d\x10\x00\x00\x57\x10\x00\x00\x61\x10\x00\x00"
+            "\x6e\x10\x00\x00\x7b\x10\x00\x00\x82\x10\x00\x00\x8c\x10\x00\x00\x99\x10\x00\x00\xa6\x10\x00\x00\xb0\x10\x00\x00\xba\x10\x00\x00"
+            "\xc4\x10\x00\x00\xce\x10\x00\x00\xdb\x10\x00\x00\xe8\x10\x00\x00\xf5\x10\x00\x00\xff\x10\x00\x00\x09\x11\x00\x00\x10\x11\x00\x00"
+            "\x1a\x11\x00\x00\x24\x11\x00\x00\x2e\x11\x00\x00\x38\x11\x00\x00\x42\x11\x00\x00\x4f\x11\x00\x00\x5c\x11\x00\x00\x69\x11\x00\x00"
+            "\x73\x11\x00\x00\x7d\x11\x00\x00\x8a\x11\x00\x00\x94\x11\x00\x00\x9e\x11\x00\x00\xa8\x11\x00\x00\xb2\x11\x00\x00\xbf\x11\x00\x00"
+            "\xc9\x11\x00\x00\xd0\x11\x00\x00\xda\x11\x00\x00\xe4\x11\x00\x00\xee\x11\x00\x00\xf8\x11\x00\x00\x02\x12\x00\x00\x12\x12\x00\x00"
+            "\x1c\x12\x00\x00\x26\x12\x00\x00\x33\x12\x00\x00\x3d\x12\x00\x00\x47\x12\x00\x00\x51\x12\x00\x00\x5b\x12\x00\x00\x65\x12\x00\x00"
+            "\x6f\x12\x00\x00\x76\x12\x00\x00\x7d\x12\x00\x00\x84\x12\x00\x00\x8e\x12\x00\x00\x98\x12\x00\x00\xa2\x12\x00\x00\xac\x12\x00\x00"
+            "\xb6\x12\x00\x00\xc0\x12\x00\x00\xca\x12\x00\x00\xd1\x12\x00\x00\xdb\x12\x00\x00\xe2\x12\x00\x00\xec\x12\x00\x00\xf3\x12\x00\x00"
+            "\x00\x13\x00\x00\x0a\x13\x00\x00\x14\x13\x00\x00\x1e\x13\x00\x00\x2b\x13\x00\x00\x35\x13\x00\x00\x3f\x13\x00\x00\x49\x13\x00\x00"
+            "\x50\x13\x00\x00\x5a\x13\x00\x00\x64\x13\x00\x00\x6e\x13\x00\x00\x7b\x13\x00\x00\x85\x13\x00\x00\x8f\x13\x00\x00\x99\x13\x00\x00"
+            "\xa3\x13\x00\x00\xaa\x13\x00\x00\xb4\x13\x00\x00\xbe\x13\x00\x00\xcb\x13\x00\x00\xd5\x13\x00\x00\xe2\x13\x00\x00\xec\x13\x00\x00"
+            "\xf6\x13\x00\x00\x00\x14\x00\x00\x0d\x14\x00\x00\x1a\x14\x00\x00\x27\x14\x00\x00\x31\x14\x00\x00\x38\x14\x00\x00\x3f\x14\x00\x00"
+            "\x4c\x14\x00\x00\x59\x14\x00\x00\x63\x14\x00\x00\x6d\x14\x00\x00\x74\x14\x00\x00\x81\x14\x00\x00\x8b\x14\x00\x00\x95\x14\x00\x00"
+            "\x9f\x14\x00\x00\xac\x14\x00\x00\xb9\x14\x00\x00\xc0\x14\x00\x00\xca\x14\x00\x00\xd1\x14\x00\x00\xdb\x14\x00\x00\xe5\x14\x00\x00"
+            "\xf2\x14\x00\x00\xf9\x14\x00\x00\x09\x15\x00\x00\x10\x15\x00\x00\x1a\x15\x00\x00\x24\x15\x00\x00\x2e\x15\x00\x00\x3b\x15\x00\x00"
+            "\x45\x15\x00\x00\x4f\x15\x00\x00\x5c\x15\x00\x00\x66\x15\x00\x00\x70\x15\x00\x00\x7a\x15\x00\x00\x87\x15\x00\x00\x91\x15\x00\x00"
+            "\x9b\x15\x00\x00\xa5\x15\x00\x00\xaf\x15\x00\x00\xb9\x15\x00\x00\xc0\x15\x00\x00\xcd\x15\x00\x00\xd7\x15\x00\x00\xe1\x15\x00\x00"
+            "\xee\x15\x00\x00\xf8\x15\x00\x00\x02\x16\x00\x00\x0c\x16\x00\x00\x19\x16\x00\x00\x23\x16\x00\x00\x2d\x16\x00\x00\x34\x16\x00\x00"
+            "\x3b\x16\x00\x00\x42\x16\x00\x00\x4f\x16\x00\x00\x5c\x16\x00\x00\x69\x16\x00\x00\x73\x16\x00\x00\x7a\x16\x00\x00\x84\x16\x00\x00"
+            "\x8e\x16\x00\x00\x9b\x16\x00\x00\xa5\x16\x00\x00\xaf\x16\x00\x00\xb9\x16\x00\x00\xc3\x16\x00\x00\xcd\x16\x00\x00\xd7\x16\x00\x00"
+            "\xe1\x16\x00\x00\xeb\x16\x00\x00\xf5\x16\x00\x00\xff\x16\x00\x00\x09\x17\x00\x00\x13\x17\x00\x00\x1d\x17\x00\x00\x2a\x17\x00\x00"
+            "\x34\x17\x00\x00\x3e\x17\x00\x00\x4b\x17\x00\x00\x58\x17\x00\x00\x65\x17\x00\x00\x6f\x17\x00\x00\x79\x17\x00\x00\x86\x17\x00\x00"
+            "\x90\x17\x00\x00\x9a\x17\x00\x00\xa4\x17\x00\x00\xae\x17\x00\x00\xbb\x17\x00\x00\xc8\x17\x00\x00\xd2\x17\x00\x00\xdf\x17\x00\x00"
+            "\xe9\x17\x00\x00\xf3\x17\x00\x00\xfd\x17\x00\x00\x07\x18\x00\x00\x11\x18\x00\x00\x1b\x18\x00\x00\x28\x18\x00\x00\x35\x18\x00\x00"
+            "\x42\x18\x00\x00\x4c\x18\x00\x00\x56\x18\x00\x00\x60\x18\x00\x00\x6d\x18\x00\x00\x7a\x18\x00\x00\x84\x18\x00\x00\x8e\x18\x00\x00"
+            "\x98\x18\x00\x00\xa2\x18\x00\x00\xac\x18\x00\x00\xb6\x18\x00\x00\xc3\x18\x00\x00\xcd\x18\x00\x00\xdd\x18\x00\x00\xe7\x18\x00\x00"
+            "\xf1\x18\x00\x00\xfb\x18\x00\x00\x05\x19\x00\x00\x12\x19\x00\x00\x1f\x19\x00\x00\x29\x19\x00\x00\x33\x19\x00\x00\x3d\x19\x00\x00"
+            "\x47\x19\x00\x00\x51\x19\x00\x00\x5b\x19\x00\x00\x65\x19\x00\x00\x6f\x19\x00\x00\x79\x19\x00\x00\x83\x19\x00\x00\x8d\x19\x00\x00"
+            "\x97\x19\x00\x00\xa1\x19\x00\x00\xab\x19\x00\x00\xb5\x19\x00\x00\xbf\x19\x00\x00\xcf\x19\x00\x00\xdc\x19\x00\x00\xec\x19\x00\x00"
+            "\xfc\x19\x00\x00\x06\x1a\x00\x00\x13\x1a\x00\x00\x1d\x1a\x00\x00\x27\x1a\x00\x00\x2e\x1a\x00\x00\x38\x1a\x00\x00\x42\x1a\x00\x00"
+            "\x4c\x1a\x00\x00\x59\x1a\x00\x00\x66\x1a\x00\x00\x70\x1a\x00\x00\x7d\x1a\x00\x00\x8a\x1a\x00\x00\x97\x1a\x00\x00\xa4\x1a\x00\x00"
+            "\xb1\x1a\x00\x00\xbb\x1a\x00\x00\xc5\x1a\x00\x00\xd2\x1a\x00\x00\xdc\x1a\x00\x00\xe9\x1a\x00\x00\xf6\x1a\x00\x00\x00\x1b\x00\x00"
+            "\x0d\x1b\x00\x00\x17\x1b\x00\x00\x21\x1b\x00\x00\x2e\x1b\x00\x00\x38\x1b\x00\x00\x42\x1b\x00\x00\x4c\x1b\x00\x00\x56\x1b\x00\x00"
+            "\x60\x1b\x00\x00\x6d\x1b\x00\x00\x77\x1b\x00\x00\x81\x1b\x00\x00\x8b\x1b\x00\x00\x98\x1b\x00\x00\xa2\x1b\x00\x00\xac\x1b\x00\x00"
+            "\xb6\x1b\x00\x00\xc0\x1b\x00\x00\xca\x1b\x00\x00\xd4\x1b\x00\x00\xde\x1b\x00\x00\xeb\x1b\x00\x00\xf8\x1b\x00\x00\x08\x1c\x00\x00"
+            "\x15\x1c\x00\x00\x22\x1c\x00\x00\x2c\x1c\x00\x00\x36\x1c\x00\x00\x40\x1c\x00\x00\x4a\x1c\x00\x00\x5a\x1c\x00\x00\x64\x1c\x00\x00"
+            "\x6e\x1c\x00\x00\x78\x1c\x00\x00\x85\x1c\x00\x00\x8f\x1c\x00\x00\x99\x1c\x00\x00\xa3\x1c\x00\x00\xad\x1c\x00\x00\xba\x1c\x00\x00"
+            "\xc4\x1c\x00\x00\xce\x1c\x00\x00\xd8\x1c\x00\x00\xe2\x1c\x00\x00\xec\x1c\x00\x00\xf6\x1c\x00\x00\x00\x1d\x00\x00\x0a\x1d\x00\x00"
+            "\x14\x1d\x00\x00\x1e\x1d\x00\x00\x28\x1d\x00\x00\x35\x1d\x00\x00\x3f\x1d\x00\x00\x49\x1d\x00\x00\x53\x1d\x00\x00\x5d\x1d\x00\x00"
+            "\x67\x1d\x00\x00\x74\x1d\x00\x00\x7e\x1d\x00\x00\x88\x1d\x00\x00\x92\x1d\x00\x00\x9f\x1d\x00\x00\xa9\x1d\x00\x00\xb3\x1d\x00\x00"
+            "\xbd\x1d\x00\x00\xc7\x1d\x00\x00\xd4\x1d\x00\x00\xde\x1d\x00\x00\xeb\x1d\x00\x00\xf5\x1d\x00\x00\xff\x1d\x00\x00\x09\x1e\x00\x00"
+            "\x13\x1e\x00\x00\x1d\x1e\x00\x00\x2a\x1e\x00\x00\x34\x1e\x00\x00\x3e\x1e\x00\x00\x48\x1e\x00\x00\x52\x1e\x00\x00\x5f\x1e\x00\x00"
+            "\x69\x1e\x00\x00\x73\x1e\x00\x00\x7d\x1e\x00\x00\x87\x1e\x00\x00\x91\x1e\x00\x00\x9b\x1e\x00\x00\xa5\x1e\x00\x00\xaf\x1e\x00\x00"
+            "\xbc\x1e\x00\x00\xc9\x1e\x00\x00\xd6\x1e\x00\x00\xe0\x1e\x00\x00\xed\x1e\x00\x00\xf7\x1e\x00\x00\x01\x1f\x00\x00\x0b\x1f\x00\x00"
+            "\x15\x1f\x00\x00\x1f\x1f\x00\x00\x29\x1f\x00\x00\x33\x1f\x00\x00\x3d\x1f\x00\x00\x47\x1f\x00\x00\x54\x1f\x00\x00\x5e\x1f\x00\x00"
+            "\x68\x1f\x00\x00\x72\x1f\x00\x00\x7f\x1f\x00\x00\x89\x1f\x00\x00\x96\x1f\x00\x00\xa0\x1f\x00\x00\xad\x1f\x00\x00\xba\x1f\x00\x00"
+            "\xc7\x1f\x00\x00\xd4\x1f\x00\x00\xde\x1f\x00\x00\xe8\x1f\x00\x00\xf2\x1f\x00\x00\xfc\x1f\x00\x00\x09\x20\x00\x00\x16\x20\x00\x00"
+            "\x23\x20\x00\x00\x30\x20\x00\x00\x3a\x20\x00\x00\x44\x20\x00\x00\x4e\x20\x00\x00\x5b\x20\x00\x00\x68\x20\x00\x00\x75\x20\x00\x00"
+            "\x82\x20\x00\x00\x8f\x20\x00\x00\x9f\x20\x00\x00\xac\x20\x00\x00\xbc\x20\x00\x00\xc6\x20\x00\x00\xd0\x20\x00\x00\xdd\x20\x00\x00"
+            "\xe4\x20\x00\x00\xf1\x20\x00\x00\xfe\x20\x00\x00\x08\x21\x00\x00\x12\x21\x00\x00\x1c\x21\x00\x00\x26\x21\x00\x00\x30\x21\x00\x00"
+            "\x3a\x21\x00\x00\x44\x21\x00\x00\x4e\x21\x00\x00\x58\x21\x00\x00\x62\x21\x00\x00\x6c\x21\x00\x00\x76\x21\x00\x00\x80\x21\x00\x00"
+            "\x8a\x21\x00\x00\x94\x21\x00\x00\x9b\x21\x00\x00\xa5\x21\x00\x00\xaf\x21\x00\x00\xb9\x21\x00\x00\xc3\x21\x00\x00\xcd\x21\x00\x00"
+            "\xd7\x21\x00\x00\xe1\x21\x00\x00\xeb\x21\x00\x00\xf5\x21\x00\x00\xff\x21\x00\x00\x0c\x22\x00\x00\x16\x22\x00\x00\x23\x22\x00\x00"
+            "\x2d\x22\x00\x00\x37\x22\x00\x00\x41\x22\x00\x00\x4e\x22\x00\x00\x58\x22\x00\x00\x65\x22\x00\x00\x72\x22\x00\x00\x82\x22\x00\x00"
+            "\x8f\x22\x00\x00\x9c\x22\x00\x00\xa9\x22\x00\x00\xb3\x22\x00\x00\xbd\x22\x00\x00\xc7\x22\x00\x00\xd1\x22\x00\x00\xdb\x22\x00\x00"
+            "\xe5\x22\x00\x00\xef\x22\x00\x00\xf9\x22\x00\x00\x06\x23\x00\x00\x10\x23\x00\x00\x1a\x23\x00\x00\x24\x23\x00\x00\x2e\x23\x00\x00"
+            "\x3e\x23\x00\x00\x4b\x23\x00\x00\x58\x23\x00\x00\x62\x23\x00\x00\x6c\x23\x00\x00\x76\x23\x00\x00\x86\x23\x00\x00\x93\x23\x00\x00"
+            "\xa3\x23\x00\x00\xad\x23\x00\x00\xba\x23\x00\x00\xc7\x23\x00\x00\xd4\x23\x00\x00\xde\x23\x00\x00\xeb\x23\x00\x00\xf5\x23\x00\x00"
+            "\x02\x24\x00\x00\x0f\x24\x00\x00\x1c\x24\x00\x00\x29\x24\x00\x00\x33\x24\x00\x00\x3d\x24\x00\x00\x47\x24\x00\x00\x54\x24\x00\x00"
+            "\x61\x24\x00\x00\x6e\x24\x00\x00\x7b\x24\x00\x00\x88\x24\x00\x00\x95\x24\x00\x00\xa5\x24\x00\x00\xb5\x24\x00\x00\xc5\x24\x00\x00"
+            "\xcf\x24\x00\x00\xd9\x24\x00\x00\xe3\x24\x00\x00\xed\x24\x00\x00\xfd\x24\x00\x00\x07\x25\x00\x00\x11\x25\x00\x00\x1b\x25\x00\x00"
+            "\x25\x25\x00\x00\x32\x25\x00\x00\x3f\x25\x00\x00\x4c\x25\x00\x00\x56\x25\x00\x00\x60\x25\x00\x00\x6d\x25\x00\x00\x77\x25\x00\x00"
+            "\x81\x25\x00\x00\x8e\x25\x00\x00\x9b\x25\x00\x00\xa5\x25\x00\x00\xaf\x25\x00\x00\xb9\x25\x00\x00\xc6\x25\x00\x00\xd0\x25\x00\x00"
+            "\xe0\x25\x00\x00\xea\x25\x00\x00\xf4\x25\x00\x00\xfe\x25\x00\x00\x0b\x26\x00\x00\x1b\x26\x00\x00\x22\x26\x00\x00\x2c\x26\x00\x00"
+            "\x39\x26\x00\x00\x43\x26\x00\x00\x4d\x26\x00\x00\x5a\x26\x00\x00\x64\x26\x00\x00\x6e\x26\x00\x00\x78\x26\x00\x00\x82\x26\x00\x00"
+            "\x8c\x26\x00\x00\x96\x26\x00\x00\xa3\x26\x00\x00\xb0\x26\x00\x00\xbd\x26\x00\x00\xca\x26\x00\x00\xda\x26\x00\x00\xe7\x26\x00\x00"
+            "\xf4\x26\x00\x00\x01\x27\x00\x00\x0b\x27\x00\x00\x15\x27\x00\x00\x1c\x27\x00\x00\x26\x27\x00\x00\x33\x27\x00\x00\x40\x27\x00\x00"
+            "\x4a\x27\x00\x00\x54\x27\x00\x00\x61\x27\x00\x00\x6e\x27\x00\x00\x7b\x27\x00\x00\x85\x27\x00\x00\x8f\x27\x00\x00\x9c\x27\x00\x00"
+            "\xa9\x27\x00\x00\xb3\x27\x00\x00\xbd\x27\x00\x00\xca\x27\x00\x00\xd7\x27\x00\x00\xe7\x27\x00\x00\xf1\x27\x00\x00\xfe\x58\x00\xf3"
+            "\xff\xff\x6e\x28\x00\x00\x15\x28\x00\x00\x22\x28\x00\x00\x2f\x28\x00\x00\x3c\x28\x00\x00\x46\x28\x00\x00\x53\x28\x00\x00\x5d\x28"
+            "\x00\x00\x67\x28\x00\x00\x71\x28\x00\x00\x7b\x28\x00\x00\x85\x28\x00\x00\x8f\x28\x00\x00\x99\x28\x00\x00\xa3\x28\x00\x00\xad\x28"
+            "\x00\x00\xb7\x28\x00\x00\xc1\x28\x00\x00\xcb\x28\x00\x00\xd8\x28\x00\x00\xe5\x28\x00\x00\xf2\x28\x00\x00\xff\x28\x00\x00\x0c\x29"
+            "\x00\x00\x19\x29\x00\x00\x20\x29\x00\x00\x2d\x29\x00\x00\x37\x29\x00\x00\x41\x29\x00\x00\x4e\x29\x00\x00\x58\x29\x00\x00\x62\x29"
+            "\x00\x00\x6f\x29\x00\x00\x79\x29\x00\x00\x83\x29\x00\x00\x8d\x29\x00\x00\x97\x29\x00\x00\xa4\x29\x00\x00\xae\x29\x00\x00\xb8\x29"
+            "\x00\x00\xc5\x29\x00\x00\xd2\x29\x00\x00\xdc\x29\x00\x00\xe9\x29\x00\x00\xf6\x29\x00\x00\x00\x2a\x00\x00\x0a\x2a\x00\x00\x17\x2a"
+            "\x00\x00\x24\x2a\x00\x00\x31\x2a\x00\x00\x3b\x2a\x00\x00\x45\x2a\x00\x00\x4f\x2a\x00\x00\x59\x2a\x00\x00\x63\x2a\x00\x00\x6d\x2a"
+            "\x00\x00\x77\x2a\x00\x00\x81\x2a\x00\x00\x8b\x2a\x00\x00\x98\x2a\x00\x00\x9f\x2a\x00\x00\xa9\x2a\x00\x00\xb0\x2a\x00\x00\xba\x2a"
+            "\x00\x00\xca\x2a\x00\x00\xda\x2a\x00\x00\xe7\x2a\x00\x00\xf1\x2a\x00\x00\xf8\x2a\x00\x00\x08\x2b\x00\x00\x12\x2b\x00\x00\x1c\x2b"
+            "\x00\x00\x29\x2b\x00\x00\x33\x2b\x00\x00\x3d\x2b\x00\x00\x4d\x2b\x00\x00\x5a\x2b\x00\x00\x67\x2b\x00\x00\x74\x2b\x00\x00\x7e\x2b"
+            "\x00\x00\x8b\x2b\x00\x00\x98\x2b\x00\x00\xa2\x2b\x00\x00\xaf\x2b\x00\x00\xbf\x2b\x00\x00\xc9\x2b\x00\x00\xd6\x2b\x00\x00\xe0\x2b"
+            "\x00\x00\xed\x2b\x00\x00\xf7\x2b\x00\x00\xfe\x2b\x00\x00\x0b\x2c\x00\x00\x15\x2c\x00\x00\x22\x2c\x00\x00\x2c\x2c\x00\x00\x36\x2c"
+            "\x00\x00\x40\x2c\x00\x00\x4a\x2c\x00\x00\x57\x2c\x00\x00\x5e\x2c\x00\x00\x68\x2c\x00\x00\x72\x2c\x00\x00\x7c\x2c\x00\x00\x86\x2c"
+            "\x00\x00\x93\x2c\x00\x00\xa0\x2c\x00\x00\xaa\x2c\x00\x00\xb4\x2c\x00\x00\xbe\x2c\x00\x00\xc8\x2c\x00\x00\xd2\x2c\x00\x00\xdf\x2c"
+            "\x00\x00\xec\x2c\x00\x00\xf6\x2c\x00\x00\x00\x2d\x00\x00\x0a\x2d\x00\x00\x17\x2d\x00\x00\x21\x2d\x00\x00\x2e\x2d\x00\x00\x38\x2d"
+            "\x00\x00\x45\x2d\x00\x00\x52\x2d\x00\x00\x5c\x2d\x00\x00\x69\x2d\x00\x00\x76\x2d\x00\x00\x86\x2d\x00\x00\x90\x2d\x00\x00\xa0\x2d"
+            "\x00\x00\xaa\x2d\x00\x00\xb7\x2d\x00\x00\xc1\x2d\x00\x00\xcb\x2d\x00\x00\xdb\x2d\x00\x00\xeb\x2d\x00\x00\xfb\x2d\x00\x00\x0b\x2e"
+            "\x00\x00\x1b\x2e\x00\x00\x28\x2e\x00\x00\x35\x2e\x00\x00\x45\x2e\x00\x00\x52\x2e\x00\x00\x5f\x2e\x00\x00\x69\x2e\x00\x00\x76\x2e"
+            "\x00\x00\x80\x2e\x00\x00\x8d\x2e\x00\x00\x97\x2e\x00\x00\xa4\x2e\x00\x00\xb4\x2e\x00\x00\xc1\x2e\x00\x00\xcb\x2e\x00\x00\xd5\x2e"
+            "\x00\x00\xe2\x2e\x00\x00\xec\x2e\x00\x00\xf9\x2e\x00\x00\x06\x2f\x00\x00\xe5\xa6\x99\xe8\x9b\x99\xe7\xa7\x8d\xe5\xad\x90\x0d\x00"
+            "\x34\xe8\x8d\x89\x0a\x00\xf0\x04\x8a\xb1\x00\xe5\xb0\x8f\xe7\x81\xab\xe9\xbe\x99\x00\xe7\x81\xab\xe6\x81\x90\x0a\x00\x33\xe5\x96"
+            "\xb7\x14\x00\xf0\x01\xe6\x9d\xb0\xe5\xb0\xbc\xe9\xbe\x9f\x00\xe5\x8d\xa1\xe5\x92\xaa\x0a\x00\x60\xe6\xb0\xb4\xe7\xae\xad\x0a\x00"
+            "\xf3\x15\xe7\xbb\xbf\xe6\xaf\x9b\xe8\x99\xab\x00\xe9\x93\x81\xe7\x94\xb2\xe8\x9b\xb9\x00\xe5\xb7\xb4\xe5\xa4\xa7\xe8\x9d\xb6\x00"
+            "\xe7\x8b\xac\xe8\xa7\x92\x1e\x00\x31\xe5\xa3\xb3\x1e\x00\xf0\x0a\xa4\xa7\xe9\x92\x88\xe8\x9c\x82\x00\xe6\xb3\xa2\xe6\xb3\xa2\x00"
+            "\xe6\xaf\x94\xe6\xaf\x94\xe9\xb8\x9f\x1b\x00\x04\x0a\x00\x93\xb0\x8f\xe6\x8b\x89\xe8\xbe\xbe\x00\x07\x00\x60\xe7\x83\x88\xe9\x9b"
+            "\x80\x22\x00\x30\xe5\x98\xb4\x0a\x00\x93\xe9\x98\xbf\xe6\x9f\x8f\xe8\x9b\x87\x0a\x00\xf0\x02\xe6\x80\xaa\x00\xe7\x9a\xae\xe5\x8d"
+            "\xa1\xe4\xb8\x98\x00\xe9\x9b\xb7\x07\x00\x93\xe7\xa9\xbf\xe5\xb1\xb1\xe9\xbc\xa0\x0a\x00\xd4\xe7\x8e\x8b\x00\xe5\xb0\xbc\xe5\xa4"
+            "\x9a\xe5\x85\xb0\x0a\x00\x24\xa8\x9c\x0a\x00\x23\x90\x8e\x0a\x00\x34\xe6\x9c\x97\x14\x00\x53\x8a\x9b\xe8\xaf\xba\x0d\x00\x00\x3f"
+            "\x00\x61\xe7\x9a\xae\xe7\x9a\xae\x6b\x00\xf0\x01\x8f\xaf\xe8\xa5\xbf\x00\xe5\x85\xad\xe5\xb0\xbe\x00\xe4\xb9\x9d\x07\x00\x60\xe8"
+            "\x83\x96\xe4\xb8\x81\x07\x00\x31\xe5\x8f\xaf\x0a\x00\x83\xb6\x85\xe9\x9f\xb3\xe8\x9d\xa0\xbc\x00\x00\x0a\x00\x60\xe8\xb5\xb0\xe8"
+            "\xb7\xaf\x85\x01\x30\xe8\x87\xad\x03\x00\x90\x8a\xb1\x00\xe9\x9c\xb8\xe7\x8e\x8b\x0a\x00\x96\xe6\xb4\xbe\xe6\x8b\x89\xe6\x96\xaf"
+            "\x0a\x00\xf0\x09\xe7\x89\xb9\x00\xe6\xaf\x9b\xe7\x90\x83\x00\xe6\x91\xa9\xe9\xb2\x81\xe8\x9b\xbe\x00\xe5\x9c\xb0\xda\x00\x33\xe4"
+            "\xb8\x89\x0a\x00\xf0\x02\xe5\x96\xb5\xe5\x96\xb5\x00\xe7\x8c\xab\xe8\x80\x81\xe5\xa4\xa7\x00\xa2\x00\x93\xbe\xbe\xe9\xb8\xad\x00"
+            "\xe5\x93\xa5\x0a\x00\x31\xe7\x8c\xb4\x2b\x01\x80\x81\xab\xe6\x9a\xb4\xe7\x8c\xb4\xd6\x01\xd0\xe8\x92\x82\xe7\x8b\x97\x00\xe9\xa3"
+            "\x8e\xe9\x80\x9f\x0a\x00\xc3\xe8\x9a\x8a\xe9\xa6\x99\xe8\x9d\x8c\xe8\x9a\xaa\x0d\x00\x33\xe5\x90\x9b\x0a\x00\x92\xe6\xb3\xb3\xe5"
+            "\xa3\xab\x00\xe5\x87\xff\x00\xf0\x0b\x8b\x87\xe5\x9f\xba\xe6\x8b\x89\x00\xe8\x83\xa1\xe5\x9c\xb0\x00\xe8\x85\x95\xe5\x8a\x9b\x00"
+            "\xe8\xb1\xaa\x07\x00\x21\xe6\x80\x07\x00\xf1\x01\xe5\x96\x87\xe5\x8f\xad\xe8\x8a\xbd\x00\xe5\x8f\xa3\xe5\x91\x86\x77\x02\x50\xa4"
+            "\xa7\xe9\xa3\x9f\x0a\x00\xf3\x04\xe7\x8e\x9b\xe7\x91\x99\xe6\xb0\xb4\xe6\xaf\x8d\x00\xe6\xaf\x92\xe5\x88\xba\x0d\x00\x01\x08\x02"
+            "\xb6\xb3\xe7\x9f\xb3\x00\xe9\x9a\x86\xe9\x9a\x86\x0a\x00\x34\xe5\xb2\xa9\xb9\x02\x20\xa9\xac\x1f\x02\x30\xe7\x84\xb0\x0a\x00\x30"
+            "\xe5\x91\x86\x03\x00\x21\x85\xbd\x0a\x00\x21\xa3\xb3\x0a\x00\x50\xb0\x8f\xe7\xa3\x81\xf7\x00\x00\x2d\x01\x53\x90\x88\xe4\xb8\x80"
+            "\x10\x00\x00\xa8\x02\x21\x91\xb1\x22\x01\x53\x98\x9f\xe5\x98\x9f\x07\x00\x21\xe5\x88\x5d\x00\xa3\xe6\xb5\xb7\xe7\x8b\xae\x00\xe7"
+            "\x99\xbd\x0a\x00\x63\xe8\x87\xad\xe6\xb3\xa5\xb6\x01\x00\x0a\x00\x00\x40\x00\x90\x88\x8c\xe8\xb4\x9d\x00\xe5\x88\xba\xff\x02\x60"
+            "\xb4\x9d\x00\xe9\xac\xbc\xbd\x01\x02\x07\x00\xa1\xe9\x80\x9a\x00\xe8\x80\xbf\xe9\xac\xbc\x00\x02\x20\xb2\xa9\xb2\x02\xf2\x07\xe5"
+            "\x82\xac\xe7\x9c\xa0\xe8\xb2\x98\x00\xe5\xbc\x95\xe6\xa2\xa6\xe8\xb2\x98\xe4\xba\xba\x1a\x03\x30\xb3\xe8\x9f\x42\x03\x13\xa8\x0a"
+            "\x00\x90\xe9\x9c\xb9\xe9\x9b\xb3\xe7\x94\xb5\xfc\x01\xf0\x0e\xe9\xa1\xbd\xe7\x9a\xae\xe9\x9b\xb7\xe5\xbc\xb9\x00\xe8\x9b\x8b\xe8"
+            "\x9b\x8b\x00\xe6\xa4\xb0\xe8\x9b\x8b\xe6\xa0\x91\xc9\x01\x32\xe6\x8b\x89\x06\x00\x72\x00\xe5\x98\x8e\xe5\x95\xa6\x06\x00\xf1\x02"
+            "\x00\xe9\xa3\x9e\xe8\x85\xbf\xe9\x83\x8e\x00\xe5\xbf\xab\xe6\x8b\xb3\x0a\x00\x01\xba\x00\xa0\xe5\xa4\xb4\x00\xe7\x93\xa6\xe6\x96"
+            "\xaf\x53\x00\x62\xe5\x8f\x8c\xe5\xbc\xb9\x10\x00\x03\xbc\x03\xa2\xe7\x8a\x80\xe7\x89\x9b\x00\xe9\x92\xbb\x0d\x00\x01\x4f\x01\x50"
+            "\x90\x89\xe5\x88\xa9\x7d\x00\x60\xe8\x94\x93\xe8\x97\xa4\x49\x01\x31\xe8\xa2\x8b\x1b\x00\x50\xa2\xa8\xe6\xb5\xb7\x88\x01\x60\xe6"
+            "\xb5\xb7\xe5\x88\xba\x41\x04\xa2\xe8\xa7\x92\xe9\x87\x91\xe9\xb1\xbc\x00\x07\x00\x00\x46\x03\x70\xe6\xb5\xb7\xe6\x98\x9f\xe6\x71"
+            "\x01\x52\xae\x9d\xe7\x9f\xb3\x10\x00\xd0\x00\xe9\xad\x94\xe5\xa2\x99\xe4\xba\xba\xe5\x81\xb6\xb6\x00\xf0\x0b\xe5\xa4\xa9\xe8\x9e"
+            "\xb3\xe8\x9e\x82\x00\xe8\xbf\xb7\xe5\x94\x87\xe5\xa7\x90\x00\xe7\x94\xb5\xe5\x87\xbb\x6d\x00\x91\xe9\xb8\xad\xe5\x98\xb4\xe7\x81"
+            "\xab\x7a\x00\x50\x87\xaf\xe7\xbd\x97\xb9\x00\xd4\xe8\x82\xaf\xe6\xb3\xb0\xe7\xbd\x97\x00\xe9\xb2\xa4\x70\x00\x20\x9a\xb4\x0d\x00"
+            "\x00\xcf\x04\x53\x8b\x89\xe6\x99\xae\x61\x03\x61\xe7\x99\xbe\xe5\x8f\x98\x19\x02\x50\xbc\x8a\xe5\xb8\x83\xd9\x04\x03\x0a\x00\x00"
+            "\x42\x04\x02\x0a\x00\x33\xe7\x81\xab\x0a\x00\x60\xe5\xa4\x9a\xe8\xbe\xb9\x6e\x00\x52\xe8\x8f\x8a\xe7\x9f\x5c\x02\x57\xa4\x9a\xe5"
+            "\x88\xba\x10\x00\xf0\x00\x8c\x96\xe7\x9f\xb3\xe7\x9b\x94\x00\xe9\x95\xb0\xe5\x88\x80\x0a\x00\x03\x14\x00\x21\xbf\xbc\x5a\x05\x50"
+            "\x8d\xa1\xe6\xaf\x94\x2b\x00\x60\xe6\x80\xa5\xe5\x86\xbb\xef\x04\x60\xe9\x97\xaa\xe7\x94\xb5\x0a\x00\x30\xe7\x81\xab\xc9\x02\x20"
+            "\xb8\x9f\xf2\x00\x31\xe4\xbd\xa0\x32\x00\x51\x93\x88\xe5\x85\x8b\x0a\x00\x11\xbf\x93\x05\xd0\xe8\xb6\x85\xe6\xa2\xa6\x00\xe6\xa2"
+            "\xa6\xe5\xb9\xbb\x8c\x00\xd0\xe8\x8d\x89\xe5\x8f\xb6\x00\xe6\x9c\x88\xe6\xa1\x82\x0a\x00\x91\xe5\xa4\xa7\xe7\xab\xba\xe8\x91\xb5"
+            "\x51\x00\x21\x90\x83\x03\x05\x53\x81\xab\xe5\xb2\xa9\x0a\x00\x33\xe6\x9a\xb4\x1a\x03\xa0\xe9\x94\xaf\xe9\xb3\x84\x00\xe8\x93\x9d"
+            "\x07\x00\x00\xa5\x02\x21\x8a\x9b\x0a\x00\x51\xb0\xbe\xe7\xab\x8b\x11\x00\x03\x0a\x00\x50\x92\x95\xe5\x92\x95\x5f\x04\xf0\x01\xe5"
+            "\xa4\xb4\xe5\xa4\x9c\xe9\xb9\xb0\x00\xe8\x8a\xad\xe7\x93\xa2\xe1\x05\x34\xe5\xae\x89\x0a\x00\x80\x9c\x86\xe4\xb8\x9d\xe8\x9b\x9b"
+            "\x9a\x05\x30\xe5\x88\xa9\x50\x05\x90\x96\xaf\x00\xe5\x8f\x89\xe5\xad\x97\xff\x04\x60\xe7\x81\xaf\xe7\xac\xbc\x11\x02\x00\xd8\x02"
+            "\x23\x81\xaf\xbb\x05\x01\xb1\x05\x80\x9a\xae\xe5\xae\x9d\xe5\xae\x9d\x18\x02\x30\xe5\xae\x9d\x42\x05\x93\xe6\xb3\xa2\xe5\x85\x8b"
+            "\xe6\xaf\x94\x0a\x00\xd2\xe5\x9f\xba\xe5\x8f\xa4\x00\xe5\xa4\xa9\xe7\x84\xb6\x15\x06\x01\x0a\x00\x00\x37\x06\xf0\x00\x92\xa9\xe5"
+            "\x88\xa9\xe7\xbe\x8a\x00\xe8\x8c\xb8\xe8\x8c\xb8\x0a\x00\x00\x59\x01\x00\xdb\x06\x53\xbe\x8e\xe4\xb8\xbd\x6e\x04\x00\xe3\x00\x26"
+            "\x9c\xb2\x0a\x00\xa1\xe4\xb8\xbd\x00\xe6\xa0\x91\xe6\x89\x8d\xcc\x02\x02\xfe\x04\xc0\x9b\x99\xe7\x9a\x87\x00\xe6\xaf\xbd\xe5\xad"
+            "\x90\xac\x05\x03\x0a\x00\x00\xa2\x05\x01\x0a\x00\xf4\x08\xe6\xa3\x89\x00\xe9\x95\xbf\xe5\xb0\xbe\xe6\x80\xaa\xe6\x89\x8b\x00\xe5"
+            "\x90\x91\xe6\x97\xa5\x69\x07\x01\x0d\x00\x31\xe8\x8a\xb1\x52\x00\x21\x9c\xbb\x03\x00\x51\x93\x00\xe4\xb9\x8c\xf4\x06\x11\xb2\x97"
+            "\x02\x64\xe5\xa4\xaa\xe9\x98\xb3\x7c\x02\x54\x9c\x88\xe4\xba\xae\x7f\x02\x83\xbb\x91\xe6\x9a\x97\xe9\xb8\xa6\xd1\x04\x01\xc5\x02"
+            "\xf0\x1b\xa2\xa6\xe5\xa6\x96\x00\xe6\x9c\xaa\xe7\x9f\xa5\xe5\x9b\xbe\xe8\x85\xbe\x00\xe6\x9e\x9c\xe7\x84\xb6\xe7\xbf\x81\x00\xe9"
+            "\xba\x92\xe9\xba\x9f\xe5\xa5\x87\x00\xe6\xa6\x9b\x17\x00\xc1\x90\x83\x00\xe4\xbd\x9b\xe7\x83\x88\xe6\x89\x98\x81\x01\xa0\x9c\x9f"
+            "\xe9\xbe\x99\xe5\xbc\x9f\xe5\xbc\x6b\x07\x31\xa9\xe8\x9d\x06\x04\x31\xe9\x92\xa2\x94\x04\x53\xb8\x83\xe9\xb2\x81\x07\x00\x00\xf9"
+            "\x00\x60\xe5\x8d\x83\xe9\x92\x88\xa6\x01\x03\x8e\x04\x02\x89\x03\xa0\xe5\xa3\xb6\xe5\xa3\xb6\x00\xe8\xb5\xab\x6d\x04\x23\x85\x8b"
+            "\x75\x03\x30\xe7\x8b\x83\x77\x04\x34\xe7\x86\x8a\xc0\x01\xc0\x9c\x88\xe5\x9c\x88\xe7\x86\x8a\x00\xe7\x86\x94\xf8\x04\x24\x99\xab"
+            "\x0a\x00\x20\x9c\x97\x53\x04\x30\xe5\xb0\x8f\x92\x07\x20\x8c\xaa\x45\x01\x00\xdd\x06\x10\x8c\x8f\x05\x00\x10\x01\x61\xe7\x8f\x8a"
+            "\xe7\x91\x9a\x51\x08\x21\x82\xae\x27\x02\xf1\x00\xab\xa0\xe9\xb1\xbc\xe6\xa1\xb6\x00\xe4\xbf\xa1\xe4\xbd\xbf\xeb\x01\x81\xb7\xa8"
+            "\xe7\xbf\x85\xe9\xa3\x9e\x21\x00\x50\x9b\x94\xe7\x94\xb2\x17\x00\x60\xe6\x88\xb4\xe9\xb2\x81\x2d\x02\x90\xe9\xbb\x91\xe9\xb2\x81"
+            "\xe5\x8a\xa0\x9b\x05\x32\xe9\xbe\x99\xfc\x07\xe6\x8f\xe5\xb0\x8f\xe8\xb1\xa1\x00\xe9\xa1\xbf\xe7\x94\xb2\xd2\x03\x70\xe2\x85\xa1"
+            "\x00\xe6\x83\x8a\xac\x04\xf0\x03\xb9\xbf\x00\xe5\x9b\xbe\xe5\x9b\xbe\xe7\x8a\xac\x00\xe6\x97\xa0\xe7\x95\x35\x00\x00\xd4\x01\x60"
+            "\xe6\x88\x98\xe8\x88\x9e\x3e\x05\x03\x8f\x04\x23\xa8\x83\x8f\x04\x00\xe5\x01\x02\x8f\x04\x04\xff\x00\xf0\x00\xa4\xa7\xe5\xa5\xb6"
+            "\xe7\xbd\x90\x00\xe5\xb9\xb8\xe7\xa6\x8f\x2e\x05\x00\xb9\x05\x90\x85\xac\x00\xe7\x82\x8e\xe5\xb8\x9d\x6b\x04\x00\x54\x07\x32\xe5"
+            "\xb9\xbc\x40\x07\x01\xf1\x07\x26\xb2\x99\x0d\x00\x37\xe7\x8f\xad\x1a\x00\xc1\xb4\x9b\xe5\xa5\x87\xe4\xba\x9a\x00\xe5\x87\xa4\x0d"
+            "\x02\x20\x97\xb6\x1b\x00\x00\x16\x03\xf2\x07\x9c\xa8\xe5\xae\x88\xe5\xae\xab\x00\xe6\xa3\xae\xe6\x9e\x97\xe8\x9c\xa5\xe8\x9c\xb4"
+            "\x00\x07\x00\x01\xb3\x08\xf0\x00\x81\xab\xe7\xa8\x9a\xe9\xb8\xa1\x00\xe5\x8a\x9b\xe5\xa3\xae\x0a\x00\x04\x68\x04\x10\xa1\x88\x00"
+            "\x30\xe8\xb7\x83\x46\x01\x33\xe6\xb2\xbc\x0a\x00\x61\xe5\xb7\xa8\xe6\xb2\xbc\x21\x07\x50\x9c\x9f\xe7\x8b\xbc\x0a\x01\x00\x53\x04"
+            "\x02\x0a\x00\x61\xe8\x9b\x87\xe7\xba\xb9\xdb\x01\x50\x9b\xb4\xe5\x86\xb2\x0a\x00\x61\xe5\x88\xba\xe5\xb0\xbe\xe5\x01\x20\x94\xb2"
+            "\xea\x09\xc1\x8c\xa7\x00\xe7\x8b\xa9\xe7\x8c\x8e\xe5\x87\xa4\x0b\x0a\x20\x9b\xbe\x20\x07\x20\x8c\xa7\xe1\x07\x30\xe7\xb2\x89\xc2"
+            "\x08\x90\xe8\x8e\xb2\xe5\x8f\xb6\xe7\xab\xa5\x5d\x01\x00\x0d\x00\x20\xb8\xbd\xab\x07\xc0\xab\xa5\x00\xe4\xb9\x90\xe5\xa4\xa9\xe6"
+            "\xb2\xb3\x0d\x00\x90\xe6\xa9\xa1\xe5\xae\x9e\xe6\x9e\x9c\x2a\x02\x30\xe9\xbc\xbb\xe1\x04\x60\xe7\x8b\xa1\xe7\x8c\xbe\xfa\x03\xc1"
+            "\x8b\x97\x00\xe5\x82\xb2\xe9\xaa\xa8\xe7\x87\x95\xa5\x00\x20\x8e\x8b\x0a\x00\x30\xe9\x95\xbf\x20\x02\x11\xb8\xa4\x07\x00\x34\x0a"
+            "\x20\xb8\xa5\xfc\x05\x00\x1d\x02\x90\x8b\x89\xe4\xb8\x9d\x00\xe5\xa5\x87\x49\x09\x51\x8e\x89\xe5\xae\x89\x79\x01\xf1\x00\xa5\x88"
+            "\xe6\x9c\xb5\x00\xe6\xba\x9c\xe6\xba\x9c\xe7\xb3\x96\x71\x07\x10\x9b\x65\x02\x01\xab\x00\x20\x98\x91\x03\x00\x91\x8f\x87\x00\xe6"
+            "\x96\x97\xe7\xac\xa0\x0a\x00\xf1\x0a\x87\x92\xe4\xba\xba\xe7\x8d\xad\x00\xe8\xbf\x87\xe5\x8a\xa8\xe7\x8c\xbf\x00\xe8\xaf\xb7\xe5"
+            "\x81\x87\x6c\x02\x80\x9c\x9f\xe5\xb1\x85\xe5\xbf\x8d\x2d\x09\xf0\x01\xe9\x93\x81\xe9\x9d\xa2\xe5\xbf\x8d\xe8\x80\x85\x00\xe8\x84"
+            "\xb1\x99\x08\x02\x0d\x00\x00\x56\x05\xc0\xa6\x9e\xe5\xa6\x9e\x00\xe5\x90\xbc\xe7\x88\x86\x88\x07\x61\xe7\x88\x86\xe9\x9f\xb3\x7f"
+            "\x01\x51\xb9\x95\xe4\xb8\x8b\xb7\x01\x01\x45\x00\x34\xe6\x8e\x8c\x0d\x00\x51\x9c\xb2\xe5\x8a\x9b\xb9\x04\x80\x9c\x9d\xe5\x8c\x97"
+            "\xe9\xbc\xbb\x74\x04\x30\xe5\xb0\xbe\x04\x0a\xf2\x03\xe4\xbc\x98\xe9\x9b\x85\xe7\x8c\xab\x00\xe5\x8b\xbe\xe9\xad\x82\xe7\x9c\x80"
+            "\x08\x20\x98\xb4\xb4\x02\x30\xe5\x8f\xaf\x03\x00\x21\xa4\x9a\x2a\x08\x05\x0a\x00\x00\x5f\x05\x26\xa3\xab\x10\x00\xd0\xe7\x8e\x9b"
+            "\xe6\xb2\x99\xe9\x82\xa3\x00\xe6\x81\xb0\xbd\x02\x61\xa7\x86\x00\xe8\x90\xbd\xc7\x02\x10\xbd\xce\x02\x00\xfc\x02\x00\xc8\x06\xf6"
+            "\x00\xad\xa3\xe7\x94\xb5\xe6\x8b\x8d\xe6\x8b\x8d\x00\xe8\xb4\x9f\x0d\x00\x62\xe7\x94\xb5\xe8\x90\xa4\x16\x02\x70\x9c\xe7\x94\x9c"
+            "\xe8\x90\xa4\xff\x01\xd2\xe8\x94\xb7\xe8\x96\x87\x00\xe6\xba\xb6\xe9\xa3\x9f\x52\x08\x14\x9e\x0a\x00\x53\x88\xa9\xe7\x89\x99\x84"
+            "\x02\x00\x0a\x00\x20\xb2\xa8\x19\x01\x60\xe5\x90\xbc\xe9\xb2\xb8\x0a\x00\x20\xe9\xb2\x28\x0b\x00\x16\x05\x01\xfb\x09\x14\xbc\xaa"
+            "\x0c\x81\xa9\xbc\x00\xe7\x85\xa4\xe7\x82\x96\x0c\x61\xe8\xb7\xb3\xe8\xb7\xb3\x52\x04\x50\x99\x97\xe5\x99\x97\x0a\x00\x30\xe6\x99"
+            "\x83\x03\x00\x21\x96\x91\xf5\x04\x44\xa2\x9a\xe8\x9a\x9d\x0b\x00\xf8\x00\x20\xb9\xbc\xa6\x00\x63\xe6\xb2\x99\xe6\xbc\xa0\xab\x05"
+            "\x00\xd2\x09\x40\x90\x83\xe4\xbb\x90\x08\x30\xe6\x8e\x8c\x7f\x05\x36\xe6\xad\x8c\x10\x00\x51\xe9\x9d\x92\xe7\xbb\xb5\x07\x91\xe4"
+            "\xb8\x83\xe5\xa4\x95\xe9\x9d\x92\xc2\x07\xf0\x00\x8c\xab\xe9\xbc\xac\xe6\x96\xa9\x00\xe9\xa5\xad\xe5\x8c\x99\x5d\x05\x30\xe6\x9c"
+            "\x88\xba\x0a\x02\xdf\x04\x00\xba\x0a\xd3\xe6\xb3\xa5\xe6\xb3\xa5\xe9\xb3\x85\x00\xe9\xb2\xb6\xa4\x08\x60\xe9\xbe\x99\xe8\x99\xbe"
+            "\x6b\x04\x20\x85\xb5\xec\x01\x32\xe8\x9e\xaf\x13\x00\x01\xe1\x06\x20\xa7\xa4\x14\x09\x30\xe5\xbf\xb5\x00\x02\x20\x9c\x9f\x0d\x00"
+            "\x60\xe8\xa7\xa6\xe6\x89\x8b\xc4\x08\x93\x90\x88\x00\xe6\x91\x87\xe7\xaf\xae\x0d\x00\x91\xe5\xa4\xaa\xe5\x8f\xa4\xe7\xbe\xbd\x90"
+            "\x07\x02\x0d\x00\x01\x23\x05\x61\x00\xe4\xb8\x91\xe4\xb8\x8d\x09\x61\xe7\xbe\x8e\xe7\xba\xb3\xaa\x0a\xf1\x02\xa3\x98\xe6\xb5\xae"
+            "\xe6\xb3\xa1\xe6\xb3\xa1\x00\xe5\x8f\x98\xe9\x9a\x03\x0e\x90\xe6\x80\xa8\xe5\xbd\xb1\xe5\xa8\x83\x33\x02\x63\xe8\xaf\x85\xe5\x92"
+            "\x92\x0d\x00\xf0\x04\xe5\xa4\x9c\xe5\xb7\xa1\xe7\x81\xb5\x00\xe5\xbd\xb7\xe5\xbe\xa8\xe5\xa4\x9c\x0d\x00\x60\xe7\x83\xad\xe5\xb8"
+            "\xa6\x3b\x00\x00\x4a\x0c\x51\x93\x83\xe9\x93\x83\x03\x08\x51\x8b\x83\xe6\xa2\xad\x5d\x06\x22\xb0\x8f\xb0\x06\x43\x00\xe9\x9b\xaa"
+            "\xf7\x03\x30\xe5\x86\xb0\x2a\x0b\x20\x8a\xa4\x14\x0a\x31\xe8\xb1\xb9\xe4\x0c\x50\xb5\xb7\xe9\xad\x94\x71\x0b\x64\xe5\xb8\x9d\xe7"
+            "\x89\x99\x88\x0b\x50\x8f\x8d\xe7\x8f\xa0\x63\x0b\x51\xe7\x8c\x8e\xe6\x96\xc6\x00\x61\xe6\xa8\xb1\xe8\x8a\xb1\x30\x02\x81\x8f\xa4"
+            "\xe7\xa9\xba\xe6\xa3\x98\xdd\x00\x42\x88\xb1\xe5\xbf\xcb\x04\x51\xae\x9d\xe8\xb4\x9d\x02\x08\x01\x99\x04\x01\xda\x00\x20\x9a\xb4"
+            "\x39\x06\x00\xa9\x00\x51\x93\x81\xe5\x93\x91\xa9\x00\x51\x87\x91\xe5\xb1\x9e\x74\x03\x51\xb7\xa8\xe9\x87\x91\xd2\x05\x50\x9b\xb7"
+            "\xe5\x90\x89\x7b\x05\x12\x85\xbe\x05\x51\x90\x89\xe8\x89\xbe\x33\x01\x02\x1a\x00\x22\x96\xaf\x46\x04\x00\x5a\x04\x51\xe5\xb8\x9d"
+            "\xe4\xba\xea\x08\x02\x0d\x00\x31\xe6\xac\xa7\xc6\x05\xb0\x9b\x96\xe6\xac\xa7\xe5\x8d\xa1\x00\xe5\x9b\xcd\x05\x31\xe5\xa4\x9a\xae"
+            "\x0c\x62\xa9\xba\xe5\x9d\x90\x00\xe1\x05\x70\xe7\xa5\x88\x00\xe4\xbb\xa3\x28\x00\x51\xa5\x87\xe5\xb8\x8c\xc6\x0a\x51\x8d\x89\xe8"
+            "\x8b\x97\x6d\x0f\x41\xa0\x91\xe6\x9e\x0a\x00\x00\xf8\x01\x21\x8f\xb0\x0a\x00\x01\xfa\x0c\x30\xe7\x84\xb0\xc2\x0d\x30\xe7\x8c\x9b"
+            "\x0d\x00\x00\x0a\x00\x01\x07\x0d\x00\x0a\x00\x00\xd4\x02\x50\x8a\xa0\xe6\x9b\xbc\x0a\x00\x31\xe7\x9a\x87\x6b\x01\x80\xb8\x9d\xe7"
+            "\x8e\x8b\xe6\x8b\xbf\x82\x08\x30\xe5\xa7\x86\x4c\x09\x23\x84\xbf\x0a\x00\x01\x54\x07\x02\x0a\x00\x21\xb9\xb0\x48\x05\x54\x89\x99"
+            "\xe7\x8b\xb8\x00\x0a\x00\x0a\x00\xf1\x03\x9c\x86\xe6\xb3\x95\xe5\xb8\x88\x00\xe9\x9f\xb3\xe7\xae\xb1\xe8\x9f\x80\x88\x00\x21\x8c"
+            "\xab\x36\x01\x20\x8b\x92\x0e\x08\x91\x8c\xab\x00\xe4\xbc\xa6\xe7\x90\xb4\x7c\x04\xf0\x03\x90\xab\xe7\xbe\x9e\xe8\x8b\x9e\x00\xe7"
+            "\xbd\x97\xe4\xb8\x9d\xe9\x9b\xb7\x63\x05\x61\xe5\xa4\xb4\xe7\x9b\x96\x89\x01\x51\x88\x98\xe6\xa7\x8c\x9d\x01\x01\x1f\x06\x01\x14"
+            "\x00\x51\x8a\xa4\xe5\x9f\x8e\x14\x00\x20\xbb\x93\xd9\x0a\x23\x84\xbf\x0a\x00\xd0\xe8\xb4\xb5\xe5\xa6\x87\x00\xe7\xbb\x85\xe5\xa3"
+            "\xab\x95\x05\x60\xe4\xb8\x89\xe8\x9c\x9c\x4b\x10\x61\xe8\x9c\x82\xe5\xa5\xb3\x19\x04\x20\xb8\x95\x45\x01\x60\x88\xa9\xe5\x85\xb9"
+            "\x00\xab\x0e\x40\x9c\x88\xe9\xbc\x8f\x0c\x41\xae\xe6\xbd\x9c\x0a\x00\x01\x32\x02\x00\xa4\x07\x03\x0a\x00\x20\x84\xbf\xe6\x07\x20"
+            "\xe5\xa3\x85\x0c\x31\xe5\x85\x94\xba\x0c\x11\x85\xa1\x0b\x00\x10\x0d\x05\xde\x09\x61\xe9\xa3\x98\xe9\xa3\x98\x16\x06\x50\x9a\x8f"
+            "\xe9\xa3\x8e\x0a\x00\x90\xe5\x8d\xb7\xe5\x8d\xb7\xe8\x80\xb3\x6f\x06\x31\xe8\x80\xb3\x3f\x00\x01\xa6\x09\x30\xe9\xad\x94\xec\x09"
+            "\x31\xe9\xb8\xa6\x2d\x0b\x50\xb4\x00\xe9\xad\x85\xba\x03\x00\x9c\x05\x50\xb8\x9c\xe6\x96\xbd\x0a\x00\x01\x24\x03\x40\x9b\xe5\x93"
+            "\x8d\x52\x0e\xd2\xe9\xbc\xac\xe5\x99\x97\x00\xe5\x9d\xa6\xe5\x85\x8b\x10\x00\x71\x00\xe9\x93\x9c\xe9\x95\x9c\x8b\x02\x20\x9d\x92"
+            "\x0d\x00\x63\x92\x9f\x00\xe7\x9b\x86\xa8\x0a\x00\x2e\x0d\x51\xb0\xbc\xe5\xb0\xbc\x87\x01\x02\x64\x08\x61\xe8\x81\x92\xe5\x99\xaa"
+            "\x40\x0c\x52\x8a\xb1\xe5\xb2\xa9\xc4\x07\x41\x86\xe9\x99\x86\x4a\x05\x20\xb0\x96\x54\x05\x02\x0d\x00\x65\xe7\x83\x88\xe5\x92\xac"
+            "\x1a\x00\x16\x8f\x99\x0c\xd0\xe5\x88\xa9\xe6\xac\xa7\xe8\xb7\xaf\x00\xe8\xb7\xaf\xf6\x11\x01\x10\x00\x01\x1e\x05\x21\xb2\xb3\xdd"
+            "\x0d\x01\x07\x00\x01\x06\x06\x20\x92\xb3\xf8\x07\x20\x9d\x8e\xbf\x04\x00\xc1\x10\xc0\x9d\x8e\x00\xe4\xb8\x8d\xe8\x89\xaf\xe8\x9b"
+            "\x99\xec\x05\x30\xe9\xaa\xb7\x0a\x00\x02\x7a\x00\xa1\xe7\xac\xbc\x00\xe8\x8d\xa7\xe5\x85\x89\x0f\x0e\x51\x9c\x93\xe8\x99\xb9\xa5"
+            "\x03\x20\xb0\x8f\xa5\x0c\x02\xcd\x09\x00\x1c\x04\x20\xac\xa0\xb9\x00\x00\xa8\x03\x21\x9b\xaa\xc3\x08\x23\x8e\x9b\x62\x0a\x67\xe8"
+            "\x87\xaa\xe7\x88\x86\xbf\x0f\x50\x88\x8c\xe8\x88\x94\xca\x05\x90\xe7\x94\xb2\xe7\x8b\x82\xe7\x8a\x80\xc2\x03\x02\x9a\x0e\x03\x9e"
+            "\x09\x00\x29\x01\x06\x30\x0e\x21\x82\x8e\xb5\x06\x04\x4c\x0c\x01\x6d\x03\x50\xbf\x9c\xe5\x8f\xa4\x37\x00\x00\xf8\x05\x24\x8f\xb6"
+            "\xf0\x0d\x25\x86\xb0\xfa\x0d\x00\x2f\x0b\x00\x8a\x00\x30\xe8\xb1\xa1\xc9\x00\x01\xad\x0a\x03\x3c\x0a\xa5\xef\xbc\xba\x00\xe8\x89"
+            "\xbe\xe8\xb7\xaf\xe1\x02\x16\xa7\x95\x07\x30\xe9\xbb\x91\x2d\x0d\x20\xad\x94\x23\x05\x90\xe9\x9b\xaa\xe5\xa6\x96\xe5\xa5\xb3\xd1"
+            "\x09\x30\xe6\x89\x98\x53\x07\x30\xe7\x94\xb1\x8a\x00\x20\xb8\x8c\x45\x00\x00\x83\x03\x01\x33\x0d\x40\x00\xe4\xba\x9a\x09\x02\x20"
+            "\xaf\xba\x24\x00\x02\x08\x05\x31\xe5\x8d\xa2\x49\x04\x20\xb8\x95\x98\x01\x03\x0f\x0a\x20\xb8\xad\x89\x00\x53\x93\x9d\xe6\x81\xa9"
+            "\x97\x04\x00\x00\x03\x21\x8d\xa1\xa7\x04\x22\xaa\x91\x8d\x04\x40\xe7\xba\xb3\x00\xdb\x03\x80\x9b\xb7\xe8\x89\xb2\xe5\x88\xa9\x3a"
+            "\x00\x60\xe9\x9c\x8f\xe6\xac\xa7\x1a\x00\x00\x5e\x01\x90\xba\xb3\xe9\x9c\x8f\x00\xe8\xbe\xbe\x75\x00\xc1\x8e\xb1\xe4\xbc\x8a\x00"
+            "\xe8\xb0\xa2\xe7\xb1\xb3\xc3\x05\x51\xb0\x94\xe5\xae\x99\xdc\x04\x00\x22\x02\x40\x8b\xe6\x8f\x90\x77\x02\x30\xe8\x97\xa4\x03\x00"
+            "\x00\x84\x13\x23\x9d\x92\x0a\x00\x61\xe5\x90\x9b\xe4\xb8\xbb\xf5\x06\x50\x9a\x96\xe6\x9a\x96\x2a\x01\x30\xe7\x82\x92\x03\x00\x01"
+            "\x0a\x00\x41\x8e\xe6\xad\xa6\xc0\x0a\x20\xb0\xb4\x46\x14\x21\x8d\xad\x66\x03\x42\x88\x83\xe4\xb8\x6c\x04\x20\x89\x91\x2c\x11\x60"
+            "\xe6\x8e\xa2\xe6\x8e\xa2\xac\x0e\x61\xe6\xad\xa5\xe5\x93\xa8\xdf\x12\x40\xb0\x8f\xe7\xba\x1d\x03\x00\x11\x0f\x03\x0a\x00\x03\x3b"
+            "\x0c\x60\x8b\x97\x00\xe6\x89\x92\x0d\x07\x50\x8c\xab\x00\xe9\x85\x48\x06\x00\x00\x03\x21\xe6\xa4\x0c\x05\x04\x0a\x00\x11\xbf\x59"
+            "\x09\x21\xa6\x99\x2a\x05\x03\x0a\x00\x50\xbf\x00\xe5\x86\xb7\x89\x00\x00\x0a\x13\x03\x0a\x00\x50\xbf\x00\xe9\xa3\x9f\xee\x07\x02"
+            "\x64\x0f\x00\xa1\x11\xc3\x9a\x80\x00\xe8\xb1\x86\xe8\xb1\x86\xe9\xb8\xbd\x09\x0f\x00\x0a\x00\x30\xe9\xab\x98\x7c\x0a\x21\x9b\x89"
+            "\x49\x0b\x20\x96\x91\x95\x06\x23\xa9\xac\x1b\x09\x03\x0d\x00\x61\xe7\x9f\xb3\xe4\xb8\xb8\x80\x05\x40\x9c\xb0\xe5\xb9\x02\x0d\x43"
+            "\x00\xe5\xba\x9e\x9c\x03\x91\xe6\xbb\x9a\xe6\xbb\x9a\xe8\x9d\x99\x22\x14\x23\xbf\x83\x0a\x00\x54\xe8\x9e\xba\xe9\x92\xd8\x13\x00"
+            "\xb6\x0d\x24\xa4\xb4\xe5\x13\x51\xb7\xae\xe4\xb8\x8d\xb8\x14\x01\x8c\x07\x60\xe6\x90\xac\xe8\xbf\x90\xbf\x03\x21\x8c\xa0\x67\x0a"
+            "\x50\xaa\xa8\xe5\x9c\x9f\x4f\x12\x60\xe4\xbf\xae\xe5\xbb\xba\x0b\x14\x20\x8c\xa0\x04\x04\x04\xcf\x13\x92\x93\x9d\xe8\x9f\xbe\xe8"
+            "\x9c\x8d\x00\x07\x00\x01\x8d\x01\x51\x8a\x95\xe6\x91\x94\x79\x01\x20\x89\x93\x31\x03\x00\xa8\x03\x20\x99\xab\xcc\x0c\x21\x8c\x85"
+            "\x8b\x0f\x20\x8c\x85\xbb\x0b\x61\xe4\xbf\x9d\xe5\xa7\x86\xd0\x09\xf0\x03\x99\xbe\xe8\xb6\xb3\xe8\x9c\x88\xe8\x9a\xa3\x00\xe8\xbd"
+            "\xa6\xe8\xbd\xae\x11\x05\x02\x11\x00\x01\x53\x00\x51\x9c\xa8\xe6\xa3\x89\x2f\x05\x81\xa3\x8e\xe5\xa6\x96\xe7\xb2\xbe\x6f\x11\x54"
+            "\x90\x88\xe6\xa0\xb9\x55\x08\x50\xa3\x99\xe5\x84\xbf\xbc\x00\xb1\xa7\x90\x00\xe9\x87\x8e\xe8\x9b\xae\xe9\xb2\x73\x0e\x60\xe9\xbb"
+            "\x91\xe7\x9c\xbc\x87\x10\x61\xe6\xb7\xb7\xe6\xb7\xb7\x0a\x00\x50\xb5\x81\xe6\xb0\x93\x0a\x00\x00\xee\x06\x20\xba\xa2\x07\x01\x20"
+            "\x80\x92\xfb\x0e\xc0\xe8\xbe\xbe\xe6\x91\xa9\xe7\x8b\x92\xe7\x8b\x92\xa6\x04\x27\xe9\x93\xb7\x09\x00\x98\x11\x21\xb1\x85\x56\x13"
+            "\x53\xb2\xa9\xe6\xae\xbf\x0d\x00\x63\xe6\xbb\x91\xe6\xbb\x91\xd9\x0d\x00\x5f\x01\x22\xb7\xbe\x6b\x00\x00\xe2\x03\x31\xe5\xbe\x81"
+            "\x10\x07\x50\x93\xad\xe5\x93\xad\xb9\x0b\xf0\x01\x85\xb7\x00\xe6\xad\xbb\xe7\xa5\x9e\xe6\xa3\xba\x00\xe5\x8e\x9f\xd6\x07\x21\xb5"
+            "\xb7\x6b\x0a\x41\x82\x8b\xe9\xaa\xf5\x12\x00\x97\x07\x50\xa7\x8b\xe7\xa5\x96\x55\x11\x01\x4e\x07\x01\x0d\x00\x21\xa4\xa7\x16\x0a"
+            "\x70\xa0\xb4\xe7\xa0\xb4\xe8\xa2\x8e\x0d\xb0\xb0\xe5\xb0\x98\xe5\xb1\xb1\x00\xe7\xb4\xa2\x18\x07\x26\xba\x9a\x0a\x00\x00\xd4\x02"
+            "\x00\x89\x09\x51\xb2\xab\xe6\xa0\x97\xef\x01\x54\xa5\x87\xe8\xaf\xba\x0d\x00\x54\x93\xa5\xe5\xbe\xb7\x62\x0e\x02\x0d\x00\x02\x30"
+            "\x0d\x05\x0d\x00\x00\x4a\x01\xc1\xe5\x8d\x95\xe5\x8d\xb5\xe7\xbb\x86\xe8\x83\x9e\xa6\x06\x29\x8f\x8c\x10\x00\x62\xe4\xba\xba\xe9"
+            "\x80\xa0\x10\x00\x31\xe5\x8d\xb5\x18\x05\x02\x54\x00\x20\xe8\x88\x73\x13\x33\xe9\xb9\x85\x7e\x12\x20\xe5\x86\x0b\x08\x10\x9a\x03"
+            "\x00\x00\x0a\x00\x41\x8f\x8c\xe5\x80\x7b\x02\x03\x10\x00\x50\x9b\x9b\xe5\xad\xa3\x30\x0f\x60\xe8\x90\x8c\xe8\x8a\xbd\x0a\x00\x00"
+            "\x6e\x11\x21\xa3\x9e\x65\x12\x51\x9b\x96\xe7\x9b\x96\xfc\x17\x20\xaa\x91\xb1\x07\x03\xf7\x0f\x80\x93\x8e\xe5\x91\x80\xe7\x90\x83"
+            "\x42\x0d\x64\xe8\xb4\xa5\xe9\x9c\xb2\x0d\x00\x22\xbd\xbb\x64\x07\x01\x3e\x17\x02\x8f\x15\x02\x71\x02\x30\xe6\x9b\xbc\xb3\x08\x00"
+            "\x2e\x12\x22\x94\xb5\x4e\x0c\x40\xb5\xe8\x9c\x98\x63\x12\x02\x6e\x11\x00\x2b\x10\x00\xe9\x00\x54\x9d\x9a\xe6\x9e\x9c\xd1\x09\x50"
+            "\xbd\xbf\xe8\xbd\xae\xde\x07\x02\x0a\x00\x33\xe7\xbb\x84\x0a\x00\x01\x3c\x07\x50\xba\xbb\xe9\xba\xbb\xaa\x01\x00\x6e\x02\x01\x0d"
+            "\x00\x36\xe9\xb3\x97\x0a\x00\x03\x94\x0b\x01\x68\x09\x13\xb0\x6b\x06\x31\xe5\xae\x87\xab\x12\x51\x83\x9b\xe5\x85\x89\xf1\x0a\x20"
+            "\x81\xaf\x55\x13\x20\xb9\xbd\x0d\x00\x00\xd1\x04\x22\x99\xb6\x13\x00\x01\x1d\x00\x80\x89\x99\xe7\x89\x99\x00\xe6\x96\x4a\x09\x01"
+            "\xbd\x13\x83\x8f\x8c\xe6\x96\xa7\xe6\x88\x98\x60\x19\x31\xe5\x9a\x8f\x3a\x0f\x20\x86\xbb\x51\x02\x00\x0a\x00\x83\x87\xa0\xe4\xbd"
+            "\x95\xe9\x9b\xaa\x95\x19\x00\x2e\x18\x91\x9c\x97\x00\xe6\x95\x8f\xe6\x8d\xb7\x9f\x0c\x51\xb3\xa5\xe5\xb7\xb4\x31\x07\x40\x8a\x9f"
+            "\xe5\xa4\x68\x0c\x70\x00\xe5\xb8\x88\xe7\x88\xb6\x0a\x00\x61\xe8\xb5\xa4\xe9\x9d\xa2\x43\x09\x80\xb3\xa5\xe5\x81\xb6\xe5\xb0\x8f"
+            "\x07\x04\x03\x0d\x00\x20\xb7\xa8\x0d\x00\x63\xe9\xa9\xb9\xe5\x88\x80\x64\x0c\xc0\xe5\x8a\x88\xe6\x96\xa9\xe5\x8f\xb8\xe4\xbb\xa4"
+            "\x11\x05\x51\xe7\x82\xb8\xe5\xa4\x96\x05\x20\x89\x9b\x6f\x18\x00\x16\x03\x21\xb0\x8f\x0f\x0a\x80\x8b\x87\xe5\xa3\xab\xe9\x9b\x84"
+            "\x0d\x00\x80\xe7\xa7\x83\xe9\xb9\xb0\xe4\xb8\x07\x14\x03\x0d\x00\x00\x44\x19\x61\xe7\x86\x94\xe8\x9a\x81\x68\x07\x20\x93\x81\x5d"
+            "\x0d\x51\xe5\x8d\x95\xe9\xa6\xe7\x09\x60\xe5\x8f\x8c\xe9\xa6\x96\xce\x07\x20\xbe\x99\xb5\x09\x00\x0d\x00\x21\x81\xb6\xe3\x09\x51"
+            "\x87\x83\xe7\x83\xa7\xd3\x01\x51\x81\xab\xe7\xa5\x9e\xd8\x18\x22\x8b\xbe\xe2\x06\x00\xdb\x03\x00\x17\x0b\x50\x8b\x89\xe5\x9f\xba"
+            "\x0d\x00\x20\xe6\xaf\x5b\x18\x31\xe5\x90\x89\xf0\x12\x83\xbe\x99\xe5\x8d\xb7\xe4\xba\x91\x6f\x05\x00\x0a\x00\x30\xe8\x8e\xb1\x3f"
+            "\x0b\x20\x8b\x89\x34\x07\x32\xe6\x8d\xb7\xa0\x12\x01\x41\x07\x51\x9c\x9f\xe5\x9c\xb0\x2e\x00\x01\x07\x07\x01\x14\x00\x20\x87\xaf"
+            "\x87\x19\x20\xbf\xaa\xdd\x08\xc0\xe7\xbe\x8e\xe6\xb4\x9b\xe8\x80\xb6\xe5\xa1\x94\xbc\x02\x50\xe8\xaf\xba\xe8\xb5\xf9\x0b\x00\x7c"
+            "\x19\x00\x82\x15\x50\x8a\x9b\xe6\xa0\x97\x9b\x02\x00\x9e\x02\x01\x10\x00\x01\x2d\x13\x81\x87\x8c\xe5\x8d\xa1\xe9\x9a\x86\xc1\x00"
+            "\x20\x8b\x90\x29\x0b\x02\x15\x14\x02\x10\x00\x10\x00\xfb\x04\x01\xaf\x04\x01\x0d\x00\x81\x91\xb1\xe5\x91\xb1\xe6\xb3\xa1\x13\x09"
+            "\x50\x91\xb1\xe5\xa4\xb4\x0a\x00\x01\x39\x18\x10\xba\x11\x10\x00\x34\x09\x51\x8e\x98\xe6\x8e\x98\x4a\x0a\x20\x8e\x98\x33\x06\x21"
+            "\x85\x94\x87\x02\x20\xae\xad\xec\x14\x00\x4c\x00\x03\x0a\x00\x20\x83\x88\x0a\x00\x00\x91\x01\x51\xb2\x89\xe8\x9d\xb6\x45\x01\x02"
+            "\x0a\x00\x00\x66\x1b\x22\xbd\xa9\x0d\x00\x01\x3c\x00\x21\x8b\xae\x40\x0d\x51\x81\xab\xe7\x82\x8e\xc8\x18\x81\x8a\xb1\xe8\x93\x93"
+            "\xe8\x93\x93\x26\x0a\x51\x8f\xb6\xe8\x92\x82\x26\x07\x51\xb4\x81\xe5\xa4\xab\x8b\x18\x20\x9d\x90\xb6\x03\x20\xb0\x8f\x42\x15\x03"
+            "\x0d\x00\x20\xb1\xb1\x0d\x00\x02\x84\x18\x30\xe7\x86\x8a\x6b\x07\x02\x93\x05\x03\x0d\x00\x91\xe5\xa4\x9a\xe4\xb8\xbd\xe7\xb1\xb3"
+            "\x97\x08\x20\xa6\x99\xe2\x0a\x63\xe8\xb6\x85\xe8\x83\xbd\x0d\x00\x30\xe7\x8b\xac\xdf\x07\x21\x9e\x98\x4a\x04\x03\x0a\x00\x71\x9d"
+            "\x9a\xe7\x9b\xbe\xe5\x89\x70\x0d\xd0\xe7\xb2\x89\xe9\xa6\x99\xe9\xa6\x99\x00\xe8\x8a\xb3\x9f\x07\x00\x34\x06\x50\xbb\xb5\xe7\xbb"
+            "\xb5\x33\x01\x20\x8a\x99\x7e\x01\xf0\x01\xe7\x94\x9c\xe5\xa6\xae\x00\xe5\xa5\xbd\xe5\x95\xa6\xe9\xb1\xbf\x66\x0b\x23\xe8\xb4\x41"
+            "\x0f\x71\x9f\xe8\x84\x9a\xe8\x84\x9a\x0a\x00\x20\xb6\xb3\xc9\x0d\xc1\x93\xa0\x00\xe5\x9e\x83\xe5\x9e\x83\xe8\x97\xbb\x7b\x10\x23"
+            "\x97\xbb\xf8\x0d\x60\xe8\x87\x82\xe6\x9e\xaa\x5f\x0f\x90\xe9\x92\xa2\xe7\x82\xae\xe8\x87\x82\x0d\x00\x31\xe4\xbc\x9e\x5e\x04\x20"
+            "\xa5\x00\xe5\x03\x51\x94\xb5\xe4\xbc\x9e\x0d\x00\x01\x21\x05\x03\xc3\x02\x61\xe6\x80\xaa\xe9\xa2\x9a\xda\x02\x56\x86\xb0\xe9\x9b"
+            "\xaa\x0a\x00\x00\x73\x00\x00\xe4\x02\x54\xbb\x99\xe5\xad\x90\xd8\x15\x21\x91\x94\x57\x14\x11\xb0\x59\x01\x54\x92\x9a\xe5\x92\x9a"
+            "\xcf\x08\x40\xa2\x8e\xe9\x92\x22\x0a\x40\x8f\xe9\xbb\x8f\x80\x05\x61\xe9\xbb\x8f\xe7\xbe\x8e\xb4\x04\x01\x0a\x00\x01\xab\x00\x20"
+            "\x92\xa5\x4c\x15\x00\xa9\x0d\x51\xb0\x8f\xe6\x9c\xa8\x6c\x04\x20\x9c\xbd\xf6\x13\x90\xa6\x96\x00\xe5\x8d\x97\xe7\x93\x9c\x29\x01"
+            "\x02\x0a\x00\x31\xe6\x80\xaa\x67\x00\x21\x86\xb0\x24\x06\x24\x86\xb0\x04\x0c\x20\x97\xa1\x58\x08\x02\xee\x10\x02\x55\x18\x10\xb2"
+            "\xd6\x09\x23\xb0\xbc\xb5\x0e\x60\xe4\xbc\x8a\xe8\xa3\xb4\x13\x00\x51\xa1\x94\xe5\xb0\x94\x9a\x0e\x20\xa0\xbc\x10\x00\x91\xbe\xb7"
+            "\x00\xe8\x92\x82\xe5\xae\x89\xa3\x0a\x51\x83\xa1\xe5\xb8\x95\x3e\x0b\x80\xb0\x94\xe5\x87\xaf\xe5\xb0\xbc\x79\x0a\x00\xee\x07\x50"
+            "\x9c\xa8\xe6\x9e\xad\x4b\x08\x30\xe7\xbe\xbd\x0a\x00\x61\xe7\x8b\x99\xe5\xb0\x84\xbe\x0e\x11\xad\x73\x18\x21\x96\x91\x06\x02\x20"
+            "\x82\x8e\x29\x10\x01\x0a\x00\xf4\x05\xbd\xe7\x84\xb0\xe5\x92\x86\xe5\x93\xae\xe8\x99\x8e\x00\xe7\x90\x83\xe7\x90\x83\x6b\x1b\x54"
+            "\x8a\xb1\xe6\xbc\xbe\x0d\x00\x50\xa5\xbf\xe7\x8b\xae\x99\x0d\x21\xa3\xac\x39\x01\x21\xac\x83\x11\x01\x01\x56\x1c\x31\xe5\x95\x84"
+            "\x44\x19\x20\x93\xb3\xdf\x12\x03\x6f\x07\x01\x85\x11\x34\xe5\xb0\x91\x8f\x11\x90\x8e\xa2\xe9\x95\xbf\x00\xe5\xbc\xba\xb9\x01\x50"
+            "\xb8\xa1\xe6\xaf\x8d\x30\x03\x30\xe8\x99\xab\x22\x0c\x00\x7a\x01\x50\x94\xb9\xe5\x86\x9c\x07\x02\x00\x32\x11\x51\xa5\xbd\xe8\x83"
+            "\x9c\x33\x08\x01\x0a\x00\x00\xe2\x1e\x11\x9f\x52\x0a\x00\xff\x15\x00\x5c\x0d\x90\x90\x8c\xe8\x99\xbb\x00\xe8\x9d\xb6\x9a\x0e\x02"
+            "\x0d\x00\x20\xe5\xb2\x8c\x14\x01\x48\x1d\x21\xac\x83\x0d\x00\x11\xbc\x8a\x01\x51\xbc\xb1\xe4\xb8\x81\xb4\x05\x50\xa5\xbd\xe5\x9d"
+            "\x8f\xe7\x1a\x33\xe8\xb6\x85\x0a\x00\x00\x05\x12\x90\xa9\xb4\xe4\xbb\x94\x00\xe9\x87\x8d\x15\x12\x21\x8c\xbd\x60\x0d\x20\xbb\xb4"
+            "\xdd\x06\x02\x07\x00\x70\xe9\x9c\xb8\x00\xe4\xbc\xaa\x80\x17\x00\xb7\x1f\x20\x85\xb0\x0a\x00\x00\xc8\x18\x50\x9d\xa1\xe7\x9d\xa1"
+            "\x3a\x07\x00\x75\x06\x50\xbd\xa9\xe5\xa4\x9c\x0d\x00\x00\x8d\x11\x50\x9b\x97\xe7\x81\xab\xb7\x02\x00\x60\x01\x21\x90\x8e\x0a\x00"
+            "\x10\xab\x07\x06\x01\xb5\x15\x51\xa9\xbf\xe7\x9d\x80\x0a\x00\x80\x94\x9c\xe7\xab\xb9\xe7\xab\xb9\x0a\x00\x00\xfc\x07\x20\xa6\xae"
+            "\x0a\x00\x30\xe5\x86\xb7\x86\x02\x20\x90\x8e\xf2\x00\xf1\x04\xe7\x96\x97\xe7\x8e\xaf\xe7\x8e\xaf\x00\xe6\x99\xba\xe6\x8c\xa5\xe7"
+            "\x8c\xa9\x2f\x0a\x21\x8e\xb7\x5b\x0b\x20\x83\x86\x51\x17\x00\x34\x01\x80\x85\xb7\xe7\x94\xb2\xe6\xad\xa6\xd5\x14\x61\xe6\xb2\x99"
+            "\xe4\xb8\x98\x2b\x12\x20\x99\xac\x5c\x15\x81\xa0\xa1\xe7\x88\xb7\x00\xe6\x8b\x64\x0f\x31\x8f\x82\x00\x6b\x11\xf4\x02\xa7\xef\xbc"
+            "\x9a\xe7\xa9\xba\x00\xe9\x93\xb6\xe4\xbc\xb4\xe6\x88\x98\x92\x1a\x21\x99\xa8\x1c\x01\x00\x3a\x02\x10\x95\x4a\x05\x00\xab\x00\x20"
+            "\x88\x86\xb0\x16\x11\xbe\x25\x14\x00\xd1\x18\x50\x88\x88\xe5\xbe\xb7\xc1\x19\xf0\x00\xb0\x94\x00\xe8\xb0\x9c\xe6\x8b\x9f\xef\xbc"
+            "\xb1\x00\xe7\xa3\x35\x14\x00\xfd\x04\x11\x9a\x3a\x18\x61\xe8\x80\x81\xe7\xbf\x81\x6a\x06\x02\x81\x09\x50\x88\xb5\xe8\xbd\xae\x69"
+            "\x0b\x31\xe9\xb3\x9e\xf8\x01\x24\xb3\x9e\x78\x10\x56\x9d\x96\xe5\xb0\xbe\x10\x00\xf6\x00\xe5\x8d\xa1\xe7\x92\x9e\xe3\x83\xbb\xe9"
+            "\xb8\xa3\xe9\xb8\xa3\x10\x00\x00\x62\x05\x00\x58\x05\x04\x10\x00\x67\xe5\x93\x9e\xe5\x93\x9e\x30\x00\xf0\x00\xb3\x8d\xe9\xb3\x8d"
+            "\x00\xe7\xa7\x91\xe6\x96\xaf\xe8\x8e\xab\xad\x1a\x06\x0d\x00\x00\xf1\x0d\x10\xb4\x3d\x03\x30\xe8\xbf\xa6\x2f\x0e\x21\xac\xa7\xcb"
+            "\x15\x51\xa5\x88\xe9\x9b\x85\xe0\x0e\x50\x99\x9a\xe5\x90\xbe\x3b\x04\x20\xbe\xb7\xf6\x00\xf0\x01\xe8\x82\x8c\xe8\x9a\x8a\x00\xe8"
+            "\xb4\xb9\xe6\xb4\x9b\xe7\xbe\x8e\x84\x19\x00\x5d\x0c\x51\x9d\x9f\xe6\x9c\xa8\x24\x19\xf0\x04\x81\xab\xe8\xbe\x89\xe5\xa4\x9c\x00"
+            "\xe7\xba\xb8\xe5\xbe\xa1\xe5\x89\x91\x00\x5e\x07\x22\xa3\x9f\x0d\x17\x30\x00\xe5\xa5\x3f\x1c\x01\xc6\x12\x41\xb9\xe7\x8e\x9b\xd7"
+            "\x15\x51\x9c\xba\xe9\x9b\x85\xb6\x07\x50\x8e\x9b\xe5\xa4\x8f\x70\x0e\x00\x1d\x05\x20\xb4\x9d\x51\x18\x30\xe5\x9b\x9b\x26\x03\x21"
+            "\x92\x88\x07\x01\x40\x9e\x92\xe7\xa3\xdd\x1c\x42\x00\xe7\xa0\xb0\x12\x08\x30\xe4\xb8\x91\x5d\x07\x00\x67\x07\x20\xa5\xa5\xb4\x00"
+            "\x00",
+            10113, 12038
+        },
+    },
+};
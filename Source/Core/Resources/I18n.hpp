@@ -1,131 +1,32 @@
-#include <Core/Util/Global.hpp>
-#include <array>
-
-constexpr std::array<u8, 561> characteristic_de = { 78, 111, 110, 101, 0, 76, 105, 101, 98, 116, 32, 101, 115, 32, 122, 117, 32, 101, 115, 115, 101, 110, 0, 78, 105, 99, 107, 116, 32, 111, 102, 116, 32, 101, 105, 110, 0, 83, 99, 104, 108, 195, 164, 102, 116, 32, 103, 101, 114, 110, 0, 77, 97, 99, 104, 116, 32, 111, 102, 116, 32, 85, 110, 111, 114, 100, 110, 117, 110, 103, 0, 77, 97, 103, 32, 101, 115, 32, 122, 117, 32, 101, 110, 116, 115, 112, 97, 110, 110, 101, 110, 0, 83, 116, 111, 108, 122, 32, 97, 117, 102, 32, 115, 101, 105, 110, 101, 32, 83, 116, 195, 164, 114, 107, 101, 0, 80, 114, 195, 188, 103, 101, 108, 116, 32, 115, 105, 99, 104, 32, 103, 101, 114, 110, 0, 66, 101, 115, 105, 116, 122, 116, 32, 84, 101, 109, 101, 114, 97, 109, 101, 110, 116, 0, 76, 105, 101, 98, 116, 32, 75, 195, 164, 109, 112, 102, 101, 0, 73, 109, 112, 117, 108, 115, 105, 118, 0, 72, 97, 116, 32, 114, 111, 98, 117, 115, 116, 101, 110, 32, 75, 195, 182, 114, 112, 101, 114, 0, 75, 97, 110, 110, 32, 84, 114, 101, 102, 102, 101, 114, 32, 103, 117, 116, 32, 118, 101, 114, 107, 114, 97, 102, 116, 101, 110, 0, 195, 132, 117, 195, 159, 101, 114, 115, 116, 32, 97, 117, 115, 100, 97, 117, 101, 114, 110, 100, 0, 72, 97, 116, 32, 101, 105, 110, 101, 32, 103, 117, 116, 101, 32, 65, 117, 115, 100, 97, 117, 101, 114, 0, 73, 115, 116, 32, 98, 101, 104, 97, 114, 114, 108, 105, 99, 104, 0, 76, 105, 101, 98, 116, 32, 101, 115, 32, 122, 117, 32, 114, 101, 110, 110, 101, 110, 0, 65, 99, 104, 116, 101, 116, 32, 97, 117, 102, 32, 71, 101, 114, 195, 164, 117, 115, 99, 104, 101, 0, 85, 110, 103, 101, 115, 116, 195, 188, 109, 32, 117, 110, 100, 32, 101, 105, 110, 102, 195, 164, 108, 116, 105, 103, 0, 73, 115, 116, 32, 102, 97, 115, 116, 32, 119, 105, 101, 32, 101, 105, 110, 32, 67, 108, 111, 119, 110, 0, 70, 108, 195, 188, 99, 104, 116, 101, 116, 32, 115, 99, 104, 110, 101, 108, 108, 0, 83, 101, 104, 114, 32, 110, 101, 117, 103, 105, 101, 114, 105, 103, 0, 72, 105, 110, 116, 101, 114, 104, 195, 164, 108, 116, 105, 103, 0, 195, 132, 117, 115, 115, 101, 114, 115, 116, 32, 103, 101, 114, 105, 115, 115, 101, 110, 0, 73, 115, 116, 32, 111, 102, 116, 32, 105, 110, 32, 71, 101, 100, 97, 110, 107, 101, 110, 0, 83, 101, 104, 114, 32, 112, 101, 100, 97, 110, 116, 105, 115, 99, 104, 0, 66, 101, 115, 105, 116, 122, 116, 32, 115, 116, 97, 114, 107, 101, 110, 32, 87, 105, 108, 108, 101, 110, 0, 73, 114, 103, 101, 110, 100, 119, 105, 101, 32, 101, 105, 116, 101, 108, 0, 83, 101, 104, 114, 32, 97, 117, 102, 115, 195, 164, 115, 115, 105, 103, 0, 72, 97, 115, 115, 116, 32, 78, 105, 101, 100, 101, 114, 108, 97, 103, 101, 110, 0, 68, 105, 99, 107, 107, 195, 182, 112, 102, 105, 103, 0 };
-
-constexpr std::array<u8, 2185> dppt_de = { 48, 44, 67, 97, 110, 97, 108, 97, 118, 101, 32, 67, 105, 116, 121, 0, 49, 44, 69, 116, 101, 114, 110, 97, 32, 67, 105, 116, 121, 0, 50, 44, 80, 97, 115, 116, 111, 114, 105, 97, 32, 67, 105, 116, 121, 0, 51, 44, 83, 117, 110, 121, 115, 104, 111, 114, 101, 32, 67, 105, 116, 121, 0, 52, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 76, 101, 97, 103, 117, 101, 0, 53, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 77, 105, 110, 101, 32, 49, 70, 0, 54, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 77, 105, 110, 101, 32, 66, 49, 70, 0, 55, 44, 86, 97, 108, 108, 101, 121, 32, 87, 105, 110, 100, 119, 111, 114, 107, 115, 0, 56, 44, 69, 116, 101, 114, 110, 97, 32, 70, 111, 114, 101, 115, 116, 0, 57, 44, 70, 117, 101, 103, 111, 32, 73, 114, 111, 110, 119, 111, 114, 107, 115, 0, 49, 48, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 40, 82, 111, 117, 116, 101, 32, 50, 48, 55, 47, 50, 48, 56, 32, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 49, 49, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 50, 70, 0, 49, 50, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 51, 70, 0, 49, 51, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 83, 110, 111, 119, 0, 49, 52, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 52, 70, 0, 49, 53, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 53, 70, 0, 49, 54, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 54, 70, 0, 49, 55, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 55, 70, 0, 49, 56, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 84, 111, 112, 32, 67, 97, 118, 101, 0, 49, 57, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 40, 82, 111, 117, 116, 101, 32, 50, 49, 54, 32, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 50, 48, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 40, 82, 111, 117, 116, 101, 32, 50, 49, 49, 32, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 50, 49, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 66, 49, 70, 0, 50, 50, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 49, 0, 50, 51, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 50, 0, 50, 52, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 51, 0, 50, 53, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 52, 0, 50, 54, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 53, 0, 50, 55, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 54, 0, 50, 56, 44, 83, 111, 108, 97, 99, 101, 111, 110, 32, 82, 117, 105, 110, 115, 0, 50, 57, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 51, 48, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 50, 70, 0, 51, 49, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 49, 70, 0, 51, 50, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 97, 99, 107, 32, 82, 111, 111, 109, 32, 49, 0, 51, 51, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 97, 99, 107, 32, 82, 111, 111, 109, 32, 50, 0, 51, 52, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 97, 99, 107, 32, 82, 111, 111, 109, 32, 51, 0, 51, 53, 44, 82, 97, 118, 97, 103, 101, 100, 32, 80, 97, 116, 104, 0, 51, 54, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 71, 97, 116, 101, 32, 49, 70, 0, 51, 55, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 71, 97, 116, 101, 32, 66, 49, 70, 0, 51, 56, 44, 83, 116, 97, 114, 107, 32, 77, 111, 117, 110, 116, 97, 105, 110, 0, 51, 57, 44, 83, 116, 97, 114, 107, 32, 77, 111, 117, 110, 116, 97, 105, 110, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 52, 48, 44, 83, 116, 97, 114, 107, 32, 77, 111, 117, 110, 116, 97, 105, 110, 32, 73, 110, 116, 101, 114, 105, 111, 114, 0, 52, 49, 44, 83, 101, 110, 100, 111, 102, 102, 32, 83, 112, 114, 105, 110, 103, 0, 52, 50, 44, 84, 117, 114, 110, 98, 97, 99, 107, 32, 67, 97, 118, 101, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 52, 51, 44, 84, 117, 114, 110, 98, 97, 99, 107, 32, 67, 97, 118, 101, 32, 49, 115, 116, 32, 80, 105, 108, 108, 97, 114, 0, 52, 52, 44, 84, 117, 114, 110, 98, 97, 99, 107, 32, 67, 97, 118, 101, 32, 50, 110, 100, 32, 80, 105, 108, 108, 97, 114, 0, 52, 53, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 49, 70, 0, 52, 54, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 49, 70, 0, 52, 55, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 50, 70, 0, 52, 56, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 51, 70, 0, 52, 57, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 52, 70, 0, 53, 48, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 53, 70, 0, 53, 49, 44, 87, 97, 121, 119, 97, 114, 100, 32, 67, 97, 118, 101, 0, 53, 50, 44, 87, 97, 121, 119, 97, 114, 100, 32, 67, 97, 118, 101, 32, 40, 83, 101, 99, 114, 101, 116, 41, 0, 53, 51, 44, 82, 117, 105, 110, 32, 77, 97, 110, 105, 97, 99, 32, 67, 97, 118, 101, 32, 40, 60, 32, 49, 48, 32, 85, 110, 111, 119, 110, 41, 0, 53, 52, 44, 82, 117, 105, 110, 32, 77, 97, 110, 105, 97, 99, 32, 67, 97, 118, 101, 32, 40, 62, 32, 49, 48, 32, 85, 110, 111, 119, 110, 41, 0, 53, 53, 44, 77, 97, 110, 105, 97, 99, 32, 84, 117, 110, 110, 101, 108, 0, 53, 54, 44, 84, 114, 111, 112, 104, 121, 32, 71, 97, 114, 100, 101, 110, 0, 53, 55, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 0, 53, 56, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 49, 70, 0, 53, 57, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 49, 70, 0, 54, 48, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 50, 70, 32, 40, 76, 101, 102, 116, 41, 0, 54, 49, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 50, 70, 32, 40, 82, 105, 103, 104, 116, 41, 0, 54, 50, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 51, 70, 0, 54, 51, 44, 79, 108, 100, 32, 67, 104, 97, 116, 101, 97, 117, 0, 54, 52, 44, 79, 108, 100, 32, 67, 104, 97, 116, 101, 97, 117, 32, 82, 111, 111, 109, 32, 53, 0, 54, 53, 44, 76, 97, 107, 101, 32, 86, 101, 114, 105, 116, 121, 0, 54, 54, 44, 76, 97, 107, 101, 32, 86, 97, 108, 111, 114, 0, 54, 55, 44, 76, 97, 107, 101, 32, 65, 99, 117, 105, 116, 121, 0, 54, 56, 44, 86, 97, 108, 111, 114, 32, 76, 97, 107, 101, 102, 114, 111, 110, 116, 0, 54, 57, 44, 65, 99, 117, 105, 116, 121, 32, 76, 97, 107, 101, 102, 114, 111, 110, 116, 0, 55, 48, 44, 82, 111, 117, 116, 101, 32, 50, 48, 49, 0, 55, 49, 44, 82, 111, 117, 116, 101, 32, 50, 48, 50, 0, 55, 50, 44, 82, 111, 117, 116, 101, 32, 50, 48, 51, 0, 55, 51, 44, 82, 111, 117, 116, 101, 32, 50, 48, 52, 32, 40, 83, 111, 117, 116, 104, 41, 0, 55, 52, 44, 82, 111, 117, 116, 101, 32, 50, 48, 52, 32, 40, 78, 111, 114, 116, 104, 41, 0, 55, 53, 44, 82, 111, 117, 116, 101, 32, 50, 48, 53, 32, 40, 83, 111, 117, 116, 104, 41, 0, 55, 54, 44, 82, 111, 117, 116, 101, 32, 50, 48, 53, 32, 40, 78, 111, 114, 116, 104, 41, 0, 55, 55, 44, 82, 111, 117, 116, 101, 32, 50, 48, 54, 0, 55, 56, 44, 82, 111, 117, 116, 101, 32, 50, 48, 55, 0, 55, 57, 44, 82, 111, 117, 116, 101, 32, 50, 48, 56, 0, 56, 48, 44, 82, 111, 117, 116, 101, 32, 50, 48, 57, 0, 56, 49, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 49, 70, 0, 56, 50, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 50, 70, 0, 56, 51, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 51, 70, 0, 56, 52, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 52, 70, 0, 56, 53, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 53, 70, 0, 56, 54, 44, 82, 111, 117, 116, 101, 32, 50, 49, 48, 32, 40, 83, 111, 117, 116, 104, 41, 0, 56, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 48, 32, 40, 78, 111, 114, 116, 104, 41, 0, 56, 56, 44, 82, 111, 117, 116, 101, 32, 50, 49, 49, 32, 40, 87, 101, 115, 116, 41, 0, 56, 57, 44, 82, 111, 117, 116, 101, 32, 50, 49, 49, 32, 40, 69, 97, 115, 116, 41, 0, 57, 48, 44, 82, 111, 117, 116, 101, 32, 50, 49, 50, 32, 40, 78, 111, 114, 116, 104, 41, 0, 57, 49, 44, 82, 111, 117, 116, 101, 32, 50, 49, 50, 32, 40, 83, 111, 117, 116, 104, 41, 0, 57, 50, 44, 82, 111, 117, 116, 101, 32, 50, 49, 51, 0, 57, 51, 44, 82, 111, 117, 116, 101, 32, 50, 49, 52, 0, 57, 52, 44, 82, 111, 117, 116, 101, 32, 50, 49, 53, 0, 57, 53, 44, 82, 111, 117, 116, 101, 32, 50, 49, 54, 0, 57, 54, 44, 82, 111, 117, 116, 101, 32, 50, 49, 55, 0, 57, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 56, 0, 57, 56, 44, 82, 111, 117, 116, 101, 32, 50, 49, 57, 0, 57, 57, 44, 82, 111, 117, 116, 101, 32, 50, 50, 49, 0, 49, 48, 48, 44, 82, 111, 117, 116, 101, 32, 50, 50, 50, 0, 49, 48, 49, 44, 82, 111, 117, 116, 101, 32, 50, 50, 52, 0, 49, 48, 50, 44, 82, 111, 117, 116, 101, 32, 50, 50, 53, 0, 49, 48, 51, 44, 82, 111, 117, 116, 101, 32, 50, 50, 55, 0, 49, 48, 52, 44, 82, 111, 117, 116, 101, 32, 50, 50, 56, 0, 49, 48, 53, 44, 82, 111, 117, 116, 101, 32, 50, 50, 57, 0, 49, 48, 54, 44, 84, 119, 105, 110, 108, 101, 97, 102, 32, 84, 111, 119, 110, 0, 49, 48, 55, 44, 67, 101, 108, 101, 115, 116, 105, 99, 32, 84, 111, 119, 110, 0, 49, 48, 56, 44, 82, 101, 115, 111, 114, 116, 32, 65, 114, 101, 97, 0, 49, 48, 57, 44, 82, 111, 117, 116, 101, 32, 50, 50, 48, 0, 49, 49, 48, 44, 82, 111, 117, 116, 101, 32, 50, 50, 51, 0, 49, 49, 49, 44, 82, 111, 117, 116, 101, 32, 50, 50, 54, 0, 49, 49, 50, 44, 82, 111, 117, 116, 101, 32, 50, 51, 48, 0 };
-
-constexpr std::array<u8, 1799> frlg_de = { 48, 44, 80, 97, 108, 108, 101, 116, 32, 84, 111, 119, 110, 0, 49, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 67, 105, 116, 121, 0, 50, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 105, 116, 121, 0, 51, 44, 86, 101, 114, 109, 105, 108, 105, 111, 110, 32, 67, 105, 116, 121, 0, 52, 44, 67, 101, 108, 97, 100, 111, 110, 32, 67, 105, 116, 121, 0, 53, 44, 70, 117, 99, 104, 115, 105, 97, 32, 67, 105, 116, 121, 0, 54, 44, 67, 105, 110, 110, 97, 98, 97, 114, 32, 73, 115, 108, 97, 110, 100, 0, 55, 44, 82, 111, 117, 116, 101, 32, 49, 0, 56, 44, 82, 111, 117, 116, 101, 32, 50, 0, 57, 44, 82, 111, 117, 116, 101, 32, 51, 0, 49, 48, 44, 82, 111, 117, 116, 101, 32, 52, 0, 49, 49, 44, 82, 111, 117, 116, 101, 32, 53, 0, 49, 50, 44, 82, 111, 117, 116, 101, 32, 54, 0, 49, 51, 44, 82, 111, 117, 116, 101, 32, 55, 0, 49, 52, 44, 82, 111, 117, 116, 101, 32, 56, 0, 49, 53, 44, 82, 111, 117, 116, 101, 32, 57, 0, 49, 54, 44, 82, 111, 117, 116, 101, 32, 49, 48, 0, 49, 55, 44, 82, 111, 117, 116, 101, 32, 49, 49, 0, 49, 56, 44, 82, 111, 117, 116, 101, 32, 49, 50, 0, 49, 57, 44, 82, 111, 117, 116, 101, 32, 49, 51, 0, 50, 48, 44, 82, 111, 117, 116, 101, 32, 49, 52, 0, 50, 49, 44, 82, 111, 117, 116, 101, 32, 49, 53, 0, 50, 50, 44, 82, 111, 117, 116, 101, 32, 49, 54, 0, 50, 51, 44, 82, 111, 117, 116, 101, 32, 49, 55, 0, 50, 52, 44, 82, 111, 117, 116, 101, 32, 49, 56, 0, 50, 53, 44, 82, 111, 117, 116, 101, 32, 49, 57, 0, 50, 54, 44, 82, 111, 117, 116, 101, 32, 50, 48, 0, 50, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 0, 50, 56, 44, 82, 111, 117, 116, 101, 32, 50, 50, 0, 50, 57, 44, 82, 111, 117, 116, 101, 32, 50, 51, 0, 51, 48, 44, 82, 111, 117, 116, 101, 32, 50, 52, 0, 51, 49, 44, 82, 111, 117, 116, 101, 32, 50, 53, 0, 51, 50, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 70, 111, 114, 101, 115, 116, 0, 51, 51, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 49, 70, 0, 51, 52, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 66, 49, 70, 0, 51, 53, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 66, 50, 70, 0, 51, 54, 44, 83, 46, 83, 46, 32, 65, 110, 110, 101, 0, 51, 55, 44, 68, 105, 103, 108, 101, 116, 116, 39, 115, 32, 67, 97, 118, 101, 0, 51, 56, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 51, 57, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 50, 70, 0, 52, 48, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 51, 70, 0, 52, 49, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 77, 97, 110, 115, 105, 111, 110, 32, 49, 70, 45, 51, 70, 0, 52, 50, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 77, 97, 110, 115, 105, 111, 110, 32, 66, 49, 70, 0, 52, 51, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 67, 101, 110, 116, 101, 114, 0, 52, 52, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 49, 0, 52, 53, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 50, 0, 52, 54, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 51, 0, 52, 55, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 49, 70, 0, 52, 56, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 66, 49, 70, 0, 52, 57, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 49, 70, 0, 53, 48, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 49, 70, 0, 53, 49, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 50, 70, 0, 53, 50, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 51, 70, 0, 53, 51, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 52, 70, 0, 53, 52, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 51, 70, 0, 53, 53, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 52, 70, 0, 53, 54, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 53, 70, 0, 53, 55, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 54, 70, 0, 53, 56, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 55, 70, 0, 53, 57, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 49, 70, 0, 54, 48, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 50, 70, 0, 54, 49, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 54, 50, 44, 80, 111, 119, 101, 114, 32, 80, 108, 97, 110, 116, 0, 54, 51, 44, 79, 110, 101, 32, 73, 115, 108, 97, 110, 100, 0, 54, 52, 44, 70, 111, 117, 114, 32, 73, 115, 108, 97, 110, 100, 0, 54, 53, 44, 70, 105, 118, 101, 32, 73, 115, 108, 97, 110, 100, 0, 54, 54, 44, 75, 105, 110, 100, 108, 101, 32, 82, 111, 97, 100, 0, 54, 55, 44, 84, 114, 101, 97, 115, 117, 114, 101, 32, 66, 101, 97, 99, 104, 0, 54, 56, 44, 67, 97, 112, 101, 32, 66, 114, 105, 110, 107, 0, 54, 57, 44, 66, 111, 110, 100, 32, 66, 114, 105, 100, 103, 101, 0, 55, 48, 44, 84, 104, 114, 101, 101, 32, 73, 115, 108, 101, 32, 80, 111, 114, 116, 0, 55, 49, 44, 82, 101, 115, 111, 114, 116, 32, 71, 111, 114, 103, 101, 111, 117, 115, 0, 55, 50, 44, 87, 97, 116, 101, 114, 32, 76, 97, 98, 121, 114, 105, 110, 116, 104, 0, 55, 51, 44, 70, 105, 118, 101, 32, 73, 115, 108, 101, 32, 77, 101, 97, 100, 111, 119, 0, 55, 52, 44, 77, 101, 109, 111, 114, 105, 97, 108, 32, 80, 105, 108, 108, 97, 114, 0, 55, 53, 44, 79, 117, 116, 99, 97, 115, 116, 32, 73, 115, 108, 97, 110, 100, 0, 55, 54, 44, 71, 114, 101, 101, 110, 32, 80, 97, 116, 104, 0, 55, 55, 44, 87, 97, 116, 101, 114, 32, 80, 97, 116, 104, 0, 55, 56, 44, 82, 117, 105, 110, 32, 86, 97, 108, 108, 101, 121, 0, 55, 57, 44, 84, 114, 97, 105, 110, 101, 114, 32, 84, 111, 119, 101, 114, 32, 40, 101, 120, 116, 101, 114, 105, 111, 114, 41, 0, 56, 48, 44, 67, 97, 110, 121, 111, 110, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 56, 49, 44, 83, 101, 118, 97, 117, 108, 116, 32, 67, 97, 110, 121, 111, 110, 0, 56, 50, 44, 84, 97, 110, 111, 98, 121, 32, 82, 117, 105, 110, 115, 0, 56, 51, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 0, 56, 52, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 82, 111, 111, 109, 32, 49, 0, 56, 53, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 82, 111, 111, 109, 32, 50, 0, 56, 54, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 82, 111, 111, 109, 32, 51, 0, 56, 55, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 49, 70, 0, 56, 56, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 49, 70, 0, 56, 57, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 50, 70, 0, 57, 48, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 51, 70, 0, 57, 49, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 52, 70, 0, 57, 50, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 53, 70, 0, 57, 51, 44, 66, 101, 114, 114, 121, 32, 70, 111, 114, 101, 115, 116, 0, 57, 52, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 0, 57, 53, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 32, 49, 70, 0, 57, 54, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 57, 55, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 32, 66, 97, 99, 107, 0, 57, 56, 44, 80, 97, 116, 116, 101, 114, 110, 32, 66, 117, 115, 104, 0, 57, 57, 44, 65, 108, 116, 101, 114, 105, 110, 103, 32, 67, 97, 118, 101, 0, 49, 48, 48, 44, 77, 111, 110, 101, 97, 110, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 49, 44, 76, 105, 112, 116, 111, 111, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 50, 44, 87, 101, 101, 112, 116, 104, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 51, 44, 68, 105, 108, 102, 111, 114, 100, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 52, 44, 83, 99, 117, 102, 105, 98, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 53, 44, 82, 105, 120, 121, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 54, 44, 86, 105, 97, 112, 111, 105, 115, 32, 67, 104, 97, 109, 98, 101, 114, 0 };
-
-constexpr std::array<u8, 1948> hgss_de = { 48, 44, 78, 101, 119, 32, 66, 97, 114, 107, 32, 84, 111, 119, 110, 0, 49, 44, 82, 111, 117, 116, 101, 32, 50, 57, 0, 50, 44, 67, 104, 101, 114, 114, 121, 103, 114, 111, 118, 101, 32, 67, 105, 116, 121, 0, 51, 44, 82, 111, 117, 116, 101, 32, 51, 48, 0, 52, 44, 82, 111, 117, 116, 101, 32, 51, 49, 0, 53, 44, 86, 105, 111, 108, 101, 116, 32, 67, 105, 116, 121, 0, 54, 44, 83, 112, 114, 111, 117, 116, 32, 84, 111, 119, 101, 114, 0, 55, 44, 82, 111, 117, 116, 101, 32, 51, 50, 0, 56, 44, 82, 117, 105, 110, 115, 32, 111, 102, 32, 65, 108, 112, 104, 32, 40, 79, 117, 116, 115, 105, 100, 101, 41, 0, 57, 44, 82, 117, 105, 110, 115, 32, 111, 102, 32, 65, 108, 112, 104, 32, 40, 73, 110, 115, 105, 100, 101, 41, 0, 49, 48, 44, 85, 110, 105, 111, 110, 32, 67, 97, 118, 101, 32, 49, 70, 0, 49, 49, 44, 85, 110, 105, 111, 110, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 49, 50, 44, 85, 110, 105, 111, 110, 32, 67, 97, 118, 101, 32, 66, 50, 70, 0, 49, 51, 44, 82, 111, 117, 116, 101, 32, 51, 51, 0, 49, 52, 44, 83, 76, 79, 87, 80, 79, 75, 69, 32, 87, 101, 108, 108, 32, 49, 70, 0, 49, 53, 44, 83, 76, 79, 87, 80, 79, 75, 69, 32, 87, 101, 108, 108, 32, 66, 49, 70, 0, 49, 54, 44, 73, 108, 101, 120, 32, 70, 111, 114, 101, 115, 116, 0, 49, 55, 44, 82, 111, 117, 116, 101, 32, 51, 52, 0, 49, 56, 44, 82, 111, 117, 116, 101, 32, 51, 53, 0, 49, 57, 44, 78, 97, 116, 105, 111, 110, 97, 108, 32, 80, 97, 114, 107, 0, 50, 48, 44, 82, 111, 117, 116, 101, 32, 51, 54, 0, 50, 49, 44, 82, 111, 117, 116, 101, 32, 51, 55, 0, 50, 50, 44, 69, 99, 114, 117, 116, 101, 97, 107, 32, 67, 105, 116, 121, 0, 50, 51, 44, 66, 117, 114, 110, 101, 100, 32, 84, 111, 119, 101, 114, 32, 49, 70, 0, 50, 52, 44, 66, 117, 114, 110, 101, 100, 32, 84, 111, 119, 101, 114, 32, 66, 49, 70, 0, 50, 53, 44, 66, 101, 108, 108, 32, 84, 111, 119, 101, 114, 0, 50, 54, 44, 82, 111, 117, 116, 101, 32, 51, 56, 0, 50, 55, 44, 82, 111, 117, 116, 101, 32, 51, 57, 0, 50, 56, 44, 79, 108, 105, 118, 105, 110, 101, 32, 67, 105, 116, 121, 0, 50, 57, 44, 82, 111, 117, 116, 101, 32, 52, 48, 0, 51, 48, 44, 82, 111, 117, 116, 101, 32, 52, 49, 0, 51, 49, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 49, 70, 0, 51, 50, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 49, 70, 0, 51, 51, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 50, 70, 0, 51, 52, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 51, 70, 0, 51, 53, 44, 67, 105, 97, 110, 119, 111, 111, 100, 32, 67, 105, 116, 121, 0, 51, 54, 44, 82, 111, 117, 116, 101, 32, 52, 50, 0, 51, 55, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 49, 70, 0, 51, 56, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 49, 70, 32, 40, 66, 97, 99, 107, 41, 0, 51, 57, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 50, 70, 0, 52, 48, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 66, 49, 70, 0, 52, 49, 44, 82, 111, 117, 116, 101, 32, 52, 51, 0, 52, 50, 44, 76, 97, 107, 101, 32, 111, 102, 32, 82, 97, 103, 101, 0, 52, 51, 44, 82, 111, 117, 116, 101, 32, 52, 52, 0, 52, 52, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 49, 70, 0, 52, 53, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 66, 49, 70, 0, 52, 54, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 66, 50, 70, 0, 52, 55, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 66, 51, 70, 0, 52, 56, 44, 66, 108, 97, 99, 107, 116, 104, 111, 114, 110, 32, 67, 105, 116, 121, 0, 52, 57, 44, 68, 114, 97, 103, 111, 110, 226, 128, 153, 115, 32, 68, 101, 110, 0, 53, 48, 44, 82, 111, 117, 116, 101, 32, 52, 53, 0, 53, 49, 44, 82, 111, 117, 116, 101, 32, 52, 54, 0, 53, 50, 44, 68, 97, 114, 107, 32, 67, 97, 118, 101, 32, 40, 82, 111, 117, 116, 101, 32, 51, 49, 41, 0, 53, 51, 44, 68, 97, 114, 107, 32, 67, 97, 118, 101, 32, 40, 82, 111, 117, 116, 101, 32, 52, 53, 41, 0, 53, 52, 44, 82, 111, 117, 116, 101, 32, 52, 55, 0, 53, 53, 44, 77, 116, 46, 32, 77, 111, 111, 110, 0, 53, 54, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 40, 67, 108, 101, 102, 97, 105, 114, 121, 41, 0, 53, 55, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 49, 70, 0, 53, 56, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 49, 70, 0, 53, 57, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 50, 70, 0, 54, 48, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 51, 70, 0, 54, 49, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 52, 70, 0, 54, 50, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 49, 70, 0, 54, 51, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 67, 97, 118, 101, 32, 49, 70, 32, 84, 111, 112, 0, 54, 52, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 52, 70, 0, 54, 53, 44, 67, 108, 105, 102, 102, 32, 69, 100, 103, 101, 32, 71, 97, 116, 101, 0, 54, 54, 44, 67, 108, 105, 102, 102, 32, 67, 97, 118, 101, 0, 54, 55, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 0, 54, 56, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 50, 70, 0, 54, 57, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 67, 97, 118, 101, 32, 77, 111, 117, 110, 116, 97, 105, 110, 115, 105, 100, 101, 0, 55, 48, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 67, 97, 118, 101, 32, 51, 70, 0, 55, 49, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 84, 111, 112, 0, 55, 50, 44, 82, 111, 117, 116, 101, 32, 49, 50, 0, 55, 51, 44, 82, 111, 117, 116, 101, 32, 49, 57, 0, 55, 52, 44, 82, 111, 117, 116, 101, 32, 50, 48, 0, 55, 53, 44, 80, 97, 108, 108, 101, 116, 32, 84, 111, 119, 110, 0, 55, 54, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 67, 105, 116, 121, 0, 55, 55, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 105, 116, 121, 0, 55, 56, 44, 86, 101, 114, 109, 105, 108, 105, 111, 110, 32, 67, 105, 116, 121, 0, 55, 57, 44, 67, 101, 108, 97, 100, 111, 110, 32, 67, 105, 116, 121, 0, 56, 48, 44, 70, 117, 99, 104, 115, 105, 97, 32, 67, 105, 116, 121, 0, 56, 49, 44, 67, 105, 110, 110, 97, 98, 97, 114, 32, 73, 115, 108, 97, 110, 100, 0, 56, 50, 44, 82, 111, 117, 116, 101, 32, 52, 56, 0, 56, 51, 44, 82, 111, 117, 116, 101, 32, 50, 54, 0, 56, 52, 44, 82, 111, 117, 116, 101, 32, 50, 55, 0, 56, 53, 44, 82, 111, 117, 116, 101, 32, 50, 56, 0, 56, 54, 44, 77, 116, 46, 32, 77, 111, 111, 110, 0, 56, 55, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 49, 70, 0, 56, 56, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 50, 70, 0, 56, 57, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 57, 48, 44, 82, 111, 117, 116, 101, 32, 49, 0, 57, 49, 44, 82, 111, 117, 116, 101, 32, 50, 32, 40, 83, 111, 117, 116, 104, 41, 0, 57, 50, 44, 82, 111, 117, 116, 101, 32, 51, 0, 57, 51, 44, 82, 111, 117, 116, 101, 32, 52, 0, 57, 52, 44, 82, 111, 117, 116, 101, 32, 53, 0, 57, 53, 44, 82, 111, 117, 116, 101, 32, 54, 0, 57, 54, 44, 82, 111, 117, 116, 101, 32, 55, 0, 57, 55, 44, 82, 111, 117, 116, 101, 32, 56, 0, 57, 56, 44, 82, 111, 117, 116, 101, 32, 57, 0, 57, 57, 44, 82, 111, 117, 116, 101, 32, 49, 48, 0, 49, 48, 48, 44, 82, 111, 117, 116, 101, 32, 49, 49, 0, 49, 48, 49, 44, 82, 111, 117, 116, 101, 32, 49, 51, 0, 49, 48, 50, 44, 82, 111, 117, 116, 101, 32, 49, 52, 0, 49, 48, 51, 44, 82, 111, 117, 116, 101, 32, 49, 53, 0, 49, 48, 52, 44, 82, 111, 117, 116, 101, 32, 49, 54, 0, 49, 48, 53, 44, 82, 111, 117, 116, 101, 32, 49, 55, 0, 49, 48, 54, 44, 82, 111, 117, 116, 101, 32, 49, 56, 0, 49, 48, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 0, 49, 48, 56, 44, 82, 111, 117, 116, 101, 32, 50, 50, 0, 49, 48, 57, 44, 82, 111, 117, 116, 101, 32, 50, 52, 0, 49, 49, 48, 44, 82, 111, 117, 116, 101, 32, 50, 53, 0, 49, 49, 49, 44, 84, 111, 104, 106, 111, 32, 70, 97, 108, 108, 115, 0, 49, 49, 50, 44, 68, 73, 71, 76, 69, 84, 84, 226, 128, 153, 115, 32, 67, 97, 118, 101, 0, 49, 49, 51, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 50, 70, 0, 49, 49, 52, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 51, 70, 0, 49, 49, 53, 44, 82, 111, 117, 116, 101, 32, 50, 32, 40, 78, 111, 114, 116, 104, 41, 0, 49, 49, 54, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 70, 111, 114, 101, 115, 116, 0, 49, 49, 55, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 49, 70, 0, 49, 49, 56, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 50, 70, 0, 49, 49, 57, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0 };
-
-constexpr std::array<u8, 156> natures_de = { 82, 111, 98, 117, 115, 116, 0, 83, 111, 108, 111, 0, 77, 117, 116, 105, 103, 0, 72, 97, 114, 116, 0, 70, 114, 101, 99, 104, 0, 75, 195, 188, 104, 110, 0, 83, 97, 110, 102, 116, 0, 76, 111, 99, 107, 101, 114, 0, 80, 102, 105, 102, 102, 105, 103, 0, 76, 97, 115, 99, 104, 0, 83, 99, 104, 101, 117, 0, 72, 97, 115, 116, 105, 103, 0, 69, 114, 110, 115, 116, 0, 70, 114, 111, 104, 0, 78, 97, 105, 118, 0, 77, 195, 164, 195, 159, 105, 103, 0, 77, 105, 108, 100, 0, 82, 117, 104, 105, 103, 0, 90, 97, 103, 104, 97, 102, 116, 0, 72, 105, 116, 122, 105, 103, 0, 83, 116, 105, 108, 108, 0, 90, 97, 114, 116, 0, 70, 111, 114, 115, 99, 104, 0, 83, 97, 99, 104, 116, 0, 75, 97, 117, 122, 105, 103, 0 };
-
-constexpr std::array<u8, 104> powers_de = { 75, 97, 109, 112, 102, 0, 70, 108, 117, 103, 0, 71, 105, 102, 116, 0, 66, 111, 100, 101, 110, 0, 71, 101, 115, 116, 101, 105, 110, 0, 75, 195, 164, 102, 101, 114, 0, 71, 101, 105, 115, 116, 0, 83, 116, 97, 104, 108, 0, 70, 101, 117, 101, 114, 0, 87, 97, 115, 115, 101, 114, 0, 80, 102, 108, 97, 110, 122, 101, 0, 69, 108, 101, 107, 116, 114, 111, 0, 80, 115, 121, 99, 104, 111, 0, 69, 105, 115, 0, 68, 114, 97, 99, 104, 101, 0, 85, 110, 108, 105, 99, 104, 116, 0 };
-
-constexpr std::array<u8, 1480> rse_de = { 48, 44, 68, 101, 119, 102, 111, 114, 100, 32, 84, 111, 119, 110, 0, 49, 44, 80, 97, 99, 105, 102, 105, 100, 108, 111, 103, 32, 84, 111, 119, 110, 0, 50, 44, 80, 101, 116, 97, 108, 98, 117, 114, 103, 32, 67, 105, 116, 121, 0, 51, 44, 83, 108, 97, 116, 101, 112, 111, 114, 116, 32, 67, 105, 116, 121, 0, 52, 44, 76, 105, 108, 121, 99, 111, 118, 101, 32, 67, 105, 116, 121, 0, 53, 44, 77, 111, 115, 115, 100, 101, 101, 112, 32, 67, 105, 116, 121, 0, 54, 44, 83, 111, 111, 116, 111, 112, 111, 108, 105, 115, 32, 67, 105, 116, 121, 0, 55, 44, 69, 118, 101, 114, 32, 71, 114, 97, 110, 100, 101, 32, 67, 105, 116, 121, 0, 56, 44, 82, 111, 117, 116, 101, 32, 49, 48, 49, 0, 57, 44, 82, 111, 117, 116, 101, 32, 49, 48, 50, 0, 49, 48, 44, 82, 111, 117, 116, 101, 32, 49, 48, 51, 0, 49, 49, 44, 82, 111, 117, 116, 101, 32, 49, 48, 52, 0, 49, 50, 44, 82, 111, 117, 116, 101, 32, 49, 48, 53, 0, 49, 51, 44, 82, 111, 117, 116, 101, 32, 49, 48, 54, 0, 49, 52, 44, 82, 111, 117, 116, 101, 32, 49, 48, 55, 0, 49, 53, 44, 82, 111, 117, 116, 101, 32, 49, 48, 56, 0, 49, 54, 44, 82, 111, 117, 116, 101, 32, 49, 48, 57, 0, 49, 55, 44, 82, 111, 117, 116, 101, 32, 49, 49, 48, 0, 49, 56, 44, 82, 111, 117, 116, 101, 32, 49, 49, 49, 0, 49, 57, 44, 82, 111, 117, 116, 101, 32, 49, 49, 50, 0, 50, 48, 44, 82, 111, 117, 116, 101, 32, 49, 49, 51, 0, 50, 49, 44, 82, 111, 117, 116, 101, 32, 49, 49, 52, 0, 50, 50, 44, 82, 111, 117, 116, 101, 32, 49, 49, 53, 0, 50, 51, 44, 82, 111, 117, 116, 101, 32, 49, 49, 54, 0, 50, 52, 44, 82, 111, 117, 116, 101, 32, 49, 49, 55, 0, 50, 53, 44, 82, 111, 117, 116, 101, 32, 49, 49, 56, 0, 50, 54, 44, 82, 111, 117, 116, 101, 32, 49, 49, 57, 0, 50, 55, 44, 82, 111, 117, 116, 101, 32, 49, 50, 48, 0, 50, 56, 44, 82, 111, 117, 116, 101, 32, 49, 50, 49, 0, 50, 57, 44, 82, 111, 117, 116, 101, 32, 49, 50, 50, 0, 51, 48, 44, 82, 111, 117, 116, 101, 32, 49, 50, 51, 0, 51, 49, 44, 82, 111, 117, 116, 101, 32, 49, 50, 52, 0, 51, 50, 44, 82, 111, 117, 116, 101, 32, 49, 50, 53, 0, 51, 51, 44, 82, 111, 117, 116, 101, 32, 49, 50, 54, 0, 51, 52, 44, 82, 111, 117, 116, 101, 32, 49, 50, 55, 0, 51, 53, 44, 82, 111, 117, 116, 101, 32, 49, 50, 56, 0, 51, 54, 44, 82, 111, 117, 116, 101, 32, 49, 50, 57, 0, 51, 55, 44, 82, 111, 117, 116, 101, 32, 49, 51, 48, 0, 51, 56, 44, 82, 111, 117, 116, 101, 32, 49, 51, 49, 0, 51, 57, 44, 82, 111, 117, 116, 101, 32, 49, 51, 50, 0, 52, 48, 44, 82, 111, 117, 116, 101, 32, 49, 51, 51, 0, 52, 49, 44, 82, 111, 117, 116, 101, 32, 49, 51, 52, 0, 52, 50, 44, 85, 110, 100, 101, 114, 119, 97, 116, 101, 114, 32, 40, 82, 111, 117, 116, 101, 32, 49, 50, 52, 41, 0, 52, 51, 44, 85, 110, 100, 101, 114, 119, 97, 116, 101, 114, 32, 40, 82, 111, 117, 116, 101, 32, 49, 50, 54, 41, 0, 52, 52, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 49, 70, 0, 52, 53, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 83, 116, 101, 118, 101, 110, 39, 115, 32, 82, 111, 111, 109, 0, 52, 54, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 52, 55, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 66, 50, 70, 0, 52, 56, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 49, 0, 52, 57, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 50, 0, 53, 48, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 51, 0, 53, 49, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 52, 0, 53, 50, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 53, 0, 53, 51, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 54, 0, 53, 52, 44, 80, 101, 116, 97, 108, 98, 117, 114, 103, 32, 87, 111, 111, 100, 115, 0, 53, 53, 44, 82, 117, 115, 116, 117, 114, 102, 32, 84, 117, 110, 110, 101, 108, 0, 53, 54, 44, 65, 98, 97, 110, 100, 111, 110, 101, 100, 32, 83, 104, 105, 112, 0, 53, 55, 44, 78, 101, 119, 32, 77, 97, 117, 118, 105, 108, 108, 101, 32, 40, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 53, 56, 44, 78, 101, 119, 32, 77, 97, 117, 118, 105, 108, 108, 101, 32, 40, 66, 97, 115, 101, 109, 101, 110, 116, 41, 0, 53, 57, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 49, 70, 32, 49, 82, 0, 54, 48, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 49, 70, 32, 50, 82, 0, 54, 49, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 66, 49, 70, 32, 49, 82, 0, 54, 50, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 66, 49, 70, 32, 50, 82, 0, 54, 51, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 83, 116, 101, 118, 101, 110, 39, 115, 32, 67, 97, 118, 101, 0, 54, 52, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 49, 70, 45, 51, 70, 0, 54, 53, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 52, 70, 45, 54, 70, 0, 54, 54, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 69, 120, 116, 101, 114, 105, 111, 114, 0, 54, 55, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 83, 117, 109, 109, 105, 116, 0, 54, 56, 44, 83, 104, 111, 97, 108, 32, 67, 97, 118, 101, 0, 54, 57, 44, 83, 104, 111, 97, 108, 32, 67, 97, 118, 101, 32, 73, 99, 101, 32, 82, 111, 111, 109, 0, 55, 48, 44, 83, 101, 97, 102, 108, 111, 111, 114, 32, 67, 97, 118, 101, 114, 110, 0, 55, 49, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 55, 50, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 49, 70, 0, 55, 51, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 50, 70, 0, 55, 52, 44, 67, 97, 118, 101, 32, 111, 102, 32, 79, 114, 105, 103, 105, 110, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 55, 53, 44, 67, 97, 118, 101, 32, 111, 102, 32, 79, 114, 105, 103, 105, 110, 0, 55, 54, 44, 70, 105, 101, 114, 121, 32, 80, 97, 116, 104, 0, 55, 55, 44, 74, 97, 103, 103, 101, 100, 32, 80, 97, 115, 115, 0, 55, 56, 44, 83, 107, 121, 32, 80, 105, 108, 108, 97, 114, 32, 49, 70, 0, 55, 57, 44, 83, 107, 121, 32, 80, 105, 108, 108, 97, 114, 32, 51, 70, 0, 56, 48, 44, 83, 107, 121, 32, 80, 105, 108, 108, 97, 114, 32, 53, 70, 0, 56, 49, 44, 77, 97, 103, 109, 97, 32, 72, 105, 100, 101, 111, 117, 116, 0, 56, 50, 44, 77, 105, 114, 97, 103, 101, 32, 84, 111, 119, 101, 114, 0, 56, 51, 44, 65, 114, 116, 105, 115, 97, 110, 32, 67, 97, 118, 101, 0, 56, 52, 44, 68, 101, 115, 101, 114, 116, 32, 85, 110, 100, 101, 114, 112, 97, 115, 115, 0, 56, 53, 44, 65, 108, 116, 101, 114, 105, 110, 103, 32, 67, 97, 118, 101, 0 };
-
-constexpr std::array<u8, 6933> species_de = { 239, 187, 191, 66, 105, 115, 97, 115, 97, 109, 0, 66, 105, 115, 97, 107, 110, 111, 115, 112, 0, 66, 105, 115, 97, 102, 108, 111, 114, 0, 71, 108, 117, 109, 97, 110, 100, 97, 0, 71, 108, 117, 116, 101, 120, 111, 0, 71, 108, 117, 114, 97, 107, 0, 83, 99, 104, 105, 103, 103, 121, 0, 83, 99, 104, 105, 108, 108, 111, 107, 0, 84, 117, 114, 116, 111, 107, 0, 82, 97, 117, 112, 121, 0, 83, 97, 102, 99, 111, 110, 0, 83, 109, 101, 116, 116, 98, 111, 0, 72, 111, 114, 110, 108, 105, 117, 0, 75, 111, 107, 117, 110, 97, 0, 66, 105, 98, 111, 114, 0, 84, 97, 117, 98, 115, 105, 0, 84, 97, 117, 98, 111, 103, 97, 0, 84, 97, 117, 98, 111, 115, 115, 0, 82, 97, 116, 116, 102, 114, 97, 116, 122, 0, 82, 97, 116, 116, 105, 107, 97, 114, 108, 0, 72, 97, 98, 105, 116, 97, 107, 0, 73, 98, 105, 116, 97, 107, 0, 82, 101, 116, 116, 97, 110, 0, 65, 114, 98, 111, 107, 0, 80, 105, 107, 97, 99, 104, 117, 0, 82, 97, 105, 99, 104, 117, 0, 83, 97, 110, 100, 97, 110, 0, 83, 97, 110, 100, 97, 109, 101, 114, 0, 78, 105, 100, 111, 114, 97, 110, 226, 153, 128, 0, 78, 105, 100, 111, 114, 105, 110, 97, 0, 78, 105, 100, 111, 113, 117, 101, 101, 110, 0, 78, 105, 100, 111, 114, 97, 110, 226, 153, 130, 0, 78, 105, 100, 111, 114, 105, 110, 111, 0, 78, 105, 100, 111, 107, 105, 110, 103, 0, 80, 105, 101, 112, 105, 0, 80, 105, 120, 105, 0, 86, 117, 108, 112, 105, 120, 0, 86, 117, 108, 110, 111, 110, 97, 0, 80, 117, 109, 109, 101, 108, 117, 102, 102, 0, 75, 110, 117, 100, 100, 101, 108, 117, 102, 102, 0, 90, 117, 98, 97, 116, 0, 71, 111, 108, 98, 97, 116, 0, 77, 121, 114, 97, 112, 108, 97, 0, 68, 117, 102, 108, 111, 114, 0, 71, 105, 102, 108, 111, 114, 0, 80, 97, 114, 97, 115, 0, 80, 97, 114, 97, 115, 101, 107, 0, 66, 108, 117, 122, 117, 107, 0, 79, 109, 111, 116, 0, 68, 105, 103, 100, 97, 0, 68, 105, 103, 100, 114, 105, 0, 77, 97, 117, 122, 105, 0, 83, 110, 111, 98, 105, 108, 105, 107, 97, 116, 0, 69, 110, 116, 111, 110, 0, 69, 110, 116, 111, 114, 111, 110, 0, 77, 101, 110, 107, 105, 0, 82, 97, 115, 97, 102, 102, 0, 70, 117, 107, 97, 110, 111, 0, 65, 114, 107, 97, 110, 105, 0, 81, 117, 97, 112, 115, 101, 108, 0, 81, 117, 97, 112, 117, 116, 122, 105, 0, 81, 117, 97, 112, 112, 111, 0, 65, 98, 114, 97, 0, 75, 97, 100, 97, 98, 114, 97, 0, 83, 105, 109, 115, 97, 108, 97, 0, 77, 97, 99, 104, 111, 108, 108, 111, 0, 77, 97, 115, 99, 104, 111, 99, 107, 0, 77, 97, 99, 104, 111, 109, 101, 105, 0, 75, 110, 111, 102, 101, 110, 115, 97, 0, 85, 108, 116, 114, 105, 103, 97, 114, 105, 97, 0, 83, 97, 114, 122, 101, 110, 105, 97, 0, 84, 101, 110, 116, 97, 99, 104, 97, 0, 84, 101, 110, 116, 111, 120, 97, 0, 75, 108, 101, 105, 110, 115, 116, 101, 105, 110, 0, 71, 101, 111, 114, 111, 107, 0, 71, 101, 111, 119, 97, 122, 0, 80, 111, 110, 105, 116, 97, 0, 71, 97, 108, 108, 111, 112, 97, 0, 70, 108, 101, 103, 109, 111, 110, 0, 76, 97, 104, 109, 117, 115, 0, 77, 97, 103, 110, 101, 116, 105, 108, 111, 0, 77, 97, 103, 110, 101, 116, 111, 110, 0, 80, 111, 114, 101, 110, 116, 97, 0, 68, 111, 100, 117, 0, 68, 111, 100, 114, 105, 0, 74, 117, 114, 111, 98, 0, 74, 117, 103, 111, 110, 103, 0, 83, 108, 101, 105, 109, 97, 0, 83, 108, 101, 105, 109, 111, 107, 0, 77, 117, 115, 99, 104, 97, 115, 0, 65, 117, 115, 116, 111, 115, 0, 78, 101, 98, 117, 108, 97, 107, 0, 65, 108, 112, 111, 108, 108, 111, 0, 71, 101, 110, 103, 97, 114, 0, 79, 110, 105, 120, 0, 84, 114, 97, 117, 109, 97, 116, 111, 0, 72, 121, 112, 110, 111, 0, 75, 114, 97, 98, 98, 121, 0, 75, 105, 110, 103, 108, 101, 114, 0, 86, 111, 108, 116, 111, 98, 97, 108, 0, 76, 101, 107, 116, 114, 111, 98, 97, 108, 0, 79, 119, 101, 105, 0, 75, 111, 107, 111, 119, 101, 105, 0, 84, 114, 97, 103, 111, 115, 115, 111, 0, 75, 110, 111, 103, 103, 97, 0, 75, 105, 99, 107, 108, 101, 101, 0, 78, 111, 99, 107, 99, 104, 97, 110, 0, 83, 99, 104, 108, 117, 114, 112, 0, 83, 109, 111, 103, 111, 110, 0, 83, 109, 111, 103, 109, 111, 103, 0, 82, 105, 104, 111, 114, 110, 0, 82, 105, 122, 101, 114, 111, 115, 0, 67, 104, 97, 110, 101, 105, 114, 97, 0, 84, 97, 110, 103, 101, 108, 97, 0, 75, 97, 110, 103, 97, 109, 97, 0, 83, 101, 101, 112, 101, 114, 0, 83, 101, 101, 109, 111, 110, 0, 71, 111, 108, 100, 105, 110, 105, 0, 71, 111, 108, 107, 105, 110, 103, 0, 83, 116, 101, 114, 110, 100, 117, 0, 83, 116, 97, 114, 109, 105, 101, 0, 80, 97, 110, 116, 105, 109, 111, 115, 0, 83, 105, 99, 104, 108, 111, 114, 0, 82, 111, 115, 115, 97, 110, 97, 0, 69, 108, 101, 107, 116, 101, 107, 0, 77, 97, 103, 109, 97, 114, 0, 80, 105, 110, 115, 105, 114, 0, 84, 97, 117, 114, 111, 115, 0, 75, 97, 114, 112, 97, 100, 111, 114, 0, 71, 97, 114, 97, 100, 111, 115, 0, 76, 97, 112, 114, 97, 115, 0, 68, 105, 116, 116, 111, 0, 69, 118, 111, 108, 105, 0, 65, 113, 117, 97, 110, 97, 0, 66, 108, 105, 116, 122, 97, 0, 70, 108, 97, 109, 97, 114, 97, 0, 80, 111, 114, 121, 103, 111, 110, 0, 65, 109, 111, 110, 105, 116, 97, 115, 0, 65, 109, 111, 114, 111, 115, 111, 0, 75, 97, 98, 117, 116, 111, 0, 75, 97, 98, 117, 116, 111, 112, 115, 0, 65, 101, 114, 111, 100, 97, 99, 116, 121, 108, 0, 82, 101, 108, 97, 120, 111, 0, 65, 114, 107, 116, 111, 115, 0, 90, 97, 112, 100, 111, 115, 0, 76, 97, 118, 97, 100, 111, 115, 0, 68, 114, 97, 116, 105, 110, 105, 0, 68, 114, 97, 103, 111, 110, 105, 114, 0, 68, 114, 97, 103, 111, 114, 97, 110, 0, 77, 101, 119, 116, 117, 0, 77, 101, 119, 0, 69, 110, 100, 105, 118, 105, 101, 0, 76, 111, 114, 98, 108, 97, 116, 116, 0, 77, 101, 103, 97, 110, 105, 101, 0, 70, 101, 117, 114, 105, 103, 101, 108, 0, 73, 103, 101, 108, 97, 118, 97, 114, 0, 84, 111, 114, 110, 117, 112, 116, 111, 0, 75, 97, 114, 110, 105, 109, 97, 110, 105, 0, 84, 121, 114, 97, 99, 114, 111, 99, 0, 73, 109, 112, 101, 114, 103, 97, 116, 111, 114, 0, 87, 105, 101, 115, 111, 114, 0, 87, 105, 101, 115, 101, 110, 105, 111, 114, 0, 72, 111, 111, 116, 104, 111, 111, 116, 0, 78, 111, 99, 116, 117, 104, 0, 76, 101, 100, 121, 98, 97, 0, 76, 101, 100, 105, 97, 110, 0, 87, 101, 98, 97, 114, 97, 107, 0, 65, 114, 105, 97, 100, 111, 115, 0, 73, 107, 115, 98, 97, 116, 0, 76, 97, 109, 112, 105, 0, 76, 97, 110, 116, 117, 114, 110, 0, 80, 105, 99, 104, 117, 0, 80, 105, 105, 0, 70, 108, 117, 102, 102, 101, 108, 117, 102, 102, 0, 84, 111, 103, 101, 112, 105, 0, 84, 111, 103, 101, 116, 105, 99, 0, 78, 97, 116, 117, 0, 88, 97, 116, 117, 0, 86, 111, 108, 116, 105, 108, 97, 109, 109, 0, 87, 97, 97, 116, 121, 0, 65, 109, 112, 104, 97, 114, 111, 115, 0, 66, 108, 117, 98, 101, 108, 108, 97, 0, 77, 97, 114, 105, 108, 108, 0, 65, 122, 117, 109, 97, 114, 105, 108, 108, 0, 77, 111, 103, 101, 108, 98, 97, 117, 109, 0, 81, 117, 97, 120, 111, 0, 72, 111, 112, 112, 115, 112, 114, 111, 115, 115, 0, 72, 117, 98, 101, 108, 117, 112, 102, 0, 80, 97, 112, 117, 110, 103, 104, 97, 0, 71, 114, 105, 102, 102, 101, 108, 0, 83, 111, 110, 110, 107, 101, 114, 110, 0, 83, 111, 110, 110, 102, 108, 111, 114, 97, 0, 89, 97, 110, 109, 97, 0, 70, 101, 108, 105, 110, 111, 0, 77, 111, 114, 108, 111, 114, 100, 0, 80, 115, 105, 97, 110, 97, 0, 78, 97, 99, 104, 116, 97, 114, 97, 0, 75, 114, 97, 109, 117, 114, 120, 0, 76, 97, 115, 99, 104, 111, 107, 105, 110, 103, 0, 84, 114, 97, 117, 110, 102, 117, 103, 105, 108, 0, 73, 99, 111, 103, 110, 105, 116, 111, 0, 87, 111, 105, 110, 103, 101, 110, 97, 117, 0, 71, 105, 114, 97, 102, 97, 114, 105, 103, 0, 84, 97, 110, 110, 122, 97, 0, 70, 111, 114, 115, 116, 101, 108, 108, 107, 97, 0, 68, 117, 109, 109, 105, 115, 101, 108, 0, 83, 107, 111, 114, 103, 108, 97, 0, 83, 116, 97, 104, 108, 111, 115, 0, 83, 110, 117, 98, 98, 117, 108, 108, 0, 71, 114, 97, 110, 98, 117, 108, 108, 0, 66, 97, 108, 100, 111, 114, 102, 105, 115, 104, 0, 83, 99, 104, 101, 114, 111, 120, 0, 80, 111, 116, 116, 114, 111, 116, 116, 0, 83, 107, 97, 114, 97, 98, 111, 114, 110, 0, 83, 110, 105, 101, 98, 101, 108, 0, 84, 101, 100, 100, 105, 117, 114, 115, 97, 0, 85, 114, 115, 97, 114, 105, 110, 103, 0, 83, 99, 104, 110, 101, 99, 107, 109, 97, 103, 0, 77, 97, 103, 99, 97, 114, 103, 111, 0, 81, 117, 105, 101, 107, 101, 108, 0, 75, 101, 105, 102, 101, 108, 0, 67, 111, 114, 97, 115, 111, 110, 110, 0, 82, 101, 109, 111, 114, 97, 105, 100, 0, 79, 99, 116, 105, 108, 108, 101, 114, 121, 0, 66, 111, 116, 111, 103, 101, 108, 0, 77, 97, 110, 116, 97, 120, 0, 80, 97, 110, 122, 97, 101, 114, 111, 110, 0, 72, 117, 110, 100, 117, 115, 116, 101, 114, 0, 72, 117, 110, 100, 101, 109, 111, 110, 0, 83, 101, 101, 100, 114, 97, 107, 105, 110, 103, 0, 80, 104, 97, 110, 112, 121, 0, 68, 111, 110, 112, 104, 97, 110, 0, 80, 111, 114, 121, 103, 111, 110, 50, 0, 68, 97, 109, 104, 105, 114, 112, 108, 101, 120, 0, 70, 97, 114, 98, 101, 97, 103, 108, 101, 0, 82, 97, 98, 97, 117, 122, 0, 75, 97, 112, 111, 101, 114, 97, 0, 75, 117, 115, 115, 105, 108, 108, 97, 0, 69, 108, 101, 107, 105, 100, 0, 77, 97, 103, 98, 121, 0, 77, 105, 108, 116, 97, 110, 107, 0, 72, 101, 105, 116, 101, 105, 114, 97, 0, 82, 97, 105, 107, 111, 117, 0, 69, 110, 116, 101, 105, 0, 83, 117, 105, 99, 117, 110, 101, 0, 76, 97, 114, 118, 105, 116, 97, 114, 0, 80, 117, 112, 105, 116, 97, 114, 0, 68, 101, 115, 112, 111, 116, 97, 114, 0, 76, 117, 103, 105, 97, 0, 72, 111, 45, 79, 104, 0, 67, 101, 108, 101, 98, 105, 0, 71, 101, 99, 107, 97, 114, 98, 111, 114, 0, 82, 101, 112, 116, 97, 105, 110, 0, 71, 101, 119, 97, 108, 100, 114, 111, 0, 70, 108, 101, 109, 109, 108, 105, 0, 74, 117, 110, 103, 103, 108, 117, 116, 0, 76, 111, 104, 103, 111, 99, 107, 0, 72, 121, 100, 114, 111, 112, 105, 0, 77, 111, 111, 114, 97, 98, 98, 101, 108, 0, 83, 117, 109, 112, 101, 120, 0, 70, 105, 102, 102, 121, 101, 110, 0, 77, 97, 103, 110, 97, 121, 101, 110, 0, 90, 105, 103, 122, 97, 99, 104, 115, 0, 71, 101, 114, 97, 100, 97, 107, 115, 0, 87, 97, 117, 109, 112, 101, 108, 0, 83, 99, 104, 97, 108, 111, 107, 111, 0, 80, 97, 112, 105, 110, 101, 108, 108, 97, 0, 80, 97, 110, 101, 107, 111, 110, 0, 80, 117, 100, 111, 120, 0, 76, 111, 116, 117, 114, 122, 101, 108, 0, 76, 111, 109, 98, 114, 101, 114, 111, 0, 75, 97, 112, 112, 97, 108, 111, 114, 101, 115, 0, 83, 97, 109, 117, 114, 122, 101, 108, 0, 66, 108, 97, 110, 97, 115, 0, 84, 101, 110, 103, 117, 108, 105, 115, 116, 0, 83, 99, 104, 119, 97, 108, 98, 105, 110, 105, 0, 83, 99, 104, 119, 97, 108, 98, 111, 115, 115, 0, 87, 105, 110, 103, 117, 108, 108, 0, 80, 101, 108, 105, 112, 112, 101, 114, 0, 84, 114, 97, 115, 108, 97, 0, 75, 105, 114, 108, 105, 97, 0, 71, 117, 97, 114, 100, 101, 118, 111, 105, 114, 0, 71, 101, 104, 119, 101, 105, 104, 101, 114, 0, 77, 97, 115, 107, 101, 114, 101, 103, 101, 110, 0, 75, 110, 105, 108, 122, 0, 75, 97, 112, 105, 108, 122, 0, 66, 117, 109, 109, 101, 108, 122, 0, 77, 117, 110, 116, 105, 101, 114, 0, 76, 101, 116, 97, 114, 107, 105, 110, 103, 0, 78, 105, 110, 99, 97, 100, 97, 0, 78, 105, 110, 106, 97, 115, 107, 0, 78, 105, 110, 106, 97, 116, 111, 109, 0, 70, 108, 117, 114, 109, 101, 108, 0, 75, 114, 97, 107, 101, 101, 108, 111, 0, 75, 114, 97, 119, 117, 109, 109, 115, 0, 77, 97, 107, 117, 104, 105, 116, 97, 0, 72, 97, 114, 105, 121, 97, 109, 97, 0, 65, 122, 117, 114, 105, 108, 108, 0, 78, 97, 115, 103, 110, 101, 116, 0, 69, 110, 101, 99, 111, 0, 69, 110, 101, 107, 111, 114, 111, 0, 90, 111, 98, 105, 114, 105, 115, 0, 70, 108, 117, 110, 107, 105, 102, 101, 114, 0, 83, 116, 111, 108, 108, 117, 110, 105, 111, 114, 0, 83, 116, 111, 108, 108, 114, 97, 107, 0, 83, 116, 111, 108, 108, 111, 115, 115, 0, 77, 101, 100, 105, 116, 105, 101, 0, 77, 101, 100, 105, 116, 97, 108, 105, 115, 0, 70, 114, 105, 122, 101, 108, 98, 108, 105, 122, 0, 86, 111, 108, 116, 101, 110, 115, 111, 0, 80, 108, 117, 115, 108, 101, 0, 77, 105, 110, 117, 110, 0, 86, 111, 108, 98, 101, 97, 116, 0, 73, 108, 108, 117, 109, 105, 115, 101, 0, 82, 111, 115, 101, 108, 105, 97, 0, 83, 99, 104, 108, 117, 112, 112, 117, 99, 107, 0, 83, 99, 104, 108, 117, 107, 119, 101, 99, 104, 0, 75, 97, 110, 105, 118, 97, 110, 104, 97, 0, 84, 111, 104, 97, 105, 100, 111, 0, 87, 97, 105, 108, 109, 101, 114, 0, 87, 97, 105, 108, 111, 114, 100, 0, 67, 97, 109, 97, 117, 98, 0, 67, 97, 109, 101, 114, 117, 112, 116, 0, 81, 117, 114, 116, 101, 108, 0, 83, 112, 111, 105, 110, 107, 0, 71, 114, 111, 105, 110, 107, 0, 80, 97, 110, 100, 105, 114, 0, 75, 110, 97, 99, 107, 108, 105, 111, 110, 0, 86, 105, 98, 114, 97, 118, 97, 0, 76, 105, 98, 101, 108, 108, 100, 114, 97, 0, 84, 117, 115, 107, 97, 0, 78, 111, 107, 116, 117, 115, 107, 97, 0, 87, 97, 98, 108, 117, 0, 65, 108, 116, 97, 114, 105, 97, 0, 83, 101, 110, 103, 111, 0, 86, 105, 112, 105, 116, 105, 115, 0, 76, 117, 110, 97, 115, 116, 101, 105, 110, 0, 83, 111, 110, 110, 102, 101, 108, 0, 83, 99, 104, 109, 101, 114, 98, 101, 0, 87, 101, 108, 115, 97, 114, 0, 75, 114, 101, 98, 115, 99, 111, 114, 112, 115, 0, 75, 114, 101, 98, 117, 116, 97, 99, 107, 0, 80, 117, 112, 112, 97, 110, 99, 101, 0, 76, 101, 112, 117, 109, 101, 110, 116, 97, 115, 0, 76, 105, 108, 105, 101, 112, 0, 87, 105, 101, 108, 105, 101, 0, 65, 110, 111, 114, 105, 116, 104, 0, 65, 114, 109, 97, 108, 100, 111, 0, 66, 97, 114, 115, 99, 104, 119, 97, 0, 77, 105, 108, 111, 116, 105, 99, 0, 70, 111, 114, 109, 101, 111, 0, 75, 101, 99, 108, 101, 111, 110, 0, 83, 104, 117, 112, 112, 101, 116, 0, 66, 97, 110, 101, 116, 116, 101, 0, 90, 119, 105, 114, 114, 108, 105, 99, 104, 116, 0, 90, 119, 105, 114, 114, 107, 108, 111, 112, 0, 84, 114, 111, 112, 105, 117, 115, 0, 80, 97, 108, 105, 109, 112, 97, 108, 105, 109, 0, 65, 98, 115, 111, 108, 0, 73, 115, 115, 111, 0, 83, 99, 104, 110, 101, 112, 112, 107, 101, 0, 70, 105, 114, 110, 111, 110, 116, 111, 114, 0, 83, 101, 101, 109, 111, 112, 115, 0, 83, 101, 101, 106, 111, 110, 103, 0, 87, 97, 108, 114, 97, 105, 115, 97, 0, 80, 101, 114, 108, 117, 0, 65, 97, 108, 97, 98, 121, 115, 115, 0, 83, 97, 103, 97, 110, 97, 98, 121, 115, 115, 0, 82, 101, 108, 105, 99, 97, 110, 116, 104, 0, 76, 105, 101, 98, 105, 115, 107, 117, 115, 0, 75, 105, 110, 100, 119, 117, 114, 109, 0, 68, 114, 97, 115, 99, 104, 101, 108, 0, 66, 114, 117, 116, 97, 108, 97, 110, 100, 97, 0, 84, 97, 110, 104, 101, 108, 0, 77, 101, 116, 97, 110, 103, 0, 77, 101, 116, 97, 103, 114, 111, 115, 115, 0, 82, 101, 103, 105, 114, 111, 99, 107, 0, 82, 101, 103, 105, 99, 101, 0, 82, 101, 103, 105, 115, 116, 101, 101, 108, 0, 76, 97, 116, 105, 97, 115, 0, 76, 97, 116, 105, 111, 115, 0, 75, 121, 111, 103, 114, 101, 0, 71, 114, 111, 117, 100, 111, 110, 0, 82, 97, 121, 113, 117, 97, 122, 97, 0, 74, 105, 114, 97, 99, 104, 105, 0, 68, 101, 111, 120, 121, 115, 0, 67, 104, 101, 108, 97, 115, 116, 0, 67, 104, 101, 108, 99, 97, 114, 97, 105, 110, 0, 67, 104, 101, 108, 116, 101, 114, 114, 97, 114, 0, 80, 97, 110, 102, 108, 97, 109, 0, 80, 97, 110, 112, 121, 114, 111, 0, 80, 97, 110, 102, 101, 114, 110, 111, 0, 80, 108, 105, 110, 102, 97, 0, 80, 108, 105, 112, 114, 105, 110, 0, 73, 109, 112, 111, 108, 101, 111, 110, 0, 83, 116, 97, 114, 97, 108, 105, 108, 105, 0, 83, 116, 97, 114, 97, 118, 105, 97, 0, 83, 116, 97, 114, 97, 112, 116, 111, 114, 0, 66, 105, 100, 105, 122, 97, 0, 66, 105, 100, 105, 102, 97, 115, 0, 90, 105, 114, 112, 117, 114, 122, 101, 0, 90, 105, 114, 112, 101, 105, 115, 101, 0, 83, 104, 101, 105, 110, 117, 120, 0, 76, 117, 120, 105, 111, 0, 76, 117, 120, 116, 114, 97, 0, 75, 110, 111, 115, 112, 105, 0, 82, 111, 115, 101, 114, 97, 100, 101, 0, 75, 111, 107, 110, 111, 100, 111, 110, 0, 82, 97, 109, 101, 105, 100, 111, 110, 0, 83, 99, 104, 105, 108, 116, 101, 114, 117, 115, 0, 66, 111, 108, 108, 116, 101, 114, 117, 115, 0, 66, 117, 114, 109, 121, 0, 66, 117, 114, 109, 97, 100, 97, 109, 101, 0, 77, 111, 116, 101, 114, 112, 101, 108, 0, 87, 97, 100, 114, 105, 98, 105, 101, 0, 72, 111, 110, 119, 101, 105, 115, 101, 108, 0, 80, 97, 99, 104, 105, 114, 105, 115, 117, 0, 66, 97, 109, 101, 108, 105, 110, 0, 66, 111, 106, 101, 108, 105, 110, 0, 75, 105, 107, 117, 103, 105, 0, 75, 105, 110, 111, 115, 111, 0, 83, 99, 104, 97, 108, 101, 108, 108, 111, 115, 0, 71, 97, 115, 116, 114, 111, 100, 111, 110, 0, 65, 109, 98, 105, 100, 105, 102, 102, 101, 108, 0, 68, 114, 105, 102, 116, 108, 111, 110, 0, 68, 114, 105, 102, 122, 101, 112, 101, 108, 105, 0, 72, 97, 115, 112, 105, 114, 111, 114, 0, 83, 99, 104, 108, 97, 112, 111, 114, 0, 84, 114, 97, 117, 110, 109, 97, 103, 105, 108, 0, 75, 114, 97, 109, 115, 104, 101, 102, 0, 67, 104, 97, 114, 109, 105, 97, 110, 0, 83, 104, 110, 117, 114, 103, 97, 114, 115, 116, 0, 75, 108, 105, 110, 103, 112, 108, 105, 109, 0, 83, 107, 117, 110, 107, 97, 112, 117, 104, 0, 83, 107, 117, 110, 116, 97, 110, 107, 0, 66, 114, 111, 110, 122, 101, 108, 0, 66, 114, 111, 110, 122, 111, 110, 103, 0, 77, 111, 98, 97, 105, 0, 80, 97, 110, 116, 105, 109, 105, 109, 105, 0, 87, 111, 110, 110, 101, 105, 114, 97, 0, 80, 108, 97, 117, 100, 97, 103, 101, 105, 0, 75, 114, 121, 112, 112, 117, 107, 0, 75, 97, 117, 109, 97, 108, 97, 116, 0, 75, 110, 97, 114, 107, 115, 101, 108, 0, 75, 110, 97, 107, 114, 97, 99, 107, 0, 77, 97, 109, 112, 102, 97, 120, 111, 0, 82, 105, 111, 108, 117, 0, 76, 117, 99, 97, 114, 105, 111, 0, 72, 105, 112, 112, 111, 112, 111, 116, 97, 115, 0, 72, 105, 112, 112, 111, 116, 101, 114, 117, 115, 0, 80, 105, 111, 110, 115, 107, 111, 114, 97, 0, 80, 105, 111, 110, 100, 114, 97, 103, 105, 0, 71, 108, 105, 98, 117, 110, 107, 101, 108, 0, 84, 111, 120, 105, 113, 117, 97, 107, 0, 86, 101, 110, 117, 102, 108, 105, 98, 105, 115, 0, 70, 105, 110, 110, 101, 111, 110, 0, 76, 117, 109, 105, 110, 101, 111, 110, 0, 77, 97, 110, 116, 105, 114, 112, 115, 0, 83, 104, 110, 101, 98, 101, 100, 101, 99, 107, 0, 82, 101, 120, 98, 108, 105, 115, 97, 114, 0, 83, 110, 105, 98, 117, 110, 110, 97, 0, 77, 97, 103, 110, 101, 122, 111, 110, 101, 0, 83, 99, 104, 108, 117, 114, 112, 108, 101, 107, 0, 82, 105, 104, 111, 114, 110, 105, 111, 114, 0, 84, 97, 110, 103, 111, 108, 111, 115, 115, 0, 69, 108, 101, 118, 111, 108, 116, 101, 107, 0, 77, 97, 103, 98, 114, 97, 110, 116, 0, 84, 111, 103, 101, 107, 105, 115, 115, 0, 89, 97, 110, 109, 101, 103, 97, 0, 70, 111, 108, 105, 112, 117, 114, 98, 97, 0, 71, 108, 97, 122, 105, 111, 108, 97, 0, 83, 107, 111, 114, 103, 114, 111, 0, 77, 97, 109, 117, 116, 101, 108, 0, 80, 111, 114, 121, 103, 111, 110, 45, 90, 0, 71, 97, 108, 97, 103, 108, 97, 100, 105, 0, 86, 111, 108, 117, 109, 105, 110, 97, 115, 0, 90, 119, 105, 114, 114, 102, 105, 110, 115, 116, 0, 70, 114, 111, 115, 100, 101, 100, 106, 101, 0, 82, 111, 116, 111, 109, 0, 83, 101, 108, 102, 101, 0, 86, 101, 115, 112, 114, 105, 116, 0, 84, 111, 98, 117, 116, 122, 0, 68, 105, 97, 108, 103, 97, 0, 80, 97, 108, 107, 105, 97, 0, 72, 101, 97, 116, 114, 97, 110, 0, 82, 101, 103, 105, 103, 105, 103, 97, 115, 0, 71, 105, 114, 97, 116, 105, 110, 97, 0, 67, 114, 101, 115, 115, 101, 108, 105, 97, 0, 80, 104, 105, 111, 110, 101, 0, 77, 97, 110, 97, 112, 104, 121, 0, 68, 97, 114, 107, 114, 97, 105, 0, 83, 104, 97, 121, 109, 105, 110, 0, 65, 114, 99, 101, 117, 115, 0, 86, 105, 99, 116, 105, 110, 105, 0, 83, 101, 114, 112, 105, 102, 101, 117, 0, 69, 102, 111, 115, 101, 114, 112, 0, 83, 101, 114, 112, 105, 114, 111, 121, 97, 108, 0, 70, 108, 111, 105, 110, 107, 0, 70, 101, 114, 107, 111, 107, 101, 108, 0, 70, 108, 97, 109, 98, 105, 114, 101, 120, 0, 79, 116, 116, 97, 114, 111, 0, 90, 119, 111, 116, 116, 114, 111, 110, 105, 110, 0, 65, 100, 109, 117, 114, 97, 105, 0, 78, 97, 103, 101, 108, 111, 116, 122, 0, 75, 117, 107, 109, 97, 114, 100, 97, 0, 89, 111, 114, 107, 108, 101, 102, 102, 0, 84, 101, 114, 114, 105, 98, 97, 114, 107, 0, 66, 105, 115, 115, 98, 97, 114, 107, 0, 70, 101, 108, 105, 108, 111, 117, 0, 75, 108, 101, 111, 112, 97, 114, 100, 97, 0, 86, 101, 103, 105, 109, 97, 107, 0, 86, 101, 103, 105, 99, 104, 105, 116, 97, 0, 71, 114, 105, 108, 108, 109, 97, 107, 0, 71, 114, 105, 108, 108, 99, 104, 105, 116, 97, 0, 83, 111, 100, 97, 109, 97, 107, 0, 83, 111, 100, 97, 99, 104, 105, 116, 97, 0, 83, 111, 109, 110, 105, 97, 109, 0, 83, 111, 109, 110, 105, 118, 111, 114, 97, 0, 68, 117, 115, 115, 101, 108, 103, 117, 114, 114, 0, 78, 97, 118, 105, 116, 97, 117, 98, 0, 70, 97, 115, 97, 115, 110, 111, 98, 0, 69, 108, 101, 122, 101, 98, 97, 0, 90, 101, 98, 114, 105, 116, 122, 0, 75, 105, 101, 115, 108, 105, 110, 103, 0, 83, 101, 100, 105, 109, 97, 110, 116, 117, 114, 0, 66, 114, 111, 99, 107, 111, 108, 111, 115, 115, 0, 70, 108, 101, 107, 110, 111, 105, 108, 0, 70, 108, 101, 116, 105, 97, 109, 111, 0, 82, 111, 116, 111, 109, 117, 114, 102, 0, 83, 116, 97, 108, 111, 98, 111, 114, 0, 79, 104, 114, 100, 111, 99, 104, 0, 80, 114, 97, 107, 116, 105, 98, 97, 108, 107, 0, 83, 116, 114, 101, 112, 111, 108, 105, 0, 77, 101, 105, 115, 116, 97, 103, 114, 105, 102, 0, 83, 99, 104, 97, 108, 108, 113, 117, 97, 112, 0, 77, 101, 98, 114, 97, 110, 97, 0, 66, 114, 97, 110, 97, 119, 97, 114, 122, 0, 74, 105, 117, 116, 101, 115, 116, 111, 0, 75, 97, 114, 97, 100, 111, 110, 105, 115, 0, 83, 116, 114, 97, 119, 105, 99, 107, 108, 0, 70, 111, 108, 105, 107, 111, 110, 0, 77, 97, 116, 114, 105, 102, 111, 108, 0, 84, 111, 120, 105, 112, 101, 100, 0, 82, 111, 108, 108, 117, 109, 0, 67, 101, 114, 97, 112, 101, 110, 100, 114, 97, 0, 87, 97, 117, 109, 98, 111, 108, 108, 0, 69, 108, 102, 117, 110, 0, 76, 105, 108, 109, 105, 110, 105, 112, 0, 68, 114, 101, 115, 115, 101, 108, 108, 97, 0, 66, 97, 114, 115, 99, 104, 117, 102, 116, 0, 71, 97, 110, 111, 118, 105, 108, 0, 82, 111, 107, 107, 97, 105, 109, 97, 110, 0, 82, 97, 98, 105, 103, 97, 116, 111, 114, 0, 70, 108, 97, 109, 112, 105, 111, 110, 0, 70, 108, 97, 109, 112, 105, 118, 105, 97, 110, 0, 77, 97, 114, 97, 99, 97, 109, 98, 97, 0, 76, 105, 116, 104, 111, 109, 105, 116, 104, 0, 67, 97, 115, 116, 101, 108, 108, 105, 116, 104, 0, 90, 117, 114, 114, 111, 107, 101, 120, 0, 73, 114, 111, 107, 101, 120, 0, 83, 121, 109, 118, 111, 108, 97, 114, 97, 0, 77, 97, 107, 97, 98, 97, 106, 97, 0, 69, 99, 104, 110, 97, 116, 111, 108, 108, 0, 71, 97, 108, 97, 112, 97, 102, 108, 111, 115, 0, 75, 97, 114, 105, 112, 112, 97, 115, 0, 70, 108, 97, 112, 116, 101, 114, 121, 120, 0, 65, 101, 114, 111, 112, 116, 101, 114, 121, 120, 0, 85, 110, 114, 97, 116, 195, 188, 116, 111, 120, 0, 68, 101, 112, 111, 110, 105, 116, 111, 120, 0, 90, 111, 114, 117, 97, 0, 90, 111, 114, 111, 97, 114, 107, 0, 80, 105, 99, 111, 99, 104, 105, 108, 108, 97, 0, 67, 104, 105, 108, 108, 97, 98, 101, 108, 108, 0, 77, 111, 108, 108, 105, 109, 111, 114, 98, 97, 0, 72, 121, 112, 110, 111, 109, 111, 114, 98, 97, 0, 77, 111, 114, 98, 105, 116, 101, 115, 115, 101, 0, 77, 111, 110, 111, 122, 121, 116, 111, 0, 77, 105, 116, 111, 100, 111, 115, 0, 90, 121, 116, 111, 109, 101, 103, 97, 0, 80, 105, 99, 99, 111, 108, 101, 110, 116, 101, 0, 83, 119, 97, 114, 111, 110, 101, 115, 115, 0, 71, 101, 108, 97, 116, 105, 110, 105, 0, 71, 101, 108, 97, 116, 114, 111, 112, 112, 111, 0, 71, 101, 108, 97, 116, 119, 105, 110, 111, 0, 83, 101, 115, 111, 107, 105, 116, 122, 0, 75, 114, 111, 110, 106, 117, 119, 105, 108, 100, 0, 69, 109, 111, 108, 103, 97, 0, 76, 97, 117, 107, 97, 112, 115, 0, 67, 97, 118, 97, 108, 97, 110, 122, 97, 115, 0, 84, 97, 114, 110, 112, 105, 103, 110, 111, 110, 0, 72, 117, 116, 115, 97, 115, 115, 97, 0, 81, 117, 97, 98, 98, 101, 108, 0, 65, 112, 111, 113, 117, 97, 108, 108, 121, 112, 0, 77, 97, 109, 111, 108, 105, 100, 97, 0, 87, 97, 116, 116, 122, 97, 112, 102, 0, 86, 111, 108, 116, 117, 108, 97, 0, 75, 97, 115, 116, 97, 100, 117, 114, 0, 84, 101, 110, 116, 97, 110, 116, 101, 108, 0, 75, 108, 105, 107, 107, 0, 75, 108, 105, 107, 108, 97, 107, 0, 75, 108, 105, 107, 100, 105, 107, 108, 97, 107, 0, 90, 97, 112, 112, 108, 97, 114, 100, 105, 110, 0, 90, 97, 112, 112, 108, 97, 108, 101, 107, 0, 90, 97, 112, 112, 108, 97, 114, 97, 110, 103, 0, 80, 121, 103, 114, 97, 117, 108, 111, 110, 0, 77, 101, 103, 97, 108, 111, 110, 0, 76, 105, 99, 104, 116, 101, 108, 0, 76, 97, 116, 101, 114, 110, 101, 99, 116, 111, 0, 83, 107, 101, 108, 97, 98, 114, 97, 0, 77, 105, 108, 122, 97, 0, 83, 104, 97, 114, 102, 97, 120, 0, 77, 97, 120, 97, 120, 0, 80, 101, 116, 122, 110, 105, 101, 102, 0, 83, 105, 98, 101, 114, 105, 111, 0, 70, 114, 105, 103, 111, 109, 101, 116, 114, 105, 0, 83, 99, 104, 110, 117, 116, 104, 101, 108, 109, 0, 72, 121, 100, 114, 97, 103, 105, 108, 0, 70, 108, 117, 110, 115, 99, 104, 108, 105, 107, 0, 76, 105, 110, 45, 70, 117, 0, 87, 105, 101, 45, 83, 104, 117, 0, 83, 104, 97, 114, 100, 114, 97, 103, 111, 0, 71, 111, 108, 98, 105, 116, 0, 71, 111, 108, 103, 97, 110, 116, 101, 115, 0, 71, 108, 97, 100, 105, 97, 110, 116, 114, 105, 0, 67, 97, 101, 115, 117, 114, 105, 111, 0, 66, 105, 115, 111, 102, 97, 110, 107, 0, 71, 101, 114, 111, 110, 105, 109, 97, 116, 122, 0, 87, 97, 115, 104, 97, 107, 119, 105, 108, 0, 83, 107, 97, 108, 108, 121, 107, 0, 71, 114, 121, 112, 104, 101, 108, 100, 105, 115, 0, 70, 117, 114, 110, 105, 102, 114, 97, 195, 159, 0, 70, 101, 114, 109, 105, 99, 117, 108, 97, 0, 75, 97, 112, 117, 110, 111, 0, 68, 117, 111, 100, 105, 110, 111, 0, 84, 114, 105, 107, 101, 112, 104, 97, 108, 111, 0, 73, 103, 110, 105, 118, 111, 114, 0, 82, 97, 109, 111, 116, 104, 0, 75, 111, 98, 97, 108, 105, 117, 109, 0, 84, 101, 114, 114, 97, 107, 105, 117, 109, 0, 86, 105, 114, 105, 100, 105, 117, 109, 0, 66, 111, 114, 101, 111, 115, 0, 86, 111, 108, 116, 111, 108, 111, 115, 0, 82, 101, 115, 104, 105, 114, 97, 109, 0, 90, 101, 107, 114, 111, 109, 0, 68, 101, 109, 101, 116, 101, 114, 111, 115, 0, 75, 121, 117, 114, 101, 109, 0, 75, 101, 108, 100, 101, 111, 0, 77, 101, 108, 111, 101, 116, 116, 97, 0, 71, 101, 110, 101, 115, 101, 99, 116, 0, 73, 103, 97, 109, 97, 114, 111, 0, 73, 103, 97, 115, 116, 97, 114, 110, 105, 115, 104, 0, 66, 114, 105, 103, 97, 114, 111, 110, 0, 70, 121, 110, 120, 0, 82, 117, 116, 101, 110, 97, 0, 70, 101, 110, 110, 101, 120, 105, 115, 0, 70, 114, 111, 120, 121, 0, 65, 109, 112, 104, 105, 122, 101, 108, 0, 81, 117, 97, 106, 117, 116, 115, 117, 0, 83, 99, 111, 112, 112, 101, 108, 0, 71, 114, 101, 98, 98, 105, 116, 0, 68, 97, 114, 116, 105, 114, 105, 0, 68, 97, 114, 116, 105, 103, 110, 105, 115, 0, 70, 105, 97, 114, 111, 0, 80, 117, 114, 109, 101, 108, 0, 80, 117, 112, 111, 110, 99, 104, 111, 0, 86, 105, 118, 105, 108, 108, 111, 110, 0, 76, 101, 117, 102, 101, 111, 0, 80, 121, 114, 111, 108, 101, 111, 0, 70, 108, 97, 98, 195, 169, 98, 195, 169, 0, 70, 108, 111, 101, 116, 116, 101, 0, 70, 108, 111, 114, 103, 101, 115, 0, 77, 195, 164, 104, 105, 107, 101, 108, 0, 67, 104, 101, 118, 114, 117, 109, 109, 0, 80, 97, 109, 45, 80, 97, 109, 0, 80, 97, 110, 100, 97, 103, 114, 111, 0, 67, 111, 105, 102, 102, 119, 97, 102, 102, 0, 80, 115, 105, 97, 117, 0, 80, 115, 105, 97, 117, 103, 111, 110, 0, 71, 114, 97, 109, 111, 107, 108, 101, 115, 0, 68, 117, 111, 107, 108, 101, 115, 0, 68, 117, 114, 101, 110, 103, 97, 114, 100, 0, 80, 97, 114, 102, 105, 0, 80, 97, 114, 102, 105, 110, 101, 115, 115, 101, 0, 70, 108, 97, 117, 115, 99, 104, 108, 105, 110, 103, 0, 83, 97, 98, 98, 97, 105, 111, 110, 101, 0, 73, 115, 99, 97, 108, 97, 114, 0, 67, 97, 108, 97, 109, 97, 110, 101, 114, 111, 0, 66, 105, 116, 104, 111, 114, 97, 0, 84, 104, 97, 110, 97, 116, 104, 111, 114, 97, 0, 65, 108, 103, 105, 116, 116, 0, 84, 97, 110, 100, 114, 97, 107, 0, 83, 99, 97, 109, 112, 105, 115, 116, 111, 0, 87, 117, 109, 109, 101, 114, 0, 69, 103, 117, 97, 110, 97, 0, 69, 108, 101, 122, 97, 114, 100, 0, 66, 97, 108, 103, 111, 114, 97, 115, 0, 77, 111, 110, 97, 114, 103, 111, 114, 97, 115, 0, 65, 109, 97, 114, 105, 110, 111, 0, 65, 109, 97, 103, 97, 114, 103, 97, 0, 70, 101, 101, 108, 105, 110, 97, 114, 97, 0, 82, 101, 115, 108, 97, 100, 101, 114, 111, 0, 68, 101, 100, 101, 110, 110, 101, 0, 82, 111, 99, 97, 114, 97, 0, 86, 105, 115, 99, 111, 114, 97, 0, 86, 105, 115, 99, 97, 114, 103, 111, 116, 0, 86, 105, 115, 99, 111, 103, 111, 110, 0, 67, 108, 97, 118, 105, 111, 110, 0, 80, 97, 114, 97, 103, 111, 110, 105, 0, 84, 114, 111, 109, 98, 111, 114, 107, 0, 73, 114, 114, 98, 105, 115, 0, 80, 117, 109, 112, 100, 106, 105, 110, 110, 0, 65, 114, 107, 116, 105, 112, 0, 65, 114, 107, 116, 105, 108, 97, 115, 0, 101, 70, 45, 101, 77, 0, 85, 72, 97, 70, 110, 105, 114, 0, 88, 101, 114, 110, 101, 97, 115, 0, 89, 118, 101, 108, 116, 97, 108, 0, 90, 121, 103, 97, 114, 100, 101, 0, 68, 105, 97, 110, 99, 105, 101, 0, 72, 111, 111, 112, 97, 0, 86, 111, 108, 99, 97, 110, 105, 111, 110, 0, 66, 97, 117, 122, 0, 65, 114, 98, 111, 114, 101, 116, 111, 115, 115, 0, 83, 105, 108, 118, 97, 114, 114, 111, 0, 70, 108, 97, 109, 105, 97, 117, 0, 77, 105, 101, 122, 117, 110, 100, 101, 114, 0, 70, 117, 101, 103, 114, 111, 0, 82, 111, 98, 98, 97, 108, 108, 0, 77, 97, 114, 105, 107, 101, 99, 107, 0, 80, 114, 105, 109, 97, 114, 101, 110, 101, 0, 80, 101, 112, 112, 101, 99, 107, 0, 84, 114, 111, 109, 112, 101, 99, 107, 0, 84, 117, 107, 97, 110, 111, 110, 0, 77, 97, 110, 103, 117, 110, 105, 111, 114, 0, 77, 97, 110, 103, 117, 115, 112, 101, 107, 116, 111, 114, 0, 77, 97, 98, 117, 108, 97, 0, 65, 107, 107, 117, 112, 0, 68, 111, 110, 97, 114, 105, 111, 110, 0, 75, 114, 97, 98, 98, 111, 120, 0, 75, 114, 97, 119, 101, 108, 108, 0, 67, 104, 111, 114, 101, 111, 103, 101, 108, 0, 87, 111, 109, 109, 101, 108, 0, 66, 97, 110, 100, 101, 108, 98, 121, 0, 87, 117, 102, 102, 101, 108, 115, 0, 87, 111, 108, 119, 101, 114, 111, 99, 107, 0, 76, 117, 115, 97, 114, 100, 105, 110, 0, 71, 97, 114, 115, 116, 101, 108, 108, 97, 0, 65, 103, 103, 114, 111, 115, 116, 101, 108, 108, 97, 0, 80, 97, 109, 112, 117, 108, 105, 0, 80, 97, 109, 112, 114, 111, 115, 115, 0, 65, 114, 97, 113, 117, 97, 0, 65, 114, 97, 110, 101, 115, 116, 114, 111, 0, 73, 109, 97, 110, 116, 105, 115, 0, 77, 97, 110, 116, 105, 100, 101, 97, 0, 66, 117, 98, 117, 110, 103, 117, 115, 0, 76, 97, 109, 101, 108, 108, 117, 120, 0, 77, 111, 108, 117, 110, 107, 0, 65, 109, 102, 105, 114, 97, 0, 86, 101, 108, 117, 114, 115, 105, 0, 75, 111, 115, 116, 117, 114, 115, 111, 0, 70, 114, 117, 98, 98, 101, 114, 108, 0, 70, 114, 117, 98, 97, 105, 108, 97, 0, 70, 114, 117, 121, 97, 108, 0, 67, 117, 114, 101, 108, 101, 105, 0, 75, 111, 109, 109, 97, 110, 100, 117, 116, 97, 110, 0, 81, 117, 97, 114, 116, 101, 114, 109, 97, 107, 0, 82, 101, 105, 195, 159, 108, 97, 117, 115, 0, 84, 101, 99, 116, 97, 115, 115, 0, 83, 97, 110, 107, 97, 98, 117, 104, 0, 67, 111, 108, 111, 115, 115, 97, 110, 100, 0, 71, 117, 102, 97, 0, 84, 121, 112, 58, 78, 117, 108, 108, 0, 65, 109, 105, 103, 101, 110, 116, 111, 0, 77, 101, 116, 101, 110, 111, 0, 75, 111, 97, 108, 101, 108, 117, 0, 84, 111, 114, 116, 117, 110, 97, 116, 111, 114, 0, 84, 111, 103, 101, 100, 101, 109, 97, 114, 117, 0, 77, 105, 109, 105, 103, 109, 97, 0, 75, 110, 105, 114, 102, 105, 115, 104, 0, 83, 101, 110, 45, 76, 111, 110, 103, 0, 77, 111, 114, 117, 100, 97, 0, 77, 105, 110, 105, 114, 97, 115, 0, 77, 101, 100, 105, 114, 97, 115, 0, 71, 114, 97, 110, 100, 105, 114, 97, 115, 0, 75, 97, 112, 117, 45, 82, 105, 107, 105, 0, 75, 97, 112, 117, 45, 70, 97, 108, 97, 0, 75, 97, 112, 117, 45, 84, 111, 114, 111, 0, 75, 97, 112, 117, 45, 75, 105, 109, 101, 0, 67, 111, 115, 109, 111, 103, 0, 67, 111, 115, 109, 111, 118, 117, 109, 0, 83, 111, 108, 103, 97, 108, 101, 111, 0, 76, 117, 110, 97, 108, 97, 0, 65, 110, 101, 103, 111, 0, 77, 97, 115, 115, 107, 105, 116, 111, 0, 83, 99, 104, 97, 98, 101, 108, 108, 101, 0, 86, 111, 108, 116, 114, 105, 97, 110, 116, 0, 75, 97, 103, 117, 114, 111, 110, 0, 75, 97, 116, 97, 103, 97, 109, 105, 0, 83, 99, 104, 108, 105, 110, 103, 107, 105, 110, 103, 0, 78, 101, 99, 114, 111, 122, 109, 97, 0, 77, 97, 103, 101, 97, 114, 110, 97, 0, 77, 97, 114, 115, 104, 97, 100, 111, 119, 0, 86, 101, 110, 105, 99, 114, 111, 0, 65, 103, 111, 121, 111, 110, 0, 77, 117, 114, 97, 109, 117, 114, 97, 0, 75, 111, 112, 112, 108, 111, 115, 105, 111, 0, 90, 101, 114, 97, 111, 114, 97, 0 };
-
-constexpr std::array<u8, 515> characteristic_en = { 78, 111, 110, 101, 0, 76, 111, 118, 101, 115, 32, 116, 111, 32, 101, 97, 116, 0, 79, 102, 116, 101, 110, 32, 100, 111, 122, 101, 115, 32, 111, 102, 102, 0, 79, 102, 116, 101, 110, 32, 115, 99, 97, 116, 116, 101, 114, 115, 32, 116, 104, 105, 110, 103, 115, 0, 83, 99, 97, 116, 116, 101, 114, 115, 32, 116, 104, 105, 110, 103, 115, 32, 111, 102, 116, 101, 110, 0, 76, 105, 107, 101, 115, 32, 116, 111, 32, 114, 101, 108, 97, 120, 0, 80, 114, 111, 117, 100, 32, 111, 102, 32, 105, 116, 115, 32, 112, 111, 119, 101, 114, 0, 76, 105, 107, 101, 115, 32, 116, 111, 32, 116, 104, 114, 97, 115, 104, 32, 97, 98, 111, 117, 116, 0, 65, 32, 108, 105, 116, 116, 108, 101, 32, 113, 117, 105, 99, 107, 32, 116, 101, 109, 112, 101, 114, 101, 100, 0, 76, 105, 107, 101, 115, 32, 116, 111, 32, 102, 105, 103, 104, 116, 0, 81, 117, 105, 99, 107, 32, 116, 101, 109, 112, 101, 114, 101, 100, 0, 83, 116, 117, 114, 100, 121, 32, 98, 111, 100, 121, 0, 67, 97, 112, 97, 98, 108, 101, 32, 111, 102, 32, 116, 97, 107, 105, 110, 103, 32, 104, 105, 116, 115, 0, 72, 105, 103, 104, 108, 121, 32, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 0, 71, 111, 111, 100, 32, 101, 110, 100, 117, 114, 97, 110, 99, 101, 0, 71, 111, 111, 100, 32, 112, 101, 114, 115, 101, 118, 101, 114, 101, 110, 99, 101, 0, 76, 105, 107, 101, 115, 32, 116, 111, 32, 114, 117, 110, 0, 65, 108, 101, 114, 116, 32, 116, 111, 32, 115, 111, 117, 110, 100, 115, 0, 73, 109, 112, 101, 116, 117, 111, 117, 115, 32, 97, 110, 100, 32, 115, 105, 108, 108, 121, 0, 83, 111, 109, 101, 119, 104, 97, 116, 32, 111, 102, 32, 97, 32, 99, 108, 111, 119, 110, 0, 81, 117, 105, 99, 107, 32, 116, 111, 32, 102, 108, 101, 101, 0, 72, 105, 103, 104, 108, 121, 32, 99, 117, 114, 105, 111, 117, 115, 0, 77, 105, 115, 99, 104, 105, 101, 118, 111, 117, 115, 0, 84, 104, 111, 114, 111, 117, 103, 104, 108, 121, 32, 99, 117, 110, 110, 105, 110, 103, 0, 79, 102, 116, 101, 110, 32, 108, 111, 115, 116, 32, 105, 110, 32, 116, 104, 111, 117, 103, 104, 116, 0, 86, 101, 114, 121, 32, 102, 105, 110, 105, 99, 107, 121, 0, 83, 116, 114, 111, 110, 103, 32, 119, 105, 108, 108, 101, 100, 0, 83, 111, 109, 101, 119, 104, 97, 116, 32, 118, 97, 105, 110, 0, 83, 116, 114, 111, 110, 103, 108, 121, 32, 100, 101, 102, 105, 97, 110, 116, 0, 72, 97, 116, 101, 115, 32, 116, 111, 32, 108, 111, 115, 101, 0, 83, 111, 109, 101, 119, 104, 97, 116, 32, 115, 116, 117, 98, 98, 111, 114, 110, 0 };
-
-constexpr std::array<u8, 2185> dppt_en = { 48, 44, 67, 97, 110, 97, 108, 97, 118, 101, 32, 67, 105, 116, 121, 0, 49, 44, 69, 116, 101, 114, 110, 97, 32, 67, 105, 116, 121, 0, 50, 44, 80, 97, 115, 116, 111, 114, 105, 97, 32, 67, 105, 116, 121, 0, 51, 44, 83, 117, 110, 121, 115, 104, 111, 114, 101, 32, 67, 105, 116, 121, 0, 52, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 76, 101, 97, 103, 117, 101, 0, 53, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 77, 105, 110, 101, 32, 49, 70, 0, 54, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 77, 105, 110, 101, 32, 66, 49, 70, 0, 55, 44, 86, 97, 108, 108, 101, 121, 32, 87, 105, 110, 100, 119, 111, 114, 107, 115, 0, 56, 44, 69, 116, 101, 114, 110, 97, 32, 70, 111, 114, 101, 115, 116, 0, 57, 44, 70, 117, 101, 103, 111, 32, 73, 114, 111, 110, 119, 111, 114, 107, 115, 0, 49, 48, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 40, 82, 111, 117, 116, 101, 32, 50, 48, 55, 47, 50, 48, 56, 32, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 49, 49, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 50, 70, 0, 49, 50, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 51, 70, 0, 49, 51, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 83, 110, 111, 119, 0, 49, 52, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 52, 70, 0, 49, 53, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 53, 70, 0, 49, 54, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 54, 70, 0, 49, 55, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 55, 70, 0, 49, 56, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 84, 111, 112, 32, 67, 97, 118, 101, 0, 49, 57, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 40, 82, 111, 117, 116, 101, 32, 50, 49, 54, 32, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 50, 48, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 40, 82, 111, 117, 116, 101, 32, 50, 49, 49, 32, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 50, 49, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 66, 49, 70, 0, 50, 50, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 49, 0, 50, 51, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 50, 0, 50, 52, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 51, 0, 50, 53, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 52, 0, 50, 54, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 53, 0, 50, 55, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 54, 0, 50, 56, 44, 83, 111, 108, 97, 99, 101, 111, 110, 32, 82, 117, 105, 110, 115, 0, 50, 57, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 51, 48, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 50, 70, 0, 51, 49, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 49, 70, 0, 51, 50, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 97, 99, 107, 32, 82, 111, 111, 109, 32, 49, 0, 51, 51, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 97, 99, 107, 32, 82, 111, 111, 109, 32, 50, 0, 51, 52, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 97, 99, 107, 32, 82, 111, 111, 109, 32, 51, 0, 51, 53, 44, 82, 97, 118, 97, 103, 101, 100, 32, 80, 97, 116, 104, 0, 51, 54, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 71, 97, 116, 101, 32, 49, 70, 0, 51, 55, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 71, 97, 116, 101, 32, 66, 49, 70, 0, 51, 56, 44, 83, 116, 97, 114, 107, 32, 77, 111, 117, 110, 116, 97, 105, 110, 0, 51, 57, 44, 83, 116, 97, 114, 107, 32, 77, 111, 117, 110, 116, 97, 105, 110, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 52, 48, 44, 83, 116, 97, 114, 107, 32, 77, 111, 117, 110, 116, 97, 105, 110, 32, 73, 110, 116, 101, 114, 105, 111, 114, 0, 52, 49, 44, 83, 101, 110, 100, 111, 102, 102, 32, 83, 112, 114, 105, 110, 103, 0, 52, 50, 44, 84, 117, 114, 110, 98, 97, 99, 107, 32, 67, 97, 118, 101, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 52, 51, 44, 84, 117, 114, 110, 98, 97, 99, 107, 32, 67, 97, 118, 101, 32, 49, 115, 116, 32, 80, 105, 108, 108, 97, 114, 0, 52, 52, 44, 84, 117, 114, 110, 98, 97, 99, 107, 32, 67, 97, 118, 101, 32, 50, 110, 100, 32, 80, 105, 108, 108, 97, 114, 0, 52, 53, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 49, 70, 0, 52, 54, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 49, 70, 0, 52, 55, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 50, 70, 0, 52, 56, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 51, 70, 0, 52, 57, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 52, 70, 0, 53, 48, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 53, 70, 0, 53, 49, 44, 87, 97, 121, 119, 97, 114, 100, 32, 67, 97, 118, 101, 0, 53, 50, 44, 87, 97, 121, 119, 97, 114, 100, 32, 67, 97, 118, 101, 32, 40, 83, 101, 99, 114, 101, 116, 41, 0, 53, 51, 44, 82, 117, 105, 110, 32, 77, 97, 110, 105, 97, 99, 32, 67, 97, 118, 101, 32, 40, 60, 32, 49, 48, 32, 85, 110, 111, 119, 110, 41, 0, 53, 52, 44, 82, 117, 105, 110, 32, 77, 97, 110, 105, 97, 99, 32, 67, 97, 118, 101, 32, 40, 62, 32, 49, 48, 32, 85, 110, 111, 119, 110, 41, 0, 53, 53, 44, 77, 97, 110, 105, 97, 99, 32, 84, 117, 110, 110, 101, 108, 0, 53, 54, 44, 84, 114, 111, 112, 104, 121, 32, 71, 97, 114, 100, 101, 110, 0, 53, 55, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 0, 53, 56, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 49, 70, 0, 53, 57, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 49, 70, 0, 54, 48, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 50, 70, 32, 40, 76, 101, 102, 116, 41, 0, 54, 49, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 50, 70, 32, 40, 82, 105, 103, 104, 116, 41, 0, 54, 50, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 51, 70, 0, 54, 51, 44, 79, 108, 100, 32, 67, 104, 97, 116, 101, 97, 117, 0, 54, 52, 44, 79, 108, 100, 32, 67, 104, 97, 116, 101, 97, 117, 32, 82, 111, 111, 109, 32, 53, 0, 54, 53, 44, 76, 97, 107, 101, 32, 86, 101, 114, 105, 116, 121, 0, 54, 54, 44, 76, 97, 107, 101, 32, 86, 97, 108, 111, 114, 0, 54, 55, 44, 76, 97, 107, 101, 32, 65, 99, 117, 105, 116, 121, 0, 54, 56, 44, 86, 97, 108, 111, 114, 32, 76, 97, 107, 101, 102, 114, 111, 110, 116, 0, 54, 57, 44, 65, 99, 117, 105, 116, 121, 32, 76, 97, 107, 101, 102, 114, 111, 110, 116, 0, 55, 48, 44, 82, 111, 117, 116, 101, 32, 50, 48, 49, 0, 55, 49, 44, 82, 111, 117, 116, 101, 32, 50, 48, 50, 0, 55, 50, 44, 82, 111, 117, 116, 101, 32, 50, 48, 51, 0, 55, 51, 44, 82, 111, 117, 116, 101, 32, 50, 48, 52, 32, 40, 83, 111, 117, 116, 104, 41, 0, 55, 52, 44, 82, 111, 117, 116, 101, 32, 50, 48, 52, 32, 40, 78, 111, 114, 116, 104, 41, 0, 55, 53, 44, 82, 111, 117, 116, 101, 32, 50, 48, 53, 32, 40, 83, 111, 117, 116, 104, 41, 0, 55, 54, 44, 82, 111, 117, 116, 101, 32, 50, 48, 53, 32, 40, 78, 111, 114, 116, 104, 41, 0, 55, 55, 44, 82, 111, 117, 116, 101, 32, 50, 48, 54, 0, 55, 56, 44, 82, 111, 117, 116, 101, 32, 50, 48, 55, 0, 55, 57, 44, 82, 111, 117, 116, 101, 32, 50, 48, 56, 0, 56, 48, 44, 82, 111, 117, 116, 101, 32, 50, 48, 57, 0, 56, 49, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 49, 70, 0, 56, 50, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 50, 70, 0, 56, 51, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 51, 70, 0, 56, 52, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 52, 70, 0, 56, 53, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 53, 70, 0, 56, 54, 44, 82, 111, 117, 116, 101, 32, 50, 49, 48, 32, 40, 83, 111, 117, 116, 104, 41, 0, 56, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 48, 32, 40, 78, 111, 114, 116, 104, 41, 0, 56, 56, 44, 82, 111, 117, 116, 101, 32, 50, 49, 49, 32, 40, 87, 101, 115, 116, 41, 0, 56, 57, 44, 82, 111, 117, 116, 101, 32, 50, 49, 49, 32, 40, 69, 97, 115, 116, 41, 0, 57, 48, 44, 82, 111, 117, 116, 101, 32, 50, 49, 50, 32, 40, 78, 111, 114, 116, 104, 41, 0, 57, 49, 44, 82, 111, 117, 116, 101, 32, 50, 49, 50, 32, 40, 83, 111, 117, 116, 104, 41, 0, 57, 50, 44, 82, 111, 117, 116, 101, 32, 50, 49, 51, 0, 57, 51, 44, 82, 111, 117, 116, 101, 32, 50, 49, 52, 0, 57, 52, 44, 82, 111, 117, 116, 101, 32, 50, 49, 53, 0, 57, 53, 44, 82, 111, 117, 116, 101, 32, 50, 49, 54, 0, 57, 54, 44, 82, 111, 117, 116, 101, 32, 50, 49, 55, 0, 57, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 56, 0, 57, 56, 44, 82, 111, 117, 116, 101, 32, 50, 49, 57, 0, 57, 57, 44, 82, 111, 117, 116, 101, 32, 50, 50, 49, 0, 49, 48, 48, 44, 82, 111, 117, 116, 101, 32, 50, 50, 50, 0, 49, 48, 49, 44, 82, 111, 117, 116, 101, 32, 50, 50, 52, 0, 49, 48, 50, 44, 82, 111, 117, 116, 101, 32, 50, 50, 53, 0, 49, 48, 51, 44, 82, 111, 117, 116, 101, 32, 50, 50, 55, 0, 49, 48, 52, 44, 82, 111, 117, 116, 101, 32, 50, 50, 56, 0, 49, 48, 53, 44, 82, 111, 117, 116, 101, 32, 50, 50, 57, 0, 49, 48, 54, 44, 84, 119, 105, 110, 108, 101, 97, 102, 32, 84, 111, 119, 110, 0, 49, 48, 55, 44, 67, 101, 108, 101, 115, 116, 105, 99, 32, 84, 111, 119, 110, 0, 49, 48, 56, 44, 82, 101, 115, 111, 114, 116, 32, 65, 114, 101, 97, 0, 49, 48, 57, 44, 82, 111, 117, 116, 101, 32, 50, 50, 48, 0, 49, 49, 48, 44, 82, 111, 117, 116, 101, 32, 50, 50, 51, 0, 49, 49, 49, 44, 82, 111, 117, 116, 101, 32, 50, 50, 54, 0, 49, 49, 50, 44, 82, 111, 117, 116, 101, 32, 50, 51, 48, 0 };
-
-constexpr std::array<u8, 1799> frlg_en = { 48, 44, 80, 97, 108, 108, 101, 116, 32, 84, 111, 119, 110, 0, 49, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 67, 105, 116, 121, 0, 50, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 105, 116, 121, 0, 51, 44, 86, 101, 114, 109, 105, 108, 105, 111, 110, 32, 67, 105, 116, 121, 0, 52, 44, 67, 101, 108, 97, 100, 111, 110, 32, 67, 105, 116, 121, 0, 53, 44, 70, 117, 99, 104, 115, 105, 97, 32, 67, 105, 116, 121, 0, 54, 44, 67, 105, 110, 110, 97, 98, 97, 114, 32, 73, 115, 108, 97, 110, 100, 0, 55, 44, 82, 111, 117, 116, 101, 32, 49, 0, 56, 44, 82, 111, 117, 116, 101, 32, 50, 0, 57, 44, 82, 111, 117, 116, 101, 32, 51, 0, 49, 48, 44, 82, 111, 117, 116, 101, 32, 52, 0, 49, 49, 44, 82, 111, 117, 116, 101, 32, 53, 0, 49, 50, 44, 82, 111, 117, 116, 101, 32, 54, 0, 49, 51, 44, 82, 111, 117, 116, 101, 32, 55, 0, 49, 52, 44, 82, 111, 117, 116, 101, 32, 56, 0, 49, 53, 44, 82, 111, 117, 116, 101, 32, 57, 0, 49, 54, 44, 82, 111, 117, 116, 101, 32, 49, 48, 0, 49, 55, 44, 82, 111, 117, 116, 101, 32, 49, 49, 0, 49, 56, 44, 82, 111, 117, 116, 101, 32, 49, 50, 0, 49, 57, 44, 82, 111, 117, 116, 101, 32, 49, 51, 0, 50, 48, 44, 82, 111, 117, 116, 101, 32, 49, 52, 0, 50, 49, 44, 82, 111, 117, 116, 101, 32, 49, 53, 0, 50, 50, 44, 82, 111, 117, 116, 101, 32, 49, 54, 0, 50, 51, 44, 82, 111, 117, 116, 101, 32, 49, 55, 0, 50, 52, 44, 82, 111, 117, 116, 101, 32, 49, 56, 0, 50, 53, 44, 82, 111, 117, 116, 101, 32, 49, 57, 0, 50, 54, 44, 82, 111, 117, 116, 101, 32, 50, 48, 0, 50, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 0, 50, 56, 44, 82, 111, 117, 116, 101, 32, 50, 50, 0, 50, 57, 44, 82, 111, 117, 116, 101, 32, 50, 51, 0, 51, 48, 44, 82, 111, 117, 116, 101, 32, 50, 52, 0, 51, 49, 44, 82, 111, 117, 116, 101, 32, 50, 53, 0, 51, 50, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 70, 111, 114, 101, 115, 116, 0, 51, 51, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 49, 70, 0, 51, 52, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 66, 49, 70, 0, 51, 53, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 66, 50, 70, 0, 51, 54, 44, 83, 46, 83, 46, 32, 65, 110, 110, 101, 0, 51, 55, 44, 68, 105, 103, 108, 101, 116, 116, 39, 115, 32, 67, 97, 118, 101, 0, 51, 56, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 51, 57, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 50, 70, 0, 52, 48, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 51, 70, 0, 52, 49, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 77, 97, 110, 115, 105, 111, 110, 32, 49, 70, 45, 51, 70, 0, 52, 50, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 77, 97, 110, 115, 105, 111, 110, 32, 66, 49, 70, 0, 52, 51, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 67, 101, 110, 116, 101, 114, 0, 52, 52, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 49, 0, 52, 53, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 50, 0, 52, 54, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 51, 0, 52, 55, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 49, 70, 0, 52, 56, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 66, 49, 70, 0, 52, 57, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 49, 70, 0, 53, 48, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 49, 70, 0, 53, 49, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 50, 70, 0, 53, 50, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 51, 70, 0, 53, 51, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 52, 70, 0, 53, 52, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 51, 70, 0, 53, 53, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 52, 70, 0, 53, 54, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 53, 70, 0, 53, 55, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 54, 70, 0, 53, 56, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 55, 70, 0, 53, 57, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 49, 70, 0, 54, 48, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 50, 70, 0, 54, 49, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 54, 50, 44, 80, 111, 119, 101, 114, 32, 80, 108, 97, 110, 116, 0, 54, 51, 44, 79, 110, 101, 32, 73, 115, 108, 97, 110, 100, 0, 54, 52, 44, 70, 111, 117, 114, 32, 73, 115, 108, 97, 110, 100, 0, 54, 53, 44, 70, 105, 118, 101, 32, 73, 115, 108, 97, 110, 100, 0, 54, 54, 44, 75, 105, 110, 100, 108, 101, 32, 82, 111, 97, 100, 0, 54, 55, 44, 84, 114, 101, 97, 115, 117, 114, 101, 32, 66, 101, 97, 99, 104, 0, 54, 56, 44, 67, 97, 112, 101, 32, 66, 114, 105, 110, 107, 0, 54, 57, 44, 66, 111, 110, 100, 32, 66, 114, 105, 100, 103, 101, 0, 55, 48, 44, 84, 104, 114, 101, 101, 32, 73, 115, 108, 101, 32, 80, 111, 114, 116, 0, 55, 49, 44, 82, 101, 115, 111, 114, 116, 32, 71, 111, 114, 103, 101, 111, 117, 115, 0, 55, 50, 44, 87, 97, 116, 101, 114, 32, 76, 97, 98, 121, 114, 105, 110, 116, 104, 0, 55, 51, 44, 70, 105, 118, 101, 32, 73, 115, 108, 101, 32, 77, 101, 97, 100, 111, 119, 0, 55, 52, 44, 77, 101, 109, 111, 114, 105, 97, 108, 32, 80, 105, 108, 108, 97, 114, 0, 55, 53, 44, 79, 117, 116, 99, 97, 115, 116, 32, 73, 115, 108, 97, 110, 100, 0, 55, 54, 44, 71, 114, 101, 101, 110, 32, 80, 97, 116, 104, 0, 55, 55, 44, 87, 97, 116, 101, 114, 32, 80, 97, 116, 104, 0, 55, 56, 44, 82, 117, 105, 110, 32, 86, 97, 108, 108, 101, 121, 0, 55, 57, 44, 84, 114, 97, 105, 110, 101, 114, 32, 84, 111, 119, 101, 114, 32, 40, 101, 120, 116, 101, 114, 105, 111, 114, 41, 0, 56, 48, 44, 67, 97, 110, 121, 111, 110, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 56, 49, 44, 83, 101, 118, 97, 117, 108, 116, 32, 67, 97, 110, 121, 111, 110, 0, 56, 50, 44, 84, 97, 110, 111, 98, 121, 32, 82, 117, 105, 110, 115, 0, 56, 51, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 0, 56, 52, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 82, 111, 111, 109, 32, 49, 0, 56, 53, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 82, 111, 111, 109, 32, 50, 0, 56, 54, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 82, 111, 111, 109, 32, 51, 0, 56, 55, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 49, 70, 0, 56, 56, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 49, 70, 0, 56, 57, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 50, 70, 0, 57, 48, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 51, 70, 0, 57, 49, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 52, 70, 0, 57, 50, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 53, 70, 0, 57, 51, 44, 66, 101, 114, 114, 121, 32, 70, 111, 114, 101, 115, 116, 0, 57, 52, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 0, 57, 53, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 32, 49, 70, 0, 57, 54, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 57, 55, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 32, 66, 97, 99, 107, 0, 57, 56, 44, 80, 97, 116, 116, 101, 114, 110, 32, 66, 117, 115, 104, 0, 57, 57, 44, 65, 108, 116, 101, 114, 105, 110, 103, 32, 67, 97, 118, 101, 0, 49, 48, 48, 44, 77, 111, 110, 101, 97, 110, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 49, 44, 76, 105, 112, 116, 111, 111, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 50, 44, 87, 101, 101, 112, 116, 104, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 51, 44, 68, 105, 108, 102, 111, 114, 100, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 52, 44, 83, 99, 117, 102, 105, 98, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 53, 44, 82, 105, 120, 121, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 54, 44, 86, 105, 97, 112, 111, 105, 115, 32, 67, 104, 97, 109, 98, 101, 114, 0 };
-
-constexpr std::array<u8, 1948> hgss_en = { 48, 44, 78, 101, 119, 32, 66, 97, 114, 107, 32, 84, 111, 119, 110, 0, 49, 44, 82, 111, 117, 116, 101, 32, 50, 57, 0, 50, 44, 67, 104, 101, 114, 114, 121, 103, 114, 111, 118, 101, 32, 67, 105, 116, 121, 0, 51, 44, 82, 111, 117, 116, 101, 32, 51, 48, 0, 52, 44, 82, 111, 117, 116, 101, 32, 51, 49, 0, 53, 44, 86, 105, 111, 108, 101, 116, 32, 67, 105, 116, 121, 0, 54, 44, 83, 112, 114, 111, 117, 116, 32, 84, 111, 119, 101, 114, 0, 55, 44, 82, 111, 117, 116, 101, 32, 51, 50, 0, 56, 44, 82, 117, 105, 110, 115, 32, 111, 102, 32, 65, 108, 112, 104, 32, 40, 79, 117, 116, 115, 105, 100, 101, 41, 0, 57, 44, 82, 117, 105, 110, 115, 32, 111, 102, 32, 65, 108, 112, 104, 32, 40, 73, 110, 115, 105, 100, 101, 41, 0, 49, 48, 44, 85, 110, 105, 111, 110, 32, 67, 97, 118, 101, 32, 49, 70, 0, 49, 49, 44, 85, 110, 105, 111, 110, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 49, 50, 44, 85, 110, 105, 111, 110, 32, 67, 97, 118, 101, 32, 66, 50, 70, 0, 49, 51, 44, 82, 111, 117, 116, 101, 32, 51, 51, 0, 49, 52, 44, 83, 76, 79, 87, 80, 79, 75, 69, 32, 87, 101, 108, 108, 32, 49, 70, 0, 49, 53, 44, 83, 76, 79, 87, 80, 79, 75, 69, 32, 87, 101, 108, 108, 32, 66, 49, 70, 0, 49, 54, 44, 73, 108, 101, 120, 32, 70, 111, 114, 101, 115, 116, 0, 49, 55, 44, 82, 111, 117, 116, 101, 32, 51, 52, 0, 49, 56, 44, 82, 111, 117, 116, 101, 32, 51, 53, 0, 49, 57, 44, 78, 97, 116, 105, 111, 110, 97, 108, 32, 80, 97, 114, 107, 0, 50, 48, 44, 82, 111, 117, 116, 101, 32, 51, 54, 0, 50, 49, 44, 82, 111, 117, 116, 101, 32, 51, 55, 0, 50, 50, 44, 69, 99, 114, 117, 116, 101, 97, 107, 32, 67, 105, 116, 121, 0, 50, 51, 44, 66, 117, 114, 110, 101, 100, 32, 84, 111, 119, 101, 114, 32, 49, 70, 0, 50, 52, 44, 66, 117, 114, 110, 101, 100, 32, 84, 111, 119, 101, 114, 32, 66, 49, 70, 0, 50, 53, 44, 66, 101, 108, 108, 32, 84, 111, 119, 101, 114, 0, 50, 54, 44, 82, 111, 117, 116, 101, 32, 51, 56, 0, 50, 55, 44, 82, 111, 117, 116, 101, 32, 51, 57, 0, 50, 56, 44, 79, 108, 105, 118, 105, 110, 101, 32, 67, 105, 116, 121, 0, 50, 57, 44, 82, 111, 117, 116, 101, 32, 52, 48, 0, 51, 48, 44, 82, 111, 117, 116, 101, 32, 52, 49, 0, 51, 49, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 49, 70, 0, 51, 50, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 49, 70, 0, 51, 51, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 50, 70, 0, 51, 52, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 51, 70, 0, 51, 53, 44, 67, 105, 97, 110, 119, 111, 111, 100, 32, 67, 105, 116, 121, 0, 51, 54, 44, 82, 111, 117, 116, 101, 32, 52, 50, 0, 51, 55, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 49, 70, 0, 51, 56, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 49, 70, 32, 40, 66, 97, 99, 107, 41, 0, 51, 57, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 50, 70, 0, 52, 48, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 66, 49, 70, 0, 52, 49, 44, 82, 111, 117, 116, 101, 32, 52, 51, 0, 52, 50, 44, 76, 97, 107, 101, 32, 111, 102, 32, 82, 97, 103, 101, 0, 52, 51, 44, 82, 111, 117, 116, 101, 32, 52, 52, 0, 52, 52, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 49, 70, 0, 52, 53, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 66, 49, 70, 0, 52, 54, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 66, 50, 70, 0, 52, 55, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 66, 51, 70, 0, 52, 56, 44, 66, 108, 97, 99, 107, 116, 104, 111, 114, 110, 32, 67, 105, 116, 121, 0, 52, 57, 44, 68, 114, 97, 103, 111, 110, 226, 128, 153, 115, 32, 68, 101, 110, 0, 53, 48, 44, 82, 111, 117, 116, 101, 32, 52, 53, 0, 53, 49, 44, 82, 111, 117, 116, 101, 32, 52, 54, 0, 53, 50, 44, 68, 97, 114, 107, 32, 67, 97, 118, 101, 32, 40, 82, 111, 117, 116, 101, 32, 51, 49, 41, 0, 53, 51, 44, 68, 97, 114, 107, 32, 67, 97, 118, 101, 32, 40, 82, 111, 117, 116, 101, 32, 52, 53, 41, 0, 53, 52, 44, 82, 111, 117, 116, 101, 32, 52, 55, 0, 53, 53, 44, 77, 116, 46, 32, 77, 111, 111, 110, 0, 53, 54, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 40, 67, 108, 101, 102, 97, 105, 114, 121, 41, 0, 53, 55, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 49, 70, 0, 53, 56, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 49, 70, 0, 53, 57, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 50, 70, 0, 54, 48, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 51, 70, 0, 54, 49, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 52, 70, 0, 54, 50, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 49, 70, 0, 54, 51, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 67, 97, 118, 101, 32, 49, 70, 32, 84, 111, 112, 0, 54, 52, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 52, 70, 0, 54, 53, 44, 67, 108, 105, 102, 102, 32, 69, 100, 103, 101, 32, 71, 97, 116, 101, 0, 54, 54, 44, 67, 108, 105, 102, 102, 32, 67, 97, 118, 101, 0, 54, 55, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 0, 54, 56, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 50, 70, 0, 54, 57, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 67, 97, 118, 101, 32, 77, 111, 117, 110, 116, 97, 105, 110, 115, 105, 100, 101, 0, 55, 48, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 67, 97, 118, 101, 32, 51, 70, 0, 55, 49, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 84, 111, 112, 0, 55, 50, 44, 82, 111, 117, 116, 101, 32, 49, 50, 0, 55, 51, 44, 82, 111, 117, 116, 101, 32, 49, 57, 0, 55, 52, 44, 82, 111, 117, 116, 101, 32, 50, 48, 0, 55, 53, 44, 80, 97, 108, 108, 101, 116, 32, 84, 111, 119, 110, 0, 55, 54, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 67, 105, 116, 121, 0, 55, 55, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 105, 116, 121, 0, 55, 56, 44, 86, 101, 114, 109, 105, 108, 105, 111, 110, 32, 67, 105, 116, 121, 0, 55, 57, 44, 67, 101, 108, 97, 100, 111, 110, 32, 67, 105, 116, 121, 0, 56, 48, 44, 70, 117, 99, 104, 115, 105, 97, 32, 67, 105, 116, 121, 0, 56, 49, 44, 67, 105, 110, 110, 97, 98, 97, 114, 32, 73, 115, 108, 97, 110, 100, 0, 56, 50, 44, 82, 111, 117, 116, 101, 32, 52, 56, 0, 56, 51, 44, 82, 111, 117, 116, 101, 32, 50, 54, 0, 56, 52, 44, 82, 111, 117, 116, 101, 32, 50, 55, 0, 56, 53, 44, 82, 111, 117, 116, 101, 32, 50, 56, 0, 56, 54, 44, 77, 116, 46, 32, 77, 111, 111, 110, 0, 56, 55, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 49, 70, 0, 56, 56, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 50, 70, 0, 56, 57, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 57, 48, 44, 82, 111, 117, 116, 101, 32, 49, 0, 57, 49, 44, 82, 111, 117, 116, 101, 32, 50, 32, 40, 83, 111, 117, 116, 104, 41, 0, 57, 50, 44, 82, 111, 117, 116, 101, 32, 51, 0, 57, 51, 44, 82, 111, 117, 116, 101, 32, 52, 0, 57, 52, 44, 82, 111, 117, 116, 101, 32, 53, 0, 57, 53, 44, 82, 111, 117, 116, 101, 32, 54, 0, 57, 54, 44, 82, 111, 117, 116, 101, 32, 55, 0, 57, 55, 44, 82, 111, 117, 116, 101, 32, 56, 0, 57, 56, 44, 82, 111, 117, 116, 101, 32, 57, 0, 57, 57, 44, 82, 111, 117, 116, 101, 32, 49, 48, 0, 49, 48, 48, 44, 82, 111, 117, 116, 101, 32, 49, 49, 0, 49, 48, 49, 44, 82, 111, 117, 116, 101, 32, 49, 51, 0, 49, 48, 50, 44, 82, 111, 117, 116, 101, 32, 49, 52, 0, 49, 48, 51, 44, 82, 111, 117, 116, 101, 32, 49, 53, 0, 49, 48, 52, 44, 82, 111, 117, 116, 101, 32, 49, 54, 0, 49, 48, 53, 44, 82, 111, 117, 116, 101, 32, 49, 55, 0, 49, 48, 54, 44, 82, 111, 117, 116, 101, 32, 49, 56, 0, 49, 48, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 0, 49, 48, 56, 44, 82, 111, 117, 116, 101, 32, 50, 50, 0, 49, 48, 57, 44, 82, 111, 117, 116, 101, 32, 50, 52, 0, 49, 49, 48, 44, 82, 111, 117, 116, 101, 32, 50, 53, 0, 49, 49, 49, 44, 84, 111, 104, 106, 111, 32, 70, 97, 108, 108, 115, 0, 49, 49, 50, 44, 68, 73, 71, 76, 69, 84, 84, 226, 128, 153, 115, 32, 67, 97, 118, 101, 0, 49, 49, 51, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 50, 70, 0, 49, 49, 52, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 51, 70, 0, 49, 49, 53, 44, 82, 111, 117, 116, 101, 32, 50, 32, 40, 78, 111, 114, 116, 104, 41, 0, 49, 49, 54, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 70, 111, 114, 101, 115, 116, 0, 49, 49, 55, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 49, 70, 0, 49, 49, 56, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 50, 70, 0, 49, 49, 57, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0 };
-
-constexpr std::array<u8, 162> natures_en = { 72, 97, 114, 100, 121, 0, 76, 111, 110, 101, 108, 121, 0, 66, 114, 97, 118, 101, 0, 65, 100, 97, 109, 97, 110, 116, 0, 78, 97, 117, 103, 104, 116, 121, 0, 66, 111, 108, 100, 0, 68, 111, 99, 105, 108, 101, 0, 82, 101, 108, 97, 120, 101, 100, 0, 73, 109, 112, 105, 115, 104, 0, 76, 97, 120, 0, 84, 105, 109, 105, 100, 0, 72, 97, 115, 116, 121, 0, 83, 101, 114, 105, 111, 117, 115, 0, 74, 111, 108, 108, 121, 0, 78, 97, 105, 118, 101, 0, 77, 111, 100, 101, 115, 116, 0, 77, 105, 108, 100, 0, 81, 117, 105, 101, 116, 0, 66, 97, 115, 104, 102, 117, 108, 0, 82, 97, 115, 104, 0, 67, 97, 108, 109, 0, 71, 101, 110, 116, 108, 101, 0, 83, 97, 115, 115, 121, 0, 67, 97, 114, 101, 102, 117, 108, 0, 81, 117, 105, 114, 107, 121, 0 };
-
-constexpr std::array<u8, 101> powers_en = { 70, 105, 103, 104, 116, 105, 110, 103, 0, 70, 108, 121, 105, 110, 103, 0, 80, 111, 105, 115, 111, 110, 0, 71, 114, 111, 117, 110, 100, 0, 82, 111, 99, 107, 0, 66, 117, 103, 0, 71, 104, 111, 115, 116, 0, 83, 116, 101, 101, 108, 0, 70, 105, 114, 101, 0, 87, 97, 116, 101, 114, 0, 71, 114, 97, 115, 115, 0, 69, 108, 101, 99, 116, 114, 105, 99, 0, 80, 115, 121, 99, 104, 105, 99, 0, 73, 99, 101, 0, 68, 114, 97, 103, 111, 110, 0, 68, 97, 114, 107, 0 };
-
-constexpr std::array<u8, 1480> rse_en = { 48, 44, 68, 101, 119, 102, 111, 114, 100, 32, 84, 111, 119, 110, 0, 49, 44, 80, 97, 99, 105, 102, 105, 100, 108, 111, 103, 32, 84, 111, 119, 110, 0, 50, 44, 80, 101, 116, 97, 108, 98, 117, 114, 103, 32, 67, 105, 116, 121, 0, 51, 44, 83, 108, 97, 116, 101, 112, 111, 114, 116, 32, 67, 105, 116, 121, 0, 52, 44, 76, 105, 108, 121, 99, 111, 118, 101, 32, 67, 105, 116, 121, 0, 53, 44, 77, 111, 115, 115, 100, 101, 101, 112, 32, 67, 105, 116, 121, 0, 54, 44, 83, 111, 111, 116, 111, 112, 111, 108, 105, 115, 32, 67, 105, 116, 121, 0, 55, 44, 69, 118, 101, 114, 32, 71, 114, 97, 110, 100, 101, 32, 67, 105, 116, 121, 0, 56, 44, 82, 111, 117, 116, 101, 32, 49, 48, 49, 0, 57, 44, 82, 111, 117, 116, 101, 32, 49, 48, 50, 0, 49, 48, 44, 82, 111, 117, 116, 101, 32, 49, 48, 51, 0, 49, 49, 44, 82, 111, 117, 116, 101, 32, 49, 48, 52, 0, 49, 50, 44, 82, 111, 117, 116, 101, 32, 49, 48, 53, 0, 49, 51, 44, 82, 111, 117, 116, 101, 32, 49, 48, 54, 0, 49, 52, 44, 82, 111, 117, 116, 101, 32, 49, 48, 55, 0, 49, 53, 44, 82, 111, 117, 116, 101, 32, 49, 48, 56, 0, 49, 54, 44, 82, 111, 117, 116, 101, 32, 49, 48, 57, 0, 49, 55, 44, 82, 111, 117, 116, 101, 32, 49, 49, 48, 0, 49, 56, 44, 82, 111, 117, 116, 101, 32, 49, 49, 49, 0, 49, 57, 44, 82, 111, 117, 116, 101, 32, 49, 49, 50, 0, 50, 48, 44, 82, 111, 117, 116, 101, 32, 49, 49, 51, 0, 50, 49, 44, 82, 111, 117, 116, 101, 32, 49, 49, 52, 0, 50, 50, 44, 82, 111, 117, 116, 101, 32, 49, 49, 53, 0, 50, 51, 44, 82, 111, 117, 116, 101, 32, 49, 49, 54, 0, 50, 52, 44, 82, 111, 117, 116, 101, 32, 49, 49, 55, 0, 50, 53, 44, 82, 111, 117, 116, 101, 32, 49, 49, 56, 0, 50, 54, 44, 82, 111, 117, 116, 101, 32, 49, 49, 57, 0, 50, 55, 44, 82, 111, 117, 116, 101, 32, 49, 50, 48, 0, 50, 56, 44, 82, 111, 117, 116, 101, 32, 49, 50, 49, 0, 50, 57, 44, 82, 111, 117, 116, 101, 32, 49, 50, 50, 0, 51, 48, 44, 82, 111, 117, 116, 101, 32, 49, 50, 51, 0, 51, 49, 44, 82, 111, 117, 116, 101, 32, 49, 50, 52, 0, 51, 50, 44, 82, 111, 117, 116, 101, 32, 49, 50, 53, 0, 51, 51, 44, 82, 111, 117, 116, 101, 32, 49, 50, 54, 0, 51, 52, 44, 82, 111, 117, 116, 101, 32, 49, 50, 55, 0, 51, 53, 44, 82, 111, 117, 116, 101, 32, 49, 50, 56, 0, 51, 54, 44, 82, 111, 117, 116, 101, 32, 49, 50, 57, 0, 51, 55, 44, 82, 111, 117, 116, 101, 32, 49, 51, 48, 0, 51, 56, 44, 82, 111, 117, 116, 101, 32, 49, 51, 49, 0, 51, 57, 44, 82, 111, 117, 116, 101, 32, 49, 51, 50, 0, 52, 48, 44, 82, 111, 117, 116, 101, 32, 49, 51, 51, 0, 52, 49, 44, 82, 111, 117, 116, 101, 32, 49, 51, 52, 0, 52, 50, 44, 85, 110, 100, 101, 114, 119, 97, 116, 101, 114, 32, 40, 82, 111, 117, 116, 101, 32, 49, 50, 52, 41, 0, 52, 51, 44, 85, 110, 100, 101, 114, 119, 97, 116, 101, 114, 32, 40, 82, 111, 117, 116, 101, 32, 49, 50, 54, 41, 0, 52, 52, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 49, 70, 0, 52, 53, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 83, 116, 101, 118, 101, 110, 39, 115, 32, 82, 111, 111, 109, 0, 52, 54, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 52, 55, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 66, 50, 70, 0, 52, 56, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 49, 0, 52, 57, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 50, 0, 53, 48, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 51, 0, 53, 49, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 52, 0, 53, 50, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 53, 0, 53, 51, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 54, 0, 53, 52, 44, 80, 101, 116, 97, 108, 98, 117, 114, 103, 32, 87, 111, 111, 100, 115, 0, 53, 53, 44, 82, 117, 115, 116, 117, 114, 102, 32, 84, 117, 110, 110, 101, 108, 0, 53, 54, 44, 65, 98, 97, 110, 100, 111, 110, 101, 100, 32, 83, 104, 105, 112, 0, 53, 55, 44, 78, 101, 119, 32, 77, 97, 117, 118, 105, 108, 108, 101, 32, 40, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 53, 56, 44, 78, 101, 119, 32, 77, 97, 117, 118, 105, 108, 108, 101, 32, 40, 66, 97, 115, 101, 109, 101, 110, 116, 41, 0, 53, 57, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 49, 70, 32, 49, 82, 0, 54, 48, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 49, 70, 32, 50, 82, 0, 54, 49, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 66, 49, 70, 32, 49, 82, 0, 54, 50, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 66, 49, 70, 32, 50, 82, 0, 54, 51, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 83, 116, 101, 118, 101, 110, 39, 115, 32, 67, 97, 118, 101, 0, 54, 52, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 49, 70, 45, 51, 70, 0, 54, 53, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 52, 70, 45, 54, 70, 0, 54, 54, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 69, 120, 116, 101, 114, 105, 111, 114, 0, 54, 55, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 83, 117, 109, 109, 105, 116, 0, 54, 56, 44, 83, 104, 111, 97, 108, 32, 67, 97, 118, 101, 0, 54, 57, 44, 83, 104, 111, 97, 108, 32, 67, 97, 118, 101, 32, 73, 99, 101, 32, 82, 111, 111, 109, 0, 55, 48, 44, 83, 101, 97, 102, 108, 111, 111, 114, 32, 67, 97, 118, 101, 114, 110, 0, 55, 49, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 55, 50, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 49, 70, 0, 55, 51, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 50, 70, 0, 55, 52, 44, 67, 97, 118, 101, 32, 111, 102, 32, 79, 114, 105, 103, 105, 110, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 55, 53, 44, 67, 97, 118, 101, 32, 111, 102, 32, 79, 114, 105, 103, 105, 110, 0, 55, 54, 44, 70, 105, 101, 114, 121, 32, 80, 97, 116, 104, 0, 55, 55, 44, 74, 97, 103, 103, 101, 100, 32, 80, 97, 115, 115, 0, 55, 56, 44, 83, 107, 121, 32, 80, 105, 108, 108, 97, 114, 32, 49, 70, 0, 55, 57, 44, 83, 107, 121, 32, 80, 105, 108, 108, 97, 114, 32, 51, 70, 0, 56, 48, 44, 83, 107, 121, 32, 80, 105, 108, 108, 97, 114, 32, 53, 70, 0, 56, 49, 44, 77, 97, 103, 109, 97, 32, 72, 105, 100, 101, 111, 117, 116, 0, 56, 50, 44, 77, 105, 114, 97, 103, 101, 32, 84, 111, 119, 101, 114, 0, 56, 51, 44, 65, 114, 116, 105, 115, 97, 110, 32, 67, 97, 118, 101, 0, 56, 52, 44, 68, 101, 115, 101, 114, 116, 32, 85, 110, 100, 101, 114, 112, 97, 115, 115, 0, 56, 53, 44, 65, 108, 116, 101, 114, 105, 110, 103, 32, 67, 97, 118, 101, 0 };
-
-constexpr std::array<u8, 6850> species_en = { 239, 187, 191, 66, 117, 108, 98, 97, 115, 97, 117, 114, 0, 73, 118, 121, 115, 97, 117, 114, 0, 86, 101, 110, 117, 115, 97, 117, 114, 0, 67, 104, 97, 114, 109, 97, 110, 100, 101, 114, 0, 67, 104, 97, 114, 109, 101, 108, 101, 111, 110, 0, 67, 104, 97, 114, 105, 122, 97, 114, 100, 0, 83, 113, 117, 105, 114, 116, 108, 101, 0, 87, 97, 114, 116, 111, 114, 116, 108, 101, 0, 66, 108, 97, 115, 116, 111, 105, 115, 101, 0, 67, 97, 116, 101, 114, 112, 105, 101, 0, 77, 101, 116, 97, 112, 111, 100, 0, 66, 117, 116, 116, 101, 114, 102, 114, 101, 101, 0, 87, 101, 101, 100, 108, 101, 0, 75, 97, 107, 117, 110, 97, 0, 66, 101, 101, 100, 114, 105, 108, 108, 0, 80, 105, 100, 103, 101, 121, 0, 80, 105, 100, 103, 101, 111, 116, 116, 111, 0, 80, 105, 100, 103, 101, 111, 116, 0, 82, 97, 116, 116, 97, 116, 97, 0, 82, 97, 116, 105, 99, 97, 116, 101, 0, 83, 112, 101, 97, 114, 111, 119, 0, 70, 101, 97, 114, 111, 119, 0, 69, 107, 97, 110, 115, 0, 65, 114, 98, 111, 107, 0, 80, 105, 107, 97, 99, 104, 117, 0, 82, 97, 105, 99, 104, 117, 0, 83, 97, 110, 100, 115, 104, 114, 101, 119, 0, 83, 97, 110, 100, 115, 108, 97, 115, 104, 0, 78, 105, 100, 111, 114, 97, 110, 226, 153, 128, 0, 78, 105, 100, 111, 114, 105, 110, 97, 0, 78, 105, 100, 111, 113, 117, 101, 101, 110, 0, 78, 105, 100, 111, 114, 97, 110, 226, 153, 130, 0, 78, 105, 100, 111, 114, 105, 110, 111, 0, 78, 105, 100, 111, 107, 105, 110, 103, 0, 67, 108, 101, 102, 97, 105, 114, 121, 0, 67, 108, 101, 102, 97, 98, 108, 101, 0, 86, 117, 108, 112, 105, 120, 0, 78, 105, 110, 101, 116, 97, 108, 101, 115, 0, 74, 105, 103, 103, 108, 121, 112, 117, 102, 102, 0, 87, 105, 103, 103, 108, 121, 116, 117, 102, 102, 0, 90, 117, 98, 97, 116, 0, 71, 111, 108, 98, 97, 116, 0, 79, 100, 100, 105, 115, 104, 0, 71, 108, 111, 111, 109, 0, 86, 105, 108, 101, 112, 108, 117, 109, 101, 0, 80, 97, 114, 97, 115, 0, 80, 97, 114, 97, 115, 101, 99, 116, 0, 86, 101, 110, 111, 110, 97, 116, 0, 86, 101, 110, 111, 109, 111, 116, 104, 0, 68, 105, 103, 108, 101, 116, 116, 0, 68, 117, 103, 116, 114, 105, 111, 0, 77, 101, 111, 119, 116, 104, 0, 80, 101, 114, 115, 105, 97, 110, 0, 80, 115, 121, 100, 117, 99, 107, 0, 71, 111, 108, 100, 117, 99, 107, 0, 77, 97, 110, 107, 101, 121, 0, 80, 114, 105, 109, 101, 97, 112, 101, 0, 71, 114, 111, 119, 108, 105, 116, 104, 101, 0, 65, 114, 99, 97, 110, 105, 110, 101, 0, 80, 111, 108, 105, 119, 97, 103, 0, 80, 111, 108, 105, 119, 104, 105, 114, 108, 0, 80, 111, 108, 105, 119, 114, 97, 116, 104, 0, 65, 98, 114, 97, 0, 75, 97, 100, 97, 98, 114, 97, 0, 65, 108, 97, 107, 97, 122, 97, 109, 0, 77, 97, 99, 104, 111, 112, 0, 77, 97, 99, 104, 111, 107, 101, 0, 77, 97, 99, 104, 97, 109, 112, 0, 66, 101, 108, 108, 115, 112, 114, 111, 117, 116, 0, 87, 101, 101, 112, 105, 110, 98, 101, 108, 108, 0, 86, 105, 99, 116, 114, 101, 101, 98, 101, 108, 0, 84, 101, 110, 116, 97, 99, 111, 111, 108, 0, 84, 101, 110, 116, 97, 99, 114, 117, 101, 108, 0, 71, 101, 111, 100, 117, 100, 101, 0, 71, 114, 97, 118, 101, 108, 101, 114, 0, 71, 111, 108, 101, 109, 0, 80, 111, 110, 121, 116, 97, 0, 82, 97, 112, 105, 100, 97, 115, 104, 0, 83, 108, 111, 119, 112, 111, 107, 101, 0, 83, 108, 111, 119, 98, 114, 111, 0, 77, 97, 103, 110, 101, 109, 105, 116, 101, 0, 77, 97, 103, 110, 101, 116, 111, 110, 0, 70, 97, 114, 102, 101, 116, 99, 104, 226, 128, 153, 100, 0, 68, 111, 100, 117, 111, 0, 68, 111, 100, 114, 105, 111, 0, 83, 101, 101, 108, 0, 68, 101, 119, 103, 111, 110, 103, 0, 71, 114, 105, 109, 101, 114, 0, 77, 117, 107, 0, 83, 104, 101, 108, 108, 100, 101, 114, 0, 67, 108, 111, 121, 115, 116, 101, 114, 0, 71, 97, 115, 116, 108, 121, 0, 72, 97, 117, 110, 116, 101, 114, 0, 71, 101, 110, 103, 97, 114, 0, 79, 110, 105, 120, 0, 68, 114, 111, 119, 122, 101, 101, 0, 72, 121, 112, 110, 111, 0, 75, 114, 97, 98, 98, 121, 0, 75, 105, 110, 103, 108, 101, 114, 0, 86, 111, 108, 116, 111, 114, 98, 0, 69, 108, 101, 99, 116, 114, 111, 100, 101, 0, 69, 120, 101, 103, 103, 99, 117, 116, 101, 0, 69, 120, 101, 103, 103, 117, 116, 111, 114, 0, 67, 117, 98, 111, 110, 101, 0, 77, 97, 114, 111, 119, 97, 107, 0, 72, 105, 116, 109, 111, 110, 108, 101, 101, 0, 72, 105, 116, 109, 111, 110, 99, 104, 97, 110, 0, 76, 105, 99, 107, 105, 116, 117, 110, 103, 0, 75, 111, 102, 102, 105, 110, 103, 0, 87, 101, 101, 122, 105, 110, 103, 0, 82, 104, 121, 104, 111, 114, 110, 0, 82, 104, 121, 100, 111, 110, 0, 67, 104, 97, 110, 115, 101, 121, 0, 84, 97, 110, 103, 101, 108, 97, 0, 75, 97, 110, 103, 97, 115, 107, 104, 97, 110, 0, 72, 111, 114, 115, 101, 97, 0, 83, 101, 97, 100, 114, 97, 0, 71, 111, 108, 100, 101, 101, 110, 0, 83, 101, 97, 107, 105, 110, 103, 0, 83, 116, 97, 114, 121, 117, 0, 83, 116, 97, 114, 109, 105, 101, 0, 77, 114, 46, 32, 77, 105, 109, 101, 0, 83, 99, 121, 116, 104, 101, 114, 0, 74, 121, 110, 120, 0, 69, 108, 101, 99, 116, 97, 98, 117, 122, 122, 0, 77, 97, 103, 109, 97, 114, 0, 80, 105, 110, 115, 105, 114, 0, 84, 97, 117, 114, 111, 115, 0, 77, 97, 103, 105, 107, 97, 114, 112, 0, 71, 121, 97, 114, 97, 100, 111, 115, 0, 76, 97, 112, 114, 97, 115, 0, 68, 105, 116, 116, 111, 0, 69, 101, 118, 101, 101, 0, 86, 97, 112, 111, 114, 101, 111, 110, 0, 74, 111, 108, 116, 101, 111, 110, 0, 70, 108, 97, 114, 101, 111, 110, 0, 80, 111, 114, 121, 103, 111, 110, 0, 79, 109, 97, 110, 121, 116, 101, 0, 79, 109, 97, 115, 116, 97, 114, 0, 75, 97, 98, 117, 116, 111, 0, 75, 97, 98, 117, 116, 111, 112, 115, 0, 65, 101, 114, 111, 100, 97, 99, 116, 121, 108, 0, 83, 110, 111, 114, 108, 97, 120, 0, 65, 114, 116, 105, 99, 117, 110, 111, 0, 90, 97, 112, 100, 111, 115, 0, 77, 111, 108, 116, 114, 101, 115, 0, 68, 114, 97, 116, 105, 110, 105, 0, 68, 114, 97, 103, 111, 110, 97, 105, 114, 0, 68, 114, 97, 103, 111, 110, 105, 116, 101, 0, 77, 101, 119, 116, 119, 111, 0, 77, 101, 119, 0, 67, 104, 105, 107, 111, 114, 105, 116, 97, 0, 66, 97, 121, 108, 101, 101, 102, 0, 77, 101, 103, 97, 110, 105, 117, 109, 0, 67, 121, 110, 100, 97, 113, 117, 105, 108, 0, 81, 117, 105, 108, 97, 118, 97, 0, 84, 121, 112, 104, 108, 111, 115, 105, 111, 110, 0, 84, 111, 116, 111, 100, 105, 108, 101, 0, 67, 114, 111, 99, 111, 110, 97, 119, 0, 70, 101, 114, 97, 108, 105, 103, 97, 116, 114, 0, 83, 101, 110, 116, 114, 101, 116, 0, 70, 117, 114, 114, 101, 116, 0, 72, 111, 111, 116, 104, 111, 111, 116, 0, 78, 111, 99, 116, 111, 119, 108, 0, 76, 101, 100, 121, 98, 97, 0, 76, 101, 100, 105, 97, 110, 0, 83, 112, 105, 110, 97, 114, 97, 107, 0, 65, 114, 105, 97, 100, 111, 115, 0, 67, 114, 111, 98, 97, 116, 0, 67, 104, 105, 110, 99, 104, 111, 117, 0, 76, 97, 110, 116, 117, 114, 110, 0, 80, 105, 99, 104, 117, 0, 67, 108, 101, 102, 102, 97, 0, 73, 103, 103, 108, 121, 98, 117, 102, 102, 0, 84, 111, 103, 101, 112, 105, 0, 84, 111, 103, 101, 116, 105, 99, 0, 78, 97, 116, 117, 0, 88, 97, 116, 117, 0, 77, 97, 114, 101, 101, 112, 0, 70, 108, 97, 97, 102, 102, 121, 0, 65, 109, 112, 104, 97, 114, 111, 115, 0, 66, 101, 108, 108, 111, 115, 115, 111, 109, 0, 77, 97, 114, 105, 108, 108, 0, 65, 122, 117, 109, 97, 114, 105, 108, 108, 0, 83, 117, 100, 111, 119, 111, 111, 100, 111, 0, 80, 111, 108, 105, 116, 111, 101, 100, 0, 72, 111, 112, 112, 105, 112, 0, 83, 107, 105, 112, 108, 111, 111, 109, 0, 74, 117, 109, 112, 108, 117, 102, 102, 0, 65, 105, 112, 111, 109, 0, 83, 117, 110, 107, 101, 114, 110, 0, 83, 117, 110, 102, 108, 111, 114, 97, 0, 89, 97, 110, 109, 97, 0, 87, 111, 111, 112, 101, 114, 0, 81, 117, 97, 103, 115, 105, 114, 101, 0, 69, 115, 112, 101, 111, 110, 0, 85, 109, 98, 114, 101, 111, 110, 0, 77, 117, 114, 107, 114, 111, 119, 0, 83, 108, 111, 119, 107, 105, 110, 103, 0, 77, 105, 115, 100, 114, 101, 97, 118, 117, 115, 0, 85, 110, 111, 119, 110, 0, 87, 111, 98, 98, 117, 102, 102, 101, 116, 0, 71, 105, 114, 97, 102, 97, 114, 105, 103, 0, 80, 105, 110, 101, 99, 111, 0, 70, 111, 114, 114, 101, 116, 114, 101, 115, 115, 0, 68, 117, 110, 115, 112, 97, 114, 99, 101, 0, 71, 108, 105, 103, 97, 114, 0, 83, 116, 101, 101, 108, 105, 120, 0, 83, 110, 117, 98, 98, 117, 108, 108, 0, 71, 114, 97, 110, 98, 117, 108, 108, 0, 81, 119, 105, 108, 102, 105, 115, 104, 0, 83, 99, 105, 122, 111, 114, 0, 83, 104, 117, 99, 107, 108, 101, 0, 72, 101, 114, 97, 99, 114, 111, 115, 115, 0, 83, 110, 101, 97, 115, 101, 108, 0, 84, 101, 100, 100, 105, 117, 114, 115, 97, 0, 85, 114, 115, 97, 114, 105, 110, 103, 0, 83, 108, 117, 103, 109, 97, 0, 77, 97, 103, 99, 97, 114, 103, 111, 0, 83, 119, 105, 110, 117, 98, 0, 80, 105, 108, 111, 115, 119, 105, 110, 101, 0, 67, 111, 114, 115, 111, 108, 97, 0, 82, 101, 109, 111, 114, 97, 105, 100, 0, 79, 99, 116, 105, 108, 108, 101, 114, 121, 0, 68, 101, 108, 105, 98, 105, 114, 100, 0, 77, 97, 110, 116, 105, 110, 101, 0, 83, 107, 97, 114, 109, 111, 114, 121, 0, 72, 111, 117, 110, 100, 111, 117, 114, 0, 72, 111, 117, 110, 100, 111, 111, 109, 0, 75, 105, 110, 103, 100, 114, 97, 0, 80, 104, 97, 110, 112, 121, 0, 68, 111, 110, 112, 104, 97, 110, 0, 80, 111, 114, 121, 103, 111, 110, 50, 0, 83, 116, 97, 110, 116, 108, 101, 114, 0, 83, 109, 101, 97, 114, 103, 108, 101, 0, 84, 121, 114, 111, 103, 117, 101, 0, 72, 105, 116, 109, 111, 110, 116, 111, 112, 0, 83, 109, 111, 111, 99, 104, 117, 109, 0, 69, 108, 101, 107, 105, 100, 0, 77, 97, 103, 98, 121, 0, 77, 105, 108, 116, 97, 110, 107, 0, 66, 108, 105, 115, 115, 101, 121, 0, 82, 97, 105, 107, 111, 117, 0, 69, 110, 116, 101, 105, 0, 83, 117, 105, 99, 117, 110, 101, 0, 76, 97, 114, 118, 105, 116, 97, 114, 0, 80, 117, 112, 105, 116, 97, 114, 0, 84, 121, 114, 97, 110, 105, 116, 97, 114, 0, 76, 117, 103, 105, 97, 0, 72, 111, 45, 79, 104, 0, 67, 101, 108, 101, 98, 105, 0, 84, 114, 101, 101, 99, 107, 111, 0, 71, 114, 111, 118, 121, 108, 101, 0, 83, 99, 101, 112, 116, 105, 108, 101, 0, 84, 111, 114, 99, 104, 105, 99, 0, 67, 111, 109, 98, 117, 115, 107, 101, 110, 0, 66, 108, 97, 122, 105, 107, 101, 110, 0, 77, 117, 100, 107, 105, 112, 0, 77, 97, 114, 115, 104, 116, 111, 109, 112, 0, 83, 119, 97, 109, 112, 101, 114, 116, 0, 80, 111, 111, 99, 104, 121, 101, 110, 97, 0, 77, 105, 103, 104, 116, 121, 101, 110, 97, 0, 90, 105, 103, 122, 97, 103, 111, 111, 110, 0, 76, 105, 110, 111, 111, 110, 101, 0, 87, 117, 114, 109, 112, 108, 101, 0, 83, 105, 108, 99, 111, 111, 110, 0, 66, 101, 97, 117, 116, 105, 102, 108, 121, 0, 67, 97, 115, 99, 111, 111, 110, 0, 68, 117, 115, 116, 111, 120, 0, 76, 111, 116, 97, 100, 0, 76, 111, 109, 98, 114, 101, 0, 76, 117, 100, 105, 99, 111, 108, 111, 0, 83, 101, 101, 100, 111, 116, 0, 78, 117, 122, 108, 101, 97, 102, 0, 83, 104, 105, 102, 116, 114, 121, 0, 84, 97, 105, 108, 108, 111, 119, 0, 83, 119, 101, 108, 108, 111, 119, 0, 87, 105, 110, 103, 117, 108, 108, 0, 80, 101, 108, 105, 112, 112, 101, 114, 0, 82, 97, 108, 116, 115, 0, 75, 105, 114, 108, 105, 97, 0, 71, 97, 114, 100, 101, 118, 111, 105, 114, 0, 83, 117, 114, 115, 107, 105, 116, 0, 77, 97, 115, 113, 117, 101, 114, 97, 105, 110, 0, 83, 104, 114, 111, 111, 109, 105, 115, 104, 0, 66, 114, 101, 108, 111, 111, 109, 0, 83, 108, 97, 107, 111, 116, 104, 0, 86, 105, 103, 111, 114, 111, 116, 104, 0, 83, 108, 97, 107, 105, 110, 103, 0, 78, 105, 110, 99, 97, 100, 97, 0, 78, 105, 110, 106, 97, 115, 107, 0, 83, 104, 101, 100, 105, 110, 106, 97, 0, 87, 104, 105, 115, 109, 117, 114, 0, 76, 111, 117, 100, 114, 101, 100, 0, 69, 120, 112, 108, 111, 117, 100, 0, 77, 97, 107, 117, 104, 105, 116, 97, 0, 72, 97, 114, 105, 121, 97, 109, 97, 0, 65, 122, 117, 114, 105, 108, 108, 0, 78, 111, 115, 101, 112, 97, 115, 115, 0, 83, 107, 105, 116, 116, 121, 0, 68, 101, 108, 99, 97, 116, 116, 121, 0, 83, 97, 98, 108, 101, 121, 101, 0, 77, 97, 119, 105, 108, 101, 0, 65, 114, 111, 110, 0, 76, 97, 105, 114, 111, 110, 0, 65, 103, 103, 114, 111, 110, 0, 77, 101, 100, 105, 116, 105, 116, 101, 0, 77, 101, 100, 105, 99, 104, 97, 109, 0, 69, 108, 101, 99, 116, 114, 105, 107, 101, 0, 77, 97, 110, 101, 99, 116, 114, 105, 99, 0, 80, 108, 117, 115, 108, 101, 0, 77, 105, 110, 117, 110, 0, 86, 111, 108, 98, 101, 97, 116, 0, 73, 108, 108, 117, 109, 105, 115, 101, 0, 82, 111, 115, 101, 108, 105, 97, 0, 71, 117, 108, 112, 105, 110, 0, 83, 119, 97, 108, 111, 116, 0, 67, 97, 114, 118, 97, 110, 104, 97, 0, 83, 104, 97, 114, 112, 101, 100, 111, 0, 87, 97, 105, 108, 109, 101, 114, 0, 87, 97, 105, 108, 111, 114, 100, 0, 78, 117, 109, 101, 108, 0, 67, 97, 109, 101, 114, 117, 112, 116, 0, 84, 111, 114, 107, 111, 97, 108, 0, 83, 112, 111, 105, 110, 107, 0, 71, 114, 117, 109, 112, 105, 103, 0, 83, 112, 105, 110, 100, 97, 0, 84, 114, 97, 112, 105, 110, 99, 104, 0, 86, 105, 98, 114, 97, 118, 97, 0, 70, 108, 121, 103, 111, 110, 0, 67, 97, 99, 110, 101, 97, 0, 67, 97, 99, 116, 117, 114, 110, 101, 0, 83, 119, 97, 98, 108, 117, 0, 65, 108, 116, 97, 114, 105, 97, 0, 90, 97, 110, 103, 111, 111, 115, 101, 0, 83, 101, 118, 105, 112, 101, 114, 0, 76, 117, 110, 97, 116, 111, 110, 101, 0, 83, 111, 108, 114, 111, 99, 107, 0, 66, 97, 114, 98, 111, 97, 99, 104, 0, 87, 104, 105, 115, 99, 97, 115, 104, 0, 67, 111, 114, 112, 104, 105, 115, 104, 0, 67, 114, 97, 119, 100, 97, 117, 110, 116, 0, 66, 97, 108, 116, 111, 121, 0, 67, 108, 97, 121, 100, 111, 108, 0, 76, 105, 108, 101, 101, 112, 0, 67, 114, 97, 100, 105, 108, 121, 0, 65, 110, 111, 114, 105, 116, 104, 0, 65, 114, 109, 97, 108, 100, 111, 0, 70, 101, 101, 98, 97, 115, 0, 77, 105, 108, 111, 116, 105, 99, 0, 67, 97, 115, 116, 102, 111, 114, 109, 0, 75, 101, 99, 108, 101, 111, 110, 0, 83, 104, 117, 112, 112, 101, 116, 0, 66, 97, 110, 101, 116, 116, 101, 0, 68, 117, 115, 107, 117, 108, 108, 0, 68, 117, 115, 99, 108, 111, 112, 115, 0, 84, 114, 111, 112, 105, 117, 115, 0, 67, 104, 105, 109, 101, 99, 104, 111, 0, 65, 98, 115, 111, 108, 0, 87, 121, 110, 97, 117, 116, 0, 83, 110, 111, 114, 117, 110, 116, 0, 71, 108, 97, 108, 105, 101, 0, 83, 112, 104, 101, 97, 108, 0, 83, 101, 97, 108, 101, 111, 0, 87, 97, 108, 114, 101, 105, 110, 0, 67, 108, 97, 109, 112, 101, 114, 108, 0, 72, 117, 110, 116, 97, 105, 108, 0, 71, 111, 114, 101, 98, 121, 115, 115, 0, 82, 101, 108, 105, 99, 97, 110, 116, 104, 0, 76, 117, 118, 100, 105, 115, 99, 0, 66, 97, 103, 111, 110, 0, 83, 104, 101, 108, 103, 111, 110, 0, 83, 97, 108, 97, 109, 101, 110, 99, 101, 0, 66, 101, 108, 100, 117, 109, 0, 77, 101, 116, 97, 110, 103, 0, 77, 101, 116, 97, 103, 114, 111, 115, 115, 0, 82, 101, 103, 105, 114, 111, 99, 107, 0, 82, 101, 103, 105, 99, 101, 0, 82, 101, 103, 105, 115, 116, 101, 101, 108, 0, 76, 97, 116, 105, 97, 115, 0, 76, 97, 116, 105, 111, 115, 0, 75, 121, 111, 103, 114, 101, 0, 71, 114, 111, 117, 100, 111, 110, 0, 82, 97, 121, 113, 117, 97, 122, 97, 0, 74, 105, 114, 97, 99, 104, 105, 0, 68, 101, 111, 120, 121, 115, 0, 84, 117, 114, 116, 119, 105, 103, 0, 71, 114, 111, 116, 108, 101, 0, 84, 111, 114, 116, 101, 114, 114, 97, 0, 67, 104, 105, 109, 99, 104, 97, 114, 0, 77, 111, 110, 102, 101, 114, 110, 111, 0, 73, 110, 102, 101, 114, 110, 97, 112, 101, 0, 80, 105, 112, 108, 117, 112, 0, 80, 114, 105, 110, 112, 108, 117, 112, 0, 69, 109, 112, 111, 108, 101, 111, 110, 0, 83, 116, 97, 114, 108, 121, 0, 83, 116, 97, 114, 97, 118, 105, 97, 0, 83, 116, 97, 114, 97, 112, 116, 111, 114, 0, 66, 105, 100, 111, 111, 102, 0, 66, 105, 98, 97, 114, 101, 108, 0, 75, 114, 105, 99, 107, 101, 116, 111, 116, 0, 75, 114, 105, 99, 107, 101, 116, 117, 110, 101, 0, 83, 104, 105, 110, 120, 0, 76, 117, 120, 105, 111, 0, 76, 117, 120, 114, 97, 121, 0, 66, 117, 100, 101, 119, 0, 82, 111, 115, 101, 114, 97, 100, 101, 0, 67, 114, 97, 110, 105, 100, 111, 115, 0, 82, 97, 109, 112, 97, 114, 100, 111, 115, 0, 83, 104, 105, 101, 108, 100, 111, 110, 0, 66, 97, 115, 116, 105, 111, 100, 111, 110, 0, 66, 117, 114, 109, 121, 0, 87, 111, 114, 109, 97, 100, 97, 109, 0, 77, 111, 116, 104, 105, 109, 0, 67, 111, 109, 98, 101, 101, 0, 86, 101, 115, 112, 105, 113, 117, 101, 110, 0, 80, 97, 99, 104, 105, 114, 105, 115, 117, 0, 66, 117, 105, 122, 101, 108, 0, 70, 108, 111, 97, 116, 122, 101, 108, 0, 67, 104, 101, 114, 117, 98, 105, 0, 67, 104, 101, 114, 114, 105, 109, 0, 83, 104, 101, 108, 108, 111, 115, 0, 71, 97, 115, 116, 114, 111, 100, 111, 110, 0, 65, 109, 98, 105, 112, 111, 109, 0, 68, 114, 105, 102, 108, 111, 111, 110, 0, 68, 114, 105, 102, 98, 108, 105, 109, 0, 66, 117, 110, 101, 97, 114, 121, 0, 76, 111, 112, 117, 110, 110, 121, 0, 77, 105, 115, 109, 97, 103, 105, 117, 115, 0, 72, 111, 110, 99, 104, 107, 114, 111, 119, 0, 71, 108, 97, 109, 101, 111, 119, 0, 80, 117, 114, 117, 103, 108, 121, 0, 67, 104, 105, 110, 103, 108, 105, 110, 103, 0, 83, 116, 117, 110, 107, 121, 0, 83, 107, 117, 110, 116, 97, 110, 107, 0, 66, 114, 111, 110, 122, 111, 114, 0, 66, 114, 111, 110, 122, 111, 110, 103, 0, 66, 111, 110, 115, 108, 121, 0, 77, 105, 109, 101, 32, 74, 114, 46, 0, 72, 97, 112, 112, 105, 110, 121, 0, 67, 104, 97, 116, 111, 116, 0, 83, 112, 105, 114, 105, 116, 111, 109, 98, 0, 71, 105, 98, 108, 101, 0, 71, 97, 98, 105, 116, 101, 0, 71, 97, 114, 99, 104, 111, 109, 112, 0, 77, 117, 110, 99, 104, 108, 97, 120, 0, 82, 105, 111, 108, 117, 0, 76, 117, 99, 97, 114, 105, 111, 0, 72, 105, 112, 112, 111, 112, 111, 116, 97, 115, 0, 72, 105, 112, 112, 111, 119, 100, 111, 110, 0, 83, 107, 111, 114, 117, 112, 105, 0, 68, 114, 97, 112, 105, 111, 110, 0, 67, 114, 111, 97, 103, 117, 110, 107, 0, 84, 111, 120, 105, 99, 114, 111, 97, 107, 0, 67, 97, 114, 110, 105, 118, 105, 110, 101, 0, 70, 105, 110, 110, 101, 111, 110, 0, 76, 117, 109, 105, 110, 101, 111, 110, 0, 77, 97, 110, 116, 121, 107, 101, 0, 83, 110, 111, 118, 101, 114, 0, 65, 98, 111, 109, 97, 115, 110, 111, 119, 0, 87, 101, 97, 118, 105, 108, 101, 0, 77, 97, 103, 110, 101, 122, 111, 110, 101, 0, 76, 105, 99, 107, 105, 108, 105, 99, 107, 121, 0, 82, 104, 121, 112, 101, 114, 105, 111, 114, 0, 84, 97, 110, 103, 114, 111, 119, 116, 104, 0, 69, 108, 101, 99, 116, 105, 118, 105, 114, 101, 0, 77, 97, 103, 109, 111, 114, 116, 97, 114, 0, 84, 111, 103, 101, 107, 105, 115, 115, 0, 89, 97, 110, 109, 101, 103, 97, 0, 76, 101, 97, 102, 101, 111, 110, 0, 71, 108, 97, 99, 101, 111, 110, 0, 71, 108, 105, 115, 99, 111, 114, 0, 77, 97, 109, 111, 115, 119, 105, 110, 101, 0, 80, 111, 114, 121, 103, 111, 110, 45, 90, 0, 71, 97, 108, 108, 97, 100, 101, 0, 80, 114, 111, 98, 111, 112, 97, 115, 115, 0, 68, 117, 115, 107, 110, 111, 105, 114, 0, 70, 114, 111, 115, 108, 97, 115, 115, 0, 82, 111, 116, 111, 109, 0, 85, 120, 105, 101, 0, 77, 101, 115, 112, 114, 105, 116, 0, 65, 122, 101, 108, 102, 0, 68, 105, 97, 108, 103, 97, 0, 80, 97, 108, 107, 105, 97, 0, 72, 101, 97, 116, 114, 97, 110, 0, 82, 101, 103, 105, 103, 105, 103, 97, 115, 0, 71, 105, 114, 97, 116, 105, 110, 97, 0, 67, 114, 101, 115, 115, 101, 108, 105, 97, 0, 80, 104, 105, 111, 110, 101, 0, 77, 97, 110, 97, 112, 104, 121, 0, 68, 97, 114, 107, 114, 97, 105, 0, 83, 104, 97, 121, 109, 105, 110, 0, 65, 114, 99, 101, 117, 115, 0, 86, 105, 99, 116, 105, 110, 105, 0, 83, 110, 105, 118, 121, 0, 83, 101, 114, 118, 105, 110, 101, 0, 83, 101, 114, 112, 101, 114, 105, 111, 114, 0, 84, 101, 112, 105, 103, 0, 80, 105, 103, 110, 105, 116, 101, 0, 69, 109, 98, 111, 97, 114, 0, 79, 115, 104, 97, 119, 111, 116, 116, 0, 68, 101, 119, 111, 116, 116, 0, 83, 97, 109, 117, 114, 111, 116, 116, 0, 80, 97, 116, 114, 97, 116, 0, 87, 97, 116, 99, 104, 111, 103, 0, 76, 105, 108, 108, 105, 112, 117, 112, 0, 72, 101, 114, 100, 105, 101, 114, 0, 83, 116, 111, 117, 116, 108, 97, 110, 100, 0, 80, 117, 114, 114, 108, 111, 105, 110, 0, 76, 105, 101, 112, 97, 114, 100, 0, 80, 97, 110, 115, 97, 103, 101, 0, 83, 105, 109, 105, 115, 97, 103, 101, 0, 80, 97, 110, 115, 101, 97, 114, 0, 83, 105, 109, 105, 115, 101, 97, 114, 0, 80, 97, 110, 112, 111, 117, 114, 0, 83, 105, 109, 105, 112, 111, 117, 114, 0, 77, 117, 110, 110, 97, 0, 77, 117, 115, 104, 97, 114, 110, 97, 0, 80, 105, 100, 111, 118, 101, 0, 84, 114, 97, 110, 113, 117, 105, 108, 108, 0, 85, 110, 102, 101, 122, 97, 110, 116, 0, 66, 108, 105, 116, 122, 108, 101, 0, 90, 101, 98, 115, 116, 114, 105, 107, 97, 0, 82, 111, 103, 103, 101, 110, 114, 111, 108, 97, 0, 66, 111, 108, 100, 111, 114, 101, 0, 71, 105, 103, 97, 108, 105, 116, 104, 0, 87, 111, 111, 98, 97, 116, 0, 83, 119, 111, 111, 98, 97, 116, 0, 68, 114, 105, 108, 98, 117, 114, 0, 69, 120, 99, 97, 100, 114, 105, 108, 108, 0, 65, 117, 100, 105, 110, 111, 0, 84, 105, 109, 98, 117, 114, 114, 0, 71, 117, 114, 100, 117, 114, 114, 0, 67, 111, 110, 107, 101, 108, 100, 117, 114, 114, 0, 84, 121, 109, 112, 111, 108, 101, 0, 80, 97, 108, 112, 105, 116, 111, 97, 100, 0, 83, 101, 105, 115, 109, 105, 116, 111, 97, 100, 0, 84, 104, 114, 111, 104, 0, 83, 97, 119, 107, 0, 83, 101, 119, 97, 100, 100, 108, 101, 0, 83, 119, 97, 100, 108, 111, 111, 110, 0, 76, 101, 97, 118, 97, 110, 110, 121, 0, 86, 101, 110, 105, 112, 101, 100, 101, 0, 87, 104, 105, 114, 108, 105, 112, 101, 100, 101, 0, 83, 99, 111, 108, 105, 112, 101, 100, 101, 0, 67, 111, 116, 116, 111, 110, 101, 101, 0, 87, 104, 105, 109, 115, 105, 99, 111, 116, 116, 0, 80, 101, 116, 105, 108, 105, 108, 0, 76, 105, 108, 108, 105, 103, 97, 110, 116, 0, 66, 97, 115, 99, 117, 108, 105, 110, 0, 83, 97, 110, 100, 105, 108, 101, 0, 75, 114, 111, 107, 111, 114, 111, 107, 0, 75, 114, 111, 111, 107, 111, 100, 105, 108, 101, 0, 68, 97, 114, 117, 109, 97, 107, 97, 0, 68, 97, 114, 109, 97, 110, 105, 116, 97, 110, 0, 77, 97, 114, 97, 99, 116, 117, 115, 0, 68, 119, 101, 98, 98, 108, 101, 0, 67, 114, 117, 115, 116, 108, 101, 0, 83, 99, 114, 97, 103, 103, 121, 0, 83, 99, 114, 97, 102, 116, 121, 0, 83, 105, 103, 105, 108, 121, 112, 104, 0, 89, 97, 109, 97, 115, 107, 0, 67, 111, 102, 97, 103, 114, 105, 103, 117, 115, 0, 84, 105, 114, 116, 111, 117, 103, 97, 0, 67, 97, 114, 114, 97, 99, 111, 115, 116, 97, 0, 65, 114, 99, 104, 101, 110, 0, 65, 114, 99, 104, 101, 111, 112, 115, 0, 84, 114, 117, 98, 98, 105, 115, 104, 0, 71, 97, 114, 98, 111, 100, 111, 114, 0, 90, 111, 114, 117, 97, 0, 90, 111, 114, 111, 97, 114, 107, 0, 77, 105, 110, 99, 99, 105, 110, 111, 0, 67, 105, 110, 99, 99, 105, 110, 111, 0, 71, 111, 116, 104, 105, 116, 97, 0, 71, 111, 116, 104, 111, 114, 105, 116, 97, 0, 71, 111, 116, 104, 105, 116, 101, 108, 108, 101, 0, 83, 111, 108, 111, 115, 105, 115, 0, 68, 117, 111, 115, 105, 111, 110, 0, 82, 101, 117, 110, 105, 99, 108, 117, 115, 0, 68, 117, 99, 107, 108, 101, 116, 116, 0, 83, 119, 97, 110, 110, 97, 0, 86, 97, 110, 105, 108, 108, 105, 116, 101, 0, 86, 97, 110, 105, 108, 108, 105, 115, 104, 0, 86, 97, 110, 105, 108, 108, 117, 120, 101, 0, 68, 101, 101, 114, 108, 105, 110, 103, 0, 83, 97, 119, 115, 98, 117, 99, 107, 0, 69, 109, 111, 108, 103, 97, 0, 75, 97, 114, 114, 97, 98, 108, 97, 115, 116, 0, 69, 115, 99, 97, 118, 97, 108, 105, 101, 114, 0, 70, 111, 111, 110, 103, 117, 115, 0, 65, 109, 111, 111, 110, 103, 117, 115, 115, 0, 70, 114, 105, 108, 108, 105, 115, 104, 0, 74, 101, 108, 108, 105, 99, 101, 110, 116, 0, 65, 108, 111, 109, 111, 109, 111, 108, 97, 0, 74, 111, 108, 116, 105, 107, 0, 71, 97, 108, 118, 97, 110, 116, 117, 108, 97, 0, 70, 101, 114, 114, 111, 115, 101, 101, 100, 0, 70, 101, 114, 114, 111, 116, 104, 111, 114, 110, 0, 75, 108, 105, 110, 107, 0, 75, 108, 97, 110, 103, 0, 75, 108, 105, 110, 107, 108, 97, 110, 103, 0, 84, 121, 110, 97, 109, 111, 0, 69, 101, 108, 101, 107, 116, 114, 105, 107, 0, 69, 101, 108, 101, 107, 116, 114, 111, 115, 115, 0, 69, 108, 103, 121, 101, 109, 0, 66, 101, 104, 101, 101, 121, 101, 109, 0, 76, 105, 116, 119, 105, 99, 107, 0, 76, 97, 109, 112, 101, 110, 116, 0, 67, 104, 97, 110, 100, 101, 108, 117, 114, 101, 0, 65, 120, 101, 119, 0, 70, 114, 97, 120, 117, 114, 101, 0, 72, 97, 120, 111, 114, 117, 115, 0, 67, 117, 98, 99, 104, 111, 111, 0, 66, 101, 97, 114, 116, 105, 99, 0, 67, 114, 121, 111, 103, 111, 110, 97, 108, 0, 83, 104, 101, 108, 109, 101, 116, 0, 65, 99, 99, 101, 108, 103, 111, 114, 0, 83, 116, 117, 110, 102, 105, 115, 107, 0, 77, 105, 101, 110, 102, 111, 111, 0, 77, 105, 101, 110, 115, 104, 97, 111, 0, 68, 114, 117, 100, 100, 105, 103, 111, 110, 0, 71, 111, 108, 101, 116, 116, 0, 71, 111, 108, 117, 114, 107, 0, 80, 97, 119, 110, 105, 97, 114, 100, 0, 66, 105, 115, 104, 97, 114, 112, 0, 66, 111, 117, 102, 102, 97, 108, 97, 110, 116, 0, 82, 117, 102, 102, 108, 101, 116, 0, 66, 114, 97, 118, 105, 97, 114, 121, 0, 86, 117, 108, 108, 97, 98, 121, 0, 77, 97, 110, 100, 105, 98, 117, 122, 122, 0, 72, 101, 97, 116, 109, 111, 114, 0, 68, 117, 114, 97, 110, 116, 0, 68, 101, 105, 110, 111, 0, 90, 119, 101, 105, 108, 111, 117, 115, 0, 72, 121, 100, 114, 101, 105, 103, 111, 110, 0, 76, 97, 114, 118, 101, 115, 116, 97, 0, 86, 111, 108, 99, 97, 114, 111, 110, 97, 0, 67, 111, 98, 97, 108, 105, 111, 110, 0, 84, 101, 114, 114, 97, 107, 105, 111, 110, 0, 86, 105, 114, 105, 122, 105, 111, 110, 0, 84, 111, 114, 110, 97, 100, 117, 115, 0, 84, 104, 117, 110, 100, 117, 114, 117, 115, 0, 82, 101, 115, 104, 105, 114, 97, 109, 0, 90, 101, 107, 114, 111, 109, 0, 76, 97, 110, 100, 111, 114, 117, 115, 0, 75, 121, 117, 114, 101, 109, 0, 75, 101, 108, 100, 101, 111, 0, 77, 101, 108, 111, 101, 116, 116, 97, 0, 71, 101, 110, 101, 115, 101, 99, 116, 0, 67, 104, 101, 115, 112, 105, 110, 0, 81, 117, 105, 108, 108, 97, 100, 105, 110, 0, 67, 104, 101, 115, 110, 97, 117, 103, 104, 116, 0, 70, 101, 110, 110, 101, 107, 105, 110, 0, 66, 114, 97, 105, 120, 101, 110, 0, 68, 101, 108, 112, 104, 111, 120, 0, 70, 114, 111, 97, 107, 105, 101, 0, 70, 114, 111, 103, 97, 100, 105, 101, 114, 0, 71, 114, 101, 110, 105, 110, 106, 97, 0, 66, 117, 110, 110, 101, 108, 98, 121, 0, 68, 105, 103, 103, 101, 114, 115, 98, 121, 0, 70, 108, 101, 116, 99, 104, 108, 105, 110, 103, 0, 70, 108, 101, 116, 99, 104, 105, 110, 100, 101, 114, 0, 84, 97, 108, 111, 110, 102, 108, 97, 109, 101, 0, 83, 99, 97, 116, 116, 101, 114, 98, 117, 103, 0, 83, 112, 101, 119, 112, 97, 0, 86, 105, 118, 105, 108, 108, 111, 110, 0, 76, 105, 116, 108, 101, 111, 0, 80, 121, 114, 111, 97, 114, 0, 70, 108, 97, 98, 195, 169, 98, 195, 169, 0, 70, 108, 111, 101, 116, 116, 101, 0, 70, 108, 111, 114, 103, 101, 115, 0, 83, 107, 105, 100, 100, 111, 0, 71, 111, 103, 111, 97, 116, 0, 80, 97, 110, 99, 104, 97, 109, 0, 80, 97, 110, 103, 111, 114, 111, 0, 70, 117, 114, 102, 114, 111, 117, 0, 69, 115, 112, 117, 114, 114, 0, 77, 101, 111, 119, 115, 116, 105, 99, 0, 72, 111, 110, 101, 100, 103, 101, 0, 68, 111, 117, 98, 108, 97, 100, 101, 0, 65, 101, 103, 105, 115, 108, 97, 115, 104, 0, 83, 112, 114, 105, 116, 122, 101, 101, 0, 65, 114, 111, 109, 97, 116, 105, 115, 115, 101, 0, 83, 119, 105, 114, 108, 105, 120, 0, 83, 108, 117, 114, 112, 117, 102, 102, 0, 73, 110, 107, 97, 121, 0, 77, 97, 108, 97, 109, 97, 114, 0, 66, 105, 110, 97, 99, 108, 101, 0, 66, 97, 114, 98, 97, 114, 97, 99, 108, 101, 0, 83, 107, 114, 101, 108, 112, 0, 68, 114, 97, 103, 97, 108, 103, 101, 0, 67, 108, 97, 117, 110, 99, 104, 101, 114, 0, 67, 108, 97, 119, 105, 116, 122, 101, 114, 0, 72, 101, 108, 105, 111, 112, 116, 105, 108, 101, 0, 72, 101, 108, 105, 111, 108, 105, 115, 107, 0, 84, 121, 114, 117, 110, 116, 0, 84, 121, 114, 97, 110, 116, 114, 117, 109, 0, 65, 109, 97, 117, 114, 97, 0, 65, 117, 114, 111, 114, 117, 115, 0, 83, 121, 108, 118, 101, 111, 110, 0, 72, 97, 119, 108, 117, 99, 104, 97, 0, 68, 101, 100, 101, 110, 110, 101, 0, 67, 97, 114, 98, 105, 110, 107, 0, 71, 111, 111, 109, 121, 0, 83, 108, 105, 103, 103, 111, 111, 0, 71, 111, 111, 100, 114, 97, 0, 75, 108, 101, 102, 107, 105, 0, 80, 104, 97, 110, 116, 117, 109, 112, 0, 84, 114, 101, 118, 101, 110, 97, 110, 116, 0, 80, 117, 109, 112, 107, 97, 98, 111, 111, 0, 71, 111, 117, 114, 103, 101, 105, 115, 116, 0, 66, 101, 114, 103, 109, 105, 116, 101, 0, 65, 118, 97, 108, 117, 103, 103, 0, 78, 111, 105, 98, 97, 116, 0, 78, 111, 105, 118, 101, 114, 110, 0, 88, 101, 114, 110, 101, 97, 115, 0, 89, 118, 101, 108, 116, 97, 108, 0, 90, 121, 103, 97, 114, 100, 101, 0, 68, 105, 97, 110, 99, 105, 101, 0, 72, 111, 111, 112, 97, 0, 86, 111, 108, 99, 97, 110, 105, 111, 110, 0, 82, 111, 119, 108, 101, 116, 0, 68, 97, 114, 116, 114, 105, 120, 0, 68, 101, 99, 105, 100, 117, 101, 121, 101, 0, 76, 105, 116, 116, 101, 110, 0, 84, 111, 114, 114, 97, 99, 97, 116, 0, 73, 110, 99, 105, 110, 101, 114, 111, 97, 114, 0, 80, 111, 112, 112, 108, 105, 111, 0, 66, 114, 105, 111, 110, 110, 101, 0, 80, 114, 105, 109, 97, 114, 105, 110, 97, 0, 80, 105, 107, 105, 112, 101, 107, 0, 84, 114, 117, 109, 98, 101, 97, 107, 0, 84, 111, 117, 99, 97, 110, 110, 111, 110, 0, 89, 117, 110, 103, 111, 111, 115, 0, 71, 117, 109, 115, 104, 111, 111, 115, 0, 71, 114, 117, 98, 98, 105, 110, 0, 67, 104, 97, 114, 106, 97, 98, 117, 103, 0, 86, 105, 107, 97, 118, 111, 108, 116, 0, 67, 114, 97, 98, 114, 97, 119, 108, 101, 114, 0, 67, 114, 97, 98, 111, 109, 105, 110, 97, 98, 108, 101, 0, 79, 114, 105, 99, 111, 114, 105, 111, 0, 67, 117, 116, 105, 101, 102, 108, 121, 0, 82, 105, 98, 111, 109, 98, 101, 101, 0, 82, 111, 99, 107, 114, 117, 102, 102, 0, 76, 121, 99, 97, 110, 114, 111, 99, 0, 87, 105, 115, 104, 105, 119, 97, 115, 104, 105, 0, 77, 97, 114, 101, 97, 110, 105, 101, 0, 84, 111, 120, 97, 112, 101, 120, 0, 77, 117, 100, 98, 114, 97, 121, 0, 77, 117, 100, 115, 100, 97, 108, 101, 0, 68, 101, 119, 112, 105, 100, 101, 114, 0, 65, 114, 97, 113, 117, 97, 110, 105, 100, 0, 70, 111, 109, 97, 110, 116, 105, 115, 0, 76, 117, 114, 97, 110, 116, 105, 115, 0, 77, 111, 114, 101, 108, 117, 108, 108, 0, 83, 104, 105, 105, 110, 111, 116, 105, 99, 0, 83, 97, 108, 97, 110, 100, 105, 116, 0, 83, 97, 108, 97, 122, 122, 108, 101, 0, 83, 116, 117, 102, 102, 117, 108, 0, 66, 101, 119, 101, 97, 114, 0, 66, 111, 117, 110, 115, 119, 101, 101, 116, 0, 83, 116, 101, 101, 110, 101, 101, 0, 84, 115, 97, 114, 101, 101, 110, 97, 0, 67, 111, 109, 102, 101, 121, 0, 79, 114, 97, 110, 103, 117, 114, 117, 0, 80, 97, 115, 115, 105, 109, 105, 97, 110, 0, 87, 105, 109, 112, 111, 100, 0, 71, 111, 108, 105, 115, 111, 112, 111, 100, 0, 83, 97, 110, 100, 121, 103, 97, 115, 116, 0, 80, 97, 108, 111, 115, 115, 97, 110, 100, 0, 80, 121, 117, 107, 117, 109, 117, 107, 117, 0, 84, 121, 112, 101, 58, 32, 78, 117, 108, 108, 0, 83, 105, 108, 118, 97, 108, 108, 121, 0, 77, 105, 110, 105, 111, 114, 0, 75, 111, 109, 97, 108, 97, 0, 84, 117, 114, 116, 111, 110, 97, 116, 111, 114, 0, 84, 111, 103, 101, 100, 101, 109, 97, 114, 117, 0, 77, 105, 109, 105, 107, 121, 117, 0, 66, 114, 117, 120, 105, 115, 104, 0, 68, 114, 97, 109, 112, 97, 0, 68, 104, 101, 108, 109, 105, 115, 101, 0, 74, 97, 110, 103, 109, 111, 45, 111, 0, 72, 97, 107, 97, 109, 111, 45, 111, 0, 75, 111, 109, 109, 111, 45, 111, 0, 84, 97, 112, 117, 32, 75, 111, 107, 111, 0, 84, 97, 112, 117, 32, 76, 101, 108, 101, 0, 84, 97, 112, 117, 32, 66, 117, 108, 117, 0, 84, 97, 112, 117, 32, 70, 105, 110, 105, 0, 67, 111, 115, 109, 111, 103, 0, 67, 111, 115, 109, 111, 101, 109, 0, 83, 111, 108, 103, 97, 108, 101, 111, 0, 76, 117, 110, 97, 108, 97, 0, 78, 105, 104, 105, 108, 101, 103, 111, 0, 66, 117, 122, 122, 119, 111, 108, 101, 0, 80, 104, 101, 114, 111, 109, 111, 115, 97, 0, 88, 117, 114, 107, 105, 116, 114, 101, 101, 0, 67, 101, 108, 101, 115, 116, 101, 101, 108, 97, 0, 75, 97, 114, 116, 97, 110, 97, 0, 71, 117, 122, 122, 108, 111, 114, 100, 0, 78, 101, 99, 114, 111, 122, 109, 97, 0, 77, 97, 103, 101, 97, 114, 110, 97, 0, 77, 97, 114, 115, 104, 97, 100, 111, 119, 0, 80, 111, 105, 112, 111, 108, 101, 0, 78, 97, 103, 97, 110, 97, 100, 101, 108, 0, 83, 116, 97, 107, 97, 116, 97, 107, 97, 0, 66, 108, 97, 99, 101, 112, 104, 97, 108, 111, 110, 0, 90, 101, 114, 97, 111, 114, 97, 0 };
-
-constexpr std::array<u8, 541> characteristic_es = { 78, 105, 110, 103, 117, 110, 111, 0, 76, 101, 32, 101, 110, 99, 97, 110, 116, 97, 32, 99, 111, 109, 101, 114, 0, 65, 32, 109, 101, 110, 117, 100, 111, 32, 115, 101, 32, 100, 117, 101, 114, 109, 101, 0, 68, 117, 101, 114, 109, 101, 32, 109, 117, 99, 104, 111, 0, 83, 117, 101, 108, 101, 32, 100, 101, 115, 111, 114, 100, 101, 110, 97, 114, 32, 99, 111, 115, 97, 115, 0, 76, 101, 32, 103, 117, 115, 116, 97, 32, 114, 101, 108, 97, 106, 97, 114, 115, 101, 0, 79, 114, 103, 117, 108, 108, 111, 115, 111, 32, 100, 101, 32, 115, 117, 32, 102, 117, 101, 114, 122, 97, 0, 76, 101, 32, 103, 117, 115, 116, 97, 32, 114, 101, 118, 111, 108, 118, 101, 114, 115, 101, 0, 65, 32, 118, 101, 99, 101, 115, 32, 115, 101, 32, 101, 110, 102, 97, 100, 97, 0, 76, 101, 32, 103, 117, 115, 116, 97, 32, 108, 117, 99, 104, 97, 114, 0, 84, 105, 101, 110, 101, 32, 109, 97, 108, 32, 103, 101, 110, 105, 111, 0, 67, 117, 101, 114, 112, 111, 32, 114, 101, 115, 105, 115, 116, 101, 110, 116, 101, 0, 69, 115, 32, 98, 117, 101, 110, 32, 102, 97, 106, 97, 100, 111, 114, 0, 77, 117, 121, 32, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 101, 0, 77, 117, 121, 32, 114, 101, 115, 105, 115, 116, 101, 110, 116, 101, 0, 77, 117, 121, 32, 112, 101, 114, 115, 101, 118, 101, 114, 97, 110, 116, 101, 0, 76, 101, 32, 103, 117, 115, 116, 97, 32, 99, 111, 114, 114, 101, 114, 0, 83, 105, 101, 109, 112, 114, 101, 32, 116, 105, 101, 110, 101, 32, 101, 108, 32, 111, 195, 173, 100, 111, 32, 97, 108, 101, 114, 116, 97, 0, 73, 109, 112, 101, 116, 117, 111, 115, 111, 32, 121, 32, 98, 111, 98, 111, 0, 69, 115, 32, 117, 110, 32, 112, 111, 99, 111, 32, 112, 97, 121, 97, 115, 111, 0, 72, 117, 121, 101, 32, 114, 195, 161, 112, 105, 100, 111, 0, 69, 120, 116, 114, 101, 109, 97, 100, 97, 109, 101, 110, 116, 101, 32, 99, 117, 114, 105, 111, 115, 111, 0, 76, 101, 32, 103, 117, 115, 116, 97, 32, 104, 97, 99, 101, 114, 32, 116, 114, 97, 118, 101, 115, 117, 114, 97, 115, 0, 77, 117, 121, 32, 97, 115, 116, 117, 116, 111, 0, 65, 32, 109, 101, 110, 117, 100, 111, 32, 101, 115, 116, 195, 161, 32, 101, 110, 32, 66, 97, 98, 105, 97, 0, 77, 117, 121, 32, 109, 101, 108, 105, 110, 100, 114, 111, 115, 111, 0, 86, 111, 108, 117, 110, 116, 97, 114, 105, 111, 115, 111, 0, 69, 115, 32, 97, 108, 103, 111, 32, 111, 114, 103, 117, 108, 108, 111, 115, 111, 0, 77, 117, 121, 32, 105, 110, 115, 111, 108, 101, 110, 116, 101, 0, 79, 100, 105, 97, 32, 112, 101, 114, 100, 101, 114, 0, 85, 110, 32, 112, 111, 99, 111, 32, 99, 97, 98, 101, 122, 111, 116, 97, 0 };
-
-constexpr std::array<u8, 2488> dppt_es = { 48, 44, 67, 105, 117, 100, 97, 100, 32, 67, 97, 110, 97, 108, 0, 49, 44, 67, 105, 117, 100, 97, 100, 32, 86, 101, 116, 117, 115, 116, 97, 0, 50, 44, 67, 105, 117, 100, 97, 100, 32, 80, 114, 97, 100, 101, 114, 97, 0, 51, 44, 67, 105, 117, 100, 97, 100, 32, 77, 97, 114, 105, 110, 97, 0, 52, 44, 76, 105, 103, 97, 32, 80, 111, 107, 195, 169, 109, 111, 110, 0, 53, 44, 77, 105, 110, 97, 32, 80, 105, 114, 105, 116, 97, 32, 80, 114, 105, 109, 101, 114, 32, 112, 105, 115, 111, 0, 54, 44, 77, 105, 110, 97, 32, 80, 105, 114, 105, 116, 97, 32, 83, 195, 179, 116, 97, 110, 111, 0, 55, 44, 86, 97, 108, 108, 101, 32, 69, 195, 179, 108, 105, 99, 111, 0, 56, 44, 66, 111, 115, 113, 117, 101, 32, 86, 101, 116, 117, 115, 116, 111, 0, 57, 44, 70, 111, 114, 106, 97, 32, 70, 117, 101, 103, 111, 0, 49, 48, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 40, 69, 110, 116, 114, 97, 100, 97, 32, 82, 117, 116, 97, 32, 50, 48, 55, 47, 50, 48, 56, 41, 0, 49, 49, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 80, 114, 105, 109, 101, 114, 32, 112, 105, 115, 111, 0, 49, 50, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 83, 101, 103, 117, 110, 100, 111, 32, 112, 105, 115, 111, 0, 49, 51, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 69, 110, 32, 101, 108, 32, 101, 120, 116, 101, 114, 105, 111, 114, 32, 40, 122, 111, 110, 97, 32, 100, 101, 32, 110, 105, 101, 118, 101, 41, 0, 49, 52, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 84, 101, 114, 99, 101, 114, 32, 112, 105, 115, 111, 0, 49, 53, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 67, 117, 97, 114, 116, 111, 32, 112, 105, 115, 111, 0, 49, 54, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 81, 117, 105, 110, 116, 111, 32, 112, 105, 115, 111, 0, 49, 55, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 83, 101, 120, 116, 111, 32, 112, 105, 115, 111, 0, 49, 56, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 69, 120, 116, 101, 114, 105, 111, 114, 0, 49, 57, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 40, 69, 110, 116, 114, 97, 100, 97, 32, 82, 117, 116, 97, 32, 50, 49, 54, 41, 0, 50, 48, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 40, 69, 110, 116, 114, 97, 100, 97, 32, 82, 117, 116, 97, 32, 50, 49, 49, 41, 0, 50, 49, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 83, 195, 179, 116, 97, 110, 111, 0, 50, 50, 44, 71, 114, 97, 110, 32, 80, 97, 110, 116, 97, 110, 111, 32, 90, 111, 110, 97, 32, 49, 0, 50, 51, 44, 71, 114, 97, 110, 32, 80, 97, 110, 116, 97, 110, 111, 32, 90, 111, 110, 97, 32, 50, 0, 50, 52, 44, 71, 114, 97, 110, 32, 80, 97, 110, 116, 97, 110, 111, 32, 90, 111, 110, 97, 32, 51, 0, 50, 53, 44, 71, 114, 97, 110, 32, 80, 97, 110, 116, 97, 110, 111, 32, 90, 111, 110, 97, 32, 52, 0, 50, 54, 44, 71, 114, 97, 110, 32, 80, 97, 110, 116, 97, 110, 111, 32, 90, 111, 110, 97, 32, 53, 0, 50, 55, 44, 71, 114, 97, 110, 32, 80, 97, 110, 116, 97, 110, 111, 32, 90, 111, 110, 97, 32, 54, 0, 50, 56, 44, 82, 117, 105, 110, 97, 115, 32, 83, 111, 115, 105, 101, 103, 111, 0, 50, 57, 44, 67, 97, 108, 108, 101, 32, 86, 105, 99, 116, 111, 114, 105, 97, 32, 69, 110, 116, 114, 97, 100, 97, 0, 51, 48, 44, 67, 97, 108, 108, 101, 32, 86, 105, 99, 116, 111, 114, 105, 97, 32, 80, 105, 115, 111, 32, 49, 0, 51, 49, 44, 67, 97, 108, 108, 101, 32, 86, 105, 99, 116, 111, 114, 105, 97, 32, 83, 195, 179, 116, 97, 110, 111, 0, 51, 50, 44, 67, 97, 108, 108, 101, 32, 86, 105, 99, 116, 111, 114, 105, 97, 32, 69, 110, 116, 114, 97, 100, 97, 32, 97, 108, 32, 115, 195, 179, 116, 97, 110, 111, 32, 112, 114, 111, 102, 117, 110, 100, 111, 0, 51, 51, 44, 67, 97, 108, 108, 101, 32, 86, 105, 99, 116, 111, 114, 105, 97, 32, 83, 195, 179, 116, 97, 110, 111, 32, 112, 114, 111, 102, 117, 110, 100, 111, 0, 51, 52, 44, 67, 97, 108, 108, 101, 32, 86, 105, 99, 116, 111, 114, 105, 97, 32, 83, 97, 108, 105, 100, 97, 32, 100, 101, 108, 32, 115, 195, 179, 116, 97, 110, 111, 32, 112, 114, 111, 102, 117, 110, 100, 111, 0, 51, 53, 44, 83, 101, 110, 100, 97, 32, 68, 101, 115, 111, 108, 97, 100, 97, 0, 51, 54, 44, 80, 117, 101, 114, 116, 97, 32, 80, 105, 114, 105, 116, 97, 32, 80, 114, 105, 109, 101, 114, 32, 112, 105, 115, 111, 0, 51, 55, 44, 80, 117, 101, 114, 116, 97, 32, 80, 105, 114, 105, 116, 97, 32, 83, 195, 179, 116, 97, 110, 111, 0, 51, 56, 44, 77, 111, 110, 116, 97, 195, 177, 97, 32, 68, 117, 114, 97, 0, 51, 57, 44, 77, 111, 110, 116, 97, 195, 177, 97, 32, 68, 117, 114, 97, 32, 69, 110, 116, 114, 97, 100, 97, 0, 52, 48, 44, 77, 111, 110, 116, 97, 195, 177, 97, 32, 68, 117, 114, 97, 32, 73, 110, 116, 101, 114, 105, 111, 114, 0, 52, 49, 44, 70, 117, 101, 110, 116, 101, 32, 68, 101, 115, 112, 101, 100, 105, 100, 97, 0, 52, 50, 44, 67, 117, 101, 118, 97, 32, 82, 101, 116, 111, 114, 110, 111, 32, 69, 110, 116, 114, 97, 100, 97, 0, 52, 51, 44, 67, 117, 101, 118, 97, 32, 82, 101, 116, 111, 114, 110, 111, 32, 80, 114, 105, 109, 101, 114, 32, 80, 105, 108, 97, 114, 0, 52, 52, 44, 67, 117, 101, 118, 97, 32, 82, 101, 116, 111, 114, 110, 111, 32, 83, 101, 103, 117, 110, 100, 111, 32, 80, 105, 108, 97, 114, 0, 52, 53, 44, 84, 101, 109, 112, 108, 111, 32, 80, 117, 110, 116, 97, 110, 101, 118, 97, 32, 83, 97, 108, 97, 32, 49, 0, 52, 54, 44, 84, 101, 109, 112, 108, 111, 32, 80, 117, 110, 116, 97, 110, 101, 118, 97, 32, 83, 195, 179, 116, 97, 110, 111, 32, 49, 0, 52, 55, 44, 84, 101, 109, 112, 108, 111, 32, 80, 117, 110, 116, 97, 110, 101, 118, 97, 32, 83, 195, 179, 116, 97, 110, 111, 32, 50, 0, 52, 56, 44, 84, 101, 109, 112, 108, 111, 32, 80, 117, 110, 116, 97, 110, 101, 118, 97, 32, 83, 195, 179, 116, 97, 110, 111, 32, 51, 0, 52, 57, 44, 84, 101, 109, 112, 108, 111, 32, 80, 117, 110, 116, 97, 110, 101, 118, 97, 32, 83, 195, 179, 116, 97, 110, 111, 32, 52, 0, 53, 48, 44, 84, 101, 109, 112, 108, 111, 32, 80, 117, 110, 116, 97, 110, 101, 118, 97, 32, 83, 97, 108, 97, 32, 100, 101, 32, 82, 101, 103, 105, 103, 105, 103, 97, 115, 0, 53, 49, 44, 67, 117, 101, 118, 97, 32, 69, 120, 116, 114, 97, 118, 195, 173, 111, 32, 90, 111, 110, 97, 32, 111, 115, 99, 117, 114, 97, 0, 53, 50, 44, 67, 117, 101, 118, 97, 32, 69, 120, 116, 114, 97, 118, 195, 173, 111, 32, 90, 111, 110, 97, 32, 115, 101, 99, 114, 101, 116, 97, 0, 53, 51, 44, 77, 105, 110, 97, 32, 82, 117, 105, 110, 97, 109, 97, 110, 195, 173, 97, 99, 111, 32, 40, 109, 101, 110, 111, 115, 32, 100, 101, 32, 49, 48, 32, 85, 110, 111, 119, 110, 32, 65, 116, 114, 97, 112, 97, 100, 111, 115, 41, 0, 53, 52, 44, 77, 105, 110, 97, 32, 82, 117, 105, 110, 97, 109, 97, 110, 195, 173, 97, 99, 111, 32, 40, 109, 195, 161, 115, 32, 100, 101, 32, 49, 48, 32, 85, 110, 111, 119, 110, 32, 65, 116, 114, 97, 112, 97, 100, 111, 115, 41, 0, 53, 53, 44, 84, 195, 186, 110, 101, 108, 32, 77, 97, 110, 195, 173, 97, 99, 111, 0, 53, 54, 44, 74, 97, 114, 100, 195, 173, 110, 32, 84, 114, 111, 102, 101, 111, 0, 53, 55, 44, 73, 115, 108, 97, 32, 72, 105, 101, 114, 114, 111, 32, 90, 111, 110, 97, 32, 101, 120, 116, 101, 114, 105, 111, 114, 0, 53, 56, 44, 73, 115, 108, 97, 32, 72, 105, 101, 114, 114, 111, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 0, 53, 57, 44, 73, 115, 108, 97, 32, 72, 105, 101, 114, 114, 111, 32, 83, 195, 179, 116, 97, 110, 111, 32, 49, 0, 54, 48, 44, 73, 115, 108, 97, 32, 72, 105, 101, 114, 114, 111, 32, 83, 195, 179, 116, 97, 110, 111, 32, 50, 32, 105, 122, 113, 117, 105, 101, 114, 100, 111, 0, 54, 49, 44, 73, 115, 108, 97, 32, 72, 105, 101, 114, 114, 111, 32, 83, 195, 179, 116, 97, 110, 111, 32, 50, 32, 100, 101, 114, 101, 99, 104, 111, 0, 54, 50, 44, 73, 115, 108, 97, 32, 72, 105, 101, 114, 114, 111, 32, 83, 195, 179, 116, 97, 110, 111, 32, 51, 0, 54, 51, 44, 86, 105, 101, 106, 97, 32, 77, 97, 110, 115, 105, 195, 179, 110, 0, 54, 52, 44, 86, 105, 101, 106, 97, 32, 77, 97, 110, 115, 105, 195, 179, 110, 32, 53, 116, 111, 32, 67, 117, 97, 114, 116, 111, 0, 54, 53, 44, 76, 97, 103, 111, 32, 86, 101, 114, 97, 122, 0, 54, 54, 44, 76, 97, 103, 111, 32, 86, 97, 108, 111, 114, 0, 54, 55, 44, 76, 97, 103, 111, 32, 65, 103, 117, 100, 101, 122, 97, 0, 54, 56, 44, 79, 114, 105, 108, 108, 97, 32, 86, 97, 108, 111, 114, 0, 54, 57, 44, 79, 114, 105, 108, 108, 97, 32, 65, 103, 117, 100, 101, 122, 97, 0, 55, 48, 44, 82, 117, 116, 97, 32, 50, 48, 49, 0, 55, 49, 44, 82, 117, 116, 97, 32, 50, 48, 50, 0, 55, 50, 44, 82, 117, 116, 97, 32, 50, 48, 51, 0, 55, 51, 44, 82, 117, 116, 97, 32, 50, 48, 52, 32, 40, 83, 117, 114, 41, 0, 55, 52, 44, 82, 117, 116, 97, 32, 50, 48, 52, 32, 40, 78, 111, 114, 116, 101, 41, 0, 55, 53, 44, 82, 117, 116, 97, 32, 50, 48, 53, 32, 40, 83, 117, 114, 41, 0, 55, 54, 44, 82, 117, 116, 97, 32, 50, 48, 53, 32, 40, 78, 111, 114, 116, 101, 41, 0, 55, 55, 44, 82, 117, 116, 97, 32, 50, 48, 54, 0, 55, 56, 44, 82, 117, 116, 97, 32, 50, 48, 55, 0, 55, 57, 44, 82, 117, 116, 97, 32, 50, 48, 56, 0, 56, 48, 44, 82, 117, 116, 97, 32, 50, 48, 57, 0, 56, 49, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 49, 70, 0, 56, 50, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 50, 70, 0, 56, 51, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 51, 70, 0, 56, 52, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 52, 70, 0, 56, 53, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 53, 70, 0, 56, 54, 44, 82, 117, 116, 97, 32, 50, 49, 48, 32, 40, 83, 117, 114, 41, 0, 56, 55, 44, 82, 117, 116, 97, 32, 50, 49, 48, 32, 40, 78, 111, 114, 116, 101, 41, 0, 56, 56, 44, 82, 117, 116, 97, 32, 50, 49, 49, 32, 40, 79, 101, 115, 116, 101, 41, 0, 56, 57, 44, 82, 117, 116, 97, 32, 50, 49, 49, 32, 40, 69, 115, 116, 101, 41, 0, 57, 48, 44, 82, 117, 116, 97, 32, 50, 49, 50, 32, 40, 78, 111, 114, 116, 101, 41, 0, 57, 49, 44, 82, 117, 116, 97, 32, 50, 49, 50, 32, 40, 83, 117, 114, 41, 0, 57, 50, 44, 82, 117, 116, 97, 32, 50, 49, 51, 0, 57, 51, 44, 82, 117, 116, 97, 32, 50, 49, 52, 0, 57, 52, 44, 82, 117, 116, 97, 32, 50, 49, 53, 0, 57, 53, 44, 82, 117, 116, 97, 32, 50, 49, 54, 0, 57, 54, 44, 82, 117, 116, 97, 32, 50, 49, 55, 0, 57, 55, 44, 82, 117, 116, 97, 32, 50, 49, 56, 0, 57, 56, 44, 82, 117, 116, 97, 32, 50, 49, 57, 0, 57, 57, 44, 82, 117, 116, 97, 32, 50, 50, 49, 0, 49, 48, 48, 44, 82, 117, 116, 97, 32, 50, 50, 50, 0, 49, 48, 49, 44, 82, 117, 116, 97, 32, 50, 50, 52, 0, 49, 48, 50, 44, 82, 117, 116, 97, 32, 50, 50, 53, 0, 49, 48, 51, 44, 82, 117, 116, 97, 32, 50, 50, 55, 0, 49, 48, 52, 44, 82, 117, 116, 97, 32, 50, 50, 56, 0, 49, 48, 53, 44, 82, 117, 116, 97, 32, 50, 50, 57, 0, 49, 48, 54, 44, 80, 117, 101, 98, 108, 111, 32, 72, 111, 106, 97, 118, 101, 114, 100, 101, 0, 49, 48, 55, 44, 80, 117, 101, 98, 108, 111, 32, 67, 97, 101, 108, 101, 115, 116, 105, 115, 0, 49, 48, 56, 44, 90, 111, 110, 97, 32, 68, 101, 115, 99, 97, 110, 115, 111, 0, 49, 48, 57, 44, 82, 117, 116, 97, 32, 50, 50, 48, 0, 49, 49, 48, 44, 82, 117, 116, 97, 32, 50, 50, 51, 0, 49, 49, 49, 44, 82, 117, 116, 97, 32, 50, 50, 54, 0, 49, 49, 50, 44, 82, 117, 116, 97, 32, 50, 51, 48, 0 };
-
-constexpr std::array<u8, 2148> frlg_es = { 48, 44, 80, 117, 101, 98, 108, 111, 32, 80, 97, 108, 101, 116, 97, 0, 49, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 67, 105, 116, 121, 0, 50, 44, 67, 105, 117, 100, 97, 100, 32, 86, 101, 114, 100, 101, 0, 51, 44, 67, 105, 117, 100, 97, 100, 32, 67, 97, 114, 109, 195, 173, 110, 0, 52, 44, 67, 105, 117, 100, 97, 100, 32, 65, 122, 117, 108, 111, 110, 97, 0, 53, 44, 67, 105, 117, 100, 97, 100, 32, 70, 117, 99, 115, 105, 97, 0, 54, 44, 73, 115, 108, 97, 32, 67, 97, 110, 101, 108, 97, 0, 55, 44, 82, 117, 116, 97, 32, 49, 0, 56, 44, 82, 117, 116, 97, 32, 50, 0, 57, 44, 82, 117, 116, 97, 32, 51, 0, 49, 48, 44, 82, 117, 116, 97, 32, 52, 0, 49, 49, 44, 82, 117, 116, 97, 32, 53, 0, 49, 50, 44, 82, 117, 116, 97, 32, 54, 0, 49, 51, 44, 82, 117, 116, 97, 32, 55, 0, 49, 52, 44, 82, 117, 116, 97, 32, 56, 0, 49, 53, 44, 82, 117, 116, 97, 32, 57, 0, 49, 54, 44, 82, 117, 116, 97, 32, 49, 48, 0, 49, 55, 44, 82, 117, 116, 97, 32, 49, 49, 0, 49, 56, 44, 82, 117, 116, 97, 32, 49, 50, 0, 49, 57, 44, 82, 117, 116, 97, 32, 49, 51, 0, 50, 48, 44, 82, 117, 116, 97, 32, 49, 52, 0, 50, 49, 44, 82, 117, 116, 97, 32, 49, 53, 0, 50, 50, 44, 82, 117, 116, 97, 32, 49, 54, 0, 50, 51, 44, 82, 117, 116, 97, 32, 49, 55, 0, 50, 52, 44, 82, 117, 116, 97, 32, 49, 56, 0, 50, 53, 44, 82, 117, 116, 97, 32, 49, 57, 0, 50, 54, 44, 82, 117, 116, 97, 32, 50, 48, 0, 50, 55, 44, 82, 117, 116, 97, 32, 50, 49, 0, 50, 56, 44, 82, 117, 116, 97, 32, 50, 50, 0, 50, 57, 44, 82, 117, 116, 97, 32, 50, 51, 0, 51, 48, 44, 82, 117, 116, 97, 32, 50, 52, 0, 51, 49, 44, 82, 117, 116, 97, 32, 50, 53, 0, 51, 50, 44, 66, 111, 115, 113, 117, 101, 32, 86, 101, 114, 100, 101, 0, 51, 51, 44, 77, 111, 110, 116, 101, 32, 77, 111, 111, 110, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 0, 51, 52, 44, 77, 111, 110, 116, 101, 32, 77, 111, 111, 110, 32, 83, 195, 179, 116, 97, 110, 111, 32, 49, 0, 51, 53, 44, 77, 111, 110, 116, 101, 32, 77, 111, 111, 110, 32, 83, 195, 179, 116, 97, 110, 111, 32, 50, 0, 51, 54, 44, 83, 46, 83, 46, 32, 65, 110, 110, 101, 0, 51, 55, 44, 67, 117, 101, 118, 97, 32, 68, 105, 103, 108, 101, 116, 116, 0, 51, 56, 44, 67, 97, 108, 108, 101, 32, 86, 105, 99, 116, 111, 114, 105, 97, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 0, 51, 57, 44, 67, 97, 108, 108, 101, 32, 86, 105, 99, 116, 111, 114, 105, 97, 32, 83, 101, 103, 117, 110, 100, 97, 32, 112, 108, 97, 110, 116, 97, 0, 52, 48, 44, 67, 97, 108, 108, 101, 32, 86, 105, 99, 116, 111, 114, 105, 97, 32, 80, 114, 105, 109, 101, 114, 97, 32, 112, 108, 97, 110, 116, 97, 0, 52, 49, 44, 77, 97, 110, 115, 105, 195, 179, 110, 32, 80, 111, 107, 195, 169, 109, 111, 110, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 32, 121, 32, 112, 105, 115, 111, 115, 32, 49, 32, 121, 32, 50, 0, 52, 50, 44, 77, 97, 110, 115, 105, 195, 179, 110, 32, 80, 111, 107, 195, 169, 109, 111, 110, 32, 83, 195, 179, 116, 97, 110, 111, 0, 52, 51, 44, 90, 111, 110, 97, 32, 83, 97, 102, 97, 114, 105, 44, 32, 90, 111, 110, 97, 32, 99, 101, 110, 116, 114, 97, 108, 0, 52, 52, 44, 90, 111, 110, 97, 32, 83, 97, 102, 97, 114, 105, 44, 32, 90, 111, 110, 97, 32, 49, 0, 52, 53, 44, 90, 111, 110, 97, 32, 83, 97, 102, 97, 114, 105, 44, 32, 90, 111, 110, 97, 32, 50, 0, 52, 54, 44, 90, 111, 110, 97, 32, 83, 97, 102, 97, 114, 105, 44, 32, 90, 111, 110, 97, 32, 51, 0, 52, 55, 44, 84, 195, 186, 110, 101, 108, 32, 82, 111, 99, 97, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 0, 52, 56, 44, 84, 195, 186, 110, 101, 108, 32, 82, 111, 99, 97, 32, 83, 195, 179, 116, 97, 110, 111, 0, 52, 57, 44, 73, 115, 108, 97, 115, 32, 69, 115, 112, 117, 109, 97, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 0, 53, 48, 44, 73, 115, 108, 97, 115, 32, 69, 115, 112, 117, 109, 97, 32, 83, 195, 179, 116, 97, 110, 111, 32, 49, 0, 53, 49, 44, 73, 115, 108, 97, 115, 32, 69, 115, 112, 117, 109, 97, 32, 83, 195, 179, 116, 97, 110, 111, 32, 50, 0, 53, 50, 44, 73, 115, 108, 97, 115, 32, 69, 115, 112, 117, 109, 97, 32, 83, 195, 179, 116, 97, 110, 111, 32, 51, 0, 53, 51, 44, 73, 115, 108, 97, 115, 32, 69, 115, 112, 117, 109, 97, 32, 83, 195, 179, 116, 97, 110, 111, 32, 52, 0, 53, 52, 44, 84, 111, 114, 114, 101, 32, 80, 111, 107, 195, 169, 109, 111, 110, 32, 80, 105, 115, 111, 32, 50, 0, 53, 53, 44, 84, 111, 114, 114, 101, 32, 80, 111, 107, 195, 169, 109, 111, 110, 32, 80, 105, 115, 111, 115, 32, 51, 0, 53, 54, 44, 84, 111, 114, 114, 101, 32, 80, 111, 107, 195, 169, 109, 111, 110, 32, 80, 105, 115, 111, 115, 32, 52, 0, 53, 55, 44, 84, 111, 114, 114, 101, 32, 80, 111, 107, 195, 169, 109, 111, 110, 32, 80, 105, 115, 111, 115, 32, 53, 0, 53, 56, 44, 84, 111, 114, 114, 101, 32, 80, 111, 107, 195, 169, 109, 111, 110, 32, 80, 105, 115, 111, 115, 32, 54, 0, 53, 57, 44, 67, 117, 101, 118, 97, 32, 67, 101, 108, 101, 115, 116, 101, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 0, 54, 48, 44, 67, 117, 101, 118, 97, 32, 67, 101, 108, 101, 115, 116, 101, 32, 80, 114, 105, 109, 101, 114, 32, 112, 105, 115, 111, 0, 54, 49, 44, 67, 117, 101, 118, 97, 32, 67, 101, 108, 101, 115, 116, 101, 32, 83, 195, 179, 116, 97, 110, 111, 0, 54, 50, 44, 67, 101, 110, 116, 114, 97, 108, 32, 100, 101, 32, 69, 110, 101, 114, 103, 195, 173, 97, 0, 54, 51, 44, 73, 115, 108, 97, 32, 80, 114, 105, 109, 97, 0, 54, 52, 44, 73, 115, 108, 97, 32, 81, 117, 97, 114, 116, 97, 0, 54, 53, 44, 73, 115, 108, 97, 32, 73, 110, 116, 97, 0, 54, 54, 44, 67, 97, 109, 105, 110, 111, 32, 67, 97, 110, 100, 101, 110, 116, 101, 0, 54, 55, 44, 80, 108, 97, 121, 97, 32, 84, 101, 115, 111, 114, 111, 0, 54, 56, 44, 67, 97, 98, 111, 32, 69, 120, 116, 114, 101, 109, 111, 0, 54, 57, 44, 80, 117, 101, 110, 116, 101, 32, 85, 110, 105, 195, 179, 110, 0, 55, 48, 44, 80, 117, 101, 114, 116, 111, 32, 73, 115, 108, 97, 32, 84, 101, 114, 97, 0, 55, 49, 44, 76, 117, 103, 97, 114, 32, 100, 101, 32, 82, 101, 99, 114, 101, 111, 0, 55, 50, 44, 65, 113, 117, 97, 114, 105, 110, 116, 111, 0, 55, 51, 44, 80, 114, 97, 100, 111, 32, 73, 115, 108, 97, 32, 73, 110, 116, 97, 0, 55, 52, 44, 80, 105, 108, 97, 114, 32, 82, 101, 99, 117, 101, 114, 100, 111, 0, 55, 53, 44, 73, 115, 108, 97, 32, 65, 105, 115, 108, 97, 100, 97, 0, 55, 54, 44, 86, 195, 173, 97, 32, 86, 101, 114, 100, 101, 0, 55, 55, 44, 86, 195, 173, 97, 32, 65, 99, 117, 195, 161, 116, 105, 99, 97, 0, 55, 56, 44, 86, 97, 108, 108, 101, 32, 82, 117, 105, 110, 97, 115, 0, 55, 57, 44, 84, 111, 114, 114, 101, 32, 68, 101, 115, 97, 102, 195, 173, 111, 32, 40, 69, 120, 116, 101, 114, 105, 111, 114, 41, 0, 56, 48, 44, 69, 110, 116, 114, 97, 100, 97, 32, 97, 108, 32, 67, 97, 195, 177, 195, 179, 110, 0, 56, 49, 44, 67, 97, 195, 177, 195, 179, 110, 32, 83, 195, 169, 116, 97, 110, 111, 0, 56, 50, 44, 82, 117, 105, 110, 97, 115, 32, 83, 101, 116, 101, 0, 56, 51, 44, 77, 111, 110, 116, 101, 32, 65, 115, 99, 117, 97, 115, 32, 76, 97, 100, 101, 114, 97, 0, 56, 52, 44, 77, 111, 110, 116, 101, 32, 65, 115, 99, 117, 97, 115, 32, 69, 110, 116, 114, 97, 100, 97, 32, 97, 108, 32, 100, 101, 115, 102, 105, 108, 97, 100, 101, 114, 111, 0, 56, 53, 44, 77, 111, 110, 116, 101, 32, 65, 115, 99, 117, 97, 115, 32, 68, 101, 115, 102, 105, 108, 97, 100, 101, 114, 111, 0, 56, 54, 44, 77, 111, 110, 116, 101, 32, 65, 115, 99, 117, 97, 115, 32, 83, 97, 108, 105, 100, 97, 32, 100, 101, 108, 32, 100, 101, 115, 102, 105, 108, 97, 100, 101, 114, 111, 0, 56, 55, 44, 77, 111, 110, 116, 101, 32, 65, 115, 99, 117, 97, 115, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 0, 56, 56, 44, 77, 111, 110, 116, 101, 32, 65, 115, 99, 117, 97, 115, 32, 83, 195, 179, 116, 97, 110, 111, 32, 49, 0, 56, 57, 44, 77, 111, 110, 116, 101, 32, 65, 115, 99, 117, 97, 115, 32, 83, 195, 179, 116, 97, 110, 111, 32, 50, 0, 57, 48, 44, 77, 111, 110, 116, 101, 32, 65, 115, 99, 117, 97, 115, 32, 83, 195, 179, 116, 97, 110, 111, 32, 51, 0, 57, 49, 44, 77, 111, 110, 116, 101, 32, 65, 115, 99, 117, 97, 115, 32, 83, 195, 179, 116, 97, 110, 111, 32, 52, 0, 57, 50, 44, 77, 111, 110, 116, 101, 32, 65, 115, 99, 117, 97, 115, 32, 83, 195, 179, 116, 97, 110, 111, 32, 53, 0, 57, 51, 44, 66, 111, 115, 113, 117, 101, 32, 66, 97, 121, 97, 0, 57, 52, 44, 67, 117, 101, 118, 97, 32, 71, 108, 97, 99, 105, 97, 100, 97, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 32, 40, 115, 97, 108, 97, 32, 49, 41, 0, 57, 53, 44, 67, 117, 101, 118, 97, 32, 71, 108, 97, 99, 105, 97, 100, 97, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 32, 40, 115, 97, 108, 97, 32, 50, 41, 0, 57, 54, 44, 67, 117, 101, 118, 97, 32, 71, 108, 97, 99, 105, 97, 100, 97, 32, 83, 195, 179, 116, 97, 110, 111, 0, 57, 55, 44, 67, 117, 101, 118, 97, 32, 71, 108, 97, 99, 105, 97, 100, 97, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 32, 40, 115, 97, 108, 97, 32, 51, 41, 0, 57, 56, 44, 66, 111, 115, 113, 117, 101, 106, 111, 0, 57, 57, 44, 67, 117, 101, 118, 97, 32, 67, 97, 109, 98, 105, 97, 110, 116, 101, 0, 49, 48, 48, 44, 67, 195, 161, 109, 97, 114, 97, 32, 65, 110, 195, 169, 109, 117, 110, 97, 0, 49, 48, 49, 44, 67, 195, 161, 109, 97, 114, 97, 32, 84, 117, 108, 105, 112, 100, 111, 115, 0, 49, 48, 50, 44, 67, 195, 161, 109, 97, 114, 97, 32, 84, 114, 105, 115, 97, 110, 116, 101, 0, 49, 48, 51, 44, 67, 195, 161, 109, 97, 114, 97, 32, 81, 117, 97, 114, 99, 105, 115, 111, 0, 49, 48, 52, 44, 67, 195, 161, 109, 97, 114, 97, 32, 72, 105, 98, 105, 110, 99, 97, 0, 49, 48, 53, 44, 67, 195, 161, 109, 97, 114, 97, 32, 83, 101, 105, 114, 105, 115, 0, 49, 48, 54, 44, 67, 195, 161, 109, 97, 114, 97, 32, 80, 97, 115, 105, 101, 116, 101, 0 };
-
-constexpr std::array<u8, 2315> hgss_es = { 48, 44, 80, 117, 101, 98, 108, 111, 32, 80, 114, 105, 109, 97, 118, 101, 114, 97, 0, 49, 44, 82, 117, 116, 97, 32, 50, 57, 0, 50, 44, 67, 105, 117, 100, 97, 100, 32, 67, 101, 114, 101, 122, 111, 0, 51, 44, 82, 117, 116, 97, 32, 51, 48, 0, 52, 44, 82, 117, 116, 97, 32, 51, 49, 0, 53, 44, 67, 105, 117, 100, 97, 100, 32, 77, 97, 108, 118, 97, 0, 54, 44, 84, 111, 114, 114, 101, 32, 66, 101, 108, 108, 115, 112, 114, 111, 117, 116, 0, 55, 44, 82, 117, 116, 97, 32, 51, 50, 0, 56, 44, 82, 117, 105, 110, 97, 115, 32, 65, 108, 102, 97, 32, 40, 69, 120, 116, 101, 114, 105, 111, 114, 41, 0, 57, 44, 82, 117, 105, 110, 97, 115, 32, 65, 108, 102, 97, 32, 40, 73, 110, 116, 101, 114, 105, 111, 114, 41, 0, 49, 48, 44, 67, 117, 101, 118, 97, 32, 85, 110, 105, 195, 179, 110, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 0, 49, 49, 44, 67, 117, 101, 118, 97, 32, 85, 110, 105, 195, 179, 110, 32, 83, 195, 179, 116, 97, 110, 111, 32, 49, 0, 49, 50, 44, 67, 117, 101, 118, 97, 32, 85, 110, 105, 195, 179, 110, 32, 83, 195, 179, 116, 97, 110, 111, 32, 50, 0, 49, 51, 44, 82, 117, 116, 97, 32, 51, 51, 0, 49, 52, 44, 80, 111, 122, 111, 32, 83, 108, 111, 119, 112, 111, 107, 101, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 0, 49, 53, 44, 80, 111, 122, 111, 32, 83, 108, 111, 119, 112, 111, 107, 101, 32, 83, 195, 179, 116, 97, 110, 111, 0, 49, 54, 44, 69, 110, 99, 105, 110, 97, 114, 0, 49, 55, 44, 82, 117, 116, 97, 32, 51, 52, 0, 49, 56, 44, 82, 117, 116, 97, 32, 51, 53, 0, 49, 57, 44, 80, 97, 114, 113, 117, 101, 32, 78, 97, 99, 105, 111, 110, 97, 108, 0, 50, 48, 44, 82, 117, 116, 97, 32, 51, 54, 0, 50, 49, 44, 82, 117, 116, 97, 32, 51, 55, 0, 50, 50, 44, 67, 105, 117, 100, 97, 100, 32, 73, 114, 105, 115, 0, 50, 51, 44, 84, 111, 114, 114, 101, 32, 81, 117, 101, 109, 97, 100, 97, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 0, 50, 52, 44, 84, 111, 114, 114, 101, 32, 81, 117, 101, 109, 97, 100, 97, 32, 83, 195, 179, 116, 97, 110, 111, 0, 50, 53, 44, 84, 111, 114, 114, 101, 32, 67, 97, 109, 112, 97, 110, 97, 0, 50, 54, 44, 82, 117, 116, 97, 32, 51, 56, 0, 50, 55, 44, 82, 117, 116, 97, 32, 51, 57, 0, 50, 56, 44, 67, 105, 117, 100, 97, 100, 32, 79, 108, 105, 118, 111, 0, 50, 57, 44, 82, 117, 116, 97, 32, 52, 48, 0, 51, 48, 44, 82, 117, 116, 97, 32, 52, 49, 0, 51, 49, 44, 73, 115, 108, 97, 115, 32, 82, 101, 109, 111, 108, 105, 110, 111, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 0, 51, 50, 44, 73, 115, 108, 97, 115, 32, 82, 101, 109, 111, 108, 105, 110, 111, 32, 83, 195, 179, 116, 97, 110, 111, 32, 49, 0, 51, 51, 44, 73, 115, 108, 97, 115, 32, 82, 101, 109, 111, 108, 105, 110, 111, 32, 83, 195, 179, 116, 97, 110, 111, 32, 50, 0, 51, 52, 44, 73, 115, 108, 97, 115, 32, 82, 101, 109, 111, 108, 105, 110, 111, 32, 83, 195, 179, 116, 97, 110, 111, 32, 51, 0, 51, 53, 44, 67, 105, 117, 100, 97, 100, 32, 79, 114, 113, 117, 195, 173, 100, 101, 97, 0, 51, 54, 44, 82, 117, 116, 97, 32, 52, 50, 0, 51, 55, 44, 77, 111, 110, 116, 101, 32, 77, 111, 114, 116, 101, 114, 111, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 32, 40, 101, 110, 116, 114, 97, 100, 97, 41, 0, 51, 56, 44, 77, 111, 110, 116, 101, 32, 77, 111, 114, 116, 101, 114, 111, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 32, 40, 105, 110, 116, 101, 114, 105, 111, 114, 41, 0, 51, 57, 44, 77, 111, 110, 116, 101, 32, 77, 111, 114, 116, 101, 114, 111, 32, 80, 114, 105, 109, 101, 114, 97, 32, 112, 108, 97, 110, 116, 97, 0, 52, 48, 44, 77, 111, 110, 116, 101, 32, 77, 111, 114, 116, 101, 114, 111, 32, 83, 195, 179, 116, 97, 110, 111, 0, 52, 49, 44, 82, 117, 116, 97, 32, 52, 51, 0, 52, 50, 44, 76, 97, 103, 111, 32, 100, 101, 32, 108, 97, 32, 70, 117, 114, 105, 97, 0, 52, 51, 44, 82, 117, 116, 97, 32, 52, 52, 0, 52, 52, 44, 82, 117, 116, 97, 32, 72, 101, 108, 97, 100, 97, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 0, 52, 53, 44, 82, 117, 116, 97, 32, 72, 101, 108, 97, 100, 97, 32, 83, 195, 179, 116, 97, 110, 111, 32, 49, 0, 52, 54, 44, 82, 117, 116, 97, 32, 72, 101, 108, 97, 100, 97, 32, 83, 195, 179, 116, 97, 110, 111, 32, 50, 0, 52, 55, 44, 82, 117, 116, 97, 32, 72, 101, 108, 97, 100, 97, 32, 83, 195, 179, 116, 97, 110, 111, 32, 51, 0, 52, 56, 44, 67, 105, 117, 100, 97, 100, 32, 69, 110, 100, 114, 105, 110, 111, 0, 52, 57, 44, 71, 117, 97, 114, 105, 100, 97, 32, 68, 114, 97, 103, 195, 179, 110, 0, 53, 48, 44, 82, 117, 116, 97, 32, 52, 53, 0, 53, 49, 44, 82, 117, 116, 97, 32, 52, 54, 0, 53, 50, 44, 67, 117, 101, 118, 97, 32, 79, 115, 99, 117, 114, 97, 32, 40, 82, 117, 116, 97, 32, 51, 49, 41, 0, 53, 51, 44, 67, 117, 101, 118, 97, 32, 79, 115, 99, 117, 114, 97, 32, 40, 82, 117, 116, 97, 32, 52, 53, 41, 0, 53, 52, 44, 82, 117, 116, 97, 32, 52, 55, 0, 53, 53, 44, 77, 111, 110, 116, 101, 32, 77, 111, 111, 110, 32, 73, 110, 116, 101, 114, 105, 111, 114, 0, 53, 54, 44, 77, 111, 110, 116, 101, 32, 77, 111, 111, 110, 32, 69, 120, 116, 101, 114, 105, 111, 114, 32, 40, 80, 108, 97, 122, 97, 32, 77, 111, 110, 116, 101, 32, 77, 111, 111, 110, 41, 0, 53, 55, 44, 73, 115, 108, 97, 115, 32, 69, 115, 112, 117, 109, 97, 32, 90, 111, 110, 97, 115, 32, 100, 101, 32, 97, 99, 99, 101, 115, 111, 0, 53, 56, 44, 73, 115, 108, 97, 115, 32, 69, 115, 112, 117, 109, 97, 32, 83, 195, 179, 116, 97, 110, 111, 32, 49, 0, 53, 57, 44, 73, 115, 108, 97, 115, 32, 69, 115, 112, 117, 109, 97, 32, 83, 195, 179, 116, 97, 110, 111, 32, 50, 0, 54, 48, 44, 73, 115, 108, 97, 115, 32, 69, 115, 112, 117, 109, 97, 32, 83, 195, 179, 116, 97, 110, 111, 32, 51, 0, 54, 49, 44, 73, 115, 108, 97, 115, 32, 69, 115, 112, 117, 109, 97, 32, 83, 195, 179, 116, 97, 110, 111, 32, 52, 0, 54, 50, 44, 67, 117, 101, 118, 97, 32, 77, 32, 80, 108, 97, 116, 101, 97, 100, 111, 32, 67, 117, 101, 118, 97, 32, 99, 111, 110, 32, 99, 97, 115, 99, 97, 100, 97, 115, 0, 54, 51, 44, 77, 111, 110, 116, 101, 32, 80, 108, 97, 116, 101, 97, 100, 111, 32, 76, 97, 100, 101, 114, 97, 32, 118, 101, 114, 100, 101, 0, 54, 52, 44, 67, 117, 101, 118, 97, 32, 77, 32, 80, 108, 97, 116, 101, 97, 100, 111, 32, 67, 117, 101, 118, 97, 32, 112, 101, 113, 117, 101, 195, 177, 97, 0, 54, 53, 44, 80, 97, 115, 111, 32, 65, 99, 97, 110, 116, 105, 108, 97, 100, 111, 0, 54, 54, 44, 67, 117, 101, 118, 97, 32, 65, 99, 97, 110, 116, 105, 108, 97, 100, 111, 0, 54, 55, 44, 77, 111, 110, 116, 101, 32, 80, 108, 97, 116, 101, 97, 100, 111, 32, 69, 120, 116, 101, 114, 105, 111, 114, 0, 54, 56, 44, 67, 117, 101, 118, 97, 32, 77, 32, 80, 108, 97, 116, 101, 97, 100, 111, 32, 67, 117, 101, 118, 97, 32, 101, 115, 112, 105, 114, 97, 108, 0, 54, 57, 44, 77, 111, 110, 116, 101, 32, 80, 108, 97, 116, 101, 97, 100, 111, 32, 76, 97, 100, 101, 114, 97, 32, 110, 101, 118, 97, 100, 97, 0, 55, 48, 44, 67, 117, 101, 118, 97, 32, 77, 32, 80, 108, 97, 116, 101, 97, 100, 111, 32, 67, 117, 101, 118, 97, 32, 102, 105, 110, 97, 108, 0, 55, 49, 44, 67, 117, 101, 118, 97, 32, 77, 32, 80, 108, 97, 116, 101, 97, 100, 111, 32, 67, 117, 101, 118, 97, 32, 100, 101, 32, 77, 111, 108, 116, 114, 101, 115, 0, 55, 50, 44, 82, 117, 116, 97, 32, 49, 50, 0, 55, 51, 44, 82, 117, 116, 97, 32, 49, 57, 0, 55, 52, 44, 82, 117, 116, 97, 32, 50, 48, 0, 55, 53, 44, 80, 117, 101, 98, 108, 111, 32, 80, 97, 108, 101, 116, 97, 0, 55, 54, 44, 67, 105, 117, 100, 97, 100, 32, 86, 101, 114, 100, 101, 0, 55, 55, 44, 67, 105, 117, 100, 97, 100, 32, 67, 101, 108, 101, 115, 116, 101, 0, 55, 56, 44, 67, 105, 117, 100, 97, 100, 32, 67, 97, 114, 109, 195, 173, 110, 0, 55, 57, 44, 67, 105, 117, 100, 97, 100, 32, 65, 122, 117, 108, 111, 110, 97, 0, 56, 48, 44, 67, 105, 117, 100, 97, 100, 32, 70, 117, 99, 115, 105, 97, 0, 56, 49, 44, 73, 115, 108, 97, 32, 67, 97, 110, 101, 108, 97, 0, 56, 50, 44, 82, 117, 116, 97, 32, 52, 56, 0, 56, 51, 44, 82, 117, 116, 97, 32, 50, 54, 0, 56, 52, 44, 82, 117, 116, 97, 32, 50, 55, 0, 56, 53, 44, 82, 117, 116, 97, 32, 50, 56, 0, 56, 54, 44, 77, 111, 110, 116, 101, 32, 77, 111, 111, 110, 0, 56, 55, 44, 84, 195, 186, 110, 101, 108, 32, 82, 111, 99, 97, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 0, 56, 56, 44, 84, 195, 186, 110, 101, 108, 32, 82, 111, 99, 97, 32, 83, 195, 179, 116, 97, 110, 111, 0, 56, 57, 44, 67, 97, 108, 108, 101, 32, 86, 105, 99, 116, 111, 114, 105, 97, 32, 69, 110, 116, 114, 97, 100, 97, 0, 57, 48, 44, 82, 117, 116, 97, 32, 49, 0, 57, 49, 44, 82, 117, 116, 97, 32, 50, 32, 40, 83, 117, 114, 41, 0, 57, 50, 44, 82, 117, 116, 97, 32, 51, 0, 57, 51, 44, 82, 117, 116, 97, 32, 52, 0, 57, 52, 44, 82, 117, 116, 97, 32, 53, 0, 57, 53, 44, 82, 117, 116, 97, 32, 54, 0, 57, 54, 44, 82, 117, 116, 97, 32, 55, 0, 57, 55, 44, 82, 117, 116, 97, 32, 56, 0, 57, 56, 44, 82, 117, 116, 97, 32, 57, 0, 57, 57, 44, 82, 117, 116, 97, 32, 49, 48, 0, 49, 48, 48, 44, 82, 117, 116, 97, 32, 49, 49, 0, 49, 48, 49, 44, 82, 117, 116, 97, 32, 49, 51, 0, 49, 48, 50, 44, 82, 117, 116, 97, 32, 49, 52, 0, 49, 48, 51, 44, 82, 117, 116, 97, 32, 49, 53, 0, 49, 48, 52, 44, 82, 117, 116, 97, 32, 49, 54, 0, 49, 48, 53, 44, 82, 117, 116, 97, 32, 49, 55, 0, 49, 48, 54, 44, 82, 117, 116, 97, 32, 49, 56, 0, 49, 48, 55, 44, 82, 117, 116, 97, 32, 50, 49, 0, 49, 48, 56, 44, 82, 117, 116, 97, 32, 50, 50, 0, 49, 48, 57, 44, 82, 117, 116, 97, 32, 50, 52, 0, 49, 49, 48, 44, 82, 117, 116, 97, 32, 50, 53, 0, 49, 49, 49, 44, 67, 97, 116, 97, 114, 97, 116, 97, 115, 32, 84, 111, 104, 106, 111, 0, 49, 49, 50, 44, 67, 117, 101, 118, 97, 32, 68, 105, 103, 108, 101, 116, 116, 0, 49, 49, 51, 44, 67, 97, 108, 108, 101, 32, 86, 105, 99, 116, 111, 114, 105, 97, 32, 80, 105, 115, 111, 32, 49, 0, 49, 49, 52, 44, 67, 97, 108, 108, 101, 32, 86, 105, 99, 116, 111, 114, 105, 97, 32, 80, 105, 115, 111, 32, 50, 0, 49, 49, 53, 44, 82, 117, 116, 97, 32, 50, 32, 40, 78, 111, 114, 116, 101, 41, 0, 49, 49, 54, 44, 66, 111, 115, 113, 117, 101, 32, 86, 101, 114, 100, 101, 0, 49, 49, 55, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 0, 49, 49, 56, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 80, 114, 105, 109, 101, 114, 32, 112, 105, 115, 111, 0, 49, 49, 57, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 83, 195, 179, 116, 97, 110, 111, 0 };
-
-constexpr std::array<u8, 177> natures_es = { 70, 117, 101, 114, 116, 101, 0, 72, 117, 114, 97, 195, 177, 97, 0, 65, 117, 100, 97, 122, 0, 70, 105, 114, 109, 101, 0, 80, 195, 173, 99, 97, 114, 97, 0, 79, 115, 97, 100, 97, 0, 68, 195, 179, 99, 105, 108, 0, 80, 108, 195, 161, 99, 105, 100, 97, 0, 65, 103, 105, 116, 97, 100, 97, 0, 70, 108, 111, 106, 97, 0, 77, 105, 101, 100, 111, 115, 97, 0, 65, 99, 116, 105, 118, 97, 0, 83, 101, 114, 105, 97, 0, 65, 108, 101, 103, 114, 101, 0, 73, 110, 103, 101, 110, 117, 97, 0, 77, 111, 100, 101, 115, 116, 97, 0, 65, 102, 97, 98, 108, 101, 0, 77, 97, 110, 115, 97, 0, 84, 195, 173, 109, 105, 100, 97, 0, 65, 108, 111, 99, 97, 100, 97, 0, 83, 101, 114, 101, 110, 97, 0, 65, 109, 97, 98, 108, 101, 0, 71, 114, 111, 115, 101, 114, 97, 0, 67, 97, 117, 116, 97, 0, 82, 97, 114, 97, 0 };
-
-constexpr std::array<u8, 117> powers_es = { 76, 117, 99, 104, 97, 0, 86, 111, 108, 97, 100, 111, 114, 0, 86, 101, 110, 101, 110, 111, 0, 84, 105, 101, 114, 114, 97, 0, 82, 111, 99, 97, 0, 66, 105, 99, 104, 111, 0, 70, 97, 110, 116, 97, 115, 109, 97, 0, 65, 99, 101, 114, 111, 0, 70, 117, 101, 103, 111, 0, 65, 103, 117, 97, 0, 80, 108, 97, 110, 116, 97, 0, 69, 108, 195, 169, 99, 116, 114, 105, 99, 111, 0, 80, 115, 195, 173, 113, 117, 105, 99, 111, 0, 72, 105, 101, 108, 111, 0, 68, 114, 97, 103, 195, 179, 110, 0, 83, 105, 110, 105, 101, 115, 116, 114, 111, 0 };
-
-constexpr std::array<u8, 1801> rse_es = { 48, 44, 80, 117, 101, 98, 108, 111, 32, 65, 122, 117, 108, 105, 122, 97, 0, 49, 44, 80, 117, 101, 98, 108, 111, 32, 79, 114, 111, 109, 97, 114, 0, 50, 44, 67, 105, 117, 100, 97, 100, 32, 80, 101, 116, 97, 108, 105, 97, 0, 51, 44, 67, 105, 117, 100, 97, 100, 32, 80, 111, 114, 116, 117, 97, 108, 0, 52, 44, 67, 105, 117, 100, 97, 100, 32, 67, 97, 108, 97, 103, 117, 97, 0, 53, 44, 67, 105, 117, 100, 97, 100, 32, 65, 108, 103, 97, 114, 105, 97, 0, 54, 44, 65, 114, 114, 101, 99, 195, 173, 112, 111, 108, 105, 115, 0, 55, 44, 67, 105, 117, 100, 97, 100, 32, 67, 111, 108, 111, 115, 97, 108, 105, 97, 0, 56, 44, 82, 117, 116, 97, 32, 49, 48, 49, 0, 57, 44, 82, 117, 116, 97, 32, 49, 48, 50, 0, 49, 48, 44, 82, 117, 116, 97, 32, 49, 48, 51, 0, 49, 49, 44, 82, 117, 116, 97, 32, 49, 48, 52, 0, 49, 50, 44, 82, 117, 116, 97, 32, 49, 48, 53, 0, 49, 51, 44, 82, 117, 116, 97, 32, 49, 48, 54, 0, 49, 52, 44, 82, 117, 116, 97, 32, 49, 48, 55, 0, 49, 53, 44, 82, 117, 116, 97, 32, 49, 48, 56, 0, 49, 54, 44, 82, 117, 116, 97, 32, 49, 48, 57, 0, 49, 55, 44, 82, 117, 116, 97, 32, 49, 49, 48, 0, 49, 56, 44, 82, 117, 116, 97, 32, 49, 49, 49, 0, 49, 57, 44, 82, 117, 116, 97, 32, 49, 49, 50, 0, 50, 48, 44, 82, 117, 116, 97, 32, 49, 49, 51, 0, 50, 49, 44, 82, 117, 116, 97, 32, 49, 49, 52, 0, 50, 50, 44, 82, 117, 116, 97, 32, 49, 49, 53, 0, 50, 51, 44, 82, 117, 116, 97, 32, 49, 49, 54, 0, 50, 52, 44, 82, 117, 116, 97, 32, 49, 49, 55, 0, 50, 53, 44, 82, 117, 116, 97, 32, 49, 49, 56, 0, 50, 54, 44, 82, 117, 116, 97, 32, 49, 49, 57, 0, 50, 55, 44, 82, 117, 116, 97, 32, 49, 50, 48, 0, 50, 56, 44, 82, 117, 116, 97, 32, 49, 50, 49, 0, 50, 57, 44, 82, 117, 116, 97, 32, 49, 50, 50, 0, 51, 48, 44, 82, 117, 116, 97, 32, 49, 50, 51, 0, 51, 49, 44, 82, 117, 116, 97, 32, 49, 50, 52, 0, 51, 50, 44, 82, 117, 116, 97, 32, 49, 50, 53, 0, 51, 51, 44, 82, 117, 116, 97, 32, 49, 50, 54, 0, 51, 52, 44, 82, 117, 116, 97, 32, 49, 50, 55, 0, 51, 53, 44, 82, 117, 116, 97, 32, 49, 50, 56, 0, 51, 54, 44, 82, 117, 116, 97, 32, 49, 50, 57, 0, 51, 55, 44, 82, 117, 116, 97, 32, 49, 51, 48, 0, 51, 56, 44, 82, 117, 116, 97, 32, 49, 51, 49, 0, 51, 57, 44, 82, 117, 116, 97, 32, 49, 51, 50, 0, 52, 48, 44, 82, 117, 116, 97, 32, 49, 51, 51, 0, 52, 49, 44, 82, 117, 116, 97, 32, 49, 51, 52, 0, 52, 50, 44, 66, 117, 99, 101, 97, 110, 100, 111, 32, 40, 82, 117, 116, 97, 32, 49, 50, 52, 41, 0, 52, 51, 44, 66, 117, 99, 101, 97, 110, 100, 111, 32, 40, 82, 117, 116, 97, 32, 49, 50, 54, 41, 0, 52, 52, 44, 67, 117, 101, 118, 97, 32, 71, 114, 97, 110, 105, 116, 111, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 32, 40, 122, 111, 110, 97, 32, 49, 41, 0, 52, 53, 44, 67, 117, 101, 118, 97, 32, 71, 114, 97, 110, 105, 116, 111, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 32, 40, 122, 111, 110, 97, 32, 50, 41, 0, 52, 54, 44, 67, 117, 101, 118, 97, 32, 71, 114, 97, 110, 105, 116, 111, 32, 83, 195, 179, 116, 97, 110, 111, 32, 49, 0, 52, 55, 44, 67, 117, 101, 118, 97, 32, 71, 114, 97, 110, 105, 116, 111, 32, 83, 195, 179, 116, 97, 110, 111, 32, 50, 0, 52, 56, 44, 90, 111, 110, 97, 32, 83, 97, 102, 97, 114, 105, 32, 83, 117, 114, 101, 115, 116, 101, 32, 40, 101, 110, 116, 114, 97, 100, 97, 41, 0, 52, 57, 44, 90, 111, 110, 97, 32, 83, 97, 102, 97, 114, 105, 32, 83, 117, 114, 111, 101, 115, 116, 101, 0, 53, 48, 44, 90, 111, 110, 97, 32, 83, 97, 102, 97, 114, 105, 32, 78, 111, 114, 111, 101, 115, 116, 101, 0, 53, 49, 44, 90, 111, 110, 97, 32, 83, 97, 102, 97, 114, 105, 32, 78, 111, 114, 101, 115, 116, 101, 0, 53, 50, 44, 90, 111, 110, 97, 32, 83, 97, 102, 97, 114, 105, 32, 69, 120, 116, 101, 110, 115, 105, 195, 179, 110, 32, 78, 111, 114, 116, 101, 0, 53, 51, 44, 90, 111, 110, 97, 32, 83, 97, 102, 97, 114, 105, 32, 69, 120, 116, 101, 110, 115, 105, 195, 179, 110, 32, 83, 117, 114, 0, 53, 52, 44, 66, 111, 115, 113, 117, 101, 32, 80, 101, 116, 97, 108, 105, 97, 0, 53, 53, 44, 84, 195, 186, 110, 101, 108, 32, 70, 101, 114, 118, 101, 114, 103, 97, 108, 0, 53, 54, 44, 78, 97, 111, 32, 65, 98, 97, 110, 100, 111, 110, 97, 100, 97, 0, 53, 55, 44, 77, 97, 108, 118, 97, 108, 97, 110, 111, 118, 97, 32, 40, 69, 110, 116, 114, 97, 100, 97, 41, 0, 53, 56, 44, 77, 97, 108, 118, 97, 108, 97, 110, 111, 118, 97, 32, 40, 83, 195, 179, 116, 97, 110, 111, 41, 0, 53, 57, 44, 67, 97, 115, 99, 97, 100, 97, 32, 77, 101, 116, 101, 111, 114, 111, 32, 69, 110, 116, 114, 97, 100, 97, 32, 40, 122, 111, 110, 97, 32, 49, 41, 0, 54, 48, 44, 67, 97, 115, 99, 97, 100, 97, 32, 77, 101, 116, 101, 111, 114, 111, 32, 73, 110, 116, 101, 114, 105, 111, 114, 32, 100, 101, 32, 108, 97, 32, 99, 117, 101, 118, 97, 32, 40, 122, 111, 110, 97, 32, 50, 41, 0, 54, 49, 44, 67, 97, 115, 99, 97, 100, 97, 32, 77, 101, 116, 101, 111, 114, 111, 32, 83, 195, 179, 116, 97, 110, 111, 32, 49, 32, 73, 110, 116, 101, 114, 105, 111, 114, 32, 100, 101, 32, 108, 97, 32, 99, 117, 101, 118, 97, 32, 40, 122, 111, 110, 97, 32, 49, 41, 0, 54, 50, 44, 67, 97, 115, 99, 97, 100, 97, 32, 77, 101, 116, 101, 111, 114, 111, 32, 83, 195, 179, 116, 97, 110, 111, 32, 50, 32, 67, 117, 97, 114, 116, 111, 32, 116, 114, 97, 115, 101, 114, 111, 32, 40, 122, 111, 110, 97, 32, 50, 41, 0, 54, 51, 44, 67, 97, 115, 99, 97, 100, 97, 32, 77, 101, 116, 101, 111, 114, 111, 32, 83, 97, 108, 97, 32, 100, 101, 32, 77, 195, 161, 120, 105, 109, 111, 32, 80, 101, 195, 177, 97, 115, 0, 54, 52, 44, 77, 111, 110, 116, 101, 32, 80, 195, 173, 114, 105, 99, 111, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 44, 32, 112, 105, 115, 111, 115, 32, 49, 32, 121, 32, 50, 32, 40, 99, 101, 109, 101, 110, 116, 101, 114, 105, 111, 41, 0, 54, 53, 44, 77, 111, 110, 116, 101, 32, 80, 195, 173, 114, 105, 99, 111, 32, 80, 105, 115, 111, 115, 32, 51, 44, 32, 52, 32, 121, 32, 53, 32, 40, 99, 101, 109, 101, 110, 116, 101, 114, 105, 111, 41, 0, 54, 54, 44, 77, 111, 110, 116, 101, 32, 80, 195, 173, 114, 105, 99, 111, 32, 76, 97, 100, 101, 114, 97, 0, 54, 55, 44, 77, 111, 110, 116, 101, 32, 80, 195, 173, 114, 105, 99, 111, 32, 67, 105, 109, 97, 0, 54, 56, 44, 67, 117, 101, 118, 97, 32, 67, 97, 114, 100, 117, 109, 101, 110, 0, 54, 57, 44, 67, 117, 101, 118, 97, 32, 67, 97, 114, 100, 117, 109, 101, 110, 32, 83, 97, 108, 97, 32, 104, 101, 108, 97, 100, 97, 0, 55, 48, 44, 67, 97, 118, 101, 114, 110, 97, 32, 65, 98, 105, 115, 97, 108, 0, 55, 49, 44, 67, 97, 108, 108, 101, 32, 86, 105, 99, 116, 111, 114, 105, 97, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 0, 55, 50, 44, 67, 97, 108, 108, 101, 32, 86, 105, 99, 116, 111, 114, 105, 97, 32, 83, 195, 179, 116, 97, 110, 111, 32, 49, 0, 55, 51, 44, 67, 97, 108, 108, 101, 32, 86, 105, 99, 116, 111, 114, 105, 97, 32, 83, 195, 179, 116, 97, 110, 111, 32, 50, 0, 55, 52, 44, 67, 117, 101, 118, 97, 32, 65, 110, 99, 101, 115, 116, 114, 97, 108, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 0, 55, 53, 44, 67, 117, 101, 118, 97, 32, 65, 110, 99, 101, 115, 116, 114, 97, 108, 32, 83, 195, 179, 116, 97, 110, 111, 115, 32, 49, 32, 97, 108, 32, 53, 0, 55, 54, 44, 83, 101, 110, 100, 97, 32, 195, 141, 103, 110, 101, 97, 0, 55, 55, 44, 68, 101, 115, 102, 105, 108, 97, 100, 101, 114, 111, 0, 55, 56, 44, 80, 105, 108, 97, 114, 32, 67, 101, 108, 101, 115, 116, 101, 32, 80, 108, 97, 110, 116, 97, 32, 98, 97, 106, 97, 0, 55, 57, 44, 80, 105, 108, 97, 114, 32, 67, 101, 108, 101, 115, 116, 101, 32, 80, 105, 115, 111, 115, 32, 49, 32, 121, 32, 50, 0, 56, 48, 44, 80, 105, 108, 97, 114, 32, 67, 101, 108, 101, 115, 116, 101, 32, 80, 105, 115, 111, 115, 32, 51, 32, 121, 32, 52, 0, 56, 49, 44, 71, 117, 97, 114, 105, 100, 97, 32, 77, 97, 103, 109, 97, 0, 56, 50, 44, 84, 111, 114, 114, 101, 32, 69, 115, 112, 101, 106, 105, 115, 109, 111, 0, 56, 51, 44, 67, 117, 101, 118, 97, 32, 84, 97, 108, 108, 101, 114, 0, 56, 52, 44, 71, 114, 117, 116, 97, 32, 68, 101, 115, 195, 169, 114, 116, 105, 99, 97, 0, 56, 53, 44, 67, 117, 101, 118, 97, 32, 67, 97, 109, 98, 105, 97, 110, 116, 101, 0 };
-
-constexpr std::array<u8, 6852> species_es = { 239, 187, 191, 66, 117, 108, 98, 97, 115, 97, 117, 114, 0, 73, 118, 121, 115, 97, 117, 114, 0, 86, 101, 110, 117, 115, 97, 117, 114, 0, 67, 104, 97, 114, 109, 97, 110, 100, 101, 114, 0, 67, 104, 97, 114, 109, 101, 108, 101, 111, 110, 0, 67, 104, 97, 114, 105, 122, 97, 114, 100, 0, 83, 113, 117, 105, 114, 116, 108, 101, 0, 87, 97, 114, 116, 111, 114, 116, 108, 101, 0, 66, 108, 97, 115, 116, 111, 105, 115, 101, 0, 67, 97, 116, 101, 114, 112, 105, 101, 0, 77, 101, 116, 97, 112, 111, 100, 0, 66, 117, 116, 116, 101, 114, 102, 114, 101, 101, 0, 87, 101, 101, 100, 108, 101, 0, 75, 97, 107, 117, 110, 97, 0, 66, 101, 101, 100, 114, 105, 108, 108, 0, 80, 105, 100, 103, 101, 121, 0, 80, 105, 100, 103, 101, 111, 116, 116, 111, 0, 80, 105, 100, 103, 101, 111, 116, 0, 82, 97, 116, 116, 97, 116, 97, 0, 82, 97, 116, 105, 99, 97, 116, 101, 0, 83, 112, 101, 97, 114, 111, 119, 0, 70, 101, 97, 114, 111, 119, 0, 69, 107, 97, 110, 115, 0, 65, 114, 98, 111, 107, 0, 80, 105, 107, 97, 99, 104, 117, 0, 82, 97, 105, 99, 104, 117, 0, 83, 97, 110, 100, 115, 104, 114, 101, 119, 0, 83, 97, 110, 100, 115, 108, 97, 115, 104, 0, 78, 105, 100, 111, 114, 97, 110, 226, 153, 128, 0, 78, 105, 100, 111, 114, 105, 110, 97, 0, 78, 105, 100, 111, 113, 117, 101, 101, 110, 0, 78, 105, 100, 111, 114, 97, 110, 226, 153, 130, 0, 78, 105, 100, 111, 114, 105, 110, 111, 0, 78, 105, 100, 111, 107, 105, 110, 103, 0, 67, 108, 101, 102, 97, 105, 114, 121, 0, 67, 108, 101, 102, 97, 98, 108, 101, 0, 86, 117, 108, 112, 105, 120, 0, 78, 105, 110, 101, 116, 97, 108, 101, 115, 0, 74, 105, 103, 103, 108, 121, 112, 117, 102, 102, 0, 87, 105, 103, 103, 108, 121, 116, 117, 102, 102, 0, 90, 117, 98, 97, 116, 0, 71, 111, 108, 98, 97, 116, 0, 79, 100, 100, 105, 115, 104, 0, 71, 108, 111, 111, 109, 0, 86, 105, 108, 101, 112, 108, 117, 109, 101, 0, 80, 97, 114, 97, 115, 0, 80, 97, 114, 97, 115, 101, 99, 116, 0, 86, 101, 110, 111, 110, 97, 116, 0, 86, 101, 110, 111, 109, 111, 116, 104, 0, 68, 105, 103, 108, 101, 116, 116, 0, 68, 117, 103, 116, 114, 105, 111, 0, 77, 101, 111, 119, 116, 104, 0, 80, 101, 114, 115, 105, 97, 110, 0, 80, 115, 121, 100, 117, 99, 107, 0, 71, 111, 108, 100, 117, 99, 107, 0, 77, 97, 110, 107, 101, 121, 0, 80, 114, 105, 109, 101, 97, 112, 101, 0, 71, 114, 111, 119, 108, 105, 116, 104, 101, 0, 65, 114, 99, 97, 110, 105, 110, 101, 0, 80, 111, 108, 105, 119, 97, 103, 0, 80, 111, 108, 105, 119, 104, 105, 114, 108, 0, 80, 111, 108, 105, 119, 114, 97, 116, 104, 0, 65, 98, 114, 97, 0, 75, 97, 100, 97, 98, 114, 97, 0, 65, 108, 97, 107, 97, 122, 97, 109, 0, 77, 97, 99, 104, 111, 112, 0, 77, 97, 99, 104, 111, 107, 101, 0, 77, 97, 99, 104, 97, 109, 112, 0, 66, 101, 108, 108, 115, 112, 114, 111, 117, 116, 0, 87, 101, 101, 112, 105, 110, 98, 101, 108, 108, 0, 86, 105, 99, 116, 114, 101, 101, 98, 101, 108, 0, 84, 101, 110, 116, 97, 99, 111, 111, 108, 0, 84, 101, 110, 116, 97, 99, 114, 117, 101, 108, 0, 71, 101, 111, 100, 117, 100, 101, 0, 71, 114, 97, 118, 101, 108, 101, 114, 0, 71, 111, 108, 101, 109, 0, 80, 111, 110, 121, 116, 97, 0, 82, 97, 112, 105, 100, 97, 115, 104, 0, 83, 108, 111, 119, 112, 111, 107, 101, 0, 83, 108, 111, 119, 98, 114, 111, 0, 77, 97, 103, 110, 101, 109, 105, 116, 101, 0, 77, 97, 103, 110, 101, 116, 111, 110, 0, 70, 97, 114, 102, 101, 116, 99, 104, 226, 128, 153, 100, 0, 68, 111, 100, 117, 111, 0, 68, 111, 100, 114, 105, 111, 0, 83, 101, 101, 108, 0, 68, 101, 119, 103, 111, 110, 103, 0, 71, 114, 105, 109, 101, 114, 0, 77, 117, 107, 0, 83, 104, 101, 108, 108, 100, 101, 114, 0, 67, 108, 111, 121, 115, 116, 101, 114, 0, 71, 97, 115, 116, 108, 121, 0, 72, 97, 117, 110, 116, 101, 114, 0, 71, 101, 110, 103, 97, 114, 0, 79, 110, 105, 120, 0, 68, 114, 111, 119, 122, 101, 101, 0, 72, 121, 112, 110, 111, 0, 75, 114, 97, 98, 98, 121, 0, 75, 105, 110, 103, 108, 101, 114, 0, 86, 111, 108, 116, 111, 114, 98, 0, 69, 108, 101, 99, 116, 114, 111, 100, 101, 0, 69, 120, 101, 103, 103, 99, 117, 116, 101, 0, 69, 120, 101, 103, 103, 117, 116, 111, 114, 0, 67, 117, 98, 111, 110, 101, 0, 77, 97, 114, 111, 119, 97, 107, 0, 72, 105, 116, 109, 111, 110, 108, 101, 101, 0, 72, 105, 116, 109, 111, 110, 99, 104, 97, 110, 0, 76, 105, 99, 107, 105, 116, 117, 110, 103, 0, 75, 111, 102, 102, 105, 110, 103, 0, 87, 101, 101, 122, 105, 110, 103, 0, 82, 104, 121, 104, 111, 114, 110, 0, 82, 104, 121, 100, 111, 110, 0, 67, 104, 97, 110, 115, 101, 121, 0, 84, 97, 110, 103, 101, 108, 97, 0, 75, 97, 110, 103, 97, 115, 107, 104, 97, 110, 0, 72, 111, 114, 115, 101, 97, 0, 83, 101, 97, 100, 114, 97, 0, 71, 111, 108, 100, 101, 101, 110, 0, 83, 101, 97, 107, 105, 110, 103, 0, 83, 116, 97, 114, 121, 117, 0, 83, 116, 97, 114, 109, 105, 101, 0, 77, 114, 46, 32, 77, 105, 109, 101, 0, 83, 99, 121, 116, 104, 101, 114, 0, 74, 121, 110, 120, 0, 69, 108, 101, 99, 116, 97, 98, 117, 122, 122, 0, 77, 97, 103, 109, 97, 114, 0, 80, 105, 110, 115, 105, 114, 0, 84, 97, 117, 114, 111, 115, 0, 77, 97, 103, 105, 107, 97, 114, 112, 0, 71, 121, 97, 114, 97, 100, 111, 115, 0, 76, 97, 112, 114, 97, 115, 0, 68, 105, 116, 116, 111, 0, 69, 101, 118, 101, 101, 0, 86, 97, 112, 111, 114, 101, 111, 110, 0, 74, 111, 108, 116, 101, 111, 110, 0, 70, 108, 97, 114, 101, 111, 110, 0, 80, 111, 114, 121, 103, 111, 110, 0, 79, 109, 97, 110, 121, 116, 101, 0, 79, 109, 97, 115, 116, 97, 114, 0, 75, 97, 98, 117, 116, 111, 0, 75, 97, 98, 117, 116, 111, 112, 115, 0, 65, 101, 114, 111, 100, 97, 99, 116, 121, 108, 0, 83, 110, 111, 114, 108, 97, 120, 0, 65, 114, 116, 105, 99, 117, 110, 111, 0, 90, 97, 112, 100, 111, 115, 0, 77, 111, 108, 116, 114, 101, 115, 0, 68, 114, 97, 116, 105, 110, 105, 0, 68, 114, 97, 103, 111, 110, 97, 105, 114, 0, 68, 114, 97, 103, 111, 110, 105, 116, 101, 0, 77, 101, 119, 116, 119, 111, 0, 77, 101, 119, 0, 67, 104, 105, 107, 111, 114, 105, 116, 97, 0, 66, 97, 121, 108, 101, 101, 102, 0, 77, 101, 103, 97, 110, 105, 117, 109, 0, 67, 121, 110, 100, 97, 113, 117, 105, 108, 0, 81, 117, 105, 108, 97, 118, 97, 0, 84, 121, 112, 104, 108, 111, 115, 105, 111, 110, 0, 84, 111, 116, 111, 100, 105, 108, 101, 0, 67, 114, 111, 99, 111, 110, 97, 119, 0, 70, 101, 114, 97, 108, 105, 103, 97, 116, 114, 0, 83, 101, 110, 116, 114, 101, 116, 0, 70, 117, 114, 114, 101, 116, 0, 72, 111, 111, 116, 104, 111, 111, 116, 0, 78, 111, 99, 116, 111, 119, 108, 0, 76, 101, 100, 121, 98, 97, 0, 76, 101, 100, 105, 97, 110, 0, 83, 112, 105, 110, 97, 114, 97, 107, 0, 65, 114, 105, 97, 100, 111, 115, 0, 67, 114, 111, 98, 97, 116, 0, 67, 104, 105, 110, 99, 104, 111, 117, 0, 76, 97, 110, 116, 117, 114, 110, 0, 80, 105, 99, 104, 117, 0, 67, 108, 101, 102, 102, 97, 0, 73, 103, 103, 108, 121, 98, 117, 102, 102, 0, 84, 111, 103, 101, 112, 105, 0, 84, 111, 103, 101, 116, 105, 99, 0, 78, 97, 116, 117, 0, 88, 97, 116, 117, 0, 77, 97, 114, 101, 101, 112, 0, 70, 108, 97, 97, 102, 102, 121, 0, 65, 109, 112, 104, 97, 114, 111, 115, 0, 66, 101, 108, 108, 111, 115, 115, 111, 109, 0, 77, 97, 114, 105, 108, 108, 0, 65, 122, 117, 109, 97, 114, 105, 108, 108, 0, 83, 117, 100, 111, 119, 111, 111, 100, 111, 0, 80, 111, 108, 105, 116, 111, 101, 100, 0, 72, 111, 112, 112, 105, 112, 0, 83, 107, 105, 112, 108, 111, 111, 109, 0, 74, 117, 109, 112, 108, 117, 102, 102, 0, 65, 105, 112, 111, 109, 0, 83, 117, 110, 107, 101, 114, 110, 0, 83, 117, 110, 102, 108, 111, 114, 97, 0, 89, 97, 110, 109, 97, 0, 87, 111, 111, 112, 101, 114, 0, 81, 117, 97, 103, 115, 105, 114, 101, 0, 69, 115, 112, 101, 111, 110, 0, 85, 109, 98, 114, 101, 111, 110, 0, 77, 117, 114, 107, 114, 111, 119, 0, 83, 108, 111, 119, 107, 105, 110, 103, 0, 77, 105, 115, 100, 114, 101, 97, 118, 117, 115, 0, 85, 110, 111, 119, 110, 0, 87, 111, 98, 98, 117, 102, 102, 101, 116, 0, 71, 105, 114, 97, 102, 97, 114, 105, 103, 0, 80, 105, 110, 101, 99, 111, 0, 70, 111, 114, 114, 101, 116, 114, 101, 115, 115, 0, 68, 117, 110, 115, 112, 97, 114, 99, 101, 0, 71, 108, 105, 103, 97, 114, 0, 83, 116, 101, 101, 108, 105, 120, 0, 83, 110, 117, 98, 98, 117, 108, 108, 0, 71, 114, 97, 110, 98, 117, 108, 108, 0, 81, 119, 105, 108, 102, 105, 115, 104, 0, 83, 99, 105, 122, 111, 114, 0, 83, 104, 117, 99, 107, 108, 101, 0, 72, 101, 114, 97, 99, 114, 111, 115, 115, 0, 83, 110, 101, 97, 115, 101, 108, 0, 84, 101, 100, 100, 105, 117, 114, 115, 97, 0, 85, 114, 115, 97, 114, 105, 110, 103, 0, 83, 108, 117, 103, 109, 97, 0, 77, 97, 103, 99, 97, 114, 103, 111, 0, 83, 119, 105, 110, 117, 98, 0, 80, 105, 108, 111, 115, 119, 105, 110, 101, 0, 67, 111, 114, 115, 111, 108, 97, 0, 82, 101, 109, 111, 114, 97, 105, 100, 0, 79, 99, 116, 105, 108, 108, 101, 114, 121, 0, 68, 101, 108, 105, 98, 105, 114, 100, 0, 77, 97, 110, 116, 105, 110, 101, 0, 83, 107, 97, 114, 109, 111, 114, 121, 0, 72, 111, 117, 110, 100, 111, 117, 114, 0, 72, 111, 117, 110, 100, 111, 111, 109, 0, 75, 105, 110, 103, 100, 114, 97, 0, 80, 104, 97, 110, 112, 121, 0, 68, 111, 110, 112, 104, 97, 110, 0, 80, 111, 114, 121, 103, 111, 110, 50, 0, 83, 116, 97, 110, 116, 108, 101, 114, 0, 83, 109, 101, 97, 114, 103, 108, 101, 0, 84, 121, 114, 111, 103, 117, 101, 0, 72, 105, 116, 109, 111, 110, 116, 111, 112, 0, 83, 109, 111, 111, 99, 104, 117, 109, 0, 69, 108, 101, 107, 105, 100, 0, 77, 97, 103, 98, 121, 0, 77, 105, 108, 116, 97, 110, 107, 0, 66, 108, 105, 115, 115, 101, 121, 0, 82, 97, 105, 107, 111, 117, 0, 69, 110, 116, 101, 105, 0, 83, 117, 105, 99, 117, 110, 101, 0, 76, 97, 114, 118, 105, 116, 97, 114, 0, 80, 117, 112, 105, 116, 97, 114, 0, 84, 121, 114, 97, 110, 105, 116, 97, 114, 0, 76, 117, 103, 105, 97, 0, 72, 111, 45, 79, 104, 0, 67, 101, 108, 101, 98, 105, 0, 84, 114, 101, 101, 99, 107, 111, 0, 71, 114, 111, 118, 121, 108, 101, 0, 83, 99, 101, 112, 116, 105, 108, 101, 0, 84, 111, 114, 99, 104, 105, 99, 0, 67, 111, 109, 98, 117, 115, 107, 101, 110, 0, 66, 108, 97, 122, 105, 107, 101, 110, 0, 77, 117, 100, 107, 105, 112, 0, 77, 97, 114, 115, 104, 116, 111, 109, 112, 0, 83, 119, 97, 109, 112, 101, 114, 116, 0, 80, 111, 111, 99, 104, 121, 101, 110, 97, 0, 77, 105, 103, 104, 116, 121, 101, 110, 97, 0, 90, 105, 103, 122, 97, 103, 111, 111, 110, 0, 76, 105, 110, 111, 111, 110, 101, 0, 87, 117, 114, 109, 112, 108, 101, 0, 83, 105, 108, 99, 111, 111, 110, 0, 66, 101, 97, 117, 116, 105, 102, 108, 121, 0, 67, 97, 115, 99, 111, 111, 110, 0, 68, 117, 115, 116, 111, 120, 0, 76, 111, 116, 97, 100, 0, 76, 111, 109, 98, 114, 101, 0, 76, 117, 100, 105, 99, 111, 108, 111, 0, 83, 101, 101, 100, 111, 116, 0, 78, 117, 122, 108, 101, 97, 102, 0, 83, 104, 105, 102, 116, 114, 121, 0, 84, 97, 105, 108, 108, 111, 119, 0, 83, 119, 101, 108, 108, 111, 119, 0, 87, 105, 110, 103, 117, 108, 108, 0, 80, 101, 108, 105, 112, 112, 101, 114, 0, 82, 97, 108, 116, 115, 0, 75, 105, 114, 108, 105, 97, 0, 71, 97, 114, 100, 101, 118, 111, 105, 114, 0, 83, 117, 114, 115, 107, 105, 116, 0, 77, 97, 115, 113, 117, 101, 114, 97, 105, 110, 0, 83, 104, 114, 111, 111, 109, 105, 115, 104, 0, 66, 114, 101, 108, 111, 111, 109, 0, 83, 108, 97, 107, 111, 116, 104, 0, 86, 105, 103, 111, 114, 111, 116, 104, 0, 83, 108, 97, 107, 105, 110, 103, 0, 78, 105, 110, 99, 97, 100, 97, 0, 78, 105, 110, 106, 97, 115, 107, 0, 83, 104, 101, 100, 105, 110, 106, 97, 0, 87, 104, 105, 115, 109, 117, 114, 0, 76, 111, 117, 100, 114, 101, 100, 0, 69, 120, 112, 108, 111, 117, 100, 0, 77, 97, 107, 117, 104, 105, 116, 97, 0, 72, 97, 114, 105, 121, 97, 109, 97, 0, 65, 122, 117, 114, 105, 108, 108, 0, 78, 111, 115, 101, 112, 97, 115, 115, 0, 83, 107, 105, 116, 116, 121, 0, 68, 101, 108, 99, 97, 116, 116, 121, 0, 83, 97, 98, 108, 101, 121, 101, 0, 77, 97, 119, 105, 108, 101, 0, 65, 114, 111, 110, 0, 76, 97, 105, 114, 111, 110, 0, 65, 103, 103, 114, 111, 110, 0, 77, 101, 100, 105, 116, 105, 116, 101, 0, 77, 101, 100, 105, 99, 104, 97, 109, 0, 69, 108, 101, 99, 116, 114, 105, 107, 101, 0, 77, 97, 110, 101, 99, 116, 114, 105, 99, 0, 80, 108, 117, 115, 108, 101, 0, 77, 105, 110, 117, 110, 0, 86, 111, 108, 98, 101, 97, 116, 0, 73, 108, 108, 117, 109, 105, 115, 101, 0, 82, 111, 115, 101, 108, 105, 97, 0, 71, 117, 108, 112, 105, 110, 0, 83, 119, 97, 108, 111, 116, 0, 67, 97, 114, 118, 97, 110, 104, 97, 0, 83, 104, 97, 114, 112, 101, 100, 111, 0, 87, 97, 105, 108, 109, 101, 114, 0, 87, 97, 105, 108, 111, 114, 100, 0, 78, 117, 109, 101, 108, 0, 67, 97, 109, 101, 114, 117, 112, 116, 0, 84, 111, 114, 107, 111, 97, 108, 0, 83, 112, 111, 105, 110, 107, 0, 71, 114, 117, 109, 112, 105, 103, 0, 83, 112, 105, 110, 100, 97, 0, 84, 114, 97, 112, 105, 110, 99, 104, 0, 86, 105, 98, 114, 97, 118, 97, 0, 70, 108, 121, 103, 111, 110, 0, 67, 97, 99, 110, 101, 97, 0, 67, 97, 99, 116, 117, 114, 110, 101, 0, 83, 119, 97, 98, 108, 117, 0, 65, 108, 116, 97, 114, 105, 97, 0, 90, 97, 110, 103, 111, 111, 115, 101, 0, 83, 101, 118, 105, 112, 101, 114, 0, 76, 117, 110, 97, 116, 111, 110, 101, 0, 83, 111, 108, 114, 111, 99, 107, 0, 66, 97, 114, 98, 111, 97, 99, 104, 0, 87, 104, 105, 115, 99, 97, 115, 104, 0, 67, 111, 114, 112, 104, 105, 115, 104, 0, 67, 114, 97, 119, 100, 97, 117, 110, 116, 0, 66, 97, 108, 116, 111, 121, 0, 67, 108, 97, 121, 100, 111, 108, 0, 76, 105, 108, 101, 101, 112, 0, 67, 114, 97, 100, 105, 108, 121, 0, 65, 110, 111, 114, 105, 116, 104, 0, 65, 114, 109, 97, 108, 100, 111, 0, 70, 101, 101, 98, 97, 115, 0, 77, 105, 108, 111, 116, 105, 99, 0, 67, 97, 115, 116, 102, 111, 114, 109, 0, 75, 101, 99, 108, 101, 111, 110, 0, 83, 104, 117, 112, 112, 101, 116, 0, 66, 97, 110, 101, 116, 116, 101, 0, 68, 117, 115, 107, 117, 108, 108, 0, 68, 117, 115, 99, 108, 111, 112, 115, 0, 84, 114, 111, 112, 105, 117, 115, 0, 67, 104, 105, 109, 101, 99, 104, 111, 0, 65, 98, 115, 111, 108, 0, 87, 121, 110, 97, 117, 116, 0, 83, 110, 111, 114, 117, 110, 116, 0, 71, 108, 97, 108, 105, 101, 0, 83, 112, 104, 101, 97, 108, 0, 83, 101, 97, 108, 101, 111, 0, 87, 97, 108, 114, 101, 105, 110, 0, 67, 108, 97, 109, 112, 101, 114, 108, 0, 72, 117, 110, 116, 97, 105, 108, 0, 71, 111, 114, 101, 98, 121, 115, 115, 0, 82, 101, 108, 105, 99, 97, 110, 116, 104, 0, 76, 117, 118, 100, 105, 115, 99, 0, 66, 97, 103, 111, 110, 0, 83, 104, 101, 108, 103, 111, 110, 0, 83, 97, 108, 97, 109, 101, 110, 99, 101, 0, 66, 101, 108, 100, 117, 109, 0, 77, 101, 116, 97, 110, 103, 0, 77, 101, 116, 97, 103, 114, 111, 115, 115, 0, 82, 101, 103, 105, 114, 111, 99, 107, 0, 82, 101, 103, 105, 99, 101, 0, 82, 101, 103, 105, 115, 116, 101, 101, 108, 0, 76, 97, 116, 105, 97, 115, 0, 76, 97, 116, 105, 111, 115, 0, 75, 121, 111, 103, 114, 101, 0, 71, 114, 111, 117, 100, 111, 110, 0, 82, 97, 121, 113, 117, 97, 122, 97, 0, 74, 105, 114, 97, 99, 104, 105, 0, 68, 101, 111, 120, 121, 115, 0, 84, 117, 114, 116, 119, 105, 103, 0, 71, 114, 111, 116, 108, 101, 0, 84, 111, 114, 116, 101, 114, 114, 97, 0, 67, 104, 105, 109, 99, 104, 97, 114, 0, 77, 111, 110, 102, 101, 114, 110, 111, 0, 73, 110, 102, 101, 114, 110, 97, 112, 101, 0, 80, 105, 112, 108, 117, 112, 0, 80, 114, 105, 110, 112, 108, 117, 112, 0, 69, 109, 112, 111, 108, 101, 111, 110, 0, 83, 116, 97, 114, 108, 121, 0, 83, 116, 97, 114, 97, 118, 105, 97, 0, 83, 116, 97, 114, 97, 112, 116, 111, 114, 0, 66, 105, 100, 111, 111, 102, 0, 66, 105, 98, 97, 114, 101, 108, 0, 75, 114, 105, 99, 107, 101, 116, 111, 116, 0, 75, 114, 105, 99, 107, 101, 116, 117, 110, 101, 0, 83, 104, 105, 110, 120, 0, 76, 117, 120, 105, 111, 0, 76, 117, 120, 114, 97, 121, 0, 66, 117, 100, 101, 119, 0, 82, 111, 115, 101, 114, 97, 100, 101, 0, 67, 114, 97, 110, 105, 100, 111, 115, 0, 82, 97, 109, 112, 97, 114, 100, 111, 115, 0, 83, 104, 105, 101, 108, 100, 111, 110, 0, 66, 97, 115, 116, 105, 111, 100, 111, 110, 0, 66, 117, 114, 109, 121, 0, 87, 111, 114, 109, 97, 100, 97, 109, 0, 77, 111, 116, 104, 105, 109, 0, 67, 111, 109, 98, 101, 101, 0, 86, 101, 115, 112, 105, 113, 117, 101, 110, 0, 80, 97, 99, 104, 105, 114, 105, 115, 117, 0, 66, 117, 105, 122, 101, 108, 0, 70, 108, 111, 97, 116, 122, 101, 108, 0, 67, 104, 101, 114, 117, 98, 105, 0, 67, 104, 101, 114, 114, 105, 109, 0, 83, 104, 101, 108, 108, 111, 115, 0, 71, 97, 115, 116, 114, 111, 100, 111, 110, 0, 65, 109, 98, 105, 112, 111, 109, 0, 68, 114, 105, 102, 108, 111, 111, 110, 0, 68, 114, 105, 102, 98, 108, 105, 109, 0, 66, 117, 110, 101, 97, 114, 121, 0, 76, 111, 112, 117, 110, 110, 121, 0, 77, 105, 115, 109, 97, 103, 105, 117, 115, 0, 72, 111, 110, 99, 104, 107, 114, 111, 119, 0, 71, 108, 97, 109, 101, 111, 119, 0, 80, 117, 114, 117, 103, 108, 121, 0, 67, 104, 105, 110, 103, 108, 105, 110, 103, 0, 83, 116, 117, 110, 107, 121, 0, 83, 107, 117, 110, 116, 97, 110, 107, 0, 66, 114, 111, 110, 122, 111, 114, 0, 66, 114, 111, 110, 122, 111, 110, 103, 0, 66, 111, 110, 115, 108, 121, 0, 77, 105, 109, 101, 32, 74, 114, 46, 0, 72, 97, 112, 112, 105, 110, 121, 0, 67, 104, 97, 116, 111, 116, 0, 83, 112, 105, 114, 105, 116, 111, 109, 98, 0, 71, 105, 98, 108, 101, 0, 71, 97, 98, 105, 116, 101, 0, 71, 97, 114, 99, 104, 111, 109, 112, 0, 77, 117, 110, 99, 104, 108, 97, 120, 0, 82, 105, 111, 108, 117, 0, 76, 117, 99, 97, 114, 105, 111, 0, 72, 105, 112, 112, 111, 112, 111, 116, 97, 115, 0, 72, 105, 112, 112, 111, 119, 100, 111, 110, 0, 83, 107, 111, 114, 117, 112, 105, 0, 68, 114, 97, 112, 105, 111, 110, 0, 67, 114, 111, 97, 103, 117, 110, 107, 0, 84, 111, 120, 105, 99, 114, 111, 97, 107, 0, 67, 97, 114, 110, 105, 118, 105, 110, 101, 0, 70, 105, 110, 110, 101, 111, 110, 0, 76, 117, 109, 105, 110, 101, 111, 110, 0, 77, 97, 110, 116, 121, 107, 101, 0, 83, 110, 111, 118, 101, 114, 0, 65, 98, 111, 109, 97, 115, 110, 111, 119, 0, 87, 101, 97, 118, 105, 108, 101, 0, 77, 97, 103, 110, 101, 122, 111, 110, 101, 0, 76, 105, 99, 107, 105, 108, 105, 99, 107, 121, 0, 82, 104, 121, 112, 101, 114, 105, 111, 114, 0, 84, 97, 110, 103, 114, 111, 119, 116, 104, 0, 69, 108, 101, 99, 116, 105, 118, 105, 114, 101, 0, 77, 97, 103, 109, 111, 114, 116, 97, 114, 0, 84, 111, 103, 101, 107, 105, 115, 115, 0, 89, 97, 110, 109, 101, 103, 97, 0, 76, 101, 97, 102, 101, 111, 110, 0, 71, 108, 97, 99, 101, 111, 110, 0, 71, 108, 105, 115, 99, 111, 114, 0, 77, 97, 109, 111, 115, 119, 105, 110, 101, 0, 80, 111, 114, 121, 103, 111, 110, 45, 90, 0, 71, 97, 108, 108, 97, 100, 101, 0, 80, 114, 111, 98, 111, 112, 97, 115, 115, 0, 68, 117, 115, 107, 110, 111, 105, 114, 0, 70, 114, 111, 115, 108, 97, 115, 115, 0, 82, 111, 116, 111, 109, 0, 85, 120, 105, 101, 0, 77, 101, 115, 112, 114, 105, 116, 0, 65, 122, 101, 108, 102, 0, 68, 105, 97, 108, 103, 97, 0, 80, 97, 108, 107, 105, 97, 0, 72, 101, 97, 116, 114, 97, 110, 0, 82, 101, 103, 105, 103, 105, 103, 97, 115, 0, 71, 105, 114, 97, 116, 105, 110, 97, 0, 67, 114, 101, 115, 115, 101, 108, 105, 97, 0, 80, 104, 105, 111, 110, 101, 0, 77, 97, 110, 97, 112, 104, 121, 0, 68, 97, 114, 107, 114, 97, 105, 0, 83, 104, 97, 121, 109, 105, 110, 0, 65, 114, 99, 101, 117, 115, 0, 86, 105, 99, 116, 105, 110, 105, 0, 83, 110, 105, 118, 121, 0, 83, 101, 114, 118, 105, 110, 101, 0, 83, 101, 114, 112, 101, 114, 105, 111, 114, 0, 84, 101, 112, 105, 103, 0, 80, 105, 103, 110, 105, 116, 101, 0, 69, 109, 98, 111, 97, 114, 0, 79, 115, 104, 97, 119, 111, 116, 116, 0, 68, 101, 119, 111, 116, 116, 0, 83, 97, 109, 117, 114, 111, 116, 116, 0, 80, 97, 116, 114, 97, 116, 0, 87, 97, 116, 99, 104, 111, 103, 0, 76, 105, 108, 108, 105, 112, 117, 112, 0, 72, 101, 114, 100, 105, 101, 114, 0, 83, 116, 111, 117, 116, 108, 97, 110, 100, 0, 80, 117, 114, 114, 108, 111, 105, 110, 0, 76, 105, 101, 112, 97, 114, 100, 0, 80, 97, 110, 115, 97, 103, 101, 0, 83, 105, 109, 105, 115, 97, 103, 101, 0, 80, 97, 110, 115, 101, 97, 114, 0, 83, 105, 109, 105, 115, 101, 97, 114, 0, 80, 97, 110, 112, 111, 117, 114, 0, 83, 105, 109, 105, 112, 111, 117, 114, 0, 77, 117, 110, 110, 97, 0, 77, 117, 115, 104, 97, 114, 110, 97, 0, 80, 105, 100, 111, 118, 101, 0, 84, 114, 97, 110, 113, 117, 105, 108, 108, 0, 85, 110, 102, 101, 122, 97, 110, 116, 0, 66, 108, 105, 116, 122, 108, 101, 0, 90, 101, 98, 115, 116, 114, 105, 107, 97, 0, 82, 111, 103, 103, 101, 110, 114, 111, 108, 97, 0, 66, 111, 108, 100, 111, 114, 101, 0, 71, 105, 103, 97, 108, 105, 116, 104, 0, 87, 111, 111, 98, 97, 116, 0, 83, 119, 111, 111, 98, 97, 116, 0, 68, 114, 105, 108, 98, 117, 114, 0, 69, 120, 99, 97, 100, 114, 105, 108, 108, 0, 65, 117, 100, 105, 110, 111, 0, 84, 105, 109, 98, 117, 114, 114, 0, 71, 117, 114, 100, 117, 114, 114, 0, 67, 111, 110, 107, 101, 108, 100, 117, 114, 114, 0, 84, 121, 109, 112, 111, 108, 101, 0, 80, 97, 108, 112, 105, 116, 111, 97, 100, 0, 83, 101, 105, 115, 109, 105, 116, 111, 97, 100, 0, 84, 104, 114, 111, 104, 0, 83, 97, 119, 107, 0, 83, 101, 119, 97, 100, 100, 108, 101, 0, 83, 119, 97, 100, 108, 111, 111, 110, 0, 76, 101, 97, 118, 97, 110, 110, 121, 0, 86, 101, 110, 105, 112, 101, 100, 101, 0, 87, 104, 105, 114, 108, 105, 112, 101, 100, 101, 0, 83, 99, 111, 108, 105, 112, 101, 100, 101, 0, 67, 111, 116, 116, 111, 110, 101, 101, 0, 87, 104, 105, 109, 115, 105, 99, 111, 116, 116, 0, 80, 101, 116, 105, 108, 105, 108, 0, 76, 105, 108, 108, 105, 103, 97, 110, 116, 0, 66, 97, 115, 99, 117, 108, 105, 110, 0, 83, 97, 110, 100, 105, 108, 101, 0, 75, 114, 111, 107, 111, 114, 111, 107, 0, 75, 114, 111, 111, 107, 111, 100, 105, 108, 101, 0, 68, 97, 114, 117, 109, 97, 107, 97, 0, 68, 97, 114, 109, 97, 110, 105, 116, 97, 110, 0, 77, 97, 114, 97, 99, 116, 117, 115, 0, 68, 119, 101, 98, 98, 108, 101, 0, 67, 114, 117, 115, 116, 108, 101, 0, 83, 99, 114, 97, 103, 103, 121, 0, 83, 99, 114, 97, 102, 116, 121, 0, 83, 105, 103, 105, 108, 121, 112, 104, 0, 89, 97, 109, 97, 115, 107, 0, 67, 111, 102, 97, 103, 114, 105, 103, 117, 115, 0, 84, 105, 114, 116, 111, 117, 103, 97, 0, 67, 97, 114, 114, 97, 99, 111, 115, 116, 97, 0, 65, 114, 99, 104, 101, 110, 0, 65, 114, 99, 104, 101, 111, 112, 115, 0, 84, 114, 117, 98, 98, 105, 115, 104, 0, 71, 97, 114, 98, 111, 100, 111, 114, 0, 90, 111, 114, 117, 97, 0, 90, 111, 114, 111, 97, 114, 107, 0, 77, 105, 110, 99, 99, 105, 110, 111, 0, 67, 105, 110, 99, 99, 105, 110, 111, 0, 71, 111, 116, 104, 105, 116, 97, 0, 71, 111, 116, 104, 111, 114, 105, 116, 97, 0, 71, 111, 116, 104, 105, 116, 101, 108, 108, 101, 0, 83, 111, 108, 111, 115, 105, 115, 0, 68, 117, 111, 115, 105, 111, 110, 0, 82, 101, 117, 110, 105, 99, 108, 117, 115, 0, 68, 117, 99, 107, 108, 101, 116, 116, 0, 83, 119, 97, 110, 110, 97, 0, 86, 97, 110, 105, 108, 108, 105, 116, 101, 0, 86, 97, 110, 105, 108, 108, 105, 115, 104, 0, 86, 97, 110, 105, 108, 108, 117, 120, 101, 0, 68, 101, 101, 114, 108, 105, 110, 103, 0, 83, 97, 119, 115, 98, 117, 99, 107, 0, 69, 109, 111, 108, 103, 97, 0, 75, 97, 114, 114, 97, 98, 108, 97, 115, 116, 0, 69, 115, 99, 97, 118, 97, 108, 105, 101, 114, 0, 70, 111, 111, 110, 103, 117, 115, 0, 65, 109, 111, 111, 110, 103, 117, 115, 115, 0, 70, 114, 105, 108, 108, 105, 115, 104, 0, 74, 101, 108, 108, 105, 99, 101, 110, 116, 0, 65, 108, 111, 109, 111, 109, 111, 108, 97, 0, 74, 111, 108, 116, 105, 107, 0, 71, 97, 108, 118, 97, 110, 116, 117, 108, 97, 0, 70, 101, 114, 114, 111, 115, 101, 101, 100, 0, 70, 101, 114, 114, 111, 116, 104, 111, 114, 110, 0, 75, 108, 105, 110, 107, 0, 75, 108, 97, 110, 103, 0, 75, 108, 105, 110, 107, 108, 97, 110, 103, 0, 84, 121, 110, 97, 109, 111, 0, 69, 101, 108, 101, 107, 116, 114, 105, 107, 0, 69, 101, 108, 101, 107, 116, 114, 111, 115, 115, 0, 69, 108, 103, 121, 101, 109, 0, 66, 101, 104, 101, 101, 121, 101, 109, 0, 76, 105, 116, 119, 105, 99, 107, 0, 76, 97, 109, 112, 101, 110, 116, 0, 67, 104, 97, 110, 100, 101, 108, 117, 114, 101, 0, 65, 120, 101, 119, 0, 70, 114, 97, 120, 117, 114, 101, 0, 72, 97, 120, 111, 114, 117, 115, 0, 67, 117, 98, 99, 104, 111, 111, 0, 66, 101, 97, 114, 116, 105, 99, 0, 67, 114, 121, 111, 103, 111, 110, 97, 108, 0, 83, 104, 101, 108, 109, 101, 116, 0, 65, 99, 99, 101, 108, 103, 111, 114, 0, 83, 116, 117, 110, 102, 105, 115, 107, 0, 77, 105, 101, 110, 102, 111, 111, 0, 77, 105, 101, 110, 115, 104, 97, 111, 0, 68, 114, 117, 100, 100, 105, 103, 111, 110, 0, 71, 111, 108, 101, 116, 116, 0, 71, 111, 108, 117, 114, 107, 0, 80, 97, 119, 110, 105, 97, 114, 100, 0, 66, 105, 115, 104, 97, 114, 112, 0, 66, 111, 117, 102, 102, 97, 108, 97, 110, 116, 0, 82, 117, 102, 102, 108, 101, 116, 0, 66, 114, 97, 118, 105, 97, 114, 121, 0, 86, 117, 108, 108, 97, 98, 121, 0, 77, 97, 110, 100, 105, 98, 117, 122, 122, 0, 72, 101, 97, 116, 109, 111, 114, 0, 68, 117, 114, 97, 110, 116, 0, 68, 101, 105, 110, 111, 0, 90, 119, 101, 105, 108, 111, 117, 115, 0, 72, 121, 100, 114, 101, 105, 103, 111, 110, 0, 76, 97, 114, 118, 101, 115, 116, 97, 0, 86, 111, 108, 99, 97, 114, 111, 110, 97, 0, 67, 111, 98, 97, 108, 105, 111, 110, 0, 84, 101, 114, 114, 97, 107, 105, 111, 110, 0, 86, 105, 114, 105, 122, 105, 111, 110, 0, 84, 111, 114, 110, 97, 100, 117, 115, 0, 84, 104, 117, 110, 100, 117, 114, 117, 115, 0, 82, 101, 115, 104, 105, 114, 97, 109, 0, 90, 101, 107, 114, 111, 109, 0, 76, 97, 110, 100, 111, 114, 117, 115, 0, 75, 121, 117, 114, 101, 109, 0, 75, 101, 108, 100, 101, 111, 0, 77, 101, 108, 111, 101, 116, 116, 97, 0, 71, 101, 110, 101, 115, 101, 99, 116, 0, 67, 104, 101, 115, 112, 105, 110, 0, 81, 117, 105, 108, 108, 97, 100, 105, 110, 0, 67, 104, 101, 115, 110, 97, 117, 103, 104, 116, 0, 70, 101, 110, 110, 101, 107, 105, 110, 0, 66, 114, 97, 105, 120, 101, 110, 0, 68, 101, 108, 112, 104, 111, 120, 0, 70, 114, 111, 97, 107, 105, 101, 0, 70, 114, 111, 103, 97, 100, 105, 101, 114, 0, 71, 114, 101, 110, 105, 110, 106, 97, 0, 66, 117, 110, 110, 101, 108, 98, 121, 0, 68, 105, 103, 103, 101, 114, 115, 98, 121, 0, 70, 108, 101, 116, 99, 104, 108, 105, 110, 103, 0, 70, 108, 101, 116, 99, 104, 105, 110, 100, 101, 114, 0, 84, 97, 108, 111, 110, 102, 108, 97, 109, 101, 0, 83, 99, 97, 116, 116, 101, 114, 98, 117, 103, 0, 83, 112, 101, 119, 112, 97, 0, 86, 105, 118, 105, 108, 108, 111, 110, 0, 76, 105, 116, 108, 101, 111, 0, 80, 121, 114, 111, 97, 114, 0, 70, 108, 97, 98, 195, 169, 98, 195, 169, 0, 70, 108, 111, 101, 116, 116, 101, 0, 70, 108, 111, 114, 103, 101, 115, 0, 83, 107, 105, 100, 100, 111, 0, 71, 111, 103, 111, 97, 116, 0, 80, 97, 110, 99, 104, 97, 109, 0, 80, 97, 110, 103, 111, 114, 111, 0, 70, 117, 114, 102, 114, 111, 117, 0, 69, 115, 112, 117, 114, 114, 0, 77, 101, 111, 119, 115, 116, 105, 99, 0, 72, 111, 110, 101, 100, 103, 101, 0, 68, 111, 117, 98, 108, 97, 100, 101, 0, 65, 101, 103, 105, 115, 108, 97, 115, 104, 0, 83, 112, 114, 105, 116, 122, 101, 101, 0, 65, 114, 111, 109, 97, 116, 105, 115, 115, 101, 0, 83, 119, 105, 114, 108, 105, 120, 0, 83, 108, 117, 114, 112, 117, 102, 102, 0, 73, 110, 107, 97, 121, 0, 77, 97, 108, 97, 109, 97, 114, 0, 66, 105, 110, 97, 99, 108, 101, 0, 66, 97, 114, 98, 97, 114, 97, 99, 108, 101, 0, 83, 107, 114, 101, 108, 112, 0, 68, 114, 97, 103, 97, 108, 103, 101, 0, 67, 108, 97, 117, 110, 99, 104, 101, 114, 0, 67, 108, 97, 119, 105, 116, 122, 101, 114, 0, 72, 101, 108, 105, 111, 112, 116, 105, 108, 101, 0, 72, 101, 108, 105, 111, 108, 105, 115, 107, 0, 84, 121, 114, 117, 110, 116, 0, 84, 121, 114, 97, 110, 116, 114, 117, 109, 0, 65, 109, 97, 117, 114, 97, 0, 65, 117, 114, 111, 114, 117, 115, 0, 83, 121, 108, 118, 101, 111, 110, 0, 72, 97, 119, 108, 117, 99, 104, 97, 0, 68, 101, 100, 101, 110, 110, 101, 0, 67, 97, 114, 98, 105, 110, 107, 0, 71, 111, 111, 109, 121, 0, 83, 108, 105, 103, 103, 111, 111, 0, 71, 111, 111, 100, 114, 97, 0, 75, 108, 101, 102, 107, 105, 0, 80, 104, 97, 110, 116, 117, 109, 112, 0, 84, 114, 101, 118, 101, 110, 97, 110, 116, 0, 80, 117, 109, 112, 107, 97, 98, 111, 111, 0, 71, 111, 117, 114, 103, 101, 105, 115, 116, 0, 66, 101, 114, 103, 109, 105, 116, 101, 0, 65, 118, 97, 108, 117, 103, 103, 0, 78, 111, 105, 98, 97, 116, 0, 78, 111, 105, 118, 101, 114, 110, 0, 88, 101, 114, 110, 101, 97, 115, 0, 89, 118, 101, 108, 116, 97, 108, 0, 90, 121, 103, 97, 114, 100, 101, 0, 68, 105, 97, 110, 99, 105, 101, 0, 72, 111, 111, 112, 97, 0, 86, 111, 108, 99, 97, 110, 105, 111, 110, 0, 82, 111, 119, 108, 101, 116, 0, 68, 97, 114, 116, 114, 105, 120, 0, 68, 101, 99, 105, 100, 117, 101, 121, 101, 0, 76, 105, 116, 116, 101, 110, 0, 84, 111, 114, 114, 97, 99, 97, 116, 0, 73, 110, 99, 105, 110, 101, 114, 111, 97, 114, 0, 80, 111, 112, 112, 108, 105, 111, 0, 66, 114, 105, 111, 110, 110, 101, 0, 80, 114, 105, 109, 97, 114, 105, 110, 97, 0, 80, 105, 107, 105, 112, 101, 107, 0, 84, 114, 117, 109, 98, 101, 97, 107, 0, 84, 111, 117, 99, 97, 110, 110, 111, 110, 0, 89, 117, 110, 103, 111, 111, 115, 0, 71, 117, 109, 115, 104, 111, 111, 115, 0, 71, 114, 117, 98, 98, 105, 110, 0, 67, 104, 97, 114, 106, 97, 98, 117, 103, 0, 86, 105, 107, 97, 118, 111, 108, 116, 0, 67, 114, 97, 98, 114, 97, 119, 108, 101, 114, 0, 67, 114, 97, 98, 111, 109, 105, 110, 97, 98, 108, 101, 0, 79, 114, 105, 99, 111, 114, 105, 111, 0, 67, 117, 116, 105, 101, 102, 108, 121, 0, 82, 105, 98, 111, 109, 98, 101, 101, 0, 82, 111, 99, 107, 114, 117, 102, 102, 0, 76, 121, 99, 97, 110, 114, 111, 99, 0, 87, 105, 115, 104, 105, 119, 97, 115, 104, 105, 0, 77, 97, 114, 101, 97, 110, 105, 101, 0, 84, 111, 120, 97, 112, 101, 120, 0, 77, 117, 100, 98, 114, 97, 121, 0, 77, 117, 100, 115, 100, 97, 108, 101, 0, 68, 101, 119, 112, 105, 100, 101, 114, 0, 65, 114, 97, 113, 117, 97, 110, 105, 100, 0, 70, 111, 109, 97, 110, 116, 105, 115, 0, 76, 117, 114, 97, 110, 116, 105, 115, 0, 77, 111, 114, 101, 108, 117, 108, 108, 0, 83, 104, 105, 105, 110, 111, 116, 105, 99, 0, 83, 97, 108, 97, 110, 100, 105, 116, 0, 83, 97, 108, 97, 122, 122, 108, 101, 0, 83, 116, 117, 102, 102, 117, 108, 0, 66, 101, 119, 101, 97, 114, 0, 66, 111, 117, 110, 115, 119, 101, 101, 116, 0, 83, 116, 101, 101, 110, 101, 101, 0, 84, 115, 97, 114, 101, 101, 110, 97, 0, 67, 111, 109, 102, 101, 121, 0, 79, 114, 97, 110, 103, 117, 114, 117, 0, 80, 97, 115, 115, 105, 109, 105, 97, 110, 0, 87, 105, 109, 112, 111, 100, 0, 71, 111, 108, 105, 115, 111, 112, 111, 100, 0, 83, 97, 110, 100, 121, 103, 97, 115, 116, 0, 80, 97, 108, 111, 115, 115, 97, 110, 100, 0, 80, 121, 117, 107, 117, 109, 117, 107, 117, 0, 67, 195, 179, 100, 105, 103, 111, 32, 67, 101, 114, 111, 0, 83, 105, 108, 118, 97, 108, 108, 121, 0, 77, 105, 110, 105, 111, 114, 0, 75, 111, 109, 97, 108, 97, 0, 84, 117, 114, 116, 111, 110, 97, 116, 111, 114, 0, 84, 111, 103, 101, 100, 101, 109, 97, 114, 117, 0, 77, 105, 109, 105, 107, 121, 117, 0, 66, 114, 117, 120, 105, 115, 104, 0, 68, 114, 97, 109, 112, 97, 0, 68, 104, 101, 108, 109, 105, 115, 101, 0, 74, 97, 110, 103, 109, 111, 45, 111, 0, 72, 97, 107, 97, 109, 111, 45, 111, 0, 75, 111, 109, 109, 111, 45, 111, 0, 84, 97, 112, 117, 32, 75, 111, 107, 111, 0, 84, 97, 112, 117, 32, 76, 101, 108, 101, 0, 84, 97, 112, 117, 32, 66, 117, 108, 117, 0, 84, 97, 112, 117, 32, 70, 105, 110, 105, 0, 67, 111, 115, 109, 111, 103, 0, 67, 111, 115, 109, 111, 101, 109, 0, 83, 111, 108, 103, 97, 108, 101, 111, 0, 76, 117, 110, 97, 108, 97, 0, 78, 105, 104, 105, 108, 101, 103, 111, 0, 66, 117, 122, 122, 119, 111, 108, 101, 0, 80, 104, 101, 114, 111, 109, 111, 115, 97, 0, 88, 117, 114, 107, 105, 116, 114, 101, 101, 0, 67, 101, 108, 101, 115, 116, 101, 101, 108, 97, 0, 75, 97, 114, 116, 97, 110, 97, 0, 71, 117, 122, 122, 108, 111, 114, 100, 0, 78, 101, 99, 114, 111, 122, 109, 97, 0, 77, 97, 103, 101, 97, 114, 110, 97, 0, 77, 97, 114, 115, 104, 97, 100, 111, 119, 0, 80, 111, 105, 112, 111, 108, 101, 0, 78, 97, 103, 97, 110, 97, 100, 101, 108, 0, 83, 116, 97, 107, 97, 116, 97, 107, 97, 0, 66, 108, 97, 99, 101, 112, 104, 97, 108, 111, 110, 0, 90, 101, 114, 97, 111, 114, 97, 0 };
-
-constexpr std::array<u8, 518> characteristic_fr = { 78, 111, 110, 101, 0, 65, 100, 111, 114, 101, 32, 109, 97, 110, 103, 101, 114, 0, 83, 39, 97, 115, 115, 111, 117, 112, 105, 116, 32, 115, 111, 117, 118, 101, 110, 116, 0, 68, 111, 114, 116, 32, 98, 101, 97, 117, 99, 111, 117, 112, 0, 195, 137, 112, 97, 114, 112, 105, 108, 108, 101, 32, 108, 101, 115, 32, 99, 104, 111, 115, 101, 115, 0, 65, 105, 109, 101, 32, 115, 101, 32, 100, 195, 169, 116, 101, 110, 100, 114, 101, 0, 70, 105, 195, 168, 114, 101, 32, 100, 101, 32, 115, 97, 32, 112, 117, 105, 115, 115, 97, 110, 99, 101, 0, 65, 105, 109, 101, 32, 115, 101, 32, 100, 195, 169, 109, 101, 110, 101, 114, 0, 85, 110, 32, 112, 101, 117, 32, 99, 111, 108, 195, 169, 114, 101, 117, 120, 0, 65, 105, 109, 101, 32, 99, 111, 109, 98, 97, 116, 116, 114, 101, 0, 83, 39, 101, 109, 112, 111, 114, 116, 101, 32, 102, 97, 99, 105, 108, 101, 109, 101, 110, 116, 0, 67, 111, 114, 112, 115, 32, 114, 111, 98, 117, 115, 116, 101, 0, 83, 97, 105, 116, 32, 101, 110, 99, 97, 105, 115, 115, 101, 114, 32, 108, 101, 115, 32, 99, 111, 117, 112, 115, 0, 84, 114, 195, 168, 115, 32, 97, 115, 116, 117, 99, 105, 101, 117, 120, 0, 66, 111, 110, 110, 101, 32, 101, 110, 100, 117, 114, 97, 110, 99, 101, 0, 80, 101, 114, 115, 195, 169, 118, 195, 169, 114, 97, 110, 116, 0, 65, 105, 109, 101, 32, 99, 111, 117, 114, 105, 114, 0, 65, 116, 116, 101, 110, 116, 105, 102, 32, 97, 117, 120, 32, 115, 111, 110, 115, 0, 66, 195, 170, 116, 101, 32, 101, 116, 32, 105, 109, 112, 117, 108, 115, 105, 102, 0, 65, 105, 109, 101, 32, 102, 97, 105, 114, 101, 32, 108, 101, 32, 112, 105, 116, 114, 101, 0, 70, 117, 105, 116, 32, 114, 97, 112, 105, 100, 101, 109, 101, 110, 116, 0, 69, 120, 116, 114, 195, 170, 109, 101, 109, 101, 110, 116, 32, 99, 117, 114, 105, 101, 117, 120, 0, 67, 111, 113, 117, 105, 110, 0, 84, 114, 195, 168, 115, 32, 111, 98, 115, 116, 105, 110, 195, 169, 0, 83, 111, 117, 118, 101, 110, 116, 32, 100, 97, 110, 115, 32, 108, 97, 32, 108, 117, 110, 101, 0, 84, 114, 195, 168, 115, 32, 112, 97, 114, 116, 105, 99, 117, 108, 105, 101, 114, 0, 84, 114, 195, 168, 115, 32, 118, 111, 108, 111, 110, 116, 97, 105, 114, 101, 0, 85, 110, 32, 112, 101, 117, 32, 118, 97, 110, 105, 116, 101, 117, 120, 0, 69, 115, 112, 114, 105, 116, 32, 114, 101, 98, 101, 108, 108, 101, 0, 65, 32, 104, 111, 114, 114, 101, 117, 114, 32, 100, 101, 32, 112, 101, 114, 100, 114, 101, 0, 65, 115, 115, 101, 122, 32, 101, 110, 116, 195, 170, 116, 195, 169, 0 };
-
-constexpr std::array<u8, 2185> dppt_fr = { 48, 44, 67, 97, 110, 97, 108, 97, 118, 101, 32, 67, 105, 116, 121, 0, 49, 44, 69, 116, 101, 114, 110, 97, 32, 67, 105, 116, 121, 0, 50, 44, 80, 97, 115, 116, 111, 114, 105, 97, 32, 67, 105, 116, 121, 0, 51, 44, 83, 117, 110, 121, 115, 104, 111, 114, 101, 32, 67, 105, 116, 121, 0, 52, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 76, 101, 97, 103, 117, 101, 0, 53, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 77, 105, 110, 101, 32, 49, 70, 0, 54, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 77, 105, 110, 101, 32, 66, 49, 70, 0, 55, 44, 86, 97, 108, 108, 101, 121, 32, 87, 105, 110, 100, 119, 111, 114, 107, 115, 0, 56, 44, 69, 116, 101, 114, 110, 97, 32, 70, 111, 114, 101, 115, 116, 0, 57, 44, 70, 117, 101, 103, 111, 32, 73, 114, 111, 110, 119, 111, 114, 107, 115, 0, 49, 48, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 40, 82, 111, 117, 116, 101, 32, 50, 48, 55, 47, 50, 48, 56, 32, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 49, 49, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 50, 70, 0, 49, 50, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 51, 70, 0, 49, 51, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 83, 110, 111, 119, 0, 49, 52, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 52, 70, 0, 49, 53, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 53, 70, 0, 49, 54, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 54, 70, 0, 49, 55, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 55, 70, 0, 49, 56, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 84, 111, 112, 32, 67, 97, 118, 101, 0, 49, 57, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 40, 82, 111, 117, 116, 101, 32, 50, 49, 54, 32, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 50, 48, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 40, 82, 111, 117, 116, 101, 32, 50, 49, 49, 32, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 50, 49, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 66, 49, 70, 0, 50, 50, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 49, 0, 50, 51, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 50, 0, 50, 52, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 51, 0, 50, 53, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 52, 0, 50, 54, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 53, 0, 50, 55, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 54, 0, 50, 56, 44, 83, 111, 108, 97, 99, 101, 111, 110, 32, 82, 117, 105, 110, 115, 0, 50, 57, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 51, 48, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 50, 70, 0, 51, 49, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 49, 70, 0, 51, 50, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 97, 99, 107, 32, 82, 111, 111, 109, 32, 49, 0, 51, 51, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 97, 99, 107, 32, 82, 111, 111, 109, 32, 50, 0, 51, 52, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 97, 99, 107, 32, 82, 111, 111, 109, 32, 51, 0, 51, 53, 44, 82, 97, 118, 97, 103, 101, 100, 32, 80, 97, 116, 104, 0, 51, 54, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 71, 97, 116, 101, 32, 49, 70, 0, 51, 55, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 71, 97, 116, 101, 32, 66, 49, 70, 0, 51, 56, 44, 83, 116, 97, 114, 107, 32, 77, 111, 117, 110, 116, 97, 105, 110, 0, 51, 57, 44, 83, 116, 97, 114, 107, 32, 77, 111, 117, 110, 116, 97, 105, 110, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 52, 48, 44, 83, 116, 97, 114, 107, 32, 77, 111, 117, 110, 116, 97, 105, 110, 32, 73, 110, 116, 101, 114, 105, 111, 114, 0, 52, 49, 44, 83, 101, 110, 100, 111, 102, 102, 32, 83, 112, 114, 105, 110, 103, 0, 52, 50, 44, 84, 117, 114, 110, 98, 97, 99, 107, 32, 67, 97, 118, 101, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 52, 51, 44, 84, 117, 114, 110, 98, 97, 99, 107, 32, 67, 97, 118, 101, 32, 49, 115, 116, 32, 80, 105, 108, 108, 97, 114, 0, 52, 52, 44, 84, 117, 114, 110, 98, 97, 99, 107, 32, 67, 97, 118, 101, 32, 50, 110, 100, 32, 80, 105, 108, 108, 97, 114, 0, 52, 53, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 49, 70, 0, 52, 54, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 49, 70, 0, 52, 55, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 50, 70, 0, 52, 56, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 51, 70, 0, 52, 57, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 52, 70, 0, 53, 48, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 53, 70, 0, 53, 49, 44, 87, 97, 121, 119, 97, 114, 100, 32, 67, 97, 118, 101, 0, 53, 50, 44, 87, 97, 121, 119, 97, 114, 100, 32, 67, 97, 118, 101, 32, 40, 83, 101, 99, 114, 101, 116, 41, 0, 53, 51, 44, 82, 117, 105, 110, 32, 77, 97, 110, 105, 97, 99, 32, 67, 97, 118, 101, 32, 40, 60, 32, 49, 48, 32, 85, 110, 111, 119, 110, 41, 0, 53, 52, 44, 82, 117, 105, 110, 32, 77, 97, 110, 105, 97, 99, 32, 67, 97, 118, 101, 32, 40, 62, 32, 49, 48, 32, 85, 110, 111, 119, 110, 41, 0, 53, 53, 44, 77, 97, 110, 105, 97, 99, 32, 84, 117, 110, 110, 101, 108, 0, 53, 54, 44, 84, 114, 111, 112, 104, 121, 32, 71, 97, 114, 100, 101, 110, 0, 53, 55, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 0, 53, 56, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 49, 70, 0, 53, 57, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 49, 70, 0, 54, 48, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 50, 70, 32, 40, 76, 101, 102, 116, 41, 0, 54, 49, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 50, 70, 32, 40, 82, 105, 103, 104, 116, 41, 0, 54, 50, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 51, 70, 0, 54, 51, 44, 79, 108, 100, 32, 67, 104, 97, 116, 101, 97, 117, 0, 54, 52, 44, 79, 108, 100, 32, 67, 104, 97, 116, 101, 97, 117, 32, 82, 111, 111, 109, 32, 53, 0, 54, 53, 44, 76, 97, 107, 101, 32, 86, 101, 114, 105, 116, 121, 0, 54, 54, 44, 76, 97, 107, 101, 32, 86, 97, 108, 111, 114, 0, 54, 55, 44, 76, 97, 107, 101, 32, 65, 99, 117, 105, 116, 121, 0, 54, 56, 44, 86, 97, 108, 111, 114, 32, 76, 97, 107, 101, 102, 114, 111, 110, 116, 0, 54, 57, 44, 65, 99, 117, 105, 116, 121, 32, 76, 97, 107, 101, 102, 114, 111, 110, 116, 0, 55, 48, 44, 82, 111, 117, 116, 101, 32, 50, 48, 49, 0, 55, 49, 44, 82, 111, 117, 116, 101, 32, 50, 48, 50, 0, 55, 50, 44, 82, 111, 117, 116, 101, 32, 50, 48, 51, 0, 55, 51, 44, 82, 111, 117, 116, 101, 32, 50, 48, 52, 32, 40, 83, 111, 117, 116, 104, 41, 0, 55, 52, 44, 82, 111, 117, 116, 101, 32, 50, 48, 52, 32, 40, 78, 111, 114, 116, 104, 41, 0, 55, 53, 44, 82, 111, 117, 116, 101, 32, 50, 48, 53, 32, 40, 83, 111, 117, 116, 104, 41, 0, 55, 54, 44, 82, 111, 117, 116, 101, 32, 50, 48, 53, 32, 40, 78, 111, 114, 116, 104, 41, 0, 55, 55, 44, 82, 111, 117, 116, 101, 32, 50, 48, 54, 0, 55, 56, 44, 82, 111, 117, 116, 101, 32, 50, 48, 55, 0, 55, 57, 44, 82, 111, 117, 116, 101, 32, 50, 48, 56, 0, 56, 48, 44, 82, 111, 117, 116, 101, 32, 50, 48, 57, 0, 56, 49, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 49, 70, 0, 56, 50, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 50, 70, 0, 56, 51, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 51, 70, 0, 56, 52, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 52, 70, 0, 56, 53, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 53, 70, 0, 56, 54, 44, 82, 111, 117, 116, 101, 32, 50, 49, 48, 32, 40, 83, 111, 117, 116, 104, 41, 0, 56, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 48, 32, 40, 78, 111, 114, 116, 104, 41, 0, 56, 56, 44, 82, 111, 117, 116, 101, 32, 50, 49, 49, 32, 40, 87, 101, 115, 116, 41, 0, 56, 57, 44, 82, 111, 117, 116, 101, 32, 50, 49, 49, 32, 40, 69, 97, 115, 116, 41, 0, 57, 48, 44, 82, 111, 117, 116, 101, 32, 50, 49, 50, 32, 40, 78, 111, 114, 116, 104, 41, 0, 57, 49, 44, 82, 111, 117, 116, 101, 32, 50, 49, 50, 32, 40, 83, 111, 117, 116, 104, 41, 0, 57, 50, 44, 82, 111, 117, 116, 101, 32, 50, 49, 51, 0, 57, 51, 44, 82, 111, 117, 116, 101, 32, 50, 49, 52, 0, 57, 52, 44, 82, 111, 117, 116, 101, 32, 50, 49, 53, 0, 57, 53, 44, 82, 111, 117, 116, 101, 32, 50, 49, 54, 0, 57, 54, 44, 82, 111, 117, 116, 101, 32, 50, 49, 55, 0, 57, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 56, 0, 57, 56, 44, 82, 111, 117, 116, 101, 32, 50, 49, 57, 0, 57, 57, 44, 82, 111, 117, 116, 101, 32, 50, 50, 49, 0, 49, 48, 48, 44, 82, 111, 117, 116, 101, 32, 50, 50, 50, 0, 49, 48, 49, 44, 82, 111, 117, 116, 101, 32, 50, 50, 52, 0, 49, 48, 50, 44, 82, 111, 117, 116, 101, 32, 50, 50, 53, 0, 49, 48, 51, 44, 82, 111, 117, 116, 101, 32, 50, 50, 55, 0, 49, 48, 52, 44, 82, 111, 117, 116, 101, 32, 50, 50, 56, 0, 49, 48, 53, 44, 82, 111, 117, 116, 101, 32, 50, 50, 57, 0, 49, 48, 54, 44, 84, 119, 105, 110, 108, 101, 97, 102, 32, 84, 111, 119, 110, 0, 49, 48, 55, 44, 67, 101, 108, 101, 115, 116, 105, 99, 32, 84, 111, 119, 110, 0, 49, 48, 56, 44, 82, 101, 115, 111, 114, 116, 32, 65, 114, 101, 97, 0, 49, 48, 57, 44, 82, 111, 117, 116, 101, 32, 50, 50, 48, 0, 49, 49, 48, 44, 82, 111, 117, 116, 101, 32, 50, 50, 51, 0, 49, 49, 49, 44, 82, 111, 117, 116, 101, 32, 50, 50, 54, 0, 49, 49, 50, 44, 82, 111, 117, 116, 101, 32, 50, 51, 48, 0 };
-
-constexpr std::array<u8, 1799> frlg_fr = { 48, 44, 80, 97, 108, 108, 101, 116, 32, 84, 111, 119, 110, 0, 49, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 67, 105, 116, 121, 0, 50, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 105, 116, 121, 0, 51, 44, 86, 101, 114, 109, 105, 108, 105, 111, 110, 32, 67, 105, 116, 121, 0, 52, 44, 67, 101, 108, 97, 100, 111, 110, 32, 67, 105, 116, 121, 0, 53, 44, 70, 117, 99, 104, 115, 105, 97, 32, 67, 105, 116, 121, 0, 54, 44, 67, 105, 110, 110, 97, 98, 97, 114, 32, 73, 115, 108, 97, 110, 100, 0, 55, 44, 82, 111, 117, 116, 101, 32, 49, 0, 56, 44, 82, 111, 117, 116, 101, 32, 50, 0, 57, 44, 82, 111, 117, 116, 101, 32, 51, 0, 49, 48, 44, 82, 111, 117, 116, 101, 32, 52, 0, 49, 49, 44, 82, 111, 117, 116, 101, 32, 53, 0, 49, 50, 44, 82, 111, 117, 116, 101, 32, 54, 0, 49, 51, 44, 82, 111, 117, 116, 101, 32, 55, 0, 49, 52, 44, 82, 111, 117, 116, 101, 32, 56, 0, 49, 53, 44, 82, 111, 117, 116, 101, 32, 57, 0, 49, 54, 44, 82, 111, 117, 116, 101, 32, 49, 48, 0, 49, 55, 44, 82, 111, 117, 116, 101, 32, 49, 49, 0, 49, 56, 44, 82, 111, 117, 116, 101, 32, 49, 50, 0, 49, 57, 44, 82, 111, 117, 116, 101, 32, 49, 51, 0, 50, 48, 44, 82, 111, 117, 116, 101, 32, 49, 52, 0, 50, 49, 44, 82, 111, 117, 116, 101, 32, 49, 53, 0, 50, 50, 44, 82, 111, 117, 116, 101, 32, 49, 54, 0, 50, 51, 44, 82, 111, 117, 116, 101, 32, 49, 55, 0, 50, 52, 44, 82, 111, 117, 116, 101, 32, 49, 56, 0, 50, 53, 44, 82, 111, 117, 116, 101, 32, 49, 57, 0, 50, 54, 44, 82, 111, 117, 116, 101, 32, 50, 48, 0, 50, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 0, 50, 56, 44, 82, 111, 117, 116, 101, 32, 50, 50, 0, 50, 57, 44, 82, 111, 117, 116, 101, 32, 50, 51, 0, 51, 48, 44, 82, 111, 117, 116, 101, 32, 50, 52, 0, 51, 49, 44, 82, 111, 117, 116, 101, 32, 50, 53, 0, 51, 50, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 70, 111, 114, 101, 115, 116, 0, 51, 51, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 49, 70, 0, 51, 52, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 66, 49, 70, 0, 51, 53, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 66, 50, 70, 0, 51, 54, 44, 83, 46, 83, 46, 32, 65, 110, 110, 101, 0, 51, 55, 44, 68, 105, 103, 108, 101, 116, 116, 39, 115, 32, 67, 97, 118, 101, 0, 51, 56, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 51, 57, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 50, 70, 0, 52, 48, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 51, 70, 0, 52, 49, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 77, 97, 110, 115, 105, 111, 110, 32, 49, 70, 45, 51, 70, 0, 52, 50, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 77, 97, 110, 115, 105, 111, 110, 32, 66, 49, 70, 0, 52, 51, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 67, 101, 110, 116, 101, 114, 0, 52, 52, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 49, 0, 52, 53, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 50, 0, 52, 54, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 51, 0, 52, 55, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 49, 70, 0, 52, 56, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 66, 49, 70, 0, 52, 57, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 49, 70, 0, 53, 48, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 49, 70, 0, 53, 49, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 50, 70, 0, 53, 50, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 51, 70, 0, 53, 51, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 52, 70, 0, 53, 52, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 51, 70, 0, 53, 53, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 52, 70, 0, 53, 54, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 53, 70, 0, 53, 55, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 54, 70, 0, 53, 56, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 55, 70, 0, 53, 57, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 49, 70, 0, 54, 48, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 50, 70, 0, 54, 49, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 54, 50, 44, 80, 111, 119, 101, 114, 32, 80, 108, 97, 110, 116, 0, 54, 51, 44, 79, 110, 101, 32, 73, 115, 108, 97, 110, 100, 0, 54, 52, 44, 70, 111, 117, 114, 32, 73, 115, 108, 97, 110, 100, 0, 54, 53, 44, 70, 105, 118, 101, 32, 73, 115, 108, 97, 110, 100, 0, 54, 54, 44, 75, 105, 110, 100, 108, 101, 32, 82, 111, 97, 100, 0, 54, 55, 44, 84, 114, 101, 97, 115, 117, 114, 101, 32, 66, 101, 97, 99, 104, 0, 54, 56, 44, 67, 97, 112, 101, 32, 66, 114, 105, 110, 107, 0, 54, 57, 44, 66, 111, 110, 100, 32, 66, 114, 105, 100, 103, 101, 0, 55, 48, 44, 84, 104, 114, 101, 101, 32, 73, 115, 108, 101, 32, 80, 111, 114, 116, 0, 55, 49, 44, 82, 101, 115, 111, 114, 116, 32, 71, 111, 114, 103, 101, 111, 117, 115, 0, 55, 50, 44, 87, 97, 116, 101, 114, 32, 76, 97, 98, 121, 114, 105, 110, 116, 104, 0, 55, 51, 44, 70, 105, 118, 101, 32, 73, 115, 108, 101, 32, 77, 101, 97, 100, 111, 119, 0, 55, 52, 44, 77, 101, 109, 111, 114, 105, 97, 108, 32, 80, 105, 108, 108, 97, 114, 0, 55, 53, 44, 79, 117, 116, 99, 97, 115, 116, 32, 73, 115, 108, 97, 110, 100, 0, 55, 54, 44, 71, 114, 101, 101, 110, 32, 80, 97, 116, 104, 0, 55, 55, 44, 87, 97, 116, 101, 114, 32, 80, 97, 116, 104, 0, 55, 56, 44, 82, 117, 105, 110, 32, 86, 97, 108, 108, 101, 121, 0, 55, 57, 44, 84, 114, 97, 105, 110, 101, 114, 32, 84, 111, 119, 101, 114, 32, 40, 101, 120, 116, 101, 114, 105, 111, 114, 41, 0, 56, 48, 44, 67, 97, 110, 121, 111, 110, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 56, 49, 44, 83, 101, 118, 97, 117, 108, 116, 32, 67, 97, 110, 121, 111, 110, 0, 56, 50, 44, 84, 97, 110, 111, 98, 121, 32, 82, 117, 105, 110, 115, 0, 56, 51, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 0, 56, 52, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 82, 111, 111, 109, 32, 49, 0, 56, 53, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 82, 111, 111, 109, 32, 50, 0, 56, 54, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 82, 111, 111, 109, 32, 51, 0, 56, 55, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 49, 70, 0, 56, 56, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 49, 70, 0, 56, 57, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 50, 70, 0, 57, 48, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 51, 70, 0, 57, 49, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 52, 70, 0, 57, 50, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 53, 70, 0, 57, 51, 44, 66, 101, 114, 114, 121, 32, 70, 111, 114, 101, 115, 116, 0, 57, 52, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 0, 57, 53, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 32, 49, 70, 0, 57, 54, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 57, 55, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 32, 66, 97, 99, 107, 0, 57, 56, 44, 80, 97, 116, 116, 101, 114, 110, 32, 66, 117, 115, 104, 0, 57, 57, 44, 65, 108, 116, 101, 114, 105, 110, 103, 32, 67, 97, 118, 101, 0, 49, 48, 48, 44, 77, 111, 110, 101, 97, 110, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 49, 44, 76, 105, 112, 116, 111, 111, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 50, 44, 87, 101, 101, 112, 116, 104, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 51, 44, 68, 105, 108, 102, 111, 114, 100, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 52, 44, 83, 99, 117, 102, 105, 98, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 53, 44, 82, 105, 120, 121, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 54, 44, 86, 105, 97, 112, 111, 105, 115, 32, 67, 104, 97, 109, 98, 101, 114, 0 };
-
-constexpr std::array<u8, 1948> hgss_fr = { 48, 44, 78, 101, 119, 32, 66, 97, 114, 107, 32, 84, 111, 119, 110, 0, 49, 44, 82, 111, 117, 116, 101, 32, 50, 57, 0, 50, 44, 67, 104, 101, 114, 114, 121, 103, 114, 111, 118, 101, 32, 67, 105, 116, 121, 0, 51, 44, 82, 111, 117, 116, 101, 32, 51, 48, 0, 52, 44, 82, 111, 117, 116, 101, 32, 51, 49, 0, 53, 44, 86, 105, 111, 108, 101, 116, 32, 67, 105, 116, 121, 0, 54, 44, 83, 112, 114, 111, 117, 116, 32, 84, 111, 119, 101, 114, 0, 55, 44, 82, 111, 117, 116, 101, 32, 51, 50, 0, 56, 44, 82, 117, 105, 110, 115, 32, 111, 102, 32, 65, 108, 112, 104, 32, 40, 79, 117, 116, 115, 105, 100, 101, 41, 0, 57, 44, 82, 117, 105, 110, 115, 32, 111, 102, 32, 65, 108, 112, 104, 32, 40, 73, 110, 115, 105, 100, 101, 41, 0, 49, 48, 44, 85, 110, 105, 111, 110, 32, 67, 97, 118, 101, 32, 49, 70, 0, 49, 49, 44, 85, 110, 105, 111, 110, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 49, 50, 44, 85, 110, 105, 111, 110, 32, 67, 97, 118, 101, 32, 66, 50, 70, 0, 49, 51, 44, 82, 111, 117, 116, 101, 32, 51, 51, 0, 49, 52, 44, 83, 76, 79, 87, 80, 79, 75, 69, 32, 87, 101, 108, 108, 32, 49, 70, 0, 49, 53, 44, 83, 76, 79, 87, 80, 79, 75, 69, 32, 87, 101, 108, 108, 32, 66, 49, 70, 0, 49, 54, 44, 73, 108, 101, 120, 32, 70, 111, 114, 101, 115, 116, 0, 49, 55, 44, 82, 111, 117, 116, 101, 32, 51, 52, 0, 49, 56, 44, 82, 111, 117, 116, 101, 32, 51, 53, 0, 49, 57, 44, 78, 97, 116, 105, 111, 110, 97, 108, 32, 80, 97, 114, 107, 0, 50, 48, 44, 82, 111, 117, 116, 101, 32, 51, 54, 0, 50, 49, 44, 82, 111, 117, 116, 101, 32, 51, 55, 0, 50, 50, 44, 69, 99, 114, 117, 116, 101, 97, 107, 32, 67, 105, 116, 121, 0, 50, 51, 44, 66, 117, 114, 110, 101, 100, 32, 84, 111, 119, 101, 114, 32, 49, 70, 0, 50, 52, 44, 66, 117, 114, 110, 101, 100, 32, 84, 111, 119, 101, 114, 32, 66, 49, 70, 0, 50, 53, 44, 66, 101, 108, 108, 32, 84, 111, 119, 101, 114, 0, 50, 54, 44, 82, 111, 117, 116, 101, 32, 51, 56, 0, 50, 55, 44, 82, 111, 117, 116, 101, 32, 51, 57, 0, 50, 56, 44, 79, 108, 105, 118, 105, 110, 101, 32, 67, 105, 116, 121, 0, 50, 57, 44, 82, 111, 117, 116, 101, 32, 52, 48, 0, 51, 48, 44, 82, 111, 117, 116, 101, 32, 52, 49, 0, 51, 49, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 49, 70, 0, 51, 50, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 49, 70, 0, 51, 51, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 50, 70, 0, 51, 52, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 51, 70, 0, 51, 53, 44, 67, 105, 97, 110, 119, 111, 111, 100, 32, 67, 105, 116, 121, 0, 51, 54, 44, 82, 111, 117, 116, 101, 32, 52, 50, 0, 51, 55, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 49, 70, 0, 51, 56, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 49, 70, 32, 40, 66, 97, 99, 107, 41, 0, 51, 57, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 50, 70, 0, 52, 48, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 66, 49, 70, 0, 52, 49, 44, 82, 111, 117, 116, 101, 32, 52, 51, 0, 52, 50, 44, 76, 97, 107, 101, 32, 111, 102, 32, 82, 97, 103, 101, 0, 52, 51, 44, 82, 111, 117, 116, 101, 32, 52, 52, 0, 52, 52, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 49, 70, 0, 52, 53, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 66, 49, 70, 0, 52, 54, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 66, 50, 70, 0, 52, 55, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 66, 51, 70, 0, 52, 56, 44, 66, 108, 97, 99, 107, 116, 104, 111, 114, 110, 32, 67, 105, 116, 121, 0, 52, 57, 44, 68, 114, 97, 103, 111, 110, 226, 128, 153, 115, 32, 68, 101, 110, 0, 53, 48, 44, 82, 111, 117, 116, 101, 32, 52, 53, 0, 53, 49, 44, 82, 111, 117, 116, 101, 32, 52, 54, 0, 53, 50, 44, 68, 97, 114, 107, 32, 67, 97, 118, 101, 32, 40, 82, 111, 117, 116, 101, 32, 51, 49, 41, 0, 53, 51, 44, 68, 97, 114, 107, 32, 67, 97, 118, 101, 32, 40, 82, 111, 117, 116, 101, 32, 52, 53, 41, 0, 53, 52, 44, 82, 111, 117, 116, 101, 32, 52, 55, 0, 53, 53, 44, 77, 116, 46, 32, 77, 111, 111, 110, 0, 53, 54, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 40, 67, 108, 101, 102, 97, 105, 114, 121, 41, 0, 53, 55, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 49, 70, 0, 53, 56, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 49, 70, 0, 53, 57, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 50, 70, 0, 54, 48, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 51, 70, 0, 54, 49, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 52, 70, 0, 54, 50, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 49, 70, 0, 54, 51, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 67, 97, 118, 101, 32, 49, 70, 32, 84, 111, 112, 0, 54, 52, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 52, 70, 0, 54, 53, 44, 67, 108, 105, 102, 102, 32, 69, 100, 103, 101, 32, 71, 97, 116, 101, 0, 54, 54, 44, 67, 108, 105, 102, 102, 32, 67, 97, 118, 101, 0, 54, 55, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 0, 54, 56, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 50, 70, 0, 54, 57, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 67, 97, 118, 101, 32, 77, 111, 117, 110, 116, 97, 105, 110, 115, 105, 100, 101, 0, 55, 48, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 67, 97, 118, 101, 32, 51, 70, 0, 55, 49, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 84, 111, 112, 0, 55, 50, 44, 82, 111, 117, 116, 101, 32, 49, 50, 0, 55, 51, 44, 82, 111, 117, 116, 101, 32, 49, 57, 0, 55, 52, 44, 82, 111, 117, 116, 101, 32, 50, 48, 0, 55, 53, 44, 80, 97, 108, 108, 101, 116, 32, 84, 111, 119, 110, 0, 55, 54, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 67, 105, 116, 121, 0, 55, 55, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 105, 116, 121, 0, 55, 56, 44, 86, 101, 114, 109, 105, 108, 105, 111, 110, 32, 67, 105, 116, 121, 0, 55, 57, 44, 67, 101, 108, 97, 100, 111, 110, 32, 67, 105, 116, 121, 0, 56, 48, 44, 70, 117, 99, 104, 115, 105, 97, 32, 67, 105, 116, 121, 0, 56, 49, 44, 67, 105, 110, 110, 97, 98, 97, 114, 32, 73, 115, 108, 97, 110, 100, 0, 56, 50, 44, 82, 111, 117, 116, 101, 32, 52, 56, 0, 56, 51, 44, 82, 111, 117, 116, 101, 32, 50, 54, 0, 56, 52, 44, 82, 111, 117, 116, 101, 32, 50, 55, 0, 56, 53, 44, 82, 111, 117, 116, 101, 32, 50, 56, 0, 56, 54, 44, 77, 116, 46, 32, 77, 111, 111, 110, 0, 56, 55, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 49, 70, 0, 56, 56, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 50, 70, 0, 56, 57, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 57, 48, 44, 82, 111, 117, 116, 101, 32, 49, 0, 57, 49, 44, 82, 111, 117, 116, 101, 32, 50, 32, 40, 83, 111, 117, 116, 104, 41, 0, 57, 50, 44, 82, 111, 117, 116, 101, 32, 51, 0, 57, 51, 44, 82, 111, 117, 116, 101, 32, 52, 0, 57, 52, 44, 82, 111, 117, 116, 101, 32, 53, 0, 57, 53, 44, 82, 111, 117, 116, 101, 32, 54, 0, 57, 54, 44, 82, 111, 117, 116, 101, 32, 55, 0, 57, 55, 44, 82, 111, 117, 116, 101, 32, 56, 0, 57, 56, 44, 82, 111, 117, 116, 101, 32, 57, 0, 57, 57, 44, 82, 111, 117, 116, 101, 32, 49, 48, 0, 49, 48, 48, 44, 82, 111, 117, 116, 101, 32, 49, 49, 0, 49, 48, 49, 44, 82, 111, 117, 116, 101, 32, 49, 51, 0, 49, 48, 50, 44, 82, 111, 117, 116, 101, 32, 49, 52, 0, 49, 48, 51, 44, 82, 111, 117, 116, 101, 32, 49, 53, 0, 49, 48, 52, 44, 82, 111, 117, 116, 101, 32, 49, 54, 0, 49, 48, 53, 44, 82, 111, 117, 116, 101, 32, 49, 55, 0, 49, 48, 54, 44, 82, 111, 117, 116, 101, 32, 49, 56, 0, 49, 48, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 0, 49, 48, 56, 44, 82, 111, 117, 116, 101, 32, 50, 50, 0, 49, 48, 57, 44, 82, 111, 117, 116, 101, 32, 50, 52, 0, 49, 49, 48, 44, 82, 111, 117, 116, 101, 32, 50, 53, 0, 49, 49, 49, 44, 84, 111, 104, 106, 111, 32, 70, 97, 108, 108, 115, 0, 49, 49, 50, 44, 68, 73, 71, 76, 69, 84, 84, 226, 128, 153, 115, 32, 67, 97, 118, 101, 0, 49, 49, 51, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 50, 70, 0, 49, 49, 52, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 51, 70, 0, 49, 49, 53, 44, 82, 111, 117, 116, 101, 32, 50, 32, 40, 78, 111, 114, 116, 104, 41, 0, 49, 49, 54, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 70, 111, 114, 101, 115, 116, 0, 49, 49, 55, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 49, 70, 0, 49, 49, 56, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 50, 70, 0, 49, 49, 57, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0 };
-
-constexpr std::array<u8, 176> natures_fr = { 72, 97, 114, 100, 105, 0, 83, 111, 108, 111, 0, 66, 114, 97, 118, 101, 0, 82, 105, 103, 105, 100, 101, 0, 77, 97, 117, 118, 97, 105, 115, 0, 65, 115, 115, 117, 114, 195, 169, 0, 68, 111, 99, 105, 108, 101, 0, 82, 101, 108, 97, 120, 0, 77, 97, 108, 105, 110, 0, 76, 195, 162, 99, 104, 101, 0, 84, 105, 109, 105, 100, 101, 0, 80, 114, 101, 115, 115, 195, 169, 0, 83, 195, 169, 114, 105, 101, 117, 120, 0, 74, 111, 118, 105, 97, 108, 0, 78, 97, 195, 175, 102, 0, 77, 111, 100, 101, 115, 116, 101, 0, 68, 111, 117, 120, 0, 68, 105, 115, 99, 114, 101, 116, 0, 80, 117, 100, 105, 113, 117, 101, 0, 70, 111, 117, 102, 111, 117, 0, 67, 97, 108, 109, 101, 0, 71, 101, 110, 116, 105, 108, 0, 77, 97, 108, 112, 111, 108, 105, 0, 80, 114, 117, 100, 101, 110, 116, 0, 66, 105, 122, 97, 114, 114, 101, 0 };
-
-constexpr std::array<u8, 103> powers_fr = { 67, 111, 109, 98, 97, 116, 0, 86, 111, 108, 0, 80, 111, 105, 115, 111, 110, 0, 83, 111, 108, 0, 82, 111, 99, 104, 101, 0, 73, 110, 115, 101, 99, 116, 101, 0, 83, 112, 101, 99, 116, 114, 101, 0, 65, 99, 105, 101, 114, 0, 70, 101, 117, 0, 69, 97, 117, 0, 80, 108, 97, 110, 116, 101, 0, 195, 137, 108, 101, 99, 116, 114, 105, 107, 0, 80, 115, 121, 0, 71, 108, 97, 99, 101, 0, 68, 114, 97, 103, 111, 110, 0, 84, 195, 169, 110, 195, 168, 98, 114, 101, 115, 0 };
-
-constexpr std::array<u8, 1480> rse_fr = { 48, 44, 68, 101, 119, 102, 111, 114, 100, 32, 84, 111, 119, 110, 0, 49, 44, 80, 97, 99, 105, 102, 105, 100, 108, 111, 103, 32, 84, 111, 119, 110, 0, 50, 44, 80, 101, 116, 97, 108, 98, 117, 114, 103, 32, 67, 105, 116, 121, 0, 51, 44, 83, 108, 97, 116, 101, 112, 111, 114, 116, 32, 67, 105, 116, 121, 0, 52, 44, 76, 105, 108, 121, 99, 111, 118, 101, 32, 67, 105, 116, 121, 0, 53, 44, 77, 111, 115, 115, 100, 101, 101, 112, 32, 67, 105, 116, 121, 0, 54, 44, 83, 111, 111, 116, 111, 112, 111, 108, 105, 115, 32, 67, 105, 116, 121, 0, 55, 44, 69, 118, 101, 114, 32, 71, 114, 97, 110, 100, 101, 32, 67, 105, 116, 121, 0, 56, 44, 82, 111, 117, 116, 101, 32, 49, 48, 49, 0, 57, 44, 82, 111, 117, 116, 101, 32, 49, 48, 50, 0, 49, 48, 44, 82, 111, 117, 116, 101, 32, 49, 48, 51, 0, 49, 49, 44, 82, 111, 117, 116, 101, 32, 49, 48, 52, 0, 49, 50, 44, 82, 111, 117, 116, 101, 32, 49, 48, 53, 0, 49, 51, 44, 82, 111, 117, 116, 101, 32, 49, 48, 54, 0, 49, 52, 44, 82, 111, 117, 116, 101, 32, 49, 48, 55, 0, 49, 53, 44, 82, 111, 117, 116, 101, 32, 49, 48, 56, 0, 49, 54, 44, 82, 111, 117, 116, 101, 32, 49, 48, 57, 0, 49, 55, 44, 82, 111, 117, 116, 101, 32, 49, 49, 48, 0, 49, 56, 44, 82, 111, 117, 116, 101, 32, 49, 49, 49, 0, 49, 57, 44, 82, 111, 117, 116, 101, 32, 49, 49, 50, 0, 50, 48, 44, 82, 111, 117, 116, 101, 32, 49, 49, 51, 0, 50, 49, 44, 82, 111, 117, 116, 101, 32, 49, 49, 52, 0, 50, 50, 44, 82, 111, 117, 116, 101, 32, 49, 49, 53, 0, 50, 51, 44, 82, 111, 117, 116, 101, 32, 49, 49, 54, 0, 50, 52, 44, 82, 111, 117, 116, 101, 32, 49, 49, 55, 0, 50, 53, 44, 82, 111, 117, 116, 101, 32, 49, 49, 56, 0, 50, 54, 44, 82, 111, 117, 116, 101, 32, 49, 49, 57, 0, 50, 55, 44, 82, 111, 117, 116, 101, 32, 49, 50, 48, 0, 50, 56, 44, 82, 111, 117, 116, 101, 32, 49, 50, 49, 0, 50, 57, 44, 82, 111, 117, 116, 101, 32, 49, 50, 50, 0, 51, 48, 44, 82, 111, 117, 116, 101, 32, 49, 50, 51, 0, 51, 49, 44, 82, 111, 117, 116, 101, 32, 49, 50, 52, 0, 51, 50, 44, 82, 111, 117, 116, 101, 32, 49, 50, 53, 0, 51, 51, 44, 82, 111, 117, 116, 101, 32, 49, 50, 54, 0, 51, 52, 44, 82, 111, 117, 116, 101, 32, 49, 50, 55, 0, 51, 53, 44, 82, 111, 117, 116, 101, 32, 49, 50, 56, 0, 51, 54, 44, 82, 111, 117, 116, 101, 32, 49, 50, 57, 0, 51, 55, 44, 82, 111, 117, 116, 101, 32, 49, 51, 48, 0, 51, 56, 44, 82, 111, 117, 116, 101, 32, 49, 51, 49, 0, 51, 57, 44, 82, 111, 117, 116, 101, 32, 49, 51, 50, 0, 52, 48, 44, 82, 111, 117, 116, 101, 32, 49, 51, 51, 0, 52, 49, 44, 82, 111, 117, 116, 101, 32, 49, 51, 52, 0, 52, 50, 44, 85, 110, 100, 101, 114, 119, 97, 116, 101, 114, 32, 40, 82, 111, 117, 116, 101, 32, 49, 50, 52, 41, 0, 52, 51, 44, 85, 110, 100, 101, 114, 119, 97, 116, 101, 114, 32, 40, 82, 111, 117, 116, 101, 32, 49, 50, 54, 41, 0, 52, 52, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 49, 70, 0, 52, 53, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 83, 116, 101, 118, 101, 110, 39, 115, 32, 82, 111, 111, 109, 0, 52, 54, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 52, 55, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 66, 50, 70, 0, 52, 56, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 49, 0, 52, 57, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 50, 0, 53, 48, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 51, 0, 53, 49, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 52, 0, 53, 50, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 53, 0, 53, 51, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 54, 0, 53, 52, 44, 80, 101, 116, 97, 108, 98, 117, 114, 103, 32, 87, 111, 111, 100, 115, 0, 53, 53, 44, 82, 117, 115, 116, 117, 114, 102, 32, 84, 117, 110, 110, 101, 108, 0, 53, 54, 44, 65, 98, 97, 110, 100, 111, 110, 101, 100, 32, 83, 104, 105, 112, 0, 53, 55, 44, 78, 101, 119, 32, 77, 97, 117, 118, 105, 108, 108, 101, 32, 40, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 53, 56, 44, 78, 101, 119, 32, 77, 97, 117, 118, 105, 108, 108, 101, 32, 40, 66, 97, 115, 101, 109, 101, 110, 116, 41, 0, 53, 57, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 49, 70, 32, 49, 82, 0, 54, 48, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 49, 70, 32, 50, 82, 0, 54, 49, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 66, 49, 70, 32, 49, 82, 0, 54, 50, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 66, 49, 70, 32, 50, 82, 0, 54, 51, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 83, 116, 101, 118, 101, 110, 39, 115, 32, 67, 97, 118, 101, 0, 54, 52, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 49, 70, 45, 51, 70, 0, 54, 53, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 52, 70, 45, 54, 70, 0, 54, 54, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 69, 120, 116, 101, 114, 105, 111, 114, 0, 54, 55, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 83, 117, 109, 109, 105, 116, 0, 54, 56, 44, 83, 104, 111, 97, 108, 32, 67, 97, 118, 101, 0, 54, 57, 44, 83, 104, 111, 97, 108, 32, 67, 97, 118, 101, 32, 73, 99, 101, 32, 82, 111, 111, 109, 0, 55, 48, 44, 83, 101, 97, 102, 108, 111, 111, 114, 32, 67, 97, 118, 101, 114, 110, 0, 55, 49, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 55, 50, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 49, 70, 0, 55, 51, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 50, 70, 0, 55, 52, 44, 67, 97, 118, 101, 32, 111, 102, 32, 79, 114, 105, 103, 105, 110, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 55, 53, 44, 67, 97, 118, 101, 32, 111, 102, 32, 79, 114, 105, 103, 105, 110, 0, 55, 54, 44, 70, 105, 101, 114, 121, 32, 80, 97, 116, 104, 0, 55, 55, 44, 74, 97, 103, 103, 101, 100, 32, 80, 97, 115, 115, 0, 55, 56, 44, 83, 107, 121, 32, 80, 105, 108, 108, 97, 114, 32, 49, 70, 0, 55, 57, 44, 83, 107, 121, 32, 80, 105, 108, 108, 97, 114, 32, 51, 70, 0, 56, 48, 44, 83, 107, 121, 32, 80, 105, 108, 108, 97, 114, 32, 53, 70, 0, 56, 49, 44, 77, 97, 103, 109, 97, 32, 72, 105, 100, 101, 111, 117, 116, 0, 56, 50, 44, 77, 105, 114, 97, 103, 101, 32, 84, 111, 119, 101, 114, 0, 56, 51, 44, 65, 114, 116, 105, 115, 97, 110, 32, 67, 97, 118, 101, 0, 56, 52, 44, 68, 101, 115, 101, 114, 116, 32, 85, 110, 100, 101, 114, 112, 97, 115, 115, 0, 56, 53, 44, 65, 108, 116, 101, 114, 105, 110, 103, 32, 67, 97, 118, 101, 0 };
-
-constexpr std::array<u8, 7477> species_fr = { 239, 187, 191, 66, 117, 108, 98, 105, 122, 97, 114, 114, 101, 0, 72, 101, 114, 98, 105, 122, 97, 114, 114, 101, 0, 70, 108, 111, 114, 105, 122, 97, 114, 114, 101, 0, 83, 97, 108, 97, 109, 195, 168, 99, 104, 101, 0, 82, 101, 112, 116, 105, 110, 99, 101, 108, 0, 68, 114, 97, 99, 97, 117, 102, 101, 117, 0, 67, 97, 114, 97, 112, 117, 99, 101, 0, 67, 97, 114, 97, 98, 97, 102, 102, 101, 0, 84, 111, 114, 116, 97, 110, 107, 0, 67, 104, 101, 110, 105, 112, 97, 110, 0, 67, 104, 114, 121, 115, 97, 99, 105, 101, 114, 0, 80, 97, 112, 105, 108, 117, 115, 105, 111, 110, 0, 65, 115, 112, 105, 99, 111, 116, 0, 67, 111, 99, 111, 110, 102, 111, 114, 116, 0, 68, 97, 114, 100, 97, 114, 103, 110, 97, 110, 0, 82, 111, 117, 99, 111, 111, 108, 0, 82, 111, 117, 99, 111, 117, 112, 115, 0, 82, 111, 117, 99, 97, 114, 110, 97, 103, 101, 0, 82, 97, 116, 116, 97, 116, 97, 0, 82, 97, 116, 116, 97, 116, 97, 99, 0, 80, 105, 97, 102, 97, 98, 101, 99, 0, 82, 97, 112, 97, 115, 100, 101, 112, 105, 99, 0, 65, 98, 111, 0, 65, 114, 98, 111, 107, 0, 80, 105, 107, 97, 99, 104, 117, 0, 82, 97, 105, 99, 104, 117, 0, 83, 97, 98, 101, 108, 101, 116, 116, 101, 0, 83, 97, 98, 108, 97, 105, 114, 101, 97, 117, 0, 78, 105, 100, 111, 114, 97, 110, 226, 153, 128, 0, 78, 105, 100, 111, 114, 105, 110, 97, 0, 78, 105, 100, 111, 113, 117, 101, 101, 110, 0, 78, 105, 100, 111, 114, 97, 110, 226, 153, 130, 0, 78, 105, 100, 111, 114, 105, 110, 111, 0, 78, 105, 100, 111, 107, 105, 110, 103, 0, 77, 195, 169, 108, 111, 102, 195, 169, 101, 0, 77, 195, 169, 108, 111, 100, 101, 108, 102, 101, 0, 71, 111, 117, 112, 105, 120, 0, 70, 101, 117, 110, 97, 114, 100, 0, 82, 111, 110, 100, 111, 117, 100, 111, 117, 0, 71, 114, 111, 100, 111, 117, 100, 111, 117, 0, 78, 111, 115, 102, 101, 114, 97, 112, 116, 105, 0, 78, 111, 115, 102, 101, 114, 97, 108, 116, 111, 0, 77, 121, 115, 116, 104, 101, 114, 98, 101, 0, 79, 114, 116, 105, 100, 101, 0, 82, 97, 102, 102, 108, 101, 115, 105, 97, 0, 80, 97, 114, 97, 115, 0, 80, 97, 114, 97, 115, 101, 99, 116, 0, 77, 105, 109, 105, 116, 111, 115, 115, 0, 65, 195, 169, 114, 111, 109, 105, 116, 101, 0, 84, 97, 117, 112, 105, 113, 117, 101, 117, 114, 0, 84, 114, 105, 111, 112, 105, 107, 101, 117, 114, 0, 77, 105, 97, 111, 117, 115, 115, 0, 80, 101, 114, 115, 105, 97, 110, 0, 80, 115, 121, 107, 111, 107, 119, 97, 107, 0, 65, 107, 119, 97, 107, 119, 97, 107, 0, 70, 195, 169, 114, 111, 115, 105, 110, 103, 101, 0, 67, 111, 108, 111, 115, 115, 105, 110, 103, 101, 0, 67, 97, 110, 105, 110, 111, 115, 0, 65, 114, 99, 97, 110, 105, 110, 0, 80, 116, 105, 116, 97, 114, 100, 0, 84, 195, 170, 116, 97, 114, 116, 101, 0, 84, 97, 114, 116, 97, 114, 100, 0, 65, 98, 114, 97, 0, 75, 97, 100, 97, 98, 114, 97, 0, 65, 108, 97, 107, 97, 122, 97, 109, 0, 77, 97, 99, 104, 111, 99, 0, 77, 97, 99, 104, 111, 112, 101, 117, 114, 0, 77, 97, 99, 107, 111, 103, 110, 101, 117, 114, 0, 67, 104, 195, 169, 116, 105, 102, 108, 111, 114, 0, 66, 111, 117, 115, 116, 105, 102, 108, 111, 114, 0, 69, 109, 112, 105, 102, 108, 111, 114, 0, 84, 101, 110, 116, 97, 99, 111, 111, 108, 0, 84, 101, 110, 116, 97, 99, 114, 117, 101, 108, 0, 82, 97, 99, 97, 105, 108, 108, 111, 117, 0, 71, 114, 97, 118, 97, 108, 97, 110, 99, 104, 0, 71, 114, 111, 108, 101, 109, 0, 80, 111, 110, 121, 116, 97, 0, 71, 97, 108, 111, 112, 97, 0, 82, 97, 109, 111, 108, 111, 115, 115, 0, 70, 108, 97, 103, 97, 100, 111, 115, 115, 0, 77, 97, 103, 110, 195, 169, 116, 105, 0, 77, 97, 103, 110, 195, 169, 116, 111, 110, 0, 67, 97, 110, 97, 114, 116, 105, 99, 104, 111, 0, 68, 111, 100, 117, 111, 0, 68, 111, 100, 114, 105, 111, 0, 79, 116, 97, 114, 105, 97, 0, 76, 97, 109, 97, 110, 116, 105, 110, 101, 0, 84, 97, 100, 109, 111, 114, 118, 0, 71, 114, 111, 116, 97, 100, 109, 111, 114, 118, 0, 75, 111, 107, 105, 121, 97, 115, 0, 67, 114, 117, 115, 116, 97, 98, 114, 105, 0, 70, 97, 110, 116, 111, 109, 105, 110, 117, 115, 0, 83, 112, 101, 99, 116, 114, 117, 109, 0, 69, 99, 116, 111, 112, 108, 97, 115, 109, 97, 0, 79, 110, 105, 120, 0, 83, 111, 112, 111, 114, 105, 102, 105, 107, 0, 72, 121, 112, 110, 111, 109, 97, 100, 101, 0, 75, 114, 97, 98, 98, 121, 0, 75, 114, 97, 98, 98, 111, 115, 115, 0, 86, 111, 108, 116, 111, 114, 98, 101, 0, 195, 137, 108, 101, 99, 116, 114, 111, 100, 101, 0, 78, 111, 101, 117, 110, 111, 101, 117, 102, 0, 78, 111, 97, 100, 107, 111, 107, 111, 0, 79, 115, 115, 101, 108, 97, 105, 116, 0, 79, 115, 115, 97, 116, 117, 101, 117, 114, 0, 75, 105, 99, 107, 108, 101, 101, 0, 84, 121, 103, 110, 111, 110, 0, 69, 120, 99, 101, 108, 97, 110, 103, 117, 101, 0, 83, 109, 111, 103, 111, 0, 83, 109, 111, 103, 111, 103, 111, 0, 82, 104, 105, 110, 111, 99, 111, 114, 110, 101, 0, 82, 104, 105, 110, 111, 102, 195, 169, 114, 111, 115, 0, 76, 101, 118, 101, 105, 110, 97, 114, 100, 0, 83, 97, 113, 117, 101, 100, 101, 110, 101, 117, 0, 75, 97, 110, 103, 111, 117, 114, 101, 120, 0, 72, 121, 112, 111, 116, 114, 101, 109, 112, 101, 0, 72, 121, 112, 111, 99, 195, 169, 97, 110, 0, 80, 111, 105, 115, 115, 105, 114, 195, 168, 110, 101, 0, 80, 111, 105, 115, 115, 111, 114, 111, 121, 0, 83, 116, 97, 114, 105, 0, 83, 116, 97, 114, 111, 115, 115, 0, 77, 46, 32, 77, 105, 109, 101, 0, 73, 110, 115, 195, 169, 99, 97, 116, 101, 117, 114, 0, 76, 105, 112, 112, 111, 117, 116, 111, 117, 0, 195, 137, 108, 101, 107, 116, 101, 107, 0, 77, 97, 103, 109, 97, 114, 0, 83, 99, 97, 114, 97, 98, 114, 117, 116, 101, 0, 84, 97, 117, 114, 111, 115, 0, 77, 97, 103, 105, 99, 97, 114, 112, 101, 0, 76, 195, 169, 118, 105, 97, 116, 111, 114, 0, 76, 111, 107, 104, 108, 97, 115, 115, 0, 77, 195, 169, 116, 97, 109, 111, 114, 112, 104, 0, 195, 137, 118, 111, 108, 105, 0, 65, 113, 117, 97, 108, 105, 0, 86, 111, 108, 116, 97, 108, 105, 0, 80, 121, 114, 111, 108, 105, 0, 80, 111, 114, 121, 103, 111, 110, 0, 65, 109, 111, 110, 105, 116, 97, 0, 65, 109, 111, 110, 105, 115, 116, 97, 114, 0, 75, 97, 98, 117, 116, 111, 0, 75, 97, 98, 117, 116, 111, 112, 115, 0, 80, 116, 195, 169, 114, 97, 0, 82, 111, 110, 102, 108, 101, 120, 0, 65, 114, 116, 105, 107, 111, 100, 105, 110, 0, 195, 137, 108, 101, 99, 116, 104, 111, 114, 0, 83, 117, 108, 102, 117, 114, 97, 0, 77, 105, 110, 105, 100, 114, 97, 99, 111, 0, 68, 114, 97, 99, 111, 0, 68, 114, 97, 99, 111, 108, 111, 115, 115, 101, 0, 77, 101, 119, 116, 119, 111, 0, 77, 101, 119, 0, 71, 101, 114, 109, 105, 103, 110, 111, 110, 0, 77, 97, 99, 114, 111, 110, 105, 117, 109, 0, 77, 195, 169, 103, 97, 110, 105, 117, 109, 0, 72, 195, 169, 114, 105, 99, 101, 110, 100, 114, 101, 0, 70, 101, 117, 114, 105, 115, 115, 111, 110, 0, 84, 121, 112, 104, 108, 111, 115, 105, 111, 110, 0, 75, 97, 105, 109, 105, 110, 117, 115, 0, 67, 114, 111, 99, 114, 111, 100, 105, 108, 0, 65, 108, 105, 103, 97, 116, 117, 101, 117, 114, 0, 70, 111, 117, 105, 110, 101, 116, 116, 101, 0, 70, 111, 117, 105, 110, 97, 114, 0, 72, 111, 111, 116, 104, 111, 111, 116, 0, 78, 111, 97, 114, 102, 97, 110, 103, 0, 67, 111, 120, 121, 0, 67, 111, 120, 121, 99, 108, 97, 113, 117, 101, 0, 77, 105, 109, 105, 103, 97, 108, 0, 77, 105, 103, 97, 108, 111, 115, 0, 78, 111, 115, 116, 101, 110, 102, 101, 114, 0, 76, 111, 117, 112, 105, 111, 0, 76, 97, 110, 116, 117, 114, 110, 0, 80, 105, 99, 104, 117, 0, 77, 195, 169, 108, 111, 0, 84, 111, 117, 100, 111, 117, 100, 111, 117, 0, 84, 111, 103, 101, 112, 105, 0, 84, 111, 103, 101, 116, 105, 99, 0, 78, 97, 116, 117, 0, 88, 97, 116, 117, 0, 87, 97, 116, 116, 111, 117, 97, 116, 0, 76, 97, 105, 110, 101, 114, 103, 105, 101, 0, 80, 104, 97, 114, 97, 109, 112, 0, 74, 111, 108, 105, 102, 108, 111, 114, 0, 77, 97, 114, 105, 108, 108, 0, 65, 122, 117, 109, 97, 114, 105, 108, 108, 0, 83, 105, 109, 117, 108, 97, 114, 98, 114, 101, 0, 84, 97, 114, 112, 97, 117, 100, 0, 71, 114, 97, 110, 105, 118, 111, 108, 0, 70, 108, 111, 114, 97, 118, 111, 108, 0, 67, 111, 116, 111, 118, 111, 108, 0, 67, 97, 112, 117, 109, 97, 105, 110, 0, 84, 111, 117, 114, 110, 101, 103, 114, 105, 110, 0, 72, 195, 169, 108, 105, 97, 116, 114, 111, 110, 99, 0, 89, 97, 110, 109, 97, 0, 65, 120, 111, 108, 111, 116, 111, 0, 77, 97, 114, 97, 105, 115, 116, 101, 0, 77, 101, 110, 116, 97, 108, 105, 0, 78, 111, 99, 116, 97, 108, 105, 0, 67, 111, 114, 110, 195, 168, 98, 114, 101, 0, 82, 111, 105, 103, 97, 100, 97, 0, 70, 101, 117, 102, 111, 114, 195, 170, 118, 101, 0, 90, 97, 114, 98, 105, 0, 81, 117, 108, 98, 117, 116, 111, 107, 195, 169, 0, 71, 105, 114, 97, 102, 97, 114, 105, 103, 0, 80, 111, 109, 100, 101, 112, 105, 107, 0, 70, 111, 114, 101, 116, 114, 101, 115, 115, 0, 73, 110, 115, 111, 108, 111, 117, 114, 100, 111, 0, 83, 99, 111, 114, 112, 108, 97, 110, 101, 0, 83, 116, 101, 101, 108, 105, 120, 0, 83, 110, 117, 98, 98, 117, 108, 108, 0, 71, 114, 97, 110, 98, 117, 108, 108, 0, 81, 119, 105, 108, 102, 105, 115, 104, 0, 67, 105, 122, 97, 121, 111, 120, 0, 67, 97, 114, 97, 116, 114, 111, 99, 0, 83, 99, 97, 114, 104, 105, 110, 111, 0, 70, 97, 114, 102, 117, 114, 101, 116, 0, 84, 101, 100, 100, 105, 117, 114, 115, 97, 0, 85, 114, 115, 97, 114, 105, 110, 103, 0, 76, 105, 109, 97, 103, 109, 97, 0, 86, 111, 108, 99, 97, 114, 111, 112, 111, 100, 0, 77, 97, 114, 99, 97, 99, 114, 105, 110, 0, 67, 111, 99, 104, 105, 103, 110, 111, 110, 0, 67, 111, 114, 97, 121, 111, 110, 0, 82, 195, 169, 109, 111, 114, 97, 105, 100, 0, 79, 99, 116, 105, 108, 108, 101, 114, 121, 0, 67, 97, 100, 111, 105, 122, 111, 0, 68, 195, 169, 109, 97, 110, 116, 97, 0, 65, 105, 114, 109, 117, 114, 101, 0, 77, 97, 108, 111, 115, 115, 101, 0, 68, 195, 169, 109, 111, 108, 111, 115, 115, 101, 0, 72, 121, 112, 111, 114, 111, 105, 0, 80, 104, 97, 110, 112, 121, 0, 68, 111, 110, 112, 104, 97, 110, 0, 80, 111, 114, 121, 103, 111, 110, 50, 0, 67, 101, 114, 102, 114, 111, 117, 115, 115, 101, 0, 81, 117, 101, 117, 108, 111, 114, 105, 111, 114, 0, 68, 101, 98, 117, 103, 97, 110, 116, 0, 75, 97, 112, 111, 101, 114, 97, 0, 76, 105, 112, 112, 111, 117, 116, 105, 0, 195, 137, 108, 101, 107, 105, 100, 0, 77, 97, 103, 98, 121, 0, 195, 137, 99, 114, 195, 169, 109, 101, 117, 104, 0, 76, 101, 117, 112, 104, 111, 114, 105, 101, 0, 82, 97, 105, 107, 111, 117, 0, 69, 110, 116, 101, 105, 0, 83, 117, 105, 99, 117, 110, 101, 0, 69, 109, 98, 114, 121, 108, 101, 120, 0, 89, 109, 112, 104, 101, 99, 116, 0, 84, 121, 114, 97, 110, 111, 99, 105, 102, 0, 76, 117, 103, 105, 97, 0, 72, 111, 45, 79, 104, 0, 67, 101, 108, 101, 98, 105, 0, 65, 114, 99, 107, 111, 0, 77, 97, 115, 115, 107, 111, 0, 74, 117, 110, 103, 107, 111, 0, 80, 111, 117, 115, 115, 105, 102, 101, 117, 0, 71, 97, 108, 105, 102, 101, 117, 0, 66, 114, 97, 115, 195, 169, 103, 97, 108, 105, 0, 71, 111, 98, 111, 117, 0, 70, 108, 111, 98, 105, 111, 0, 76, 97, 103, 103, 114, 111, 110, 0, 77, 101, 100, 104, 121, 195, 168, 110, 97, 0, 71, 114, 97, 104, 121, 195, 168, 110, 97, 0, 90, 105, 103, 122, 97, 116, 111, 110, 0, 76, 105, 110, 195, 169, 111, 110, 0, 67, 104, 101, 110, 105, 112, 111, 116, 116, 101, 0, 65, 114, 109, 117, 108, 121, 115, 0, 67, 104, 97, 114, 109, 105, 108, 108, 111, 110, 0, 66, 108, 105, 110, 100, 97, 108, 121, 115, 0, 80, 97, 112, 105, 110, 111, 120, 0, 78, 195, 169, 110, 117, 112, 105, 111, 116, 0, 76, 111, 109, 98, 114, 101, 0, 76, 117, 100, 105, 99, 111, 108, 111, 0, 71, 114, 97, 105, 110, 105, 112, 105, 111, 116, 0, 80, 105, 102, 101, 117, 105, 108, 0, 84, 101, 110, 103, 97, 108, 105, 99, 101, 0, 78, 105, 114, 111, 110, 100, 101, 108, 108, 101, 0, 72, 195, 169, 108, 195, 169, 100, 101, 108, 108, 101, 0, 71, 111, 195, 169, 108, 105, 115, 101, 0, 66, 101, 107, 105, 112, 97, 110, 0, 84, 97, 114, 115, 97, 108, 0, 75, 105, 114, 108, 105, 97, 0, 71, 97, 114, 100, 101, 118, 111, 105, 114, 0, 65, 114, 97, 107, 100, 111, 0, 77, 97, 115, 107, 97, 100, 114, 97, 0, 66, 97, 108, 105, 103, 110, 111, 110, 0, 67, 104, 97, 112, 105, 103, 110, 111, 110, 0, 80, 97, 114, 101, 99, 111, 111, 108, 0, 86, 105, 103, 111, 114, 111, 116, 104, 0, 77, 111, 110, 97, 102, 108, 195, 168, 109, 105, 116, 0, 78, 105, 110, 103, 97, 108, 101, 0, 78, 105, 110, 106, 97, 115, 107, 0, 77, 117, 110, 106, 97, 0, 67, 104, 117, 99, 104, 109, 117, 114, 0, 82, 97, 109, 98, 111, 117, 109, 0, 66, 114, 111, 117, 104, 97, 98, 97, 109, 0, 77, 97, 107, 117, 104, 105, 116, 97, 0, 72, 97, 114, 105, 121, 97, 109, 97, 0, 65, 122, 117, 114, 105, 108, 108, 0, 84, 97, 114, 105, 110, 111, 114, 0, 83, 107, 105, 116, 116, 121, 0, 68, 101, 108, 99, 97, 116, 116, 121, 0, 84, 195, 169, 110, 195, 169, 102, 105, 120, 0, 77, 121, 115, 100, 105, 98, 117, 108, 101, 0, 71, 97, 108, 101, 107, 105, 100, 0, 71, 97, 108, 101, 103, 111, 110, 0, 71, 97, 108, 101, 107, 105, 110, 103, 0, 77, 195, 169, 100, 105, 116, 105, 107, 107, 97, 0, 67, 104, 97, 114, 109, 105, 110, 97, 0, 68, 121, 110, 97, 118, 111, 108, 116, 0, 195, 137, 108, 101, 99, 115, 112, 114, 105, 110, 116, 0, 80, 111, 115, 105, 112, 105, 0, 78, 195, 169, 103, 97, 112, 105, 0, 77, 117, 99, 105, 111, 108, 101, 0, 76, 117, 109, 105, 118, 111, 108, 101, 0, 82, 111, 115, 195, 169, 108, 105, 97, 0, 71, 108, 111, 117, 112, 116, 105, 0, 65, 118, 97, 108, 116, 111, 117, 116, 0, 67, 97, 114, 118, 97, 110, 104, 97, 0, 83, 104, 97, 114, 112, 101, 100, 111, 0, 87, 97, 105, 108, 109, 101, 114, 0, 87, 97, 105, 108, 111, 114, 100, 0, 67, 104, 97, 109, 97, 108, 108, 111, 116, 0, 67, 97, 109, 195, 169, 114, 117, 112, 116, 0, 67, 104, 97, 114, 116, 111, 114, 0, 83, 112, 111, 105, 110, 107, 0, 71, 114, 111, 114, 101, 116, 0, 83, 112, 105, 110, 100, 97, 0, 75, 114, 97, 107, 110, 111, 105, 120, 0, 86, 105, 98, 114, 97, 110, 105, 110, 102, 0, 76, 105, 98, 195, 169, 103, 111, 110, 0, 67, 97, 99, 110, 101, 97, 0, 67, 97, 99, 116, 117, 114, 110, 101, 0, 84, 121, 108, 116, 111, 110, 0, 65, 108, 116, 97, 114, 105, 97, 0, 77, 97, 110, 103, 114, 105, 102, 102, 0, 83, 195, 169, 118, 105, 112, 101, 114, 0, 83, 195, 169, 108, 195, 169, 114, 111, 99, 0, 83, 111, 108, 97, 114, 111, 99, 0, 66, 97, 114, 108, 111, 99, 104, 101, 0, 66, 97, 114, 98, 105, 99, 104, 97, 0, 195, 137, 99, 114, 97, 112, 105, 110, 99, 101, 0, 67, 111, 108, 104, 111, 109, 97, 114, 100, 0, 66, 97, 108, 98, 117, 116, 111, 0, 75, 97, 111, 114, 105, 110, 101, 0, 76, 105, 108, 105, 97, 0, 86, 97, 99, 105, 108, 121, 115, 0, 65, 110, 111, 114, 105, 116, 104, 0, 65, 114, 109, 97, 108, 100, 111, 0, 66, 97, 114, 112, 97, 117, 0, 77, 105, 108, 111, 98, 101, 108, 108, 117, 115, 0, 77, 111, 114, 112, 104, 195, 169, 111, 0, 75, 101, 99, 108, 101, 111, 110, 0, 80, 111, 108, 105, 99, 104, 111, 109, 98, 114, 0, 66, 114, 97, 110, 101, 116, 116, 101, 0, 83, 107, 101, 108, 195, 169, 110, 111, 120, 0, 84, 195, 169, 114, 97, 99, 108, 111, 112, 101, 0, 84, 114, 111, 112, 105, 117, 115, 0, 195, 137, 111, 107, 111, 0, 65, 98, 115, 111, 108, 0, 79, 107, 195, 169, 111, 107, 195, 169, 0, 83, 116, 97, 108, 103, 97, 109, 105, 110, 0, 79, 110, 105, 103, 108, 97, 108, 105, 0, 79, 98, 97, 108, 105, 101, 0, 80, 104, 111, 103, 108, 101, 117, 114, 0, 75, 97, 105, 109, 111, 114, 115, 101, 0, 67, 111, 113, 117, 105, 112, 101, 114, 108, 0, 83, 101, 114, 112, 97, 110, 103, 0, 82, 111, 115, 97, 98, 121, 115, 115, 0, 82, 101, 108, 105, 99, 97, 110, 116, 104, 0, 76, 111, 118, 100, 105, 115, 99, 0, 68, 114, 97, 98, 121, 0, 68, 114, 97, 99, 107, 104, 97, 117, 115, 0, 68, 114, 97, 116, 116, 97, 107, 0, 84, 101, 114, 104, 97, 108, 0, 77, 195, 169, 116, 97, 110, 103, 0, 77, 195, 169, 116, 97, 108, 111, 115, 115, 101, 0, 82, 101, 103, 105, 114, 111, 99, 107, 0, 82, 101, 103, 105, 99, 101, 0, 82, 101, 103, 105, 115, 116, 101, 101, 108, 0, 76, 97, 116, 105, 97, 115, 0, 76, 97, 116, 105, 111, 115, 0, 75, 121, 111, 103, 114, 101, 0, 71, 114, 111, 117, 100, 111, 110, 0, 82, 97, 121, 113, 117, 97, 122, 97, 0, 74, 105, 114, 97, 99, 104, 105, 0, 68, 101, 111, 120, 121, 115, 0, 84, 111, 114, 116, 105, 112, 111, 117, 115, 115, 0, 66, 111, 115, 107, 97, 114, 97, 0, 84, 111, 114, 116, 101, 114, 114, 97, 0, 79, 117, 105, 115, 116, 105, 99, 114, 97, 109, 0, 67, 104, 105, 109, 112, 101, 110, 102, 101, 117, 0, 83, 105, 109, 105, 97, 98, 114, 97, 122, 0, 84, 105, 112, 108, 111, 117, 102, 0, 80, 114, 105, 110, 112, 108, 111, 117, 102, 0, 80, 105, 110, 103, 111, 108, 195, 169, 111, 110, 0, 195, 137, 116, 111, 117, 114, 109, 105, 0, 195, 137, 116, 111, 117, 114, 118, 111, 108, 0, 195, 137, 116, 111, 117, 114, 97, 112, 116, 111, 114, 0, 75, 101, 117, 110, 111, 116, 111, 114, 0, 67, 97, 115, 116, 111, 114, 110, 111, 0, 67, 114, 105, 107, 122, 105, 107, 0, 77, 195, 169, 108, 111, 107, 114, 105, 107, 0, 76, 105, 120, 121, 0, 76, 117, 120, 105, 111, 0, 76, 117, 120, 114, 97, 121, 0, 82, 111, 122, 98, 111, 117, 116, 111, 110, 0, 82, 111, 115, 101, 114, 97, 100, 101, 0, 75, 114, 97, 110, 105, 100, 111, 115, 0, 67, 104, 97, 114, 107, 111, 115, 0, 68, 105, 110, 111, 99, 108, 105, 101, 114, 0, 66, 97, 115, 116, 105, 111, 100, 111, 110, 0, 67, 104, 101, 110, 105, 116, 105, 0, 67, 104, 101, 110, 105, 115, 101, 108, 108, 101, 0, 80, 97, 112, 105, 108, 111, 114, 100, 0, 65, 112, 105, 116, 114, 105, 110, 105, 0, 65, 112, 105, 114, 101, 105, 110, 101, 0, 80, 97, 99, 104, 105, 114, 105, 115, 117, 0, 77, 117, 115, 116, 195, 169, 98, 111, 117, 195, 169, 101, 0, 77, 117, 115, 116, 195, 169, 102, 108, 111, 116, 116, 0, 67, 101, 114, 105, 98, 111, 117, 0, 67, 101, 114, 105, 102, 108, 111, 114, 0, 83, 97, 110, 99, 111, 107, 105, 0, 84, 114, 105, 116, 111, 115, 111, 114, 0, 67, 97, 112, 105, 100, 101, 120, 116, 114, 101, 0, 66, 97, 117, 100, 114, 105, 118, 101, 0, 71, 114, 111, 100, 114, 105, 118, 101, 0, 76, 97, 112, 111, 114, 101, 105, 108, 108, 101, 0, 76, 111, 99, 107, 112, 105, 110, 0, 77, 97, 103, 105, 114, 195, 170, 118, 101, 0, 67, 111, 114, 98, 111, 115, 115, 0, 67, 104, 97, 103, 108, 97, 109, 0, 67, 104, 97, 102, 102, 114, 101, 117, 120, 0, 75, 111, 114, 105, 108, 108, 111, 110, 0, 77, 111, 117, 102, 111, 117, 101, 116, 116, 101, 0, 77, 111, 117, 102, 102, 108, 97, 105, 114, 0, 65, 114, 99, 104, 195, 169, 111, 109, 105, 114, 101, 0, 65, 114, 99, 104, 195, 169, 111, 100, 111, 110, 103, 0, 77, 97, 110, 122, 97, 195, 175, 0, 77, 105, 109, 101, 32, 74, 114, 46, 0, 80, 116, 105, 114, 97, 118, 105, 0, 80, 105, 106, 97, 107, 111, 0, 83, 112, 105, 114, 105, 116, 111, 109, 98, 0, 71, 114, 105, 107, 110, 111, 116, 0, 67, 97, 114, 109, 97, 99, 104, 101, 0, 67, 97, 114, 99, 104, 97, 99, 114, 111, 107, 0, 71, 111, 105, 110, 102, 114, 101, 120, 0, 82, 105, 111, 108, 117, 0, 76, 117, 99, 97, 114, 105, 111, 0, 72, 105, 112, 112, 111, 112, 111, 116, 97, 115, 0, 72, 105, 112, 112, 111, 100, 111, 99, 117, 115, 0, 82, 97, 112, 105, 111, 110, 0, 68, 114, 97, 115, 99, 111, 114, 101, 0, 67, 114, 97, 100, 111, 112, 97, 117, 100, 0, 67, 111, 97, 116, 111, 120, 0, 86, 111, 114, 116, 101, 110, 116, 101, 0, 195, 137, 99, 97, 121, 111, 110, 0, 76, 117, 109, 105, 110, 195, 169, 111, 110, 0, 66, 97, 98, 105, 109, 97, 110, 116, 97, 0, 66, 108, 105, 122, 122, 105, 0, 66, 108, 105, 122, 122, 97, 114, 111, 105, 0, 68, 105, 109, 111, 114, 101, 116, 0, 77, 97, 103, 110, 195, 169, 122, 111, 110, 101, 0, 67, 111, 117, 100, 108, 97, 110, 103, 117, 101, 0, 82, 104, 105, 110, 97, 115, 116, 111, 99, 0, 66, 111, 117, 108, 100, 101, 110, 101, 117, 0, 195, 137, 108, 101, 107, 97, 98, 108, 101, 0, 77, 97, 103, 97, 110, 111, 110, 0, 84, 111, 103, 101, 107, 105, 115, 115, 0, 89, 97, 110, 109, 101, 103, 97, 0, 80, 104, 121, 108, 108, 97, 108, 105, 0, 71, 105, 118, 114, 97, 108, 105, 0, 83, 99, 111, 114, 118, 111, 108, 0, 77, 97, 109, 109, 111, 99, 104, 111, 110, 0, 80, 111, 114, 121, 103, 111, 110, 45, 90, 0, 71, 97, 108, 108, 97, 109, 101, 0, 84, 97, 114, 105, 110, 111, 114, 109, 101, 0, 78, 111, 99, 116, 117, 110, 111, 105, 114, 0, 77, 111, 109, 97, 114, 116, 105, 107, 0, 77, 111, 116, 105, 115, 109, 97, 0, 67, 114, 195, 169, 104, 101, 108, 102, 0, 67, 114, 195, 169, 102, 111, 108, 108, 101, 116, 0, 67, 114, 195, 169, 102, 97, 100, 101, 116, 0, 68, 105, 97, 108, 103, 97, 0, 80, 97, 108, 107, 105, 97, 0, 72, 101, 97, 116, 114, 97, 110, 0, 82, 101, 103, 105, 103, 105, 103, 97, 115, 0, 71, 105, 114, 97, 116, 105, 110, 97, 0, 67, 114, 101, 115, 115, 101, 108, 105, 97, 0, 80, 104, 105, 111, 110, 101, 0, 77, 97, 110, 97, 112, 104, 121, 0, 68, 97, 114, 107, 114, 97, 105, 0, 83, 104, 97, 121, 109, 105, 110, 0, 65, 114, 99, 101, 117, 115, 0, 86, 105, 99, 116, 105, 110, 105, 0, 86, 105, 112, 195, 169, 108, 105, 101, 114, 114, 101, 0, 76, 105, 97, 110, 97, 106, 97, 0, 77, 97, 106, 97, 115, 112, 105, 99, 0, 71, 114, 117, 105, 107, 117, 105, 0, 71, 114, 111, 116, 105, 99, 104, 111, 110, 0, 82, 111, 105, 116, 105, 102, 108, 97, 109, 0, 77, 111, 117, 115, 116, 105, 108, 108, 111, 110, 0, 77, 97, 116, 101, 108, 111, 117, 116, 114, 101, 0, 67, 108, 97, 109, 105, 114, 97, 108, 0, 82, 97, 116, 101, 110, 116, 105, 102, 0, 77, 105, 114, 97, 100, 97, 114, 0, 80, 111, 110, 99, 104, 105, 111, 116, 0, 80, 111, 110, 99, 104, 105, 101, 110, 0, 77, 97, 115, 116, 111, 117, 102, 102, 101, 0, 67, 104, 97, 99, 114, 105, 112, 97, 110, 0, 76, 195, 169, 111, 112, 97, 114, 100, 117, 115, 0, 70, 101, 117, 105, 108, 108, 97, 106, 111, 117, 0, 70, 101, 117, 105, 108, 111, 117, 116, 97, 110, 0, 70, 108, 97, 109, 97, 106, 111, 117, 0, 70, 108, 97, 109, 111, 117, 116, 97, 110, 0, 70, 108, 111, 116, 97, 106, 111, 117, 0, 70, 108, 111, 116, 111, 117, 116, 97, 110, 0, 77, 117, 110, 110, 97, 0, 77, 117, 115, 104, 97, 110, 97, 0, 80, 111, 105, 99, 104, 105, 103, 101, 111, 110, 0, 67, 111, 108, 111, 109, 98, 101, 97, 117, 0, 68, 195, 169, 102, 108, 97, 105, 115, 97, 110, 0, 90, 195, 169, 98, 105, 98, 114, 111, 110, 0, 90, 195, 169, 98, 108, 105, 116, 122, 0, 78, 111, 100, 117, 108, 105, 116, 104, 101, 0, 71, 195, 169, 111, 108, 105, 116, 104, 101, 0, 71, 105, 103, 97, 108, 105, 116, 104, 101, 0, 67, 104, 111, 118, 115, 111, 117, 114, 105, 114, 0, 82, 104, 105, 110, 111, 108, 111, 118, 101, 0, 82, 111, 116, 111, 116, 97, 117, 112, 101, 0, 77, 105, 110, 111, 116, 97, 117, 112, 101, 0, 78, 97, 110, 109, 195, 169, 111, 117, 195, 175, 101, 0, 67, 104, 97, 114, 112, 101, 110, 116, 105, 0, 79, 117, 118, 114, 105, 102, 105, 101, 114, 0, 66, 195, 169, 116, 111, 99, 104, 101, 102, 0, 84, 114, 105, 116, 111, 110, 100, 101, 0, 66, 97, 116, 114, 97, 99, 110, 195, 169, 0, 67, 114, 97, 112, 117, 115, 116, 117, 108, 101, 0, 74, 117, 100, 111, 107, 114, 97, 107, 0, 75, 97, 114, 97, 99, 108, 195, 169, 101, 0, 76, 97, 114, 118, 101, 121, 101, 116, 116, 101, 0, 67, 111, 117, 118, 101, 114, 100, 117, 114, 101, 0, 77, 97, 110, 116, 101, 114, 110, 101, 108, 0, 86, 101, 110, 105, 112, 97, 116, 116, 101, 0, 83, 99, 111, 98, 111, 108, 105, 100, 101, 0, 66, 114, 117, 116, 97, 112, 111, 100, 101, 0, 68, 111, 117, 100, 111, 117, 118, 101, 116, 0, 70, 97, 114, 102, 97, 100, 117, 118, 101, 116, 0, 67, 104, 108, 111, 114, 111, 98, 117, 108, 101, 0, 70, 114, 97, 103, 105, 108, 97, 100, 121, 0, 66, 97, 114, 103, 97, 110, 116, 117, 97, 0, 77, 97, 115, 99, 97, 195, 175, 109, 97, 110, 0, 69, 115, 99, 114, 111, 99, 111, 0, 67, 114, 111, 99, 111, 114, 105, 98, 108, 101, 0, 68, 97, 114, 117, 109, 97, 114, 111, 110, 100, 0, 68, 97, 114, 117, 109, 97, 99, 104, 111, 0, 77, 97, 114, 97, 99, 97, 99, 104, 105, 0, 67, 114, 97, 98, 105, 99, 111, 113, 117, 101, 0, 67, 114, 97, 98, 97, 114, 97, 113, 117, 101, 0, 66, 97, 103, 103, 105, 103, 117, 97, 110, 101, 0, 66, 97, 103, 103, 97, 195, 175, 100, 0, 67, 114, 121, 112, 116, 195, 169, 114, 111, 0, 84, 117, 116, 97, 102, 101, 104, 0, 84, 117, 116, 97, 110, 107, 97, 102, 101, 114, 0, 67, 97, 114, 97, 112, 97, 103, 111, 115, 0, 77, 195, 169, 103, 97, 112, 97, 103, 111, 115, 0, 65, 114, 107, 195, 169, 97, 112, 116, 105, 0, 65, 195, 169, 114, 111, 112, 116, 195, 169, 114, 121, 120, 0, 77, 105, 97, 109, 105, 97, 115, 109, 101, 0, 77, 105, 97, 115, 109, 97, 120, 0, 90, 111, 114, 117, 97, 0, 90, 111, 114, 111, 97, 114, 107, 0, 67, 104, 105, 110, 99, 104, 105, 100, 111, 117, 0, 80, 97, 115, 104, 109, 105, 108, 108, 97, 0, 83, 99, 114, 117, 116, 101, 108, 108, 97, 0, 77, 101, 115, 109, 195, 169, 114, 101, 108, 108, 97, 0, 83, 105, 100, 195, 169, 114, 101, 108, 108, 97, 0, 78, 117, 99, 108, 195, 169, 111, 115, 0, 77, 195, 169, 105, 111, 115, 0, 83, 121, 109, 98, 105, 111, 115, 0, 67, 111, 117, 97, 110, 101, 116, 111, 110, 0, 76, 97, 107, 109, 195, 169, 99, 121, 103, 110, 101, 0, 83, 111, 114, 98, 195, 169, 98, 195, 169, 0, 83, 111, 114, 98, 111, 117, 108, 0, 83, 111, 114, 98, 111, 117, 98, 111, 117, 108, 0, 86, 105, 118, 97, 108, 100, 97, 105, 109, 0, 72, 97, 121, 100, 97, 105, 109, 0, 69, 109, 111, 108, 103, 97, 0, 67, 97, 114, 97, 98, 105, 110, 103, 0, 76, 97, 110, 195, 167, 97, 114, 103, 111, 116, 0, 84, 114, 111, 109, 112, 105, 103, 110, 111, 110, 0, 71, 97, 117, 108, 101, 116, 0, 86, 105, 115, 107, 117, 115, 101, 0, 77, 111, 121, 97, 100, 101, 0, 77, 97, 109, 97, 110, 98, 111, 0, 83, 116, 97, 116, 105, 116, 105, 107, 0, 77, 121, 103, 97, 118, 111, 108, 116, 0, 71, 114, 105, 110, 100, 117, 114, 0, 78, 111, 97, 99, 105, 101, 114, 0, 84, 105, 99, 0, 67, 108, 105, 99, 0, 67, 108, 105, 116, 105, 99, 108, 105, 99, 0, 65, 110, 99, 104, 119, 97, 116, 116, 0, 76, 97, 109, 112, 195, 169, 114, 111, 105, 101, 0, 79, 104, 109, 97, 115, 115, 97, 99, 114, 101, 0, 76, 101, 119, 115, 111, 114, 0, 78, 101, 105, 116, 114, 97, 109, 0, 70, 117, 110, 195, 169, 99, 105, 114, 101, 0, 77, 195, 169, 108, 97, 110, 99, 111, 108, 117, 120, 0, 76, 117, 103, 117, 108, 97, 98, 114, 101, 0, 67, 111, 117, 112, 101, 110, 111, 116, 116, 101, 0, 73, 110, 99, 105, 115, 97, 99, 104, 101, 0, 84, 114, 97, 110, 99, 104, 111, 100, 111, 110, 0, 80, 111, 108, 97, 114, 104, 117, 109, 101, 0, 80, 111, 108, 97, 103, 114, 105, 102, 102, 101, 0, 72, 101, 120, 97, 103, 101, 108, 0, 69, 115, 99, 97, 114, 103, 97, 117, 109, 101, 0, 76, 105, 109, 97, 115, 112, 101, 101, 100, 0, 76, 105, 109, 111, 110, 100, 101, 0, 75, 117, 110, 103, 102, 111, 117, 105, 110, 101, 0, 83, 104, 97, 111, 102, 111, 117, 105, 110, 101, 0, 68, 114, 97, 107, 107, 97, 114, 109, 105, 110, 0, 71, 114, 105, 110, 103, 111, 108, 101, 109, 0, 71, 111, 108, 101, 109, 97, 115, 116, 111, 99, 0, 83, 99, 97, 108, 112, 105, 111, 110, 0, 83, 99, 97, 108, 112, 114, 111, 105, 101, 0, 70, 114, 105, 115, 111, 110, 0, 70, 117, 114, 97, 105, 103, 108, 111, 110, 0, 71, 117, 101, 114, 105, 97, 105, 103, 108, 101, 0, 86, 111, 115, 116, 111, 117, 114, 110, 111, 0, 86, 97, 117, 116, 117, 116, 114, 105, 99, 101, 0, 65, 102, 108, 97, 109, 97, 110, 111, 105, 114, 0, 70, 101, 114, 109, 105, 116, 101, 0, 83, 111, 108, 111, 99, 104, 105, 0, 68, 105, 97, 109, 97, 116, 0, 84, 114, 105, 111, 120, 104, 121, 100, 114, 101, 0, 80, 121, 114, 111, 110, 105, 108, 108, 101, 0, 80, 121, 114, 97, 120, 0, 67, 111, 98, 97, 108, 116, 105, 117, 109, 0, 84, 101, 114, 114, 97, 107, 105, 117, 109, 0, 86, 105, 114, 105, 100, 105, 117, 109, 0, 66, 111, 114, 195, 169, 97, 115, 0, 70, 117, 108, 103, 117, 114, 105, 115, 0, 82, 101, 115, 104, 105, 114, 97, 109, 0, 90, 101, 107, 114, 111, 109, 0, 68, 195, 169, 109, 195, 169, 116, 195, 169, 114, 111, 115, 0, 75, 121, 117, 114, 101, 109, 0, 75, 101, 108, 100, 101, 111, 0, 77, 101, 108, 111, 101, 116, 116, 97, 0, 71, 101, 110, 101, 115, 101, 99, 116, 0, 77, 97, 114, 105, 115, 115, 111, 110, 0, 66, 111, 103, 117, 195, 169, 114, 105, 115, 115, 101, 0, 66, 108, 105, 110, 100, 195, 169, 112, 105, 113, 117, 101, 0, 70, 101, 117, 110, 110, 101, 99, 0, 82, 111, 117, 115, 115, 105, 108, 0, 71, 111, 117, 112, 101, 108, 105, 110, 0, 71, 114, 101, 110, 111, 117, 115, 115, 101, 0, 67, 114, 111, 195, 162, 112, 111, 114, 97, 108, 0, 65, 109, 112, 104, 105, 110, 111, 98, 105, 0, 83, 97, 112, 101, 114, 101, 97, 117, 0, 69, 120, 99, 97, 118, 97, 114, 101, 110, 110, 101, 0, 80, 97, 115, 115, 101, 114, 111, 117, 103, 101, 0, 66, 114, 97, 105, 115, 105, 108, 108, 111, 110, 0, 70, 108, 97, 109, 98, 117, 115, 97, 114, 100, 0, 76, 195, 169, 112, 105, 100, 111, 110, 105, 108, 108, 101, 0, 80, 195, 169, 114, 195, 169, 103, 114, 97, 105, 110, 0, 80, 114, 105, 115, 109, 105, 108, 108, 111, 110, 0, 72, 195, 169, 108, 105, 111, 110, 99, 101, 97, 117, 0, 78, 195, 169, 109, 195, 169, 108, 105, 111, 115, 0, 70, 108, 97, 98, 195, 169, 98, 195, 169, 0, 70, 108, 111, 101, 116, 116, 101, 0, 70, 108, 111, 114, 103, 101, 115, 0, 67, 97, 98, 114, 105, 111, 108, 97, 105, 110, 101, 0, 67, 104, 101, 118, 114, 111, 117, 109, 0, 80, 97, 110, 100, 101, 115, 112, 105, 195, 168, 103, 108, 101, 0, 80, 97, 110, 100, 97, 114, 98, 97, 114, 101, 0, 67, 111, 117, 97, 102, 97, 114, 101, 108, 0, 80, 115, 121, 115, 116, 105, 103, 114, 105, 0, 77, 105, 115, 116, 105, 103, 114, 105, 120, 0, 77, 111, 110, 111, 114, 112, 97, 108, 101, 0, 68, 105, 109, 111, 99, 108, 195, 168, 115, 0, 69, 120, 97, 103, 105, 100, 101, 0, 70, 108, 117, 118, 101, 116, 105, 110, 0, 67, 111, 99, 111, 116, 105, 110, 101, 0, 83, 117, 99, 114, 111, 113, 117, 105, 110, 0, 67, 117, 112, 99, 97, 110, 97, 105, 108, 108, 101, 0, 83, 101, 112, 105, 97, 116, 111, 112, 0, 83, 101, 112, 105, 97, 116, 114, 111, 99, 101, 0, 79, 112, 101, 114, 109, 105, 110, 101, 0, 71, 111, 108, 103, 111, 112, 97, 116, 104, 101, 0, 86, 101, 110, 97, 108, 103, 117, 101, 0, 75, 114, 97, 118, 97, 114, 101, 99, 104, 0, 70, 108, 105, 110, 103, 111, 117, 115, 116, 101, 0, 71, 97, 109, 98, 108, 97, 115, 116, 0, 71, 97, 108, 118, 97, 114, 97, 110, 0, 73, 103, 117, 111, 108, 116, 97, 0, 80, 116, 121, 114, 97, 110, 105, 100, 117, 114, 0, 82, 101, 120, 105, 108, 108, 105, 117, 115, 0, 65, 109, 97, 103, 97, 114, 97, 0, 68, 114, 97, 103, 109, 97, 114, 97, 0, 78, 121, 109, 112, 104, 97, 108, 105, 0, 66, 114, 117, 116, 97, 108, 105, 98, 114, 195, 169, 0, 68, 101, 100, 101, 110, 110, 101, 0, 83, 116, 114, 97, 115, 115, 105, 101, 0, 77, 117, 99, 117, 115, 99, 117, 108, 101, 0, 67, 111, 108, 105, 109, 117, 99, 117, 115, 0, 77, 117, 112, 108, 111, 100, 111, 99, 117, 115, 0, 84, 114, 111, 117, 115, 115, 101, 108, 105, 110, 0, 66, 114, 111, 99, 195, 169, 108, 195, 180, 109, 101, 0, 68, 101, 115, 115, 195, 169, 108, 105, 97, 110, 100, 101, 0, 80, 105, 116, 114, 111, 117, 105, 108, 108, 101, 0, 66, 97, 110, 115, 104, 105, 116, 114, 111, 117, 121, 101, 0, 71, 114, 101, 108, 97, 195, 167, 111, 110, 0, 83, 195, 169, 114, 97, 99, 114, 97, 119, 108, 0, 83, 111, 110, 105, 115, 116, 114, 101, 108, 108, 101, 0, 66, 114, 117, 121, 118, 101, 114, 110, 101, 0, 88, 101, 114, 110, 101, 97, 115, 0, 89, 118, 101, 108, 116, 97, 108, 0, 90, 121, 103, 97, 114, 100, 101, 0, 68, 105, 97, 110, 99, 105, 101, 0, 72, 111, 111, 112, 97, 0, 86, 111, 108, 99, 97, 110, 105, 111, 110, 0, 66, 114, 105, 110, 100, 105, 98, 111, 117, 0, 69, 102, 102, 108, 195, 168, 99, 104, 101, 0, 65, 114, 99, 104, 195, 169, 100, 117, 99, 0, 70, 108, 97, 109, 105, 97, 111, 117, 0, 77, 97, 116, 111, 117, 102, 101, 117, 0, 70, 195, 169, 108, 105, 110, 102, 101, 114, 110, 111, 0, 79, 116, 97, 113, 117, 105, 110, 0, 79, 116, 97, 114, 108, 101, 116, 116, 101, 0, 79, 114, 97, 116, 111, 114, 105, 97, 0, 80, 105, 99, 97, 115, 115, 97, 117, 116, 0, 80, 105, 99, 108, 97, 105, 114, 111, 110, 0, 66, 97, 122, 111, 117, 99, 97, 110, 0, 77, 97, 110, 103, 108, 111, 117, 116, 111, 110, 0, 65, 114, 103, 111, 117, 115, 116, 101, 0, 76, 97, 114, 118, 105, 98, 117, 108, 101, 0, 67, 104, 114, 121, 115, 97, 112, 105, 108, 101, 0, 76, 117, 99, 97, 110, 111, 110, 0, 67, 114, 97, 98, 97, 103, 97, 114, 114, 101, 0, 67, 114, 97, 98, 111, 109, 105, 110, 97, 98, 108, 101, 0, 80, 108, 117, 109, 101, 108, 105, 110, 101, 0, 66, 111, 109, 98, 121, 100, 111, 117, 0, 82, 117, 98, 111, 109, 98, 101, 108, 108, 101, 0, 82, 111, 99, 97, 98, 111, 116, 0, 76, 111, 117, 103, 97, 114, 111, 99, 0, 70, 114, 111, 117, 115, 115, 97, 114, 100, 105, 110, 101, 0, 86, 111, 114, 97, 115, 116, 195, 169, 114, 105, 101, 0, 80, 114, 195, 169, 100, 97, 115, 116, 195, 169, 114, 105, 101, 0, 84, 105, 98, 111, 117, 100, 101, 116, 0, 66, 111, 117, 114, 114, 105, 110, 111, 115, 0, 65, 114, 97, 113, 117, 97, 0, 84, 97, 114, 101, 110, 98, 117, 108, 108, 101, 0, 77, 105, 109, 97, 110, 116, 105, 115, 0, 70, 108, 111, 114, 97, 109, 97, 110, 116, 105, 115, 0, 83, 112, 111, 100, 111, 100, 111, 0, 76, 97, 109, 112, 105, 103, 110, 111, 110, 0, 84, 114, 105, 116, 111, 120, 0, 77, 97, 108, 97, 109, 97, 110, 100, 114, 101, 0, 78, 111, 117, 110, 111, 117, 114, 115, 111, 110, 0, 67, 104, 101, 108, 111, 117, 114, 115, 0, 67, 114, 111, 113, 117, 105, 110, 101, 0, 67, 97, 110, 100, 105, 110, 101, 0, 83, 117, 99, 114, 101, 105, 110, 101, 0, 71, 117, 195, 169, 114, 105, 108, 97, 110, 100, 101, 0, 71, 111, 117, 114, 111, 117, 116, 97, 110, 0, 81, 117, 97, 114, 116, 101, 114, 109, 97, 99, 0, 83, 111, 118, 107, 105, 112, 111, 117, 0, 83, 97, 114, 109, 117, 114, 97, 195, 175, 0, 66, 97, 99, 97, 98, 111, 117, 104, 0, 84, 114, 195, 169, 112, 97, 115, 115, 97, 98, 108, 101, 0, 67, 111, 110, 99, 111, 109, 98, 97, 102, 102, 101, 0, 84, 121, 112, 101, 58, 48, 0, 83, 105, 108, 118, 97, 108, 108, 105, 195, 169, 0, 77, 195, 169, 116, 195, 169, 110, 111, 0, 68, 111, 100, 111, 97, 108, 97, 0, 66, 111, 117, 109, 97, 116, 97, 0, 84, 111, 103, 101, 100, 101, 109, 97, 114, 117, 0, 77, 105, 109, 105, 113, 117, 105, 0, 68, 101, 110, 116, 105, 99, 114, 105, 115, 115, 101, 0, 68, 114, 97, 195, 175, 101, 117, 108, 0, 83, 105, 110, 105, 115, 116, 114, 97, 105, 108, 0, 66, 195, 169, 98, 195, 169, 99, 97, 105, 108, 108, 101, 0, 195, 137, 99, 97, 195, 175, 100, 0, 195, 137, 107, 97, 195, 175, 115, 101, 114, 0, 84, 111, 107, 111, 114, 105, 99, 111, 0, 84, 111, 107, 111, 112, 105, 121, 111, 110, 0, 84, 111, 107, 111, 116, 111, 114, 111, 0, 84, 111, 107, 111, 112, 105, 115, 99, 111, 0, 67, 111, 115, 109, 111, 103, 0, 67, 111, 115, 109, 111, 118, 117, 109, 0, 83, 111, 108, 103, 97, 108, 101, 111, 0, 76, 117, 110, 97, 108, 97, 0, 90, 195, 169, 114, 111, 195, 175, 100, 0, 77, 111, 117, 115, 99, 111, 116, 111, 0, 67, 97, 110, 99, 114, 101, 108, 111, 118, 101, 0, 67, 195, 162, 98, 108, 105, 102, 195, 168, 114, 101, 0, 66, 97, 109, 98, 111, 105, 115, 101, 108, 108, 101, 0, 75, 97, 116, 97, 103, 97, 109, 105, 0, 69, 110, 103, 108, 111, 117, 116, 121, 114, 97, 110, 0, 78, 101, 99, 114, 111, 122, 109, 97, 0, 77, 97, 103, 101, 97, 114, 110, 97, 0, 77, 97, 114, 115, 104, 97, 100, 111, 119, 0, 86, 195, 169, 109, 105, 110, 105, 0, 77, 97, 110, 100, 114, 105, 108, 108, 111, 110, 0, 65, 109, 97, 45, 65, 109, 97, 0, 80, 105, 101, 114, 114, 111, 116, 101, 107, 110, 105, 107, 0, 90, 101, 114, 97, 111, 114, 97, 0 };
-
-constexpr std::array<u8, 564> characteristic_it = { 78, 101, 115, 115, 117, 110, 97, 0, 65, 100, 111, 114, 97, 32, 109, 97, 110, 103, 105, 97, 114, 101, 0, 83, 105, 32, 97, 100, 100, 111, 114, 109, 101, 110, 116, 97, 32, 115, 112, 101, 115, 115, 111, 0, 68, 111, 114, 109, 101, 32, 97, 32, 108, 117, 110, 103, 111, 0, 76, 97, 115, 99, 105, 97, 32, 99, 111, 115, 101, 32, 105, 110, 32, 103, 105, 114, 111, 0, 65, 100, 111, 114, 97, 32, 114, 105, 108, 97, 115, 115, 97, 114, 115, 105, 0, 76, 97, 32, 102, 111, 114, 122, 97, 32, 195, 168, 32, 105, 108, 32, 115, 117, 111, 32, 118, 97, 110, 116, 111, 0, 65, 100, 111, 114, 97, 32, 100, 105, 109, 101, 110, 97, 114, 115, 105, 0, 83, 105, 32, 97, 114, 114, 97, 98, 98, 105, 97, 32, 102, 97, 99, 105, 108, 109, 101, 110, 116, 101, 0, 65, 100, 111, 114, 97, 32, 99, 111, 109, 98, 97, 116, 116, 101, 114, 101, 0, 70, 97, 99, 105, 108, 109, 101, 110, 116, 101, 32, 105, 114, 114, 105, 116, 97, 98, 105, 108, 101, 0, 72, 97, 32, 117, 110, 32, 99, 111, 114, 112, 111, 32, 114, 111, 98, 117, 115, 116, 111, 0, 70, 111, 114, 116, 101, 32, 105, 110, 32, 97, 116, 116, 97, 99, 99, 111, 0, 77, 111, 108, 116, 111, 32, 111, 115, 116, 105, 110, 97, 116, 111, 0, 77, 111, 108, 116, 111, 32, 112, 97, 122, 105, 101, 110, 116, 101, 0, 77, 111, 108, 116, 111, 32, 116, 101, 110, 97, 99, 101, 0, 65, 100, 111, 114, 97, 32, 99, 111, 114, 114, 101, 114, 101, 0, 70, 97, 32, 97, 116, 116, 101, 110, 122, 105, 111, 110, 101, 32, 97, 105, 32, 115, 117, 111, 110, 105, 0, 73, 114, 114, 117, 101, 110, 116, 101, 32, 101, 32, 115, 101, 109, 112, 108, 105, 99, 101, 0, 85, 110, 97, 32, 115, 112, 101, 99, 105, 101, 32, 100, 105, 32, 98, 117, 102, 102, 111, 110, 101, 0, 83, 97, 32, 102, 117, 103, 103, 105, 114, 101, 32, 118, 101, 108, 111, 99, 101, 109, 101, 110, 116, 101, 0, 71, 114, 97, 110, 100, 101, 32, 102, 105, 99, 99, 97, 110, 97, 115, 111, 0, 65, 108, 113, 117, 97, 110, 116, 111, 32, 118, 105, 118, 97, 99, 101, 0, 69, 115, 116, 114, 101, 109, 97, 109, 101, 110, 116, 101, 32, 115, 97, 103, 97, 99, 101, 0, 83, 105, 32, 112, 101, 114, 100, 101, 32, 110, 101, 108, 32, 115, 117, 111, 32, 109, 111, 110, 100, 111, 0, 77, 111, 108, 116, 111, 32, 101, 115, 105, 103, 101, 110, 116, 101, 0, 83, 97, 32, 105, 108, 32, 102, 97, 116, 116, 111, 32, 115, 117, 111, 0, 65, 98, 98, 97, 115, 116, 97, 110, 122, 97, 32, 115, 117, 112, 101, 114, 102, 105, 99, 105, 97, 108, 101, 0, 77, 111, 108, 116, 111, 32, 105, 110, 115, 111, 108, 101, 110, 116, 101, 0, 78, 111, 110, 32, 115, 111, 112, 112, 111, 114, 116, 97, 32, 112, 101, 114, 100, 101, 114, 101, 0, 85, 110, 32, 112, 111, 39, 32, 116, 101, 115, 116, 97, 114, 100, 111, 0 };
-
-constexpr std::array<u8, 2376> dppt_it = { 48, 44, 67, 97, 110, 97, 108, 105, 112, 111, 108, 105, 0, 49, 44, 69, 118, 111, 112, 111, 108, 105, 0, 50, 44, 80, 114, 97, 116, 111, 112, 111, 108, 105, 0, 51, 44, 65, 114, 101, 110, 105, 112, 111, 108, 105, 0, 52, 44, 76, 101, 103, 97, 32, 80, 111, 107, 195, 169, 109, 111, 110, 0, 53, 44, 67, 97, 118, 97, 32, 77, 105, 110, 101, 114, 111, 112, 111, 108, 105, 32, 80, 49, 0, 54, 44, 67, 97, 118, 97, 32, 77, 105, 110, 101, 114, 111, 112, 111, 108, 105, 32, 80, 49, 83, 0, 55, 44, 73, 109, 112, 105, 97, 110, 116, 111, 32, 84, 117, 114, 98, 105, 110, 101, 0, 56, 44, 66, 111, 115, 99, 111, 32, 69, 118, 111, 112, 111, 108, 105, 0, 57, 44, 70, 111, 110, 100, 101, 114, 105, 101, 32, 70, 117, 101, 103, 111, 0, 49, 48, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 40, 69, 110, 116, 114, 97, 116, 97, 32, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 48, 55, 47, 50, 48, 56, 41, 0, 49, 49, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 80, 50, 0, 49, 50, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 80, 51, 0, 49, 51, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 45, 32, 78, 101, 118, 101, 0, 49, 52, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 80, 52, 0, 49, 53, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 80, 53, 0, 49, 54, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 80, 54, 0, 49, 55, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 80, 55, 0, 49, 56, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 45, 32, 71, 114, 111, 116, 116, 97, 32, 105, 110, 32, 67, 105, 109, 97, 0, 49, 57, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 40, 69, 110, 116, 114, 97, 116, 97, 32, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 49, 54, 41, 0, 50, 48, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 40, 69, 110, 116, 114, 97, 116, 97, 32, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 49, 49, 41, 0, 50, 49, 44, 77, 111, 110, 116, 101, 32, 67, 111, 114, 111, 110, 97, 32, 80, 49, 83, 0, 50, 50, 44, 71, 114, 97, 110, 32, 80, 97, 108, 117, 100, 101, 32, 45, 32, 65, 114, 101, 97, 32, 49, 0, 50, 51, 44, 71, 114, 97, 110, 32, 80, 97, 108, 117, 100, 101, 32, 45, 32, 65, 114, 101, 97, 32, 50, 0, 50, 52, 44, 71, 114, 97, 110, 32, 80, 97, 108, 117, 100, 101, 32, 45, 32, 65, 114, 101, 97, 32, 51, 0, 50, 53, 44, 71, 114, 97, 110, 32, 80, 97, 108, 117, 100, 101, 32, 45, 32, 65, 114, 101, 97, 32, 52, 0, 50, 54, 44, 71, 114, 97, 110, 32, 80, 97, 108, 117, 100, 101, 32, 45, 32, 65, 114, 101, 97, 32, 53, 0, 50, 55, 44, 71, 114, 97, 110, 32, 80, 97, 108, 117, 100, 101, 32, 45, 32, 65, 114, 101, 97, 32, 54, 0, 50, 56, 44, 82, 111, 118, 105, 110, 101, 32, 70, 108, 101, 109, 109, 105, 110, 105, 97, 0, 50, 57, 44, 86, 105, 97, 32, 86, 105, 116, 116, 111, 114, 105, 97, 32, 45, 32, 80, 49, 0, 51, 48, 44, 86, 105, 97, 32, 86, 105, 116, 116, 111, 114, 105, 97, 32, 45, 32, 80, 50, 0, 51, 49, 44, 86, 105, 97, 32, 86, 105, 116, 116, 111, 114, 105, 97, 32, 45, 32, 80, 49, 83, 0, 51, 50, 44, 86, 105, 97, 32, 86, 105, 116, 116, 111, 114, 105, 97, 32, 45, 32, 83, 116, 97, 110, 122, 97, 32, 115, 117, 108, 32, 82, 101, 116, 114, 111, 32, 49, 0, 51, 51, 44, 86, 105, 97, 32, 86, 105, 116, 116, 111, 114, 105, 97, 32, 45, 32, 83, 116, 97, 110, 122, 97, 32, 115, 117, 108, 32, 82, 101, 116, 114, 111, 32, 50, 0, 51, 52, 44, 86, 105, 97, 32, 86, 105, 116, 116, 111, 114, 105, 97, 32, 45, 32, 83, 116, 97, 110, 122, 97, 32, 115, 117, 108, 32, 82, 101, 116, 114, 111, 32, 51, 0, 51, 53, 44, 67, 97, 109, 109, 105, 110, 111, 32, 82, 111, 99, 99, 105, 111, 115, 111, 0, 51, 54, 44, 86, 97, 114, 99, 111, 32, 77, 105, 110, 101, 114, 111, 112, 111, 108, 105, 32, 80, 49, 0, 51, 55, 44, 86, 97, 114, 99, 111, 32, 77, 105, 110, 101, 114, 111, 112, 111, 108, 105, 32, 80, 49, 83, 0, 51, 56, 44, 77, 111, 110, 116, 101, 32, 79, 115, 116, 105, 108, 101, 0, 51, 57, 44, 77, 111, 110, 116, 101, 32, 79, 115, 116, 105, 108, 101, 32, 45, 32, 69, 110, 116, 114, 97, 116, 97, 0, 52, 48, 44, 77, 111, 110, 116, 101, 32, 79, 115, 116, 105, 108, 101, 32, 45, 32, 73, 110, 116, 101, 114, 110, 111, 0, 52, 49, 44, 70, 111, 110, 116, 101, 32, 83, 97, 108, 117, 116, 111, 0, 52, 50, 44, 71, 114, 111, 116, 116, 97, 32, 82, 105, 116, 111, 114, 110, 111, 32, 45, 32, 69, 110, 116, 114, 97, 116, 97, 0, 52, 51, 44, 71, 114, 111, 116, 116, 97, 32, 82, 105, 116, 111, 114, 110, 111, 32, 45, 32, 80, 105, 108, 97, 115, 116, 114, 111, 32, 49, 0, 52, 52, 44, 71, 114, 111, 116, 116, 97, 32, 82, 105, 116, 111, 114, 110, 111, 32, 45, 32, 80, 105, 108, 97, 115, 116, 114, 111, 32, 50, 0, 52, 53, 44, 84, 101, 109, 112, 105, 111, 32, 78, 101, 118, 101, 112, 111, 108, 105, 32, 80, 49, 0, 52, 54, 44, 84, 101, 109, 112, 105, 111, 32, 78, 101, 118, 101, 112, 111, 108, 105, 32, 80, 49, 83, 0, 52, 55, 44, 84, 101, 109, 112, 105, 111, 32, 78, 101, 118, 101, 112, 111, 108, 105, 32, 80, 50, 83, 0, 52, 56, 44, 84, 101, 109, 112, 105, 111, 32, 78, 101, 118, 101, 112, 111, 108, 105, 32, 80, 51, 83, 0, 52, 57, 44, 84, 101, 109, 112, 105, 111, 32, 78, 101, 118, 101, 112, 111, 108, 105, 32, 80, 52, 83, 0, 53, 48, 44, 84, 101, 109, 112, 105, 111, 32, 78, 101, 118, 101, 112, 111, 108, 105, 32, 80, 53, 83, 0, 53, 49, 44, 71, 114, 111, 116, 116, 97, 32, 76, 97, 98, 105, 114, 105, 110, 116, 111, 0, 53, 50, 44, 71, 114, 111, 116, 116, 97, 32, 76, 97, 98, 105, 114, 105, 110, 116, 111, 32, 40, 83, 101, 103, 114, 101, 116, 111, 41, 0, 53, 51, 44, 71, 114, 111, 116, 116, 97, 32, 82, 111, 118, 105, 110, 101, 32, 40, 60, 32, 49, 48, 32, 85, 110, 111, 119, 110, 41, 0, 53, 52, 44, 71, 114, 111, 116, 116, 97, 32, 82, 111, 118, 105, 110, 101, 32, 40, 62, 32, 49, 48, 32, 85, 110, 111, 119, 110, 41, 0, 53, 53, 44, 84, 117, 110, 110, 101, 108, 32, 82, 111, 118, 105, 110, 101, 0, 53, 54, 44, 71, 105, 97, 114, 100, 105, 110, 111, 32, 84, 114, 111, 102, 101, 111, 0, 53, 55, 44, 73, 115, 111, 108, 97, 32, 70, 101, 114, 114, 111, 115, 97, 0, 53, 56, 44, 73, 115, 111, 108, 97, 32, 70, 101, 114, 114, 111, 115, 97, 32, 80, 49, 0, 53, 57, 44, 73, 115, 111, 108, 97, 32, 70, 101, 114, 114, 111, 115, 97, 32, 80, 49, 83, 0, 54, 48, 44, 73, 115, 111, 108, 97, 32, 70, 101, 114, 114, 111, 115, 97, 32, 80, 50, 83, 32, 40, 83, 105, 110, 105, 115, 116, 114, 97, 41, 0, 54, 49, 44, 73, 115, 111, 108, 97, 32, 70, 101, 114, 114, 111, 115, 97, 32, 80, 50, 83, 32, 40, 68, 101, 115, 116, 114, 97, 41, 0, 54, 50, 44, 73, 115, 111, 108, 97, 32, 70, 101, 114, 114, 111, 115, 97, 32, 80, 51, 83, 0, 54, 51, 44, 65, 110, 116, 105, 99, 111, 32, 67, 104, 97, 116, 101, 97, 117, 0, 54, 52, 44, 65, 110, 116, 105, 99, 111, 32, 67, 104, 97, 116, 101, 97, 117, 32, 45, 32, 83, 116, 97, 110, 122, 97, 32, 53, 0, 54, 53, 44, 76, 97, 103, 111, 32, 86, 101, 114, 105, 116, 195, 160, 0, 54, 54, 44, 76, 97, 103, 111, 32, 86, 97, 108, 111, 114, 101, 0, 54, 55, 44, 76, 97, 103, 111, 32, 65, 114, 103, 117, 122, 105, 97, 0, 54, 56, 44, 82, 105, 118, 97, 32, 86, 97, 108, 111, 114, 101, 0, 54, 57, 44, 82, 105, 118, 97, 32, 65, 114, 103, 117, 122, 105, 97, 0, 55, 48, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 48, 49, 0, 55, 49, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 48, 50, 0, 55, 50, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 48, 51, 0, 55, 51, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 48, 52, 32, 40, 83, 117, 100, 41, 0, 55, 52, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 48, 52, 32, 40, 78, 111, 114, 100, 41, 0, 55, 53, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 48, 53, 32, 40, 83, 117, 100, 41, 0, 55, 54, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 48, 53, 32, 40, 78, 111, 114, 100, 41, 0, 55, 55, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 48, 54, 0, 55, 56, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 48, 55, 0, 55, 57, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 48, 56, 0, 56, 48, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 48, 57, 0, 56, 49, 44, 84, 111, 114, 114, 101, 32, 77, 101, 109, 111, 114, 105, 97, 32, 80, 49, 0, 56, 50, 44, 84, 111, 114, 114, 101, 32, 77, 101, 109, 111, 114, 105, 97, 32, 80, 50, 0, 56, 51, 44, 84, 111, 114, 114, 101, 32, 77, 101, 109, 111, 114, 105, 97, 32, 80, 51, 0, 56, 52, 44, 84, 111, 114, 114, 101, 32, 77, 101, 109, 111, 114, 105, 97, 32, 80, 52, 0, 56, 53, 44, 84, 111, 114, 114, 101, 32, 77, 101, 109, 111, 114, 105, 97, 32, 80, 53, 0, 56, 54, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 49, 48, 32, 40, 83, 117, 100, 41, 0, 56, 55, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 49, 48, 32, 40, 78, 111, 114, 100, 41, 0, 56, 56, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 49, 49, 32, 40, 79, 118, 101, 115, 116, 41, 0, 56, 57, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 49, 49, 32, 40, 69, 115, 116, 41, 0, 57, 48, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 49, 50, 32, 40, 78, 111, 114, 100, 41, 0, 57, 49, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 49, 50, 32, 40, 83, 117, 100, 41, 0, 57, 50, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 49, 51, 0, 57, 51, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 49, 52, 0, 57, 52, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 49, 53, 0, 57, 53, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 49, 54, 0, 57, 54, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 49, 55, 0, 57, 55, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 49, 56, 0, 57, 56, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 49, 57, 0, 57, 57, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 50, 49, 0, 49, 48, 48, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 50, 50, 0, 49, 48, 49, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 50, 52, 0, 49, 48, 50, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 50, 53, 0, 49, 48, 51, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 50, 55, 0, 49, 48, 52, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 50, 56, 0, 49, 48, 53, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 50, 57, 0, 49, 48, 54, 44, 68, 117, 101, 102, 111, 103, 108, 105, 101, 0, 49, 48, 55, 44, 77, 101, 109, 111, 114, 105, 100, 101, 0, 49, 48, 56, 44, 65, 114, 101, 97, 32, 83, 118, 97, 103, 111, 0, 49, 48, 57, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 50, 48, 0, 49, 49, 48, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 50, 51, 0, 49, 49, 49, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 50, 54, 0, 49, 49, 50, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 51, 48, 0 };
-
-constexpr std::array<u8, 1936> frlg_it = { 48, 44, 66, 105, 97, 110, 99, 97, 118, 105, 108, 108, 97, 0, 49, 44, 83, 109, 101, 114, 97, 108, 100, 111, 112, 111, 108, 105, 0, 50, 44, 67, 101, 108, 101, 115, 116, 111, 112, 111, 108, 105, 0, 51, 44, 65, 114, 97, 110, 99, 105, 111, 112, 111, 108, 105, 0, 52, 44, 65, 122, 122, 117, 114, 114, 111, 112, 111, 108, 105, 0, 53, 44, 70, 117, 99, 115, 105, 97, 112, 111, 108, 105, 0, 54, 44, 73, 115, 111, 108, 97, 32, 67, 97, 110, 110, 101, 108, 108, 97, 0, 55, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 0, 56, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 0, 57, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 51, 0, 49, 48, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 52, 0, 49, 49, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 53, 0, 49, 50, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 54, 0, 49, 51, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 55, 0, 49, 52, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 56, 0, 49, 53, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 57, 0, 49, 54, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 48, 0, 49, 55, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 49, 0, 49, 56, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 50, 0, 49, 57, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 51, 0, 50, 48, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 52, 0, 50, 49, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 53, 0, 50, 50, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 54, 0, 50, 51, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 55, 0, 50, 52, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 56, 0, 50, 53, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 57, 0, 50, 54, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 48, 0, 50, 55, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 49, 0, 50, 56, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 50, 0, 50, 57, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 51, 0, 51, 48, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 52, 0, 51, 49, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 53, 0, 51, 50, 44, 66, 111, 115, 99, 111, 32, 83, 109, 101, 114, 97, 108, 100, 111, 0, 51, 51, 44, 77, 111, 110, 116, 101, 32, 76, 117, 110, 97, 32, 80, 49, 0, 51, 52, 44, 77, 111, 110, 116, 101, 32, 76, 117, 110, 97, 32, 80, 49, 83, 0, 51, 53, 44, 77, 111, 110, 116, 101, 32, 76, 117, 110, 97, 32, 80, 50, 83, 0, 51, 54, 44, 77, 47, 78, 32, 65, 110, 110, 97, 0, 51, 55, 44, 71, 114, 111, 116, 116, 97, 32, 68, 105, 103, 108, 101, 116, 116, 0, 51, 56, 44, 86, 105, 97, 32, 86, 105, 116, 116, 111, 114, 105, 97, 32, 80, 49, 0, 51, 57, 44, 86, 105, 97, 32, 86, 105, 116, 116, 111, 114, 105, 97, 32, 80, 50, 0, 52, 48, 44, 86, 105, 97, 32, 86, 105, 116, 116, 111, 114, 105, 97, 32, 80, 51, 0, 52, 49, 44, 86, 105, 108, 108, 97, 32, 80, 111, 107, 195, 169, 109, 111, 110, 32, 80, 49, 45, 80, 51, 0, 52, 50, 44, 86, 105, 108, 108, 97, 32, 80, 111, 107, 195, 169, 109, 111, 110, 32, 80, 49, 83, 0, 52, 51, 44, 90, 111, 110, 97, 32, 83, 97, 102, 97, 114, 105, 32, 45, 32, 67, 101, 110, 116, 114, 111, 0, 52, 52, 44, 90, 111, 110, 97, 32, 83, 97, 102, 97, 114, 105, 32, 45, 32, 65, 114, 101, 97, 32, 49, 0, 52, 53, 44, 90, 111, 110, 97, 32, 83, 97, 102, 97, 114, 105, 32, 45, 32, 65, 114, 101, 97, 32, 50, 0, 52, 54, 44, 90, 111, 110, 97, 32, 83, 97, 102, 97, 114, 105, 32, 45, 32, 65, 114, 101, 97, 32, 51, 0, 52, 55, 44, 84, 117, 110, 110, 101, 108, 32, 82, 111, 99, 99, 105, 111, 115, 111, 32, 80, 49, 0, 52, 56, 44, 84, 117, 110, 110, 101, 108, 32, 82, 111, 99, 99, 105, 111, 115, 111, 32, 80, 49, 83, 0, 52, 57, 44, 73, 115, 111, 108, 101, 32, 83, 112, 117, 109, 97, 114, 105, 110, 101, 32, 80, 49, 0, 53, 48, 44, 73, 115, 111, 108, 101, 32, 83, 112, 117, 109, 97, 114, 105, 110, 101, 32, 80, 49, 83, 0, 53, 49, 44, 73, 115, 111, 108, 101, 32, 83, 112, 117, 109, 97, 114, 105, 110, 101, 32, 80, 50, 83, 0, 53, 50, 44, 73, 115, 111, 108, 101, 32, 83, 112, 117, 109, 97, 114, 105, 110, 101, 32, 80, 51, 83, 0, 53, 51, 44, 73, 115, 111, 108, 101, 32, 83, 112, 117, 109, 97, 114, 105, 110, 101, 32, 80, 52, 83, 0, 53, 52, 44, 84, 111, 114, 114, 101, 32, 80, 111, 107, 195, 169, 109, 111, 110, 32, 80, 51, 0, 53, 53, 44, 84, 111, 114, 114, 101, 32, 80, 111, 107, 195, 169, 109, 111, 110, 32, 80, 52, 0, 53, 54, 44, 84, 111, 114, 114, 101, 32, 80, 111, 107, 195, 169, 109, 111, 110, 32, 80, 53, 0, 53, 55, 44, 84, 111, 114, 114, 101, 32, 80, 111, 107, 195, 169, 109, 111, 110, 32, 80, 54, 0, 53, 56, 44, 84, 111, 114, 114, 101, 32, 80, 111, 107, 195, 169, 109, 111, 110, 32, 80, 55, 0, 53, 57, 44, 71, 114, 111, 116, 116, 97, 32, 67, 101, 108, 101, 115, 116, 101, 32, 80, 49, 0, 54, 48, 44, 71, 114, 111, 116, 116, 97, 32, 67, 101, 108, 101, 115, 116, 101, 32, 80, 50, 0, 54, 49, 44, 71, 114, 111, 116, 116, 97, 32, 67, 101, 108, 101, 115, 116, 101, 32, 80, 49, 83, 0, 54, 50, 44, 67, 101, 110, 116, 114, 97, 108, 101, 32, 69, 108, 101, 116, 116, 114, 105, 99, 97, 0, 54, 51, 44, 80, 114, 105, 109, 105, 115, 111, 108, 97, 0, 54, 52, 44, 81, 117, 97, 114, 116, 105, 115, 111, 108, 97, 0, 54, 53, 44, 81, 117, 105, 110, 116, 105, 115, 111, 108, 97, 0, 54, 54, 44, 86, 105, 97, 32, 86, 117, 108, 99, 97, 110, 105, 99, 97, 0, 54, 55, 44, 82, 105, 118, 97, 32, 100, 101, 108, 32, 84, 101, 115, 111, 114, 111, 0, 54, 56, 44, 67, 97, 112, 111, 32, 69, 115, 116, 114, 101, 109, 111, 0, 54, 57, 44, 80, 111, 110, 116, 101, 32, 65, 98, 98, 114, 97, 99, 99, 105, 111, 0, 55, 48, 44, 80, 111, 114, 116, 111, 32, 84, 101, 114, 122, 105, 115, 111, 108, 97, 0, 55, 49, 44, 80, 101, 114, 108, 97, 32, 100, 101, 105, 32, 77, 97, 114, 105, 0, 55, 50, 44, 76, 97, 98, 105, 114, 105, 110, 116, 111, 32, 77, 97, 114, 105, 110, 111, 0, 55, 51, 44, 80, 114, 97, 116, 111, 32, 81, 117, 105, 110, 116, 105, 115, 111, 108, 97, 0, 55, 52, 44, 67, 111, 108, 111, 110, 110, 97, 32, 82, 111, 99, 99, 105, 111, 115, 97, 0, 55, 53, 44, 73, 115, 111, 108, 97, 32, 83, 111, 108, 105, 116, 97, 114, 105, 97, 0, 55, 54, 44, 86, 105, 97, 32, 86, 101, 114, 100, 101, 0, 55, 55, 44, 86, 105, 97, 32, 77, 97, 114, 105, 110, 97, 0, 55, 56, 44, 86, 97, 108, 108, 101, 32, 65, 110, 116, 105, 99, 97, 0, 55, 57, 44, 84, 111, 114, 114, 101, 32, 65, 108, 108, 101, 110, 97, 116, 111, 114, 105, 32, 40, 69, 115, 116, 101, 114, 110, 111, 41, 0, 56, 48, 44, 73, 110, 103, 114, 101, 115, 115, 111, 32, 67, 97, 110, 121, 111, 110, 0, 56, 49, 44, 67, 97, 110, 121, 111, 110, 32, 83, 101, 112, 116, 105, 111, 110, 0, 56, 50, 44, 82, 111, 118, 105, 110, 101, 32, 70, 108, 111, 114, 97, 98, 101, 116, 111, 0, 56, 51, 44, 77, 111, 110, 116, 101, 32, 66, 114, 97, 99, 101, 0, 56, 52, 44, 77, 111, 110, 116, 101, 32, 66, 114, 97, 99, 101, 32, 45, 32, 83, 116, 97, 110, 122, 97, 32, 49, 0, 56, 53, 44, 77, 111, 110, 116, 101, 32, 66, 114, 97, 99, 101, 32, 45, 32, 83, 116, 97, 110, 122, 97, 32, 50, 0, 56, 54, 44, 77, 111, 110, 116, 101, 32, 66, 114, 97, 99, 101, 32, 45, 32, 83, 116, 97, 110, 122, 97, 32, 51, 0, 56, 55, 44, 77, 111, 110, 116, 101, 32, 66, 114, 97, 99, 101, 32, 80, 49, 0, 56, 56, 44, 77, 111, 110, 116, 101, 32, 66, 114, 97, 99, 101, 32, 80, 49, 83, 0, 56, 57, 44, 77, 111, 110, 116, 101, 32, 66, 114, 97, 99, 101, 32, 80, 50, 83, 0, 57, 48, 44, 77, 111, 110, 116, 101, 32, 66, 114, 97, 99, 101, 32, 80, 51, 83, 0, 57, 49, 44, 77, 111, 110, 116, 101, 32, 66, 114, 97, 99, 101, 32, 80, 52, 83, 0, 57, 50, 44, 77, 111, 110, 116, 101, 32, 66, 114, 97, 99, 101, 32, 80, 53, 83, 0, 57, 51, 44, 66, 111, 115, 99, 111, 32, 66, 97, 99, 99, 111, 115, 111, 0, 57, 52, 44, 71, 114, 111, 116, 116, 97, 32, 71, 101, 108, 97, 116, 97, 0, 57, 53, 44, 71, 114, 111, 116, 116, 97, 32, 71, 101, 108, 97, 116, 97, 32, 80, 49, 0, 57, 54, 44, 71, 114, 111, 116, 116, 97, 32, 71, 101, 108, 97, 116, 97, 32, 80, 49, 83, 0, 57, 55, 44, 71, 114, 111, 116, 116, 97, 32, 71, 101, 108, 97, 116, 97, 32, 45, 32, 82, 101, 116, 114, 111, 0, 57, 56, 44, 66, 111, 115, 99, 111, 32, 68, 105, 115, 101, 103, 110, 97, 116, 111, 0, 57, 57, 44, 71, 114, 111, 116, 116, 97, 32, 77, 117, 116, 101, 118, 111, 108, 101, 0, 49, 48, 48, 44, 83, 97, 108, 97, 32, 65, 45, 108, 111, 101, 0, 49, 48, 49, 44, 83, 97, 108, 97, 32, 66, 45, 101, 116, 117, 108, 108, 97, 0, 49, 48, 50, 44, 83, 97, 108, 97, 32, 67, 45, 105, 99, 108, 97, 109, 105, 110, 111, 0, 49, 48, 51, 44, 83, 97, 108, 97, 32, 68, 45, 97, 102, 110, 101, 0, 49, 48, 52, 44, 83, 97, 108, 97, 32, 69, 45, 100, 101, 114, 97, 0, 49, 48, 53, 44, 83, 97, 108, 97, 32, 70, 45, 101, 108, 99, 101, 0, 49, 48, 54, 44, 83, 97, 108, 97, 32, 71, 45, 97, 114, 100, 101, 110, 105, 97, 0 };
-
-constexpr std::array<u8, 2220> hgss_it = { 48, 44, 66, 111, 114, 103, 111, 32, 70, 111, 103, 108, 105, 97, 110, 111, 118, 97, 0, 49, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 57, 0, 50, 44, 70, 105, 111, 114, 112, 101, 115, 99, 111, 112, 111, 108, 105, 0, 51, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 51, 48, 0, 52, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 51, 49, 0, 53, 44, 86, 105, 111, 108, 97, 112, 111, 108, 105, 0, 54, 44, 84, 111, 114, 114, 101, 32, 83, 112, 114, 111, 117, 116, 0, 55, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 51, 50, 0, 56, 44, 82, 111, 118, 105, 110, 101, 32, 100, 39, 65, 108, 102, 97, 32, 40, 69, 115, 116, 101, 114, 110, 111, 41, 0, 57, 44, 82, 111, 118, 105, 110, 101, 32, 100, 39, 65, 108, 102, 97, 32, 40, 73, 110, 115, 105, 100, 101, 41, 0, 49, 48, 44, 71, 114, 111, 116, 116, 97, 32, 100, 105, 32, 109, 101, 122, 122, 111, 32, 80, 49, 0, 49, 49, 44, 71, 114, 111, 116, 116, 97, 32, 100, 105, 32, 109, 101, 122, 122, 111, 32, 80, 49, 83, 0, 49, 50, 44, 71, 114, 111, 116, 116, 97, 32, 100, 105, 32, 109, 101, 122, 122, 111, 32, 80, 50, 83, 0, 49, 51, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 51, 51, 0, 49, 52, 44, 80, 111, 122, 122, 111, 32, 83, 76, 79, 87, 80, 79, 75, 69, 32, 80, 49, 0, 49, 53, 44, 80, 111, 122, 122, 111, 32, 83, 76, 79, 87, 80, 79, 75, 69, 32, 80, 49, 83, 0, 49, 54, 44, 66, 111, 115, 99, 111, 32, 100, 105, 32, 76, 101, 99, 99, 105, 0, 49, 55, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 51, 52, 0, 49, 56, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 51, 53, 0, 49, 57, 44, 80, 97, 114, 99, 111, 32, 78, 97, 122, 105, 111, 110, 97, 108, 101, 0, 50, 48, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 51, 54, 0, 50, 49, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 51, 55, 0, 50, 50, 44, 65, 109, 97, 114, 97, 110, 116, 111, 112, 111, 108, 105, 0, 50, 51, 44, 84, 111, 114, 114, 101, 32, 66, 114, 117, 99, 105, 97, 116, 97, 32, 80, 49, 0, 50, 52, 44, 84, 111, 114, 114, 101, 32, 66, 114, 117, 99, 105, 97, 116, 97, 32, 80, 49, 83, 0, 50, 53, 44, 84, 111, 114, 114, 101, 32, 67, 97, 109, 112, 97, 110, 97, 0, 50, 54, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 51, 56, 0, 50, 55, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 51, 57, 0, 50, 56, 44, 79, 108, 105, 118, 105, 110, 111, 112, 111, 108, 105, 0, 50, 57, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 52, 48, 0, 51, 48, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 52, 49, 0, 51, 49, 44, 73, 115, 111, 108, 101, 32, 86, 111, 114, 116, 105, 99, 111, 115, 101, 32, 80, 49, 0, 51, 50, 44, 73, 115, 111, 108, 101, 32, 86, 111, 114, 116, 105, 99, 111, 115, 101, 32, 80, 49, 83, 0, 51, 51, 44, 73, 115, 111, 108, 101, 32, 86, 111, 114, 116, 105, 99, 111, 115, 101, 32, 80, 50, 83, 0, 51, 52, 44, 73, 115, 111, 108, 101, 32, 86, 111, 114, 116, 105, 99, 111, 115, 101, 32, 80, 51, 83, 0, 51, 53, 44, 70, 105, 111, 114, 108, 105, 115, 111, 112, 111, 108, 105, 0, 51, 54, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 52, 50, 0, 51, 55, 44, 77, 111, 110, 116, 101, 32, 83, 99, 111, 100, 101, 108, 108, 97, 32, 80, 49, 0, 51, 56, 44, 77, 111, 110, 116, 101, 32, 83, 99, 111, 100, 101, 108, 108, 97, 32, 80, 49, 32, 40, 82, 101, 116, 114, 111, 41, 0, 51, 57, 44, 77, 111, 110, 116, 101, 32, 83, 99, 111, 100, 101, 108, 108, 97, 32, 80, 50, 0, 52, 48, 44, 77, 111, 110, 116, 101, 32, 83, 99, 111, 100, 101, 108, 108, 97, 32, 80, 49, 83, 0, 52, 49, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 52, 51, 0, 52, 50, 44, 76, 97, 103, 111, 32, 100, 39, 73, 114, 97, 0, 52, 51, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 52, 52, 0, 52, 52, 44, 86, 105, 97, 32, 71, 101, 108, 97, 116, 97, 32, 80, 49, 0, 52, 53, 44, 86, 105, 97, 32, 71, 101, 108, 97, 116, 97, 32, 80, 49, 83, 0, 52, 54, 44, 86, 105, 97, 32, 71, 101, 108, 97, 116, 97, 32, 80, 50, 83, 0, 52, 55, 44, 86, 105, 97, 32, 71, 101, 108, 97, 116, 97, 32, 80, 51, 83, 0, 52, 56, 44, 69, 98, 97, 110, 111, 112, 111, 108, 105, 0, 52, 57, 44, 84, 97, 110, 97, 32, 100, 101, 108, 32, 68, 114, 97, 103, 111, 0, 53, 48, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 52, 53, 0, 53, 49, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 52, 54, 0, 53, 50, 44, 71, 114, 111, 116, 116, 97, 32, 83, 99, 117, 114, 97, 32, 40, 80, 101, 114, 99, 111, 114, 115, 111, 32, 51, 49, 41, 0, 53, 51, 44, 71, 114, 111, 116, 116, 97, 32, 83, 99, 117, 114, 97, 32, 40, 80, 101, 114, 99, 111, 114, 115, 111, 32, 52, 53, 41, 0, 53, 52, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 52, 55, 0, 53, 53, 44, 77, 111, 110, 116, 101, 32, 76, 117, 110, 97, 0, 53, 54, 44, 77, 111, 110, 116, 101, 32, 76, 117, 110, 97, 32, 40, 67, 108, 101, 102, 97, 105, 114, 121, 41, 0, 53, 55, 44, 73, 115, 111, 108, 101, 32, 83, 112, 117, 109, 97, 114, 105, 110, 101, 32, 80, 49, 0, 53, 56, 44, 73, 115, 111, 108, 101, 32, 83, 112, 117, 109, 97, 114, 105, 110, 101, 32, 80, 49, 83, 0, 53, 57, 44, 73, 115, 111, 108, 101, 32, 83, 112, 117, 109, 97, 114, 105, 110, 101, 32, 80, 50, 83, 0, 54, 48, 44, 73, 115, 111, 108, 101, 32, 83, 112, 117, 109, 97, 114, 105, 110, 101, 32, 80, 51, 83, 0, 54, 49, 44, 73, 115, 111, 108, 101, 32, 83, 112, 117, 109, 97, 114, 105, 110, 101, 32, 80, 52, 83, 0, 54, 50, 44, 71, 114, 111, 116, 116, 97, 32, 65, 114, 103, 101, 110, 116, 111, 32, 80, 49, 0, 54, 51, 44, 71, 114, 111, 116, 116, 97, 32, 65, 114, 103, 101, 110, 116, 111, 32, 45, 32, 71, 114, 111, 116, 116, 97, 32, 105, 110, 32, 67, 105, 109, 97, 32, 80, 49, 0, 54, 52, 44, 71, 114, 111, 116, 116, 97, 32, 65, 114, 103, 101, 110, 116, 111, 32, 80, 52, 0, 54, 53, 44, 73, 110, 103, 114, 101, 115, 115, 111, 32, 70, 97, 108, 101, 115, 105, 97, 0, 54, 54, 44, 71, 114, 111, 116, 116, 97, 32, 70, 97, 108, 101, 115, 105, 97, 0, 54, 55, 44, 71, 114, 111, 116, 116, 97, 32, 65, 114, 103, 101, 110, 116, 111, 0, 54, 56, 44, 71, 114, 111, 116, 116, 97, 32, 65, 114, 103, 101, 110, 116, 111, 32, 80, 50, 0, 54, 57, 44, 71, 114, 111, 116, 116, 97, 32, 65, 114, 103, 101, 110, 116, 111, 32, 45, 32, 71, 114, 111, 116, 116, 97, 32, 110, 101, 108, 32, 80, 101, 110, 100, 105, 111, 32, 100, 101, 108, 32, 77, 111, 110, 116, 101, 0, 55, 48, 44, 71, 114, 111, 116, 116, 97, 32, 65, 114, 103, 101, 110, 116, 111, 32, 45, 32, 71, 114, 111, 116, 116, 97, 32, 80, 51, 0, 55, 49, 44, 71, 114, 111, 116, 116, 97, 32, 65, 114, 103, 101, 110, 116, 111, 32, 45, 32, 67, 105, 109, 97, 0, 55, 50, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 50, 0, 55, 51, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 57, 0, 55, 52, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 48, 0, 55, 53, 44, 66, 105, 97, 110, 99, 97, 118, 105, 108, 108, 97, 0, 55, 54, 44, 83, 109, 101, 114, 97, 108, 100, 111, 112, 111, 108, 105, 0, 55, 55, 44, 67, 101, 108, 101, 115, 116, 111, 112, 111, 108, 105, 0, 55, 56, 44, 65, 114, 97, 110, 99, 105, 111, 112, 111, 108, 105, 0, 55, 57, 44, 65, 122, 122, 117, 114, 114, 111, 112, 111, 108, 105, 0, 56, 48, 44, 70, 117, 99, 115, 105, 97, 112, 111, 108, 105, 0, 56, 49, 44, 73, 115, 111, 108, 97, 32, 67, 97, 110, 110, 101, 108, 108, 97, 0, 56, 50, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 52, 56, 0, 56, 51, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 54, 0, 56, 52, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 55, 0, 56, 53, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 56, 0, 56, 54, 44, 77, 111, 110, 116, 101, 32, 76, 117, 110, 97, 0, 56, 55, 44, 84, 117, 110, 110, 101, 108, 32, 82, 111, 99, 99, 105, 111, 115, 111, 32, 80, 49, 0, 56, 56, 44, 84, 117, 110, 110, 101, 108, 32, 82, 111, 99, 99, 105, 111, 115, 111, 32, 80, 50, 0, 56, 57, 44, 86, 105, 97, 32, 86, 105, 116, 116, 111, 114, 105, 97, 32, 80, 49, 0, 57, 48, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 0, 57, 49, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 32, 40, 83, 117, 100, 41, 0, 57, 50, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 51, 0, 57, 51, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 52, 0, 57, 52, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 53, 0, 57, 53, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 54, 0, 57, 54, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 55, 0, 57, 55, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 56, 0, 57, 56, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 57, 0, 57, 57, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 48, 0, 49, 48, 48, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 49, 0, 49, 48, 49, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 51, 0, 49, 48, 50, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 52, 0, 49, 48, 51, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 53, 0, 49, 48, 52, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 54, 0, 49, 48, 53, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 55, 0, 49, 48, 54, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 56, 0, 49, 48, 55, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 49, 0, 49, 48, 56, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 50, 0, 49, 48, 57, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 52, 0, 49, 49, 48, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 53, 0, 49, 49, 49, 44, 67, 97, 115, 99, 97, 116, 101, 32, 84, 111, 104, 106, 111, 0, 49, 49, 50, 44, 71, 114, 111, 116, 116, 97, 32, 68, 73, 71, 76, 69, 84, 84, 0, 49, 49, 51, 44, 86, 105, 97, 32, 86, 105, 116, 116, 111, 114, 105, 97, 32, 80, 50, 0, 49, 49, 52, 44, 86, 105, 97, 32, 86, 105, 116, 116, 111, 114, 105, 97, 32, 80, 51, 0, 49, 49, 53, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 50, 32, 40, 78, 111, 114, 100, 41, 0, 49, 49, 54, 44, 66, 111, 115, 99, 111, 32, 83, 109, 101, 114, 97, 108, 100, 111, 0, 49, 49, 55, 44, 71, 114, 111, 116, 116, 97, 32, 67, 101, 108, 101, 115, 116, 101, 32, 80, 49, 0, 49, 49, 56, 44, 71, 114, 111, 116, 116, 97, 32, 67, 101, 108, 101, 115, 116, 101, 32, 80, 50, 0, 49, 49, 57, 44, 71, 114, 111, 116, 116, 97, 32, 67, 101, 108, 101, 115, 116, 101, 32, 80, 49, 83, 0 };
-
-constexpr std::array<u8, 177> natures_it = { 65, 114, 100, 105, 116, 97, 0, 83, 99, 104, 105, 118, 97, 0, 65, 117, 100, 97, 99, 101, 0, 68, 101, 99, 105, 115, 97, 0, 66, 105, 114, 98, 111, 110, 97, 0, 83, 105, 99, 117, 114, 97, 0, 68, 111, 99, 105, 108, 101, 0, 80, 108, 97, 99, 105, 100, 97, 0, 83, 99, 97, 108, 116, 114, 97, 0, 70, 105, 97, 99, 99, 97, 0, 84, 105, 109, 105, 100, 97, 0, 76, 101, 115, 116, 97, 0, 83, 101, 114, 105, 97, 0, 65, 108, 108, 101, 103, 114, 97, 0, 73, 110, 103, 101, 110, 117, 97, 0, 77, 111, 100, 101, 115, 116, 97, 0, 77, 105, 116, 101, 0, 81, 117, 105, 101, 116, 97, 0, 82, 105, 116, 114, 111, 115, 97, 0, 65, 114, 100, 101, 110, 116, 101, 0, 67, 97, 108, 109, 97, 0, 71, 101, 110, 116, 105, 108, 101, 0, 86, 105, 118, 97, 99, 101, 0, 67, 97, 117, 116, 97, 0, 70, 117, 114, 98, 97, 0 };
-
-constexpr std::array<u8, 112> powers_it = { 76, 111, 116, 116, 97, 0, 86, 111, 108, 97, 110, 116, 101, 0, 86, 101, 108, 101, 110, 111, 0, 84, 101, 114, 114, 97, 0, 82, 111, 99, 99, 105, 97, 0, 67, 111, 108, 101, 111, 116, 116, 101, 114, 111, 0, 83, 112, 101, 116, 116, 114, 111, 0, 65, 99, 99, 105, 97, 105, 111, 0, 70, 117, 111, 99, 111, 0, 65, 99, 113, 117, 97, 0, 69, 114, 98, 97, 0, 69, 108, 101, 116, 116, 114, 111, 0, 80, 115, 105, 99, 111, 0, 71, 104, 105, 97, 99, 99, 105, 111, 0, 68, 114, 97, 103, 111, 0, 66, 117, 105, 111, 0 };
-
-constexpr std::array<u8, 1661> rse_it = { 48, 44, 66, 108, 117, 114, 117, 118, 105, 97, 0, 49, 44, 79, 114, 111, 99, 101, 97, 0, 50, 44, 80, 101, 116, 97, 108, 105, 112, 111, 108, 105, 0, 51, 44, 80, 111, 114, 116, 111, 32, 83, 101, 108, 99, 101, 112, 111, 108, 105, 0, 52, 44, 80, 111, 114, 116, 111, 32, 65, 108, 103, 104, 101, 112, 111, 108, 105, 0, 53, 44, 86, 101, 114, 100, 101, 97, 122, 122, 117, 112, 111, 108, 105, 0, 54, 44, 67, 101, 110, 101, 114, 105, 100, 101, 0, 55, 44, 73, 114, 105, 100, 111, 112, 111, 108, 105, 0, 56, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 48, 49, 0, 57, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 48, 50, 0, 49, 48, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 48, 51, 0, 49, 49, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 48, 52, 0, 49, 50, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 48, 53, 0, 49, 51, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 48, 54, 0, 49, 52, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 48, 55, 0, 49, 53, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 48, 56, 0, 49, 54, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 48, 57, 0, 49, 55, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 49, 48, 0, 49, 56, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 49, 49, 0, 49, 57, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 49, 50, 0, 50, 48, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 49, 51, 0, 50, 49, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 49, 52, 0, 50, 50, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 49, 53, 0, 50, 51, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 49, 54, 0, 50, 52, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 49, 55, 0, 50, 53, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 49, 56, 0, 50, 54, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 49, 57, 0, 50, 55, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 50, 48, 0, 50, 56, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 50, 49, 0, 50, 57, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 50, 50, 0, 51, 48, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 50, 51, 0, 51, 49, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 50, 52, 0, 51, 50, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 50, 53, 0, 51, 51, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 50, 54, 0, 51, 52, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 50, 55, 0, 51, 53, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 50, 56, 0, 51, 54, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 50, 57, 0, 51, 55, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 51, 48, 0, 51, 56, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 51, 49, 0, 51, 57, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 51, 50, 0, 52, 48, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 51, 51, 0, 52, 49, 44, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 51, 52, 0, 52, 50, 44, 83, 111, 116, 116, 39, 97, 99, 113, 117, 97, 32, 40, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 50, 52, 41, 0, 52, 51, 44, 83, 111, 116, 116, 39, 97, 99, 113, 117, 97, 32, 40, 80, 101, 114, 99, 111, 114, 115, 111, 32, 49, 50, 54, 41, 0, 52, 52, 44, 71, 114, 111, 116, 116, 97, 32, 80, 105, 101, 116, 114, 111, 115, 97, 32, 80, 49, 0, 52, 53, 44, 71, 114, 111, 116, 116, 97, 32, 80, 105, 101, 116, 114, 111, 115, 97, 32, 45, 32, 83, 116, 97, 110, 122, 97, 32, 100, 105, 32, 82, 111, 99, 99, 111, 0, 52, 54, 44, 71, 114, 111, 116, 116, 97, 32, 80, 105, 101, 116, 114, 111, 115, 97, 32, 80, 49, 83, 0, 52, 55, 44, 71, 114, 111, 116, 116, 97, 32, 80, 105, 101, 116, 114, 111, 115, 97, 32, 80, 50, 83, 0, 52, 56, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 45, 32, 65, 114, 101, 97, 32, 49, 0, 52, 57, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 45, 32, 65, 114, 101, 97, 32, 50, 0, 53, 48, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 45, 32, 65, 114, 101, 97, 32, 51, 0, 53, 49, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 45, 32, 65, 114, 101, 97, 32, 52, 0, 53, 50, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 45, 32, 65, 114, 101, 97, 32, 53, 0, 53, 51, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 45, 32, 65, 114, 101, 97, 32, 54, 0, 53, 52, 44, 66, 111, 115, 99, 111, 32, 80, 101, 116, 97, 108, 111, 0, 53, 53, 44, 84, 117, 110, 110, 101, 108, 32, 77, 101, 110, 102, 101, 114, 114, 111, 0, 53, 54, 44, 86, 101, 99, 99, 104, 105, 97, 32, 78, 97, 118, 101, 0, 53, 55, 44, 67, 105, 99, 108, 97, 110, 111, 118, 97, 32, 40, 69, 110, 116, 114, 97, 116, 97, 41, 0, 53, 56, 44, 67, 105, 99, 108, 97, 110, 111, 118, 97, 32, 40, 83, 111, 116, 116, 101, 114, 114, 97, 110, 101, 105, 41, 0, 53, 57, 44, 67, 97, 115, 99, 97, 116, 101, 32, 77, 101, 116, 101, 111, 114, 97, 32, 80, 49, 32, 49, 83, 0, 54, 48, 44, 67, 97, 115, 99, 97, 116, 101, 32, 77, 101, 116, 101, 111, 114, 97, 32, 80, 49, 32, 50, 83, 0, 54, 49, 44, 67, 97, 115, 99, 97, 116, 101, 32, 77, 101, 116, 101, 111, 114, 97, 32, 80, 49, 83, 32, 49, 83, 0, 54, 50, 44, 67, 97, 115, 99, 97, 116, 101, 32, 77, 101, 116, 101, 111, 114, 97, 32, 80, 49, 83, 32, 50, 83, 0, 54, 51, 44, 67, 97, 115, 99, 97, 116, 101, 32, 77, 101, 116, 101, 111, 114, 97, 32, 45, 32, 83, 116, 97, 110, 122, 97, 32, 100, 105, 32, 82, 111, 99, 99, 111, 0, 54, 52, 44, 77, 111, 110, 116, 101, 32, 80, 105, 114, 97, 32, 80, 49, 45, 80, 51, 0, 54, 53, 44, 77, 111, 110, 116, 101, 32, 80, 105, 114, 97, 32, 80, 52, 45, 80, 54, 0, 54, 54, 44, 77, 111, 110, 116, 101, 32, 80, 105, 114, 97, 32, 45, 32, 69, 115, 116, 101, 114, 110, 111, 0, 54, 55, 44, 77, 111, 110, 116, 101, 32, 80, 105, 114, 97, 32, 45, 32, 67, 105, 109, 97, 0, 54, 56, 44, 71, 114, 111, 116, 116, 97, 32, 79, 110, 100, 111, 115, 97, 0, 54, 57, 44, 71, 114, 111, 116, 116, 97, 32, 79, 110, 100, 111, 115, 97, 32, 45, 32, 83, 116, 97, 110, 122, 97, 32, 71, 104, 105, 97, 99, 99, 105, 97, 116, 97, 0, 55, 48, 44, 65, 110, 116, 114, 111, 32, 65, 98, 105, 115, 115, 97, 108, 101, 0, 55, 49, 44, 86, 105, 97, 32, 86, 105, 116, 116, 111, 114, 105, 97, 32, 80, 49, 0, 55, 50, 44, 86, 105, 97, 32, 86, 105, 116, 116, 111, 114, 105, 97, 32, 80, 49, 83, 0, 55, 51, 44, 86, 105, 97, 32, 86, 105, 116, 116, 111, 114, 105, 97, 32, 80, 50, 83, 0, 55, 52, 44, 71, 114, 111, 116, 116, 97, 32, 100, 101, 105, 32, 84, 101, 109, 112, 105, 32, 45, 32, 69, 110, 116, 114, 97, 116, 97, 0, 55, 53, 44, 71, 114, 111, 116, 116, 97, 32, 100, 101, 105, 32, 84, 101, 109, 112, 105, 0, 55, 54, 44, 67, 97, 109, 109, 105, 110, 111, 32, 65, 114, 100, 101, 110, 116, 101, 0, 55, 55, 44, 80, 97, 115, 115, 111, 32, 83, 101, 108, 118, 97, 103, 103, 105, 111, 0, 55, 56, 44, 84, 111, 114, 114, 101, 32, 100, 101, 105, 32, 67, 105, 101, 108, 105, 32, 80, 49, 0, 55, 57, 44, 84, 111, 114, 114, 101, 32, 100, 101, 105, 32, 67, 105, 101, 108, 105, 32, 80, 51, 0, 56, 48, 44, 84, 111, 114, 114, 101, 32, 100, 101, 105, 32, 67, 105, 101, 108, 105, 32, 80, 53, 0, 56, 49, 44, 82, 105, 102, 117, 103, 105, 111, 32, 77, 97, 103, 109, 97, 0, 56, 50, 44, 84, 111, 114, 114, 101, 32, 77, 105, 114, 97, 103, 103, 105, 111, 0, 56, 51, 44, 71, 114, 111, 116, 116, 97, 32, 65, 114, 116, 105, 115, 116, 105, 99, 97, 0, 56, 52, 44, 71, 97, 108, 108, 101, 114, 105, 97, 32, 68, 101, 115, 101, 114, 116, 111, 0, 56, 53, 44, 71, 114, 111, 116, 116, 97, 32, 77, 117, 116, 101, 118, 111, 108, 101, 0 };
-
-constexpr std::array<u8, 6849> species_it = { 239, 187, 191, 66, 117, 108, 98, 97, 115, 97, 117, 114, 0, 73, 118, 121, 115, 97, 117, 114, 0, 86, 101, 110, 117, 115, 97, 117, 114, 0, 67, 104, 97, 114, 109, 97, 110, 100, 101, 114, 0, 67, 104, 97, 114, 109, 101, 108, 101, 111, 110, 0, 67, 104, 97, 114, 105, 122, 97, 114, 100, 0, 83, 113, 117, 105, 114, 116, 108, 101, 0, 87, 97, 114, 116, 111, 114, 116, 108, 101, 0, 66, 108, 97, 115, 116, 111, 105, 115, 101, 0, 67, 97, 116, 101, 114, 112, 105, 101, 0, 77, 101, 116, 97, 112, 111, 100, 0, 66, 117, 116, 116, 101, 114, 102, 114, 101, 101, 0, 87, 101, 101, 100, 108, 101, 0, 75, 97, 107, 117, 110, 97, 0, 66, 101, 101, 100, 114, 105, 108, 108, 0, 80, 105, 100, 103, 101, 121, 0, 80, 105, 100, 103, 101, 111, 116, 116, 111, 0, 80, 105, 100, 103, 101, 111, 116, 0, 82, 97, 116, 116, 97, 116, 97, 0, 82, 97, 116, 105, 99, 97, 116, 101, 0, 83, 112, 101, 97, 114, 111, 119, 0, 70, 101, 97, 114, 111, 119, 0, 69, 107, 97, 110, 115, 0, 65, 114, 98, 111, 107, 0, 80, 105, 107, 97, 99, 104, 117, 0, 82, 97, 105, 99, 104, 117, 0, 83, 97, 110, 100, 115, 104, 114, 101, 119, 0, 83, 97, 110, 100, 115, 108, 97, 115, 104, 0, 78, 105, 100, 111, 114, 97, 110, 226, 153, 128, 0, 78, 105, 100, 111, 114, 105, 110, 97, 0, 78, 105, 100, 111, 113, 117, 101, 101, 110, 0, 78, 105, 100, 111, 114, 97, 110, 226, 153, 130, 0, 78, 105, 100, 111, 114, 105, 110, 111, 0, 78, 105, 100, 111, 107, 105, 110, 103, 0, 67, 108, 101, 102, 97, 105, 114, 121, 0, 67, 108, 101, 102, 97, 98, 108, 101, 0, 86, 117, 108, 112, 105, 120, 0, 78, 105, 110, 101, 116, 97, 108, 101, 115, 0, 74, 105, 103, 103, 108, 121, 112, 117, 102, 102, 0, 87, 105, 103, 103, 108, 121, 116, 117, 102, 102, 0, 90, 117, 98, 97, 116, 0, 71, 111, 108, 98, 97, 116, 0, 79, 100, 100, 105, 115, 104, 0, 71, 108, 111, 111, 109, 0, 86, 105, 108, 101, 112, 108, 117, 109, 101, 0, 80, 97, 114, 97, 115, 0, 80, 97, 114, 97, 115, 101, 99, 116, 0, 86, 101, 110, 111, 110, 97, 116, 0, 86, 101, 110, 111, 109, 111, 116, 104, 0, 68, 105, 103, 108, 101, 116, 116, 0, 68, 117, 103, 116, 114, 105, 111, 0, 77, 101, 111, 119, 116, 104, 0, 80, 101, 114, 115, 105, 97, 110, 0, 80, 115, 121, 100, 117, 99, 107, 0, 71, 111, 108, 100, 117, 99, 107, 0, 77, 97, 110, 107, 101, 121, 0, 80, 114, 105, 109, 101, 97, 112, 101, 0, 71, 114, 111, 119, 108, 105, 116, 104, 101, 0, 65, 114, 99, 97, 110, 105, 110, 101, 0, 80, 111, 108, 105, 119, 97, 103, 0, 80, 111, 108, 105, 119, 104, 105, 114, 108, 0, 80, 111, 108, 105, 119, 114, 97, 116, 104, 0, 65, 98, 114, 97, 0, 75, 97, 100, 97, 98, 114, 97, 0, 65, 108, 97, 107, 97, 122, 97, 109, 0, 77, 97, 99, 104, 111, 112, 0, 77, 97, 99, 104, 111, 107, 101, 0, 77, 97, 99, 104, 97, 109, 112, 0, 66, 101, 108, 108, 115, 112, 114, 111, 117, 116, 0, 87, 101, 101, 112, 105, 110, 98, 101, 108, 108, 0, 86, 105, 99, 116, 114, 101, 101, 98, 101, 108, 0, 84, 101, 110, 116, 97, 99, 111, 111, 108, 0, 84, 101, 110, 116, 97, 99, 114, 117, 101, 108, 0, 71, 101, 111, 100, 117, 100, 101, 0, 71, 114, 97, 118, 101, 108, 101, 114, 0, 71, 111, 108, 101, 109, 0, 80, 111, 110, 121, 116, 97, 0, 82, 97, 112, 105, 100, 97, 115, 104, 0, 83, 108, 111, 119, 112, 111, 107, 101, 0, 83, 108, 111, 119, 98, 114, 111, 0, 77, 97, 103, 110, 101, 109, 105, 116, 101, 0, 77, 97, 103, 110, 101, 116, 111, 110, 0, 70, 97, 114, 102, 101, 116, 99, 104, 226, 128, 153, 100, 0, 68, 111, 100, 117, 111, 0, 68, 111, 100, 114, 105, 111, 0, 83, 101, 101, 108, 0, 68, 101, 119, 103, 111, 110, 103, 0, 71, 114, 105, 109, 101, 114, 0, 77, 117, 107, 0, 83, 104, 101, 108, 108, 100, 101, 114, 0, 67, 108, 111, 121, 115, 116, 101, 114, 0, 71, 97, 115, 116, 108, 121, 0, 72, 97, 117, 110, 116, 101, 114, 0, 71, 101, 110, 103, 97, 114, 0, 79, 110, 105, 120, 0, 68, 114, 111, 119, 122, 101, 101, 0, 72, 121, 112, 110, 111, 0, 75, 114, 97, 98, 98, 121, 0, 75, 105, 110, 103, 108, 101, 114, 0, 86, 111, 108, 116, 111, 114, 98, 0, 69, 108, 101, 99, 116, 114, 111, 100, 101, 0, 69, 120, 101, 103, 103, 99, 117, 116, 101, 0, 69, 120, 101, 103, 103, 117, 116, 111, 114, 0, 67, 117, 98, 111, 110, 101, 0, 77, 97, 114, 111, 119, 97, 107, 0, 72, 105, 116, 109, 111, 110, 108, 101, 101, 0, 72, 105, 116, 109, 111, 110, 99, 104, 97, 110, 0, 76, 105, 99, 107, 105, 116, 117, 110, 103, 0, 75, 111, 102, 102, 105, 110, 103, 0, 87, 101, 101, 122, 105, 110, 103, 0, 82, 104, 121, 104, 111, 114, 110, 0, 82, 104, 121, 100, 111, 110, 0, 67, 104, 97, 110, 115, 101, 121, 0, 84, 97, 110, 103, 101, 108, 97, 0, 75, 97, 110, 103, 97, 115, 107, 104, 97, 110, 0, 72, 111, 114, 115, 101, 97, 0, 83, 101, 97, 100, 114, 97, 0, 71, 111, 108, 100, 101, 101, 110, 0, 83, 101, 97, 107, 105, 110, 103, 0, 83, 116, 97, 114, 121, 117, 0, 83, 116, 97, 114, 109, 105, 101, 0, 77, 114, 46, 32, 77, 105, 109, 101, 0, 83, 99, 121, 116, 104, 101, 114, 0, 74, 121, 110, 120, 0, 69, 108, 101, 99, 116, 97, 98, 117, 122, 122, 0, 77, 97, 103, 109, 97, 114, 0, 80, 105, 110, 115, 105, 114, 0, 84, 97, 117, 114, 111, 115, 0, 77, 97, 103, 105, 107, 97, 114, 112, 0, 71, 121, 97, 114, 97, 100, 111, 115, 0, 76, 97, 112, 114, 97, 115, 0, 68, 105, 116, 116, 111, 0, 69, 101, 118, 101, 101, 0, 86, 97, 112, 111, 114, 101, 111, 110, 0, 74, 111, 108, 116, 101, 111, 110, 0, 70, 108, 97, 114, 101, 111, 110, 0, 80, 111, 114, 121, 103, 111, 110, 0, 79, 109, 97, 110, 121, 116, 101, 0, 79, 109, 97, 115, 116, 97, 114, 0, 75, 97, 98, 117, 116, 111, 0, 75, 97, 98, 117, 116, 111, 112, 115, 0, 65, 101, 114, 111, 100, 97, 99, 116, 121, 108, 0, 83, 110, 111, 114, 108, 97, 120, 0, 65, 114, 116, 105, 99, 117, 110, 111, 0, 90, 97, 112, 100, 111, 115, 0, 77, 111, 108, 116, 114, 101, 115, 0, 68, 114, 97, 116, 105, 110, 105, 0, 68, 114, 97, 103, 111, 110, 97, 105, 114, 0, 68, 114, 97, 103, 111, 110, 105, 116, 101, 0, 77, 101, 119, 116, 119, 111, 0, 77, 101, 119, 0, 67, 104, 105, 107, 111, 114, 105, 116, 97, 0, 66, 97, 121, 108, 101, 101, 102, 0, 77, 101, 103, 97, 110, 105, 117, 109, 0, 67, 121, 110, 100, 97, 113, 117, 105, 108, 0, 81, 117, 105, 108, 97, 118, 97, 0, 84, 121, 112, 104, 108, 111, 115, 105, 111, 110, 0, 84, 111, 116, 111, 100, 105, 108, 101, 0, 67, 114, 111, 99, 111, 110, 97, 119, 0, 70, 101, 114, 97, 108, 105, 103, 97, 116, 114, 0, 83, 101, 110, 116, 114, 101, 116, 0, 70, 117, 114, 114, 101, 116, 0, 72, 111, 111, 116, 104, 111, 111, 116, 0, 78, 111, 99, 116, 111, 119, 108, 0, 76, 101, 100, 121, 98, 97, 0, 76, 101, 100, 105, 97, 110, 0, 83, 112, 105, 110, 97, 114, 97, 107, 0, 65, 114, 105, 97, 100, 111, 115, 0, 67, 114, 111, 98, 97, 116, 0, 67, 104, 105, 110, 99, 104, 111, 117, 0, 76, 97, 110, 116, 117, 114, 110, 0, 80, 105, 99, 104, 117, 0, 67, 108, 101, 102, 102, 97, 0, 73, 103, 103, 108, 121, 98, 117, 102, 102, 0, 84, 111, 103, 101, 112, 105, 0, 84, 111, 103, 101, 116, 105, 99, 0, 78, 97, 116, 117, 0, 88, 97, 116, 117, 0, 77, 97, 114, 101, 101, 112, 0, 70, 108, 97, 97, 102, 102, 121, 0, 65, 109, 112, 104, 97, 114, 111, 115, 0, 66, 101, 108, 108, 111, 115, 115, 111, 109, 0, 77, 97, 114, 105, 108, 108, 0, 65, 122, 117, 109, 97, 114, 105, 108, 108, 0, 83, 117, 100, 111, 119, 111, 111, 100, 111, 0, 80, 111, 108, 105, 116, 111, 101, 100, 0, 72, 111, 112, 112, 105, 112, 0, 83, 107, 105, 112, 108, 111, 111, 109, 0, 74, 117, 109, 112, 108, 117, 102, 102, 0, 65, 105, 112, 111, 109, 0, 83, 117, 110, 107, 101, 114, 110, 0, 83, 117, 110, 102, 108, 111, 114, 97, 0, 89, 97, 110, 109, 97, 0, 87, 111, 111, 112, 101, 114, 0, 81, 117, 97, 103, 115, 105, 114, 101, 0, 69, 115, 112, 101, 111, 110, 0, 85, 109, 98, 114, 101, 111, 110, 0, 77, 117, 114, 107, 114, 111, 119, 0, 83, 108, 111, 119, 107, 105, 110, 103, 0, 77, 105, 115, 100, 114, 101, 97, 118, 117, 115, 0, 85, 110, 111, 119, 110, 0, 87, 111, 98, 98, 117, 102, 102, 101, 116, 0, 71, 105, 114, 97, 102, 97, 114, 105, 103, 0, 80, 105, 110, 101, 99, 111, 0, 70, 111, 114, 114, 101, 116, 114, 101, 115, 115, 0, 68, 117, 110, 115, 112, 97, 114, 99, 101, 0, 71, 108, 105, 103, 97, 114, 0, 83, 116, 101, 101, 108, 105, 120, 0, 83, 110, 117, 98, 98, 117, 108, 108, 0, 71, 114, 97, 110, 98, 117, 108, 108, 0, 81, 119, 105, 108, 102, 105, 115, 104, 0, 83, 99, 105, 122, 111, 114, 0, 83, 104, 117, 99, 107, 108, 101, 0, 72, 101, 114, 97, 99, 114, 111, 115, 115, 0, 83, 110, 101, 97, 115, 101, 108, 0, 84, 101, 100, 100, 105, 117, 114, 115, 97, 0, 85, 114, 115, 97, 114, 105, 110, 103, 0, 83, 108, 117, 103, 109, 97, 0, 77, 97, 103, 99, 97, 114, 103, 111, 0, 83, 119, 105, 110, 117, 98, 0, 80, 105, 108, 111, 115, 119, 105, 110, 101, 0, 67, 111, 114, 115, 111, 108, 97, 0, 82, 101, 109, 111, 114, 97, 105, 100, 0, 79, 99, 116, 105, 108, 108, 101, 114, 121, 0, 68, 101, 108, 105, 98, 105, 114, 100, 0, 77, 97, 110, 116, 105, 110, 101, 0, 83, 107, 97, 114, 109, 111, 114, 121, 0, 72, 111, 117, 110, 100, 111, 117, 114, 0, 72, 111, 117, 110, 100, 111, 111, 109, 0, 75, 105, 110, 103, 100, 114, 97, 0, 80, 104, 97, 110, 112, 121, 0, 68, 111, 110, 112, 104, 97, 110, 0, 80, 111, 114, 121, 103, 111, 110, 50, 0, 83, 116, 97, 110, 116, 108, 101, 114, 0, 83, 109, 101, 97, 114, 103, 108, 101, 0, 84, 121, 114, 111, 103, 117, 101, 0, 72, 105, 116, 109, 111, 110, 116, 111, 112, 0, 83, 109, 111, 111, 99, 104, 117, 109, 0, 69, 108, 101, 107, 105, 100, 0, 77, 97, 103, 98, 121, 0, 77, 105, 108, 116, 97, 110, 107, 0, 66, 108, 105, 115, 115, 101, 121, 0, 82, 97, 105, 107, 111, 117, 0, 69, 110, 116, 101, 105, 0, 83, 117, 105, 99, 117, 110, 101, 0, 76, 97, 114, 118, 105, 116, 97, 114, 0, 80, 117, 112, 105, 116, 97, 114, 0, 84, 121, 114, 97, 110, 105, 116, 97, 114, 0, 76, 117, 103, 105, 97, 0, 72, 111, 45, 79, 104, 0, 67, 101, 108, 101, 98, 105, 0, 84, 114, 101, 101, 99, 107, 111, 0, 71, 114, 111, 118, 121, 108, 101, 0, 83, 99, 101, 112, 116, 105, 108, 101, 0, 84, 111, 114, 99, 104, 105, 99, 0, 67, 111, 109, 98, 117, 115, 107, 101, 110, 0, 66, 108, 97, 122, 105, 107, 101, 110, 0, 77, 117, 100, 107, 105, 112, 0, 77, 97, 114, 115, 104, 116, 111, 109, 112, 0, 83, 119, 97, 109, 112, 101, 114, 116, 0, 80, 111, 111, 99, 104, 121, 101, 110, 97, 0, 77, 105, 103, 104, 116, 121, 101, 110, 97, 0, 90, 105, 103, 122, 97, 103, 111, 111, 110, 0, 76, 105, 110, 111, 111, 110, 101, 0, 87, 117, 114, 109, 112, 108, 101, 0, 83, 105, 108, 99, 111, 111, 110, 0, 66, 101, 97, 117, 116, 105, 102, 108, 121, 0, 67, 97, 115, 99, 111, 111, 110, 0, 68, 117, 115, 116, 111, 120, 0, 76, 111, 116, 97, 100, 0, 76, 111, 109, 98, 114, 101, 0, 76, 117, 100, 105, 99, 111, 108, 111, 0, 83, 101, 101, 100, 111, 116, 0, 78, 117, 122, 108, 101, 97, 102, 0, 83, 104, 105, 102, 116, 114, 121, 0, 84, 97, 105, 108, 108, 111, 119, 0, 83, 119, 101, 108, 108, 111, 119, 0, 87, 105, 110, 103, 117, 108, 108, 0, 80, 101, 108, 105, 112, 112, 101, 114, 0, 82, 97, 108, 116, 115, 0, 75, 105, 114, 108, 105, 97, 0, 71, 97, 114, 100, 101, 118, 111, 105, 114, 0, 83, 117, 114, 115, 107, 105, 116, 0, 77, 97, 115, 113, 117, 101, 114, 97, 105, 110, 0, 83, 104, 114, 111, 111, 109, 105, 115, 104, 0, 66, 114, 101, 108, 111, 111, 109, 0, 83, 108, 97, 107, 111, 116, 104, 0, 86, 105, 103, 111, 114, 111, 116, 104, 0, 83, 108, 97, 107, 105, 110, 103, 0, 78, 105, 110, 99, 97, 100, 97, 0, 78, 105, 110, 106, 97, 115, 107, 0, 83, 104, 101, 100, 105, 110, 106, 97, 0, 87, 104, 105, 115, 109, 117, 114, 0, 76, 111, 117, 100, 114, 101, 100, 0, 69, 120, 112, 108, 111, 117, 100, 0, 77, 97, 107, 117, 104, 105, 116, 97, 0, 72, 97, 114, 105, 121, 97, 109, 97, 0, 65, 122, 117, 114, 105, 108, 108, 0, 78, 111, 115, 101, 112, 97, 115, 115, 0, 83, 107, 105, 116, 116, 121, 0, 68, 101, 108, 99, 97, 116, 116, 121, 0, 83, 97, 98, 108, 101, 121, 101, 0, 77, 97, 119, 105, 108, 101, 0, 65, 114, 111, 110, 0, 76, 97, 105, 114, 111, 110, 0, 65, 103, 103, 114, 111, 110, 0, 77, 101, 100, 105, 116, 105, 116, 101, 0, 77, 101, 100, 105, 99, 104, 97, 109, 0, 69, 108, 101, 99, 116, 114, 105, 107, 101, 0, 77, 97, 110, 101, 99, 116, 114, 105, 99, 0, 80, 108, 117, 115, 108, 101, 0, 77, 105, 110, 117, 110, 0, 86, 111, 108, 98, 101, 97, 116, 0, 73, 108, 108, 117, 109, 105, 115, 101, 0, 82, 111, 115, 101, 108, 105, 97, 0, 71, 117, 108, 112, 105, 110, 0, 83, 119, 97, 108, 111, 116, 0, 67, 97, 114, 118, 97, 110, 104, 97, 0, 83, 104, 97, 114, 112, 101, 100, 111, 0, 87, 97, 105, 108, 109, 101, 114, 0, 87, 97, 105, 108, 111, 114, 100, 0, 78, 117, 109, 101, 108, 0, 67, 97, 109, 101, 114, 117, 112, 116, 0, 84, 111, 114, 107, 111, 97, 108, 0, 83, 112, 111, 105, 110, 107, 0, 71, 114, 117, 109, 112, 105, 103, 0, 83, 112, 105, 110, 100, 97, 0, 84, 114, 97, 112, 105, 110, 99, 104, 0, 86, 105, 98, 114, 97, 118, 97, 0, 70, 108, 121, 103, 111, 110, 0, 67, 97, 99, 110, 101, 97, 0, 67, 97, 99, 116, 117, 114, 110, 101, 0, 83, 119, 97, 98, 108, 117, 0, 65, 108, 116, 97, 114, 105, 97, 0, 90, 97, 110, 103, 111, 111, 115, 101, 0, 83, 101, 118, 105, 112, 101, 114, 0, 76, 117, 110, 97, 116, 111, 110, 101, 0, 83, 111, 108, 114, 111, 99, 107, 0, 66, 97, 114, 98, 111, 97, 99, 104, 0, 87, 104, 105, 115, 99, 97, 115, 104, 0, 67, 111, 114, 112, 104, 105, 115, 104, 0, 67, 114, 97, 119, 100, 97, 117, 110, 116, 0, 66, 97, 108, 116, 111, 121, 0, 67, 108, 97, 121, 100, 111, 108, 0, 76, 105, 108, 101, 101, 112, 0, 67, 114, 97, 100, 105, 108, 121, 0, 65, 110, 111, 114, 105, 116, 104, 0, 65, 114, 109, 97, 108, 100, 111, 0, 70, 101, 101, 98, 97, 115, 0, 77, 105, 108, 111, 116, 105, 99, 0, 67, 97, 115, 116, 102, 111, 114, 109, 0, 75, 101, 99, 108, 101, 111, 110, 0, 83, 104, 117, 112, 112, 101, 116, 0, 66, 97, 110, 101, 116, 116, 101, 0, 68, 117, 115, 107, 117, 108, 108, 0, 68, 117, 115, 99, 108, 111, 112, 115, 0, 84, 114, 111, 112, 105, 117, 115, 0, 67, 104, 105, 109, 101, 99, 104, 111, 0, 65, 98, 115, 111, 108, 0, 87, 121, 110, 97, 117, 116, 0, 83, 110, 111, 114, 117, 110, 116, 0, 71, 108, 97, 108, 105, 101, 0, 83, 112, 104, 101, 97, 108, 0, 83, 101, 97, 108, 101, 111, 0, 87, 97, 108, 114, 101, 105, 110, 0, 67, 108, 97, 109, 112, 101, 114, 108, 0, 72, 117, 110, 116, 97, 105, 108, 0, 71, 111, 114, 101, 98, 121, 115, 115, 0, 82, 101, 108, 105, 99, 97, 110, 116, 104, 0, 76, 117, 118, 100, 105, 115, 99, 0, 66, 97, 103, 111, 110, 0, 83, 104, 101, 108, 103, 111, 110, 0, 83, 97, 108, 97, 109, 101, 110, 99, 101, 0, 66, 101, 108, 100, 117, 109, 0, 77, 101, 116, 97, 110, 103, 0, 77, 101, 116, 97, 103, 114, 111, 115, 115, 0, 82, 101, 103, 105, 114, 111, 99, 107, 0, 82, 101, 103, 105, 99, 101, 0, 82, 101, 103, 105, 115, 116, 101, 101, 108, 0, 76, 97, 116, 105, 97, 115, 0, 76, 97, 116, 105, 111, 115, 0, 75, 121, 111, 103, 114, 101, 0, 71, 114, 111, 117, 100, 111, 110, 0, 82, 97, 121, 113, 117, 97, 122, 97, 0, 74, 105, 114, 97, 99, 104, 105, 0, 68, 101, 111, 120, 121, 115, 0, 84, 117, 114, 116, 119, 105, 103, 0, 71, 114, 111, 116, 108, 101, 0, 84, 111, 114, 116, 101, 114, 114, 97, 0, 67, 104, 105, 109, 99, 104, 97, 114, 0, 77, 111, 110, 102, 101, 114, 110, 111, 0, 73, 110, 102, 101, 114, 110, 97, 112, 101, 0, 80, 105, 112, 108, 117, 112, 0, 80, 114, 105, 110, 112, 108, 117, 112, 0, 69, 109, 112, 111, 108, 101, 111, 110, 0, 83, 116, 97, 114, 108, 121, 0, 83, 116, 97, 114, 97, 118, 105, 97, 0, 83, 116, 97, 114, 97, 112, 116, 111, 114, 0, 66, 105, 100, 111, 111, 102, 0, 66, 105, 98, 97, 114, 101, 108, 0, 75, 114, 105, 99, 107, 101, 116, 111, 116, 0, 75, 114, 105, 99, 107, 101, 116, 117, 110, 101, 0, 83, 104, 105, 110, 120, 0, 76, 117, 120, 105, 111, 0, 76, 117, 120, 114, 97, 121, 0, 66, 117, 100, 101, 119, 0, 82, 111, 115, 101, 114, 97, 100, 101, 0, 67, 114, 97, 110, 105, 100, 111, 115, 0, 82, 97, 109, 112, 97, 114, 100, 111, 115, 0, 83, 104, 105, 101, 108, 100, 111, 110, 0, 66, 97, 115, 116, 105, 111, 100, 111, 110, 0, 66, 117, 114, 109, 121, 0, 87, 111, 114, 109, 97, 100, 97, 109, 0, 77, 111, 116, 104, 105, 109, 0, 67, 111, 109, 98, 101, 101, 0, 86, 101, 115, 112, 105, 113, 117, 101, 110, 0, 80, 97, 99, 104, 105, 114, 105, 115, 117, 0, 66, 117, 105, 122, 101, 108, 0, 70, 108, 111, 97, 116, 122, 101, 108, 0, 67, 104, 101, 114, 117, 98, 105, 0, 67, 104, 101, 114, 114, 105, 109, 0, 83, 104, 101, 108, 108, 111, 115, 0, 71, 97, 115, 116, 114, 111, 100, 111, 110, 0, 65, 109, 98, 105, 112, 111, 109, 0, 68, 114, 105, 102, 108, 111, 111, 110, 0, 68, 114, 105, 102, 98, 108, 105, 109, 0, 66, 117, 110, 101, 97, 114, 121, 0, 76, 111, 112, 117, 110, 110, 121, 0, 77, 105, 115, 109, 97, 103, 105, 117, 115, 0, 72, 111, 110, 99, 104, 107, 114, 111, 119, 0, 71, 108, 97, 109, 101, 111, 119, 0, 80, 117, 114, 117, 103, 108, 121, 0, 67, 104, 105, 110, 103, 108, 105, 110, 103, 0, 83, 116, 117, 110, 107, 121, 0, 83, 107, 117, 110, 116, 97, 110, 107, 0, 66, 114, 111, 110, 122, 111, 114, 0, 66, 114, 111, 110, 122, 111, 110, 103, 0, 66, 111, 110, 115, 108, 121, 0, 77, 105, 109, 101, 32, 74, 114, 46, 0, 72, 97, 112, 112, 105, 110, 121, 0, 67, 104, 97, 116, 111, 116, 0, 83, 112, 105, 114, 105, 116, 111, 109, 98, 0, 71, 105, 98, 108, 101, 0, 71, 97, 98, 105, 116, 101, 0, 71, 97, 114, 99, 104, 111, 109, 112, 0, 77, 117, 110, 99, 104, 108, 97, 120, 0, 82, 105, 111, 108, 117, 0, 76, 117, 99, 97, 114, 105, 111, 0, 72, 105, 112, 112, 111, 112, 111, 116, 97, 115, 0, 72, 105, 112, 112, 111, 119, 100, 111, 110, 0, 83, 107, 111, 114, 117, 112, 105, 0, 68, 114, 97, 112, 105, 111, 110, 0, 67, 114, 111, 97, 103, 117, 110, 107, 0, 84, 111, 120, 105, 99, 114, 111, 97, 107, 0, 67, 97, 114, 110, 105, 118, 105, 110, 101, 0, 70, 105, 110, 110, 101, 111, 110, 0, 76, 117, 109, 105, 110, 101, 111, 110, 0, 77, 97, 110, 116, 121, 107, 101, 0, 83, 110, 111, 118, 101, 114, 0, 65, 98, 111, 109, 97, 115, 110, 111, 119, 0, 87, 101, 97, 118, 105, 108, 101, 0, 77, 97, 103, 110, 101, 122, 111, 110, 101, 0, 76, 105, 99, 107, 105, 108, 105, 99, 107, 121, 0, 82, 104, 121, 112, 101, 114, 105, 111, 114, 0, 84, 97, 110, 103, 114, 111, 119, 116, 104, 0, 69, 108, 101, 99, 116, 105, 118, 105, 114, 101, 0, 77, 97, 103, 109, 111, 114, 116, 97, 114, 0, 84, 111, 103, 101, 107, 105, 115, 115, 0, 89, 97, 110, 109, 101, 103, 97, 0, 76, 101, 97, 102, 101, 111, 110, 0, 71, 108, 97, 99, 101, 111, 110, 0, 71, 108, 105, 115, 99, 111, 114, 0, 77, 97, 109, 111, 115, 119, 105, 110, 101, 0, 80, 111, 114, 121, 103, 111, 110, 45, 90, 0, 71, 97, 108, 108, 97, 100, 101, 0, 80, 114, 111, 98, 111, 112, 97, 115, 115, 0, 68, 117, 115, 107, 110, 111, 105, 114, 0, 70, 114, 111, 115, 108, 97, 115, 115, 0, 82, 111, 116, 111, 109, 0, 85, 120, 105, 101, 0, 77, 101, 115, 112, 114, 105, 116, 0, 65, 122, 101, 108, 102, 0, 68, 105, 97, 108, 103, 97, 0, 80, 97, 108, 107, 105, 97, 0, 72, 101, 97, 116, 114, 97, 110, 0, 82, 101, 103, 105, 103, 105, 103, 97, 115, 0, 71, 105, 114, 97, 116, 105, 110, 97, 0, 67, 114, 101, 115, 115, 101, 108, 105, 97, 0, 80, 104, 105, 111, 110, 101, 0, 77, 97, 110, 97, 112, 104, 121, 0, 68, 97, 114, 107, 114, 97, 105, 0, 83, 104, 97, 121, 109, 105, 110, 0, 65, 114, 99, 101, 117, 115, 0, 86, 105, 99, 116, 105, 110, 105, 0, 83, 110, 105, 118, 121, 0, 83, 101, 114, 118, 105, 110, 101, 0, 83, 101, 114, 112, 101, 114, 105, 111, 114, 0, 84, 101, 112, 105, 103, 0, 80, 105, 103, 110, 105, 116, 101, 0, 69, 109, 98, 111, 97, 114, 0, 79, 115, 104, 97, 119, 111, 116, 116, 0, 68, 101, 119, 111, 116, 116, 0, 83, 97, 109, 117, 114, 111, 116, 116, 0, 80, 97, 116, 114, 97, 116, 0, 87, 97, 116, 99, 104, 111, 103, 0, 76, 105, 108, 108, 105, 112, 117, 112, 0, 72, 101, 114, 100, 105, 101, 114, 0, 83, 116, 111, 117, 116, 108, 97, 110, 100, 0, 80, 117, 114, 114, 108, 111, 105, 110, 0, 76, 105, 101, 112, 97, 114, 100, 0, 80, 97, 110, 115, 97, 103, 101, 0, 83, 105, 109, 105, 115, 97, 103, 101, 0, 80, 97, 110, 115, 101, 97, 114, 0, 83, 105, 109, 105, 115, 101, 97, 114, 0, 80, 97, 110, 112, 111, 117, 114, 0, 83, 105, 109, 105, 112, 111, 117, 114, 0, 77, 117, 110, 110, 97, 0, 77, 117, 115, 104, 97, 114, 110, 97, 0, 80, 105, 100, 111, 118, 101, 0, 84, 114, 97, 110, 113, 117, 105, 108, 108, 0, 85, 110, 102, 101, 122, 97, 110, 116, 0, 66, 108, 105, 116, 122, 108, 101, 0, 90, 101, 98, 115, 116, 114, 105, 107, 97, 0, 82, 111, 103, 103, 101, 110, 114, 111, 108, 97, 0, 66, 111, 108, 100, 111, 114, 101, 0, 71, 105, 103, 97, 108, 105, 116, 104, 0, 87, 111, 111, 98, 97, 116, 0, 83, 119, 111, 111, 98, 97, 116, 0, 68, 114, 105, 108, 98, 117, 114, 0, 69, 120, 99, 97, 100, 114, 105, 108, 108, 0, 65, 117, 100, 105, 110, 111, 0, 84, 105, 109, 98, 117, 114, 114, 0, 71, 117, 114, 100, 117, 114, 114, 0, 67, 111, 110, 107, 101, 108, 100, 117, 114, 114, 0, 84, 121, 109, 112, 111, 108, 101, 0, 80, 97, 108, 112, 105, 116, 111, 97, 100, 0, 83, 101, 105, 115, 109, 105, 116, 111, 97, 100, 0, 84, 104, 114, 111, 104, 0, 83, 97, 119, 107, 0, 83, 101, 119, 97, 100, 100, 108, 101, 0, 83, 119, 97, 100, 108, 111, 111, 110, 0, 76, 101, 97, 118, 97, 110, 110, 121, 0, 86, 101, 110, 105, 112, 101, 100, 101, 0, 87, 104, 105, 114, 108, 105, 112, 101, 100, 101, 0, 83, 99, 111, 108, 105, 112, 101, 100, 101, 0, 67, 111, 116, 116, 111, 110, 101, 101, 0, 87, 104, 105, 109, 115, 105, 99, 111, 116, 116, 0, 80, 101, 116, 105, 108, 105, 108, 0, 76, 105, 108, 108, 105, 103, 97, 110, 116, 0, 66, 97, 115, 99, 117, 108, 105, 110, 0, 83, 97, 110, 100, 105, 108, 101, 0, 75, 114, 111, 107, 111, 114, 111, 107, 0, 75, 114, 111, 111, 107, 111, 100, 105, 108, 101, 0, 68, 97, 114, 117, 109, 97, 107, 97, 0, 68, 97, 114, 109, 97, 110, 105, 116, 97, 110, 0, 77, 97, 114, 97, 99, 116, 117, 115, 0, 68, 119, 101, 98, 98, 108, 101, 0, 67, 114, 117, 115, 116, 108, 101, 0, 83, 99, 114, 97, 103, 103, 121, 0, 83, 99, 114, 97, 102, 116, 121, 0, 83, 105, 103, 105, 108, 121, 112, 104, 0, 89, 97, 109, 97, 115, 107, 0, 67, 111, 102, 97, 103, 114, 105, 103, 117, 115, 0, 84, 105, 114, 116, 111, 117, 103, 97, 0, 67, 97, 114, 114, 97, 99, 111, 115, 116, 97, 0, 65, 114, 99, 104, 101, 110, 0, 65, 114, 99, 104, 101, 111, 112, 115, 0, 84, 114, 117, 98, 98, 105, 115, 104, 0, 71, 97, 114, 98, 111, 100, 111, 114, 0, 90, 111, 114, 117, 97, 0, 90, 111, 114, 111, 97, 114, 107, 0, 77, 105, 110, 99, 99, 105, 110, 111, 0, 67, 105, 110, 99, 99, 105, 110, 111, 0, 71, 111, 116, 104, 105, 116, 97, 0, 71, 111, 116, 104, 111, 114, 105, 116, 97, 0, 71, 111, 116, 104, 105, 116, 101, 108, 108, 101, 0, 83, 111, 108, 111, 115, 105, 115, 0, 68, 117, 111, 115, 105, 111, 110, 0, 82, 101, 117, 110, 105, 99, 108, 117, 115, 0, 68, 117, 99, 107, 108, 101, 116, 116, 0, 83, 119, 97, 110, 110, 97, 0, 86, 97, 110, 105, 108, 108, 105, 116, 101, 0, 86, 97, 110, 105, 108, 108, 105, 115, 104, 0, 86, 97, 110, 105, 108, 108, 117, 120, 101, 0, 68, 101, 101, 114, 108, 105, 110, 103, 0, 83, 97, 119, 115, 98, 117, 99, 107, 0, 69, 109, 111, 108, 103, 97, 0, 75, 97, 114, 114, 97, 98, 108, 97, 115, 116, 0, 69, 115, 99, 97, 118, 97, 108, 105, 101, 114, 0, 70, 111, 111, 110, 103, 117, 115, 0, 65, 109, 111, 111, 110, 103, 117, 115, 115, 0, 70, 114, 105, 108, 108, 105, 115, 104, 0, 74, 101, 108, 108, 105, 99, 101, 110, 116, 0, 65, 108, 111, 109, 111, 109, 111, 108, 97, 0, 74, 111, 108, 116, 105, 107, 0, 71, 97, 108, 118, 97, 110, 116, 117, 108, 97, 0, 70, 101, 114, 114, 111, 115, 101, 101, 100, 0, 70, 101, 114, 114, 111, 116, 104, 111, 114, 110, 0, 75, 108, 105, 110, 107, 0, 75, 108, 97, 110, 103, 0, 75, 108, 105, 110, 107, 108, 97, 110, 103, 0, 84, 121, 110, 97, 109, 111, 0, 69, 101, 108, 101, 107, 116, 114, 105, 107, 0, 69, 101, 108, 101, 107, 116, 114, 111, 115, 115, 0, 69, 108, 103, 121, 101, 109, 0, 66, 101, 104, 101, 101, 121, 101, 109, 0, 76, 105, 116, 119, 105, 99, 107, 0, 76, 97, 109, 112, 101, 110, 116, 0, 67, 104, 97, 110, 100, 101, 108, 117, 114, 101, 0, 65, 120, 101, 119, 0, 70, 114, 97, 120, 117, 114, 101, 0, 72, 97, 120, 111, 114, 117, 115, 0, 67, 117, 98, 99, 104, 111, 111, 0, 66, 101, 97, 114, 116, 105, 99, 0, 67, 114, 121, 111, 103, 111, 110, 97, 108, 0, 83, 104, 101, 108, 109, 101, 116, 0, 65, 99, 99, 101, 108, 103, 111, 114, 0, 83, 116, 117, 110, 102, 105, 115, 107, 0, 77, 105, 101, 110, 102, 111, 111, 0, 77, 105, 101, 110, 115, 104, 97, 111, 0, 68, 114, 117, 100, 100, 105, 103, 111, 110, 0, 71, 111, 108, 101, 116, 116, 0, 71, 111, 108, 117, 114, 107, 0, 80, 97, 119, 110, 105, 97, 114, 100, 0, 66, 105, 115, 104, 97, 114, 112, 0, 66, 111, 117, 102, 102, 97, 108, 97, 110, 116, 0, 82, 117, 102, 102, 108, 101, 116, 0, 66, 114, 97, 118, 105, 97, 114, 121, 0, 86, 117, 108, 108, 97, 98, 121, 0, 77, 97, 110, 100, 105, 98, 117, 122, 122, 0, 72, 101, 97, 116, 109, 111, 114, 0, 68, 117, 114, 97, 110, 116, 0, 68, 101, 105, 110, 111, 0, 90, 119, 101, 105, 108, 111, 117, 115, 0, 72, 121, 100, 114, 101, 105, 103, 111, 110, 0, 76, 97, 114, 118, 101, 115, 116, 97, 0, 86, 111, 108, 99, 97, 114, 111, 110, 97, 0, 67, 111, 98, 97, 108, 105, 111, 110, 0, 84, 101, 114, 114, 97, 107, 105, 111, 110, 0, 86, 105, 114, 105, 122, 105, 111, 110, 0, 84, 111, 114, 110, 97, 100, 117, 115, 0, 84, 104, 117, 110, 100, 117, 114, 117, 115, 0, 82, 101, 115, 104, 105, 114, 97, 109, 0, 90, 101, 107, 114, 111, 109, 0, 76, 97, 110, 100, 111, 114, 117, 115, 0, 75, 121, 117, 114, 101, 109, 0, 75, 101, 108, 100, 101, 111, 0, 77, 101, 108, 111, 101, 116, 116, 97, 0, 71, 101, 110, 101, 115, 101, 99, 116, 0, 67, 104, 101, 115, 112, 105, 110, 0, 81, 117, 105, 108, 108, 97, 100, 105, 110, 0, 67, 104, 101, 115, 110, 97, 117, 103, 104, 116, 0, 70, 101, 110, 110, 101, 107, 105, 110, 0, 66, 114, 97, 105, 120, 101, 110, 0, 68, 101, 108, 112, 104, 111, 120, 0, 70, 114, 111, 97, 107, 105, 101, 0, 70, 114, 111, 103, 97, 100, 105, 101, 114, 0, 71, 114, 101, 110, 105, 110, 106, 97, 0, 66, 117, 110, 110, 101, 108, 98, 121, 0, 68, 105, 103, 103, 101, 114, 115, 98, 121, 0, 70, 108, 101, 116, 99, 104, 108, 105, 110, 103, 0, 70, 108, 101, 116, 99, 104, 105, 110, 100, 101, 114, 0, 84, 97, 108, 111, 110, 102, 108, 97, 109, 101, 0, 83, 99, 97, 116, 116, 101, 114, 98, 117, 103, 0, 83, 112, 101, 119, 112, 97, 0, 86, 105, 118, 105, 108, 108, 111, 110, 0, 76, 105, 116, 108, 101, 111, 0, 80, 121, 114, 111, 97, 114, 0, 70, 108, 97, 98, 195, 169, 98, 195, 169, 0, 70, 108, 111, 101, 116, 116, 101, 0, 70, 108, 111, 114, 103, 101, 115, 0, 83, 107, 105, 100, 100, 111, 0, 71, 111, 103, 111, 97, 116, 0, 80, 97, 110, 99, 104, 97, 109, 0, 80, 97, 110, 103, 111, 114, 111, 0, 70, 117, 114, 102, 114, 111, 117, 0, 69, 115, 112, 117, 114, 114, 0, 77, 101, 111, 119, 115, 116, 105, 99, 0, 72, 111, 110, 101, 100, 103, 101, 0, 68, 111, 117, 98, 108, 97, 100, 101, 0, 65, 101, 103, 105, 115, 108, 97, 115, 104, 0, 83, 112, 114, 105, 116, 122, 101, 101, 0, 65, 114, 111, 109, 97, 116, 105, 115, 115, 101, 0, 83, 119, 105, 114, 108, 105, 120, 0, 83, 108, 117, 114, 112, 117, 102, 102, 0, 73, 110, 107, 97, 121, 0, 77, 97, 108, 97, 109, 97, 114, 0, 66, 105, 110, 97, 99, 108, 101, 0, 66, 97, 114, 98, 97, 114, 97, 99, 108, 101, 0, 83, 107, 114, 101, 108, 112, 0, 68, 114, 97, 103, 97, 108, 103, 101, 0, 67, 108, 97, 117, 110, 99, 104, 101, 114, 0, 67, 108, 97, 119, 105, 116, 122, 101, 114, 0, 72, 101, 108, 105, 111, 112, 116, 105, 108, 101, 0, 72, 101, 108, 105, 111, 108, 105, 115, 107, 0, 84, 121, 114, 117, 110, 116, 0, 84, 121, 114, 97, 110, 116, 114, 117, 109, 0, 65, 109, 97, 117, 114, 97, 0, 65, 117, 114, 111, 114, 117, 115, 0, 83, 121, 108, 118, 101, 111, 110, 0, 72, 97, 119, 108, 117, 99, 104, 97, 0, 68, 101, 100, 101, 110, 110, 101, 0, 67, 97, 114, 98, 105, 110, 107, 0, 71, 111, 111, 109, 121, 0, 83, 108, 105, 103, 103, 111, 111, 0, 71, 111, 111, 100, 114, 97, 0, 75, 108, 101, 102, 107, 105, 0, 80, 104, 97, 110, 116, 117, 109, 112, 0, 84, 114, 101, 118, 101, 110, 97, 110, 116, 0, 80, 117, 109, 112, 107, 97, 98, 111, 111, 0, 71, 111, 117, 114, 103, 101, 105, 115, 116, 0, 66, 101, 114, 103, 109, 105, 116, 101, 0, 65, 118, 97, 108, 117, 103, 103, 0, 78, 111, 105, 98, 97, 116, 0, 78, 111, 105, 118, 101, 114, 110, 0, 88, 101, 114, 110, 101, 97, 115, 0, 89, 118, 101, 108, 116, 97, 108, 0, 90, 121, 103, 97, 114, 100, 101, 0, 68, 105, 97, 110, 99, 105, 101, 0, 72, 111, 111, 112, 97, 0, 86, 111, 108, 99, 97, 110, 105, 111, 110, 0, 82, 111, 119, 108, 101, 116, 0, 68, 97, 114, 116, 114, 105, 120, 0, 68, 101, 99, 105, 100, 117, 101, 121, 101, 0, 76, 105, 116, 116, 101, 110, 0, 84, 111, 114, 114, 97, 99, 97, 116, 0, 73, 110, 99, 105, 110, 101, 114, 111, 97, 114, 0, 80, 111, 112, 112, 108, 105, 111, 0, 66, 114, 105, 111, 110, 110, 101, 0, 80, 114, 105, 109, 97, 114, 105, 110, 97, 0, 80, 105, 107, 105, 112, 101, 107, 0, 84, 114, 117, 109, 98, 101, 97, 107, 0, 84, 111, 117, 99, 97, 110, 110, 111, 110, 0, 89, 117, 110, 103, 111, 111, 115, 0, 71, 117, 109, 115, 104, 111, 111, 115, 0, 71, 114, 117, 98, 98, 105, 110, 0, 67, 104, 97, 114, 106, 97, 98, 117, 103, 0, 86, 105, 107, 97, 118, 111, 108, 116, 0, 67, 114, 97, 98, 114, 97, 119, 108, 101, 114, 0, 67, 114, 97, 98, 111, 109, 105, 110, 97, 98, 108, 101, 0, 79, 114, 105, 99, 111, 114, 105, 111, 0, 67, 117, 116, 105, 101, 102, 108, 121, 0, 82, 105, 98, 111, 109, 98, 101, 101, 0, 82, 111, 99, 107, 114, 117, 102, 102, 0, 76, 121, 99, 97, 110, 114, 111, 99, 0, 87, 105, 115, 104, 105, 119, 97, 115, 104, 105, 0, 77, 97, 114, 101, 97, 110, 105, 101, 0, 84, 111, 120, 97, 112, 101, 120, 0, 77, 117, 100, 98, 114, 97, 121, 0, 77, 117, 100, 115, 100, 97, 108, 101, 0, 68, 101, 119, 112, 105, 100, 101, 114, 0, 65, 114, 97, 113, 117, 97, 110, 105, 100, 0, 70, 111, 109, 97, 110, 116, 105, 115, 0, 76, 117, 114, 97, 110, 116, 105, 115, 0, 77, 111, 114, 101, 108, 117, 108, 108, 0, 83, 104, 105, 105, 110, 111, 116, 105, 99, 0, 83, 97, 108, 97, 110, 100, 105, 116, 0, 83, 97, 108, 97, 122, 122, 108, 101, 0, 83, 116, 117, 102, 102, 117, 108, 0, 66, 101, 119, 101, 97, 114, 0, 66, 111, 117, 110, 115, 119, 101, 101, 116, 0, 83, 116, 101, 101, 110, 101, 101, 0, 84, 115, 97, 114, 101, 101, 110, 97, 0, 67, 111, 109, 102, 101, 121, 0, 79, 114, 97, 110, 103, 117, 114, 117, 0, 80, 97, 115, 115, 105, 109, 105, 97, 110, 0, 87, 105, 109, 112, 111, 100, 0, 71, 111, 108, 105, 115, 111, 112, 111, 100, 0, 83, 97, 110, 100, 121, 103, 97, 115, 116, 0, 80, 97, 108, 111, 115, 115, 97, 110, 100, 0, 80, 121, 117, 107, 117, 109, 117, 107, 117, 0, 84, 105, 112, 111, 32, 90, 101, 114, 111, 0, 83, 105, 108, 118, 97, 108, 108, 121, 0, 77, 105, 110, 105, 111, 114, 0, 75, 111, 109, 97, 108, 97, 0, 84, 117, 114, 116, 111, 110, 97, 116, 111, 114, 0, 84, 111, 103, 101, 100, 101, 109, 97, 114, 117, 0, 77, 105, 109, 105, 107, 121, 117, 0, 66, 114, 117, 120, 105, 115, 104, 0, 68, 114, 97, 109, 112, 97, 0, 68, 104, 101, 108, 109, 105, 115, 101, 0, 74, 97, 110, 103, 109, 111, 45, 111, 0, 72, 97, 107, 97, 109, 111, 45, 111, 0, 75, 111, 109, 109, 111, 45, 111, 0, 84, 97, 112, 117, 32, 75, 111, 107, 111, 0, 84, 97, 112, 117, 32, 76, 101, 108, 101, 0, 84, 97, 112, 117, 32, 66, 117, 108, 117, 0, 84, 97, 112, 117, 32, 70, 105, 110, 105, 0, 67, 111, 115, 109, 111, 103, 0, 67, 111, 115, 109, 111, 101, 109, 0, 83, 111, 108, 103, 97, 108, 101, 111, 0, 76, 117, 110, 97, 108, 97, 0, 78, 105, 104, 105, 108, 101, 103, 111, 0, 66, 117, 122, 122, 119, 111, 108, 101, 0, 80, 104, 101, 114, 111, 109, 111, 115, 97, 0, 88, 117, 114, 107, 105, 116, 114, 101, 101, 0, 67, 101, 108, 101, 115, 116, 101, 101, 108, 97, 0, 75, 97, 114, 116, 97, 110, 97, 0, 71, 117, 122, 122, 108, 111, 114, 100, 0, 78, 101, 99, 114, 111, 122, 109, 97, 0, 77, 97, 103, 101, 97, 114, 110, 97, 0, 77, 97, 114, 115, 104, 97, 100, 111, 119, 0, 80, 111, 105, 112, 111, 108, 101, 0, 78, 97, 103, 97, 110, 97, 100, 101, 108, 0, 83, 116, 97, 107, 97, 116, 97, 107, 97, 0, 66, 108, 97, 99, 101, 112, 104, 97, 108, 111, 110, 0, 90, 101, 114, 97, 111, 114, 97, 0 };
-
-constexpr std::array<u8, 761> characteristic_ja = { 78, 111, 110, 101, 0, 227, 129, 159, 227, 129, 185, 227, 130, 139, 227, 129, 174, 227, 129, 140, 227, 129, 160, 227, 129, 132, 227, 129, 153, 227, 129, 141, 0, 227, 129, 178, 227, 130, 139, 227, 129, 173, 227, 130, 146, 227, 130, 136, 227, 129, 143, 227, 129, 153, 227, 130, 139, 0, 227, 129, 132, 227, 129, 173, 227, 130, 128, 227, 130, 138, 227, 129, 140, 227, 129, 138, 227, 129, 138, 227, 129, 132, 0, 227, 130, 130, 227, 129, 174, 227, 130, 146, 227, 130, 136, 227, 129, 143, 227, 129, 161, 227, 130, 137, 227, 129, 139, 227, 129, 153, 0, 227, 129, 174, 227, 130, 147, 227, 129, 179, 227, 130, 138, 227, 129, 153, 227, 130, 139, 227, 129, 174, 227, 129, 140, 227, 129, 153, 227, 129, 141, 0, 227, 129, 161, 227, 129, 139, 227, 130, 137, 227, 129, 140, 227, 129, 152, 227, 129, 190, 227, 130, 147, 0, 227, 129, 130, 227, 129, 176, 227, 130, 140, 227, 130, 139, 227, 129, 147, 227, 129, 168, 227, 129, 140, 227, 129, 153, 227, 129, 141, 0, 227, 129, 161, 227, 130, 135, 227, 129, 163, 227, 129, 168, 227, 129, 138, 227, 129, 147, 227, 130, 138, 227, 129, 163, 227, 129, 189, 227, 129, 132, 0, 227, 130, 177, 227, 131, 179, 227, 130, 171, 227, 130, 146, 227, 129, 153, 227, 130, 139, 227, 129, 174, 227, 129, 140, 227, 129, 153, 227, 129, 141, 0, 227, 129, 161, 227, 129, 174, 227, 129, 145, 227, 129, 140, 227, 129, 138, 227, 129, 138, 227, 129, 132, 0, 227, 129, 139, 227, 130, 137, 227, 129, 160, 227, 129, 140, 227, 129, 152, 227, 130, 135, 227, 129, 134, 227, 129, 182, 0, 227, 129, 134, 227, 129, 159, 227, 130, 140, 227, 129, 165, 227, 130, 136, 227, 129, 132, 0, 227, 129, 173, 227, 129, 176, 227, 130, 138, 227, 129, 165, 227, 130, 136, 227, 129, 132, 0, 227, 129, 151, 227, 130, 147, 227, 129, 188, 227, 129, 134, 227, 129, 165, 227, 130, 136, 227, 129, 132, 0, 227, 129, 140, 227, 129, 190, 227, 130, 147, 227, 129, 165, 227, 130, 136, 227, 129, 132, 0, 227, 129, 139, 227, 129, 145, 227, 129, 163, 227, 129, 147, 227, 129, 140, 227, 129, 153, 227, 129, 141, 0, 227, 130, 130, 227, 129, 174, 227, 129, 138, 227, 129, 168, 227, 129, 171, 227, 129, 179, 227, 130, 147, 227, 129, 139, 227, 130, 147, 0, 227, 129, 138, 227, 129, 163, 227, 129, 161, 227, 130, 135, 227, 129, 147, 227, 129, 161, 227, 130, 135, 227, 129, 132, 0, 227, 129, 153, 227, 129, 147, 227, 129, 151, 227, 129, 138, 227, 129, 161, 227, 130, 135, 227, 129, 134, 227, 129, 151, 227, 130, 130, 227, 129, 174, 0, 227, 129, 171, 227, 129, 146, 227, 130, 139, 227, 129, 174, 227, 129, 140, 227, 129, 175, 227, 130, 132, 227, 129, 132, 0, 227, 129, 147, 227, 129, 134, 227, 129, 141, 227, 129, 151, 227, 130, 147, 227, 129, 140, 227, 129, 164, 227, 130, 136, 227, 129, 132, 0, 227, 130, 164, 227, 130, 191, 227, 130, 186, 227, 131, 169, 227, 129, 140, 227, 129, 153, 227, 129, 141, 0, 227, 129, 172, 227, 129, 145, 227, 130, 129, 227, 129, 140, 227, 129, 170, 227, 129, 132, 0, 227, 129, 139, 227, 130, 147, 227, 129, 140, 227, 129, 136, 227, 129, 148, 227, 129, 168, 227, 129, 140, 227, 129, 138, 227, 129, 138, 227, 129, 132, 0, 227, 129, 168, 227, 129, 166, 227, 130, 130, 227, 129, 141, 227, 129, 161, 227, 130, 135, 227, 129, 134, 227, 130, 129, 227, 130, 147, 0, 227, 129, 141, 227, 129, 140, 227, 129, 164, 227, 130, 136, 227, 129, 132, 0, 227, 129, 161, 227, 130, 135, 227, 129, 163, 227, 129, 180, 227, 130, 138, 227, 129, 191, 227, 129, 136, 227, 129, 163, 227, 129, 177, 227, 130, 138, 0, 227, 129, 190, 227, 129, 145, 227, 130, 147, 227, 129, 141, 227, 129, 140, 227, 129, 164, 227, 130, 136, 227, 129, 132, 0, 227, 129, 190, 227, 129, 145, 227, 129, 154, 227, 129, 142, 227, 130, 137, 227, 129, 132, 0, 227, 129, 161, 227, 130, 135, 227, 129, 163, 227, 129, 180, 227, 130, 138, 227, 129, 148, 227, 129, 134, 227, 129, 152, 227, 130, 135, 227, 129, 134, 0 };
-
-constexpr std::array<u8, 2185> dppt_ja = { 48, 44, 67, 97, 110, 97, 108, 97, 118, 101, 32, 67, 105, 116, 121, 0, 49, 44, 69, 116, 101, 114, 110, 97, 32, 67, 105, 116, 121, 0, 50, 44, 80, 97, 115, 116, 111, 114, 105, 97, 32, 67, 105, 116, 121, 0, 51, 44, 83, 117, 110, 121, 115, 104, 111, 114, 101, 32, 67, 105, 116, 121, 0, 52, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 76, 101, 97, 103, 117, 101, 0, 53, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 77, 105, 110, 101, 32, 49, 70, 0, 54, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 77, 105, 110, 101, 32, 66, 49, 70, 0, 55, 44, 86, 97, 108, 108, 101, 121, 32, 87, 105, 110, 100, 119, 111, 114, 107, 115, 0, 56, 44, 69, 116, 101, 114, 110, 97, 32, 70, 111, 114, 101, 115, 116, 0, 57, 44, 70, 117, 101, 103, 111, 32, 73, 114, 111, 110, 119, 111, 114, 107, 115, 0, 49, 48, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 40, 82, 111, 117, 116, 101, 32, 50, 48, 55, 47, 50, 48, 56, 32, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 49, 49, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 50, 70, 0, 49, 50, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 51, 70, 0, 49, 51, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 83, 110, 111, 119, 0, 49, 52, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 52, 70, 0, 49, 53, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 53, 70, 0, 49, 54, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 54, 70, 0, 49, 55, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 55, 70, 0, 49, 56, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 84, 111, 112, 32, 67, 97, 118, 101, 0, 49, 57, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 40, 82, 111, 117, 116, 101, 32, 50, 49, 54, 32, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 50, 48, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 40, 82, 111, 117, 116, 101, 32, 50, 49, 49, 32, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 50, 49, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 66, 49, 70, 0, 50, 50, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 49, 0, 50, 51, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 50, 0, 50, 52, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 51, 0, 50, 53, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 52, 0, 50, 54, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 53, 0, 50, 55, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 54, 0, 50, 56, 44, 83, 111, 108, 97, 99, 101, 111, 110, 32, 82, 117, 105, 110, 115, 0, 50, 57, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 51, 48, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 50, 70, 0, 51, 49, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 49, 70, 0, 51, 50, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 97, 99, 107, 32, 82, 111, 111, 109, 32, 49, 0, 51, 51, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 97, 99, 107, 32, 82, 111, 111, 109, 32, 50, 0, 51, 52, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 97, 99, 107, 32, 82, 111, 111, 109, 32, 51, 0, 51, 53, 44, 82, 97, 118, 97, 103, 101, 100, 32, 80, 97, 116, 104, 0, 51, 54, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 71, 97, 116, 101, 32, 49, 70, 0, 51, 55, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 71, 97, 116, 101, 32, 66, 49, 70, 0, 51, 56, 44, 83, 116, 97, 114, 107, 32, 77, 111, 117, 110, 116, 97, 105, 110, 0, 51, 57, 44, 83, 116, 97, 114, 107, 32, 77, 111, 117, 110, 116, 97, 105, 110, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 52, 48, 44, 83, 116, 97, 114, 107, 32, 77, 111, 117, 110, 116, 97, 105, 110, 32, 73, 110, 116, 101, 114, 105, 111, 114, 0, 52, 49, 44, 83, 101, 110, 100, 111, 102, 102, 32, 83, 112, 114, 105, 110, 103, 0, 52, 50, 44, 84, 117, 114, 110, 98, 97, 99, 107, 32, 67, 97, 118, 101, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 52, 51, 44, 84, 117, 114, 110, 98, 97, 99, 107, 32, 67, 97, 118, 101, 32, 49, 115, 116, 32, 80, 105, 108, 108, 97, 114, 0, 52, 52, 44, 84, 117, 114, 110, 98, 97, 99, 107, 32, 67, 97, 118, 101, 32, 50, 110, 100, 32, 80, 105, 108, 108, 97, 114, 0, 52, 53, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 49, 70, 0, 52, 54, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 49, 70, 0, 52, 55, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 50, 70, 0, 52, 56, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 51, 70, 0, 52, 57, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 52, 70, 0, 53, 48, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 53, 70, 0, 53, 49, 44, 87, 97, 121, 119, 97, 114, 100, 32, 67, 97, 118, 101, 0, 53, 50, 44, 87, 97, 121, 119, 97, 114, 100, 32, 67, 97, 118, 101, 32, 40, 83, 101, 99, 114, 101, 116, 41, 0, 53, 51, 44, 82, 117, 105, 110, 32, 77, 97, 110, 105, 97, 99, 32, 67, 97, 118, 101, 32, 40, 60, 32, 49, 48, 32, 85, 110, 111, 119, 110, 41, 0, 53, 52, 44, 82, 117, 105, 110, 32, 77, 97, 110, 105, 97, 99, 32, 67, 97, 118, 101, 32, 40, 62, 32, 49, 48, 32, 85, 110, 111, 119, 110, 41, 0, 53, 53, 44, 77, 97, 110, 105, 97, 99, 32, 84, 117, 110, 110, 101, 108, 0, 53, 54, 44, 84, 114, 111, 112, 104, 121, 32, 71, 97, 114, 100, 101, 110, 0, 53, 55, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 0, 53, 56, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 49, 70, 0, 53, 57, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 49, 70, 0, 54, 48, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 50, 70, 32, 40, 76, 101, 102, 116, 41, 0, 54, 49, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 50, 70, 32, 40, 82, 105, 103, 104, 116, 41, 0, 54, 50, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 51, 70, 0, 54, 51, 44, 79, 108, 100, 32, 67, 104, 97, 116, 101, 97, 117, 0, 54, 52, 44, 79, 108, 100, 32, 67, 104, 97, 116, 101, 97, 117, 32, 82, 111, 111, 109, 32, 53, 0, 54, 53, 44, 76, 97, 107, 101, 32, 86, 101, 114, 105, 116, 121, 0, 54, 54, 44, 76, 97, 107, 101, 32, 86, 97, 108, 111, 114, 0, 54, 55, 44, 76, 97, 107, 101, 32, 65, 99, 117, 105, 116, 121, 0, 54, 56, 44, 86, 97, 108, 111, 114, 32, 76, 97, 107, 101, 102, 114, 111, 110, 116, 0, 54, 57, 44, 65, 99, 117, 105, 116, 121, 32, 76, 97, 107, 101, 102, 114, 111, 110, 116, 0, 55, 48, 44, 82, 111, 117, 116, 101, 32, 50, 48, 49, 0, 55, 49, 44, 82, 111, 117, 116, 101, 32, 50, 48, 50, 0, 55, 50, 44, 82, 111, 117, 116, 101, 32, 50, 48, 51, 0, 55, 51, 44, 82, 111, 117, 116, 101, 32, 50, 48, 52, 32, 40, 83, 111, 117, 116, 104, 41, 0, 55, 52, 44, 82, 111, 117, 116, 101, 32, 50, 48, 52, 32, 40, 78, 111, 114, 116, 104, 41, 0, 55, 53, 44, 82, 111, 117, 116, 101, 32, 50, 48, 53, 32, 40, 83, 111, 117, 116, 104, 41, 0, 55, 54, 44, 82, 111, 117, 116, 101, 32, 50, 48, 53, 32, 40, 78, 111, 114, 116, 104, 41, 0, 55, 55, 44, 82, 111, 117, 116, 101, 32, 50, 48, 54, 0, 55, 56, 44, 82, 111, 117, 116, 101, 32, 50, 48, 55, 0, 55, 57, 44, 82, 111, 117, 116, 101, 32, 50, 48, 56, 0, 56, 48, 44, 82, 111, 117, 116, 101, 32, 50, 48, 57, 0, 56, 49, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 49, 70, 0, 56, 50, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 50, 70, 0, 56, 51, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 51, 70, 0, 56, 52, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 52, 70, 0, 56, 53, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 53, 70, 0, 56, 54, 44, 82, 111, 117, 116, 101, 32, 50, 49, 48, 32, 40, 83, 111, 117, 116, 104, 41, 0, 56, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 48, 32, 40, 78, 111, 114, 116, 104, 41, 0, 56, 56, 44, 82, 111, 117, 116, 101, 32, 50, 49, 49, 32, 40, 87, 101, 115, 116, 41, 0, 56, 57, 44, 82, 111, 117, 116, 101, 32, 50, 49, 49, 32, 40, 69, 97, 115, 116, 41, 0, 57, 48, 44, 82, 111, 117, 116, 101, 32, 50, 49, 50, 32, 40, 78, 111, 114, 116, 104, 41, 0, 57, 49, 44, 82, 111, 117, 116, 101, 32, 50, 49, 50, 32, 40, 83, 111, 117, 116, 104, 41, 0, 57, 50, 44, 82, 111, 117, 116, 101, 32, 50, 49, 51, 0, 57, 51, 44, 82, 111, 117, 116, 101, 32, 50, 49, 52, 0, 57, 52, 44, 82, 111, 117, 116, 101, 32, 50, 49, 53, 0, 57, 53, 44, 82, 111, 117, 116, 101, 32, 50, 49, 54, 0, 57, 54, 44, 82, 111, 117, 116, 101, 32, 50, 49, 55, 0, 57, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 56, 0, 57, 56, 44, 82, 111, 117, 116, 101, 32, 50, 49, 57, 0, 57, 57, 44, 82, 111, 117, 116, 101, 32, 50, 50, 49, 0, 49, 48, 48, 44, 82, 111, 117, 116, 101, 32, 50, 50, 50, 0, 49, 48, 49, 44, 82, 111, 117, 116, 101, 32, 50, 50, 52, 0, 49, 48, 50, 44, 82, 111, 117, 116, 101, 32, 50, 50, 53, 0, 49, 48, 51, 44, 82, 111, 117, 116, 101, 32, 50, 50, 55, 0, 49, 48, 52, 44, 82, 111, 117, 116, 101, 32, 50, 50, 56, 0, 49, 48, 53, 44, 82, 111, 117, 116, 101, 32, 50, 50, 57, 0, 49, 48, 54, 44, 84, 119, 105, 110, 108, 101, 97, 102, 32, 84, 111, 119, 110, 0, 49, 48, 55, 44, 67, 101, 108, 101, 115, 116, 105, 99, 32, 84, 111, 119, 110, 0, 49, 48, 56, 44, 82, 101, 115, 111, 114, 116, 32, 65, 114, 101, 97, 0, 49, 48, 57, 44, 82, 111, 117, 116, 101, 32, 50, 50, 48, 0, 49, 49, 48, 44, 82, 111, 117, 116, 101, 32, 50, 50, 51, 0, 49, 49, 49, 44, 82, 111, 117, 116, 101, 32, 50, 50, 54, 0, 49, 49, 50, 44, 82, 111, 117, 116, 101, 32, 50, 51, 48, 0 };
-
-constexpr std::array<u8, 1799> frlg_ja = { 48, 44, 80, 97, 108, 108, 101, 116, 32, 84, 111, 119, 110, 0, 49, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 67, 105, 116, 121, 0, 50, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 105, 116, 121, 0, 51, 44, 86, 101, 114, 109, 105, 108, 105, 111, 110, 32, 67, 105, 116, 121, 0, 52, 44, 67, 101, 108, 97, 100, 111, 110, 32, 67, 105, 116, 121, 0, 53, 44, 70, 117, 99, 104, 115, 105, 97, 32, 67, 105, 116, 121, 0, 54, 44, 67, 105, 110, 110, 97, 98, 97, 114, 32, 73, 115, 108, 97, 110, 100, 0, 55, 44, 82, 111, 117, 116, 101, 32, 49, 0, 56, 44, 82, 111, 117, 116, 101, 32, 50, 0, 57, 44, 82, 111, 117, 116, 101, 32, 51, 0, 49, 48, 44, 82, 111, 117, 116, 101, 32, 52, 0, 49, 49, 44, 82, 111, 117, 116, 101, 32, 53, 0, 49, 50, 44, 82, 111, 117, 116, 101, 32, 54, 0, 49, 51, 44, 82, 111, 117, 116, 101, 32, 55, 0, 49, 52, 44, 82, 111, 117, 116, 101, 32, 56, 0, 49, 53, 44, 82, 111, 117, 116, 101, 32, 57, 0, 49, 54, 44, 82, 111, 117, 116, 101, 32, 49, 48, 0, 49, 55, 44, 82, 111, 117, 116, 101, 32, 49, 49, 0, 49, 56, 44, 82, 111, 117, 116, 101, 32, 49, 50, 0, 49, 57, 44, 82, 111, 117, 116, 101, 32, 49, 51, 0, 50, 48, 44, 82, 111, 117, 116, 101, 32, 49, 52, 0, 50, 49, 44, 82, 111, 117, 116, 101, 32, 49, 53, 0, 50, 50, 44, 82, 111, 117, 116, 101, 32, 49, 54, 0, 50, 51, 44, 82, 111, 117, 116, 101, 32, 49, 55, 0, 50, 52, 44, 82, 111, 117, 116, 101, 32, 49, 56, 0, 50, 53, 44, 82, 111, 117, 116, 101, 32, 49, 57, 0, 50, 54, 44, 82, 111, 117, 116, 101, 32, 50, 48, 0, 50, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 0, 50, 56, 44, 82, 111, 117, 116, 101, 32, 50, 50, 0, 50, 57, 44, 82, 111, 117, 116, 101, 32, 50, 51, 0, 51, 48, 44, 82, 111, 117, 116, 101, 32, 50, 52, 0, 51, 49, 44, 82, 111, 117, 116, 101, 32, 50, 53, 0, 51, 50, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 70, 111, 114, 101, 115, 116, 0, 51, 51, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 49, 70, 0, 51, 52, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 66, 49, 70, 0, 51, 53, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 66, 50, 70, 0, 51, 54, 44, 83, 46, 83, 46, 32, 65, 110, 110, 101, 0, 51, 55, 44, 68, 105, 103, 108, 101, 116, 116, 39, 115, 32, 67, 97, 118, 101, 0, 51, 56, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 51, 57, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 50, 70, 0, 52, 48, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 51, 70, 0, 52, 49, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 77, 97, 110, 115, 105, 111, 110, 32, 49, 70, 45, 51, 70, 0, 52, 50, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 77, 97, 110, 115, 105, 111, 110, 32, 66, 49, 70, 0, 52, 51, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 67, 101, 110, 116, 101, 114, 0, 52, 52, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 49, 0, 52, 53, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 50, 0, 52, 54, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 51, 0, 52, 55, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 49, 70, 0, 52, 56, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 66, 49, 70, 0, 52, 57, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 49, 70, 0, 53, 48, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 49, 70, 0, 53, 49, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 50, 70, 0, 53, 50, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 51, 70, 0, 53, 51, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 52, 70, 0, 53, 52, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 51, 70, 0, 53, 53, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 52, 70, 0, 53, 54, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 53, 70, 0, 53, 55, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 54, 70, 0, 53, 56, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 55, 70, 0, 53, 57, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 49, 70, 0, 54, 48, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 50, 70, 0, 54, 49, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 54, 50, 44, 80, 111, 119, 101, 114, 32, 80, 108, 97, 110, 116, 0, 54, 51, 44, 79, 110, 101, 32, 73, 115, 108, 97, 110, 100, 0, 54, 52, 44, 70, 111, 117, 114, 32, 73, 115, 108, 97, 110, 100, 0, 54, 53, 44, 70, 105, 118, 101, 32, 73, 115, 108, 97, 110, 100, 0, 54, 54, 44, 75, 105, 110, 100, 108, 101, 32, 82, 111, 97, 100, 0, 54, 55, 44, 84, 114, 101, 97, 115, 117, 114, 101, 32, 66, 101, 97, 99, 104, 0, 54, 56, 44, 67, 97, 112, 101, 32, 66, 114, 105, 110, 107, 0, 54, 57, 44, 66, 111, 110, 100, 32, 66, 114, 105, 100, 103, 101, 0, 55, 48, 44, 84, 104, 114, 101, 101, 32, 73, 115, 108, 101, 32, 80, 111, 114, 116, 0, 55, 49, 44, 82, 101, 115, 111, 114, 116, 32, 71, 111, 114, 103, 101, 111, 117, 115, 0, 55, 50, 44, 87, 97, 116, 101, 114, 32, 76, 97, 98, 121, 114, 105, 110, 116, 104, 0, 55, 51, 44, 70, 105, 118, 101, 32, 73, 115, 108, 101, 32, 77, 101, 97, 100, 111, 119, 0, 55, 52, 44, 77, 101, 109, 111, 114, 105, 97, 108, 32, 80, 105, 108, 108, 97, 114, 0, 55, 53, 44, 79, 117, 116, 99, 97, 115, 116, 32, 73, 115, 108, 97, 110, 100, 0, 55, 54, 44, 71, 114, 101, 101, 110, 32, 80, 97, 116, 104, 0, 55, 55, 44, 87, 97, 116, 101, 114, 32, 80, 97, 116, 104, 0, 55, 56, 44, 82, 117, 105, 110, 32, 86, 97, 108, 108, 101, 121, 0, 55, 57, 44, 84, 114, 97, 105, 110, 101, 114, 32, 84, 111, 119, 101, 114, 32, 40, 101, 120, 116, 101, 114, 105, 111, 114, 41, 0, 56, 48, 44, 67, 97, 110, 121, 111, 110, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 56, 49, 44, 83, 101, 118, 97, 117, 108, 116, 32, 67, 97, 110, 121, 111, 110, 0, 56, 50, 44, 84, 97, 110, 111, 98, 121, 32, 82, 117, 105, 110, 115, 0, 56, 51, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 0, 56, 52, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 82, 111, 111, 109, 32, 49, 0, 56, 53, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 82, 111, 111, 109, 32, 50, 0, 56, 54, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 82, 111, 111, 109, 32, 51, 0, 56, 55, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 49, 70, 0, 56, 56, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 49, 70, 0, 56, 57, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 50, 70, 0, 57, 48, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 51, 70, 0, 57, 49, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 52, 70, 0, 57, 50, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 53, 70, 0, 57, 51, 44, 66, 101, 114, 114, 121, 32, 70, 111, 114, 101, 115, 116, 0, 57, 52, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 0, 57, 53, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 32, 49, 70, 0, 57, 54, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 57, 55, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 32, 66, 97, 99, 107, 0, 57, 56, 44, 80, 97, 116, 116, 101, 114, 110, 32, 66, 117, 115, 104, 0, 57, 57, 44, 65, 108, 116, 101, 114, 105, 110, 103, 32, 67, 97, 118, 101, 0, 49, 48, 48, 44, 77, 111, 110, 101, 97, 110, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 49, 44, 76, 105, 112, 116, 111, 111, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 50, 44, 87, 101, 101, 112, 116, 104, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 51, 44, 68, 105, 108, 102, 111, 114, 100, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 52, 44, 83, 99, 117, 102, 105, 98, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 53, 44, 82, 105, 120, 121, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 54, 44, 86, 105, 97, 112, 111, 105, 115, 32, 67, 104, 97, 109, 98, 101, 114, 0 };
-
-constexpr std::array<u8, 1948> hgss_ja = { 48, 44, 78, 101, 119, 32, 66, 97, 114, 107, 32, 84, 111, 119, 110, 0, 49, 44, 82, 111, 117, 116, 101, 32, 50, 57, 0, 50, 44, 67, 104, 101, 114, 114, 121, 103, 114, 111, 118, 101, 32, 67, 105, 116, 121, 0, 51, 44, 82, 111, 117, 116, 101, 32, 51, 48, 0, 52, 44, 82, 111, 117, 116, 101, 32, 51, 49, 0, 53, 44, 86, 105, 111, 108, 101, 116, 32, 67, 105, 116, 121, 0, 54, 44, 83, 112, 114, 111, 117, 116, 32, 84, 111, 119, 101, 114, 0, 55, 44, 82, 111, 117, 116, 101, 32, 51, 50, 0, 56, 44, 82, 117, 105, 110, 115, 32, 111, 102, 32, 65, 108, 112, 104, 32, 40, 79, 117, 116, 115, 105, 100, 101, 41, 0, 57, 44, 82, 117, 105, 110, 115, 32, 111, 102, 32, 65, 108, 112, 104, 32, 40, 73, 110, 115, 105, 100, 101, 41, 0, 49, 48, 44, 85, 110, 105, 111, 110, 32, 67, 97, 118, 101, 32, 49, 70, 0, 49, 49, 44, 85, 110, 105, 111, 110, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 49, 50, 44, 85, 110, 105, 111, 110, 32, 67, 97, 118, 101, 32, 66, 50, 70, 0, 49, 51, 44, 82, 111, 117, 116, 101, 32, 51, 51, 0, 49, 52, 44, 83, 76, 79, 87, 80, 79, 75, 69, 32, 87, 101, 108, 108, 32, 49, 70, 0, 49, 53, 44, 83, 76, 79, 87, 80, 79, 75, 69, 32, 87, 101, 108, 108, 32, 66, 49, 70, 0, 49, 54, 44, 73, 108, 101, 120, 32, 70, 111, 114, 101, 115, 116, 0, 49, 55, 44, 82, 111, 117, 116, 101, 32, 51, 52, 0, 49, 56, 44, 82, 111, 117, 116, 101, 32, 51, 53, 0, 49, 57, 44, 78, 97, 116, 105, 111, 110, 97, 108, 32, 80, 97, 114, 107, 0, 50, 48, 44, 82, 111, 117, 116, 101, 32, 51, 54, 0, 50, 49, 44, 82, 111, 117, 116, 101, 32, 51, 55, 0, 50, 50, 44, 69, 99, 114, 117, 116, 101, 97, 107, 32, 67, 105, 116, 121, 0, 50, 51, 44, 66, 117, 114, 110, 101, 100, 32, 84, 111, 119, 101, 114, 32, 49, 70, 0, 50, 52, 44, 66, 117, 114, 110, 101, 100, 32, 84, 111, 119, 101, 114, 32, 66, 49, 70, 0, 50, 53, 44, 66, 101, 108, 108, 32, 84, 111, 119, 101, 114, 0, 50, 54, 44, 82, 111, 117, 116, 101, 32, 51, 56, 0, 50, 55, 44, 82, 111, 117, 116, 101, 32, 51, 57, 0, 50, 56, 44, 79, 108, 105, 118, 105, 110, 101, 32, 67, 105, 116, 121, 0, 50, 57, 44, 82, 111, 117, 116, 101, 32, 52, 48, 0, 51, 48, 44, 82, 111, 117, 116, 101, 32, 52, 49, 0, 51, 49, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 49, 70, 0, 51, 50, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 49, 70, 0, 51, 51, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 50, 70, 0, 51, 52, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 51, 70, 0, 51, 53, 44, 67, 105, 97, 110, 119, 111, 111, 100, 32, 67, 105, 116, 121, 0, 51, 54, 44, 82, 111, 117, 116, 101, 32, 52, 50, 0, 51, 55, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 49, 70, 0, 51, 56, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 49, 70, 32, 40, 66, 97, 99, 107, 41, 0, 51, 57, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 50, 70, 0, 52, 48, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 66, 49, 70, 0, 52, 49, 44, 82, 111, 117, 116, 101, 32, 52, 51, 0, 52, 50, 44, 76, 97, 107, 101, 32, 111, 102, 32, 82, 97, 103, 101, 0, 52, 51, 44, 82, 111, 117, 116, 101, 32, 52, 52, 0, 52, 52, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 49, 70, 0, 52, 53, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 66, 49, 70, 0, 52, 54, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 66, 50, 70, 0, 52, 55, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 66, 51, 70, 0, 52, 56, 44, 66, 108, 97, 99, 107, 116, 104, 111, 114, 110, 32, 67, 105, 116, 121, 0, 52, 57, 44, 68, 114, 97, 103, 111, 110, 226, 128, 153, 115, 32, 68, 101, 110, 0, 53, 48, 44, 82, 111, 117, 116, 101, 32, 52, 53, 0, 53, 49, 44, 82, 111, 117, 116, 101, 32, 52, 54, 0, 53, 50, 44, 68, 97, 114, 107, 32, 67, 97, 118, 101, 32, 40, 82, 111, 117, 116, 101, 32, 51, 49, 41, 0, 53, 51, 44, 68, 97, 114, 107, 32, 67, 97, 118, 101, 32, 40, 82, 111, 117, 116, 101, 32, 52, 53, 41, 0, 53, 52, 44, 82, 111, 117, 116, 101, 32, 52, 55, 0, 53, 53, 44, 77, 116, 46, 32, 77, 111, 111, 110, 0, 53, 54, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 40, 67, 108, 101, 102, 97, 105, 114, 121, 41, 0, 53, 55, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 49, 70, 0, 53, 56, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 49, 70, 0, 53, 57, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 50, 70, 0, 54, 48, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 51, 70, 0, 54, 49, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 52, 70, 0, 54, 50, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 49, 70, 0, 54, 51, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 67, 97, 118, 101, 32, 49, 70, 32, 84, 111, 112, 0, 54, 52, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 52, 70, 0, 54, 53, 44, 67, 108, 105, 102, 102, 32, 69, 100, 103, 101, 32, 71, 97, 116, 101, 0, 54, 54, 44, 67, 108, 105, 102, 102, 32, 67, 97, 118, 101, 0, 54, 55, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 0, 54, 56, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 50, 70, 0, 54, 57, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 67, 97, 118, 101, 32, 77, 111, 117, 110, 116, 97, 105, 110, 115, 105, 100, 101, 0, 55, 48, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 67, 97, 118, 101, 32, 51, 70, 0, 55, 49, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 84, 111, 112, 0, 55, 50, 44, 82, 111, 117, 116, 101, 32, 49, 50, 0, 55, 51, 44, 82, 111, 117, 116, 101, 32, 49, 57, 0, 55, 52, 44, 82, 111, 117, 116, 101, 32, 50, 48, 0, 55, 53, 44, 80, 97, 108, 108, 101, 116, 32, 84, 111, 119, 110, 0, 55, 54, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 67, 105, 116, 121, 0, 55, 55, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 105, 116, 121, 0, 55, 56, 44, 86, 101, 114, 109, 105, 108, 105, 111, 110, 32, 67, 105, 116, 121, 0, 55, 57, 44, 67, 101, 108, 97, 100, 111, 110, 32, 67, 105, 116, 121, 0, 56, 48, 44, 70, 117, 99, 104, 115, 105, 97, 32, 67, 105, 116, 121, 0, 56, 49, 44, 67, 105, 110, 110, 97, 98, 97, 114, 32, 73, 115, 108, 97, 110, 100, 0, 56, 50, 44, 82, 111, 117, 116, 101, 32, 52, 56, 0, 56, 51, 44, 82, 111, 117, 116, 101, 32, 50, 54, 0, 56, 52, 44, 82, 111, 117, 116, 101, 32, 50, 55, 0, 56, 53, 44, 82, 111, 117, 116, 101, 32, 50, 56, 0, 56, 54, 44, 77, 116, 46, 32, 77, 111, 111, 110, 0, 56, 55, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 49, 70, 0, 56, 56, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 50, 70, 0, 56, 57, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 57, 48, 44, 82, 111, 117, 116, 101, 32, 49, 0, 57, 49, 44, 82, 111, 117, 116, 101, 32, 50, 32, 40, 83, 111, 117, 116, 104, 41, 0, 57, 50, 44, 82, 111, 117, 116, 101, 32, 51, 0, 57, 51, 44, 82, 111, 117, 116, 101, 32, 52, 0, 57, 52, 44, 82, 111, 117, 116, 101, 32, 53, 0, 57, 53, 44, 82, 111, 117, 116, 101, 32, 54, 0, 57, 54, 44, 82, 111, 117, 116, 101, 32, 55, 0, 57, 55, 44, 82, 111, 117, 116, 101, 32, 56, 0, 57, 56, 44, 82, 111, 117, 116, 101, 32, 57, 0, 57, 57, 44, 82, 111, 117, 116, 101, 32, 49, 48, 0, 49, 48, 48, 44, 82, 111, 117, 116, 101, 32, 49, 49, 0, 49, 48, 49, 44, 82, 111, 117, 116, 101, 32, 49, 51, 0, 49, 48, 50, 44, 82, 111, 117, 116, 101, 32, 49, 52, 0, 49, 48, 51, 44, 82, 111, 117, 116, 101, 32, 49, 53, 0, 49, 48, 52, 44, 82, 111, 117, 116, 101, 32, 49, 54, 0, 49, 48, 53, 44, 82, 111, 117, 116, 101, 32, 49, 55, 0, 49, 48, 54, 44, 82, 111, 117, 116, 101, 32, 49, 56, 0, 49, 48, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 0, 49, 48, 56, 44, 82, 111, 117, 116, 101, 32, 50, 50, 0, 49, 48, 57, 44, 82, 111, 117, 116, 101, 32, 50, 52, 0, 49, 49, 48, 44, 82, 111, 117, 116, 101, 32, 50, 53, 0, 49, 49, 49, 44, 84, 111, 104, 106, 111, 32, 70, 97, 108, 108, 115, 0, 49, 49, 50, 44, 68, 73, 71, 76, 69, 84, 84, 226, 128, 153, 115, 32, 67, 97, 118, 101, 0, 49, 49, 51, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 50, 70, 0, 49, 49, 52, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 51, 70, 0, 49, 49, 53, 44, 82, 111, 117, 116, 101, 32, 50, 32, 40, 78, 111, 114, 116, 104, 41, 0, 49, 49, 54, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 70, 111, 114, 101, 115, 116, 0, 49, 49, 55, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 49, 70, 0, 49, 49, 56, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 50, 70, 0, 49, 49, 57, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0 };
-
-constexpr std::array<u8, 334> natures_ja = { 227, 129, 140, 227, 130, 147, 227, 129, 176, 227, 130, 138, 227, 130, 132, 0, 227, 129, 149, 227, 129, 191, 227, 129, 151, 227, 129, 140, 227, 130, 138, 0, 227, 130, 134, 227, 129, 134, 227, 129, 139, 227, 130, 147, 0, 227, 129, 132, 227, 129, 152, 227, 129, 163, 227, 129, 177, 227, 130, 138, 0, 227, 130, 132, 227, 130, 147, 227, 129, 161, 227, 130, 131, 0, 227, 129, 154, 227, 129, 182, 227, 129, 168, 227, 129, 132, 0, 227, 129, 153, 227, 129, 170, 227, 129, 138, 0, 227, 129, 174, 227, 130, 147, 227, 129, 141, 0, 227, 130, 143, 227, 130, 147, 227, 129, 177, 227, 129, 143, 0, 227, 129, 174, 227, 129, 134, 227, 129, 166, 227, 130, 147, 227, 129, 141, 0, 227, 129, 138, 227, 129, 143, 227, 129, 179, 227, 130, 135, 227, 129, 134, 0, 227, 129, 155, 227, 129, 163, 227, 129, 139, 227, 129, 161, 0, 227, 129, 190, 227, 129, 152, 227, 130, 129, 0, 227, 130, 136, 227, 129, 134, 227, 129, 141, 0, 227, 130, 128, 227, 129, 152, 227, 130, 131, 227, 129, 141, 0, 227, 129, 178, 227, 129, 139, 227, 129, 136, 227, 130, 129, 0, 227, 129, 138, 227, 129, 163, 227, 129, 168, 227, 130, 138, 0, 227, 130, 140, 227, 129, 132, 227, 129, 155, 227, 129, 132, 0, 227, 129, 166, 227, 130, 140, 227, 130, 132, 0, 227, 129, 134, 227, 129, 163, 227, 129, 139, 227, 130, 138, 227, 130, 132, 0, 227, 129, 138, 227, 129, 160, 227, 130, 132, 227, 129, 139, 0, 227, 129, 138, 227, 129, 168, 227, 129, 170, 227, 129, 151, 227, 129, 132, 0, 227, 129, 170, 227, 129, 190, 227, 129, 132, 227, 129, 141, 0, 227, 129, 151, 227, 130, 147, 227, 129, 161, 227, 130, 135, 227, 129, 134, 0, 227, 129, 141, 227, 129, 190, 227, 129, 144, 227, 130, 140, 0 };
-
-constexpr std::array<u8, 154> powers_ja = { 227, 129, 139, 227, 129, 143, 227, 129, 168, 227, 129, 134, 0, 227, 129, 178, 227, 129, 147, 227, 129, 134, 0, 227, 129, 169, 227, 129, 143, 0, 227, 129, 152, 227, 130, 129, 227, 130, 147, 0, 227, 129, 132, 227, 130, 143, 0, 227, 130, 128, 227, 129, 151, 0, 227, 130, 180, 227, 131, 188, 227, 130, 185, 227, 131, 136, 0, 227, 129, 175, 227, 129, 140, 227, 129, 173, 0, 227, 129, 187, 227, 129, 174, 227, 129, 138, 0, 227, 129, 191, 227, 129, 154, 0, 227, 129, 143, 227, 129, 149, 0, 227, 129, 167, 227, 130, 147, 227, 129, 141, 0, 227, 130, 168, 227, 130, 185, 227, 131, 145, 227, 131, 188, 0, 227, 129, 147, 227, 129, 138, 227, 130, 138, 0, 227, 131, 137, 227, 131, 169, 227, 130, 180, 227, 131, 179, 0, 227, 129, 130, 227, 129, 143, 0 };
-
-constexpr std::array<u8, 1480> rse_ja = { 48, 44, 68, 101, 119, 102, 111, 114, 100, 32, 84, 111, 119, 110, 0, 49, 44, 80, 97, 99, 105, 102, 105, 100, 108, 111, 103, 32, 84, 111, 119, 110, 0, 50, 44, 80, 101, 116, 97, 108, 98, 117, 114, 103, 32, 67, 105, 116, 121, 0, 51, 44, 83, 108, 97, 116, 101, 112, 111, 114, 116, 32, 67, 105, 116, 121, 0, 52, 44, 76, 105, 108, 121, 99, 111, 118, 101, 32, 67, 105, 116, 121, 0, 53, 44, 77, 111, 115, 115, 100, 101, 101, 112, 32, 67, 105, 116, 121, 0, 54, 44, 83, 111, 111, 116, 111, 112, 111, 108, 105, 115, 32, 67, 105, 116, 121, 0, 55, 44, 69, 118, 101, 114, 32, 71, 114, 97, 110, 100, 101, 32, 67, 105, 116, 121, 0, 56, 44, 82, 111, 117, 116, 101, 32, 49, 48, 49, 0, 57, 44, 82, 111, 117, 116, 101, 32, 49, 48, 50, 0, 49, 48, 44, 82, 111, 117, 116, 101, 32, 49, 48, 51, 0, 49, 49, 44, 82, 111, 117, 116, 101, 32, 49, 48, 52, 0, 49, 50, 44, 82, 111, 117, 116, 101, 32, 49, 48, 53, 0, 49, 51, 44, 82, 111, 117, 116, 101, 32, 49, 48, 54, 0, 49, 52, 44, 82, 111, 117, 116, 101, 32, 49, 48, 55, 0, 49, 53, 44, 82, 111, 117, 116, 101, 32, 49, 48, 56, 0, 49, 54, 44, 82, 111, 117, 116, 101, 32, 49, 48, 57, 0, 49, 55, 44, 82, 111, 117, 116, 101, 32, 49, 49, 48, 0, 49, 56, 44, 82, 111, 117, 116, 101, 32, 49, 49, 49, 0, 49, 57, 44, 82, 111, 117, 116, 101, 32, 49, 49, 50, 0, 50, 48, 44, 82, 111, 117, 116, 101, 32, 49, 49, 51, 0, 50, 49, 44, 82, 111, 117, 116, 101, 32, 49, 49, 52, 0, 50, 50, 44, 82, 111, 117, 116, 101, 32, 49, 49, 53, 0, 50, 51, 44, 82, 111, 117, 116, 101, 32, 49, 49, 54, 0, 50, 52, 44, 82, 111, 117, 116, 101, 32, 49, 49, 55, 0, 50, 53, 44, 82, 111, 117, 116, 101, 32, 49, 49, 56, 0, 50, 54, 44, 82, 111, 117, 116, 101, 32, 49, 49, 57, 0, 50, 55, 44, 82, 111, 117, 116, 101, 32, 49, 50, 48, 0, 50, 56, 44, 82, 111, 117, 116, 101, 32, 49, 50, 49, 0, 50, 57, 44, 82, 111, 117, 116, 101, 32, 49, 50, 50, 0, 51, 48, 44, 82, 111, 117, 116, 101, 32, 49, 50, 51, 0, 51, 49, 44, 82, 111, 117, 116, 101, 32, 49, 50, 52, 0, 51, 50, 44, 82, 111, 117, 116, 101, 32, 49, 50, 53, 0, 51, 51, 44, 82, 111, 117, 116, 101, 32, 49, 50, 54, 0, 51, 52, 44, 82, 111, 117, 116, 101, 32, 49, 50, 55, 0, 51, 53, 44, 82, 111, 117, 116, 101, 32, 49, 50, 56, 0, 51, 54, 44, 82, 111, 117, 116, 101, 32, 49, 50, 57, 0, 51, 55, 44, 82, 111, 117, 116, 101, 32, 49, 51, 48, 0, 51, 56, 44, 82, 111, 117, 116, 101, 32, 49, 51, 49, 0, 51, 57, 44, 82, 111, 117, 116, 101, 32, 49, 51, 50, 0, 52, 48, 44, 82, 111, 117, 116, 101, 32, 49, 51, 51, 0, 52, 49, 44, 82, 111, 117, 116, 101, 32, 49, 51, 52, 0, 52, 50, 44, 85, 110, 100, 101, 114, 119, 97, 116, 101, 114, 32, 40, 82, 111, 117, 116, 101, 32, 49, 50, 52, 41, 0, 52, 51, 44, 85, 110, 100, 101, 114, 119, 97, 116, 101, 114, 32, 40, 82, 111, 117, 116, 101, 32, 49, 50, 54, 41, 0, 52, 52, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 49, 70, 0, 52, 53, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 83, 116, 101, 118, 101, 110, 39, 115, 32, 82, 111, 111, 109, 0, 52, 54, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 52, 55, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 66, 50, 70, 0, 52, 56, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 49, 0, 52, 57, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 50, 0, 53, 48, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 51, 0, 53, 49, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 52, 0, 53, 50, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 53, 0, 53, 51, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 54, 0, 53, 52, 44, 80, 101, 116, 97, 108, 98, 117, 114, 103, 32, 87, 111, 111, 100, 115, 0, 53, 53, 44, 82, 117, 115, 116, 117, 114, 102, 32, 84, 117, 110, 110, 101, 108, 0, 53, 54, 44, 65, 98, 97, 110, 100, 111, 110, 101, 100, 32, 83, 104, 105, 112, 0, 53, 55, 44, 78, 101, 119, 32, 77, 97, 117, 118, 105, 108, 108, 101, 32, 40, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 53, 56, 44, 78, 101, 119, 32, 77, 97, 117, 118, 105, 108, 108, 101, 32, 40, 66, 97, 115, 101, 109, 101, 110, 116, 41, 0, 53, 57, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 49, 70, 32, 49, 82, 0, 54, 48, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 49, 70, 32, 50, 82, 0, 54, 49, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 66, 49, 70, 32, 49, 82, 0, 54, 50, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 66, 49, 70, 32, 50, 82, 0, 54, 51, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 83, 116, 101, 118, 101, 110, 39, 115, 32, 67, 97, 118, 101, 0, 54, 52, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 49, 70, 45, 51, 70, 0, 54, 53, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 52, 70, 45, 54, 70, 0, 54, 54, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 69, 120, 116, 101, 114, 105, 111, 114, 0, 54, 55, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 83, 117, 109, 109, 105, 116, 0, 54, 56, 44, 83, 104, 111, 97, 108, 32, 67, 97, 118, 101, 0, 54, 57, 44, 83, 104, 111, 97, 108, 32, 67, 97, 118, 101, 32, 73, 99, 101, 32, 82, 111, 111, 109, 0, 55, 48, 44, 83, 101, 97, 102, 108, 111, 111, 114, 32, 67, 97, 118, 101, 114, 110, 0, 55, 49, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 55, 50, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 49, 70, 0, 55, 51, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 50, 70, 0, 55, 52, 44, 67, 97, 118, 101, 32, 111, 102, 32, 79, 114, 105, 103, 105, 110, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 55, 53, 44, 67, 97, 118, 101, 32, 111, 102, 32, 79, 114, 105, 103, 105, 110, 0, 55, 54, 44, 70, 105, 101, 114, 121, 32, 80, 97, 116, 104, 0, 55, 55, 44, 74, 97, 103, 103, 101, 100, 32, 80, 97, 115, 115, 0, 55, 56, 44, 83, 107, 121, 32, 80, 105, 108, 108, 97, 114, 32, 49, 70, 0, 55, 57, 44, 83, 107, 121, 32, 80, 105, 108, 108, 97, 114, 32, 51, 70, 0, 56, 48, 44, 83, 107, 121, 32, 80, 105, 108, 108, 97, 114, 32, 53, 70, 0, 56, 49, 44, 77, 97, 103, 109, 97, 32, 72, 105, 100, 101, 111, 117, 116, 0, 56, 50, 44, 77, 105, 114, 97, 103, 101, 32, 84, 111, 119, 101, 114, 0, 56, 51, 44, 65, 114, 116, 105, 115, 97, 110, 32, 67, 97, 118, 101, 0, 56, 52, 44, 68, 101, 115, 101, 114, 116, 32, 85, 110, 100, 101, 114, 112, 97, 115, 115, 0, 56, 53, 44, 65, 108, 116, 101, 114, 105, 110, 103, 32, 67, 97, 118, 101, 0 };
-
-constexpr std::array<u8, 11919> species_ja = { 239, 187, 191, 227, 131, 149, 227, 130, 183, 227, 130, 174, 227, 131, 128, 227, 131, 141, 0, 227, 131, 149, 227, 130, 183, 227, 130, 174, 227, 130, 189, 227, 130, 166, 0, 227, 131, 149, 227, 130, 183, 227, 130, 174, 227, 131, 144, 227, 131, 138, 0, 227, 131, 146, 227, 131, 136, 227, 130, 171, 227, 130, 178, 0, 227, 131, 170, 227, 130, 182, 227, 131, 188, 227, 131, 137, 0, 227, 131, 170, 227, 130, 182, 227, 131, 188, 227, 131, 137, 227, 131, 179, 0, 227, 130, 188, 227, 131, 139, 227, 130, 172, 227, 131, 161, 0, 227, 130, 171, 227, 131, 161, 227, 131, 188, 227, 131, 171, 0, 227, 130, 171, 227, 131, 161, 227, 131, 131, 227, 130, 175, 227, 130, 185, 0, 227, 130, 173, 227, 131, 163, 227, 130, 191, 227, 131, 148, 227, 131, 188, 0, 227, 131, 136, 227, 131, 169, 227, 131, 179, 227, 130, 187, 227, 131, 171, 0, 227, 131, 144, 227, 130, 191, 227, 131, 149, 227, 131, 170, 227, 131, 188, 0, 227, 131, 147, 227, 131, 188, 227, 131, 137, 227, 131, 171, 0, 227, 130, 179, 227, 130, 175, 227, 131, 188, 227, 131, 179, 0, 227, 130, 185, 227, 131, 148, 227, 130, 162, 227, 131, 188, 0, 227, 131, 157, 227, 131, 131, 227, 131, 157, 0, 227, 131, 148, 227, 130, 184, 227, 131, 167, 227, 131, 179, 0, 227, 131, 148, 227, 130, 184, 227, 131, 167, 227, 131, 131, 227, 131, 136, 0, 227, 130, 179, 227, 131, 169, 227, 131, 131, 227, 130, 191, 0, 227, 131, 169, 227, 131, 131, 227, 130, 191, 0, 227, 130, 170, 227, 131, 139, 227, 130, 185, 227, 130, 186, 227, 131, 161, 0, 227, 130, 170, 227, 131, 139, 227, 131, 137, 227, 131, 170, 227, 131, 171, 0, 227, 130, 162, 227, 131, 188, 227, 131, 156, 0, 227, 130, 162, 227, 131, 188, 227, 131, 156, 227, 131, 131, 227, 130, 175, 0, 227, 131, 148, 227, 130, 171, 227, 131, 129, 227, 131, 165, 227, 130, 166, 0, 227, 131, 169, 227, 130, 164, 227, 131, 129, 227, 131, 165, 227, 130, 166, 0, 227, 130, 181, 227, 131, 179, 227, 131, 137, 0, 227, 130, 181, 227, 131, 179, 227, 131, 137, 227, 131, 145, 227, 131, 179, 0, 227, 131, 139, 227, 131, 137, 227, 131, 169, 227, 131, 179, 226, 153, 128, 0, 227, 131, 139, 227, 131, 137, 227, 131, 170, 227, 131, 188, 227, 131, 138, 0, 227, 131, 139, 227, 131, 137, 227, 130, 175, 227, 130, 164, 227, 131, 179, 0, 227, 131, 139, 227, 131, 137, 227, 131, 169, 227, 131, 179, 226, 153, 130, 0, 227, 131, 139, 227, 131, 137, 227, 131, 170, 227, 131, 188, 227, 131, 142, 0, 227, 131, 139, 227, 131, 137, 227, 130, 173, 227, 131, 179, 227, 130, 176, 0, 227, 131, 148, 227, 131, 131, 227, 131, 148, 0, 227, 131, 148, 227, 130, 175, 227, 130, 183, 227, 131, 188, 0, 227, 131, 173, 227, 130, 179, 227, 131, 179, 0, 227, 130, 173, 227, 131, 165, 227, 130, 166, 227, 130, 179, 227, 131, 179, 0, 227, 131, 151, 227, 131, 170, 227, 131, 179, 0, 227, 131, 151, 227, 130, 175, 227, 131, 170, 227, 131, 179, 0, 227, 130, 186, 227, 131, 144, 227, 131, 131, 227, 131, 136, 0, 227, 130, 180, 227, 131, 171, 227, 131, 144, 227, 131, 131, 227, 131, 136, 0, 227, 131, 138, 227, 130, 190, 227, 131, 142, 227, 130, 175, 227, 130, 181, 0, 227, 130, 175, 227, 130, 181, 227, 130, 164, 227, 131, 143, 227, 131, 138, 0, 227, 131, 169, 227, 131, 149, 227, 131, 172, 227, 130, 183, 227, 130, 162, 0, 227, 131, 145, 227, 131, 169, 227, 130, 185, 0, 227, 131, 145, 227, 131, 169, 227, 130, 187, 227, 130, 175, 227, 131, 136, 0, 227, 130, 179, 227, 131, 179, 227, 131, 145, 227, 131, 179, 0, 227, 131, 162, 227, 131, 171, 227, 131, 149, 227, 130, 169, 227, 131, 179, 0, 227, 131, 135, 227, 130, 163, 227, 130, 176, 227, 131, 128, 0, 227, 131, 128, 227, 130, 176, 227, 131, 136, 227, 131, 170, 227, 130, 170, 0, 227, 131, 139, 227, 131, 163, 227, 131, 188, 227, 130, 185, 0, 227, 131, 154, 227, 131, 171, 227, 130, 183, 227, 130, 162, 227, 131, 179, 0, 227, 130, 179, 227, 131, 128, 227, 131, 131, 227, 130, 175, 0, 227, 130, 180, 227, 131, 171, 227, 131, 128, 227, 131, 131, 227, 130, 175, 0, 227, 131, 158, 227, 131, 179, 227, 130, 173, 227, 131, 188, 0, 227, 130, 170, 227, 130, 179, 227, 131, 170, 227, 130, 182, 227, 131, 171, 0, 227, 130, 172, 227, 131, 188, 227, 131, 135, 227, 130, 163, 0, 227, 130, 166, 227, 130, 164, 227, 131, 179, 227, 131, 135, 227, 130, 163, 0, 227, 131, 139, 227, 131, 167, 227, 131, 173, 227, 131, 162, 0, 227, 131, 139, 227, 131, 167, 227, 131, 173, 227, 130, 190, 0, 227, 131, 139, 227, 131, 167, 227, 131, 173, 227, 131, 156, 227, 131, 179, 0, 227, 130, 177, 227, 131, 188, 227, 130, 183, 227, 130, 163, 0, 227, 131, 166, 227, 131, 179, 227, 130, 178, 227, 131, 169, 227, 131, 188, 0, 227, 131, 149, 227, 131, 188, 227, 131, 135, 227, 130, 163, 227, 131, 179, 0, 227, 131, 175, 227, 131, 179, 227, 131, 170, 227, 130, 173, 227, 131, 188, 0, 227, 130, 180, 227, 131, 188, 227, 131, 170, 227, 130, 173, 227, 131, 188, 0, 227, 130, 171, 227, 130, 164, 227, 131, 170, 227, 130, 173, 227, 131, 188, 0, 227, 131, 158, 227, 131, 128, 227, 131, 132, 227, 131, 156, 227, 131, 159, 0, 227, 130, 166, 227, 131, 132, 227, 131, 137, 227, 131, 179, 0, 227, 130, 166, 227, 131, 132, 227, 131, 156, 227, 131, 131, 227, 131, 136, 0, 227, 131, 161, 227, 131, 142, 227, 130, 175, 227, 131, 169, 227, 130, 178, 0, 227, 131, 137, 227, 130, 175, 227, 130, 175, 227, 131, 169, 227, 130, 178, 0, 227, 130, 164, 227, 130, 183, 227, 131, 132, 227, 131, 150, 227, 131, 134, 0, 227, 130, 180, 227, 131, 173, 227, 131, 188, 227, 131, 179, 0, 227, 130, 180, 227, 131, 173, 227, 131, 188, 227, 131, 139, 227, 131, 163, 0, 227, 131, 157, 227, 131, 139, 227, 131, 188, 227, 130, 191, 0, 227, 130, 174, 227, 131, 163, 227, 131, 173, 227, 131, 131, 227, 131, 151, 0, 227, 131, 164, 227, 131, 137, 227, 131, 179, 0, 227, 131, 164, 227, 131, 137, 227, 131, 169, 227, 131, 179, 0, 227, 130, 179, 227, 130, 164, 227, 131, 171, 0, 227, 131, 172, 227, 130, 162, 227, 130, 179, 227, 130, 164, 227, 131, 171, 0, 227, 130, 171, 227, 131, 162, 227, 131, 141, 227, 130, 174, 0, 227, 131, 137, 227, 131, 188, 227, 131, 137, 227, 131, 188, 0, 227, 131, 137, 227, 131, 188, 227, 131, 137, 227, 131, 170, 227, 130, 170, 0, 227, 131, 145, 227, 130, 166, 227, 131, 175, 227, 130, 166, 0, 227, 130, 184, 227, 131, 165, 227, 130, 180, 227, 131, 179, 0, 227, 131, 153, 227, 131, 136, 227, 131, 153, 227, 130, 191, 227, 131, 188, 0, 227, 131, 153, 227, 131, 136, 227, 131, 153, 227, 131, 136, 227, 131, 179, 0, 227, 130, 183, 227, 130, 167, 227, 131, 171, 227, 131, 128, 227, 131, 188, 0, 227, 131, 145, 227, 131, 171, 227, 130, 183, 227, 130, 167, 227, 131, 179, 0, 227, 130, 180, 227, 131, 188, 227, 130, 185, 0, 227, 130, 180, 227, 131, 188, 227, 130, 185, 227, 131, 136, 0, 227, 130, 178, 227, 131, 179, 227, 130, 172, 227, 131, 188, 0, 227, 130, 164, 227, 131, 175, 227, 131, 188, 227, 130, 175, 0, 227, 130, 185, 227, 131, 170, 227, 131, 188, 227, 131, 151, 0, 227, 130, 185, 227, 131, 170, 227, 131, 188, 227, 131, 145, 227, 131, 188, 0, 227, 130, 175, 227, 131, 169, 227, 131, 150, 0, 227, 130, 173, 227, 131, 179, 227, 130, 176, 227, 131, 169, 227, 131, 188, 0, 227, 131, 147, 227, 131, 170, 227, 131, 170, 227, 131, 128, 227, 131, 158, 0, 227, 131, 158, 227, 131, 171, 227, 131, 158, 227, 130, 164, 227, 131, 179, 0, 227, 130, 191, 227, 131, 158, 227, 130, 191, 227, 131, 158, 0, 227, 131, 138, 227, 131, 131, 227, 130, 183, 227, 131, 188, 0, 227, 130, 171, 227, 131, 169, 227, 130, 171, 227, 131, 169, 0, 227, 130, 172, 227, 131, 169, 227, 130, 172, 227, 131, 169, 0, 227, 130, 181, 227, 131, 175, 227, 131, 160, 227, 131, 169, 227, 131, 188, 0, 227, 130, 168, 227, 131, 147, 227, 131, 175, 227, 131, 169, 227, 131, 188, 0, 227, 131, 153, 227, 131, 173, 227, 131, 170, 227, 131, 179, 227, 130, 172, 0, 227, 131, 137, 227, 130, 172, 227, 131, 188, 227, 130, 185, 0, 227, 131, 158, 227, 130, 191, 227, 131, 137, 227, 130, 172, 227, 130, 185, 0, 227, 130, 181, 227, 130, 164, 227, 131, 155, 227, 131, 188, 227, 131, 179, 0, 227, 130, 181, 227, 130, 164, 227, 131, 137, 227, 131, 179, 0, 227, 131, 169, 227, 131, 131, 227, 130, 173, 227, 131, 188, 0, 227, 131, 162, 227, 131, 179, 227, 130, 184, 227, 131, 163, 227, 131, 169, 0, 227, 130, 172, 227, 131, 171, 227, 131, 188, 227, 131, 169, 0, 227, 130, 191, 227, 131, 131, 227, 131, 132, 227, 131, 188, 0, 227, 130, 183, 227, 131, 188, 227, 131, 137, 227, 131, 169, 0, 227, 131, 136, 227, 130, 181, 227, 130, 173, 227, 131, 179, 227, 131, 136, 0, 227, 130, 162, 227, 130, 186, 227, 131, 158, 227, 130, 170, 227, 130, 166, 0, 227, 131, 146, 227, 131, 136, 227, 131, 135, 227, 131, 158, 227, 131, 179, 0, 227, 130, 185, 227, 130, 191, 227, 131, 188, 227, 131, 159, 227, 131, 188, 0, 227, 131, 144, 227, 131, 170, 227, 131, 164, 227, 131, 188, 227, 131, 137, 0, 227, 130, 185, 227, 131, 136, 227, 131, 169, 227, 130, 164, 227, 130, 175, 0, 227, 131, 171, 227, 131, 188, 227, 130, 184, 227, 131, 165, 227, 131, 169, 0, 227, 130, 168, 227, 131, 172, 227, 131, 150, 227, 131, 188, 0, 227, 131, 150, 227, 131, 188, 227, 131, 144, 227, 131, 188, 0, 227, 130, 171, 227, 130, 164, 227, 131, 173, 227, 130, 185, 0, 227, 130, 177, 227, 131, 179, 227, 130, 191, 227, 131, 173, 227, 130, 185, 0, 227, 130, 179, 227, 130, 164, 227, 130, 173, 227, 131, 179, 227, 130, 176, 0, 227, 130, 174, 227, 131, 163, 227, 131, 169, 227, 131, 137, 227, 130, 185, 0, 227, 131, 169, 227, 131, 151, 227, 131, 169, 227, 130, 185, 0, 227, 131, 161, 227, 130, 191, 227, 131, 162, 227, 131, 179, 0, 227, 130, 164, 227, 131, 188, 227, 131, 150, 227, 130, 164, 0, 227, 130, 183, 227, 131, 163, 227, 131, 175, 227, 131, 188, 227, 130, 186, 0, 227, 130, 181, 227, 131, 179, 227, 131, 128, 227, 131, 188, 227, 130, 185, 0, 227, 131, 150, 227, 131, 188, 227, 130, 185, 227, 130, 191, 227, 131, 188, 0, 227, 131, 157, 227, 131, 170, 227, 130, 180, 227, 131, 179, 0, 227, 130, 170, 227, 131, 160, 227, 131, 138, 227, 130, 164, 227, 131, 136, 0, 227, 130, 170, 227, 131, 160, 227, 130, 185, 227, 130, 191, 227, 131, 188, 0, 227, 130, 171, 227, 131, 150, 227, 131, 136, 0, 227, 130, 171, 227, 131, 150, 227, 131, 136, 227, 131, 151, 227, 130, 185, 0, 227, 131, 151, 227, 131, 134, 227, 131, 169, 0, 227, 130, 171, 227, 131, 147, 227, 130, 180, 227, 131, 179, 0, 227, 131, 149, 227, 131, 170, 227, 131, 188, 227, 130, 182, 227, 131, 188, 0, 227, 130, 181, 227, 131, 179, 227, 131, 128, 227, 131, 188, 0, 227, 131, 149, 227, 130, 161, 227, 130, 164, 227, 131, 164, 227, 131, 188, 0, 227, 131, 159, 227, 131, 139, 227, 131, 170, 227, 131, 165, 227, 130, 166, 0, 227, 131, 143, 227, 130, 175, 227, 131, 170, 227, 131, 165, 227, 131, 188, 0, 227, 130, 171, 227, 130, 164, 227, 131, 170, 227, 131, 165, 227, 131, 188, 0, 227, 131, 159, 227, 131, 165, 227, 130, 166, 227, 131, 132, 227, 131, 188, 0, 227, 131, 159, 227, 131, 165, 227, 130, 166, 0, 227, 131, 129, 227, 130, 179, 227, 131, 170, 227, 131, 188, 227, 130, 191, 0, 227, 131, 153, 227, 130, 164, 227, 131, 170, 227, 131, 188, 227, 131, 149, 0, 227, 131, 161, 227, 130, 172, 227, 131, 139, 227, 130, 166, 227, 131, 160, 0, 227, 131, 146, 227, 131, 142, 227, 130, 162, 227, 131, 169, 227, 130, 183, 0, 227, 131, 158, 227, 130, 176, 227, 131, 158, 227, 131, 169, 227, 130, 183, 0, 227, 131, 144, 227, 130, 175, 227, 131, 149, 227, 131, 188, 227, 131, 179, 0, 227, 131, 175, 227, 131, 139, 227, 131, 142, 227, 130, 179, 0, 227, 130, 162, 227, 131, 170, 227, 130, 178, 227, 130, 164, 227, 131, 132, 0, 227, 130, 170, 227, 131, 188, 227, 131, 128, 227, 130, 164, 227, 131, 171, 0, 227, 130, 170, 227, 130, 191, 227, 131, 129, 0, 227, 130, 170, 227, 130, 170, 227, 130, 191, 227, 131, 129, 0, 227, 131, 155, 227, 131, 188, 227, 131, 155, 227, 131, 188, 0, 227, 131, 168, 227, 131, 171, 227, 131, 142, 227, 130, 186, 227, 130, 175, 0, 227, 131, 172, 227, 131, 135, 227, 130, 163, 227, 131, 144, 0, 227, 131, 172, 227, 131, 135, 227, 130, 163, 227, 130, 162, 227, 131, 179, 0, 227, 130, 164, 227, 131, 136, 227, 131, 158, 227, 131, 171, 0, 227, 130, 162, 227, 131, 170, 227, 130, 162, 227, 131, 137, 227, 130, 185, 0, 227, 130, 175, 227, 131, 173, 227, 131, 144, 227, 131, 131, 227, 131, 136, 0, 227, 131, 129, 227, 131, 167, 227, 131, 179, 227, 131, 129, 227, 131, 188, 0, 227, 131, 169, 227, 131, 179, 227, 130, 191, 227, 131, 188, 227, 131, 179, 0, 227, 131, 148, 227, 131, 129, 227, 131, 165, 227, 131, 188, 0, 227, 131, 148, 227, 130, 163, 0, 227, 131, 151, 227, 131, 151, 227, 131, 170, 227, 131, 179, 0, 227, 131, 136, 227, 130, 178, 227, 131, 148, 227, 131, 188, 0, 227, 131, 136, 227, 130, 178, 227, 131, 129, 227, 131, 131, 227, 130, 175, 0, 227, 131, 141, 227, 130, 164, 227, 131, 134, 227, 130, 163, 0, 227, 131, 141, 227, 130, 164, 227, 131, 134, 227, 130, 163, 227, 130, 170, 0, 227, 131, 161, 227, 131, 170, 227, 131, 188, 227, 131, 151, 0, 227, 131, 162, 227, 130, 179, 227, 130, 179, 0, 227, 131, 135, 227, 131, 179, 227, 131, 170, 227, 131, 165, 227, 130, 166, 0, 227, 130, 173, 227, 131, 172, 227, 130, 164, 227, 131, 143, 227, 131, 138, 0, 227, 131, 158, 227, 131, 170, 227, 131, 171, 0, 227, 131, 158, 227, 131, 170, 227, 131, 171, 227, 131, 170, 0, 227, 130, 166, 227, 130, 189, 227, 131, 131, 227, 130, 173, 227, 131, 188, 0, 227, 131, 139, 227, 131, 167, 227, 131, 173, 227, 131, 136, 227, 131, 142, 0, 227, 131, 143, 227, 131, 141, 227, 131, 131, 227, 130, 179, 0, 227, 131, 157, 227, 131, 157, 227, 131, 131, 227, 130, 179, 0, 227, 131, 175, 227, 130, 191, 227, 131, 131, 227, 130, 179, 0, 227, 130, 168, 227, 130, 164, 227, 131, 145, 227, 131, 160, 0, 227, 131, 146, 227, 131, 158, 227, 131, 138, 227, 131, 131, 227, 131, 132, 0, 227, 130, 173, 227, 131, 158, 227, 131, 175, 227, 131, 170, 0, 227, 131, 164, 227, 131, 179, 227, 131, 164, 227, 131, 179, 227, 131, 158, 0, 227, 130, 166, 227, 131, 145, 227, 131, 188, 0, 227, 131, 140, 227, 130, 170, 227, 131, 188, 0, 227, 130, 168, 227, 131, 188, 227, 131, 149, 227, 130, 163, 0, 227, 131, 150, 227, 131, 169, 227, 131, 131, 227, 130, 173, 227, 131, 188, 0, 227, 131, 164, 227, 131, 159, 227, 130, 171, 227, 131, 169, 227, 130, 185, 0, 227, 131, 164, 227, 131, 137, 227, 130, 173, 227, 131, 179, 227, 130, 176, 0, 227, 131, 160, 227, 130, 166, 227, 131, 158, 0, 227, 130, 162, 227, 131, 179, 227, 131, 142, 227, 131, 188, 227, 131, 179, 0, 227, 130, 189, 227, 131, 188, 227, 131, 138, 227, 131, 179, 227, 130, 185, 0, 227, 130, 173, 227, 131, 170, 227, 131, 179, 227, 131, 170, 227, 130, 173, 0, 227, 130, 175, 227, 131, 140, 227, 130, 174, 227, 131, 128, 227, 131, 158, 0, 227, 131, 149, 227, 130, 169, 227, 131, 172, 227, 131, 136, 227, 130, 185, 0, 227, 131, 142, 227, 130, 179, 227, 131, 131, 227, 131, 129, 0, 227, 130, 176, 227, 131, 169, 227, 130, 164, 227, 130, 172, 227, 131, 188, 0, 227, 131, 143, 227, 130, 172, 227, 131, 141, 227, 131, 188, 227, 131, 171, 0, 227, 131, 150, 227, 131, 171, 227, 131, 188, 0, 227, 130, 176, 227, 131, 169, 227, 131, 179, 227, 131, 150, 227, 131, 171, 0, 227, 131, 143, 227, 131, 170, 227, 131, 188, 227, 130, 187, 227, 131, 179, 0, 227, 131, 143, 227, 131, 131, 227, 130, 181, 227, 131, 160, 0, 227, 131, 132, 227, 131, 156, 227, 131, 132, 227, 131, 156, 0, 227, 131, 152, 227, 131, 169, 227, 130, 175, 227, 131, 173, 227, 130, 185, 0, 227, 131, 139, 227, 131, 165, 227, 131, 188, 227, 131, 169, 0, 227, 131, 146, 227, 131, 161, 227, 130, 176, 227, 131, 158, 0, 227, 131, 170, 227, 131, 179, 227, 130, 176, 227, 131, 158, 0, 227, 131, 158, 227, 130, 176, 227, 131, 158, 227, 131, 131, 227, 130, 176, 0, 227, 131, 158, 227, 130, 176, 227, 130, 171, 227, 131, 171, 227, 130, 180, 0, 227, 130, 166, 227, 131, 170, 227, 131, 160, 227, 131, 188, 0, 227, 130, 164, 227, 131, 142, 227, 131, 160, 227, 131, 188, 0, 227, 130, 181, 227, 131, 139, 227, 131, 188, 227, 130, 180, 0, 227, 131, 134, 227, 131, 131, 227, 131, 157, 227, 130, 166, 227, 130, 170, 0, 227, 130, 170, 227, 130, 175, 227, 130, 191, 227, 131, 179, 0, 227, 131, 135, 227, 131, 170, 227, 131, 144, 227, 131, 188, 227, 131, 137, 0, 227, 131, 158, 227, 131, 179, 227, 130, 191, 227, 130, 164, 227, 131, 179, 0, 227, 130, 168, 227, 130, 162, 227, 131, 188, 227, 131, 160, 227, 131, 137, 0, 227, 131, 135, 227, 131, 171, 227, 131, 147, 227, 131, 171, 0, 227, 131, 152, 227, 131, 171, 227, 130, 172, 227, 131, 188, 0, 227, 130, 173, 227, 131, 179, 227, 130, 176, 227, 131, 137, 227, 131, 169, 0, 227, 130, 180, 227, 131, 158, 227, 130, 190, 227, 130, 166, 0, 227, 131, 137, 227, 131, 179, 227, 131, 149, 227, 130, 161, 227, 131, 179, 0, 227, 131, 157, 227, 131, 170, 227, 130, 180, 227, 131, 179, 239, 188, 146, 0, 227, 130, 170, 227, 131, 137, 227, 130, 183, 227, 130, 183, 0, 227, 131, 137, 227, 131, 188, 227, 131, 150, 227, 131, 171, 0, 227, 131, 144, 227, 131, 171, 227, 130, 173, 227, 131, 188, 0, 227, 130, 171, 227, 131, 157, 227, 130, 168, 227, 131, 169, 227, 131, 188, 0, 227, 131, 160, 227, 131, 129, 227, 131, 165, 227, 131, 188, 227, 131, 171, 0, 227, 130, 168, 227, 131, 172, 227, 130, 173, 227, 131, 131, 227, 131, 137, 0, 227, 131, 150, 227, 131, 147, 227, 130, 163, 0, 227, 131, 159, 227, 131, 171, 227, 130, 191, 227, 131, 179, 227, 130, 175, 0, 227, 131, 143, 227, 131, 148, 227, 131, 138, 227, 130, 185, 0, 227, 131, 169, 227, 130, 164, 227, 130, 179, 227, 130, 166, 0, 227, 130, 168, 227, 131, 179, 227, 131, 134, 227, 130, 164, 0, 227, 130, 185, 227, 130, 164, 227, 130, 175, 227, 131, 179, 0, 227, 131, 168, 227, 131, 188, 227, 130, 174, 227, 131, 169, 227, 130, 185, 0, 227, 130, 181, 227, 131, 138, 227, 130, 174, 227, 131, 169, 227, 130, 185, 0, 227, 131, 144, 227, 131, 179, 227, 130, 174, 227, 131, 169, 227, 130, 185, 0, 227, 131, 171, 227, 130, 174, 227, 130, 162, 0, 227, 131, 155, 227, 130, 166, 227, 130, 170, 227, 130, 166, 0, 227, 130, 187, 227, 131, 172, 227, 131, 147, 227, 130, 163, 0, 227, 130, 173, 227, 131, 162, 227, 131, 170, 0, 227, 130, 184, 227, 131, 165, 227, 131, 151, 227, 131, 136, 227, 131, 171, 0, 227, 130, 184, 227, 131, 165, 227, 130, 171, 227, 130, 164, 227, 131, 179, 0, 227, 130, 162, 227, 131, 129, 227, 131, 163, 227, 131, 162, 0, 227, 131, 175, 227, 130, 171, 227, 130, 183, 227, 131, 163, 227, 131, 162, 0, 227, 131, 144, 227, 130, 183, 227, 131, 163, 227, 131, 188, 227, 131, 162, 0, 227, 131, 159, 227, 130, 186, 227, 130, 180, 227, 131, 173, 227, 130, 166, 0, 227, 131, 140, 227, 131, 158, 227, 130, 175, 227, 131, 173, 227, 131, 188, 0, 227, 131, 169, 227, 130, 176, 227, 131, 169, 227, 131, 188, 227, 130, 184, 0, 227, 131, 157, 227, 131, 129, 227, 130, 168, 227, 131, 138, 0, 227, 130, 176, 227, 131, 169, 227, 130, 168, 227, 131, 138, 0, 227, 130, 184, 227, 130, 176, 227, 130, 182, 227, 130, 176, 227, 131, 158, 0, 227, 131, 158, 227, 131, 131, 227, 130, 185, 227, 130, 176, 227, 131, 158, 0, 227, 130, 177, 227, 131, 160, 227, 131, 131, 227, 130, 189, 0, 227, 130, 171, 227, 131, 169, 227, 130, 181, 227, 131, 170, 227, 130, 185, 0, 227, 130, 162, 227, 130, 178, 227, 131, 143, 227, 131, 179, 227, 131, 136, 0, 227, 131, 158, 227, 131, 166, 227, 131, 171, 227, 131, 137, 0, 227, 131, 137, 227, 130, 175, 227, 130, 177, 227, 130, 164, 227, 131, 171, 0, 227, 131, 143, 227, 130, 185, 227, 131, 156, 227, 131, 188, 0, 227, 131, 143, 227, 130, 185, 227, 131, 150, 227, 131, 172, 227, 131, 173, 0, 227, 131, 171, 227, 131, 179, 227, 131, 145, 227, 131, 131, 227, 131, 145, 0, 227, 130, 191, 227, 131, 141, 227, 131, 156, 227, 131, 188, 0, 227, 130, 179, 227, 131, 142, 227, 131, 143, 227, 131, 138, 0, 227, 131, 128, 227, 131, 188, 227, 131, 134, 227, 131, 179, 227, 130, 176, 0, 227, 130, 185, 227, 131, 144, 227, 131, 161, 0, 227, 130, 170, 227, 130, 170, 227, 130, 185, 227, 131, 144, 227, 131, 161, 0, 227, 130, 173, 227, 131, 163, 227, 131, 162, 227, 131, 161, 0, 227, 131, 154, 227, 131, 170, 227, 131, 131, 227, 131, 145, 227, 131, 188, 0, 227, 131, 169, 227, 131, 171, 227, 131, 136, 227, 130, 185, 0, 227, 130, 173, 227, 131, 171, 227, 131, 170, 227, 130, 162, 0, 227, 130, 181, 227, 131, 188, 227, 131, 138, 227, 130, 164, 227, 131, 136, 0, 227, 130, 162, 227, 131, 161, 227, 130, 191, 227, 131, 158, 0, 227, 130, 162, 227, 131, 161, 227, 131, 162, 227, 131, 188, 227, 130, 185, 0, 227, 130, 173, 227, 131, 142, 227, 130, 179, 227, 130, 179, 0, 227, 130, 173, 227, 131, 142, 227, 130, 172, 227, 131, 131, 227, 130, 181, 0, 227, 131, 138, 227, 131, 158, 227, 130, 177, 227, 131, 173, 0, 227, 131, 164, 227, 131, 171, 227, 130, 173, 227, 131, 162, 227, 131, 142, 0, 227, 130, 177, 227, 131, 131, 227, 130, 173, 227, 131, 179, 227, 130, 176, 0, 227, 131, 132, 227, 131, 129, 227, 131, 139, 227, 131, 179, 0, 227, 131, 134, 227, 131, 131, 227, 130, 171, 227, 131, 139, 227, 131, 179, 0, 227, 131, 140, 227, 130, 177, 227, 131, 139, 227, 131, 179, 0, 227, 130, 180, 227, 131, 139, 227, 131, 167, 227, 131, 139, 227, 131, 167, 0, 227, 131, 137, 227, 130, 180, 227, 131, 188, 227, 131, 160, 0, 227, 131, 144, 227, 130, 175, 227, 130, 170, 227, 131, 179, 227, 130, 176, 0, 227, 131, 158, 227, 130, 175, 227, 131, 142, 227, 130, 183, 227, 130, 191, 0, 227, 131, 143, 227, 131, 170, 227, 131, 134, 227, 131, 164, 227, 131, 158, 0, 227, 131, 171, 227, 131, 170, 227, 131, 170, 0, 227, 131, 142, 227, 130, 186, 227, 131, 145, 227, 130, 185, 0, 227, 130, 168, 227, 131, 141, 227, 130, 179, 0, 227, 130, 168, 227, 131, 141, 227, 130, 179, 227, 131, 173, 227, 131, 173, 0, 227, 131, 164, 227, 131, 159, 227, 131, 169, 227, 131, 159, 0, 227, 130, 175, 227, 131, 129, 227, 131, 188, 227, 131, 136, 0, 227, 130, 179, 227, 130, 179, 227, 131, 137, 227, 131, 169, 0, 227, 130, 179, 227, 131, 137, 227, 131, 169, 0, 227, 131, 156, 227, 130, 185, 227, 130, 180, 227, 131, 137, 227, 131, 169, 0, 227, 130, 162, 227, 130, 181, 227, 131, 138, 227, 131, 179, 0, 227, 131, 129, 227, 131, 163, 227, 131, 188, 227, 131, 172, 227, 131, 160, 0, 227, 131, 169, 227, 130, 175, 227, 131, 169, 227, 130, 164, 0, 227, 131, 169, 227, 130, 164, 227, 131, 156, 227, 131, 171, 227, 131, 136, 0, 227, 131, 151, 227, 131, 169, 227, 130, 185, 227, 131, 171, 0, 227, 131, 158, 227, 130, 164, 227, 131, 138, 227, 131, 179, 0, 227, 131, 144, 227, 131, 171, 227, 131, 147, 227, 131, 188, 227, 131, 136, 0, 227, 130, 164, 227, 131, 171, 227, 131, 159, 227, 131, 188, 227, 130, 188, 0, 227, 131, 173, 227, 130, 188, 227, 131, 170, 227, 130, 162, 0, 227, 130, 180, 227, 130, 175, 227, 131, 170, 227, 131, 179, 0, 227, 131, 158, 227, 131, 171, 227, 131, 142, 227, 131, 188, 227, 131, 160, 0, 227, 130, 173, 227, 131, 144, 227, 131, 139, 227, 130, 162, 0, 227, 130, 181, 227, 131, 161, 227, 131, 143, 227, 131, 128, 227, 131, 188, 0, 227, 131, 155, 227, 130, 168, 227, 131, 171, 227, 130, 179, 0, 227, 131, 155, 227, 130, 168, 227, 131, 171, 227, 130, 170, 227, 131, 188, 0, 227, 131, 137, 227, 131, 179, 227, 131, 161, 227, 131, 171, 0, 227, 131, 144, 227, 130, 175, 227, 131, 188, 227, 131, 128, 0, 227, 130, 179, 227, 131, 188, 227, 130, 191, 227, 130, 185, 0, 227, 131, 144, 227, 131, 141, 227, 131, 150, 227, 131, 188, 0, 227, 131, 150, 227, 131, 188, 227, 131, 148, 227, 131, 131, 227, 130, 176, 0, 227, 131, 145, 227, 131, 131, 227, 131, 129, 227, 131, 188, 227, 131, 171, 0, 227, 131, 138, 227, 131, 131, 227, 130, 175, 227, 131, 169, 227, 131, 188, 0, 227, 131, 147, 227, 131, 150, 227, 131, 169, 227, 131, 188, 227, 131, 144, 0, 227, 131, 149, 227, 131, 169, 227, 130, 164, 227, 130, 180, 227, 131, 179, 0, 227, 130, 181, 227, 131, 156, 227, 131, 141, 227, 130, 162, 0, 227, 131, 142, 227, 130, 175, 227, 130, 191, 227, 130, 185, 0, 227, 131, 129, 227, 131, 171, 227, 131, 131, 227, 131, 136, 0, 227, 131, 129, 227, 131, 171, 227, 130, 191, 227, 131, 170, 227, 130, 185, 0, 227, 130, 182, 227, 131, 179, 227, 130, 176, 227, 131, 188, 227, 130, 185, 0, 227, 131, 143, 227, 131, 150, 227, 131, 141, 227, 131, 188, 227, 130, 175, 0, 227, 131, 171, 227, 131, 138, 227, 131, 136, 227, 131, 188, 227, 131, 179, 0, 227, 130, 189, 227, 131, 171, 227, 131, 173, 227, 131, 131, 227, 130, 175, 0, 227, 131, 137, 227, 130, 184, 227, 131, 167, 227, 131, 131, 227, 131, 129, 0, 227, 131, 138, 227, 131, 158, 227, 130, 186, 227, 131, 179, 0, 227, 131, 152, 227, 130, 164, 227, 130, 172, 227, 131, 139, 0, 227, 130, 183, 227, 130, 182, 227, 131, 170, 227, 130, 172, 227, 131, 188, 0, 227, 131, 164, 227, 130, 184, 227, 131, 173, 227, 131, 179, 0, 227, 131, 141, 227, 131, 179, 227, 131, 137, 227, 131, 188, 227, 131, 171, 0, 227, 131, 170, 227, 131, 170, 227, 131, 188, 227, 131, 169, 0, 227, 131, 166, 227, 131, 172, 227, 130, 164, 227, 131, 137, 227, 131, 171, 0, 227, 130, 162, 227, 131, 142, 227, 131, 151, 227, 130, 185, 0, 227, 130, 162, 227, 131, 188, 227, 131, 158, 227, 131, 171, 227, 131, 137, 0, 227, 131, 146, 227, 131, 179, 227, 131, 144, 227, 130, 185, 0, 227, 131, 159, 227, 131, 173, 227, 130, 171, 227, 131, 173, 227, 130, 185, 0, 227, 131, 157, 227, 131, 175, 227, 131, 171, 227, 131, 179, 0, 227, 130, 171, 227, 130, 175, 227, 131, 172, 227, 130, 170, 227, 131, 179, 0, 227, 130, 171, 227, 130, 178, 227, 131, 156, 227, 130, 166, 227, 130, 186, 0, 227, 130, 184, 227, 131, 165, 227, 131, 154, 227, 131, 131, 227, 130, 191, 0, 227, 131, 168, 227, 131, 158, 227, 131, 175, 227, 131, 171, 0, 227, 130, 181, 227, 131, 158, 227, 131, 168, 227, 131, 188, 227, 131, 171, 0, 227, 131, 136, 227, 131, 173, 227, 131, 148, 227, 130, 166, 227, 130, 185, 0, 227, 131, 129, 227, 131, 170, 227, 131, 188, 227, 131, 179, 0, 227, 130, 162, 227, 131, 150, 227, 130, 189, 227, 131, 171, 0, 227, 130, 189, 227, 131, 188, 227, 131, 138, 227, 131, 142, 0, 227, 131, 166, 227, 130, 173, 227, 131, 175, 227, 131, 169, 227, 130, 183, 0, 227, 130, 170, 227, 131, 139, 227, 130, 180, 227, 131, 188, 227, 131, 170, 0, 227, 130, 191, 227, 131, 158, 227, 130, 182, 227, 131, 169, 227, 130, 183, 0, 227, 131, 136, 227, 131, 137, 227, 130, 176, 227, 131, 169, 227, 131, 188, 0, 227, 131, 136, 227, 131, 137, 227, 130, 188, 227, 131, 171, 227, 130, 172, 0, 227, 131, 145, 227, 131, 188, 227, 131, 171, 227, 131, 171, 0, 227, 131, 143, 227, 131, 179, 227, 131, 134, 227, 131, 188, 227, 131, 171, 0, 227, 130, 181, 227, 130, 175, 227, 131, 169, 227, 131, 147, 227, 130, 185, 0, 227, 130, 184, 227, 131, 188, 227, 131, 169, 227, 131, 179, 227, 130, 185, 0, 227, 131, 169, 227, 131, 150, 227, 130, 171, 227, 130, 185, 0, 227, 130, 191, 227, 131, 132, 227, 131, 153, 227, 130, 164, 0, 227, 130, 179, 227, 131, 162, 227, 131, 171, 227, 131, 188, 0, 227, 131, 156, 227, 131, 188, 227, 131, 158, 227, 131, 179, 227, 131, 128, 0, 227, 131, 128, 227, 131, 179, 227, 131, 144, 227, 131, 171, 0, 227, 131, 161, 227, 130, 191, 227, 131, 179, 227, 130, 176, 0, 227, 131, 161, 227, 130, 191, 227, 130, 176, 227, 131, 173, 227, 130, 185, 0, 227, 131, 172, 227, 130, 184, 227, 131, 173, 227, 131, 131, 227, 130, 175, 0, 227, 131, 172, 227, 130, 184, 227, 130, 162, 227, 130, 164, 227, 130, 185, 0, 227, 131, 172, 227, 130, 184, 227, 130, 185, 227, 131, 129, 227, 131, 171, 0, 227, 131, 169, 227, 131, 134, 227, 130, 163, 227, 130, 162, 227, 130, 185, 0, 227, 131, 169, 227, 131, 134, 227, 130, 163, 227, 130, 170, 227, 130, 185, 0, 227, 130, 171, 227, 130, 164, 227, 130, 170, 227, 131, 188, 227, 130, 172, 0, 227, 130, 176, 227, 131, 169, 227, 131, 188, 227, 131, 137, 227, 131, 179, 0, 227, 131, 172, 227, 131, 131, 227, 130, 175, 227, 130, 166, 227, 130, 182, 0, 227, 130, 184, 227, 131, 169, 227, 131, 188, 227, 131, 129, 0, 227, 131, 135, 227, 130, 170, 227, 130, 173, 227, 130, 183, 227, 130, 185, 0, 227, 131, 138, 227, 130, 168, 227, 131, 136, 227, 131, 171, 0, 227, 131, 143, 227, 131, 164, 227, 130, 183, 227, 130, 172, 227, 131, 161, 0, 227, 131, 137, 227, 131, 128, 227, 130, 164, 227, 131, 136, 227, 130, 185, 0, 227, 131, 146, 227, 130, 179, 227, 130, 182, 227, 131, 171, 0, 227, 131, 162, 227, 130, 166, 227, 130, 171, 227, 130, 182, 227, 131, 171, 0, 227, 130, 180, 227, 130, 166, 227, 130, 171, 227, 130, 182, 227, 131, 171, 0, 227, 131, 157, 227, 131, 131, 227, 131, 129, 227, 131, 163, 227, 131, 158, 0, 227, 131, 157, 227, 131, 131, 227, 130, 191, 227, 130, 164, 227, 130, 183, 0, 227, 130, 168, 227, 131, 179, 227, 131, 154, 227, 131, 171, 227, 131, 136, 0, 227, 131, 160, 227, 131, 131, 227, 130, 175, 227, 131, 171, 0, 227, 131, 160, 227, 130, 175, 227, 131, 144, 227, 131, 188, 227, 131, 137, 0, 227, 131, 160, 227, 130, 175, 227, 131, 155, 227, 131, 188, 227, 130, 175, 0, 227, 131, 147, 227, 131, 131, 227, 131, 145, 0, 227, 131, 147, 227, 131, 188, 227, 131, 128, 227, 131, 171, 0, 227, 130, 179, 227, 131, 173, 227, 131, 156, 227, 131, 188, 227, 130, 183, 0, 227, 130, 179, 227, 131, 173, 227, 131, 136, 227, 131, 131, 227, 130, 175, 0, 227, 130, 179, 227, 131, 170, 227, 131, 179, 227, 130, 175, 0, 227, 131, 171, 227, 130, 175, 227, 130, 183, 227, 130, 170, 0, 227, 131, 172, 227, 131, 179, 227, 131, 136, 227, 131, 169, 227, 131, 188, 0, 227, 130, 185, 227, 131, 156, 227, 131, 159, 227, 131, 188, 0, 227, 131, 173, 227, 130, 186, 227, 131, 172, 227, 130, 164, 227, 131, 137, 0, 227, 130, 186, 227, 130, 172, 227, 130, 164, 227, 131, 137, 227, 130, 185, 0, 227, 131, 169, 227, 131, 160, 227, 131, 145, 227, 131, 171, 227, 131, 137, 0, 227, 130, 191, 227, 131, 134, 227, 131, 136, 227, 131, 151, 227, 130, 185, 0, 227, 131, 136, 227, 131, 170, 227, 131, 135, 227, 131, 151, 227, 130, 185, 0, 227, 131, 159, 227, 131, 142, 227, 131, 160, 227, 131, 131, 227, 131, 129, 0, 227, 131, 159, 227, 131, 142, 227, 131, 158, 227, 131, 128, 227, 131, 160, 0, 227, 130, 172, 227, 131, 188, 227, 131, 161, 227, 130, 164, 227, 131, 171, 0, 227, 131, 159, 227, 131, 132, 227, 131, 143, 227, 131, 139, 227, 131, 188, 0, 227, 131, 147, 227, 131, 188, 227, 130, 175, 227, 130, 164, 227, 131, 179, 0, 227, 131, 145, 227, 131, 129, 227, 131, 170, 227, 130, 185, 0, 227, 131, 150, 227, 130, 164, 227, 130, 188, 227, 131, 171, 0, 227, 131, 149, 227, 131, 173, 227, 131, 188, 227, 130, 188, 227, 131, 171, 0, 227, 131, 129, 227, 130, 167, 227, 131, 170, 227, 131, 179, 227, 131, 156, 0, 227, 131, 129, 227, 130, 167, 227, 131, 170, 227, 131, 160, 0, 227, 130, 171, 227, 131, 169, 227, 131, 138, 227, 130, 175, 227, 130, 183, 0, 227, 131, 136, 227, 131, 170, 227, 131, 136, 227, 131, 137, 227, 131, 179, 0, 227, 130, 168, 227, 131, 134, 227, 131, 156, 227, 131, 188, 227, 130, 185, 0, 227, 131, 149, 227, 131, 175, 227, 131, 179, 227, 131, 134, 0, 227, 131, 149, 227, 131, 175, 227, 131, 169, 227, 130, 164, 227, 131, 137, 0, 227, 131, 159, 227, 131, 159, 227, 131, 173, 227, 131, 171, 0, 227, 131, 159, 227, 131, 159, 227, 131, 173, 227, 131, 131, 227, 131, 151, 0, 227, 131, 160, 227, 130, 166, 227, 131, 158, 227, 131, 188, 227, 130, 184, 0, 227, 131, 137, 227, 131, 179, 227, 130, 171, 227, 131, 169, 227, 130, 185, 0, 227, 131, 139, 227, 131, 163, 227, 131, 171, 227, 131, 158, 227, 131, 188, 0, 227, 131, 150, 227, 131, 139, 227, 131, 163, 227, 131, 131, 227, 131, 136, 0, 227, 131, 170, 227, 131, 188, 227, 130, 183, 227, 131, 163, 227, 131, 179, 0, 227, 130, 185, 227, 130, 171, 227, 131, 179, 227, 131, 151, 227, 131, 188, 0, 227, 130, 185, 227, 130, 171, 227, 130, 191, 227, 131, 179, 227, 130, 175, 0, 227, 131, 137, 227, 131, 188, 227, 131, 159, 227, 131, 169, 227, 131, 188, 0, 227, 131, 137, 227, 131, 188, 227, 130, 191, 227, 130, 175, 227, 131, 179, 0, 227, 130, 166, 227, 130, 189, 227, 131, 143, 227, 131, 129, 0, 227, 131, 158, 227, 131, 141, 227, 131, 141, 0, 227, 131, 148, 227, 131, 179, 227, 131, 151, 227, 130, 175, 0, 227, 131, 154, 227, 131, 169, 227, 131, 131, 227, 131, 151, 0, 227, 131, 159, 227, 130, 171, 227, 131, 171, 227, 130, 178, 0, 227, 131, 149, 227, 130, 171, 227, 131, 158, 227, 131, 171, 0, 227, 130, 172, 227, 131, 144, 227, 130, 164, 227, 131, 136, 0, 227, 130, 172, 227, 131, 150, 227, 131, 170, 227, 130, 162, 227, 130, 185, 0, 227, 130, 180, 227, 131, 179, 227, 131, 153, 0, 227, 131, 170, 227, 130, 170, 227, 131, 171, 0, 227, 131, 171, 227, 130, 171, 227, 131, 170, 227, 130, 170, 0, 227, 131, 146, 227, 131, 157, 227, 131, 157, 227, 130, 191, 227, 130, 185, 0, 227, 130, 171, 227, 131, 144, 227, 131, 171, 227, 131, 137, 227, 131, 179, 0, 227, 130, 185, 227, 130, 179, 227, 131, 171, 227, 131, 148, 0, 227, 131, 137, 227, 131, 169, 227, 131, 148, 227, 130, 170, 227, 131, 179, 0, 227, 130, 176, 227, 131, 172, 227, 131, 131, 227, 130, 176, 227, 131, 171, 0, 227, 131, 137, 227, 130, 175, 227, 131, 173, 227, 131, 131, 227, 130, 176, 0, 227, 131, 158, 227, 130, 185, 227, 130, 173, 227, 131, 131, 227, 131, 145, 0, 227, 130, 177, 227, 130, 164, 227, 130, 179, 227, 130, 166, 227, 130, 170, 0, 227, 131, 141, 227, 130, 170, 227, 131, 169, 227, 131, 179, 227, 131, 136, 0, 227, 130, 191, 227, 131, 158, 227, 131, 179, 227, 130, 191, 0, 227, 131, 166, 227, 130, 173, 227, 130, 171, 227, 131, 150, 227, 131, 170, 0, 227, 131, 166, 227, 130, 173, 227, 131, 142, 227, 130, 170, 227, 131, 188, 0, 227, 131, 158, 227, 131, 139, 227, 131, 165, 227, 131, 188, 227, 131, 169, 0, 227, 130, 184, 227, 131, 144, 227, 130, 179, 227, 130, 164, 227, 131, 171, 0, 227, 131, 153, 227, 131, 173, 227, 131, 153, 227, 131, 171, 227, 131, 136, 0, 227, 131, 137, 227, 130, 181, 227, 130, 164, 227, 131, 137, 227, 131, 179, 0, 227, 131, 162, 227, 130, 184, 227, 131, 163, 227, 131, 179, 227, 131, 156, 0, 227, 130, 168, 227, 131, 172, 227, 130, 173, 227, 131, 150, 227, 131, 171, 0, 227, 131, 150, 227, 131, 188, 227, 131, 144, 227, 131, 188, 227, 131, 179, 0, 227, 131, 136, 227, 130, 178, 227, 130, 173, 227, 131, 131, 227, 130, 185, 0, 227, 131, 161, 227, 130, 172, 227, 131, 164, 227, 131, 179, 227, 131, 158, 0, 227, 131, 170, 227, 131, 188, 227, 131, 149, 227, 130, 163, 227, 130, 162, 0, 227, 130, 176, 227, 131, 172, 227, 130, 164, 227, 130, 183, 227, 130, 162, 0, 227, 130, 176, 227, 131, 169, 227, 130, 164, 227, 130, 170, 227, 131, 179, 0, 227, 131, 158, 227, 131, 179, 227, 131, 160, 227, 131, 188, 0, 227, 131, 157, 227, 131, 170, 227, 130, 180, 227, 131, 179, 239, 188, 186, 0, 227, 130, 168, 227, 131, 171, 227, 131, 172, 227, 130, 164, 227, 131, 137, 0, 227, 131, 128, 227, 130, 164, 227, 131, 142, 227, 131, 188, 227, 130, 186, 0, 227, 131, 168, 227, 131, 142, 227, 131, 175, 227, 131, 188, 227, 131, 171, 0, 227, 131, 166, 227, 130, 173, 227, 131, 161, 227, 131, 142, 227, 130, 179, 0, 227, 131, 173, 227, 131, 136, 227, 131, 160, 0, 227, 131, 166, 227, 130, 175, 227, 130, 183, 227, 131, 188, 0, 227, 130, 168, 227, 131, 160, 227, 131, 170, 227, 131, 131, 227, 131, 136, 0, 227, 130, 162, 227, 130, 176, 227, 131, 142, 227, 131, 160, 0, 227, 131, 135, 227, 130, 163, 227, 130, 162, 227, 131, 171, 227, 130, 172, 0, 227, 131, 145, 227, 131, 171, 227, 130, 173, 227, 130, 162, 0, 227, 131, 146, 227, 131, 188, 227, 131, 137, 227, 131, 169, 227, 131, 179, 0, 227, 131, 172, 227, 130, 184, 227, 130, 174, 227, 130, 172, 227, 130, 185, 0, 227, 130, 174, 227, 131, 169, 227, 131, 134, 227, 130, 163, 227, 131, 138, 0, 227, 130, 175, 227, 131, 172, 227, 130, 187, 227, 131, 170, 227, 130, 162, 0, 227, 131, 149, 227, 130, 163, 227, 130, 170, 227, 131, 141, 0, 227, 131, 158, 227, 131, 138, 227, 131, 149, 227, 130, 163, 0, 227, 131, 128, 227, 131, 188, 227, 130, 175, 227, 131, 169, 227, 130, 164, 0, 227, 130, 183, 227, 130, 167, 227, 130, 164, 227, 131, 159, 0, 227, 130, 162, 227, 131, 171, 227, 130, 187, 227, 130, 166, 227, 130, 185, 0, 227, 131, 147, 227, 130, 175, 227, 131, 134, 227, 130, 163, 227, 131, 139, 0, 227, 131, 132, 227, 130, 191, 227, 131, 188, 227, 130, 184, 227, 131, 163, 0, 227, 130, 184, 227, 131, 163, 227, 131, 142, 227, 131, 147, 227, 131, 188, 0, 227, 130, 184, 227, 131, 163, 227, 131, 173, 227, 131, 188, 227, 131, 128, 0, 227, 131, 157, 227, 130, 171, 227, 131, 150, 0, 227, 131, 129, 227, 131, 163, 227, 130, 170, 227, 131, 150, 227, 131, 188, 0, 227, 130, 168, 227, 131, 179, 227, 131, 150, 227, 130, 170, 227, 131, 188, 0, 227, 131, 159, 227, 130, 184, 227, 131, 165, 227, 131, 158, 227, 131, 171, 0, 227, 131, 149, 227, 130, 191, 227, 131, 129, 227, 131, 158, 227, 131, 171, 0, 227, 131, 128, 227, 130, 164, 227, 130, 177, 227, 131, 179, 227, 130, 173, 0, 227, 131, 159, 227, 131, 141, 227, 130, 186, 227, 131, 159, 0, 227, 131, 159, 227, 131, 171, 227, 131, 155, 227, 131, 131, 227, 130, 176, 0, 227, 131, 168, 227, 131, 188, 227, 131, 134, 227, 131, 170, 227, 131, 188, 0, 227, 131, 143, 227, 131, 188, 227, 131, 135, 227, 131, 170, 227, 130, 162, 0, 227, 131, 160, 227, 131, 188, 227, 131, 169, 227, 131, 179, 227, 131, 137, 0, 227, 131, 129, 227, 131, 167, 227, 131, 173, 227, 131, 141, 227, 130, 179, 0, 227, 131, 172, 227, 131, 145, 227, 131, 171, 227, 131, 128, 227, 130, 185, 0, 227, 131, 164, 227, 131, 138, 227, 131, 131, 227, 131, 151, 0, 227, 131, 164, 227, 131, 138, 227, 131, 131, 227, 130, 173, 227, 131, 188, 0, 227, 131, 144, 227, 130, 170, 227, 131, 131, 227, 131, 151, 0, 227, 131, 144, 227, 130, 170, 227, 131, 131, 227, 130, 173, 227, 131, 188, 0, 227, 131, 146, 227, 131, 164, 227, 131, 131, 227, 131, 151, 0, 227, 131, 146, 227, 131, 164, 227, 131, 131, 227, 130, 173, 227, 131, 188, 0, 227, 131, 160, 227, 131, 179, 227, 131, 138, 0, 227, 131, 160, 227, 130, 183, 227, 131, 163, 227, 131, 188, 227, 131, 138, 0, 227, 131, 158, 227, 131, 161, 227, 131, 145, 227, 131, 136, 0, 227, 131, 143, 227, 131, 136, 227, 131, 188, 227, 131, 156, 227, 131, 188, 0, 227, 130, 177, 227, 131, 179, 227, 131, 155, 227, 131, 173, 227, 130, 166, 0, 227, 130, 183, 227, 131, 158, 227, 131, 158, 0, 227, 130, 188, 227, 131, 150, 227, 131, 169, 227, 130, 164, 227, 130, 171, 0, 227, 131, 128, 227, 131, 179, 227, 130, 180, 227, 131, 173, 0, 227, 130, 172, 227, 131, 179, 227, 131, 136, 227, 131, 171, 0, 227, 130, 174, 227, 130, 172, 227, 130, 164, 227, 130, 162, 227, 130, 185, 0, 227, 130, 179, 227, 131, 173, 227, 131, 162, 227, 131, 170, 0, 227, 130, 179, 227, 130, 179, 227, 131, 173, 227, 131, 162, 227, 131, 170, 0, 227, 131, 162, 227, 130, 176, 227, 131, 170, 227, 131, 165, 227, 131, 188, 0, 227, 131, 137, 227, 131, 170, 227, 131, 165, 227, 130, 166, 227, 130, 186, 0, 227, 130, 191, 227, 131, 150, 227, 131, 179, 227, 131, 141, 0, 227, 131, 137, 227, 131, 131, 227, 130, 179, 227, 131, 169, 227, 131, 188, 0, 227, 131, 137, 227, 131, 134, 227, 131, 131, 227, 130, 179, 227, 131, 132, 0, 227, 131, 173, 227, 131, 188, 227, 131, 150, 227, 130, 183, 227, 131, 179, 0, 227, 130, 170, 227, 130, 191, 227, 131, 158, 227, 131, 173, 0, 227, 130, 172, 227, 131, 158, 227, 130, 172, 227, 131, 171, 0, 227, 130, 172, 227, 131, 158, 227, 130, 178, 227, 131, 173, 227, 130, 178, 0, 227, 131, 138, 227, 130, 178, 227, 130, 173, 0, 227, 131, 128, 227, 130, 178, 227, 130, 173, 0, 227, 130, 175, 227, 131, 171, 227, 131, 159, 227, 131, 171, 0, 227, 130, 175, 227, 131, 171, 227, 131, 158, 227, 131, 166, 0, 227, 131, 143, 227, 131, 143, 227, 130, 179, 227, 131, 162, 227, 131, 170, 0, 227, 131, 149, 227, 130, 183, 227, 131, 135, 0, 227, 131, 155, 227, 130, 164, 227, 131, 188, 227, 130, 172, 0, 227, 131, 154, 227, 131, 179, 227, 131, 137, 227, 131, 169, 227, 131, 188, 0, 227, 131, 162, 227, 131, 179, 227, 131, 161, 227, 131, 179, 0, 227, 130, 168, 227, 131, 171, 227, 131, 149, 227, 131, 188, 227, 131, 179, 0, 227, 131, 129, 227, 131, 165, 227, 131, 170, 227, 131, 141, 0, 227, 131, 137, 227, 131, 172, 227, 131, 135, 227, 130, 163, 227, 130, 162, 0, 227, 131, 144, 227, 130, 185, 227, 131, 169, 227, 130, 170, 0, 227, 131, 161, 227, 130, 176, 227, 131, 173, 227, 130, 179, 0, 227, 131, 175, 227, 131, 171, 227, 131, 147, 227, 131, 171, 0, 227, 131, 175, 227, 131, 171, 227, 131, 147, 227, 130, 162, 227, 131, 171, 0, 227, 131, 128, 227, 131, 171, 227, 131, 158, 227, 131, 131, 227, 130, 171, 0, 227, 131, 146, 227, 131, 146, 227, 131, 128, 227, 131, 171, 227, 131, 158, 0, 227, 131, 158, 227, 131, 169, 227, 130, 171, 227, 131, 131, 227, 131, 129, 0, 227, 130, 164, 227, 130, 183, 227, 130, 186, 227, 131, 158, 227, 130, 164, 0, 227, 130, 164, 227, 131, 175, 227, 131, 145, 227, 131, 172, 227, 130, 185, 0, 227, 130, 186, 227, 131, 171, 227, 131, 131, 227, 130, 176, 0, 227, 130, 186, 227, 131, 171, 227, 130, 186, 227, 130, 173, 227, 131, 179, 0, 227, 130, 183, 227, 131, 179, 227, 131, 156, 227, 131, 169, 227, 131, 188, 0, 227, 131, 135, 227, 130, 185, 227, 131, 158, 227, 130, 185, 0, 227, 131, 135, 227, 130, 185, 227, 130, 171, 227, 131, 188, 227, 131, 179, 0, 227, 131, 151, 227, 131, 173, 227, 131, 136, 227, 131, 188, 227, 130, 172, 0, 227, 130, 162, 227, 131, 144, 227, 130, 180, 227, 131, 188, 227, 131, 169, 0, 227, 130, 162, 227, 131, 188, 227, 130, 177, 227, 131, 179, 0, 227, 130, 162, 227, 131, 188, 227, 130, 177, 227, 130, 170, 227, 130, 185, 0, 227, 131, 164, 227, 131, 150, 227, 130, 175, 227, 131, 173, 227, 131, 179, 0, 227, 131, 128, 227, 130, 185, 227, 131, 136, 227, 131, 128, 227, 130, 185, 0, 227, 130, 190, 227, 131, 173, 227, 130, 162, 0, 227, 130, 190, 227, 131, 173, 227, 130, 162, 227, 131, 188, 227, 130, 175, 0, 227, 131, 129, 227, 131, 169, 227, 131, 188, 227, 131, 159, 227, 130, 163, 0, 227, 131, 129, 227, 131, 169, 227, 131, 129, 227, 131, 188, 227, 131, 142, 0, 227, 130, 180, 227, 131, 129, 227, 131, 160, 0, 227, 130, 180, 227, 131, 129, 227, 131, 159, 227, 131, 171, 0, 227, 130, 180, 227, 131, 129, 227, 131, 171, 227, 130, 188, 227, 131, 171, 0, 227, 131, 166, 227, 131, 139, 227, 131, 169, 227, 131, 179, 0, 227, 131, 128, 227, 131, 150, 227, 131, 169, 227, 131, 179, 0, 227, 131, 169, 227, 131, 179, 227, 130, 175, 227, 131, 171, 227, 130, 185, 0, 227, 130, 179, 227, 130, 162, 227, 131, 171, 227, 131, 146, 227, 131, 188, 0, 227, 130, 185, 227, 131, 175, 227, 131, 179, 227, 131, 138, 0, 227, 131, 144, 227, 131, 139, 227, 131, 151, 227, 131, 131, 227, 131, 129, 0, 227, 131, 144, 227, 131, 139, 227, 131, 170, 227, 131, 131, 227, 131, 129, 0, 227, 131, 144, 227, 130, 164, 227, 131, 144, 227, 131, 139, 227, 131, 169, 0, 227, 130, 183, 227, 130, 173, 227, 130, 184, 227, 130, 171, 0, 227, 131, 161, 227, 131, 150, 227, 130, 173, 227, 130, 184, 227, 130, 171, 0, 227, 130, 168, 227, 131, 162, 227, 131, 179, 227, 130, 172, 0, 227, 130, 171, 227, 131, 150, 227, 131, 171, 227, 131, 162, 0, 227, 130, 183, 227, 131, 165, 227, 131, 144, 227, 131, 171, 227, 130, 180, 0, 227, 130, 191, 227, 131, 158, 227, 130, 178, 227, 130, 191, 227, 130, 177, 0, 227, 131, 162, 227, 131, 173, 227, 131, 144, 227, 131, 172, 227, 131, 171, 0, 227, 131, 151, 227, 131, 171, 227, 131, 170, 227, 131, 171, 0, 227, 131, 150, 227, 131, 171, 227, 131, 179, 227, 130, 178, 227, 131, 171, 0, 227, 131, 158, 227, 131, 158, 227, 131, 179, 227, 131, 156, 227, 130, 166, 0, 227, 131, 144, 227, 131, 129, 227, 131, 165, 227, 131, 171, 0, 227, 131, 135, 227, 131, 179, 227, 131, 129, 227, 131, 165, 227, 131, 169, 0, 227, 131, 134, 227, 131, 131, 227, 130, 183, 227, 131, 188, 227, 131, 137, 0, 227, 131, 138, 227, 131, 131, 227, 131, 136, 227, 131, 172, 227, 130, 164, 0, 227, 130, 174, 227, 130, 162, 227, 131, 171, 0, 227, 130, 174, 227, 130, 174, 227, 130, 162, 227, 131, 171, 0, 227, 130, 174, 227, 130, 174, 227, 130, 174, 227, 130, 162, 227, 131, 171, 0, 227, 130, 183, 227, 131, 147, 227, 130, 183, 227, 131, 169, 227, 130, 185, 0, 227, 130, 183, 227, 131, 147, 227, 131, 147, 227, 131, 188, 227, 131, 171, 0, 227, 130, 183, 227, 131, 147, 227, 131, 171, 227, 131, 137, 227, 131, 179, 0, 227, 131, 170, 227, 130, 176, 227, 131, 172, 227, 131, 188, 0, 227, 130, 170, 227, 131, 188, 227, 131, 153, 227, 131, 160, 0, 227, 131, 146, 227, 131, 136, 227, 131, 162, 227, 130, 183, 0, 227, 131, 169, 227, 131, 179, 227, 131, 151, 227, 131, 169, 227, 131, 188, 0, 227, 130, 183, 227, 131, 163, 227, 131, 179, 227, 131, 135, 227, 131, 169, 0, 227, 130, 173, 227, 131, 144, 227, 130, 180, 0, 227, 130, 170, 227, 131, 142, 227, 131, 179, 227, 131, 137, 0, 227, 130, 170, 227, 131, 142, 227, 131, 142, 227, 130, 175, 227, 130, 185, 0, 227, 130, 175, 227, 131, 158, 227, 130, 183, 227, 131, 165, 227, 131, 179, 0, 227, 131, 132, 227, 131, 179, 227, 131, 153, 227, 130, 162, 227, 131, 188, 0, 227, 131, 149, 227, 131, 170, 227, 131, 188, 227, 130, 184, 227, 130, 170, 0, 227, 131, 129, 227, 131, 167, 227, 131, 156, 227, 131, 158, 227, 130, 173, 0, 227, 130, 162, 227, 130, 174, 227, 131, 171, 227, 131, 128, 227, 131, 188, 0, 227, 131, 158, 227, 131, 131, 227, 130, 174, 227, 131, 167, 0, 227, 130, 179, 227, 130, 184, 227, 131, 167, 227, 131, 149, 227, 131, 188, 0, 227, 130, 179, 227, 130, 184, 227, 131, 167, 227, 131, 179, 227, 131, 137, 0, 227, 130, 175, 227, 131, 170, 227, 131, 160, 227, 130, 172, 227, 131, 179, 0, 227, 130, 180, 227, 131, 147, 227, 131, 131, 227, 131, 136, 0, 227, 130, 180, 227, 131, 171, 227, 131, 188, 227, 130, 176, 0, 227, 130, 179, 227, 131, 158, 227, 130, 191, 227, 131, 138, 0, 227, 130, 173, 227, 131, 170, 227, 130, 173, 227, 130, 182, 227, 131, 179, 0, 227, 131, 144, 227, 131, 131, 227, 131, 149, 227, 131, 173, 227, 131, 179, 0, 227, 131, 175, 227, 130, 183, 227, 131, 156, 227, 131, 179, 0, 227, 130, 166, 227, 130, 169, 227, 131, 188, 227, 130, 176, 227, 131, 171, 0, 227, 131, 144, 227, 131, 171, 227, 131, 129, 227, 131, 163, 227, 130, 164, 0, 227, 131, 144, 227, 131, 171, 227, 130, 184, 227, 131, 188, 227, 131, 138, 0, 227, 130, 175, 227, 130, 164, 227, 130, 191, 227, 131, 169, 227, 131, 179, 0, 227, 130, 162, 227, 130, 164, 227, 130, 162, 227, 131, 179, 227, 131, 136, 0, 227, 131, 162, 227, 131, 142, 227, 130, 186, 0, 227, 130, 184, 227, 131, 152, 227, 131, 131, 227, 131, 137, 0, 227, 130, 181, 227, 130, 182, 227, 131, 179, 227, 131, 137, 227, 131, 169, 0, 227, 131, 161, 227, 131, 169, 227, 131, 171, 227, 131, 144, 0, 227, 130, 166, 227, 131, 171, 227, 130, 172, 227, 131, 162, 227, 130, 185, 0, 227, 130, 179, 227, 131, 144, 227, 131, 171, 227, 130, 170, 227, 131, 179, 0, 227, 131, 134, 227, 131, 169, 227, 130, 173, 227, 130, 170, 227, 131, 179, 0, 227, 131, 147, 227, 131, 170, 227, 130, 184, 227, 130, 170, 227, 131, 179, 0, 227, 131, 136, 227, 131, 171, 227, 131, 141, 227, 131, 173, 227, 130, 185, 0, 227, 131, 156, 227, 131, 171, 227, 131, 136, 227, 131, 173, 227, 130, 185, 0, 227, 131, 172, 227, 130, 183, 227, 131, 169, 227, 131, 160, 0, 227, 130, 188, 227, 130, 175, 227, 131, 173, 227, 131, 160, 0, 227, 131, 169, 227, 131, 179, 227, 131, 137, 227, 131, 173, 227, 130, 185, 0, 227, 130, 173, 227, 131, 165, 227, 131, 172, 227, 131, 160, 0, 227, 130, 177, 227, 131, 171, 227, 131, 135, 227, 130, 163, 227, 130, 170, 0, 227, 131, 161, 227, 131, 173, 227, 130, 168, 227, 131, 131, 227, 130, 191, 0, 227, 130, 178, 227, 131, 142, 227, 130, 187, 227, 130, 175, 227, 131, 136, 0, 227, 131, 143, 227, 131, 170, 227, 131, 158, 227, 131, 173, 227, 131, 179, 0, 227, 131, 143, 227, 131, 170, 227, 131, 156, 227, 131, 188, 227, 130, 176, 0, 227, 131, 150, 227, 131, 170, 227, 130, 172, 227, 131, 173, 227, 131, 179, 0, 227, 131, 149, 227, 130, 169, 227, 131, 131, 227, 130, 179, 0, 227, 131, 134, 227, 131, 188, 227, 131, 171, 227, 131, 138, 227, 131, 188, 0, 227, 131, 158, 227, 131, 149, 227, 130, 169, 227, 130, 175, 227, 130, 183, 227, 131, 188, 0, 227, 130, 177, 227, 131, 173, 227, 131, 158, 227, 131, 132, 0, 227, 130, 178, 227, 130, 179, 227, 130, 172, 227, 130, 183, 227, 131, 169, 0, 227, 130, 178, 227, 131, 131, 227, 130, 179, 227, 130, 166, 227, 130, 172, 0, 227, 131, 155, 227, 131, 171, 227, 131, 147, 227, 131, 188, 0, 227, 131, 155, 227, 131, 171, 227, 131, 188, 227, 131, 137, 0, 227, 131, 164, 227, 131, 164, 227, 130, 179, 227, 131, 158, 0, 227, 131, 146, 227, 131, 142, 227, 131, 164, 227, 130, 179, 227, 131, 158, 0, 227, 131, 149, 227, 130, 161, 227, 130, 164, 227, 130, 162, 227, 131, 173, 227, 131, 188, 0, 227, 130, 179, 227, 131, 149, 227, 130, 173, 227, 131, 160, 227, 130, 183, 0, 227, 130, 179, 227, 131, 149, 227, 131, 188, 227, 131, 169, 227, 130, 164, 0, 227, 131, 147, 227, 131, 147, 227, 131, 168, 227, 131, 179, 0, 227, 130, 183, 227, 130, 183, 227, 130, 179, 0, 227, 130, 171, 227, 130, 168, 227, 131, 179, 227, 130, 184, 227, 130, 183, 0, 227, 131, 149, 227, 131, 169, 227, 131, 153, 227, 131, 153, 0, 227, 131, 149, 227, 131, 169, 227, 130, 168, 227, 131, 131, 227, 131, 134, 0, 227, 131, 149, 227, 131, 169, 227, 131, 188, 227, 130, 184, 227, 130, 167, 227, 130, 185, 0, 227, 131, 161, 227, 130, 167, 227, 131, 188, 227, 130, 175, 227, 131, 171, 0, 227, 130, 180, 227, 131, 188, 227, 130, 180, 227, 131, 188, 227, 131, 136, 0, 227, 131, 164, 227, 131, 179, 227, 131, 129, 227, 131, 163, 227, 131, 160, 0, 227, 130, 180, 227, 131, 173, 227, 131, 179, 227, 131, 128, 0, 227, 131, 136, 227, 131, 170, 227, 131, 159, 227, 130, 162, 227, 131, 179, 0, 227, 131, 139, 227, 131, 163, 227, 130, 185, 227, 131, 145, 227, 131, 188, 0, 227, 131, 139, 227, 131, 163, 227, 130, 170, 227, 131, 139, 227, 130, 175, 227, 130, 185, 0, 227, 131, 146, 227, 131, 136, 227, 131, 132, 227, 130, 173, 0, 227, 131, 139, 227, 131, 128, 227, 131, 179, 227, 130, 174, 227, 131, 171, 0, 227, 130, 174, 227, 131, 171, 227, 130, 172, 227, 131, 171, 227, 131, 137, 0, 227, 130, 183, 227, 131, 165, 227, 130, 183, 227, 131, 165, 227, 131, 151, 0, 227, 131, 149, 227, 131, 172, 227, 131, 149, 227, 131, 175, 227, 131, 179, 0, 227, 131, 154, 227, 131, 173, 227, 131, 131, 227, 131, 145, 227, 131, 149, 0, 227, 131, 154, 227, 131, 173, 227, 131, 170, 227, 131, 188, 227, 131, 160, 0, 227, 131, 158, 227, 131, 188, 227, 130, 164, 227, 131, 188, 227, 130, 171, 0, 227, 130, 171, 227, 131, 169, 227, 131, 158, 227, 131, 141, 227, 131, 173, 0, 227, 130, 171, 227, 131, 161, 227, 131, 134, 227, 131, 134, 0, 227, 130, 172, 227, 131, 161, 227, 131, 142, 227, 131, 135, 227, 130, 185, 0, 227, 130, 175, 227, 130, 186, 227, 131, 162, 227, 131, 188, 0, 227, 131, 137, 227, 131, 169, 227, 131, 159, 227, 131, 137, 227, 131, 173, 0, 227, 130, 166, 227, 131, 135, 227, 131, 131, 227, 131, 157, 227, 130, 166, 0, 227, 131, 150, 227, 131, 173, 227, 130, 185, 227, 130, 191, 227, 131, 188, 0, 227, 130, 168, 227, 131, 170, 227, 130, 173, 227, 131, 134, 227, 131, 171, 0, 227, 130, 168, 227, 131, 172, 227, 130, 182, 227, 131, 188, 227, 131, 137, 0, 227, 131, 129, 227, 130, 180, 227, 131, 169, 227, 130, 185, 0, 227, 130, 172, 227, 131, 129, 227, 130, 180, 227, 131, 169, 227, 130, 185, 0, 227, 130, 162, 227, 131, 158, 227, 131, 171, 227, 130, 185, 0, 227, 130, 162, 227, 131, 158, 227, 131, 171, 227, 131, 171, 227, 130, 172, 0, 227, 131, 139, 227, 131, 179, 227, 131, 149, 227, 130, 163, 227, 130, 162, 0, 227, 131, 171, 227, 131, 129, 227, 131, 163, 227, 131, 150, 227, 131, 171, 0, 227, 131, 135, 227, 131, 135, 227, 131, 179, 227, 131, 141, 0, 227, 131, 161, 227, 131, 172, 227, 130, 183, 227, 131, 188, 0, 227, 131, 140, 227, 131, 161, 227, 131, 169, 0, 227, 131, 140, 227, 131, 161, 227, 130, 164, 227, 131, 171, 0, 227, 131, 140, 227, 131, 161, 227, 131, 171, 227, 130, 180, 227, 131, 179, 0, 227, 130, 175, 227, 131, 172, 227, 131, 131, 227, 131, 149, 227, 130, 163, 0, 227, 131, 156, 227, 130, 175, 227, 131, 172, 227, 131, 188, 0, 227, 130, 170, 227, 131, 188, 227, 131, 173, 227, 131, 131, 227, 131, 136, 0, 227, 131, 144, 227, 130, 177, 227, 131, 131, 227, 131, 129, 227, 131, 163, 0, 227, 131, 145, 227, 131, 179, 227, 131, 151, 227, 130, 184, 227, 131, 179, 0, 227, 130, 171, 227, 131, 129, 227, 130, 179, 227, 131, 188, 227, 131, 171, 0, 227, 130, 175, 227, 131, 172, 227, 131, 153, 227, 131, 188, 227, 130, 185, 0, 227, 130, 170, 227, 131, 179, 227, 131, 144, 227, 131, 131, 227, 131, 136, 0, 227, 130, 170, 227, 131, 179, 227, 131, 144, 227, 131, 188, 227, 131, 179, 0, 227, 130, 188, 227, 131, 171, 227, 131, 141, 227, 130, 162, 227, 130, 185, 0, 227, 130, 164, 227, 131, 153, 227, 131, 171, 227, 130, 191, 227, 131, 171, 0, 227, 130, 184, 227, 130, 172, 227, 131, 171, 227, 131, 135, 0, 227, 131, 135, 227, 130, 163, 227, 130, 162, 227, 131, 179, 227, 130, 183, 227, 131, 188, 0, 227, 131, 149, 227, 131, 188, 227, 131, 145, 0, 227, 131, 156, 227, 131, 171, 227, 130, 177, 227, 131, 139, 227, 130, 170, 227, 131, 179, 0, 227, 131, 162, 227, 130, 175, 227, 131, 173, 227, 131, 188, 0, 227, 131, 149, 227, 130, 175, 227, 130, 185, 227, 131, 173, 227, 131, 188, 0, 227, 130, 184, 227, 131, 165, 227, 131, 138, 227, 130, 164, 227, 131, 145, 227, 131, 188, 0, 227, 131, 139, 227, 131, 163, 227, 131, 147, 227, 131, 188, 0, 227, 131, 139, 227, 131, 163, 227, 131, 146, 227, 131, 188, 227, 131, 136, 0, 227, 130, 172, 227, 130, 170, 227, 130, 172, 227, 130, 168, 227, 131, 179, 0, 227, 130, 162, 227, 130, 183, 227, 131, 158, 227, 131, 170, 0, 227, 130, 170, 227, 130, 183, 227, 131, 163, 227, 131, 158, 227, 131, 170, 0, 227, 130, 162, 227, 130, 183, 227, 131, 172, 227, 131, 188, 227, 131, 140, 0, 227, 131, 132, 227, 131, 132, 227, 130, 177, 227, 131, 169, 0, 227, 130, 177, 227, 131, 169, 227, 131, 169, 227, 131, 131, 227, 131, 145, 0, 227, 131, 137, 227, 131, 135, 227, 130, 171, 227, 131, 144, 227, 130, 183, 0, 227, 131, 164, 227, 131, 179, 227, 130, 176, 227, 131, 188, 227, 130, 185, 0, 227, 131, 135, 227, 130, 171, 227, 130, 176, 227, 131, 188, 227, 130, 185, 0, 227, 130, 162, 227, 130, 180, 227, 130, 184, 227, 131, 160, 227, 130, 183, 0, 227, 131, 135, 227, 131, 179, 227, 131, 130, 227, 131, 160, 227, 130, 183, 0, 227, 130, 175, 227, 131, 175, 227, 130, 172, 227, 131, 142, 227, 131, 179, 0, 227, 131, 158, 227, 130, 177, 227, 131, 179, 227, 130, 171, 227, 131, 139, 0, 227, 130, 177, 227, 130, 177, 227, 131, 179, 227, 130, 171, 227, 131, 139, 0, 227, 130, 170, 227, 131, 137, 227, 131, 170, 227, 131, 137, 227, 131, 170, 0, 227, 130, 162, 227, 131, 150, 227, 131, 170, 227, 131, 188, 0, 227, 130, 162, 227, 131, 150, 227, 131, 170, 227, 131, 156, 227, 131, 179, 0, 227, 130, 164, 227, 131, 175, 227, 131, 179, 227, 130, 179, 0, 227, 131, 171, 227, 130, 172, 227, 131, 171, 227, 130, 172, 227, 131, 179, 0, 227, 131, 168, 227, 131, 175, 227, 130, 183, 0, 227, 131, 146, 227, 131, 137, 227, 130, 164, 227, 131, 135, 0, 227, 131, 137, 227, 131, 146, 227, 131, 137, 227, 130, 164, 227, 131, 135, 0, 227, 131, 137, 227, 131, 173, 227, 131, 144, 227, 131, 179, 227, 130, 179, 0, 227, 131, 144, 227, 131, 179, 227, 131, 144, 227, 131, 137, 227, 131, 173, 0, 227, 130, 183, 227, 130, 186, 227, 130, 175, 227, 131, 162, 0, 227, 130, 170, 227, 131, 139, 227, 130, 183, 227, 130, 186, 227, 130, 175, 227, 131, 162, 0, 227, 130, 171, 227, 131, 170, 227, 130, 173, 227, 131, 170, 0, 227, 131, 169, 227, 131, 169, 227, 131, 179, 227, 131, 134, 227, 130, 185, 0, 227, 131, 141, 227, 131, 158, 227, 130, 183, 227, 131, 165, 0, 227, 131, 158, 227, 130, 183, 227, 130, 167, 227, 131, 188, 227, 131, 137, 0, 227, 131, 164, 227, 131, 136, 227, 130, 166, 227, 131, 162, 227, 131, 170, 0, 227, 130, 168, 227, 131, 179, 227, 131, 139, 227, 131, 165, 227, 131, 188, 227, 131, 136, 0, 227, 131, 140, 227, 130, 164, 227, 130, 179, 227, 130, 176, 227, 131, 158, 0, 227, 130, 173, 227, 131, 134, 227, 131, 171, 227, 130, 176, 227, 131, 158, 0, 227, 130, 162, 227, 131, 158, 227, 130, 171, 227, 130, 184, 0, 227, 130, 162, 227, 131, 158, 227, 131, 158, 227, 130, 164, 227, 130, 179, 0, 227, 130, 162, 227, 131, 158, 227, 131, 188, 227, 130, 184, 227, 131, 167, 0, 227, 130, 173, 227, 131, 165, 227, 131, 175, 227, 131, 175, 227, 131, 188, 0, 227, 131, 164, 227, 131, 172, 227, 131, 166, 227, 131, 188, 227, 130, 191, 227, 131, 179, 0, 227, 131, 138, 227, 130, 178, 227, 131, 132, 227, 130, 177, 227, 130, 181, 227, 131, 171, 0, 227, 130, 179, 227, 130, 189, 227, 130, 175, 227, 131, 160, 227, 130, 183, 0, 227, 130, 176, 227, 130, 189, 227, 130, 175, 227, 131, 160, 227, 130, 183, 227, 131, 163, 0, 227, 130, 185, 227, 131, 138, 227, 131, 144, 227, 130, 161, 0, 227, 130, 183, 227, 131, 173, 227, 131, 135, 227, 130, 185, 227, 131, 138, 0, 227, 131, 138, 227, 131, 158, 227, 130, 179, 227, 131, 150, 227, 130, 183, 0, 227, 130, 191, 227, 130, 164, 227, 131, 151, 239, 188, 154, 227, 131, 140, 227, 131, 171, 0, 227, 130, 183, 227, 131, 171, 227, 131, 180, 227, 130, 161, 227, 131, 135, 227, 130, 163, 0, 227, 131, 161, 227, 131, 134, 227, 131, 142, 0, 227, 131, 141, 227, 131, 131, 227, 130, 179, 227, 130, 162, 227, 131, 169, 0, 227, 131, 144, 227, 130, 175, 227, 130, 172, 227, 131, 161, 227, 130, 185, 0, 227, 131, 136, 227, 130, 178, 227, 131, 135, 227, 131, 158, 227, 131, 171, 0, 227, 131, 159, 227, 131, 159, 227, 131, 131, 227, 130, 173, 227, 131, 165, 0, 227, 131, 143, 227, 130, 174, 227, 130, 174, 227, 130, 183, 227, 131, 170, 0, 227, 130, 184, 227, 130, 184, 227, 131, 188, 227, 131, 173, 227, 131, 179, 0, 227, 131, 128, 227, 131, 128, 227, 131, 170, 227, 131, 179, 0, 227, 130, 184, 227, 131, 163, 227, 131, 169, 227, 130, 179, 0, 227, 130, 184, 227, 131, 163, 227, 131, 169, 227, 131, 179, 227, 130, 180, 0, 227, 130, 184, 227, 131, 163, 227, 131, 169, 227, 131, 169, 227, 131, 179, 227, 130, 172, 0, 227, 130, 171, 227, 131, 151, 227, 131, 187, 227, 130, 179, 227, 130, 177, 227, 130, 179, 0, 227, 130, 171, 227, 131, 151, 227, 131, 187, 227, 131, 134, 227, 131, 134, 227, 131, 149, 0, 227, 130, 171, 227, 131, 151, 227, 131, 187, 227, 131, 150, 227, 131, 171, 227, 131, 171, 0, 227, 130, 171, 227, 131, 151, 227, 131, 187, 227, 131, 172, 227, 131, 146, 227, 131, 172, 0, 227, 130, 179, 227, 130, 185, 227, 131, 162, 227, 131, 131, 227, 130, 176, 0, 227, 130, 179, 227, 130, 185, 227, 131, 162, 227, 130, 166, 227, 131, 160, 0, 227, 130, 189, 227, 131, 171, 227, 130, 172, 227, 131, 172, 227, 130, 170, 0, 227, 131, 171, 227, 131, 138, 227, 130, 162, 227, 131, 188, 227, 131, 169, 0, 227, 130, 166, 227, 131, 132, 227, 131, 173, 227, 130, 164, 227, 131, 137, 0, 227, 131, 158, 227, 131, 131, 227, 130, 183, 227, 131, 150, 227, 131, 188, 227, 131, 179, 0, 227, 131, 149, 227, 130, 167, 227, 131, 173, 227, 131, 188, 227, 131, 129, 227, 130, 167, 0, 227, 131, 135, 227, 131, 179, 227, 130, 184, 227, 131, 165, 227, 131, 162, 227, 130, 175, 0, 227, 131, 134, 227, 131, 131, 227, 130, 171, 227, 130, 176, 227, 131, 164, 0, 227, 130, 171, 227, 131, 159, 227, 131, 132, 227, 131, 171, 227, 130, 174, 0, 227, 130, 162, 227, 130, 175, 227, 130, 184, 227, 130, 173, 227, 131, 179, 227, 130, 176, 0, 227, 131, 141, 227, 130, 175, 227, 131, 173, 227, 130, 186, 227, 131, 158, 0, 227, 131, 158, 227, 130, 174, 227, 130, 162, 227, 131, 138, 0, 227, 131, 158, 227, 131, 188, 227, 130, 183, 227, 131, 163, 227, 131, 137, 227, 131, 188, 0, 227, 131, 153, 227, 131, 153, 227, 131, 142, 227, 131, 160, 0, 227, 130, 162, 227, 131, 188, 227, 130, 180, 227, 131, 168, 227, 131, 179, 0, 227, 131, 132, 227, 131, 179, 227, 131, 135, 227, 131, 132, 227, 131, 179, 227, 131, 135, 0, 227, 130, 186, 227, 130, 172, 227, 131, 137, 227, 131, 188, 227, 131, 179, 0, 227, 130, 188, 227, 131, 169, 227, 130, 170, 227, 131, 169, 0 };
-
-constexpr std::array<u8, 646> characteristic_ko = { 78, 111, 110, 101, 0, 235, 168, 185, 235, 138, 148, 32, 234, 178, 131, 236, 157, 132, 32, 236, 160, 156, 236, 157, 188, 32, 236, 162, 139, 236, 149, 132, 237, 149, 168, 0, 235, 130, 174, 236, 158, 160, 236, 157, 132, 32, 236, 158, 152, 32, 236, 158, 160, 0, 235, 167, 144, 235, 154, 157, 236, 158, 160, 236, 157, 180, 32, 235, 167, 142, 236, 157, 140, 0, 235, 172, 188, 234, 177, 180, 236, 157, 132, 32, 236, 158, 152, 32, 236, 150, 180, 236, 167, 128, 235, 166, 132, 0, 236, 156, 160, 236, 156, 160, 236, 158, 144, 236, 160, 129, 237, 149, 168, 236, 157, 132, 32, 236, 162, 139, 236, 149, 132, 237, 149, 168, 0, 237, 158, 152, 236, 158, 144, 235, 158, 145, 236, 157, 180, 32, 237, 138, 185, 234, 184, 176, 236, 158, 132, 0, 235, 130, 156, 235, 143, 153, 235, 182, 128, 235, 166, 172, 234, 184, 176, 235, 165, 188, 32, 236, 162, 139, 236, 149, 132, 237, 149, 168, 0, 236, 161, 176, 234, 184, 136, 32, 237, 153, 148, 235, 165, 188, 32, 236, 158, 152, 235, 131, 132, 0, 236, 139, 184, 236, 155, 128, 236, 157, 132, 32, 236, 162, 139, 236, 149, 132, 237, 149, 168, 0, 237, 152, 136, 234, 184, 176, 234, 176, 128, 32, 236, 153, 149, 236, 132, 177, 237, 149, 168, 0, 235, 170, 184, 236, 157, 180, 32, 237, 138, 188, 237, 138, 188, 237, 149, 168, 0, 235, 167, 183, 236, 167, 145, 236, 157, 180, 32, 234, 176, 149, 237, 149, 168, 0, 235, 129, 136, 236, 167, 136, 234, 185, 128, 0, 236, 157, 184, 235, 130, 180, 236, 139, 172, 236, 157, 180, 32, 234, 176, 149, 237, 149, 168, 0, 236, 158, 152, 32, 236, 176, 184, 236, 157, 140, 0, 235, 139, 172, 235, 166, 172, 234, 184, 176, 235, 165, 188, 32, 236, 162, 139, 236, 149, 132, 237, 149, 168, 0, 236, 163, 188, 236, 156, 132, 32, 236, 134, 140, 235, 166, 172, 236, 151, 144, 32, 235, 175, 188, 234, 176, 144, 237, 149, 168, 0, 236, 180, 144, 235, 158, 145, 235, 140, 128, 235, 138, 148, 32, 236, 132, 177, 234, 178, 169, 236, 158, 132, 0, 236, 149, 189, 234, 176, 132, 32, 236, 154, 176, 236, 173, 144, 236, 159, 129, 236, 157, 180, 236, 158, 132, 0, 235, 143, 132, 235, 167, 157, 236, 151, 144, 235, 138, 148, 32, 236, 132, 160, 236, 136, 152, 236, 158, 132, 0, 237, 152, 184, 234, 184, 176, 236, 139, 172, 236, 157, 180, 32, 234, 176, 149, 237, 149, 168, 0, 236, 158, 165, 235, 130, 156, 236, 157, 132, 32, 236, 162, 139, 236, 149, 132, 237, 149, 168, 0, 235, 185, 136, 237, 139, 136, 236, 157, 180, 32, 236, 151, 134, 236, 157, 140, 0, 234, 177, 177, 236, 160, 149, 234, 177, 176, 235, 166, 172, 234, 176, 128, 32, 235, 167, 142, 236, 157, 140, 0, 235, 167, 164, 236, 154, 176, 32, 234, 188, 188, 234, 188, 188, 237, 149, 168, 0, 234, 184, 176, 234, 176, 128, 32, 236, 132, 188, 32, 236, 132, 177, 234, 178, 169, 236, 158, 132, 0, 236, 161, 176, 234, 184, 136, 32, 234, 178, 137, 236, 185, 152, 235, 160, 136, 235, 165, 188, 32, 236, 162, 139, 236, 149, 132, 237, 149, 168, 0, 236, 152, 164, 234, 184, 176, 234, 176, 128, 32, 236, 132, 188, 32, 236, 132, 177, 234, 178, 169, 236, 158, 132, 0, 236, 167, 128, 234, 184, 176, 32, 236, 139, 171, 236, 150, 180, 237, 149, 168, 0, 236, 161, 176, 234, 184, 136, 32, 234, 179, 160, 236, 167, 145, 237, 134, 181, 236, 157, 180, 236, 158, 132, 0 };
-
-constexpr std::array<u8, 2185> dppt_ko = { 48, 44, 67, 97, 110, 97, 108, 97, 118, 101, 32, 67, 105, 116, 121, 0, 49, 44, 69, 116, 101, 114, 110, 97, 32, 67, 105, 116, 121, 0, 50, 44, 80, 97, 115, 116, 111, 114, 105, 97, 32, 67, 105, 116, 121, 0, 51, 44, 83, 117, 110, 121, 115, 104, 111, 114, 101, 32, 67, 105, 116, 121, 0, 52, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 76, 101, 97, 103, 117, 101, 0, 53, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 77, 105, 110, 101, 32, 49, 70, 0, 54, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 77, 105, 110, 101, 32, 66, 49, 70, 0, 55, 44, 86, 97, 108, 108, 101, 121, 32, 87, 105, 110, 100, 119, 111, 114, 107, 115, 0, 56, 44, 69, 116, 101, 114, 110, 97, 32, 70, 111, 114, 101, 115, 116, 0, 57, 44, 70, 117, 101, 103, 111, 32, 73, 114, 111, 110, 119, 111, 114, 107, 115, 0, 49, 48, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 40, 82, 111, 117, 116, 101, 32, 50, 48, 55, 47, 50, 48, 56, 32, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 49, 49, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 50, 70, 0, 49, 50, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 51, 70, 0, 49, 51, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 83, 110, 111, 119, 0, 49, 52, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 52, 70, 0, 49, 53, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 53, 70, 0, 49, 54, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 54, 70, 0, 49, 55, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 55, 70, 0, 49, 56, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 84, 111, 112, 32, 67, 97, 118, 101, 0, 49, 57, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 40, 82, 111, 117, 116, 101, 32, 50, 49, 54, 32, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 50, 48, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 40, 82, 111, 117, 116, 101, 32, 50, 49, 49, 32, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 50, 49, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 66, 49, 70, 0, 50, 50, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 49, 0, 50, 51, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 50, 0, 50, 52, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 51, 0, 50, 53, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 52, 0, 50, 54, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 53, 0, 50, 55, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 54, 0, 50, 56, 44, 83, 111, 108, 97, 99, 101, 111, 110, 32, 82, 117, 105, 110, 115, 0, 50, 57, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 51, 48, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 50, 70, 0, 51, 49, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 49, 70, 0, 51, 50, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 97, 99, 107, 32, 82, 111, 111, 109, 32, 49, 0, 51, 51, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 97, 99, 107, 32, 82, 111, 111, 109, 32, 50, 0, 51, 52, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 97, 99, 107, 32, 82, 111, 111, 109, 32, 51, 0, 51, 53, 44, 82, 97, 118, 97, 103, 101, 100, 32, 80, 97, 116, 104, 0, 51, 54, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 71, 97, 116, 101, 32, 49, 70, 0, 51, 55, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 71, 97, 116, 101, 32, 66, 49, 70, 0, 51, 56, 44, 83, 116, 97, 114, 107, 32, 77, 111, 117, 110, 116, 97, 105, 110, 0, 51, 57, 44, 83, 116, 97, 114, 107, 32, 77, 111, 117, 110, 116, 97, 105, 110, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 52, 48, 44, 83, 116, 97, 114, 107, 32, 77, 111, 117, 110, 116, 97, 105, 110, 32, 73, 110, 116, 101, 114, 105, 111, 114, 0, 52, 49, 44, 83, 101, 110, 100, 111, 102, 102, 32, 83, 112, 114, 105, 110, 103, 0, 52, 50, 44, 84, 117, 114, 110, 98, 97, 99, 107, 32, 67, 97, 118, 101, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 52, 51, 44, 84, 117, 114, 110, 98, 97, 99, 107, 32, 67, 97, 118, 101, 32, 49, 115, 116, 32, 80, 105, 108, 108, 97, 114, 0, 52, 52, 44, 84, 117, 114, 110, 98, 97, 99, 107, 32, 67, 97, 118, 101, 32, 50, 110, 100, 32, 80, 105, 108, 108, 97, 114, 0, 52, 53, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 49, 70, 0, 52, 54, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 49, 70, 0, 52, 55, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 50, 70, 0, 52, 56, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 51, 70, 0, 52, 57, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 52, 70, 0, 53, 48, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 53, 70, 0, 53, 49, 44, 87, 97, 121, 119, 97, 114, 100, 32, 67, 97, 118, 101, 0, 53, 50, 44, 87, 97, 121, 119, 97, 114, 100, 32, 67, 97, 118, 101, 32, 40, 83, 101, 99, 114, 101, 116, 41, 0, 53, 51, 44, 82, 117, 105, 110, 32, 77, 97, 110, 105, 97, 99, 32, 67, 97, 118, 101, 32, 40, 60, 32, 49, 48, 32, 85, 110, 111, 119, 110, 41, 0, 53, 52, 44, 82, 117, 105, 110, 32, 77, 97, 110, 105, 97, 99, 32, 67, 97, 118, 101, 32, 40, 62, 32, 49, 48, 32, 85, 110, 111, 119, 110, 41, 0, 53, 53, 44, 77, 97, 110, 105, 97, 99, 32, 84, 117, 110, 110, 101, 108, 0, 53, 54, 44, 84, 114, 111, 112, 104, 121, 32, 71, 97, 114, 100, 101, 110, 0, 53, 55, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 0, 53, 56, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 49, 70, 0, 53, 57, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 49, 70, 0, 54, 48, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 50, 70, 32, 40, 76, 101, 102, 116, 41, 0, 54, 49, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 50, 70, 32, 40, 82, 105, 103, 104, 116, 41, 0, 54, 50, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 51, 70, 0, 54, 51, 44, 79, 108, 100, 32, 67, 104, 97, 116, 101, 97, 117, 0, 54, 52, 44, 79, 108, 100, 32, 67, 104, 97, 116, 101, 97, 117, 32, 82, 111, 111, 109, 32, 53, 0, 54, 53, 44, 76, 97, 107, 101, 32, 86, 101, 114, 105, 116, 121, 0, 54, 54, 44, 76, 97, 107, 101, 32, 86, 97, 108, 111, 114, 0, 54, 55, 44, 76, 97, 107, 101, 32, 65, 99, 117, 105, 116, 121, 0, 54, 56, 44, 86, 97, 108, 111, 114, 32, 76, 97, 107, 101, 102, 114, 111, 110, 116, 0, 54, 57, 44, 65, 99, 117, 105, 116, 121, 32, 76, 97, 107, 101, 102, 114, 111, 110, 116, 0, 55, 48, 44, 82, 111, 117, 116, 101, 32, 50, 48, 49, 0, 55, 49, 44, 82, 111, 117, 116, 101, 32, 50, 48, 50, 0, 55, 50, 44, 82, 111, 117, 116, 101, 32, 50, 48, 51, 0, 55, 51, 44, 82, 111, 117, 116, 101, 32, 50, 48, 52, 32, 40, 83, 111, 117, 116, 104, 41, 0, 55, 52, 44, 82, 111, 117, 116, 101, 32, 50, 48, 52, 32, 40, 78, 111, 114, 116, 104, 41, 0, 55, 53, 44, 82, 111, 117, 116, 101, 32, 50, 48, 53, 32, 40, 83, 111, 117, 116, 104, 41, 0, 55, 54, 44, 82, 111, 117, 116, 101, 32, 50, 48, 53, 32, 40, 78, 111, 114, 116, 104, 41, 0, 55, 55, 44, 82, 111, 117, 116, 101, 32, 50, 48, 54, 0, 55, 56, 44, 82, 111, 117, 116, 101, 32, 50, 48, 55, 0, 55, 57, 44, 82, 111, 117, 116, 101, 32, 50, 48, 56, 0, 56, 48, 44, 82, 111, 117, 116, 101, 32, 50, 48, 57, 0, 56, 49, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 49, 70, 0, 56, 50, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 50, 70, 0, 56, 51, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 51, 70, 0, 56, 52, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 52, 70, 0, 56, 53, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 53, 70, 0, 56, 54, 44, 82, 111, 117, 116, 101, 32, 50, 49, 48, 32, 40, 83, 111, 117, 116, 104, 41, 0, 56, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 48, 32, 40, 78, 111, 114, 116, 104, 41, 0, 56, 56, 44, 82, 111, 117, 116, 101, 32, 50, 49, 49, 32, 40, 87, 101, 115, 116, 41, 0, 56, 57, 44, 82, 111, 117, 116, 101, 32, 50, 49, 49, 32, 40, 69, 97, 115, 116, 41, 0, 57, 48, 44, 82, 111, 117, 116, 101, 32, 50, 49, 50, 32, 40, 78, 111, 114, 116, 104, 41, 0, 57, 49, 44, 82, 111, 117, 116, 101, 32, 50, 49, 50, 32, 40, 83, 111, 117, 116, 104, 41, 0, 57, 50, 44, 82, 111, 117, 116, 101, 32, 50, 49, 51, 0, 57, 51, 44, 82, 111, 117, 116, 101, 32, 50, 49, 52, 0, 57, 52, 44, 82, 111, 117, 116, 101, 32, 50, 49, 53, 0, 57, 53, 44, 82, 111, 117, 116, 101, 32, 50, 49, 54, 0, 57, 54, 44, 82, 111, 117, 116, 101, 32, 50, 49, 55, 0, 57, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 56, 0, 57, 56, 44, 82, 111, 117, 116, 101, 32, 50, 49, 57, 0, 57, 57, 44, 82, 111, 117, 116, 101, 32, 50, 50, 49, 0, 49, 48, 48, 44, 82, 111, 117, 116, 101, 32, 50, 50, 50, 0, 49, 48, 49, 44, 82, 111, 117, 116, 101, 32, 50, 50, 52, 0, 49, 48, 50, 44, 82, 111, 117, 116, 101, 32, 50, 50, 53, 0, 49, 48, 51, 44, 82, 111, 117, 116, 101, 32, 50, 50, 55, 0, 49, 48, 52, 44, 82, 111, 117, 116, 101, 32, 50, 50, 56, 0, 49, 48, 53, 44, 82, 111, 117, 116, 101, 32, 50, 50, 57, 0, 49, 48, 54, 44, 84, 119, 105, 110, 108, 101, 97, 102, 32, 84, 111, 119, 110, 0, 49, 48, 55, 44, 67, 101, 108, 101, 115, 116, 105, 99, 32, 84, 111, 119, 110, 0, 49, 48, 56, 44, 82, 101, 115, 111, 114, 116, 32, 65, 114, 101, 97, 0, 49, 48, 57, 44, 82, 111, 117, 116, 101, 32, 50, 50, 48, 0, 49, 49, 48, 44, 82, 111, 117, 116, 101, 32, 50, 50, 51, 0, 49, 49, 49, 44, 82, 111, 117, 116, 101, 32, 50, 50, 54, 0, 49, 49, 50, 44, 82, 111, 117, 116, 101, 32, 50, 51, 48, 0 };
-
-constexpr std::array<u8, 1799> frlg_ko = { 48, 44, 80, 97, 108, 108, 101, 116, 32, 84, 111, 119, 110, 0, 49, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 67, 105, 116, 121, 0, 50, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 105, 116, 121, 0, 51, 44, 86, 101, 114, 109, 105, 108, 105, 111, 110, 32, 67, 105, 116, 121, 0, 52, 44, 67, 101, 108, 97, 100, 111, 110, 32, 67, 105, 116, 121, 0, 53, 44, 70, 117, 99, 104, 115, 105, 97, 32, 67, 105, 116, 121, 0, 54, 44, 67, 105, 110, 110, 97, 98, 97, 114, 32, 73, 115, 108, 97, 110, 100, 0, 55, 44, 82, 111, 117, 116, 101, 32, 49, 0, 56, 44, 82, 111, 117, 116, 101, 32, 50, 0, 57, 44, 82, 111, 117, 116, 101, 32, 51, 0, 49, 48, 44, 82, 111, 117, 116, 101, 32, 52, 0, 49, 49, 44, 82, 111, 117, 116, 101, 32, 53, 0, 49, 50, 44, 82, 111, 117, 116, 101, 32, 54, 0, 49, 51, 44, 82, 111, 117, 116, 101, 32, 55, 0, 49, 52, 44, 82, 111, 117, 116, 101, 32, 56, 0, 49, 53, 44, 82, 111, 117, 116, 101, 32, 57, 0, 49, 54, 44, 82, 111, 117, 116, 101, 32, 49, 48, 0, 49, 55, 44, 82, 111, 117, 116, 101, 32, 49, 49, 0, 49, 56, 44, 82, 111, 117, 116, 101, 32, 49, 50, 0, 49, 57, 44, 82, 111, 117, 116, 101, 32, 49, 51, 0, 50, 48, 44, 82, 111, 117, 116, 101, 32, 49, 52, 0, 50, 49, 44, 82, 111, 117, 116, 101, 32, 49, 53, 0, 50, 50, 44, 82, 111, 117, 116, 101, 32, 49, 54, 0, 50, 51, 44, 82, 111, 117, 116, 101, 32, 49, 55, 0, 50, 52, 44, 82, 111, 117, 116, 101, 32, 49, 56, 0, 50, 53, 44, 82, 111, 117, 116, 101, 32, 49, 57, 0, 50, 54, 44, 82, 111, 117, 116, 101, 32, 50, 48, 0, 50, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 0, 50, 56, 44, 82, 111, 117, 116, 101, 32, 50, 50, 0, 50, 57, 44, 82, 111, 117, 116, 101, 32, 50, 51, 0, 51, 48, 44, 82, 111, 117, 116, 101, 32, 50, 52, 0, 51, 49, 44, 82, 111, 117, 116, 101, 32, 50, 53, 0, 51, 50, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 70, 111, 114, 101, 115, 116, 0, 51, 51, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 49, 70, 0, 51, 52, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 66, 49, 70, 0, 51, 53, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 66, 50, 70, 0, 51, 54, 44, 83, 46, 83, 46, 32, 65, 110, 110, 101, 0, 51, 55, 44, 68, 105, 103, 108, 101, 116, 116, 39, 115, 32, 67, 97, 118, 101, 0, 51, 56, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 51, 57, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 50, 70, 0, 52, 48, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 51, 70, 0, 52, 49, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 77, 97, 110, 115, 105, 111, 110, 32, 49, 70, 45, 51, 70, 0, 52, 50, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 77, 97, 110, 115, 105, 111, 110, 32, 66, 49, 70, 0, 52, 51, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 67, 101, 110, 116, 101, 114, 0, 52, 52, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 49, 0, 52, 53, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 50, 0, 52, 54, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 51, 0, 52, 55, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 49, 70, 0, 52, 56, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 66, 49, 70, 0, 52, 57, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 49, 70, 0, 53, 48, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 49, 70, 0, 53, 49, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 50, 70, 0, 53, 50, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 51, 70, 0, 53, 51, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 52, 70, 0, 53, 52, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 51, 70, 0, 53, 53, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 52, 70, 0, 53, 54, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 53, 70, 0, 53, 55, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 54, 70, 0, 53, 56, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 55, 70, 0, 53, 57, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 49, 70, 0, 54, 48, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 50, 70, 0, 54, 49, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 54, 50, 44, 80, 111, 119, 101, 114, 32, 80, 108, 97, 110, 116, 0, 54, 51, 44, 79, 110, 101, 32, 73, 115, 108, 97, 110, 100, 0, 54, 52, 44, 70, 111, 117, 114, 32, 73, 115, 108, 97, 110, 100, 0, 54, 53, 44, 70, 105, 118, 101, 32, 73, 115, 108, 97, 110, 100, 0, 54, 54, 44, 75, 105, 110, 100, 108, 101, 32, 82, 111, 97, 100, 0, 54, 55, 44, 84, 114, 101, 97, 115, 117, 114, 101, 32, 66, 101, 97, 99, 104, 0, 54, 56, 44, 67, 97, 112, 101, 32, 66, 114, 105, 110, 107, 0, 54, 57, 44, 66, 111, 110, 100, 32, 66, 114, 105, 100, 103, 101, 0, 55, 48, 44, 84, 104, 114, 101, 101, 32, 73, 115, 108, 101, 32, 80, 111, 114, 116, 0, 55, 49, 44, 82, 101, 115, 111, 114, 116, 32, 71, 111, 114, 103, 101, 111, 117, 115, 0, 55, 50, 44, 87, 97, 116, 101, 114, 32, 76, 97, 98, 121, 114, 105, 110, 116, 104, 0, 55, 51, 44, 70, 105, 118, 101, 32, 73, 115, 108, 101, 32, 77, 101, 97, 100, 111, 119, 0, 55, 52, 44, 77, 101, 109, 111, 114, 105, 97, 108, 32, 80, 105, 108, 108, 97, 114, 0, 55, 53, 44, 79, 117, 116, 99, 97, 115, 116, 32, 73, 115, 108, 97, 110, 100, 0, 55, 54, 44, 71, 114, 101, 101, 110, 32, 80, 97, 116, 104, 0, 55, 55, 44, 87, 97, 116, 101, 114, 32, 80, 97, 116, 104, 0, 55, 56, 44, 82, 117, 105, 110, 32, 86, 97, 108, 108, 101, 121, 0, 55, 57, 44, 84, 114, 97, 105, 110, 101, 114, 32, 84, 111, 119, 101, 114, 32, 40, 101, 120, 116, 101, 114, 105, 111, 114, 41, 0, 56, 48, 44, 67, 97, 110, 121, 111, 110, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 56, 49, 44, 83, 101, 118, 97, 117, 108, 116, 32, 67, 97, 110, 121, 111, 110, 0, 56, 50, 44, 84, 97, 110, 111, 98, 121, 32, 82, 117, 105, 110, 115, 0, 56, 51, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 0, 56, 52, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 82, 111, 111, 109, 32, 49, 0, 56, 53, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 82, 111, 111, 109, 32, 50, 0, 56, 54, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 82, 111, 111, 109, 32, 51, 0, 56, 55, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 49, 70, 0, 56, 56, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 49, 70, 0, 56, 57, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 50, 70, 0, 57, 48, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 51, 70, 0, 57, 49, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 52, 70, 0, 57, 50, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 53, 70, 0, 57, 51, 44, 66, 101, 114, 114, 121, 32, 70, 111, 114, 101, 115, 116, 0, 57, 52, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 0, 57, 53, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 32, 49, 70, 0, 57, 54, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 57, 55, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 32, 66, 97, 99, 107, 0, 57, 56, 44, 80, 97, 116, 116, 101, 114, 110, 32, 66, 117, 115, 104, 0, 57, 57, 44, 65, 108, 116, 101, 114, 105, 110, 103, 32, 67, 97, 118, 101, 0, 49, 48, 48, 44, 77, 111, 110, 101, 97, 110, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 49, 44, 76, 105, 112, 116, 111, 111, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 50, 44, 87, 101, 101, 112, 116, 104, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 51, 44, 68, 105, 108, 102, 111, 114, 100, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 52, 44, 83, 99, 117, 102, 105, 98, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 53, 44, 82, 105, 120, 121, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 54, 44, 86, 105, 97, 112, 111, 105, 115, 32, 67, 104, 97, 109, 98, 101, 114, 0 };
-
-constexpr std::array<u8, 1948> hgss_ko = { 48, 44, 78, 101, 119, 32, 66, 97, 114, 107, 32, 84, 111, 119, 110, 0, 49, 44, 82, 111, 117, 116, 101, 32, 50, 57, 0, 50, 44, 67, 104, 101, 114, 114, 121, 103, 114, 111, 118, 101, 32, 67, 105, 116, 121, 0, 51, 44, 82, 111, 117, 116, 101, 32, 51, 48, 0, 52, 44, 82, 111, 117, 116, 101, 32, 51, 49, 0, 53, 44, 86, 105, 111, 108, 101, 116, 32, 67, 105, 116, 121, 0, 54, 44, 83, 112, 114, 111, 117, 116, 32, 84, 111, 119, 101, 114, 0, 55, 44, 82, 111, 117, 116, 101, 32, 51, 50, 0, 56, 44, 82, 117, 105, 110, 115, 32, 111, 102, 32, 65, 108, 112, 104, 32, 40, 79, 117, 116, 115, 105, 100, 101, 41, 0, 57, 44, 82, 117, 105, 110, 115, 32, 111, 102, 32, 65, 108, 112, 104, 32, 40, 73, 110, 115, 105, 100, 101, 41, 0, 49, 48, 44, 85, 110, 105, 111, 110, 32, 67, 97, 118, 101, 32, 49, 70, 0, 49, 49, 44, 85, 110, 105, 111, 110, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 49, 50, 44, 85, 110, 105, 111, 110, 32, 67, 97, 118, 101, 32, 66, 50, 70, 0, 49, 51, 44, 82, 111, 117, 116, 101, 32, 51, 51, 0, 49, 52, 44, 83, 76, 79, 87, 80, 79, 75, 69, 32, 87, 101, 108, 108, 32, 49, 70, 0, 49, 53, 44, 83, 76, 79, 87, 80, 79, 75, 69, 32, 87, 101, 108, 108, 32, 66, 49, 70, 0, 49, 54, 44, 73, 108, 101, 120, 32, 70, 111, 114, 101, 115, 116, 0, 49, 55, 44, 82, 111, 117, 116, 101, 32, 51, 52, 0, 49, 56, 44, 82, 111, 117, 116, 101, 32, 51, 53, 0, 49, 57, 44, 78, 97, 116, 105, 111, 110, 97, 108, 32, 80, 97, 114, 107, 0, 50, 48, 44, 82, 111, 117, 116, 101, 32, 51, 54, 0, 50, 49, 44, 82, 111, 117, 116, 101, 32, 51, 55, 0, 50, 50, 44, 69, 99, 114, 117, 116, 101, 97, 107, 32, 67, 105, 116, 121, 0, 50, 51, 44, 66, 117, 114, 110, 101, 100, 32, 84, 111, 119, 101, 114, 32, 49, 70, 0, 50, 52, 44, 66, 117, 114, 110, 101, 100, 32, 84, 111, 119, 101, 114, 32, 66, 49, 70, 0, 50, 53, 44, 66, 101, 108, 108, 32, 84, 111, 119, 101, 114, 0, 50, 54, 44, 82, 111, 117, 116, 101, 32, 51, 56, 0, 50, 55, 44, 82, 111, 117, 116, 101, 32, 51, 57, 0, 50, 56, 44, 79, 108, 105, 118, 105, 110, 101, 32, 67, 105, 116, 121, 0, 50, 57, 44, 82, 111, 117, 116, 101, 32, 52, 48, 0, 51, 48, 44, 82, 111, 117, 116, 101, 32, 52, 49, 0, 51, 49, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 49, 70, 0, 51, 50, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 49, 70, 0, 51, 51, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 50, 70, 0, 51, 52, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 51, 70, 0, 51, 53, 44, 67, 105, 97, 110, 119, 111, 111, 100, 32, 67, 105, 116, 121, 0, 51, 54, 44, 82, 111, 117, 116, 101, 32, 52, 50, 0, 51, 55, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 49, 70, 0, 51, 56, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 49, 70, 32, 40, 66, 97, 99, 107, 41, 0, 51, 57, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 50, 70, 0, 52, 48, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 66, 49, 70, 0, 52, 49, 44, 82, 111, 117, 116, 101, 32, 52, 51, 0, 52, 50, 44, 76, 97, 107, 101, 32, 111, 102, 32, 82, 97, 103, 101, 0, 52, 51, 44, 82, 111, 117, 116, 101, 32, 52, 52, 0, 52, 52, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 49, 70, 0, 52, 53, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 66, 49, 70, 0, 52, 54, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 66, 50, 70, 0, 52, 55, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 66, 51, 70, 0, 52, 56, 44, 66, 108, 97, 99, 107, 116, 104, 111, 114, 110, 32, 67, 105, 116, 121, 0, 52, 57, 44, 68, 114, 97, 103, 111, 110, 226, 128, 153, 115, 32, 68, 101, 110, 0, 53, 48, 44, 82, 111, 117, 116, 101, 32, 52, 53, 0, 53, 49, 44, 82, 111, 117, 116, 101, 32, 52, 54, 0, 53, 50, 44, 68, 97, 114, 107, 32, 67, 97, 118, 101, 32, 40, 82, 111, 117, 116, 101, 32, 51, 49, 41, 0, 53, 51, 44, 68, 97, 114, 107, 32, 67, 97, 118, 101, 32, 40, 82, 111, 117, 116, 101, 32, 52, 53, 41, 0, 53, 52, 44, 82, 111, 117, 116, 101, 32, 52, 55, 0, 53, 53, 44, 77, 116, 46, 32, 77, 111, 111, 110, 0, 53, 54, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 40, 67, 108, 101, 102, 97, 105, 114, 121, 41, 0, 53, 55, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 49, 70, 0, 53, 56, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 49, 70, 0, 53, 57, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 50, 70, 0, 54, 48, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 51, 70, 0, 54, 49, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 52, 70, 0, 54, 50, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 49, 70, 0, 54, 51, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 67, 97, 118, 101, 32, 49, 70, 32, 84, 111, 112, 0, 54, 52, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 52, 70, 0, 54, 53, 44, 67, 108, 105, 102, 102, 32, 69, 100, 103, 101, 32, 71, 97, 116, 101, 0, 54, 54, 44, 67, 108, 105, 102, 102, 32, 67, 97, 118, 101, 0, 54, 55, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 0, 54, 56, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 50, 70, 0, 54, 57, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 67, 97, 118, 101, 32, 77, 111, 117, 110, 116, 97, 105, 110, 115, 105, 100, 101, 0, 55, 48, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 67, 97, 118, 101, 32, 51, 70, 0, 55, 49, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 84, 111, 112, 0, 55, 50, 44, 82, 111, 117, 116, 101, 32, 49, 50, 0, 55, 51, 44, 82, 111, 117, 116, 101, 32, 49, 57, 0, 55, 52, 44, 82, 111, 117, 116, 101, 32, 50, 48, 0, 55, 53, 44, 80, 97, 108, 108, 101, 116, 32, 84, 111, 119, 110, 0, 55, 54, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 67, 105, 116, 121, 0, 55, 55, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 105, 116, 121, 0, 55, 56, 44, 86, 101, 114, 109, 105, 108, 105, 111, 110, 32, 67, 105, 116, 121, 0, 55, 57, 44, 67, 101, 108, 97, 100, 111, 110, 32, 67, 105, 116, 121, 0, 56, 48, 44, 70, 117, 99, 104, 115, 105, 97, 32, 67, 105, 116, 121, 0, 56, 49, 44, 67, 105, 110, 110, 97, 98, 97, 114, 32, 73, 115, 108, 97, 110, 100, 0, 56, 50, 44, 82, 111, 117, 116, 101, 32, 52, 56, 0, 56, 51, 44, 82, 111, 117, 116, 101, 32, 50, 54, 0, 56, 52, 44, 82, 111, 117, 116, 101, 32, 50, 55, 0, 56, 53, 44, 82, 111, 117, 116, 101, 32, 50, 56, 0, 56, 54, 44, 77, 116, 46, 32, 77, 111, 111, 110, 0, 56, 55, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 49, 70, 0, 56, 56, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 50, 70, 0, 56, 57, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 57, 48, 44, 82, 111, 117, 116, 101, 32, 49, 0, 57, 49, 44, 82, 111, 117, 116, 101, 32, 50, 32, 40, 83, 111, 117, 116, 104, 41, 0, 57, 50, 44, 82, 111, 117, 116, 101, 32, 51, 0, 57, 51, 44, 82, 111, 117, 116, 101, 32, 52, 0, 57, 52, 44, 82, 111, 117, 116, 101, 32, 53, 0, 57, 53, 44, 82, 111, 117, 116, 101, 32, 54, 0, 57, 54, 44, 82, 111, 117, 116, 101, 32, 55, 0, 57, 55, 44, 82, 111, 117, 116, 101, 32, 56, 0, 57, 56, 44, 82, 111, 117, 116, 101, 32, 57, 0, 57, 57, 44, 82, 111, 117, 116, 101, 32, 49, 48, 0, 49, 48, 48, 44, 82, 111, 117, 116, 101, 32, 49, 49, 0, 49, 48, 49, 44, 82, 111, 117, 116, 101, 32, 49, 51, 0, 49, 48, 50, 44, 82, 111, 117, 116, 101, 32, 49, 52, 0, 49, 48, 51, 44, 82, 111, 117, 116, 101, 32, 49, 53, 0, 49, 48, 52, 44, 82, 111, 117, 116, 101, 32, 49, 54, 0, 49, 48, 53, 44, 82, 111, 117, 116, 101, 32, 49, 55, 0, 49, 48, 54, 44, 82, 111, 117, 116, 101, 32, 49, 56, 0, 49, 48, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 0, 49, 48, 56, 44, 82, 111, 117, 116, 101, 32, 50, 50, 0, 49, 48, 57, 44, 82, 111, 117, 116, 101, 32, 50, 52, 0, 49, 49, 48, 44, 82, 111, 117, 116, 101, 32, 50, 53, 0, 49, 49, 49, 44, 84, 111, 104, 106, 111, 32, 70, 97, 108, 108, 115, 0, 49, 49, 50, 44, 68, 73, 71, 76, 69, 84, 84, 226, 128, 153, 115, 32, 67, 97, 118, 101, 0, 49, 49, 51, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 50, 70, 0, 49, 49, 52, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 51, 70, 0, 49, 49, 53, 44, 82, 111, 117, 116, 101, 32, 50, 32, 40, 78, 111, 114, 116, 104, 41, 0, 49, 49, 54, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 70, 111, 114, 101, 115, 116, 0, 49, 49, 55, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 49, 70, 0, 49, 49, 56, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 50, 70, 0, 49, 49, 57, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0 };
-
-constexpr std::array<u8, 211> natures_ko = { 235, 133, 184, 235, 160, 165, 0, 236, 153, 184, 235, 161, 156, 236, 155, 128, 0, 236, 154, 169, 234, 176, 144, 0, 234, 179, 160, 236, 167, 145, 0, 234, 176, 156, 234, 181, 172, 236, 159, 129, 236, 157, 180, 0, 235, 140, 128, 235, 139, 180, 0, 236, 152, 168, 236, 136, 156, 0, 235, 172, 180, 236, 130, 172, 237, 131, 156, 237, 143, 137, 0, 236, 158, 165, 235, 130, 156, 234, 190, 184, 235, 159, 172, 234, 184, 176, 0, 236, 180, 144, 235, 158, 145, 0, 234, 178, 129, 236, 159, 129, 236, 157, 180, 0, 236, 132, 177, 234, 184, 137, 0, 236, 132, 177, 236, 139, 164, 0, 235, 170, 133, 235, 158, 145, 0, 236, 178, 156, 236, 167, 132, 235, 130, 156, 235, 167, 140, 0, 236, 161, 176, 236, 139, 172, 0, 236, 157, 152, 236, 160, 147, 0, 235, 131, 137, 236, 160, 149, 0, 236, 136, 152, 236, 164, 141, 236, 157, 140, 0, 235, 141, 156, 235, 160, 129, 0, 236, 176, 168, 235, 182, 132, 0, 236, 150, 140, 236, 160, 132, 0, 234, 177, 180, 235, 176, 169, 0, 236, 139, 160, 236, 164, 145, 0, 235, 179, 128, 235, 141, 149, 0 };
-
-constexpr std::array<u8, 106> powers_ko = { 234, 178, 169, 237, 136, 172, 0, 235, 185, 132, 237, 150, 137, 0, 235, 143, 133, 0, 235, 149, 133, 0, 235, 176, 148, 236, 156, 132, 0, 235, 178, 140, 235, 160, 136, 0, 234, 179, 160, 236, 138, 164, 237, 138, 184, 0, 234, 176, 149, 236, 178, 160, 0, 235, 182, 136, 234, 189, 131, 0, 235, 172, 188, 0, 237, 146, 128, 0, 236, 160, 132, 234, 184, 176, 0, 236, 151, 144, 236, 138, 164, 237, 141, 188, 0, 236, 150, 188, 236, 157, 140, 0, 235, 147, 156, 235, 158, 152, 234, 179, 164, 0, 236, 149, 133, 0 };
-
-constexpr std::array<u8, 1480> rse_ko = { 48, 44, 68, 101, 119, 102, 111, 114, 100, 32, 84, 111, 119, 110, 0, 49, 44, 80, 97, 99, 105, 102, 105, 100, 108, 111, 103, 32, 84, 111, 119, 110, 0, 50, 44, 80, 101, 116, 97, 108, 98, 117, 114, 103, 32, 67, 105, 116, 121, 0, 51, 44, 83, 108, 97, 116, 101, 112, 111, 114, 116, 32, 67, 105, 116, 121, 0, 52, 44, 76, 105, 108, 121, 99, 111, 118, 101, 32, 67, 105, 116, 121, 0, 53, 44, 77, 111, 115, 115, 100, 101, 101, 112, 32, 67, 105, 116, 121, 0, 54, 44, 83, 111, 111, 116, 111, 112, 111, 108, 105, 115, 32, 67, 105, 116, 121, 0, 55, 44, 69, 118, 101, 114, 32, 71, 114, 97, 110, 100, 101, 32, 67, 105, 116, 121, 0, 56, 44, 82, 111, 117, 116, 101, 32, 49, 48, 49, 0, 57, 44, 82, 111, 117, 116, 101, 32, 49, 48, 50, 0, 49, 48, 44, 82, 111, 117, 116, 101, 32, 49, 48, 51, 0, 49, 49, 44, 82, 111, 117, 116, 101, 32, 49, 48, 52, 0, 49, 50, 44, 82, 111, 117, 116, 101, 32, 49, 48, 53, 0, 49, 51, 44, 82, 111, 117, 116, 101, 32, 49, 48, 54, 0, 49, 52, 44, 82, 111, 117, 116, 101, 32, 49, 48, 55, 0, 49, 53, 44, 82, 111, 117, 116, 101, 32, 49, 48, 56, 0, 49, 54, 44, 82, 111, 117, 116, 101, 32, 49, 48, 57, 0, 49, 55, 44, 82, 111, 117, 116, 101, 32, 49, 49, 48, 0, 49, 56, 44, 82, 111, 117, 116, 101, 32, 49, 49, 49, 0, 49, 57, 44, 82, 111, 117, 116, 101, 32, 49, 49, 50, 0, 50, 48, 44, 82, 111, 117, 116, 101, 32, 49, 49, 51, 0, 50, 49, 44, 82, 111, 117, 116, 101, 32, 49, 49, 52, 0, 50, 50, 44, 82, 111, 117, 116, 101, 32, 49, 49, 53, 0, 50, 51, 44, 82, 111, 117, 116, 101, 32, 49, 49, 54, 0, 50, 52, 44, 82, 111, 117, 116, 101, 32, 49, 49, 55, 0, 50, 53, 44, 82, 111, 117, 116, 101, 32, 49, 49, 56, 0, 50, 54, 44, 82, 111, 117, 116, 101, 32, 49, 49, 57, 0, 50, 55, 44, 82, 111, 117, 116, 101, 32, 49, 50, 48, 0, 50, 56, 44, 82, 111, 117, 116, 101, 32, 49, 50, 49, 0, 50, 57, 44, 82, 111, 117, 116, 101, 32, 49, 50, 50, 0, 51, 48, 44, 82, 111, 117, 116, 101, 32, 49, 50, 51, 0, 51, 49, 44, 82, 111, 117, 116, 101, 32, 49, 50, 52, 0, 51, 50, 44, 82, 111, 117, 116, 101, 32, 49, 50, 53, 0, 51, 51, 44, 82, 111, 117, 116, 101, 32, 49, 50, 54, 0, 51, 52, 44, 82, 111, 117, 116, 101, 32, 49, 50, 55, 0, 51, 53, 44, 82, 111, 117, 116, 101, 32, 49, 50, 56, 0, 51, 54, 44, 82, 111, 117, 116, 101, 32, 49, 50, 57, 0, 51, 55, 44, 82, 111, 117, 116, 101, 32, 49, 51, 48, 0, 51, 56, 44, 82, 111, 117, 116, 101, 32, 49, 51, 49, 0, 51, 57, 44, 82, 111, 117, 116, 101, 32, 49, 51, 50, 0, 52, 48, 44, 82, 111, 117, 116, 101, 32, 49, 51, 51, 0, 52, 49, 44, 82, 111, 117, 116, 101, 32, 49, 51, 52, 0, 52, 50, 44, 85, 110, 100, 101, 114, 119, 97, 116, 101, 114, 32, 40, 82, 111, 117, 116, 101, 32, 49, 50, 52, 41, 0, 52, 51, 44, 85, 110, 100, 101, 114, 119, 97, 116, 101, 114, 32, 40, 82, 111, 117, 116, 101, 32, 49, 50, 54, 41, 0, 52, 52, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 49, 70, 0, 52, 53, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 83, 116, 101, 118, 101, 110, 39, 115, 32, 82, 111, 111, 109, 0, 52, 54, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 52, 55, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 66, 50, 70, 0, 52, 56, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 49, 0, 52, 57, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 50, 0, 53, 48, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 51, 0, 53, 49, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 52, 0, 53, 50, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 53, 0, 53, 51, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 54, 0, 53, 52, 44, 80, 101, 116, 97, 108, 98, 117, 114, 103, 32, 87, 111, 111, 100, 115, 0, 53, 53, 44, 82, 117, 115, 116, 117, 114, 102, 32, 84, 117, 110, 110, 101, 108, 0, 53, 54, 44, 65, 98, 97, 110, 100, 111, 110, 101, 100, 32, 83, 104, 105, 112, 0, 53, 55, 44, 78, 101, 119, 32, 77, 97, 117, 118, 105, 108, 108, 101, 32, 40, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 53, 56, 44, 78, 101, 119, 32, 77, 97, 117, 118, 105, 108, 108, 101, 32, 40, 66, 97, 115, 101, 109, 101, 110, 116, 41, 0, 53, 57, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 49, 70, 32, 49, 82, 0, 54, 48, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 49, 70, 32, 50, 82, 0, 54, 49, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 66, 49, 70, 32, 49, 82, 0, 54, 50, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 66, 49, 70, 32, 50, 82, 0, 54, 51, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 83, 116, 101, 118, 101, 110, 39, 115, 32, 67, 97, 118, 101, 0, 54, 52, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 49, 70, 45, 51, 70, 0, 54, 53, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 52, 70, 45, 54, 70, 0, 54, 54, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 69, 120, 116, 101, 114, 105, 111, 114, 0, 54, 55, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 83, 117, 109, 109, 105, 116, 0, 54, 56, 44, 83, 104, 111, 97, 108, 32, 67, 97, 118, 101, 0, 54, 57, 44, 83, 104, 111, 97, 108, 32, 67, 97, 118, 101, 32, 73, 99, 101, 32, 82, 111, 111, 109, 0, 55, 48, 44, 83, 101, 97, 102, 108, 111, 111, 114, 32, 67, 97, 118, 101, 114, 110, 0, 55, 49, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 55, 50, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 49, 70, 0, 55, 51, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 50, 70, 0, 55, 52, 44, 67, 97, 118, 101, 32, 111, 102, 32, 79, 114, 105, 103, 105, 110, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 55, 53, 44, 67, 97, 118, 101, 32, 111, 102, 32, 79, 114, 105, 103, 105, 110, 0, 55, 54, 44, 70, 105, 101, 114, 121, 32, 80, 97, 116, 104, 0, 55, 55, 44, 74, 97, 103, 103, 101, 100, 32, 80, 97, 115, 115, 0, 55, 56, 44, 83, 107, 121, 32, 80, 105, 108, 108, 97, 114, 32, 49, 70, 0, 55, 57, 44, 83, 107, 121, 32, 80, 105, 108, 108, 97, 114, 32, 51, 70, 0, 56, 48, 44, 83, 107, 121, 32, 80, 105, 108, 108, 97, 114, 32, 53, 70, 0, 56, 49, 44, 77, 97, 103, 109, 97, 32, 72, 105, 100, 101, 111, 117, 116, 0, 56, 50, 44, 77, 105, 114, 97, 103, 101, 32, 84, 111, 119, 101, 114, 0, 56, 51, 44, 65, 114, 116, 105, 115, 97, 110, 32, 67, 97, 118, 101, 0, 56, 52, 44, 68, 101, 115, 101, 114, 116, 32, 85, 110, 100, 101, 114, 112, 97, 115, 115, 0, 56, 53, 44, 65, 108, 116, 101, 114, 105, 110, 103, 32, 67, 97, 118, 101, 0 };
-
-constexpr std::array<u8, 8829> species_ko = { 236, 157, 180, 236, 131, 129, 237, 149, 180, 236, 148, 168, 0, 236, 157, 180, 236, 131, 129, 237, 149, 180, 237, 146, 128, 0, 236, 157, 180, 236, 131, 129, 237, 149, 180, 234, 189, 131, 0, 237, 140, 140, 236, 157, 180, 235, 166, 172, 0, 235, 166, 172, 236, 158, 144, 235, 147, 156, 0, 235, 166, 172, 236, 158, 144, 235, 170, 189, 0, 234, 188, 172, 235, 182, 128, 234, 184, 176, 0, 236, 150, 180, 235, 139, 136, 235, 182, 128, 234, 184, 176, 0, 234, 177, 176, 235, 182, 129, 236, 153, 149, 0, 236, 186, 144, 237, 132, 176, 237, 148, 188, 0, 235, 139, 168, 235, 141, 176, 234, 184, 176, 0, 235, 178, 132, 237, 132, 176, 237, 148, 140, 0, 235, 191, 148, 236, 182, 169, 236, 157, 180, 0, 235, 148, 177, 236, 182, 169, 236, 157, 180, 0, 235, 143, 133, 236, 185, 168, 235, 182, 149, 0, 234, 181, 172, 234, 181, 172, 0, 237, 148, 188, 236, 163, 164, 0, 237, 148, 188, 236, 163, 164, 237, 136, 172, 0, 234, 188, 172, 235, 160, 155, 0, 235, 160, 136, 237, 138, 184, 235, 157, 188, 0, 234, 185, 168, 235, 185, 132, 236, 176, 184, 0, 234, 185, 168, 235, 185, 132, 235, 147, 156, 235, 166, 180, 236, 161, 176, 0, 236, 149, 132, 235, 179, 180, 0, 236, 149, 132, 235, 179, 180, 237, 129, 172, 0, 237, 148, 188, 236, 185, 180, 236, 184, 132, 0, 235, 157, 188, 236, 157, 180, 236, 184, 132, 0, 235, 170, 168, 235, 158, 152, 235, 145, 144, 236, 167, 128, 0, 234, 179, 160, 236, 167, 128, 0, 235, 139, 136, 235, 147, 156, 235, 159, 176, 226, 153, 128, 0, 235, 139, 136, 235, 147, 156, 235, 166, 172, 235, 130, 152, 0, 235, 139, 136, 235, 147, 156, 237, 128, 184, 0, 235, 139, 136, 235, 147, 156, 235, 159, 176, 226, 153, 130, 0, 235, 139, 136, 235, 147, 156, 235, 166, 172, 235, 133, 184, 0, 235, 139, 136, 235, 147, 156, 237, 130, 185, 0, 236, 130, 144, 236, 130, 144, 0, 237, 148, 189, 236, 139, 156, 0, 236, 139, 157, 236, 138, 164, 237, 133, 140, 236, 157, 188, 0, 235, 130, 152, 236, 157, 184, 237, 133, 140, 236, 157, 188, 0, 237, 145, 184, 235, 166, 176, 0, 237, 145, 184, 237, 129, 172, 235, 166, 176, 0, 236, 163, 188, 235, 177, 131, 0, 234, 179, 168, 235, 177, 131, 0, 235, 154, 156, 235, 178, 133, 236, 181, 184, 0, 235, 131, 132, 236, 131, 136, 234, 188, 172, 0, 235, 157, 188, 237, 148, 140, 235, 160, 136, 236, 139, 156, 236, 149, 132, 0, 237, 140, 140, 235, 157, 188, 236, 138, 164, 0, 237, 140, 140, 235, 157, 188, 236, 132, 185, 237, 138, 184, 0, 236, 189, 152, 237, 140, 161, 0, 235, 143, 132, 235, 130, 152, 235, 166, 172, 0, 235, 148, 148, 234, 183, 184, 235, 139, 164, 0, 235, 139, 165, 237, 138, 184, 235, 166, 172, 236, 152, 164, 0, 235, 130, 152, 236, 152, 185, 0, 237, 142, 152, 235, 165, 180, 236, 139, 156, 236, 152, 168, 0, 234, 179, 160, 235, 157, 188, 237, 140, 140, 235, 141, 149, 0, 234, 179, 168, 235, 141, 149, 0, 235, 167, 157, 237, 130, 164, 0, 236, 132, 177, 236, 155, 144, 236, 136, 173, 0, 234, 176, 128, 235, 148, 148, 0, 236, 156, 136, 235, 148, 148, 0, 235, 176, 156, 236, 177, 153, 236, 157, 180, 0, 236, 138, 136, 235, 165, 153, 236, 177, 153, 236, 157, 180, 0, 234, 176, 149, 236, 177, 153, 236, 157, 180, 0, 236, 186, 144, 236, 157, 180, 236, 139, 156, 0, 236, 156, 164, 234, 178, 148, 235, 157, 188, 0, 237, 155, 132, 235, 148, 152, 0, 236, 149, 140, 237, 134, 181, 235, 170, 172, 0, 234, 183, 188, 236, 156, 161, 235, 170, 172, 0, 234, 180, 180, 235, 160, 165, 235, 170, 172, 0, 235, 170, 168, 235, 139, 164, 237, 148, 188, 0, 236, 154, 176, 236, 184, 160, 235, 143, 153, 0, 236, 154, 176, 236, 184, 160, 235, 179, 180, 237, 138, 184, 0, 236, 153, 149, 235, 136, 136, 237, 149, 180, 0, 235, 143, 133, 237, 140, 140, 235, 166, 172, 0, 234, 188, 172, 235, 167, 136, 235, 143, 140, 0, 235, 141, 176, 234, 181, 172, 235, 166, 172, 0, 235, 148, 177, 234, 181, 172, 235, 166, 172, 0, 237, 143, 172, 235, 139, 136, 237, 131, 128, 0, 235, 130, 160, 236, 140, 169, 235, 167, 136, 0, 236, 149, 188, 235, 143, 136, 0, 236, 149, 188, 235, 143, 132, 235, 158, 128, 0, 236, 189, 148, 236, 157, 188, 0, 235, 160, 136, 236, 150, 180, 236, 189, 148, 236, 157, 188, 0, 237, 140, 140, 236, 152, 164, 235, 166, 172, 0, 235, 145, 144, 235, 145, 144, 0, 235, 145, 144, 237, 138, 184, 235, 166, 172, 236, 152, 164, 0, 236, 165, 172, 236, 165, 172, 0, 236, 165, 172, 235, 160, 136, 234, 179, 164, 0, 236, 167, 136, 237, 141, 189, 236, 157, 180, 0, 236, 167, 136, 235, 187, 144, 234, 184, 176, 0, 236, 133, 128, 235, 159, 172, 0, 237, 140, 140, 235, 165, 180, 236, 133, 128, 0, 234, 179, 160, 236, 152, 164, 236, 138, 164, 0, 234, 179, 160, 236, 154, 176, 236, 138, 164, 237, 138, 184, 0, 237, 140, 172, 237, 133, 128, 0, 235, 161, 177, 236, 138, 164, 237, 134, 164, 0, 236, 138, 172, 235, 166, 172, 237, 148, 132, 0, 236, 138, 172, 235, 166, 172, 237, 141, 188, 0, 237, 129, 172, 235, 158, 169, 0, 237, 130, 185, 237, 129, 172, 235, 158, 169, 0, 236, 176, 140, 235, 166, 172, 235, 166, 172, 234, 179, 181, 0, 235, 182, 144, 235, 179, 188, 0, 236, 149, 132, 235, 157, 188, 235, 166, 172, 0, 235, 130, 152, 236, 139, 156, 0, 237, 131, 149, 234, 181, 172, 235, 166, 172, 0, 237, 133, 133, 234, 181, 172, 235, 166, 172, 0, 236, 139, 156, 235, 157, 188, 236, 134, 140, 235, 170, 172, 0, 237, 153, 141, 236, 136, 152, 235, 170, 172, 0, 235, 130, 180, 235, 163, 168, 235, 175, 184, 0, 235, 152, 144, 234, 176, 128, 236, 138, 164, 0, 235, 152, 144, 235, 143, 132, 234, 176, 128, 236, 138, 164, 0, 235, 191, 148, 236, 185, 180, 235, 133, 184, 0, 236, 189, 148, 235, 191, 140, 235, 166, 172, 0, 235, 159, 173, 237, 130, 164, 0, 235, 141, 169, 236, 191, 160, 235, 166, 172, 0, 236, 186, 165, 236, 185, 180, 0, 236, 143, 152, 235, 147, 156, 235, 157, 188, 0, 236, 139, 156, 235, 147, 156, 235, 157, 188, 0, 236, 189, 152, 236, 185, 152, 0, 236, 153, 149, 236, 189, 152, 236, 185, 152, 0, 235, 179, 132, 234, 176, 128, 236, 130, 172, 235, 166, 172, 0, 236, 149, 132, 236, 191, 160, 236, 138, 164, 237, 131, 128, 0, 235, 167, 136, 236, 158, 132, 235, 167, 168, 0, 236, 138, 164, 235, 157, 188, 237, 129, 172, 0, 235, 163, 168, 236, 163, 188, 235, 157, 188, 0, 236, 151, 144, 235, 160, 136, 235, 184, 140, 0, 235, 167, 136, 234, 183, 184, 235, 167, 136, 0, 236, 129, 152, 236, 130, 172, 236, 157, 180, 236, 160, 128, 0, 236, 188, 132, 237, 131, 128, 235, 161, 156, 236, 138, 164, 0, 236, 158, 137, 236, 150, 180, 237, 130, 185, 0, 234, 176, 184, 235, 157, 188, 235, 143, 132, 236, 138, 164, 0, 235, 157, 188, 237, 148, 132, 235, 157, 188, 236, 138, 164, 0, 235, 169, 148, 237, 131, 128, 235, 170, 189, 0, 236, 157, 180, 235, 184, 140, 236, 157, 180, 0, 236, 131, 164, 235, 175, 184, 235, 147, 156, 0, 236, 165, 172, 237, 148, 188, 236, 141, 172, 235, 141, 148, 0, 235, 182, 128, 236, 138, 164, 237, 132, 176, 0, 237, 143, 180, 235, 166, 172, 234, 179, 164, 0, 236, 149, 148, 235, 130, 152, 236, 157, 180, 237, 138, 184, 0, 236, 149, 148, 236, 138, 164, 237, 131, 128, 0, 237, 136, 172, 234, 181, 172, 0, 237, 136, 172, 234, 181, 172, 237, 145, 184, 236, 138, 164, 0, 237, 148, 132, 237, 133, 140, 235, 157, 188, 0, 236, 158, 160, 235, 167, 140, 235, 179, 180, 0, 237, 148, 132, 235, 166, 172, 236, 160, 184, 0, 236, 141, 172, 235, 141, 148, 0, 237, 140, 140, 236, 157, 180, 236, 150, 180, 0, 235, 175, 184, 235, 135, 189, 0, 236, 139, 160, 235, 135, 189, 0, 235, 167, 157, 235, 130, 152, 235, 135, 189, 0, 235, 174, 164, 236, 184, 160, 0, 235, 174, 164, 0, 236, 185, 152, 236, 189, 148, 235, 166, 172, 237, 131, 128, 0, 235, 178, 160, 236, 157, 180, 235, 166, 172, 237, 148, 132, 0, 235, 169, 148, 234, 176, 128, 235, 139, 136, 236, 155, 128, 0, 235, 184, 140, 236, 188, 128, 236, 157, 184, 0, 235, 167, 136, 234, 183, 184, 236, 188, 128, 236, 157, 184, 0, 235, 184, 148, 235, 160, 136, 236, 157, 180, 235, 178, 148, 0, 235, 166, 172, 236, 149, 132, 236, 189, 148, 0, 236, 151, 152, 235, 166, 172, 234, 178, 140, 236, 157, 180, 0, 236, 158, 165, 237, 129, 172, 235, 161, 156, 235, 139, 164, 236, 157, 188, 0, 234, 188, 172, 235, 166, 172, 236, 132, 160, 0, 235, 139, 164, 234, 188, 172, 235, 166, 172, 0, 235, 182, 128, 236, 154, 176, 235, 182, 128, 0, 236, 149, 188, 235, 182, 128, 236, 151, 137, 0, 235, 160, 136, 235, 148, 148, 235, 176, 148, 0, 235, 160, 136, 235, 148, 148, 236, 149, 136, 0, 237, 142, 152, 236, 157, 180, 234, 178, 128, 0, 236, 149, 132, 235, 166, 172, 236, 149, 132, 235, 143, 132, 236, 138, 164, 0, 237, 129, 172, 235, 161, 156, 235, 177, 131, 0, 236, 180, 136, 235, 157, 188, 234, 184, 176, 0, 235, 158, 156, 237, 132, 180, 0, 237, 148, 188, 236, 184, 132, 0, 236, 130, 144, 0, 237, 145, 184, 237, 145, 184, 235, 166, 176, 0, 237, 134, 160, 234, 178, 140, 237, 148, 188, 0, 237, 134, 160, 234, 178, 140, 237, 139, 177, 0, 235, 132, 164, 236, 157, 180, 237, 139, 176, 0, 235, 132, 164, 236, 157, 180, 237, 139, 176, 236, 152, 164, 0, 235, 169, 148, 235, 166, 172, 237, 148, 132, 0, 235, 179, 180, 236, 134, 161, 236, 134, 161, 0, 236, 160, 132, 235, 163, 161, 0, 236, 149, 132, 235, 165, 180, 236, 189, 148, 0, 235, 167, 136, 235, 166, 180, 0, 235, 167, 136, 235, 166, 180, 235, 166, 172, 0, 234, 188, 172, 236, 167, 128, 235, 170, 168, 0, 236, 153, 149, 234, 181, 172, 235, 166, 172, 0, 237, 134, 181, 237, 134, 181, 236, 189, 148, 0, 235, 145, 144, 236, 189, 148, 0, 236, 134, 156, 236, 134, 156, 236, 189, 148, 0, 236, 151, 144, 236, 157, 180, 237, 140, 156, 0, 237, 149, 180, 235, 132, 136, 236, 184, 160, 0, 237, 149, 180, 235, 163, 168, 235, 175, 184, 0, 236, 153, 149, 236, 158, 144, 235, 166, 172, 0, 236, 154, 176, 237, 140, 140, 0, 235, 136, 132, 236, 152, 164, 0, 236, 151, 144, 235, 184, 140, 236, 157, 180, 0, 235, 184, 148, 235, 158, 152, 237, 130, 164, 0, 235, 139, 136, 235, 161, 156, 236, 154, 176, 0, 236, 149, 188, 235, 143, 132, 237, 130, 185, 0, 235, 172, 180, 236, 154, 176, 235, 167, 136, 0, 236, 149, 136, 235, 134, 141, 0, 235, 167, 136, 236, 158, 144, 236, 154, 169, 0, 237, 130, 164, 235, 167, 129, 237, 130, 164, 0, 237, 148, 188, 236, 189, 152, 0, 236, 143, 152, 236, 189, 152, 0, 235, 133, 184, 234, 179, 160, 236, 185, 152, 0, 234, 184, 128, 235, 157, 188, 236, 157, 180, 234, 177, 176, 0, 234, 176, 149, 236, 178, 160, 237, 134, 164, 0, 235, 184, 148, 235, 163, 168, 0, 234, 183, 184, 235, 158, 145, 235, 184, 148, 235, 163, 168, 0, 236, 185, 168, 235, 176, 148, 235, 163, 168, 0, 237, 149, 171, 236, 130, 188, 0, 235, 139, 168, 235, 139, 168, 236, 167, 128, 0, 237, 151, 164, 235, 157, 188, 237, 129, 172, 235, 161, 156, 236, 138, 164, 0, 237, 143, 172, 237, 145, 184, 235, 139, 136, 0, 234, 185, 156, 236, 167, 128, 234, 179, 176, 0, 235, 167, 129, 234, 179, 176, 0, 235, 167, 136, 234, 183, 184, 235, 167, 136, 234, 183, 184, 0, 235, 167, 136, 234, 183, 184, 236, 185, 180, 235, 165, 180, 234, 179, 160, 0, 234, 190, 184, 234, 190, 184, 235, 166, 172, 0, 235, 169, 148, 234, 190, 184, 235, 166, 172, 0, 236, 189, 148, 236, 130, 176, 237, 152, 184, 0, 236, 180, 157, 236, 150, 180, 0, 235, 140, 128, 237, 143, 172, 235, 172, 180, 235, 133, 184, 0, 235, 148, 156, 235, 166, 172, 235, 178, 132, 235, 147, 156, 0, 235, 167, 140, 237, 131, 128, 236, 157, 184, 0, 235, 172, 180, 236, 158, 165, 236, 161, 176, 0, 235, 141, 184, 235, 185, 140, 0, 237, 151, 172, 234, 176, 128, 0, 237, 130, 185, 235, 147, 156, 235, 157, 188, 0, 236, 189, 148, 236, 189, 148, 235, 166, 172, 0, 236, 189, 148, 235, 166, 172, 234, 176, 145, 0, 237, 143, 180, 235, 166, 172, 234, 179, 164, 50, 0, 235, 133, 184, 235, 157, 188, 237, 130, 164, 0, 235, 163, 168, 235, 184, 140, 235, 143, 132, 0, 235, 176, 176, 235, 163, 168, 237, 130, 164, 0, 236, 185, 180, 237, 143, 172, 236, 151, 144, 235, 157, 188, 0, 235, 189, 128, 235, 189, 128, 235, 157, 188, 0, 236, 151, 144, 235, 160, 136, 237, 130, 164, 235, 147, 156, 0, 235, 167, 136, 234, 183, 184, 235, 185, 132, 0, 235, 176, 128, 237, 131, 177, 237, 129, 172, 0, 237, 149, 180, 237, 148, 188, 235, 132, 136, 236, 138, 164, 0, 235, 157, 188, 236, 157, 180, 236, 189, 148, 0, 236, 149, 164, 237, 133, 140, 236, 157, 180, 0, 236, 138, 164, 236, 157, 180, 236, 191, 164, 0, 236, 149, 160, 235, 178, 132, 235, 157, 188, 236, 138, 164, 0, 235, 141, 176, 234, 184, 176, 235, 157, 188, 236, 138, 164, 0, 235, 167, 136, 234, 184, 176, 235, 157, 188, 236, 138, 164, 0, 235, 163, 168, 234, 184, 176, 236, 149, 132, 0, 236, 185, 160, 236, 131, 137, 236, 161, 176, 0, 236, 132, 184, 235, 160, 136, 235, 185, 132, 0, 235, 130, 152, 235, 172, 180, 236, 167, 128, 234, 184, 176, 0, 235, 130, 152, 235, 172, 180, 235, 143, 140, 236, 157, 180, 0, 235, 130, 152, 235, 172, 180, 237, 130, 185, 0, 236, 149, 132, 236, 176, 168, 235, 170, 168, 0, 236, 152, 129, 236, 185, 152, 236, 189, 148, 0, 235, 178, 136, 236, 185, 152, 236, 189, 148, 0, 235, 172, 188, 236, 167, 177, 236, 157, 180, 0, 235, 138, 170, 236, 167, 177, 236, 157, 180, 0, 235, 140, 128, 236, 167, 177, 236, 157, 180, 0, 237, 143, 172, 236, 177, 160, 235, 130, 152, 0, 234, 183, 184, 235, 157, 188, 236, 151, 144, 235, 130, 152, 0, 236, 167, 128, 234, 183, 184, 236, 160, 156, 234, 181, 172, 235, 166, 172, 0, 236, 167, 129, 234, 181, 172, 235, 166, 172, 0, 234, 176, 156, 235, 172, 180, 236, 134, 140, 0, 236, 139, 164, 236, 191, 164, 0, 235, 183, 176, 237, 139, 176, 237, 148, 140, 235, 157, 188, 236, 157, 180, 0, 236, 185, 180, 236, 138, 164, 236, 191, 164, 0, 235, 143, 133, 236, 188, 128, 236, 157, 188, 0, 236, 151, 176, 234, 189, 131, 235, 170, 172, 0, 235, 161, 156, 237, 134, 160, 236, 138, 164, 0, 235, 161, 156, 237, 140, 140, 237, 140, 140, 0, 235, 143, 132, 237, 134, 160, 235, 167, 129, 0, 236, 158, 142, 236, 131, 136, 236, 189, 148, 0, 235, 139, 164, 237, 131, 177, 234, 181, 172, 0, 237, 133, 140, 236, 157, 188, 235, 161, 156, 0, 236, 138, 164, 236, 153, 136, 235, 161, 156, 0, 234, 176, 136, 235, 170, 168, 235, 167, 164, 0, 237, 140, 168, 235, 166, 172, 237, 141, 188, 0, 235, 158, 132, 237, 134, 160, 236, 138, 164, 0, 237, 130, 172, 235, 166, 172, 236, 149, 132, 0, 234, 176, 128, 235, 148, 148, 236, 149, 136, 0, 235, 185, 132, 234, 181, 172, 236, 136, 160, 0, 235, 185, 132, 235, 130, 152, 235, 176, 169, 0, 235, 178, 132, 236, 132, 175, 234, 188, 172, 0, 235, 178, 132, 236, 132, 175, 235, 170, 168, 0, 234, 178, 140, 236, 157, 132, 235, 161, 156, 0, 235, 176, 156, 235, 176, 148, 235, 161, 156, 0, 234, 178, 140, 236, 157, 132, 237, 130, 185, 0, 237, 134, 160, 236, 164, 145, 235, 170, 172, 0, 236, 149, 132, 236, 157, 180, 236, 138, 164, 237, 129, 172, 0, 234, 187, 141, 236, 167, 136, 235, 170, 172, 0, 236, 134, 140, 234, 179, 164, 235, 163, 161, 0, 235, 133, 184, 234, 179, 181, 235, 163, 161, 0, 237, 143, 173, 236, 157, 140, 235, 163, 161, 0, 235, 167, 136, 237, 129, 172, 237, 131, 149, 0, 237, 149, 152, 235, 166, 172, 235, 173, 137, 0, 235, 163, 168, 235, 166, 172, 235, 166, 172, 0, 236, 189, 148, 236, 189, 148, 237, 140, 140, 236, 138, 164, 0, 236, 151, 144, 235, 130, 152, 235, 185, 132, 0, 235, 141, 184, 236, 188, 128, 237, 139, 176, 0, 234, 185, 156, 234, 185, 140, 235, 175, 184, 0, 236, 158, 133, 236, 185, 152, 237, 138, 184, 0, 234, 176, 128, 235, 179, 180, 235, 166, 172, 0, 234, 176, 177, 235, 143, 132, 235, 157, 188, 0, 235, 179, 180, 236, 138, 164, 235, 161, 156, 235, 157, 188, 0, 236, 154, 148, 234, 176, 128, 235, 158, 145, 0, 236, 154, 148, 234, 176, 128, 235, 158, 168, 0, 236, 141, 172, 235, 141, 148, 235, 157, 188, 236, 157, 180, 0, 236, 141, 172, 235, 141, 148, 235, 179, 188, 237, 138, 184, 0, 237, 148, 140, 235, 159, 172, 236, 139, 156, 0, 235, 167, 136, 236, 157, 180, 235, 134, 141, 0, 235, 179, 188, 235, 185, 132, 237, 138, 184, 0, 235, 132, 164, 236, 152, 164, 235, 185, 132, 237, 138, 184, 0, 235, 161, 156, 236, 160, 164, 235, 166, 172, 236, 149, 132, 0, 234, 188, 180, 234, 185, 141, 235, 170, 172, 0, 234, 191, 128, 234, 186, 189, 235, 170, 172, 0, 236, 131, 164, 237, 148, 132, 235, 139, 136, 236, 149, 132, 0, 236, 131, 164, 237, 129, 172, 235, 139, 136, 236, 149, 132, 0, 234, 179, 160, 235, 158, 152, 236, 153, 149, 236, 158, 144, 0, 234, 179, 160, 235, 158, 152, 236, 153, 149, 0, 235, 145, 148, 237, 131, 128, 0, 237, 143, 173, 237, 131, 128, 0, 236, 189, 148, 237, 132, 176, 236, 138, 164, 0, 237, 148, 188, 234, 183, 184, 236, 160, 144, 237, 148, 132, 0, 237, 148, 188, 234, 183, 184, 237, 130, 185, 0, 236, 150, 188, 235, 163, 168, 234, 184, 176, 0, 237, 134, 177, 236, 185, 152, 0, 235, 185, 132, 235, 184, 140, 235, 157, 188, 235, 176, 148, 0, 237, 148, 140, 235, 157, 188, 236, 157, 180, 234, 179, 164, 0, 236, 132, 160, 236, 157, 184, 236, 153, 149, 0, 235, 176, 164, 236, 132, 160, 236, 157, 184, 0, 237, 140, 140, 235, 185, 132, 236, 189, 148, 0, 237, 140, 140, 235, 185, 132, 236, 189, 148, 235, 166, 172, 0, 236, 159, 157, 234, 179, 160, 0, 236, 132, 184, 235, 185, 132, 237, 141, 188, 0, 235, 163, 168, 235, 130, 152, 237, 134, 164, 0, 236, 134, 148, 235, 161, 157, 0, 235, 175, 184, 234, 190, 184, 235, 166, 172, 0, 235, 169, 148, 234, 185, 133, 0, 234, 176, 128, 236, 158, 172, 234, 181, 176, 0, 234, 176, 128, 236, 158, 172, 236, 158, 165, 234, 181, 176, 0, 236, 152, 164, 235, 154, 157, 234, 181, 176, 0, 236, 160, 144, 237, 134, 160, 235, 143, 132, 235, 166, 172, 0, 235, 166, 180, 235, 167, 129, 0, 235, 166, 180, 235, 166, 172, 236, 154, 148, 0, 236, 149, 132, 235, 133, 184, 235, 148, 165, 236, 138, 164, 0, 236, 149, 132, 235, 167, 144, 235, 143, 132, 0, 235, 185, 136, 237, 139, 176, 235, 130, 152, 0, 235, 176, 128, 235, 161, 156, 237, 139, 177, 0, 236, 186, 144, 236, 138, 164, 237, 144, 129, 0, 236, 188, 136, 235, 166, 172, 235, 170, 172, 0, 236, 150, 180, 235, 145, 160, 235, 140, 128, 236, 139, 160, 0, 235, 139, 164, 237, 129, 172, 237, 142, 171, 0, 237, 149, 180, 234, 179, 168, 235, 170, 189, 0, 235, 175, 184, 235, 157, 188, 235, 170, 189, 0, 237, 138, 184, 235, 161, 156, 237, 148, 188, 236, 154, 176, 236, 138, 164, 0, 236, 185, 152, 235, 160, 129, 0, 236, 149, 177, 236, 134, 148, 0, 235, 167, 136, 236, 158, 144, 0, 235, 136, 136, 234, 188, 172, 235, 167, 136, 0, 236, 150, 188, 236, 157, 140, 234, 183, 128, 236, 139, 160, 0, 235, 140, 128, 234, 181, 180, 235, 160, 136, 236, 152, 164, 0, 236, 148, 168, 235, 160, 136, 236, 152, 164, 0, 236, 148, 168, 236, 185, 180, 236, 157, 180, 236, 160, 128, 0, 236, 167, 132, 236, 163, 188, 235, 170, 189, 0, 237, 151, 140, 237, 133, 140, 236, 157, 188, 0, 235, 182, 132, 237, 153, 141, 236, 158, 165, 236, 157, 180, 0, 236, 139, 156, 235, 157, 188, 236, 185, 184, 0, 236, 130, 172, 235, 158, 145, 235, 143, 153, 236, 157, 180, 0, 236, 149, 132, 234, 179, 181, 236, 157, 180, 0, 236, 137, 152, 234, 179, 164, 0, 235, 179, 180, 235, 167, 140, 235, 139, 164, 0, 235, 169, 148, 237, 131, 149, 0, 235, 169, 148, 237, 131, 149, 234, 181, 172, 0, 235, 169, 148, 237, 131, 128, 234, 183, 184, 235, 161, 156, 236, 138, 164, 0, 235, 160, 136, 236, 167, 128, 235, 157, 189, 0, 235, 160, 136, 236, 167, 128, 236, 149, 132, 236, 157, 180, 236, 138, 164, 0, 235, 160, 136, 236, 167, 128, 236, 138, 164, 237, 139, 184, 0, 235, 157, 188, 237, 139, 176, 236, 149, 132, 236, 138, 164, 0, 235, 157, 188, 237, 139, 176, 236, 152, 164, 236, 138, 164, 0, 234, 176, 128, 236, 157, 180, 236, 152, 164, 234, 176, 128, 0, 234, 183, 184, 235, 158, 128, 235, 143, 136, 0, 235, 160, 136, 236, 191, 160, 236, 159, 136, 0, 236, 167, 128, 235, 157, 188, 236, 185, 152, 0, 237, 133, 140, 236, 152, 164, 237, 130, 164, 236, 138, 164, 0, 235, 170, 168, 235, 182, 128, 234, 184, 176, 0, 236, 136, 152, 237, 146, 128, 235, 182, 128, 234, 184, 176, 0, 237, 134, 160, 235, 140, 128, 235, 182, 128, 234, 184, 176, 0, 235, 182, 136, 234, 189, 131, 236, 136, 173, 236, 157, 180, 0, 237, 140, 140, 236, 157, 180, 236, 136, 173, 236, 157, 180, 0, 236, 180, 136, 236, 151, 188, 235, 170, 189, 0, 237, 140, 189, 235, 143, 132, 235, 166, 172, 0, 237, 140, 189, 237, 131, 156, 236, 158, 144, 0, 236, 151, 160, 237, 142, 152, 235, 165, 180, 237, 138, 184, 0, 236, 176, 140, 235, 165, 180, 234, 188, 172, 0, 236, 176, 140, 235, 165, 180, 235, 178, 132, 235, 147, 156, 0, 236, 176, 140, 235, 165, 180, 237, 152, 184, 237, 129, 172, 0, 235, 185, 132, 235, 178, 132, 235, 139, 136, 0, 235, 185, 132, 235, 178, 132, 237, 134, 181, 0, 234, 183, 128, 235, 154, 164, 235, 154, 156, 234, 184, 176, 0, 234, 183, 128, 235, 154, 164, 237, 134, 161, 237, 129, 172, 0, 234, 188, 172, 235, 167, 129, 237, 129, 172, 0, 235, 159, 173, 236, 139, 156, 236, 152, 164, 0, 235, 160, 140, 237, 138, 184, 235, 157, 188, 0, 234, 188, 172, 235, 170, 189, 236, 154, 184, 0, 235, 161, 156, 236, 166, 136, 235, 160, 136, 236, 157, 180, 235, 147, 156, 0, 235, 145, 144, 234, 176, 156, 235, 143, 132, 236, 138, 164, 0, 235, 158, 168, 237, 142, 132, 235, 147, 156, 0, 235, 176, 169, 237, 140, 168, 237, 134, 177, 236, 138, 164, 0, 235, 176, 148, 235, 166, 172, 237, 134, 177, 236, 138, 164, 0, 235, 143, 132, 235, 161, 177, 236, 182, 169, 236, 157, 180, 0, 235, 143, 132, 235, 161, 177, 235, 167, 136, 235, 139, 180, 0, 235, 130, 152, 235, 169, 148, 236, 157, 188, 0, 236, 132, 184, 234, 191, 128, 235, 178, 132, 235, 166, 172, 0, 235, 185, 132, 237, 128, 184, 0, 237, 140, 140, 236, 185, 152, 235, 166, 172, 236, 138, 164, 0, 235, 184, 140, 236, 157, 180, 236, 160, 164, 0, 237, 148, 140, 235, 161, 156, 236, 160, 164, 0, 236, 178, 180, 235, 166, 172, 235, 178, 132, 0, 236, 178, 180, 235, 166, 172, 234, 188, 172, 0, 234, 185, 157, 236, 167, 136, 235, 172, 180, 0, 237, 138, 184, 235, 166, 172, 237, 134, 160, 235, 143, 136, 0, 234, 178, 159, 237, 149, 184, 235, 179, 180, 236, 136, 173, 0, 237, 157, 148, 235, 147, 164, 237, 146, 141, 236, 134, 144, 0, 235, 145, 165, 236, 139, 164, 235, 157, 188, 236, 157, 180, 235, 147, 156, 0, 236, 157, 180, 236, 150, 180, 235, 161, 164, 0, 236, 157, 180, 236, 150, 180, 235, 161, 173, 0, 235, 172, 180, 236, 154, 176, 235, 167, 136, 236, 167, 129, 0, 235, 143, 136, 237, 129, 172, 235, 161, 156, 236, 154, 176, 0, 235, 130, 152, 236, 152, 185, 235, 167, 136, 0, 235, 170, 172, 235, 131, 165, 236, 157, 180, 0, 235, 158, 145, 235, 148, 184, 235, 158, 145, 0, 236, 138, 164, 236, 187, 185, 235, 191, 161, 0, 236, 138, 164, 236, 187, 185, 237, 131, 177, 237, 129, 172, 0, 235, 143, 153, 235, 175, 184, 235, 159, 172, 0, 235, 143, 153, 237, 131, 129, 234, 181, 176, 0, 234, 188, 172, 236, 167, 128, 236, 167, 128, 0, 237, 157, 137, 235, 130, 180, 235, 130, 180, 0, 237, 149, 145, 235, 179, 181, 0, 237, 142, 152, 235, 157, 188, 237, 142, 152, 0, 237, 153, 148, 234, 176, 149, 235, 143, 140, 0, 235, 148, 165, 236, 131, 129, 236, 150, 180, 235, 143, 153, 0, 237, 149, 156, 235, 176, 148, 236, 157, 180, 237, 138, 184, 0, 237, 149, 156, 236, 185, 180, 235, 166, 172, 236, 149, 132, 236, 138, 164, 0, 235, 168, 185, 234, 179, 160, 236, 158, 144, 0, 235, 166, 172, 236, 152, 164, 235, 165, 180, 0, 235, 163, 168, 236, 185, 180, 235, 166, 172, 236, 152, 164, 0, 237, 158, 136, 237, 143, 172, 237, 143, 172, 237, 131, 128, 236, 138, 164, 0, 237, 149, 152, 235, 167, 136, 235, 143, 136, 0, 236, 138, 164, 236, 189, 156, 237, 148, 188, 0, 235, 147, 156, 235, 158, 152, 237, 148, 188, 236, 152, 168, 0, 236, 130, 144, 235, 148, 177, 234, 181, 172, 235, 166, 172, 0, 235, 143, 133, 234, 176, 156, 234, 181, 180, 0, 235, 172, 180, 236, 138, 164, 237, 139, 136, 235, 139, 136, 0, 237, 152, 149, 234, 180, 145, 236, 150, 180, 0, 235, 132, 164, 236, 152, 164, 235, 157, 188, 236, 157, 180, 237, 138, 184, 0, 237, 131, 128, 235, 167, 140, 237, 131, 128, 0, 235, 136, 136, 236, 147, 176, 234, 176, 156, 0, 235, 136, 136, 236, 132, 164, 236, 153, 149, 0, 237, 143, 172, 237, 145, 184, 235, 139, 136, 235, 157, 188, 0, 236, 158, 144, 237, 143, 172, 236, 189, 148, 236, 157, 188, 0, 235, 130, 180, 235, 163, 184, 235, 178, 168, 237, 138, 184, 0, 234, 177, 176, 235, 140, 128, 236, 189, 148, 235, 191, 140, 235, 166, 172, 0, 235, 141, 169, 236, 191, 160, 235, 166, 188, 235, 179, 180, 0, 236, 151, 144, 235, 160, 136, 237, 130, 164, 235, 184, 148, 0, 235, 167, 136, 234, 183, 184, 235, 167, 136, 235, 178, 136, 0, 237, 134, 160, 234, 178, 140, 237, 130, 164, 236, 138, 164, 0, 235, 169, 148, 234, 176, 128, 236, 158, 144, 235, 166, 172, 0, 235, 166, 172, 237, 148, 188, 236, 149, 132, 0, 234, 184, 128, 235, 160, 136, 236, 157, 180, 236, 139, 156, 236, 149, 132, 0, 234, 184, 128, 235, 157, 188, 236, 157, 180, 236, 152, 168, 0, 235, 167, 152, 235, 170, 168, 234, 190, 184, 235, 166, 172, 0, 237, 143, 180, 235, 166, 172, 234, 179, 164, 90, 0, 236, 151, 152, 235, 160, 136, 236, 157, 180, 235, 147, 156, 0, 235, 140, 128, 236, 189, 148, 237, 140, 140, 236, 138, 164, 0, 236, 149, 188, 235, 138, 144, 236, 153, 128, 235, 165, 180, 235, 170, 189, 0, 235, 136, 136, 236, 151, 172, 236, 149, 132, 0, 235, 161, 156, 237, 134, 160, 235, 172, 180, 0, 236, 156, 160, 237, 129, 172, 236, 139, 156, 0, 236, 151, 160, 235, 157, 188, 236, 157, 180, 237, 138, 184, 0, 236, 149, 132, 234, 183, 184, 235, 134, 136, 0, 235, 148, 148, 236, 149, 132, 235, 163, 168, 234, 176, 128, 0, 237, 142, 132, 234, 184, 176, 236, 149, 132, 0, 237, 158, 136, 235, 147, 156, 235, 159, 176, 0, 235, 160, 136, 236, 167, 128, 234, 184, 176, 234, 176, 128, 236, 138, 164, 0, 234, 184, 176, 235, 157, 188, 237, 139, 176, 235, 130, 152, 0, 237, 129, 172, 235, 160, 136, 236, 132, 184, 235, 166, 172, 236, 149, 132, 0, 237, 148, 188, 236, 152, 164, 235, 132, 164, 0, 235, 167, 136, 235, 130, 152, 237, 148, 188, 0, 235, 139, 164, 237, 129, 172, 235, 157, 188, 236, 157, 180, 0, 236, 137, 144, 236, 157, 180, 235, 175, 184, 0, 236, 149, 132, 235, 165, 180, 236, 132, 184, 236, 154, 176, 236, 138, 164, 0, 235, 185, 132, 237, 129, 172, 237, 139, 176, 235, 139, 136, 0, 236, 163, 188, 235, 166, 172, 235, 185, 132, 236, 150, 128, 0, 236, 131, 164, 235, 185, 132, 0, 236, 131, 164, 235, 161, 156, 235, 139, 164, 0, 235, 154, 156, 234, 190, 184, 235, 166, 172, 0, 236, 176, 168, 236, 152, 164, 234, 191, 128, 0, 236, 151, 188, 235, 172, 180, 236, 153, 149, 0, 236, 136, 152, 235, 140, 149, 236, 157, 180, 0, 236, 140, 141, 234, 178, 128, 236, 158, 144, 235, 185, 132, 0, 235, 140, 128, 234, 178, 128, 234, 183, 128, 0, 235, 179, 180, 235, 165, 180, 236, 165, 144, 0, 235, 179, 180, 235, 165, 180, 234, 183, 184, 0, 236, 154, 148, 237, 133, 140, 235, 166, 172, 0, 237, 149, 152, 235, 141, 176, 235, 166, 172, 236, 150, 180, 0, 235, 176, 148, 235, 158, 156, 235, 147, 156, 0, 236, 140, 148, 235, 185, 132, 235, 131, 165, 0, 235, 160, 136, 237, 140, 140, 235, 165, 180, 235, 139, 164, 236, 138, 164, 0, 236, 149, 188, 235, 130, 152, 237, 148, 132, 0, 236, 149, 188, 235, 130, 152, 237, 130, 164, 0, 235, 176, 148, 236, 152, 164, 237, 148, 132, 0, 235, 176, 148, 236, 152, 164, 237, 130, 164, 0, 236, 149, 151, 236, 176, 168, 237, 148, 132, 0, 236, 149, 151, 236, 176, 168, 237, 130, 164, 0, 235, 170, 189, 235, 130, 152, 0, 235, 170, 189, 236, 150, 140, 235, 130, 152, 0, 236, 189, 169, 235, 145, 152, 234, 184, 176, 0, 236, 156, 160, 237, 134, 160, 235, 184, 140, 0, 236, 188, 132, 237, 152, 184, 235, 161, 156, 236, 154, 176, 0, 236, 164, 132, 235, 174, 164, 235, 167, 136, 0, 236, 160, 156, 235, 184, 140, 235, 157, 188, 236, 157, 180, 236, 185, 180, 0, 235, 139, 168, 234, 181, 180, 0, 236, 149, 148, 237, 138, 184, 235, 165, 180, 0, 234, 184, 176, 234, 176, 128, 236, 157, 180, 236, 150, 180, 236, 138, 164, 0, 235, 152, 144, 235, 165, 180, 235, 176, 149, 236, 165, 144, 0, 235, 167, 152, 235, 176, 149, 236, 165, 144, 0, 235, 145, 144, 235, 141, 148, 235, 165, 152, 0, 235, 170, 176, 235, 147, 156, 235, 165, 152, 0, 235, 139, 164, 235, 182, 128, 235, 139, 136, 0, 236, 156, 188, 235, 158, 143, 236, 176, 168, 0, 237, 134, 160, 236, 135, 160, 234, 179, 168, 0, 235, 133, 184, 235, 179, 180, 236, 178, 173, 0, 235, 143, 153, 236, 177, 153, 236, 157, 180, 0, 235, 145, 144, 234, 185, 140, 235, 185, 132, 0, 235, 145, 144, 235, 185, 133, 234, 181, 180, 0, 235, 141, 152, 236, 167, 128, 235, 175, 184, 0, 237, 131, 128, 234, 178, 169, 234, 183, 128, 0, 235, 145, 144, 235, 165, 180, 235, 179, 180, 0, 235, 145, 144, 235, 165, 180, 236, 191, 164, 0, 235, 170, 168, 236, 149, 132, 235, 168, 184, 0, 235, 167, 136, 235, 148, 148, 235, 132, 164, 0, 237, 156, 160, 234, 181, 172, 0, 237, 142, 156, 235, 147, 156, 235, 157, 188, 0, 236, 134, 140, 235, 175, 184, 236, 149, 136, 0, 236, 151, 152, 237, 146, 141, 0, 236, 185, 152, 235, 166, 180, 235, 166, 172, 0, 235, 147, 156, 235, 160, 136, 235, 148, 148, 236, 150, 180, 0, 235, 176, 176, 236, 147, 176, 235, 130, 152, 236, 157, 180, 0, 234, 185, 156, 235, 136, 136, 237, 129, 172, 0, 236, 149, 133, 235, 185, 132, 235, 165, 180, 0, 236, 149, 133, 235, 185, 132, 236, 149, 132, 235, 165, 180, 0, 235, 139, 172, 235, 167, 137, 237, 153, 148, 0, 235, 182, 136, 235, 185, 132, 235, 139, 172, 235, 167, 136, 0, 235, 167, 136, 235, 157, 188, 236, 185, 180, 236, 185, 152, 0, 235, 143, 140, 236, 130, 180, 236, 157, 180, 0, 236, 149, 148, 237, 140, 176, 235, 166, 172, 236, 138, 164, 0, 234, 179, 164, 236, 156, 168, 235, 158, 173, 0, 234, 179, 164, 236, 156, 168, 234, 177, 176, 235, 139, 136, 0, 236, 139, 172, 235, 179, 180, 235, 159, 172, 0, 235, 141, 176, 236, 138, 164, 235, 167, 136, 236, 138, 164, 0, 235, 141, 176, 236, 138, 164, 235, 139, 136, 236, 185, 184, 0, 237, 148, 132, 235, 161, 156, 237, 134, 160, 234, 176, 128, 0, 235, 138, 145, 234, 179, 168, 235, 157, 188, 0, 236, 149, 132, 236, 188, 132, 0, 236, 149, 132, 236, 188, 128, 236, 152, 164, 236, 138, 164, 0, 234, 185, 168, 235, 180, 137, 236, 157, 180, 0, 235, 141, 148, 236, 138, 164, 237, 138, 184, 235, 130, 152, 0, 236, 161, 176, 235, 161, 156, 236, 149, 132, 0, 236, 161, 176, 235, 161, 156, 236, 149, 132, 237, 129, 172, 0, 236, 185, 152, 235, 157, 188, 235, 175, 184, 0, 236, 185, 152, 235, 157, 188, 236, 185, 152, 235, 133, 184, 0, 234, 179, 160, 235, 148, 148, 237, 131, 177, 0, 234, 179, 160, 235, 148, 148, 235, 179, 180, 235, 175, 184, 0, 234, 179, 160, 235, 148, 148, 235, 170, 168, 236, 149, 132, 236, 160, 164, 0, 236, 156, 160, 235, 139, 136, 235, 158, 128, 0, 235, 147, 128, 235, 158, 128, 0, 235, 158, 128, 236, 191, 168, 235, 163, 168, 236, 138, 164, 0, 234, 188, 172, 236, 167, 128, 235, 179, 180, 235, 166, 172, 0, 236, 138, 164, 236, 153, 132, 235, 130, 152, 0, 235, 176, 148, 235, 139, 144, 237, 148, 132, 237, 139, 176, 0, 235, 176, 148, 235, 139, 144, 235, 166, 172, 236, 185, 152, 0, 235, 176, 176, 235, 176, 148, 235, 139, 144, 235, 157, 188, 0, 236, 130, 172, 236, 178, 160, 235, 161, 157, 0, 235, 176, 148, 235, 157, 188, 236, 178, 160, 235, 161, 157, 0, 236, 151, 144, 235, 170, 189, 234, 176, 128, 0, 235, 148, 177, 236, 160, 149, 234, 179, 164, 0, 236, 138, 136, 235, 176, 148, 235, 165, 180, 234, 179, 160, 0, 234, 185, 156, 235, 134, 128, 235, 178, 132, 236, 138, 172, 0, 235, 189, 128, 235, 161, 157, 235, 130, 152, 0, 237, 131, 177, 234, 183, 184, 235, 166, 180, 0, 237, 131, 177, 237, 131, 177, 234, 178, 148, 0, 235, 167, 152, 235, 179, 181, 236, 185, 152, 0, 237, 140, 140, 236, 170, 188, 236, 152, 165, 0, 236, 160, 132, 237, 136, 180, 235, 157, 188, 0, 236, 178, 160, 236, 139, 156, 235, 147, 156, 0, 235, 132, 136, 237, 138, 184, 235, 160, 185, 0, 234, 184, 176, 236, 150, 180, 235, 165, 180, 0, 234, 184, 176, 234, 184, 176, 236, 150, 180, 235, 165, 180, 0, 234, 184, 176, 234, 184, 176, 234, 184, 176, 236, 150, 180, 235, 165, 180, 0, 236, 160, 128, 235, 166, 172, 236, 150, 180, 0, 236, 160, 128, 235, 166, 172, 235, 166, 180, 0, 236, 160, 128, 235, 166, 172, 235, 141, 148, 237, 148, 132, 0, 235, 166, 172, 234, 183, 184, 235, 160, 136, 0, 235, 178, 176, 237, 129, 172, 0, 235, 182, 136, 236, 188, 156, 235, 175, 184, 0, 235, 158, 168, 237, 148, 132, 235, 157, 188, 0, 236, 131, 185, 235, 141, 184, 235, 157, 188, 0, 237, 132, 176, 234, 178, 128, 235, 139, 136, 0, 236, 149, 161, 236, 138, 168, 235, 143, 132, 0, 236, 149, 161, 236, 138, 164, 235, 157, 188, 236, 157, 180, 236, 166, 136, 0, 236, 189, 148, 234, 179, 160, 235, 175, 184, 0, 237, 136, 176, 235, 178, 160, 236, 150, 180, 0, 237, 148, 132, 235, 166, 172, 236, 167, 128, 236, 152, 164, 0, 236, 170, 188, 235, 167, 136, 235, 166, 172, 0, 236, 150, 180, 236, 167, 128, 235, 166, 172, 235, 141, 148, 0, 235, 169, 148, 235, 141, 148, 0, 235, 185, 132, 236, 161, 176, 237, 145, 184, 0, 235, 185, 132, 236, 161, 176, 235, 143, 132, 0, 237, 129, 172, 235, 166, 172, 235, 167, 140, 0, 234, 179, 168, 235, 185, 132, 235, 158, 140, 0, 234, 179, 168, 235, 163, 168, 234, 183, 184, 0, 236, 158, 144, 235, 167, 157, 236, 185, 188, 0, 236, 160, 136, 234, 176, 129, 236, 176, 184, 0, 235, 178, 132, 237, 148, 132, 235, 161, 160, 0, 236, 136, 152, 235, 166, 172, 235, 145, 165, 235, 179, 180, 0, 236, 155, 140, 234, 184, 128, 0, 235, 178, 140, 236, 176, 168, 236, 157, 180, 0, 235, 178, 132, 235, 158, 156, 236, 167, 128, 235, 130, 152, 0, 236, 149, 164, 237, 139, 176, 234, 179, 168, 0, 236, 149, 132, 236, 157, 180, 236, 149, 164, 237, 138, 184, 0, 235, 170, 168, 235, 133, 184, 235, 145, 144, 0, 235, 148, 148, 237, 151, 164, 235, 147, 156, 0, 236, 130, 188, 236, 130, 188, 235, 147, 156, 235, 158, 152, 0, 237, 153, 156, 237, 153, 148, 235, 165, 180, 235, 176, 148, 0, 235, 182, 136, 236, 185, 180, 235, 170, 168, 236, 138, 164, 0, 236, 189, 148, 235, 176, 148, 235, 165, 180, 236, 152, 168, 0, 237, 133, 140, 235, 157, 188, 237, 130, 164, 236, 152, 168, 0, 235, 185, 132, 235, 166, 172, 235, 148, 148, 236, 152, 168, 0, 237, 134, 160, 235, 132, 164, 235, 161, 156, 236, 138, 164, 0, 235, 179, 188, 237, 138, 184, 235, 161, 156, 236, 138, 164, 0, 235, 160, 136, 236, 139, 156, 235, 157, 188, 235, 172, 180, 0, 236, 160, 156, 237, 129, 172, 235, 161, 156, 235, 172, 180, 0, 235, 158, 156, 235, 147, 156, 235, 161, 156, 236, 138, 164, 0, 237, 129, 144, 235, 160, 136, 235, 172, 180, 0, 236, 188, 128, 235, 165, 180, 235, 148, 148, 236, 152, 164, 0, 235, 169, 148, 235, 161, 156, 236, 151, 163, 237, 131, 128, 0, 234, 178, 140, 235, 133, 184, 236, 132, 184, 237, 129, 172, 237, 138, 184, 0, 235, 143, 132, 236, 185, 152, 235, 167, 136, 235, 161, 160, 0, 235, 143, 132, 236, 185, 152, 235, 179, 180, 234, 181, 172, 0, 235, 184, 140, 235, 166, 172, 234, 176, 128, 235, 161, 160, 0, 237, 145, 184, 237, 152, 184, 234, 188, 172, 0, 237, 133, 140, 235, 165, 180, 235, 130, 152, 0, 235, 167, 136, 237, 143, 173, 236, 139, 156, 0, 234, 176, 156, 234, 181, 172, 235, 167, 136, 235, 165, 180, 0, 234, 176, 156, 234, 181, 180, 235, 176, 152, 236, 158, 165, 0, 234, 176, 156, 234, 181, 180, 235, 139, 140, 236, 158, 144, 0, 237, 140, 140, 235, 165, 180, 235, 185, 151, 0, 237, 140, 140, 235, 165, 180, 237, 134, 160, 0, 237, 153, 148, 236, 130, 180, 234, 188, 172, 235, 185, 136, 0, 235, 182, 136, 237, 153, 148, 236, 130, 180, 235, 185, 136, 0, 237, 140, 140, 236, 157, 180, 236, 150, 180, 235, 161, 156, 0, 235, 182, 132, 236, 157, 180, 235, 178, 140, 235, 160, 136, 0, 235, 182, 132, 235, 150, 160, 235, 143, 132, 235, 166, 172, 0, 235, 185, 132, 235, 185, 132, 236, 154, 169, 0, 235, 160, 136, 236, 152, 164, 234, 188, 172, 0, 237, 153, 148, 236, 151, 188, 235, 160, 136, 236, 152, 164, 0, 237, 148, 140, 235, 157, 188, 235, 178, 160, 235, 178, 160, 0, 237, 148, 140, 235, 157, 188, 236, 151, 163, 237, 133, 140, 0, 237, 148, 140, 235, 157, 188, 236, 160, 156, 236, 138, 164, 0, 235, 169, 148, 236, 157, 180, 237, 129, 180, 0, 234, 179, 160, 234, 179, 160, 237, 138, 184, 0, 237, 140, 144, 236, 167, 177, 0, 235, 182, 128, 235, 158, 128, 235, 139, 164, 0, 237, 138, 184, 235, 166, 172, 235, 175, 184, 236, 149, 153, 0, 235, 131, 144, 236, 138, 164, 237, 141, 188, 0, 235, 131, 144, 236, 152, 164, 235, 139, 137, 236, 138, 164, 0, 235, 139, 168, 236, 185, 188, 235, 185, 153, 0, 236, 140, 141, 234, 178, 128, 237, 130, 172, 0, 237, 130, 172, 234, 176, 128, 235, 165, 180, 235, 143, 132, 0, 236, 138, 136, 236, 129, 152, 0, 237, 148, 132, 235, 160, 136, 237, 148, 132, 237, 139, 176, 235, 165, 180, 0, 235, 130, 152, 235, 163, 184, 237, 141, 188, 237, 148, 132, 0, 235, 130, 152, 235, 163, 168, 235, 166, 188, 0, 236, 152, 164, 236, 188, 128, 236, 157, 180, 236, 167, 149, 0, 236, 185, 188, 235, 157, 188, 235, 167, 136, 235, 132, 164, 235, 161, 156, 0, 234, 177, 176, 235, 182, 129, 236, 134, 144, 236, 134, 144, 0, 234, 177, 176, 235, 182, 129, 236, 134, 144, 235, 141, 176, 236, 138, 164, 0, 236, 136, 152, 235, 160, 136, 234, 184, 176, 0, 235, 147, 156, 235, 158, 152, 236, 186, 132, 0, 236, 153, 132, 236, 178, 160, 237, 143, 172, 0, 235, 184, 148, 235, 161, 156, 236, 138, 164, 237, 132, 176, 0, 235, 170, 169, 235, 143, 132, 235, 166, 172, 237, 130, 164, 237, 133, 148, 0, 236, 157, 188, 235, 160, 136, 235, 143, 132, 235, 166, 172, 236, 158, 144, 235, 147, 156, 0, 237, 139, 176, 234, 179, 160, 235, 157, 188, 236, 138, 164, 0, 234, 178, 172, 234, 179, 160, 235, 157, 188, 236, 138, 164, 0, 236, 149, 132, 235, 167, 136, 235, 163, 168, 236, 138, 164, 0, 236, 149, 132, 235, 167, 136, 235, 163, 168, 235, 165, 180, 234, 176, 128, 0, 235, 139, 152, 237, 148, 188, 236, 149, 132, 0, 235, 163, 168, 236, 176, 168, 235, 182, 136, 0, 235, 141, 176, 235, 141, 180, 235, 132, 164, 0, 235, 169, 156, 235, 166, 172, 236, 139, 156, 0, 235, 175, 184, 235, 129, 132, 235, 169, 148, 235, 157, 188, 0, 235, 175, 184, 235, 129, 132, 235, 132, 164, 236, 157, 188, 0, 235, 175, 184, 235, 129, 132, 235, 158, 152, 234, 179, 164, 0, 237, 129, 180, 235, 160, 136, 237, 148, 188, 0, 235, 130, 152, 235, 170, 169, 235, 160, 185, 0, 235, 140, 128, 235, 161, 156, 237, 138, 184, 0, 237, 152, 184, 235, 176, 148, 234, 183, 128, 0, 237, 142, 140, 237, 130, 168, 236, 157, 184, 0, 234, 189, 129, 236, 150, 180, 235, 166, 132, 0, 237, 129, 172, 235, 160, 136, 235, 178, 160, 236, 157, 180, 236, 138, 164, 0, 236, 157, 140, 235, 177, 131, 0, 236, 157, 140, 235, 178, 136, 0, 236, 160, 156, 235, 165, 180, 235, 132, 164, 236, 149, 132, 236, 138, 164, 0, 236, 157, 180, 235, 178, 168, 237, 131, 128, 235, 165, 180, 0, 236, 167, 128, 234, 176, 128, 235, 165, 180, 235, 141, 176, 0, 235, 148, 148, 236, 149, 136, 236, 139, 156, 0, 237, 155, 132, 237, 140, 140, 0, 235, 179, 188, 236, 188, 128, 235, 139, 136, 236, 152, 168, 0, 235, 130, 152, 235, 170, 176, 235, 185, 188, 235, 175, 184, 0, 235, 185, 188, 235, 175, 184, 236, 138, 164, 235, 161, 156, 236, 154, 176, 0, 235, 170, 168, 237, 129, 172, 235, 130, 152, 236, 157, 180, 237, 141, 188, 0, 235, 131, 144, 236, 152, 164, 235, 182, 136, 0, 235, 131, 144, 236, 152, 164, 237, 158, 136, 237, 138, 184, 0, 236, 150, 180, 237, 157, 165, 236, 151, 188, 0, 235, 136, 132, 235, 166, 172, 234, 179, 181, 0, 237, 130, 164, 236, 154, 148, 234, 179, 181, 0, 235, 136, 132, 235, 166, 172, 235, 160, 136, 235, 138, 144, 0, 236, 189, 149, 236, 189, 148, 234, 181, 172, 235, 166, 172, 0, 237, 129, 172, 235, 157, 188, 237, 140, 140, 0, 236, 153, 149, 237, 129, 176, 235, 182, 128, 235, 166, 172, 0, 236, 152, 129, 234, 181, 172, 236, 138, 164, 0, 237, 152, 149, 236, 130, 172, 234, 181, 172, 236, 138, 164, 0, 237, 132, 177, 236, 167, 128, 236, 182, 169, 236, 157, 180, 0, 236, 160, 132, 236, 167, 128, 236, 182, 169, 236, 157, 180, 0, 237, 136, 172, 234, 181, 172, 235, 191, 140, 235, 133, 188, 0, 236, 152, 164, 234, 184, 176, 236, 167, 128, 234, 178, 140, 0, 235, 170, 168, 235, 139, 168, 235, 139, 168, 234, 178, 140, 0, 236, 182, 164, 236, 182, 148, 236, 131, 136, 0, 236, 151, 144, 235, 184, 148, 235, 166, 172, 0, 236, 151, 144, 235, 166, 172, 235, 179, 184, 0, 236, 149, 148, 235, 169, 141, 236, 157, 180, 0, 235, 163, 168, 234, 176, 128, 235, 163, 168, 236, 149, 148, 0, 236, 149, 189, 236, 150, 180, 235, 166, 172, 0, 236, 139, 156, 235, 167, 136, 236, 130, 172, 235, 166, 172, 0, 235, 141, 148, 236, 139, 156, 235, 167, 136, 236, 130, 172, 235, 166, 172, 0, 235, 168, 184, 235, 147, 156, 235, 130, 152, 234, 184, 176, 0, 235, 167, 140, 235, 167, 136, 235, 147, 156, 0, 235, 172, 188, 234, 177, 176, 235, 175, 184, 0, 234, 185, 168, 235, 185, 132, 235, 172, 188, 234, 177, 176, 235, 175, 184, 0, 236, 167, 156, 235, 158, 145, 235, 158, 145, 0, 235, 157, 188, 235, 158, 128, 237, 139, 176, 236, 138, 164, 0, 236, 158, 144, 235, 167, 136, 236, 138, 136, 0, 235, 167, 136, 236, 133, 176, 236, 157, 180, 235, 147, 156, 0, 236, 149, 188, 235, 143, 132, 235, 135, 189, 0, 236, 151, 188, 235, 137, 180, 237, 138, 184, 0, 237, 143, 172, 234, 179, 176, 234, 179, 176, 0, 236, 157, 180, 235, 184, 144, 234, 179, 176, 0, 235, 139, 172, 236, 189, 164, 236, 149, 132, 0, 235, 139, 172, 235, 172, 180, 235, 166, 172, 235, 130, 152, 0, 235, 139, 172, 236, 189, 148, 237, 128, 184, 0, 237, 129, 144, 236, 149, 132, 235, 167, 129, 0, 237, 149, 152, 235, 158, 145, 236, 154, 176, 237, 131, 132, 0, 235, 130, 180, 235, 141, 152, 236, 136, 173, 236, 157, 180, 0, 234, 188, 172, 236, 139, 156, 235, 160, 136, 0, 234, 176, 145, 236, 163, 188, 235, 172, 180, 236, 130, 172, 0, 235, 170, 168, 235, 158, 152, 234, 191, 141, 0, 235, 170, 168, 235, 158, 152, 236, 132, 177, 236, 157, 180, 235, 139, 185, 0, 237, 149, 180, 235, 172, 180, 234, 184, 176, 0, 237, 131, 128, 236, 158, 133, 58, 235, 132, 144, 0, 236, 139, 164, 235, 178, 132, 235, 148, 148, 0, 235, 169, 148, 237, 133, 140, 235, 133, 184, 0, 236, 158, 144, 235, 167, 144, 235, 157, 188, 0, 237, 143, 173, 234, 177, 176, 235, 182, 129, 236, 138, 164, 0, 237, 134, 160, 234, 178, 140, 235, 141, 176, 235, 167, 136, 235, 163, 168, 0, 235, 148, 176, 235, 157, 188, 237, 129, 144, 0, 236, 185, 152, 234, 176, 136, 234, 184, 176, 0, 237, 149, 160, 235, 185, 132, 235, 161, 177, 0, 237, 131, 128, 237, 131, 128, 235, 165, 156, 0, 236, 167, 156, 235, 158, 145, 234, 188, 172, 0, 236, 167, 156, 235, 158, 145, 234, 179, 160, 236, 154, 176, 0, 236, 167, 156, 235, 158, 145, 234, 179, 160, 236, 154, 176, 234, 177, 176, 0, 236, 185, 180, 237, 145, 184, 234, 188, 172, 234, 188, 172, 234, 188, 173, 0, 236, 185, 180, 237, 145, 184, 235, 130, 152, 235, 185, 132, 235, 130, 152, 0, 236, 185, 180, 237, 145, 184, 235, 184, 140, 235, 163, 168, 235, 163, 168, 0, 236, 185, 180, 237, 145, 184, 235, 138, 144, 236, 167, 128, 235, 138, 144, 0, 236, 189, 148, 236, 138, 164, 235, 170, 168, 234, 183, 184, 0, 236, 189, 148, 236, 138, 164, 235, 170, 168, 236, 155, 128, 0, 236, 134, 148, 234, 176, 128, 235, 160, 136, 236, 152, 164, 0, 235, 163, 168, 235, 130, 152, 236, 149, 132, 235, 157, 188, 0, 237, 133, 133, 235, 185, 132, 235, 147, 156, 0, 235, 167, 164, 236, 139, 156, 235, 182, 149, 0, 237, 142, 152, 235, 161, 156, 236, 189, 148, 236, 178, 180, 0, 236, 160, 132, 236, 136, 152, 235, 170, 169, 0, 236, 178, 160, 237, 153, 148, 234, 181, 172, 236, 149, 188, 0, 236, 162, 133, 236, 157, 180, 236, 139, 160, 235, 143, 132, 0, 236, 149, 133, 236, 139, 157, 237, 130, 185, 0, 235, 132, 164, 237, 129, 172, 235, 161, 156, 236, 166, 136, 235, 167, 136, 0, 235, 167, 136, 234, 184, 176, 236, 149, 132, 235, 130, 152, 0, 235, 167, 136, 236, 131, 164, 235, 143, 132, 0, 235, 178, 160, 235, 178, 160, 235, 134, 136, 0, 236, 149, 132, 234, 179, 160, 236, 154, 169, 0, 236, 176, 168, 234, 179, 161, 236, 176, 168, 234, 179, 161, 0, 235, 145, 144, 237, 140, 140, 237, 140, 161, 0, 236, 160, 156, 235, 157, 188, 236, 152, 164, 235, 157, 188, 0 };
-
-constexpr std::array<u8, 515> characteristic_zh = { 78, 111, 110, 101, 0, 76, 111, 118, 101, 115, 32, 116, 111, 32, 101, 97, 116, 0, 79, 102, 116, 101, 110, 32, 100, 111, 122, 101, 115, 32, 111, 102, 102, 0, 79, 102, 116, 101, 110, 32, 115, 99, 97, 116, 116, 101, 114, 115, 32, 116, 104, 105, 110, 103, 115, 0, 83, 99, 97, 116, 116, 101, 114, 115, 32, 116, 104, 105, 110, 103, 115, 32, 111, 102, 116, 101, 110, 0, 76, 105, 107, 101, 115, 32, 116, 111, 32, 114, 101, 108, 97, 120, 0, 80, 114, 111, 117, 100, 32, 111, 102, 32, 105, 116, 115, 32, 112, 111, 119, 101, 114, 0, 76, 105, 107, 101, 115, 32, 116, 111, 32, 116, 104, 114, 97, 115, 104, 32, 97, 98, 111, 117, 116, 0, 65, 32, 108, 105, 116, 116, 108, 101, 32, 113, 117, 105, 99, 107, 32, 116, 101, 109, 112, 101, 114, 101, 100, 0, 76, 105, 107, 101, 115, 32, 116, 111, 32, 102, 105, 103, 104, 116, 0, 81, 117, 105, 99, 107, 32, 116, 101, 109, 112, 101, 114, 101, 100, 0, 83, 116, 117, 114, 100, 121, 32, 98, 111, 100, 121, 0, 67, 97, 112, 97, 98, 108, 101, 32, 111, 102, 32, 116, 97, 107, 105, 110, 103, 32, 104, 105, 116, 115, 0, 72, 105, 103, 104, 108, 121, 32, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 0, 71, 111, 111, 100, 32, 101, 110, 100, 117, 114, 97, 110, 99, 101, 0, 71, 111, 111, 100, 32, 112, 101, 114, 115, 101, 118, 101, 114, 101, 110, 99, 101, 0, 76, 105, 107, 101, 115, 32, 116, 111, 32, 114, 117, 110, 0, 65, 108, 101, 114, 116, 32, 116, 111, 32, 115, 111, 117, 110, 100, 115, 0, 73, 109, 112, 101, 116, 117, 111, 117, 115, 32, 97, 110, 100, 32, 115, 105, 108, 108, 121, 0, 83, 111, 109, 101, 119, 104, 97, 116, 32, 111, 102, 32, 97, 32, 99, 108, 111, 119, 110, 0, 81, 117, 105, 99, 107, 32, 116, 111, 32, 102, 108, 101, 101, 0, 72, 105, 103, 104, 108, 121, 32, 99, 117, 114, 105, 111, 117, 115, 0, 77, 105, 115, 99, 104, 105, 101, 118, 111, 117, 115, 0, 84, 104, 111, 114, 111, 117, 103, 104, 108, 121, 32, 99, 117, 110, 110, 105, 110, 103, 0, 79, 102, 116, 101, 110, 32, 108, 111, 115, 116, 32, 105, 110, 32, 116, 104, 111, 117, 103, 104, 116, 0, 86, 101, 114, 121, 32, 102, 105, 110, 105, 99, 107, 121, 0, 83, 116, 114, 111, 110, 103, 32, 119, 105, 108, 108, 101, 100, 0, 83, 111, 109, 101, 119, 104, 97, 116, 32, 118, 97, 105, 110, 0, 83, 116, 114, 111, 110, 103, 108, 121, 32, 100, 101, 102, 105, 97, 110, 116, 0, 72, 97, 116, 101, 115, 32, 116, 111, 32, 108, 111, 115, 101, 0, 83, 111, 109, 101, 119, 104, 97, 116, 32, 115, 116, 117, 98, 98, 111, 114, 110, 0 };
-
-constexpr std::array<u8, 2185> dppt_zh = { 48, 44, 67, 97, 110, 97, 108, 97, 118, 101, 32, 67, 105, 116, 121, 0, 49, 44, 69, 116, 101, 114, 110, 97, 32, 67, 105, 116, 121, 0, 50, 44, 80, 97, 115, 116, 111, 114, 105, 97, 32, 67, 105, 116, 121, 0, 51, 44, 83, 117, 110, 121, 115, 104, 111, 114, 101, 32, 67, 105, 116, 121, 0, 52, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 76, 101, 97, 103, 117, 101, 0, 53, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 77, 105, 110, 101, 32, 49, 70, 0, 54, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 77, 105, 110, 101, 32, 66, 49, 70, 0, 55, 44, 86, 97, 108, 108, 101, 121, 32, 87, 105, 110, 100, 119, 111, 114, 107, 115, 0, 56, 44, 69, 116, 101, 114, 110, 97, 32, 70, 111, 114, 101, 115, 116, 0, 57, 44, 70, 117, 101, 103, 111, 32, 73, 114, 111, 110, 119, 111, 114, 107, 115, 0, 49, 48, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 40, 82, 111, 117, 116, 101, 32, 50, 48, 55, 47, 50, 48, 56, 32, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 49, 49, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 50, 70, 0, 49, 50, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 51, 70, 0, 49, 51, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 83, 110, 111, 119, 0, 49, 52, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 52, 70, 0, 49, 53, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 53, 70, 0, 49, 54, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 54, 70, 0, 49, 55, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 55, 70, 0, 49, 56, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 84, 111, 112, 32, 67, 97, 118, 101, 0, 49, 57, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 40, 82, 111, 117, 116, 101, 32, 50, 49, 54, 32, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 50, 48, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 40, 82, 111, 117, 116, 101, 32, 50, 49, 49, 32, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 50, 49, 44, 77, 116, 46, 32, 67, 111, 114, 111, 110, 101, 116, 32, 66, 49, 70, 0, 50, 50, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 49, 0, 50, 51, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 50, 0, 50, 52, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 51, 0, 50, 53, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 52, 0, 50, 54, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 53, 0, 50, 55, 44, 71, 114, 101, 97, 116, 32, 77, 97, 114, 115, 104, 32, 65, 114, 101, 97, 32, 54, 0, 50, 56, 44, 83, 111, 108, 97, 99, 101, 111, 110, 32, 82, 117, 105, 110, 115, 0, 50, 57, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 51, 48, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 50, 70, 0, 51, 49, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 49, 70, 0, 51, 50, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 97, 99, 107, 32, 82, 111, 111, 109, 32, 49, 0, 51, 51, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 97, 99, 107, 32, 82, 111, 111, 109, 32, 50, 0, 51, 52, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 97, 99, 107, 32, 82, 111, 111, 109, 32, 51, 0, 51, 53, 44, 82, 97, 118, 97, 103, 101, 100, 32, 80, 97, 116, 104, 0, 51, 54, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 71, 97, 116, 101, 32, 49, 70, 0, 51, 55, 44, 79, 114, 101, 98, 117, 114, 103, 104, 32, 71, 97, 116, 101, 32, 66, 49, 70, 0, 51, 56, 44, 83, 116, 97, 114, 107, 32, 77, 111, 117, 110, 116, 97, 105, 110, 0, 51, 57, 44, 83, 116, 97, 114, 107, 32, 77, 111, 117, 110, 116, 97, 105, 110, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 52, 48, 44, 83, 116, 97, 114, 107, 32, 77, 111, 117, 110, 116, 97, 105, 110, 32, 73, 110, 116, 101, 114, 105, 111, 114, 0, 52, 49, 44, 83, 101, 110, 100, 111, 102, 102, 32, 83, 112, 114, 105, 110, 103, 0, 52, 50, 44, 84, 117, 114, 110, 98, 97, 99, 107, 32, 67, 97, 118, 101, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 52, 51, 44, 84, 117, 114, 110, 98, 97, 99, 107, 32, 67, 97, 118, 101, 32, 49, 115, 116, 32, 80, 105, 108, 108, 97, 114, 0, 52, 52, 44, 84, 117, 114, 110, 98, 97, 99, 107, 32, 67, 97, 118, 101, 32, 50, 110, 100, 32, 80, 105, 108, 108, 97, 114, 0, 52, 53, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 49, 70, 0, 52, 54, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 49, 70, 0, 52, 55, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 50, 70, 0, 52, 56, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 51, 70, 0, 52, 57, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 52, 70, 0, 53, 48, 44, 83, 110, 111, 119, 112, 111, 105, 110, 116, 32, 84, 101, 109, 112, 108, 101, 32, 66, 53, 70, 0, 53, 49, 44, 87, 97, 121, 119, 97, 114, 100, 32, 67, 97, 118, 101, 0, 53, 50, 44, 87, 97, 121, 119, 97, 114, 100, 32, 67, 97, 118, 101, 32, 40, 83, 101, 99, 114, 101, 116, 41, 0, 53, 51, 44, 82, 117, 105, 110, 32, 77, 97, 110, 105, 97, 99, 32, 67, 97, 118, 101, 32, 40, 60, 32, 49, 48, 32, 85, 110, 111, 119, 110, 41, 0, 53, 52, 44, 82, 117, 105, 110, 32, 77, 97, 110, 105, 97, 99, 32, 67, 97, 118, 101, 32, 40, 62, 32, 49, 48, 32, 85, 110, 111, 119, 110, 41, 0, 53, 53, 44, 77, 97, 110, 105, 97, 99, 32, 84, 117, 110, 110, 101, 108, 0, 53, 54, 44, 84, 114, 111, 112, 104, 121, 32, 71, 97, 114, 100, 101, 110, 0, 53, 55, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 0, 53, 56, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 49, 70, 0, 53, 57, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 49, 70, 0, 54, 48, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 50, 70, 32, 40, 76, 101, 102, 116, 41, 0, 54, 49, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 50, 70, 32, 40, 82, 105, 103, 104, 116, 41, 0, 54, 50, 44, 73, 114, 111, 110, 32, 73, 115, 108, 97, 110, 100, 32, 66, 51, 70, 0, 54, 51, 44, 79, 108, 100, 32, 67, 104, 97, 116, 101, 97, 117, 0, 54, 52, 44, 79, 108, 100, 32, 67, 104, 97, 116, 101, 97, 117, 32, 82, 111, 111, 109, 32, 53, 0, 54, 53, 44, 76, 97, 107, 101, 32, 86, 101, 114, 105, 116, 121, 0, 54, 54, 44, 76, 97, 107, 101, 32, 86, 97, 108, 111, 114, 0, 54, 55, 44, 76, 97, 107, 101, 32, 65, 99, 117, 105, 116, 121, 0, 54, 56, 44, 86, 97, 108, 111, 114, 32, 76, 97, 107, 101, 102, 114, 111, 110, 116, 0, 54, 57, 44, 65, 99, 117, 105, 116, 121, 32, 76, 97, 107, 101, 102, 114, 111, 110, 116, 0, 55, 48, 44, 82, 111, 117, 116, 101, 32, 50, 48, 49, 0, 55, 49, 44, 82, 111, 117, 116, 101, 32, 50, 48, 50, 0, 55, 50, 44, 82, 111, 117, 116, 101, 32, 50, 48, 51, 0, 55, 51, 44, 82, 111, 117, 116, 101, 32, 50, 48, 52, 32, 40, 83, 111, 117, 116, 104, 41, 0, 55, 52, 44, 82, 111, 117, 116, 101, 32, 50, 48, 52, 32, 40, 78, 111, 114, 116, 104, 41, 0, 55, 53, 44, 82, 111, 117, 116, 101, 32, 50, 48, 53, 32, 40, 83, 111, 117, 116, 104, 41, 0, 55, 54, 44, 82, 111, 117, 116, 101, 32, 50, 48, 53, 32, 40, 78, 111, 114, 116, 104, 41, 0, 55, 55, 44, 82, 111, 117, 116, 101, 32, 50, 48, 54, 0, 55, 56, 44, 82, 111, 117, 116, 101, 32, 50, 48, 55, 0, 55, 57, 44, 82, 111, 117, 116, 101, 32, 50, 48, 56, 0, 56, 48, 44, 82, 111, 117, 116, 101, 32, 50, 48, 57, 0, 56, 49, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 49, 70, 0, 56, 50, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 50, 70, 0, 56, 51, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 51, 70, 0, 56, 52, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 52, 70, 0, 56, 53, 44, 76, 111, 115, 116, 32, 84, 111, 119, 101, 114, 32, 53, 70, 0, 56, 54, 44, 82, 111, 117, 116, 101, 32, 50, 49, 48, 32, 40, 83, 111, 117, 116, 104, 41, 0, 56, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 48, 32, 40, 78, 111, 114, 116, 104, 41, 0, 56, 56, 44, 82, 111, 117, 116, 101, 32, 50, 49, 49, 32, 40, 87, 101, 115, 116, 41, 0, 56, 57, 44, 82, 111, 117, 116, 101, 32, 50, 49, 49, 32, 40, 69, 97, 115, 116, 41, 0, 57, 48, 44, 82, 111, 117, 116, 101, 32, 50, 49, 50, 32, 40, 78, 111, 114, 116, 104, 41, 0, 57, 49, 44, 82, 111, 117, 116, 101, 32, 50, 49, 50, 32, 40, 83, 111, 117, 116, 104, 41, 0, 57, 50, 44, 82, 111, 117, 116, 101, 32, 50, 49, 51, 0, 57, 51, 44, 82, 111, 117, 116, 101, 32, 50, 49, 52, 0, 57, 52, 44, 82, 111, 117, 116, 101, 32, 50, 49, 53, 0, 57, 53, 44, 82, 111, 117, 116, 101, 32, 50, 49, 54, 0, 57, 54, 44, 82, 111, 117, 116, 101, 32, 50, 49, 55, 0, 57, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 56, 0, 57, 56, 44, 82, 111, 117, 116, 101, 32, 50, 49, 57, 0, 57, 57, 44, 82, 111, 117, 116, 101, 32, 50, 50, 49, 0, 49, 48, 48, 44, 82, 111, 117, 116, 101, 32, 50, 50, 50, 0, 49, 48, 49, 44, 82, 111, 117, 116, 101, 32, 50, 50, 52, 0, 49, 48, 50, 44, 82, 111, 117, 116, 101, 32, 50, 50, 53, 0, 49, 48, 51, 44, 82, 111, 117, 116, 101, 32, 50, 50, 55, 0, 49, 48, 52, 44, 82, 111, 117, 116, 101, 32, 50, 50, 56, 0, 49, 48, 53, 44, 82, 111, 117, 116, 101, 32, 50, 50, 57, 0, 49, 48, 54, 44, 84, 119, 105, 110, 108, 101, 97, 102, 32, 84, 111, 119, 110, 0, 49, 48, 55, 44, 67, 101, 108, 101, 115, 116, 105, 99, 32, 84, 111, 119, 110, 0, 49, 48, 56, 44, 82, 101, 115, 111, 114, 116, 32, 65, 114, 101, 97, 0, 49, 48, 57, 44, 82, 111, 117, 116, 101, 32, 50, 50, 48, 0, 49, 49, 48, 44, 82, 111, 117, 116, 101, 32, 50, 50, 51, 0, 49, 49, 49, 44, 82, 111, 117, 116, 101, 32, 50, 50, 54, 0, 49, 49, 50, 44, 82, 111, 117, 116, 101, 32, 50, 51, 48, 0 };
-
-constexpr std::array<u8, 1799> frlg_zh = { 48, 44, 80, 97, 108, 108, 101, 116, 32, 84, 111, 119, 110, 0, 49, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 67, 105, 116, 121, 0, 50, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 105, 116, 121, 0, 51, 44, 86, 101, 114, 109, 105, 108, 105, 111, 110, 32, 67, 105, 116, 121, 0, 52, 44, 67, 101, 108, 97, 100, 111, 110, 32, 67, 105, 116, 121, 0, 53, 44, 70, 117, 99, 104, 115, 105, 97, 32, 67, 105, 116, 121, 0, 54, 44, 67, 105, 110, 110, 97, 98, 97, 114, 32, 73, 115, 108, 97, 110, 100, 0, 55, 44, 82, 111, 117, 116, 101, 32, 49, 0, 56, 44, 82, 111, 117, 116, 101, 32, 50, 0, 57, 44, 82, 111, 117, 116, 101, 32, 51, 0, 49, 48, 44, 82, 111, 117, 116, 101, 32, 52, 0, 49, 49, 44, 82, 111, 117, 116, 101, 32, 53, 0, 49, 50, 44, 82, 111, 117, 116, 101, 32, 54, 0, 49, 51, 44, 82, 111, 117, 116, 101, 32, 55, 0, 49, 52, 44, 82, 111, 117, 116, 101, 32, 56, 0, 49, 53, 44, 82, 111, 117, 116, 101, 32, 57, 0, 49, 54, 44, 82, 111, 117, 116, 101, 32, 49, 48, 0, 49, 55, 44, 82, 111, 117, 116, 101, 32, 49, 49, 0, 49, 56, 44, 82, 111, 117, 116, 101, 32, 49, 50, 0, 49, 57, 44, 82, 111, 117, 116, 101, 32, 49, 51, 0, 50, 48, 44, 82, 111, 117, 116, 101, 32, 49, 52, 0, 50, 49, 44, 82, 111, 117, 116, 101, 32, 49, 53, 0, 50, 50, 44, 82, 111, 117, 116, 101, 32, 49, 54, 0, 50, 51, 44, 82, 111, 117, 116, 101, 32, 49, 55, 0, 50, 52, 44, 82, 111, 117, 116, 101, 32, 49, 56, 0, 50, 53, 44, 82, 111, 117, 116, 101, 32, 49, 57, 0, 50, 54, 44, 82, 111, 117, 116, 101, 32, 50, 48, 0, 50, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 0, 50, 56, 44, 82, 111, 117, 116, 101, 32, 50, 50, 0, 50, 57, 44, 82, 111, 117, 116, 101, 32, 50, 51, 0, 51, 48, 44, 82, 111, 117, 116, 101, 32, 50, 52, 0, 51, 49, 44, 82, 111, 117, 116, 101, 32, 50, 53, 0, 51, 50, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 70, 111, 114, 101, 115, 116, 0, 51, 51, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 49, 70, 0, 51, 52, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 66, 49, 70, 0, 51, 53, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 66, 50, 70, 0, 51, 54, 44, 83, 46, 83, 46, 32, 65, 110, 110, 101, 0, 51, 55, 44, 68, 105, 103, 108, 101, 116, 116, 39, 115, 32, 67, 97, 118, 101, 0, 51, 56, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 51, 57, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 50, 70, 0, 52, 48, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 51, 70, 0, 52, 49, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 77, 97, 110, 115, 105, 111, 110, 32, 49, 70, 45, 51, 70, 0, 52, 50, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 77, 97, 110, 115, 105, 111, 110, 32, 66, 49, 70, 0, 52, 51, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 67, 101, 110, 116, 101, 114, 0, 52, 52, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 49, 0, 52, 53, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 50, 0, 52, 54, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 51, 0, 52, 55, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 49, 70, 0, 52, 56, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 66, 49, 70, 0, 52, 57, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 49, 70, 0, 53, 48, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 49, 70, 0, 53, 49, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 50, 70, 0, 53, 50, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 51, 70, 0, 53, 51, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 52, 70, 0, 53, 52, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 51, 70, 0, 53, 53, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 52, 70, 0, 53, 54, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 53, 70, 0, 53, 55, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 54, 70, 0, 53, 56, 44, 80, 111, 107, 195, 169, 109, 111, 110, 32, 84, 111, 119, 101, 114, 32, 55, 70, 0, 53, 57, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 49, 70, 0, 54, 48, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 50, 70, 0, 54, 49, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 54, 50, 44, 80, 111, 119, 101, 114, 32, 80, 108, 97, 110, 116, 0, 54, 51, 44, 79, 110, 101, 32, 73, 115, 108, 97, 110, 100, 0, 54, 52, 44, 70, 111, 117, 114, 32, 73, 115, 108, 97, 110, 100, 0, 54, 53, 44, 70, 105, 118, 101, 32, 73, 115, 108, 97, 110, 100, 0, 54, 54, 44, 75, 105, 110, 100, 108, 101, 32, 82, 111, 97, 100, 0, 54, 55, 44, 84, 114, 101, 97, 115, 117, 114, 101, 32, 66, 101, 97, 99, 104, 0, 54, 56, 44, 67, 97, 112, 101, 32, 66, 114, 105, 110, 107, 0, 54, 57, 44, 66, 111, 110, 100, 32, 66, 114, 105, 100, 103, 101, 0, 55, 48, 44, 84, 104, 114, 101, 101, 32, 73, 115, 108, 101, 32, 80, 111, 114, 116, 0, 55, 49, 44, 82, 101, 115, 111, 114, 116, 32, 71, 111, 114, 103, 101, 111, 117, 115, 0, 55, 50, 44, 87, 97, 116, 101, 114, 32, 76, 97, 98, 121, 114, 105, 110, 116, 104, 0, 55, 51, 44, 70, 105, 118, 101, 32, 73, 115, 108, 101, 32, 77, 101, 97, 100, 111, 119, 0, 55, 52, 44, 77, 101, 109, 111, 114, 105, 97, 108, 32, 80, 105, 108, 108, 97, 114, 0, 55, 53, 44, 79, 117, 116, 99, 97, 115, 116, 32, 73, 115, 108, 97, 110, 100, 0, 55, 54, 44, 71, 114, 101, 101, 110, 32, 80, 97, 116, 104, 0, 55, 55, 44, 87, 97, 116, 101, 114, 32, 80, 97, 116, 104, 0, 55, 56, 44, 82, 117, 105, 110, 32, 86, 97, 108, 108, 101, 121, 0, 55, 57, 44, 84, 114, 97, 105, 110, 101, 114, 32, 84, 111, 119, 101, 114, 32, 40, 101, 120, 116, 101, 114, 105, 111, 114, 41, 0, 56, 48, 44, 67, 97, 110, 121, 111, 110, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 56, 49, 44, 83, 101, 118, 97, 117, 108, 116, 32, 67, 97, 110, 121, 111, 110, 0, 56, 50, 44, 84, 97, 110, 111, 98, 121, 32, 82, 117, 105, 110, 115, 0, 56, 51, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 0, 56, 52, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 82, 111, 111, 109, 32, 49, 0, 56, 53, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 82, 111, 111, 109, 32, 50, 0, 56, 54, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 82, 111, 111, 109, 32, 51, 0, 56, 55, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 49, 70, 0, 56, 56, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 49, 70, 0, 56, 57, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 50, 70, 0, 57, 48, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 51, 70, 0, 57, 49, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 52, 70, 0, 57, 50, 44, 77, 116, 46, 32, 69, 109, 98, 101, 114, 32, 66, 53, 70, 0, 57, 51, 44, 66, 101, 114, 114, 121, 32, 70, 111, 114, 101, 115, 116, 0, 57, 52, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 0, 57, 53, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 32, 49, 70, 0, 57, 54, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 57, 55, 44, 73, 99, 101, 102, 97, 108, 108, 32, 67, 97, 118, 101, 32, 66, 97, 99, 107, 0, 57, 56, 44, 80, 97, 116, 116, 101, 114, 110, 32, 66, 117, 115, 104, 0, 57, 57, 44, 65, 108, 116, 101, 114, 105, 110, 103, 32, 67, 97, 118, 101, 0, 49, 48, 48, 44, 77, 111, 110, 101, 97, 110, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 49, 44, 76, 105, 112, 116, 111, 111, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 50, 44, 87, 101, 101, 112, 116, 104, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 51, 44, 68, 105, 108, 102, 111, 114, 100, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 52, 44, 83, 99, 117, 102, 105, 98, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 53, 44, 82, 105, 120, 121, 32, 67, 104, 97, 109, 98, 101, 114, 0, 49, 48, 54, 44, 86, 105, 97, 112, 111, 105, 115, 32, 67, 104, 97, 109, 98, 101, 114, 0 };
-
-constexpr std::array<u8, 1948> hgss_zh = { 48, 44, 78, 101, 119, 32, 66, 97, 114, 107, 32, 84, 111, 119, 110, 0, 49, 44, 82, 111, 117, 116, 101, 32, 50, 57, 0, 50, 44, 67, 104, 101, 114, 114, 121, 103, 114, 111, 118, 101, 32, 67, 105, 116, 121, 0, 51, 44, 82, 111, 117, 116, 101, 32, 51, 48, 0, 52, 44, 82, 111, 117, 116, 101, 32, 51, 49, 0, 53, 44, 86, 105, 111, 108, 101, 116, 32, 67, 105, 116, 121, 0, 54, 44, 83, 112, 114, 111, 117, 116, 32, 84, 111, 119, 101, 114, 0, 55, 44, 82, 111, 117, 116, 101, 32, 51, 50, 0, 56, 44, 82, 117, 105, 110, 115, 32, 111, 102, 32, 65, 108, 112, 104, 32, 40, 79, 117, 116, 115, 105, 100, 101, 41, 0, 57, 44, 82, 117, 105, 110, 115, 32, 111, 102, 32, 65, 108, 112, 104, 32, 40, 73, 110, 115, 105, 100, 101, 41, 0, 49, 48, 44, 85, 110, 105, 111, 110, 32, 67, 97, 118, 101, 32, 49, 70, 0, 49, 49, 44, 85, 110, 105, 111, 110, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 49, 50, 44, 85, 110, 105, 111, 110, 32, 67, 97, 118, 101, 32, 66, 50, 70, 0, 49, 51, 44, 82, 111, 117, 116, 101, 32, 51, 51, 0, 49, 52, 44, 83, 76, 79, 87, 80, 79, 75, 69, 32, 87, 101, 108, 108, 32, 49, 70, 0, 49, 53, 44, 83, 76, 79, 87, 80, 79, 75, 69, 32, 87, 101, 108, 108, 32, 66, 49, 70, 0, 49, 54, 44, 73, 108, 101, 120, 32, 70, 111, 114, 101, 115, 116, 0, 49, 55, 44, 82, 111, 117, 116, 101, 32, 51, 52, 0, 49, 56, 44, 82, 111, 117, 116, 101, 32, 51, 53, 0, 49, 57, 44, 78, 97, 116, 105, 111, 110, 97, 108, 32, 80, 97, 114, 107, 0, 50, 48, 44, 82, 111, 117, 116, 101, 32, 51, 54, 0, 50, 49, 44, 82, 111, 117, 116, 101, 32, 51, 55, 0, 50, 50, 44, 69, 99, 114, 117, 116, 101, 97, 107, 32, 67, 105, 116, 121, 0, 50, 51, 44, 66, 117, 114, 110, 101, 100, 32, 84, 111, 119, 101, 114, 32, 49, 70, 0, 50, 52, 44, 66, 117, 114, 110, 101, 100, 32, 84, 111, 119, 101, 114, 32, 66, 49, 70, 0, 50, 53, 44, 66, 101, 108, 108, 32, 84, 111, 119, 101, 114, 0, 50, 54, 44, 82, 111, 117, 116, 101, 32, 51, 56, 0, 50, 55, 44, 82, 111, 117, 116, 101, 32, 51, 57, 0, 50, 56, 44, 79, 108, 105, 118, 105, 110, 101, 32, 67, 105, 116, 121, 0, 50, 57, 44, 82, 111, 117, 116, 101, 32, 52, 48, 0, 51, 48, 44, 82, 111, 117, 116, 101, 32, 52, 49, 0, 51, 49, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 49, 70, 0, 51, 50, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 49, 70, 0, 51, 51, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 50, 70, 0, 51, 52, 44, 87, 104, 105, 114, 108, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 51, 70, 0, 51, 53, 44, 67, 105, 97, 110, 119, 111, 111, 100, 32, 67, 105, 116, 121, 0, 51, 54, 44, 82, 111, 117, 116, 101, 32, 52, 50, 0, 51, 55, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 49, 70, 0, 51, 56, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 49, 70, 32, 40, 66, 97, 99, 107, 41, 0, 51, 57, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 50, 70, 0, 52, 48, 44, 77, 116, 46, 32, 77, 111, 114, 116, 97, 114, 32, 66, 49, 70, 0, 52, 49, 44, 82, 111, 117, 116, 101, 32, 52, 51, 0, 52, 50, 44, 76, 97, 107, 101, 32, 111, 102, 32, 82, 97, 103, 101, 0, 52, 51, 44, 82, 111, 117, 116, 101, 32, 52, 52, 0, 52, 52, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 49, 70, 0, 52, 53, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 66, 49, 70, 0, 52, 54, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 66, 50, 70, 0, 52, 55, 44, 73, 99, 101, 32, 80, 97, 116, 104, 32, 66, 51, 70, 0, 52, 56, 44, 66, 108, 97, 99, 107, 116, 104, 111, 114, 110, 32, 67, 105, 116, 121, 0, 52, 57, 44, 68, 114, 97, 103, 111, 110, 226, 128, 153, 115, 32, 68, 101, 110, 0, 53, 48, 44, 82, 111, 117, 116, 101, 32, 52, 53, 0, 53, 49, 44, 82, 111, 117, 116, 101, 32, 52, 54, 0, 53, 50, 44, 68, 97, 114, 107, 32, 67, 97, 118, 101, 32, 40, 82, 111, 117, 116, 101, 32, 51, 49, 41, 0, 53, 51, 44, 68, 97, 114, 107, 32, 67, 97, 118, 101, 32, 40, 82, 111, 117, 116, 101, 32, 52, 53, 41, 0, 53, 52, 44, 82, 111, 117, 116, 101, 32, 52, 55, 0, 53, 53, 44, 77, 116, 46, 32, 77, 111, 111, 110, 0, 53, 54, 44, 77, 116, 46, 32, 77, 111, 111, 110, 32, 40, 67, 108, 101, 102, 97, 105, 114, 121, 41, 0, 53, 55, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 49, 70, 0, 53, 56, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 49, 70, 0, 53, 57, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 50, 70, 0, 54, 48, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 51, 70, 0, 54, 49, 44, 83, 101, 97, 102, 111, 97, 109, 32, 73, 115, 108, 97, 110, 100, 115, 32, 66, 52, 70, 0, 54, 50, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 49, 70, 0, 54, 51, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 67, 97, 118, 101, 32, 49, 70, 32, 84, 111, 112, 0, 54, 52, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 52, 70, 0, 54, 53, 44, 67, 108, 105, 102, 102, 32, 69, 100, 103, 101, 32, 71, 97, 116, 101, 0, 54, 54, 44, 67, 108, 105, 102, 102, 32, 67, 97, 118, 101, 0, 54, 55, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 0, 54, 56, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 50, 70, 0, 54, 57, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 67, 97, 118, 101, 32, 77, 111, 117, 110, 116, 97, 105, 110, 115, 105, 100, 101, 0, 55, 48, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 67, 97, 118, 101, 32, 51, 70, 0, 55, 49, 44, 77, 116, 46, 32, 83, 105, 108, 118, 101, 114, 32, 84, 111, 112, 0, 55, 50, 44, 82, 111, 117, 116, 101, 32, 49, 50, 0, 55, 51, 44, 82, 111, 117, 116, 101, 32, 49, 57, 0, 55, 52, 44, 82, 111, 117, 116, 101, 32, 50, 48, 0, 55, 53, 44, 80, 97, 108, 108, 101, 116, 32, 84, 111, 119, 110, 0, 55, 54, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 67, 105, 116, 121, 0, 55, 55, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 105, 116, 121, 0, 55, 56, 44, 86, 101, 114, 109, 105, 108, 105, 111, 110, 32, 67, 105, 116, 121, 0, 55, 57, 44, 67, 101, 108, 97, 100, 111, 110, 32, 67, 105, 116, 121, 0, 56, 48, 44, 70, 117, 99, 104, 115, 105, 97, 32, 67, 105, 116, 121, 0, 56, 49, 44, 67, 105, 110, 110, 97, 98, 97, 114, 32, 73, 115, 108, 97, 110, 100, 0, 56, 50, 44, 82, 111, 117, 116, 101, 32, 52, 56, 0, 56, 51, 44, 82, 111, 117, 116, 101, 32, 50, 54, 0, 56, 52, 44, 82, 111, 117, 116, 101, 32, 50, 55, 0, 56, 53, 44, 82, 111, 117, 116, 101, 32, 50, 56, 0, 56, 54, 44, 77, 116, 46, 32, 77, 111, 111, 110, 0, 56, 55, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 49, 70, 0, 56, 56, 44, 82, 111, 99, 107, 32, 84, 117, 110, 110, 101, 108, 32, 50, 70, 0, 56, 57, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 57, 48, 44, 82, 111, 117, 116, 101, 32, 49, 0, 57, 49, 44, 82, 111, 117, 116, 101, 32, 50, 32, 40, 83, 111, 117, 116, 104, 41, 0, 57, 50, 44, 82, 111, 117, 116, 101, 32, 51, 0, 57, 51, 44, 82, 111, 117, 116, 101, 32, 52, 0, 57, 52, 44, 82, 111, 117, 116, 101, 32, 53, 0, 57, 53, 44, 82, 111, 117, 116, 101, 32, 54, 0, 57, 54, 44, 82, 111, 117, 116, 101, 32, 55, 0, 57, 55, 44, 82, 111, 117, 116, 101, 32, 56, 0, 57, 56, 44, 82, 111, 117, 116, 101, 32, 57, 0, 57, 57, 44, 82, 111, 117, 116, 101, 32, 49, 48, 0, 49, 48, 48, 44, 82, 111, 117, 116, 101, 32, 49, 49, 0, 49, 48, 49, 44, 82, 111, 117, 116, 101, 32, 49, 51, 0, 49, 48, 50, 44, 82, 111, 117, 116, 101, 32, 49, 52, 0, 49, 48, 51, 44, 82, 111, 117, 116, 101, 32, 49, 53, 0, 49, 48, 52, 44, 82, 111, 117, 116, 101, 32, 49, 54, 0, 49, 48, 53, 44, 82, 111, 117, 116, 101, 32, 49, 55, 0, 49, 48, 54, 44, 82, 111, 117, 116, 101, 32, 49, 56, 0, 49, 48, 55, 44, 82, 111, 117, 116, 101, 32, 50, 49, 0, 49, 48, 56, 44, 82, 111, 117, 116, 101, 32, 50, 50, 0, 49, 48, 57, 44, 82, 111, 117, 116, 101, 32, 50, 52, 0, 49, 49, 48, 44, 82, 111, 117, 116, 101, 32, 50, 53, 0, 49, 49, 49, 44, 84, 111, 104, 106, 111, 32, 70, 97, 108, 108, 115, 0, 49, 49, 50, 44, 68, 73, 71, 76, 69, 84, 84, 226, 128, 153, 115, 32, 67, 97, 118, 101, 0, 49, 49, 51, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 50, 70, 0, 49, 49, 52, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 51, 70, 0, 49, 49, 53, 44, 82, 111, 117, 116, 101, 32, 50, 32, 40, 78, 111, 114, 116, 104, 41, 0, 49, 49, 54, 44, 86, 105, 114, 105, 100, 105, 97, 110, 32, 70, 111, 114, 101, 115, 116, 0, 49, 49, 55, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 49, 70, 0, 49, 49, 56, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 50, 70, 0, 49, 49, 57, 44, 67, 101, 114, 117, 108, 101, 97, 110, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0 };
-
-constexpr std::array<u8, 181> natures_zh = { 229, 139, 164, 229, 165, 139, 0, 230, 128, 149, 229, 175, 130, 229, 175, 158, 0, 229, 139, 135, 230, 149, 162, 0, 229, 155, 186, 230, 137, 167, 0, 233, 161, 189, 231, 154, 174, 0, 229, 164, 167, 232, 131, 134, 0, 229, 157, 166, 231, 142, 135, 0, 230, 130, 160, 233, 151, 178, 0, 230, 183, 152, 230, 176, 148, 0, 228, 185, 144, 229, 164, 169, 0, 232, 131, 134, 229, 176, 143, 0, 230, 128, 165, 232, 186, 129, 0, 232, 174, 164, 231, 156, 159, 0, 231, 136, 189, 230, 156, 151, 0, 229, 164, 169, 231, 156, 159, 0, 229, 134, 133, 230, 149, 155, 0, 230, 133, 162, 229, 144, 158, 229, 144, 158, 0, 229, 134, 183, 233, 157, 153, 0, 229, 174, 179, 231, 190, 158, 0, 233, 169, 172, 232, 153, 142, 0, 230, 184, 169, 229, 146, 140, 0, 230, 184, 169, 233, 161, 186, 0, 232, 135, 170, 229, 164, 167, 0, 230, 133, 142, 233, 135, 141, 0, 230, 181, 174, 232, 186, 129, 0 };
-
-constexpr std::array<u8, 85> powers_zh = { 230, 160, 188, 230, 150, 151, 0, 233, 163, 158, 232, 161, 140, 0, 230, 175, 146, 0, 229, 156, 176, 233, 157, 162, 0, 229, 178, 169, 231, 159, 179, 0, 232, 153, 171, 0, 229, 185, 189, 231, 129, 181, 0, 233, 146, 162, 0, 231, 129, 171, 0, 230, 176, 180, 0, 232, 141, 137, 0, 231, 148, 181, 0, 232, 182, 133, 232, 131, 189, 229, 138, 155, 0, 229, 134, 176, 0, 233, 190, 153, 0, 230, 129, 182, 0 };
-
-constexpr std::array<u8, 1480> rse_zh = { 48, 44, 68, 101, 119, 102, 111, 114, 100, 32, 84, 111, 119, 110, 0, 49, 44, 80, 97, 99, 105, 102, 105, 100, 108, 111, 103, 32, 84, 111, 119, 110, 0, 50, 44, 80, 101, 116, 97, 108, 98, 117, 114, 103, 32, 67, 105, 116, 121, 0, 51, 44, 83, 108, 97, 116, 101, 112, 111, 114, 116, 32, 67, 105, 116, 121, 0, 52, 44, 76, 105, 108, 121, 99, 111, 118, 101, 32, 67, 105, 116, 121, 0, 53, 44, 77, 111, 115, 115, 100, 101, 101, 112, 32, 67, 105, 116, 121, 0, 54, 44, 83, 111, 111, 116, 111, 112, 111, 108, 105, 115, 32, 67, 105, 116, 121, 0, 55, 44, 69, 118, 101, 114, 32, 71, 114, 97, 110, 100, 101, 32, 67, 105, 116, 121, 0, 56, 44, 82, 111, 117, 116, 101, 32, 49, 48, 49, 0, 57, 44, 82, 111, 117, 116, 101, 32, 49, 48, 50, 0, 49, 48, 44, 82, 111, 117, 116, 101, 32, 49, 48, 51, 0, 49, 49, 44, 82, 111, 117, 116, 101, 32, 49, 48, 52, 0, 49, 50, 44, 82, 111, 117, 116, 101, 32, 49, 48, 53, 0, 49, 51, 44, 82, 111, 117, 116, 101, 32, 49, 48, 54, 0, 49, 52, 44, 82, 111, 117, 116, 101, 32, 49, 48, 55, 0, 49, 53, 44, 82, 111, 117, 116, 101, 32, 49, 48, 56, 0, 49, 54, 44, 82, 111, 117, 116, 101, 32, 49, 48, 57, 0, 49, 55, 44, 82, 111, 117, 116, 101, 32, 49, 49, 48, 0, 49, 56, 44, 82, 111, 117, 116, 101, 32, 49, 49, 49, 0, 49, 57, 44, 82, 111, 117, 116, 101, 32, 49, 49, 50, 0, 50, 48, 44, 82, 111, 117, 116, 101, 32, 49, 49, 51, 0, 50, 49, 44, 82, 111, 117, 116, 101, 32, 49, 49, 52, 0, 50, 50, 44, 82, 111, 117, 116, 101, 32, 49, 49, 53, 0, 50, 51, 44, 82, 111, 117, 116, 101, 32, 49, 49, 54, 0, 50, 52, 44, 82, 111, 117, 116, 101, 32, 49, 49, 55, 0, 50, 53, 44, 82, 111, 117, 116, 101, 32, 49, 49, 56, 0, 50, 54, 44, 82, 111, 117, 116, 101, 32, 49, 49, 57, 0, 50, 55, 44, 82, 111, 117, 116, 101, 32, 49, 50, 48, 0, 50, 56, 44, 82, 111, 117, 116, 101, 32, 49, 50, 49, 0, 50, 57, 44, 82, 111, 117, 116, 101, 32, 49, 50, 50, 0, 51, 48, 44, 82, 111, 117, 116, 101, 32, 49, 50, 51, 0, 51, 49, 44, 82, 111, 117, 116, 101, 32, 49, 50, 52, 0, 51, 50, 44, 82, 111, 117, 116, 101, 32, 49, 50, 53, 0, 51, 51, 44, 82, 111, 117, 116, 101, 32, 49, 50, 54, 0, 51, 52, 44, 82, 111, 117, 116, 101, 32, 49, 50, 55, 0, 51, 53, 44, 82, 111, 117, 116, 101, 32, 49, 50, 56, 0, 51, 54, 44, 82, 111, 117, 116, 101, 32, 49, 50, 57, 0, 51, 55, 44, 82, 111, 117, 116, 101, 32, 49, 51, 48, 0, 51, 56, 44, 82, 111, 117, 116, 101, 32, 49, 51, 49, 0, 51, 57, 44, 82, 111, 117, 116, 101, 32, 49, 51, 50, 0, 52, 48, 44, 82, 111, 117, 116, 101, 32, 49, 51, 51, 0, 52, 49, 44, 82, 111, 117, 116, 101, 32, 49, 51, 52, 0, 52, 50, 44, 85, 110, 100, 101, 114, 119, 97, 116, 101, 114, 32, 40, 82, 111, 117, 116, 101, 32, 49, 50, 52, 41, 0, 52, 51, 44, 85, 110, 100, 101, 114, 119, 97, 116, 101, 114, 32, 40, 82, 111, 117, 116, 101, 32, 49, 50, 54, 41, 0, 52, 52, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 49, 70, 0, 52, 53, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 83, 116, 101, 118, 101, 110, 39, 115, 32, 82, 111, 111, 109, 0, 52, 54, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 66, 49, 70, 0, 52, 55, 44, 71, 114, 97, 110, 105, 116, 101, 32, 67, 97, 118, 101, 32, 66, 50, 70, 0, 52, 56, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 49, 0, 52, 57, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 50, 0, 53, 48, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 51, 0, 53, 49, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 52, 0, 53, 50, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 53, 0, 53, 51, 44, 83, 97, 102, 97, 114, 105, 32, 90, 111, 110, 101, 32, 65, 114, 101, 97, 32, 54, 0, 53, 52, 44, 80, 101, 116, 97, 108, 98, 117, 114, 103, 32, 87, 111, 111, 100, 115, 0, 53, 53, 44, 82, 117, 115, 116, 117, 114, 102, 32, 84, 117, 110, 110, 101, 108, 0, 53, 54, 44, 65, 98, 97, 110, 100, 111, 110, 101, 100, 32, 83, 104, 105, 112, 0, 53, 55, 44, 78, 101, 119, 32, 77, 97, 117, 118, 105, 108, 108, 101, 32, 40, 69, 110, 116, 114, 97, 110, 99, 101, 41, 0, 53, 56, 44, 78, 101, 119, 32, 77, 97, 117, 118, 105, 108, 108, 101, 32, 40, 66, 97, 115, 101, 109, 101, 110, 116, 41, 0, 53, 57, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 49, 70, 32, 49, 82, 0, 54, 48, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 49, 70, 32, 50, 82, 0, 54, 49, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 66, 49, 70, 32, 49, 82, 0, 54, 50, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 66, 49, 70, 32, 50, 82, 0, 54, 51, 44, 77, 101, 116, 101, 111, 114, 32, 70, 97, 108, 108, 115, 32, 83, 116, 101, 118, 101, 110, 39, 115, 32, 67, 97, 118, 101, 0, 54, 52, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 49, 70, 45, 51, 70, 0, 54, 53, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 52, 70, 45, 54, 70, 0, 54, 54, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 69, 120, 116, 101, 114, 105, 111, 114, 0, 54, 55, 44, 77, 116, 46, 32, 80, 121, 114, 101, 32, 83, 117, 109, 109, 105, 116, 0, 54, 56, 44, 83, 104, 111, 97, 108, 32, 67, 97, 118, 101, 0, 54, 57, 44, 83, 104, 111, 97, 108, 32, 67, 97, 118, 101, 32, 73, 99, 101, 32, 82, 111, 111, 109, 0, 55, 48, 44, 83, 101, 97, 102, 108, 111, 111, 114, 32, 67, 97, 118, 101, 114, 110, 0, 55, 49, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 49, 70, 0, 55, 50, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 49, 70, 0, 55, 51, 44, 86, 105, 99, 116, 111, 114, 121, 32, 82, 111, 97, 100, 32, 66, 50, 70, 0, 55, 52, 44, 67, 97, 118, 101, 32, 111, 102, 32, 79, 114, 105, 103, 105, 110, 32, 69, 110, 116, 114, 97, 110, 99, 101, 0, 55, 53, 44, 67, 97, 118, 101, 32, 111, 102, 32, 79, 114, 105, 103, 105, 110, 0, 55, 54, 44, 70, 105, 101, 114, 121, 32, 80, 97, 116, 104, 0, 55, 55, 44, 74, 97, 103, 103, 101, 100, 32, 80, 97, 115, 115, 0, 55, 56, 44, 83, 107, 121, 32, 80, 105, 108, 108, 97, 114, 32, 49, 70, 0, 55, 57, 44, 83, 107, 121, 32, 80, 105, 108, 108, 97, 114, 32, 51, 70, 0, 56, 48, 44, 83, 107, 121, 32, 80, 105, 108, 108, 97, 114, 32, 53, 70, 0, 56, 49, 44, 77, 97, 103, 109, 97, 32, 72, 105, 100, 101, 111, 117, 116, 0, 56, 50, 44, 77, 105, 114, 97, 103, 101, 32, 84, 111, 119, 101, 114, 0, 56, 51, 44, 65, 114, 116, 105, 115, 97, 110, 32, 67, 97, 118, 101, 0, 56, 52, 44, 68, 101, 115, 101, 114, 116, 32, 85, 110, 100, 101, 114, 112, 97, 115, 115, 0, 56, 53, 44, 65, 108, 116, 101, 114, 105, 110, 103, 32, 67, 97, 118, 101, 0 };
-
-constexpr std::array<u8, 8805> species_zh = { 239, 187, 191, 229, 166, 153, 232, 155, 153, 231, 167, 141, 229, 173, 144, 0, 229, 166, 153, 232, 155, 153, 232, 141, 137, 0, 229, 166, 153, 232, 155, 153, 232, 138, 177, 0, 229, 176, 143, 231, 129, 171, 233, 190, 153, 0, 231, 129, 171, 230, 129, 144, 233, 190, 153, 0, 229, 150, 183, 231, 129, 171, 233, 190, 153, 0, 230, 157, 176, 229, 176, 188, 233, 190, 159, 0, 229, 141, 161, 229, 146, 170, 233, 190, 159, 0, 230, 176, 180, 231, 174, 173, 233, 190, 159, 0, 231, 187, 191, 230, 175, 155, 232, 153, 171, 0, 233, 147, 129, 231, 148, 178, 232, 155, 185, 0, 229, 183, 180, 229, 164, 167, 232, 157, 182, 0, 231, 139, 172, 232, 167, 146, 232, 153, 171, 0, 233, 147, 129, 229, 163, 179, 232, 155, 185, 0, 229, 164, 167, 233, 146, 136, 232, 156, 130, 0, 230, 179, 162, 230, 179, 162, 0, 230, 175, 148, 230, 175, 148, 233, 184, 159, 0, 229, 164, 167, 230, 175, 148, 233, 184, 159, 0, 229, 176, 143, 230, 139, 137, 232, 190, 190, 0, 230, 139, 137, 232, 190, 190, 0, 231, 131, 136, 233, 155, 128, 0, 229, 164, 167, 229, 152, 180, 233, 155, 128, 0, 233, 152, 191, 230, 159, 143, 232, 155, 135, 0, 233, 152, 191, 230, 159, 143, 230, 128, 170, 0, 231, 154, 174, 229, 141, 161, 228, 184, 152, 0, 233, 155, 183, 228, 184, 152, 0, 231, 169, 191, 229, 177, 177, 233, 188, 160, 0, 231, 169, 191, 229, 177, 177, 231, 142, 139, 0, 229, 176, 188, 229, 164, 154, 229, 133, 176, 0, 229, 176, 188, 229, 164, 154, 229, 168, 156, 0, 229, 176, 188, 229, 164, 154, 229, 144, 142, 0, 229, 176, 188, 229, 164, 154, 230, 156, 151, 0, 229, 176, 188, 229, 164, 154, 229, 138, 155, 232, 175, 186, 0, 229, 176, 188, 229, 164, 154, 231, 142, 139, 0, 231, 154, 174, 231, 154, 174, 0, 231, 154, 174, 229, 143, 175, 232, 165, 191, 0, 229, 133, 173, 229, 176, 190, 0, 228, 185, 157, 229, 176, 190, 0, 232, 131, 150, 228, 184, 129, 0, 232, 131, 150, 229, 143, 175, 228, 184, 129, 0, 232, 182, 133, 233, 159, 179, 232, 157, 160, 0, 229, 164, 167, 229, 152, 180, 232, 157, 160, 0, 232, 181, 176, 232, 183, 175, 232, 141, 137, 0, 232, 135, 173, 232, 135, 173, 232, 138, 177, 0, 233, 156, 184, 231, 142, 139, 232, 138, 177, 0, 230, 180, 190, 230, 139, 137, 230, 150, 175, 0, 230, 180, 190, 230, 139, 137, 230, 150, 175, 231, 137, 185, 0, 230, 175, 155, 231, 144, 131, 0, 230, 145, 169, 233, 178, 129, 232, 155, 190, 0, 229, 156, 176, 233, 188, 160, 0, 228, 184, 137, 229, 156, 176, 233, 188, 160, 0, 229, 150, 181, 229, 150, 181, 0, 231, 140, 171, 232, 128, 129, 229, 164, 167, 0, 229, 143, 175, 232, 190, 190, 233, 184, 173, 0, 229, 147, 165, 232, 190, 190, 233, 184, 173, 0, 231, 140, 180, 230, 128, 170, 0, 231, 129, 171, 230, 154, 180, 231, 140, 180, 0, 229, 141, 161, 232, 146, 130, 231, 139, 151, 0, 233, 163, 142, 233, 128, 159, 231, 139, 151, 0, 232, 154, 138, 233, 166, 153, 232, 157, 140, 232, 154, 170, 0, 232, 154, 138, 233, 166, 153, 229, 144, 155, 0, 232, 154, 138, 233, 166, 153, 230, 179, 179, 229, 163, 171, 0, 229, 135, 175, 232, 165, 191, 0, 229, 139, 135, 229, 159, 186, 230, 139, 137, 0, 232, 131, 161, 229, 156, 176, 0, 232, 133, 149, 229, 138, 155, 0, 232, 177, 170, 229, 138, 155, 0, 230, 128, 170, 229, 138, 155, 0, 229, 150, 135, 229, 143, 173, 232, 138, 189, 0, 229, 143, 163, 229, 145, 134, 232, 138, 177, 0, 229, 164, 167, 233, 163, 159, 232, 138, 177, 0, 231, 142, 155, 231, 145, 153, 230, 176, 180, 230, 175, 141, 0, 230, 175, 146, 229, 136, 186, 230, 176, 180, 230, 175, 141, 0, 229, 176, 143, 230, 139, 179, 231, 159, 179, 0, 233, 154, 134, 233, 154, 134, 231, 159, 179, 0, 233, 154, 134, 233, 154, 134, 229, 178, 169, 0, 229, 176, 143, 231, 129, 171, 233, 169, 172, 0, 231, 131, 136, 231, 132, 176, 233, 169, 172, 0, 229, 145, 134, 229, 145, 134, 229, 133, 189, 0, 229, 145, 134, 229, 163, 179, 229, 133, 189, 0, 229, 176, 143, 231, 163, 129, 230, 128, 170, 0, 228, 184, 137, 229, 144, 136, 228, 184, 128, 231, 163, 129, 230, 128, 170, 0, 229, 164, 167, 232, 145, 177, 233, 184, 173, 0, 229, 152, 159, 229, 152, 159, 0, 229, 152, 159, 229, 152, 159, 229, 136, 169, 0, 229, 176, 143, 230, 181, 183, 231, 139, 174, 0, 231, 153, 189, 230, 181, 183, 231, 139, 174, 0, 232, 135, 173, 230, 179, 165, 0, 232, 135, 173, 232, 135, 173, 230, 179, 165, 0, 229, 164, 167, 232, 136, 140, 232, 180, 157, 0, 229, 136, 186, 231, 148, 178, 232, 180, 157, 0, 233, 172, 188, 230, 150, 175, 0, 233, 172, 188, 230, 150, 175, 233, 128, 154, 0, 232, 128, 191, 233, 172, 188, 0, 229, 164, 167, 229, 178, 169, 232, 155, 135, 0, 229, 130, 172, 231, 156, 160, 232, 178, 152, 0, 229, 188, 149, 230, 162, 166, 232, 178, 152, 228, 186, 186, 0, 229, 164, 167, 233, 146, 179, 232, 159, 185, 0, 229, 183, 168, 233, 146, 179, 232, 159, 185, 0, 233, 156, 185, 233, 155, 179, 231, 148, 181, 231, 144, 131, 0, 233, 161, 189, 231, 154, 174, 233, 155, 183, 229, 188, 185, 0, 232, 155, 139, 232, 155, 139, 0, 230, 164, 176, 232, 155, 139, 230, 160, 145, 0, 229, 141, 161, 230, 139, 137, 229, 141, 161, 230, 139, 137, 0, 229, 152, 142, 229, 149, 166, 229, 152, 142, 229, 149, 166, 0, 233, 163, 158, 232, 133, 191, 233, 131, 142, 0, 229, 191, 171, 230, 139, 179, 233, 131, 142, 0, 229, 164, 167, 232, 136, 140, 229, 164, 180, 0, 231, 147, 166, 230, 150, 175, 229, 188, 185, 0, 229, 143, 140, 229, 188, 185, 231, 147, 166, 230, 150, 175, 0, 231, 139, 172, 232, 167, 146, 231, 138, 128, 231, 137, 155, 0, 233, 146, 187, 232, 167, 146, 231, 138, 128, 229, 133, 189, 0, 229, 144, 137, 229, 136, 169, 232, 155, 139, 0, 232, 148, 147, 232, 151, 164, 230, 128, 170, 0, 232, 162, 139, 229, 133, 189, 0, 229, 162, 168, 230, 181, 183, 233, 169, 172, 0, 230, 181, 183, 229, 136, 186, 233, 190, 153, 0, 232, 167, 146, 233, 135, 145, 233, 177, 188, 0, 233, 135, 145, 233, 177, 188, 231, 142, 139, 0, 230, 181, 183, 230, 152, 159, 230, 152, 159, 0, 229, 174, 157, 231, 159, 179, 230, 181, 183, 230, 152, 159, 0, 233, 173, 148, 229, 162, 153, 228, 186, 186, 229, 129, 182, 0, 233, 163, 158, 229, 164, 169, 232, 158, 179, 232, 158, 130, 0, 232, 191, 183, 229, 148, 135, 229, 167, 144, 0, 231, 148, 181, 229, 135, 187, 229, 133, 189, 0, 233, 184, 173, 229, 152, 180, 231, 129, 171, 229, 133, 189, 0, 229, 135, 175, 231, 189, 151, 230, 150, 175, 0, 232, 130, 175, 230, 179, 176, 231, 189, 151, 0, 233, 178, 164, 233, 177, 188, 231, 142, 139, 0, 230, 154, 180, 233, 178, 164, 233, 190, 153, 0, 230, 139, 137, 230, 153, 174, 230, 139, 137, 230, 150, 175, 0, 231, 153, 190, 229, 143, 152, 230, 128, 170, 0, 228, 188, 138, 229, 184, 131, 0, 230, 176, 180, 228, 188, 138, 229, 184, 131, 0, 233, 155, 183, 228, 188, 138, 229, 184, 131, 0, 231, 129, 171, 228, 188, 138, 229, 184, 131, 0, 229, 164, 154, 232, 190, 185, 229, 133, 189, 0, 232, 143, 138, 231, 159, 179, 229, 133, 189, 0, 229, 164, 154, 229, 136, 186, 232, 143, 138, 231, 159, 179, 229, 133, 189, 0, 229, 140, 150, 231, 159, 179, 231, 155, 148, 0, 233, 149, 176, 229, 136, 128, 231, 155, 148, 0, 229, 140, 150, 231, 159, 179, 231, 191, 188, 233, 190, 153, 0, 229, 141, 161, 230, 175, 148, 229, 133, 189, 0, 230, 128, 165, 229, 134, 187, 233, 184, 159, 0, 233, 151, 170, 231, 148, 181, 233, 184, 159, 0, 231, 129, 171, 231, 132, 176, 233, 184, 159, 0, 232, 191, 183, 228, 189, 160, 233, 190, 153, 0, 229, 147, 136, 229, 133, 139, 233, 190, 153, 0, 229, 191, 171, 233, 190, 153, 0, 232, 182, 133, 230, 162, 166, 0, 230, 162, 166, 229, 185, 187, 0, 232, 143, 138, 232, 141, 137, 229, 143, 182, 0, 230, 156, 136, 230, 161, 130, 229, 143, 182, 0, 229, 164, 167, 231, 171, 186, 232, 145, 181, 0, 231, 129, 171, 231, 144, 131, 233, 188, 160, 0, 231, 129, 171, 229, 178, 169, 233, 188, 160, 0, 231, 129, 171, 230, 154, 180, 229, 133, 189, 0, 229, 176, 143, 233, 148, 175, 233, 179, 132, 0, 232, 147, 157, 233, 179, 132, 0, 229, 164, 167, 229, 138, 155, 233, 179, 132, 0, 229, 176, 190, 231, 171, 139, 0, 229, 164, 167, 229, 176, 190, 231, 171, 139, 0, 229, 146, 149, 229, 146, 149, 0, 231, 140, 171, 229, 164, 180, 229, 164, 156, 233, 185, 176, 0, 232, 138, 173, 231, 147, 162, 232, 153, 171, 0, 229, 174, 137, 231, 147, 162, 232, 153, 171, 0, 229, 156, 134, 228, 184, 157, 232, 155, 155, 0, 233, 152, 191, 229, 136, 169, 229, 164, 154, 230, 150, 175, 0, 229, 143, 137, 229, 173, 151, 232, 157, 160, 0, 231, 129, 175, 231, 172, 188, 233, 177, 188, 0, 231, 148, 181, 231, 129, 175, 230, 128, 170, 0, 231, 154, 174, 228, 184, 152, 0, 231, 154, 174, 229, 174, 157, 229, 174, 157, 0, 229, 174, 157, 229, 174, 157, 228, 184, 129, 0, 230, 179, 162, 229, 133, 139, 230, 175, 148, 0, 230, 179, 162, 229, 133, 139, 229, 159, 186, 229, 143, 164, 0, 229, 164, 169, 231, 132, 182, 233, 155, 128, 0, 229, 164, 169, 231, 132, 182, 233, 184, 159, 0, 229, 146, 169, 229, 136, 169, 231, 190, 138, 0, 232, 140, 184, 232, 140, 184, 231, 190, 138, 0, 231, 148, 181, 233, 190, 153, 0, 231, 190, 142, 228, 184, 189, 232, 138, 177, 0, 231, 142, 155, 229, 138, 155, 233, 156, 178, 0, 231, 142, 155, 229, 138, 155, 233, 156, 178, 228, 184, 189, 0, 230, 160, 145, 230, 137, 141, 230, 128, 170, 0, 232, 154, 138, 233, 166, 153, 232, 155, 153, 231, 154, 135, 0, 230, 175, 189, 229, 173, 144, 232, 141, 137, 0, 230, 175, 189, 229, 173, 144, 232, 138, 177, 0, 230, 175, 189, 229, 173, 144, 230, 163, 137, 0, 233, 149, 191, 229, 176, 190, 230, 128, 170, 230, 137, 139, 0, 229, 144, 145, 230, 151, 165, 231, 167, 141, 229, 173, 144, 0, 229, 144, 145, 230, 151, 165, 232, 138, 177, 230, 128, 170, 0, 232, 156, 187, 232, 156, 187, 232, 156, 147, 0, 228, 185, 140, 230, 179, 162, 0, 230, 178, 188, 231, 142, 139, 0, 229, 164, 170, 233, 152, 179, 228, 188, 138, 229, 184, 131, 0, 230, 156, 136, 228, 186, 174, 228, 188, 138, 229, 184, 131, 0, 233, 187, 145, 230, 154, 151, 233, 184, 166, 0, 229, 145, 134, 229, 145, 134, 231, 142, 139, 0, 230, 162, 166, 229, 166, 150, 0, 230, 156, 170, 231, 159, 165, 229, 155, 190, 232, 133, 190, 0, 230, 158, 156, 231, 132, 182, 231, 191, 129, 0, 233, 186, 146, 233, 186, 159, 229, 165, 135, 0, 230, 166, 155, 230, 158, 156, 231, 144, 131, 0, 228, 189, 155, 231, 131, 136, 230, 137, 152, 230, 150, 175, 0, 229, 156, 159, 233, 190, 153, 229, 188, 159, 229, 188, 159, 0, 229, 164, 169, 232, 157, 142, 0, 229, 164, 167, 233, 146, 162, 232, 155, 135, 0, 229, 184, 131, 233, 178, 129, 0, 229, 184, 131, 233, 178, 129, 231, 154, 135, 0, 229, 141, 131, 233, 146, 136, 233, 177, 188, 0, 229, 183, 168, 233, 146, 179, 232, 158, 179, 232, 158, 130, 0, 229, 163, 182, 229, 163, 182, 0, 232, 181, 171, 230, 139, 137, 229, 133, 139, 231, 189, 151, 230, 150, 175, 0, 231, 139, 131, 230, 139, 137, 0, 231, 134, 138, 229, 174, 157, 229, 174, 157, 0, 229, 156, 136, 229, 156, 136, 231, 134, 138, 0, 231, 134, 148, 229, 178, 169, 232, 153, 171, 0, 231, 134, 148, 229, 178, 169, 232, 156, 151, 231, 137, 155, 0, 229, 176, 143, 229, 177, 177, 231, 140, 170, 0, 233, 149, 191, 230, 175, 155, 231, 140, 170, 0, 229, 164, 170, 233, 152, 179, 231, 143, 138, 231, 145, 154, 0, 233, 147, 129, 231, 130, 174, 233, 177, 188, 0, 231, 171, 160, 233, 177, 188, 230, 161, 182, 0, 228, 191, 161, 228, 189, 191, 233, 184, 159, 0, 229, 183, 168, 231, 191, 133, 233, 163, 158, 233, 177, 188, 0, 231, 155, 148, 231, 148, 178, 233, 184, 159, 0, 230, 136, 180, 233, 178, 129, 230, 175, 148, 0, 233, 187, 145, 233, 178, 129, 229, 138, 160, 0, 229, 136, 186, 233, 190, 153, 231, 142, 139, 0, 229, 176, 143, 229, 176, 143, 232, 177, 161, 0, 233, 161, 191, 231, 148, 178, 0, 229, 164, 154, 232, 190, 185, 229, 133, 189, 226, 133, 161, 0, 230, 131, 138, 232, 167, 146, 233, 185, 191, 0, 229, 155, 190, 229, 155, 190, 231, 138, 172, 0, 230, 151, 160, 231, 149, 143, 229, 176, 143, 229, 173, 144, 0, 230, 136, 152, 232, 136, 158, 233, 131, 142, 0, 232, 191, 183, 229, 148, 135, 229, 168, 131, 0, 231, 148, 181, 229, 135, 187, 230, 128, 170, 0, 233, 184, 173, 229, 152, 180, 229, 174, 157, 229, 174, 157, 0, 229, 164, 167, 229, 165, 182, 231, 189, 144, 0, 229, 185, 184, 231, 166, 143, 232, 155, 139, 0, 233, 155, 183, 229, 133, 172, 0, 231, 130, 142, 229, 184, 157, 0, 230, 176, 180, 229, 144, 155, 0, 229, 185, 188, 229, 159, 186, 230, 139, 137, 230, 150, 175, 0, 230, 178, 153, 229, 159, 186, 230, 139, 137, 230, 150, 175, 0, 231, 143, 173, 229, 159, 186, 230, 139, 137, 230, 150, 175, 0, 230, 180, 155, 229, 165, 135, 228, 186, 154, 0, 229, 135, 164, 231, 142, 139, 0, 230, 151, 182, 230, 139, 137, 230, 175, 148, 0, 230, 156, 168, 229, 174, 136, 229, 174, 171, 0, 230, 163, 174, 230, 158, 151, 232, 156, 165, 232, 156, 180, 0, 232, 156, 165, 232, 156, 180, 231, 142, 139, 0, 231, 129, 171, 231, 168, 154, 233, 184, 161, 0, 229, 138, 155, 229, 163, 174, 233, 184, 161, 0, 231, 129, 171, 231, 132, 176, 233, 184, 161, 0, 230, 176, 180, 232, 183, 131, 233, 177, 188, 0, 230, 178, 188, 232, 183, 131, 233, 177, 188, 0, 229, 183, 168, 230, 178, 188, 230, 128, 170, 0, 229, 156, 159, 231, 139, 188, 231, 138, 172, 0, 229, 164, 167, 231, 139, 188, 231, 138, 172, 0, 232, 155, 135, 231, 186, 185, 231, 134, 138, 0, 231, 155, 180, 229, 134, 178, 231, 134, 138, 0, 229, 136, 186, 229, 176, 190, 232, 153, 171, 0, 231, 148, 178, 229, 163, 179, 232, 140, 167, 0, 231, 139, 169, 231, 140, 142, 229, 135, 164, 232, 157, 182, 0, 231, 155, 190, 231, 148, 178, 232, 140, 167, 0, 230, 175, 146, 231, 178, 137, 232, 155, 190, 0, 232, 142, 178, 229, 143, 182, 231, 171, 165, 229, 173, 144, 0, 232, 142, 178, 229, 184, 189, 229, 176, 143, 231, 171, 165, 0, 228, 185, 144, 229, 164, 169, 230, 178, 179, 231, 171, 165, 0, 230, 169, 161, 229, 174, 158, 230, 158, 156, 0, 233, 149, 191, 233, 188, 187, 229, 143, 182, 0, 231, 139, 161, 231, 140, 190, 229, 164, 169, 231, 139, 151, 0, 229, 130, 178, 233, 170, 168, 231, 135, 149, 0, 229, 164, 167, 231, 142, 139, 231, 135, 149, 0, 233, 149, 191, 231, 191, 133, 233, 184, 165, 0, 229, 164, 167, 229, 152, 180, 233, 184, 165, 0, 230, 139, 137, 233, 178, 129, 230, 139, 137, 228, 184, 157, 0, 229, 165, 135, 233, 178, 129, 232, 142, 137, 229, 174, 137, 0, 230, 178, 153, 229, 165, 136, 230, 156, 181, 0, 230, 186, 156, 230, 186, 156, 231, 179, 150, 231, 144, 131, 0, 233, 155, 168, 231, 191, 133, 232, 155, 190, 0, 232, 152, 145, 232, 152, 145, 232, 143, 135, 0, 230, 150, 151, 231, 172, 160, 232, 143, 135, 0, 230, 135, 146, 228, 186, 186, 231, 141, 173, 0, 232, 191, 135, 229, 138, 168, 231, 140, 191, 0, 232, 175, 183, 229, 129, 135, 231, 142, 139, 0, 229, 156, 159, 229, 177, 133, 229, 191, 141, 229, 163, 171, 0, 233, 147, 129, 233, 157, 162, 229, 191, 141, 232, 128, 133, 0, 232, 132, 177, 229, 163, 179, 229, 191, 141, 232, 128, 133, 0, 229, 146, 149, 229, 166, 158, 229, 166, 158, 0, 229, 144, 188, 231, 136, 134, 229, 188, 185, 0, 231, 136, 134, 233, 159, 179, 230, 128, 170, 0, 229, 185, 149, 228, 184, 139, 229, 138, 155, 229, 163, 171, 0, 233, 147, 129, 230, 142, 140, 229, 138, 155, 229, 163, 171, 0, 233, 156, 178, 229, 138, 155, 228, 184, 189, 0, 230, 156, 157, 229, 140, 151, 233, 188, 187, 0, 229, 144, 145, 229, 176, 190, 229, 150, 181, 0, 228, 188, 152, 233, 155, 133, 231, 140, 171, 0, 229, 139, 190, 233, 173, 130, 231, 156, 188, 0, 229, 164, 167, 229, 152, 180, 229, 168, 131, 0, 229, 143, 175, 229, 143, 175, 229, 164, 154, 230, 139, 137, 0, 229, 143, 175, 229, 164, 154, 230, 139, 137, 0, 230, 179, 162, 229, 163, 171, 229, 143, 175, 229, 164, 154, 230, 139, 137, 0, 231, 142, 155, 230, 178, 153, 233, 130, 163, 0, 230, 129, 176, 233, 155, 183, 229, 167, 134, 0, 232, 144, 189, 233, 155, 183, 229, 133, 189, 0, 233, 155, 183, 231, 148, 181, 229, 133, 189, 0, 230, 173, 163, 231, 148, 181, 230, 139, 141, 230, 139, 141, 0, 232, 180, 159, 231, 148, 181, 230, 139, 141, 230, 139, 141, 0, 231, 148, 181, 232, 144, 164, 232, 153, 171, 0, 231, 148, 156, 231, 148, 156, 232, 144, 164, 0, 230, 175, 146, 232, 148, 183, 232, 150, 135, 0, 230, 186, 182, 233, 163, 159, 229, 133, 189, 0, 229, 144, 158, 233, 163, 159, 229, 133, 189, 0, 229, 136, 169, 231, 137, 153, 233, 177, 188, 0, 229, 183, 168, 231, 137, 153, 233, 178, 168, 0, 229, 144, 188, 229, 144, 188, 233, 178, 184, 0, 229, 144, 188, 233, 178, 184, 231, 142, 139, 0, 229, 145, 134, 231, 129, 171, 233, 169, 188, 0, 229, 150, 183, 231, 129, 171, 233, 169, 188, 0, 231, 133, 164, 231, 130, 173, 233, 190, 159, 0, 232, 183, 179, 232, 183, 179, 231, 140, 170, 0, 229, 153, 151, 229, 153, 151, 231, 140, 170, 0, 230, 153, 131, 230, 153, 131, 230, 150, 145, 0, 229, 164, 167, 233, 162, 154, 232, 154, 129, 0, 232, 182, 133, 233, 159, 179, 230, 179, 162, 229, 185, 188, 232, 153, 171, 0, 230, 178, 153, 230, 188, 160, 232, 156, 187, 232, 156, 147, 0, 229, 136, 186, 231, 144, 131, 228, 187, 153, 228, 186, 186, 230, 142, 140, 0, 230, 162, 166, 230, 173, 140, 228, 187, 153, 228, 186, 186, 230, 142, 140, 0, 233, 157, 146, 231, 187, 181, 233, 184, 159, 0, 228, 184, 131, 229, 164, 149, 233, 157, 146, 233, 184, 159, 0, 231, 140, 171, 233, 188, 172, 230, 150, 169, 0, 233, 165, 173, 229, 140, 153, 232, 155, 135, 0, 230, 156, 136, 231, 159, 179, 0, 229, 164, 170, 233, 152, 179, 229, 178, 169, 0, 230, 179, 165, 230, 179, 165, 233, 179, 133, 0, 233, 178, 182, 233, 177, 188, 231, 142, 139, 0, 233, 190, 153, 232, 153, 190, 229, 176, 143, 229, 133, 181, 0, 233, 147, 129, 232, 158, 175, 233, 190, 153, 232, 153, 190, 0, 229, 164, 169, 231, 167, 164, 229, 129, 182, 0, 229, 191, 181, 229, 138, 155, 229, 156, 159, 229, 129, 182, 0, 232, 167, 166, 230, 137, 139, 231, 153, 190, 229, 144, 136, 0, 230, 145, 135, 231, 175, 174, 231, 153, 190, 229, 144, 136, 0, 229, 164, 170, 229, 143, 164, 231, 190, 189, 232, 153, 171, 0, 229, 164, 170, 229, 143, 164, 231, 155, 148, 231, 148, 178, 0, 228, 184, 145, 228, 184, 145, 233, 177, 188, 0, 231, 190, 142, 231, 186, 179, 230, 150, 175, 0, 233, 163, 152, 230, 181, 174, 230, 179, 161, 230, 179, 161, 0, 229, 143, 152, 233, 154, 144, 233, 190, 153, 0, 230, 128, 168, 229, 189, 177, 229, 168, 131, 229, 168, 131, 0, 232, 175, 133, 229, 146, 146, 229, 168, 131, 229, 168, 131, 0, 229, 164, 156, 229, 183, 161, 231, 129, 181, 0, 229, 189, 183, 229, 190, 168, 229, 164, 156, 231, 129, 181, 0, 231, 131, 173, 229, 184, 166, 233, 190, 153, 0, 233, 163, 142, 233, 147, 131, 233, 147, 131, 0, 233, 152, 191, 229, 139, 131, 230, 162, 173, 233, 178, 129, 0, 229, 176, 143, 230, 158, 156, 231, 132, 182, 0, 233, 155, 170, 231, 171, 165, 229, 173, 144, 0, 229, 134, 176, 233, 172, 188, 230, 138, 164, 0, 230, 181, 183, 232, 177, 185, 231, 144, 131, 0, 230, 181, 183, 233, 173, 148, 231, 139, 174, 0, 229, 184, 157, 231, 137, 153, 230, 181, 183, 231, 139, 174, 0, 231, 143, 141, 231, 143, 160, 232, 180, 157, 0, 231, 140, 142, 230, 150, 145, 233, 177, 188, 0, 230, 168, 177, 232, 138, 177, 233, 177, 188, 0, 229, 143, 164, 231, 169, 186, 230, 163, 152, 233, 177, 188, 0, 231, 136, 177, 229, 191, 131, 233, 177, 188, 0, 229, 174, 157, 232, 180, 157, 233, 190, 153, 0, 231, 148, 178, 229, 163, 179, 233, 190, 153, 0, 230, 154, 180, 233, 163, 158, 233, 190, 153, 0, 233, 147, 129, 229, 147, 145, 233, 147, 131, 0, 233, 135, 145, 229, 177, 158, 230, 128, 170, 0, 229, 183, 168, 233, 135, 145, 230, 128, 170, 0, 233, 155, 183, 229, 144, 137, 230, 180, 155, 229, 133, 139, 0, 233, 155, 183, 229, 144, 137, 232, 137, 190, 230, 150, 175, 0, 233, 155, 183, 229, 144, 137, 230, 150, 175, 229, 165, 135, 233, 178, 129, 0, 230, 139, 137, 229, 184, 157, 228, 186, 154, 230, 150, 175, 0, 230, 139, 137, 229, 184, 157, 230, 172, 167, 230, 150, 175, 0, 231, 155, 150, 230, 172, 167, 229, 141, 161, 0, 229, 155, 186, 230, 139, 137, 229, 164, 154, 0, 231, 131, 136, 231, 169, 186, 229, 157, 144, 0, 229, 159, 186, 230, 139, 137, 231, 165, 136, 0, 228, 187, 163, 230, 172, 167, 229, 165, 135, 229, 184, 140, 230, 150, 175, 0, 232, 141, 137, 232, 139, 151, 233, 190, 159, 0, 230, 160, 145, 230, 158, 151, 233, 190, 159, 0, 229, 156, 159, 229, 143, 176, 233, 190, 159, 0, 229, 176, 143, 231, 129, 171, 231, 132, 176, 231, 140, 180, 0, 231, 140, 155, 231, 129, 171, 231, 140, 180, 0, 231, 131, 136, 231, 132, 176, 231, 140, 180, 0, 230, 179, 162, 229, 138, 160, 230, 155, 188, 0, 230, 179, 162, 231, 154, 135, 229, 173, 144, 0, 229, 184, 157, 231, 142, 139, 230, 139, 191, 230, 179, 162, 0, 229, 167, 134, 229, 133, 139, 229, 132, 191, 0, 229, 167, 134, 229, 133, 139, 233, 184, 159, 0, 229, 167, 134, 229, 133, 139, 233, 185, 176, 0, 229, 164, 167, 231, 137, 153, 231, 139, 184, 0, 229, 164, 167, 229, 176, 190, 231, 139, 184, 0, 229, 156, 134, 230, 179, 149, 229, 184, 136, 0, 233, 159, 179, 231, 174, 177, 232, 159, 128, 0, 229, 176, 143, 231, 140, 171, 230, 128, 170, 0, 229, 139, 146, 229, 133, 139, 231, 140, 171, 0, 228, 188, 166, 231, 144, 180, 231, 140, 171, 0, 229, 144, 171, 231, 190, 158, 232, 139, 158, 0, 231, 189, 151, 228, 184, 157, 233, 155, 183, 230, 156, 181, 0, 229, 164, 180, 231, 155, 150, 233, 190, 153, 0, 230, 136, 152, 230, 167, 140, 233, 190, 153, 0, 231, 155, 190, 231, 148, 178, 233, 190, 153, 0, 230, 138, 164, 229, 159, 142, 233, 190, 153, 0, 231, 187, 147, 232, 141, 137, 229, 132, 191, 0, 231, 187, 147, 232, 141, 137, 232, 180, 181, 229, 166, 135, 0, 231, 187, 133, 229, 163, 171, 232, 155, 190, 0, 228, 184, 137, 232, 156, 156, 232, 156, 130, 0, 232, 156, 130, 229, 165, 179, 231, 142, 139, 0, 229, 184, 149, 229, 165, 135, 229, 136, 169, 229, 133, 185, 0, 230, 179, 179, 229, 156, 136, 233, 188, 172, 0, 230, 181, 174, 230, 189, 156, 233, 188, 172, 0, 230, 168, 177, 232, 138, 177, 229, 174, 157, 0, 230, 168, 177, 232, 138, 177, 229, 132, 191, 0, 230, 151, 160, 229, 163, 179, 230, 181, 183, 229, 133, 148, 0, 230, 181, 183, 229, 133, 148, 229, 133, 189, 0, 229, 143, 140, 229, 176, 190, 230, 128, 170, 230, 137, 139, 0, 233, 163, 152, 233, 163, 152, 231, 144, 131, 0, 233, 154, 143, 233, 163, 142, 231, 144, 131, 0, 229, 141, 183, 229, 141, 183, 232, 128, 179, 0, 233, 149, 191, 232, 128, 179, 229, 133, 148, 0, 230, 162, 166, 229, 166, 150, 233, 173, 148, 0, 228, 185, 140, 233, 184, 166, 229, 164, 180, 229, 164, 180, 0, 233, 173, 133, 229, 138, 155, 229, 150, 181, 0, 228, 184, 156, 230, 150, 189, 229, 150, 181, 0, 233, 147, 131, 233, 147, 155, 229, 147, 141, 0, 232, 135, 173, 233, 188, 172, 229, 153, 151, 0, 229, 157, 166, 229, 133, 139, 232, 135, 173, 233, 188, 172, 0, 233, 147, 156, 233, 149, 156, 230, 128, 170, 0, 233, 157, 146, 233, 147, 156, 233, 146, 159, 0, 231, 155, 134, 230, 137, 141, 230, 128, 170, 0, 233, 173, 148, 229, 176, 188, 229, 176, 188, 0, 229, 176, 143, 231, 166, 143, 232, 155, 139, 0, 232, 129, 146, 229, 153, 170, 233, 184, 159, 0, 232, 138, 177, 229, 178, 169, 230, 128, 170, 0, 229, 156, 134, 233, 153, 134, 233, 178, 168, 0, 229, 176, 150, 231, 137, 153, 233, 153, 134, 233, 178, 168, 0, 231, 131, 136, 229, 146, 172, 233, 153, 134, 233, 178, 168, 0, 229, 176, 143, 229, 141, 161, 230, 175, 148, 229, 133, 189, 0, 229, 136, 169, 230, 172, 167, 232, 183, 175, 0, 232, 183, 175, 229, 141, 161, 229, 136, 169, 230, 172, 167, 0, 230, 178, 153, 230, 178, 179, 233, 169, 172, 0, 230, 178, 179, 233, 169, 172, 229, 133, 189, 0, 233, 146, 179, 229, 176, 190, 232, 157, 142, 0, 233, 190, 153, 231, 142, 139, 232, 157, 142, 0, 228, 184, 141, 232, 137, 175, 232, 155, 153, 0, 230, 175, 146, 233, 170, 183, 232, 155, 153, 0, 229, 176, 150, 231, 137, 153, 231, 172, 188, 0, 232, 141, 167, 229, 133, 137, 233, 177, 188, 0, 233, 156, 147, 232, 153, 185, 233, 177, 188, 0, 229, 176, 143, 231, 144, 131, 233, 163, 158, 233, 177, 188, 0, 233, 155, 170, 231, 172, 160, 230, 128, 170, 0, 230, 154, 180, 233, 155, 170, 231, 142, 139, 0, 231, 142, 155, 231, 139, 131, 230, 139, 137, 0, 232, 135, 170, 231, 136, 134, 231, 163, 129, 230, 128, 170, 0, 229, 164, 167, 232, 136, 140, 232, 136, 148, 0, 232, 182, 133, 231, 148, 178, 231, 139, 130, 231, 138, 128, 0, 229, 183, 168, 232, 148, 147, 232, 151, 164, 0, 231, 148, 181, 229, 135, 187, 233, 173, 148, 229, 133, 189, 0, 233, 184, 173, 229, 152, 180, 231, 130, 142, 229, 133, 189, 0, 230, 179, 162, 229, 133, 139, 229, 159, 186, 230, 150, 175, 0, 232, 191, 156, 229, 143, 164, 229, 183, 168, 232, 156, 147, 0, 229, 143, 182, 228, 188, 138, 229, 184, 131, 0, 229, 134, 176, 228, 188, 138, 229, 184, 131, 0, 229, 164, 169, 232, 157, 142, 231, 142, 139, 0, 232, 177, 161, 231, 137, 153, 231, 140, 170, 0, 229, 164, 154, 232, 190, 185, 229, 133, 189, 239, 188, 186, 0, 232, 137, 190, 232, 183, 175, 233, 155, 183, 230, 156, 181, 0, 229, 164, 167, 230, 156, 157, 229, 140, 151, 233, 188, 187, 0, 233, 187, 145, 229, 164, 156, 233, 173, 148, 231, 129, 181, 0, 233, 155, 170, 229, 166, 150, 229, 165, 179, 0, 230, 180, 155, 230, 137, 152, 229, 167, 134, 0, 231, 148, 177, 229, 133, 139, 229, 184, 140, 0, 232, 137, 190, 229, 167, 134, 229, 136, 169, 229, 164, 154, 0, 228, 186, 154, 229, 133, 139, 232, 175, 186, 229, 167, 134, 0, 229, 184, 157, 231, 137, 153, 229, 141, 162, 229, 141, 161, 0, 229, 184, 149, 232, 183, 175, 229, 165, 135, 228, 186, 154, 0, 229, 184, 173, 229, 164, 154, 232, 147, 157, 230, 129, 169, 0, 233, 155, 183, 229, 144, 137, 229, 165, 135, 229, 141, 161, 230, 150, 175, 0, 233, 170, 145, 230, 139, 137, 229, 184, 157, 231, 186, 179, 0, 229, 133, 139, 233, 155, 183, 232, 137, 178, 229, 136, 169, 228, 186, 154, 0, 233, 156, 143, 230, 172, 167, 231, 186, 179, 0, 231, 142, 155, 231, 186, 179, 233, 156, 143, 0, 232, 190, 190, 229, 133, 139, 232, 142, 177, 228, 188, 138, 0, 232, 176, 162, 231, 177, 179, 0, 233, 152, 191, 229, 176, 148, 229, 174, 153, 230, 150, 175, 0, 230, 175, 148, 229, 133, 139, 230, 143, 144, 229, 176, 188, 0, 232, 151, 164, 232, 151, 164, 232, 155, 135, 0, 233, 157, 146, 232, 151, 164, 232, 155, 135, 0, 229, 144, 155, 228, 184, 187, 232, 155, 135, 0, 230, 154, 150, 230, 154, 150, 231, 140, 170, 0, 231, 130, 146, 231, 130, 146, 231, 140, 170, 0, 231, 130, 142, 230, 173, 166, 231, 142, 139, 0, 230, 176, 180, 230, 176, 180, 231, 141, 173, 0, 229, 143, 140, 229, 136, 131, 228, 184, 184, 0, 229, 164, 167, 229, 137, 145, 233, 172, 188, 0, 230, 142, 162, 230, 142, 162, 233, 188, 160, 0, 230, 173, 165, 229, 147, 168, 233, 188, 160, 0, 229, 176, 143, 231, 186, 166, 229, 133, 139, 0, 229, 147, 136, 231, 186, 166, 229, 133, 139, 0, 233, 149, 191, 230, 175, 155, 231, 139, 151, 0, 230, 137, 146, 230, 137, 139, 231, 140, 171, 0, 233, 133, 183, 232, 177, 185, 0, 232, 138, 177, 230, 164, 176, 231, 140, 180, 0, 232, 138, 177, 230, 164, 176, 231, 140, 191, 0, 231, 136, 134, 233, 166, 153, 231, 140, 180, 0, 231, 136, 134, 233, 166, 153, 231, 140, 191, 0, 229, 134, 183, 230, 176, 180, 231, 140, 180, 0, 229, 134, 183, 230, 176, 180, 231, 140, 191, 0, 233, 163, 159, 230, 162, 166, 230, 162, 166, 0, 230, 162, 166, 230, 162, 166, 232, 154, 128, 0, 232, 177, 134, 232, 177, 134, 233, 184, 189, 0, 229, 146, 149, 229, 146, 149, 233, 184, 189, 0, 233, 171, 152, 229, 130, 178, 233, 155, 137, 233, 184, 161, 0, 230, 150, 145, 230, 150, 145, 233, 169, 172, 0, 233, 155, 183, 231, 148, 181, 230, 150, 145, 233, 169, 172, 0, 231, 159, 179, 228, 184, 184, 229, 173, 144, 0, 229, 156, 176, 229, 185, 148, 229, 178, 169, 0, 229, 186, 158, 229, 178, 169, 230, 128, 170, 0, 230, 187, 154, 230, 187, 154, 232, 157, 153, 232, 157, 160, 0, 229, 191, 131, 232, 157, 153, 232, 157, 160, 0, 232, 158, 186, 233, 146, 137, 229, 156, 176, 233, 188, 160, 0, 233, 190, 153, 229, 164, 180, 229, 156, 176, 233, 188, 160, 0, 229, 183, 174, 228, 184, 141, 229, 164, 154, 229, 168, 131, 229, 168, 131, 0, 230, 144, 172, 232, 191, 144, 229, 176, 143, 229, 140, 160, 0, 233, 147, 129, 233, 170, 168, 229, 156, 159, 228, 186, 186, 0, 228, 191, 174, 229, 187, 186, 232, 128, 129, 229, 140, 160, 0, 229, 156, 134, 232, 157, 140, 232, 154, 170, 0, 232, 147, 157, 232, 159, 190, 232, 156, 141, 0, 232, 159, 190, 232, 156, 141, 231, 142, 139, 0, 230, 138, 149, 230, 145, 148, 233, 172, 188, 0, 230, 137, 147, 229, 135, 187, 233, 172, 188, 0, 232, 153, 171, 229, 174, 157, 229, 140, 133, 0, 229, 174, 157, 229, 140, 133, 232, 140, 167, 0, 228, 191, 157, 229, 167, 134, 232, 153, 171, 0, 231, 153, 190, 232, 182, 179, 232, 156, 136, 232, 154, 163, 0, 232, 189, 166, 232, 189, 174, 231, 144, 131, 0, 232, 156, 136, 232, 154, 163, 231, 142, 139, 0, 230, 156, 168, 230, 163, 137, 231, 144, 131, 0, 233, 163, 142, 229, 166, 150, 231, 178, 190, 0, 231, 153, 190, 229, 144, 136, 230, 160, 185, 229, 168, 131, 229, 168, 131, 0, 232, 163, 153, 229, 132, 191, 229, 176, 143, 229, 167, 144, 0, 233, 135, 142, 232, 155, 174, 233, 178, 136, 233, 177, 188, 0, 233, 187, 145, 231, 156, 188, 233, 179, 132, 0, 230, 183, 183, 230, 183, 183, 233, 179, 132, 0, 230, 181, 129, 230, 176, 147, 233, 179, 132, 0, 231, 129, 171, 231, 186, 162, 228, 184, 141, 229, 128, 146, 231, 191, 129, 0, 232, 190, 190, 230, 145, 169, 231, 139, 146, 231, 139, 146, 0, 230, 178, 153, 233, 147, 131, 228, 187, 153, 228, 186, 186, 230, 142, 140, 0, 231, 159, 179, 229, 177, 133, 232, 159, 185, 0, 229, 178, 169, 230, 174, 191, 229, 177, 133, 232, 159, 185, 0, 230, 187, 145, 230, 187, 145, 229, 176, 143, 229, 173, 144, 0, 229, 164, 180, 229, 183, 190, 230, 183, 183, 230, 183, 183, 0, 232, 177, 161, 229, 190, 129, 233, 184, 159, 0, 229, 147, 173, 229, 147, 173, 233, 157, 162, 229, 133, 183, 0, 230, 173, 187, 231, 165, 158, 230, 163, 186, 0, 229, 142, 159, 231, 155, 150, 230, 181, 183, 233, 190, 159, 0, 232, 130, 139, 233, 170, 168, 230, 181, 183, 233, 190, 159, 0, 229, 167, 139, 231, 165, 150, 229, 176, 143, 233, 184, 159, 0, 229, 167, 139, 231, 165, 150, 229, 164, 167, 233, 184, 159, 0, 231, 160, 180, 231, 160, 180, 232, 162, 139, 0, 231, 129, 176, 229, 176, 152, 229, 177, 177, 0, 231, 180, 162, 231, 189, 151, 228, 186, 154, 0, 231, 180, 162, 231, 189, 151, 228, 186, 154, 229, 133, 139, 0, 230, 179, 161, 230, 178, 171, 230, 160, 151, 233, 188, 160, 0, 229, 165, 135, 232, 175, 186, 230, 160, 151, 233, 188, 160, 0, 229, 147, 165, 229, 190, 183, 229, 174, 157, 229, 174, 157, 0, 229, 147, 165, 229, 190, 183, 229, 176, 143, 231, 171, 165, 0, 229, 147, 165, 229, 190, 183, 229, 176, 143, 229, 167, 144, 0, 229, 141, 149, 229, 141, 181, 231, 187, 134, 232, 131, 158, 231, 144, 131, 0, 229, 143, 140, 229, 141, 181, 231, 187, 134, 232, 131, 158, 231, 144, 131, 0, 228, 186, 186, 233, 128, 160, 231, 187, 134, 232, 131, 158, 229, 141, 181, 0, 233, 184, 173, 229, 174, 157, 229, 174, 157, 0, 232, 136, 158, 229, 164, 169, 233, 185, 133, 0, 232, 191, 183, 228, 189, 160, 229, 134, 176, 0, 229, 164, 154, 229, 164, 154, 229, 134, 176, 0, 229, 143, 140, 229, 128, 141, 229, 164, 154, 229, 164, 154, 229, 134, 176, 0, 229, 155, 155, 229, 173, 163, 233, 185, 191, 0, 232, 144, 140, 232, 138, 189, 233, 185, 191, 0, 231, 148, 181, 233, 163, 158, 233, 188, 160, 0, 231, 155, 150, 231, 155, 150, 232, 153, 171, 0, 233, 170, 145, 229, 163, 171, 232, 156, 151, 231, 137, 155, 0, 229, 147, 142, 229, 145, 128, 231, 144, 131, 232, 143, 135, 0, 232, 180, 165, 233, 156, 178, 231, 144, 131, 232, 143, 135, 0, 232, 189, 187, 233, 163, 152, 233, 163, 152, 0, 232, 131, 150, 229, 152, 159, 229, 152, 159, 0, 228, 191, 157, 229, 167, 134, 230, 155, 188, 230, 179, 162, 0, 231, 148, 181, 231, 148, 181, 232, 153, 171, 0, 231, 148, 181, 232, 156, 152, 232, 155, 155, 0, 231, 167, 141, 229, 173, 144, 233, 147, 129, 231, 144, 131, 0, 229, 157, 154, 230, 158, 156, 229, 147, 145, 233, 147, 131, 0, 233, 189, 191, 232, 189, 174, 229, 132, 191, 0, 233, 189, 191, 232, 189, 174, 231, 187, 132, 0, 233, 189, 191, 232, 189, 174, 230, 128, 170, 0, 233, 186, 187, 233, 186, 187, 229, 176, 143, 233, 177, 188, 0, 233, 186, 187, 233, 186, 187, 233, 179, 151, 0, 233, 186, 187, 233, 186, 187, 233, 179, 151, 233, 177, 188, 231, 142, 139, 0, 229, 176, 143, 231, 129, 176, 230, 128, 170, 0, 229, 164, 167, 229, 174, 135, 230, 128, 170, 0, 231, 131, 155, 229, 133, 137, 231, 129, 181, 0, 231, 129, 175, 231, 129, 171, 229, 185, 189, 231, 129, 181, 0, 230, 176, 180, 230, 153, 182, 231, 129, 175, 231, 129, 171, 231, 129, 181, 0, 231, 137, 153, 231, 137, 153, 0, 230, 150, 167, 231, 137, 153, 233, 190, 153, 0, 229, 143, 140, 230, 150, 167, 230, 136, 152, 233, 190, 153, 0, 229, 150, 183, 229, 154, 143, 231, 134, 138, 0, 229, 134, 187, 229, 142, 159, 231, 134, 138, 0, 229, 135, 160, 228, 189, 149, 233, 155, 170, 232, 138, 177, 0, 229, 176, 143, 229, 152, 180, 232, 156, 151, 0, 230, 149, 143, 230, 141, 183, 232, 153, 171, 0, 230, 179, 165, 229, 183, 180, 233, 177, 188, 0, 229, 138, 159, 229, 164, 171, 233, 188, 172, 0, 229, 184, 136, 231, 136, 182, 233, 188, 172, 0, 232, 181, 164, 233, 157, 162, 233, 190, 153, 0, 230, 179, 165, 229, 129, 182, 229, 176, 143, 228, 186, 186, 0, 230, 179, 165, 229, 129, 182, 229, 183, 168, 228, 186, 186, 0, 233, 169, 185, 229, 136, 128, 229, 176, 143, 229, 133, 181, 0, 229, 138, 136, 230, 150, 169, 229, 143, 184, 228, 187, 164, 0, 231, 136, 134, 231, 130, 184, 229, 164, 180, 230, 176, 180, 231, 137, 155, 0, 230, 175, 155, 229, 164, 180, 229, 176, 143, 233, 185, 176, 0, 229, 139, 135, 229, 163, 171, 233, 155, 132, 233, 185, 176, 0, 231, 167, 131, 233, 185, 176, 228, 184, 171, 229, 164, 180, 0, 231, 167, 131, 233, 185, 176, 229, 168, 156, 0, 231, 134, 148, 232, 154, 129, 229, 133, 189, 0, 233, 147, 129, 232, 154, 129, 0, 229, 141, 149, 233, 166, 150, 233, 190, 153, 0, 229, 143, 140, 233, 166, 150, 230, 154, 180, 233, 190, 153, 0, 228, 184, 137, 233, 166, 150, 230, 129, 182, 233, 190, 153, 0, 231, 135, 131, 231, 131, 167, 232, 153, 171, 0, 231, 129, 171, 231, 165, 158, 232, 155, 190, 0, 229, 139, 190, 229, 184, 149, 232, 183, 175, 231, 191, 129, 0, 228, 187, 163, 230, 139, 137, 229, 159, 186, 231, 191, 129, 0, 230, 175, 149, 229, 138, 155, 229, 144, 137, 231, 191, 129, 0, 233, 190, 153, 229, 141, 183, 228, 186, 145, 0, 233, 155, 183, 231, 148, 181, 228, 186, 145, 0, 232, 142, 177, 229, 184, 140, 230, 139, 137, 229, 167, 134, 0, 230, 141, 183, 229, 133, 139, 231, 189, 151, 229, 167, 134, 0, 229, 156, 159, 229, 156, 176, 228, 186, 145, 0, 233, 133, 139, 233, 155, 183, 229, 167, 134, 0, 229, 135, 175, 232, 183, 175, 232, 191, 170, 230, 172, 167, 0, 231, 190, 142, 230, 180, 155, 232, 128, 182, 229, 161, 148, 0, 231, 155, 150, 232, 175, 186, 232, 181, 155, 229, 133, 139, 231, 137, 185, 0, 229, 147, 136, 229, 138, 155, 230, 160, 151, 0, 232, 131, 150, 232, 131, 150, 229, 147, 136, 229, 138, 155, 0, 229, 184, 131, 233, 135, 140, 229, 141, 161, 233, 154, 134, 0, 231, 129, 171, 231, 139, 144, 231, 139, 184, 0, 233, 149, 191, 229, 176, 190, 231, 129, 171, 231, 139, 144, 0, 229, 166, 150, 231, 129, 171, 231, 186, 162, 231, 139, 144, 0, 229, 145, 177, 229, 145, 177, 230, 179, 161, 232, 155, 153, 0, 229, 145, 177, 229, 164, 180, 232, 155, 153, 0, 231, 148, 178, 232, 180, 186, 229, 191, 141, 232, 155, 153, 0, 230, 142, 152, 230, 142, 152, 229, 133, 148, 0, 230, 142, 152, 229, 156, 176, 229, 133, 148, 0, 229, 176, 143, 231, 174, 173, 233, 155, 128, 0, 231, 129, 171, 231, 174, 173, 233, 155, 128, 0, 231, 131, 136, 231, 174, 173, 233, 185, 176, 0, 231, 178, 137, 232, 157, 182, 232, 153, 171, 0, 231, 178, 137, 232, 157, 182, 232, 155, 185, 0, 229, 189, 169, 231, 178, 137, 232, 157, 182, 0, 229, 176, 143, 231, 139, 174, 231, 139, 174, 0, 231, 129, 171, 231, 130, 142, 231, 139, 174, 0, 232, 138, 177, 232, 147, 147, 232, 147, 147, 0, 232, 138, 177, 229, 143, 182, 232, 146, 130, 0, 232, 138, 177, 230, 180, 129, 229, 164, 171, 228, 186, 186, 0, 229, 157, 144, 233, 170, 145, 229, 176, 143, 231, 190, 138, 0, 229, 157, 144, 233, 170, 145, 229, 177, 177, 231, 190, 138, 0, 233, 161, 189, 231, 154, 174, 231, 134, 138, 231, 140, 171, 0, 230, 181, 129, 230, 176, 147, 231, 134, 138, 231, 140, 171, 0, 229, 164, 154, 228, 184, 189, 231, 177, 179, 228, 186, 154, 0, 229, 166, 153, 229, 150, 181, 0, 232, 182, 133, 232, 131, 189, 229, 166, 153, 229, 150, 181, 0, 231, 139, 172, 229, 137, 145, 233, 158, 152, 0, 229, 143, 140, 229, 137, 145, 233, 158, 152, 0, 229, 157, 154, 231, 155, 190, 229, 137, 145, 230, 128, 170, 0, 231, 178, 137, 233, 166, 153, 233, 166, 153, 0, 232, 138, 179, 233, 166, 153, 231, 178, 190, 0, 231, 187, 181, 231, 187, 181, 230, 179, 161, 232, 138, 153, 0, 232, 131, 150, 231, 148, 156, 229, 166, 174, 0, 229, 165, 189, 229, 149, 166, 233, 177, 191, 0, 228, 185, 140, 232, 180, 188, 231, 142, 139, 0, 233, 190, 159, 232, 132, 154, 232, 132, 154, 0, 233, 190, 159, 232, 182, 179, 229, 183, 168, 233, 147, 160, 0, 229, 158, 131, 229, 158, 131, 232, 151, 187, 0, 230, 175, 146, 232, 151, 187, 233, 190, 153, 0, 233, 147, 129, 232, 135, 130, 230, 158, 170, 232, 153, 190, 0, 233, 146, 162, 231, 130, 174, 232, 135, 130, 232, 153, 190, 0, 228, 188, 158, 231, 148, 181, 232, 156, 165, 0, 229, 133, 137, 231, 148, 181, 228, 188, 158, 232, 156, 165, 0, 229, 174, 157, 229, 174, 157, 230, 154, 180, 233, 190, 153, 0, 230, 128, 170, 233, 162, 154, 233, 190, 153, 0, 229, 134, 176, 233, 155, 170, 233, 190, 153, 0, 229, 134, 176, 233, 155, 170, 229, 183, 168, 233, 190, 153, 0, 228, 187, 153, 229, 173, 144, 228, 188, 138, 229, 184, 131, 0, 230, 145, 148, 232, 167, 146, 233, 185, 176, 228, 186, 186, 0, 229, 146, 154, 229, 146, 154, 233, 188, 160, 0, 229, 176, 143, 231, 162, 142, 233, 146, 187, 0, 233, 187, 143, 233, 187, 143, 229, 174, 157, 0, 233, 187, 143, 231, 190, 142, 229, 132, 191, 0, 233, 187, 143, 231, 190, 142, 233, 190, 153, 0, 233, 146, 165, 229, 156, 136, 229, 132, 191, 0, 229, 176, 143, 230, 156, 168, 231, 129, 181, 0, 230, 156, 189, 230, 156, 168, 229, 166, 150, 0, 229, 141, 151, 231, 147, 156, 231, 178, 190, 0, 229, 141, 151, 231, 147, 156, 230, 128, 170, 228, 186, 186, 0, 229, 134, 176, 229, 174, 157, 0, 229, 134, 176, 229, 178, 169, 230, 128, 170, 0, 229, 151, 161, 232, 157, 160, 0, 233, 159, 179, 230, 179, 162, 233, 190, 153, 0, 229, 147, 178, 229, 176, 148, 229, 176, 188, 228, 186, 154, 230, 150, 175, 0, 228, 188, 138, 232, 163, 180, 229, 176, 148, 229, 161, 148, 229, 176, 148, 0, 229, 159, 186, 230, 160, 188, 229, 176, 148, 229, 190, 183, 0, 232, 146, 130, 229, 174, 137, 229, 184, 140, 0, 232, 131, 161, 229, 184, 149, 0, 230, 179, 162, 229, 176, 148, 229, 135, 175, 229, 176, 188, 230, 129, 169, 0, 230, 156, 168, 230, 156, 168, 230, 158, 173, 0, 230, 138, 149, 231, 190, 189, 230, 158, 173, 0, 231, 139, 153, 229, 176, 132, 230, 160, 145, 230, 158, 173, 0, 231, 129, 171, 230, 150, 145, 229, 150, 181, 0, 231, 130, 142, 231, 131, 173, 229, 150, 181, 0, 231, 130, 189, 231, 132, 176, 229, 146, 134, 229, 147, 174, 232, 153, 142, 0, 231, 144, 131, 231, 144, 131, 230, 181, 183, 231, 139, 174, 0, 232, 138, 177, 230, 188, 190, 230, 181, 183, 231, 139, 174, 0, 232, 165, 191, 231, 139, 174, 230, 181, 183, 229, 163, 172, 0, 229, 176, 143, 231, 172, 131, 229, 132, 191, 0, 229, 150, 135, 229, 143, 173, 229, 149, 132, 233, 184, 159, 0, 233, 147, 179, 229, 152, 180, 229, 164, 167, 233, 184, 159, 0, 231, 140, 171, 233, 188, 172, 229, 176, 145, 0, 231, 140, 171, 233, 188, 172, 230, 142, 162, 233, 149, 191, 0, 229, 188, 186, 233, 162, 154, 233, 184, 161, 230, 175, 141, 232, 153, 171, 0, 232, 153, 171, 231, 148, 181, 229, 174, 157, 0, 233, 148, 185, 229, 134, 156, 231, 130, 174, 232, 153, 171, 0, 229, 165, 189, 232, 131, 156, 232, 159, 185, 0, 229, 165, 189, 232, 131, 156, 230, 175, 155, 232, 159, 185, 0, 232, 138, 177, 232, 136, 158, 233, 184, 159, 0, 232, 144, 140, 232, 153, 187, 0, 232, 157, 182, 231, 187, 147, 232, 144, 140, 232, 153, 187, 0, 229, 178, 169, 231, 139, 151, 231, 139, 151, 0, 233, 172, 131, 229, 178, 169, 231, 139, 188, 228, 186, 186, 0, 229, 188, 177, 228, 184, 129, 233, 177, 188, 0, 229, 165, 189, 229, 157, 143, 230, 152, 159, 0, 232, 182, 133, 229, 157, 143, 230, 152, 159, 0, 230, 179, 165, 233, 169, 180, 228, 187, 148, 0, 233, 135, 141, 230, 179, 165, 230, 140, 189, 233, 169, 172, 0, 230, 187, 180, 232, 155, 155, 0, 230, 187, 180, 232, 155, 155, 233, 156, 184, 0, 228, 188, 170, 232, 158, 179, 232, 141, 137, 0, 229, 133, 176, 232, 158, 179, 232, 138, 177, 0, 231, 157, 161, 231, 157, 161, 232, 143, 135, 0, 231, 129, 175, 231, 189, 169, 229, 164, 156, 232, 143, 135, 0, 229, 164, 156, 231, 155, 151, 231, 129, 171, 232, 156, 165, 0, 231, 132, 176, 229, 144, 142, 232, 156, 165, 0, 231, 171, 165, 229, 129, 182, 231, 134, 138, 0, 231, 169, 191, 231, 157, 128, 231, 134, 138, 0, 231, 148, 156, 231, 171, 185, 231, 171, 185, 0, 231, 148, 156, 232, 136, 158, 229, 166, 174, 0, 231, 148, 156, 229, 134, 183, 231, 190, 142, 229, 144, 142, 0, 232, 138, 177, 231, 150, 151, 231, 142, 175, 231, 142, 175, 0, 230, 153, 186, 230, 140, 165, 231, 140, 169, 0, 230, 138, 149, 230, 142, 183, 231, 140, 180, 0, 232, 131, 134, 229, 176, 143, 232, 153, 171, 0, 229, 133, 183, 231, 148, 178, 230, 173, 166, 232, 128, 133, 0, 230, 178, 153, 228, 184, 152, 229, 168, 131, 0, 229, 153, 172, 230, 178, 153, 229, 160, 161, 231, 136, 183, 0, 230, 139, 179, 230, 181, 183, 229, 143, 130, 0, 229, 177, 158, 230, 128, 167, 239, 188, 154, 231, 169, 186, 0, 233, 147, 182, 228, 188, 180, 230, 136, 152, 229, 133, 189, 0, 229, 176, 143, 233, 153, 168, 230, 152, 159, 0, 230, 160, 145, 230, 158, 149, 229, 176, 190, 231, 134, 138, 0, 231, 136, 134, 231, 132, 176, 233, 190, 159, 229, 133, 189, 0, 230, 137, 152, 230, 136, 136, 229, 190, 183, 231, 142, 155, 229, 176, 148, 0, 232, 176, 156, 230, 139, 159, 239, 188, 177, 0, 231, 163, 168, 231, 137, 153, 229, 189, 169, 231, 154, 174, 233, 177, 188, 0, 232, 128, 129, 231, 191, 129, 233, 190, 153, 0, 231, 160, 180, 231, 160, 180, 232, 136, 181, 232, 189, 174, 0, 229, 191, 131, 233, 179, 158, 229, 174, 157, 0, 233, 179, 158, 231, 148, 178, 233, 190, 153, 0, 230, 157, 150, 229, 176, 190, 233, 179, 158, 231, 148, 178, 233, 190, 153, 0, 229, 141, 161, 231, 146, 158, 227, 131, 187, 233, 184, 163, 233, 184, 163, 0, 229, 141, 161, 231, 146, 158, 227, 131, 187, 232, 157, 182, 232, 157, 182, 0, 229, 141, 161, 231, 146, 158, 227, 131, 187, 229, 147, 158, 229, 147, 158, 0, 229, 141, 161, 231, 146, 158, 227, 131, 187, 233, 179, 141, 233, 179, 141, 0, 231, 167, 145, 230, 150, 175, 232, 142, 171, 229, 143, 164, 0, 231, 167, 145, 230, 150, 175, 232, 142, 171, 229, 167, 134, 0, 231, 180, 162, 229, 176, 148, 232, 191, 166, 233, 155, 183, 230, 172, 167, 0, 233, 156, 178, 229, 165, 136, 233, 155, 133, 230, 139, 137, 0, 232, 153, 154, 229, 144, 190, 228, 188, 138, 229, 190, 183, 0, 231, 136, 134, 232, 130, 140, 232, 154, 138, 0, 232, 180, 185, 230, 180, 155, 231, 190, 142, 232, 158, 130, 0, 231, 148, 181, 230, 157, 159, 230, 156, 168, 0, 233, 147, 129, 231, 129, 171, 232, 190, 137, 229, 164, 156, 0, 231, 186, 184, 229, 190, 161, 229, 137, 145, 0, 230, 129, 182, 233, 163, 159, 229, 164, 167, 231, 142, 139, 0, 229, 165, 136, 229, 133, 139, 230, 180, 155, 229, 133, 185, 231, 142, 155, 0, 231, 142, 155, 230, 156, 186, 233, 155, 133, 229, 168, 156, 0, 231, 142, 155, 229, 164, 143, 229, 164, 154, 0, 230, 175, 146, 232, 180, 157, 230, 175, 148, 0, 229, 155, 155, 233, 162, 154, 233, 146, 136, 233, 190, 153, 0, 229, 158, 146, 231, 163, 138, 231, 159, 179, 0, 231, 160, 176, 229, 164, 180, 229, 176, 143, 228, 184, 145, 0, 230, 141, 183, 230, 139, 137, 229, 165, 165, 230, 139, 137, 0 };
-
+#ifndef I18N_HPP
+#define I18N_HPP
+
+#include <Core/Resources/Resource.hpp>
+
+enum class Locale : u8
+{
+    German,
+    English,
+    Spanish,
+    French,
+    Italian,
+    Japanese,
+    Korean,
+    Chinese
+};
+
+enum class Translation : u8
+{
+    Characteristic,
+    DPPt,
+    FRLG,
+    HGSS,
+    Natures,
+    Powers,
+    RSE,
+    Species
+};
+
+extern const Resource i18n[8][8];
+
+#endif // I18N_HPP
@@ -0,0 +1,91 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Resource.hpp"
+
+namespace
+{
+    size_t readLength(const u8 *&input, size_t length)
+    {
+        if (length == 15)
+        {
+            u8 value;
+            do
+            {
+                value = *input++;
+                length += value;
+            } while (value == 255);
+        }
+        return length;
+    }
+}
+
+Resource::Resource(const char *compressed, size_t compressedSize, size_t length) :
+    compressed(reinterpret_cast<const u8 *>(compressed)), compressedSize(compressedSize), length(length)
+{
+}
+
+const u8 *Resource::data() const
+{
+    std::call_once(flag, [this] { decompress(); });
+    return buffer.data();
+}
+
+size_t Resource::size() const
+{
+    return length;
+}
+
+// Each sequence is a token (literal count << 4 | match length - 4), the literals,
+// and a 16 bit backwards offset with the match. The final sequence only has literals.
+void Resource::decompress() const
+{
+    buffer.resize(length);
+
+    const u8 *input = compressed;
+    const u8 *end = compressed + compressedSize;
+    u8 *output = buffer.data();
+
+    while (input < end)
+    {
+        u8 token = *input++;
+
+        size_t literals = readLength(input, token >> 4);
+        for (size_t i = 0; i < literals; i++)
+        {
+            *output++ = *input++;
+        }
+
+        if (input >= end)
+        {
+            break;
+        }
+
+        u16 offset = static_cast<u16>(input[0] | (input[1] << 8));
+        input += 2;
+
+        // Matches can overlap the bytes they are producing, copy forward one at a time
+        size_t match = readLength(input, token & 0xf) + 4;
+        const u8 *source = output - offset;
+        for (size_t i = 0; i < match; i++)
+        {
+            *output++ = *source++;
+        }
+    }
+}
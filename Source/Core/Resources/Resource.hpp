@@ -0,0 +1,46 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef RESOURCE_HPP
+#define RESOURCE_HPP
+
+#include <Core/Util/Global.hpp>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+// Compressed blob generated by embed.py, decompressed into a cached buffer the first time it is read
+class Resource
+{
+public:
+    Resource(const char *compressed, size_t compressedSize, size_t length);
+    const u8 *data() const;
+    size_t size() const;
+
+private:
+    const u8 *compressed;
+    size_t compressedSize;
+    size_t length;
+    mutable std::vector<u8> buffer;
+    mutable std::once_flag flag;
+
+    void decompress() const;
+};
+
+#endif // RESOURCE_HPP
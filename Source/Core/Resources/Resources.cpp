@@ -0,0 +1,2691 @@
+#include "Resources.hpp"
+
+const Resource colo(
+    "\xf3\x02\x03\x01\x12\x7f\xff\x06\x00\xbe\x0c\x7f\xff\x02\x01\x00\x00\x7e\x00\x08\x00\xf1\x02\x18\x7f\xff\x04\x04\x10\x00\x7e\x0c"
+    "\x00\x7e\x0a\x00\x7e\x04\x00\xbe\x29\x00\x40\x0c\x00\x7e\x06\x19\x00\xf0\x16\x0b\x7f\xff\x03\x7f\xff\x02\x00\xff\x0d\x00\x7e\x04"
+    "\x04\x16\x00\x1e\x18\x7f\xff\x08\x7f\xff\x17\x7f\xff\x03\x01\x15\x00\x7e\x10\x1f\xff\x14\x00\x3f",
+    88, 91);
+
+const Resource emerald(
+    "\x5f\x00\x00\x00\x01\x00\x01\x00\x24\xf0\x01\x05\x23\x00\x48\x0a\x1e\x01\x16\x0f\x19\x01\x16\x19\x1e\x01\x17\x04\x00\x60\x05\x0a"
+    "\x00\x81\x05\x0a\x18\x00\x41\x00\x81\x0a\x1e\x20\x00\xff\x07\x40\x19\x1e\x01\x40\x1e\x23\x01\x40\x14\x19\x01\x40\x23\x28\x01\x40"
+    "\x28\x2d\x01\x40\x01\x78\x00\x50\x40\x1e\x23\x01\x3f\x78\x00\x00\x80\x00\x04\x78\x00\x1f\x02\x78\x00\x28\xe5\x14\x1e\x00\xb7\x0a"
+    "\x14\x00\xb7\x1e\x23\x00\xb7\x05\x0a\x04\x00\x00\x78\x00\x13\x76\x78\x00\xff\x0b\x76\x0a\x1e\x01\x55\x19\x1e\x01\x55\x1e\x23\x01"
+    "\x55\x14\x19\x01\x55\x23\x28\x01\x55\x28\x2d\x01\x55\x03\x68\x01\x64\x1f\x04\x78\x00\x58\x44\x19\x1e\x00\x78\x78\x00\x1f\x05\xe0"
+    "\x01\x64\x1f\x06\x78\x00\x2b\x00\x5c\x00\x72\x81\x0f\x19\x00\x81\x19\x1e\x04\x00\x0b\x78\x00\x01\x04\x00\x22\x1e\x23\x04\x00\xdf"
+    "\x23\x28\x00\x82\x23\x2d\x00\x82\x05\x2d\x00\x82\x07\xf0\x00\x4a\x23\x01\x72\xf0\x00\x10\x72\xf0\x00\x44\x1e\x23\x00\xde\xf0\x00"
+    "\xe0\x08\x01\x00\x00\x02\x01\x09\x02\x01\x05\x02\x01\x09\x03\x03\x00\x11\x05\x03\x00\x00\x09\x00\x71\x02\x01\x07\x02\x01\x07\x03"
+    "\x03\x00\x0f\x87\x00\x10\x0f\x01\x00\x1a\x42\x09\x01\x00\x01\x69\x00\x40\x04\x01\x05\x04\x6f\x00\x42\x0e\x04\x01\x0e\x6c\x00\x10"
+    "\x04\x03\x00\x20\x18\x04\x0c\x00\x1f\x11\x3c\x00\x01\x0c\x48\x03\x4f\x14\x1e\x00\x76\x48\x03\x15\x53\x0a\x01\x00\x01\x02\xe4\x00"
+    "\x20\x05\x04\xe4\x00\x15\x16\x75\x00\x10\x03\x0c\x00\x7f\x16\x02\x01\x16\x04\x01\x16\x78\x00\x01\x0f\x58\x02\x29\x42\x0b\x01\x00"
+    "\x01\xea\x00\xa0\x05\x01\x05\x05\x00\xb7\x04\x00\xb7\x05\x0f\x00\x51\x14\x05\x01\x14\x04\x72\x00\x4f\x03\x01\x16\x05\x78\x00\x03"
+    "\x04\x74\x00\x0f\x78\x00\x00\x05\x54\x02\x00\x04\x00\x00\x70\x02\x00\x58\x02\x21\x14\x19\x5c\x02\x6f\x81\x28\x2d\x00\x81\x0c\x38"
+    "\x04\x64\x1f\x0d\x78\x00\x64\x1f\x0e\x78\x00\x64\x1f\x0f\x78\x00\x64\x1f\x10\x78\x00\x64\xf0\x07\x11\x01\x00\x01\x0c\x01\x05\x0c"
+    "\x01\x35\x0c\x01\x3c\x0d\x01\x35\x0d\x01\x38\x0d\x00\x2b\x06\x00\x51\x01\x3c\x0c\x01\x16\x03\x00\x4f\x37\x0d\x01\x37\x78\x00\x3d"
+    "\xf1\x14\x12\x01\x01\x01\x14\x00\x1b\x14\x01\x48\x15\x00\x1b\x15\x01\x48\x13\x01\x57\x15\x01\x57\x13\x00\x1b\x13\x01\x48\x14\x01"
+    "\x57\x14\x01\x4b\x16\x03\x00\xa6\x0a\x0f\x00\x4a\x05\x0a\x00\x4a\x0f\x14\x04\x00\x0f\x38\x04\x14\xf0\x0d\x53\x19\x1e\x01\x53\x1e"
+    "\x23\x01\x53\x14\x19\x01\x53\x23\x28\x01\x53\x28\x2d\x01\x53\x13\x01\x00\x00\x0f\x01\x42\x03\x00\x50\x00\xb7\x0e\x01\x42\x03\x00"
+    "\x62\x00\xb7\x10\x01\x42\x10\x06\x00\x04\x03\x00\x0f\xf0\x00\x01\x0f\x01\x00\x29\x11\x14\x78\x00\x10\x47\x03\x00\x50\x00\xda\x0e"
+    "\x01\x47\x03\x00\x63\x00\xda\x10\x01\x47\x10\x06\x00\x12\xe3\x06\x00\x0f\x4b\x00\x10\x0f\x01\x00\x1a\xe0\x15\x01\x01\x01\x10\x01"
+    "\x4d\x10\x01\x0e\x11\x01\x4d\x0f\x03\x00\xf1\x01\x0e\x10\x01\x0f\x10\x01\x0f\x12\x01\x0f\x11\x01\x50\x0f\x01\x50\x06\x00\x1f\x12"
+    "\x68\x01\x3d\xe0\x16\x01\x00\x01\x17\x01\x4d\x17\x01\x14\x19\x01\x4d\x18\x06\x00\xff\x05\x14\x19\x01\x15\x18\x00\x27\x19\x00\x27"
+    "\x18\x01\x16\x18\x01\x16\x1a\x01\x16\x19\xa0\x05\x2b\x0f\x58\x02\x01\xf0\x0b\x17\x01\x00\x00\x06\x01\x05\x06\x01\x25\x06\x01\x22"
+    "\x07\x00\x3f\x07\x01\x22\x06\x01\x14\x07\x01\x14\x08\x06\x00\xaf\x05\x08\x01\x05\x07\x01\x2c\x08\x01\x2c\x78\x00\x01\x0f\x01\x00"
+    "\x29\xf1\x04\x18\x01\x00\x01\x0d\x01\x05\x0d\x00\x2b\x0e\x01\x05\x0e\x00\x2b\x0d\x00\xb7\x48\x03\x51\x3a\x0d\x01\x3a\x0e\x03\x00"
+    "\x4f\x0d\x01\x39\x0d\x08\x07\x3f\xe0\x19\x01\x00\x01\x18\x01\x07\x18\x01\x35\x1a\x01\x07\x1a\x06\x00\x40\x08\x1a\x01\x36\x39\x01"
+    "\x01\x62\x01\x40\x1a\x01\x16\x1b\x0c\x00\x1f\x60\x78\x00\x01\x0f\x68\x01\x14\x13\x3e\x08\x07\xff\x23\x3e\x14\x19\x01\x3e\x23\x28"
+    "\x01\x3e\x28\x2d\x01\x3e\x1a\x01\x00\x01\x19\x01\x07\x19\x01\x08\x1b\x01\x07\x19\x00\x2b\x1b\x01\x08\x1a\x00\x2b\x1b\x00\x2b\x18"
+    "\x00\x2b\x19\x01\x65\x1a\x01\x65\x1b\x01\x65\x78\x00\x2c\x12\x19\x7c\x00\x09\x78\x00\x11\x1b\x78\x00\xd2\x05\x19\x01\x06\x1b\x01"
+    "\x06\x19\x00\x2b\x19\x00\xb7\x78\x00\xdf\x1b\x00\xb7\x19\x01\x67\x1b\x01\x67\x19\x01\x60\x19\x68\x01\x2a\x0f\xd0\x02\x02\xf0\x08"
+    "\x1c\x01\x00\x01\x1a\x01\x05\x1a\x01\x61\x1a\x01\x06\x1c\x01\x61\x1c\x01\x06\x1a\x00\x2b\x1c\x03\x00\x12\x2c\x65\x01\x1f\x1c\x68"
+    "\x01\x2d\x0f\xd0\x02\x02\x1f\x1d\x40\x0b\x64\x1f\x1e\xf0\x00\x64\x1f\x1f\xf0\x00\x64\x1f\x20\x78\x00\x64\x1f\x21\x78\x00\x64\x1f"
+    "\x22\x78\x00\x64\x1f\x23\x20\x0d\x64\x1f\x24\x78\x00\x3b\x1f\x41\xf0\x00\x15\xf4\x11\x25\x01\x00\x01\x1e\x01\x68\x23\x01\x68\x19"
+    "\x01\x68\x28\x01\x68\x14\x01\x68\x2d\x01\x68\x0f\x01\x68\x32\x01\x68\x0a\x01\x68\x05\x06\x00\x0f\x78\x00\x14\x0f\x68\x01\x16\x1f"
+    "\x26\xe0\x01\x64\x1f\x27\x78\x00\x5a\x24\x00\x74\x78\x00\x1f\x28\x78\x00\x64\x1f\x29\x78\x00\x64\x1f\x2a\xc0\x12\x2a\xe0\x01\x6e"
+    "\x14\x1e\x00\xaa\x1e\x23\x01\x6e\x1e\x23\x01\x71\x04\x00\x0f\x37\x00\x10\x01\x01\x00\x1f\x2b\x78\x00\x64\xf0\x02\x2c\x01\x00\x00"
+    "\x07\x00\x29\x08\x01\x28\x07\x01\x28\x08\x00\x29\x09\x06\x00\xff\x04\x3f\x0a\x01\x28\x06\x01\x28\x07\x00\x4a\x08\x00\x4a\x06\x00"
+    "\x4a\x09\x00\x4a\x4b\x00\x10\x0f\x01\x00\x1a\x1f\x2d\x78\x00\x09\x52\x01\x30\x08\x01\x30\x06\x00\x0f\x4b\x00\x10\x0f\x01\x00\x1a"
+    "\xf1\x05\x2e\x01\x00\x00\x09\x00\x29\x0a\x01\x30\x09\x01\x30\x0b\x01\x30\x0a\x00\x29\x09\x78\x00\xff\x00\x0b\x01\x28\x0a\x01\x2e"
+    "\x0a\x01\x2e\x09\x01\x2e\x0b\x01\x2e\x4b\x00\x10\x0f\x01\x00\x1a\x70\x2f\x01\x01\x00\x0a\x00\x29\x72\x00\x60\x01\x30\x0b\x00\x29"
+    "\x0c\x7b\x00\x21\x3f\x0a\x6c\x00\x11\x0c\x78\x00\x02\x06\x00\x00\x30\x0c\x48\x0a\x14\x01\x2b\x34\x0c\x0f\x5f\x00\x10\x0f\x01\x00"
+    "\x06\x40\x30\x02\x00\x00\x47\x0a\x00\xd2\x09\xff\x0d\xcb\x1b\x00\xcb\x19\x00\xb1\x19\x00\x54\x19\x00\x2c\x1b\x00\xca\x19\x00\x19"
+    "\x1b\x00\xca\x1b\x00\x19\x1d\x00\xca\x4b\x00\x10\x0f\x01\x00\x1a\x4b\x31\x02\x00\x01\x78\x00\x1f\x1b\x78\x00\x15\x40\x14\x1e\x00"
+    "\x36\x04\x00\x26\x1e\x23\x04\x00\x09\x50\x0a\x11\x19\x08\x00\x71\x76\x19\x1e\x00\x76\x1e\x23\x04\x00\xf0\x08\x77\x23\x28\x00\x77"
+    "\x19\x1e\x00\x77\x32\x02\x00\x01\x1b\x00\x6f\x1b\x00\x2b\x1d\x00\x6f\x1d\x81\x00\x80\x54\x1d\x00\x2c\x1f\x00\x2c\x1d\x09\x00\xaf"
+    "\x55\x1b\x00\x7f\x1f\x00\x55\x1d\x00\x7f\x78\x00\x10\x5f\x37\x19\x28\x00\x37\x78\x00\x15\x71\x33\x02\x01\x00\x1b\x00\xe7\x78\x00"
+    "\x11\xe7\x78\x00\x14\xb1\x78\x00\xd8\xb1\x1d\x00\xb2\x1b\x00\xd6\x1f\x00\xb2\x1d\x00\xd6\x10\x0e\x6f\x14\x19\x00\x4a\x19\x1e\xe0"
+    "\x01\x2b\xff\x19\x34\x02\x00\x01\x21\x00\xbf\x22\x00\xb3\x23\x00\xbf\x24\x00\xb3\x22\x00\xbe\x21\x00\xa7\x23\x00\xa3\x22\x00\xd1"
+    "\x24\x00\xea\x25\x00\xcf\x27\x00\xea\x28\x00\xcf\x3c\x00\x01\x80\x19\x1e\x00\xc2\x19\x1e\x00\xb7\x04\x00\x00\xbc\x0b\x43\x23\x28"
+    "\x00\xc3\x98\x15\x00\xe4\x00\x01\x08\x00\x43\x1e\x23\x00\xdf\x10\x00\x10\xdf\x0c\x00\x00\x04\x00\xf1\x0b\x23\x28\x00\xe0\x35\x02"
+    "\x01\x00\x21\x00\xbe\x22\x00\xd8\x23\x00\xbe\x24\x00\xd8\x22\x00\xbf\x21\x00\xa5\x78\x00\xf2\x08\xcc\x24\x00\xe4\x25\x00\xf1\x27"
+    "\x00\xe4\x28\x00\xf1\x19\x1e\x00\xd5\x14\x19\x00\xd5\x1e\x23\x04\x00\x4f\x23\x28\x00\xd5\x8c\x00\x01\x0f\x01\x00\x15\x40\x36\x01"
+    "\x00\x00\x22\x14\x00\x28\x14\x20\x1d\x06\x09\x00\xb0\x0a\x05\x01\x0c\x06\x01\x09\x06\x01\x1d\x05\x2e\x14\x7f\x1f\x06\x01\x14\x06"
+    "\x01\x1f\x4b\x00\x10\x0f\x01\x00\x1a\x11\x37\x00\x0f\x20\x25\x07\x00\x0f\x00\x03\x00\x11\x07\x03\x00\x4a\x05\x01\x25\x08\x06\x00"
+    "\x0f\x4b\x00\x10\x0f\x01\x00\x1a\x1f\x38\x08\x07\x2c\x08\x04\x00\x4e\x1e\x23\x00\x49\x08\x07\x41\x00\x48\x19\x1e\x1c\x00\x01\x20"
+    "\x00\xf4\x19\x19\x1e\x00\x49\x14\x19\x00\x49\x39\x01\x00\x00\x18\x00\x64\x18\x00\x51\x19\x00\x64\x19\x00\x51\x17\x00\x64\x17\x00"
+    "\x51\x1a\x00\x64\x1a\x00\x51\x16\x00\x64\x16\x06\x00\x0f\x87\x00\x10\x0f\x01\x00\x1a\x1f\x3a\x78\x00\x0e\x6f\x1a\x00\x65\x1a\x00"
+    "\x52\x4b\x00\x10\x0f\x01\x00\x1a\xf2\x13\x3b\x01\x00\x01\x10\x00\x29\x11\x00\x29\x12\x00\x29\x0f\x00\x29\x0e\x00\x29\x10\x01\x52"
+    "\x12\x01\x52\x0e\x01\x52\x13\x00\x29\x14\x00\x29\x06\x00\x0f\x3c\x00\x01\xff\x05\x05\x23\x00\x29\x1e\x23\x00\x29\x19\x23\x01\x52"
+    "\x0f\x19\x01\x52\x05\x0f\x01\x52\x00\x0f\x15\x20\x3c\x01\xc0\x03\x40\x2a\x23\x00\x2a\x06\x00\xf2\x05\x01\x52\x21\x01\x52\x25\x01"
+    "\x52\x23\x00\x2a\x27\x01\x52\x26\x00\x2a\x28\x00\x2a\x06\x00\x0f\x78\x00\x01\x40\x1e\x23\x00\x2a\x04\x00\x0f\x78\x00\x15\xdf\x1e"
+    "\x23\x01\x54\x23\x28\x01\x54\x28\x2d\x01\x54\x3d\x78\x00\x64\x15\x3e\x78\x00\xff\x00\x1e\x01\x73\x23\x01\x52\x23\x01\x73\x25\x01"
+    "\x52\x19\x01\x73\x78\x00\x4c\x4f\x3f\x01\x00\x00\xf0\x00\x25\x0f\x01\x00\x29\x00\x89\x1d\x10\x1b\xe7\x0f\xf4\x02\x61\x1a\x01\x61"
+    "\x19\x01\x61\x1d\x01\x61\x18\x01\x61\x17\x01\x61\x16\x0c\x00\x02\x06\x00\x0f\x4b\x00\x10\x0f\x01\x00\x1a\x1f\x41\x78\x00\x08\xcf"
+    "\x1b\x01\x63\x1b\x01\x63\x19\x01\x63\x1d\x01\x63\x4b\x00\x10\x0f\x01\x00\x1a\x12\x42\x78\x00\x02\x7b\x00\xf1\x01\x1d\x01\x61\x1d"
+    "\x00\x25\x1b\x00\x25\x1d\x00\x25\x19\x00\x25\x1b\xe0\x10\x11\x1a\xe3\x10\x0f\x4b\x00\x10\x0f\x01\x00\x1a\x42\x43\x01\x00\x00\x72"
+    "\x00\x11\x1b\xf3\x00\x11\x1e\xf6\x00\x10\x18\x87\x00\xdf\x63\x1a\x01\x63\x1e\x01\x63\x1c\x01\x66\x1c\x01\x66\x4b\x00\x10\x0f\x01"
+    "\x00\x1a\x10\x44\xd0\x11\xf0\x06\x00\x29\x1a\x01\x6b\x1c\x00\x29\x1c\x01\x6b\x1e\x00\x29\x1e\x01\x6b\x20\x00\x29\x20\x06\x00\x15"
+    "\x2a\x06\x00\x0f\x3c\x00\x01\x03\x98\x05\x51\x29\x19\x1e\x01\x6b\x04\x00\x3f\x23\x01\x6b\xd0\x11\x15\x4e\x45\x01\x00\x00\x78\x00"
+    "\x40\x1a\x01\x69\x20\x0c\x00\x50\x2a\x1c\x01\x69\x20\x63\x03\x1f\x69\x78\x00\x01\x0f\x01\x00\x29\x10\x46\x78\x0f\xf0\x06\x00\x29"
+    "\x1f\x00\x29\x20\x00\x29\x21\x00\x29\x1c\x00\x29\x1d\x00\x29\x22\x00\x29\x23\x06\x00\x03\x60\x03\x1f\x24\x48\x03\x03\x04\xf0\x00"
+    "\x00\x2c\x05\x04\xcc\x03\x0f\xf0\x00\x15\xf2\x13\x47\x01\x00\x00\x28\x00\x2a\x28\x01\x29\x28\x01\x31\x28\x01\x26\x24\x00\x29\x24"
+    "\x01\x28\x26\x00\x2a\x26\x01\x29\x24\x01\x30\x24\x01\x25\x06\x00\x0f\x78\x00\x01\x0f\x01\x00\x29\x38\x48\x01\x01\x78\x00\x12\x31"
+    "\x72\x00\xc2\x2a\x00\x2a\x2a\x01\x29\x2a\x01\x31\x26\x01\x2f\x06\x00\xc4\x1e\x28\x00\x4b\x1e\x28\x00\x4a\x23\x28\x00\x4b\x04\x00"
+    "\x0f\x5f\x00\x10\x0f\x01\x00\x06\x41\x49\x01\x00\x01\x78\x00\x12\x2e\x78\x00\x01\x72\x00\xff\x04\x2e\x2c\x00\x2a\x2c\x01\x2e\x2a"
+    "\x01\x31\x2a\x01\x2f\x2c\x01\x31\x2c\x01\x2f\x3c\x00\x01\x01\x24\x05\x56\x1e\x00\x2a\x23\x28\x04\x00\x0f\x28\x05\x15\x4f\x4a\x01"
+    "\x00\x00\xe0\x01\x25\x0f\x01\x00\x29\x18\x4b\x78\x00\xa1\x1e\x01\x2e\x20\x01\x2e\x22\x01\x2e\x21\x7b\x00\x0f\x78\x00\x49\x13\x4c"
+    "\xb8\x1a\x30\x00\x6d\x10\x06\x00\xff\x0a\x42\x0f\x01\x44\x0f\x00\xda\x10\x00\x6d\x10\x00\x42\x0e\x01\x44\x10\x01\x44\x0e\x00\x58"
+    "\x0e\x00\x58\x4b\x00\x10\x0f\x01\x00\x1a\x20\x4d\x01\x44\x1a\x10\x42\x03\x00\xf2\x08\x00\x42\x14\x01\x42\x14\x01\x45\x14\x00\x42"
+    "\x15\x01\x45\x16\x00\x42\x16\x01\x42\x16\x01\x45\x06\x00\x0f\x4b\x00\x10\x0f\x01\x00\x1a\x10\x4e\x08\x07\x22\x01\x2e\x53\x01\xc1"
+    "\x22\x01\x2e\x24\x01\x58\x25\x01\x62\x26\x01\x62\x09\x00\x24\x58\x26\x06\x00\x0f\x4b\x00\x10\x0f\x01\x00\x1a\x1f\x4f\x78\x00\x64"
+    "\x1f\x50\x78\x00\x0d\x21\x4e\x27\x03\x00\x0f\x4b\x00\x10\x0f\x01\x00\x1a\x10\x51\x08\x07\xf3\x00\x00\x4a\x1c\x01\x44\x1c\x00\x4a"
+    "\x1e\x01\x44\x1d\x00\x4a\x1e\x03\x00\xbf\x4b\x1e\x00\x4b\x1f\x00\x4b\x20\x00\x4b\x21\x24\x04\x2b\x0f\x01\x00\x01\x10\x52\x58\x02"
+    "\x01\xfa\x1d\x02\x06\x1e\x02\x06\x00\xff\x03\x16\x00\x1b\x16\x01\x48\x17\x00\x1b\x17\x01\x48\x18\x00\x1b\x18\x01\x48\x4b\x00\x10"
+    "\x0f\x01\x00\x1a\x11\x53\xa0\x05\xf1\x0e\xeb\x29\x00\xeb\x2a\x00\xeb\x2b\x00\xeb\x2c\x00\xeb\x2d\x00\xeb\x2e\x00\xeb\x2f\x00\xeb"
+    "\x30\x00\xeb\x31\x00\xeb\x32\x03\x00\x0f\x4b\x00\x10\x0f\x01\x00\x1a\xff\x19\x54\x01\x00\x00\x26\x00\x84\x23\x01\x25\x28\x00\x84"
+    "\x28\x01\x26\x29\x00\x84\x24\x01\x25\x26\x01\x26\x2a\x00\x84\x26\x01\x25\x2b\x00\x84\x2c\x01\x26\x2d\x00\x84\x4b\x00\x10\x0f\x01"
+    "\x00\x1a\x30\x55\x01\x00\xd0\x11\x41\x0c\x00\x29\x08\x2d\x0c\x02\x0c\x00\x44\x10\x00\x29\x06\x12\x00\x02\x06\x00\x0f\x4b\x00\x10"
+    "\x0f\x01\x00\x1a\x00",
+    2821, 10320);
+
+const Resource firered(
+    "\x5f\x00\x00\x00\x01\x00\x01\x00\x24\xf1\x09\x05\x0a\x00\x48\x0a\x14\x00\x48\x14\x1e\x00\x48\x1e\x23\x00\x48\x23\x28\x00\x48\x05"
+    "\x0a\x00\x81\x04\x00\x51\x0f\x00\x74\x05\x0f\x08\x00\xff\x07\x62\x0f\x19\x00\x74\x0f\x19\x00\x5a\x0f\x19\x00\x82\x19\x23\x00\x75"
+    "\x19\x23\x00\x36\x01\x78\x00\x28\x40\x14\x19\x00\x36\x04\x00\xf1\x01\x19\x1e\x00\x36\x1e\x23\x00\x36\x23\x28\x00\x36\x05\x05\x00"
+    "\x81\x04\x00\x33\x0f\x00\x3c\x78\x00\x90\x76\x0f\x19\x00\x3c\x14\x1e\x00\x3d\x78\x00\x10\x0f\x30\x00\x4f\x23\x00\x36\x02\xf0\x00"
+    "\x3d\x06\x78\x00\x0c\xf0\x00\x00\x04\x00\x00\xf0\x00\x10\x74\x78\x00\x1f\x03\x78\x00\x57\x04\x68\x01\x01\x78\x00\x1f\x04\x78\x00"
+    "\x2b\x60\x36\x0a\x14\x00\x36\x14\x68\x01\x11\x28\x04\x00\x17\x6d\x78\x00\x05\x04\x00\x26\x0f\x19\x04\x00\x9f\x19\x23\x00\x81\x1e"
+    "\x28\x00\x58\x05\xe0\x01\x47\x13\x76\x78\x00\x98\x3c\x0f\x19\x00\x76\x14\x1e\x00\x77\xe0\x01\x1f\x06\x68\x01\x5f\x01\xd0\x02\xa2"
+    "\x07\x01\x00\x00\x03\x00\x10\x03\x00\x13\x06\x00\x44\x02\x00\x10\x02\x0c\x00\x71\x04\x00\x10\x04\x00\x13\x05\x06\x00\x0f\x87\x00"
+    "\x10\x0f\x01\x00\x1a\x11\x08\x78\x00\x00\x69\x00\x11\x04\x69\x00\x11\x02\x7b\x00\x13\x05\x6f\x00\xaf\x0a\x04\x00\x0d\x05\x00\x0a"
+    "\x05\x00\x0d\x4b\x00\x10\x0f\x01\x00\x1a\xff\x19\x09\x01\x00\x00\x06\x00\x15\x06\x00\x10\x07\x00\x15\x07\x00\x38\x06\x00\x20\x07"
+    "\x00\x10\x08\x00\x15\x03\x00\x27\x07\x00\x20\x05\x00\x27\x06\x00\x1d\x07\x00\x27\x4b\x00\x10\x0f\x01\x00\x1a\xff\x19\x0a\x01\x00"
+    "\x01\x0a\x00\x15\x0a\x00\x13\x06\x00\x17\x0a\x00\x17\x08\x00\x15\x08\x00\x13\x0c\x00\x15\x0c\x00\x13\x0a\x00\x38\x08\x00\x17\x0c"
+    "\x00\x38\x0c\x00\x17\x3c\x00\x01\x0f\xc0\x03\x29\xf0\x11\x0b\x01\x00\x00\x0a\x00\x34\x0d\x00\x10\x0d\x00\x2b\x0c\x00\x34\x0f\x00"
+    "\x2b\x0f\x00\x10\x10\x00\x2b\x10\x00\x10\x0f\x00\x10\x0e\x12\x00\x4f\x10\x10\x00\x34\x78\x00\x01\x0f\x01\x00\x29\x11\x0c\xf0\x00"
+    "\x0f\x78\x00\x23\x0f\x28\x05\x29\xf0\x05\x0d\x01\x00\x00\x13\x00\x10\x11\x00\x34\x13\x00\x2b\x12\x00\x34\x16\x00\x10\x16\x09\x00"
+    "\x41\x3a\x14\x00\x3a\x15\x00\x5f\x34\x11\x00\x34\x14\xf0\x00\x3f\xb0\x0e\x01\x00\x00\x12\x00\x10\x12\x00\x34\x10\x6c\x00\x20\x10"
+    "\x14\x69\x00\x50\x17\x11\x00\x3a\x13\x06\x00\x20\x17\x0f\x7e\x00\x4f\x17\x12\x00\x3a\x4b\x00\x10\x0f\x01\x00\x1a\xb0\x0f\x01\x00"
+    "\x00\x10\x00\x15\x10\x00\x13\x0b\x66\x00\xf1\x04\x17\x0d\x00\x15\x0e\x00\x13\x11\x00\x15\x11\x00\x13\x0e\x00\x13\x0d\x00\x17\x0f"
+    "\x00\x0f\x58\x02\x02\x0f\x01\x00\x29\x41\x10\x01\x00\x01\x78\x00\x17\x64\x78\x00\x11\x64\x78\x00\x41\x64\x0e\x00\x64\x78\x00\x1f"
+    "\x64\x78\x00\x04\x0f\xd0\x02\x29\x50\x11\x01\x00\x01\x0e\x72\x00\x21\x15\x0c\x75\x00\x70\x0b\x00\x60\x0d\x00\x60\x0f\x65\x01\x00"
+    "\x12\x00\x32\x0f\x00\x60\x06\x00\x0f\x78\x00\x3d\xff\x19\x12\x01\x00\x01\x18\x00\x2b\x18\x00\x30\x16\x00\x2b\x17\x00\x10\x19\x00"
+    "\x10\x1a\x00\x30\x1a\x00\x2b\x1b\x00\x10\x17\x00\x10\x1c\x00\x2c\x17\x00\x10\x1e\x00\x2c\x78\x00\x3d\x18\x13\x78\x00\x17\x1b\x78"
+    "\x00\xcf\x19\x00\x84\x1d\x00\x11\x1c\x00\x2c\x1d\x00\x11\x78\x00\x40\x47\x14\x01\x00\x00\xf0\x00\x24\x84\x1b\x78\x00\x10\x1e\xea"
+    "\x00\x00\x7b\x00\x02\x06\x00\x0f\x78\x00\x01\x0f\x01\x00\x29\x18\x15\x78\x00\x0f\xf0\x00\x1c\x0f\x01\x00\x29\xf0\x08\x16\x01\x00"
+    "\x00\x14\x00\x15\x12\x00\x54\x12\x00\x13\x14\x00\x13\x16\x00\x15\x14\x00\x54\x16\x09\x00\x00\x12\x00\x9f\x17\x00\x14\x12\x00\x13"
+    "\x19\x00\x14\x4b\x00\x10\x0f\x01\x00\x1a\x12\x17\x78\x00\x10\x18\x6c\x00\xf0\x02\x15\x1a\x00\x54\x19\x00\x14\x1b\x00\x14\x1c\x00"
+    "\x54\x1d\x00\x14\x16\x72\x00\x7f\x16\x16\x00\x13\x1b\x00\x16\x4b\x00\x10\x0f\x01\x00\x1a\x1e\x18\x78\x00\x35\x19\x00\x16\x78\x00"
+    "\x11\x1b\x78\x00\x1f\x1d\x78\x00\x3f\x1f\x19\xc8\x0a\x5f\x01\xe8\x08\x1f\x1a\x78\x00\x64\xff\x19\x1b\x01\x00\x01\x16\x00\x72\x17"
+    "\x00\x72\x18\x00\x72\x15\x00\x72\x19\x00\x72\x14\x00\x72\x13\x00\x72\x1a\x00\x72\x12\x00\x72\x1b\x00\x72\x11\x00\x72\x1c\x00\x72"
+    "\x78\x00\x3d\x41\x1c\x01\x00\x01\x60\x09\x11\x38\x60\x09\x11\x38\x60\x09\x50\x38\x03\x00\x15\x05\x03\x00\x42\x13\x05\x00\x38\x06"
+    "\x00\x0f\x78\x00\x01\x0f\x80\x07\x29\xff\x17\x1d\x01\x00\x01\x20\x00\x38\x28\x00\x16\x22\x00\x38\x22\x00\x15\x20\x00\x17\x22\x00"
+    "\x17\x2a\x00\x39\x2c\x00\x18\x20\x00\x15\x2a\x00\x16\x20\x00\x15\x2c\x58\x02\x03\x0f\x78\x00\x29\xf0\x08\x1e\x01\x00\x01\x07\x00"
+    "\x0d\x07\x00\x0a\x0b\x00\x10\x0c\x00\x2b\x0d\x00\x2b\x0a\x00\x3f\x0d\x6a\x08\xdf\x2b\x08\x00\x0e\x08\x00\x3f\x08\x00\x0b\x0c\x00"
+    "\x3f\x78\x00\x01\x0f\x28\x05\x29\xa2\x1f\x01\x00\x01\x08\x00\x0d\x08\x00\x0a\x6c\x00\x62\x0d\x00\x2b\x0b\x00\x3f\x84\x00\xaf\x09"
+    "\x00\x0e\x09\x00\x3f\x09\x00\x0b\x0d\x78\x00\x03\x0f\xf0\x00\x29\x48\x20\x01\x00\x00\x28\x0b\x40\x03\x00\x0a\x03\x0c\x00\xe0\x0b"
+    "\x05\x00\x0e\x04\x00\x0e\x03\x00\x19\x06\x00\x0e\x05\x6f\x03\x0f\x01\x00\x3b\xf0\x02\x21\x01\x00\x00\x07\x00\x29\x08\x00\x29\x07"
+    "\x00\x4a\x09\x00\x29\x0a\x0c\x00\x80\x4a\x09\x00\x4a\x08\x00\x2e\x07\x15\x00\x00\x03\x00\x3f\x08\x00\x23\x4b\x00\x10\x0f\x01\x00"
+    "\x1a\x11\x22\x78\x00\xe0\x2e\x08\x00\x2e\x05\x00\x2e\x06\x00\x2e\x09\x00\x2e\x0a\x72\x00\x0c\x12\x00\x0f\x4b\x00\x10\x0f\x01\x00"
+    "\x1a\x84\x23\x01\x00\x00\x08\x00\x29\x09\xed\x00\x70\x0a\x00\x4a\x0a\x00\x2e\x0c\x6c\x00\x42\x23\x0b\x00\x29\x03\x00\x1f\x0c\xf0"
+    "\x00\x3f\x1f\x24\x78\x0f\x64\x11\x25\xc8\x0a\xf1\x05\x32\x13\x00\x32\x11\x00\x32\x0f\x00\x32\x10\x00\x32\x14\x00\x32\x15\x00\x32"
+    "\x16\x12\x00\x9f\x1d\x00\x33\x11\x00\x32\x1f\x00\x33\x87\x00\x10\x0f\x01\x00\x1a\xf0\x14\x26\x01\x00\x00\x20\x00\x42\x20\x00\x4a"
+    "\x28\x00\x5f\x2b\x00\x5f\x2e\x00\x5f\x20\x00\x29\x2c\x00\x18\x2c\x00\x2a\x2c\x00\x69\x2c\x00\x43\x2e\x03\x00\x1f\x69\x4b\x00\x10"
+    "\x0f\x01\x00\x1a\xf0\x14\x27\x01\x00\x00\x22\x00\x42\x22\x00\x4a\x2a\x00\x39\x2d\x00\x5f\x30\x00\x5f\x22\x00\x29\x2e\x00\x18\x2e"
+    "\x00\x2a\x2e\x00\x69\x2e\x00\x43\x30\x03\x00\x0f\x78\x00\x3e\x1f\x28\xf0\x00\x64\xe0\x29\x01\x00\x00\x1c\x00\x6d\x20\x00\x14\x1e"
+    "\x00\x6d\x24\x06\x00\xf2\x01\x3a\x1c\x00\x13\x1c\x00\x58\x20\x00\x6e\x20\x00\x3a\x1a\x00\x13\x06\x00\x0f\x4b\x00\x10\x0f\x01\x00"
+    "\x1a\x12\x2a\x78\x00\x11\x22\x78\x00\x70\x1e\x00\x84\x1e\x00\x3a\x26\xe8\x08\x2f\x58\x22\x78\x00\x4b\xf1\x13\x2b\x01\x00\x01\x19"
+    "\x00\x6f\x16\x00\x20\x18\x00\x66\x19\x00\x66\x16\x00\x30\x1f\x00\x21\x1f\x00\x1e\x1e\x00\x2f\x16\x00\x30\x17\x00\x7b\x06\x00\x1f"
+    "\x71\x3c\x00\x01\x0f\xd0\x11\x20\x31\x93\x0f\x23\xa0\x05\x21\x94\x2c\xb8\x0b\x53\x20\x1a\x00\x54\x17\x78\x00\x80\x2e\x21\x00\x21"
+    "\x18\x00\x1d\x19\x78\x00\xaf\x2e\x19\x00\x73\x16\x00\x2e\x1c\x00\x7b\x78\x00\x3d\xf0\x14\x2d\x01\x00\x01\x1a\x00\x6f\x1e\x00\x20"
+    "\x19\x00\x66\x1b\x00\x66\x17\x00\x2e\x1e\x00\x21\x1e\x00\x1e\x20\x00\x31\x17\x00\x2e\x1a\x00\x71\x17\x78\x00\x1f\x80\x78\x00\x3d"
+    "\x11\x2e\x78\x00\x26\x54\x16\x78\x00\x11\x30\x78\x00\x11\x1d\x78\x00\xaf\x30\x19\x00\x80\x17\x00\x30\x1c\x00\x73\x78\x00\x3d\xe0"
+    "\x2f\x01\x00\x00\x0f\x00\x29\x10\x00\x4a\x10\x00\x38\x11\x06\x00\x50\x29\x10\x00\x42\x11\x0c\x00\xdf\x42\x0f\x00\x4a\x0d\x00\x5f"
+    "\x0f\x00\x4a\x0f\x00\x5f\x78\x00\x01\x0f\x01\x00\x29\xe0\x30\x01\x01\x00\x10\x00\x29\x11\x00\x4a\x11\x00\x38\x10\x63\x00\x75\x29"
+    "\x11\x00\x42\x10\x00\x38\x72\x00\x10\x0f\x1b\x00\xff\x06\x5f\x05\x14\x00\x4a\x0a\x14\x00\x4a\x0f\x1e\x00\x4a\x19\x28\x00\x4b\x1e"
+    "\x28\x00\x4b\x5f\x00\x10\x0f\x01\x00\x06\xf0\x0e\x31\x01\x00\x00\x1b\x00\x36\x1d\x00\x36\x1f\x00\x36\x16\x00\x29\x16\x00\x29\x18"
+    "\x00\x29\x1a\x00\x2a\x1c\x00\x2a\x21\xe7\x0a\x7f\x29\x1a\x00\x36\x1e\x00\x2a\x4b\x00\x10\x0f\x01\x00\x1a\x42\x32\x01\x00\x00\x75"
+    "\x00\x3d\x1c\x00\x56\x78\x00\x7f\x37\x1a\x00\x29\x23\x00\x37\x78\x00\x40\x80\x33\x01\x00\x00\x1e\x00\x36\x20\xd5\x00\x21\x56\x20"
+    "\x7b\x00\x02\x78\x00\xaf\x22\x00\x37\x20\x00\x37\x1c\x00\x2a\x20\x78\x00\x42\x42\x34\x01\x00\x01\x72\x00\x01\x7b\x00\x47\x36\x20"
+    "\x00\x37\x78\x00\x20\x57\x1c\x09\x00\x1f\x57\x78\x00\x04\xc0\x19\x23\x00\x56\x19\x1e\x00\x74\x23\x28\x00\x57\x80\x16\x4f\x23\x28"
+    "\x00\x37\x80\x07\x05\x22\x14\x1e\x50\x0a\x03\xd8\x09\x28\x82\x35\x78\x00\x10\x22\x06\x00\x11\x37\x75\x00\x51\x57\x22\x00\x37\x24"
+    "\x78\x00\x1f\x24\x78\x00\x42\x00\xd9\x18\xf0\x0a\x0f\x00\x5c\x10\x00\x5c\x11\x00\x5c\x0d\x00\x5c\x0e\x00\x5c\x12\x00\x5c\x13\x00"
+    "\x5c\x0f\x00\x68\x11\x15\x00\x00\x06\x00\x3f\x14\x00\x5d\x78\x00\x01\x0f\x01\x00\x29\x1f\x37\x78\x00\x02\x38\x14\x00\x5d\x78\x00"
+    "\x3f\x13\x00\x5c\x4b\x00\x10\x0f\x01\x00\x1a\x1f\x38\x78\x00\x64\x11\x39\xb0\x13\x00\x75\x00\x11\x12\x75\x00\x11\x0f\x66\x00\x61"
+    "\x15\x00\x5d\x11\x00\x68\x71\x01\x00\x06\x00\x1f\x17\x68\x01\x3f\x18\x3a\x78\x00\x02\x75\x00\x11\x17\x75\x00\x05\x72\x00\x4f\x12"
+    "\x00\x5c\x19\x78\x00\x3f\xa1\x3b\x01\x01\x01\x31\x00\x52\x31\x00\x2f\x51\x09\xf1\x18\x43\x34\x00\x39\x34\x00\x84\x3a\x00\x65\x3a"
+    "\x00\x2f\x37\x00\x2a\x37\x00\xca\x3d\x00\x39\x3d\x00\x84\x1e\x28\x00\x4a\x28\x32\x00\x4b\x2d\x37\x00\x4b\x28\x32\x0c\x00\x10\x4a"
+    "\xc4\x02\xa1\x28\x32\x00\x37\x2d\x37\x00\x37\x28\x32\x0c\x00\x0f\x20\x0d\x16\x80\x3c\x01\x01\x00\x31\x00\x2a\x31\x72\x00\x20\x52"
+    "\x34\x6c\x00\x20\x40\x37\x78\x00\x20\x2a\x3a\x72\x00\xe0\x65\x3d\x00\x2f\x40\x00\x40\x40\x00\x84\x23\x2d\x00\x4a\x74\x00\x21\x32"
+    "\x3c\x7c\x00\x00\x0c\x00\x1f\x4a\xd7\x00\x10\x0f\x01\x00\x06\xf0\x19\x3d\x01\x01\x01\x3a\x00\x40\x3a\x00\x84\x37\x00\x52\x37\x00"
+    "\x2f\x34\x00\x2a\x34\x00\x43\x43\x00\x40\x43\x00\x84\x40\x00\x65\x40\x00\x2f\x3d\x00\x2a\x3d\x00\xca\xe0\x00\x00\x74\x00\x21\x37"
+    "\x41\x7c\x00\x00\x0c\x00\x00\xf4\x00\xb1\x36\x32\x3c\x00\x37\x37\x41\x00\x37\x32\x3c\x0c\x00\x0f\xf0\x00\x15\xf0\x15\x82\x3e\x01"
+    "\x00\x00\x16\x00\x64\x16\x00\x51\x19\x00\x64\x19\x00\x51\x16\x00\x19\x18\x00\x19\x1f\x00\x52\x22\x00\x52\x1a\x00\x19\x20\x00\x7d"
+    "\x1a\x20\x04\x1f\x7d\xc3\x00\x10\x0f\x01\x00\x1a\x1f\x3f\xa8\x0c\x29\x00\xa4\x0c\x03\xa0\x0c\x40\x23\x28\x00\x49\x04\x00\x0f\xb0"
+    "\x04\x00\x04\x74\x0f\x09\xb8\x1a\x1f\x40\x78\x00\x29\xb4\x0f\x00\xc2\x05\x23\x00\x36\x0f\x19\x00\xc2\x04\x00\x0f\x58\x02\x15\x1f"
+    "\x41\x78\x00\x29\x7f\x23\x00\x48\x05\x0f\x00\xbb\xf0\x00\x21\xf0\x08\x42\x01\x01\x01\x20\x00\x15\x22\x00\x4d\x24\x00\x16\x1f\x00"
+    "\x4d\x1f\x00\x4a\x1f\x00\x34\x1e\x12\x00\xdf\x36\x25\x00\x4e\x25\x00\x35\x28\x00\x4e\x28\x00\x35\x70\x08\x01\x0f\x68\x01\x1c\x09"
+    "\x48\x12\x11\x43\xd0\x11\xa1\x15\x21\x00\x72\x1f\x00\x15\x23\x00\x72\x7e\x00\x20\x34\x26\x06\x00\x41\x36\x28\x00\x16\x78\x00\x4f"
+    "\x16\x28\x00\x35\xf0\x00\x02\x0f\x78\x00\x28\xf4\x01\x44\x01\x00\x01\x1f\x00\x15\x1e\x00\x2b\x20\x00\x2b\x24\x00\x2c\x78\x00\x20"
+    "\x2c\x1f\xf0\x00\x11\x37\x78\x00\x1f\x37\x78\x00\x07\x23\x36\x14\x48\x0a\x00\x04\x07\x0b\x08\x07\x0f\xe0\x01\x0a\x11\x45\xf0\x00"
+    "\xf0\x02\x10\x1f\x00\x2b\x1d\x00\x10\x24\x00\x2c\x22\x00\x11\x1f\x00\x34\x22\x36\x0c\x41\x36\x25\x00\x11\x78\x00\x1f\x11\xf0\x00"
+    "\x40\x11\x46\x90\x06\x51\xce\x0f\x00\xce\x0a\x03\x00\x11\x14\x03\x00\x44\x19\x00\xce\x1e\x06\x00\x6f\x05\x00\xce\x23\x00\xce\x78"
+    "\x00\x01\x0f\x01\x00\x29\x1f\x47\xd0\x02\x57\x18\xd3\xf0\x00\x1f\x48\x38\x04\x2c\x0f\x78\x00\x25\xf0\x05\x49\x01\x00\x01\x2c\x00"
+    "\x10\x0a\x00\xa1\x30\x00\x11\x0a\x00\xbb\x0f\x00\xa1\x29\x8c\x1c\xef\xbb\x29\x00\x36\x32\x00\x11\x2f\x00\x35\x32\x00\x11\x32\xe0"
+    "\x01\x04\x0f\xf0\x00\x28\x11\x4a\x10\x1d\xa2\xbb\x0c\x00\xbb\x08\x00\xbb\x0e\x00\xbb\x0c\x00\x44\x10\x00\xbb\x06\x12\x00\x02\x06"
+    "\x00\x0f\x78\x00\x3d\x1f\x4b\xa0\x05\x57\x09\x78\x00\x1f\x4c\x78\x00\x64\x11\x4d\xe0\x01\xa2\x15\x0a\x00\xa1\x2c\x00\x2b\x30\x00"
+    "\x16\xe0\x01\x31\x30\x00\x2c\xe0\x01\x11\x16\xe0\x01\x1f\x16\xe0\x01\x05\x0f\x78\x00\x28\x80\x4e\x01\x00\x01\x0f\x00\xb1\x2c\x43"
+    "\x1a\xff\x0b\xc1\x0f\x00\xc2\x31\x00\x16\x2b\x00\x34\x19\x00\xca\x29\x00\x36\x14\x00\xb1\x31\x00\x35\x14\x00\xb1\x34\x78\x00\x06"
+    "\x32\xc2\x0a\x14\x88\x06\x13\x14\x04\x00\x0f\xb0\x04\x15\x1f\x4f\x68\x01\x64\x42\x50\x01\x00\x00\x68\x01\x35\x0a\x00\xe7\x68\x01"
+    "\xff\x00\x32\x00\x16\x29\x00\x36\x0f\x00\xe7\x2f\x00\x35\x0f\x00\xe7\x68\x01\x04\x0f\x01\x00\x29\x50\x51\x01\x01\x00\x2e\x60\x0f"
+    "\xf1\x07\xe7\x2e\x00\x68\x32\x00\x16\x34\x00\x69\x2b\x00\x34\x36\x00\x5f\x1e\x00\xe3\x0f\x00\xf6\x68\x01\xe1\xf6\x34\x00\x35\x19"
+    "\x23\x00\x4a\x1e\x2d\x00\x4b\x23\x32\x04\x07\x00\x4c\x0a\x0f\xd8\x09\x2a\x1f\x52\x68\x01\x64\xe0\x53\x01\x01\x00\x1e\x00\x4d\x26"
+    "\x00\x16\x21\x00\x4d\x20\x83\x07\xf0\x02\x42\x21\x00\x4a\x24\x00\x4d\x28\x00\x16\x1e\x00\x15\x27\x00\x4e\x1e\x56\x19\x1f\x4e\x68"
+    "\x10\x3d\xb0\x54\x01\x00\x00\x21\x00\x4a\x23\x00\x42\x1d\x6a\x08\x20\x4a\x1f\x78\x00\xb4\x42\x23\x00\x4a\x25\x00\x42\x25\x00\x4a"
+    "\x27\x06\x00\x0f\x4b\x00\x10\x0f\x01\x00\x1a\x50\x55\x01\x01\x00\x22\xe1\x00\x50\x42\x1e\x00\x4a\x20\x03\x00\xb7\x42\x22\x00\x42"
+    "\x26\x00\x43\x26\x00\x43\x28\x03\x00\x0f\xf0\x00\x3d\x1f\x56\xf0\x00\x64\x81\x57\x01\x01\x00\x24\x00\x4a\x26\x0b\x16\x10\x22\x03"
+    "\x00\x20\x42\x24\xf0\x00\x11\x4a\xe7\x00\x24\x4a\x2a\x06\x00\x0f\xd0\x02\x3d\x50\x58\x01\x01\x00\x26\x68\x01\x00\x75\x00\xd1\x28"
+    "\x00\x4a\x18\x00\xda\x1a\x00\xda\x2a\x00\x4a\x1c\x06\x00\x14\x1e\x06\x00\x0f\x78\x00\x3d\x72\x59\x01\x01\x00\x28\x00\x4a\x6c\x00"
+    "\xa0\x18\x00\xda\x1c\x00\xda\x1e\x00\xda\x2c\xe9\x01\x00\x06\x00\x14\x16\x06\x00\x0f\x78\x00\x3d\x54\x5a\x01\x01\x00\x1a\x6f\x00"
+    "\xf4\x04\x20\x00\xda\x18\x00\xda\x16\x00\xda\x14\x00\xda\x22\x00\xda\x24\x00\xda\x12\x06\x00\x21\x0f\x19\x7c\x00\xdf\xda\x28\x2d"
+    "\x00\xdb\x23\x2d\x00\xdb\x19\x23\x00\xdb\x5f\x00\x10\x0f\x01\x00\x06\x1f\x5b\xf0\x00\x64\x1f\x5c\xe0\x01\x64\xb0\x5d\x01\x00\x01"
+    "\x25\x00\x11\x23\x00\x2c\x20\x10\x23\xa1\x2b\x22\x00\x30\x22\x00\x60\x23\x00\x66\x40\x0b\xaf\x31\x25\x00\x61\x28\x00\x31\x28\x00"
+    "\x61\x3c\x00\x01\x0f\xb8\x0b\x0c\x0f\x40\x29\x0a\xf2\x13\x5e\x01\x00\x01\x2b\x00\x56\x2d\x00\x2a\x2d\x00\x56\x2f\x00\x56\x28\x00"
+    "\x29\x31\x00\x57\x33\x00\x57\x29\x00\x36\x30\x00\x2a\x35\x00\x57\x06\x00\x0f\x78\x00\x02\x30\x23\x00\x56\x10\x0e\x00\x38\x13\x01"
+    "\x1c\x0e\x00\x04\x00\x0f\x80\x07\x14\x20\x5f\x01\xd4\x20\x12\xdc\x78\x00\xf4\x04\x1b\x00\xdc\x28\x00\x29\x1d\x00\xdc\x1e\x00\xe1"
+    "\x1f\x00\xdc\x30\x00\x2a\x17\x06\x00\x0f\x78\x00\x01\x0f\x01\x00\x29\x1f\x60\x78\x00\x64\x1f\x61\x68\x01\x29\x04\x08\x07\x11\x2d"
+    "\x04\x00\x5f\x49\x1e\x2d\x00\x83\x08\x07\x08\x09\x00\x0f\xf0\x0b\x62\x01\x00\x00\x09\x00\xa7\x09\x00\x0e\x0e\x00\xa7\x06\x00\x0a"
+    "\x06\x00\x0d\x0f\x00\xd6\x09\x00\x0b\x14\x06\x00\xaf\xa5\x19\x00\xd6\x0e\x00\xa5\x1e\x00\xd6\x78\x00\x01\x0f\x01\x00\x29\x11\x63"
+    "\x40\x29\x21\x29\x0c\xf3\x1e\x11\x0e\x03\x1e\x10\x0c\x63\x18\x24\x29\x06\x12\x00\x02\x06\x00\x0f\x4b\x00\x10\x0f\x01\x00\x1a\x11"
+    "\x64\xe0\x01\x1f\xc9\x03\x00\x0e\x0f\x4b\x00\x10\x0f\x01\x00\x1a\x1f\x65\x78\x00\x64\x1f\x66\x78\x00\x64\x1f\x67\x78\x00\x64\x1f"
+    "\x68\x78\x00\x64\x1f\x69\x78\x00\x64\x1f\x6a\x78\x00\x64\x00",
+    3503, 12840);
+
+const Resource gales(
+    "\xf0\x10\x03\x03\x18\x7f\xff\x00\x00\x7e\x0c\x7f\xff\x04\x01\x12\x00\x7e\x0c\x00\x7e\x00\x00\x7e\x06\x7f\xff\x03\x03\x0c\x00\xff"
+    "\x12\x0e\x00\x32\xff\x03\x03\x13\x00\x40\x0c\x00\xbe\x02\x2f\x00\x50\x06\x00\x7e\x03\x01\x37\x00\x00\x0b\x00\x90\xbe\x01\x00\x12"
+    "\x00\x7e\x05\x01\x00\x20\x00\x00\x3f\x00\x11\x12\x19\x00\x31\x04\x01\x0c\x29\x00\x02\x0e\x00\x01\x2f\x00\x00\x5e\x00\x00\x0b\x00"
+    "\x82\x12\x00\x7e\x06\x00\x7e\x18\x3f\x16\x00\x02\x7c\x00\x05\x16\x00\xc4\x7f\xff\x02\x01\x12\x7f\xff\x0c\x7f\xff\x02\x03\x10\x00"
+    "\x01\x7b\x00\x1c\x7e\x08\x00\x07\x33\x00\x70\x04\x01\x18\x00\x3e\x06\x00\x16\x00\x43\x12\x7f\xff\x04\xa4\x00\x00\x0e\x00\x00\x27"
+    "\x00\x05\xc8\x00\x01\x19\x00\x02\x01\x00\x61\x06\x00\x7e\x01\x00\x00\x4d\x00\x24\x00\xff\x75\x00\x30\x00\x00\x7e\xf6\x00\x00\xeb"
+    "\x00\x10\x18\x93\x00\x70\x00\x00\x7e\x12\xbf\xff\x12\x0b\x00\x00\x17\x01\x00\xc2\x00\x00\x29\x00\x01\x21\x00\x60\x01\x00\x06\x00"
+    "\x7e\x04\xc1\x00\x05\x51\x00\x04\x1b\x00\x01\x99\x00\x00\x32\x01\x33\x3f\xff\x04\xc4\x00\x11\x12\x03\x00\x10\x02\x52\x00\x01\x5a"
+    "\x00\x05\x27\x01\x31\x03\x01\x18\x9b\x00\x11\x06\xe8\x00\x04\x00\x01\x10\x1f\x00\x01\x21\x01\x00\x86\x01\x05\x85\x00\x13\x04\x20"
+    "\x00\x02\x4c\x00\x33\x01\x00\x0c\x80\x00\x07\xea\x00\x11\x12\x0e\x00\x10\x00\x5a\x01\x07\xc7\x00\x11\x12\xa4\x00\x11\x12\xa1\x00"
+    "\x10\x7f\x6a\x00\x25\x03\x03\x3a\x01\x21\x01\x02\xb9\x00\x02\x47\x00\x10\x05\xb4\x01\x11\x00\x08\x01\x11\x18\x3f\x00\x04\x11\x00"
+    "\x16\x12\x11\x00\x11\x06\x1f\x00\x05\x22\x00\x01\xec\x00\x02\x56\x00\x02\xde\x00\x25\x00\xbe\x5e\x00\x12\x3f\x25\x01\x01\x48\x01"
+    "\x00\x8c\x00\x00\x3d\x01\x02\x12\x02\x00\x13\x00\x00\xad\x01\x01\xee\x00\x02\x08\x00\x09\x13\x00\x02\xe1\x01\x13\x05\xba\x00\x07"
+    "\x3f\x00\x02\x8c\x00\x04\x52\x00\x70\x0c\x00\xbe\x03\x01\x0c\x3f\x1b\x00\x03\xe9\x01\x05\x56\x01\x03\x0a\x01\x01\xc7\x02\x04\x21"
+    "\x00\x00",
+    450, 747);
+
+const Resource leafgreen(
+    "\x5f\x00\x00\x00\x01\x00\x01\x00\x24\xf1\x09\x05\x0a\x00\x48\x0a\x14\x00\x48\x14\x1e\x00\x48\x1e\x23\x00\x48\x23\x28\x00\x48\x05"
+    "\x0a\x00\x81\x04\x00\x51\x0f\x00\x62\x05\x0f\x08\x00\xff\x07\x74\x0f\x19\x00\x62\x0f\x19\x00\x78\x0f\x19\x00\x82\x19\x23\x00\x63"
+    "\x19\x23\x00\x4f\x01\x78\x00\x28\x40\x14\x19\x00\x4f\x04\x00\xf1\x01\x19\x1e\x00\x4f\x1e\x23\x00\x4f\x23\x28\x00\x4f\x05\x05\x00"
+    "\x81\x04\x00\x33\x0f\x00\x3c\x78\x00\x90\x76\x0f\x19\x00\x3c\x14\x1e\x00\x3d\x78\x00\x10\x0f\x30\x00\x4f\x23\x00\x4f\x02\xf0\x00"
+    "\x3d\x06\x78\x00\x0c\xf0\x00\x00\x04\x00\x00\xf0\x00\x10\x62\x78\x00\x1f\x03\x78\x00\x57\x04\x68\x01\x10\x74\x78\x00\x1f\x04\x78"
+    "\x00\x2b\x60\x4f\x0a\x14\x00\x4f\x14\x68\x01\x11\x28\x04\x00\x17\x6d\x78\x00\x05\x04\x00\x26\x0f\x19\x04\x00\x9f\x19\x23\x00\x81"
+    "\x1e\x28\x00\x58\x05\xe0\x01\x47\x13\x76\x78\x00\x98\x3c\x0f\x19\x00\x76\x14\x1e\x00\x77\xe0\x01\x1f\x06\x68\x01\x5f\x10\x50\x78"
+    "\x00\xa2\x07\x01\x00\x00\x03\x00\x10\x03\x00\x13\x06\x00\x44\x02\x00\x10\x02\x0c\x00\x71\x04\x00\x10\x04\x00\x13\x05\x06\x00\x0f"
+    "\x87\x00\x10\x0f\x01\x00\x1a\x11\x08\x78\x00\x00\x69\x00\x11\x04\x69\x00\x11\x02\x7b\x00\x13\x05\x6f\x00\xaf\x0a\x04\x00\x0d\x05"
+    "\x00\x0a\x05\x00\x0d\x4b\x00\x10\x0f\x01\x00\x1a\xff\x19\x09\x01\x00\x00\x06\x00\x15\x06\x00\x10\x07\x00\x15\x07\x00\x38\x06\x00"
+    "\x1d\x07\x00\x10\x08\x00\x15\x03\x00\x27\x07\x00\x1d\x05\x00\x27\x06\x00\x20\x07\x00\x27\x4b\x00\x10\x0f\x01\x00\x1a\xff\x19\x0a"
+    "\x01\x00\x01\x0a\x00\x15\x0a\x00\x13\x06\x00\x1b\x0a\x00\x1b\x08\x00\x15\x08\x00\x13\x0c\x00\x15\x0c\x00\x13\x0a\x00\x38\x08\x00"
+    "\x1b\x0c\x00\x38\x0c\x00\x1b\x3c\x00\x01\x0f\xc0\x03\x29\xf0\x11\x0b\x01\x00\x00\x0a\x00\x34\x0d\x00\x10\x0d\x00\x45\x0c\x00\x34"
+    "\x0f\x00\x45\x0f\x00\x10\x10\x00\x45\x10\x00\x10\x0f\x00\x10\x0e\x12\x00\x4f\x10\x10\x00\x34\x78\x00\x01\x0f\x01\x00\x29\x11\x0c"
+    "\xf0\x00\x0f\x78\x00\x23\x0f\x28\x05\x29\xf0\x05\x0d\x01\x00\x00\x13\x00\x10\x11\x00\x34\x13\x00\x45\x12\x00\x34\x16\x00\x10\x16"
+    "\x09\x00\x41\x25\x14\x00\x25\x15\x00\x5f\x34\x11\x00\x34\x14\xf0\x00\x3f\xb0\x0e\x01\x00\x00\x12\x00\x10\x12\x00\x34\x10\x6c\x00"
+    "\x20\x10\x14\x69\x00\x50\x1b\x11\x00\x25\x13\x06\x00\x20\x1b\x0f\x7e\x00\x4f\x1b\x12\x00\x25\x4b\x00\x10\x0f\x01\x00\x1a\xb0\x0f"
+    "\x01\x00\x00\x10\x00\x15\x10\x00\x13\x0b\x66\x00\xf1\x04\x1b\x0d\x00\x15\x0e\x00\x13\x11\x00\x15\x11\x00\x13\x0e\x00\x13\x0d\x00"
+    "\x1b\x0f\x00\x0f\x58\x02\x02\x0f\x01\x00\x29\x41\x10\x01\x00\x01\x78\x00\x17\x64\x78\x00\x11\x64\x78\x00\x41\x64\x0e\x00\x64\x78"
+    "\x00\x1f\x64\x78\x00\x04\x0f\xd0\x02\x29\x50\x11\x01\x00\x01\x0e\x72\x00\x21\x15\x0c\x75\x00\x70\x0b\x00\x60\x0d\x00\x60\x0f\x65"
+    "\x01\x00\x12\x00\x32\x0f\x00\x60\x06\x00\x0f\x78\x00\x3d\xff\x19\x12\x01\x00\x01\x18\x00\x45\x18\x00\x30\x16\x00\x45\x17\x00\x10"
+    "\x19\x00\x10\x1a\x00\x30\x1a\x00\x45\x1b\x00\x10\x17\x00\x10\x1c\x00\x46\x17\x00\x10\x1e\x00\x46\x78\x00\x3d\x18\x13\x78\x00\x17"
+    "\x1b\x78\x00\xcf\x19\x00\x84\x1d\x00\x11\x1c\x00\x46\x1d\x00\x11\x78\x00\x40\x47\x14\x01\x00\x00\xf0\x00\x24\x84\x1b\x78\x00\x10"
+    "\x1e\xea\x00\x00\x7b\x00\x02\x06\x00\x0f\x78\x00\x01\x0f\x01\x00\x29\x18\x15\x78\x00\x0f\xf0\x00\x1c\x0f\x01\x00\x29\xf0\x08\x16"
+    "\x01\x00\x00\x14\x00\x15\x12\x00\x54\x12\x00\x13\x14\x00\x13\x16\x00\x15\x14\x00\x54\x16\x09\x00\x00\x12\x00\x9f\x17\x00\x14\x12"
+    "\x00\x13\x19\x00\x14\x4b\x00\x10\x0f\x01\x00\x1a\x12\x17\x78\x00\x10\x18\x6c\x00\xf0\x02\x15\x1a\x00\x54\x19\x00\x14\x1b\x00\x14"
+    "\x1c\x00\x54\x1d\x00\x14\x16\x72\x00\x7f\x16\x16\x00\x13\x1b\x00\x16\x4b\x00\x10\x0f\x01\x00\x1a\x1e\x18\x78\x00\x35\x19\x00\x16"
+    "\x78\x00\x11\x1b\x78\x00\x1f\x1d\x78\x00\x3f\x1f\x19\xc8\x0a\x5f\x01\xb8\x0b\x1f\x1a\x78\x00\x64\xff\x19\x1b\x01\x00\x01\x16\x00"
+    "\x72\x17\x00\x72\x18\x00\x72\x15\x00\x72\x19\x00\x72\x14\x00\x72\x13\x00\x72\x1a\x00\x72\x12\x00\x72\x1b\x00\x72\x11\x00\x72\x1c"
+    "\x00\x72\x78\x00\x3d\x41\x1c\x01\x00\x01\x60\x09\x11\x38\x60\x09\x11\x38\x60\x09\x50\x38\x03\x00\x15\x05\x03\x00\x42\x13\x05\x00"
+    "\x38\x06\x00\x0f\x78\x00\x01\x0f\x80\x07\x29\xff\x17\x1d\x01\x00\x01\x20\x00\x38\x28\x00\x16\x22\x00\x38\x22\x00\x15\x20\x00\x1b"
+    "\x22\x00\x1b\x2a\x00\x39\x2c\x00\x1c\x20\x00\x15\x2a\x00\x16\x20\x00\x15\x2c\x58\x02\x03\x0f\x78\x00\x29\xf0\x08\x1e\x01\x00\x01"
+    "\x07\x00\x0d\x07\x00\x0a\x0b\x00\x10\x0c\x00\x45\x0d\x00\x45\x0a\x00\x3f\x0d\x6a\x08\xdf\x45\x08\x00\x0b\x08\x00\x3f\x08\x00\x0e"
+    "\x0c\x00\x3f\x78\x00\x01\x0f\x28\x05\x29\xa2\x1f\x01\x00\x01\x08\x00\x0d\x08\x00\x0a\x6c\x00\x62\x0d\x00\x45\x0b\x00\x3f\x84\x00"
+    "\xaf\x09\x00\x0b\x09\x00\x3f\x09\x00\x0e\x0d\x78\x00\x03\x0f\xf0\x00\x29\x48\x20\x01\x00\x00\x28\x0b\x40\x03\x00\x0a\x03\x0c\x00"
+    "\xe0\x0e\x05\x00\x0b\x04\x00\x0b\x03\x00\x19\x06\x00\x0b\x05\x6f\x03\x0f\x01\x00\x3b\xf0\x02\x21\x01\x00\x00\x07\x00\x29\x08\x00"
+    "\x29\x07\x00\x4a\x09\x00\x29\x0a\x0c\x00\x80\x4a\x09\x00\x4a\x08\x00\x2e\x07\x15\x00\x00\x03\x00\x3f\x08\x00\x23\x4b\x00\x10\x0f"
+    "\x01\x00\x1a\x11\x22\x78\x00\xe0\x2e\x08\x00\x2e\x05\x00\x2e\x06\x00\x2e\x09\x00\x2e\x0a\x72\x00\x0c\x12\x00\x0f\x4b\x00\x10\x0f"
+    "\x01\x00\x1a\x84\x23\x01\x00\x00\x08\x00\x29\x09\xed\x00\x70\x0a\x00\x4a\x0a\x00\x2e\x0c\x6c\x00\x42\x23\x0b\x00\x29\x03\x00\x1f"
+    "\x0c\xf0\x00\x3f\x1f\x24\x10\x0e\x5f\x01\xd0\x02\x11\x25\xc8\x0a\xf1\x05\x32\x13\x00\x32\x11\x00\x32\x0f\x00\x32\x10\x00\x32\x14"
+    "\x00\x32\x15\x00\x32\x16\x12\x00\x9f\x1d\x00\x33\x11\x00\x32\x1f\x00\x33\x87\x00\x10\x0f\x01\x00\x1a\xf0\x14\x26\x01\x00\x00\x20"
+    "\x00\x42\x20\x00\x4a\x28\x00\x5f\x2b\x00\x5f\x2e\x00\x5f\x20\x00\x29\x2c\x00\x1c\x2c\x00\x2a\x2c\x00\x69\x2c\x00\x43\x2e\x03\x00"
+    "\x1f\x69\x4b\x00\x10\x0f\x01\x00\x1a\xf0\x14\x27\x01\x00\x00\x22\x00\x42\x22\x00\x4a\x2a\x00\x39\x2d\x00\x5f\x30\x00\x5f\x22\x00"
+    "\x29\x2e\x00\x1c\x2e\x00\x2a\x2e\x00\x69\x2e\x00\x43\x30\x03\x00\x0f\x78\x00\x3e\x1f\x28\xf0\x00\x64\xe0\x29\x01\x00\x00\x1c\x00"
+    "\x58\x20\x00\x14\x1e\x00\x58\x24\x06\x00\xf2\x01\x25\x1c\x00\x13\x1c\x00\x6d\x20\x00\x59\x20\x00\x25\x1a\x00\x13\x06\x00\x0f\x4b"
+    "\x00\x10\x0f\x01\x00\x1a\x12\x2a\x78\x00\x11\x22\x78\x00\x70\x1e\x00\x84\x1e\x00\x25\x26\xe8\x08\x2f\x6d\x22\x78\x00\x4b\xf1\x13"
+    "\x2b\x01\x00\x01\x19\x00\x6f\x16\x00\x1d\x18\x00\x66\x19\x00\x66\x16\x00\x30\x1f\x00\x1e\x1f\x00\x21\x1e\x00\x2f\x16\x00\x30\x17"
+    "\x00\x7f\x06\x00\x1f\x71\x3c\x00\x01\x0f\xd0\x11\x20\x31\x93\x0f\x23\xa0\x05\x21\x94\x2c\xb8\x0b\x53\x1d\x1a\x00\x54\x17\x78\x00"
+    "\x80\x2e\x21\x00\x1e\x18\x00\x20\x19\x78\x00\xaf\x2e\x19\x00\x73\x16\x00\x2e\x1c\x00\x7f\x78\x00\x3d\xf0\x14\x2d\x01\x00\x01\x1a"
+    "\x00\x6f\x1e\x00\x1d\x19\x00\x66\x1b\x00\x66\x17\x00\x2e\x1e\x00\x1e\x1e\x00\x21\x20\x00\x31\x17\x00\x2e\x1a\x00\x71\x17\x78\x00"
+    "\x1f\x80\x78\x00\x3d\x11\x2e\x78\x00\x26\x54\x16\x78\x00\x11\x30\x78\x00\x11\x20\x78\x00\xaf\x30\x19\x00\x80\x17\x00\x30\x1c\x00"
+    "\x73\x78\x00\x3d\xe0\x2f\x01\x00\x00\x0f\x00\x29\x10\x00\x4a\x10\x00\x38\x11\x06\x00\x50\x29\x10\x00\x42\x11\x0c\x00\xdf\x42\x0f"
+    "\x00\x4a\x0d\x00\x5f\x0f\x00\x4a\x0f\x00\x5f\x78\x00\x01\x0f\x01\x00\x29\xe0\x30\x01\x01\x00\x10\x00\x29\x11\x00\x4a\x11\x00\x38"
+    "\x10\x63\x00\x75\x29\x11\x00\x42\x10\x00\x38\x72\x00\x10\x0f\x1b\x00\xff\x06\x5f\x05\x14\x00\x4a\x0a\x14\x00\x4a\x0f\x1e\x00\x4a"
+    "\x19\x28\x00\x4b\x1e\x28\x00\x4b\x5f\x00\x10\x0f\x01\x00\x06\xf0\x0e\x31\x01\x00\x00\x1b\x00\x4f\x1d\x00\x4f\x1f\x00\x4f\x16\x00"
+    "\x29\x16\x00\x29\x18\x00\x29\x1a\x00\x2a\x1c\x00\x2a\x21\xe7\x0a\x7f\x29\x1a\x00\x4f\x1e\x00\x2a\x4b\x00\x10\x0f\x01\x00\x1a\x42"
+    "\x32\x01\x00\x00\x75\x00\x3d\x1c\x00\x56\x78\x00\x7f\x50\x1a\x00\x29\x23\x00\x50\x78\x00\x40\x80\x33\x01\x00\x00\x1e\x00\x4f\x20"
+    "\xd5\x00\x21\x56\x20\x7b\x00\x02\x78\x00\xaf\x22\x00\x50\x20\x00\x50\x1c\x00\x2a\x20\x78\x00\x42\x42\x34\x01\x00\x01\x72\x00\x01"
+    "\x7b\x00\x47\x4f\x20\x00\x50\x78\x00\x20\x57\x1c\x09\x00\x1f\x57\x78\x00\x04\xc0\x19\x23\x00\x56\x19\x1e\x00\x62\x23\x28\x00\x57"
+    "\x80\x16\x4f\x23\x28\x00\x50\x80\x07\x05\x22\x14\x1e\x50\x0a\x03\xd8\x09\x28\x82\x35\x78\x00\x10\x22\x06\x00\x11\x50\x75\x00\x51"
+    "\x57\x22\x00\x50\x24\x78\x00\x1f\x24\x78\x00\x42\x11\x36\x48\x03\xf0\x08\x5c\x10\x00\x5c\x11\x00\x5c\x0d\x00\x5c\x0e\x00\x5c\x12"
+    "\x00\x5c\x13\x00\x5c\x0f\x00\x68\x11\x15\x00\x00\x06\x00\x3f\x14\x00\x5d\x78\x00\x01\x0f\x01\x00\x29\x1f\x37\x78\x00\x02\x38\x14"
+    "\x00\x5d\x78\x00\x3f\x13\x00\x5c\x4b\x00\x10\x0f\x01\x00\x1a\x1f\x38\x78\x00\x64\x11\x39\xb0\x13\x00\x75\x00\x11\x12\x75\x00\x11"
+    "\x0f\x66\x00\x61\x15\x00\x5d\x11\x00\x68\x71\x01\x00\x06\x00\x1f\x17\x68\x01\x3f\x18\x3a\x78\x00\x02\x75\x00\x11\x17\x75\x00\x05"
+    "\x72\x00\x4f\x12\x00\x5c\x19\x78\x00\x3f\xa1\x3b\x01\x01\x01\x31\x00\x52\x31\x00\x2f\x51\x09\xf1\x18\x43\x34\x00\x39\x34\x00\x84"
+    "\x3a\x00\x65\x3a\x00\x2f\x37\x00\x2a\x37\x00\xca\x3d\x00\x39\x3d\x00\x84\x1e\x28\x00\x4a\x28\x32\x00\x4b\x2d\x37\x00\x4b\x28\x32"
+    "\x0c\x00\x10\x4a\xc4\x02\xa1\x28\x32\x00\x50\x2d\x37\x00\x50\x28\x32\x0c\x00\x0f\x20\x0d\x16\x80\x3c\x01\x01\x00\x31\x00\x2a\x31"
+    "\x72\x00\x20\x52\x34\x6c\x00\x20\x40\x37\x78\x00\x20\x2a\x3a\x72\x00\xe0\x65\x3d\x00\x2f\x40\x00\x40\x40\x00\x84\x23\x2d\x00\x4a"
+    "\x74\x00\x21\x32\x3c\x7c\x00\x00\x0c\x00\x1f\x4a\xd7\x00\x10\x0f\x01\x00\x06\xf0\x19\x3d\x01\x01\x01\x3a\x00\x40\x3a\x00\x84\x37"
+    "\x00\x52\x37\x00\x2f\x34\x00\x2a\x34\x00\x43\x43\x00\x40\x43\x00\x84\x40\x00\x65\x40\x00\x2f\x3d\x00\x2a\x3d\x00\xca\xe0\x00\x00"
+    "\x74\x00\x21\x37\x41\x7c\x00\x00\x0c\x00\x00\xf4\x00\xb1\x4f\x32\x3c\x00\x50\x37\x41\x00\x50\x32\x3c\x0c\x00\x0f\xf0\x00\x15\xf1"
+    "\x0f\x82\x3e\x01\x00\x00\x16\x00\x64\x16\x00\x51\x19\x00\x64\x19\x00\x51\x16\x00\x19\x18\x00\x19\x1f\x00\x52\x22\x00\x52\x1a\x09"
+    "\x00\x6f\x1a\x00\x19\x22\x00\x52\xc3\x00\x10\x0f\x01\x00\x1a\x1f\x3f\xa8\x0c\x29\x00\xa4\x0c\x03\xa0\x0c\x40\x23\x28\x00\x49\x04"
+    "\x00\x0f\xb0\x04\x00\x04\x74\x0f\x09\x88\x1d\x1f\x40\x78\x00\x29\xb4\x0f\x00\xb7\x05\x23\x00\x4f\x0f\x19\x00\xb7\x04\x00\x0f\x58"
+    "\x02\x15\x1f\x41\x78\x00\x29\x7f\x23\x00\x48\x05\x0f\x00\xbb\xf0\x00\x21\xf0\x08\x42\x01\x01\x01\x20\x00\x15\x22\x00\x4d\x24\x00"
+    "\x16\x1f\x00\x4d\x1f\x00\x4a\x1f\x00\x34\x1e\x12\x00\xdf\x4f\x25\x00\x4e\x25\x00\x35\x28\x00\x4e\x28\x00\x35\x70\x08\x01\x0f\x68"
+    "\x01\x1c\x09\x48\x12\x11\x43\xd0\x11\xa1\x15\x21\x00\x72\x1f\x00\x15\x23\x00\x72\x7e\x00\x20\x34\x26\x06\x00\x41\x4f\x28\x00\x16"
+    "\x78\x00\x4f\x16\x28\x00\x35\xf0\x00\x02\x0f\x78\x00\x28\xf4\x01\x44\x01\x00\x01\x1f\x00\x15\x1e\x00\x45\x20\x00\x45\x24\x00\x46"
+    "\x78\x00\x20\x46\x1f\xf0\x00\x11\x50\x78\x00\x1f\x50\x78\x00\x07\x23\x4f\x14\x48\x0a\x00\x04\x07\x0b\x08\x07\x0f\xe0\x01\x0a\x11"
+    "\x45\xf0\x00\xf0\x02\x10\x1f\x00\x45\x1d\x00\x10\x24\x00\x46\x22\x00\x11\x1f\x00\x34\x22\x36\x0c\x41\x4f\x25\x00\x11\x78\x00\x1f"
+    "\x11\xf0\x00\x40\x11\x46\x90\x06\x51\xce\x0f\x00\xce\x0a\x03\x00\x11\x14\x03\x00\x44\x19\x00\xce\x1e\x06\x00\x6f\x05\x00\xce\x23"
+    "\x00\xce\x78\x00\x01\x0f\x01\x00\x29\x1f\x47\xd0\x02\x57\x18\xdf\xf0\x00\x1f\x48\x78\x00\x64\xf0\x05\x49\x01\x00\x01\x2c\x00\x10"
+    "\x0a\x00\xa1\x30\x00\x11\x0a\x00\xbb\x0f\x00\xa1\x29\x8c\x1c\xef\xbb\x29\x00\x4f\x32\x00\x11\x2f\x00\x35\x32\x00\x11\x32\xe0\x01"
+    "\x04\x0f\x78\x00\x28\x11\x4a\x10\x1d\xa2\xbb\x0c\x00\xbb\x08\x00\xbb\x0e\x00\xbb\x0c\x00\x44\x10\x00\xbb\x06\x12\x00\x02\x06\x00"
+    "\x0f\x78\x00\x3d\x1f\x4b\xa0\x05\x57\x09\x78\x00\x1f\x4c\x78\x00\x64\x11\x4d\xe0\x01\xa2\x15\x0a\x00\xa1\x2c\x00\x45\x30\x00\x16"
+    "\xe0\x01\x31\x30\x00\x46\xe0\x01\x11\x16\xe0\x01\x1f\x16\xe0\x01\x05\x0f\x78\x00\x28\x80\x4e\x01\x00\x01\x0f\x00\xb1\x2c\x43\x1a"
+    "\xff\x0b\xc1\x0f\x00\xb7\x31\x00\x16\x2b\x00\x34\x19\x00\xca\x29\x00\x4f\x14\x00\xb1\x31\x00\x35\x14\x00\xb1\x34\x78\x00\x06\x32"
+    "\xb7\x0a\x14\x88\x06\x13\x14\x04\x00\x0f\xb0\x04\x15\x1f\x4f\x68\x01\x33\x1f\xe2\xf0\x00\x1d\x42\x50\x01\x00\x00\x68\x01\x35\x0a"
+    "\x00\xe7\x68\x01\xff\x00\x32\x00\x16\x29\x00\x4f\x0f\x00\xe7\x2f\x00\x35\x0f\x00\xe7\x68\x01\x04\x0f\x01\x00\x29\x50\x51\x01\x01"
+    "\x00\x2e\x60\x0f\xf0\x02\xe7\x2e\x00\x68\x32\x00\x16\x34\x00\x69\x2b\x00\x34\x36\x00\x5f\x32\x84\x00\x11\xf6\x68\x01\xe1\xf6\x34"
+    "\x00\x35\x19\x23\x00\x4a\x1e\x2d\x00\x4b\x23\x32\x04\x07\x00\x4c\x0a\x0f\xd8\x09\x2a\x1f\x52\x68\x01\x64\xe0\x53\x01\x01\x00\x1e"
+    "\x00\x4d\x26\x00\x16\x21\x00\x4d\x20\x83\x07\xe0\x42\x21\x00\x4a\x24\x00\x4d\x28\x00\x16\x26\x00\x7e\x27\xf5\x07\x4f\x7e\x2a\x00"
+    "\x4e\x68\x10\x3d\xb0\x54\x01\x00\x00\x21\x00\x4a\x23\x00\x42\x1d\x6a\x08\x20\x4a\x1f\x78\x00\xb4\x42\x23\x00\x4a\x25\x00\x42\x25"
+    "\x00\x4a\x27\x06\x00\x0f\x4b\x00\x10\x0f\x01\x00\x1a\x50\x55\x01\x01\x00\x22\xe1\x00\x50\x42\x1e\x00\x4a\x20\x03\x00\xb7\x42\x22"
+    "\x00\x42\x26\x00\x43\x26\x00\x43\x28\x03\x00\x0f\xf0\x00\x3d\x1f\x56\xf0\x00\x64\x81\x57\x01\x01\x00\x24\x00\x4a\x26\x0b\x16\x10"
+    "\x22\x03\x00\x20\x42\x24\xf0\x00\x11\x4a\xe7\x00\x24\x4a\x2a\x06\x00\x0f\xd0\x02\x3d\x50\x58\x01\x01\x00\x26\x68\x01\x00\x75\x00"
+    "\xd1\x28\x00\x4a\x18\x00\xda\x1a\x00\xda\x2a\x00\x4a\x1c\x06\x00\x14\x1e\x06\x00\x0f\x78\x00\x3d\x72\x59\x01\x01\x00\x28\x00\x4a"
+    "\x6c\x00\xa0\x18\x00\xda\x1c\x00\xda\x1e\x00\xda\x2c\xe9\x01\x00\x06\x00\x14\x16\x06\x00\x0f\x78\x00\x3d\x54\x5a\x01\x01\x00\x1a"
+    "\x6f\x00\xf4\x04\x20\x00\xda\x18\x00\xda\x16\x00\xda\x14\x00\xda\x22\x00\xda\x24\x00\xda\x12\x06\x00\x21\x0f\x19\x7c\x00\xdf\xda"
+    "\x28\x2d\x00\xdb\x23\x2d\x00\xdb\x19\x23\x00\xdb\x5f\x00\x10\x0f\x01\x00\x06\x1f\x5b\xf0\x00\x64\x1f\x5c\xe0\x01\x64\xb0\x5d\x01"
+    "\x00\x01\x25\x00\x11\x23\x00\x46\x20\x10\x23\xa1\x45\x22\x00\x30\x22\x00\x60\x23\x00\x66\x40\x0b\xaf\x31\x25\x00\x61\x28\x00\x31"
+    "\x28\x00\x61\x3c\x00\x01\x0f\xb8\x0b\x0c\x0f\x40\x29\x0a\xf2\x13\x5e\x01\x00\x01\x2b\x00\x56\x2d\x00\x2a\x2d\x00\x56\x2f\x00\x56"
+    "\x28\x00\x29\x31\x00\x57\x33\x00\x57\x29\x00\x4f\x30\x00\x2a\x35\x00\x57\x06\x00\x0f\x78\x00\x02\x30\x23\x00\x56\x10\x0e\x00\x38"
+    "\x13\x01\x1c\x0e\x00\x04\x00\x0f\x80\x07\x14\x20\x5f\x01\xd4\x20\x12\xdc\x78\x00\xf4\x04\x1b\x00\xdc\x28\x00\x29\x1d\x00\xdc\x1e"
+    "\x00\xd7\x1f\x00\xdc\x30\x00\x2a\x17\x06\x00\x0f\x78\x00\x01\x0f\x01\x00\x29\x1f\x60\x78\x00\x64\x1f\x61\x68\x01\x29\x04\x08\x07"
+    "\x11\x2d\x04\x00\x5f\x49\x1e\x2d\x00\x83\x08\x07\x08\x09\x00\x0f\xf0\x0b\x62\x01\x00\x00\x09\x00\xa5\x09\x00\x0e\x0e\x00\xa5\x06"
+    "\x00\x0a\x06\x00\x0d\x0f\x00\xd6\x09\x00\x0b\x14\x06\x00\xaf\xa7\x19\x00\xd6\x0e\x00\xa7\x1e\x00\xd6\x78\x00\x01\x0f\x01\x00\x29"
+    "\x11\x63\x40\x29\x21\x29\x0c\xf3\x1e\x11\x0e\x03\x1e\x10\x0c\x63\x18\x24\x29\x06\x12\x00\x02\x06\x00\x0f\x4b\x00\x10\x0f\x01\x00"
+    "\x1a\x11\x64\xe0\x01\x1f\xc9\x03\x00\x0e\x0f\x4b\x00\x10\x0f\x01\x00\x1a\x1f\x65\x78\x00\x64\x1f\x66\x78\x00\x64\x1f\x67\x78\x00"
+    "\x64\x1f\x68\x78\x00\x64\x1f\x69\x78\x00\x64\x1f\x6a\x78\x00\x64\x00",
+    3505, 12840);
+
+const Resource ruby(
+    "\x5f\x00\x00\x00\x01\x00\x01\x00\x24\xf0\x01\x05\x23\x00\x48\x0a\x1e\x01\x16\x0f\x19\x01\x16\x19\x1e\x01\x17\x04\x00\x60\x05\x0a"
+    "\x00\x81\x05\x0a\x18\x00\x41\x00\x81\x0a\x1e\x20\x00\xff\x07\x40\x19\x1e\x01\x40\x1e\x23\x01\x40\x14\x19\x01\x40\x23\x28\x01\x40"
+    "\x28\x2d\x01\x40\x01\x78\x00\x50\x40\x1e\x23\x01\x3f\x78\x00\x00\x80\x00\x04\x78\x00\x1f\x02\x78\x00\x28\xe5\x14\x1e\x00\xb7\x0a"
+    "\x14\x00\xb7\x1e\x23\x00\xb7\x05\x0a\x04\x00\x00\x78\x00\x13\x76\x78\x00\xff\x0b\x76\x0a\x1e\x01\x55\x19\x1e\x01\x55\x1e\x23\x01"
+    "\x55\x14\x19\x01\x55\x23\x28\x01\x55\x28\x2d\x01\x55\x03\x68\x01\x64\x1f\x04\x78\x00\x58\x44\x19\x1e\x00\x78\x78\x00\x1f\x05\xe0"
+    "\x01\x64\x1f\x06\x78\x00\x2b\x00\x5c\x00\x72\x81\x0f\x19\x00\x81\x19\x1e\x04\x00\x00\x78\x00\x22\x0a\x0f\x18\x00\x04\x04\x00\x22"
+    "\x1e\x23\x04\x00\xdf\x23\x28\x00\x82\x23\x2d\x00\x82\x05\x2d\x00\x82\x07\xf0\x00\x4a\x23\x01\x72\xf0\x00\x10\x72\xf0\x00\x44\x1e"
+    "\x23\x00\xde\xf0\x00\xe0\x08\x01\x00\x00\x02\x01\x09\x02\x01\x07\x02\x01\x09\x03\x03\x00\x11\x07\x03\x00\x00\x09\x00\x71\x02\x01"
+    "\x05\x02\x01\x05\x03\x03\x00\x0f\x87\x00\x10\x0f\x01\x00\x1a\x42\x09\x01\x00\x01\x69\x00\x40\x04\x01\x07\x04\x6f\x00\x42\x11\x04"
+    "\x01\x11\x6c\x00\x10\x04\x03\x00\x20\x18\x04\x0c\x00\x1f\x1b\x3c\x00\x01\x0c\x48\x03\x4f\x14\x1e\x01\x1b\x48\x03\x15\x53\x0a\x01"
+    "\x00\x01\x02\xe4\x00\x21\x07\x04\xe4\x00\x05\x75\x00\xcf\x03\x01\x16\x03\x01\x16\x02\x01\x16\x04\x01\x16\x78\x00\x01\x0f\x58\x02"
+    "\x29\x42\x0b\x01\x00\x01\xea\x00\x41\x05\x01\x07\x05\xf6\x00\x10\x05\x0f\x00\x51\x14\x05\x01\x14\x04\x72\x00\x4f\x03\x01\x16\x05"
+    "\x78\x00\x03\x04\x74\x00\x0f\x78\x00\x00\x09\x58\x02\x00\x70\x02\x00\x58\x02\x21\x14\x19\x5c\x02\x6f\x81\x28\x2d\x00\x81\x0c\x38"
+    "\x04\x64\x1f\x0d\x78\x00\x64\x1f\x0e\x78\x00\x64\x1f\x0f\x78\x00\x64\x1f\x10\x78\x00\x64\xf0\x07\x11\x01\x00\x01\x0c\x01\x07\x0c"
+    "\x01\x35\x0c\x01\x3c\x0d\x01\x35\x0d\x01\x38\x0d\x00\x2b\x06\x00\x51\x01\x3c\x0c\x01\x16\x03\x00\x4f\x37\x0d\x01\x37\x78\x00\x3d"
+    "\xf1\x14\x12\x01\x01\x01\x14\x00\x1b\x14\x01\x48\x15\x00\x1b\x15\x01\x48\x13\x01\x4b\x15\x01\x4b\x13\x00\x1b\x13\x01\x48\x14\x01"
+    "\x57\x14\x01\x57\x16\x03\x00\xa6\x0a\x0f\x00\x4a\x05\x0a\x00\x4a\x0f\x14\x04\x00\x0f\x38\x04\x14\xf0\x0d\x53\x19\x1e\x01\x53\x1e"
+    "\x23\x01\x53\x14\x19\x01\x53\x23\x28\x01\x53\x28\x2d\x01\x53\x13\x01\x00\x00\x0f\x01\x42\x03\x00\x41\x00\x42\x0e\x01\x03\x00\x62"
+    "\x00\x42\x10\x01\x42\x10\x06\x00\x04\x03\x00\x0f\xf0\x00\x01\x0f\x01\x00\x29\x11\x14\x78\x00\x10\x47\x03\x00\x50\x00\x1b\x0e\x01"
+    "\x47\x03\x00\x63\x00\x1b\x10\x01\x47\x10\x06\x00\x12\xe3\x06\x00\x0f\x4b\x00\x10\x0f\x01\x00\x1a\xe0\x15\x01\x01\x01\x10\x01\x4d"
+    "\x10\x01\x11\x11\x01\x4d\x0f\x03\x00\xf1\x01\x11\x10\x01\x4f\x10\x01\x12\x12\x01\x12\x11\x01\x4f\x0f\x01\x4f\x06\x00\x1f\x1b\x68"
+    "\x01\x3d\xe0\x16\x01\x00\x01\x17\x01\x4d\x17\x01\x14\x19\x01\x4d\x18\x06\x00\xff\x05\x14\x19\x01\x15\x18\x00\x27\x19\x00\x27\x18"
+    "\x01\x16\x18\x01\x16\x1a\x01\x16\x19\xa0\x05\x2b\x0f\x58\x02\x01\xf0\x0b\x17\x01\x00\x00\x06\x01\x07\x06\x01\x25\x06\x01\x22\x07"
+    "\x01\x25\x07\x01\x22\x06\x01\x14\x07\x01\x14\x08\x06\x00\xaf\x07\x08\x01\x07\x07\x01\x2c\x08\x01\x2c\x78\x00\x01\x0f\x01\x00\x29"
+    "\xf1\x04\x18\x01\x00\x01\x0d\x01\x07\x0d\x01\x3b\x0e\x01\x07\x0e\x01\x3b\x0d\x00\xb7\x48\x03\x51\x3a\x0d\x01\x3a\x0e\x03\x00\x4f"
+    "\x0d\x01\x39\x0d\x08\x07\x3f\xe0\x19\x01\x00\x01\x18\x01\x07\x18\x01\x35\x1a\x01\x07\x1a\x06\x00\x40\x08\x1a\x01\x36\x39\x01\x01"
+    "\x62\x01\x40\x1a\x01\x16\x1b\x0c\x00\x1f\x60\x78\x00\x01\x0f\x68\x01\x14\x13\x3e\x08\x07\xff\x23\x3e\x14\x19\x01\x3e\x23\x28\x01"
+    "\x3e\x28\x2d\x01\x3e\x1a\x01\x00\x01\x19\x01\x07\x19\x01\x08\x1b\x01\x07\x19\x00\x2b\x1b\x01\x08\x1a\x00\x2b\x1b\x00\x2b\x18\x00"
+    "\x2b\x19\x01\x65\x1a\x01\x65\x1b\x01\x65\x78\x00\x2c\x12\x19\x7c\x00\x09\x78\x00\x17\x1b\x78\x00\x72\x08\x19\x00\x2b\x19\x00\xb7"
+    "\x78\x00\xdf\x1b\x00\xb7\x19\x01\x67\x1b\x01\x67\x19\x01\x60\x19\x68\x01\x2a\x0f\xd0\x02\x02\x41\x1c\x01\x00\x01\x62\x01\x81\x63"
+    "\x1a\x01\x08\x1c\x01\x63\x1c\xf0\x00\x10\x1c\x03\x00\x12\x2c\x65\x01\x1f\x1c\x68\x01\x2d\x0f\xd0\x02\x02\x1f\x1d\x40\x0b\x64\x1f"
+    "\x1e\xf0\x00\x64\x1f\x1f\xf0\x00\x64\x1f\x20\x78\x00\x64\x1f\x21\x78\x00\x64\x1f\x22\x78\x00\x64\x1f\x23\x20\x0d\x64\x1f\x24\x78"
+    "\x00\x38\x4f\x23\x28\x01\x41\xf0\x00\x15\xf4\x11\x25\x01\x00\x01\x1e\x01\x68\x23\x01\x68\x19\x01\x68\x28\x01\x68\x14\x01\x68\x2d"
+    "\x01\x68\x0f\x01\x68\x32\x01\x68\x0a\x01\x68\x05\x06\x00\x0f\x78\x00\x11\x0f\x68\x01\x19\x1f\x26\xe0\x01\x64\x1f\x27\x78\x00\x5a"
+    "\x24\x00\x74\x78\x00\x1f\x28\x78\x00\x64\x1f\x29\x78\x00\x64\x1f\x2a\xc0\x12\x2a\xe0\x01\x6e\x14\x1e\x00\xaa\x1e\x23\x01\x6e\x1e"
+    "\x23\x01\x71\x04\x00\x0f\x37\x00\x10\x01\x01\x00\x1f\x2b\x78\x00\x64\xf0\x02\x2c\x01\x00\x00\x07\x00\x29\x08\x01\x28\x07\x01\x28"
+    "\x08\x00\x29\x09\x06\x00\xff\x04\x3f\x0a\x01\x28\x06\x01\x28\x07\x00\x4a\x08\x00\x4a\x06\x00\x4a\x09\x00\x4a\x4b\x00\x10\x0f\x01"
+    "\x00\x1a\x1f\x2d\x78\x00\x09\x52\x01\x30\x08\x01\x30\x06\x00\x0f\x4b\x00\x10\x0f\x01\x00\x1a\xf1\x05\x2e\x01\x00\x00\x09\x00\x29"
+    "\x0a\x01\x30\x09\x01\x30\x0b\x01\x30\x0a\x00\x29\x09\x78\x00\xff\x00\x0b\x01\x28\x0a\x01\x2f\x0a\x01\x2f\x09\x01\x2f\x0b\x01\x2f"
+    "\x4b\x00\x10\x0f\x01\x00\x1a\x70\x2f\x01\x01\x00\x0a\x00\x29\x72\x00\x60\x01\x30\x0b\x00\x29\x0c\x7b\x00\x21\x3f\x0a\x6c\x00\x11"
+    "\x0c\x78\x00\x02\x06\x00\x00\x30\x0c\x48\x0a\x14\x01\x2b\x34\x0c\x0f\x5f\x00\x10\x0f\x01\x00\x06\x40\x30\x02\x00\x00\x47\x0a\x00"
+    "\xd2\x09\xff\x0d\xcb\x1b\x00\xcb\x19\x00\xb1\x19\x00\x54\x19\x00\x2c\x1b\x00\xca\x19\x00\x19\x1b\x00\xca\x1b\x00\x19\x1d\x00\xca"
+    "\x4b\x00\x10\x0f\x01\x00\x1a\x4f\x31\x02\x00\x01\x78\x00\x25\x40\x14\x1e\x00\x36\x04\x00\x26\x1e\x23\x04\x00\x09\x50\x0a\x11\x19"
+    "\x08\x00\x71\x76\x19\x1e\x00\x76\x1e\x23\x04\x00\xf0\x08\x77\x23\x28\x00\x77\x19\x1e\x00\x77\x32\x02\x00\x01\x1b\x00\x6f\x1b\x00"
+    "\x2b\x1d\x00\x6f\x1d\x81\x00\x80\x54\x1d\x00\x2c\x1f\x00\x2c\x1d\x09\x00\xaf\x55\x1b\x00\x7f\x1f\x00\x55\x1d\x00\x7f\x78\x00\x10"
+    "\x5f\x37\x19\x28\x00\x37\x78\x00\x15\x71\x33\x02\x01\x00\x1b\x00\xe7\x78\x00\x11\xe7\x78\x00\x14\xb1\x78\x00\xd8\xb1\x1d\x00\xb2"
+    "\x1b\x00\xd6\x1f\x00\xb2\x1d\x00\xd6\x10\x0e\x6f\x14\x19\x00\x4a\x19\x1e\xe0\x01\x2b\x42\x36\x01\x00\x00\x32\x13\x40\x05\x01\x1d"
+    "\x06\x09\x00\xb0\x0a\x05\x01\x0c\x06\x01\x09\x06\x01\x1d\x05\x3e\x13\x7f\x1f\x06\x01\x14\x06\x01\x1f\x4b\x00\x10\x0f\x01\x00\x1a"
+    "\x11\x37\x10\x0e\x20\x25\x07\x10\x0e\x00\x03\x00\x01\x13\x0e\x5a\x25\x05\x01\x25\x08\x06\x00\x0f\x4b\x00\x10\x0f\x01\x00\x1a\x1f"
+    "\x38\x18\x06\x2c\x08\x04\x00\x4e\x1e\x23\x00\x49\x18\x06\x41\x00\x48\x19\x1e\x1c\x00\x01\x20\x00\xf4\x19\x19\x1e\x00\x49\x14\x19"
+    "\x00\x49\x39\x01\x00\x00\x18\x00\x64\x18\x00\x51\x19\x00\x64\x19\x00\x51\x17\x00\x64\x17\x00\x51\x1a\x00\x64\x1a\x00\x51\x16\x00"
+    "\x64\x16\x06\x00\x0f\x87\x00\x10\x0f\x01\x00\x1a\x1f\x3a\x78\x00\x0e\x6f\x1a\x00\x65\x1a\x00\x52\x4b\x00\x10\x0f\x01\x00\x1a\xf2"
+    "\x13\x3b\x01\x00\x01\x10\x00\x29\x11\x00\x29\x12\x00\x29\x0f\x00\x29\x0e\x00\x29\x10\x01\x52\x12\x01\x52\x0e\x01\x52\x13\x00\x29"
+    "\x14\x00\x29\x06\x00\x0f\x3c\x00\x01\xff\x05\x05\x23\x00\x29\x1e\x23\x00\x29\x19\x23\x01\x52\x0f\x19\x01\x52\x05\x0f\x01\x52\x10"
+    "\x0e\x15\xa0\x3c\x01\x00\x01\x21\x00\x2a\x23\x00\x2a\x06\x00\xf2\x05\x01\x52\x21\x01\x52\x25\x01\x52\x23\x00\x2a\x27\x01\x52\x26"
+    "\x00\x2a\x28\x00\x2a\x06\x00\x0f\x78\x00\x01\x40\x1e\x23\x00\x2a\x04\x00\x0f\x78\x00\x15\xdf\x1e\x23\x01\x54\x23\x28\x01\x54\x28"
+    "\x2d\x01\x54\x3d\x78\x00\x64\x15\x3e\x78\x00\xff\x00\x1e\x01\x73\x23\x01\x52\x23\x01\x73\x25\x01\x52\x19\x01\x73\x78\x00\x4c\x00"
+    "\x21\x1c\x10\x1b\x7f\x0e\xf4\x02\x63\x1a\x01\x63\x19\x01\x63\x1d\x01\x63\x18\x01\x63\x17\x01\x63\x16\x0c\x00\x02\x06\x00\x0f\x78"
+    "\x00\x01\x0f\x01\x00\x29\x1f\x41\x78\x00\x08\xcf\x1b\x01\x61\x1b\x01\x61\x19\x01\x61\x1d\x01\x61\x4b\x00\x10\x0f\x01\x00\x1a\x12"
+    "\x42\x78\x00\x40\x1b\x01\x33\x1c\x75\x00\xe1\x33\x1d\x01\x63\x1b\x00\x25\x1d\x00\x25\x19\x00\x25\x1b\x78\x0f\x11\x1a\x7b\x0f\x0f"
+    "\x4b\x00\x10\x0f\x01\x00\x1a\x41\x43\x01\x00\x00\x72\x00\x21\x63\x1b\xf3\x00\x11\x1e\xf6\x00\x10\x18\x02\x01\xdf\x61\x1a\x01\x61"
+    "\x1e\x01\x61\x1c\x01\x66\x1c\x01\x66\x4b\x00\x10\x0f\x01\x00\x1a\x10\x44\x68\x10\xf0\x06\x00\x29\x1a\x01\x6b\x1c\x00\x29\x1c\x01"
+    "\x6b\x1e\x00\x29\x1e\x01\x6b\x20\x00\x29\x20\x06\x00\x15\x2a\x06\x00\x0f\x3c\x00\x01\x03\x20\x05\x51\x29\x19\x1e\x01\x6b\x04\x00"
+    "\x3f\x23\x01\x6b\x68\x10\x15\x4e\x45\x01\x00\x00\x78\x00\x40\x1a\x01\x69\x20\x0c\x00\x50\x2a\x1c\x01\x69\x20\xeb\x02\x1f\x69\x78"
+    "\x00\x01\x0f\x01\x00\x29\x10\x46\x10\x0e\xf0\x06\x00\x29\x1f\x00\x29\x20\x00\x29\x21\x00\x29\x1c\x00\x29\x1d\x00\x29\x22\x00\x29"
+    "\x23\x06\x00\x03\xd8\x03\x1f\x24\x48\x03\x03\x04\xf0\x00\x00\xb4\x04\x04\x54\x03\x0f\xf0\x00\x15\xf2\x13\x47\x01\x00\x00\x28\x00"
+    "\x2a\x28\x01\x29\x28\x01\x31\x28\x01\x26\x24\x00\x29\x24\x01\x28\x26\x00\x2a\x26\x01\x29\x24\x01\x30\x24\x01\x25\x06\x00\x0f\x78"
+    "\x00\x01\x0f\x01\x00\x29\x38\x48\x01\x01\x78\x00\x12\x34\x72\x00\xc2\x2a\x00\x2a\x2a\x01\x29\x2a\x01\x31\x26\x01\x33\x06\x00\xc4"
+    "\x1e\x28\x00\x4b\x1e\x28\x00\x4a\x23\x28\x00\x4b\x04\x00\x0f\x5f\x00\x10\x0f\x01\x00\x06\x41\x49\x01\x00\x01\x78\x00\x12\x2f\x78"
+    "\x00\x01\x72\x00\xff\x04\x2f\x2c\x00\x2a\x2c\x01\x2f\x2a\x01\x31\x2a\x01\x34\x2c\x01\x31\x2c\x01\x34\x3c\x00\x01\x01\xac\x04\x56"
+    "\x1e\x00\x2a\x23\x28\x04\x00\x0f\xb0\x04\x15\x4f\x4a\x01\x00\x00\xe0\x01\x25\x0f\x01\x00\x29\x18\x4b\x78\x00\xa1\x1e\x01\x2f\x20"
+    "\x01\x2f\x22\x01\x2f\x21\x7b\x00\x0f\x78\x00\x49\x13\x4c\x50\x19\x31\x00\x6d\x10\x53\x19\xa0\x0f\x01\x44\x0f\x00\xda\x10\x00\x6d"
+    "\x10\x5f\x19\xaf\x44\x10\x01\x44\x0e\x00\x58\x0e\x00\x58\x4b\x00\x10\x0f\x01\x00\x1a\x70\x4d\x01\x00\x00\x13\x01\x42\x03\x00\xf2"
+    "\x08\x00\x42\x12\x01\x42\x12\x01\x45\x12\x00\x42\x13\x01\x45\x14\x00\x42\x14\x01\x42\x14\x01\x45\x06\x00\x0f\x4b\x00\x10\x0f\x01"
+    "\x00\x1a\xf4\x11\x4e\x01\x00\x00\x30\x01\x2f\x30\x00\x2a\x32\x00\x2a\x32\x01\x2f\x30\x01\x58\x30\x01\x64\x32\x01\x64\x31\x01\x58"
+    "\x2f\x01\x58\x32\x06\x00\x0f\x4b\x00\x10\x0f\x01\x00\x1a\xf1\x0b\x4f\x01\x00\x00\x33\x01\x2f\x33\x00\x2a\x35\x00\x2a\x35\x01\x2f"
+    "\x33\x01\x58\x33\x01\x64\x35\x01\x64\x34\x6f\x00\x14\x35\x06\x00\x0f\x4b\x00\x10\x0f\x01\x00\x1a\x20\x50\x01\xbc\x0b\xff\x13\x2f"
+    "\x36\x00\x2a\x38\x00\x2a\x38\x01\x2f\x36\x01\x58\x36\x01\x64\x38\x01\x64\x37\x01\x58\x38\x01\x58\x39\x01\x4e\x36\x01\x4e\x3c\x01"
+    "\x4e\x4b\x00\x10\x0f\x01\x00\x1a\x00",
+    2505, 9360);
+
+const Resource sapphire(
+    "\x5f\x00\x00\x00\x01\x00\x01\x00\x24\xf0\x01\x05\x23\x00\x48\x0a\x1e\x01\x16\x0f\x19\x01\x16\x19\x1e\x01\x17\x04\x00\x60\x05\x0a"
+    "\x00\x81\x05\x0a\x18\x00\x41\x00\x81\x0a\x1e\x20\x00\xff\x07\x40\x19\x1e\x01\x40\x1e\x23\x01\x40\x14\x19\x01\x40\x23\x28\x01\x40"
+    "\x28\x2d\x01\x40\x01\x78\x00\x50\x40\x1e\x23\x01\x3f\x78\x00\x00\x80\x00\x04\x78\x00\x1f\x02\x78\x00\x28\xe5\x14\x1e\x00\xb7\x0a"
+    "\x14\x00\xb7\x1e\x23\x00\xb7\x05\x0a\x04\x00\x00\x78\x00\x13\x76\x78\x00\xff\x0b\x76\x0a\x1e\x01\x55\x19\x1e\x01\x55\x1e\x23\x01"
+    "\x55\x14\x19\x01\x55\x23\x28\x01\x55\x28\x2d\x01\x55\x03\x68\x01\x64\x1f\x04\x78\x00\x58\x44\x19\x1e\x00\x78\x78\x00\x1f\x05\xe0"
+    "\x01\x64\x1f\x06\x78\x00\x2b\x00\x5c\x00\x72\x81\x0f\x19\x00\x81\x19\x1e\x04\x00\x0b\x78\x00\x01\x04\x00\x22\x1e\x23\x04\x00\xdf"
+    "\x23\x28\x00\x82\x23\x2d\x00\x82\x05\x2d\x00\x82\x07\xf0\x00\x4a\x23\x01\x72\xf0\x00\x10\x72\xf0\x00\x44\x1e\x23\x00\xde\xf0\x00"
+    "\xe0\x08\x01\x00\x00\x02\x01\x09\x02\x01\x07\x02\x01\x09\x03\x03\x00\x11\x07\x03\x00\x00\x09\x00\x71\x02\x01\x05\x02\x01\x05\x03"
+    "\x03\x00\x0f\x87\x00\x10\x0f\x01\x00\x1a\x42\x09\x01\x00\x01\x69\x00\x40\x04\x01\x07\x04\x6f\x00\x42\x0e\x04\x01\x0e\x6c\x00\x10"
+    "\x04\x03\x00\x20\x18\x04\x0c\x00\x1f\x1b\x3c\x00\x01\x0c\x48\x03\x4f\x14\x1e\x01\x1b\x48\x03\x15\x53\x0a\x01\x00\x01\x02\xe4\x00"
+    "\x21\x07\x04\xe4\x00\x05\x75\x00\xcf\x03\x01\x16\x03\x01\x16\x02\x01\x16\x04\x01\x16\x78\x00\x01\x0f\x58\x02\x29\x42\x0b\x01\x00"
+    "\x01\xea\x00\x41\x05\x01\x07\x05\xf6\x00\x10\x05\x0f\x00\x51\x14\x05\x01\x14\x04\x72\x00\x4f\x03\x01\x16\x05\x78\x00\x03\x04\x74"
+    "\x00\x0f\x78\x00\x00\x05\x54\x02\x00\x04\x00\x00\x70\x02\x00\x58\x02\x21\x14\x19\x5c\x02\x6f\x81\x28\x2d\x00\x81\x0c\x38\x04\x64"
+    "\x1f\x0d\x78\x00\x64\x1f\x0e\x78\x00\x64\x1f\x0f\x78\x00\x64\x1f\x10\x78\x00\x64\xf0\x07\x11\x01\x00\x01\x0c\x01\x07\x0c\x01\x35"
+    "\x0c\x01\x3c\x0d\x01\x35\x0d\x01\x37\x0d\x00\x2b\x06\x00\x51\x01\x3c\x0c\x01\x16\x03\x00\x4f\x38\x0d\x01\x38\x78\x00\x3d\xf1\x14"
+    "\x12\x01\x01\x01\x14\x00\x1b\x14\x01\x48\x15\x00\x1b\x15\x01\x48\x13\x01\x4b\x15\x01\x4b\x13\x00\x1b\x13\x01\x48\x14\x01\x57\x14"
+    "\x01\x57\x16\x03\x00\xa6\x0a\x0f\x00\x4a\x05\x0a\x00\x4a\x0f\x14\x04\x00\x0f\x38\x04\x14\xf0\x0d\x53\x19\x1e\x01\x53\x1e\x23\x01"
+    "\x53\x14\x19\x01\x53\x23\x28\x01\x53\x28\x2d\x01\x53\x13\x01\x00\x00\x0f\x01\x42\x03\x00\x41\x00\x42\x0e\x01\x03\x00\x62\x00\x42"
+    "\x10\x01\x42\x10\x06\x00\x04\x03\x00\x0f\xf0\x00\x01\x0f\x01\x00\x29\x11\x14\x78\x00\x10\x47\x03\x00\x50\x00\x1b\x0e\x01\x47\x03"
+    "\x00\x63\x00\x1b\x10\x01\x47\x10\x06\x00\x12\xe3\x06\x00\x0f\x4b\x00\x10\x0f\x01\x00\x1a\xe0\x15\x01\x01\x01\x10\x01\x4d\x10\x01"
+    "\x0e\x11\x01\x4d\x0f\x03\x00\xf1\x01\x0e\x10\x01\x50\x10\x01\x0f\x12\x01\x0f\x11\x01\x50\x0f\x01\x50\x06\x00\x1f\x1b\x68\x01\x1a"
+    "\x1f\x01\x68\x01\x0f\xe0\x16\x01\x00\x01\x17\x01\x4d\x17\x01\x14\x19\x01\x4d\x18\x06\x00\xff\x05\x14\x19\x01\x15\x18\x00\x27\x19"
+    "\x00\x27\x18\x01\x16\x18\x01\x16\x1a\x01\x16\x19\xa0\x05\x2b\x0f\x58\x02\x01\xf0\x0b\x17\x01\x00\x00\x06\x01\x07\x06\x01\x25\x06"
+    "\x01\x22\x07\x01\x25\x07\x01\x22\x06\x01\x14\x07\x01\x14\x08\x06\x00\xaf\x07\x08\x01\x07\x07\x01\x2c\x08\x01\x2c\x78\x00\x01\x0f"
+    "\x01\x00\x29\xf1\x04\x18\x01\x00\x01\x0d\x01\x07\x0d\x01\x3b\x0e\x01\x07\x0e\x01\x3b\x0d\x00\xb7\x48\x03\x51\x39\x0d\x01\x39\x0e"
+    "\x03\x00\x4f\x0d\x01\x3a\x0d\x08\x07\x3f\xe0\x19\x01\x00\x01\x18\x01\x07\x18\x01\x35\x1a\x01\x07\x1a\x06\x00\x40\x08\x1a\x01\x36"
+    "\x39\x01\x01\x62\x01\x40\x1a\x01\x16\x1b\x0c\x00\x1f\x60\x78\x00\x01\x0f\x68\x01\x14\x13\x3e\x08\x07\xff\x23\x3e\x14\x19\x01\x3e"
+    "\x23\x28\x01\x3e\x28\x2d\x01\x3e\x1a\x01\x00\x01\x19\x01\x07\x19\x01\x08\x1b\x01\x07\x19\x00\x2b\x1b\x01\x08\x1a\x00\x2b\x1b\x00"
+    "\x2b\x18\x00\x2b\x19\x01\x65\x1a\x01\x65\x1b\x01\x65\x78\x00\x2c\x12\x19\x7c\x00\x09\x78\x00\x17\x1b\x78\x00\x72\x08\x19\x00\x2b"
+    "\x19\x00\xb7\x78\x00\xdf\x1b\x00\xb7\x19\x01\x67\x1b\x01\x67\x19\x01\x60\x19\x68\x01\x2a\x0f\xd0\x02\x02\x41\x1c\x01\x00\x01\x62"
+    "\x01\x81\x61\x1a\x01\x08\x1c\x01\x61\x1c\xf0\x00\x10\x1c\x03\x00\x12\x2c\x65\x01\x1f\x1c\x68\x01\x2d\x0f\xd0\x02\x02\x1f\x1d\x40"
+    "\x0b\x64\x1f\x1e\xf0\x00\x64\x1f\x1f\xf0\x00\x64\x1f\x20\x78\x00\x64\x1f\x21\x78\x00\x64\x1f\x22\x78\x00\x64\x1f\x23\x20\x0d\x64"
+    "\x1f\x24\x78\x00\x3b\x1f\x41\xf0\x00\x15\xf4\x11\x25\x01\x00\x01\x1e\x01\x68\x23\x01\x68\x19\x01\x68\x28\x01\x68\x14\x01\x68\x2d"
+    "\x01\x68\x0f\x01\x68\x32\x01\x68\x0a\x01\x68\x05\x06\x00\x0f\x78\x00\x14\x0f\x68\x01\x16\x1f\x26\xe0\x01\x64\x1f\x27\x78\x00\x5a"
+    "\x24\x00\x74\x78\x00\x1f\x28\x78\x00\x64\x1f\x29\x78\x00\x64\x1f\x2a\xc0\x12\x2a\xe0\x01\x6e\x14\x1e\x00\xaa\x1e\x23\x01\x6e\x1e"
+    "\x23\x01\x71\x04\x00\x0f\x37\x00\x10\x01\x01\x00\x1f\x2b\x78\x00\x64\xf0\x02\x2c\x01\x00\x00\x07\x00\x29\x08\x01\x28\x07\x01\x28"
+    "\x08\x00\x29\x09\x06\x00\xff\x04\x3f\x0a\x01\x28\x06\x01\x28\x07\x00\x4a\x08\x00\x4a\x06\x00\x4a\x09\x00\x4a\x4b\x00\x10\x0f\x01"
+    "\x00\x1a\x1f\x2d\x78\x00\x09\x52\x01\x30\x08\x01\x30\x06\x00\x0f\x4b\x00\x10\x0f\x01\x00\x1a\xf1\x05\x2e\x01\x00\x00\x09\x00\x29"
+    "\x0a\x01\x30\x09\x01\x30\x0b\x01\x30\x0a\x00\x29\x09\x78\x00\xff\x00\x0b\x01\x28\x0a\x01\x2e\x0a\x01\x2e\x09\x01\x2e\x0b\x01\x2e"
+    "\x4b\x00\x10\x0f\x01\x00\x1a\x70\x2f\x01\x01\x00\x0a\x00\x29\x72\x00\x60\x01\x30\x0b\x00\x29\x0c\x7b\x00\x21\x3f\x0a\x6c\x00\x11"
+    "\x0c\x78\x00\x02\x06\x00\x00\x30\x0c\x48\x0a\x14\x01\x2b\x34\x0c\x0f\x5f\x00\x10\x0f\x01\x00\x06\x40\x30\x02\x00\x00\x47\x0a\x00"
+    "\xd2\x09\xff\x0d\xcb\x1b\x00\xcb\x19\x00\xb1\x19\x00\x54\x19\x00\x2c\x1b\x00\xca\x19\x00\x19\x1b\x00\xca\x1b\x00\x19\x1d\x00\xca"
+    "\x4b\x00\x10\x0f\x01\x00\x1a\x4b\x31\x02\x00\x01\x78\x00\x1f\x1b\x78\x00\x15\x40\x14\x1e\x00\x36\x04\x00\x26\x1e\x23\x04\x00\x09"
+    "\x50\x0a\x11\x19\x08\x00\x71\x76\x19\x1e\x00\x76\x1e\x23\x04\x00\xf0\x08\x77\x23\x28\x00\x77\x19\x1e\x00\x77\x32\x02\x00\x01\x1b"
+    "\x00\x6f\x1b\x00\x2b\x1d\x00\x6f\x1d\x81\x00\x80\x54\x1d\x00\x2c\x1f\x00\x2c\x1d\x09\x00\xaf\x55\x1b\x00\x7f\x1f\x00\x55\x1d\x00"
+    "\x7f\x78\x00\x10\x5f\x37\x19\x28\x00\x37\x78\x00\x15\x71\x33\x02\x01\x00\x1b\x00\xe7\x78\x00\x11\xe7\x78\x00\x14\xb1\x78\x00\xd8"
+    "\xb1\x1d\x00\xb2\x1b\x00\xd6\x1f\x00\xb2\x1d\x00\xd6\x10\x0e\x6f\x14\x19\x00\x4a\x19\x1e\xe0\x01\x2b\x42\x36\x01\x00\x00\x32\x13"
+    "\x40\x05\x01\x1d\x06\x09\x00\xb0\x0a\x05\x01\x0c\x06\x01\x09\x06\x01\x1d\x05\x3e\x13\x7f\x1f\x06\x01\x14\x06\x01\x1f\x4b\x00\x10"
+    "\x0f\x01\x00\x1a\x11\x37\x10\x0e\x20\x25\x07\x10\x0e\x00\x03\x00\x01\x13\x0e\x5a\x25\x05\x01\x25\x08\x06\x00\x0f\x4b\x00\x10\x0f"
+    "\x01\x00\x1a\x1f\x38\x18\x06\x2c\x08\x04\x00\x4e\x1e\x23\x00\x49\x18\x06\x41\x00\x48\x19\x1e\x1c\x00\x01\x20\x00\xf4\x19\x19\x1e"
+    "\x00\x49\x14\x19\x00\x49\x39\x01\x00\x00\x18\x00\x64\x18\x00\x51\x19\x00\x64\x19\x00\x51\x17\x00\x64\x17\x00\x51\x1a\x00\x64\x1a"
+    "\x00\x51\x16\x00\x64\x16\x06\x00\x0f\x87\x00\x10\x0f\x01\x00\x1a\x1f\x3a\x78\x00\x0e\x6f\x1a\x00\x65\x1a\x00\x52\x4b\x00\x10\x0f"
+    "\x01\x00\x1a\xf2\x13\x3b\x01\x00\x01\x10\x00\x29\x11\x00\x29\x12\x00\x29\x0f\x00\x29\x0e\x00\x29\x10\x01\x51\x12\x01\x51\x0e\x01"
+    "\x51\x13\x00\x29\x14\x00\x29\x06\x00\x0f\x3c\x00\x01\xff\x05\x05\x23\x00\x29\x1e\x23\x00\x29\x19\x23\x01\x51\x0f\x19\x01\x51\x05"
+    "\x0f\x01\x51\x10\x0e\x15\xa0\x3c\x01\x00\x01\x21\x00\x2a\x23\x00\x2a\x06\x00\xf2\x05\x01\x51\x21\x01\x51\x25\x01\x51\x23\x00\x2a"
+    "\x27\x01\x51\x26\x00\x2a\x28\x00\x2a\x06\x00\x0f\x78\x00\x01\x40\x1e\x23\x00\x2a\x04\x00\x0f\x78\x00\x15\xd5\x1e\x23\x01\x54\x23"
+    "\x28\x01\x54\x28\x2d\x01\x54\x3d\x78\x00\xff\x00\x1e\x01\x73\x23\x01\x51\x23\x01\x73\x25\x01\x51\x19\x01\x73\x78\x00\x4c\x1f\x3e"
+    "\xf0\x00\x64\x00\x21\x1c\x10\x1b\x7f\x0e\xf4\x02\x61\x1a\x01\x61\x19\x01\x61\x1d\x01\x61\x18\x01\x61\x17\x01\x61\x16\x0c\x00\x02"
+    "\x06\x00\x0f\x78\x00\x01\x0f\x01\x00\x29\x1f\x41\x78\x00\x08\xcf\x1b\x01\x63\x1b\x01\x63\x19\x01\x63\x1d\x01\x63\x4b\x00\x10\x0f"
+    "\x01\x00\x1a\x12\x42\x78\x00\x40\x1b\x01\x33\x1c\x75\x00\xe1\x33\x1d\x01\x61\x1b\x00\x25\x1d\x00\x25\x19\x00\x25\x1b\x78\x0f\x11"
+    "\x1a\x7b\x0f\x0f\x4b\x00\x10\x0f\x01\x00\x1a\x41\x43\x01\x00\x00\x72\x00\x21\x61\x1b\xf3\x00\x11\x1e\xf6\x00\x10\x18\x02\x01\xdf"
+    "\x63\x1a\x01\x63\x1e\x01\x63\x1c\x01\x66\x1c\x01\x66\x4b\x00\x10\x0f\x01\x00\x1a\x10\x44\x68\x10\xf0\x06\x00\x29\x1a\x01\x6b\x1c"
+    "\x00\x29\x1c\x01\x6b\x1e\x00\x29\x1e\x01\x6b\x20\x00\x29\x20\x06\x00\x15\x2a\x06\x00\x0f\x3c\x00\x01\x03\x20\x05\x51\x29\x19\x1e"
+    "\x01\x6b\x04\x00\x3f\x23\x01\x6b\x68\x10\x15\x4e\x45\x01\x00\x00\x78\x00\x40\x1a\x01\x69\x20\x0c\x00\x50\x2a\x1c\x01\x69\x20\x63"
+    "\x03\x1f\x69\x78\x00\x01\x0f\x01\x00\x29\x10\x46\x10\x0e\xf0\x06\x00\x29\x1f\x00\x29\x20\x00\x29\x21\x00\x29\x1c\x00\x29\x1d\x00"
+    "\x29\x22\x00\x29\x23\x06\x00\x03\x60\x03\x1f\x24\x48\x03\x03\x04\xf0\x00\x00\xb4\x04\x04\x54\x03\x0f\xf0\x00\x15\xf2\x13\x47\x01"
+    "\x00\x00\x28\x00\x2a\x28\x01\x29\x28\x01\x31\x28\x01\x26\x24\x00\x29\x24\x01\x28\x26\x00\x2a\x26\x01\x29\x24\x01\x30\x24\x01\x25"
+    "\x06\x00\x0f\x78\x00\x01\x0f\x01\x00\x29\x38\x48\x01\x01\x78\x00\x12\x34\x72\x00\xc2\x2a\x00\x2a\x2a\x01\x29\x2a\x01\x31\x26\x01"
+    "\x33\x06\x00\xc4\x1e\x28\x00\x4b\x1e\x28\x00\x4a\x23\x28\x00\x4b\x04\x00\x0f\x5f\x00\x10\x0f\x01\x00\x06\x41\x49\x01\x00\x01\x78"
+    "\x00\x12\x2e\x78\x00\x01\x72\x00\xff\x04\x2e\x2c\x00\x2a\x2c\x01\x2e\x2a\x01\x31\x2a\x01\x34\x2c\x01\x31\x2c\x01\x34\x3c\x00\x01"
+    "\x01\xac\x04\x56\x1e\x00\x2a\x23\x28\x04\x00\x0f\xb0\x04\x15\x4f\x4a\x01\x00\x00\xe0\x01\x25\x0f\x01\x00\x29\x18\x4b\x78\x00\xa1"
+    "\x1e\x01\x2e\x20\x01\x2e\x22\x01\x2e\x21\x7b\x00\x0f\x78\x00\x49\x13\x4c\x50\x19\x31\x00\x58\x10\x53\x19\xa0\x0f\x01\x44\x0f\x00"
+    "\xda\x10\x00\x58\x10\x5f\x19\xaf\x44\x10\x01\x44\x0e\x00\x6d\x0e\x00\x6d\x4b\x00\x10\x0f\x01\x00\x1a\x20\x4d\x01\xdc\x18\x10\x42"
+    "\x03\x00\xf2\x08\x00\x42\x14\x01\x42\x14\x01\x45\x14\x00\x42\x15\x01\x45\x16\x00\x42\x16\x01\x42\x16\x01\x45\x06\x00\x0f\x4b\x00"
+    "\x10\x0f\x01\x00\x1a\xf4\x11\x4e\x01\x00\x00\x30\x01\x2e\x30\x00\x2a\x32\x00\x2a\x32\x01\x2e\x30\x01\x58\x30\x01\x62\x32\x01\x62"
+    "\x31\x01\x58\x2f\x01\x58\x32\x06\x00\x0f\x4b\x00\x10\x0f\x01\x00\x1a\xf1\x0b\x4f\x01\x00\x00\x33\x01\x2e\x33\x00\x2a\x35\x00\x2a"
+    "\x35\x01\x2e\x33\x01\x58\x33\x01\x62\x35\x01\x62\x34\x6f\x00\x14\x35\x06\x00\x0f\x4b\x00\x10\x0f\x01\x00\x1a\x20\x50\x01\xbc\x0b"
+    "\xff\x13\x2e\x36\x00\x2a\x38\x00\x2a\x38\x01\x2e\x36\x01\x58\x36\x01\x62\x38\x01\x62\x37\x01\x58\x38\x01\x58\x39\x01\x4e\x36\x01"
+    "\x4e\x3c\x01\x4e\x4b\x00\x10\x0f\x01\x00\x1a\x00",
+    2508, 9360);
+
+const Resource diamond(
+    "\x4f\x00\x00\x01\x00\x01\x00\x38\xf0\x01\x14\x1e\x00\x48\x14\x1e\x01\x16\x14\x28\x00\x49\x14\x28\x01\x17\x04\x00\xa6\x04\x06\x00"
+    "\x81\x03\x07\x00\x81\x05\x0a\x04\x00\x20\x0f\x14\x04\x00\x80\x01\xc8\x0a\x19\x00\x81\x0a\x19\x08\x00\xf0\x03\x01\xc8\x1e\x28\x00"
+    "\x82\x1e\x28\x01\xc9\x14\x28\x00\x78\x14\x32\x01\xc9\x04\x00\x1f\x01\x9f\x00\x3e\x90\x36\x14\x28\x00\x36\x1e\x28\x00\x37\x04\x00"
+    "\x4f\x14\x28\x00\x37\x9f\x00\x08\x13\x53\x9f\x00\x10\x53\x04\x00\x03\x9f\x00\x90\x54\x28\x37\x00\x82\x14\x32\x01\x54\x04\x00\x1f"
+    "\x02\x3e\x01\x69\x22\x00\xdf\x9f\x00\x01\x08\x00\x12\xdf\x9f\x00\x22\x00\xe0\x9f\x00\x20\x00\xe0\x04\x00\x1f\x03\x9f\x00\x3b\xc0"
+    "\x23\x2d\x00\x49\x23\x2d\x01\x17\x1e\x28\x01\xca\x04\x00\x4f\x23\x2d\x01\xca\x9f\x00\x1d\x02\xdd\x01\x02\x9f\x00\x1f\x04\x9f\x00"
+    "\x3c\xd0\x28\x01\x17\x23\x28\x00\x49\x28\x2d\x01\x17\x28\x2d\x08\x00\x2f\x00\x49\x9f\x00\x1e\x34\x1e\x01\x72\x9f\x00\xc1\x05\x01"
+    "\x00\x06\x00\x4a\x06\x00\x4a\x07\x00\x29\x03\x00\xf1\x02\x4a\x07\x00\x4a\x08\x00\x5f\x08\x00\x5f\x09\x00\x4a\x09\x00\x4a\x05\x03"
+    "\x00\x01\x02\x00\x13\x29\x02\x00\x02\x0e\x00\x0f\x02\x00\x03\x0f\x01\x00\x3c\x34\x06\x01\x00\x93\x00\x11\x29\x03\x00\x20\x4a\x08"
+    "\x96\x00\x81\x5f\x09\x00\x5f\x0a\x00\x4a\x0a\xba\x00\x1f\x06\x9f\x00\x67\xf0\x07\x07\x01\x01\x07\x01\xa2\x07\x01\xa1\x08\x01\xa2"
+    "\x08\x01\xa6\x08\x01\x8f\x07\x01\xa6\x09\x09\x00\x50\xa1\x09\x01\xa2\x09\x0c\x00\x00\x06\x00\x80\x01\x35\x01\x35\x01\xa2\x01\xa6"
+    "\x04\x00\x22\x00\xb3\x02\x00\x04\x10\x00\x01\x14\x00\x30\xef\x00\xef\x08\x00\x0f\x59\x04\x34\x50\x5a\x1e\x32\x01\xc9\x04\x00\xa0"
+    "\x08\x01\x00\x0a\x01\x09\x0a\x01\x0a\x0b\x06\x00\xd1\x96\x0a\x01\xab\x0b\x01\x96\x0b\x01\xab\x0c\x01\x96\x03\x00\xf3\x06\xab\x0c"
+    "\x01\x0b\x0c\x01\x0b\x01\x1f\x01\x1f\x01\x09\x01\x96\x00\xc6\x00\xc6\x01\x22\x02\x00\xff\x04\x11\x01\x11\x01\x96\x01\xab\x00\xcc"
+    "\x00\xcc\x00\x0b\x00\x0b\x00\x0e\x00\x0e\x11\x01\x10\x0f\x01\x00\x1a\xf2\x12\x09\x01\x01\x1d\x01\xa3\x1c\x01\xa6\x1c\x01\x93\x1d"
+    "\x01\x16\x1d\x01\x94\x1d\x01\xa7\x1d\x01\xa1\x1d\x01\xa1\x1e\x01\xa3\x1e\x01\xa7\x06\x00\x81\x00\x51\x00\x51\x01\x93\x01\x16\x04"
+    "\x00\x13\x30\x02\x00\x3c\xa3\x01\xa7\x04\x00\x0f\x3e\x01\x35\x04\x97\x05\xf2\x12\x0a\x01\x01\x0f\x00\x42\x0f\x00\x4a\x0e\x00\xad"
+    "\x0e\x00\xad\x0f\x01\x33\x0f\x00\x29\x0f\x01\xb1\x0f\x01\xb1\x10\x00\x42\x0e\x00\xad\x06\x00\x23\x00\x42\x7e\x02\x91\x4a\x00\x29"
+    "\x01\x33\x00\x29\x00\x42\x14\x00\x0d\x04\x00\xc0\x14\x1e\x00\x29\x14\x28\x00\x29\x1e\x28\x00\x2a\x04\x00\x4f\x14\x28\x00\x2a\x97"
+    "\x05\x29\xf0\x20\x0b\x01\x00\x26\x01\xb5\x24\x00\x4b\x25\x00\x43\x24\x00\x23\x25\x01\x34\x25\x00\x2a\x25\x01\xb1\x26\x01\xb1\x24"
+    "\x01\xb4\x25\x00\x23\x24\x01\xb4\x26\x00\x23\x01\xb5\x00\x4b\x00\x43\x00\x23\x04\x00\xf1\x01\x01\x34\x00\x2a\x01\xb4\x00\x23\x01"
+    "\x52\x01\x52\x01\x51\x01\x51\x0c\x00\x03\x04\x00\x0f\xb0\x01\x10\x0f\x01\x00\x1a\x1f\x0c\x9f\x00\x8b\x10\x0d\x9f\x00\xf0\x0b\xcb"
+    "\x28\x01\xcc\x27\x01\x34\x27\x00\x43\x28\x01\x34\x28\x00\x43\x27\x01\xb1\x28\x01\xb1\x27\x01\xb5\x26\x68\x05\xf3\x03\xb5\x27\x00"
+    "\x23\x01\xcb\x01\xcc\x01\x34\x00\x43\x00\x2a\x00\xa4\x01\x26\x02\x00\x04\x9f\x00\x11\xb5\xbf\x00\x01\x04\x00\x0f\x72\x00\x10\x0f"
+    "\x01\x00\x1a\x40\x0e\x01\x01\x28\x87\x00\x71\x4b\x27\x00\x43\x26\x00\x23\xa5\x00\x12\x2a\x9f\x00\x11\x26\x99\x00\x4f\x27\x01\xb5"
+    "\x28\x3e\x01\x00\x00\x8f\x00\x0f\x9f\x00\x00\x0f\x7c\x02\x2d\x40\x0f\x14\x00\x93\x7c\x02\xbe\x0f\x23\x00\x94\x0f\x28\x00\x94\x0f"
+    "\x01\x00\x9f\x00\x10\x28\x9f\x00\x1f\x66\x9f\x00\x21\x0f\x11\x01\x10\x0f\x01\x00\x1a\x20\x10\x01\x6c\x00\xf0\x0a\x28\x00\x4b\x29"
+    "\x00\x43\x28\x00\x23\x29\x01\x34\x29\x00\x2a\x29\x01\x66\x2a\x01\x66\x28\x01\xb5\x29\x12\x00\x2f\xb5\x2a\x9f\x00\x67\x1f\x11\x9f"
+    "\x00\x8b\x40\x12\x01\x00\x28\xda\x01\x21\x4b\x28\xdd\x01\x11\x28\xdd\x01\x11\x26\x7c\x02\x02\x15\x03\x02\xdd\x01\x2f\x00\x4b\x9f"
+    "\x00\x63\xf0\x0d\x13\x01\x00\x1f\x01\x33\x1f\x00\x4b\x1e\x00\x23\x20\x00\x2a\x1f\x00\x43\x1f\x00\x2a\x1e\x01\xb1\x1e\x01\xb1\x20"
+    "\x18\x00\xf1\x00\x23\x20\x01\x33\x20\x00\x23\x01\x33\x00\x4b\x00\x23\x00\x2a\x04\x00\x51\x43\x00\x2a\x01\x33\x14\x00\x0d\x04\x00"
+    "\x0f\x72\x00\x10\x0f\x01\x00\x1a\xf2\x12\x14\x01\x00\x0d\x01\x33\x0d\x00\x4a\x0c\x00\xad\x0c\x00\xad\x0d\x00\x42\x0d\x00\x29\x0d"
+    "\x01\xb1\x0d\x01\xb1\x0e\x01\x33\x0c\x00\xad\x06\x00\x26\x01\x33\x36\x06\x21\x00\x42\x3a\x06\x00\x14\x00\x10\xad\x02\x00\x04\x0c"
+    "\x00\x01\x10\x00\x0f\x01\x00\x3c\x3f\x15\x01\x01\x3e\x01\x39\x0f\xd5\x06\x3d\xf0\x0a\x16\x01\x01\x18\x00\xc2\x19\x01\x90\x18\x01"
+    "\x96\x1a\x01\x8c\x19\x00\xb7\x19\x00\xc3\x1a\x00\xb7\x1a\x06\x00\xf7\x11\x36\x18\x00\x36\x1a\x01\x8f\x18\x01\x2a\x00\xc2\x01\x90"
+    "\x01\x96\x01\x8c\x00\xa3\x00\xa4\x00\xb7\x00\xc3\x01\x8f\x01\x2a\x00\x36\x02\x00\x30\x18\x00\x18\x08\x00\xc0\x14\x1e\x00\xc2\x14"
+    "\x1e\x00\xb7\x14\x28\x00\xc3\x13\x0d\x00\x04\x00\x0f\x9f\x00\x0d\x40\x0f\x1e\x00\x82\x04\x00\x81\x1e\x37\x01\x54\x0f\x14\x01\x3e"
+    "\xf8\x04\x30\x1e\x01\x3e\x04\x00\x1f\x17\x9f\x00\x8b\xf0\x0a\x18\x01\x01\x16\x00\xc2\x17\x01\x90\x16\x01\x96\x18\x01\x8c\x17\x00"
+    "\xb7\x17\x00\xc3\x18\x00\xb7\x18\x06\x00\x89\x36\x16\x00\x36\x18\x01\x8f\x16\x9f\x00\x1f\xa3\x9f\x00\x59\x1f\x19\x9f\x00\x8b\xf2"
+    "\x12\x1a\x01\x00\x14\x00\xc2\x15\x01\x90\x14\x01\x96\x16\x01\x8c\x15\x00\xb7\x15\x00\xc3\x16\x00\xb7\x16\x00\xc3\x16\x01\x8f\x14"
+    "\x01\x2a\x06\x00\x0f\x9f\x00\x01\x08\x04\x00\x00\x9f\x00\x01\x08\x00\x0f\x01\x00\x3c\x3f\x1b\x01\x01\x9f\x00\x06\x5f\x00\x36\x14"
+    "\x00\x36\x9f\x00\x07\x0f\x3e\x01\x51\xff\x18\x1c\x01\x00\x13\x00\xc9\x14\x00\xc9\x12\x00\xc9\x15\x00\xc9\x11\x00\xc9\x16\x00\xc9"
+    "\x10\x00\xc9\x17\x00\xc9\x0f\x00\xc9\x18\x00\xc9\x0e\x00\xc9\x19\x00\xc9\x02\x00\x16\x0f\x01\x00\x3c\xf0\x07\x1d\x01\x00\x2d\x00"
+    "\x43\x2d\x00\x4b\x2d\x01\x34\x2d\x00\x2a\x2c\x00\x5f\x2e\x00\xd0\x2e\x09\x00\xb1\x2a\x2e\x00\x43\x2e\x01\x34\x2c\x00\x43\x2c\xea"
+    "\x09\x11\x4b\xcd\x06\x90\x34\x00\x2a\x00\x5f\x00\xd0\x00\x43\x14\x00\x0f\x04\x00\x00\x0f\x01\x00\x3c\xf0\x07\x1e\x01\x00\x2e\x00"
+    "\x40\x2e\x00\x4b\x2e\x01\x34\x2e\x00\x2a\x2d\x00\x5f\x2f\x00\xd0\x2f\x09\x00\x50\x2a\x2f\x00\x40\x2f\xb4\x00\x6b\x40\x2d\x01\x34"
+    "\x00\x40\x9f\x00\x10\x40\x14\x00\x0f\x04\x00\x00\x0f\x01\x00\x3c\x30\x1f\x01\x01\x3e\x01\x23\x01\xa3\x3e\x01\x2f\x01\xa3\x3e\x01"
+    "\x04\x24\x01\xa3\x9f\x00\x2f\x01\xa3\x3e\x01\x07\x40\x23\x2d\x00\x2a\x04\x00\x26\x28\x32\x04\x00\x0f\xc5\x10\x08\x00\xc1\x10\x05"
+    "\x04\x00\x03\xc5\x10\x13\x82\x03\x12\x01\x04\x00\xff\x16\x20\x01\x01\x33\x00\x43\x33\x01\xa3\x33\x01\x34\x33\x00\x2a\x32\x01\xa3"
+    "\x34\x00\xd0\x34\x00\x2a\x32\x00\x2a\x34\x00\x43\x34\x01\x34\x32\x00\x43\x32\x9f\x00\x17\x00\x8f\x00\x21\x2d\x37\x97\x00\x9f\x83"
+    "\x2d\x37\x00\x83\x32\x3c\x00\x83\x9f\x00\x29\x30\x21\x01\x00\x9f\x00\x23\x00\x4b\x9f\x00\x2f\x00\x5f\x9f\x00\x04\x0f\x7c\x02\x63"
+    "\x1f\x22\x9f\x00\x8b\x92\x23\x01\x01\x04\x00\x29\x04\x00\x29\x8a\x12\x10\x05\x09\x00\x27\x29\x06\x03\x00\x69\x05\x00\x36\x05\x00"
+    "\x36\xfb\x11\x00\x0c\x00\x00\xec\x04\x04\x13\x12\x07\x02\x00\x01\xb2\x08\x02\x22\x15\x00\xae\x08\x0f\x1e\x15\x2e\x32\x24\x01\x00"
+    "\x99\x00\x04\x90\x00\x02\x4d\x13\x02\xb4\x12\x00\x03\x00\x11\x04\x03\x00\x0f\xa2\x12\x65\x34\x25\x01\x01\x3b\x13\x11\x36\xd1\x13"
+    "\x21\x36\x09\x0c\x00\x10\x0a\x03\x00\x15\x29\x03\x00\x03\x32\x01\x13\x4a\x04\x00\x0f\x38\x01\x00\x0f\x3e\x01\x43\xf3\x26\x26\x01"
+    "\x00\x37\x01\x43\x37\x00\x70\x36\x00\x16\x36\x00\x4b\x37\x00\x16\x37\x00\x6e\x38\x00\xe3\x38\x00\x4b\x16\x01\x42\x16\x00\x6f\x18"
+    "\x01\x42\x18\x00\x6f\x01\x43\x00\x70\x00\x16\x00\x4b\x01\x62\x00\x2a\x01\x44\x02\x00\x30\x42\x00\x6f\x04\x00\x41\x00\xcf\x00\xcf"
+    "\x08\x00\x3f\xf0\x00\xf0\x11\x01\x10\x0f\x01\x00\x1a\x40\x27\x01\x00\x37\x96\x00\xf2\x14\xdb\x36\x00\x2a\x38\x00\x43\x38\x00\xdb"
+    "\x38\x00\x6e\x36\x00\x5f\x38\x01\x43\x19\x00\x4a\x19\x00\xda\x1b\x00\x4a\x1b\x00\xda\x00\x4b\x00\xdb\x28\x0b\xad\x00\x43\x00\xdb"
+    "\x00\x6e\x00\x4a\x00\xda\x04\x00\x0f\x9f\x00\x40\x70\x28\x01\x00\x39\x00\x4b\x39\x96\x00\x80\x2a\x3a\x00\x43\x3a\x00\xdb\x3a\x3e"
+    "\x01\x42\x5f\x3a\x01\x43\x99\x00\x4f\x1d\x00\x4a\x1d\x9f\x00\x67\xf2\x12\x29\x01\x01\x35\x01\x90\x36\x01\x90\x35\x01\x8d\x36\x01"
+    "\x8d\x35\x00\x37\x36\x00\x37\x34\x01\x66\x36\x01\x66\x34\x01\x90\x34\x01\x8d\x06\x00\xf1\x01\x01\x90\x01\x90\x01\x8d\x01\x8d\x00"
+    "\xa4\x00\xa4\x00\x37\x00\x37\x0e\x00\x04\x49\x0e\x00\x0c\x00\x03\x04\x00\x40\x28\x32\x00\x37\x04\x00\x26\x2d\x37\x04\x00\x5f\x03"
+    "\x06\x00\x81\x04\x97\x05\x03\x13\x76\x93\x05\x00\x08\x00\x13\x76\x97\x05\x13\x77\x97\x05\x10\x77\x04\x00\x10\x2a\x13\x08\x80\x2a"
+    "\x2e\x01\xb5\x2d\x00\x5d\x2e\xc9\x06\x70\x5d\x2d\x01\xb5\x2c\x00\x5d\x03\x00\x52\x01\xb4\x2e\x01\xb5\x06\x00\x01\xda\x0e\x32\x5d"
+    "\x00\x2a\x04\x00\x66\x01\xb5\x01\xb4\x01\xb5\xa2\x12\x03\x10\x00\x3f\xb4\x01\xb5\x11\x01\x10\x0f\x01\x00\x1a\x10\x2b\x7c\x02\x80"
+    "\x2a\x38\x01\xb5\x37\x00\x5d\x38\x7f\x02\x70\x5d\x37\x01\xb5\x36\x00\x5d\x03\x00\x52\x01\xb4\x38\x01\xb5\x06\x00\x0f\x9f\x00\x65"
+    "\xf0\x09\x2c\x01\x00\x41\x00\x2a\x42\x01\xb5\x41\x00\x5d\x42\x00\x2a\x42\x00\x5d\x41\x01\xb5\x40\x00\x5d\x03\x00\x52\x01\xb4\x42"
+    "\x01\xb5\x06\x00\x0f\x9f\x00\x65\x10\x2d\xd5\x06\x80\x2a\x33\x00\xd7\x34\x00\x4b\x34\xc9\x06\x50\xd7\x33\x00\x5f\x32\x0f\x00\x20"
+    "\xd0\x34\x09\x00\x00\xe7\x06\xb1\x32\x00\x2a\x00\x2a\x00\xd7\x00\x4b\x00\x2a\x04\x00\x51\xd7\x00\x5f\x00\x5f\xdd\x06\x0e\x04\x00"
+    "\x0f\x01\x00\x3c\xf0\x04\x2e\x01\x00\x35\x00\x2a\x35\x00\xd7\x36\x00\x4b\x36\x00\x2a\x36\x00\xd7\x35\x99\x00\x50\xd7\x36\x00\xd0"
+    "\x35\x80\x07\x21\x2a\x34\x06\x00\x0b\x9f\x00\x1f\xd0\x9f\x00\x55\x1f\x2f\x9f\x00\x8b\x1f\x30\x9f\x00\x8b\x11\x31\xba\x03\x61\x37"
+    "\x00\xd7\x38\x00\x4b\xba\x03\x50\xd7\x37\x00\xd0\x36\x0f\x00\x20\xd0\x36\x03\x00\x12\x2a\x06\x00\x0d\x9f\x00\x3f\xd0\x00\x2a\x04"
+    "\x00\x02\x0f\x01\x00\x3c\x1f\x32\x9f\x00\x8b\xc1\x33\x01\x00\x0e\x01\xb4\x0e\x00\x29\x0f\x00\x4a\x71\x19\xf2\x01\xb4\x0f\x00\x29"
+    "\x10\x01\xb4\x0e\x01\xb4\x10\x00\x4a\x10\x00\x29\x06\x00\x23\x01\xb4\x3d\x13\x00\x77\x19\x07\x0c\x00\x09\x04\x00\x3f\x1b\x00\x1b"
+    "\x72\x00\x10\x0f\x01\x00\x1a\x33\x34\x01\x00\x93\x00\x02\x8d\x00\xf1\x03\x01\xb4\x0f\x01\xbb\x0f\x01\xb4\x11\x01\xb4\x10\x01\xbb"
+    "\x11\x00\x29\x11\x06\x00\x0a\x9f\x00\x6c\x01\xbb\x01\xbb\x00\x29\x04\x00\x0f\x9f\x00\x41\x6f\x35\x01\x00\x16\x00\x4a\x03\x00\x06"
+    "\x8e\x01\xc1\x16\x00\x4a\x17\x01\xc1\x79\x0a\x00\x14\x00\x0f\x04\x00\x00\x0f\x01\x00\x3c\x6e\x36\x01\x00\x17\x00\x4a\x03\x00\x30"
+    "\x16\x01\xc1\x09\x00\x01\x06\x00\x1f\x18\x9f\x00\x67\x68\x37\x01\x00\x18\x00\x4a\x03\x00\x41\x16\x01\xc1\x18\x99\x00\x00\x0f\x00"
+    "\x01\x06\x00\x1c\x19\x9f\x00\x0f\x9b\x00\x04\x0f\x9f\x00\x40\xf8\x0c\x38\x01\x00\x11\x01\x8d\x10\x01\x3b\x10\x00\xac\x10\x00\xac"
+    "\x11\x01\x3b\x11\x01\x92\x12\x00\x19\x10\x00\xac\x06\x00\x40\x01\x8d\x01\x3b\x51\x09\xcf\x01\x92\x01\x92\x01\x3b\x01\x92\x00\x19"
+    "\x00\xac\x04\x00\x02\x0f\x01\x00\x3c\x1f\x39\x67\x23\x82\x14\xd3\xd0\x1d\x61\x3a\x01\x00\x1e\x00\x4a\xfb\x16\xf2\x07\x29\x1f\x00"
+    "\x2a\x1d\x00\x4a\x20\x00\x4b\x20\x00\x5f\x21\x00\x5f\x1f\x00\x4a\x21\x00\x4b\x06\x00\x81\x00\x4a\x00\x4b\x00\x29\x00\x2a\x04\x00"
+    "\x00\x0c\x00\x0f\x04\x00\x05\x0f\x01\x00\x3c\x10\x3b\x9f\x00\x11\x4b\x9f\x00\x11\x2a\x9f\x00\x17\x4b\x9f\x00\x16\x4b\x9f\x00\x00"
+    "\x02\x00\x00\x9d\x05\x00\x02\x00\x00\x0c\x00\xb3\x4a\x00\x4b\x01\x2f\x01\x2f\x01\x2e\x01\x2e\x1e\x00\x02\x02\x00\x0f\x01\x00\x3c"
+    "\x13\x3c\x9f\x00\x1f\x5f\x9f\x00\x0e\x00\x52\x07\x0f\x9f\x00\x5e\x41\x3d\x01\x00\x1f\x90\x00\x70\x1f\x00\x2a\x20\x00\x2a\x1e\x93"
+    "\x00\xb0\x5f\x21\x00\xd0\x22\x00\xd0\x20\x00\x4b\x22\x1b\x00\x2d\x4a\x22\x9f\x00\x1f\x5f\x9f\x00\x55\x1f\x3e\x9f\x00\x8b\xa1\x3f"
+    "\x01\x00\x0c\x00\x5c\x0c\x00\x5c\x0e\x03\x00\x17\x0d\x03\x00\x11\x10\x03\x00\x11\x0f\x03\x00\x0f\x02\x00\x02\x1f\x5d\x02\x00\x00"
+    "\x0f\x01\x00\x3c\x1f\x40\x9f\x00\x28\x3d\x5e\x00\x5d\x04\x00\x0f\x01\x00\x3c\xd4\x41\x01\x01\x02\x01\x8c\x02\x01\x8f\x03\x01\x8c"
+    "\x03\x06\x00\x4a\x04\x01\x8c\x04\x06\x00\x80\x01\x1b\x01\x1b\x01\x8c\x01\x8f\x02\x00\x22\x00\xca\x02\x00\x0f\xe8\x0e\x01\x0f\xc0"
+    "\x27\x01\x0f\xe8\x0e\x29\xf0\x07\x42\x01\x01\x22\x01\x90\x24\x01\x90\x22\x01\x8d\x24\x01\x8d\x23\x00\x36\x24\x00\x36\x23\x87\x21"
+    "\x72\xb1\x23\x01\x90\x23\x01\x8d\x06\x00\x45\x00\x6c\x00\x6c\x87\x0f\x0f\x9f\x00\x58\x30\x43\x01\x01\x81\x00\x20\x00\xd7\xa5\x00"
+    "\x91\x00\x36\x22\x00\x36\x23\x00\x36\x22\x9f\x00\x01\x12\x00\x02\x18\x00\x9f\xd7\x00\xee\x00\xee\x01\x90\x00\x36\x9f\x00\x01\x80"
+    "\x00\xd9\x00\xd9\x01\x90\x00\xd7\x04\x00\x0f\x9f\x00\x3d\xf0\x0d\x44\x01\x00\x15\x00\xcb\x14\x00\x4a\x15\x01\x8d\x15\x00\x4b\x15"
+    "\x01\x90\x16\x00\xcb\x16\x01\x92\x16\x01\x8d\x16\x0c\x00\x12\x4b\x06\x00\x80\x00\xcb\x00\x4a\x01\x8d\x00\x4b\x74\x07\xcc\x00\x1e"
+    "\x00\x1e\x00\x21\x00\x21\x01\x90\x00\x4b\x04\x00\x0f\x4f\x02\x10\x0f\x01\x00\x1a\xf0\x04\x45\x01\x00\x22\x01\xcb\x22\x00\xd7\x23"
+    "\x01\x33\x23\x00\x43\x23\x01\x34\x24\x06\x00\x75\xcb\x23\x00\xd7\x24\x01\x34\x03\x00\x40\x01\xcb\x00\xd7\x24\x17\x63\x00\x29\x00"
+    "\xa4\x01\x69\x02\x00\x12\x34\x02\x00\x45\x00\xd8\x00\xd8\x0c\x00\x0f\x01\x00\x3c\x3e\x46\x01\x00\x1b\x03\x02\x06\x00\x02\x18\x00"
+    "\x02\x06\x00\x45\x00\x54\x00\x54\x1b\x03\x96\x1d\x00\x1d\x00\x20\x00\x20\x01\x8c\x02\x00\x41\x00\x3a\x00\x3a\x08\x00\x0f\x01\x00"
+    "\x3c\x62\x47\x01\x00\x03\x01\x93\xae\x03\x40\x03\x01\x91\x03\xa8\x03\x12\x93\xae\x03\x08\x9f\x00\x41\x01\x07\x01\x07\x89\x00\x52"
+    "\x91\x01\x91\x00\xa1\x02\x00\x01\xaf\x00\x03\x04\x00\x03\x9f\x00\x1f\x8f\x72\x00\x10\x0f\x01\x00\x1a\x31\x48\x01\x01\x8d\x00\x20"
+    "\x93\x05\x06\x00\xb1\x91\x04\x01\x8f\x05\x00\x3f\x04\x00\x3f\x05\x12\x00\xd1\x05\x01\x8f\x06\x01\x8c\x06\x01\x8f\x00\x68\x00\x68"
+    "\x1e\x01\x51\x29\x01\x91\x01\x18\x02\x00\x11\x19\xc0\x27\x30\x0e\x01\x0e\xc0\x27\x04\xa7\x00\x0f\x19\x2c\x1b\x0f\x1b\x03\x0f\x13"
+    "\x49\x9f\x00\x41\x8f\x04\x01\x96\x9f\x00\x11\x96\xab\x00\x42\x96\x05\x01\x93\x99\x00\x02\x06\x00\x01\x7f\x00\x00\x92\x1c\x0f\x9f"
+    "\x00\x04\x8f\x00\x0a\x00\x0a\x00\x0d\x00\x0d\x9f\x00\x3d\x34\x4a\x01\x01\x87\x00\x41\x96\x06\x01\x91\x06\x00\xd2\x93\x07\x01\x96"
+    "\x07\x01\x93\x08\x01\x8c\x08\x01\x8f\x06\x00\x08\x9f\x00\x22\x00\xbf\x02\x00\x0f\x3e\x01\x51\x32\x4b\x01\x01\x36\x2a\x04\x2a\x2a"
+    "\x11\x8f\x06\x00\xa2\xa1\x09\x01\xa1\x0a\x01\xa2\x0a\x01\xa6\x06\x00\x09\x28\x2a\x12\xbb\x02\x00\x0f\x3c\x2a\x49\x04\x2e\x0b\x31"
+    "\x4c\x01\x01\x81\x00\x50\x8f\x0b\x01\xa2\x0b\x06\x00\x11\xa6\x06\x00\xa2\xa1\x0b\x01\xa1\x0c\x01\xa2\x0c\x01\x8f\x06\x00\x26\x01"
+    "\xa2\x04\x00\x01\x9d\x00\x31\xbc\x00\xbc\x10\x00\x38\x0e\x01\x0e\x1c\x00\x0f\x95\x2e\x3d\xa0\x4d\x01\x00\x0e\x00\x4d\x0e\x01\xb2"
+    "\x0f\x06\x00\x70\x91\x0e\x00\x4a\x0f\x01\x92\x99\x0f\x00\x9c\x0f\xf2\x09\x4d\x0f\x01\xb2\x10\x00\x4d\x10\x01\xb2\x01\x2b\x01\x2b"
+    "\x00\x4d\x00\x4d\x00\x29\x01\x92\x01\x57\x02\x00\x41\x00\x4d\x01\xb2\x04\x00\x35\xcf\x00\xcf\x0c\x00\x0f\x01\x00\x3c\x10\x4e\x16"
+    "\x1a\x11\x42\x16\x1a\x10\x42\x7c\x02\x07\x16\x1a\x35\x07\x00\x42\x06\x00\x61\x00\xe7\x00\xe7\x00\x42\x00\x24\x33\x91\x00\xf6\x02"
+    "\x00\x00\x50\x2a\x00\x04\x00\x00\x9f\x00\x04\x0c\x00\x0f\x01\x00\x3c\xf4\x10\x4f\x01\x01\x10\x00\x36\x10\x01\x8f\x10\x01\x33\x10"
+    "\x00\x42\x11\x01\x33\x11\x00\x42\x11\x00\x36\x11\x01\x90\x12\x00\x36\x12\x06\x00\x60\x00\xce\x00\xce\x01\x33\x9f\x00\x42\x00\x29"
+    "\x00\xec\x02\x00\xa0\x01\x4f\x01\x4f\x01\x50\x01\x50\x00\x36\x8e\x07\x02\x04\x00\x0f\xdd\x01\x3d\xf0\x06\x50\x01\x01\x10\x01\x8c"
+    "\x10\x01\x90\x10\x01\xb7\x10\x01\xb7\x11\x01\x90\x11\x01\x8d\x96\x00\x50\x01\x8d\x10\x00\x71\x15\x00\x01\x06\x00\x40\x00\xd1\x00"
+    "\xd1\x94\x08\xf9\x01\x00\x5c\x00\x29\x00\x80\x00\x80\x00\xf1\x00\xf1\x00\x71\x01\xb7\x04\x00\x3f\x25\x00\x25\xba\x03\x3d\x31\x51"
+    "\x01\x00\x77\x0a\x40\x29\x11\x00\x5c\xf1\x11\x01\x06\x00\x4a\x12\x00\x5c\x12\x06\x00\x01\x97\x00\x00\x04\x00\x35\xc6\x00\xc6\x0c"
+    "\x00\x0f\x04\x00\x01\x0f\x01\x00\x3c\x3e\x52\x01\x00\x93\x00\x4a\x13\x00\x5c\x13\x06\x00\x0f\x9f\x00\x65\x3e\x53\x01\x00\x93\x00"
+    "\x47\x14\x00\x5c\x14\x06\x00\x3f\x13\x00\x2a\x9f\x00\x00\x06\x14\x00\x0f\x9f\x00\x48\x10\x54\xc8\x22\x0c\x93\x00\x41\x15\x00\x5c"
+    "\x15\x06\x00\x31\x14\x00\x2a\x0c\x00\x0f\x9f\x00\x05\x0e\x04\x00\x0f\x01\x00\x3c\x10\x55\xa5\x24\x09\x93\x00\x41\x15\x00\x29\x16"
+    "\x93\x00\x41\x16\x00\x5c\x16\x06\x00\x1f\x17\x9f\x00\x67\x10\x56\x3e\x01\xe0\x4d\x13\x00\x4a\x12\x01\xb7\x12\x01\xb7\x13\x00\x4a"
+    "\x13\xa2\x12\xb1\x4d\x14\x00\x4d\x12\x00\x71\x14\x01\xb7\x14\x06\x00\x40\x00\x4d\x00\x4a\x97\x05\x01\x2e\x0b\x03\xba\x03\x41\x01"
+    "\x11\x01\x12\xb2\x03\x00\x13\x08\x04\xbe\x03\x0f\x01\x00\x3c\x40\x57\x01\x01\x19\x67\x26\xf1\x01\x90\x18\x01\x33\x19\x00\x42\x19"
+    "\x01\x33\x1a\x00\x42\x1a\x00\x43\x09\x00\x24\x43\x1a\x06\x00\x00\xd4\x04\x01\xf8\x04\x53\xa3\x00\xa4\x01\x60\x02\x00\x04\xf8\x04"
+    "\x10\x43\x48\x0b\x02\x04\x00\x0f\xf8\x04\x3d\x12\x58\x3c\x2a\x00\x5c\x07\xa2\x33\x0e\x01\x8f\x0d\x00\x4a\x0d\x00\x4d\x3c\x2a\x30"
+    "\x0c\x01\x8f\x39\x2a\x01\x06\x00\x40\x01\x33\x01\x8f\x04\x00\x45\x00\x29\x00\xa3\x97\x05\x01\x12\x00\x21\x01\x33\xcd\x0b\x04\x0c"
+    "\x00\x0f\x01\x00\x3c\xf0\x0a\x59\x01\x00\x1b\x01\x33\x1b\x00\x4b\x1a\x00\x4d\x1c\x00\x43\x1b\x00\x43\x1c\x01\x33\x1b\x01\xb1\x1c"
+    "\x03\x00\xa1\x33\x1b\x00\x4d\x1c\x01\x33\x1c\x00\x4d\x3c\x2a\x13\x4d\x6c\x0c\x13\x4d\x02\x00\x11\x33\x18\x00\x11\x4d\x9f\x00\x04"
+    "\x0c\x00\x0f\x01\x00\x3c\x13\x5a\x36\x06\x70\x96\x11\x01\x8d\x11\x01\x92\x27\x15\x00\x0c\x00\x21\x3b\x12\x0f\x00\x00\x2a\x15\x01"
+    "\x03\x00\x44\x01\x8c\x01\x96\x1e\x15\x22\x00\xeb\x02\x00\x01\x2a\x15\x0b\x02\x00\x0f\x36\x06\x3d\xd0\x5b\x01\x01\x12\x00\xc2\x12"
+    "\x01\x90\x13\x01\x3b\x13\xcc\x06\xb0\x92\x12\x01\x3b\x14\x01\x3b\x12\x00\xc2\x14\x71\x07\x03\x06\x00\x01\xc0\x27\x31\x3b\x01\x90"
+    "\x9f\x00\x12\x58\x02\x00\x80\x01\x90\x00\xc2\x01\x0f\x01\x0e\x08\x00\x40\x00\x17\x00\x17\x08\x00\x01\xc0\x27\x70\x28\x00\xc2\x1e"
+    "\x28\x00\xc3\x04\x00\x00\xc8\x27\x0f\x7c\x02\x29\xa0\x5c\x01\x01\x14\x01\xa2\x14\x01\xa6\x15\x06\x00\xd8\x16\x15\x01\xa6\x14\x01"
+    "\x16\x16\x01\xa3\x16\x01\xa6\x06\x00\x81\x01\x67\x01\x67\x01\xa2\x01\x16\x7f\x0a\x13\x15\x02\x00\x3c\xa3\x01\xa6\x04\x00\x0f\xe6"
+    "\x37\x33\x24\x01\x3f\xa8\x36\x60\x5d\x01\x01\x17\x00\x4d\xbd\x18\xf0\x03\x00\x4d\x17\x00\x4b\x17\x01\xb2\x18\x00\xcb\x18\x01\x92"
+    "\x18\x00\x4d\x18\x0c\x00\x12\x4b\x06\x00\x62\x01\x45\x01\x45\x00\x4d\x87\x0f\x23\x01\x06\x02\x00\x30\xb2\x00\x4b\x04\x00\x01\x29"
+    "\x22\x00\x08\x00\x0f\x13\x08\x40\x10\x5e\x26\x10\x20\x4d\x14\x65\x19\xf1\x01\x4d\x15\x00\x4a\x14\x00\x3f\x14\x01\x92\x14\x00\x40"
+    "\x15\x00\x40\x7a\x19\x03\x06\x00\x44\x00\x60\x00\x60\xf8\x04\x04\x9f\x00\x41\x00\x4a\x00\x40\x04\x00\x00\xf0\x09\x04\x0c\x00\x0f"
+    "\x01\x00\x3c\xf1\x0d\x5f\x01\x00\x20\x01\xcb\x20\x00\xd7\x21\x01\x33\x21\x00\x43\x22\x01\x33\x22\x00\x43\x21\x01\xcb\x21\x00\xd7"
+    "\x21\x7f\x14\x02\x06\x00\x4c\x00\xe1\x00\xe1\x26\x10\x05\x73\x14\x3f\xd9\x00\xd9\x7f\x14\x45\x1f\x60\xc5\x10\x13\x4f\x00\xdc\x00"
+    "\xdc\xc5\x10\x06\x00\x03\x12\x0f\xc5\x10\x44\x41\x61\x01\x01\x1c\xa8\x36\x01\xae\x36\xf0\x01\xa7\x1d\x00\x7a\x1d\x01\x16\x1e\x01"
+    "\xa3\x1d\x01\xa7\x1e\x00\x7a\xa8\x36\x01\x06\x00\x44\x00\x64\x00\x64\x8c\x36\x23\x00\x84\x02\x00\x3c\x7a\x01\xa7\x04\x00\x0f\xaa"
+    "\x0d\x31\x03\xba\x03\x01\xaa\x0d\x1f\x62\x77\x19\x80\x34\x1e\x01\x6e\x9f\x00\x13\x63\x3e\x01\x41\xb2\x1d\x01\x3b\x44\x01\x16\xb3"
+    "\x3e\x01\x21\x01\xb3\xe6\x37\x00\x06\x00\x80\x00\x53\x00\x53\x01\x3b\x01\xa6\x04\x00\x05\x41\x13\x3c\xb3\x01\xa7\x04\x00\x0f\x9f"
+    "\x00\x3d\x10\x64\x6a\x35\xf4\x0b\xa3\x28\x01\xa7\x29\x01\xb9\x28\x01\xb9\x29\x00\x7a\x29\x01\x16\x2a\x01\xa3\x29\x01\xa7\x2a\x00"
+    "\x7a\x2a\x06\x00\x81\x01\x2c\x01\x2c\x01\xb9\x01\xb9\xdd\x01\x13\xb4\x02\x00\x0f\xdd\x01\x2e\x0f\xf8\x04\x0f\x10\x65\x44\x25\x80"
+    "\xa3\x35\x01\xa7\x36\x01\xb9\x34\x03\x00\xf4\x0b\x3b\x36\x01\x3b\x35\x00\x2c\x35\x00\x46\x17\x01\xa2\x17\x01\x0b\x17\x01\xa6\x17"
+    "\x01\x0b\x00\xb1\x00\xb1\x9f\x00\xc0\x01\x64\x01\x64\x01\x63\x01\x63\x01\xa2\x01\x0b\x04\x00\x44\x00\xd5\x00\xd5\x0c\x00\xe0\x28"
+    "\x32\x01\x17\x28\x32\x00\x49\x2d\x37\x01\x17\x2d\x37\x08\x00\x0f\x3f\x3c\x2b\x10\x66\x7a\x2b\x80\x16\x32\x00\x14\x32\x00\x16\x34"
+    "\x03\x00\x41\x14\x33\x01\xb3\x8c\x2b\xfc\x16\x3b\x14\x00\x15\x14\x00\x13\x16\x00\x15\x16\x00\x13\x01\x28\x01\x28\x00\x16\x00\x16"
+    "\x01\x62\x01\x62\x00\x39\x00\x39\x00\x38\x00\x38\x00\x15\x00\x13\x04\x00\x03\xe3\x25\x18\x3d\xe3\x25\x0f\x9f\x00\x08\x13\x3c\x9f"
+    "\x00\x00\x08\x00\x13\x3c\x9f\x00\x10\x3d\x1b\x03\x40\x23\x37\x00\x3d\x04\x00\x3f\x67\x01\x01\x5f\x28\x12\x3f\x47\x01\x47\x5f\x28"
+    "\x11\x00\x9b\x00\x61\x14\x1e\x00\x3c\x2d\x37\xa3\x00\x01\x04\x00\x0f\x74\x07\x29\xf0\x04\x68\x01\x01\x35\x00\x33\x35\x01\x4c\x34"
+    "\x01\xc2\x34\x00\x70\x35\x00\x70\x36\x09\x00\xf9\x19\x33\x36\x00\x33\x17\x00\x32\x17\x01\x4b\x19\x00\x32\x19\x01\x4b\x01\x76\x01"
+    "\x76\x01\xc2\x00\x70\x01\x4c\x01\x4c\x01\x49\x01\x49\x01\x48\x01\x48\x00\x32\x01\x4b\x04\x00\x3f\x1c\x00\x1c\x9f\x00\x3d\x10\x69"
+    "\xdd\x01\xf1\x2f\x46\x33\x00\x2c\x34\x00\xa6\x34\x00\xa6\x32\x01\x3a\x32\x01\x3b\x34\x00\x7b\x32\x01\x39\x14\x00\x45\x14\x00\x2b"
+    "\x16\x00\x45\x16\x00\x2b\x00\x10\x00\x10\x00\x46\x00\x2c\x00\xa8\x00\xa8\x00\x31\x00\x31\x00\x30\x00\x30\x01\x12\x01\x12\x01\x0f"
+    "\x01\x0f\xcd\x0b\x30\x45\x00\x2b\x04\x00\x42\x28\x32\x01\x16\x78\x02\x01\x08\x00\x01\x04\x00\x0f\x57\x2d\x29\x1f\x6a\x37\x41\x69"
+    "\x0f\x13\x08\x0f\x1f\x6b\xd6\x41\x7e\x90\x55\x28\x37\x01\x54\x23\x37\x01\x56\x04\x00\x1f\x6c\x9f\x00\x3b\x0f\x9d\x29\x01\x0f\x3e"
+    "\x01\x29\x1f\x6d\xd5\x06\x7b\x41\x0f\x19\x00\xaa\x3a\x06\x30\x2d\x00\xab\x04\x00\x1f\x6e\x75\x42\x7d\xa0\x01\x40\x28\x37\x00\xe0"
+    "\x23\x37\x01\x41\x04\x00\x32\x6f\x01\x01\x8e\x05\x40\x35\x00\x16\x33\x03\x00\xa8\x14\x35\x00\x43\x35\x00\x37\x33\x00\x37\x97\x05"
+    "\x4f\x00\x62\x00\x62\x97\x05\x12\xf0\x00\x37\x01\x17\x23\x2d\x00\x56\x28\x37\x00\x49\x28\x37\x00\x57\x04\x00\x0f\x9f\x00\x08\x13"
+    "\x74\x9f\x00\x00\x08\x00\x13\x74\xdd\x01\x90\x75\x28\x32\x01\x71\x23\x37\x00\x75\x04\x00\x70\x70\x01\x01\x32\x00\x46\x32\x59\x04"
+    "\xa1\x37\x33\x01\x0b\x12\x00\x45\x12\x00\x2b\xbf\x31\xf1\x06\xa7\x34\x01\xa3\x32\x01\xa3\x17\x00\x45\x17\x00\x2b\x00\xde\x00\xde"
+    "\x00\x37\x01\x0b\x04\x00\x12\xaf\x02\x00\x2e\x01\xa3\x02\x00\x0f\x9f\x00\x1c\x0f\x3e\x01\x0e\x00",
+    5304, 17967);
+
+const Resource heartgold(
+    "\x5f\x00\x00\x00\x01\x00\x01\x00\x50\xc4\x0f\x19\x00\x48\x0a\x14\x00\x48\x0f\x19\x00\x49\x04\x00\x47\x0a\x0a\x00\x81\x04\x00\x10"
+    "\x48\x04\x00\x61\x14\x14\x00\x81\x14\x14\x08\x00\x50\xaa\x14\x14\x00\x5a\x08\x00\x21\x28\x28\x04\x00\x90\x5a\x28\x28\x00\x49\x28"
+    "\x28\x00\xab\x08\x00\xfa\x0b\x00\x00\x00\x48\x00\x5a\x00\x81\x01\x01\x00\x00\x02\x00\x10\x00\x10\x00\xa3\x03\x00\xa1\x00\xa1\x00"
+    "\xa3\x0e\x00\x14\x03\x0e\x00\x01\x07\x00\x11\x02\x15\x00\x13\x13\x07\x00\x30\x04\x00\x13\x02\x00\x12\x04\x1c\x00\x0a\x0e\x00\x8f"
+    "\x01\x37\x01\x38\x01\x93\x01\x93\xdb\x00\x10\x0f\x01\x00\x23\x12\x10\x07\x00\x1f\x02\x80\x01\x77\x10\x62\x04\x00\x03\x80\x01\x00"
+    "\x08\x00\x00\x04\x00\x10\xde\x08\x00\x21\x28\x28\x04\x00\x13\xde\x08\x00\x10\x63\x08\x00\x01\x80\x01\x72\x78\x00\x81\x03\x01\x00"
+    "\x01\x72\x01\x60\xa7\x03\x00\x0a\x00\x0a\x5d\x01\x08\x0e\x00\x32\x04\x00\x0a\x5d\x01\x03\x07\x00\x30\x0b\x00\x0b\x15\x00\x03\x07"
+    "\x00\x30\x10\x00\x0a\x15\x00\x32\x10\x00\x0b\x07\x00\x06\x0e\x00\x87\x01\x25\x01\x08\x01\xa2\x01\x8f\xc0\x00\x90\x3c\x0a\x14\x00"
+    "\x3c\x0f\x19\x00\x3d\x04\x00\x4b\x20\x20\x00\x3d\xc0\x00\x10\x3c\x04\x00\x03\xc0\x00\x00\x08\x00\x05\x04\x00\x25\x28\x28\x04\x00"
+    "\x14\x81\x08\x00\xc2\x00\x10\x00\x3c\x00\x3c\x00\x81\x04\x01\x00\x01\x1d\x02\x10\xa7\xa4\x00\x3c\x0a\x00\x13\x0e\x00\x10\x45\x02"
+    "\x00\x03\x07\x00\x12\x05\xb9\x00\x05\x07\x00\x00\x23\x00\x12\xa3\x0e\x00\x1a\xa3\x0e\x00\x0f\xc0\x00\x55\x1f\x05\x40\x02\x57\x09"
+    "\xc0\x00\x00\x04\x00\x0f\xc0\x00\x2a\x10\x00\xc0\x00\x71\x01\x54\x06\x01\x00\x00\x03\x7a\x03\x12\x5c\x81\x03\x1a\x5c\x0e\x00\x19"
+    "\x05\x07\x00\x02\x1c\x00\x13\x13\x07\x00\x18\x06\x1c\x00\x0b\x0e\x00\x8f\x01\x07\x01\x47\x01\xb9\x01\x33\xdb\x00\x10\x0f\x01\x00"
+    "\x23\x12\x13\x07\x00\x51\x07\x01\x00\x01\x06\x1d\x02\x13\xc2\x41\x04\x0c\x0e\x00\x55\xb3\x00\xb3\x00\x45\x07\x00\x55\xbb\x00\xbb"
+    "\x00\xb3\x07\x00\x00\x23\x00\x8a\xc2\x04\x00\x29\x00\x13\x00\x29\x0e\x00\x0c\x40\x02\x03\xbc\x03\x14\xc3\xbc\x03\x2f\x24\x24\x40"
+    "\x05\x0e\x04\x04\x00\x53\xd3\x28\x28\x00\x48\x04\x00\x00\x80\x01\x00\x10\x00\xf0\x01\x81\x00\x45\x00\x48\x00\x48\x00\xd3\x08\x01"
+    "\x01\x01\x14\x00\xb1\x02\x00\x12\x16\x07\x00\x0a\x0e\x00\x19\x12\x07\x00\x19\x18\x07\x00\x30\x14\x00\xeb\x02\x00\x12\x16\x07\x00"
+    "\x0a\x0e\x00\x04\xc0\x00\xc0\x08\x0e\x00\x4a\x03\x06\x00\x4a\x0a\x14\x00\xc2\xc0\x00\x27\x0a\x14\x04\x00\x0f\x40\x02\x29\x30\xb1"
+    "\x00\xc2\x00\x03\x70\x09\x01\x00\x00\x05\x00\xc9\x02\x00\x0f\x07\x00\x3a\x05\x02\x00\x0f\x01\x00\x45\x03\x5a\x00\x11\x0a\x40\x02"
+    "\x10\x4a\x02\x00\x30\x06\x00\x1b\x02\x00\x0a\x0e\x00\x30\x05\x00\x29\x02\x00\x03\x07\x00\x05\xa4\x06\x01\x07\x00\x12\x07\x15\x00"
+    "\x30\x06\x00\x5f\x02\x00\x0a\x0e\x00\x84\x01\x67\x01\x28\x01\xb4\x01\xb1\x6f\x00\x0f\x80\x01\x10\x10\x76\x04\x00\x03\x80\x01\x00"
+    "\x08\x00\x05\x04\x00\x25\x28\x28\x04\x00\x00\x80\x01\x11\x77\x80\x01\xc2\x4a\x00\xc2\x00\x76\x00\x81\x0b\x01\x00\x01\x08\xb2\x00"
+    "\x12\x08\xb2\x00\x0a\x0e\x00\x03\x96\x00\x03\x07\x00\x12\x08\x9d\x00\x03\x07\x00\x14\x09\xb2\x00\x01\xce\x00\x0a\x0e\x00\x0f\xc0"
+    "\x00\x55\x52\x0c\x01\x00\x01\x16\x7a\x00\x30\x16\x00\x14\x02\x00\x0c\x0e\x00\x10\x2a\x02\x00\x03\x07\x00\x12\x15\xdc\x00\x03\x07"
+    "\x00\x12\x14\xab\x00\x12\x17\xce\x00\x0a\x0e\x00\x0f\xc0\x00\x00\x09\xc0\x03\x0f\x80\x07\x2e\x12\x29\x80\x07\x42\x0d\x01\x00\x00"
+    "\x4f\x04\x24\x29\x07\x72\x04\x0a\x0e\x00\x37\x15\x00\x15\x07\x00\x07\x2b\x05\x22\x13\x08\x2a\x00\x03\x72\x04\x0a\x0e\x00\x0f\x00"
+    "\x09\x4e\x12\xbb\x07\x00\x43\x0e\x01\x00\x01\xdd\x02\x19\x06\xeb\x02\x03\x0e\x00\x0a\x40\x02\x30\x06\x00\x4f\x02\x00\x03\x07\x00"
+    "\x14\x08\x55\x02\x0f\x0e\x00\x00\x0f\x80\x01\x00\x76\x4f\x0f\x19\x00\x4f\x05\x0f\x04\x00\x0f\x40\x02\x2a\x30\x29\x00\x4f\x40\x02"
+    "\x52\x0f\x01\x00\x01\x15\x7a\x00\x12\x17\x07\x00\x0a\x0e\x00\x19\x13\x07\x00\x12\x15\x9d\x00\x03\x07\x00\x12\x17\x55\x02\x1f\x17"
+    "\x0e\x00\x01\x0f\xc0\x00\x05\x40\x0f\x19\x00\x50\x04\x00\x4f\x1e\x1e\x00\x50\xc0\x00\x31\x11\x10\x80\x01\x00\xba\x08\x40\x2b\x06"
+    "\x00\x0b\x07\x00\x0a\x0e\x00\x50\x06\x00\x0a\x00\x0b\x79\x01\x01\x07\x00\x75\x05\x00\x2e\x00\x0b\x00\x2e\x07\x00\x03\x95\x01\x10"
+    "\x2e\x02\x00\x0a\x0e\x00\x87\x01\x45\x01\x42\x01\x96\x01\xc7\xc0\x00\x95\x36\x05\x0f\x00\x36\x0a\x14\x00\x37\x04\x00\x0f\x00\x06"
+    "\x29\x30\x0a\x00\x36\x00\x06\x70\x11\x01\x00\x01\x0a\x00\x60\x02\x00\x12\x0b\xd6\x02\x0a\x0e\x00\x12\x0c\x0e\x00\x03\x07\x00\x30"
+    "\x0a\x00\x3f\x02\x00\x03\x07\x00\x14\x0d\x31\x00\x10\x84\x02\x00\x0a\x0e\x00\x0f\xc0\x09\x00\x09\x40\x0b\x2f\x1d\x1d\xc0\x03\x2b"
+    "\x22\x01\x18\xc0\x03\x70\x12\x01\x00\x01\x0c\x00\x20\x02\x00\x30\x0c\x00\x1d\x02\x00\x0a\x0e\x00\x12\x0e\xb9\x00\x03\x07\x00\x0a"
+    "\xc0\x00\x12\x0e\xab\x0c\x03\xb2\x00\x03\x0e\x00\x30\x0c\x00\xc1\x02\x00\x0f\xc0\x00\x00\x00\x7c\x01\x50\x36\x0f\x19\x00\x37\x04"
+    "\x00\x2f\x1f\x1f\x80\x01\x2c\x12\xc1\x80\x01\x31\x13\x01\x00\x30\x02\x10\x0a\x88\x00\x01\xfa\x0a\x0a\x0e\x00\x57\x0c\x00\x0a\x00"
+    "\xbf\x07\x00\x03\xa4\x00\x03\xb9\x00\x10\x10\x15\x00\x05\xc7\x00\x08\x0e\x00\x0f\x80\x04\x4e\x12\x0a\x07\x00\x4f\x14\x01\x00\x00"
+    "\x80\x01\x09\x12\x0d\x8f\x00\x05\x07\x00\x10\x3a\x02\x00\x05\x07\x00\x10\xea\x02\x00\x50\x0f\x00\x10\x00\x3a\x1c\x00\x08\x0e\x00"
+    "\x0f\xc0\x00\x4e\x12\x20\x07\x00\x42\x15\x01\x00\x00\x9d\x00\x22\xa7\x0f\x81\x00\x0a\x0e\x00\x00\x8f\x00\x33\x10\x00\xa3\x07\x00"
+    "\x12\x0e\xb9\x00\x03\x07\x00\x00\x15\x00\x10\x11\x2a\x00\x00\xb2\x00\x01\x07\x00\x06\x0e\x00\x0f\x00\x0f\x55\x1f\x16\xc0\x0c\xaa"
+    "\x31\x00\x81\x17\x80\x01\x01\x3a\x04\x30\x0e\x00\x6d\x02\x00\x0a\x0e\x00\x12\x0f\x0e\x00\x03\x07\x00\x12\x0e\x24\x05\x03\x07\x00"
+    "\x14\x10\x23\x00\x01\x6a\x08\x0a\x0e\x00\x0f\xc0\x0c\x55\x59\x18\x01\x00\x00\x0e\xb2\x00\x0a\x0e\x00\x03\x96\x00\x05\x07\x00\x53"
+    "\x13\x00\x7e\x00\x13\x07\x00\x14\x0f\xce\x00\x10\x7e\x10\x00\x0a\x0e\x00\x0f\xc0\x00\x55\x42\x19\x01\x00\x00\x7a\x09\x22\x5c\x15"
+    "\x07\x00\x0a\x0e\x00\x1f\x16\x07\x00\x00\x13\x13\x07\x00\x12\x17\x07\x00\x1f\x18\x0e\x00\x01\x0f\xc0\x00\x55\x20\x1a\x01\x0b\x03"
+    "\x01\x73\x00\x14\x10\x08\x02\x0a\x0e\x00\x10\x51\x02\x00\x05\x07\x00\x30\x53\x00\x53\x1c\x00\x01\x07\x00\x30\x0d\x00\xf1\x02\x00"
+    "\x30\x0d\x00\x80\x02\x00\x05\x0e\x00\x10\xd1\x02\x00\x0f\xc0\x03\x4e\x12\xd1\x07\x00\x16\x1b\xc0\x00\x19\x11\xc0\x00\x05\x0e\x00"
+    "\x0f\xc0\x00\x07\x12\x0f\xb2\x00\x12\x0f\xc0\x00\x0a\x0e\x00\x0f\xc0\x00\x4e\x03\x80\x01\x1f\x1c\x80\x13\xac\x1f\x1d\xc0\x00\xac"
+    "\x1f\x1e\xc0\x00\x58\x03\xb8\x00\x14\xe2\x04\x00\x0b\xc0\x00\x0f\x80\x16\x22\x11\x1f\x40\x0e\x10\x62\x02\x00\x03\xf2\x0b\x0a\x0e"
+    "\x00\x12\x18\x0e\x00\x03\x07\x00\x30\x16\x00\x56\x02\x00\x03\x07\x00\x03\xf2\x0b\x1f\x18\x0e\x00\x01\x0c\x00\x0c\x03\x80\x01\x1f"
+    "\x74\x80\x01\x1c\x17\x74\x80\x01\x13\x74\x7c\x01\x10\x75\x08\x00\xa0\x00\x62\x00\x48\x00\x74\x00\x81\x20\x01\x84\x07\x0f\xc0\x00"
+    "\x4f\x0f\x01\x00\x3e\x00\x42\x02\x4f\x00\x00\x00\x21\x80\x01\x57\x04\x7c\x01\x10\x75\x04\x00\x4f\x1e\x1e\x00\x75\x80\x01\x2c\x10"
+    "\x74\x80\x01\x54\x22\x01\x00\x00\x17\xa4\x00\x03\x39\x0e\x08\x0e\x00\x12\x19\x0e\x00\x03\x07\x00\x14\x17\xab\x00\x01\x07\x00\x12"
+    "\x18\xb2\x00\x1f\x19\x0e\x00\x01\x0f\x80\x01\x55\x20\x23\x00\x82\x19\x0f\x01\x00\x47\x8f\x0f\x18\x00\x62\x17\x1c\x00\xd5\x80\x04"
+    "\x45\x70\x24\x01\x00\x01\x0f\x00\x38\x02\x00\x11\x0d\xa4\x15\x1a\xb3\x0e\x00\x11\x0e\x39\x11\x13\x29\x07\x00\x19\x10\x07\x00\x30"
+    "\x0f\x00\xb4\x02\x00\x12\x11\x07\x00\x0a\x0e\x00\x0f\x80\x0d\x00\x94\x76\x0a\x14\x00\x76\x0f\x19\x00\x77\x04\x00\x0b\xc0\x00\x0f"
+    "\xc0\x0f\x1b\x30\x38\x00\x76\xc0\x0f\x52\x25\x01\x00\x01\x0d\x2b\x02\x03\x81\x09\x0a\x0e\x00\x30\x0e\x00\x42\x02\x00\x05\x07\x00"
+    "\x03\xdc\x09\x03\x07\x00\x01\xc7\x12\x03\xb1\x07\x03\x0e\x00\x30\x0f\x00\xb7\x02\x00\x0f\x00\x03\x00\x0f\xc0\x00\x3b\x12\xb7\xc0"
+    "\x00\x11\x26\x40\x0b\x01\x7a\x00\x12\x0d\xa4\x00\x0a\x0e\x00\x14\x0f\x96\x00\x01\x07\x00\x0a\xc0\x00\x14\x0f\xd5\x00\x03\xf1\x00"
+    "\x08\x0e\x00\x0f\x00\x03\x4e\x12\x4a\x07\x00\x70\x27\x01\x00\x01\x1f\x00\x4b\x02\x00\x30\x20\x00\x43\x02\x00\x0c\x0e\x00\x01\xb9"
+    "\x00\x03\x07\x00\x12\x1e\x15\x09\x03\x07\x00\x12\x1c\xb2\x00\x12\x1e\xb9\x03\x0a\x0e\x00\x0f\x80\x01\x01\x21\x14\x1e\x04\x00\x14"
+    "\x77\x04\x00\x0f\x80\x01\x2a\x12\x4b\x80\x01\x11\x28\x00\x03\x01\x33\x01\x19\x11\x39\x02\x03\x0e\x00\x05\x8e\x0a\x03\x07\x00\x01"
+    "\xa4\x00\x05\x07\x00\x03\x40\x02\x03\xea\x09\x08\x0e\x00\x0f\x40\x02\x4e\x12\x29\xc0\x00\x11\x29\xc0\x00\x03\x81\x03\x10\xcb\x02"
+    "\x00\x0a\x0e\x00\x20\x11\x00\x02\x00\x13\xa4\x07\x00\x11\x0f\xd5\x03\x13\x30\x07\x00\x70\x10\x00\x30\x00\xb4\x00\xb3\x1a\x00\x1c"
+    "\xb4\x0e\x00\x0f\xc0\x03\x00\x72\x81\x0a\x14\x00\x81\x05\x0f\x04\x00\x29\x32\x32\xbc\x00\x00\x04\x00\x0f\x40\x0e\x1b\x30\xb4\x00"
+    "\x81\x40\x0e\x1f\x2a\x00\x09\x54\x04\xbc\x00\x45\x0a\x14\x00\x82\x04\x00\x0a\xc0\x00\x01\x04\x00\x03\xc0\x00\x04\x04\x00\x10\x82"
+    "\x08\x00\x03\xb8\x00\x13\x82\x08\x00\x01\x04\x00\xf0\x00\x00\x00\x00\x81\x00\x82\x00\x81\x2b\x01\x00\x01\x17\x00\x72\x02\x00\x30"
+    "\x16\x00\x46\x02\x00\x0a\x0e\x00\x12\x16\x39\x1d\x03\x07\x00\x30\x18\x00\x6c\x02\x00\x05\x07\x00\x01\x23\x00\x1f\x1a\x0e\x00\x01"
+    "\x0c\x80\x01\x21\x14\x1e\xbc\x0f\x54\x3c\x14\x1e\x00\x3d\x04\x00\x0f\x80\x01\x14\x1b\xdf\x80\x01\x00\x10\x00\x31\x81\x00\x72\xc0"
+    "\x0f\x80\xdf\x2c\x01\x00\x00\x15\x00\xdc\x02\x00\x05\xe4\x17\x08\x0e\x00\x05\x0e\x18\x03\x9c\x07\x01\x1c\x00\x03\x07\x00\x00\x15"
+    "\x00\x10\x7c\x1c\x00\x10\x7c\x02\x00\x0a\x0e\x00\x0f\x80\x04\x4e\x12\xdc\x07\x00\x1f\x2d\xc0\x00\xac\x11\x2e\x80\x0a\x03\x96\x00"
+    "\x03\xb2\x00\x08\x0e\x00\x03\xc7\x09\x05\xce\x09\x01\x1c\x00\x03\x07\x00\x00\x15\x00\x10\x7c\x1c\x00\x01\xb2\x00\x0a\x0e\x00\x0f"
+    "\xc0\x00\x55\x1f\x2f\xc0\x00\xac\x1f\x30\x80\x04\x5c\x26\x02\x0a\x04\x00\x0f\x40\x05\x2a\x00\x80\x04\x4f\x3c\x00\x81\x31\xc0\x00"
+    "\x5c\x44\x05\x0f\x00\x93\x04\x00\x0f\x40\x05\x10\x17\x93\x40\x05\x13\x93\x08\x00\x15\x94\xc0\x00\x41\x93\x00\x81\x32\x40\x05\x01"
+    "\x3a\x07\x12\x17\x39\x08\x0a\x0e\x00\x30\x18\x00\xcf\x02\x00\x03\x07\x00\x30\x14\x00\xe7\x02\x00\x03\x07\x00\x12\x19\x23\x00\x12"
+    "\x1b\x07\x00\x0a\x0e\x00\x0f\xc0\x06\x05\x0f\x80\x01\x35\x22\x01\x4d\x80\x01\x11\x33\xc0\x21\x01\xb2\x00\x12\x02\x64\x1c\x0a\x0e"
+    "\x00\x12\x02\x39\x08\x05\x07\x00\x03\x1c\x00\x01\x07\x00\x11\x03\x23\x00\x13\x4a\xce\x1e\x0a\x0e\x00\x0f\x00\x12\x4e\x03\xc0\x09"
+    "\x45\x34\x01\x01\x01\xb2\x00\x01\xa4\x03\x0a\x0e\x00\x0a\xb2\x00\x19\x04\x07\x00\x12\x03\x23\x00\x00\x32\x1d\x01\x38\x00\x03\x0e"
+    "\x00\x10\xce\x02\x00\x04\xc0\x03\x40\x04\x08\x00\xce\x04\x21\x0f\x00\x03\x10\x0f\x00\x09\x1b\x30\xce\x00\x81\x00\x09\x18\x35\x40"
+    "\x02\x03\x6b\x04\x08\x0e\x00\x03\x16\x02\x03\x07\x00\x30\x14\x00\xca\x02\x00\x03\x07\x00\x12\x19\x07\x00\x03\xaa\x04\x0a\x0e\x00"
+    "\x0f\x80\x1c\x00\x0f\xc0\x00\x3b\x12\x4a\xc0\x00\x51\x36\x01\x00\x01\x23\x0f\x14\x22\xa4\x23\x01\x14\x12\x22\xcf\x1a\x12\x21\x07"
+    "\x00\x12\x20\x07\x00\x14\x1f\x0e\x00\x10\x2c\x02\x00\x11\x1f\x2b\x02\x40\x15\x22\x00\x16\x02\x00\x12\x1f\x72\x0a\x12\x21\x07\x00"
+    "\x1f\x28\xc0\x1b\x0a\x54\x56\x0f\x19\x00\x78\x04\x00\x0b\xc0\x00\x0f\x00\x12\x1b\x12\x84\x00\x12\x1f\x37\x80\x04\x54\xa6\x23\x23"
+    "\x00\x3c\x1e\x1e\x00\x81\x23\x23\x04\x00\x0f\x80\x04\x0c\x0f\xc0\x03\x01\x05\x04\x00\x04\xc0\x18\x1f\x38\xc0\x00\x5b\x10\x3c\x08"
+    "\x00\x04\x04\x00\x04\x74\x04\x03\x04\x00\x01\x84\x04\x0b\x7c\x04\x01\xc8\x00\x0b\xbc\x00\x01\x84\x04\x01\xc0\x00\x50\x81\x00\x3c"
+    "\x39\x01\xc4\x15\x01\xeb\x02\x14\x20\x48\x0d\x10\x36\x02\x00\x12\x1d\x07\x00\x03\x4f\x0d\x30\x20\x00\x37\x02\x00\x12\x1b\x2a\x00"
+    "\x12\x1a\x07\x00\x12\x1b\x23\x00\x12\x1a\x07\x00\x0a\x0e\x00\x0f\x80\x07\x4e\x12\x29\x07\x00\x20\x3a\x01\xcb\x1b\x01\xb3\x11\x19"
+    "\x22\xc0\x00\x12\x22\x15\x00\x03\xd5\x00\x12\x22\xc0\x00\x12\x1d\xb9\x00\x05\xf1\x00\x01\x15\x00\x03\x31\x00\x0f\xc0\x00\x5c\x12"
+    "\x56\x07\x00\x52\x3b\x01\x00\x00\x21\xab\x00\x12\x23\xab\x00\x12\x1e\x81\x00\x12\x23\x15\x00\x12\x21\x15\x00\x12\x23\xab\x00\x12"
+    "\x1e\xb9\x00\x03\xc7\x00\x14\x21\xd5\x00\x01\x31\x00\x0a\xc7\x00\x0f\xc0\x00\x55\x20\x3c\x01\xc4\x12\x10\x57\x02\x00\x14\x24\x2b"
+    "\x02\x08\x80\x01\x03\x95\x01\x12\x24\xab\x00\x12\x20\xb9\x00\x12\x1f\x07\x00\x03\x95\x01\x12\x24\x3f\x00\x03\x38\x00\x1f\x1f\xc0"
+    "\x00\x54\x12\x57\x07\x00\x52\x3d\x01\x00\x01\x25\x81\x00\x14\x28\x2b\x02\x08\xc0\x00\x12\x26\x4f\x0a\x12\x26\xab\x00\x12\x27\x23"
+    "\x00\x12\x26\x07\x00\x12\x25\x15\x00\x14\x26\x3f\x00\x01\x2a\x00\x03\x07\x00\x0c\xc0\x00\xf0\x01\x1e\x28\x00\x56\x1e\x28\x00\x74"
+    "\x23\x2d\x00\x50\x32\x32\x00\x50\x08\x00\x0b\x7c\x04\x08\x80\x13\x1b\x36\x00\x15\x00\x3c\x0e\x08\x00\x15\x11\x75\x9e\x00\xa0\x74"
+    "\x00\x81\x3e\x01\x00\x01\x2d\x00\xc3\x02\x00\x30\x30\x00\xd0\x02\x00\x05\x0e\x00\x01\x9d\x00\x30\x30\x00\xe8\x02\x00\x12\x2f\x07"
+    "\x00\x02\x1c\x00\x13\xc8\x07\x00\x12\x30\xc7\x00\x30\x14\x00\xf6\x02\x00\x03\x0e\x00\x12\x0f\x0e\x00\x0f\xc0\x00\x00\x94\x77\x23"
+    "\x2d\x00\x77\x1e\x28\x00\x76\x04\x00\x0f\xc0\x06\x2a\x30\xc3\x00\x77\xc0\x06\x18\x3f\xc0\x00\x10\xd7\x02\x00\x12\x2e\x9d\x09\x0a"
+    "\xc0\x00\x1f\x32\xc0\x00\x85\x52\x40\x01\x00\x01\x32\xb9\x00\x03\xb2\x00\x0a\x80\x01\x03\x79\x01\x0f\x80\x01\x7f\x12\xd7\xc0\x00"
+    "\x1f\x41\xc0\x06\x54\x40\x14\x1e\x00\xc2\x04\x00\x44\x1e\x28\x00\xc3\x04\x00\x0f\x80\x07\x0c\x05\x84\x07\x07\x38\x11\x08\x80\x07"
+    "\x93\xc2\x00\x81\x00\x81\x42\x01\x01\x00\xab\x0f\x12\x13\xb9\x09\x14\x14\xab\x18\x10\x63\x02\x00\x12\x13\x6b\x13\x12\x14\x56\x28"
+    "\x82\x12\x00\xc2\x00\xc2\x00\x29\x14\x80\x01\x11\x14\xd5\x09\x22\x2a\x16\x6a\x14\x12\x17\x3f\x03\x03\x07\x00\x04\x80\x01\x8f\x14"
+    "\x1a\x00\x62\x1c\x1f\x00\x63\xe3\x00\x10\x0f\x01\x00\x1b\x12\x2a\x07\x00\x52\x43\x01\x00\x01\x29\xf2\x11\x30\x2a\x00\x4d\x02\x00"
+    "\x0a\x0e\x00\x12\x2a\x39\x02\x03\x07\x00\x30\x2c\x00\x4e\x02\x00\x03\x07\x00\xea\x29\x00\x54\x00\x54\x00\xd7\x2b\x00\x55\x00\x55"
+    "\x00\xd7\x0e\x00\x0c\xc0\x09\xc0\x1e\x28\x00\x3d\x23\x2d\x00\x3d\x1e\x28\x00\x3c\x04\x00\x2f\x30\x30\xc0\x21\x2c\x30\x72\x00\x3d"
+    "\x42\x08\x52\x44\x01\x00\x01\x2a\x5d\x01\x14\x2c\xab\x00\x08\x0e\x00\x12\x2b\xce\x03\x12\x2b\x40\x0b\x12\x2a\x07\x00\x12\x29\x07"
+    "\x00\x19\x2d\x00\x03\x03\x0e\x00\x0f\x00\x03\x14\x2f\x32\x32\x00\x15\x0e\x13\x77\x0c\x00\x00\xf0\x02\x00\x40\x05\x00\x08\x00\x05"
+    "\x0c\x00\x40\x00\x5f\x00\x77\x80\x13\x52\x45\x01\x00\x00\x33\x7a\x00\x12\x30\xb9\x00\x0a\x0e\x00\x14\x30\x8e\x04\x01\x15\x00\x03"
+    "\x87\x04\x03\x07\x00\x12\x33\xe3\x03\x03\xc0\x00\x03\x0e\x00\x0f\xc0\x00\x04\x0f\x01\x00\x3e\x03\x40\x02\x45\x46\x01\x00\x00\x4f"
+    "\x04\x07\x80\x04\x15\xc8\x47\x05\x0a\x80\x04\x10\xf7\x02\x00\x05\xa3\x04\x0f\x80\x04\x17\x0f\x01\x00\x3e\x12\xc3\x07\x00\x11\x47"
+    "\x00\x06\x0f\x40\x05\x06\x1a\xc8\x40\x05\x14\x1e\x2b\x02\x0f\x40\x05\x76\x1f\x48\x40\x05\x54\xc4\x19\x19\x00\x48\x19\x19\x00\xc3"
+    "\x19\x19\x00\x49\x04\x00\x0b\xc0\x00\x0f\xc0\x30\x05\x04\xbc\x30\x0a\xc0\x30\x00\xc0\x1b\x4f\x48\x01\x71\x49\x80\x1c\x4c\x00\x3c"
+    "\x05\xf4\x01\x18\x1b\x00\x62\x23\x23\x00\x48\x1e\x1e\x00\x48\x23\x23\x00\x49\x04\x00\x0f\x00\x09\x08\x0f\x80\x1c\x10\x20\x01\x6e"
+    "\x80\x1c\x1f\x4a\x80\x0d\x57\x0f\xc0\x00\x0d\x0f\x00\x21\x22\x1f\x4b\xc0\x00\xac\x1f\x4c\x40\x14\x55\x51\x0a\x00\x3c\x05\x05\xa4"
+    "\x06\x00\xb8\x06\x04\x04\x00\x0f\xc0\x06\x27\x03\xc0\x0f\x1f\x4d\xc0\x00\x57\x31\x76\x05\x05\x64\x04\x00\xb8\x06\x04\x04\x00\x0f"
+    "\x80\x04\x27\x12\x00\xc0\x1b\x1f\x4e\xc0\x03\x4c\x8f\x18\x25\x00\x32\x20\x23\x00\xd5\x40\x02\x3f\x20\x01\x16\x40\x02\x1f\x4f\x80"
+    "\x0a\x55\x51\x14\x00\x58\x0f\x0f\x04\x00\x14\x59\x04\x00\x0f\x37\x00\x10\x0f\x01\x00\x09\x10\x58\x05\x00\x1f\x50\xc0\x00\x57\x20"
+    "\x81\x0f\x80\x1c\x0a\x74\x01\x0d\x04\x00\x0b\x40\x0b\x0f\x80\x1c\x0e\x1f\x51\x80\x04\xac\x51\x52\x01\x00\x00\x19\x00\x15\x22\x3a"
+    "\x14\xfa\x28\x11\x14\x88\x33\x22\xbb\x15\xdd\x14\x12\x16\xf2\x14\x12\x18\x07\x00\x12\x15\xb9\x2d\x12\x14\xdc\x1e\x30\x14\x00\x32"
+    "\x02\x00\x12\x16\x15\x00\x12\x16\x38\x00\x1f\x18\x40\x29\x54\x12\x80\x07\x00\x51\x53\x01\x00\x01\x1c\xba\x0b\x31\x14\x1c\x00\x02"
+    "\x00\x0a\x0e\x00\x12\x20\x07\x0c\x03\x07\x00\x12\x1e\x1c\x00\x05\x07\x00\x00\xb2\x15\x21\xc3\x1e\xf2\x0b\x1a\xc3\x0e\x00\x0d\x00"
+    "\x0c\x11\x1e\x40\x08\x00\x84\x01\x14\x49\x04\x00\x0f\x80\x01\x2a\x12\x54\x80\x01\x15\x54\xc0\x00\x24\xc3\x1c\x96\x21\x08\x0e\x00"
+    "\x02\xab\x00\x15\xc3\x07\x00\x08\xc0\x21\x05\xd5\x00\x08\xea\x00\x03\x0e\x00\x0d\xc0\x1e\x00\xbc\x24\x11\x0f\x98\x00\x14\x49\x04"
+    "\x00\x0f\xc0\x00\x2b\x20\x01\x72\xc0\x00\x52\x55\x01\x00\x01\x27\x72\x0d\x12\x28\x81\x00\x0a\x0e\x00\x12\x28\x79\x0a\x03\x07\x00"
+    "\x11\x2a\x79\x0d\x13\xd7\x07\x00\x02\x72\x0d\x12\x4e\x72\x0d\x03\x8e\x0d\x04\x0e\x00\x0c\xc0\x00\x00\x78\x06\x00\xb4\x15\x44\x28"
+    "\x28\x00\x3d\x04\x00\x0f\xc0\x06\x2a\x02\x80\x1f\x21\x81\x56\xc0\x36\x01\x4f\x13\x03\x39\x38\x0a\x0e\x00\x05\x55\x38\x01\x07\x00"
+    "\x12\x0c\x5d\x34\x03\x07\x00\x12\x0a\x6b\x01\x30\x08\x00\x23\x02\x00\x0a\x0e\x00\x0f\xc0\x15\x55\x11\x57\x00\x33\x10\x68\x02\x00"
+    "\x12\x0a\xb2\x00\x0a\x0e\x00\x12\x0c\xc0\x0f\x03\x07\x00\x05\xa4\x36\x01\x07\x00\x12\x0e\xb9\x0f\x12\x0d\x31\x00\x0a\x0e\x00\x0f"
+    "\xc0\x00\x4e\x12\x68\x07\x00\x52\x58\x01\x01\x00\x0c\x73\x00\x14\x0c\xb2\x00\x08\x0e\x00\x12\x10\x47\x0e\x03\x07\x00\x12\x0a\xb9"
+    "\x00\x03\x07\x00\x30\x0e\x00\x69\x02\x00\x30\x0e\x00\x73\x02\x00\x0a\x0e\x00\x04\xc0\x00\x50\x0c\x10\x00\x4a\x11\x30\x39\x0f\x01"
+    "\x00\x3d\x03\xc0\x00\x11\x59\x40\x17\x03\x72\x25\x03\xc0\x15\x08\x0e\x00\x12\x21\xf9\x02\x03\x07\x00\x12\x22\xc7\x00\x03\x07\x00"
+    "\x12\x24\x07\x00\x30\x23\x00\x6f\x02\x00\x0a\x0e\x00\x0f\x80\x01\x4e\x12\x4b\x07\x00\x16\x5a\xc0\x42\x05\x24\x1d\x08\x0e\x00\x02"
+    "\xc7\x42\x06\x07\x00\x08\xce\x42\x55\x06\x00\xa2\x00\xa2\xb2\x42\x0a\x0e\x00\x0f\x00\x06\x4d\x22\x01\x05\x08\x00\x11\x5b\x00\x1e"
+    "\x01\xf2\x35\x03\x39\x41\x0a\x0e\x00\x05\x1d\x41\x01\x07\x00\x20\x07\x00\xfb\x35\x22\xa4\x08\x07\x00\x11\x07\x95\x25\x40\xa8\x0a"
+    "\x00\xa7\x9c\x25\x03\x0e\x00\x02\x78\x41\x0f\x80\x34\x4f\x03\x00\x36\x11\x5c\x40\x3e\x01\xab\x1e\x02\x3a\x40\x1a\x29\x0e\x00\x12"
+    "\x08\x0e\x00\x03\x07\x00\x30\x06\x00\x27\x02\x00\x03\x07\x00\x12\x0a\xa3\x01\x03\x1c\x00\x0a\x0e\x00\x0f\x80\x01\x4e\x03\x00\x18"
+    "\x11\x5d\xc0\x39\x01\x0f\x1d\x09\xc0\x00\x04\x0e\x00\x0f\xc0\x00\x26\x0c\x80\x40\x0f\x00\x0c\x3d\x12\x15\x00\x0c\x15\x5e\xc0\x36"
+    "\x21\x2b\x0d\x24\x26\x1a\x2b\x0e\x00\x02\x0f\x38\x13\x45\x07\x00\x02\xc7\x36\x13\x2c\x07\x00\x14\x0c\x07\x39\x01\x07\x00\x0a\x0e"
+    "\x00\x0f\xc0\x36\x55\x11\x5f\x80\x2b\x0f\xc0\x00\x17\x01\x07\x33\x03\x07\x00\x0f\xc0\x00\x0a\x0e\x80\x01\x71\x36\x05\x05\x00\x36"
+    "\x0a\x0a\xb8\x39\x04\x04\x00\x0f\x80\x07\x27\x12\x10\xc0\x39\x52\x60\x01\x00\x00\x11\xfa\x01\x11\x11\xfa\x01\x1a\xc6\x0e\x00\x12"
+    "\x12\x5d\x0a\x03\x07\x00\x12\x13\xf9\x08\x05\x07\x00\x00\x02\x00\x10\xc6\xdc\x36\x3a\x3a\x00\xe4\x0e\x00\x0f\xc0\x33\x55\x11\x61"
+    "\xc0\x00\x01\xdd\x29\x11\x13\x07\x00\x1a\x5d\x0e\x00\x12\x0f\x4f\x01\x03\x07\x00\x02\xc7\x00\x13\xa4\x07\x00\x02\x2a\x00\x40\x3a"
+    "\x0f\x00\x40\x02\x00\x0a\x0e\x00\x0f\xc0\x00\x4e\x12\x11\x07\x00\x11\x62\x40\x02\x01\x72\x2e\x03\x24\x38\x0c\x0e\x00\x00\x87\x01"
+    "\x13\x14\x07\x00\x02\x1d\x38\x15\x13\x07\x00\x00\x23\x0c\x40\x14\x0f\x00\x39\x02\x00\x0a\x0e\x00\x0d\x00\x21\x12\x0f\xa0\x03\x44"
+    "\x0f\x0f\x00\x77\x04\x00\x0f\xc0\x03\x29\x22\x01\x2e\xc0\x03\x42\x63\x01\x00\x01\x0f\x2f\x40\xc3\x11\x00\x64\x02\x00\x0c\x0e\x00"
+    "\x03\x1d\x2c\x01\x07\x00\x11\x12\xa4\x00\x15\xc3\x07\x00\x30\x14\x00\x7d\xb2\x00\x10\x7d\x02\x00\x0a\x0e\x00\x0f\xc0\x00\x4d\x04"
+    "\x80\x04\x11\x64\x00\x39\x01\x5d\x3d\x05\xa4\x39\x08\x0e\x00\x0a\xb2\x03\x12\x10\x1c\x00\x05\x07\x00\x10\x61\x02\x00\x0f\x07\x00"
+    "\x02\x0f\x40\x02\x4e\x12\x60\x07\x00\x11\x65\x00\x24\x10\x1e\x02\x00\x30\x17\x00\x21\x02\x00\x0a\x0e\x00\x12\x19\x0e\x03\x03\x07"
+    "\x00\x02\x24\x0e\x13\xc3\x07\x00\x1f\x18\x07\x00\x01\x30\x19\x00\x71\x02\x00\x0c\x80\x01\x0f\xc0\x15\x3e\x11\x71\x80\x46\x21\x81"
+    "\x66\x00\x33\x0f\xc0\x00\x15\x0a\xab\x00\x5c\x1a\x00\xbc\x00\xbc\x07\x00\x04\xc0\x00\x0f\x80\x01\x4d\x12\x1e\x07\x00\x1f\x67\xc0"
+    "\x00\x1a\x0f\x80\x01\x18\x0f\xc0\x00\x54\x70\x68\x01\x00\x00\x1a\x00\x58\x02\x00\x11\x1b\x96\x03\x1a\x58\x0e\x00\x12\x1c\x0e\x00"
+    "\x03\x07\x00\x11\x1d\x15\x00\x13\xc6\x07\x00\x30\x1b\x00\xda\x02\x00\x30\x1e\x00\x59\x02\x00\x0a\x0e\x00\x0f\xc0\x00\x4e\x01\xbe"
+    "\x12\x31\x00\x00\x69\x00\x24\x01\xab\x00\x50\x1b\x00\x58\x00\xda\xab\x00\x08\x0e\x00\x14\x1d\xb9\x00\x01\x07\x00\x11\x1e\x1c\x00"
+    "\x13\x59\x07\x00\x12\x1d\xb2\x00\x12\x20\xb2\x00\x0a\x0e\x00\x0f\xc0\x00\x4e\x12\x16\x07\x00\x1f\x6a\x80\x01\x20\x13\x59\x07\x00"
+    "\x0f\x80\x01\x71\x52\x6b\x01\x00\x01\x1e\x72\x10\x12\x19\x07\x00\x0a\x0e\x00\x19\x23\x07\x00\x19\x14\x07\x00\x00\x2a\x00\x60\x7a"
+    "\x00\x72\x1c\x00\x7a\x02\x00\x0a\x0e\x00\x0c\x80\x04\x0f\x80\x13\x3e\x12\x72\x00\x12\x11\x6c\x00\x4e\x07\x81\x2a\x04\x5d\x4c\x03"
+    "\x0e\x00\x05\x0e\x0c\x01\x07\x00\x11\x04\x24\x11\x04\x07\x00\x12\x06\x63\x11\x11\x07\x8e\x01\x0b\x0e\x00\x0f\xc0\x09\x00\x0f\x00"
+    "\x18\x3b\x12\x13\x40\x11\x11\x6d\x80\x49\x00\x6b\x0a\x8a\x30\x0a\x00\x45\x00\xbf\x00\x2b\x0e\x00\x12\x09\xf9\x08\x03\x07\x00\x12"
+    "\x0c\x64\x31\x03\x07\x00\x30\x08\x00\x30\x2c\x00\x11\x0e\x0e\x00\x1a\x31\x0e\x00\x0f\x00\x0c\x4e\x12\x45\x80\x07\x11\x6e\xc0\x00"
+    "\x00\x1d\x0b\x01\xb2\x00\x10\x45\xc0\x00\x0a\x0e\x00\x32\x30\x00\x10\x9d\x00\x3a\x10\x00\x31\xce\x00\x11\x0a\x55\x05\x12\x46\xb2"
+    "\x00\x1a\x45\x0e\x00\x0f\xc0\x00\x4d\x22\x01\xab\xc0\x00\x1f\x6f\x40\x4a\x1c\x08\x00\x48\x05\x32\x4a\x0f\x0e\x00\x00\x0c\x80\x10"
+    "\x03\x8c\x00\x13\x4f\x18\x20\x01\x04\x00\x0f\x80\x01\x2a\x03\x40\x35\x52\x70\x01\x00\x00\x0f\x48\x16\x12\x11\x07\x00\x0a\x0e\x00"
+    "\x19\x13\x07\x00\x19\x0d\x07\x00\x30\x13\x00\x33\x02\x00\x12\x18\x07\x00\x03\x0e\x00\x12\x1d\x07\x00\x0f\x40\x11\x4e\x12\x32\x07"
+    "\x00\x1f\x71\x00\x12\xac\x3f\x72\x01\x01\xc0\x00\x4a\x64\x18\x20\x00\x4a\x1e\x21\x6e\x00\x0f\x01\x00\x38\x03\x52\x00\x1f\x73\x00"
+    "\x12\x10\x12\x10\x00\x12\x12\x10\x00\x12\x12\x0c\x00\x12\x1f\x0c\x00\x12\x73\x18\x74\xc0\x00\x03\x07\x00\x01\xab\x12\x03\x64\x13"
+    "\x0f\xc0\x12\x02\x00\x07\x00\x05\xb2\x00\x40\xa4\x04\x00\x19\x02\x00\x11\x07\x07\x00\x04\x0e\x00\x0c\x00\x4b\x0f\x01\x00\x3d\x22"
+    "\x01\x91\x08\x00\x51\x75\x01\x01\x01\x27\x3a\x16\x65\x2a\x26\x00\x2f\x00\x2f\xdd\x29\x11\x26\x08\x0e\x40\x2f\x28\x00\x52\x02\x00"
+    "\x12\x27\x16\x2f\x30\x28\x00\x65\x02\x00\x12\x25\xeb\x2f\x12\x27\x2b\x0e\x12\x28\x79\x16\x11\x27\x2a\x00\x12\x43\x40\x2f\x14\x43"
+    "\x40\x02\xf4\x05\x16\x18\x00\x4a\x1a\x1e\x00\x4b\x28\x28\x00\x36\x23\x23\x00\x36\x28\x28\x00\x37\x04\x00\x0b\x80\x04\x01\x04\x00"
+    "\x03\xb4\x06\x08\x88\x04\x04\xbc\x06\x00\x34\x18\x00\xc4\x1b\x01\x04\x00\x22\x00\x2a\xc0\x06\x11\x76\x80\x25\x01\x73\x0f\x11\x28"
+    "\xc0\x00\x22\x2f\x29\xc0\x00\x02\xd5\x00\x22\x43\x29\xc0\x00\x12\x2a\xc0\x00\x12\x29\xc0\x00\x12\x2a\xc0\x00\x12\x29\xf8\x00\x12"
+    "\x2a\x07\x00\x0a\x0e\x00\x0c\xc0\x03\x0f\xc0\x00\x3e\x12\x40\xc0\x00\x52\x77\x01\x01\x01\x2e\xc0\x00\x12\x2d\xc0\x00\x12\x2f\xc0"
+    "\x00\x12\x2d\xc0\x00\x12\x2d\xc0\x00\x12\x2d\xc0\x00\x12\x2e\xc0\x00\x12\x2f\x15\x00\x01\x2f\x00\x32\x00\x2f\x31\xce\x00\x0a\x0e"
+    "\x00\x0f\x80\x01\x4e\x03\xc0\x00\x00",
+    5513, 23040);
+
+const Resource pearl(
+    "\x4f\x00\x00\x01\x00\x01\x00\x38\xf0\x01\x14\x1e\x00\x48\x14\x1e\x01\x16\x14\x28\x00\x49\x14\x28\x01\x17\x04\x00\xa6\x04\x06\x00"
+    "\x81\x03\x07\x00\x81\x05\x0a\x04\x00\x20\x0f\x14\x04\x00\x80\x01\xc8\x0a\x19\x00\x81\x0a\x19\x08\x00\xf0\x03\x01\xc8\x1e\x28\x00"
+    "\x82\x1e\x28\x01\xc9\x14\x28\x00\x78\x14\x32\x01\xc9\x04\x00\x1f\x01\x9f\x00\x3e\x90\x36\x14\x28\x00\x36\x1e\x28\x00\x37\x04\x00"
+    "\x4f\x14\x28\x00\x37\x9f\x00\x08\x13\x53\x9f\x00\x10\x53\x04\x00\x03\x9f\x00\x90\x54\x28\x37\x00\x82\x14\x32\x01\x54\x04\x00\x1f"
+    "\x02\x3e\x01\x69\x22\x00\xdf\x9f\x00\x01\x08\x00\x12\xdf\x9f\x00\x22\x00\xe0\x9f\x00\x20\x00\xe0\x04\x00\x1f\x03\x9f\x00\x3b\xc0"
+    "\x23\x2d\x00\x49\x23\x2d\x01\x17\x1e\x28\x01\xca\x04\x00\x4f\x23\x2d\x01\xca\x9f\x00\x1d\x02\xdd\x01\x02\x9f\x00\x1f\x04\x9f\x00"
+    "\x3c\xd0\x28\x01\x17\x23\x28\x00\x49\x28\x2d\x01\x17\x28\x2d\x08\x00\x2f\x00\x49\x9f\x00\x1e\x34\x1e\x01\x72\x9f\x00\xc1\x05\x01"
+    "\x00\x06\x00\x4a\x06\x00\x4a\x07\x00\x29\x03\x00\xf1\x02\x4a\x07\x00\x4a\x08\x00\x5f\x08\x00\x5f\x09\x00\x4a\x09\x00\x4a\x05\x03"
+    "\x00\x01\x02\x00\x13\x29\x02\x00\x02\x0e\x00\x0f\x02\x00\x03\x0f\x01\x00\x3c\x34\x06\x01\x00\x93\x00\x11\x29\x03\x00\x20\x4a\x08"
+    "\x96\x00\x81\x5f\x09\x00\x5f\x0a\x00\x4a\x0a\xba\x00\x1f\x06\x9f\x00\x67\xf0\x07\x07\x01\x01\x07\x01\xa2\x07\x01\xa1\x08\x01\xa2"
+    "\x08\x01\xa6\x08\x01\x8f\x07\x01\xa6\x09\x09\x00\x50\xa1\x09\x01\xa2\x09\x0c\x00\x00\x06\x00\x80\x01\x35\x01\x35\x01\xa2\x01\xa6"
+    "\x04\x00\x22\x00\xb3\x02\x00\x04\x10\x00\x01\x14\x00\x30\xef\x00\xef\x08\x00\x0f\x59\x04\x34\x50\x5a\x1e\x32\x01\xc9\x04\x00\xa0"
+    "\x08\x01\x00\x0a\x01\x09\x0a\x01\x0c\x0b\x06\x00\xd1\x96\x0a\x01\xab\x0b\x01\x96\x0b\x01\xab\x0c\x01\x96\x03\x00\xf3\x06\xab\x0c"
+    "\x01\x0d\x0c\x01\x0d\x01\x1f\x01\x1f\x01\x09\x01\x96\x00\xc8\x00\xc8\x01\x22\x02\x00\xff\x04\x11\x01\x11\x01\x96\x01\xab\x00\xcc"
+    "\x00\xcc\x00\x0b\x00\x0b\x00\x0e\x00\x0e\x11\x01\x10\x0f\x01\x00\x1a\xf2\x12\x09\x01\x01\x1d\x01\xa3\x1c\x01\xa6\x1c\x01\x93\x1d"
+    "\x01\x16\x1d\x01\x94\x1d\x01\xa7\x1d\x01\xa1\x1d\x01\xa1\x1e\x01\xa3\x1e\x01\xa7\x06\x00\x80\x00\x51\x00\x51\x01\x93\x01\x16\x04"
+    "\x00\xcc\x00\xbb\x00\xbb\x00\xbc\x00\xbc\x01\xa3\x01\xa7\x04\x00\x0f\x3e\x01\x35\x04\x97\x05\xf2\x12\x0a\x01\x01\x0f\x00\x42\x0f"
+    "\x00\x4a\x0e\x00\xad\x0e\x00\xad\x0f\x01\x33\x0f\x00\x29\x0f\x01\xb1\x0f\x01\xb1\x10\x00\x42\x0e\x00\xad\x06\x00\x23\x00\x42\x7e"
+    "\x02\x91\x4a\x00\x29\x01\x33\x00\x29\x00\x42\x14\x00\x0d\x04\x00\xc0\x14\x1e\x00\x29\x14\x28\x00\x29\x1e\x28\x00\x2a\x04\x00\x4f"
+    "\x14\x28\x00\x2a\x97\x05\x29\xf0\x20\x0b\x01\x00\x26\x01\xb5\x24\x00\x4b\x25\x00\x43\x24\x00\x23\x25\x01\x34\x25\x00\x2a\x25\x01"
+    "\xb1\x26\x01\xb1\x24\x01\xb4\x25\x00\x23\x24\x01\xb4\x26\x00\x23\x01\xb5\x00\x4b\x00\x43\x00\x23\x04\x00\xf1\x01\x01\x34\x00\x2a"
+    "\x01\xb4\x00\x23\x01\x52\x01\x52\x01\x51\x01\x51\x0c\x00\x03\x04\x00\x0f\xb0\x01\x10\x0f\x01\x00\x1a\x1f\x0c\x9f\x00\x8b\x10\x0d"
+    "\x9f\x00\xf0\x0b\xcb\x28\x01\xcc\x27\x01\x34\x27\x00\x43\x28\x01\x34\x28\x00\x43\x27\x01\xb1\x28\x01\xb1\x27\x01\xb5\x26\x68\x05"
+    "\xf3\x03\xb5\x27\x00\x23\x01\xcb\x01\xcc\x01\x34\x00\x43\x00\x2a\x00\xa4\x01\x26\x02\x00\x04\x9f\x00\x11\xb5\xbf\x00\x01\x04\x00"
+    "\x0f\x72\x00\x10\x0f\x01\x00\x1a\x40\x0e\x01\x01\x28\x87\x00\x71\x4b\x27\x00\x43\x26\x00\x23\xa5\x00\x12\x2a\x9f\x00\x11\x26\x99"
+    "\x00\x4f\x27\x01\xb5\x28\x3e\x01\x00\x00\x8f\x00\x0f\x9f\x00\x00\x0f\x7c\x02\x2d\x40\x0f\x14\x00\x93\x7c\x02\xbe\x0f\x23\x00\x94"
+    "\x0f\x28\x00\x94\x0f\x01\x00\x9f\x00\x10\x28\x9f\x00\x1f\x66\x9f\x00\x21\x0f\x11\x01\x10\x0f\x01\x00\x1a\x20\x10\x01\x6c\x00\xf0"
+    "\x0a\x28\x00\x4b\x29\x00\x43\x28\x00\x23\x29\x01\x34\x29\x00\x2a\x29\x01\x66\x2a\x01\x66\x28\x01\xb5\x29\x12\x00\x2f\xb5\x2a\x9f"
+    "\x00\x67\x1f\x11\x9f\x00\x8b\x40\x12\x01\x00\x28\xda\x01\x21\x4b\x28\xdd\x01\x11\x28\xdd\x01\x11\x26\x7c\x02\x02\x15\x03\x02\xdd"
+    "\x01\x2f\x00\x4b\x9f\x00\x63\xf0\x0d\x13\x01\x00\x1f\x01\x33\x1f\x00\x4b\x1e\x00\x23\x20\x00\x2a\x1f\x00\x43\x1f\x00\x2a\x1e\x01"
+    "\xb1\x1e\x01\xb1\x20\x18\x00\xf1\x00\x23\x20\x01\x33\x20\x00\x23\x01\x33\x00\x4b\x00\x23\x00\x2a\x04\x00\x51\x43\x00\x2a\x01\x33"
+    "\x14\x00\x0d\x04\x00\x0f\x72\x00\x10\x0f\x01\x00\x1a\xf2\x12\x14\x01\x00\x0d\x01\x33\x0d\x00\x4a\x0c\x00\xad\x0c\x00\xad\x0d\x00"
+    "\x42\x0d\x00\x29\x0d\x01\xb1\x0d\x01\xb1\x0e\x01\x33\x0c\x00\xad\x06\x00\x26\x01\x33\x36\x06\x21\x00\x42\x3a\x06\x00\x14\x00\x10"
+    "\xad\x02\x00\x04\x0c\x00\x01\x10\x00\x0f\x01\x00\x3c\x3f\x15\x01\x01\x3e\x01\x39\x0f\xd5\x06\x3d\xf0\x0a\x16\x01\x01\x18\x00\xc2"
+    "\x19\x01\x90\x18\x01\x96\x1a\x01\x8c\x19\x00\xb7\x19\x00\xc3\x1a\x00\xb7\x1a\x06\x00\xf7\x11\x36\x18\x00\x36\x1a\x01\x8f\x18\x01"
+    "\x2a\x00\xc2\x01\x90\x01\x96\x01\x8c\x00\xa3\x00\xa4\x00\xb7\x00\xc3\x01\x8f\x01\x2a\x00\x36\x02\x00\x30\x18\x00\x18\x08\x00\xc0"
+    "\x14\x1e\x00\xc2\x14\x1e\x00\xb7\x14\x28\x00\xc3\x13\x0d\x00\x04\x00\x0f\x9f\x00\x0d\x40\x0f\x1e\x00\x82\x04\x00\x81\x1e\x37\x01"
+    "\x54\x0f\x14\x01\x3e\xf8\x04\x30\x1e\x01\x3e\x04\x00\x1f\x17\x9f\x00\x8b\xf0\x0a\x18\x01\x01\x16\x00\xc2\x17\x01\x90\x16\x01\x96"
+    "\x18\x01\x8c\x17\x00\xb7\x17\x00\xc3\x18\x00\xb7\x18\x06\x00\x89\x36\x16\x00\x36\x18\x01\x8f\x16\x9f\x00\x1f\xa3\x9f\x00\x59\x1f"
+    "\x19\x9f\x00\x8b\xf2\x12\x1a\x01\x00\x14\x00\xc2\x15\x01\x90\x14\x01\x96\x16\x01\x8c\x15\x00\xb7\x15\x00\xc3\x16\x00\xb7\x16\x00"
+    "\xc3\x16\x01\x8f\x14\x01\x2a\x06\x00\x0f\x9f\x00\x01\x08\x04\x00\x00\x9f\x00\x01\x08\x00\x0f\x01\x00\x3c\x3f\x1b\x01\x01\x9f\x00"
+    "\x06\x5f\x00\x36\x14\x00\x36\x9f\x00\x07\x0f\x3e\x01\x51\xff\x18\x1c\x01\x00\x13\x00\xc9\x14\x00\xc9\x12\x00\xc9\x15\x00\xc9\x11"
+    "\x00\xc9\x16\x00\xc9\x10\x00\xc9\x17\x00\xc9\x0f\x00\xc9\x18\x00\xc9\x0e\x00\xc9\x19\x00\xc9\x02\x00\x16\x0f\x01\x00\x3c\xf0\x07"
+    "\x1d\x01\x00\x2d\x00\x43\x2d\x00\x4b\x2d\x01\x34\x2d\x00\x2a\x2c\x00\x5f\x2e\x00\xd0\x2e\x09\x00\xb1\x2a\x2e\x00\x43\x2e\x01\x34"
+    "\x2c\x00\x43\x2c\xea\x09\x11\x4b\xcd\x06\x90\x34\x00\x2a\x00\x5f\x00\xd0\x00\x43\x14\x00\x0f\x04\x00\x00\x0f\x01\x00\x3c\xf0\x07"
+    "\x1e\x01\x00\x2e\x00\x40\x2e\x00\x4b\x2e\x01\x34\x2e\x00\x2a\x2d\x00\x5f\x2f\x00\xd0\x2f\x09\x00\x50\x2a\x2f\x00\x40\x2f\xb4\x00"
+    "\x6b\x40\x2d\x01\x34\x00\x40\x9f\x00\x10\x40\x14\x00\x0f\x04\x00\x00\x0f\x01\x00\x3c\x30\x1f\x01\x01\x3e\x01\x23\x01\xa3\x3e\x01"
+    "\x2f\x01\xa3\x3e\x01\x04\x24\x01\xa3\x9f\x00\x2f\x01\xa3\x3e\x01\x07\x40\x23\x2d\x00\x2a\x04\x00\x26\x28\x32\x04\x00\x0f\xc5\x10"
+    "\x08\x00\xc1\x10\x05\x04\x00\x03\xc5\x10\x13\x82\x03\x12\x01\x04\x00\xff\x16\x20\x01\x01\x33\x00\x43\x33\x01\xa3\x33\x01\x34\x33"
+    "\x00\x2a\x32\x01\xa3\x34\x00\xd0\x34\x00\x2a\x32\x00\x2a\x34\x00\x43\x34\x01\x34\x32\x00\x43\x32\x9f\x00\x17\x00\x8f\x00\x21\x2d"
+    "\x37\x97\x00\x9f\x83\x2d\x37\x00\x83\x32\x3c\x00\x83\x9f\x00\x29\x30\x21\x01\x00\x9f\x00\x23\x00\x4b\x9f\x00\x2f\x00\x5f\x9f\x00"
+    "\x04\x0f\x7c\x02\x63\x1f\x22\x9f\x00\x8b\x92\x23\x01\x01\x04\x00\x29\x04\x00\x29\x8a\x12\x10\x05\x09\x00\x27\x29\x06\x03\x00\x69"
+    "\x05\x00\x36\x05\x00\x36\xfb\x11\x00\x0c\x00\x00\xec\x04\x04\x13\x12\x07\x02\x00\x01\xb2\x08\x02\x22\x15\x00\xae\x08\x0f\x1e\x15"
+    "\x2e\x32\x24\x01\x00\x99\x00\x04\x90\x00\x02\x4d\x13\x02\xb4\x12\x00\x03\x00\x11\x04\x03\x00\x0f\xa2\x12\x65\x34\x25\x01\x01\x3b"
+    "\x13\x11\x36\xd1\x13\x21\x36\x09\x0c\x00\x10\x0a\x03\x00\x15\x29\x03\x00\x03\x32\x01\x13\x4a\x04\x00\x0f\x38\x01\x00\x0f\x3e\x01"
+    "\x43\xf3\x26\x26\x01\x00\x37\x01\x43\x37\x00\x70\x36\x00\x16\x36\x00\x4b\x37\x00\x16\x37\x00\x6e\x38\x00\xe3\x38\x00\x4b\x16\x01"
+    "\x42\x16\x00\x6f\x18\x01\x42\x18\x00\x6f\x01\x43\x00\x70\x00\x16\x00\x4b\x01\x62\x00\x2a\x01\x44\x02\x00\x30\x42\x00\x6f\x04\x00"
+    "\x41\x00\xcf\x00\xcf\x08\x00\x3f\xf0\x00\xf0\x11\x01\x10\x0f\x01\x00\x1a\x40\x27\x01\x00\x37\x96\x00\xf2\x14\xdb\x36\x00\x2a\x38"
+    "\x00\x43\x38\x00\xdb\x38\x00\x6e\x36\x00\x5f\x38\x01\x43\x19\x00\x4a\x19\x00\xda\x1b\x00\x4a\x1b\x00\xda\x00\x4b\x00\xdb\x28\x0b"
+    "\xad\x00\x43\x00\xdb\x00\x6e\x00\x4a\x00\xda\x04\x00\x0f\x9f\x00\x40\x70\x28\x01\x00\x39\x00\x4b\x39\x96\x00\x80\x2a\x3a\x00\x43"
+    "\x3a\x00\xdb\x3a\x3e\x01\x42\x5f\x3a\x01\x43\x99\x00\x4f\x1d\x00\x4a\x1d\x9f\x00\x67\xf2\x12\x29\x01\x01\x35\x01\x90\x36\x01\x90"
+    "\x35\x01\x8d\x36\x01\x8d\x35\x00\x37\x36\x00\x37\x34\x01\x66\x36\x01\x66\x34\x01\x90\x34\x01\x8d\x06\x00\xf1\x01\x01\x90\x01\x90"
+    "\x01\x8d\x01\x8d\x00\xa4\x00\xa4\x00\x37\x00\x37\x0e\x00\x04\x49\x0e\x00\x0c\x00\x03\x04\x00\x40\x28\x32\x00\x37\x04\x00\x26\x2d"
+    "\x37\x04\x00\x5f\x03\x06\x00\x81\x04\x97\x05\x03\x13\x76\x93\x05\x00\x08\x00\x13\x76\x97\x05\x13\x77\x97\x05\x10\x77\x04\x00\x10"
+    "\x2a\x13\x08\x80\x2a\x2e\x01\xb5\x2d\x00\x5d\x2e\xc9\x06\x70\x5d\x2d\x01\xb5\x2c\x00\x5d\x03\x00\x52\x01\xb4\x2e\x01\xb5\x06\x00"
+    "\x01\xda\x0e\x32\x5d\x00\x2a\x04\x00\x66\x01\xb5\x01\xb4\x01\xb5\xa2\x12\x03\x10\x00\x3f\xb4\x01\xb5\x11\x01\x10\x0f\x01\x00\x1a"
+    "\x10\x2b\x7c\x02\x80\x2a\x38\x01\xb5\x37\x00\x5d\x38\x7f\x02\x70\x5d\x37\x01\xb5\x36\x00\x5d\x03\x00\x52\x01\xb4\x38\x01\xb5\x06"
+    "\x00\x0f\x9f\x00\x65\xf0\x09\x2c\x01\x00\x41\x00\x2a\x42\x01\xb5\x41\x00\x5d\x42\x00\x2a\x42\x00\x5d\x41\x01\xb5\x40\x00\x5d\x03"
+    "\x00\x52\x01\xb4\x42\x01\xb5\x06\x00\x0f\x9f\x00\x65\x10\x2d\xd5\x06\x80\x2a\x33\x00\xd7\x34\x00\x4b\x34\xc9\x06\x50\xd7\x33\x00"
+    "\x5f\x32\x0f\x00\x20\xd0\x34\x09\x00\x00\xe7\x06\xb1\x32\x00\x2a\x00\x2a\x00\xd7\x00\x4b\x00\x2a\x04\x00\x51\xd7\x00\x5f\x00\x5f"
+    "\xdd\x06\x0e\x04\x00\x0f\x01\x00\x3c\xf0\x04\x2e\x01\x00\x35\x00\x2a\x35\x00\xd7\x36\x00\x4b\x36\x00\x2a\x36\x00\xd7\x35\x99\x00"
+    "\x50\xd7\x36\x00\xd0\x35\x80\x07\x21\x2a\x34\x06\x00\x0b\x9f\x00\x1f\xd0\x9f\x00\x55\x1f\x2f\x9f\x00\x8b\x1f\x30\x9f\x00\x8b\x11"
+    "\x31\xba\x03\x61\x37\x00\xd7\x38\x00\x4b\xba\x03\x50\xd7\x37\x00\xd0\x36\x0f\x00\x20\xd0\x36\x03\x00\x12\x2a\x06\x00\x0d\x9f\x00"
+    "\x3f\xd0\x00\x2a\x04\x00\x02\x0f\x01\x00\x3c\x1f\x32\x9f\x00\x8b\xc1\x33\x01\x00\x0e\x01\xb4\x0e\x00\x29\x0f\x00\x4a\x71\x19\xf2"
+    "\x01\xb4\x0f\x00\x29\x10\x01\xb4\x0e\x01\xb4\x10\x00\x4a\x10\x00\x29\x06\x00\x23\x01\xb4\x3d\x13\x00\x77\x19\x07\x0c\x00\x09\x04"
+    "\x00\x3f\x1b\x00\x1b\x72\x00\x10\x0f\x01\x00\x1a\x33\x34\x01\x00\x93\x00\x02\x8d\x00\xf1\x03\x01\xb4\x0f\x01\xbb\x0f\x01\xb4\x11"
+    "\x01\xb4\x10\x01\xbb\x11\x00\x29\x11\x06\x00\x0a\x9f\x00\x6c\x01\xbb\x01\xbb\x00\x29\x04\x00\x0f\x9f\x00\x41\x6f\x35\x01\x00\x16"
+    "\x00\x4a\x03\x00\x06\x8e\x01\xc1\x16\x00\x4a\x17\x01\xc1\x79\x0a\x00\x14\x00\x0f\x04\x00\x00\x0f\x01\x00\x3c\x6e\x36\x01\x00\x17"
+    "\x00\x4a\x03\x00\x30\x16\x01\xc1\x09\x00\x01\x06\x00\x1f\x18\x9f\x00\x67\x68\x37\x01\x00\x18\x00\x4a\x03\x00\x41\x16\x01\xc1\x18"
+    "\x99\x00\x00\x0f\x00\x01\x06\x00\x1c\x19\x9f\x00\x0f\x9b\x00\x04\x0f\x9f\x00\x40\xf8\x0c\x38\x01\x00\x11\x01\x8d\x10\x01\x3b\x10"
+    "\x00\xac\x10\x00\xac\x11\x01\x3b\x11\x01\x92\x12\x00\x19\x10\x00\xac\x06\x00\x40\x01\x8d\x01\x3b\x51\x09\xcf\x01\x92\x01\x92\x01"
+    "\x3b\x01\x92\x00\x19\x00\xac\x04\x00\x02\x0f\x01\x00\x3c\x1f\x39\x67\x23\x82\x14\xd3\xd0\x1d\x61\x3a\x01\x00\x1e\x00\x4a\xfb\x16"
+    "\xf2\x07\x29\x1f\x00\x2a\x1d\x00\x4a\x20\x00\x4b\x20\x00\x5f\x21\x00\x5f\x1f\x00\x4a\x21\x00\x4b\x06\x00\x81\x00\x4a\x00\x4b\x00"
+    "\x29\x00\x2a\x04\x00\x00\x0c\x00\x0f\x04\x00\x05\x0f\x01\x00\x3c\x10\x3b\x9f\x00\x11\x4b\x9f\x00\x11\x2a\x9f\x00\x17\x4b\x9f\x00"
+    "\x16\x4b\x9f\x00\x00\x02\x00\x00\x9d\x05\x00\x02\x00\x00\x0c\x00\xb3\x4a\x00\x4b\x01\x2f\x01\x2f\x01\x2e\x01\x2e\x1e\x00\x02\x02"
+    "\x00\x0f\x01\x00\x3c\x13\x3c\x9f\x00\x1f\x5f\x9f\x00\x0e\x00\x52\x07\x0f\x9f\x00\x5e\x41\x3d\x01\x00\x1f\x90\x00\x70\x1f\x00\x2a"
+    "\x20\x00\x2a\x1e\x93\x00\xb0\x5f\x21\x00\xd0\x22\x00\xd0\x20\x00\x4b\x22\x1b\x00\x2d\x4a\x22\x9f\x00\x1f\x5f\x9f\x00\x55\x1f\x3e"
+    "\x9f\x00\x8b\xa1\x3f\x01\x00\x0c\x00\x5c\x0c\x00\x5c\x0e\x03\x00\x17\x0d\x03\x00\x11\x10\x03\x00\x11\x0f\x03\x00\x0f\x02\x00\x02"
+    "\x1f\x5d\x02\x00\x00\x0f\x01\x00\x3c\x1f\x40\x9f\x00\x28\x3d\x5e\x00\x5d\x04\x00\x0f\x01\x00\x3c\xd4\x41\x01\x01\x02\x01\x8c\x02"
+    "\x01\x8f\x03\x01\x8c\x03\x06\x00\x4a\x04\x01\x8c\x04\x06\x00\x80\x01\x1b\x01\x1b\x01\x8c\x01\x8f\x02\x00\x22\x00\xca\x02\x00\x0f"
+    "\xe8\x0e\x01\x0f\xc0\x27\x01\x0f\xe8\x0e\x29\xf0\x07\x42\x01\x01\x22\x01\x90\x24\x01\x90\x22\x01\x8d\x24\x01\x8d\x23\x00\x36\x24"
+    "\x00\x36\x23\x87\x21\x72\xb1\x23\x01\x90\x23\x01\x8d\x06\x00\x45\x00\x6c\x00\x6c\x87\x0f\x0f\x9f\x00\x58\x30\x43\x01\x01\x81\x00"
+    "\x20\x00\xd7\xa5\x00\x91\x00\x36\x22\x00\x36\x23\x00\x36\x22\x9f\x00\x01\x12\x00\x02\x18\x00\x9f\xd7\x00\xee\x00\xee\x01\x90\x00"
+    "\x36\x9f\x00\x01\x80\x00\xd9\x00\xd9\x01\x90\x00\xd7\x04\x00\x0f\x9f\x00\x3d\xf0\x0d\x44\x01\x00\x15\x00\xcb\x14\x00\x4a\x15\x01"
+    "\x8d\x15\x00\x4b\x15\x01\x90\x16\x00\xcb\x16\x01\x92\x16\x01\x8d\x16\x0c\x00\x12\x4b\x06\x00\x80\x00\xcb\x00\x4a\x01\x8d\x00\x4b"
+    "\x74\x07\xcc\x00\x21\x00\x21\x00\x1e\x00\x1e\x01\x90\x00\x4b\x04\x00\x0f\x4f\x02\x10\x0f\x01\x00\x1a\xf0\x04\x45\x01\x00\x22\x01"
+    "\xcb\x22\x00\xd7\x23\x01\x33\x23\x00\x43\x23\x01\x34\x24\x06\x00\x75\xcb\x23\x00\xd7\x24\x01\x34\x03\x00\x40\x01\xcb\x00\xd7\x24"
+    "\x17\x63\x00\x29\x00\xa4\x01\x69\x02\x00\x12\x34\x02\x00\x45\x00\xd8\x00\xd8\x0c\x00\x0f\x01\x00\x3c\x3e\x46\x01\x00\x1b\x03\x02"
+    "\x06\x00\x02\x18\x00\x02\x06\x00\x45\x00\x54\x00\x54\x1b\x03\x96\x20\x00\x20\x00\x1d\x00\x1d\x01\x8c\x02\x00\x41\x00\x3a\x00\x3a"
+    "\x08\x00\x0f\x01\x00\x3c\x62\x47\x01\x00\x03\x01\x93\xae\x03\x40\x03\x01\x91\x03\xa8\x03\x12\x93\xae\x03\x08\x9f\x00\x41\x01\x07"
+    "\x01\x07\x89\x00\x52\x91\x01\x91\x00\xa1\x02\x00\x01\xaf\x00\x03\x04\x00\x03\x9f\x00\x1f\x8f\x72\x00\x10\x0f\x01\x00\x1a\x31\x48"
+    "\x01\x01\x8d\x00\x20\x93\x05\x06\x00\xb1\x91\x04\x01\x8f\x05\x00\x3f\x04\x00\x3f\x05\x12\x00\xd1\x05\x01\x8f\x06\x01\x8c\x06\x01"
+    "\x8f\x00\x68\x00\x68\x1e\x01\x51\x29\x01\x91\x01\x18\x02\x00\x11\x19\xc0\x27\x30\x0e\x01\x0e\xc0\x27\x04\xa7\x00\x0f\x19\x2c\x1b"
+    "\x0f\x1b\x03\x0f\x13\x49\x9f\x00\x41\x8f\x04\x01\x96\x9f\x00\x11\x96\xab\x00\x42\x96\x05\x01\x93\x99\x00\x02\x06\x00\x01\x7f\x00"
+    "\x00\x92\x1c\x0f\x9f\x00\x04\x8f\x00\x0a\x00\x0a\x00\x0d\x00\x0d\x9f\x00\x3d\x34\x4a\x01\x01\x87\x00\x41\x96\x06\x01\x91\x06\x00"
+    "\xd2\x93\x07\x01\x96\x07\x01\x93\x08\x01\x8c\x08\x01\x8f\x06\x00\x08\x9f\x00\x22\x00\xbf\x02\x00\x0f\x3e\x01\x51\x32\x4b\x01\x01"
+    "\x36\x2a\x04\x2a\x2a\x11\x8f\x06\x00\xa2\xa1\x09\x01\xa1\x0a\x01\xa2\x0a\x01\xa6\x06\x00\x09\x28\x2a\x00\xfe\x28\x3f\xbb\x00\xbb"
+    "\x3c\x2a\x49\x04\x2e\x0b\x31\x4c\x01\x01\x81\x00\x50\x8f\x0b\x01\xa2\x0b\x06\x00\x11\xa6\x06\x00\xa2\xa1\x0b\x01\xa1\x0c\x01\xa2"
+    "\x0c\x01\x8f\x06\x00\x26\x01\xa2\x04\x00\x22\x00\x4f\x02\x00\x01\x10\x00\x38\x0e\x01\x0e\x1c\x00\x0f\x95\x2e\x3d\x70\x4d\x01\x00"
+    "\x0e\x00\x4d\x0e\x23\x10\x40\x4d\x0e\x01\x91\x09\x00\x20\x01\x92\x99\x0f\x00\x9c\x0f\x20\x4d\x0f\x9c\x0f\xf2\x03\x4d\x10\x00\x4a"
+    "\x01\x2b\x01\x2b\x00\x4d\x00\x4d\x00\x29\x01\x92\x01\x57\x02\x00\x41\x00\x4d\x00\x4a\x04\x00\x35\xcf\x00\xcf\x0c\x00\x0f\x01\x00"
+    "\x3c\x10\x4e\x16\x1a\x11\x42\x16\x1a\x10\x42\x7c\x02\x07\x16\x1a\x35\x07\x00\x42\x06\x00\x61\x00\xe7\x00\xe7\x00\x42\x00\x24\x33"
+    "\x91\x00\xea\x02\x00\x00\x50\x2a\x00\x04\x00\x00\x9f\x00\x04\x0c\x00\x0f\x01\x00\x3c\xf4\x10\x4f\x01\x01\x10\x00\x36\x10\x01\x8f"
+    "\x10\x01\x33\x10\x00\x42\x11\x01\x33\x11\x00\x42\x11\x00\x36\x11\x01\x90\x12\x00\x36\x12\x06\x00\x60\x00\xce\x00\xce\x01\x33\x9f"
+    "\x00\x42\x00\x29\x00\xec\x02\x00\xa0\x01\x4f\x01\x4f\x01\x50\x01\x50\x00\x36\x8e\x07\x02\x04\x00\x0f\xdd\x01\x3d\xf0\x06\x50\x01"
+    "\x01\x10\x01\x8c\x10\x01\x90\x10\x01\xb6\x10\x01\xb6\x11\x01\x90\x11\x01\x8d\x96\x00\x50\x01\x8d\x10\x00\x71\x15\x00\x01\x06\x00"
+    "\x40\x00\xd1\x00\xd1\x94\x08\xf9\x01\x00\x5c\x00\x29\x00\xf1\x00\xf1\x00\x80\x00\x80\x00\x71\x01\xb6\x04\x00\x3f\x25\x00\x25\xba"
+    "\x03\x3d\x31\x51\x01\x00\x77\x0a\x40\x29\x11\x00\x5c\xf1\x11\x01\x06\x00\x4a\x12\x00\x5c\x12\x06\x00\x01\x97\x00\x00\x04\x00\x35"
+    "\xc8\x00\xc8\x0c\x00\x0f\x04\x00\x01\x0f\x01\x00\x3c\x3e\x52\x01\x00\x93\x00\x4a\x13\x00\x5c\x13\x06\x00\x0f\x9f\x00\x65\x3e\x53"
+    "\x01\x00\x93\x00\x47\x14\x00\x5c\x14\x06\x00\x3f\x13\x00\x2a\x9f\x00\x00\x06\x14\x00\x0f\x9f\x00\x48\x10\x54\xc8\x22\x0c\x93\x00"
+    "\x41\x15\x00\x5c\x15\x06\x00\x31\x14\x00\x2a\x0c\x00\x0f\x9f\x00\x05\x0e\x04\x00\x0f\x01\x00\x3c\x10\x55\xa5\x24\x09\x93\x00\x41"
+    "\x15\x00\x29\x16\x93\x00\x41\x16\x00\x5c\x16\x06\x00\x1f\x17\x9f\x00\x67\x10\x56\x3e\x01\xe0\x4d\x13\x00\x4a\x12\x01\xb6\x12\x01"
+    "\xb6\x13\x00\x4a\x13\xa2\x12\xb1\x4d\x14\x00\x4d\x12\x00\x71\x14\x01\xb6\x14\x06\x00\x03\x77\x05\x11\x4d\x2e\x0b\x03\xba\x03\x41"
+    "\x01\x11\x01\x12\xb2\x03\x00\x13\x08\x04\xbe\x03\x0f\x01\x00\x3c\x40\x57\x01\x01\x19\x67\x26\xf1\x01\x90\x18\x01\x33\x19\x00\x42"
+    "\x19\x01\x33\x1a\x00\x42\x1a\x00\x43\x09\x00\x24\x43\x1a\x06\x00\x00\xd4\x04\x01\xf8\x04\x53\xa3\x00\xa4\x01\x73\x02\x00\x04\xf8"
+    "\x04\x10\x43\x48\x0b\x02\x04\x00\x0f\xf8\x04\x3d\x12\x58\x3c\x2a\x00\x5c\x07\xa2\x33\x0e\x01\x8f\x0d\x00\x4a\x0d\x00\x4d\x3c\x2a"
+    "\x30\x0c\x01\x8f\x39\x2a\x01\x06\x00\x40\x01\x33\x01\x8f\x04\x00\x45\x00\x29\x00\xa3\x97\x05\x01\x12\x00\x21\x01\x33\xcd\x0b\x04"
+    "\x0c\x00\x0f\x01\x00\x3c\xf0\x0a\x59\x01\x00\x1b\x01\x33\x1b\x00\x4b\x1a\x00\x4d\x1c\x00\x43\x1b\x00\x43\x1c\x01\x33\x1b\x01\xb1"
+    "\x1c\x03\x00\xa1\x33\x1b\x00\x4d\x1c\x01\x33\x1c\x00\x4d\x3c\x2a\x13\x4d\x6c\x0c\x13\x4d\x02\x00\x11\x33\x18\x00\x11\x4d\x9f\x00"
+    "\x04\x0c\x00\x0f\x01\x00\x3c\x13\x5a\x36\x06\x70\x96\x11\x01\x8d\x11\x01\x92\x27\x15\x00\x0c\x00\x21\x3b\x12\x0f\x00\x00\x2a\x15"
+    "\x01\x03\x00\x44\x01\x8c\x01\x96\x1e\x15\x22\x00\xeb\x02\x00\x01\x2a\x15\x0b\x02\x00\x0f\x36\x06\x3d\xd0\x5b\x01\x01\x12\x00\xc2"
+    "\x12\x01\x90\x13\x01\x3b\x13\xcc\x06\xb0\x92\x12\x01\x3b\x14\x01\x3b\x12\x00\xc2\x14\x71\x07\x03\x06\x00\x01\xc0\x27\x31\x3b\x01"
+    "\x90\x9f\x00\x12\x58\x02\x00\x80\x01\x90\x00\xc2\x01\x0f\x01\x0e\x08\x00\x40\x00\x17\x00\x17\x08\x00\x01\xc0\x27\x70\x28\x00\xc2"
+    "\x1e\x28\x00\xc3\x04\x00\x00\xc8\x27\x0f\x7c\x02\x29\xa0\x5c\x01\x01\x14\x01\xa2\x14\x01\xa6\x15\x06\x00\xd8\x16\x15\x01\xa6\x14"
+    "\x01\x16\x16\x01\xa3\x16\x01\xa6\x06\x00\x81\x01\x67\x01\x67\x01\xa2\x01\x16\x7f\x0a\x13\x15\x02\x00\x3c\xa3\x01\xa6\x04\x00\x0f"
+    "\xe6\x37\x33\x24\x01\x3f\xa8\x36\x60\x5d\x01\x01\x17\x00\x4d\xbd\x18\xf0\x03\x00\x4d\x17\x00\x4b\x17\x00\xb9\x18\x00\xcb\x18\x01"
+    "\x92\x18\x00\x4d\x18\x0c\x00\x12\x4b\x06\x00\x63\x01\x45\x01\x45\x00\x4d\x87\x0f\x13\xe5\x02\x00\x31\xb9\x00\x4b\x04\x00\x00\x51"
+    "\x09\x00\x08\x00\x0f\x13\x08\x40\x10\x5e\x26\x10\x20\x4d\x14\x65\x19\xf1\x01\x4d\x15\x00\x4a\x14\x00\x3f\x14\x01\x92\x14\x00\x40"
+    "\x15\x00\x40\x7a\x19\x03\x06\x00\x45\x00\x60\x00\x60\xf8\x04\x04\x9f\x00\x31\x4a\x00\x40\x04\x00\x00\x9f\x00\x04\x0c\x00\x0f\x01"
+    "\x00\x3c\xf1\x0d\x5f\x01\x00\x20\x01\xcb\x20\x00\xd7\x21\x01\x33\x21\x00\x43\x22\x01\x33\x22\x00\x43\x21\x01\xcb\x21\x00\xd7\x21"
+    "\x7f\x14\x02\x06\x00\x4c\x00\xe1\x00\xe1\x26\x10\x05\x73\x14\x3f\xd9\x00\xd9\x7f\x14\x45\x1f\x60\xc5\x10\x13\x4f\x00\xdc\x00\xdc"
+    "\xc5\x10\x06\x00\x03\x12\x0f\xc5\x10\x44\x41\x61\x01\x01\x1c\xa8\x36\x01\xae\x36\xb0\xa7\x1d\x01\xaf\x1d\x01\x16\x1e\x01\xa3\x1d"
+    "\xa2\x36\x11\xaf\xa8\x36\x00\x06\x00\x44\x00\x64\x00\x64\x8c\x36\x22\x00\x84\x02\x00\x4c\x01\xaf\x01\xa7\x04\x00\x0f\xaa\x0d\x31"
+    "\x03\xba\x03\x01\xaa\x0d\x1f\x62\x77\x19\x80\x34\x1e\x01\x6e\x9f\x00\x13\x63\x3e\x01\x40\xa7\x1d\x01\x3b\x44\x01\x26\x00\xb9\x3e"
+    "\x01\x20\x00\xb9\x3e\x01\x01\x06\x00\x80\x00\x53\x00\x53\x01\x3b\x01\xa6\x04\x00\x04\x41\x13\x4c\x00\xb9\x01\xa7\x04\x00\x0f\x9f"
+    "\x00\x3d\x10\x64\x6a\x35\xf4\x0b\xa3\x28\x01\xaf\x29\x01\xb9\x28\x01\xb9\x29\x01\xb0\x29\x01\x16\x2a\x01\xa3\x29\x01\xa7\x2a\x01"
+    "\xb0\x2a\x06\x00\x81\x01\x2c\x01\x2c\x01\xb9\x01\xb9\xdd\x01\x12\xb4\x02\x00\x4c\x01\xb0\x01\xa7\x04\x00\x0f\xf8\x04\x3d\x10\x65"
+    "\x44\x25\x80\xa3\x35\x01\xa7\x36\x01\xb9\x34\x03\x00\xf4\x0b\x3b\x36\x01\x3b\x35\x00\x2c\x35\x00\x46\x17\x01\xa2\x17\x01\x0b\x17"
+    "\x01\xa6\x17\x01\x0b\x00\xb1\x00\xb1\x9f\x00\xc0\x01\x64\x01\x64\x01\x63\x01\x63\x01\xa2\x01\x0b\x04\x00\x44\x00\xd5\x00\xd5\x0c"
+    "\x00\xe0\x28\x32\x01\x17\x28\x32\x00\x49\x2d\x37\x01\x17\x2d\x37\x08\x00\x0f\x3f\x3c\x2b\x10\x66\x7a\x2b\x80\x16\x32\x00\x14\x32"
+    "\x00\x16\x34\x03\x00\x41\x14\x33\x01\x3b\x8c\x2b\xfc\x16\x3b\x14\x00\x15\x14\x00\x13\x16\x00\x15\x16\x00\x13\x01\x28\x01\x28\x00"
+    "\x16\x00\x16\x01\x62\x01\x62\x00\x39\x00\x39\x00\x38\x00\x38\x00\x15\x00\x13\x04\x00\x03\xe3\x25\x18\x3d\xe3\x25\x0f\x9f\x00\x08"
+    "\x13\x3c\x9f\x00\x00\x08\x00\x13\x3c\x9f\x00\x10\x3d\x1b\x03\x40\x23\x37\x00\x3d\x04\x00\x3f\x67\x01\x01\x5f\x28\x12\x3f\x47\x01"
+    "\x47\x5f\x28\x11\x00\x9b\x00\x61\x14\x1e\x00\x3c\x2d\x37\xa3\x00\x01\x04\x00\x0f\x74\x07\x29\xf0\x04\x68\x01\x01\x35\x00\x33\x35"
+    "\x01\x4c\x34\x01\xc2\x34\x00\x70\x35\x00\x70\x36\x09\x00\xf9\x19\x33\x36\x00\x33\x17\x00\x32\x17\x01\x4b\x19\x00\x32\x19\x01\x4b"
+    "\x01\x76\x01\x76\x01\xc2\x00\x70\x01\x4c\x01\x4c\x01\x49\x01\x49\x01\x48\x01\x48\x00\x32\x01\x4b\x04\x00\x3f\x1c\x00\x1c\x9f\x00"
+    "\x3d\x10\x69\xdd\x01\xf1\x2f\x46\x33\x00\x2c\x34\x00\xa6\x34\x00\xa6\x32\x01\x39\x32\x01\xb0\x34\x00\x7f\x32\x01\x3a\x14\x00\x45"
+    "\x14\x00\x2b\x16\x00\x45\x16\x00\x2b\x00\x10\x00\x10\x00\x46\x00\x2c\x00\xa8\x00\xa8\x00\x31\x00\x31\x00\x30\x00\x30\x01\x12\x01"
+    "\x12\x01\x0f\x01\x0f\xcd\x0b\x30\x45\x00\x2b\x04\x00\x42\x28\x32\x01\x16\x78\x02\x01\x08\x00\x01\x04\x00\x0f\x57\x2d\x29\x1f\x6a"
+    "\x37\x41\x69\x0f\x13\x08\x0f\x1f\x6b\xd6\x41\x7e\x90\x55\x28\x37\x01\x54\x23\x37\x01\x56\x04\x00\x1f\x6c\x9f\x00\x3b\x0f\x9d\x29"
+    "\x01\x0f\x3e\x01\x29\x1f\x6d\xd5\x06\x7b\x41\x0f\x19\x00\xaa\x3a\x06\x30\x2d\x00\xab\x04\x00\x1f\x6e\x75\x42\x7d\xa0\x01\x40\x28"
+    "\x37\x00\xe0\x23\x37\x01\x41\x04\x00\x32\x6f\x01\x01\x8e\x05\x40\x35\x00\x16\x33\x03\x00\xa8\x14\x35\x00\x43\x35\x00\x37\x33\x00"
+    "\x37\x97\x05\x4f\x00\x62\x00\x62\x97\x05\x12\xf0\x00\x37\x01\x17\x23\x2d\x01\x6b\x28\x37\x00\x49\x28\x37\x01\x6c\x04\x00\x0f\x9f"
+    "\x00\x08\x13\x74\x9f\x00\x00\x08\x00\x13\x74\xdd\x01\x90\x75\x28\x32\x01\x71\x23\x37\x00\x75\x04\x00\x70\x70\x01\x01\x32\x00\x46"
+    "\x32\x59\x04\xa1\x37\x33\x01\x0d\x12\x00\x45\x12\x00\x2b\xbf\x31\xf1\x06\xa7\x34\x01\xa3\x32\x01\xa3\x17\x00\x45\x17\x00\x2b\x00"
+    "\xde\x00\xde\x00\x37\x01\x0d\x04\x00\x12\xaf\x02\x00\x2e\x01\xa3\x02\x00\x0f\x9f\x00\x1c\x0f\x3e\x01\x0e\x00",
+    5307, 17967);
+
+const Resource platinum(
+    "\x4f\x00\x00\x01\x00\x01\x00\x38\xc2\x14\x1e\x00\x48\x14\x1e\x01\xa6\x14\x28\x00\x49\x04\x00\xc3\x01\xa7\x04\x06\x00\x81\x03\x07"
+    "\x00\x81\x05\x0a\x04\x00\x50\x0f\x00\x81\x0f\x14\x04\x00\x80\x01\xc8\x0a\x19\x00\x81\x0a\x19\x08\x00\xf0\x03\x01\xc8\x1e\x37\x00"
+    "\x82\x1e\x28\x01\xc9\x14\x32\x00\x78\x28\x37\x01\xc9\x04\x00\x1f\x01\x9f\x00\x3e\x11\x36\x04\x00\x34\x28\x00\x37\x04\x00\x0f\x9f"
+    "\x00\x08\x13\x53\x9f\x00\x10\x53\x04\x00\x21\x1e\x28\x9f\x00\x70\x54\x28\x37\x00\x82\x28\x37\x08\x00\x3f\x01\x54\x02\x3e\x01\x48"
+    "\x3f\x1e\x01\x16\x3e\x01\x0b\x22\x00\xdf\x9f\x00\x01\x08\x00\x12\xdf\x9f\x00\x22\x00\xe0\x9f\x00\x01\x08\x00\x2f\xe0\x03\x9f\x00"
+    "\x3b\xc2\x1e\x28\x00\x48\x1e\x28\x01\x16\x1e\x32\x00\x49\x04\x00\x2f\x01\x17\x9f\x00\x16\x01\xdd\x01\x22\x00\xe0\xdd\x01\x02\x9f"
+    "\x00\x1f\x04\x9f\x00\x3d\x00\x9b\x00\x22\x01\x17\x04\x00\x02\xa3\x00\x0f\x9f\x00\x1e\x34\x1e\x01\x72\x9f\x00\xf0\x04\x05\x01\x00"
+    "\x05\x00\x4a\x06\x00\x4a\x05\x00\x29\x06\x00\x29\x04\x00\x4a\x07\x0f\x00\x20\x5f\x08\x03\x00\x42\x4a\x07\x00\x29\x06\x00\x63\x00"
+    "\x4a\x00\x4a\x00\x29\x02\x00\x00\x0c\x00\x0f\x02\x00\x05\x0f\x01\x00\x3c\x43\x06\x01\x00\x06\x93\x00\x71\x29\x07\x00\x29\x05\x00"
+    "\x4a\x90\x00\x20\x5f\x09\x03\x00\x42\x4a\x08\x00\x29\x06\x00\x0f\x9f\x00\x65\xd0\x07\x01\x01\x09\x01\xa6\x0a\x01\x93\x09\x01\xa2"
+    "\x0a\x09\x00\x80\xa2\x0b\x01\xa6\x09\x01\xa1\x0b\x03\x00\x42\xa2\x0c\x01\xa6\x06\x00\x80\x01\x35\x01\x35\x01\xa2\x01\xa6\x04\x00"
+    "\x22\x00\xb3\x02\x00\x04\x10\x00\x08\x04\x00\x01\x17\x03\x00\x1f\x03\x32\x28\x01\xa7\x04\x00\x0f\xdd\x01\x09\x0f\x59\x04\x06\x14"
+    "\x5a\x59\x04\xf3\x26\x08\x01\x00\x0b\x01\xab\x0a\x01\x96\x0a\x01\x09\x0c\x01\x91\x0b\x01\x96\x0c\x01\x8f\x0c\x01\x0a\x0c\x01\x0c"
+    "\x0d\x01\xab\x0d\x00\x5c\x0e\x01\x0b\x0e\x01\x0d\x01\x1f\x01\x1f\x01\x09\x01\x96\x01\x91\x00\xa3\x01\x22\x02\x00\xff\x04\x11\x01"
+    "\x11\x01\xab\x00\x5c\x00\xcc\x00\xcc\x00\x0a\x00\x0b\x00\x0d\x00\x0e\x11\x01\x10\x0f\x01\x00\x1a\xf0\x01\x09\x01\x01\x1c\x00\x7e"
+    "\x1d\x00\x51\x1d\x00\x7e\x1d\x01\xa3\x1e\x03\x00\xd2\xa7\x1c\x00\x51\x1e\x00\x51\x1f\x01\xa3\x1f\x01\xa7\x06\x00\xe3\x00\x7e\x00"
+    "\x51\x00\x7e\x01\xa3\x01\xa7\x01\xa3\x01\x30\x02\x00\x02\x0e\x00\x09\x04\x00\x0f\x97\x05\x34\x05\x3e\x01\xf2\x12\x0a\x01\x01\x12"
+    "\x01\xb4\x13\x00\x4a\x12\x01\x33\x11\x00\x23\x14\x00\x42\x14\x01\x33\x11\x01\xb1\x12\x01\x2b\x13\x00\x29\x13\x01\xb1\x06\x00\x61"
+    "\x01\xb4\x00\x4a\x01\x33\x80\x02\x9f\x23\x00\x42\x01\x33\x00\x29\x01\xb1\x04\x00\x01\x41\x14\x1e\x00\x29\x04\x00\x34\x28\x00\x2a"
+    "\x04\x00\x0f\x97\x05\x16\x02\x9f\x00\x27\x54\x14\x97\x05\xf2\x12\x0b\x01\x00\x25\x01\xb5\x26\x00\x4b\x25\x01\x34\x24\x00\x23\x27"
+    "\x00\x43\x27\x01\x34\x24\x01\xb1\x25\x01\x2b\x26\x00\x2a\x26\x01\xb1\x06\x00\xf0\x0d\x01\xb5\x00\x4b\x01\x34\x00\x4b\x00\x2a\x00"
+    "\x23\x00\x43\x01\x34\x00\x2a\x01\xb1\x01\x52\x01\x52\x01\x51\x01\x51\x0c\x00\x05\x04\x00\x0f\x01\x00\x3c\x1f\x0c\x9f\x00\x0e\x2f"
+    "\x01\x34\x9f\x00\x00\x2f\x01\x34\x9f\x00\x53\xf0\x07\x0d\x01\x00\x24\x01\xcb\x26\x01\xcc\x26\x01\x34\x27\x01\xcc\x28\x00\x43\x28"
+    "\x01\x34\x25\x96\x00\x81\x2b\x26\x01\x67\x27\x01\xb1\x28\x06\x00\xe3\x01\xcb\x01\xcc\x01\x34\x01\xcc\x00\x2a\x00\xa4\x01\x26\x02"
+    "\x00\x03\x9f\x00\x44\x01\x67\x01\xb1\x04\x00\x0f\x72\x00\x10\x0f\x01\x00\x1a\x3f\x0e\x01\x01\xdd\x01\x39\x0f\x7c\x02\x2d\xff\x02"
+    "\x0f\x19\x00\x93\x14\x32\x01\x54\x14\x28\x00\x94\x23\x37\x00\x94\x0f\x7c\x02\x10\x3f\x27\x01\x66\x9f\x00\x00\x1f\x66\xdd\x01\x51"
+    "\x1f\x10\x9f\x00\x0a\x7f\x27\x01\x66\x26\x00\x2a\x28\x9f\x00\x0e\x15\x66\x04\x00\x0f\x01\x00\x3c\x1f\x11\x9f\x00\x01\x32\x27\x01"
+    "\x66\x9f\x00\x11\x28\x9f\x00\x1f\x29\x9f\x00\x67\x6f\x12\x01\x00\x25\x00\x4b\x7c\x02\x0e\x2f\x00\x4b\x59\x04\x63\xf2\x12\x13\x01"
+    "\x00\x21\x01\xb4\x22\x00\x4b\x21\x01\x33\x20\x00\x23\x23\x00\x43\x23\x01\x33\x20\x01\xb1\x21\x01\x2b\x22\x00\x2a\x22\x01\xb1\x06"
+    "\x00\x65\x01\xb4\x00\x4b\x01\x33\x9f\x00\x19\x33\x93\x00\x0f\x9f\x00\x48\xf2\x12\x14\x01\x00\x0e\x01\xb4\x0f\x00\x4a\x0e\x01\x33"
+    "\x0d\x00\xad\x10\x00\x42\x10\x01\x33\x0d\x01\xb1\x0e\x01\x2b\x0f\x00\x29\x0f\x01\xb1\x06\x00\x07\x36\x06\x1f\xad\x36\x06\x09\x0f"
+    "\x72\x00\x10\x0f\x01\x00\x1a\x3f\x15\x01\x01\x3e\x01\x39\x0f\x59\x04\x01\x5f\x03\x06\x00\x81\x04\x6c\x0c\x24\x10\x16\x13\x08\xf0"
+    "\x02\xc2\x1c\x01\x90\x1c\x01\x65\x1e\x01\x65\x1d\x00\xc2\x1e\x00\xc3\x1c\x06\x00\xf9\x12\xc2\x1e\x00\xc1\x1e\x00\x72\x1f\x00\xc1"
+    "\x1f\x00\x72\x00\xc2\x01\x90\x01\x65\x01\x65\x00\xa4\x00\xa4\x00\xc2\x00\xc3\x00\xc1\x00\x72\x04\x00\x30\x18\x00\x18\x08\x00\x41"
+    "\x14\x1e\x00\xc2\x04\x00\x34\x28\x00\xc3\x04\x00\x0f\x9f\x00\x16\x02\x74\x07\x10\x3e\xf8\x04\x40\x28\x37\x01\x3e\x04\x00\x1f\x17"
+    "\x9f\x00\x8b\x70\x18\x01\x01\x1b\x00\xc2\x1b\x9f\x00\x81\x90\x1b\x00\x72\x1c\x00\x72\x1d\x9f\x00\x10\x1d\x03\x00\x42\xc1\x1d\x00"
+    "\x72\xa5\x00\x01\x9f\x00\x9f\x90\x00\x72\x00\xa4\x00\xa3\x00\x72\x9f\x00\x57\x1f\x19\x9f\x00\x8b\xf0\x09\x1a\x01\x01\x1a\x00\xc2"
+    "\x1a\x01\x90\x1b\x01\x90\x1a\x00\xc1\x1b\x00\xc1\x1c\x00\xc3\x1b\x00\xc2\xf2\x01\x00\x0c\x00\x12\x72\xa5\x00\x03\x9f\x00\x7f\xc1"
+    "\x00\xa3\x00\xa3\x00\xc1\x9f\x00\x57\x1f\x1b\x9f\x00\x8b\xf1\x13\x1c\x01\x00\x14\x00\xc9\x15\x00\xc9\x16\x00\xc9\x17\x00\xc9\x18"
+    "\x00\xc9\x19\x00\xc9\x1a\x00\xc9\x1b\x00\xc9\x1c\x00\xc9\x1d\x00\xc9\x1e\x03\x00\x0f\x02\x00\x16\x0f\x01\x00\x3c\xa0\x1d\x01\x00"
+    "\x28\x00\x4b\x29\x00\x6f\x2a\x06\x00\xf2\x04\x5f\x2a\x00\x5f\x29\x00\x70\x2b\x00\x2a\x2b\x00\x70\x2a\x00\xd0\x29\x01\xbc\x06\x00"
+    "\xff\x05\x00\x4b\x00\x6f\x00\x4b\x00\x5f\x00\x2a\x00\x5f\x00\x5f\x00\x70\x00\xd0\x01\xbc\x04\x00\x02\x0f\x01\x00\x3c\x60\x1e\x01"
+    "\x00\x29\x00\x52\x84\x00\xc0\x00\x4b\x2a\x00\xd0\x2c\x00\xd0\x2b\x00\x52\x2c\x9f\x00\x50\x4b\x2a\x00\x5f\x2b\x9f\x00\x00\x06\x00"
+    "\xff\x05\x00\x52\x00\xd0\x00\x4b\x00\xd0\x00\x2a\x00\xd0\x00\xd0\x00\x52\x00\x5f\x01\xbc\x04\x00\x02\x0f\x01\x00\x3c\xf2\x06\x1f"
+    "\x01\x01\x2a\x01\xa3\x29\x00\xb8\x29\x00\x4b\x2b\x00\xb8\x2a\x00\x5f\x2c\x01\xa3\x9f\x00\x00\xab\x00\x22\x01\xbc\x06\x00\xff\x01"
+    "\x01\xa3\x00\xb8\x00\x4b\x00\xb8\x00\x2a\x00\xb8\x00\x5f\x01\xa3\x3e\x01\x05\x42\x1e\x32\x01\xa3\x04\x00\x24\x00\x2a\x04\x00\x0f"
+    "\xc5\x10\x08\x00\xc1\x10\x05\x04\x00\x03\x03\x12\x00\xff\x11\x05\x04\x00\x20\x20\x01\x12\x0e\xf2\x0c\x2f\x00\xb8\x2f\x00\x4b\x31"
+    "\x00\xb8\x30\x00\x57\x32\x01\xa3\x32\x00\x2a\x31\x00\x4b\x32\x00\x57\x31\x01\xbc\x06\x00\x09\x9f\x00\x7f\x57\x01\xa3\x00\x57\x01"
+    "\xbc\x04\x00\x01\xc4\x23\x37\x01\xa3\x23\x37\x00\x57\x23\x37\x00\x83\x04\x00\x0f\x9f\x00\x29\xf2\x04\x21\x01\x00\x2f\x00\x4b\x2f"
+    "\x01\xa3\x31\x00\x4b\x30\x00\x5f\x32\x00\x5f\x30\x9f\x00\x00\x06\x00\x20\xd0\x32\x9f\x00\x00\x06\x00\x46\x00\x4b\x01\xa3\x7c\x02"
+    "\x0f\x3e\x01\x07\x0f\xb0\x01\x10\x0f\x01\x00\x1a\x1f\x22\x9f\x00\x01\x1f\x31\x9f\x00\x76\x40\x23\x01\x01\x04\x99\x12\x20\x36\x05"
+    "\x00\x12\x50\x36\x03\x00\x29\x03\xab\x12\x21\x36\x06\xb1\x12\x05\x03\x00\x47\x00\x29\x00\x36\x04\x00\x0f\x02\x00\x06\x03\x1e\x15"
+    "\x00\xb2\x08\x00\x1a\x15\x0f\x87\x0f\x22\x08\xb2\x08\x10\x24\x41\x13\x00\x99\x00\x01\x87\x00\x21\x36\x05\x4a\x13\x43\x07\x00\x36"
+    "\x07\x3e\x13\x00\xb7\x12\x00\xa2\x12\x08\x9f\x00\x06\xac\x12\x0e\x02\x00\x0f\x01\x00\x3c\x40\x25\x01\x01\x06\x81\x00\x20\x36\x07"
+    "\x2c\x13\x21\x36\x06\x2f\x13\x70\x0a\x00\x36\x08\x00\x4a\x09\x09\x00\x12\x2a\x06\x00\x0f\x9f\x00\x00\x00\x14\x00\x0d\x04\x00\x0f"
+    "\x3e\x01\x3d\xf2\x12\x26\x01\x00\x35\x01\x43\x36\x00\x70\x33\x00\x16\x33\x00\x4b\x35\x00\x16\x34\x00\x6e\x35\x00\xe3\x35\x00\x4b"
+    "\x33\x01\x42\x34\x00\x6f\x06\x00\x61\x01\x43\x00\x70\x00\x16\x8f\x0a\x33\x4b\x01\x44\x02\x00\x3c\x42\x00\x6f\x04\x00\x0f\x11\x01"
+    "\x10\x0f\x01\x00\x1a\xf0\x07\x27\x01\x00\x36\x00\xdb\x36\x00\x70\x34\x00\x2a\x33\x00\x4b\x34\x00\x2a\x35\x00\x6e\x33\xa2\x00\x72"
+    "\x4b\x34\x00\xda\x34\x00\x6f\x06\x00\x40\x00\xdb\x00\x70\x9b\x00\x03\x04\x00\x5f\x6e\x00\xda\x00\x6f\x04\x00\x02\x0f\x01\x00\x3c"
+    "\xf0\x0a\x28\x01\x00\x35\x00\xdb\x37\x00\xdb\x35\x00\x2a\x34\x00\x4b\x37\x00\x70\x36\x00\x6e\x34\x00\x6e\x36\x4a\x01\x42\xda\x35"
+    "\x00\x6d\x06\x00\x45\x00\xdb\x00\xdb\x9f\x00\x11\x70\x9f\x00\x1f\x6d\x04\x00\x02\x0f\x01\x00\x3c\x31\x29\x01\x01\x46\x0e\xe0\x90"
+    "\x27\x00\x4b\x26\x01\x8d\x26\x01\x90\x28\x01\x8d\x25\x12\x00\x41\xb1\x28\x01\x64\x64\x11\x00\x06\x00\xe0\x00\x4b\x01\x90\x00\x4b"
+    "\x01\x8d\x01\x64\x00\x2a\x01\x90\x08\x00\x06\x49\x0e\x01\x0c\x00\x03\x04\x00\x08\xd0\x18\x0f\xd8\x18\x0f\x23\x00\x76\x93\x05\x00"
+    "\x08\x00\x13\x76\x97\x05\x13\x77\x93\x05\x00\x08\x00\xf1\x02\x77\x2a\x01\x00\x0f\x00\x5c\x0f\x01\xb4\x10\x00\x5c\x11\x00\x2a\x11"
+    "\x06\x00\x40\x12\x00\x2a\x10\xe3\x13\x24\x63\x12\x06\x00\x80\x00\x5c\x01\xb4\x00\x5c\x00\x2a\x9f\x00\x02\x08\x00\x0f\x9f\x00\x03"
+    "\x0f\x11\x01\x10\x0f\x01\x00\x1a\xf1\x01\x2b\x01\x00\x19\x00\x5d\x19\x01\xb4\x1a\x00\x5d\x1b\x00\x2a\x1b\x06\x00\xa0\x19\x00\x2a"
+    "\x1a\x01\xb1\x1c\x01\x63\x1c\x06\x00\xa3\x64\x1c\x01\x66\x00\x5d\x01\xb4\x00\x5d\x9f\x00\x01\x08\x00\x0f\x9f\x00\x53\xf1\x01\x2c"
+    "\x01\x00\x23\x00\x5d\x23\x01\xb5\x24\x00\x5d\x25\x00\x2a\x25\x06\x00\xa4\x26\x00\x2a\x24\x01\x66\x26\x01\x64\x26\x06\x00\x4b\x00"
+    "\x5d\x01\xb5\x9f\x00\x05\xc5\x10\x01\x0c\x00\x03\x04\x00\x0f\x72\x00\x10\x0f\x01\x00\x1a\x10\x2d\xd5\x06\x20\x2a\x30\x04\x08\x23"
+    "\x2a\x32\x09\x00\x40\xd7\x2f\x00\xee\xd8\x06\x34\x00\xee\x2f\x06\x00\x0b\x02\x00\x5f\xd7\x00\xee\x00\x2a\x04\x00\x02\x0f\x01\x00"
+    "\x3c\x1f\x2e\x9f\x00\x03\x11\x7c\x9f\x00\x11\x7c\x9f\x00\x00\x06\x00\x0d\x9f\x00\x3f\x7c\x00\x2a\x04\x00\x02\x0f\x01\x00\x3c\x1d"
+    "\x2f\x9f\x00\x41\x32\x00\xd7\x30\x9f\x00\x11\x32\x99\x00\x02\x06\x00\x0f\x9f\x00\x65\x1f\x30\x9f\x00\x8b\x1d\x31\x9f\x00\x41\x33"
+    "\x00\xd7\x31\x9f\x00\x11\x33\x99\x00\x02\x06\x00\x0f\x9f\x00\x65\x1f\x32\x9f\x00\x8b\xf0\x0a\x33\x01\x00\x12\x01\xb4\x12\x00\x4a"
+    "\x11\x00\x4a\x13\x00\x29\x14\x01\xb4\x14\x00\x5f\x13\x00\x4a\x14\x12\x00\x42\x29\x12\x00\x5f\x06\x00\x00\x41\x13\x01\xaa\x08\x9f"
+    "\x4a\x00\x29\x01\xb4\x00\x5f\x00\x4a\x04\x00\x00\x3f\x1b\x00\x1b\x72\x00\x10\x0f\x01\x00\x1a\x15\x34\x9f\x00\x26\x01\xbb\x9f\x00"
+    "\xb2\x01\xbb\x14\x00\x4a\x14\x01\xbb\x12\x00\x5f\x06\x00\x01\xe0\x13\x31\xbb\x00\x29\x04\x00\x5e\xb4\x00\x5f\x01\xbb\x04\x00\x0f"
+    "\x9f\x00\x41\xdd\x35\x01\x00\x17\x00\x4a\x16\x00\x4a\x15\x00\x4a\x17\x03\x00\x9e\x16\x01\xc1\x17\x00\x4a\x18\x01\xc1\x1b\x1d\x00"
+    "\x14\x00\x0f\x04\x00\x00\x0f\x01\x00\x3c\x42\x36\x01\x00\x18\x8a\x00\x38\x00\x4a\x18\x03\x00\x20\x01\xc1\x18\x00\x01\x06\x00\x1f"
+    "\x19\x9f\x00\x67\x10\x37\x74\x07\x00\x90\x00\x42\x17\x00\x4a\x19\x03\x00\x25\x01\xc1\x06\x00\x11\x18\x06\x00\x1c\x1a\x9f\x00\x0f"
+    "\x9b\x00\x04\x0f\x9f\x00\x40\xf7\x0d\x38\x01\x00\x15\x00\xac\x16\x01\x3b\x16\x01\x8d\x17\x01\x92\x17\x01\x3b\x18\x01\x8d\x16\x00"
+    "\x19\x16\x00\xac\x18\x06\x00\xc0\x00\xac\x01\x3b\x01\x8d\x01\x8d\x01\x92\x01\x92\x0a\x00\x4f\x00\x19\x00\xac\x04\x00\x02\x0f\x01"
+    "\x00\x3c\x1f\x39\x29\x22\x3d\x23\x01\x16\x0e\x1f\x12\x17\x04\x00\x0f\x0e\x1f\x22\x14\xd3\xd0\x1d\xf0\x10\x3a\x01\x00\x1f\x00\x4a"
+    "\x20\x00\x4b\x1e\x00\x29\x20\x00\x2a\x20\x00\x4a\x21\x00\x4b\x1f\x00\x5f\x21\x00\x5f\x1e\x00\x4a\x1f\x18\x00\x00\x06\x00\x45\x00"
+    "\x4a\x00\x4b\xf3\x0c\x00\x0c\x00\x0f\x04\x00\x05\x0f\x01\x00\x3c\x10\x3b\x9f\x00\x11\x4b\x9f\x00\x11\x2a\x9f\x00\x17\x4b\x9f\x00"
+    "\x11\x4b\x9f\x00\x00\x06\x00\x01\x02\x00\x04\x95\x05\x02\x0e\x00\x94\x4b\x01\x2f\x01\x2f\x01\x2e\x01\x2e\x10\x00\x01\x02\x00\x0f"
+    "\x01\x00\x3c\x40\x3c\x01\x00\x20\x8d\x00\x50\x4b\x1f\x00\x2a\x21\x03\x00\x10\x4b\x45\x18\x52\x00\xd0\x23\x00\xd0\xb7\x00\x02\x06"
+    "\x00\x2f\x00\x5f\x9f\x00\x63\x1f\x3d\x9f\x00\x8b\x10\x3e\x9f\x00\x1f\xd0\x9f\x00\x86\x92\x3f\x01\x00\x0e\x00\x5c\x0f\x00\x5c\x06"
+    "\x00\x01\x11\x0d\x03\x06\x00\x08\x03\x00\x0f\x02\x00\x16\x0f\x01\x00\x3c\x1f\x40\x9f\x00\x28\x1f\x5e\x04\x00\x00\x0f\x01\x00\x3c"
+    "\xd4\x41\x01\x01\x02\x01\x8c\x02\x01\x8f\x03\x01\x8c\x03\x06\x00\x4a\x04\x01\x8c\x04\x06\x00\x23\x01\x8c\x04\x00\x52\x8f\x01\x8f"
+    "\x00\xca\x02\x00\x05\x0b\x0d\x04\x1c\x00\x3f\x8c\x01\x8f\xc0\x27\x1b\x02\xe8\x0e\x40\x19\x23\x00\x77\x04\x00\x0f\xe8\x0e\x01\x71"
+    "\x42\x01\x01\x26\x01\x8d\x27\x7e\x0f\xf3\x00\x29\x01\x90\x28\x00\x37\x26\x00\x36\x29\x00\x37\x27\x00\x36\x12\x00\x01\x06\x00\x26"
+    "\x01\x8d\x04\x00\x0d\x9f\x00\x07\x1c\x00\x0f\x9f\x00\x3d\x10\x43\x9f\x00\xf2\x02\xcb\x27\x01\x90\x27\x01\xcb\x28\x01\xcb\x28\x00"
+    "\x37\x29\x00\xd7\x27\xa5\x00\x00\x12\x00\x12\x90\x06\x00\x21\x01\xcb\x04\x00\x91\xcb\x01\x69\x01\x69\x00\x37\x00\xd7\x10\x00\x04"
+    "\x6f\x1e\x33\xd8\x00\xd8\x20\x00\x0f\x9f\x00\x3e\xf0\x0f\x44\x01\x00\x1a\x00\xcb\x19\x01\x90\x1a\x01\x8d\x1b\x01\x92\x1b\x01\x8d"
+    "\x1c\x00\xe4\x1c\x01\x8d\x1a\x01\x90\x1c\x00\xcb\xcd\x1a\x01\x06\x00\x10\x00\x7f\x00\x01\x74\x07\x61\x00\xe4\x00\x21\x00\x1e\x04"
+    "\x00\x12\xcb\x18\x00\x09\x04\x00\x0f\x01\x00\x3c\x10\x45\x0e\x1f\xf1\x02\xcb\x20\x00\xdc\x21\x00\xd7\x20\x01\xcb\x23\x00\xd7\x22"
+    "\x00\xdc\x22\x12\x00\x41\x23\x00\xd7\x23\x12\x00\x10\x23\x38\x01\x21\x00\xdc\x34\x01\x00\x3e\x01\x12\xd7\x0c\x00\x05\x04\x00\x35"
+    "\xd9\x00\xd9\x0c\x00\x0f\x01\x00\x3c\x37\x46\x01\x00\x1b\x03\x18\x91\x21\x03\x02\x18\x00\x02\x06\x00\x41\x00\x54\x00\x54\xff\x02"
+    "\x70\x91\x01\x8f\x00\x20\x00\x1d\x04\x00\x08\x13\x03\x41\x00\x3a\x00\x3a\x08\x00\x0f\x01\x00\x3c\x62\x47\x01\x00\x03\x01\x93\xae"
+    "\x03\x44\x03\x01\x91\x04\x0c\x00\x1a\x04\x9f\x00\x45\x01\x07\x01\x07\x9f\x00\x12\xa1\x02\x00\x0f\x9f\x00\x51\x31\x48\x01\x01\x8d"
+    "\x00\x20\x93\x05\x06\x00\xf2\x0e\x91\x05\x01\x8f\x04\x00\x3f\x05\x00\x3f\x05\x01\x93\x06\x01\x8c\x06\x01\x8f\x07\x01\x8c\x07\x01"
+    "\x8f\x00\x68\x00\x68\x9f\x00\x61\x00\x29\x01\x8f\x00\x3f\x0c\x00\x00\xc0\x27\x30\x0e\x01\x0e\xc0\x27\x0f\x59\x04\x29\x0f\x41\x13"
+    "\x09\x13\x49\x9f\x00\x41\x8f\x04\x01\x09\x3e\x01\x11\x96\xab\x00\x21\x96\x05\xb1\x00\x32\x05\x01\x8f\xa5\x00\x01\x7f\x00\x02\x5f"
+    "\x28\x5c\x29\x01\x96\x01\x93\x9f\x00\x8f\x00\x0a\x00\x0a\x00\x0d\x00\x0d\x9f\x00\x3d\x10\x4a\x9d\x29\xf1\x01\x8c\x09\x01\x8f\x09"
+    "\x01\x09\x08\x01\x91\x09\x01\x96\x09\x01\x93\x0d\x29\xba\x93\x0a\x01\x8c\x0a\x01\x8f\x0b\x01\x8c\x0b\x9f\x00\x22\x00\xbf\x02\x00"
+    "\x0f\x9f\x00\x51\x40\x4b\x01\x01\x0a\x21\x2a\x00\x36\x2a\x01\x45\x2a\x1f\x8f\x3c\x2a\x03\x00\x02\x00\x04\x3c\x2a\x12\xbb\x02\x00"
+    "\x0f\x3c\x2a\x51\x31\x4c\x01\x01\x2d\x2a\x21\x96\x0d\x3c\x2a\x40\x0e\x01\x0a\x0e\x36\x2a\xf4\x05\x8f\x0e\x01\x8f\x0d\x01\x96\x0e"
+    "\x01\x96\x0f\x01\x0b\x0f\x01\x0d\x01\x8f\x01\x96\x3c\x2a\x22\x00\x4f\x02\x00\x40\x01\x96\x01\x96\x3e\x01\x01\x08\x00\x03\x02\x00"
+    "\x0f\x95\x2e\x3d\xf0\x07\x4d\x01\x00\x10\x00\x4d\x10\x00\x4a\x12\x00\xcf\x11\x01\x92\x10\x00\xcf\x11\x00\x42\x12\x03\x00\x27\x4a"
+    "\x13\x06\x00\xe2\x00\xf6\x00\xf6\x00\xcf\x00\x4d\x01\x92\x00\x29\x01\x57\x02\x00\x4d\x00\x42\x00\x4a\x04\x00\x0f\x01\x00\x3c\x61"
+    "\x4e\x01\x00\x07\x00\x42\x5a\x2d\xd1\x4d\x05\x01\x91\x05\x00\x4d\x06\x00\x42\x08\x00\x42\xcd\x2c\x11\x4d\x1c\x1a\x00\x06\x00\x81"
+    "\x00\xe7\x00\xe7\x00\x4d\x00\x42\x7c\x02\x13\xea\x02\x00\x3d\x4d\x00\x4a\x04\x00\x0f\x01\x00\x3c\x10\x4f\xdb\x2a\xf0\x02\x96\x12"
+    "\x01\x8f\x13\x01\x96\x11\x01\x18\x13\x01\x3b\x12\x01\x90\x12\x09\x00\x54\x90\x14\x01\x3b\x14\x06\x00\xe2\x00\xce\x00\xce\x01\x96"
+    "\x01\x18\x00\x29\x01\x18\x00\xeb\x02\x00\xc4\x01\x4f\x01\x4f\x01\x50\x01\x50\x01\x3b\x01\x90\x04\x00\x41\x14\x14\x00\x36\x04\x00"
+    "\x0f\x1b\x03\x34\x32\x50\x01\x01\x93\x00\xa1\x13\x01\x8d\x11\x01\x18\x12\x01\x8d\x13\x9f\x00\xf1\x06\x14\x01\x3b\x13\x01\x18\x11"
+    "\x00\x71\x13\x01\x18\x13\x00\x71\x00\xd1\x00\xd1\x01\x8d\x9f\x00\x33\x63\x01\x19\x02\x00\x38\x18\x00\x71\x04\x00\x4f\x00\x25\x00"
+    "\x25\xba\x03\x3d\x40\x51\x01\x00\x12\x71\x0a\x21\x29\x13\x77\x0a\x60\x12\x00\x29\x11\x00\x5c\x0c\x12\x28\x00\x5c\x03\x00\x40\x00"
+    "\x5c\x00\x29\x06\x00\x42\x01\x63\x01\x63\x0a\x00\x0f\x2e\x0b\x53\x1f\x52\x9f\x00\x8b\x41\x53\x01\x00\x13\x96\x00\x10\x14\x06\x00"
+    "\x00\x99\x00\x10\x12\x90\x00\x47\x29\x15\x00\x5c\x03\x00\x00\x6b\x19\x0f\x9f\x00\x62\x1f\x54\x9f\x00\x0c\x1f\x2a\x9f\x00\x6b\x10"
+    "\x55\x67\x23\x00\x96\x00\x10\x15\x06\x00\x00\x99\x00\x10\x13\x90\x00\x75\x29\x16\x00\x2a\x16\x00\x5c\x06\x00\x0f\x9f\x00\x65\x70"
+    "\x56\x01\x00\x13\x01\x8d\x12\x7f\x14\x40\x7b\x14\x00\x4d\xb1\x03\x90\x00\x4d\x13\x00\x7b\x15\x01\x3b\x15\x09\x00\x91\x71\x15\x00"
+    "\x4d\x15\x00\x71\x01\x8d\xd8\x04\x11\x4d\xe3\x25\x30\xf1\x00\x80\x04\x00\x81\x01\x11\x01\x12\x00\x4d\x00\x71\x74\x07\x00\x08\x00"
+    "\x00\x04\x00\x0f\x01\x00\x3c\x61\x57\x01\x01\x1b\x01\x4d\x7f\x26\xf4\x05\x7b\x1b\x01\x33\x1d\x01\x33\x1c\x00\x42\x1d\x00\x7b\x1d"
+    "\x00\x43\x1d\x00\x42\x1e\x06\x00\x80\x01\x4d\x01\x90\x01\x4d\x01\x33\x9f\x00\x23\x01\x73\x02\x00\x03\xf8\x04\x44\x00\x42\x00\x43"
+    "\x04\x00\x0f\xd5\x06\x21\x40\x19\x23\x01\x54\x04\x00\x0f\xd5\x06\x01\x70\x58\x01\x00\x0d\x01\x33\x0e\x65\x07\x20\x33\x0f\x09\x00"
+    "\x20\xb1\x0e\x3f\x2a\x11\xb1\x51\x2a\x24\x42\x10\x06\x00\x60\x01\x33\x01\x8f\x01\x33\x34\x2a\x43\x00\xa3\x00\xec\x02\x00\x31\x42"
+    "\x01\xb4\x04\x00\x35\xd8\x00\xd8\x0c\x00\x0f\x01\x00\x3c\x40\x59\x01\x00\x1b\x32\x01\x22\x4b\x1c\x3b\x01\xb0\x01\xb1\x1d\x00\x43"
+    "\x1e\x01\xb1\x1d\x01\xb4\x3b\x01\x04\x06\x00\x00\x38\x2a\x03\x9f\x00\x9f\xa4\x01\xb1\x00\x43\x00\x43\x01\xb4\x04\x00\x02\x0f\x01"
+    "\x00\x3c\x40\x5a\x01\x01\x17\x67\x02\xf1\x01\xb7\x17\x01\x8d\x16\x01\x19\x16\x01\x3b\x15\x01\x8d\x18\x01\x19\x03\x00\x42\x3b\x17"
+    "\x00\xb7\x06\x00\x41\x01\x3b\x00\xb7\x36\x06\x35\xb7\x00\xb7\xd5\x06\x00\x14\x00\x0b\x04\x00\x0f\x36\x06\x3d\x10\x5b\x9f\x00\xb0"
+    "\xa6\x18\x00\xc3\x19\x01\xa2\x18\x01\xa6\x1a\x09\x00\xd2\xa6\x18\x01\xc5\x19\x01\xc5\x17\x01\xa2\x1a\x01\xa6\x06\x00\x45\x01\xa6"
+    "\x00\xc3\xf0\x09\x12\x58\x02\x00\x01\x10\x00\x31\x0f\x01\x0e\x14\x00\x3f\x17\x00\x17\xf0\x09\x1f\x0f\x47\x37\x0f\x41\x5c\x01\x01"
+    "\x18\x84\x00\x40\x17\x01\xb9\x19\x03\x00\x11\x16\x9f\x00\x20\x16\x1a\x09\x00\x00\x99\x00\x02\x06\x00\x01\x99\x00\x31\xb9\x01\xb9"
+    "\x08\x00\x13\x15\x02\x00\x0f\x8f\x0a\x02\x01\x8d\x33\x13\x16\xe6\x37\x1f\xa6\xe6\x37\x2d\x70\x5d\x01\x01\x17\x00\x4b\x15\x39\x18"
+    "\xb0\x4b\x16\x00\x6f\x17\x00\xe4\x17\x00\x6f\x18\x12\x00\x54\x6f\x18\x00\xe4\x18\x06\x00\x41\x01\x45\x01\x45\xc4\x27\x52\xe4\x00"
+    "\x29\x01\x05\x02\x00\x21\x00\xe4\x10\x00\x06\x04\x00\x0f\x13\x08\x40\x11\x5e\xf8\x04\x40\x14\x00\xb7\x16\xec\x04\xe0\x8d\x14\x00"
+    "\x6c\x13\x00\x3f\x14\x00\x7b\x15\x00\x40\x16\x15\x00\x03\x06\x00\x40\x00\x60\x00\x60\x26\x10\x01\x7c\x02\x7f\x6c\x00\x3f\x00\xb7"
+    "\x00\x40\x04\x00\x02\x0f\x01\x00\x3c\x61\x5f\x01\x00\x20\x01\xcb\x23\x10\xb2\x33\x21\x01\xcb\x21\x01\x33\x22\x00\xd7\x22\x1d\x10"
+    "\x21\x00\x4b\x26\x10\x00\x06\x00\x01\x04\x10\xf5\x00\x33\x01\xcb\x00\x29\x01\x69\x01\x33\x00\xd7\x00\x4b\x01\xcb\x04\x00\x00\x26"
+    "\x10\x04\x0c\x00\x0f\x01\x00\x3c\x13\x60\x9f\x00\x00\xc5\x10\x30\x21\x01\xcb\x9c\x00\x0f\xc5\x10\x01\x45\x00\xe1\x00\xe1\xc5\x10"
+    "\x13\xdd\x02\x00\x0f\xc5\x10\x50\xf1\x0d\x61\x01\x01\x1c\x01\xa7\x1d\x01\xa3\x1c\x01\xb9\x1e\x01\xb9\x1d\x00\x7a\x1e\x00\x7a\x1e"
+    "\x01\xa3\x1f\x00\x7a\x1f\xb4\x36\x02\x06\x00\x41\x00\x64\x00\x64\x1b\x03\x7f\xa7\x01\xa3\x00\x7a\x00\x7a\xa4\x36\x01\x0f\xa8\x36"
+    "\x2e\x02\x36\x06\x13\xc9\x36\x06\x01\xaa\x0d\x1f\x62\xa0\x3b\x42\x02\xba\x03\x02\x9f\x00\x0f\x01\x3b\x08\x02\x9f\x00\x40\x19\x23"
+    "\x01\xc9\x04\x00\x0f\x9f\x00\x01\x30\x63\x01\x01\x3b\x01\xc0\x00\xcb\x1c\x01\x3b\x1d\x01\x3b\x1f\x00\xb9\x1e\x03\x00\x41\xcb\x1d"
+    "\x00\xb9\x38\x01\x12\x3b\x06\x00\xc4\x00\x53\x00\x53\x01\x3b\x01\x3b\x01\xa3\x01\x3b\x41\x13\x00\x0c\x00\x0c\x04\x00\x0f\x9f\x00"
+    "\x3d\x70\x64\x01\x01\x27\x00\x7d\x28\xde\x2a\xe0\x7d\x26\x01\xb9\x26\x01\x16\x27\x00\x51\x26\x01\x94\x28\x03\x00\x42\x17\x29\x00"
+    "\x52\x06\x00\xe2\x01\x2c\x01\x2c\x00\x7d\x01\xb9\x01\xa3\x01\xa3\x00\xb4\x02\x00\x4c\x01\x17\x00\x52\x04\x00\x0f\x3f\x3c\x2a\x0f"
+    "\xf8\x04\x00\x30\x65\x01\x01\xcc\x2a\xf2\x0b\x01\x3b\x31\x00\x45\x31\x00\x45\x33\x01\x17\x31\x01\xa7\x33\x00\x2c\x33\x00\x46\x34"
+    "\x01\x0b\x34\x01\x0d\x06\x00\xf4\x05\x00\xb1\x00\xb1\x00\x45\x00\x45\x00\x2b\x00\x2b\x01\x17\x01\xa7\x01\x0b\x01\x0d\x04\x00\x44"
+    "\x00\xd5\x00\xd5\x0c\x00\xc4\x23\x37\x01\x17\x23\x37\x00\x49\x23\x37\x01\xa7\x04\x00\x0f\x9f\x00\x06\x02\x97\x00\x0f\x3f\x3c\x0a"
+    "\x61\x66\x01\x01\x30\x00\x43\x39\x2a\x50\x16\x32\x00\x16\x31\x06\x00\x20\x14\x32\x12\x00\x72\x14\x2f\x00\x15\x2f\x00\x13\x06\x00"
+    "\xfc\x09\x01\x28\x01\x28\x00\x16\x00\x16\x01\x62\x01\x62\x00\x39\x00\x39\x00\x38\x00\x38\x00\x15\x00\x13\x04\x00\x41\x23\x37\x00"
+    "\x37\x04\x00\x34\x2d\x00\x36\x04\x00\x0f\x26\x10\x29\x3f\x67\x01\x01\x5f\x28\x12\x3f\x47\x01\x47\x5f\x28\x11\x81\x23\x37\x00\x3d"
+    "\x23\x2d\x00\x3c\x08\x00\x03\x04\x00\x0f\x9f\x00\x29\xd0\x68\x01\x01\x33\x00\x33\x34\x01\x4c\x32\x01\xc2\x32\x65\x28\xf2\x01\x70"
+    "\x33\x01\xc2\x34\x00\x33\x32\x00\x33\x31\x00\x32\x32\x01\x4b\x06\x00\xfd\x05\x01\x76\x01\x76\x01\xc2\x00\x70\x01\x4c\x01\x4c\x00"
+    "\x70\x01\xc2\x00\x32\x01\x4b\x04\x00\x3f\x1c\x00\x1c\x9f\x00\x21\x0f\x8f\x0a\x09\x10\x69\x57\x2d\xf2\x0d\x3b\x31\x01\x3b\x32\x00"
+    "\xa6\x32\x00\xa6\x31\x01\x39\x31\x01\x3a\x2f\x00\x10\x32\x01\x3b\x30\x01\x0b\x30\x01\x0d\x06\x00\xf1\x0d\x00\x7f\x00\x7f\x00\x10"
+    "\x00\x10\x00\xa8\x00\xa8\x00\x31\x00\x31\x00\x30\x00\x30\x01\x12\x01\x12\x01\x0f\x01\x0f\x7f\x14\x04\x7c\x02\x35\x2d\x01\x1b\x04"
+    "\x00\x30\x37\x01\x1c\x04\x00\x0f\x74\x07\x29\x1f\x6a\x37\x41\x69\x05\x39\x18\x10\x76\x04\x00\x0f\x9f\x00\x01\x1f\x6b\x9f\x00\x78"
+    "\x02\xe0\x13\x54\x55\x28\x37\x01\x56\x9f\x00\x1f\x6c\x9f\x00\x3b\x0f\xba\x03\x1b\x02\x2c\x2f\x22\x19\x23\x04\x00\xff\x06\x28\x3c"
+    "\x00\x81\x1e\x46\x00\x81\x14\x50\x00\x81\x0a\x5a\x00\x81\x01\x64\x00\x81\x6d\xd5\x06\x78\x06\x1e\x15\x14\xaa\x36\x06\x1f\x6e\xd6"
+    "\x41\x3c\x03\x2a\x06\x44\x1e\x28\x01\xca\x04\x00\x0f\x97\x05\x0d\x40\x19\x23\x00\xe0\x04\x00\x03\x9f\x00\x30\x40\x14\x32\x93\x05"
+    "\x20\x01\x41\x04\x00\x1b\x6f\x97\x05\x17\x01\x97\x05\x20\x01\x16\x97\x05\x01\x06\x00\x4c\x00\x62\x00\x62\x97\x05\x4c\x01\x16\x00"
+    "\x13\x04\x00\x46\x23\x2d\x01\x16\x3a\x06\x02\x04\x00\x0f\xdd\x01\x08\x13\x74\xba\x03\x00\x08\x00\x13\x74\x36\x06\x90\x75\x14\x32"
+    "\x01\x71\x28\x37\x00\x75\x04\x00\x10\x70\x59\x04\x11\x17\xb3\x31\x40\x45\x2f\x00\x45\x62\x04\xe2\x01\x17\x31\x00\x2c\x31\x00\x46"
+    "\x30\x01\x16\x32\x01\xa3\x06\x00\x44\x00\xde\x00\xde\xd5\x06\x22\x00\xaf\x02\x00\x4c\x01\x17\x01\xa3\x04\x00\x4f\x23\x37\x01\x6c"
+    "\x9f\x00\x18\x0f\xd5\x06\x00\x0a\x3e\x01\x00",
+    5323, 17967);
+
+const Resource soulsilver(
+    "\x5f\x00\x00\x00\x01\x00\x01\x00\x50\xc4\x0f\x19\x00\x48\x0a\x14\x00\x48\x0f\x19\x00\x49\x04\x00\x47\x0a\x0a\x00\x81\x04\x00\x10"
+    "\x48\x04\x00\x61\x14\x14\x00\x81\x14\x14\x08\x00\x50\xaa\x14\x14\x00\x5a\x08\x00\x21\x28\x28\x04\x00\x90\x5a\x28\x28\x00\x49\x28"
+    "\x28\x00\xab\x08\x00\xfa\x0b\x00\x00\x00\x48\x00\x5a\x00\x81\x01\x01\x00\x00\x02\x00\x10\x00\x10\x00\xa3\x03\x00\xa1\x00\xa1\x00"
+    "\xa3\x0e\x00\x14\x03\x0e\x00\x01\x07\x00\x11\x02\x15\x00\x40\x13\x04\x00\x13\x07\x00\x00\x0e\x00\x10\x13\x0e\x00\x05\x1c\x00\x06"
+    "\x0e\x00\x8f\x01\x37\x01\x38\x01\x93\x01\x93\xdb\x00\x10\x0f\x01\x00\x23\x12\x10\x07\x00\x1f\x02\x80\x01\x77\x10\x62\x04\x00\x03"
+    "\x80\x01\x00\x08\x00\x00\x04\x00\x10\xde\x08\x00\x21\x28\x28\x04\x00\x13\xde\x08\x00\x10\x63\x08\x00\x01\x80\x01\xa2\x78\x00\x81"
+    "\x03\x01\x00\x01\x03\x00\xa5\x64\x01\x5a\x0d\x00\x0d\x00\x13\x0e\x00\x30\x04\x00\x0d\x0e\x00\x05\x07\x00\x30\x0e\x00\x0e\x15\x00"
+    "\x03\x07\x00\x30\x10\x00\x0d\x15\x00\x32\x10\x00\x0e\x07\x00\x06\x0e\x00\x87\x01\x25\x01\x08\x01\xa2\x01\x8f\xc0\x00\x90\x3c\x0a"
+    "\x14\x00\x3c\x0f\x19\x00\x3d\x04\x00\x4b\x20\x20\x00\x3d\xc0\x00\x10\x3c\x04\x00\x03\xc0\x00\x00\x08\x00\x05\x04\x00\x25\x28\x28"
+    "\x04\x00\x14\x81\x08\x00\xd2\x00\xa5\x00\x3c\x00\x3c\x00\x81\x04\x01\x00\x01\x04\xb2\x00\x00\xa4\x00\x01\xb2\x00\x08\x0e\x00\x30"
+    "\x03\x00\x45\x02\x00\x03\x07\x00\x12\x05\xb9\x00\x05\x07\x00\x01\xb2\x00\x00\x07\x00\x12\x0e\x07\x00\x06\x0e\x00\x0f\xc0\x00\x55"
+    "\x1f\x05\x40\x02\x57\x09\xc0\x00\x00\x04\x00\x0f\xc0\x00\x2a\x10\x00\xc0\x00\x70\x01\x54\x06\x01\x00\x00\x03\x78\x03\x20\x00\x5c"
+    "\x96\x03\x3a\x13\x00\x5c\x0e\x00\x19\x05\x07\x00\x02\x1c\x00\x13\x13\x07\x00\x18\x06\x1c\x00\x0b\x0e\x00\x8f\x01\x07\x01\x47\x01"
+    "\xb9\x01\x33\xdb\x00\x10\x0f\x01\x00\x23\x12\x13\x07\x00\x51\x07\x01\x00\x01\x06\x1d\x02\x40\xc2\x04\x00\x17\x02\x00\x0c\x0e\x00"
+    "\x55\xb3\x00\xb3\x00\x45\x07\x00\x55\xbb\x00\xbb\x00\xb3\x07\x00\x00\xab\x00\x8a\xc2\x04\x00\x29\x00\x13\x00\x29\x0e\x00\x0c\x40"
+    "\x02\x03\xbc\x03\x14\xc3\xbc\x03\x2f\x24\x24\x40\x05\x0e\x04\x04\x00\x53\xd3\x28\x28\x00\x48\x04\x00\x00\x80\x01\x00\x10\x00\xf0"
+    "\x01\x81\x00\x45\x00\x48\x00\x48\x00\xd3\x08\x01\x01\x01\x14\x00\xb1\x02\x00\x12\x16\x07\x00\x0a\x0e\x00\x19\x12\x07\x00\x19\x18"
+    "\x07\x00\x30\x14\x00\xeb\x02\x00\x12\x16\x07\x00\x0a\x0e\x00\x04\xc0\x00\xc0\x08\x0e\x00\x4a\x03\x06\x00\x4a\x0a\x14\x00\xc2\xc0"
+    "\x00\x27\x0a\x14\x04\x00\x0f\x40\x02\x29\x30\xb1\x00\xc2\x00\x03\x70\x09\x01\x00\x00\x05\x00\xc9\x02\x00\x0f\x07\x00\x3a\x05\x02"
+    "\x00\x0f\x01\x00\x45\x03\x5a\x00\x11\x0a\x40\x02\x10\x4a\x02\x00\x02\x01\x02\x1a\x13\x0e\x00\x30\x05\x00\x29\x02\x00\x03\x07\x00"
+    "\x02\x15\x03\x01\xc0\x06\x42\x13\x00\x13\x07\x15\x00\x30\x06\x00\x5f\x02\x00\x0a\x0e\x00\x84\x01\x67\x01\x28\x01\xb4\x01\xb1\x6f"
+    "\x00\x0f\x80\x01\x10\x10\x76\x04\x00\x03\x80\x01\x00\x08\x00\x05\x04\x00\x25\x28\x28\x04\x00\x00\x80\x01\x11\x77\x80\x01\xc2\x4a"
+    "\x00\xc2\x00\x76\x00\x81\x0b\x01\x00\x01\x08\xb2\x00\x12\x08\x96\x00\x0a\x0e\x00\x03\x96\x00\x03\x07\x00\x12\x08\x9d\x00\x03\x07"
+    "\x00\x14\x09\xb2\x00\x01\x2a\x00\x0a\x0e\x00\x0f\xc0\x00\x55\x52\x0c\x01\x00\x01\x16\x7a\x00\x30\x16\x00\x14\x02\x00\x0c\x0e\x00"
+    "\x10\x2a\x02\x00\x03\x07\x00\x12\x15\xdc\x00\x03\x07\x00\x12\x14\xab\x00\x12\x17\xce\x00\x0a\x0e\x00\x0f\xc0\x00\x00\x09\xc0\x03"
+    "\x0f\x80\x07\x2e\x12\x29\x80\x07\x42\x0d\x01\x00\x00\x4f\x04\x24\x29\x07\x72\x04\x0a\x0e\x00\x30\x15\x00\x15\x55\x02\x03\x07\x00"
+    "\x07\x2b\x05\x22\x13\x08\x2a\x00\x03\x72\x04\x0a\x0e\x00\x0f\x00\x09\x4e\x12\xbb\x07\x00\x43\x0e\x01\x00\x01\xdd\x02\x19\x06\xeb"
+    "\x02\x03\x0e\x00\x0a\x40\x02\x30\x06\x00\x4f\x02\x00\x03\x07\x00\x14\x08\x55\x02\x0f\x0e\x00\x00\x0f\x80\x01\x00\x76\x4f\x0f\x19"
+    "\x00\x4f\x05\x0f\x04\x00\x0f\x40\x02\x2a\x30\x29\x00\x4f\x40\x02\x52\x0f\x01\x00\x01\x15\x7a\x00\x12\x17\x07\x00\x0a\x0e\x00\x19"
+    "\x13\x07\x00\x12\x15\x9d\x00\x03\x07\x00\x12\x17\x55\x02\x1f\x17\x0e\x00\x01\x0f\xc0\x00\x05\x40\x0f\x19\x00\x50\x04\x00\x4f\x1e"
+    "\x1e\x00\x50\xc0\x00\x31\x11\x10\x80\x01\x00\xeb\x08\x40\x2b\x06\x00\x0e\x07\x00\x0a\x0e\x00\x50\x06\x00\x0d\x00\x0e\x79\x01\x01"
+    "\x07\x00\x75\x05\x00\x2e\x00\x0e\x00\x2e\x07\x00\x03\x95\x01\x10\x2e\x02\x00\x0a\x0e\x00\x87\x01\x45\x01\x42\x01\x96\x01\xc7\xc0"
+    "\x00\x95\x36\x05\x0f\x00\x36\x0a\x14\x00\x37\x04\x00\x0f\x00\x06\x29\x30\x0d\x00\x36\x00\x06\x70\x11\x01\x00\x01\x0a\x00\x60\x02"
+    "\x00\x12\x0b\xd6\x02\x0a\x0e\x00\x12\x0c\x0e\x00\x03\x07\x00\x30\x0a\x00\x3f\x02\x00\x03\x07\x00\x14\x0d\x31\x00\x10\x84\x02\x00"
+    "\x0a\x0e\x00\x0f\xc0\x09\x00\x09\x40\x0b\x2f\x1d\x1d\xc0\x03\x2b\x22\x01\x18\xc0\x03\x70\x12\x01\x00\x01\x0c\x00\x1d\x02\x00\x30"
+    "\x0c\x00\x20\x02\x00\x0a\x0e\x00\x12\x0e\xb9\x00\x03\x07\x00\x0a\xc0\x00\x12\x0e\xab\x0c\x03\xb2\x00\x03\x0e\x00\x30\x0c\x00\xc1"
+    "\x02\x00\x0f\xc0\x00\x00\x00\x7c\x01\x50\x36\x0f\x19\x00\x37\x04\x00\x2f\x1f\x1f\x80\x01\x2c\x12\xc1\x80\x01\x51\x13\x01\x00\x00"
+    "\x0a\x32\x02\x21\xa3\x0a\x16\x0b\x1a\xa3\x0e\x00\x57\x0c\x00\x0d\x00\xbf\x07\x00\x03\xa4\x00\x03\xb9\x00\x10\x10\x15\x00\x05\xc7"
+    "\x00\x08\x0e\x00\x0f\x80\x04\x4e\x12\x0d\x07\x00\x4c\x14\x01\x00\x00\x80\x01\x12\x10\x0e\x00\x10\x10\x0e\x00\x30\x0d\x00\x1d\x8f"
+    "\x00\x32\x0d\x00\x20\x07\x00\x10\x25\x02\x00\x05\x07\x00\x10\xea\x02\x00\x50\x0f\x00\x10\x00\x25\x1c\x00\x08\x0e\x00\x0f\xc0\x00"
+    "\x4e\x12\x1d\x07\x00\x20\x15\x01\xcb\x00\x01\xb2\x0c\x12\x0f\x81\x00\x0a\x0e\x00\x00\x8f\x00\x01\x0e\x00\x01\x07\x00\x12\x0e\xb9"
+    "\x00\x03\x07\x00\x50\x0f\x00\xa5\x00\x11\x1c\x00\x10\xa5\xb2\x00\x0a\x0e\x00\x0f\xc0\x00\x4e\x12\xa5\x07\x00\x1f\x16\xc0\x0c\xaa"
+    "\x31\x00\x81\x17\x80\x01\x01\x3a\x04\x30\x0e\x00\x6d\x02\x00\x0a\x0e\x00\x12\x0f\x0e\x00\x03\x07\x00\x12\x0e\x24\x05\x03\x07\x00"
+    "\x14\x10\x23\x00\x01\x6a\x08\x0a\x0e\x00\x0f\xc0\x0c\x55\x30\x18\x01\x00\xcb\x0e\x07\xb2\x00\x0a\x0e\x00\x03\x96\x00\x05\x07\x00"
+    "\x53\x13\x00\x7e\x00\x13\x07\x00\x14\x0f\xce\x00\x10\x7e\x10\x00\x0a\x0e\x00\x0f\xc0\x00\x55\x42\x19\x01\x00\x00\x7a\x09\x22\x5c"
+    "\x15\x07\x00\x0a\x0e\x00\x1f\x16\x07\x00\x00\x13\x13\x07\x00\x12\x17\x07\x00\x1f\x18\x0e\x00\x01\x0f\xc0\x00\x55\x20\x1a\x01\x0b"
+    "\x12\x10\x34\x02\x00\x14\x10\x08\x02\x19\x53\x0e\x00\x10\x51\x02\x00\x05\x07\x00\x10\x34\x1e\x00\x03\x07\x00\x30\x0d\x00\xf1\x02"
+    "\x00\x30\x0d\x00\x80\x02\x00\x05\x0e\x00\x10\xd1\x02\x00\x0f\xc0\x03\x4e\x12\xd1\x07\x00\x16\x1b\xc0\x00\x19\x11\xc0\x00\x05\x0e"
+    "\x00\x0f\xc0\x00\x07\x12\x0f\xb2\x00\x12\x0f\xc0\x00\x0a\x0e\x00\x0f\xc0\x00\x4e\x12\x34\x07\x00\x1f\x1c\x80\x13\xac\x1f\x1d\xc0"
+    "\x00\xac\x1f\x1e\x80\x16\xac\x11\x1f\x40\x0e\x10\x62\x02\x00\x03\xf2\x0b\x0a\x0e\x00\x12\x18\x0e\x00\x03\x07\x00\x30\x16\x00\x56"
+    "\x02\x00\x03\x07\x00\x03\xf2\x0b\x1f\x18\x0e\x00\x01\x0c\x00\x0c\x03\xc0\x00\x1f\x74\x80\x01\x1c\x17\x74\x80\x01\x13\x74\x7c\x01"
+    "\x10\x75\x08\x00\xa0\x00\x62\x00\x48\x00\x74\x00\x81\x20\x01\x84\x07\x0f\xc0\x00\x4f\x0f\x01\x00\x3e\x00\x42\x02\x4f\x00\x00\x00"
+    "\x21\x80\x01\x57\x04\x7c\x01\x10\x75\x04\x00\x4f\x1e\x1e\x00\x75\x80\x01\x2c\x10\x74\x80\x01\x54\x22\x01\x00\x00\x17\xa4\x00\x03"
+    "\x39\x0e\x08\x0e\x00\x12\x19\x0e\x00\x03\x07\x00\x14\x17\xab\x00\x01\x07\x00\x12\x18\xb2\x00\x1f\x19\x0e\x00\x01\x0f\x80\x01\x55"
+    "\x20\x23\x00\x82\x19\x0f\x01\x00\x47\x8f\x0f\x18\x00\x62\x17\x1c\x00\xd5\x80\x04\x45\x51\x24\x01\x00\x01\x0d\x9d\x15\x21\xb3\x0e"
+    "\x24\x11\x1a\x29\x0e\x00\x12\x0f\x0e\x00\x03\x07\x00\x12\x10\x15\x00\x03\x07\x00\x30\x0f\x00\xb4\x02\x00\x12\x11\x07\x00\x0a\x0e"
+    "\x00\x0f\x80\x0d\x00\x94\x76\x0a\x14\x00\x76\x0f\x19\x00\x77\x04\x00\x0b\xc0\x00\x0f\xc0\x0f\x1b\x30\xb3\x00\x76\xc0\x0f\x11\x25"
+    "\xc0\x00\x01\x2b\x02\x03\x81\x09\x0a\x0e\x00\x30\x0e\x00\x42\x02\x00\x05\x07\x00\x03\xdc\x09\x03\x07\x00\x01\xc7\x12\x00\xce\x09"
+    "\x06\x0e\x00\x30\x0f\x00\xb7\x02\x00\x0f\x00\x03\x00\x0f\xc0\x00\x3b\x12\xb7\xc0\x00\x11\x26\x40\x0b\x01\x7a\x00\x12\x0d\xa4\x00"
+    "\x0a\x0e\x00\x14\x0f\x96\x00\x01\x07\x00\x0a\xc0\x00\x14\x0f\xd5\x00\x03\xf1\x00\x08\x0e\x00\x0f\x00\x03\x4e\x12\x4a\x07\x00\x70"
+    "\x27\x01\x00\x01\x1f\x00\x4b\x02\x00\x30\x20\x00\x43\x02\x00\x0c\x0e\x00\x01\xb9\x00\x03\x07\x00\x12\x1e\x15\x09\x03\x07\x00\x12"
+    "\x1c\xb2\x00\x12\x1e\xb9\x03\x0a\x0e\x00\x0f\x80\x01\x01\x21\x14\x1e\x04\x00\x14\x77\x04\x00\x0f\x80\x01\x2a\x12\x4b\x80\x01\x43"
+    "\x28\x01\x00\x01\x2b\x02\x19\x11\x39\x02\x03\x0e\x00\x03\x1d\x02\x05\x07\x00\x01\xa4\x00\x05\x07\x00\x03\x40\x02\x03\xea\x09\x08"
+    "\x0e\x00\x0f\x40\x02\x4e\x12\x29\xc0\x00\x11\x29\xc0\x00\x03\x81\x03\x10\xcb\x02\x00\x0a\x0e\x00\x20\x11\x00\x02\x00\x13\xa4\x07"
+    "\x00\x02\xc7\x03\x13\x30\x07\x00\x70\x10\x00\x30\x00\xb4\x00\xb3\x1a\x00\x1c\xb4\x0e\x00\x0f\xc0\x03\x00\x72\x81\x0a\x14\x00\x81"
+    "\x05\x0f\x04\x00\x29\x32\x32\xbc\x00\x00\x04\x00\x0f\x40\x0e\x1b\x30\xb4\x00\x81\x40\x0e\x1f\x2a\x00\x09\x54\x04\xbc\x00\x45\x0a"
+    "\x14\x00\x82\x04\x00\x0a\xc0\x00\x01\x04\x00\x03\xc0\x00\x04\x04\x00\x10\x82\x08\x00\x03\xb8\x00\x13\x82\x08\x00\x01\x04\x00\xf0"
+    "\x00\x00\x00\x00\x81\x00\x82\x00\x81\x2b\x01\x00\x01\x17\x00\x72\x02\x00\x30\x16\x00\x46\x02\x00\x0a\x0e\x00\x12\x16\x39\x1d\x03"
+    "\x07\x00\x30\x18\x00\x6c\x02\x00\x05\x07\x00\x01\x23\x00\x1f\x1a\x0e\x00\x01\x0c\x80\x01\x21\x14\x1e\xbc\x0f\x54\x3c\x14\x1e\x00"
+    "\x3d\x04\x00\x0f\x80\x01\x14\x1b\xdf\x80\x01\x00\x10\x00\x31\x81\x00\x72\xc0\x0f\x80\xdf\x2c\x01\x00\x00\x15\x00\xdc\x02\x00\x05"
+    "\xe4\x17\x08\x0e\x00\x30\x16\x00\xe1\x02\x00\x03\x07\x00\x12\x17\x1c\x00\x03\x07\x00\x00\x2a\x18\x10\x7c\x71\x08\x10\x7c\x02\x00"
+    "\x0a\x0e\x00\x0f\x80\x04\x4e\x12\xdc\x07\x00\x1f\x2d\xc0\x00\xac\x11\x2e\x80\x0a\x03\x96\x00\x03\xb2\x00\x08\x0e\x00\x14\x17\xb9"
+    "\x00\x01\x07\x00\x12\x18\x1c\x00\x03\x07\x00\x00\xe3\x09\x10\x7c\x31\x09\x01\xb2\x00\x0a\x0e\x00\x0f\xc0\x00\x55\x1f\x2f\xc0\x00"
+    "\xac\x1f\x30\x80\x04\x5c\x26\x02\x0a\x04\x00\x0f\x40\x05\x2a\x00\x80\x04\x4f\x3c\x00\x81\x31\xc0\x00\x5c\x44\x05\x0f\x00\x93\x04"
+    "\x00\x0f\x40\x05\x10\x17\x93\x40\x05\x13\x93\x08\x00\x15\x94\xc0\x00\x41\x93\x00\x81\x32\x40\x05\x01\x3a\x07\x12\x17\x39\x08\x0a"
+    "\x0e\x00\x19\x18\x07\x00\x30\x14\x00\xd8\x02\x00\x03\x07\x00\x12\x19\x15\x00\x30\x1b\x00\xe3\x02\x00\x0a\x0e\x00\x0f\xc0\x06\x05"
+    "\x0f\x80\x01\x35\x22\x01\x4d\x80\x01\x11\x33\xc0\x21\x01\xb2\x00\x12\x02\x64\x1c\x0a\x0e\x00\x12\x02\x39\x08\x05\x07\x00\x03\x1c"
+    "\x00\x01\x07\x00\x11\x03\x23\x00\x13\x4a\xce\x1e\x0a\x0e\x00\x0f\x00\x12\x4e\x03\xc0\x09\x45\x34\x01\x01\x01\xb2\x00\x01\xf2\x08"
+    "\x0a\x0e\x00\x0a\xb2\x00\x19\x04\x07\x00\x12\x03\x23\x00\x00\x32\x1d\x01\x38\x00\x03\x0e\x00\x10\xce\x02\x00\x04\xc0\x03\x40\x04"
+    "\x08\x00\xce\x04\x21\x0f\x00\x03\x10\x0f\x00\x09\x1b\x30\xce\x00\x81\x00\x09\x18\x35\x40\x02\x03\x40\x0e\x08\x0e\x00\x03\x16\x02"
+    "\x03\x07\x00\x30\x14\x00\xca\x02\x00\x03\x07\x00\x12\x19\x07\x00\x03\xaa\x04\x0a\x0e\x00\x0f\x80\x1c\x00\x0f\xc0\x00\x3b\x12\x4a"
+    "\xc0\x00\xc2\x36\x01\x00\x01\x23\x00\x53\x00\x53\x00\xa4\x23\x01\x14\x12\x22\xcf\x1a\x12\x21\x07\x00\x12\x20\x07\x00\x14\x1f\x0e"
+    "\x00\x10\x2c\x02\x00\x11\x1f\x2b\x02\x40\x15\x22\x00\x16\x02\x00\x12\x1f\x72\x0a\x12\x21\x07\x00\x1f\x28\xc0\x1b\x0a\x54\x56\x0f"
+    "\x19\x00\x78\x04\x00\x0b\xc0\x00\x0f\x00\x12\x1b\x12\x84\x00\x12\x1f\x37\x80\x04\x54\xa6\x23\x23\x00\x3c\x1e\x1e\x00\x81\x23\x23"
+    "\x04\x00\x0f\x80\x04\x0c\x0f\xc0\x03\x01\x05\x04\x00\x04\xc0\x18\x1f\x38\xc0\x00\x5b\x10\x3c\x08\x00\x04\x04\x00\x04\x74\x04\x03"
+    "\x04\x00\x01\x84\x04\x0b\x7c\x04\x01\xc8\x00\x0b\xbc\x00\x01\x84\x04\x01\xc0\x00\x50\x81\x00\x3c\x39\x01\xc4\x15\x01\xeb\x02\x14"
+    "\x20\x48\x0d\x10\x36\x02\x00\x12\x1d\x07\x00\x03\x4f\x0d\x30\x20\x00\x37\x02\x00\x12\x1b\x2a\x00\x12\x1a\x07\x00\x12\x1b\x23\x00"
+    "\x12\x1a\x07\x00\x0a\x0e\x00\x0f\x80\x07\x4e\x12\x29\x07\x00\x52\x3a\x01\x00\x00\x20\xb3\x11\x19\x22\xc0\x00\x12\x22\x15\x00\x03"
+    "\xd5\x00\x12\x22\xc0\x00\x12\x1d\xb9\x00\x05\xf1\x00\x01\x15\x00\x03\x31\x00\x0f\xc0\x00\x5c\x12\x56\x07\x00\x52\x3b\x01\x00\x00"
+    "\x21\xab\x00\x12\x23\xab\x00\x12\x1e\x81\x00\x12\x23\x15\x00\x12\x21\x15\x00\x12\x23\xab\x00\x12\x1e\xb9\x00\x03\xc7\x00\x14\x21"
+    "\xd5\x00\x01\x31\x00\x0a\xc7\x00\x0f\xc0\x00\x55\x20\x3c\x01\xc4\x12\x10\x57\x02\x00\x14\x24\x2b\x02\x08\x80\x01\x03\x95\x01\x12"
+    "\x24\xab\x00\x12\x20\xb9\x00\x12\x1f\x07\x00\x03\x95\x01\x12\x24\x3f\x00\x03\x38\x00\x1f\x1f\xc0\x00\x54\x12\x57\x07\x00\x52\x3d"
+    "\x01\x00\x01\x25\x81\x00\x14\x28\x2b\x02\x08\xc0\x00\x12\x26\x4f\x0a\x12\x26\xab\x00\x12\x27\x23\x00\x12\x26\x07\x00\x12\x25\x15"
+    "\x00\x14\x26\x3f\x00\x01\x2a\x00\x03\x07\x00\x0c\xc0\x00\xf0\x01\x1e\x28\x00\x56\x1e\x28\x00\x74\x23\x2d\x00\x50\x32\x32\x00\x50"
+    "\x08\x00\x0b\x7c\x04\x08\x80\x13\x1b\x36\x00\x15\x00\x3c\x0e\x08\x00\x15\x11\x75\x9e\x00\xa0\x74\x00\x81\x3e\x01\x00\x01\x2d\x00"
+    "\xc3\x02\x00\x30\x30\x00\xd0\x02\x00\x05\x0e\x00\x01\x9d\x00\x30\x30\x00\xd9\x02\x00\x12\x2f\x07\x00\x02\x1c\x00\x13\xc8\x07\x00"
+    "\x12\x30\xc7\x00\x30\x14\x00\xf6\x02\x00\x03\x0e\x00\x12\x0f\x0e\x00\x0f\xc0\x00\x00\x94\x77\x23\x2d\x00\x77\x1e\x28\x00\x76\x04"
+    "\x00\x0f\xc0\x06\x2a\x30\xc3\x00\x77\xc0\x06\x18\x3f\xc0\x00\x10\xd7\x02\x00\x12\x2e\x9d\x09\x0a\xc0\x00\x1f\x32\xc0\x00\x85\x52"
+    "\x40\x01\x00\x01\x32\xb9\x00\x03\xb2\x00\x0a\x80\x01\x03\x79\x01\x0f\x80\x01\x7f\x12\xd7\xc0\x00\x1f\x41\xc0\x06\x54\x40\x14\x1e"
+    "\x00\xc2\x04\x00\x44\x1e\x28\x00\xc3\x04\x00\x0f\x80\x07\x0c\x05\x84\x07\x07\x38\x11\x08\x80\x07\x93\xc2\x00\x81\x00\x81\x42\x01"
+    "\x01\x00\xab\x0f\x12\x13\xb9\x09\x14\x14\xab\x18\x10\x63\x02\x00\x12\x13\x6b\x13\x12\x14\x56\x28\x82\x12\x00\xc2\x00\xc2\x00\x29"
+    "\x14\x80\x01\x11\x14\xd5\x09\x22\x2a\x16\x6a\x14\x12\x17\x3f\x03\x03\x07\x00\x04\x80\x01\x8f\x14\x1a\x00\x62\x1c\x1f\x00\x63\xe3"
+    "\x00\x10\x0f\x01\x00\x1b\x12\x2a\x07\x00\x52\x43\x01\x00\x01\x29\xf2\x11\x30\x2a\x00\x4d\x02\x00\x0a\x0e\x00\x12\x2a\x39\x02\x03"
+    "\x07\x00\x30\x2c\x00\x4e\x02\x00\x03\x07\x00\xea\x29\x00\x54\x00\x54\x00\xd7\x2b\x00\x55\x00\x55\x00\xd7\x0e\x00\x0c\xc0\x09\xc0"
+    "\x1e\x28\x00\x3d\x23\x2d\x00\x3d\x1e\x28\x00\x3c\x04\x00\x2f\x30\x30\xc0\x21\x2c\x30\x72\x00\x3d\x42\x08\x52\x44\x01\x00\x01\x2a"
+    "\x5d\x01\x14\x2c\xab\x00\x08\x0e\x00\x12\x2b\xce\x03\x12\x2b\x40\x0b\x12\x2a\x07\x00\x12\x29\x07\x00\x19\x2d\x00\x03\x03\x0e\x00"
+    "\x0f\x00\x03\x14\x2f\x32\x32\x00\x15\x0e\x13\x77\x0c\x00\x00\xf0\x02\x00\x40\x05\x00\x08\x00\x05\x0c\x00\x40\x00\x5f\x00\x77\x80"
+    "\x13\x52\x45\x01\x00\x00\x33\x7a\x00\x12\x30\xb9\x00\x0a\x0e\x00\x14\x30\x8e\x04\x01\x15\x00\x03\x87\x04\x03\x07\x00\x12\x33\xe3"
+    "\x03\x03\xc0\x00\x03\x0e\x00\x0f\xc0\x00\x04\x0f\x01\x00\x3e\x03\x40\x02\x45\x46\x01\x00\x00\x4f\x04\x07\x80\x04\x15\xc8\x47\x05"
+    "\x08\x80\x04\x30\x1e\x00\xf7\x02\x00\x05\xa3\x04\x0f\x80\x04\x17\x0f\x01\x00\x3e\x12\xc3\x07\x00\x11\x47\x00\x06\x0f\x40\x05\x06"
+    "\x1a\xc8\x40\x05\x14\x1e\x2b\x02\x0f\x40\x05\x76\x1f\x48\x40\x05\x54\xc4\x19\x19\x00\x48\x19\x19\x00\xc3\x19\x19\x00\x49\x04\x00"
+    "\x0b\xc0\x00\x0f\xc0\x30\x05\x04\xbc\x30\x0a\xc0\x30\x00\xc0\x1b\x4f\x48\x01\x71\x49\x80\x1c\x4c\x00\x3c\x05\xf4\x01\x18\x1b\x00"
+    "\x62\x23\x23\x00\x48\x1e\x1e\x00\x48\x23\x23\x00\x49\x04\x00\x0f\x00\x09\x08\x0f\x80\x1c\x10\x20\x01\x6e\x80\x1c\x1f\x4a\x80\x0d"
+    "\x57\x0f\xc0\x00\x0d\x0f\x00\x21\x22\x1f\x4b\xc0\x00\xac\x1f\x4c\x40\x14\x55\x51\x0a\x00\x3c\x05\x05\xa4\x06\x00\xb8\x06\x04\x04"
+    "\x00\x0f\xc0\x06\x27\x03\xc0\x0f\x1f\x4d\xc0\x00\x57\x31\x76\x05\x05\x64\x04\x00\xb8\x06\x04\x04\x00\x0f\x80\x04\x27\x12\x00\xc0"
+    "\x1b\x1f\x4e\xc0\x03\x4c\x8f\x18\x25\x00\x32\x20\x23\x00\xd5\x40\x02\x3f\x20\x01\x16\x40\x02\x1f\x4f\x80\x0a\x55\x51\x14\x00\x58"
+    "\x0f\x0f\x04\x00\x14\x59\x04\x00\x0f\x37\x00\x10\x0f\x01\x00\x09\x10\x58\x05\x00\x1f\x50\xc0\x00\x57\x20\x81\x0f\x80\x1c\x0a\x74"
+    "\x01\x0d\x04\x00\x0b\x40\x0b\x0f\x80\x1c\x0e\x1f\x51\x80\x04\xac\x51\x52\x01\x00\x00\x18\x00\x15\x22\x25\x14\xfa\x28\x11\x14\x88"
+    "\x33\x22\xbb\x15\xdd\x14\x12\x16\xf2\x14\x12\x18\x07\x00\x12\x15\xb9\x2d\x12\x14\xdc\x1e\x30\x14\x00\x32\x02\x00\x12\x16\x15\x00"
+    "\x12\x16\x38\x00\x1f\x18\x40\x29\x54\x12\x80\x07\x00\x51\x53\x01\x00\x01\x1c\xba\x0b\x24\x14\x1c\xd6\x20\x08\x0e\x00\x12\x20\x07"
+    "\x0c\x03\x07\x00\x11\x1e\x1c\x00\x15\x54\x07\x00\x00\x23\x00\x40\xc3\x1e\x00\x18\x02\x00\x0a\x0e\x00\x0d\x00\x0c\x11\x1e\x40\x08"
+    "\x00\x84\x01\x14\x49\x04\x00\x0f\x80\x01\x2a\x12\x54\x80\x01\x15\x54\xc0\x00\x22\xc3\x1c\x7a\x00\x0a\x0e\x00\x05\x96\x00\x03\x07"
+    "\x00\x01\xdc\x00\x03\x07\x00\x05\xd5\x00\x00\xb2\x0c\x1a\xc3\x0e\x00\x0d\xc0\x1e\x00\xbc\x24\x11\x0f\x98\x00\x14\x49\x04\x00\x0f"
+    "\xc0\x00\x2b\x20\x01\x72\xc0\x00\x52\x55\x01\x00\x01\x27\x72\x0d\x12\x28\x81\x00\x0a\x0e\x00\x12\x28\x79\x0a\x03\x07\x00\x11\x2a"
+    "\x79\x0d\x13\xd7\x07\x00\x02\x72\x0d\x12\x4e\x72\x0d\x03\x8e\x0d\x04\x0e\x00\x0c\xc0\x00\x00\x78\x06\x00\xb4\x15\x44\x28\x28\x00"
+    "\x3d\x04\x00\x0f\xc0\x06\x2a\x02\x80\x1f\x21\x81\x56\xc0\x36\x01\x4f\x13\x03\x39\x38\x0a\x0e\x00\x05\xd6\x35\x01\x07\x00\x12\x0c"
+    "\x5d\x34\x03\x07\x00\x14\x0a\x23\x00\x10\x23\x02\x00\x0a\x0e\x00\x0f\xc0\x15\x55\x11\x57\x00\x33\x10\x68\x02\x00\x03\x81\x00\x0a"
+    "\x0e\x00\x12\x0c\xc0\x0f\x03\x07\x00\x0a\xce\x00\x12\x0e\xb9\x0f\x12\x0d\x31\x00\x0a\x0e\x00\x0f\xc0\x00\x4e\x12\x68\x07\x00\x52"
+    "\x58\x01\x01\x00\x0c\x73\x00\x14\x0c\xb2\x00\x08\x0e\x00\x12\x10\x47\x0e\x03\x07\x00\x12\x0a\xb9\x00\x03\x07\x00\x30\x0e\x00\x69"
+    "\x02\x00\x30\x0e\x00\x73\x02\x00\x0a\x0e\x00\x04\xc0\x00\x50\x0c\x10\x00\x4a\x11\x30\x39\x0f\x01\x00\x3d\x03\xc0\x00\x11\x59\x40"
+    "\x17\x03\x72\x25\x03\xc0\x15\x08\x0e\x00\x12\x21\xf9\x02\x03\x07\x00\x12\x22\xc7\x00\x03\x07\x00\x12\x24\x07\x00\x30\x23\x00\x6f"
+    "\x02\x00\x0a\x0e\x00\x0f\x80\x01\x4e\x12\x4b\x07\x00\x16\x5a\xc0\x42\x05\x24\x1d\x08\x0e\x00\x02\xc7\x42\x06\x07\x00\x08\xce\x42"
+    "\x55\x06\x00\xa2\x00\xa2\xb2\x42\x0a\x0e\x00\x0f\x00\x06\x4d\x22\x01\x05\x08\x00\x11\x5b\x00\x1e\x10\xa5\xf2\x35\x05\x9d\x00\x00"
+    "\x00\x36\x13\x0e\x07\x42\x02\x2b\x41\x03\x07\x00\x30\x0d\x07\x00\x89\x34\x15\xa4\x07\x00\x10\xa6\x95\x25\x72\x0a\x00\xa6\x00\xa5"
+    "\x00\x0f\x0e\x00\x12\x0e\x78\x41\x1f\x0d\x00\x36\x55\x11\x5c\x40\x3e\x01\xab\x1e\x02\x3a\x40\x1a\x29\x0e\x00\x12\x08\x47\x3b\x03"
+    "\x07\x00\x30\x06\x00\x27\x02\x00\x03\x07\x00\x12\x0a\x23\x06\x12\x08\x31\x00\x0a\x0e\x00\x0f\x80\x01\x4e\x00\x42\x14\x41\x00\x00"
+    "\x00\x5d\xc0\x39\x0f\xc0\x00\x40\x0c\x80\x40\x0f\x00\x0c\x3d\x12\x15\x00\x0c\x11\x5e\x00\x2a\x00\x39\x02\x21\x2b\x0d\x24\x26\x1a"
+    "\x34\x0e\x00\x11\x0e\x5c\x32\x13\x45\x07\x00\x02\xc7\x36\x13\x2c\x07\x00\x14\x0c\x07\x39\x01\x07\x00\x0a\x0e\x00\x0f\xc0\x45\x55"
+    "\x11\x5f\x80\x2b\x0f\xc0\x00\x17\x01\x07\x33\x03\x07\x00\x0f\xc0\x00\x0a\x0e\x80\x01\x71\x36\x05\x05\x00\x36\x0a\x0a\xb8\x39\x04"
+    "\x04\x00\x0f\x80\x07\x27\x12\x10\xc0\x39\x54\x60\x01\x00\x00\x11\xc0\x33\x00\xfa\x01\x1a\xc6\x0e\x00\x12\x12\x5d\x0a\x03\x07\x00"
+    "\x12\x13\xd5\x09\x05\x07\x00\x10\x35\x02\x00\x00\xdc\x36\x3a\x25\x00\xe4\x0e\x00\x0f\xc0\x33\x55\x16\x61\xc0\x00\x11\x13\xe4\x29"
+    "\x1a\x5d\x0e\x00\x12\x0f\x4f\x01\x03\x07\x00\x02\xc7\x00\x13\xa4\x07\x00\x02\x15\x2a\x40\x25\x0f\x00\x40\x02\x00\x0a\x0e\x00\x0f"
+    "\xc0\x00\x55\x11\x62\x40\x02\x03\xcf\x2c\x01\x7a\x03\x0c\x0e\x00\x00\x07\x00\x13\x14\x07\x00\x02\x1d\x38\x15\x13\x07\x00\x00\x23"
+    "\x0c\x03\x15\x00\x1a\x14\x0e\x00\x0d\x00\x21\x12\x0f\xa0\x03\x44\x0f\x0f\x00\x77\x04\x00\x0f\xc0\x03\x29\x22\x01\x2f\xc0\x03\x42"
+    "\x63\x01\x00\x01\x0f\x2f\x40\xc3\x11\x00\x64\x02\x00\x0c\x0e\x00\x03\x1d\x2c\x01\x07\x00\x11\x12\xa4\x00\x15\xc3\x07\x00\x30\x14"
+    "\x00\x7d\xb2\x00\x10\x7d\x02\x00\x0a\x0e\x00\x0f\xc0\x00\x4d\x04\x80\x04\x11\x64\x00\x39\x01\x5d\x3d\x05\xa4\x39\x08\x0e\x00\x0a"
+    "\xb2\x03\x12\x10\x1c\x00\x05\x07\x00\x10\x61\x02\x00\x0f\x07\x00\x02\x0f\x40\x02\x4e\x12\x60\x07\x00\x11\x65\x00\x24\x10\x21\x02"
+    "\x00\x30\x17\x00\x1e\x02\x00\x0a\x0e\x00\x12\x19\xf9\x2c\x03\x07\x00\x02\x24\x0e\x13\xc3\x07\x00\x1f\x18\x07\x00\x01\x30\x19\x00"
+    "\x71\x02\x00\x0c\x80\x01\x0f\xc0\x15\x3e\x11\x71\x80\x46\x21\x81\x66\x00\x33\x0f\xc0\x00\x15\x0a\xab\x00\x5c\x1a\x00\xbc\x00\xbc"
+    "\x07\x00\x04\xc0\x00\x0f\x80\x01\x4d\x12\x21\x07\x00\x1f\x67\xc0\x00\x1a\x0f\x80\x01\x18\x0f\xc0\x00\x54\x70\x68\x01\x00\x00\x1a"
+    "\x00\x58\x02\x00\x11\x1b\x96\x03\x1a\x58\x0e\x00\x12\x1c\x0e\x00\x03\x07\x00\x11\x1d\x15\x00\x13\xc6\x07\x00\x30\x1b\x00\xda\x02"
+    "\x00\x30\x1e\x00\x59\x02\x00\x0a\x0e\x00\x0f\xc0\x00\x4e\x01\xbe\x12\x31\x00\x00\x69\x00\x24\x01\xab\x00\x50\x1b\x00\x58\x00\xda"
+    "\xab\x00\x08\x0e\x00\x14\x1d\xb9\x00\x01\x07\x00\x11\x1e\x1c\x00\x13\x59\x07\x00\x12\x1d\xb2\x00\x12\x20\xb2\x00\x0a\x0e\x00\x0f"
+    "\xc0\x00\x4e\x12\x16\x07\x00\x1f\x6a\x80\x01\x20\x13\x59\x07\x00\x0f\x80\x01\x71\x52\x6b\x01\x00\x01\x1e\x72\x10\x12\x19\x07\x00"
+    "\x0a\x0e\x00\x19\x23\x07\x00\x19\x14\x07\x00\x00\x2a\x00\x60\x7a\x00\x72\x1c\x00\x7a\x02\x00\x0a\x0e\x00\x0c\x80\x04\x0f\x80\x13"
+    "\x3e\x12\x72\x00\x12\x11\x6c\xc0\x4e\x07\x81\x2a\x04\x5d\x4c\x03\x0e\x00\x05\x4e\x0b\x01\x07\x00\x11\x04\x24\x11\x04\x07\x00\x12"
+    "\x06\x63\x11\x11\x07\x8e\x01\x0b\x0e\x00\x0f\xc0\x09\x00\x0f\x00\x18\x3b\x12\x13\x40\x11\x11\x6d\x80\x49\x00\x6b\x0a\x8a\x30\x0a"
+    "\x00\x45\x00\xbf\x00\x2b\x0e\x00\x12\x09\xf9\x08\x03\x07\x00\x12\x0c\x64\x31\x03\x07\x00\x30\x08\x00\x30\x2c\x00\x11\x0e\x0e\x00"
+    "\x1a\x31\x0e\x00\x0f\x00\x0c\x4e\x12\x45\x80\x07\x11\x6e\xc0\x00\x00\x32\x0b\x01\xb2\x00\x10\x45\xc0\x00\x0a\x0e\x00\x32\x30\x00"
+    "\x10\x9d\x00\x3a\x10\x00\x31\xce\x00\x11\x0a\x55\x05\x12\x46\xb2\x00\x1a\x45\x0e\x00\x0f\xc0\x00\x4d\x22\x01\xab\xc0\x00\x1f\x6f"
+    "\x40\x4a\x1c\x08\x00\x48\x05\x32\x4a\x0f\x0e\x00\x00\x0c\x80\x10\x03\x8c\x00\x13\x4f\x18\x20\x01\x04\x00\x0f\x80\x01\x2a\x03\x40"
+    "\x35\x52\x70\x01\x00\x00\x0f\x48\x16\x12\x11\x07\x00\x0a\x0e\x00\x19\x13\x07\x00\x19\x0d\x07\x00\x30\x13\x00\x33\x02\x00\x12\x18"
+    "\x07\x00\x03\x0e\x00\x12\x1d\x07\x00\x0f\x40\x11\x4e\x12\x32\x07\x00\x1f\x71\x00\x12\xac\x3f\x72\x01\x01\xc0\x00\x4a\x64\x18\x20"
+    "\x00\x4a\x1e\x21\x6e\x00\x0f\x01\x00\x38\x03\x52\x00\x1f\x73\x00\x12\xac\x11\x74\xc0\x00\x01\xb2\x48\x05\x07\x00\x01\xb2\x00\x03"
+    "\xce\x00\x09\xc0\x00\x17\xa3\xc0\x00\x10\x11\x07\x00\x01\xd5\x09\x30\x04\x00\x19\x02\x00\x11\x07\x07\x00\x04\x0e\x00\x0c\x00\x4b"
+    "\x0f\x01\x00\x3d\x22\x01\x91\x08\x00\x51\x75\x01\x01\x01\x27\x3a\x16\x65\x2a\x26\x00\x2f\x00\x2f\xdd\x29\x11\x26\x8f\x0f\x40\x2f"
+    "\x28\x00\x52\x02\x00\x12\x27\x16\x2f\x30\x28\x00\x65\x02\x00\x12\x25\xeb\x2f\x12\x27\xb2\x0f\x12\x28\x79\x16\x11\x27\x2a\x00\x12"
+    "\x43\x40\x2f\x14\x43\x40\x02\xf4\x05\x16\x18\x00\x4a\x1a\x1e\x00\x4b\x28\x28\x00\x36\x23\x23\x00\x36\x28\x28\x00\x37\x04\x00\x0b"
+    "\x80\x04\x01\x04\x00\x03\xb4\x06\x08\x88\x04\x04\xbc\x06\x00\x34\x18\x00\xc4\x1b\x01\x04\x00\x22\x00\x2a\xc0\x06\x11\x76\x80\x25"
+    "\x01\x73\x0f\x11\x28\xc0\x00\x22\x2f\x29\xc0\x00\x02\xd5\x00\x22\x43\x29\xc0\x00\x12\x2a\xc0\x00\x12\x29\xc0\x00\x12\x2a\xc0\x00"
+    "\x12\x29\xf8\x00\x12\x2a\x07\x00\x0a\x0e\x00\x0c\xc0\x03\x0f\xc0\x00\x3e\x12\x40\xc0\x00\x52\x77\x01\x01\x01\x2e\xc0\x00\x12\x2d"
+    "\xc0\x00\x12\x2f\xc0\x00\x12\x2d\xc0\x00\x12\x2d\xc0\x00\x12\x2d\xc0\x00\x12\x2e\xc0\x00\x12\x2f\x15\x00\x01\x2f\x00\x32\x00\x2f"
+    "\x31\xce\x00\x0a\x0e\x00\x0f\x80\x01\x4e\x03\xc0\x00\x00",
+    5518, 23040);
+
+const Resource black(
+    "\x8f\x00\x00\x00\x03\x01\x32\x01\x00\x01\x00\x7d\x4d\x26\x02\x05\x0f\x04\x00\x3c\x0a\x05\x14\x04\x00\x80\x76\x00\x23\x37\x26\x02"
+    "\x23\x37\x08\x00\x07\x04\x00\xc1\x3c\x26\x0a\x23\x3c\x77\x00\x23\x46\x77\x00\x2d\x04\x00\x0f\xe8\x00\x85\x4c\x50\x02\x0a\x19\x04"
+    "\x00\x44\x52\x02\x0a\x1e\x04\x00\x13\x51\x04\x00\x80\x62\x00\x23\x37\xaa\x00\x23\x37\x08\x00\x22\x72\x01\x04\x00\xf1\x00\xaa\x00"
+    "\x23\x3c\x72\x01\x23\x3c\x63\x00\x23\x46\xab\x00\x2d\x04\x00\x13\x08\xe8\x00\xf1\x02\x18\x02\x1e\x1e\x68\x02\x1e\x1e\x18\x02\x1f"
+    "\x1f\x68\x02\x1f\x1f\x6a\x04\x00\x71\x20\x20\x18\x02\x20\x20\x68\x08\x00\x64\x21\x21\x68\x02\x21\x21\x08\x00\x0f\xab\x00\x10\x0f"
+    "\x01\x00\x2a\x4f\x6a\x02\x0f\x23\x04\x00\x00\x14\x28\x04\x00\x13\x19\x04\x00\x80\x53\x01\x23\x37\x6a\x02\x23\x37\x08\x00\x07\x04"
+    "\x00\xc1\x3c\x6a\x02\x23\x3c\x54\x01\x23\x46\x54\x01\x2d\x04\x00\x0f\xe8\x00\xff\xbe\x0f\xa0\x03\x85\x0f\xd0\x01\x3e\x12\x08\xe4"
+    "\x00\xf0\x0f\xf8\x01\x08\x08\xfd\x01\x08\x08\xf8\x01\x09\x09\xfd\x01\x09\x09\x05\x02\x08\x08\x05\x02\x0a\x0a\xf8\x01\x0a\x0a\xfd"
+    "\x01\x08\x00\x64\x0b\x0b\xfd\x01\x0b\x0b\x08\x00\xf4\x19\xf9\x01\x2f\x2f\xfe\x01\x2f\x2f\x14\x00\x30\x30\x05\x02\x30\x30\xa6\x00"
+    "\x31\x31\xa8\x00\x31\x31\x92\x01\x30\x30\x31\x00\x30\x30\x92\x01\x32\x32\x31\x00\x32\x32\x08\x00\x42\x13\x02\x08\x08\x04\x00\x22"
+    "\x09\x09\x04\x00\x68\x0a\x0a\x13\x02\x0b\x0b\x04\x00\x17\x06\x08\x00\x0f\x09\x01\x0e\x0f\x01\x00\x1d\x1f\x08\x24\x00\x10\x0f\x01"
+    "\x00\x00\x80\x14\x00\x2f\x2f\x92\x01\x2f\x2f\xe4\x00\x00\xec\x00\x00\xe0\x00\x22\x05\x02\xec\x00\x00\xf4\x00\x13\x14\xe4\x00\x04"
+    "\x08\x00\x0f\x53\x00\x10\x0f\x01\x00\x4a\x04\xd0\x01\xf1\x02\x17\x02\x0c\x0c\x07\x02\x0c\x0c\x17\x02\x0d\x0d\x07\x02\x0d\x0d\x14"
+    "\x04\x00\x71\x0e\x0e\x17\x02\x0e\x0e\x1b\x18\x00\x66\x0f\x0f\x1b\x02\x0f\x0f\x08\x00\x31\x0e\x0e\x07\x20\x00\x71\x0f\x0f\x07\x02"
+    "\x0f\x0f\x14\x04\x00\x71\x10\x10\x17\x02\x10\x10\x1b\x18\x00\x64\x11\x11\x1b\x02\x11\x11\x08\x00\x42\x13\x02\x0c\x0c\x04\x00\x22"
+    "\x0d\x0d\x04\x00\x68\x0e\x0e\x13\x02\x0f\x0f\x04\x00\x17\x1a\x08\x00\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x31\x08\x08\x01\xa0\x03\xd3"
+    "\x22\x02\x0e\x0e\x1c\x02\x0e\x0e\x22\x02\x0f\x0f\x1c\xbc\x00\x11\x1f\x08\x00\xb1\x10\x10\x1f\x02\x10\x10\x22\x02\x10\x10\x1c\x08"
+    "\x00\xf1\x0c\x11\x11\x1c\x02\x11\x11\x22\x02\x16\x16\x1d\x02\x16\x16\x22\x02\x17\x17\x1d\x02\x17\x17\x08\x02\x17\x17\x20\x08\x00"
+    "\xb1\x18\x18\x20\x02\x18\x18\x22\x02\x18\x18\x1d\x08\x00\x64\x19\x19\x1d\x02\x19\x19\xd8\x00\x91\xff\x01\x0f\x0f\x01\x02\x0f\x0f"
+    "\x03\xd4\x00\x00\x00\x01\x06\x04\x00\x17\x23\x08\x00\x4d\x26\x02\x05\x14\x04\x00\x0f\x28\x08\x28\x13\x03\xf0\x00\xf1\x0e\x27\x02"
+    "\x13\x13\x2a\x02\x13\x13\x27\x02\x14\x14\x2a\x02\x14\x14\x2c\x02\x14\x14\x2f\x02\x14\x14\x27\x02\x15\x15\x2d\x08\x00\x64\x16\x16"
+    "\x2d\x02\x16\x16\x08\x00\x0f\x3f\x01\x0c\x0f\x01\x00\x7e\x0f\xe8\x00\x09\x1f\x31\xe8\x00\xc4\x13\x32\xe8\x00\x13\x32\xe0\x00\x46"
+    "\x32\x02\x15\x15\x08\x00\x33\x16\x16\x32\xe8\x00\x00\x08\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x0f\xe8\x00\xdd\xf6\x09\x28\x02\x22"
+    "\x22\x33\x02\x22\x22\x28\x02\x23\x23\x33\x02\x23\x23\x28\x02\x24\x24\x33\x02\x24\x24\x08\x00\x64\x25\x25\x33\x02\x25\x25\x08\x00"
+    "\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x0f\xe8\x00\xff\xff\xb1\xf0\x11\x2f\x2f\x1c\x00\x2f\x2f\x33\x02\x30\x30\x5f\x00\x30\x30\x28\x02"
+    "\x30\x30\x1c\x00\x31\x31\x33\x02\x31\x31\x5f\x00\x31\x31\x28\x02\x0c\x00\x60\x32\x32\x28\x02\x32\x32\x08\x00\x0f\x57\x00\x0c\x0f"
+    "\x01\x00\x7e\x0f\xe8\x00\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xb1\x42\x58\x01\x2f\x2f\x04\x00\x22\x30\x30\x04\x00\x22"
+    "\x31\x31\x04\x00\x2f\x32\x32\x04\x00\x01\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x0f\xe8\x00\xdd\x0f\xa0\x03\xd7\x0f\xf0\x13\xff\xff\xff"
+    "\x90\x0f\xe8\x00\xd3\x0f\x48\x1a\xff\xb6\x04\xb8\x1f\xf6\x19\xfb\x01\x15\x15\x3c\x02\x14\x14\xfb\x01\x16\x16\x14\x02\x15\x15\x46"
+    "\x02\x14\x14\x46\x02\x15\x15\x14\x02\x16\x16\x46\x02\x16\x16\xfb\x01\x17\x17\x46\x02\x17\x17\x08\x00\xf4\x17\x19\x19\x3c\x02\x18"
+    "\x18\xfb\x01\x1a\x1a\x14\x02\x19\x19\x46\x02\x18\x18\x46\x02\x19\x19\x14\x02\x1a\x1a\x46\x02\x1a\x1a\xfb\x01\x1b\x1b\x46\x02\x1b"
+    "\x1b\x08\x00\x42\x13\x02\x14\x14\x04\x00\x22\x15\x15\x04\x00\x64\x16\x16\x13\x02\x17\x17\x04\x00\x66\x3d\x02\x17\x17\xfc\x01\x08"
+    "\x00\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x21\x03\x00\xe8\x00\xf1\x03\x01\x53\x02\x18\x18\x57\x02\x19\x19\x53\x02\x19\x19\x0d\x02\x18"
+    "\x18\x55\x04\x00\x00\x10\x00\xf3\x00\x1a\x1a\x57\x02\x1a\x1a\x53\x02\x1b\x1b\x57\x02\x1b\x1b\x5a\x04\x00\x0f\x5a\x00\x0f\x0a\x01"
+    "\x00\x42\x11\x02\x18\x18\x04\x00\x22\x19\x19\x04\x00\x22\x1a\x1a\x04\x00\x2f\x1b\x1b\x04\x00\x01\x0f\x53\x00\x10\x0f\x01\x00\x1a"
+    "\x0f\xe8\x00\x07\x31\x19\x19\x55\xe0\x00\x0f\xe8\x00\xcd\x64\x1a\x1a\x55\x02\x1b\x1b\xe8\x00\x04\xe0\x00\x04\xf0\x00\x0f\x5a\x00"
+    "\x0f\x0a\x01\x00\x0f\xe8\x00\x75\xf1\x06\x0d\x02\x1c\x1c\x15\x02\x1c\x1c\x0d\x02\x1d\x1d\x15\x02\x1e\x1e\x0d\x02\x1e\x1e\x65\x10"
+    "\x00\xf1\x00\x1e\x1e\x0f\x02\x1d\x1d\x0d\x02\x1f\x1f\x0f\x02\x1e\x1e\x67\x08\x00\x2f\x1f\x1f\x5a\x00\x0f\x0a\x01\x00\x42\x11\x02"
+    "\x1c\x1c\x04\x00\x22\x1d\x1d\x04\x00\x22\x1e\x1e\x04\x00\x2f\x1f\x1f\x04\x00\x01\x0f\x53\x00\x10\x0f\x01\x00\x1a\x0f\xe8\x00\x09"
+    "\x11\x0f\x10\x00\x00\xd8\x00\x20\x1d\x1d\xf4\x00\x02\xe8\x00\x00\x08\x00\x0f\xe8\x00\xbb\x0f\xd0\x01\xc1\x02\xd4\x00\x00\xe4\x00"
+    "\x00\xbc\x01\x00\xd8\x00\x00\xe8\x00\x00\x04\x00\x00\xd8\x00\x22\x1c\x1c\xe0\x00\x22\x1d\x1d\x08\x00\x2f\x1e\x1e\x5a\x00\x0f\x0a"
+    "\x01\x00\x0f\xd0\x01\xff\x5e\x0f\xa0\x03\xff\xff\xff\xff\xff\xff\xff\xff\xff\xe6\x12\x08\xe8\x00\xa1\x00\x08\x02\x1e\x1e\x49\x02"
+    "\x1f\x1f\x6b\x08\x00\x71\x20\x20\x6b\x02\x1f\x1f\x08\x08\x00\x31\x20\x20\x6d\x18\x00\x31\x21\x21\x6d\x10\x00\x00\x08\x00\x0f\x78"
+    "\x35\x1f\x40\x13\x02\x1e\x1e\x04\x00\x51\x4b\x02\x1f\x1f\x13\x04\x00\x68\x20\x20\x13\x02\x21\x21\x04\x00\x17\x09\x08\x00\x0f\x53"
+    "\x00\x10\x0f\x01\x00\x1a\x09\xe8\x00\x13\x0a\xe8\x00\x1f\x0a\xe8\x00\xcc\x13\x12\xe8\x00\x1f\x12\xe8\x00\xc0\x03\xd8\x14\x81\x46"
+    "\x02\x1f\x1f\x49\x1a\x1e\x1e\xe8\x00\x12\x1a\xe8\x00\x40\x65\x02\x21\x21\xe8\x00\x00\x1c\x00\x00\xe0\x00\x13\x46\xe8\x00\xf0\x11"
+    "\x46\x02\x21\x21\x47\x02\x23\x23\x4a\x1a\x22\x22\x6b\x02\x22\x22\x4a\x1a\x24\x24\x6b\x02\x23\x23\x66\x02\x25\x25\x6b\x02\x24\x24"
+    "\x1c\x00\x60\x6b\x02\x25\x25\x47\x02\x18\x00\x00\x08\x00\x2f\x25\x25\xe8\x00\x11\x08\x04\x00\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x04"
+    "\x90\x34\x10\x08\xe8\x00\x13\x02\xe8\x00\x0f\xa0\x03\x10\x10\x08\xe8\x00\x13\x02\xe8\x00\x01\xd0\x00\x31\x23\x23\x08\x08\x00\x33"
+    "\x24\x24\x6d\xe8\x00\x13\x6d\xe8\x00\x1f\x6d\xe8\x00\x14\x08\xd0\x01\x4d\x26\x02\x0f\x23\x04\x00\x3c\x0a\x0f\x28\x04\x00\x13\x93"
+    "\x90\x34\x00\x08\x00\x13\x94\x04\x00\x13\x93\x90\x34\xb0\x94\x00\x23\x46\x94\x00\x2d\x46\x95\x00\x32\x30\x38\x06\xe8\x00\x13\x0a"
+    "\xe8\x00\x0f\xa0\x03\x10\x01\xe8\x00\x13\x0a\xe8\x00\x1f\x0a\xe8\x00\x9c\x13\x12\xe8\x00\x0f\xa0\x03\x10\x01\xe8\x00\x13\x12\xe8"
+    "\x00\x1f\x12\xe8\x00\x97\x0f\xa0\x03\x0b\x04\x98\x03\x0f\xa0\x03\x15\x04\x98\x03\x0f\xa0\x03\x27\x0f\xe8\x00\x3d\x04\x48\x1a\x11"
+    "\x6e\x9c\x03\xb3\x21\x21\x6e\x02\x1f\x1f\x6d\x02\x1e\x1e\x6e\xc8\x01\x02\x08\x00\x33\x20\x20\x6e\xc8\x01\x04\x08\x00\x0f\xf7\x03"
+    "\x0c\x0f\x01\x00\x7e\x08\xe8\x00\x02\x04\x00\x00\xdc\x00\x02\xe0\x00\x0a\x04\x00\x02\xe4\x00\x04\x04\x00\x0f\x57\x00\x0c\x0f\x01"
+    "\x00\x7e\x04\xcf\x3b\xf1\x02\x75\x02\x26\x26\x77\x02\x25\x25\x75\x02\x28\x28\x77\x02\x26\x26\x6b\x10\x00\xf1\x00\x27\x27\x6b\x02"
+    "\x28\x28\x63\x02\x28\x28\x75\x02\x25\x25\x77\x08\x00\x20\x27\x27\x08\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x21\x06\x00\xa0\x03\xf1"
+    "\x03\x01\x78\x02\x25\x25\x0d\x02\x27\x27\x78\x02\x26\x26\x79\x02\x26\x26\x0f\x6c\x03\x00\x10\x00\x20\x27\x27\x10\x00\x51\x78\x02"
+    "\x28\x28\x79\x10\x00\x00\x08\x00\x0f\xe8\x00\x1f\x42\x12\x02\x25\x25\x04\x00\x22\x26\x26\x04\x00\x22\x27\x27\x04\x00\x2f\x28\x28"
+    "\x04\x00\x01\x4d\x26\x02\x14\x2d\x04\x00\x3c\x0a\x14\x32\x04\x00\x13\x3c\xa0\x03\x40\x3d\x00\x23\x37\x0c\x00\x00\x04\x00\x13\x3d"
+    "\xa0\x03\x71\x3d\x00\x23\x46\x3e\x00\x2d\x04\x00\x03\xc8\x0b\x12\x00\xe8\x00\x20\x25\x25\xe8\x00\x00\xf0\x00\x08\xe8\x00\x13\x0f"
+    "\xe8\x00\x13\x0f\xe8\x00\x1f\x0f\xe8\x00\x50\x0f\x53\x00\x10\x0f\x01\x00\x1a\x0f\xe8\x00\xdf\x22\x27\x27\xb8\x02\x60\x28\x28\x0d"
+    "\x02\x29\x29\xd4\x00\x51\x6b\x02\x29\x29\x78\x0c\x00\xa4\x28\x28\x78\x02\x2a\x2a\x0f\x02\x2a\x2a\x08\x00\x0f\x59\x00\x0e\x0b\x01"
+    "\x00\x0e\xd8\x00\x22\x29\x29\x04\x00\x2f\x2a\x2a\x04\x00\x01\x0f\x53\x00\x10\x0f\x01\x00\x1a\x0f\xd0\x01\xd5\x0f\x88\x04\xff\xff"
+    "\xb1\x0f\x70\x05\xf9\x00\x10\x00\x0f\x70\x05\xad\x0f\xe8\x00\xff\xff\xff\xff\x6f\x04\xd8\x14\xf8\x17\x72\x00\x2f\x2f\x15\x01\x2f"
+    "\x2f\x2a\x00\x30\x30\x51\x01\x30\x30\x52\x01\x30\x30\xaa\x01\x31\x31\x67\x01\x30\x30\x67\x01\x32\x32\x72\x00\x31\x31\x2a\x00\x08"
+    "\x00\xf6\x15\x39\x39\x15\x01\x39\x39\x2a\x00\x3a\x3a\x51\x01\x3a\x3a\x52\x01\x3a\x3a\xaa\x01\x3b\x3b\x67\x01\x3a\x3a\x67\x01\x3c"
+    "\x3c\x72\x00\x3b\x3b\x2a\x00\x08\x00\x40\x13\x02\x2f\x2f\x04\x00\x51\x4b\x02\x30\x30\x13\x04\x00\x40\x31\x31\x13\x02\x50\x4b\x02"
+    "\x04\x00\x66\xa9\x00\x32\x32\xd1\x01\x08\x00\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x13\x03\xf8\x09\xd1\x2a\x00\x2f\x2f\xdd\x00\x2f\x2f"
+    "\xd7\x00\x30\x30\xe1\xec\x00\xf0\x01\x32\x32\x52\x01\x32\x32\x0d\x02\x31\x31\x7c\x00\x30\x30\xdd\x00\x08\x00\x24\x32\x32\x08\x00"
+    "\x0f\x5b\x00\x10\x09\x01\x00\x42\x12\x02\x2f\x2f\x04\x00\x22\x30\x30\x04\x00\x22\x31\x31\x04\x00\x2f\x32\x32\x04\x00\x01\x80\x26"
+    "\x02\x19\x37\x56\x00\x19\x37\x08\x00\x04\x04\x00\xc4\x56\x00\x19\x3c\x26\x0a\x19\x3c\x57\x00\x23\x46\x04\x00\x0f\xf8\x09\x15\x04"
+    "\xd0\x01\xf4\x19\x23\x00\x34\x34\xdd\x00\x34\x34\x23\x00\x36\x36\x84\x00\x35\x35\x51\x01\x37\x37\x52\x01\x37\x37\x84\x00\x37\x37"
+    "\x77\x01\x35\x35\xdd\x00\x36\x36\x77\x01\x37\x37\x08\x00\xf4\x19\x23\x00\x3e\x3e\xdd\x00\x3e\x3e\x23\x00\x40\x40\x84\x00\x3f\x3f"
+    "\x51\x01\x41\x41\x52\x01\x41\x41\x84\x00\x41\x41\x77\x01\x3f\x3f\xdd\x00\x40\x40\x77\x01\x41\x41\x08\x00\x42\x13\x02\x34\x34\x04"
+    "\x00\x22\x35\x35\x04\x00\x60\x36\x36\x13\x02\x37\x37\x04\x00\x97\xd9\x01\x37\x37\x24\x00\x37\x37\x78\x08\x00\x0f\x39\x01\x0e\x0f"
+    "\x01\x00\x1c\x06\xd0\x01\xb1\x39\x39\xdd\x00\x39\x39\xd7\x00\x3a\x3a\xe1\x8c\x02\xf0\x01\x3c\x3c\x52\x01\x3c\x3c\x0d\x02\x3b\x3b"
+    "\x7c\x00\x3a\x3a\xdd\x00\x08\x00\x24\x3c\x3c\x08\x00\x0f\x5b\x00\x10\x09\x01\x00\x42\x12\x02\x39\x39\x04\x00\x22\x3a\x3a\x04\x00"
+    "\x22\x3b\x3b\x04\x00\x2f\x3c\x3c\x04\x00\x01\x0f\xd0\x01\x33\x02\xcc\x01\x01\xd0\x01\xff\x26\x00\x01\x05\x01\x50\x01\x00\xf9\x01"
+    "\x1c\x1c\xfb\x01\x1c\x1c\xf9\x01\x1d\x1d\xfb\x01\x1d\x1d\x57\x02\x1d\x1d\x2f\x02\x1d\x1d\xf9\x01\x1e\x1e\xfb\x01\x1e\x1e\x57\x02"
+    "\x1f\x1f\x2f\x02\x1f\x1f\xf9\x01\x1f\x1f\xfb\x01\xb8\x1b\x1f\x42\x13\x02\x1c\x1c\x04\x00\x22\x1d\x1d\x04\x00\x02\xe8\x14\x02\xe4"
+    "\x14\x02\x04\x00\x26\xfc\x01\x08\x00\x4c\x50\x02\x05\x0f\x04\x00\x44\x52\x02\x05\x14\x04\x00\x13\x51\x04\x00\x62\xc8\x01\x23\x37"
+    "\x74\x00\x04\x00\x00\x0c\x00\x00\x04\x00\xf1\x00\x75\x00\x23\x3c\xd3\x00\x23\x3c\xc9\x01\x23\x46\xe6\x00\x2d\x04\x00\x31\x00\x00"
+    "\x00\xe8\x00\x0f\x01\x00\x7d\x97\x16\x01\x19\x37\xca\x01\x19\x37\x17\x04\x00\x40\x40\x01\x19\x3c\x04\x00\x62\xe2\x00\x23\x46\x41"
+    "\x01\x04\x00\x80\xdf\x00\x23\x37\x5a\x00\x23\x37\x08\x00\x04\x48\x54\x13\x5a\x48\x54\x71\xe0\x00\x23\x46\x5b\x00\x2d\x04\x00\x0f"
+    "\xe8\x00\xff\xff\x5b\x1f\x6b\xe8\x00\x00\x40\x6c\x01\x19\x3c\xe0\x00\x13\x6d\x04\x00\x0f\xe8\x00\x17\x01\xe4\x00\x1f\x02\x7a\x00"
+    "\x0f\x0f\x01\x00\x2b\x42\x44\x02\x16\x16\x04\x00\x22\x17\x17\x04\x00\x22\x18\x18\x04\x00\x2f\x19\x19\x04\x00\x01\x0f\x53\x00\x10"
+    "\x0f\x01\x00\x1a\x04\x48\x1a\xf0\x03\x37\x00\x2f\x2f\x90\x01\x2f\x2f\x4f\x01\x30\x30\x50\x01\x30\x30\x75\x02\x04\x00\xf4\x03\x32"
+    "\x32\x37\x00\x31\x31\x90\x01\x31\x31\x4f\x01\x32\x32\x50\x01\x32\x32\x08\x00\xf0\x03\x37\x00\x39\x39\x90\x01\x39\x39\x4f\x01\x3a"
+    "\x3a\x50\x01\x3a\x3a\x76\x02\x04\x00\xf4\x03\x3c\x3c\x37\x00\x3b\x3b\x90\x01\x3b\x3b\x4f\x01\x3c\x3c\x50\x01\x3c\x3c\x08\x00\x0f"
+    "\x10\x09\x0d\x0c\x04\x00\x08\x50\x06\x05\x04\x00\x12\x0a\x58\x06\x62\x26\x0a\x23\x46\x83\x00\x04\x00\x22\x3e\x01\x58\x06\x00\x08"
+    "\x00\x07\x04\x00\x01\x58\x06\x71\x3f\x01\x23\x46\x3f\x01\x2d\x04\x00\x0f\xd0\x01\x55\x42\x45\x02\x2f\x2f\x04\x00\x22\x30\x30\x04"
+    "\x00\x22\x31\x31\x04\x00\x2f\x32\x32\x04\x00\x01\x0f\x53\x00\x10\x0f\x01\x00\x1a\x04\xd0\x01\xff\x09\xf8\x01\x02\x02\xfa\x01\x02"
+    "\x02\xf8\x01\x03\x03\xfa\x01\x03\x03\xf8\x01\x04\x04\xfa\x01\x04\x04\x08\x00\x05\xf2\x13\xf9\x01\x20\x20\xfb\x01\x20\x20\xf9\x01"
+    "\x21\x21\xfb\x01\x21\x21\x2f\x02\x20\x20\x2f\x02\x21\x21\xf9\x01\x22\x22\xfb\x01\x22\x22\x2f\x02\x08\x00\xc2\xf9\x01\x23\x23\x2f"
+    "\x02\x23\x23\x13\x02\x02\x02\x04\x00\x22\x03\x03\x04\x00\x2f\x04\x04\x04\x00\x09\x0f\x88\x5b\x15\x00\xcc\x01\x04\x04\x00\x25\x5d"
+    "\x01\x04\x00\x01\xd0\x01\x00\xf8\x01\x31\x5e\x01\x2d\x04\x00\x04\x88\x21\x06\xc8\x00\xf4\x0f\x05\x05\xfa\x01\x05\x05\xfd\x01\x04"
+    "\x04\xfd\x01\x05\x05\xf8\x01\x06\x06\xfa\x01\x06\x06\xf8\x01\x07\x07\xfa\x01\x07\x07\x08\x00\x0f\x41\x01\x0e\x0b\x01\x00\x06\xc4"
+    "\x00\x22\x05\x05\x04\x00\x6f\x06\x06\x13\x02\x07\x07\x04\x00\x05\x0f\x53\x00\x10\x0f\x01\x00\x1a\x06\xd0\x01\x80\x08\x08\x07\x02"
+    "\x08\x08\x0a\x02\x08\x00\x33\x09\x09\xfa\xf0\x57\xf0\x05\x0a\x02\x09\x09\x07\x02\x0a\x0a\x0a\x02\x0a\x0a\x07\x02\x0b\x0b\x0a\x02"
+    "\x0b\x0b\x08\x00\x00\x00\x58\x08\x18\x00\x13\xfa\x00\x58\x02\x20\x00\x31\x0c\x0c\x0a\x68\x56\x33\x0d\x0d\x0a\x68\x56\x0f\xe8\x57"
+    "\x11\x08\x04\x00\x0f\x58\x5d\x3d\x04\xe0\x0a\xf6\x01\x0c\x02\x0a\x0a\x0f\x02\x0a\x0a\x0c\x02\x0b\x0b\x0f\x02\x0b\x0b\x08\x00\xe4"
+    "\x0c\x0c\x0f\x02\x0c\x0c\x0c\x02\x0d\x0d\x0f\x02\x0d\x0d\x08\x00\x0f\x43\x01\x10\x09\x01\x00\x42\x11\x02\x0a\x0a\x04\x00\x22\x0b"
+    "\x0b\x04\x00\x22\x0c\x0c\x04\x00\x2f\x0d\x0d\x04\x00\x01\x0f\xe8\x00\x15\x0f\xb0\x0c\x0c\x23\x3c\x3e\x04\x00\x0f\xe8\x00\xd7\x02"
+    "\x88\x5b\xf1\x02\x27\x02\x0f\x0f\x2a\x02\x0f\x0f\x27\x02\x10\x10\x2a\x02\x10\x10\x2f\x04\x00\x71\x11\x11\x27\x02\x11\x11\x2a\x08"
+    "\x00\x64\x12\x12\x2a\x02\x12\x12\x08\x00\x0f\xdb\x00\x10\x0f\x01\x00\x2a\x0f\xc8\x0b\x15\x00\x20\x5f\x2a\x6e\x01\x28\x5f\x26\x71"
+    "\x01\x28\x5f\x31\x6f\x01\x2d\x04\x00\x04\x80\x0e\x91\x3e\x02\x13\x13\x3c\x02\x13\x13\x38\x04\x00\xa0\x15\x15\xfe\x01\x14\x14\xfe"
+    "\x01\x16\x16\x14\x3a\xa0\x3e\x02\x14\x14\x3c\x02\x15\x15\x3e\x02\x24\x3a\x33\x16\x16\x3e\x04\x00\x00\x0c\x00\x11\x38\x04\x00\x71"
+    "\x18\x18\xfe\x01\x17\x17\xfe\x14\x3a\x60\x17\x17\x3e\x02\x17\x17\x1c\x3a\x91\x3e\x02\x18\x18\x3c\x02\x19\x19\x3e\xd0\x58\x20\x13"
+    "\x13\x04\x00\x19\x4b\x08\x3a\x00\x04\x3a\x02\x04\x00\x1b\x3d\x08\x00\x0f\x09\x01\x0e\x0f\x01\x00\x1c\x04\x88\x04\x80\x49\x02\x16"
+    "\x16\x4c\x02\x16\x16\x80\x59\x53\x4e\x02\x17\x17\x49\x90\x59\xf4\x01\x49\x02\x18\x18\x4c\x02\x18\x18\x08\x02\x19\x19\x4e\x02\x19"
+    "\x19\x08\x00\xf1\x06\x49\x02\x1a\x1a\x4c\x02\x1a\x1a\x08\x02\x1b\x1b\x4e\x02\x1b\x1b\x49\x02\x1b\x1b\x1d\x08\x00\xe4\x1c\x1c\x4c"
+    "\x02\x1c\x1c\x08\x02\x1d\x1d\x4e\x02\x1d\x1d\x08\x00\x04\xd8\x3a\x11\x4b\x04\x00\x00\xf8\x00\x31\x18\x18\x13\x08\x00\x02\x04\x00"
+    "\x57\x09\x02\x19\x19\x1e\x08\x00\x3e\x26\x02\x0a\x04\x00\x3c\x0a\x0a\x1e\x04\x00\x0f\x50\x10\x0d\x31\xba\x00\x2d\x04\x00\x05\xe8"
+    "\x00\x1b\x0a\xe8\x00\x13\x0a\xe8\x00\x1f\x0a\xe8\x00\x04\x1b\x0a\xe8\x00\x13\x0a\xe8\x00\x1f\x0a\xe8\x00\x8c\x1b\x12\xe8\x00\x13"
+    "\x12\xe8\x00\x1f\x12\xe8\x00\x04\x1b\x12\xe8\x00\x13\x12\xe8\x00\x1f\x12\xe8\x00\x8c\x12\x1a\xe8\x00\x00\x7c\x3d\x01\xe8\x00\x13"
+    "\x1a\xe8\x00\x12\x1a\xe8\x00\x00\x7c\x3d\x00\xe0\x00\x04\x08\x00\x22\x49\x1a\xe8\x00\x00\x7c\x3d\x01\xe8\x00\x13\x1a\xe8\x00\x12"
+    "\x1a\xe8\x00\x13\x46\xe0\x00\x04\x08\x00\x0f\xe8\x00\x0d\x00\x04\x00\x00\xe0\x00\x04\x08\x00\x0f\xe8\x00\x3d\x08\x38\x2e\x02\x10"
+    "\x2f\x20\x1d\x1d\x30\x2d\x00\x50\x2d\x15\x62\x08\x00\x20\x1f\x1f\x38\x2e\x08\x08\x00\x0f\xfa\x03\x0f\x0a\x01\x00\x0f\x20\x2f\x79"
+    "\x0f\xe8\x00\xff\xb2\x24\x0f\x0f\x50\x2d\x20\x1a\x1a\x2c\x06\xd1\xf9\x01\x1b\x1b\x0b\x02\x1b\x1b\x08\x02\x1c\x1c\x0b\xf0\x13\x20"
+    "\x1c\x1c\x80\x03\x00\x08\x14\x00\x68\x03\x04\x08\x00\x02\x50\x2f\x20\x1e\x1e\x00\x14\x13\x0b\xdc\x29\x11\x0b\xb0\x0c\x31\x20\x20"
+    "\x4e\x18\x14\x31\x21\x21\x4e\x10\x00\x02\x08\x00\x40\x13\x02\x1a\x1a\x04\x00\x11\x4b\x4c\x41\x00\x04\x00\x08\xfc\x13\x02\x04\x00"
+    "\x17\x09\x08\x00\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x09\xe8\x00\x1f\x0a\xe8\x00\x1c\x1f\x0a\xe8\x00\xa4\x1f\x12\xe8\x00\x1c\x1f\x12"
+    "\xe8\x00\x9f\x10\x65\xe8\x00\x16\x1a\xe8\x00\x00\xd0\x32\x0f\xe8\x00\x09\x00\xdc\x32\x00\xb0\x2b\x04\xe8\x00\x1f\x65\xe8\x00\x30"
+    "\x08\x04\x00\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x04\x98\x2a\x42\x5f\x02\x1a\x1a\x04\x00\x22\x1b\x1b\x04\x00\x2a\x1c\x1c\x04\x00\x28"
+    "\x1d\x1d\x04\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x0f\xe8\x00\x09\x11\x5d\x10\x00\x06\xe8\x00\x11\x5d\x18\x00\x00\x08\x00\x2f\x1c"
+    "\x1c\x57\x00\x0c\x0f\x01\x00\x7e\x0a\xe8\x00\x00\xc8\x00\x24\x1a\x1a\xe0\x00\x02\xd8\x00\x00\x08\x00\x04\xe8\x00\x02\xcc\x01\x00"
+    "\x08\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x08\xe8\x00\x02\xe0\x00\x2a\x1b\x1b\xe0\x00\x0f\xe8\x00\xb3\x0f\xa8\x6d\xff\xff\xff\x91"
+    "\x0f\x48\x71\xff\xff\xff\x97\xf0\x07\x3f\x02\x1f\x1f\x3c\x02\x20\x20\x39\x02\x1f\x1f\x39\x02\x21\x21\x70\x02\x1f\x1f\xfe\x01\x08"
+    "\x00\xb1\x20\x20\x3f\x02\x20\x20\x70\x02\x21\x21\x3f\x18\x00\x31\x22\x22\x3f\x04\x00\xe2\x24\x24\x3c\x02\x25\x25\x39\x02\x24\x24"
+    "\x39\x02\x26\x26\x30\x00\x00\x08\x00\xb1\x25\x25\x3f\x02\x25\x25\x70\x02\x26\x26\x3f\x18\x00\x64\x27\x27\x3f\x02\x27\x27\x54\x22"
+    "\x11\x4b\x40\x37\x04\x44\x37\x24\x22\x22\x04\x00\x57\x3d\x02\x22\x22\x40\x08\x00\x0f\x09\x01\x0e\x0f\x01\x00\x1c\x06\x50\x10\x30"
+    "\x30\x30\x0f\x88\x1d\x10\x00\x04\x00\xb1\x31\x31\x2e\x01\x31\x31\x6c\x00\x31\x31\x2f\x08\x00\x2a\x32\x32\x08\x00\x2f\x31\x31\x5a"
+    "\x00\x0f\x0a\x01\x00\x0f\x10\x26\x1d\x0f\x53\x00\x10\x0f\x01\x00\x1a\x0f\xe8\x00\x19\x24\xbf\x01\x08\x00\x0f\xe8\x00\xa2\x01\x48"
+    "\x1a\x0f\xe8\x00\x09\x06\xe0\x00\x0f\xe8\x00\x57\x0f\xb8\x1f\x04\x1c\x46\x04\x00\x0f\xe0\x27\x1d\x00\x94\x1e\x13\x75\x84\x1e\xf0"
+    "\x03\x75\x02\x24\x24\x72\x02\x22\x22\x72\x02\x23\x23\x4e\x02\x22\x22\x1b\x02\x2c\x0f\x00\x08\x00\x60\x24\x24\x4e\x02\x23\x23\x08"
+    "\x00\x40\xfb\x01\x26\x26\x3c\x38\xf2\x09\xfb\x01\x27\x27\x75\x02\x29\x29\x72\x02\x27\x27\x72\x02\x28\x28\x4f\x02\x27\x27\x1b\x02"
+    "\x26\x26\x08\x00\x60\x29\x29\x4f\x02\x28\x28\x08\x00\x04\xc0\x3a\x15\x4b\x94\x03\x00\xe4\x1e\x24\x24\x24\x04\x00\x57\xfc\x01\x24"
+    "\x24\x1a\x08\x00\x0f\x39\x01\x0e\x0f\x01\x00\x1c\x0f\xe8\x00\x0f\x2f\x21\x21\xe8\x00\x1b\x2f\x26\x26\xe8\x00\x84\x01\x58\x06\x00"
+    "\x60\x22\x00\x74\x22\x84\xcf\x00\x2f\x2f\x4f\x02\x30\x30\x78\x22\xc0\x4c\x02\x31\x31\x70\x02\x32\x32\xcf\x00\x32\x32\x80\x22\x04"
+    "\x08\x00\x00\x60\x22\x00\x74\x22\x84\xcf\x00\x39\x39\x4f\x02\x3a\x3a\x78\x22\xc0\x4c\x02\x3b\x3b\x71\x02\x3c\x3c\xcf\x00\x3c\x3c"
+    "\x80\x22\x04\x08\x00\x0f\x70\x22\x0d\x2a\xd8\x01\x08\x00\x00\xa8\x02\x2a\xa2\x01\xb8\x02\x22\xa2\x01\x70\x22\x44\xa3\x01\x23\x46"
+    "\x04\x00\x0f\xd0\x1e\x15\x04\xd0\x01\xf6\x17\x9f\x01\x2f\x2f\xbf\x00\x2f\x2f\x4e\x00\x31\x31\x08\x02\x30\x30\xa5\x01\x30\x30\x0e"
+    "\x00\x30\x30\xd6\x00\x32\x32\x7f\x00\x32\x32\xce\x00\x30\x30\x08\x02\x08\x00\xf1\x12\x9f\x01\x39\x39\xbf\x00\x39\x39\x4e\x00\x3b"
+    "\x3b\x08\x02\x3a\x3a\xa5\x01\x3a\x3a\x0e\x00\x3b\x3b\xd6\x00\x3c\x3c\x7f\x00\x3c\x3c\xce\x18\x00\x06\x08\x00\x0f\xe8\x00\x05\xd7"
+    "\x09\x02\x32\x32\x0f\x00\x32\x32\xa0\x01\x32\x32\xc0\x08\x00\x0f\xa1\x01\x0e\x0f\x01\x00\x1c\x04\xd0\x01\x0f\x50\x2d\x7d\x00\x10"
+    "\x26\x2a\x78\x00\x10\x26\xc4\x78\x00\x19\x3c\xde\x00\x19\x3c\x79\x00\x23\x46\x04\x00\x00\xe0\x1d\x00\x10\x26\x08\xe8\x1d\x04\x10"
+    "\x26\x00\xe8\x1d\x04\x10\x26\x08\x28\x25\xf0\x01\x27\x00\x30\x30\x65\x01\x30\x30\x6b\x02\x31\x31\x4e\x01\x31\x31\xe8\x00\x60\xd5"
+    "\x00\x31\x31\x5e\x02\x18\x00\x64\x32\x32\x5e\x02\x32\x32\x08\x00\x00\xb4\x02\xf0\x01\x27\x00\x3a\x3a\x65\x01\x3a\x3a\x6c\x02\x3b"
+    "\x3b\x4e\x01\x3b\x3b\xe8\x00\x60\xd5\x00\x3b\x3b\x5e\x02\x18\x00\x64\x3c\x3c\x5e\x02\x3c\x3c\x08\x00\x0f\xe8\x00\x0d\x11\x28\x94"
+    "\x79\x06\x08\x00\x0f\xb8\x02\x40\x01\xe8\x00\xf0\x0f\x25\x00\x2f\x2f\x66\x01\x2f\x2f\x22\x02\x30\x30\x66\x01\x31\x31\xea\x00\x30"
+    "\x30\xa4\x00\x30\x30\xc6\x00\x30\x30\xb5\x01\x0c\x00\x64\x32\x32\xb5\x01\x32\x32\x08\x00\xf0\x0f\x25\x00\x39\x39\x66\x01\x39\x39"
+    "\x22\x02\x3a\x3a\x66\x01\x3b\x3b\xea\x00\x3a\x3a\xa4\x00\x3a\x3a\xc6\x00\x3a\x3a\xb5\x01\x0c\x00\x64\x3c\x3c\xb5\x01\x3c\x3c\x08"
+    "\x00\x0f\xe8\x00\x05\x54\xae\x01\x32\x32\x23\x04\x26\x04\xe4\x00\x12\x00\xe8\x00\x1b\x4f\x68\x2c\x13\x4f\x68\x2c\x53\x50\x00\x23"
+    "\x46\xc7\x04\x00\x0f\xa0\x03\x1d\x80\x69\x00\x2f\x2f\x16\x00\x30\x30\x88\x04\xf0\x07\x73\x00\x31\x31\x16\x00\x32\x32\x1b\x02\x30"
+    "\x30\xf7\x00\x30\x30\x1b\x02\x31\x31\xf7\x00\x84\x04\x06\x08\x00\x80\x69\x00\x39\x39\x16\x00\x3a\x3a\x88\x04\xf6\x0b\x73\x00\x3b"
+    "\x3b\x16\x00\x3c\x3c\x1b\x02\x3a\x3a\xf7\x00\x3a\x3a\x1b\x02\x3b\x3b\xf9\x01\x3c\x3c\xf7\x00\x08\x00\x0f\xd0\x01\x09\x13\x1a\x80"
+    "\x04\x26\xf8\x00\x08\x00\x0f\x71\x03\x0e\x0f\x01\x00\x1c\x0f\xa0\x20\xdd\xf2\x15\x22\x02\x13\x13\x1d\x02\x14\x14\x22\x02\x14\x14"
+    "\x1d\x02\x15\x15\x08\x02\x15\x15\x1f\x02\x14\x14\x08\x02\x16\x16\x1f\x02\x15\x15\x22\x02\x15\x15\x48\x7a\x04\x50\x7a\x00\x08\x00"
+    "\x22\x17\x17\x58\x7a\x00\xf0\x1e\x31\x18\x18\x1f\x58\x7a\x35\x19\x19\x1f\x58\x7a\x26\x19\x19\x58\x7a\x00\xe8\x00\x20\x14\x14\xe8"
+    "\x00\x93\xff\x01\x14\x14\x01\x02\x14\x14\x03\xf0\x00\x97\x09\x02\x16\x16\x1e\x02\x16\x16\x23\x08\x00\x0f\x58\x7a\x31\x12\x76\xd8"
+    "\x02\x01\x04\x00\x04\xe8\x00\x51\x2f\x02\x1c\x1c\x2d\x00\x1b\x00\x08\x00\x00\x0c\x2f\x02\x1c\x2f\x51\x2f\x02\x1e\x1e\x1b\x2c\x2f"
+    "\x33\x1f\x1f\x1b\x24\x2f\x02\x08\x00\x40\x20\x20\x2e\x02\xc0\x27\x00\x08\x00\x00\xc4\x27\x02\xdc\x27\x00\xd8\x27\x00\x58\x08\x00"
+    "\xd4\x27\x11\x1b\x18\x00\x02\x08\x00\x0f\x20\x2f\x03\x06\x1c\x2f\x00\x04\x00\x17\x1a\x08\x00\x0f\x20\x2f\x25\x00\x8c\x82\x0f\x20"
+    "\x2f\x04\x0f\x80\x0e\x82\x0f\x50\x2d\x05\x00\x58\x06\x00\x50\x2d\x04\x04\x00\x0f\x50\x2d\xad\x0f\xf0\x30\x3d\x00",
+    5276, 34336);
+
+const Resource black2(
+    "\x8f\x00\x00\x00\x0a\x01\x32\x01\x00\x01\x00\x7d\xb6\x26\x02\x2d\x3c\x55\x01\x2d\x3c\x26\x02\x32\x04\x00\x21\x0a\x2d\x04\x00\x35"
+    "\x56\x01\x32\x04\x00\xc6\x76\x00\x28\x3c\x26\x02\x28\x3c\x76\x00\x32\x46\x04\x00\xa4\x28\x3c\x26\x0a\x28\x3c\x77\x00\x32\x46\x04"
+    "\x00\x22\x01\x03\xe4\x00\xf0\x0f\x13\x00\x0f\x0f\x22\x02\x0f\x0f\x07\x02\x0f\x0f\xab\x01\x0f\x0f\x13\x00\x10\x10\x22\x02\x10\x10"
+    "\x07\x02\x10\x10\xab\x01\x0c\x00\x64\x11\x11\x85\x00\x12\x12\x08\x00\x0c\x20\x00\x40\x13\x00\x11\x11\x1c\x00\x60\x07\x02\x11\x11"
+    "\xab\x01\x0c\x00\x64\x12\x12\x85\x00\x13\x13\x08\x00\x42\x13\x02\x0f\x0f\x04\x00\x22\x10\x10\x04\x00\x22\x11\x11\x04\x00\x20\x12"
+    "\x12\x04\x00\x57\xac\x01\x12\x12\x23\x08\x00\x0f\x09\x01\x0e\x0f\x01\x00\x1c\x13\x0c\xd0\x01\xf0\x03\x18\x02\x36\x36\x68\x02\x36"
+    "\x36\x18\x02\x37\x37\xc5\x01\x37\x37\x6a\x02\x04\x00\x80\x38\x38\x18\x02\x38\x38\xc5\x01\x08\x00\x64\x39\x39\x4c\x02\x39\x39\x08"
+    "\x00\x0f\x5b\x00\x10\x0f\x01\x00\x2a\x42\x6a\x02\x2d\x3c\x04\x00\x17\x3c\x04\x00\x06\x14\x00\x13\x19\x04\x00\x22\x53\x01\x14\x00"
+    "\x20\x53\x01\x0c\x00\x04\x04\x00\x02\x14\x00\x35\x54\x01\x3c\x04\x00\x0f\xe8\x00\xff\xbe\x0f\x88\x04\x85\x06\xd4\x00\x17\x32\x04"
+    "\x00\x06\x14\x00\x13\x19\x04\x00\x06\xe8\x00\x00\x0c\x00\x04\x04\x00\x04\xe8\x00\x15\x32\x04\x00\x0f\x70\x05\x87\x2d\x05\x0f\x04"
+    "\x00\x1e\x0a\x04\x00\x0f\x70\x05\x15\x0f\xe8\x00\x85\x4c\x50\x02\x05\x0f\x04\x00\x17\x52\x04\x00\x13\x51\x04\x00\xe2\xc8\x01\x28"
+    "\x3c\x62\x00\x28\x3c\xc8\x01\x32\x46\xd3\x00\x04\x00\x00\x10\x00\x84\xc9\x01\x28\x3c\x63\x00\x32\x46\x04\x00\x0f\xe8\x00\x87\xb3"
+    "\x1e\x2d\x78\x00\x1e\x2d\x26\x02\x23\x2d\x50\x04\x00\xe2\x51\x02\x23\x2d\xde\x00\x23\x2d\x26\x0a\x23\x2d\x79\x00\x04\x00\xc4\x72"
+    "\x01\x28\x3c\x5a\x00\x28\x3c\x72\x01\x32\x46\x04\x00\x02\x10\x00\x00\x18\x00\x33\x32\x46\x5b\x04\x00\x04\x40\x07\xf0\x03\xf9\x01"
+    "\x38\x38\xfe\x01\x38\x38\x14\x00\x39\x39\x27\x00\x39\x39\x05\x02\x04\x00\xf6\x03\x3a\x3a\x2a\x00\x39\x39\x2a\x00\x3a\x3a\xf9\x01"
+    "\x3b\x3b\xfe\x01\x3b\x3b\x08\x00\xf0\x01\x40\x40\xfe\x01\x40\x40\x14\x00\x41\x41\x27\x00\x41\x41\x05\x02\x04\x00\xf4\x03\x42\x42"
+    "\x2a\x00\x41\x41\x2a\x00\x42\x42\xf9\x01\x43\x43\xfe\x01\x43\x43\x08\x00\x42\x13\x02\x38\x38\x04\x00\xa2\x39\x39\xce\x00\x39\x39"
+    "\x13\x02\x3a\x3a\x04\x00\xc6\x3b\x3b\x28\x00\x3b\x3b\xa9\x00\x3b\x3b\x06\x02\x08\x00\x0f\x09\x01\x0e\x0f\x01\x00\x1d\x1f\x03\x24"
+    "\x00\x10\x0f\x01\x00\x00\xaa\x14\x00\x40\x40\x2a\x00\x40\x40\xf9\x01\xe8\x00\xf4\x01\xfe\x01\x41\x41\xfe\x01\x42\x42\x14\x00\x43"
+    "\x43\x2a\x00\x43\x43\x08\x00\x0f\x53\x00\x10\x0f\x01\x00\x4a\x04\xd0\x01\x00\x58\x06\xe0\x15\x02\x36\x36\xc6\x01\x37\x37\xc1\x00"
+    "\x37\x37\x15\x02\x04\x00\x60\x38\x38\x1b\x02\x37\x37\x04\x00\x00\x50\x06\x13\x1b\x58\x06\x02\x08\x00\xf0\x01\x40\x40\x15\x02\x40"
+    "\x40\xc6\x01\x3f\x3f\xc1\x00\x3f\x3f\x15\x02\x04\x00\x60\x40\x40\x1b\x02\x3f\x3f\x04\x00\x84\x18\x02\x41\x41\x1b\x02\x41\x41\x08"
+    "\x00\x42\x13\x02\x36\x36\x04\x00\x22\x37\x37\x04\x00\x02\xe0\x01\x60\xd5\x01\x39\x39\x19\x02\xe0\x01\x37\x39\x39\x1a\x08\x00\x0f"
+    "\xb9\x00\x0e\x0f\x01\x00\x1c\x31\x01\x03\x01\xa0\x03\xf1\x06\x22\x02\x36\x36\x1d\x02\x36\x36\x22\x02\x37\x37\x20\x01\x37\x37\x22"
+    "\x02\x38\x38\x20\x0c\x00\xe6\x39\x39\x20\x02\x39\x39\x22\x02\x39\x39\x1d\x02\x38\x38\x08\x00\xf1\x04\x3e\x3e\x1d\x02\x3e\x3e\x22"
+    "\x02\x3f\x3f\x20\x01\x3f\x3f\x22\x02\x40\x40\x20\x0c\x00\xe4\x41\x41\x20\x02\x41\x41\x22\x02\x41\x41\x1d\x02\x40\x40\x08\x00\x02"
+    "\xe4\x00\xb5\x40\x40\xff\x01\x37\x37\x01\x02\x37\x37\x03\xec\x00\x30\x39\x39\x21\x04\x00\x47\x01\x39\x39\x23\x08\x00\x00\xe0\x0a"
+    "\x2a\xb7\x00\xe0\x0a\x01\x10\x00\x01\xe4\x0a\x42\x32\x3c\xb8\x00\x04\x00\x0f\x70\x05\x03\xd1\x23\x3c\x26\x0a\x23\x3c\x77\x00\x23"
+    "\x46\x77\x00\x2d\x04\x00\x13\x09\xf0\x00\xf1\x0e\x27\x02\x12\x12\x2a\x02\x12\x12\x27\x02\x13\x13\x2a\x02\x13\x13\x2c\x02\x13\x13"
+    "\x2f\x02\x13\x13\x1b\x00\x13\x13\x2d\x08\x00\x64\x14\x14\x2d\x02\x15\x15\x08\x00\x0f\x3f\x01\x0c\x0f\x01\x00\x7e\x0f\xe8\x00\x01"
+    "\x00\xdc\x00\x00\xe8\x00\x15\x31\xe0\x00\x60\x13\x13\x48\x01\x15\x15\xe0\x00\x04\x08\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x13\x07"
+    "\x08\x00\x00\xe8\x00\x13\x32\xe8\x00\x13\x32\xec\x00\x00\xe4\x00\x60\x27\x02\x14\x14\x32\x02\x08\x00\x64\x15\x15\x32\x02\x15\x15"
+    "\x08\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x0f\xe8\x00\xdd\xf0\x03\x32\x02\x1b\x1b\x27\x02\x1b\x1b\x32\x02\x1c\x1c\x27\x02\x1c\x1c"
+    "\x1c\x00\x04\x00\x80\x1d\x1d\x32\x02\x1d\x1d\x28\x02\x08\x00\x64\x1e\x1e\x28\x02\x1e\x1e\x08\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e"
+    "\x0f\xe8\x00\xff\xff\xaf\x42\x57\x01\x1b\x1b\x04\x00\x2a\x1c\x1c\x04\x00\x22\x1d\x1d\x04\x00\x28\x1e\x1e\x04\x00\x0f\x57\x00\x0c"
+    "\x0f\x01\x00\x7e\x0f\xe8\x00\xd7\x01\xe0\x0a\xf3\x1b\x01\x53\x02\x19\x19\x57\x02\x1a\x1a\x53\x02\x1a\x1a\x2b\x01\x1b\x1b\x55\x02"
+    "\x1a\x1a\x55\x02\x1b\x1b\x53\x02\x1b\x1b\x0d\x02\x19\x19\x53\x02\x1c\x1c\x57\x02\x1c\x1c\x5a\x04\x00\x0f\x5a\x00\x0f\x0a\x01\x00"
+    "\x42\x11\x02\x19\x19\x04\x00\x22\x1a\x1a\x04\x00\x22\x1b\x1b\x04\x00\x2f\x1c\x1c\x04\x00\x01\x0f\x53\x00\x10\x0f\x01\x00\x1a\x06"
+    "\xe8\x00\x00\xc8\x00\xf3\x14\x1d\x1d\x53\x02\x1d\x1d\x2b\x01\x1e\x1e\x55\x02\x1d\x1d\x55\x02\x1e\x1e\x53\x02\x1e\x1e\x0d\x02\x1c"
+    "\x1c\x53\x02\x1f\x1f\x57\x02\x1f\x1f\x5a\x04\x00\x0f\x5a\x00\x0f\x0a\x01\x00\x06\xc4\x00\x22\x1d\x1d\x04\x00\x22\x1e\x1e\x04\x00"
+    "\x2f\x1f\x1f\x04\x00\x01\x0f\x53\x00\x10\x0f\x01\x00\x1a\x0f\xe8\x00\x07\x00\x04\x00\x24\x1f\x1f\xe8\x00\x04\xe0\x00\x04\xf0\x00"
+    "\x0f\x5a\x00\x0f\x0a\x01\x00\x0f\xe8\x00\x75\x51\x0d\x02\x36\x36\x0d\x8c\x0d\xf6\x0d\x37\x37\x0f\x02\x36\x36\x78\x02\x38\x38\x66"
+    "\x02\x38\x38\x77\x02\x38\x38\x78\x02\x39\x39\x67\x02\x39\x39\x5f\x00\x08\x00\x0f\x5a\x00\x0f\x0a\x01\x00\xc2\x12\x02\x36\x36\x5f"
+    "\x00\x36\x36\x12\x02\x37\x37\x04\x00\x22\x38\x38\x04\x00\x24\x39\x39\x04\x00\x26\xd0\x00\x08\x00\x0f\x53\x00\x10\x0f\x01\x00\x1a"
+    "\x08\xe8\x00\x00\xe4\x00\x17\x77\xe8\x00\x00\xe4\x00\x00\xec\x00\x0f\xe8\x00\xbd\x0f\xd0\x01\xd1\x1f\x66\xe8\x00\x00\x1f\x67\xb8"
+    "\x02\xc4\x0f\xa0\x03\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xcb\x12\x01\xe8\x00\xf1\x07\x00\x08\x02\x37\x37\x4a\x02\x37\x37\x6c"
+    "\x02\x38\x38\x4a\x02\x39\x39\x6c\x02\x39\x39\x08\x08\x00\xb7\x3a\x3a\x08\x02\x3a\x3a\x4a\x02\x3a\x3a\x6d\x08\x00\x0f\x59\x00\x0e"
+    "\x0b\x01\x00\x04\x10\x1c\x17\x4b\xf0\x1d\x02\x04\x00\x04\xf0\x1d\x37\x3a\x3a\x09\x08\x00\x0f\x53\x00\x10\x0f\x01\x00\x1a\x09\xe8"
+    "\x00\x13\x0a\xe8\x00\x1f\x0a\xe8\x00\x00\x13\x0a\xe8\x00\x03\x08\x00\x0f\x59\x00\x0e\x0b\x01\x00\x0f\xe8\x00\x7a\x13\x12\xe8\x00"
+    "\x1f\x12\xe8\x00\x00\x13\x12\xe8\x00\x03\x08\x00\x0f\x59\x00\x0e\x0b\x01\x00\x0f\xe8\x00\x6e\x03\xd0\x1e\x10\x47\xe8\x00\x13\x1a"
+    "\xe8\x00\x12\x1a\xe8\x00\x13\x66\xe8\x00\x13\x47\x08\x00\x44\x66\x02\x3a\x3a\x08\x00\xf0\x07\x47\x02\x3f\x3f\x4a\x1a\x3f\x3f\x6c"
+    "\x02\x40\x40\x4a\x1a\x41\x41\x6c\x02\x41\x41\x66\x02\x08\x00\x33\x42\x42\x47\x08\x00\x53\x66\x02\x42\x42\x6b\x08\x00\x0f\xe8\x00"
+    "\x11\x17\x48\x08\x00\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x04\xd0\x1e\x0f\xa0\x03\x1d\x10\x08\xe8\x00\x13\x02\xe8\x00\x01\xd8\x00\x33"
+    "\x41\x41\x08\xe0\x00\x97\x08\x02\x42\x42\x4a\x02\x42\x42\x6d\x08\x00\x0f\xe8\x00\x07\x06\x04\x00\x17\x09\x08\x00\x00\xd0\x1e\x02"
+    "\x04\x00\x0e\xb0\x29\x00\xd0\x1e\x04\x04\x00\x13\x93\xd0\x1e\x46\x93\x00\x32\x46\x04\x00\x02\x40\x24\x40\x94\x00\x32\x46\x04\x00"
+    "\x12\x95\x70\x22\x06\xe8\x00\x0f\xa0\x03\x18\x01\xe8\x00\x13\x0a\xe8\x00\x1f\x0a\xe8\x00\x00\x13\x0a\xe8\x00\x03\x08\x00\x0f\xe8"
+    "\x00\x7a\x0f\xa0\x03\x18\x01\xe8\x00\x13\x12\xe8\x00\x1f\x12\xe8\x00\x00\x13\x12\xe8\x00\x03\x08\x00\x0f\xe8\x00\x75\x0f\xa0\x03"
+    "\x0d\x00\x94\x03\x00\xe0\x00\x04\x08\x00\x0f\xa0\x03\x0d\x00\x94\x03\x00\xe0\x00\x04\x08\x00\x0f\xe8\x00\x11\x17\x48\x08\x00\x0f"
+    "\xe8\x00\x3d\x04\x60\x19\x11\x6f\x9c\x03\xf3\x04\x37\x37\x6f\x02\x38\x38\x6d\x02\x38\x38\x6f\x02\x39\x39\x6d\x02\x39\x39\x6f\xd8"
+    "\x00\x0c\x08\x00\x0f\xf7\x03\x0c\x0f\x01\x00\x7e\x08\xe8\x00\x02\x04\x00\x00\xe4\x00\x02\xe8\x00\x02\x04\x00\x02\xdc\x00\x0c\x04"
+    "\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x06\xe0\x0a\x22\x2f\x2f\x04\x00\x22\x30\x30\x04\x00\x22\x31\x31\x04\x00\x2f\x32\x32\x04\x00"
+    "\x01\x0f\x5a\x00\x0f\x0a\x01\x00\x42\x12\x02\x2f\x2f\x04\x00\x22\x30\x30\x04\x00\x22\x31\x31\x04\x00\x2f\x32\x32\x04\x00\x01\x0f"
+    "\x53\x00\x10\x0f\x01\x00\x1a\x04\x40\x07\xf4\x19\x72\x00\x2c\x2c\x17\x01\x2d\x2d\x72\x00\x2d\x2d\x51\x01\x2d\x2d\x52\x01\x2e\x2e"
+    "\x23\x00\x2d\x2d\x47\x02\x2d\x2d\x23\x00\x2f\x2f\x47\x02\x2f\x2f\xe1\x00\x2c\x2c\x08\x00\xf4\x19\x72\x00\x31\x31\x17\x01\x32\x32"
+    "\x72\x00\x32\x32\x51\x01\x32\x32\x52\x01\x33\x33\x23\x00\x32\x32\x47\x02\x32\x32\x23\x00\x34\x34\x47\x02\x34\x34\xe1\x00\x31\x31"
+    "\x08\x00\x42\x13\x02\x2c\x2c\x04\x00\x22\x2d\x2d\x04\x00\x22\x2e\x2e\x04\x00\xc6\x2f\x2f\x24\x00\x2f\x2f\x48\x02\x2f\x2f\xd1\x01"
+    "\x08\x00\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x21\x07\x00\x88\x04\x61\x01\xd7\x00\x2c\x2c\xdd\xc8\x00\x00\xd8\x00\x62\x2c\x2c\x51\x01"
+    "\x2e\x2e\xec\x00\x20\x2e\x2e\xdc\x00\x66\xdd\x00\x2e\x2e\xe1\x00\x08\x00\x0f\x5b\x00\x10\x09\x01\x00\x42\x12\x02\x2c\x2c\x04\x00"
+    "\x22\x2d\x2d\x04\x00\x22\x2e\x2e\x04\x00\x04\xe8\x01\x0a\x04\x00\xb5\x26\x02\x23\x32\x56\x00\x23\x32\x26\x02\x28\x04\x00\x01\x10"
+    "\x00\x65\x0a\x23\x32\x57\x00\x28\x04\x00\x13\x3c\x88\x04\x44\x3c\x00\x32\x46\x04\x00\x13\x3d\x88\x04\x53\x3d\x00\x32\x46\x3e\x04"
+    "\x00\x04\xd0\x01\x00\xe4\x00\x00\xc0\x01\x00\xc8\x00\x11\x84\xd4\x01\x02\xe8\x00\x80\x84\x00\x2f\x2f\x77\x01\x2d\x2d\xc4\x01\x22"
+    "\x77\x01\xcc\x01\x00\x08\x00\x40\xdd\x00\x31\x31\xc0\x01\x51\xdd\x00\x33\x33\x84\xd4\x01\x20\x33\x33\xd4\x01\x80\x84\x00\x34\x34"
+    "\x77\x01\x32\x32\xc4\x01\x22\x77\x01\xcc\x01\x00\x08\x00\x0f\xd0\x01\x09\x22\xd9\x01\xd4\x01\x17\x78\x08\x00\x0f\x39\x01\x0e\x0f"
+    "\x01\x00\x1c\x0f\xe8\x00\xd5\x0f\xb8\x02\xd5\x10\x07\x50\x2d\xb0\x1e\x01\x00\x13\x00\x0e\x0e\x29\x00\x0e\x0e\xb0\x33\x22\x29\x00"
+    "\xa8\x33\xc0\x29\x00\x10\x10\x58\x00\x0f\x0f\x58\x00\x11\x11\x88\x33\x17\x29\x08\x00\x0f\xdb\x00\x10\x0f\x01\x00\x2a\x4f\x58\x00"
+    "\x05\x0f\x04\x00\x00\x14\x14\x04\x00\x13\x59\x04\x00\x42\x58\x00\x28\x3c\x04\x00\x26\x32\x46\x04\x00\x02\x14\x00\x44\x59\x00\x32"
+    "\x46\x04\x00\x0f\xe8\x00\xc3\x20\x3c\x3c\x04\x00\x44\x59\x00\x46\x46\x04\x00\x0f\xd0\x01\xff\xac\x0f\xe8\x00\xe7\x10\x01\x70\x05"
+    "\x21\x50\x01\xf0\x30\xf0\x03\xfb\x01\x38\x38\x6e\x00\x39\x39\x52\x00\x39\x39\x58\x02\x39\x39\x30\x02\x0c\x00\xe4\x3b\x3b\x58\x02"
+    "\x3b\x3b\x30\x02\x3a\x3a\x6e\x00\x3a\x3a\x08\x00\x0f\xab\x00\x10\x09\x01\x00\x08\xf0\x30\x0a\x48\x10\xb7\x3b\x3b\xce\x01\x3b\x3b"
+    "\x59\x02\x3b\x3b\xfc\x08\x00\x42\x50\x02\x2d\x3c\x04\x00\x15\x32\x04\x00\x33\x52\x02\x2d\x04\x00\x33\x32\x3c\x51\x04\x00\x62\xc8"
+    "\x01\x23\x37\x74\x00\x04\x00\x00\x0c\x00\x00\x04\x00\xf1\x00\x75\x00\x23\x3c\xd3\x00\x23\x3c\xc9\x01\x23\x46\xe6\x00\x2d\x04\x00"
+    "\x0f\xc0\x32\x87\xc2\x19\x28\xca\x01\x19\x28\xdf\x00\x1e\x28\x50\x02\x04\x00\xe2\x51\x02\x19\x28\x40\x01\x19\x28\xe2\x00\x1e\x28"
+    "\x41\x01\x04\x00\xc4\xaa\x00\x28\x3c\xdf\x00\x28\x3c\xaa\x00\x32\x46\x04\x00\x02\x10\x00\x73\x28\x3c\xab\x00\x32\x46\xe0\x04\x00"
+    "\x0f\xe8\x00\xff\xff\x5b\x1b\x6b\xe8\x00\x00\xe4\x00\x53\x6c\x01\x19\x28\x6d\xe4\x00\x0f\xe8\x00\xb1\x00\x20\x38\x2e\x2a\x01\x30"
+    "\x38\x22\xb7\x00\x08\x00\x22\xb8\x00\x04\x00\x0f\xf8\x09\x0d\x13\xba\x04\x00\x12\x02\xe0\x0a\xf1\x07\x00\xfa\x01\x04\x04\x2a\x01"
+    "\x05\x05\xf8\x01\x05\x05\xb3\x00\x05\x05\xfa\x01\x05\x05\x36\x08\x00\x80\x06\x06\x07\x02\x07\x07\xbf\x01\x0c\x00\x00\x08\x00\x20"
+    "\x07\x07\x08\x00\x0f\xab\x00\x10\x09\x01\x00\x42\x13\x02\x04\x04\x04\x00\xa2\x05\x05\xce\x00\x05\x05\x13\x02\x06\x06\x04\x00\x2f"
+    "\x07\x07\x04\x00\x01\x0f\xe8\x00\x3d\x01\x58\x06\xff\x24\x32\x01\x00\xf8\x01\x0a\x0a\x07\x02\x0a\x0a\xf0\x00\x0a\x0a\x51\x00\x0a"
+    "\x0a\xf8\x01\x0b\x0b\x07\x02\x0b\x0b\xf0\x00\x0b\x0b\x51\x00\x0b\x0b\xf8\x01\x0c\x0c\x07\x02\x0c\x0c\xf8\x01\x0d\x0d\x07\x02\x0d"
+    "\x0d\xdb\x00\x10\x09\x01\x00\x42\x13\x02\x0a\x0a\x04\x00\x22\x0b\x0b\x04\x00\x22\x0c\x0c\x04\x00\x2f\x0d\x0d\x04\x00\x01\x0f\x18"
+    "\x39\x3d\x04\x98\x0d\x06\xe0\x00\xf0\x05\x0a\x0a\x6d\x00\x0a\x0a\x3a\x00\x0b\x0b\x3a\x00\x0d\x0d\xf0\x00\x0c\x0c\x51\x00\xe0\x00"
+    "\x31\x0c\x0c\x6d\x08\x00\x31\x0d\x0d\x6d\x18\x00\x04\x00\x01\x31\x0b\x0b\x6d\x2c\x00\xe4\x0c\x0c\x3a\x00\x0e\x0e\xf0\x00\x0d\x0d"
+    "\x51\x00\x0d\x0d\x28\x00\x50\xf8\x01\x0e\x0e\x6d\x80\x08\x0f\xe8\x00\x1c\x0f\x39\x01\x0e\x0f\x01\x00\x1c\x22\x01\x04\xe8\x00\xfa"
+    "\x13\xc3\x01\x1f\x1f\x45\x01\x1f\x1f\x48\x01\x20\x20\xc3\x01\x21\x21\xaa\x01\x20\x20\xaa\x01\x21\x21\xe3\x00\x22\x22\x46\x01\x21"
+    "\x21\x48\x01\x08\x00\xfa\x13\xc3\x01\x23\x23\x46\x01\x23\x23\xe3\x00\x24\x24\xc3\x01\x25\x25\xaa\x01\x24\x24\xaa\x01\x25\x25\xe3"
+    "\x00\x26\x26\x46\x01\x25\x25\x49\x01\x08\x00\x42\x13\x02\x1f\x1f\x04\x00\x22\x20\x20\x04\x00\x22\x21\x21\x04\x00\x2f\x22\x22\x04"
+    "\x00\x01\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x04\x08\x13\x00\xe4\x00\x62\x0f\x02\x20\x20\x0d\x02\xe8\x00\x60\x0d\x02\x22\x22\x0f\x02"
+    "\xd4\x00\x20\x23\x23\xd4\x00\x66\x0f\x02\x23\x23\x0d\x02\x08\x00\x0f\x5a\x00\x0f\x0a\x01\x00\x42\x12\x02\x20\x20\x04\x00\x22\x21"
+    "\x21\x04\x00\x22\x22\x22\x04\x00\x2f\x23\x23\x04\x00\x01\x0f\x53\x00\x10\x0f\x01\x00\x1a\x04\xe8\x00\x00\xd0\x00\x0f\xe8\x00\x01"
+    "\x00\x00\x01\x0f\xe8\x00\xb9\x0f\xd0\x01\xd5\x0f\xe8\x00\xff\xff\xff\x90\x0f\x70\x05\xff\xff\xff\xff\x73\x02\x01\x00\xf0\x0f\x5f"
+    "\x02\x1f\x1f\x3e\x02\x1f\x1f\x14\x00\x20\x20\x2a\x00\x20\x20\x5f\x02\x21\x21\x62\x01\x20\x20\x14\x00\x21\x21\x2a\x00\x0c\x00\x64"
+    "\x22\x22\x3f\x02\x22\x22\x08\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x0f\xe8\x00\xff\xff\xbf\x1f\x3f\xd0\x01\xff\xff\xa6\x0f\xe8\x00"
+    "\xff\xff\x92\x01\xa8\x16\x42\x62\x01\x2f\x2f\x04\x00\xfc\x07\x30\x30\x6f\x02\x30\x30\x62\x01\x31\x31\x6f\x02\x31\x31\x62\x01\x32"
+    "\x32\x6f\x02\x32\x32\x08\x00\x0f\x5b\x00\x10\x0f\x01\x00\x2a\x00\x70\x22\x1b\xb7\x70\x22\x01\x10\x00\x10\x0a\x04\x00\x42\x28\x32"
+    "\xb8\x00\x04\x00\xb5\x3c\x00\x28\x37\x26\x02\x28\x37\x3c\x00\x32\x04\x00\x07\x90\x17\x23\x3c\x3e\x04\x00\x04\xa8\x16\x42\x22\x02"
+    "\x2f\x2f\x04\x00\xfe\x07\x30\x30\x3b\x01\x30\x30\x22\x02\x31\x31\x3b\x01\x31\x31\x22\x02\x32\x32\x3b\x01\x32\x32\x08\x00\x22\x34"
+    "\x34\x04\x00\x60\x35\x35\x3b\x01\x35\x35\x60\x4c\x22\x3b\x01\x60\x4c\x11\x3b\x60\x4c\x0a\x08\x00\x00\x28\x24\x02\x04\x00\x20\x30"
+    "\x30\x04\x00\x11\xce\x0c\x27\x00\x04\x00\x20\x32\x32\x04\x00\x66\x23\x02\x32\x32\x97\x01\x08\x00\x0f\x09\x01\x0e\x0f\x01\x00\x1c"
+    "\x06\x68\x2c\x22\x2f\x2f\x04\x00\x22\x30\x30\x04\x00\xee\x31\x31\x4e\x01\x31\x31\x08\x02\x32\x32\x4e\x01\x32\x32\x08\x00\x22\x34"
+    "\x34\x04\x00\x22\x35\x35\x04\x00\x60\x36\x36\x4e\x01\x36\x36\xb0\x2c\x4c\x4e\x01\x37\x37\x08\x00\x0f\xe8\x00\x0d\x00\x04\x00\x17"
+    "\x09\x08\x00\x00\xd0\x01\x2a\xa2\x01\xd0\x01\x01\x10\x00\x65\x0a\x23\x32\xa3\x01\x28\x04\x00\x0f\x60\x19\x15\x06\xb0\x29\x22\x29"
+    "\x29\x04\x00\x22\x2a\x2a\x04\x00\xec\x2b\x2b\x5f\x00\x2b\x2b\x0d\x02\x2c\x2c\x5f\x00\x2c\x2c\x08\x00\x0f\x42\x01\x0f\x0a\x01\x00"
+    "\xc2\x12\x02\x29\x29\x5f\x00\x29\x29\x12\x02\x2a\x2a\x04\x00\x22\x2b\x2b\x04\x00\x04\x40\x25\x0a\x04\x00\x0f\x53\x00\x10\x0f\x01"
+    "\x00\x1a\x04\x10\x26\x0f\x98\x2a\x01\x22\x5f\x00\x98\x2a\x22\x5f\x00\x8c\x2a\x08\x08\x00\x0f\x5b\x00\x10\x09\x01\x00\x00\xe4\x25"
+    "\x2f\x5f\x00\x98\x2a\x17\x0f\xa0\x03\x04\x01\xb0\x4e\x62\x26\x0a\x28\x46\xb8\x00\x04\x00\x0f\xc8\x28\x1d\x42\x15\x02\x2f\x2f\x04"
+    "\x00\xfe\x07\x30\x30\x1a\x02\x30\x30\x15\x02\x31\x31\x1a\x02\x31\x31\x15\x02\x32\x32\x1a\x02\x32\x32\x08\x00\x22\x34\x34\x04\x00"
+    "\x60\x35\x35\x1a\x02\x35\x35\xe4\x50\x13\x1a\x8c\x37\x13\x1a\xc0\x35\x08\x08\x00\x0c\xb8\x02\x02\xb4\x02\x0a\xb8\x02\x17\x1b\x08"
+    "\x00\x0f\x39\x01\x0e\x0f\x01\x00\x1c\x04\xb8\x02\x42\x6d\x02\x2f\x2f\x04\x00\x22\x30\x30\x04\x00\xec\x31\x31\x7a\x02\x31\x31\x6d"
+    "\x02\x32\x32\x7a\x02\x32\x32\x08\x00\x0f\x5a\x00\x0f\x0a\x01\x00\x0f\xd0\x01\x1d\x0f\x53\x00\x10\x0f\x01\x00\x1a\x0f\x58\x06\xb0"
+    "\x0f\xb8\x02\x15\x0f\x70\x05\xda\x0f\xb8\x02\xcf\x02\xe8\x00\xf1\x02\x0c\x02\x10\x10\x0f\x02\x10\x10\x0c\x02\x11\x11\x0f\x02\x11"
+    "\x11\x14\x04\x00\x00\x28\x5e\x02\xec\x26\x93\x0c\x02\x12\x12\x5f\x00\x12\x12\x0f\x08\x00\x0f\x5a\x00\x0f\x0a\x01\x00\xc2\x11\x02"
+    "\x10\x10\x5f\x00\x10\x10\x11\x02\x11\x11\x04\x00\x22\x12\x12\x04\x00\x2f\x13\x13\x04\x00\x01\x0f\x53\x00\x10\x0f\x01\x00\x1a\x06"
+    "\x58\x06\x31\x1b\x1b\x0f\x24\x4b\x71\x1c\x1c\x0f\x02\x1c\x1c\x15\x04\x00\x60\x1e\x1e\x14\x00\x1d\x1d\x04\x00\x93\x0d\x02\x1e\x1e"
+    "\x5f\x00\x1e\x1e\x0f\x08\x00\x0f\x5b\x00\x10\x09\x01\x00\x00\x24\x4b\x28\x5f\x00\x28\x4b\x0c\x70\x49\x0a\x04\x00\x71\x26\x02\x0a"
+    "\x1e\xb7\x00\x0a\x08\x00\x04\x04\x00\x01\x10\x00\x12\x0a\x04\x00\x22\xb8\x00\x04\x00\x0f\x68\x2c\x17\x04\x28\x08\x0f\xe8\x00\x03"
+    "\x6f\x0d\x02\x1d\x1d\x0f\x02\xe8\x00\x5f\x0f\x53\x00\x10\x0f\x01\x00\x1a\x08\xa0\x3d\x13\x78\xbc\x3c\x00\xb8\x3c\xf0\x05\x31\x01"
+    "\x37\x37\x2b\x01\x37\x37\x31\x01\x39\x39\x2b\x01\x39\x39\x0d\x02\x38\x38\xb0\x3c\x04\x08\x00\x0f\x5a\x00\x0f\x0a\x01\x00\x0f\xa0"
+    "\x3d\x70\x03\xb8\x02\x0f\xe8\x00\x7b\x0f\x60\x36\x15\x22\x3c\x00\x1c\x00\x44\x3c\x00\x3c\x46\x04\x00\x00\xa8\x0c\x00\x1c\x00\x53"
+    "\x3d\x00\x3c\x3c\x3e\x04\x00\x0f\xe8\x00\xd8\x00\x87\x00\x0f\xb8\x02\xd1\x00\x07\x00\x0f\xe8\x00\xff\xff\xff\xff\x75\x01\x58\x06"
+    "\x00\xd4\x1d\x66\x37\x00\x22\x22\x56\x00\xd0\x1d\xf4\x05\x37\x00\x23\x23\x5a\x02\x25\x25\x0d\x02\x25\x25\x37\x00\x24\x24\x0f\x02"
+    "\x24\x24\x08\x00\x0f\x5b\x00\x10\x09\x01\x00\x0e\xd8\x1d\x22\x24\x24\x04\x00\x2f\x25\x25\x04\x00\x01\x00\x50\x2d\x35\x56\x00\x19"
+    "\x4c\x2d\x00\x04\x00\x00\x10\x00\x00\x3c\x2e\x35\x57\x00\x1e\x04\x00\x0f\xc8\x62\x15\x04\xd0\x01\xf0\x05\x0f\x02\x27\x27\x0d\x02"
+    "\x27\x27\x37\x00\x28\x28\x0d\x02\x28\x28\x0f\x02\x28\x28\x0c\x00\x13\x5b\x30\x12\x84\xd5\x00\x29\x29\x0f\x02\x29\x29\x08\x00\x0f"
+    "\xda\x00\x0f\x0a\x01\x00\x42\x12\x02\x27\x27\x04\x00\x22\x28\x28\x04\x00\x00\x2c\x12\x08\x30\x12\x0a\x04\x00\x0f\x53\x00\x10\x0f"
+    "\x01\x00\x1a\x04\x80\x0e\xf2\x19\x12\x01\x38\x38\x4e\x01\x38\x38\x12\x01\x39\x39\x37\x00\x39\x39\xa4\x00\x3a\x3a\xcb\x00\x3a\x3a"
+    "\x63\x02\x39\x39\xcb\x00\x3b\x3b\x63\x02\x3b\x3b\x60\x01\x39\x39\x08\x00\xf2\x1b\x3b\x3b\x12\x01\x40\x40\x4e\x01\x40\x40\x12\x01"
+    "\x41\x41\x37\x00\x41\x41\xa4\x00\x42\x42\xcb\x00\x42\x42\x63\x02\x41\x41\xcb\x00\x43\x43\x63\x02\x43\x43\x60\x01\x41\x41\x08\x00"
+    "\x0f\xb0\x63\x0b\x01\x04\x00\x1a\x01\x08\x00\x00\x24\x08\x1b\xa2\xd8\x6b\x01\x10\x00\x03\x28\x08\x22\xa3\x01\x04\x00\x13\x81\xc8"
+    "\x0b\x42\x81\x00\x32\x46\x04\x00\x21\x01\x64\x14\x00\x72\x0a\x28\x3c\x82\x00\x32\x46\x04\x00\x20\x01\x64\xe2\x44\x4f\x00\x00\x00"
+    "\x02\x12\x01\x0f\x0f\x01\x00\x2b\x42\x44\x02\x17\x17\x04\x00\x22\x18\x18\x04\x00\x22\x19\x19\x04\x00\x26\x1a\x1a\x08\x00\x06\x04"
+    "\x00\x0f\x53\x00\x10\x0f\x01\x00\x1a\x04\xd0\x01\x00\x78\x03\xa0\xb7\x00\x24\x24\x4f\x01\x25\x25\x50\x01\x90\x03\x40\x25\x25\xb7"
+    "\x00\x08\x00\xe4\x26\x26\xb7\x00\x26\x26\x4f\x01\x27\x27\x50\x01\x27\x27\x08\x00\x00\xd4\x02\xf0\x03\xb7\x00\x28\x28\x4f\x01\x29"
+    "\x29\x50\x01\x29\x29\x37\x00\x29\x29\xb7\x00\x08\x00\xe4\x2a\x2a\xb7\x00\x2a\x2a\x4f\x01\x2b\x2b\x50\x01\x2b\x2b\x08\x00\x40\x13"
+    "\x02\x24\x24\x04\x00\x60\x4b\x02\x25\x25\xce\x00\x78\x2c\x22\x26\x26\x04\x00\x24\x27\x27\x04\x00\x26\xb8\x00\x08\x00\xb5\x26\x02"
+    "\x19\x28\xb7\x00\x19\x28\x26\x02\x1e\x04\x00\x01\x10\x00\x83\x0a\x19\x28\xb8\x00\x1e\x28\x83\x04\x00\x22\x3e\x01\xd0\x01\x46\x3e"
+    "\x01\x32\x46\x04\x00\x02\xd0\x01\x44\x3f\x01\x32\x46\x04\x00\x0f\xd0\x01\x55\x42\x45\x02\x36\x36\x04\x00\x22\x37\x37\x04\x00\x22"
+    "\x38\x38\x04\x00\x2f\x39\x39\x04\x00\x01\x0f\x53\x00\x10\x0f\x01\x00\x1a\x04\xd0\x01\x04\x60\x36\x00\x4c\x67\xa2\xfb\x01\x39\x39"
+    "\xf9\x01\x3a\x3a\xfb\x01\x48\x67\x13\xfb\x48\x67\x0a\x08\x00\x60\x40\x40\xfb\x01\x40\x40\x64\x66\xa2\xfb\x01\x41\x41\xf9\x01\x42"
+    "\x42\x30\x02\x48\x67\x13\xfb\x48\x67\x04\x08\x00\x2f\x30\x02\xa0\x03\x0f\x00\x54\x36\x00\x58\x67\x04\x08\x00\x0f\xc8\x0b\x15\x00"
+    "\xcc\x01\x02\x04\x00\x44\x32\x46\x5d\x01\x04\x00\x02\xd0\x01\x00\x0c\x00\x13\x5e\x04\x00\x04\x80\x48\x08\xe8\x00\x9f\x6c\x00\x3a"
+    "\x3a\xfe\x01\x39\x39\xfe\xe8\x00\x08\x0f\x41\x01\x0e\x0b\x01\x00\x0f\xe8\x00\x09\x2e\xcf\x01\xe8\x00\x0f\x53\x00\x10\x0f\x01\x00"
+    "\x1a\x06\xd0\x01\x02\x9c\x13\x60\x0b\x02\x38\x38\xc1\x00\xf4\x00\x71\x39\x39\xfd\x01\x39\x39\x0b\xb4\x45\x0e\x08\x00\x40\xf9\x01"
+    "\x3f\x3f\xcc\x45\x60\x0b\x02\x40\x40\xc1\x00\xdc\x01\x71\x41\x41\xfd\x01\x41\x41\x0b\xc8\x45\x0e\x08\x00\x0c\x48\x67\x08\x38\x38"
+    "\x22\xd5\x01\x5c\x49\x17\xfc\x08\x00\x0f\x48\x71\x01\x2f\x55\x09\x48\x71\x27\x06\x80\x0e\x00\x08\x09\x20\x37\x37\xf0\x08\xa0\x0f"
+    "\x02\x38\x38\x0d\x02\x39\x39\x0f\x02\x00\x09\x6c\x3a\x3a\x0f\x02\x3a\x3a\x08\x00\x0f\x43\x01\x10\x09\x01\x00\x0f\x08\x09\x07\x2f"
+    "\x3a\x3a\x04\x00\x01\x0f\x68\x0f\x47\x0f\xe8\x00\xcb\x13\x09\x90\x17\xf1\x02\x27\x02\x0e\x0e\x2a\x02\x0e\x0e\x27\x02\x0f\x0f\x2a"
+    "\x02\x0f\x0f\x38\x04\x00\xff\x09\x0e\x0e\x2f\x02\x11\x11\x38\x02\x11\x11\x27\x02\x10\x10\x2a\x02\x10\x10\x27\x02\x11\x11\x2a\x02"
+    "\xd0\x3b\x4f\x0f\x90\x34\x04\x14\x14\x04\x00\x13\x51\x04\x00\x00\x90\x34\x2a\x6e\x01\x90\x34\x00\x8c\x34\x93\xd3\x00\x28\x3c\x71"
+    "\x01\x32\x46\x6f\x04\x00\x0f\xe8\x00\xd5\x04\x30\x1b\x91\x3e\x02\x15\x15\x3c\x02\x15\x15\x38\x04\x00\xf1\x10\x17\x17\xfe\x01\x16"
+    "\x16\xfe\x01\x18\x18\x3c\x02\x16\x16\x3e\x02\x16\x16\x3c\x02\x17\x17\x3e\x02\x17\x17\x3c\x02\x18\x18\x3e\x04\x00\x00\x0c\x00\x20"
+    "\x17\x17\x2c\x00\x40\x38\x02\x19\x19\x2c\x00\x44\xfe\x01\x1a\x1a\x20\x00\xf0\x05\x3c\x02\x19\x19\x3e\x02\x19\x19\x3c\x02\x1a\x1a"
+    "\x3e\x02\x1a\x1a\x13\x02\x15\x15\x04\x00\x51\x4b\x02\x16\x16\x13\x04\x00\x22\x17\x17\x04\x00\x20\x18\x18\x04\x00\x1b\x3d\x08\x00"
+    "\x0f\x09\x01\x0e\x0f\x01\x00\x1c\x04\x70\x05\xf3\x0e\x49\x02\x17\x17\x68\x02\x17\x17\x08\x02\x1a\x1a\x4e\x02\x1a\x1a\x49\x02\x19"
+    "\x19\x1d\x02\x1a\x1a\xb7\x00\x19\x19\x4c\x18\x00\x44\x68\x02\x1a\x1a\x08\x00\x15\x49\x10\x00\xf3\x04\x1d\x1d\x4e\x02\x1d\x1d\x49"
+    "\x02\x1c\x1c\x1d\x02\x1d\x1d\xb7\x00\x1c\x1c\x4c\x18\x00\x44\x68\x02\x1d\x1d\x08\x00\x04\xd4\x00\x11\x4b\x04\x00\xf6\x09\x19\x19"
+    "\x13\x02\x19\x19\xce\x00\x19\x19\xb8\x00\x1a\x1a\x5f\x01\x1a\x1a\x09\x02\x1a\x1a\x1e\x02\x08\x00\x80\x26\x02\x0a\x19\xb7\x00\x0a"
+    "\x19\x08\x00\x04\x04\x00\x0f\xa8\x16\x21\x05\x30\x38\x04\xe8\x00\x1b\x0a\xe8\x00\x1f\x0a\xe8\x00\x0c\x1b\x0a\xe8\x00\x1f\x0a\xe8"
+    "\x00\x94\x1b\x12\xe8\x00\x1f\x12\xe8\x00\x0c\x1b\x12\xe8\x00\x1f\x12\xe8\x00\x94\x1b\x1a\xe8\x00\x1f\x1a\xe8\x00\x0c\x1b\x1a\xe8"
+    "\x00\x1f\x1a\xe8\x00\x8b\x0f\x60\x19\x05\xfc\x01\x30\x01\x1d\x1d\x62\x02\x1d\x1d\x30\x01\x1e\x1e\x62\x02\x1e\x1e\x08\x00\x0f\xfa"
+    "\x03\x0f\x0a\x01\x00\x0e\x70\x65\x0f\x60\x19\x65\x0f\xe8\x00\xff\xb4\x22\x05\x06\x40\x07\xf4\x19\x08\x02\x1e\x1e\x49\x02\x1e\x1e"
+    "\xf9\x01\x1f\x1f\x0b\x02\x1f\x1f\x08\x02\x20\x20\x0b\x02\x21\x21\x4f\x01\x20\x20\x50\x01\x20\x20\xf9\x01\x21\x21\x4e\x02\x21\x21"
+    "\x08\x00\x51\x08\x02\x21\x21\x49\x10\x00\xc0\x22\x22\x0b\x02\x22\x22\x08\x02\x23\x23\x0b\x02\xa8\x0f\xe4\x23\x23\x50\x01\x23\x23"
+    "\xf9\x01\x24\x24\x4e\x02\x24\x24\x08\x00\x40\x13\x02\x1e\x1e\x04\x00\x1f\x4b\xd8\x3b\x06\x37\x21\x21\x09\x08\x00\x0f\xb9\x00\x0e"
+    "\x0f\x01\x00\x1c\x04\x28\x08\x01\xe8\x00\x1f\x0a\xe8\x00\x1c\x1f\x0a\xe8\x00\xa4\x1f\x12\xe8\x00\x1c\x1f\x12\xe8\x00\x9f\x10\x65"
+    "\xe8\x00\x18\x1a\xe8\x00\x28\x1e\x1e\xe8\x00\x22\x65\x02\xe0\x00\x08\x08\x00\x28\x49\x1a\xe8\x00\x28\x21\x21\xe8\x00\x22\x65\x02"
+    "\xe0\x00\x04\x08\x00\x0f\xe8\x00\x6d\x06\x80\x2b\x22\x1b\x1b\x04\x00\x22\x1c\x1c\x04\x00\x22\x1d\x1d\x04\x00\x2f\x1e\x1e\x04\x00"
+    "\x01\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x06\xe8\x00\x0e\xe0\x00\x11\x5d\xd4\x00\x60\x1f\x1f\x2a\x00\x1f\x1f\x08\x00\x26\x5d\x02\x08"
+    "\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x06\xe8\x00\x0e\xe0\x00\x00\xd0\x00\x00\x5c\x2d\x02\x00\x31\x46\x20\x20\x5d\x02\x08\x00\x0f"
+    "\x57\x00\x0c\x0f\x01\x00\x7e\x06\xe8\x00\x0c\xe0\x00\x02\x30\x2e\x06\xe0\x00\x40\x21\x21\x5d\x02\x10\x00\x02\x08\x00\x0f\x57\x00"
+    "\x0c\x0f\x01\x00\x7e\x0f\xb0\x80\x89\x1f\x18\xb0\x80\x00\x04\x14\x00\x0f\x98\x81\xb9\x02\xd4\x00\x0a\xb0\x80\x04\x14\x00\x0f\xb0"
+    "\x80\x1d\x0f\xe8\x00\xd5\x0f\x80\x82\x89\x0f\xd0\x01\xd5\x0f\x50\x84\x39\x0f\x20\x86\xff\xff\xa7\x04\xc8\x0b\xf8\x17\x3f\x02\x25"
+    "\x25\x3c\x02\x25\x25\x39\x02\x26\x26\x3c\x02\x27\x27\x70\x02\x26\x26\xfe\x01\x28\x28\x70\x02\x28\x28\x59\x00\x28\x28\x3f\x02\x27"
+    "\x27\x39\x02\x08\x00\xf6\x15\x29\x29\x3c\x02\x29\x29\x39\x02\x2a\x2a\x3c\x02\x2b\x2b\x70\x02\x2a\x2a\xfe\x01\x2c\x2c\x70\x02\x2c"
+    "\x2c\x59\x00\x2c\x2c\x3f\x02\x2b\x2b\x39\x02\x08\x00\x20\x13\x02\xdc\x1d\x3d\x25\x25\x4b\xe0\x1d\x20\x28\x28\x04\x00\x57\x3d\x02"
+    "\x28\x28\x40\x08\x00\x0f\x09\x01\x0e\x0f\x01\x00\x1c\x04\x08\x13\x13\x68\x4c\x22\x11\xcf\xc8\x1e\x00\x78\x0c\xc0\x26\x26\x50\x01"
+    "\x26\x26\x4f\x02\x25\x25\x4c\x02\x18\x00\x64\x27\x27\x68\x02\x27\x27\x08\x00\x13\x68\xa8\x21\x11\xcf\xc8\x1e\x00\xd8\x1e\xc0\x2a"
+    "\x2a\x50\x01\x2a\x2a\x4f\x02\x29\x29\x4c\x02\x18\x00\x64\x2b\x2b\x68\x02\x2b\x2b\x08\x00\x08\xd0\x1e\x02\xf4\x00\x0a\xf0\x00\x22"
+    "\xd8\x01\xc8\x1e\x04\x08\x00\x00\xd0\x1e\x2a\xa2\x01\xd0\x1e\x01\x10\x00\x65\x0a\x19\x28\xa3\x01\x1e\x04\x00\x22\x76\x00\x3c\x2f"
+    "\x11\x76\xa4\x81\x04\x04\x00\x0f\x78\x8c\x07\xf0\x03\x9f\x01\x23\x23\x3b\x01\x23\x23\x1c\x02\x24\x24\x08\x02\x25\x25\xd6\x00\x08"
+    "\x00\xf7\x00\x24\x24\xd6\x00\x26\x26\x1c\x02\x26\x26\x3b\x01\x25\x25\x08\x08\x00\xf0\x03\x9f\x01\x27\x27\x3b\x01\x27\x27\x1c\x02"
+    "\x28\x28\x08\x02\x29\x29\xd6\x00\x08\x00\xf7\x00\x28\x28\xd6\x00\x2a\x2a\x1c\x02\x2a\x2a\x3b\x01\x29\x29\x08\x08\x00\x40\x13\x02"
+    "\x23\x23\x04\x00\x60\x4b\x02\x24\x24\xce\x00\xf4\x00\x02\xf0\x00\xe6\x09\x02\x26\x26\x1e\x02\x26\x26\xa0\x01\x26\x26\x97\x01\x08"
+    "\x00\x0f\xa1\x01\x0e\x0f\x01\x00\x1c\x04\xd0\x01\xf1\x1e\x72\x00\x22\x22\x17\x01\x22\x22\xaa\x01\x22\x22\x51\x01\x24\x24\x52\x01"
+    "\x24\x24\x67\x01\x23\x23\xaa\x01\x23\x23\x67\x01\x25\x25\x72\x00\x24\x24\x17\x01\x24\x24\x72\x00\x25\x25\x17\x10\x00\xf4\x1f\x26"
+    "\x26\x17\x01\x26\x26\xaa\x01\x26\x26\x51\x01\x28\x28\x52\x01\x28\x28\x67\x01\x27\x27\xaa\x01\x27\x27\x67\x01\x29\x29\x72\x00\x28"
+    "\x28\x17\x01\x28\x28\x72\x00\x29\x29\x17\x01\x29\x29\xe0\x4c\x13\x4b\xf0\x00\x04\xe0\x01\x04\xf0\x00\x00\x04\x00\x11\xd1\x30\x4d"
+    "\x02\x08\x00\x00\x40\x24\x13\x78\xa0\x20\x04\x40\x24\x00\x10\x00\x00\x40\x24\x62\x26\x0a\x1e\x28\x79\x00\x04\x00\x0f\x08\x87\x18"
+    "\x03\x88\x21\x31\x22\x22\x4d\xe8\x4d\x80\x22\x22\x6b\x02\x21\x21\x6b\x02\xe0\x00\x00\xf8\x00\x00\x08\x00\x00\xd4\x02\x39\x23\x23"
+    "\x4e\x08\x00\x40\x25\x25\x6b\x02\xe8\x4d\x40\x26\x26\x4e\x01\x0c\x00\x00\xe0\x00\x00\xf8\x00\x00\x08\x00\x00\xd4\x02\x37\x27\x27"
+    "\x4e\x08\x00\x04\x4c\x0f\x15\x4b\xd4\x4d\x0c\xf0\x00\x0a\x04\x00\x80\x26\x02\x0f\x23\xa2\x01\x0f\x23\x08\x00\x04\x04\x00\xa0\xa2"
+    "\x01\x0f\x28\x26\x0a\x0f\x28\xa3\x01\xbc\x02\x02\x04\x00\x0f\x30\x8f\x18\x01\xe8\x00\x00\xe4\x00\xe2\x22\x02\x21\x21\x25\x00\x22"
+    "\x22\xb4\x01\x20\x20\xb7\x00\x20\x26\x40\x22\x02\x23\x23\x10\x00\x00\x08\x00\x00\xe0\x00\x04\x08\x00\xf0\x01\x25\x00\x25\x25\x22"
+    "\x02\x25\x25\x4e\x01\x26\x26\x22\x02\x27\x27\x94\x22\x00\x9c\x22\x40\xb5\x01\x24\x24\x04\x00\x00\x14\x00\x00\xe0\x00\x04\x08\x00"
+    "\x0f\xe8\x00\x0d\x10\x23\xdc\x00\x16\x00\x08\x00\x0f\x70\x22\x09\x00\xd0\x01\x00\x74\x22\x00\x04\x00\x0f\x18\x90\x1d\xd3\x1c\x00"
+    "\x36\x36\xcf\x00\x37\x37\x1c\x00\x38\x38\x30\xfc\x86\x20\xf7\x00\x08\x00\x00\x0c\x87\x86\x39\x39\xf7\x00\x39\x39\xcf\x00\x08\x00"
+    "\xd3\x1c\x00\x3e\x3e\xcf\x00\x3f\x3f\x1c\x00\x40\x40\x30\xfc\x86\x20\xf7\x00\x08\x00\x00\x0c\x87\x86\x41\x41\xf7\x00\x41\x41\xcf"
+    "\x00\x08\x00\x04\x08\x87\x1f\x4b\xc0\x1f\x00\x00\xf8\x86\x66\xd8\x01\x39\x39\xf8\x00\x08\x00\x0f\x71\x03\x0e\x0f\x01\x00\x1c\x0f"
+    "\x18\x1c\xdd\xf2\x05\x22\x02\x15\x15\x1d\x02\x15\x15\x9f\x01\x16\x16\x1f\x02\x15\x15\x3b\x01\x17\x17\x08\x00\xc0\x18\x18\xd6\x00"
+    "\x18\x18\x22\x02\x17\x17\x1d\x02\x08\x00\x22\x18\x18\x08\x00\x00\x10\x00\xe2\x17\x17\x9f\x01\x18\x18\x20\x02\x17\x17\x3b\x01\x19"
+    "\x19\x08\x00\x73\x1a\x1a\xd6\x00\x1a\x1a\x22\x58\x1c\x40\x22\x02\x1a\x1a\x08\x00\x02\xe8\x00\x20\x17\x17\xe8\x00\xf6\x0b\xff\x01"
+    "\x16\x16\x01\x02\x16\x16\x03\x02\x16\x16\xa0\x01\x18\x18\x97\x01\x18\x18\x1e\x02\x18\x18\x23\x02\x08\x00\x00\x50\x19\x2a\xa2\x01"
+    "\x60\x19\x22\xa2\x01\x5c\x19\x26\xa3\x01\x04\x00\x0f\x48\x1a\x1d\x00\x8c\x5a\x11\x2e\x48\x22\x60\x38\x38\x65\x01\x3a\x3a\xac\x02"
+    "\x22\xc7\x01\x90\x5a\x13\x1b\xa0\x5a\x0a\x08\x00\x40\x41\x41\x2e\x02\x38\x24\x60\x40\x40\x65\x01\x42\x42\xac\x02\x13\xc7\x44\x24"
+    "\x20\x1b\x02\x34\x24\x0a\x08\x00\x0f\xe0\x27\x0e\x47\x02\x3b\x3b\x1a\x08\x00\x0f\xa0\x5a\x17\x40\x32\x3c\x74\x00\x08\x00\x42\x3c"
+    "\x46\xde\x00\x04\x00\x00\x10\x00\x93\xc9\x01\x32\x3c\x75\x00\x3c\x46\xe6\x04\x00\x06\x30\x55\xff\x07\x02\x02\xfd\x01\x02\x02\xf8"
+    "\x01\x03\x03\xfd\x01\x03\x03\xf8\x01\x04\x04\xfd\x01\x04\x04\x08\x00\x05\x0f\x2b\x02\x10\x09\x01\x00\x00\x60\x00\x02\x04\x00\x00"
+    "\x5c\x00\x02\x60\x00\x0f\x04\x00\x09\x0f\x30\x8f\x15\x0f\xd0\x01\x1d\x68\x07\x02\x02\x02\x1c\x02\xe8\x00\xc2\x03\x03\x1c\x02\x03"
+    "\x03\x07\x02\x04\x04\x1c\x02\xdc\x00\x26\xbf\x00\x08\x00\x62\x07\x02\x09\x09\x1f\x02\x60\x55\x22\xfd\x01\x08\x00\x20\x1c\x02\x4c"
+    "\x56\x00\x08\x00\x00\x14\x00\x64\x0b\x0b\xbf\x00\x0b\x0b\x08\x00\x42\x13\x02\x02\x02\x04\x00\x66\x03\x03\xce\x00\x03\x03\x10\x57"
+    "\x0f\x04\x00\x03\x0f\xe8\x57\x3e\x03\xe8\x00\x2f\xbf\x00\xe8\x00\x11\x20\x03\x03\xe4\x00\x02\x04\x00\x0f\xe8\x00\x11\x20\x0a\x0a"
+    "\xe4\x00\x0f\xe8\x00\x79\x0f\xd0\x01\xd5\x0f\xe8\x00\xcd\x04\xa0\x03\x40\x4f\x02\x27\x27\xbc\x09\x00\x94\x0a\x00\x88\x0c\x62\x51"
+    "\x01\x29\x29\x52\x01\x8c\x0c\x00\x50\x2b\x60\x6b\x02\x2a\x2a\xe1\x00\x24\x00\x02\x08\x00\x62\x4f\x02\x2c\x2c\x6b\x02\x54\x69\x17"
+    "\x37\x98\x66\x93\xb7\x00\x2d\x2d\xb7\x00\x2f\x2f\x6b\x48\x69\x04\x08\x00\x04\x98\x0c\x13\x4b\x88\x0d\x20\x13\x02\xf4\x0a\x00\x04"
+    "\x00\x00\xe4\x0b\x02\x04\x00\x26\xb8\x00\x08\x00\x80\x26\x02\x0f\x28\xb7\x00\x0f\x28\x08\x00\x04\x04\x00\x01\x10\x00\x10\x0a\x04"
+    "\x00\x42\x19\x2d\xb8\x00\x04\x00\x0f\xf8\x09\x1d\xf0\x09\x72\x02\x31\x31\x1b\x02\x30\x30\xcf\x00\x31\x31\x6b\x02\x30\x30\x4f\x02"
+    "\x31\x31\x37\x00\x32\x32\x0c\x00\xc4\x1b\x02\x31\x31\x75\x02\x2f\x2f\x72\x02\x33\x33\x08\x00\xf0\x07\x72\x02\x36\x36\x1b\x02\x35"
+    "\x35\xcf\x00\x36\x36\x6c\x02\x35\x35\x4f\x02\x36\x36\x37\x00\x04\x6d\xe4\x35\x35\x1b\x02\x36\x36\x75\x02\x34\x34\x72\x02\x38\x38"
+    "\x08\x00\x04\xb0\x3c\x1d\x4b\x68\x3f\x20\x33\x33\x04\x00\x57\xd8\x01\x33\x33\x1a\x08\x00\x00\xcc\x43\x20\xa2\x01\xd4\x43\x15\x2d"
+    "\x04\x00\x01\x10\x00\x65\x0a\x28\x37\xa3\x01\x2d\x04\x00\x0f\x00\x3a\x15\x0f\x40\x5e\x89\x0f\xb0\x0c\x39\x01\xe8\x00\x1f\x50\xe8"
+    "\x00\x81\x0f\x28\x08\x1f\x04\x04\x00\x0f\x28\x08\x01\x0f\xe8\x00\x87\x88\x1e\x2d\xca\x01\x1e\x2d\xdf\x00\x88\x95\xc2\x1e\x2d\x52"
+    "\x02\x1e\x2d\xe2\x00\x23\x2d\x52\x02\x04\x00\x00\xb8\x01\x00\x00\x60\x08\xd0\x01\x02\x10\x00\x00\x18\x00\x06\x10\x60\x00",
+    7390, 40368);
+
+const Resource white(
+    "\x8f\x00\x00\x00\x03\x01\x32\x01\x00\x01\x00\x7d\x4d\x26\x0a\x05\x0f\x04\x00\x3c\x02\x05\x14\x04\x00\x80\x76\x00\x23\x37\x26\x0a"
+    "\x23\x37\x08\x00\x07\x04\x00\xc1\x3c\x26\x02\x23\x3c\x77\x00\x23\x46\x77\x00\x2d\x04\x00\x0f\xe8\x00\x85\x4c\x50\x02\x0a\x19\x04"
+    "\x00\x44\x52\x02\x0a\x1e\x04\x00\x13\x51\x04\x00\x80\x62\x00\x23\x37\xaa\x00\x23\x37\x08\x00\x22\x72\x01\x04\x00\xf1\x00\xaa\x00"
+    "\x23\x3c\x72\x01\x23\x3c\x63\x00\x23\x46\xab\x00\x2d\x04\x00\x13\x08\xe8\x00\xf1\x02\x18\x02\x1e\x1e\x68\x02\x1e\x1e\x18\x02\x1f"
+    "\x1f\x68\x02\x1f\x1f\x6a\x04\x00\x71\x20\x20\x18\x02\x20\x20\x68\x08\x00\x64\x21\x21\x68\x02\x21\x21\x08\x00\x0f\xab\x00\x10\x0f"
+    "\x01\x00\x2a\x4f\x6a\x02\x0f\x23\x04\x00\x00\x14\x28\x04\x00\x13\x19\x04\x00\x80\x53\x01\x23\x37\x6a\x02\x23\x37\x08\x00\x07\x04"
+    "\x00\xc1\x3c\x6a\x02\x23\x3c\x54\x01\x23\x46\x54\x01\x2d\x04\x00\x0f\xe8\x00\xff\xbe\x0f\xa0\x03\x85\x0f\xd0\x01\x3e\x12\x08\xe4"
+    "\x00\xf0\x0f\xf8\x01\x08\x08\xfd\x01\x08\x08\xf8\x01\x09\x09\xfd\x01\x09\x09\x05\x02\x08\x08\x05\x02\x0a\x0a\xf8\x01\x0a\x0a\xfd"
+    "\x01\x08\x00\x64\x0b\x0b\xfd\x01\x0b\x0b\x08\x00\xf4\x19\xf9\x01\x2f\x2f\xfe\x01\x2f\x2f\x14\x00\x30\x30\x05\x02\x30\x30\xa6\x00"
+    "\x31\x31\xa8\x00\x31\x31\x92\x01\x30\x30\x31\x00\x30\x30\x92\x01\x32\x32\x31\x00\x32\x32\x08\x00\x42\x13\x02\x08\x08\x04\x00\x22"
+    "\x09\x09\x04\x00\x68\x0a\x0a\x13\x02\x0b\x0b\x04\x00\x17\x06\x08\x00\x0f\x09\x01\x0e\x0f\x01\x00\x1d\x1f\x08\x24\x00\x10\x0f\x01"
+    "\x00\x00\x80\x14\x00\x2f\x2f\x92\x01\x2f\x2f\xe4\x00\x00\xec\x00\x00\xe0\x00\x22\x05\x02\xec\x00\x00\xf4\x00\x13\x14\xe4\x00\x04"
+    "\x08\x00\x0f\x53\x00\x10\x0f\x01\x00\x4a\x04\xd0\x01\xf1\x02\x17\x02\x0c\x0c\x07\x02\x0c\x0c\x17\x02\x0d\x0d\x07\x02\x0d\x0d\x14"
+    "\x04\x00\x71\x0e\x0e\x17\x02\x0e\x0e\x1a\x18\x00\x66\x0f\x0f\x1a\x02\x0f\x0f\x08\x00\x31\x0e\x0e\x07\x20\x00\x71\x0f\x0f\x07\x02"
+    "\x0f\x0f\x14\x04\x00\x71\x10\x10\x17\x02\x10\x10\x1a\x18\x00\x64\x11\x11\x1a\x02\x11\x11\x08\x00\x42\x13\x02\x0c\x0c\x04\x00\x22"
+    "\x0d\x0d\x04\x00\x68\x0e\x0e\x13\x02\x0f\x0f\x04\x00\x17\x1b\x08\x00\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x31\x08\x08\x01\xa0\x03\xd3"
+    "\x24\x02\x0e\x0e\x1c\x02\x0e\x0e\x24\x02\x0f\x0f\x1c\xbc\x00\x11\x1f\x08\x00\xb1\x10\x10\x1f\x02\x10\x10\x24\x02\x10\x10\x1c\x08"
+    "\x00\xf1\x0c\x11\x11\x1c\x02\x11\x11\x24\x02\x16\x16\x1d\x02\x16\x16\x24\x02\x17\x17\x1d\x02\x17\x17\x08\x02\x17\x17\x20\x08\x00"
+    "\xb1\x18\x18\x20\x02\x18\x18\x24\x02\x18\x18\x1d\x08\x00\x64\x19\x19\x1d\x02\x19\x19\xd8\x00\x91\xff\x01\x0f\x0f\x01\x02\x0f\x0f"
+    "\x03\xd4\x00\x00\x00\x01\x06\x04\x00\x17\x25\x08\x00\x4d\x26\x0a\x05\x14\x04\x00\x0f\x28\x08\x28\x13\x03\xf0\x00\xf1\x0e\x27\x02"
+    "\x13\x13\x2a\x02\x13\x13\x27\x02\x14\x14\x2a\x02\x14\x14\x2c\x02\x14\x14\x2f\x02\x14\x14\x27\x02\x15\x15\x2d\x08\x00\x64\x16\x16"
+    "\x2d\x02\x16\x16\x08\x00\x0f\x3f\x01\x0c\x0f\x01\x00\x7e\x0f\xe8\x00\x09\x1f\x31\xe8\x00\xc4\x13\x32\xe8\x00\x13\x32\xe0\x00\x46"
+    "\x32\x02\x15\x15\x08\x00\x33\x16\x16\x32\xe8\x00\x00\x08\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x0f\xe8\x00\xdd\xf6\x09\x28\x02\x22"
+    "\x22\x33\x02\x22\x22\x28\x02\x23\x23\x33\x02\x23\x23\x28\x02\x24\x24\x33\x02\x24\x24\x08\x00\x64\x25\x25\x33\x02\x25\x25\x08\x00"
+    "\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x0f\xe8\x00\xff\xff\xb1\xf0\x11\x2f\x2f\x1c\x00\x2f\x2f\x33\x02\x30\x30\x5f\x00\x30\x30\x28\x02"
+    "\x30\x30\x1c\x00\x31\x31\x33\x02\x31\x31\x5f\x00\x31\x31\x28\x02\x0c\x00\x60\x32\x32\x28\x02\x32\x32\x08\x00\x0f\x57\x00\x0c\x0f"
+    "\x01\x00\x7e\x0f\xe8\x00\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xb1\x42\x58\x01\x2f\x2f\x04\x00\x22\x30\x30\x04\x00\x22"
+    "\x31\x31\x04\x00\x2f\x32\x32\x04\x00\x01\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x0f\xe8\x00\xdd\x0f\xa0\x03\xd7\x0f\xf0\x13\xff\xff\xff"
+    "\x90\x0f\xe8\x00\xd3\x0f\x48\x1a\xff\xb6\x04\xb8\x1f\xf6\x19\xfb\x01\x15\x15\x3c\x02\x14\x14\xfb\x01\x16\x16\x14\x02\x15\x15\x46"
+    "\x02\x14\x14\x46\x02\x15\x15\x14\x02\x16\x16\x46\x02\x16\x16\xfb\x01\x17\x17\x46\x02\x17\x17\x08\x00\xf4\x17\x19\x19\x3c\x02\x18"
+    "\x18\xfb\x01\x1a\x1a\x14\x02\x19\x19\x46\x02\x18\x18\x46\x02\x19\x19\x14\x02\x1a\x1a\x46\x02\x1a\x1a\xfb\x01\x1b\x1b\x46\x02\x1b"
+    "\x1b\x08\x00\x42\x13\x02\x14\x14\x04\x00\x22\x15\x15\x04\x00\x64\x16\x16\x13\x02\x17\x17\x04\x00\x66\x3d\x02\x17\x17\xfc\x01\x08"
+    "\x00\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x21\x03\x00\xe8\x00\xf1\x03\x01\x53\x02\x18\x18\x57\x02\x19\x19\x53\x02\x19\x19\x0d\x02\x18"
+    "\x18\x55\x04\x00\x00\x10\x00\xf3\x00\x1a\x1a\x57\x02\x1a\x1a\x53\x02\x1b\x1b\x57\x02\x1b\x1b\x5a\x04\x00\x0f\x5a\x00\x0f\x0a\x01"
+    "\x00\x42\x11\x02\x18\x18\x04\x00\x22\x19\x19\x04\x00\x22\x1a\x1a\x04\x00\x2f\x1b\x1b\x04\x00\x01\x0f\x53\x00\x10\x0f\x01\x00\x1a"
+    "\x0f\xe8\x00\x07\x31\x19\x19\x55\xe0\x00\x0f\xe8\x00\xcd\x64\x1a\x1a\x55\x02\x1b\x1b\xe8\x00\x04\xe0\x00\x04\xf0\x00\x0f\x5a\x00"
+    "\x0f\x0a\x01\x00\x0f\xe8\x00\x75\xf1\x06\x0d\x02\x1c\x1c\x15\x02\x1c\x1c\x0d\x02\x1d\x1d\x15\x02\x1e\x1e\x0d\x02\x1e\x1e\x65\x10"
+    "\x00\xf1\x00\x1e\x1e\x0f\x02\x1d\x1d\x0d\x02\x1f\x1f\x0f\x02\x1e\x1e\x67\x08\x00\x2f\x1f\x1f\x5a\x00\x0f\x0a\x01\x00\x42\x11\x02"
+    "\x1c\x1c\x04\x00\x22\x1d\x1d\x04\x00\x22\x1e\x1e\x04\x00\x2f\x1f\x1f\x04\x00\x01\x0f\x53\x00\x10\x0f\x01\x00\x1a\x0f\xe8\x00\x09"
+    "\x11\x0f\x10\x00\x00\xd8\x00\x20\x1d\x1d\xf4\x00\x02\xe8\x00\x00\x08\x00\x0f\xe8\x00\xbb\x0f\xd0\x01\xc1\x02\xd4\x00\x00\xe4\x00"
+    "\x00\xbc\x01\x00\xd8\x00\x00\xe8\x00\x00\x04\x00\x00\xd8\x00\x22\x1c\x1c\xe0\x00\x22\x1d\x1d\x08\x00\x2f\x1e\x1e\x5a\x00\x0f\x0a"
+    "\x01\x00\x0f\xd0\x01\xff\x5e\x0f\xa0\x03\xff\xff\xff\xff\xff\xff\xff\xff\xff\xe6\x12\x08\xe8\x00\xa1\x00\x08\x02\x1e\x1e\x49\x02"
+    "\x1f\x1f\x6b\x08\x00\x71\x20\x20\x6b\x02\x1f\x1f\x08\x08\x00\x31\x20\x20\x6d\x18\x00\x31\x21\x21\x6d\x10\x00\x00\x08\x00\x0f\x78"
+    "\x35\x1f\x40\x13\x02\x1e\x1e\x04\x00\x51\x4b\x02\x1f\x1f\x13\x04\x00\x68\x20\x20\x13\x02\x21\x21\x04\x00\x17\x09\x08\x00\x0f\x53"
+    "\x00\x10\x0f\x01\x00\x1a\x09\xe8\x00\x13\x0a\xe8\x00\x1f\x0a\xe8\x00\xcc\x13\x12\xe8\x00\x1f\x12\xe8\x00\xc0\x03\xd8\x14\x81\x46"
+    "\x02\x1f\x1f\x49\x1a\x1e\x1e\xe8\x00\x12\x1a\xe8\x00\x40\x65\x02\x21\x21\xe8\x00\x00\x1c\x00\x00\xe0\x00\x13\x46\xe8\x00\xf0\x11"
+    "\x46\x02\x21\x21\x47\x02\x23\x23\x4a\x1a\x22\x22\x6b\x02\x22\x22\x4a\x1a\x24\x24\x6b\x02\x23\x23\x66\x02\x25\x25\x6b\x02\x24\x24"
+    "\x1c\x00\x60\x6b\x02\x25\x25\x47\x02\x18\x00\x00\x08\x00\x2f\x25\x25\xe8\x00\x11\x08\x04\x00\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x04"
+    "\x90\x34\x10\x08\xe8\x00\x13\x02\xe8\x00\x0f\xa0\x03\x10\x10\x08\xe8\x00\x13\x02\xe8\x00\x01\xd0\x00\x31\x23\x23\x08\x08\x00\x33"
+    "\x24\x24\x6d\xe8\x00\x13\x6d\xe8\x00\x1f\x6d\xe8\x00\x14\x08\xd0\x01\x4d\x26\x0a\x0f\x23\x04\x00\x3c\x02\x0f\x28\x04\x00\x13\x93"
+    "\x90\x34\x00\x08\x00\x13\x94\x04\x00\x13\x93\x90\x34\xb0\x94\x00\x23\x46\x94\x00\x2d\x46\x95\x00\x32\x30\x38\x06\xe8\x00\x13\x0a"
+    "\xe8\x00\x0f\xa0\x03\x10\x01\xe8\x00\x13\x0a\xe8\x00\x1f\x0a\xe8\x00\x9c\x13\x12\xe8\x00\x0f\xa0\x03\x10\x01\xe8\x00\x13\x12\xe8"
+    "\x00\x1f\x12\xe8\x00\x97\x0f\xa0\x03\x0b\x04\x98\x03\x0f\xa0\x03\x15\x04\x98\x03\x0f\xa0\x03\x27\x0f\xe8\x00\x3d\x04\x48\x1a\x11"
+    "\x6e\x9c\x03\xb3\x21\x21\x6e\x02\x1f\x1f\x6d\x02\x1e\x1e\x6e\xc8\x01\x02\x08\x00\x33\x20\x20\x6e\xc8\x01\x04\x08\x00\x0f\xf7\x03"
+    "\x0c\x0f\x01\x00\x7e\x08\xe8\x00\x02\x04\x00\x00\xdc\x00\x02\xe0\x00\x0a\x04\x00\x02\xe4\x00\x04\x04\x00\x0f\x57\x00\x0c\x0f\x01"
+    "\x00\x7e\x04\xcf\x3b\xf1\x02\x73\x02\x26\x26\x77\x02\x25\x25\x73\x02\x28\x28\x77\x02\x26\x26\x6b\x10\x00\xf1\x00\x27\x27\x6b\x02"
+    "\x28\x28\x63\x02\x28\x28\x73\x02\x25\x25\x77\x08\x00\x20\x27\x27\x08\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x21\x06\x00\xa0\x03\xf1"
+    "\x03\x01\x78\x02\x25\x25\x0d\x02\x27\x27\x78\x02\x26\x26\x79\x02\x26\x26\x0f\x6c\x03\x00\x10\x00\x20\x27\x27\x10\x00\x51\x78\x02"
+    "\x28\x28\x79\x10\x00\x00\x08\x00\x0f\xe8\x00\x1f\x42\x12\x02\x25\x25\x04\x00\x22\x26\x26\x04\x00\x22\x27\x27\x04\x00\x2f\x28\x28"
+    "\x04\x00\x01\x4d\x26\x0a\x14\x2d\x04\x00\x3c\x02\x14\x32\x04\x00\x13\x3c\xa0\x03\x40\x3d\x00\x23\x37\x0c\x00\x00\x04\x00\x13\x3d"
+    "\xa0\x03\x71\x3d\x00\x23\x46\x3e\x00\x2d\x04\x00\x03\xc8\x0b\x12\x00\xe8\x00\x20\x25\x25\xe8\x00\x00\xf0\x00\x08\xe8\x00\x13\x0f"
+    "\xe8\x00\x13\x0f\xe8\x00\x1f\x0f\xe8\x00\x50\x0f\x53\x00\x10\x0f\x01\x00\x1a\x0f\xe8\x00\xdf\x22\x27\x27\xb8\x02\x60\x28\x28\x0d"
+    "\x02\x29\x29\xd4\x00\x51\x6b\x02\x29\x29\x78\x0c\x00\xa4\x28\x28\x78\x02\x2a\x2a\x0f\x02\x2a\x2a\x08\x00\x0f\x59\x00\x0e\x0b\x01"
+    "\x00\x0e\xd8\x00\x22\x29\x29\x04\x00\x2f\x2a\x2a\x04\x00\x01\x0f\x53\x00\x10\x0f\x01\x00\x1a\x0f\xd0\x01\xd5\x0f\x88\x04\xff\xff"
+    "\xb1\x0f\x70\x05\xf9\x00\x10\x00\x0f\x70\x05\xad\x0f\xe8\x00\xff\xff\xff\xff\x6f\x04\xd8\x14\xf8\x17\x72\x00\x2f\x2f\x15\x01\x2f"
+    "\x2f\x2a\x00\x30\x30\x51\x01\x30\x30\x52\x01\x30\x30\xaa\x01\x31\x31\x67\x01\x30\x30\x67\x01\x32\x32\x72\x00\x31\x31\x2a\x00\x08"
+    "\x00\xf6\x15\x39\x39\x15\x01\x39\x39\x2a\x00\x3a\x3a\x51\x01\x3a\x3a\x52\x01\x3a\x3a\xaa\x01\x3b\x3b\x67\x01\x3a\x3a\x67\x01\x3c"
+    "\x3c\x72\x00\x3b\x3b\x2a\x00\x08\x00\x40\x13\x02\x2f\x2f\x04\x00\x51\x4b\x02\x30\x30\x13\x04\x00\x40\x31\x31\x13\x02\x50\x4b\x02"
+    "\x04\x00\x66\xa9\x00\x32\x32\xd1\x01\x08\x00\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x13\x03\xf8\x09\xd1\x2a\x00\x2f\x2f\xdd\x00\x2f\x2f"
+    "\xd7\x00\x30\x30\xe1\xec\x00\xf0\x01\x32\x32\x52\x01\x32\x32\x0d\x02\x31\x31\x7c\x00\x30\x30\xdd\x00\x08\x00\x24\x32\x32\x08\x00"
+    "\x0f\x5b\x00\x10\x09\x01\x00\x42\x12\x02\x2f\x2f\x04\x00\x22\x30\x30\x04\x00\x22\x31\x31\x04\x00\x2f\x32\x32\x04\x00\x01\x80\x26"
+    "\x0a\x19\x37\x56\x00\x19\x37\x08\x00\x04\x04\x00\xc4\x56\x00\x19\x3c\x26\x02\x19\x3c\x57\x00\x23\x46\x04\x00\x0f\xf8\x09\x15\x04"
+    "\xd0\x01\xf4\x19\x23\x00\x34\x34\xdd\x00\x34\x34\x23\x00\x36\x36\x84\x00\x35\x35\x51\x01\x37\x37\x52\x01\x37\x37\x84\x00\x37\x37"
+    "\x77\x01\x35\x35\xdd\x00\x36\x36\x77\x01\x37\x37\x08\x00\xf4\x19\x23\x00\x3e\x3e\xdd\x00\x3e\x3e\x23\x00\x40\x40\x84\x00\x3f\x3f"
+    "\x51\x01\x41\x41\x52\x01\x41\x41\x84\x00\x41\x41\x77\x01\x3f\x3f\xdd\x00\x40\x40\x77\x01\x41\x41\x08\x00\x42\x13\x02\x34\x34\x04"
+    "\x00\x22\x35\x35\x04\x00\x60\x36\x36\x13\x02\x37\x37\x04\x00\x97\xd9\x01\x37\x37\x24\x00\x37\x37\x78\x08\x00\x0f\x39\x01\x0e\x0f"
+    "\x01\x00\x1c\x06\xd0\x01\xb1\x39\x39\xdd\x00\x39\x39\xd7\x00\x3a\x3a\xe1\x8c\x02\xf0\x01\x3c\x3c\x52\x01\x3c\x3c\x0d\x02\x3b\x3b"
+    "\x7c\x00\x3a\x3a\xdd\x00\x08\x00\x24\x3c\x3c\x08\x00\x0f\x5b\x00\x10\x09\x01\x00\x42\x12\x02\x39\x39\x04\x00\x22\x3a\x3a\x04\x00"
+    "\x22\x3b\x3b\x04\x00\x2f\x3c\x3c\x04\x00\x01\x0f\xd0\x01\x33\x02\xcc\x01\x01\xd0\x01\xff\x26\x00\x01\x05\x01\x50\x01\x00\xf9\x01"
+    "\x1c\x1c\xfb\x01\x1c\x1c\xf9\x01\x1d\x1d\xfb\x01\x1d\x1d\x57\x02\x1d\x1d\x2f\x02\x1d\x1d\xf9\x01\x1e\x1e\xfb\x01\x1e\x1e\x57\x02"
+    "\x1f\x1f\x2f\x02\x1f\x1f\xf9\x01\x1f\x1f\xfb\x01\xb8\x1b\x1f\x42\x13\x02\x1c\x1c\x04\x00\x22\x1d\x1d\x04\x00\x02\xe8\x14\x02\xe4"
+    "\x14\x02\x04\x00\x26\xfc\x01\x08\x00\x4c\x50\x02\x05\x0f\x04\x00\x44\x52\x02\x05\x14\x04\x00\x13\x51\x04\x00\x62\xc8\x01\x23\x37"
+    "\x74\x00\x04\x00\x00\x0c\x00\x00\x04\x00\xf1\x00\x75\x00\x23\x3c\xd3\x00\x23\x3c\xc9\x01\x23\x46\xe6\x00\x2d\x04\x00\x31\x00\x00"
+    "\x00\xe8\x00\x0f\x01\x00\x7d\x97\x16\x01\x19\x37\xca\x01\x19\x37\x17\x04\x00\x40\x40\x01\x19\x3c\x04\x00\x62\xe2\x00\x23\x46\x41"
+    "\x01\x04\x00\x80\xdf\x00\x23\x37\x5a\x00\x23\x37\x08\x00\x04\x48\x54\x13\x5a\x48\x54\x71\xe0\x00\x23\x46\x5b\x00\x2d\x04\x00\x0f"
+    "\xe8\x00\xff\xff\x5b\x1f\x6b\xe8\x00\x00\x40\x6c\x01\x19\x3c\xe0\x00\x13\x6d\x04\x00\x0f\xe8\x00\x17\x01\xe4\x00\x1f\x02\x7a\x00"
+    "\x0f\x0f\x01\x00\x2b\x42\x44\x02\x16\x16\x04\x00\x22\x17\x17\x04\x00\x22\x18\x18\x04\x00\x2f\x19\x19\x04\x00\x01\x0f\x53\x00\x10"
+    "\x0f\x01\x00\x1a\x04\x48\x1a\xf0\x03\x37\x00\x2f\x2f\x90\x01\x2f\x2f\x4f\x01\x30\x30\x50\x01\x30\x30\x73\x02\x04\x00\xf4\x03\x32"
+    "\x32\x37\x00\x31\x31\x90\x01\x31\x31\x4f\x01\x32\x32\x50\x01\x32\x32\x08\x00\xf0\x03\x37\x00\x39\x39\x90\x01\x39\x39\x4f\x01\x3a"
+    "\x3a\x50\x01\x3a\x3a\x74\x02\x04\x00\xf4\x03\x3c\x3c\x37\x00\x3b\x3b\x90\x01\x3b\x3b\x4f\x01\x3c\x3c\x50\x01\x3c\x3c\x08\x00\x0f"
+    "\x10\x09\x0d\x0c\x04\x00\x08\x50\x06\x05\x04\x00\x12\x02\x58\x06\x62\x26\x02\x23\x46\x83\x00\x04\x00\x22\x3e\x01\x58\x06\x00\x08"
+    "\x00\x07\x04\x00\x01\x58\x06\x71\x3f\x01\x23\x46\x3f\x01\x2d\x04\x00\x0f\xd0\x01\x55\x42\x45\x02\x2f\x2f\x04\x00\x22\x30\x30\x04"
+    "\x00\x22\x31\x31\x04\x00\x2f\x32\x32\x04\x00\x01\x0f\x53\x00\x10\x0f\x01\x00\x1a\x04\xd0\x01\xff\x09\xf8\x01\x02\x02\xfa\x01\x02"
+    "\x02\xf8\x01\x03\x03\xfa\x01\x03\x03\xf8\x01\x04\x04\xfa\x01\x04\x04\x08\x00\x05\xf2\x13\xf9\x01\x20\x20\xfb\x01\x20\x20\xf9\x01"
+    "\x21\x21\xfb\x01\x21\x21\x2f\x02\x20\x20\x2f\x02\x21\x21\xf9\x01\x22\x22\xfb\x01\x22\x22\x2f\x02\x08\x00\xc2\xf9\x01\x23\x23\x2f"
+    "\x02\x23\x23\x13\x02\x02\x02\x04\x00\x22\x03\x03\x04\x00\x2f\x04\x04\x04\x00\x09\x0f\x88\x5b\x15\x00\xcc\x01\x04\x04\x00\x25\x5d"
+    "\x01\x04\x00\x01\xd0\x01\x00\xf8\x01\x31\x5e\x01\x2d\x04\x00\x04\x88\x21\x06\xc8\x00\xf4\x0f\x05\x05\xfa\x01\x05\x05\xfd\x01\x04"
+    "\x04\xfd\x01\x05\x05\xf8\x01\x06\x06\xfa\x01\x06\x06\xf8\x01\x07\x07\xfa\x01\x07\x07\x08\x00\x0f\x41\x01\x0e\x0b\x01\x00\x06\xc4"
+    "\x00\x22\x05\x05\x04\x00\x6f\x06\x06\x13\x02\x07\x07\x04\x00\x05\x0f\x53\x00\x10\x0f\x01\x00\x1a\x06\xd0\x01\x80\x08\x08\x07\x02"
+    "\x08\x08\x0a\x02\x08\x00\x33\x09\x09\xfa\xf0\x57\xf0\x05\x0a\x02\x09\x09\x07\x02\x0a\x0a\x0a\x02\x0a\x0a\x07\x02\x0b\x0b\x0a\x02"
+    "\x0b\x0b\x08\x00\x00\x00\x58\x08\x18\x00\x13\xfa\x00\x58\x02\x20\x00\x31\x0c\x0c\x0a\x68\x56\x33\x0d\x0d\x0a\x68\x56\x0f\xe8\x57"
+    "\x11\x08\x04\x00\x0f\x58\x5d\x3d\x04\xe0\x0a\xf6\x01\x0c\x02\x0a\x0a\x0f\x02\x0a\x0a\x0c\x02\x0b\x0b\x0f\x02\x0b\x0b\x08\x00\xe4"
+    "\x0c\x0c\x0f\x02\x0c\x0c\x0c\x02\x0d\x0d\x0f\x02\x0d\x0d\x08\x00\x0f\x43\x01\x10\x09\x01\x00\x42\x11\x02\x0a\x0a\x04\x00\x22\x0b"
+    "\x0b\x04\x00\x22\x0c\x0c\x04\x00\x2f\x0d\x0d\x04\x00\x01\x0f\xe8\x00\x15\x0f\xb0\x0c\x0c\x23\x3c\x3e\x04\x00\x0f\xe8\x00\xd7\x02"
+    "\x88\x5b\xf1\x02\x27\x02\x0f\x0f\x2a\x02\x0f\x0f\x27\x02\x10\x10\x2a\x02\x10\x10\x2f\x04\x00\x71\x11\x11\x27\x02\x11\x11\x2a\x08"
+    "\x00\x64\x12\x12\x2a\x02\x12\x12\x08\x00\x0f\xdb\x00\x10\x0f\x01\x00\x2a\x0f\xc8\x0b\x15\x00\x20\x5f\x2a\x6e\x01\x28\x5f\x26\x71"
+    "\x01\x28\x5f\x31\x70\x01\x2d\x04\x00\x04\x80\x0e\x91\x41\x02\x13\x13\x3c\x02\x13\x13\x38\x04\x00\xa0\x15\x15\xfe\x01\x14\x14\xfe"
+    "\x01\x16\x16\x14\x3a\xa0\x41\x02\x14\x14\x3c\x02\x15\x15\x41\x02\x24\x3a\x33\x16\x16\x41\x04\x00\x00\x0c\x00\x11\x38\x04\x00\x71"
+    "\x18\x18\xfe\x01\x17\x17\xfe\x14\x3a\x60\x17\x17\x41\x02\x17\x17\x1c\x3a\x91\x41\x02\x18\x18\x3c\x02\x19\x19\x41\xd0\x58\x20\x13"
+    "\x13\x04\x00\x19\x4b\x08\x3a\x00\x04\x3a\x02\x04\x00\x1b\x3d\x08\x00\x0f\x09\x01\x0e\x0f\x01\x00\x1c\x04\x88\x04\x80\x49\x02\x16"
+    "\x16\x4c\x02\x16\x16\x80\x59\x53\x4e\x02\x17\x17\x49\x90\x59\xf4\x01\x49\x02\x18\x18\x4c\x02\x18\x18\x08\x02\x19\x19\x4e\x02\x19"
+    "\x19\x08\x00\xf1\x06\x49\x02\x1a\x1a\x4c\x02\x1a\x1a\x08\x02\x1b\x1b\x4e\x02\x1b\x1b\x49\x02\x1b\x1b\x1d\x08\x00\xe4\x1c\x1c\x4c"
+    "\x02\x1c\x1c\x08\x02\x1d\x1d\x4e\x02\x1d\x1d\x08\x00\x04\xd8\x3a\x11\x4b\x04\x00\x00\xf8\x00\x31\x18\x18\x13\x08\x00\x02\x04\x00"
+    "\x57\x09\x02\x19\x19\x1e\x08\x00\x3e\x26\x0a\x0a\x04\x00\x3c\x02\x0a\x1e\x04\x00\x0f\x50\x10\x0d\x31\xba\x00\x2d\x04\x00\x05\xe8"
+    "\x00\x1b\x0a\xe8\x00\x13\x0a\xe8\x00\x1f\x0a\xe8\x00\x04\x1b\x0a\xe8\x00\x13\x0a\xe8\x00\x1f\x0a\xe8\x00\x8c\x1b\x12\xe8\x00\x13"
+    "\x12\xe8\x00\x1f\x12\xe8\x00\x04\x1b\x12\xe8\x00\x13\x12\xe8\x00\x1f\x12\xe8\x00\x8c\x12\x1a\xe8\x00\x00\x7c\x3d\x01\xe8\x00\x13"
+    "\x1a\xe8\x00\x12\x1a\xe8\x00\x00\x7c\x3d\x00\xe0\x00\x04\x08\x00\x22\x49\x1a\xe8\x00\x00\x7c\x3d\x01\xe8\x00\x13\x1a\xe8\x00\x12"
+    "\x1a\xe8\x00\x13\x46\xe0\x00\x04\x08\x00\x0f\xe8\x00\x0d\x00\x04\x00\x00\xe0\x00\x04\x08\x00\x0f\xe8\x00\x3d\x08\x38\x2e\x02\x10"
+    "\x2f\x20\x1d\x1d\x30\x2d\x00\x50\x2d\x15\x62\x08\x00\x20\x1f\x1f\x38\x2e\x08\x08\x00\x0f\xfa\x03\x0f\x0a\x01\x00\x0f\x20\x2f\x79"
+    "\x0f\xe8\x00\xff\xb2\x24\x0f\x0f\x50\x2d\x20\x1a\x1a\x2c\x06\xd1\xf9\x01\x1b\x1b\x0b\x02\x1b\x1b\x08\x02\x1c\x1c\x0b\xf0\x13\x20"
+    "\x1c\x1c\x80\x03\x00\x08\x14\x00\x68\x03\x04\x08\x00\x02\x50\x2f\x20\x1e\x1e\x00\x14\x13\x0b\xdc\x29\x11\x0b\xb0\x0c\x31\x20\x20"
+    "\x4e\x18\x14\x31\x21\x21\x4e\x10\x00\x02\x08\x00\x40\x13\x02\x1a\x1a\x04\x00\x11\x4b\x4c\x41\x00\x04\x00\x08\xfc\x13\x02\x04\x00"
+    "\x17\x09\x08\x00\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x09\xe8\x00\x1f\x0a\xe8\x00\x1c\x1f\x0a\xe8\x00\xa4\x1f\x12\xe8\x00\x1c\x1f\x12"
+    "\xe8\x00\x9f\x10\x65\xe8\x00\x16\x1a\xe8\x00\x00\xd0\x32\x0f\xe8\x00\x09\x00\xdc\x32\x00\xb0\x2b\x04\xe8\x00\x1f\x65\xe8\x00\x30"
+    "\x08\x04\x00\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x04\x98\x2a\x42\x5f\x02\x1a\x1a\x04\x00\x22\x1b\x1b\x04\x00\x2a\x1c\x1c\x04\x00\x28"
+    "\x1d\x1d\x04\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x0f\xe8\x00\x09\x11\x5d\x10\x00\x06\xe8\x00\x11\x5d\x18\x00\x00\x08\x00\x2f\x1c"
+    "\x1c\x57\x00\x0c\x0f\x01\x00\x7e\x0a\xe8\x00\x00\xc8\x00\x24\x1a\x1a\xe0\x00\x02\xd8\x00\x00\x08\x00\x04\xe8\x00\x02\xcc\x01\x00"
+    "\x08\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x08\xe8\x00\x02\xe0\x00\x2a\x1b\x1b\xe0\x00\x0f\xe8\x00\xb3\x0f\xa8\x6d\xff\xff\xff\x91"
+    "\x0f\x48\x71\xff\xff\xff\x97\xf0\x07\x42\x02\x1f\x1f\x3c\x02\x20\x20\x39\x02\x1f\x1f\x39\x02\x21\x21\x70\x02\x1f\x1f\xfe\x01\x08"
+    "\x00\xb1\x20\x20\x42\x02\x20\x20\x70\x02\x21\x21\x42\x18\x00\x31\x22\x22\x42\x04\x00\xf0\x05\x24\x24\x3c\x02\x25\x25\x39\x02\x24"
+    "\x24\x39\x02\x26\x26\x70\x02\x24\x24\xfe\x01\x08\x00\xb1\x25\x25\x42\x02\x25\x25\x70\x02\x26\x26\x42\x18\x00\x64\x27\x27\x42\x02"
+    "\x27\x27\x54\x22\x11\x4b\x40\x37\x04\x44\x37\x24\x22\x22\x04\x00\x57\x3d\x02\x22\x22\x43\x08\x00\x0f\x09\x01\x0e\x0f\x01\x00\x1c"
+    "\x06\x50\x10\x30\x30\x30\x0f\x88\x1d\x10\x00\x04\x00\xb1\x31\x31\x2e\x01\x31\x31\x6c\x00\x31\x31\x2f\x08\x00\x2a\x32\x32\x08\x00"
+    "\x2f\x31\x31\x5a\x00\x0f\x0a\x01\x00\x0f\x10\x26\x1d\x0f\x53\x00\x10\x0f\x01\x00\x1a\x0f\xe8\x00\x19\x24\xbf\x01\x08\x00\x0f\xe8"
+    "\x00\xa2\x01\x48\x1a\x0f\xe8\x00\x09\x06\xe0\x00\x0f\xe8\x00\x57\x0f\xb8\x1f\x04\x1c\x46\x04\x00\x0f\xe0\x27\x1d\x00\x94\x1e\x13"
+    "\x73\x84\x1e\xf0\x03\x73\x02\x24\x24\x72\x02\x22\x22\x72\x02\x23\x23\x4e\x02\x22\x22\x1a\x02\x2c\x0f\x00\x08\x00\x60\x24\x24\x4e"
+    "\x02\x23\x23\x08\x00\x40\xfb\x01\x26\x26\x3c\x38\xf2\x09\xfb\x01\x27\x27\x73\x02\x29\x29\x72\x02\x27\x27\x72\x02\x28\x28\x4f\x02"
+    "\x27\x27\x1a\x02\x26\x26\x08\x00\x60\x29\x29\x4f\x02\x28\x28\x08\x00\x04\xc0\x3a\x15\x4b\x94\x03\x00\xe4\x1e\x24\x24\x24\x04\x00"
+    "\x57\xfc\x01\x24\x24\x1b\x08\x00\x0f\x39\x01\x0e\x0f\x01\x00\x1c\x0f\xe8\x00\x0f\x2f\x21\x21\xe8\x00\x1b\x2f\x26\x26\xe8\x00\x84"
+    "\x01\x58\x06\x00\x60\x22\x00\x74\x22\x84\xcf\x00\x2f\x2f\x4f\x02\x30\x30\x78\x22\xc0\x4c\x02\x31\x31\x70\x02\x32\x32\xcf\x00\x32"
+    "\x32\x80\x22\x04\x08\x00\x00\x60\x22\x00\x74\x22\x84\xcf\x00\x39\x39\x4f\x02\x3a\x3a\x78\x22\xc0\x4c\x02\x3b\x3b\x71\x02\x3c\x3c"
+    "\xcf\x00\x3c\x3c\x80\x22\x04\x08\x00\x0f\x70\x22\x0d\x2a\xd8\x01\x08\x00\x00\xa8\x02\x2a\xa2\x01\xb8\x02\x22\xa2\x01\x70\x22\x44"
+    "\xa3\x01\x23\x46\x04\x00\x0f\xd0\x1e\x15\x04\xd0\x01\xf6\x17\x9f\x01\x2f\x2f\xbf\x00\x2f\x2f\x4e\x00\x31\x31\x08\x02\x30\x30\xa5"
+    "\x01\x30\x30\x0b\x00\x30\x30\xd6\x00\x32\x32\x7f\x00\x32\x32\xce\x00\x30\x30\x08\x02\x08\x00\xf1\x12\x9f\x01\x39\x39\xbf\x00\x39"
+    "\x39\x4e\x00\x3b\x3b\x08\x02\x3a\x3a\xa5\x01\x3a\x3a\x0b\x00\x3b\x3b\xd6\x00\x3c\x3c\x7f\x00\x3c\x3c\xce\x18\x00\x06\x08\x00\x0f"
+    "\xe8\x00\x05\xd7\x09\x02\x32\x32\x0c\x00\x32\x32\xa0\x01\x32\x32\xc0\x08\x00\x0f\xa1\x01\x0e\x0f\x01\x00\x1c\x04\xd0\x01\x0f\x50"
+    "\x2d\x7d\x00\x10\x26\x2a\x78\x00\x10\x26\xc4\x78\x00\x19\x3c\xde\x00\x19\x3c\x79\x00\x23\x46\x04\x00\x00\xe0\x1d\x00\x10\x26\x08"
+    "\xe8\x1d\x04\x10\x26\x00\xe8\x1d\x04\x10\x26\x08\x28\x25\xf0\x01\x27\x00\x30\x30\x65\x01\x30\x30\x6b\x02\x31\x31\x4e\x01\x31\x31"
+    "\xe8\x00\x60\xd5\x00\x31\x31\x5e\x02\x18\x00\x64\x32\x32\x5e\x02\x32\x32\x08\x00\x00\xb4\x02\xf0\x01\x27\x00\x3a\x3a\x65\x01\x3a"
+    "\x3a\x6c\x02\x3b\x3b\x4e\x01\x3b\x3b\xe8\x00\x60\xd5\x00\x3b\x3b\x5e\x02\x18\x00\x64\x3c\x3c\x5e\x02\x3c\x3c\x08\x00\x0f\xe8\x00"
+    "\x0d\x11\x28\x94\x79\x06\x08\x00\x0f\xb8\x02\x40\x01\xe8\x00\xf0\x0f\x25\x00\x2f\x2f\x66\x01\x2f\x2f\x24\x02\x30\x30\x66\x01\x31"
+    "\x31\xea\x00\x30\x30\xa4\x00\x30\x30\xc8\x00\x30\x30\xb5\x01\x0c\x00\x64\x32\x32\xb5\x01\x32\x32\x08\x00\xf0\x0f\x25\x00\x39\x39"
+    "\x66\x01\x39\x39\x24\x02\x3a\x3a\x66\x01\x3b\x3b\xea\x00\x3a\x3a\xa4\x00\x3a\x3a\xc8\x00\x3a\x3a\xb5\x01\x0c\x00\x64\x3c\x3c\xb5"
+    "\x01\x3c\x3c\x08\x00\x0f\xe8\x00\x05\x10\xad\x4c\x00\x04\x04\x26\x04\xe4\x00\x12\x00\xe8\x00\x1b\x4f\x68\x2c\x13\x4f\x68\x2c\x53"
+    "\x50\x00\x23\x46\xc7\x04\x00\x0f\xa0\x03\x1d\x80\x69\x00\x2f\x2f\x16\x00\x30\x30\x88\x04\xf0\x07\x73\x00\x31\x31\x16\x00\x32\x32"
+    "\x1a\x02\x30\x30\xf7\x00\x30\x30\x1a\x02\x31\x31\xf7\x00\x84\x04\x06\x08\x00\x80\x69\x00\x39\x39\x16\x00\x3a\x3a\x88\x04\xf6\x0b"
+    "\x73\x00\x3b\x3b\x16\x00\x3c\x3c\x1a\x02\x3a\x3a\xf7\x00\x3a\x3a\x1a\x02\x3b\x3b\xf9\x01\x3c\x3c\xf7\x00\x08\x00\x0f\xd0\x01\x09"
+    "\x13\x1b\x80\x04\x26\xf8\x00\x08\x00\x0f\x71\x03\x0e\x0f\x01\x00\x1c\x0f\xa0\x20\xdd\xf2\x15\x24\x02\x13\x13\x1d\x02\x14\x14\x24"
+    "\x02\x14\x14\x1d\x02\x15\x15\x08\x02\x15\x15\x1f\x02\x14\x14\x08\x02\x16\x16\x1f\x02\x15\x15\x24\x02\x15\x15\x48\x7a\x04\x50\x7a"
+    "\x00\x08\x00\x22\x17\x17\x58\x7a\x00\xf0\x1e\x31\x18\x18\x1f\x58\x7a\x35\x19\x19\x1f\x58\x7a\x26\x19\x19\x58\x7a\x00\xe8\x00\x20"
+    "\x14\x14\xe8\x00\x93\xff\x01\x14\x14\x01\x02\x14\x14\x03\xf0\x00\x97\x09\x02\x16\x16\x1e\x02\x16\x16\x25\x08\x00\x0f\x58\x7a\x31"
+    "\x12\x76\xd8\x02\x01\x04\x00\x04\xe8\x00\x51\x2f\x02\x1c\x1c\x2d\x00\x1b\x00\x08\x00\x00\x0c\x2f\x02\x1c\x2f\x51\x2f\x02\x1e\x1e"
+    "\x1a\x2c\x2f\x33\x1f\x1f\x1a\x24\x2f\x02\x08\x00\x40\x20\x20\x2e\x02\xc0\x27\x00\x08\x00\x00\xc4\x27\x02\xdc\x27\x00\xd8\x27\x00"
+    "\x58\x08\x00\xd4\x27\x11\x1a\x18\x00\x02\x08\x00\x0f\x20\x2f\x03\x06\x1c\x2f\x00\x04\x00\x17\x1b\x08\x00\x0f\x20\x2f\x25\x00\x8c"
+    "\x82\x0f\x20\x2f\x04\x0f\x80\x0e\x82\x0f\x50\x2d\x05\x00\x58\x06\x00\x50\x2d\x04\x04\x00\x0f\x50\x2d\xad\x0f\xf0\x30\x3d\x00",
+    5279, 34336);
+
+const Resource white2(
+    "\x8f\x00\x00\x00\x0a\x01\x32\x01\x00\x01\x00\x7d\xb6\x26\x0a\x2d\x3c\x55\x01\x2d\x3c\x26\x0a\x32\x04\x00\x21\x02\x2d\x04\x00\x35"
+    "\x56\x01\x32\x04\x00\xc6\x76\x00\x28\x3c\x26\x0a\x28\x3c\x76\x00\x32\x46\x04\x00\xa4\x28\x3c\x26\x02\x28\x3c\x77\x00\x32\x46\x04"
+    "\x00\x22\x01\x03\xe4\x00\xf0\x0f\x13\x00\x0f\x0f\x24\x02\x0f\x0f\x07\x02\x0f\x0f\x2c\x01\x0f\x0f\x13\x00\x10\x10\x24\x02\x10\x10"
+    "\x07\x02\x10\x10\x2c\x01\x0c\x00\x64\x11\x11\x85\x00\x12\x12\x08\x00\x0c\x20\x00\x40\x13\x00\x11\x11\x1c\x00\x60\x07\x02\x11\x11"
+    "\x2c\x01\x0c\x00\x64\x12\x12\x85\x00\x13\x13\x08\x00\x42\x13\x02\x0f\x0f\x04\x00\x22\x10\x10\x04\x00\x22\x11\x11\x04\x00\x20\x12"
+    "\x12\x04\x00\x57\x2d\x01\x12\x12\x25\x08\x00\x0f\x09\x01\x0e\x0f\x01\x00\x1c\x13\x0c\xd0\x01\xf0\x03\x18\x02\x36\x36\x4c\x02\x36"
+    "\x36\x18\x02\x37\x37\xc5\x01\x37\x37\x6a\x02\x04\x00\x80\x38\x38\x18\x02\x38\x38\xc5\x01\x08\x00\x64\x39\x39\x68\x02\x39\x39\x08"
+    "\x00\x0f\x5b\x00\x10\x0f\x01\x00\x2a\x42\x6a\x02\x2d\x3c\x04\x00\x17\x3c\x04\x00\x06\x14\x00\x13\x19\x04\x00\x22\x53\x01\x14\x00"
+    "\x20\x53\x01\x0c\x00\x04\x04\x00\x02\x14\x00\x35\x54\x01\x3c\x04\x00\x0f\xe8\x00\xff\xbe\x0f\x88\x04\x85\x06\xd4\x00\x17\x32\x04"
+    "\x00\x06\x14\x00\x13\x19\x04\x00\x06\xe8\x00\x00\x0c\x00\x04\x04\x00\x04\xe8\x00\x15\x32\x04\x00\x0f\x70\x05\x87\x2d\x05\x0f\x04"
+    "\x00\x1e\x02\x04\x00\x0f\x70\x05\x15\x0f\xe8\x00\x85\x4c\x50\x02\x05\x0f\x04\x00\x17\x52\x04\x00\x13\x51\x04\x00\xe2\xc8\x01\x28"
+    "\x3c\x62\x00\x28\x3c\xc8\x01\x32\x46\xd3\x00\x04\x00\x00\x10\x00\x84\xc9\x01\x28\x3c\x63\x00\x32\x46\x04\x00\x0f\xe8\x00\x87\xc2"
+    "\x1e\x2d\x78\x00\x1e\x2d\x26\x0a\x23\x2d\x50\x02\x04\x00\xe2\x51\x02\x23\x2d\xde\x00\x23\x2d\x26\x02\x23\x2d\x79\x00\x04\x00\xc4"
+    "\x72\x01\x28\x3c\x5a\x00\x28\x3c\x72\x01\x32\x46\x04\x00\x02\x10\x00\x00\x18\x00\x33\x32\x46\x5b\x04\x00\x04\x40\x07\xf0\x03\xf9"
+    "\x01\x38\x38\xfe\x01\x38\x38\x14\x00\x39\x39\x27\x00\x39\x39\x05\x02\x04\x00\xf6\x03\x3a\x3a\x2a\x00\x39\x39\x2a\x00\x3a\x3a\xf9"
+    "\x01\x3b\x3b\xfe\x01\x3b\x3b\x08\x00\xf0\x01\x40\x40\xfe\x01\x40\x40\x14\x00\x41\x41\x27\x00\x41\x41\x05\x02\x04\x00\xf4\x03\x42"
+    "\x42\x2a\x00\x41\x41\x2a\x00\x42\x42\xf9\x01\x43\x43\xfe\x01\x43\x43\x08\x00\x42\x13\x02\x38\x38\x04\x00\xa2\x39\x39\xce\x00\x39"
+    "\x39\x13\x02\x3a\x3a\x04\x00\xc6\x3b\x3b\x28\x00\x3b\x3b\xa9\x00\x3b\x3b\x06\x02\x08\x00\x0f\x09\x01\x0e\x0f\x01\x00\x1d\x1f\x03"
+    "\x24\x00\x10\x0f\x01\x00\x00\xaa\x14\x00\x40\x40\x2a\x00\x40\x40\xf9\x01\xe8\x00\xf4\x01\xfe\x01\x41\x41\xfe\x01\x42\x42\x14\x00"
+    "\x43\x43\x2a\x00\x43\x43\x08\x00\x0f\x53\x00\x10\x0f\x01\x00\x4a\x04\xd0\x01\x00\x58\x06\xe0\x15\x02\x36\x36\xc6\x01\x37\x37\xc1"
+    "\x00\x37\x37\x15\x02\x04\x00\x60\x38\x38\x1a\x02\x37\x37\x04\x00\x00\x50\x06\x13\x1a\x58\x06\x02\x08\x00\xf0\x01\x40\x40\x15\x02"
+    "\x40\x40\xc6\x01\x3f\x3f\xc1\x00\x3f\x3f\x15\x02\x04\x00\x60\x40\x40\x1a\x02\x3f\x3f\x04\x00\x84\x18\x02\x41\x41\x1a\x02\x41\x41"
+    "\x08\x00\x42\x13\x02\x36\x36\x04\x00\x22\x37\x37\x04\x00\x02\xe0\x01\x60\xd5\x01\x39\x39\x19\x02\xe0\x01\x37\x39\x39\x1b\x08\x00"
+    "\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x31\x01\x03\x01\xa0\x03\xf1\x06\x24\x02\x36\x36\x1d\x02\x36\x36\x24\x02\x37\x37\x20\x01\x37\x37"
+    "\x24\x02\x38\x38\x20\x0c\x00\xe6\x39\x39\x20\x02\x39\x39\x24\x02\x39\x39\x1d\x02\x38\x38\x08\x00\xf1\x04\x3e\x3e\x1d\x02\x3e\x3e"
+    "\x24\x02\x3f\x3f\x20\x01\x3f\x3f\x24\x02\x40\x40\x20\x0c\x00\xe4\x41\x41\x20\x02\x41\x41\x24\x02\x41\x41\x1d\x02\x40\x40\x08\x00"
+    "\x04\xe8\x00\x95\xff\x01\x37\x37\x01\x02\x37\x37\x03\xec\x00\x30\x39\x39\x21\x04\x00\x47\x01\x39\x39\x25\x08\x00\x00\xe0\x0a\x2a"
+    "\xb7\x00\xe0\x0a\x01\x10\x00\x01\xe4\x0a\x42\x32\x3c\xb8\x00\x04\x00\x0f\x70\x05\x03\xd1\x23\x3c\x26\x02\x23\x3c\x77\x00\x23\x46"
+    "\x77\x00\x2d\x04\x00\x13\x09\xf0\x00\xf1\x0e\x27\x02\x12\x12\x2a\x02\x12\x12\x27\x02\x13\x13\x2a\x02\x13\x13\x2c\x02\x13\x13\x2f"
+    "\x02\x13\x13\x1b\x00\x13\x13\x2d\x08\x00\x64\x14\x14\x2d\x02\x15\x15\x08\x00\x0f\x3f\x01\x0c\x0f\x01\x00\x7e\x0f\xe8\x00\x01\x00"
+    "\xdc\x00\x00\xe8\x00\x15\x31\xe0\x00\x60\x13\x13\x48\x01\x15\x15\xe0\x00\x04\x08\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x13\x07\x08"
+    "\x00\x00\xe8\x00\x13\x32\xe8\x00\x13\x32\xec\x00\x00\xe4\x00\x60\x27\x02\x14\x14\x32\x02\x08\x00\x64\x15\x15\x32\x02\x15\x15\x08"
+    "\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x0f\xe8\x00\xdd\xf0\x03\x32\x02\x1b\x1b\x27\x02\x1b\x1b\x32\x02\x1c\x1c\x27\x02\x1c\x1c\x1c"
+    "\x00\x04\x00\x80\x1d\x1d\x32\x02\x1d\x1d\x28\x02\x08\x00\x64\x1e\x1e\x28\x02\x1e\x1e\x08\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x0f"
+    "\xe8\x00\xff\xff\xaf\x42\x57\x01\x1b\x1b\x04\x00\x2a\x1c\x1c\x04\x00\x22\x1d\x1d\x04\x00\x28\x1e\x1e\x04\x00\x0f\x57\x00\x0c\x0f"
+    "\x01\x00\x7e\x0f\xe8\x00\xd7\x01\xe0\x0a\xf3\x1b\x01\x53\x02\x19\x19\x57\x02\x1a\x1a\x53\x02\x1a\x1a\x2b\x01\x1b\x1b\x55\x02\x1a"
+    "\x1a\x55\x02\x1b\x1b\x53\x02\x1b\x1b\x0d\x02\x19\x19\x53\x02\x1c\x1c\x57\x02\x1c\x1c\x5a\x04\x00\x0f\x5a\x00\x0f\x0a\x01\x00\x42"
+    "\x11\x02\x19\x19\x04\x00\x22\x1a\x1a\x04\x00\x22\x1b\x1b\x04\x00\x2f\x1c\x1c\x04\x00\x01\x0f\x53\x00\x10\x0f\x01\x00\x1a\x06\xe8"
+    "\x00\x00\xc8\x00\xf3\x14\x1d\x1d\x53\x02\x1d\x1d\x2b\x01\x1e\x1e\x55\x02\x1d\x1d\x55\x02\x1e\x1e\x53\x02\x1e\x1e\x0d\x02\x1c\x1c"
+    "\x53\x02\x1f\x1f\x57\x02\x1f\x1f\x5a\x04\x00\x0f\x5a\x00\x0f\x0a\x01\x00\x06\xc4\x00\x22\x1d\x1d\x04\x00\x22\x1e\x1e\x04\x00\x2f"
+    "\x1f\x1f\x04\x00\x01\x0f\x53\x00\x10\x0f\x01\x00\x1a\x0f\xe8\x00\x07\x00\x04\x00\x24\x1f\x1f\xe8\x00\x04\xe0\x00\x04\xf0\x00\x0f"
+    "\x5a\x00\x0f\x0a\x01\x00\x0f\xe8\x00\x75\x51\x0d\x02\x36\x36\x0d\x8c\x0d\xf6\x0d\x37\x37\x0f\x02\x36\x36\x78\x02\x38\x38\x66\x02"
+    "\x38\x38\x77\x02\x38\x38\x78\x02\x39\x39\x67\x02\x39\x39\x5f\x00\x08\x00\x0f\x5a\x00\x0f\x0a\x01\x00\xc2\x12\x02\x36\x36\x5f\x00"
+    "\x36\x36\x12\x02\x37\x37\x04\x00\x22\x38\x38\x04\x00\x24\x39\x39\x04\x00\x26\xd0\x00\x08\x00\x0f\x53\x00\x10\x0f\x01\x00\x1a\x08"
+    "\xe8\x00\x00\xe4\x00\x17\x77\xe8\x00\x00\xe4\x00\x00\xec\x00\x0f\xe8\x00\xbd\x0f\xd0\x01\xd1\x1f\x66\xe8\x00\x00\x1f\x67\xb8\x02"
+    "\xc4\x0f\xa0\x03\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xcb\x12\x01\xe8\x00\xf1\x07\x00\x08\x02\x37\x37\x4a\x02\x37\x37\x6c\x02"
+    "\x38\x38\x4a\x02\x39\x39\x6c\x02\x39\x39\x08\x08\x00\xb7\x3a\x3a\x08\x02\x3a\x3a\x4a\x02\x3a\x3a\x6d\x08\x00\x0f\x59\x00\x0e\x0b"
+    "\x01\x00\x04\x10\x1c\x17\x4b\xf0\x1d\x02\x04\x00\x04\xf0\x1d\x37\x3a\x3a\x09\x08\x00\x0f\x53\x00\x10\x0f\x01\x00\x1a\x09\xe8\x00"
+    "\x13\x0a\xe8\x00\x1f\x0a\xe8\x00\x00\x13\x0a\xe8\x00\x03\x08\x00\x0f\x59\x00\x0e\x0b\x01\x00\x0f\xe8\x00\x7a\x13\x12\xe8\x00\x1f"
+    "\x12\xe8\x00\x00\x13\x12\xe8\x00\x03\x08\x00\x0f\x59\x00\x0e\x0b\x01\x00\x0f\xe8\x00\x6e\x03\xd0\x1e\x10\x47\xe8\x00\x13\x1a\xe8"
+    "\x00\x12\x1a\xe8\x00\x13\x66\xe8\x00\x13\x47\x08\x00\x44\x66\x02\x3a\x3a\x08\x00\xf0\x07\x47\x02\x3f\x3f\x4a\x1a\x3f\x3f\x6c\x02"
+    "\x40\x40\x4a\x1a\x41\x41\x6c\x02\x41\x41\x66\x02\x08\x00\x33\x42\x42\x47\x08\x00\x53\x66\x02\x42\x42\x6b\x08\x00\x0f\xe8\x00\x11"
+    "\x17\x48\x08\x00\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x04\xd0\x1e\x0f\xa0\x03\x1d\x10\x08\xe8\x00\x13\x02\xe8\x00\x01\xd8\x00\x33\x41"
+    "\x41\x08\xe0\x00\x97\x08\x02\x42\x42\x4a\x02\x42\x42\x6d\x08\x00\x0f\xe8\x00\x07\x06\x04\x00\x17\x09\x08\x00\x00\xd0\x1e\x02\x04"
+    "\x00\x0e\xb0\x29\x00\xd0\x1e\x04\x04\x00\x13\x93\xd0\x1e\x46\x93\x00\x32\x46\x04\x00\x02\x40\x24\x40\x94\x00\x32\x46\x04\x00\x12"
+    "\x95\x70\x22\x06\xe8\x00\x0f\xa0\x03\x18\x01\xe8\x00\x13\x0a\xe8\x00\x1f\x0a\xe8\x00\x00\x13\x0a\xe8\x00\x03\x08\x00\x0f\xe8\x00"
+    "\x7a\x0f\xa0\x03\x18\x01\xe8\x00\x13\x12\xe8\x00\x1f\x12\xe8\x00\x00\x13\x12\xe8\x00\x03\x08\x00\x0f\xe8\x00\x75\x0f\xa0\x03\x0d"
+    "\x00\x94\x03\x00\xe0\x00\x04\x08\x00\x0f\xa0\x03\x0d\x00\x94\x03\x00\xe0\x00\x04\x08\x00\x0f\xe8\x00\x11\x17\x48\x08\x00\x0f\xe8"
+    "\x00\x3d\x04\x60\x19\x11\x6f\x9c\x03\xf3\x04\x37\x37\x6f\x02\x38\x38\x6d\x02\x38\x38\x6f\x02\x39\x39\x6d\x02\x39\x39\x6f\xd8\x00"
+    "\x0c\x08\x00\x0f\xf7\x03\x0c\x0f\x01\x00\x7e\x08\xe8\x00\x02\x04\x00\x00\xe4\x00\x02\xe8\x00\x02\x04\x00\x02\xdc\x00\x0c\x04\x00"
+    "\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x06\xe0\x0a\x22\x2f\x2f\x04\x00\x22\x30\x30\x04\x00\x22\x31\x31\x04\x00\x2f\x32\x32\x04\x00\x01"
+    "\x0f\x5a\x00\x0f\x0a\x01\x00\x42\x12\x02\x2f\x2f\x04\x00\x22\x30\x30\x04\x00\x22\x31\x31\x04\x00\x2f\x32\x32\x04\x00\x01\x0f\x53"
+    "\x00\x10\x0f\x01\x00\x1a\x04\x40\x07\xf4\x19\x72\x00\x2c\x2c\x17\x01\x2d\x2d\x72\x00\x2d\x2d\x51\x01\x2d\x2d\x52\x01\x2e\x2e\x23"
+    "\x00\x2d\x2d\x47\x02\x2d\x2d\x23\x00\x2f\x2f\x47\x02\x2f\x2f\xe1\x00\x2c\x2c\x08\x00\xf4\x19\x72\x00\x31\x31\x17\x01\x32\x32\x72"
+    "\x00\x32\x32\x51\x01\x32\x32\x52\x01\x33\x33\x23\x00\x32\x32\x47\x02\x32\x32\x23\x00\x34\x34\x47\x02\x34\x34\xe1\x00\x31\x31\x08"
+    "\x00\x42\x13\x02\x2c\x2c\x04\x00\x22\x2d\x2d\x04\x00\x22\x2e\x2e\x04\x00\xc6\x2f\x2f\x24\x00\x2f\x2f\x48\x02\x2f\x2f\xd1\x01\x08"
+    "\x00\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x21\x07\x00\x88\x04\x61\x01\xd7\x00\x2c\x2c\xdd\xc8\x00\x00\xd8\x00\x62\x2c\x2c\x51\x01\x2e"
+    "\x2e\xec\x00\x20\x2e\x2e\xdc\x00\x66\xdd\x00\x2e\x2e\xe1\x00\x08\x00\x0f\x5b\x00\x10\x09\x01\x00\x42\x12\x02\x2c\x2c\x04\x00\x22"
+    "\x2d\x2d\x04\x00\x22\x2e\x2e\x04\x00\x04\xe8\x01\x0a\x04\x00\xb5\x26\x0a\x23\x32\x56\x00\x23\x32\x26\x0a\x28\x04\x00\x01\x10\x00"
+    "\x65\x02\x23\x32\x57\x00\x28\x04\x00\x13\x3c\x88\x04\x44\x3c\x00\x32\x46\x04\x00\x13\x3d\x88\x04\x53\x3d\x00\x32\x46\x3e\x04\x00"
+    "\x04\xd0\x01\x00\xe4\x00\x00\xc0\x01\x00\xc8\x00\x11\x84\xd4\x01\x02\xe8\x00\x80\x84\x00\x2f\x2f\x77\x01\x2d\x2d\xc4\x01\x22\x77"
+    "\x01\xcc\x01\x00\x08\x00\x40\xdd\x00\x31\x31\xc0\x01\x51\xdd\x00\x33\x33\x84\xd4\x01\x20\x33\x33\xd4\x01\x80\x84\x00\x34\x34\x77"
+    "\x01\x32\x32\xc4\x01\x22\x77\x01\xcc\x01\x00\x08\x00\x0f\xd0\x01\x09\x22\xd9\x01\xd4\x01\x17\x78\x08\x00\x0f\x39\x01\x0e\x0f\x01"
+    "\x00\x1c\x0f\xe8\x00\xd5\x0f\xb8\x02\xd5\x10\x07\x50\x2d\xb0\x1e\x01\x00\x13\x00\x0e\x0e\x29\x00\x0e\x0e\xb0\x33\x22\x29\x00\xa8"
+    "\x33\xc0\x29\x00\x10\x10\x58\x00\x0f\x0f\x58\x00\x11\x11\x88\x33\x17\x29\x08\x00\x0f\xdb\x00\x10\x0f\x01\x00\x2a\x4f\x58\x00\x05"
+    "\x0f\x04\x00\x00\x14\x14\x04\x00\x13\x59\x04\x00\x42\x58\x00\x28\x3c\x04\x00\x26\x32\x46\x04\x00\x02\x14\x00\x44\x59\x00\x32\x46"
+    "\x04\x00\x0f\xe8\x00\xc3\x20\x3c\x3c\x04\x00\x44\x59\x00\x46\x46\x04\x00\x0f\xd0\x01\xff\xac\x0f\xe8\x00\xe7\x10\x01\x70\x05\x21"
+    "\x50\x01\xf0\x30\xf0\x03\xfb\x01\x38\x38\x6e\x00\x39\x39\x52\x00\x39\x39\x58\x02\x39\x39\x30\x02\x0c\x00\xe4\x3b\x3b\x58\x02\x3b"
+    "\x3b\x30\x02\x3a\x3a\x6e\x00\x3a\x3a\x08\x00\x0f\xab\x00\x10\x09\x01\x00\x08\xf0\x30\x0a\x48\x10\xb7\x3b\x3b\xce\x01\x3b\x3b\x59"
+    "\x02\x3b\x3b\xfc\x08\x00\x42\x50\x02\x2d\x3c\x04\x00\x15\x32\x04\x00\x33\x52\x02\x2d\x04\x00\x33\x32\x3c\x51\x04\x00\x62\xc8\x01"
+    "\x23\x37\x74\x00\x04\x00\x00\x0c\x00\x00\x04\x00\xf1\x00\x75\x00\x23\x3c\xd3\x00\x23\x3c\xc9\x01\x23\x46\xe6\x00\x2d\x04\x00\x0f"
+    "\xc0\x32\x87\xc2\x19\x28\xca\x01\x19\x28\xdf\x00\x1e\x28\x50\x02\x04\x00\xe2\x51\x02\x19\x28\x40\x01\x19\x28\xe2\x00\x1e\x28\x41"
+    "\x01\x04\x00\xc4\xaa\x00\x28\x3c\xdf\x00\x28\x3c\xaa\x00\x32\x46\x04\x00\x02\x10\x00\x73\x28\x3c\xab\x00\x32\x46\xe0\x04\x00\x0f"
+    "\xe8\x00\xff\xff\x5b\x1b\x6b\xe8\x00\x00\xe4\x00\x53\x6c\x01\x19\x28\x6d\xe4\x00\x0f\xe8\x00\xb1\x00\x20\x38\x2e\x2a\x01\x30\x38"
+    "\x22\xb7\x00\x08\x00\x22\xb8\x00\x04\x00\x0f\xf8\x09\x0d\x13\xba\x04\x00\x12\x02\xe0\x0a\xf1\x07\x00\xfa\x01\x04\x04\x2a\x01\x05"
+    "\x05\xf8\x01\x05\x05\xb3\x00\x05\x05\xfa\x01\x05\x05\x36\x08\x00\x80\x06\x06\x07\x02\x07\x07\xbf\x01\x0c\x00\x00\x08\x00\x20\x07"
+    "\x07\x08\x00\x0f\xab\x00\x10\x09\x01\x00\x42\x13\x02\x04\x04\x04\x00\xa2\x05\x05\xce\x00\x05\x05\x13\x02\x06\x06\x04\x00\x2f\x07"
+    "\x07\x04\x00\x01\x0f\xe8\x00\x3d\x01\x58\x06\xff\x24\x32\x01\x00\xf8\x01\x0a\x0a\x07\x02\x0a\x0a\xef\x00\x0a\x0a\x51\x00\x0a\x0a"
+    "\xf8\x01\x0b\x0b\x07\x02\x0b\x0b\xef\x00\x0b\x0b\x51\x00\x0b\x0b\xf8\x01\x0c\x0c\x07\x02\x0c\x0c\xf8\x01\x0d\x0d\x07\x02\x0d\x0d"
+    "\xdb\x00\x10\x09\x01\x00\x42\x13\x02\x0a\x0a\x04\x00\x22\x0b\x0b\x04\x00\x22\x0c\x0c\x04\x00\x2f\x0d\x0d\x04\x00\x01\x0f\x18\x39"
+    "\x3d\x04\x98\x0d\x06\xe0\x00\xf0\x05\x0a\x0a\x6d\x00\x0a\x0a\x3a\x00\x0b\x0b\x3a\x00\x0d\x0d\xef\x00\x0c\x0c\x51\x00\xe0\x00\x31"
+    "\x0c\x0c\x6d\x08\x00\x31\x0d\x0d\x6d\x18\x00\x04\x00\x01\x31\x0b\x0b\x6d\x2c\x00\xe4\x0c\x0c\x3a\x00\x0e\x0e\xef\x00\x0d\x0d\x51"
+    "\x00\x0d\x0d\x28\x00\x50\xf8\x01\x0e\x0e\x6d\x80\x08\x0f\xe8\x00\x1c\x0f\x39\x01\x0e\x0f\x01\x00\x1c\x22\x01\x04\xe8\x00\xfa\x13"
+    "\xc3\x01\x1f\x1f\x42\x01\x1f\x1f\x48\x01\x20\x20\xc3\x01\x21\x21\xaa\x01\x20\x20\xaa\x01\x21\x21\xe3\x00\x22\x22\x43\x01\x21\x21"
+    "\x48\x01\x08\x00\xfa\x13\xc3\x01\x23\x23\x43\x01\x23\x23\xe3\x00\x24\x24\xc3\x01\x25\x25\xaa\x01\x24\x24\xaa\x01\x25\x25\xe3\x00"
+    "\x26\x26\x43\x01\x25\x25\x49\x01\x08\x00\x42\x13\x02\x1f\x1f\x04\x00\x22\x20\x20\x04\x00\x22\x21\x21\x04\x00\x2f\x22\x22\x04\x00"
+    "\x01\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x04\x08\x13\x00\xe4\x00\x62\x0f\x02\x20\x20\x0d\x02\xe8\x00\x60\x0d\x02\x22\x22\x0f\x02\xd4"
+    "\x00\x20\x23\x23\xd4\x00\x66\x0f\x02\x23\x23\x0d\x02\x08\x00\x0f\x5a\x00\x0f\x0a\x01\x00\x42\x12\x02\x20\x20\x04\x00\x22\x21\x21"
+    "\x04\x00\x22\x22\x22\x04\x00\x2f\x23\x23\x04\x00\x01\x0f\x53\x00\x10\x0f\x01\x00\x1a\x04\xe8\x00\x00\xd0\x00\x0f\xe8\x00\x01\x00"
+    "\x00\x01\x0f\xe8\x00\xb9\x0f\xd0\x01\xd5\x0f\xe8\x00\xff\xff\xff\x90\x0f\x70\x05\xff\xff\xff\xff\x73\x02\x01\x00\xf0\x0f\x5f\x02"
+    "\x1f\x1f\x41\x02\x1f\x1f\x14\x00\x20\x20\x2a\x00\x20\x20\x5f\x02\x21\x21\x62\x01\x20\x20\x14\x00\x21\x21\x2a\x00\x0c\x00\x64\x22"
+    "\x22\x42\x02\x22\x22\x08\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x0f\xe8\x00\xff\xff\xbf\x1f\x42\xd0\x01\xff\xff\xa6\x0f\xe8\x00\xff"
+    "\xff\x92\x01\xa8\x16\x42\x62\x01\x2f\x2f\x04\x00\xfc\x07\x30\x30\x6f\x02\x30\x30\x62\x01\x31\x31\x6f\x02\x31\x31\x62\x01\x32\x32"
+    "\x6f\x02\x32\x32\x08\x00\x0f\x5b\x00\x10\x0f\x01\x00\x2a\x00\x70\x22\x1b\xb7\x70\x22\x01\x10\x00\x10\x02\x04\x00\x42\x28\x32\xb8"
+    "\x00\x04\x00\xb5\x3c\x00\x28\x37\x26\x0a\x28\x37\x3c\x00\x32\x04\x00\x07\x90\x17\x23\x3c\x3e\x04\x00\x04\xa8\x16\x10\x24\x80\x26"
+    "\x01\x04\x00\xfe\x07\x30\x30\x3b\x01\x30\x30\x24\x02\x31\x31\x3b\x01\x31\x31\x24\x02\x32\x32\x3b\x01\x32\x32\x08\x00\x22\x34\x34"
+    "\x04\x00\x60\x35\x35\x3b\x01\x35\x35\x60\x4c\x22\x3b\x01\x60\x4c\x11\x3b\x60\x4c\x0a\x08\x00\x00\x28\x24\x02\x04\x00\x20\x30\x30"
+    "\x04\x00\x11\xce\x0c\x27\x00\x04\x00\x20\x32\x32\x04\x00\x66\x25\x02\x32\x32\x97\x01\x08\x00\x0f\x09\x01\x0e\x0f\x01\x00\x1c\x06"
+    "\x68\x2c\x22\x2f\x2f\x04\x00\x22\x30\x30\x04\x00\xee\x31\x31\x4e\x01\x31\x31\x08\x02\x32\x32\x4e\x01\x32\x32\x08\x00\x22\x34\x34"
+    "\x04\x00\x22\x35\x35\x04\x00\x60\x36\x36\x4e\x01\x36\x36\xb0\x2c\x4c\x4e\x01\x37\x37\x08\x00\x0f\xe8\x00\x0d\x00\x04\x00\x17\x09"
+    "\x08\x00\x00\xd0\x01\x2a\xa2\x01\xd0\x01\x01\x10\x00\x65\x02\x23\x32\xa3\x01\x28\x04\x00\x0f\x60\x19\x15\x06\xb0\x29\x22\x29\x29"
+    "\x04\x00\x22\x2a\x2a\x04\x00\xec\x2b\x2b\x5f\x00\x2b\x2b\x0d\x02\x2c\x2c\x5f\x00\x2c\x2c\x08\x00\x0f\x42\x01\x0f\x0a\x01\x00\xc2"
+    "\x12\x02\x29\x29\x5f\x00\x29\x29\x12\x02\x2a\x2a\x04\x00\x22\x2b\x2b\x04\x00\x04\x40\x25\x0a\x04\x00\x0f\x53\x00\x10\x0f\x01\x00"
+    "\x1a\x04\x10\x26\x0f\x98\x2a\x01\x22\x5f\x00\x98\x2a\x22\x5f\x00\x8c\x2a\x08\x08\x00\x0f\x5b\x00\x10\x09\x01\x00\x00\xe4\x25\x2f"
+    "\x5f\x00\x98\x2a\x17\x0f\xa0\x03\x18\x0f\xc8\x28\x1a\x42\x15\x02\x2f\x2f\x04\x00\xfe\x07\x30\x30\x1a\x02\x30\x30\x15\x02\x31\x31"
+    "\x1a\x02\x31\x31\x15\x02\x32\x32\x1a\x02\x32\x32\x08\x00\x22\x34\x34\x04\x00\x60\x35\x35\x1a\x02\x35\x35\xe4\x50\x13\x1a\x8c\x37"
+    "\x00\xd8\x50\x0c\x08\x00\x0c\xb8\x02\x02\xb4\x02\x0a\xb8\x02\x17\x1b\x08\x00\x0f\x39\x01\x0e\x0f\x01\x00\x1c\x04\xb8\x02\x42\x6d"
+    "\x02\x2f\x2f\x04\x00\x22\x30\x30\x04\x00\xec\x31\x31\x7a\x02\x31\x31\x6d\x02\x32\x32\x7a\x02\x32\x32\x08\x00\x0f\x5a\x00\x0f\x0a"
+    "\x01\x00\x0f\xd0\x01\x1d\x0f\x53\x00\x10\x0f\x01\x00\x1a\x0f\x58\x06\xb0\x0f\xb8\x02\x15\x0f\x70\x05\xda\x0f\xb8\x02\xcf\x02\xe8"
+    "\x00\xf1\x02\x0c\x02\x10\x10\x0f\x02\x10\x10\x0c\x02\x11\x11\x0f\x02\x11\x11\x14\x04\x00\x00\x28\x5e\x02\xec\x26\x93\x0c\x02\x12"
+    "\x12\x5f\x00\x12\x12\x0f\x08\x00\x0f\x5a\x00\x0f\x0a\x01\x00\xc2\x11\x02\x10\x10\x5f\x00\x10\x10\x11\x02\x11\x11\x04\x00\x22\x12"
+    "\x12\x04\x00\x2f\x13\x13\x04\x00\x01\x0f\x53\x00\x10\x0f\x01\x00\x1a\x06\x58\x06\x31\x1b\x1b\x0f\x24\x4b\x71\x1c\x1c\x0f\x02\x1c"
+    "\x1c\x15\x04\x00\x60\x1e\x1e\x14\x00\x1d\x1d\x04\x00\x93\x0d\x02\x1e\x1e\x5f\x00\x1e\x1e\x0f\x08\x00\x0f\x5b\x00\x10\x09\x01\x00"
+    "\x00\x24\x4b\x28\x5f\x00\x28\x4b\x0c\x70\x49\x0a\x04\x00\x71\x26\x0a\x0a\x1e\xb7\x00\x0a\x08\x00\x04\x04\x00\x01\x10\x00\x12\x02"
+    "\x04\x00\x22\xb8\x00\x04\x00\x0f\x68\x2c\x17\x04\x28\x08\x0f\xe8\x00\x03\x6f\x0d\x02\x1d\x1d\x0f\x02\xe8\x00\x5f\x0f\x53\x00\x10"
+    "\x0f\x01\x00\x1a\x08\xa0\x3d\x13\x78\xbc\x3c\x00\xb8\x3c\xf0\x05\x31\x01\x37\x37\x2b\x01\x37\x37\x31\x01\x39\x39\x2b\x01\x39\x39"
+    "\x0d\x02\x38\x38\xb0\x3c\x04\x08\x00\x0f\x5a\x00\x0f\x0a\x01\x00\x0f\xa0\x3d\x70\x03\xb8\x02\x0f\xe8\x00\x7b\x0f\x60\x36\x15\x22"
+    "\x3c\x00\x1c\x00\x44\x3c\x00\x3c\x46\x04\x00\x00\xa8\x0c\x00\x1c\x00\x53\x3d\x00\x3c\x3c\x3e\x04\x00\x0f\xe8\x00\xd8\x00\x87\x00"
+    "\x0f\xb8\x02\xd1\x00\x07\x00\x0f\xe8\x00\xff\xff\xff\xff\x75\x01\x58\x06\x00\xd4\x1d\x66\x37\x00\x22\x22\x56\x00\xd0\x1d\xf4\x05"
+    "\x37\x00\x23\x23\x5a\x02\x25\x25\x0d\x02\x25\x25\x37\x00\x24\x24\x0f\x02\x24\x24\x08\x00\x0f\x5b\x00\x10\x09\x01\x00\x0e\xd8\x1d"
+    "\x22\x24\x24\x04\x00\x2f\x25\x25\x04\x00\x01\x00\x50\x2d\x35\x56\x00\x19\x4c\x2d\x00\x04\x00\x00\x10\x00\x00\x3c\x2e\x35\x57\x00"
+    "\x1e\x04\x00\x0f\xc8\x62\x15\x04\xd0\x01\xf0\x05\x0f\x02\x27\x27\x0d\x02\x27\x27\x37\x00\x28\x28\x0d\x02\x28\x28\x0f\x02\x28\x28"
+    "\x0c\x00\x13\x5b\x30\x12\x84\xd5\x00\x29\x29\x0f\x02\x29\x29\x08\x00\x0f\xda\x00\x0f\x0a\x01\x00\x42\x12\x02\x27\x27\x04\x00\x22"
+    "\x28\x28\x04\x00\x00\x2c\x12\x08\x30\x12\x0a\x04\x00\x0f\x53\x00\x10\x0f\x01\x00\x1a\x04\x80\x0e\xf2\x19\x12\x01\x38\x38\x4e\x01"
+    "\x38\x38\x12\x01\x39\x39\x37\x00\x39\x39\xa4\x00\x3a\x3a\xcb\x00\x3a\x3a\x63\x02\x39\x39\xcb\x00\x3b\x3b\x63\x02\x3b\x3b\x60\x01"
+    "\x39\x39\x08\x00\xf2\x1b\x3b\x3b\x12\x01\x40\x40\x4e\x01\x40\x40\x12\x01\x41\x41\x37\x00\x41\x41\xa4\x00\x42\x42\xcb\x00\x42\x42"
+    "\x63\x02\x41\x41\xcb\x00\x43\x43\x63\x02\x43\x43\x60\x01\x41\x41\x08\x00\x0f\xb0\x63\x0b\x01\x04\x00\x1a\x01\x08\x00\x00\x24\x08"
+    "\x1b\xa2\xd8\x6b\x01\x10\x00\x03\x28\x08\x22\xa3\x01\x04\x00\x13\x81\xc8\x0b\x42\x81\x00\x32\x46\x04\x00\x21\x01\x64\x14\x00\x72"
+    "\x02\x28\x3c\x82\x00\x32\x46\x04\x00\x20\x01\x64\xe2\x44\x4f\x00\x00\x00\x02\x12\x01\x0f\x0f\x01\x00\x2b\x42\x44\x02\x17\x17\x04"
+    "\x00\x22\x18\x18\x04\x00\x22\x19\x19\x04\x00\x26\x1a\x1a\x08\x00\x06\x04\x00\x0f\x53\x00\x10\x0f\x01\x00\x1a\x04\xd0\x01\x00\x78"
+    "\x03\xa0\xb7\x00\x24\x24\x4f\x01\x25\x25\x50\x01\x90\x03\x40\x25\x25\xb7\x00\x08\x00\xe4\x26\x26\xb7\x00\x26\x26\x4f\x01\x27\x27"
+    "\x50\x01\x27\x27\x08\x00\x00\xd4\x02\xf0\x03\xb7\x00\x28\x28\x4f\x01\x29\x29\x50\x01\x29\x29\x37\x00\x29\x29\xb7\x00\x08\x00\xe4"
+    "\x2a\x2a\xb7\x00\x2a\x2a\x4f\x01\x2b\x2b\x50\x01\x2b\x2b\x08\x00\x40\x13\x02\x24\x24\x04\x00\x60\x4b\x02\x25\x25\xce\x00\x78\x2c"
+    "\x22\x26\x26\x04\x00\x24\x27\x27\x04\x00\x26\xb8\x00\x08\x00\xb5\x26\x0a\x19\x28\xb7\x00\x19\x28\x26\x0a\x1e\x04\x00\x01\x10\x00"
+    "\x83\x02\x19\x28\xb8\x00\x1e\x28\x83\x04\x00\x22\x3e\x01\xd0\x01\x46\x3e\x01\x32\x46\x04\x00\x02\xd0\x01\x44\x3f\x01\x32\x46\x04"
+    "\x00\x0f\xd0\x01\x55\x42\x45\x02\x36\x36\x04\x00\x22\x37\x37\x04\x00\x22\x38\x38\x04\x00\x2f\x39\x39\x04\x00\x01\x0f\x53\x00\x10"
+    "\x0f\x01\x00\x1a\x04\xd0\x01\x04\x60\x36\x00\x4c\x67\xa2\xfb\x01\x39\x39\xf9\x01\x3a\x3a\xfb\x01\x48\x67\x13\xfb\x48\x67\x0a\x08"
+    "\x00\x60\x40\x40\xfb\x01\x40\x40\x64\x66\xa2\xfb\x01\x41\x41\xf9\x01\x42\x42\x30\x02\x48\x67\x13\xfb\x48\x67\x04\x08\x00\x2f\x30"
+    "\x02\xa0\x03\x0f\x00\x54\x36\x00\x58\x67\x04\x08\x00\x0f\xc8\x0b\x15\x00\xcc\x01\x02\x04\x00\x44\x32\x46\x5d\x01\x04\x00\x02\xd0"
+    "\x01\x00\x0c\x00\x13\x5e\x04\x00\x04\x80\x48\x08\xe8\x00\x9f\x6c\x00\x3a\x3a\xfe\x01\x39\x39\xfe\xe8\x00\x08\x0f\x41\x01\x0e\x0b"
+    "\x01\x00\x0f\xe8\x00\x09\x2e\xcf\x01\xe8\x00\x0f\x53\x00\x10\x0f\x01\x00\x1a\x06\xd0\x01\x02\x9c\x13\x60\x0b\x02\x38\x38\xc1\x00"
+    "\xf4\x00\x71\x39\x39\xfd\x01\x39\x39\x0b\xb4\x45\x0e\x08\x00\x40\xf9\x01\x3f\x3f\xcc\x45\x60\x0b\x02\x40\x40\xc1\x00\xdc\x01\x71"
+    "\x41\x41\xfd\x01\x41\x41\x0b\xc8\x45\x0e\x08\x00\x0c\x48\x67\x08\x38\x38\x22\xd5\x01\x5c\x49\x17\xfc\x08\x00\x0f\x48\x71\x01\x01"
+    "\x10\x00\x0f\x48\x71\x24\x06\x80\x0e\x00\x08\x09\x20\x37\x37\xf0\x08\xa0\x0f\x02\x38\x38\x0d\x02\x39\x39\x0f\x02\x00\x09\x6c\x3a"
+    "\x3a\x0f\x02\x3a\x3a\x08\x00\x0f\x43\x01\x10\x09\x01\x00\x0f\x08\x09\x07\x2f\x3a\x3a\x04\x00\x01\x0f\x68\x0f\x47\x0f\xe8\x00\xcb"
+    "\x13\x09\x90\x17\xf1\x02\x27\x02\x0e\x0e\x2a\x02\x0e\x0e\x27\x02\x0f\x0f\x2a\x02\x0f\x0f\x3c\x04\x00\xff\x09\x0e\x0e\x2f\x02\x11"
+    "\x11\x3c\x02\x11\x11\x27\x02\x10\x10\x2a\x02\x10\x10\x27\x02\x11\x11\x2a\x02\xd0\x3b\x4f\x0f\x90\x34\x04\x14\x14\x04\x00\x13\x51"
+    "\x04\x00\x00\x90\x34\x2a\x6e\x01\x90\x34\x00\x8c\x34\x93\xd3\x00\x28\x3c\x71\x01\x32\x46\x70\x04\x00\x0f\xe8\x00\xd5\x04\x30\x1b"
+    "\x91\x41\x02\x15\x15\x3c\x02\x15\x15\x38\x08\x00\xf1\x10\x17\x17\xfe\x01\x16\x16\xfe\x01\x18\x18\x38\x02\x16\x16\x41\x02\x16\x16"
+    "\x38\x02\x17\x17\x41\x02\x17\x17\x38\x02\x18\x18\x41\x04\x00\x20\x17\x17\x28\x00\x00\x18\x00\x40\x3c\x02\x19\x19\x2c\x00\x44\xfe"
+    "\x01\x1a\x1a\x20\x00\xf0\x05\x38\x02\x19\x19\x41\x02\x19\x19\x38\x02\x1a\x1a\x41\x02\x1a\x1a\x13\x02\x15\x15\x04\x00\x51\x4b\x02"
+    "\x16\x16\x13\x04\x00\x22\x17\x17\x04\x00\x20\x18\x18\x04\x00\x1b\x3d\x08\x00\x0f\x09\x01\x0e\x0f\x01\x00\x1c\x04\x70\x05\xf3\x0e"
+    "\x49\x02\x17\x17\x4c\x02\x17\x17\x08\x02\x1a\x1a\x4e\x02\x1a\x1a\x49\x02\x19\x19\x1d\x02\x1a\x1a\xb7\x00\x19\x19\x68\x18\x00\x44"
+    "\x4c\x02\x1a\x1a\x08\x00\x15\x49\x10\x00\xf3\x04\x1d\x1d\x4e\x02\x1d\x1d\x49\x02\x1c\x1c\x1d\x02\x1d\x1d\xb7\x00\x1c\x1c\x68\x18"
+    "\x00\x44\x4c\x02\x1d\x1d\x08\x00\x04\xd4\x00\x11\x4b\x04\x00\xf6\x09\x19\x19\x13\x02\x19\x19\xce\x00\x19\x19\xb8\x00\x1a\x1a\x5f"
+    "\x01\x1a\x1a\x09\x02\x1a\x1a\x1e\x02\x08\x00\x0f\xa8\x16\x04\x32\x23\x26\x02\x04\x00\x22\xb8\x00\x04\x00\x0f\x30\x38\x16\x04\xe8"
+    "\x00\x1b\x0a\xe8\x00\x1f\x0a\xe8\x00\x0c\x1b\x0a\xe8\x00\x1f\x0a\xe8\x00\x94\x1b\x12\xe8\x00\x1f\x12\xe8\x00\x0c\x1b\x12\xe8\x00"
+    "\x1f\x12\xe8\x00\x94\x1b\x1a\xe8\x00\x1f\x1a\xe8\x00\x0c\x1b\x1a\xe8\x00\x1f\x1a\xe8\x00\x8b\x0f\x60\x19\x05\xfc\x01\x30\x01\x1d"
+    "\x1d\x62\x02\x1d\x1d\x30\x01\x1e\x1e\x62\x02\x1e\x1e\x08\x00\x0f\xfa\x03\x0f\x0a\x01\x00\x0e\x70\x65\x0f\x60\x19\x65\x0f\xe8\x00"
+    "\xff\xb4\x22\x05\x06\x40\x07\xf4\x19\x08\x02\x1e\x1e\x49\x02\x1e\x1e\xf9\x01\x1f\x1f\x0b\x02\x1f\x1f\x08\x02\x20\x20\x0b\x02\x21"
+    "\x21\x4f\x01\x20\x20\x50\x01\x20\x20\xf9\x01\x21\x21\x4e\x02\x21\x21\x08\x00\x51\x08\x02\x21\x21\x49\x10\x00\xc0\x22\x22\x0b\x02"
+    "\x22\x22\x08\x02\x23\x23\x0b\x02\xa8\x0f\xe4\x23\x23\x50\x01\x23\x23\xf9\x01\x24\x24\x4e\x02\x24\x24\x08\x00\x40\x13\x02\x1e\x1e"
+    "\x04\x00\x1f\x4b\xd8\x3b\x06\x37\x21\x21\x09\x08\x00\x0f\xb9\x00\x0e\x0f\x01\x00\x1c\x04\x28\x08\x01\xe8\x00\x1f\x0a\xe8\x00\x1c"
+    "\x1f\x0a\xe8\x00\xa4\x1f\x12\xe8\x00\x1c\x1f\x12\xe8\x00\x9f\x10\x65\xe8\x00\x18\x1a\xe8\x00\x28\x1e\x1e\xe8\x00\x22\x65\x02\xe0"
+    "\x00\x08\x08\x00\x28\x49\x1a\xe8\x00\x28\x21\x21\xe8\x00\x22\x65\x02\xe0\x00\x04\x08\x00\x0f\xe8\x00\x6d\x06\x80\x2b\x22\x1b\x1b"
+    "\x04\x00\x22\x1c\x1c\x04\x00\x22\x1d\x1d\x04\x00\x2f\x1e\x1e\x04\x00\x01\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x06\xe8\x00\x0e\xe0\x00"
+    "\x11\x5d\xd4\x00\x60\x1f\x1f\x2a\x00\x1f\x1f\x08\x00\x26\x5d\x02\x08\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x06\xe8\x00\x0e\xe0\x00"
+    "\x00\xd0\x00\x00\x5c\x2d\x02\x00\x31\x46\x20\x20\x5d\x02\x08\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x06\xe8\x00\x0c\xe0\x00\x02\x30"
+    "\x2e\x06\xe0\x00\x40\x21\x21\x5d\x02\x10\x00\x02\x08\x00\x0f\x57\x00\x0c\x0f\x01\x00\x7e\x0f\xb0\x80\x89\x1f\x18\xb0\x80\x00\x04"
+    "\x14\x00\x0f\x98\x81\xb9\x02\xd4\x00\x0a\xb0\x80\x04\x14\x00\x0f\xb0\x80\x1d\x0f\xe8\x00\xd5\x0f\x80\x82\x89\x0f\xd0\x01\xd5\x0f"
+    "\x50\x84\x39\x0f\x20\x86\xff\xff\xa7\x04\xc8\x0b\xf8\x17\x42\x02\x25\x25\x3c\x02\x25\x25\x39\x02\x26\x26\x3c\x02\x27\x27\x70\x02"
+    "\x26\x26\xfe\x01\x28\x28\x70\x02\x28\x28\x59\x00\x28\x28\x42\x02\x27\x27\x39\x02\x08\x00\xf6\x15\x29\x29\x3c\x02\x29\x29\x39\x02"
+    "\x2a\x2a\x3c\x02\x2b\x2b\x70\x02\x2a\x2a\xfe\x01\x2c\x2c\x70\x02\x2c\x2c\x59\x00\x2c\x2c\x42\x02\x2b\x2b\x39\x02\x08\x00\x20\x13"
+    "\x02\xdc\x1d\x3d\x25\x25\x4b\xe0\x1d\x20\x28\x28\x04\x00\x57\x3d\x02\x28\x28\x43\x08\x00\x0f\x09\x01\x0e\x0f\x01\x00\x1c\x04\x08"
+    "\x13\x13\x4c\x4c\x22\x11\xcf\xc8\x1e\x00\x78\x0c\xc0\x26\x26\x50\x01\x26\x26\x4f\x02\x25\x25\x68\x02\x18\x00\x64\x27\x27\x4c\x02"
+    "\x27\x27\x08\x00\x13\x4c\xa8\x21\x11\xcf\xc8\x1e\x00\xd8\x1e\xc0\x2a\x2a\x50\x01\x2a\x2a\x4f\x02\x29\x29\x68\x02\x18\x00\x64\x2b"
+    "\x2b\x4c\x02\x2b\x2b\x08\x00\x08\xd0\x1e\x02\xf4\x00\x0a\xf0\x00\x22\xd8\x01\xc8\x1e\x04\x08\x00\x00\xd0\x1e\x2a\xa2\x01\xd0\x1e"
+    "\x01\x10\x00\x65\x02\x19\x28\xa3\x01\x1e\x04\x00\x0f\x78\x8c\x1d\xf0\x03\x9f\x01\x23\x23\x3b\x01\x23\x23\x1c\x02\x24\x24\x08\x02"
+    "\x25\x25\x7f\x00\x08\x00\xf7\x00\x24\x24\x7f\x00\x26\x26\x1c\x02\x26\x26\x3b\x01\x25\x25\x08\x08\x00\xf0\x03\x9f\x01\x27\x27\x3b"
+    "\x01\x27\x27\x1c\x02\x28\x28\x08\x02\x29\x29\x7f\x00\x08\x00\xf7\x00\x28\x28\x7f\x00\x2a\x2a\x1c\x02\x2a\x2a\x3b\x01\x29\x29\x08"
+    "\x08\x00\x40\x13\x02\x23\x23\x04\x00\x60\x4b\x02\x24\x24\xce\x00\xf4\x00\x02\xf0\x00\xe6\x09\x02\x26\x26\x1e\x02\x26\x26\xa0\x01"
+    "\x26\x26\x97\x01\x08\x00\x0f\xa1\x01\x0e\x0f\x01\x00\x1c\x04\xd0\x01\xf1\x1e\x72\x00\x22\x22\x17\x01\x22\x22\xaa\x01\x22\x22\x51"
+    "\x01\x24\x24\x52\x01\x24\x24\x67\x01\x23\x23\xaa\x01\x23\x23\x67\x01\x25\x25\x72\x00\x24\x24\x17\x01\x24\x24\x72\x00\x25\x25\x17"
+    "\x10\x00\xf4\x1f\x26\x26\x17\x01\x26\x26\xaa\x01\x26\x26\x51\x01\x28\x28\x52\x01\x28\x28\x67\x01\x27\x27\xaa\x01\x27\x27\x67\x01"
+    "\x29\x29\x72\x00\x28\x28\x17\x01\x28\x28\x72\x00\x29\x29\x17\x01\x29\x29\xe0\x4c\x13\x4b\xf0\x00\x04\xe0\x01\x04\xf0\x00\x00\x04"
+    "\x00\x11\xd1\x30\x4d\x02\x08\x00\x00\x40\x24\x13\x78\xa0\x20\x04\x40\x24\x00\x10\x00\x00\x40\x24\x62\x26\x02\x1e\x28\x79\x00\x04"
+    "\x00\x0f\x08\x87\x18\x03\x88\x21\x31\x22\x22\x4d\xe8\x4d\x80\x22\x22\x6b\x02\x21\x21\x6b\x02\xe0\x00\x00\xf8\x00\x00\x08\x00\x00"
+    "\xd4\x02\x39\x23\x23\x4e\x08\x00\x40\x26\x26\x6b\x02\xe8\x4d\x80\x26\x26\x4e\x01\x25\x25\x6b\x02\xe0\x00\x00\xf8\x00\x00\x08\x00"
+    "\x00\xd4\x02\x37\x27\x27\x4e\x08\x00\x04\x4c\x0f\x15\x4b\xd4\x4d\x0c\xf0\x00\x0a\x04\x00\x0f\xb8\x02\x40\x01\xe8\x00\x00\xe4\x00"
+    "\xe2\x24\x02\x21\x21\x25\x00\x22\x22\xb4\x01\x20\x20\xb7\x00\x20\x26\x40\x24\x02\x23\x23\x10\x00\x00\x08\x00\x00\xe0\x00\x04\x08"
+    "\x00\xf0\x01\x25\x00\x25\x25\x24\x02\x25\x25\x4e\x01\x26\x26\x24\x02\x27\x27\x94\x22\x00\xfc\x00\x40\xb5\x01\x24\x24\x04\x00\x00"
+    "\x14\x00\x00\xe0\x00\x04\x08\x00\x0f\xe8\x00\x09\x50\xb8\x00\x24\x24\x25\xdc\x00\x07\x08\x00\x0f\x70\x22\x09\x00\xd0\x01\x00\x74"
+    "\x22\x00\x04\x00\x0f\xa0\x03\x1d\xd3\x1c\x00\x36\x36\xcf\x00\x37\x37\x1c\x00\x38\x38\x30\x14\x36\x20\xf7\x00\x08\x00\x00\x0c\x87"
+    "\x86\x39\x39\xf7\x00\x39\x39\xcf\x00\x08\x00\xd3\x1c\x00\x3e\x3e\xcf\x00\x3f\x3f\x1c\x00\x40\x40\x30\xfc\x86\x20\xf7\x00\x08\x00"
+    "\x00\x0c\x87\x86\x41\x41\xf7\x00\x41\x41\xcf\x00\x08\x00\x04\x20\x86\x1f\x4b\xc0\x1f\x00\x00\xf8\x86\x66\xd8\x01\x39\x39\xf8\x00"
+    "\x08\x00\x0f\x71\x03\x0e\x0f\x01\x00\x1c\x0f\x18\x1c\xdd\xf2\x05\x24\x02\x15\x15\x1d\x02\x15\x15\x9f\x01\x16\x16\x1f\x02\x15\x15"
+    "\x3b\x01\x17\x17\x08\x00\xc0\x18\x18\x7f\x00\x18\x18\x24\x02\x17\x17\x1d\x02\x08\x00\x22\x18\x18\x08\x00\x00\x10\x00\xe2\x17\x17"
+    "\x9f\x01\x18\x18\x20\x02\x17\x17\x3b\x01\x19\x19\x08\x00\x73\x1a\x1a\x7f\x00\x1a\x1a\x24\x58\x1c\x40\x24\x02\x1a\x1a\x08\x00\x02"
+    "\xe8\x00\x20\x17\x17\xe8\x00\xf6\x0b\xff\x01\x16\x16\x01\x02\x16\x16\x03\x02\x16\x16\xa0\x01\x18\x18\x97\x01\x18\x18\x1e\x02\x18"
+    "\x18\x25\x02\x08\x00\x80\x26\x0a\x0a\x19\xa2\x01\x0a\x19\x08\x00\x04\x04\x00\x22\xa2\x01\xbc\x32\x26\xa3\x01\x04\x00\x0f\x48\x1a"
+    "\x1d\x00\x8c\x5a\x11\x2e\x48\x22\x60\x38\x38\x65\x01\x3a\x3a\xac\x02\x22\xc7\x01\x90\x5a\x13\x1a\xa0\x5a\x0a\x08\x00\x40\x41\x41"
+    "\x2e\x02\x38\x24\x60\x40\x40\x65\x01\x42\x42\xac\x02\x13\xc7\x44\x24\x20\x1a\x02\x34\x24\x0a\x08\x00\x0f\xe0\x27\x0e\x47\x02\x3b"
+    "\x3b\x1b\x08\x00\x0f\xa0\x5a\x17\x40\x32\x3c\x74\x00\x08\x00\x42\x3c\x46\xde\x00\x04\x00\x00\x10\x00\x93\xc9\x01\x32\x3c\x75\x00"
+    "\x3c\x46\xe6\x04\x00\x06\x30\x55\xff\x07\x02\x02\xfd\x01\x02\x02\xf8\x01\x03\x03\xfd\x01\x03\x03\xf8\x01\x04\x04\xfd\x01\x04\x04"
+    "\x08\x00\x05\x0f\x2b\x02\x10\x09\x01\x00\x00\x60\x00\x02\x04\x00\x00\x5c\x00\x02\x60\x00\x0f\x04\x00\x09\x0f\x30\x8f\x15\x0f\xd0"
+    "\x01\x1d\x68\x07\x02\x02\x02\x1c\x02\xe8\x00\xc2\x03\x03\x1c\x02\x03\x03\x07\x02\x04\x04\x1c\x02\xdc\x00\x26\xbf\x00\x08\x00\x62"
+    "\x07\x02\x09\x09\x1f\x02\x60\x55\x22\xfd\x01\x08\x00\x20\x1c\x02\x4c\x56\x00\x08\x00\x00\x14\x00\x64\x0b\x0b\xbf\x00\x0b\x0b\x08"
+    "\x00\x42\x13\x02\x02\x02\x04\x00\x66\x03\x03\xce\x00\x03\x03\x10\x57\x0f\x04\x00\x03\x0f\xe8\x57\x3e\x03\xe8\x00\x2f\xbf\x00\xe8"
+    "\x00\x11\x20\x03\x03\xe4\x00\x02\x04\x00\x0f\xe8\x00\x11\x20\x0a\x0a\xe4\x00\x0f\xe8\x00\x79\x0f\xd0\x01\xd5\x0f\xe8\x00\xcd\x04"
+    "\xa0\x03\x40\x4f\x02\x27\x27\xbc\x09\x00\x94\x0a\x00\x88\x0c\x62\x51\x01\x29\x29\x52\x01\x8c\x0c\x00\x50\x2b\x60\x6b\x02\x2a\x2a"
+    "\xe1\x00\x24\x00\x02\x08\x00\x62\x4f\x02\x2c\x2c\x6b\x02\x54\x69\x17\x37\x98\x66\x93\xb7\x00\x2d\x2d\xb7\x00\x2f\x2f\x6b\x48\x69"
+    "\x04\x08\x00\x04\x98\x0c\x13\x4b\x88\x0d\x20\x13\x02\xf4\x0a\x00\x04\x00\x00\xe4\x0b\x02\x04\x00\x26\xb8\x00\x08\x00\x80\x26\x0a"
+    "\x0f\x28\xb7\x00\x0f\x28\x08\x00\x04\x04\x00\x01\x10\x00\x10\x02\x04\x00\x42\x19\x2d\xb8\x00\x04\x00\x0f\xf8\x09\x1d\x11\x72\x60"
+    "\x3f\xf0\x03\x30\x30\xcf\x00\x31\x31\x6b\x02\x30\x30\x4f\x02\x31\x31\x37\x00\x32\x32\x0c\x00\x00\x78\x3f\x84\x73\x02\x2f\x2f\x72"
+    "\x02\x33\x33\x08\x00\x11\x72\x60\x3f\xf0\x01\x35\x35\xcf\x00\x36\x36\x6c\x02\x35\x35\x4f\x02\x36\x36\x37\x00\x04\x6d\x00\x80\x3f"
+    "\xa4\x36\x36\x73\x02\x34\x34\x72\x02\x38\x38\x08\x00\x04\xb0\x3c\x1d\x4b\x68\x3f\x20\x33\x33\x04\x00\x57\xd8\x01\x33\x33\x1b\x08"
+    "\x00\x00\xcc\x43\x20\xa2\x01\xd4\x43\x15\x2d\x04\x00\x01\x10\x00\x65\x02\x28\x37\xa3\x01\x2d\x04\x00\x0f\x00\x3a\x15\x0f\x40\x5e"
+    "\x89\x0f\xb0\x0c\x39\x01\xe8\x00\x1f\x50\xe8\x00\x81\x0f\x28\x08\x1f\x04\x04\x00\x0f\x28\x08\x01\x0f\xe8\x00\x87\x88\x1e\x2d\xca"
+    "\x01\x1e\x2d\xdf\x00\x88\x95\xc2\x1e\x2d\x52\x02\x1e\x2d\xe2\x00\x23\x2d\x52\x02\x04\x00\x00\xb8\x01\x00\x00\x60\x08\xd0\x01\x02"
+    "\x10\x00\x00\x18\x00\x06\x10\x60\x00",
+    7337, 40368);
+
+const Resource personal3(
+    "\x18\x00\x01\x00\xd2\x01\x00\x00\x2d\x31\x31\x41\x41\x2d\x1f\x41\x00\x41\x10\x00\x66\x3c\x3e\x3f\x50\x50\x3c\x10\x00\x66\x50\x52"
+    "\x53\x64\x64\x50\x10\x00\xa2\x27\x34\x2b\x3c\x32\x41\x1f\x42\x00\x42\x10\x00\x66\x3a\x40\x3a\x50\x41\x50\x10\x00\x66\x4e\x54\x4e"
+    "\x6d\x55\x64\x10\x00\xa2\x2c\x30\x41\x32\x40\x2b\x1f\x43\x00\x43\x10\x00\x66\x3b\x3f\x50\x41\x50\x3a\x10\x00\x66\x4f\x53\x64\x55"
+    "\x69\x4e\x10\x00\xa2\x2d\x1e\x23\x14\x14\x2d\x7f\x13\x00\x13\x10\x00\xa3\x32\x14\x37\x19\x19\x1e\x7f\x3d\x00\x3d\xa0\x00\x92\x2d"
+    "\x32\x50\x50\x46\x7f\x0e\x00\x0e\x10\x00\x66\x28\x23\x1e\x14\x14\x32\x30\x00\x66\x2d\x19\x32\x19\x19\x23\x30\x00\xa3\x41\x50\x28"
+    "\x2d\x50\x4b\x7f\x44\x00\x44\x30\x00\x92\x2d\x28\x23\x23\x38\x7f\x33\x00\x33\x10\x00\x66\x3f\x3c\x37\x32\x32\x47\x10\x00\x66\x53"
+    "\x50\x4b\x46\x46\x5b\x10\x00\xa2\x1e\x38\x23\x19\x23\x48\x7f\x32\x00\x3e\x10\x00\x66\x37\x51\x3c\x32\x46\x61\x10\x00\x66\x28\x3c"
+    "\x1e\x1f\x1f\x46\x30\x00\x66\x41\x5a\x41\x3d\x3d\x64\x10\x00\x85\x23\x3c\x2c\x28\x36\x37\x7f\x16\xc0\x00\x56\x55\x45\x41\x4f\x50"
+    "\x10\x00\xa3\x23\x37\x1e\x32\x28\x5a\x7f\x09\x00\x09\x20\x00\x56\x5a\x37\x5a\x50\x64\x10\x00\xa2\x32\x4b\x55\x14\x1e\x28\x7f\x08"
+    "\x00\x08\x10\x00\x66\x4b\x64\x6e\x2d\x37\x41\x10\x00\xa2\x37\x2f\x34\x28\x28\x29\xfe\x26\x00\x26\x10\x00\x66\x46\x3e\x43\x37\x37"
+    "\x38\x10\x00\x66\x5a\x52\x57\x4b\x55\x4c\x10\x00\x75\x2e\x39\x28\x28\x28\x32\x00\x10\x00\x66\x3d\x48\x39\x37\x37\x41\x10\x00\x66"
+    "\x51\x5c\x4d\x55\x4b\x55\x10\x00\xa2\x46\x2d\x30\x3c\x41\x23\xbf\x38\x00\x38\x10\x00\x66\x5f\x46\x49\x55\x5a\x3c\x10\x00\xa2\x26"
+    "\x29\x28\x32\x41\x41\xbf\x12\x00\x12\x10\x00\x66\x49\x4c\x4b\x51\x64\x64\x10\x00\x66\x73\x2d\x14\x2d\x19\x14\x30\x00\x66\x8c\x46"
+    "\x2d\x4b\x32\x2d\x10\x00\xa3\x28\x2d\x23\x1e\x28\x37\x7f\x27\x00\x27\xe0\x00\x56\x50\x46\x41\x4b\x5a\x10\x00\xa3\x2d\x32\x37\x4b"
+    "\x41\x1e\x7f\x22\x00\x22\x20\x01\x56\x41\x46\x55\x4b\x28\x10\x00\x66\x4b\x50\x55\x64\x5a\x32\x10\x00\xa3\x23\x46\x37\x2d\x37\x19"
+    "\x7f\x1b\x00\x1b\x30\x00\x57\x5f\x50\x3c\x50\x1e\x10\x00\x56\x37\x32\x28\x37\x2d\x40\x02\x66\x46\x41\x3c\x5a\x4b\x5a\x40\x02\xa3"
+    "\x0a\x37\x19\x23\x2d\x5f\x7f\x08\x00\x47\x50\x00\x56\x50\x32\x32\x46\x78\x10\x00\xa3\x28\x2d\x23\x28\x28\x5a\x7f\x35\x00\x35\xf0"
+    "\x01\x93\x46\x3c\x41\x41\x73\x7f\x07\x00\x07\xb0\x01\x92\x34\x30\x41\x32\x37\x7f\x06\x00\x0d\x10\x00\x66\x50\x52\x4e\x5f\x50\x55"
+    "\x10\x00\xa3\x28\x50\x23\x23\x2d\x46\x7f\x48\x00\x48\x40\x00\x56\x69\x3c\x3c\x46\x5f\x10\x00\x84\x37\x46\x2d\x46\x32\x3c\x3f\x16"
+    "\x40\x01\x66\x5a\x6e\x50\x64\x50\x5f\x10\x00\x30\x28\x32\x28\x80\x00\x33\x0b\x00\x06\x40\x00\x47\x41\x41\x32\x32\x10\x00\x66\x5a"
+    "\x55\x5f\x46\x5a\x46\x10\x00\x84\x19\x14\x0f\x69\x37\x5a\x3f\x1c\x50\x01\x66\x28\x23\x1e\x78\x46\x69\x10\x00\x66\x37\x32\x2d\x87"
+    "\x55\x78\x10\x00\x84\x46\x50\x32\x23\x23\x23\x3f\x3e\xe0\x02\x66\x50\x64\x46\x32\x3c\x2d\x10\x00\x66\x5a\x82\x50\x41\x55\x37\x10"
+    "\x00\x57\x32\x4b\x23\x46\x1e\x90\x01\x66\x41\x5a\x32\x55\x2d\x37\x10\x00\x66\x50\x69\x41\x64\x3c\x46\x10\x00\xa3\x28\x28\x23\x32"
+    "\x64\x46\x7f\x1d\x00\x40\x20\x00\x56\x46\x41\x50\x78\x64\x10\x00\xa3\x28\x50\x64\x1e\x1e\x14\x7f\x45\x00\x05\xa0\x00\x56\x5f\x73"
+    "\x2d\x2d\x23\x10\x00\x66\x50\x6e\x82\x37\x41\x2d\x10\x00\x84\x32\x55\x37\x41\x41\x5a\x7f\x32\x20\x01\x66\x41\x64\x46\x50\x50\x69"
+    "\x10\x00\xa2\x5a\x41\x41\x28\x28\x0f\x7f\x0c\x00\x14\x10\x00\x66\x5f\x4b\x6e\x64\x50\x1e\x10\x00\x85\x19\x23\x46\x5f\x37\x2d\xff"
+    "\x2a\x50\x00\x56\x3c\x5f\x78\x46\x46\x10\x00\x84\x34\x41\x37\x3a\x3e\x3c\x7f\x33\x20\x01\xa2\x23\x55\x2d\x23\x23\x4b\x7f\x32\x00"
+    "\x30\x10\x00\x66\x3c\x6e\x46\x3c\x3c\x64\x10\x00\xa3\x41\x2d\x37\x2d\x46\x2d\x7f\x2f\x00\x2f\x80\x00\x56\x46\x50\x46\x5f\x46\x10"
+    "\x00\xa2\x50\x50\x32\x28\x32\x19\x7f\x01\x00\x3c\x10\x00\x66\x69\x69\x4b\x41\x64\x32\x10\x00\xa3\x1e\x41\x64\x2d\x19\x28\x7f\x4b"
+    "\x00\x4b\x90\x00\x56\x5f\xb4\x55\x2d\x46\x10\x00\xa2\x1e\x23\x1e\x64\x23\x50\x7f\x1a\x00\x1a\x10\x00\x66\x2d\x32\x2d\x73\x37\x5f"
+    "\x10\x00\x66\x3c\x41\x3c\x82\x4b\x6e\x10\x00\x66\x23\x2d\xa0\x1e\x2d\x46\x30\x01\xa2\x3c\x30\x2d\x2b\x5a\x2a\x7f\x0f\x00\x0f\x10"
+    "\x00\x66\x55\x49\x46\x49\x73\x43\x10\x00\x84\x1e\x69\x5a\x19\x19\x32\x7f\x34\x70\x00\x66\x37\x82\x73\x32\x32\x4b\x10\x00\x85\x28"
+    "\x1e\x32\x37\x37\x64\xff\x2b\xb0\x04\x57\x32\x46\x50\x50\x8c\x10\x00\x47\x28\x50\x3c\x2d\x10\x02\x57\x5f\x5f\x55\x7d\x41\x10\x02"
+    "\x50\x32\x32\x5f\x28\x32\xd0\x01\x13\x1f\x30\x00\x40\x50\x6e\x32\x50\xd0\x01\x03\x10\x00\x76\x32\x78\x35\x23\x6e\x57\x00\x50\x03"
+    "\x65\x69\x4f\x23\x6e\x4c\x00\x50\x05\xa3\x5a\x37\x4b\x3c\x4b\x1e\x7f\x14\x00\x0c\x90\x00\x56\x41\x5f\x3c\x2d\x23\xf0\x00\x66\x41"
+    "\x5a\x78\x55\x46\x3c\x10\x00\xa3\x50\x55\x5f\x1e\x1e\x19\x7f\x1f\x00\x45\x70\x01\x56\x82\x78\x2d\x2d\x28\x10\x00\xa3\xfa\x05\x05"
+    "\x23\x69\x32\xfe\x1e\x00\x20\x40\x00\x56\x37\x73\x64\x28\x3c\xb0\x00\x84\x69\x5f\x50\x28\x50\x5a\xfe\x30\xe0\x01\xa3\x1e\x28\x46"
+    "\x46\x19\x3c\x7f\x21\x00\x21\x20\x01\x65\x41\x5f\x5f\x2d\x55\x7f\x30\x05\xa3\x2d\x43\x3c\x23\x32\x3f\x7f\x21\x00\x29\x80\x00\x56"
+    "\x5c\x41\x41\x50\x44\x10\x00\xa3\x1e\x2d\x37\x46\x37\x55\xff\x23\x00\x1e\x00\x01\x56\x4b\x55\x64\x55\x73\x10\x00\xa2\x28\x2d\x41"
+    "\x64\x78\x5a\x7f\x2b\x00\x2b\x10\x00\x66\x46\x6e\x50\x37\x50\x69\xc0\x06\x84\x41\x32\x23\x73\x5f\x5f\xfe\x0c\x00\x01\x75\x41\x53"
+    "\x39\x5f\x55\x69\x3f\x30\x06\xa3\x41\x5f\x39\x64\x55\x5d\x3f\x31\x00\x31\x10\x00\x92\x7d\x64\x37\x46\x55\x7f\x34\x00\x34\x10\x00"
+    "\xa2\x4b\x64\x5f\x28\x46\x6e\x00\x16\x00\x16\x10\x00\x66\x14\x0a\x37\x0f\x14\x50\xd0\x00\x75\x5f\x7d\x4f\x3c\x64\x51\x7f\x20\x00"
+    "\x84\x82\x55\x50\x55\x5f\x3c\x7f\x0b\x00\x02\x11\x30\x01\x00\x15\xff\xa0\x01\xa3\x37\x37\x32\x2d\x41\x37\x1f\x32\x00\x32\x30\x00"
+    "\x93\x41\x3c\x6e\x5f\x41\x1f\x0b\x00\x0b\x80\x00\x00\x10\x00\x53\x82\x1f\x0a\x00\x0a\x10\x00\x65\x82\x3c\x5f\x6e\x41\x1f\x20\x06"
+    "\x20\x41\x3c\xd0\x05\x42\xff\x24\x00\x24\x10\x00\x84\x23\x28\x64\x5a\x37\x23\x1f\x21\x70\x00\x66\x46\x3c\x7d\x73\x46\x37\x10\x00"
+    "\x50\x1e\x50\x5a\x37\x2d\x10\x00\x13\x04\x40\x01\x56\x73\x69\x41\x46\x50\x10\x00\xa2\x50\x69\x41\x3c\x4b\x82\x1f\x45\x00\x2e\x10"
+    "\x00\x85\xa0\x6e\x41\x41\x6e\x1e\x1f\x11\x90\x03\x74\x55\x64\x5f\x7d\x55\xff\x2e\x20\x00\x67\x5a\x5a\x55\x7d\x5a\x64\x10\x00\x56"
+    "\x64\x5a\x7d\x55\x5a\x10\x00\x66\x29\x40\x2d\x32\x32\x32\x50\x08\x66\x3d\x54\x41\x46\x46\x46\x10\x00\x66\x5b\x86\x5f\x64\x64\x50"
+    "\xb0\x06\x66\x6a\x6e\x5a\x9a\x5a\x82\x40\x00\x11\x64\x01\x00\x42\xff\x1c\x00\x1c\x10\x00\x4a\x2d\x31\x41\x31\x70\x09\x2a\x50\x3f"
+    "\x70\x09\x2f\x64\x53\x70\x09\x29\x57\x32\x41\x40\x2c\x30\x70\x09\x57\x41\x50\x50\x3b\x3f\x70\x09\x57\x55\x69\x64\x4f\x53\x70\x09"
+    "\x84\x23\x2e\x22\x23\x2d\x14\x7f\x32\x60\x03\x50\x55\x4c\x40\x2d\x37\x50\x05\x03\x10\x00\x84\x3c\x1e\x1e\x24\x38\x32\x7f\x0f\x10"
+    "\x00\x66\x64\x32\x32\x4c\x60\x46\x10\x00\x84\x28\x14\x1e\x28\x50\x37\x7f\x44\x20\x03\x66\x37\x23\x32\x37\x6e\x55\x10\x00\x84\x28"
+    "\x3c\x28\x28\x28\x1e\x7f\x44\x60\x04\x66\x46\x5a\x46\x3c\x3c\x28\x10\x00\x67\x55\x5a\x50\x46\x50\x82\x00\x08\x92\x26\x26\x38\x38"
+    "\x43\x7f\x0a\x00\x23\x10\x00\x57\x7d\x3a\x3a\x4c\x4c\x10\x00\x67\x14\x28\x0f\x23\x23\x3c\x20\x09\x56\x19\x1c\x2d\x37\x0f\x50\x08"
+    "\x57\x5a\x1e\x0f\x28\x14\x10\x00\x84\x23\x14\x41\x28\x41\x14\x1f\x37\xe0\x03\x66\x37\x28\x55\x50\x69\x28\x10\x00\x85\x28\x32\x2d"
+    "\x46\x2d\x46\x7f\x1c\xc0\x05\x56\x4b\x46\x5f\x46\x5f\x10\x00\x66\x37\x28\x28\x41\x2d\x23\x70\x00\x66\x46\x37\x37\x50\x3c\x2d\x10"
+    "\x00\x66\x5a\x4b\x4b\x73\x5a\x37\x10\x00\x57\x4b\x50\x55\x5a\x64\x90\x08\xa4\x46\x14\x32\x14\x32\x28\x7f\x2f\x00\x25\x40\x01\x46"
+    "\x50\x32\x50\x32\x10\x00\x84\x46\x64\x73\x1e\x41\x1e\x7f\x05\x90\x04\x57\x5a\x4b\x4b\x5a\x64\xc0\x07\x57\x23\x23\x28\x23\x37\x50"
+    "\x00\x67\x37\x2d\x32\x2d\x41\x50\x00\x09\x00\x4f\x04\x17\x6e\x20\x00\x74\x46\x37\x28\x37\x55\x7f\x32\xa0\x08\x11\x1e\x01\x00\x07"
+    "\x30\x00\x47\x4b\x37\x69\x55\x10\x00\x84\x41\x41\x2d\x4b\x2d\x5f\x7f\x03\x10\x09\x84\x37\x2d\x2d\x19\x19\x0f\x7f\x06\xc0\x03\x66"
+    "\x5f\x55\x55\x41\x41\x23\x10\x00\x75\x41\x41\x3c\x82\x5f\x6e\x1f\xd0\x02\x66\x5f\x41\x6e\x3c\x82\x41\x10\x00\x66\x3c\x55\x2a\x55"
+    "\x2a\x5b\x50\x06\x57\x5f\x4b\x50\x64\x6e\x70\x07\x66\x3c\x3c\x3c\x55\x55\x55\xa0\x05\x75\x30\x48\x30\x48\x30\x30\xff\x10\x00\xa3"
+    "\xbe\x21\x3a\x21\x3a\x21\x7f\x17\x00\x17\x20\x01\x74\x50\x41\x5a\x41\x55\x7f\x27\x90\x01\x84\x32\x41\x5a\x23\x23\x0f\x7f\x05\xd0"
+    "\x06\x30\x4b\x5a\x8c\x50\x02\x05\x10\x00\x84\x64\x46\x46\x41\x41\x2d\x7f\x20\x90\x04\x50\x41\x4b\x69\x23\x41\x00\x05\x04\x40\x0b"
+    "\x57\x55\xc8\x37\x41\x1e\x10\x07\x74\x50\x32\x28\x28\x1e\xbf\x16\x30\x00\x75\x5a\x78\x4b\x3c\x3c\x2d\xbf\x00\x05\x50\x41\x5f\x4b"
+    "\x37\x37\xe0\x05\x03\x20\x05\x66\x46\x82\x64\x37\x50\x41\x90\x05\x66\x14\x0a\xe6\x0a\xe6\x05\x80\x00\x50\x50\x7d\x4b\x28\x5f\x00"
+    "\x03\x04\x30\x0c\x75\x5f\x37\x23\x4b\x73\x7f\x27\x50\x03\x56\x50\x32\x32\x32\x28\x40\x0a\x75\x5a\x82\x4b\x4b\x4b\x37\x7f\x50\x09"
+    "\x84\x28\x28\x28\x46\x28\x14\x7f\x28\xc0\x05\x68\x32\x32\x78\x50\x50\x1e\x10\x00\x55\x28\x1e\x1e\x32\x7f\x00\x06\x57\x64\x64\x50"
+    "\x3c\x3c\x10\x00\x84\x37\x37\x55\x41\x55\x23\xbf\x37\x50\x06\x20\x23\x41\x02\x00\x43\x7f\x37\x00\x37\x00\x01\x92\x69\x4b\x69\x4b"
+    "\x2d\x7f\x15\x00\x15\x10\x00\x84\x2d\x37\x2d\x41\x2d\x4b\x7f\x48\x20\x00\x85\x41\x28\x46\x50\x8c\x46\x7f\x21\xf0\x01\x40\x50\x8c"
+    "\x28\x46\xe0\x0c\x03\xe0\x00\x84\x2d\x3c\x1e\x50\x32\x41\x7f\x30\xc0\x05\x67\x4b\x5a\x32\x6e\x50\x5f\x10\x00\x56\x5f\x5f\x5f\x5f"
+    "\x55\x50\x06\x20\x5a\x3c\x01\x04\x07\xf0\x00\x20\x78\x78\xb0\x00\x05\x30\x01\x66\x55\x50\x5a\x69\x5f\x3c\x00\x06\x66\x49\x5f\x3e"
+    "\x55\x41\x55\x80\x06\x84\x37\x14\x23\x14\x2d\x4b\x7f\x14\x40\x02\x11\x23\x01\x00\x16\x00\x80\x0a\x56\x5f\x5f\x23\x6e\x46\xd0\x06"
+    "\x66\x2d\x1e\x0f\x55\x41\x41\x20\x07\x66\x2d\x3f\x25\x41\x37\x5f\x20\x07\x66\x2d\x4b\x25\x46\x37\x53\x20\x07\x75\x5f\x50\x69\x28"
+    "\x46\x64\xfe\xa0\x09\x66\xff\x0a\x0a\x4b\x87\x37\x10\x08\x66\x5a\x55\x4b\x73\x64\x73\xd0\x05\x57\x73\x73\x55\x5a\x4b\x30\x06\x57"
+    "\x64\x4b\x73\x5a\x73\x50\x06\x66\x32\x40\x32\x2d\x32\x29\xd0\x01\x66\x46\x54\x46\x41\x46\x33\x30\x06\xa2\x64\x86\x6e\x5f\x64\x3d"
+    "\x7f\x2d\x00\x2d\x10\x00\x66\x6a\x5a\x82\x5a\x9a\x6e\x40\x00\x57\x6a\x82\x5a\x6e\x9a\x80\x06\x03\x40\x06\x16\x1e\x20\x08\x46\x23"
+    "\x41\x37\x46\x20\x06\x66\x32\x41\x2d\x55\x41\x5f\x10\x00\x66\x46\x55\x41\x69\x55\x78\x10\x00\x66\x2d\x3c\x28\x46\x32\x2d\x20\x06"
+    "\x66\x3c\x55\x3c\x55\x3c\x37\x10\x00\x57\x50\x78\x46\x6e\x46\x50\x06\x20\x32\x46\xa0\x02\x06\x20\x06\x66\x46\x55\x46\x3c\x46\x32"
+    "\x10\x00\x67\x64\x6e\x5a\x55\x5a\x3c\x40\x06\x65\x37\x23\x1e\x1e\x23\x7f\x00\x08\x01\xe0\x05\x16\x46\xc0\x01\x66\x26\x1e\x29\x1e"
+    "\x29\x3c\x00\x02\x66\x4e\x46\x3d\x32\x3d\x64\x10\x00\x67\x2d\x2d\x23\x14\x1e\x14\xf0\x0f\x20\x23\x37\x80\x04\x06\xf0\x0f\x47\x46"
+    "\x32\x5a\x32\x70\x03\x0d\x20\x00\x56\x32\x46\x32\x5a\x41\x40\x00\xa4\x28\x1e\x1e\x28\x32\x1e\x7f\x21\x00\x2c\x20\x00\x46\x32\x3c"
+    "\x46\x32\x10\x00\x30\x50\x46\x46\x60\x05\x05\x10\x00\x32\x28\x28\x32\x20\x05\x03\x60\x04\x41\x46\x46\x28\x3c\x00\x0a\x03\x10\x00"
+    "\x50\x5a\x64\x3c\x5a\x3c\x70\x05\x04\xd0\x06\x56\x37\x1e\x1e\x1e\x55\xe0\x01\x67\x3c\x55\x3c\x32\x32\x7d\xc0\x03\x56\x1e\x1e\x37"
+    "\x1e\x55\x00\x10\x66\x3c\x32\x64\x55\x46\x41\x10\x00\x84\x1c\x19\x19\x2d\x23\x28\x7f\x1c\xf0\x02\x66\x26\x23\x23\x41\x37\x32\x10"
+    "\x00\x66\x44\x41\x41\x7d\x73\x50\x10\x00\x66\x28\x1e\x20\x32\x34\x41\x50\x03\x66\x46\x3c\x3e\x50\x52\x3c\x60\x01\x10\x3c\xaf\x00"
+    "\x17\x23\xe0\x0e\x20\x82\x50\x80\x01\x06\x10\x00\x93\x3c\x3c\x23\x23\x1e\x7f\x36\x00\x36\x00\x01\x56\x50\x50\x37\x37\x5a\x70\x0e"
+    "\x66\x96\xa0\x64\x5f\x41\x64\x20\x00\x66\x1f\x2d\x5a\x1e\x1e\x28\x20\x0f\xa2\x3d\x5a\x2d\x32\x32\xa0\x7f\x03\x00\x03\x10\x00\xa2"
+    "\x01\x5a\x2d\x1e\x1e\x28\xff\x19\x00\x19\x10\x00\x66\x40\x33\x17\x33\x17\x1c\xb0\x0a\x66\x54\x47\x2b\x47\x2b\x30\x10\x00\x66\x68"
+    "\x5b\x3f\x5b\x3f\x44\x10\x00\x84\x48\x3c\x1e\x14\x1e\x19\x3f\x2f\x30\x01\x66\x90\x78\x3c\x28\x3c\x32\x10\x00\x75\x32\x14\x28\x14"
+    "\x28\x14\xbf\x20\x07\x50\x1e\x2d\x87\x2d\x5a\x20\x07\x13\x2a\x20\x00\x56\x2d\x2d\x23\x23\x32\xe0\x07\x66\x46\x41\x41\x37\x37\x46"
+    "\x10\x00\x66\x32\x4b\x4b\x41\x41\x32\x70\x01\x50\x32\x55\x55\x37\x37\xd0\x0c\x03\x30\x01\x30\x32\x46\x64\x90\x08\x05\x70\x07\x30"
+    "\x3c\x5a\x8c\x90\x05\x05\x10\x00\x32\x46\x6e\xb4\xa0\x04\x03\x10\x00\xa4\x1e\x28\x37\x28\x37\x3c\x7f\x4a\x00\x4a\x50\x01\x46\x4b"
+    "\x3c\x4b\x50\x10\x00\x84\x28\x2d\x28\x41\x28\x41\x7f\x09\xc0\x0c\x66\x46\x4b\x3c\x69\x3c\x69\x10\x00\xa4\x3c\x32\x28\x55\x4b\x5f"
+    "\x7f\x39\x00\x39\xb0\x01\x82\x32\x4b\x55\x5f\x7f\x3a\x00\x3a\x10\x00\x85\x41\x49\x37\x2f\x4b\x55\x00\x23\xe0\x0b\x56\x2f\x37\x49"
+    "\x4b\x55\xc0\x04\x85\x32\x3c\x2d\x64\x50\x41\x7f\x1e\x90\x11\x74\x2b\x35\x2b\x35\x28\x7f\x40\x30\x0e\x66\x64\x49\x53\x49\x53\x37"
+    "\x10\x00\xa3\x2d\x5a\x14\x41\x14\x41\x7f\x18\x00\x18\x30\x00\x56\x78\x28\x5f\x28\x5f\x10\x00\x84\x82\x46\x23\x46\x23\x3c\x7f\x29"
+    "\x60\x00\x57\xaa\x5a\x2d\x5a\x2d\x10\x00\x21\x3c\x3c\xf0\x08\x05\x80\x00\xa3\x46\x64\x46\x69\x4b\x28\x7f\x28\x00\x28\x10\x00\x93"
+    "\x55\x8c\x55\x46\x14\x7f\x49\x00\x49\x30\x00\x74\x19\x23\x46\x50\x3c\x7f\x2f\xa0\x05\x66\x50\x2d\x41\x5a\x6e\x50\x10\x00\x11\x3c"
+    "\x01\x00\x06\xc0\x05\x84\x2d\x64\x2d\x2d\x2d\x0a\x7f\x34\x50\x11\x01\x70\x04\x17\x46\xb0\x0d\x56\x64\x50\x50\x50\x64\x10\x00\x66"
+    "\x32\x55\x28\x55\x28\x23\xf0\x12\x66\x46\x73\x3c\x73\x3c\x37\x10\x00\x75\x2d\x28\x3c\x28\x4b\x32\x7f\x20\x05\x66\x4b\x46\x5a\x46"
+    "\x69\x50\x10\x00\xa3\x49\x73\x3c\x3c\x3c\x5a\x7f\x11\x00\x11\x10\x00\x56\x64\x3c\x64\x3c\x41\x40\x04\x66\x46\x37\x41\x5f\x55\x46"
+    "\x80\x08\x57\x46\x5f\x55\x37\x41\x10\x00\x66\x32\x30\x2b\x2e\x29\x3c\x10\x01\x57\x6e\x4e\x49\x4c\x47\x10\x00\x66\x2b\x50\x41\x32"
+    "\x23\x23\x20\x0f\x67\x3f\x78\x55\x5a\x37\x37\x30\x0f\x56\x28\x37\x28\x46\x37\x50\x00\x66\x3c\x46\x69\x46\x78\x4b\x10\x00\x75\x42"
+    "\x29\x4d\x3d\x57\x17\x1f\x90\x07\x66\x56\x51\x61\x51\x6b\x2b\x10\x00\x84\x2d\x5f\x32\x28\x32\x4b\x1f\x04\xe0\x0c\x66\x4b\x7d\x64"
+    "\x46\x50\x2d\x10\x00\x58\x14\x0f\x14\x0a\x37\xc0\x0d\x93\x3c\x4f\x64\x7d\x51\x7f\x3f\x00\x3f\xd0\x00\x01\x01\x00\x43\x7f\x3b\x00"
+    "\x3b\x80\x00\x92\x5a\x46\x3c\x78\x28\x7f\x10\x00\x10\x10\x00\x66\x2c\x4b\x23\x3f\x21\x2d\xb0\x09\x66\x40\x73\x41\x53\x3f\x41\x10"
+    "\x00\x66\x14\x28\x5a\x1e\x5a\x19\x90\x01\x75\x28\x46\x82\x3c\x82\x19\x7f\xa0\x06\x67\x63\x44\x53\x48\x57\x33\x50\x0a\x57\x32\x46"
+    "\x5f\x50\x41\x90\x0f\x10\x82\x31\x03\x06\x30\x00\x66\x5f\x17\x30\x17\x30\x17\xe0\x09\x11\x32\x01\x00\x06\x00\x0c\x11\x50\x01\x00"
+    "\x06\x10\x00\x67\x46\x28\x32\x37\x32\x19\x50\x11\x38\x3c\x46\x4b\x60\x11\x66\x6e\x50\x5a\x5f\x5a\x41\x10\x00\x66\x23\x40\x55\x4a"
+    "\x37\x20\x30\x11\x67\x37\x68\x69\x5e\x4b\x34\xb0\x0f\x38\x54\x69\x72\x10\x00\x30\x64\x5a\x82\xc0\x0e\x14\x21\xf0\x03\x75\x2b\x1e"
+    "\x37\x28\x41\x61\xbf\x20\x00\x84\x2d\x4b\x3c\x28\x1e\x32\x7f\x45\x20\x00\x57\x41\x5f\x64\x3c\x32\x10\x00\x66\x5f\x87\x50\x6e\x50"
+    "\x64\x90\x05\xa3\x28\x37\x50\x23\x3c\x1e\xff\x1d\x00\x1d\x70\x01\x56\x4b\x64\x37\x50\x32\x10\x00\x67\x50\x87\x82\x5f\x5a\x46\x10"
+    "\x00\x48\x64\xc8\x32\x64\x20\x00\x48\x32\x64\x64\xc8\x10\x00\x48\x4b\x96\x4b\x96\x10\x00\x66\x50\x5a\x6e\x82\x6e\xfe\x30\x03\x65"
+    "\x5a\x50\x82\x6e\x6e\x00\x10\x00\xa3\x64\x64\x5a\x96\x8c\x5a\xff\x02\x00\x02\x10\x00\x92\x96\x8c\x64\x5a\x5a\xff\x46\x00\x46\x10"
+    "\x00\xa4\x69\x96\x5a\x96\x5a\x5f\xff\x4c\x00\x4c\x30\x00\x01\x60\x08\x14\x20\xf0\x08\x66\x32\x5f\x5a\x5f\x5a\xb4\x80\x08\x00",
+    3711, 6192);
+
+const Resource personal4(
+    "\x18\x00\x01\x00\xd2\x01\x00\x00\x2d\x31\x31\x41\x41\x2d\x1f\x41\x00\x41\x10\x00\x66\x3c\x3e\x3f\x50\x50\x3c\x10\x00\x66\x50\x52"
+    "\x53\x64\x64\x50\x10\x00\xa2\x27\x34\x2b\x3c\x32\x41\x1f\x42\x00\x42\x10\x00\x66\x3a\x40\x3a\x50\x41\x50\x10\x00\x66\x4e\x54\x4e"
+    "\x6d\x55\x64\x10\x00\xa2\x2c\x30\x41\x32\x40\x2b\x1f\x43\x00\x43\x10\x00\x66\x3b\x3f\x50\x41\x50\x3a\x10\x00\x66\x4f\x53\x64\x55"
+    "\x69\x4e\x10\x00\xa2\x2d\x1e\x23\x14\x14\x2d\x7f\x13\x00\x13\x10\x00\xa3\x32\x14\x37\x19\x19\x1e\x7f\x3d\x00\x3d\xa0\x00\x92\x2d"
+    "\x32\x50\x50\x46\x7f\x0e\x00\x0e\x10\x00\x66\x28\x23\x1e\x14\x14\x32\x30\x00\x66\x2d\x19\x32\x19\x19\x23\x30\x00\xa3\x41\x50\x28"
+    "\x2d\x50\x4b\x7f\x44\x00\x44\x30\x00\x92\x2d\x28\x23\x23\x38\x7f\x33\x00\x4d\x10\x00\x66\x3f\x3c\x37\x32\x32\x47\x10\x00\x66\x53"
+    "\x50\x4b\x46\x46\x5b\x10\x00\xa2\x1e\x38\x23\x19\x23\x48\x7f\x32\x00\x3e\x10\x00\x66\x37\x51\x3c\x32\x46\x61\x10\x00\xa3\x28\x3c"
+    "\x1e\x1f\x1f\x46\x7f\x33\x00\x33\x70\x00\x56\x5a\x41\x3d\x3d\x64\x10\x00\x85\x23\x3c\x2c\x28\x36\x37\x7f\x16\xc0\x00\x56\x55\x45"
+    "\x41\x4f\x50\x10\x00\xa3\x23\x37\x1e\x32\x28\x5a\x7f\x09\x00\x09\x20\x00\x56\x5a\x37\x5a\x50\x64\x10\x00\xa2\x32\x4b\x55\x14\x1e"
+    "\x28\x7f\x08\x00\x08\x10\x00\x66\x4b\x64\x6e\x2d\x37\x41\x10\x00\xa2\x37\x2f\x34\x28\x28\x29\xfe\x26\x00\x4f\x10\x00\x66\x46\x3e"
+    "\x43\x37\x37\x38\x10\x00\x66\x5a\x52\x57\x4b\x55\x4c\x10\x00\x75\x2e\x39\x28\x28\x28\x32\x00\x10\x00\x66\x3d\x48\x39\x37\x37\x41"
+    "\x10\x00\x66\x51\x5c\x4d\x55\x4b\x55\x10\x00\xa2\x46\x2d\x30\x3c\x41\x23\xbf\x38\x00\x62\x10\x00\x66\x5f\x46\x49\x55\x5a\x3c\x10"
+    "\x00\xa2\x26\x29\x28\x32\x41\x41\xbf\x12\x00\x12\x10\x00\x66\x49\x4c\x4b\x51\x64\x64\x10\x00\xa2\x73\x2d\x14\x2d\x19\x14\xbf\x38"
+    "\x00\x38\x10\x00\x66\x8c\x46\x2d\x4b\x32\x2d\x10\x00\xa3\x28\x2d\x23\x1e\x28\x37\x7f\x27\x00\x27\xe0\x00\x56\x50\x46\x41\x4b\x5a"
+    "\x10\x00\xa3\x2d\x32\x37\x4b\x41\x1e\x7f\x22\x00\x22\x20\x01\x56\x41\x46\x55\x4b\x28\x10\x00\x66\x4b\x50\x55\x64\x5a\x32\x10\x00"
+    "\xa3\x23\x46\x37\x2d\x37\x19\x7f\x1b\x00\x57\x30\x00\x57\x5f\x50\x3c\x50\x1e\x10\x00\x93\x37\x32\x28\x37\x2d\x7f\x0e\x00\x6e\xe0"
+    "\x00\x74\x41\x3c\x5a\x4b\x5a\x7f\x13\x10\x00\xa3\x0a\x37\x19\x23\x2d\x5f\x7f\x08\x00\x47\x50\x00\x56\x50\x32\x32\x46\x78\x10\x00"
+    "\xa3\x28\x2d\x23\x28\x28\x5a\x7f\x35\x00\x65\xf0\x01\x74\x46\x3c\x41\x41\x73\x7f\x07\x10\x00\xa2\x32\x34\x30\x41\x32\x37\x7f\x06"
+    "\x00\x0d\x10\x00\x66\x50\x52\x4e\x5f\x50\x55\x10\x00\xa3\x28\x50\x23\x23\x2d\x46\x7f\x48\x00\x53\x40\x00\x56\x69\x3c\x3c\x46\x5f"
+    "\x10\x00\x84\x37\x46\x2d\x46\x32\x3c\x3f\x16\x40\x01\x66\x5a\x6e\x50\x64\x50\x5f\x10\x00\x30\x28\x32\x28\x80\x00\x33\x0b\x00\x06"
+    "\x40\x00\x47\x41\x41\x32\x32\x10\x00\x66\x5a\x55\x5f\x46\x5a\x46\x10\x00\x84\x19\x14\x0f\x69\x37\x5a\x3f\x1c\x50\x01\x66\x28\x23"
+    "\x1e\x78\x46\x69\x10\x00\x66\x37\x32\x2d\x87\x55\x78\x10\x00\xa3\x46\x50\x32\x23\x23\x23\x3f\x3e\x00\x63\xc0\x00\x56\x64\x46\x32"
+    "\x3c\x2d\x10\x00\x66\x5a\x82\x50\x41\x55\x37\x10\x00\x57\x32\x4b\x23\x46\x1e\x90\x01\x66\x41\x5a\x32\x55\x2d\x37\x10\x00\x66\x50"
+    "\x69\x41\x64\x3c\x46\x10\x00\xa3\x28\x28\x23\x32\x64\x46\x7f\x1d\x00\x40\x20\x00\x56\x46\x41\x50\x78\x64\x10\x00\xa3\x28\x50\x64"
+    "\x1e\x1e\x14\x7f\x45\x00\x05\xa0\x00\x56\x5f\x73\x2d\x2d\x23\x10\x00\x66\x50\x6e\x82\x37\x41\x2d\x10\x00\x84\x32\x55\x37\x41\x41"
+    "\x5a\x7f\x32\x20\x01\x66\x41\x64\x46\x50\x50\x69\x10\x00\xa2\x5a\x41\x41\x28\x28\x0f\x7f\x0c\x00\x14\x10\x00\x66\x5f\x4b\x6e\x64"
+    "\x50\x1e\x10\x00\x85\x19\x23\x46\x5f\x37\x2d\xff\x2a\x50\x00\x56\x3c\x5f\x78\x46\x46\x10\x00\x84\x34\x41\x37\x3a\x3e\x3c\x7f\x33"
+    "\x20\x01\xa2\x23\x55\x2d\x23\x23\x4b\x7f\x32\x00\x30\x10\x00\x66\x3c\x6e\x46\x3c\x3c\x64\x10\x00\xa3\x41\x2d\x37\x2d\x46\x2d\x7f"
+    "\x2f\x00\x5d\x80\x00\x56\x46\x50\x46\x5f\x46\x10\x00\xa2\x50\x50\x32\x28\x32\x19\x7f\x01\x00\x3c\x10\x00\x66\x69\x69\x4b\x41\x64"
+    "\x32\x10\x00\xa3\x1e\x41\x64\x2d\x19\x28\x7f\x4b\x00\x5c\x90\x00\x56\x5f\xb4\x55\x2d\x46\x10\x00\xa2\x1e\x23\x1e\x64\x23\x50\x7f"
+    "\x1a\x00\x1a\x10\x00\x66\x2d\x32\x2d\x73\x37\x5f\x10\x00\x66\x3c\x41\x3c\x82\x4b\x6e\x10\x00\x66\x23\x2d\xa0\x1e\x2d\x46\x30\x01"
+    "\xa2\x3c\x30\x2d\x2b\x5a\x2a\x7f\x0f\x00\x6c\x10\x00\x66\x55\x49\x46\x49\x73\x43\x10\x00\xa3\x1e\x69\x5a\x19\x19\x32\x7f\x34\x00"
+    "\x4b\x80\x01\x56\x82\x73\x32\x32\x4b\x10\x00\x85\x28\x1e\x32\x37\x37\x64\xff\x2b\xb0\x04\x57\x32\x46\x50\x50\x8c\x10\x00\x47\x28"
+    "\x50\x3c\x2d\x10\x02\x57\x5f\x5f\x55\x7d\x41\x10\x02\x50\x32\x32\x5f\x28\x32\xd0\x01\x13\x1f\x30\x00\x40\x50\x6e\x32\x50\xd0\x01"
+    "\x03\x10\x00\xa3\x32\x78\x35\x23\x6e\x57\x00\x07\x00\x78\x10\x00\x93\x69\x4f\x23\x6e\x4c\x00\x33\x00\x59\x50\x01\x93\x37\x4b\x3c"
+    "\x4b\x1e\x7f\x14\x00\x0c\x90\x00\x56\x41\x5f\x3c\x2d\x23\xf0\x00\x66\x41\x5a\x78\x55\x46\x3c\x10\x00\xa3\x50\x55\x5f\x1e\x1e\x19"
+    "\x7f\x1f\x00\x45\x70\x01\x56\x82\x78\x2d\x2d\x28\x10\x00\xa3\xfa\x05\x05\x23\x69\x32\xfe\x1e\x00\x20\x40\x00\x93\x37\x73\x64\x28"
+    "\x3c\x7f\x22\x00\x66\x30\x00\x93\x5f\x50\x28\x50\x5a\xfe\x30\x00\x71\x20\x01\x93\x28\x46\x46\x19\x3c\x7f\x21\x00\x61\x20\x01\x74"
+    "\x41\x5f\x5f\x2d\x55\x7f\x26\x10\x00\xa3\x2d\x43\x3c\x23\x32\x3f\x7f\x21\x00\x29\x80\x00\x56\x5c\x41\x41\x50\x44\x10\x00\xa3\x1e"
+    "\x2d\x37\x46\x37\x55\xff\x23\x00\x1e\x00\x01\x56\x4b\x55\x64\x55\x73\x10\x00\xa2\x28\x2d\x41\x64\x78\x5a\x7f\x2b\x00\x6f\x10\x00"
+    "\x85\x46\x6e\x50\x37\x50\x69\x7f\x44\x70\x04\x74\x32\x23\x73\x5f\x5f\xfe\x0c\xb0\x01\x75\x41\x53\x39\x5f\x55\x69\x3f\x30\x06\xa3"
+    "\x41\x5f\x39\x64\x55\x5d\x3f\x31\x00\x31\x10\x00\x92\x7d\x64\x37\x46\x55\x7f\x34\x00\x68\x10\x00\x84\x4b\x64\x5f\x28\x46\x6e\x00"
+    "\x16\x70\x04\xa3\x14\x0a\x37\x0f\x14\x50\x7f\x21\x00\x21\xb0\x01\x92\x7d\x4f\x3c\x64\x51\x7f\x16\x00\x16\x10\x00\x84\x82\x55\x50"
+    "\x55\x5f\x3c\x7f\x0b\x00\x02\x11\x30\x01\x00\x43\xff\x07\x00\x07\x00\x01\x93\x37\x32\x2d\x41\x37\x1f\x32\x00\x5b\x30\x00\x93\x41"
+    "\x3c\x6e\x5f\x41\x1f\x0b\x00\x0b\x80\x00\x00\x10\x00\x53\x82\x1f\x0a\x00\x0a\x10\x00\x65\x82\x3c\x5f\x6e\x41\x1f\x20\x06\x20\x41"
+    "\x3c\xd0\x05\x42\xff\x24\x00\x58\x10\x00\x84\x23\x28\x64\x5a\x37\x23\x1f\x21\x70\x00\x66\x46\x3c\x7d\x73\x46\x37\x10\x00\x50\x1e"
+    "\x50\x5a\x37\x2d\x10\x00\x13\x04\x40\x01\x56\x73\x69\x41\x46\x50\x10\x00\xa2\x50\x69\x41\x3c\x4b\x82\x1f\x45\x00\x2e\x10\x00\xa2"
+    "\xa0\x6e\x41\x41\x6e\x1e\x1f\x11\x00\x2f\x10\x00\x84\x5a\x55\x64\x5f\x7d\x55\xff\x2e\x20\x00\x67\x5a\x5a\x55\x7d\x5a\x64\x10\x00"
+    "\x56\x64\x5a\x7d\x55\x5a\x10\x00\x66\x29\x40\x2d\x32\x32\x32\x50\x08\x66\x3d\x54\x41\x46\x46\x46\x10\x00\x66\x5b\x86\x5f\x64\x64"
+    "\x50\xb0\x06\x66\x6a\x6e\x5a\x9a\x5a\x82\x40\x00\x11\x64\x01\x00\x42\xff\x1c\x00\x1c\x10\x00\x4a\x2d\x31\x41\x31\x70\x09\x2a\x50"
+    "\x3f\x70\x09\x2f\x64\x53\x70\x09\x29\x57\x32\x41\x40\x2c\x30\x70\x09\x57\x41\x50\x50\x3b\x3f\x70\x09\x57\x55\x69\x64\x4f\x53\x70"
+    "\x09\x84\x23\x2e\x22\x23\x2d\x14\x7f\x32\xb0\x08\x50\x55\x4c\x40\x2d\x37\x50\x05\x03\x10\x00\x84\x3c\x1e\x1e\x24\x38\x32\x7f\x0f"
+    "\x10\x00\x66\x64\x32\x32\x4c\x60\x46\x10\x00\x84\x28\x14\x1e\x28\x50\x37\x7f\x44\x00\x05\x66\x37\x23\x32\x37\x6e\x55\x10\x00\xa3"
+    "\x28\x3c\x28\x28\x28\x1e\x7f\x44\x00\x0f\xd0\x01\x56\x5a\x46\x3c\x3c\x28\x10\x00\x67\x55\x5a\x50\x46\x50\x82\x00\x08\x92\x26\x26"
+    "\x38\x38\x43\x7f\x0a\x00\x23\x10\x00\x57\x7d\x3a\x3a\x4c\x4c\x10\x00\x63\x14\x28\x0f\x23\x23\x3c\x20\x09\x96\x02\x00\x00\x32\x19"
+    "\x1c\x2d\x37\x0f\x90\x08\x50\x5a\x1e\x0f\x28\x14\x10\x00\x03\x60\x08\x84\x23\x14\x41\x28\x41\x14\x1f\x37\xe0\x03\x66\x37\x28\x55"
+    "\x50\x69\x28\x10\x00\x85\x28\x32\x2d\x46\x2d\x46\x7f\x1c\xc0\x05\x56\x4b\x46\x5f\x46\x5f\x10\x00\x66\x37\x28\x28\x41\x2d\x23\x90"
+    "\x09\x66\x46\x37\x37\x50\x3c\x2d\x10\x00\x66\x5a\x4b\x4b\x73\x5a\x37\x10\x00\x57\x4b\x50\x55\x5a\x64\x90\x08\xa4\x46\x14\x32\x14"
+    "\x32\x28\x7f\x2f\x00\x25\x40\x01\x46\x50\x32\x50\x32\x10\x00\x84\x46\x64\x73\x1e\x41\x1e\x7f\x05\x90\x04\x57\x5a\x4b\x4b\x5a\x64"
+    "\xc0\x07\x50\x23\x23\x28\x23\x37\x50\x00\x03\x90\x04\x66\x37\x2d\x32\x2d\x41\x50\x10\x00\x10\x4b\x4f\x04\x17\x6e\x20\x00\x92\x46"
+    "\x37\x28\x37\x55\x7f\x32\x00\x35\x10\x00\x11\x1e\x01\x00\x43\x7f\x22\x00\x5e\x30\x00\x47\x4b\x37\x69\x55\x10\x00\x84\x41\x41\x2d"
+    "\x4b\x2d\x5f\x7f\x03\x50\x0b\x84\x37\x2d\x2d\x19\x19\x0f\x7f\x06\xc0\x03\x66\x5f\x55\x55\x41\x41\x23\x10\x00\x75\x41\x41\x3c\x82"
+    "\x5f\x6e\x1f\xd0\x02\x66\x5f\x41\x6e\x3c\x82\x41\x10\x00\xa3\x3c\x55\x2a\x55\x2a\x5b\x7f\x0f\x00\x69\x20\x00\x47\x4b\x50\x64\x6e"
+    "\x70\x07\x66\x3c\x3c\x3c\x55\x55\x55\xa0\x05\x75\x30\x48\x30\x48\x30\x30\xff\x10\x00\xa3\xbe\x21\x3a\x21\x3a\x21\x7f\x17\x00\x17"
+    "\x20\x01\x74\x50\x41\x5a\x41\x55\x7f\x27\x90\x01\x84\x32\x41\x5a\x23\x23\x0f\x7f\x05\xd0\x06\x30\x4b\x5a\x8c\x50\x02\x05\x10\x00"
+    "\xa4\x64\x46\x46\x41\x41\x2d\x7f\x20\x00\x32\xd0\x01\x30\x69\x23\x41\x00\x05\x04\x40\x0b\x57\x55\xc8\x37\x41\x1e\x10\x07\x74\x50"
+    "\x32\x28\x28\x1e\xbf\x16\x30\x00\xa3\x5a\x78\x4b\x3c\x3c\x2d\xbf\x16\x00\x5f\x40\x00\x40\x5f\x4b\x37\x37\xe0\x05\x03\x20\x05\x66"
+    "\x46\x82\x64\x37\x50\x41\x90\x05\xa2\x14\x0a\xe6\x0a\xe6\x05\x7f\x05\x00\x52\x10\x00\x50\x50\x7d\x4b\x28\x5f\x00\x03\x04\x30\x0c"
+    "\x75\x5f\x37\x23\x4b\x73\x7f\x27\x50\x03\x74\x50\x32\x32\x32\x28\x7f\x35\x60\x00\x84\x5a\x82\x4b\x4b\x4b\x37\x7f\x3e\x10\x00\x84"
+    "\x28\x28\x28\x46\x28\x14\x7f\x28\xc0\x05\x68\x32\x32\x78\x50\x50\x1e\x10\x00\x83\x28\x1e\x1e\x32\x7f\x0c\x00\x51\xf0\x00\x47\x64"
+    "\x50\x3c\x3c\x10\x00\x84\x37\x37\x55\x41\x55\x23\xbf\x37\x50\x06\x20\x23\x41\x02\x00\x24\x7f\x37\xa0\x06\x85\x4b\x69\x4b\x69\x4b"
+    "\x2d\x7f\x15\xb0\x06\x93\x37\x2d\x41\x2d\x4b\x7f\x48\x00\x37\xf0\x00\x75\x28\x46\x50\x8c\x46\x7f\x21\xf0\x01\x40\x50\x8c\x28\x46"
+    "\xe0\x0c\x03\x30\x01\x84\x2d\x3c\x1e\x50\x32\x41\x7f\x30\xc0\x05\x67\x4b\x5a\x32\x6e\x50\x5f\x10\x00\x56\x5f\x5f\x5f\x5f\x55\x20"
+    "\x07\x20\x5a\x3c\x01\x04\x24\x7f\x35\x90\x02\x30\x5a\x78\x78\xb0\x00\x05\xb0\x01\x66\x55\x50\x5a\x69\x5f\x3c\x00\x06\xa3\x49\x5f"
+    "\x3e\x55\x41\x55\x7f\x16\x00\x77\xd0\x00\x74\x14\x23\x14\x2d\x4b\x7f\x14\x70\x01\x11\x23\x01\x00\x43\x00\x3e\x00\x50\x10\x01\x74"
+    "\x5f\x5f\x23\x6e\x46\x00\x16\x20\x00\x66\x2d\x1e\x0f\x55\x41\x41\x20\x07\x66\x2d\x3f\x25\x41\x37\x5f\x20\x07\x66\x2d\x4b\x25\x46"
+    "\x37\x53\x20\x07\x84\x5f\x50\x69\x28\x46\x64\xfe\x2f\xe0\x07\x66\xff\x0a\x0a\x4b\x87\x37\x10\x08\x66\x5a\x55\x4b\x73\x64\x73\xd0"
+    "\x05\x57\x73\x73\x55\x5a\x4b\x30\x06\x57\x64\x4b\x73\x5a\x73\x50\x06\x84\x32\x40\x32\x2d\x32\x29\x7f\x3e\x00\x02\x66\x46\x54\x46"
+    "\x41\x46\x33\x30\x06\xa2\x64\x86\x6e\x5f\x64\x3d\x7f\x2d\x00\x2d\x10\x00\x66\x6a\x5a\x82\x5a\x9a\x6e\x40\x00\x57\x6a\x82\x5a\x6e"
+    "\x9a\x80\x06\x03\x40\x06\x16\x1e\x20\x08\x46\x23\x41\x37\x46\x20\x06\x66\x32\x41\x2d\x55\x41\x5f\x10\x00\x66\x46\x55\x41\x69\x55"
+    "\x78\x10\x00\x66\x2d\x3c\x28\x46\x32\x2d\x20\x06\x66\x3c\x55\x3c\x55\x3c\x37\x10\x00\x57\x50\x78\x46\x6e\x46\x50\x06\x20\x32\x46"
+    "\xa0\x02\x06\x20\x06\x66\x46\x55\x46\x3c\x46\x32\x10\x00\x67\x64\x6e\x5a\x55\x5a\x3c\x40\x06\x74\x37\x23\x1e\x1e\x23\x7f\x32\xc0"
+    "\x02\x01\xe0\x05\x25\x46\x7f\x40\x03\x84\x26\x1e\x29\x1e\x29\x3c\x7f\x35\x20\x03\x66\x4e\x46\x3d\x32\x3d\x64\x10\x00\x67\x2d\x2d"
+    "\x23\x14\x1e\x14\xf0\x0f\x20\x23\x37\x80\x04\x06\xf0\x0f\x40\x46\x32\x5a\x32\x70\x03\x03\xc0\x0f\x0d\x20\x00\x56\x32\x46\x32\x5a"
+    "\x41\x40\x00\xa4\x28\x1e\x1e\x28\x32\x1e\x7f\x21\x00\x2c\x20\x00\x46\x32\x3c\x46\x32\x10\x00\x30\x50\x46\x46\x60\x05\x05\x10\x00"
+    "\x32\x28\x28\x32\x20\x05\x03\x60\x04\x41\x46\x46\x28\x3c\x00\x0a\x03\x10\x00\x50\x5a\x64\x3c\x5a\x3c\x70\x05\x04\xd0\x06\x56\x37"
+    "\x1e\x1e\x1e\x55\xe0\x01\x66\x3c\x55\x3c\x32\x32\x7d\x10\x00\x66\x28\x1e\x1e\x37\x1e\x55\x00\x10\x66\x3c\x32\x64\x55\x46\x41\x10"
+    "\x00\xa3\x1c\x19\x19\x2d\x23\x28\x7f\x1c\x00\x24\x20\x01\x56\x23\x23\x41\x37\x32\x10\x00\x66\x44\x41\x41\x7d\x73\x50\x10\x00\x66"
+    "\x28\x1e\x20\x32\x34\x41\xa0\x09\x66\x46\x3c\x3e\x50\x52\x3c\xa0\x09\x10\x3c\xaf\x00\x53\x23\x7f\x1b\x00\x5a\x10\x00\x20\x82\x50"
+    "\x80\x01\x06\x10\x00\x93\x3c\x3c\x23\x23\x1e\x7f\x36\x00\x36\x00\x01\x92\x50\x50\x37\x37\x5a\x7f\x48\x00\x48\x10\x00\x66\x96\xa0"
+    "\x64\x5f\x41\x64\x20\x00\x66\x1f\x2d\x5a\x1e\x1e\x28\x60\x11\xa2\x3d\x5a\x2d\x32\x32\xa0\x7f\x03\x00\x03\x10\x00\xa2\x01\x5a\x2d"
+    "\x1e\x1e\x28\xff\x19\x00\x19\x10\x00\xa2\x40\x33\x17\x33\x17\x1c\x7f\x2b\x00\x2b\x10\x00\x66\x54\x47\x2b\x47\x2b\x30\x10\x00\x66"
+    "\x68\x5b\x3f\x5b\x3f\x44\x10\x00\x84\x48\x3c\x1e\x14\x1e\x19\x3f\x2f\x30\x01\x66\x90\x78\x3c\x28\x3c\x32\x10\x00\x75\x32\x14\x28"
+    "\x14\x28\x14\xbf\x20\x07\x50\x1e\x2d\x87\x2d\x5a\x20\x07\x13\x2a\x20\x00\x93\x2d\x2d\x23\x23\x32\xbf\x38\x00\x60\x10\x01\x56\x41"
+    "\x41\x37\x37\x46\x10\x00\xa3\x32\x4b\x4b\x41\x41\x32\x7f\x33\x00\x64\x10\x00\x40\x55\x55\x37\x37\xd0\x0c\x03\x30\x01\x30\x32\x46"
+    "\x64\x90\x08\x05\x70\x07\x30\x3c\x5a\x8c\x90\x05\x05\x10\x00\x32\x46\x6e\xb4\xa0\x04\x03\x10\x00\xa4\x1e\x28\x37\x28\x37\x3c\x7f"
+    "\x4a\x00\x4a\x50\x01\x46\x4b\x3c\x4b\x50\x10\x00\x84\x28\x2d\x28\x41\x28\x41\x7f\x09\xc0\x0c\x66\x46\x4b\x3c\x69\x3c\x69\x10\x00"
+    "\xa4\x3c\x32\x28\x55\x4b\x5f\x7f\x39\x00\x39\xb0\x01\x82\x32\x4b\x55\x5f\x7f\x3a\x00\x3a\x10\x00\x84\x41\x49\x37\x2f\x4b\x55\x00"
+    "\x23\xe0\x02\x84\x41\x2f\x37\x49\x4b\x55\xfe\x0c\x90\x10\xa3\x32\x3c\x2d\x64\x50\x41\x7f\x1e\x00\x26\x60\x00\x74\x2b\x35\x2b\x35"
+    "\x28\x7f\x40\x30\x0e\x66\x64\x49\x53\x49\x53\x37\x10\x00\xa3\x2d\x5a\x14\x41\x14\x41\x7f\x18\x00\x18\x30\x00\x56\x78\x28\x5f\x28"
+    "\x5f\x10\x00\x84\x82\x46\x23\x46\x23\x3c\x7f\x29\x40\x0d\x57\xaa\x5a\x2d\x5a\x2d\x10\x00\x21\x3c\x3c\xf0\x08\x33\x0c\x00\x56\x40"
+    "\x00\x93\x64\x46\x69\x4b\x28\x7f\x28\x00\x74\x10\x00\x93\x55\x8c\x55\x46\x14\x7f\x49\x00\x49\x30\x00\x74\x19\x23\x46\x50\x3c\x7f"
+    "\x2f\xe0\x07\x66\x50\x2d\x41\x5a\x6e\x50\x10\x00\x11\x3c\x01\x00\x24\x7f\x14\x50\x13\x84\x2d\x64\x2d\x2d\x2d\x0a\x7f\x34\x50\x11"
+    "\x01\x70\x04\x17\x46\xb0\x0d\x56\x64\x50\x50\x50\x64\x10\x00\x66\x32\x55\x28\x55\x28\x23\xf0\x12\x66\x46\x73\x3c\x73\x3c\x37\x10"
+    "\x00\x75\x2d\x28\x3c\x28\x4b\x32\x7f\x20\x05\x66\x4b\x46\x5a\x46\x69\x50\x10\x00\xa3\x49\x73\x3c\x3c\x3c\x5a\x7f\x11\x00\x11\x10"
+    "\x00\x56\x64\x3c\x64\x3c\x41\x40\x04\x66\x46\x37\x41\x5f\x55\x46\x80\x08\x57\x46\x5f\x55\x37\x41\x10\x00\xa2\x32\x30\x2b\x2e\x29"
+    "\x3c\x7f\x0c\x00\x6b\x10\x00\x57\x6e\x4e\x49\x4c\x47\x10\x00\x66\x2b\x50\x41\x32\x23\x23\x20\x0f\x67\x3f\x78\x55\x5a\x37\x37\x30"
+    "\x0f\x56\x28\x37\x28\x46\x37\x50\x00\x66\x3c\x46\x69\x46\x78\x4b\x10\x00\xa2\x42\x29\x4d\x3d\x57\x17\x1f\x15\x00\x15\x10\x00\x66"
+    "\x56\x51\x61\x51\x6b\x2b\x10\x00\x84\x2d\x5f\x32\x28\x32\x4b\x1f\x04\xe0\x0c\x66\x4b\x7d\x64\x46\x50\x2d\x10\x00\x58\x14\x0f\x14"
+    "\x0a\x37\xc0\x0d\x93\x3c\x4f\x64\x7d\x51\x7f\x3f\x00\x3f\xd0\x00\x01\x01\x00\x60\x7f\x3b\x00\x3b\x00\x00\x34\x00\xa2\x3c\x5a\x46"
+    "\x3c\x78\x28\x7f\x10\x00\x10\x20\x00\x84\x2c\x4b\x23\x3f\x21\x2d\x7f\x0f\x70\x07\x66\x40\x73\x41\x53\x3f\x41\x10\x00\x66\x14\x28"
+    "\x5a\x1e\x5a\x19\x90\x01\x75\x28\x46\x82\x3c\x82\x19\x7f\xa0\x06\x67\x63\x44\x53\x48\x57\x33\x50\x0a\x57\x32\x46\x5f\x50\x41\x90"
+    "\x0f\x10\x82\x31\x03\x25\x7f\x2e\x10\x0a\x56\x17\x30\x17\x30\x17\xe0\x09\x11\x32\x01\x00\x43\x7f\x27\x00\x73\x00\x02\x01\x01\x00"
+    "\x06\x10\x00\x84\x46\x28\x32\x37\x32\x19\x7f\x2f\x10\x00\x41\x5a\x3c\x46\x4b\x60\x11\x03\x10\x00\x66\x6e\x50\x5a\x5f\x5a\x41\x10"
+    "\x00\x85\x23\x40\x55\x4a\x37\x20\x7f\x4b\xc0\x10\x56\x68\x69\x5e\x4b\x34\x20\x01\x48\x37\x54\x69\x72\x10\x00\x30\x64\x5a\x82\xc0"
+    "\x0e\x14\x21\xf0\x03\x75\x2b\x1e\x37\x28\x41\x61\xbf\x20\x00\x84\x2d\x4b\x3c\x28\x1e\x32\x7f\x45\x20\x00\x57\x41\x5f\x64\x3c\x32"
+    "\x10\x00\x66\x5f\x87\x50\x6e\x50\x64\x90\x05\xa3\x28\x37\x50\x23\x3c\x1e\xff\x1d\x00\x1d\xf0\x01\x56\x4b\x64\x37\x50\x32\x10\x00"
+    "\x67\x50\x87\x82\x5f\x5a\x46\x10\x00\x48\x64\xc8\x32\x64\x20\x00\x48\x32\x64\x64\xc8\x10\x00\x48\x4b\x96\x4b\x96\x10\x00\x66\x50"
+    "\x5a\x6e\x82\x6e\xfe\x30\x03\x65\x5a\x50\x82\x6e\x6e\x00\x10\x00\x80\x64\x64\x5a\x96\x8c\x5a\xff\x02\x1c\x0d\x01\x10\x00\x92\x96"
+    "\x8c\x64\x5a\x5a\xff\x46\x00\x46\x10\x00\xa4\x69\x96\x5a\x96\x5a\x5f\xff\x4c\x00\x4c\x30\x00\x01\x60\x08\x14\x20\xf0\x08\x20\x32"
+    "\x96\x02\x00\x03\x80\x08\x96\x04\xf0\x01\x37\x44\x40\x2d\x37\x1f\x50\x08\x66\x4b\x59\x55\x37\x41\x24\x10\x00\x66\x5f\x6d\x69\x4b"
+    "\x55\x38\x10\x00\x66\x2c\x3a\x2c\x3a\x2c\x3d\x50\x08\x66\x40\x4e\x34\x4e\x34\x51\x10\x00\x66\x4c\x68\x47\x68\x47\x6c\x10\x00\x57"
+    "\x35\x33\x35\x3d\x38\x70\x08\x57\x40\x42\x44\x51\x4c\x70\x08\x57\x54\x56\x58\x6f\x65\x70\x08\x01\x80\x07\x00\x90\x13\x03\x50\x07"
+    "\x50\x37\x4b\x32\x28\x28\x50\x17\x03\x80\x01\x57\x55\x78\x46\x32\x32\x90\x01\xa2\x3b\x2d\x28\x23\x28\x1f\x7f\x56\x00\x6d\x10\x00"
+    "\x66\x4f\x55\x3c\x37\x3c\x47\x10\x00\x66\x25\x19\x29\x19\x29\x19\x10\x04\x57\x4d\x55\x33\x37\x33\x70\x08\x85\x2d\x41\x22\x28\x22"
+    "\x2d\x7f\x4f\x70\x07\x56\x55\x31\x3c\x31\x3c\x10\x00\x66\x50\x78\x4f\x5f\x4f\x46\x10\x00\x66\x28\x1e\x23\x32\x46\x37\xb0\x05\x66"
+    "\x3c\x46\x37\x7d\x69\x5a\x10\x00\x84\x43\x7d\x28\x1e\x1e\x3a\x1f\x68\x90\x11\x57\x61\xa5\x3c\x41\x32\x10\x00\x75\x1e\x2a\x76\x2a"
+    "\x58\x1e\x1f\x20\x0b\x57\x3c\x34\xa8\x2f\x8a\x10\x00\x63\x28\x1d\x2d\x1d\x2d\x24\xb0\x00\xb1\x03\x00\x00\x3c\x3b\x55\x4f\x69\x24"
+    "\xfe\x6b\x90\x04\xa5\x03\xf3\x01\x46\x5e\x32\x5e\x32\x42\x00\xc0\x00\xa2\x1e\x1e\x2a\x1e\x2a\x46\x1f\x76\x00\x76\x10\x00\x75\x46"
+    "\x50\x66\x50\x66\x28\xfe\xc0\x03\x66\x3c\x2d\x46\x2d\x5a\x5f\x30\x0e\x50\x37\x41\x23\x3c\x1e\xc0\x0b\x03\x00\x03\x66\x55\x69\x37"
+    "\x55\x32\x73\x10\x00\x67\x2d\x23\x2d\x3e\x35\x23\xe0\x0e\x93\x3c\x46\x57\x4e\x55\x7f\x7a\x00\x7a\xe0\x01\x92\x30\x30\x39\x3e\x22"
+    "\x7f\x3c\x00\x72\xa0\x0f\x66\x6f\x53\x44\x5c\x52\x27\x10\x00\x85\x4b\x64\x42\x3c\x42\x73\x7f\x65\x10\x0c\x92\x32\x22\x3c\x2c\x46"
+    "\x7f\x6a\x00\x54\x10\x00\x66\x96\x50\x2c\x5a\x36\x50\x10\x00\x50\x37\x42\x2c\x2c\x38\xd0\x0e\x12\x67\x10\x00\x84\x41\x4c\x54\x36"
+    "\x60\x69\x7f\x38\x10\x00\x66\x3c\x3c\x3c\x69\x69\x69\x70\x04\x66\x64\x7d\x34\x69\x34\x47\x80\x0e\x84\x31\x37\x2a\x2a\x25\x55\xbf"
+    "\x07\x90\x06\x75\x47\x52\x40\x40\x3b\x70\xbf\xa0\x06\x66\x2d\x1e\x32\x41\x32\x2d\x40\x00\xa2\x3f\x3f\x2f\x29\x29\x4a\x7f\x01\x00"
+    "\x6a\x10\x00\x66\x67\x5d\x43\x47\x3d\x54\x10\x00\xa3\x39\x18\x56\x18\x56\x17\xff\x1a\x00\x55\xd0\x01\x56\x59\x74\x4f\x74\x21\x10"
+    "\x00\x66\x32\x50\x5f\x0a\x2d\x0a\x40\x08\x66\x14\x19\x2d\x46\x5a\x3c\xd0\x13\x66\x64\x05\x05\x0f\x41\x1e\x60\x0c\x57\x4c\x41\x2d"
+    "\x5c\x2a\x70\x1a\x66\x32\x5c\x6c\x5c\x6c\x23\x60\x05\x66\x3a\x46\x2d\x28\x2d\x2a\xf0\x06\x66\x44\x5a\x41\x32\x37\x52\x10\x00\x66"
+    "\x6c\x82\x5f\x50\x55\x66\x10\x00\x84\x87\x55\x28\x28\x55\x05\x1f\x35\xf0\x12\x85\x28\x46\x28\x23\x28\x3c\x1f\x50\xe0\x17\x56\x6e"
+    "\x46\x73\x46\x5a\x10\x00\x66\x44\x48\x4e\x26\x2a\x20\x90\x0c\x66\x6c\x70\x76\x44\x48\x2f\x10\x00\x84\x28\x32\x5a\x1e\x37\x41\x7f"
+    "\x04\xd0\x0d\x66\x46\x5a\x6e\x3c\x4b\x5f\x10\x00\x84\x30\x3d\x28\x3d\x28\x32\x7f\x6b\x60\x19\x66\x53\x6a\x41\x56\x41\x55\x10\x00"
+    "\x66\x4a\x64\x48\x5a\x48\x2e\x60\x01\x81\x31\x31\x38\x31\x3d\x42\x7f\x21\x10\x02\x96\x01\x00\x00\x45\x45\x4c\x45\x56\x5b\x10\x00"
+    "\x50\x2d\x14\x32\x3c\x78\xb0\x0b\x03\x80\x0e\xa2\x3c\x3e\x32\x3e\x3c\x28\x7f\x75\x00\x75\x10\x00\x66\x5a\x5c\x4b\x5c\x55\x3c\x10"
+    "\x00\x66\x46\x78\x41\x2d\x55\x7d\x30\x01\x66\x46\x46\x73\x82\x5a\x3c\xc0\x17\x66\x6e\x55\x5f\x50\x5f\x32\x30\x16\x50\x73\x8c\x82"
+    "\x37\x37\x00\x16\x03\xd0\x08\x57\x64\x64\x7d\x6e\x32\x60\x11\xa3\x4b\x7b\x43\x5f\x55\x5f\x3f\x4e\x00\x4e\x10\x00\x47\x5f\x43\x7d"
+    "\x5f\x30\x0e\x66\x55\x32\x5f\x78\x73\x50\x40\x12\x50\x56\x4c\x56\x74\x38\x40\x11\x03\xb0\x09\x84\x41\x6e\x82\x3c\x41\x5f\x1f\x66"
+    "\x50\x00\x84\x41\x3c\x6e\x82\x5f\x41\x1f\x51\xa0\x0f\x66\x4b\x5f\x7d\x2d\x4b\x5f\x90\x10\x66\x6e\x82\x50\x46\x3c\x50\xc0\x0f\x84"
+    "\x55\x50\x46\x87\x4b\x5a\xff\x5b\x10\x0f\x70\x44\x7d\x41\x41\x73\x50\x00\x02\x00\x02\x10\x01\x40\x37\x91\x4b\x96\xb0\x0a\x03\x10"
+    "\x0b\x67\x2d\x64\x87\x41\x87\x2d\x00\x01\x65\x50\x46\x50\x46\x6e\xfe\x70\x00\x63\x32\x32\x4d\x5f\x4d\x5b\x70\x08\x96\x06\xf7\x01"
+    "\x4b\x4b\x82\x4b\x82\x5f\x80\x08\x66\x50\x69\x69\x69\x69\x50\x10\x00\x66\x4b\x7d\x46\x7d\x46\x73\x10\x00\x57\x64\x78\x78\x96\x64"
+    "\x90\x0e\x57\x5a\x78\x64\x96\x78\x00\x0f\x75\x5b\x5a\x6a\x82\x6a\x4d\x7f\xd0\x15\xa2\x6e\xa0\x6e\x50\x6e\x64\xff\x70\x00\x70\x10"
+    "\x00\x54\x96\x64\x78\x64\x78\x40\x00\x97\x02\xf5\x01\x78\x46\x78\x4b\x82\x55\xc0\x06\x01\x01\x00\x24\xff\x5d\x20\x19\x03\x90\x06"
+    "\x05\x10\x00\xa9\x46\x5a\x5a\x87\x5a\x7d\xff\x7b\x00\x7b\x20\x00\x02\xe0\x09\x41\x02\xf6\x01\x78\x01\x00\x60\xff\x79\x00\x79\x00"
+    "\x00\x84\x00\x11\x0a\x01\x00\x15\xff\xe0\x1e\x0c\x10\x00\x55\x32\xb4\x14\xb4\x14\xe0\x06\x00\x80\x0a\x34\xa0\x46\xa0\xa0\x00\x00"
+    "\x10\x00\x56\x5f\x5a\x5f\x5a\xb4\x10\x00\x55\x3c\x4f\x69\x3b\x55\x60\x05\x77\x00\x00\x3c\x45\x5f\x45\x5f\x10\x00\x63\x96\x78\x64"
+    "\x78\x64\x5a\x30\x01\x93\x02\x00\x00\x64\x67\x4b\x78\x4b\x7f\x50\x07\x00\xa0\x14\x54\x41\x6b\x69\x6b\x56\x80\x01\x0f\x10\x00\x2f"
+    "\x00",
+    4993, 8128);
+
+const Resource personal5(
+    "\x11\x00\x01\x00\x12\xff\x07\x00\xf6\x0a\x00\x00\x00\x2d\x31\x31\x41\x41\x2d\x1f\x41\x00\x41\x00\x22\x00\x01\x00\x00\x3c\x3e\x3f"
+    "\x50\x50\x3c\x10\x00\x66\x50\x52\x53\x64\x64\x50\x10\x00\xc0\x27\x34\x2b\x3c\x32\x41\x1f\x42\x00\x42\x00\x5e\x10\x00\x66\x3a\x40"
+    "\x3a\x50\x41\x50\x10\x00\x66\x4e\x54\x4e\x6d\x55\x64\x10\x00\xc0\x2c\x30\x41\x32\x40\x2b\x1f\x43\x00\x43\x00\x2c\x10\x00\x66\x3b"
+    "\x3f\x50\x41\x50\x3a\x10\x00\x66\x4f\x53\x64\x55\x69\x4e\x10\x00\xc0\x2d\x1e\x23\x14\x14\x2d\x7f\x13\x00\x13\x00\x32\x10\x00\x90"
+    "\x32\x14\x37\x19\x19\x1e\x7f\x3d\x00\x02\x00\x00\xa0\x00\xb0\x2d\x32\x50\x50\x46\x7f\x0e\x00\x0e\x00\x6e\x10\x00\x66\x28\x23\x1e"
+    "\x14\x14\x32\x30\x00\x66\x2d\x19\x32\x19\x19\x23\x30\x00\xc1\x41\x50\x28\x2d\x50\x4b\x7f\x44\x00\x44\x00\x61\x30\x00\xb0\x2d\x28"
+    "\x23\x23\x38\x7f\x33\x00\x4d\x00\x91\x10\x00\x66\x3f\x3c\x37\x32\x32\x47\x10\x00\x66\x53\x50\x4b\x46\x46\x5b\x10\x00\xc0\x1e\x38"
+    "\x23\x19\x23\x48\x7f\x32\x00\x3e\x00\x37\x10\x00\x66\x37\x51\x3c\x32\x46\x61\x10\x00\xa2\x28\x3c\x1e\x1f\x1f\x46\x7f\x33\x00\x33"
+    "\x60\x00\x66\x41\x5a\x41\x3d\x3d\x64\x10\x00\xc1\x23\x3c\x2c\x28\x36\x37\x7f\x16\x00\x3d\x00\x7f\xc0\x00\x56\x55\x45\x41\x4f\x50"
+    "\x10\x00\xc1\x23\x37\x1e\x32\x28\x5a\x7f\x09\x00\x09\x00\x1f\x20\x00\x56\x5a\x37\x5a\x50\x64\x10\x00\xc0\x32\x4b\x55\x14\x1e\x28"
+    "\x7f\x08\x00\x08\x00\x92\x10\x00\x66\x4b\x64\x6e\x2d\x37\x41\x10\x00\xa2\x37\x2f\x34\x28\x28\x29\xfe\x26\x00\x4f\x90\x00\x66\x46"
+    "\x3e\x43\x37\x37\x38\x10\x00\x61\x5a\x52\x57\x4b\x55\x4c\x10\x00\x10\x7d\x10\x00\x75\x2e\x39\x28\x28\x28\x32\x00\x20\x00\x66\x3d"
+    "\x48\x39\x37\x37\x41\x10\x00\x61\x51\x5c\x4d\x55\x4b\x55\x10\x00\x01\x30\x00\xc0\x46\x2d\x30\x3c\x41\x23\xbf\x38\x00\x62\x00\x84"
+    "\x10\x00\x61\x5f\x46\x49\x55\x5a\x3c\x10\x00\x10\x6d\x10\x00\xc0\x26\x29\x28\x32\x41\x41\xbf\x12\x00\x12\x00\x46\x10\x00\x66\x49"
+    "\x4c\x4b\x51\x64\x64\x10\x00\xa2\x73\x2d\x14\x2d\x19\x14\xbf\x38\x00\x38\x40\x00\x61\x8c\x46\x2d\x4b\x32\x2d\x10\x00\x12\x77\x90"
+    "\x01\xa1\x23\x1e\x28\x37\x7f\x27\x00\x27\x00\x97\xe0\x00\x56\x50\x46\x41\x4b\x5a\x10\x00\xa2\x2d\x32\x37\x4b\x41\x1e\x7f\x22\x00"
+    "\x22\xe0\x01\x61\x3c\x41\x46\x55\x4b\x28\x10\x00\x12\x01\x30\x00\x41\x55\x64\x5a\x32\x10\x00\x11\x1b\x50\x01\xb1\x46\x37\x2d\x37"
+    "\x19\x7f\x1b\x00\x57\x00\x06\x30\x00\x57\x5f\x50\x3c\x50\x1e\x10\x00\x60\x37\x32\x28\x37\x2d\x7f\x3e\x02\x01\x50\x00\xc0\x46\x41"
+    "\x3c\x5a\x4b\x5a\x7f\x13\x00\x6e\x00\x93\x10\x00\xc1\x0a\x37\x19\x23\x2d\x5f\x7f\x08\x00\x47\x00\x9f\x50\x00\x56\x50\x32\x32\x46"
+    "\x78\x10\x00\xa2\x28\x2d\x23\x28\x28\x5a\x7f\x35\x00\x65\xc0\x01\x84\x41\x46\x3c\x41\x41\x73\x7f\x07\x10\x00\xc0\x32\x34\x30\x41"
+    "\x32\x37\x7f\x06\x00\x0d\x00\x21\x10\x00\x66\x50\x52\x4e\x5f\x50\x55\x10\x00\xc1\x28\x50\x23\x23\x2d\x46\x7f\x48\x00\x53\x00\x80"
+    "\x40\x00\x56\x69\x3c\x3c\x46\x5f\x10\x00\xc1\x37\x46\x2d\x46\x32\x3c\x3f\x16\x00\x12\x00\x9a\xc0\x01\x56\x6e\x50\x64\x50\x5f\x10"
+    "\x00\x30\x28\x32\x28\x80\x00\x32\x0b\x00\x06\x50\x00\x57\x41\x41\x41\x32\x32\x10\x00\x66\x5a\x55\x5f\x46\x5a\x46\x10\x00\xc1\x19"
+    "\x14\x0f\x69\x37\x5a\x3f\x1c\x00\x27\x00\x62\x40\x00\x56\x23\x1e\x78\x46\x69\x10\x00\x66\x37\x32\x2d\x87\x55\x78\x10\x00\xc1\x46"
+    "\x50\x32\x23\x23\x23\x3f\x3e\x00\x63\x00\x50\xc0\x00\x56\x64\x46\x32\x3c\x2d\x10\x00\x66\x5a\x82\x50\x41\x55\x37\x10\x00\x52\x32"
+    "\x4b\x23\x46\x1e\x90\x01\x11\x52\x90\x00\x56\x5a\x32\x55\x2d\x37\x10\x00\x66\x50\x69\x41\x64\x3c\x46\x10\x00\xa2\x28\x28\x23\x32"
+    "\x64\x46\x7f\x1d\x00\x40\xf0\x03\x66\x50\x46\x41\x50\x78\x64\x10\x00\xc1\x28\x50\x64\x1e\x1e\x14\x7f\x45\x00\x05\x00\x08\xa0\x00"
+    "\x56\x5f\x73\x2d\x2d\x23\x10\x00\x66\x50\x6e\x82\x37\x41\x2d\x10\x00\xc1\x32\x55\x37\x41\x41\x5a\x7f\x32\x00\x12\x00\x31\x80\x00"
+    "\x56\x64\x46\x50\x50\x69\x10\x00\xc0\x5a\x41\x41\x28\x28\x0f\x7f\x0c\x00\x14\x00\x90\x10\x00\x66\x5f\x4b\x6e\x64\x50\x1e\x10\x00"
+    "\xc1\x19\x23\x46\x5f\x37\x2d\xff\x2a\x00\x05\x00\x94\x50\x00\x56\x3c\x5f\x78\x46\x46\x10\x00\xa2\x34\x41\x37\x3a\x3e\x3c\x7f\x33"
+    "\x00\x27\xa0\x01\xc0\x23\x55\x2d\x23\x23\x4b\x7f\x32\x00\x30\x00\x4d\x10\x00\x66\x3c\x6e\x46\x3c\x3c\x64\x10\x00\xc1\x41\x2d\x37"
+    "\x2d\x46\x2d\x7f\x2f\x00\x5d\x00\x73\x80\x00\x56\x46\x50\x46\x5f\x46\x10\x00\xc0\x50\x50\x32\x28\x32\x19\x7f\x01\x00\x3c\x00\x8f"
+    "\x10\x00\x66\x69\x69\x4b\x41\x64\x32\x10\x00\xc1\x1e\x41\x64\x2d\x19\x28\x7f\x4b\x00\x5c\x00\x8e\x90\x00\x56\x5f\xb4\x55\x2d\x46"
+    "\x10\x00\x90\x1e\x23\x1e\x64\x23\x50\x7f\x1a\x00\x02\x00\x01\x20\x03\x46\x2d\x73\x37\x5f\x10\x00\x66\x3c\x41\x3c\x82\x4b\x6e\x10"
+    "\x00\x61\x23\x2d\xa0\x1e\x2d\x46\x30\x01\x11\x85\x20\x00\xb0\x30\x2d\x2b\x5a\x2a\x7f\x0f\x00\x6c\x00\x27\x10\x00\x66\x55\x49\x46"
+    "\x49\x73\x43\x10\x00\xa2\x1e\x69\x5a\x19\x19\x32\x7f\x34\x00\x4b\x00\x04\x66\x37\x82\x73\x32\x32\x4b\x10\x00\xc1\x28\x1e\x32\x37"
+    "\x37\x64\xff\x2b\x00\x09\x00\x6a\x50\x00\x57\x32\x46\x50\x50\x8c\x10\x00\x42\x28\x50\x3c\x2d\x10\x02\x11\x8b\x70\x01\x42\x5f\x55"
+    "\x7d\x41\x10\x02\x01\x10\x00\x50\x32\x32\x5f\x28\x32\xd0\x01\x31\x1f\x00\x04\x30\x00\x40\x50\x6e\x32\x50\xd0\x01\x03\x10\x00\xc1"
+    "\x32\x78\x35\x23\x6e\x57\x00\x07\x00\x78\x00\x54\x10\x00\x92\x69\x4f\x23\x6e\x4c\x00\x33\x00\x59\xa0\x00\xc1\x5a\x37\x4b\x3c\x4b"
+    "\x1e\x7f\x14\x00\x0c\x00\x0d\x90\x00\x56\x41\x5f\x3c\x2d\x23\xf0\x00\x66\x41\x5a\x78\x55\x46\x3c\x10\x00\xc1\x50\x55\x5f\x1e\x1e"
+    "\x19\x7f\x1f\x00\x45\x00\x78\x70\x01\x56\x82\x78\x2d\x2d\x28\x10\x00\xc1\xfa\x05\x05\x23\x69\x32\xfe\x1e\x00\x20\x00\x83\x40\x00"
+    "\x92\x37\x73\x64\x28\x3c\x7f\x22\x00\x66\x20\x02\xa3\x69\x5f\x50\x28\x50\x5a\xfe\x30\x00\x71\x20\x01\x92\x28\x46\x46\x19\x3c\x7f"
+    "\x21\x00\x61\x50\x04\x84\x37\x41\x5f\x5f\x2d\x55\x7f\x26\x10\x00\xa2\x2d\x43\x3c\x23\x32\x3f\x7f\x21\x00\x29\xc0\x05\x66\x50\x5c"
+    "\x41\x41\x50\x44\x10\x00\xa2\x1e\x2d\x37\x46\x37\x55\xff\x23\x00\x1e\x60\x02\x66\x3c\x4b\x55\x64\x55\x73\x10\x00\xc0\x28\x2d\x41"
+    "\x64\x78\x5a\x7f\x2b\x00\x6f\x00\x65\x10\x00\xa2\x46\x6e\x50\x37\x50\x69\x7f\x44\x00\x65\x70\x03\xc1\x41\x32\x23\x73\x5f\x5f\xfe"
+    "\x0c\x00\x6c\x00\x57\x10\x00\x60\x53\x39\x5f\x55\x69\x3f\x30\x06\x11\x48\x10\x00\x93\x5f\x39\x64\x55\x5d\x3f\x31\x00\x31\x10\x00"
+    "\xb0\x7d\x64\x37\x46\x55\x7f\x34\x00\x68\x00\x99\x10\x00\xa2\x4b\x64\x5f\x28\x46\x6e\x00\x16\x00\x53\xd0\x01\xc1\x14\x0a\x37\x0f"
+    "\x14\x50\x7f\x21\x00\x21\x00\x9b\xb0\x01\x92\x7d\x4f\x3c\x64\x51\x7f\x16\x00\x16\x30\x00\xc0\x82\x55\x50\x55\x5f\x3c\x7f\x0b\x00"
+    "\x4b\x00\x5d\x10\x00\x11\x30\x01\x00\x61\xff\x07\x00\x07\x00\x96\x00\x01\xb1\x37\x32\x2d\x41\x37\x1f\x32\x00\x5b\x00\x6b\x30\x00"
+    "\x92\x41\x3c\x6e\x5f\x41\x1f\x0b\x00\x0b\x30\x00\x10\x41\x10\x00\x71\x82\x1f\x0a\x00\x0a\x00\x5f\x10\x00\x60\x82\x3c\x5f\x6e\x41"
+    "\x1f\x20\x06\x11\x3e\x10\x00\x10\x3c\xd0\x05\x42\xff\x24\x00\x58\x00\x01\xa2\x23\x28\x64\x5a\x37\x23\x1f\x21\x00\x4b\xb0\x02\x66"
+    "\x46\x3c\x7d\x73\x46\x37\x10\x00\x50\x1e\x50\x5a\x37\x2d\x10\x00\x13\x04\xd0\x02\x56\x73\x69\x41\x46\x50\x10\x00\xa2\x50\x69\x41"
+    "\x3c\x4b\x82\x1f\x45\x00\x2e\x90\x05\xa2\xa0\x6e\x41\x41\x6e\x1e\x1f\x11\x00\x2f\x80\x04\xc1\x5a\x55\x64\x5f\x7d\x55\xff\x2e\x00"
+    "\x2e\x00\x51\x10\x00\x51\x5a\x55\x7d\x5a\x64\x10\x00\x01\xa0\x01\x61\x5a\x64\x5a\x7d\x55\x5a\x10\x00\x01\x40\x04\x61\x29\x40\x2d"
+    "\x32\x32\x32\x50\x08\x10\x3f\x10\x00\x66\x3d\x54\x41\x46\x46\x46\x10\x00\x61\x5b\x86\x5f\x64\x64\x50\xb0\x06\x10\x88\x10\x00\x61"
+    "\x6a\x6e\x5a\x9a\x5a\x82\x40\x00\x01\x80\x00\x11\x64\x01\x00\x30\xff\x1c\x00\x02\x00\x00\x20\x02\x33\x31\x41\x31\x70\x09\x11\x66"
+    "\xc0\x00\x33\x3e\x50\x3f\x70\x09\x01\x10\x00\x43\x50\x52\x64\x53\x70\x09\x01\x10\x00\x07\x70\x09\x10\x12\x10\x00\x07\x70\x09\x01"
+    "\x10\x00\x07\x70\x09\x01\x10\x00\x52\x32\x41\x40\x2c\x30\x70\x09\x01\xe0\x01\x52\x41\x50\x50\x3b\x3f\x70\x09\x01\x10\x00\x52\x55"
+    "\x69\x64\x4f\x53\x70\x09\x01\x10\x00\xa2\x23\x2e\x22\x23\x2d\x14\x7f\x32\x00\x33\x90\x07\x50\x55\x4c\x40\x2d\x37\x50\x05\x03\x10"
+    "\x00\xa2\x3c\x1e\x1e\x24\x38\x32\x7f\x0f\x00\x33\x70\x09\x66\x64\x32\x32\x4c\x60\x46\x10\x00\xa2\x28\x14\x1e\x28\x50\x37\x7f\x44"
+    "\x00\x30\x40\x02\x61\x37\x23\x32\x37\x6e\x55\x10\x00\x11\x59\x20\x00\x92\x3c\x28\x28\x28\x1e\x7f\x44\x00\x0f\x10\x09\x66\x46\x5a"
+    "\x46\x3c\x3c\x28\x10\x00\x67\x55\x5a\x50\x46\x50\x82\x00\x08\xb0\x26\x26\x38\x38\x43\x7f\x0a\x00\x23\x00\x0b\x10\x00\x57\x7d\x3a"
+    "\x3a\x4c\x4c\x10\x00\x67\x14\x28\x0f\x23\x23\x3c\x20\x09\x56\x19\x1c\x2d\x37\x0f\xa0\x08\x50\x5a\x1e\x0f\x28\x14\x10\x00\x03\x70"
+    "\x08\xc1\x23\x14\x41\x28\x41\x14\x1f\x37\x00\x20\x00\x69\xa0\x00\x56\x28\x55\x50\x69\x28\x10\x00\xc1\x28\x32\x2d\x46\x2d\x46\x7f"
+    "\x1c\x00\x30\x00\x9c\x30\x01\x56\x4b\x46\x5f\x46\x5f\x10\x00\x61\x37\x28\x28\x41\x2d\x23\x70\x00\x11\x39\xc0\x00\x56\x37\x37\x50"
+    "\x3c\x2d\x10\x00\x66\x5a\x4b\x4b\x73\x5a\x37\x10\x00\x52\x4b\x50\x55\x5a\x64\x90\x08\x01\x50\x04\xc2\x46\x14\x32\x14\x32\x28\x7f"
+    "\x2f\x00\x25\x00\x9d\x40\x01\x46\x50\x32\x50\x32\x10\x00\xa2\x46\x64\x73\x1e\x41\x1e\x7f\x05\x00\x45\x40\x01\x52\x5a\x4b\x4b\x5a"
+    "\x64\xc0\x07\x11\x02\xc0\x00\x40\x23\x28\x23\x37\x50\x00\x12\x66\x20\x01\x66\x37\x2d\x32\x2d\x41\x50\x10\x00\x10\x4b\x4f\x04\x17"
+    "\x6e\x20\x00\xb0\x46\x37\x28\x37\x55\x7f\x32\x00\x35\x00\x5c\x10\x00\x11\x1e\x01\x00\x61\x7f\x22\x00\x5e\x00\x30\x30\x00\x47\x4b"
+    "\x37\x69\x55\x10\x00\xa2\x41\x41\x2d\x4b\x2d\x5f\x7f\x03\x00\x0e\xf0\x01\xa2\x37\x2d\x2d\x19\x19\x0f\x7f\x06\x00\x0b\xe0\x09\x66"
+    "\x5f\x55\x55\x41\x41\x23\x10\x00\x70\x41\x41\x3c\x82\x5f\x6e\x1f\xce\x02\x01\x20\x01\x61\x5f\x41\x6e\x3c\x82\x41\x10\x00\x01\x20"
+    "\x05\xc1\x3c\x55\x2a\x55\x2a\x5b\x7f\x0f\x00\x69\x00\x9e\x20\x00\x47\x4b\x50\x64\x6e\x70\x07\x66\x3c\x3c\x3c\x55\x55\x55\xa0\x05"
+    "\x72\x30\x48\x30\x48\x30\x30\xff\x10\x00\xf1\x00\x1c\x00\x00\xbe\x21\x3a\x21\x3a\x21\x7f\x17\x00\x17\x00\x8c\x20\x01\x92\x50\x41"
+    "\x5a\x41\x55\x7f\x27\x00\x30\x30\x01\xa2\x32\x41\x5a\x23\x23\x0f\x7f\x05\x00\x05\x10\x07\x30\x4b\x5a\x8c\x50\x02\x05\x10\x00\xa2"
+    "\x64\x46\x46\x41\x41\x2d\x7f\x20\x00\x32\x50\x01\x50\x41\x4b\x69\x23\x41\x00\x05\x31\x08\x00\x11\x30\x00\x51\x55\xc8\x37\x41\x1e"
+    "\x10\x07\x01\x00\x03\x84\x3c\x50\x32\x28\x28\x1e\xbf\x16\x30\x00\xa3\x5a\x78\x4b\x3c\x3c\x2d\xbf\x16\x00\x5f\x40\x00\x40\x5f\x4b"
+    "\x37\x37\xe0\x05\x31\x21\x00\x16\x90\x00\x51\x82\x64\x37\x50\x41\x90\x05\x10\x87\x10\x00\xc0\x14\x0a\xe6\x0a\xe6\x05\x7f\x05\x00"
+    "\x52\x00\x7e\x10\x00\x50\x50\x7d\x4b\x28\x5f\x00\x03\x12\x3e\x40\x05\xc3\x37\x5f\x37\x23\x4b\x73\x7f\x27\x00\x33\x00\x7c\x70\x00"
+    "\x91\x32\x32\x28\x7f\x35\x00\x5f\x00\x76\x70\x00\x92\x82\x4b\x4b\x4b\x37\x7f\x3e\x00\x5f\x30\x04\xa2\x28\x28\x28\x46\x28\x14\x7f"
+    "\x28\x00\x31\xd0\x04\x68\x32\x32\x78\x50\x50\x1e\x10\x00\xa1\x28\x1e\x1e\x32\x7f\x0c\x00\x51\x00\x2f\xf0\x00\x47\x64\x50\x3c\x3c"
+    "\x10\x00\xa2\x37\x37\x55\x41\x55\x23\xbf\x37\x00\x1e\x70\x01\x20\x23\x41\x02\x00\x61\x7f\x37\x00\x61\x00\x8d\x00\x01\x74\x69\x4b"
+    "\x69\x4b\x2d\x7f\x15\x10\x00\xc1\x2d\x37\x2d\x41\x2d\x4b\x7f\x48\x00\x37\x00\x0f\xf0\x00\xb1\x28\x46\x50\x8c\x46\x7f\x21\x00\x0b"
+    "\x00\x29\x10\x00\x40\x50\x8c\x28\x46\xe0\x0c\x03\x40\x08\xa2\x2d\x3c\x1e\x50\x32\x41\x7f\x30\x00\x12\xb0\x00\x67\x4b\x5a\x32\x6e"
+    "\x50\x5f\x10\x00\x56\x5f\x5f\x5f\x5f\x55\x20\x07\x20\x5a\x3c\x01\x04\x42\x7f\x35\x00\x35\xb0\x09\x30\x5a\x78\x78\xb0\x00\x00\xb0"
+    "\x01\x01\x10\x00\x66\x55\x50\x5a\x69\x5f\x3c\x00\x06\xa2\x49\x5f\x3e\x55\x41\x55\x7f\x16\x00\x77\xf0\x01\xa2\x37\x14\x23\x14\x2d"
+    "\x4b\x7f\x14\x00\x65\xb0\x00\x11\x23\x01\x00\x42\x00\x3e\x00\x50\xe0\x06\x84\x32\x5f\x5f\x23\x6e\x46\x00\x16\x20\x07\x61\x2d\x1e"
+    "\x0f\x55\x41\x41\x20\x07\x01\x80\x06\x66\x2d\x3f\x25\x41\x37\x5f\x20\x07\x66\x2d\x4b\x25\x46\x37\x53\x20\x07\xa2\x5f\x50\x69\x28"
+    "\x46\x64\xfe\x2f\x00\x71\x70\x00\x66\xff\x0a\x0a\x4b\x87\x37\x10\x08\x61\x5a\x55\x4b\x73\x64\x73\xd0\x05\x10\x0a\x10\x00\x52\x73"
+    "\x73\x55\x5a\x4b\x30\x06\x01\x70\x05\x52\x64\x4b\x73\x5a\x73\x50\x06\x01\xa0\x04\xa2\x32\x40\x32\x2d\x32\x29\x7f\x3e\x00\x3e\xe0"
+    "\x00\x66\x46\x54\x46\x41\x46\x33\x90\x0e\xa2\x64\x86\x6e\x5f\x64\x3d\x7f\x2d\x00\x2d\x30\x01\x61\x6a\x5a\x82\x5a\x9a\x6e\x40\x00"
+    "\x02\x40\x06\x42\x82\x5a\x6e\x9a\x80\x06\x01\xc0\x01\x03\x40\x06\x20\x1e\x00\x02\x00\x02\x80\x0c\x31\x41\x37\x46\x20\x06\x02\x20"
+    "\x09\x56\x41\x2d\x55\x41\x5f\x10\x00\x66\x46\x55\x41\x69\x55\x78\x10\x00\x61\x2d\x3c\x28\x46\x32\x2d\x20\x06\x10\x03\x10\x00\x66"
+    "\x3c\x55\x3c\x55\x3c\x37\x10\x00\x52\x50\x78\x46\x6e\x46\x50\x06\x01\x10\x00\x20\x32\x46\xa0\x02\x01\x20\x06\x01\xc0\x01\x66\x46"
+    "\x55\x46\x3c\x46\x32\x10\x00\x66\x64\x6e\x5a\x55\x5a\x3c\x10\x00\x84\x23\x37\x23\x1e\x1e\x23\x7f\x32\x30\x03\x01\xe0\x05\x20\x46"
+    "\x7f\x40\x03\x01\x00\x03\xa2\x26\x1e\x29\x1e\x29\x3c\x7f\x35\x00\x52\x00\x08\x66\x4e\x46\x3d\x32\x3d\x64\x10\x00\x67\x2d\x2d\x23"
+    "\x14\x1e\x14\xf0\x0f\x20\x23\x37\x80\x04\x06\xf0\x0f\x40\x46\x32\x5a\x32\x70\x03\x3f\x44\x00\x4f\x20\x00\x02\x51\x32\x46\x32\x5a"
+    "\x41\x40\x00\x11\x0e\x20\x01\xb2\x1e\x1e\x28\x32\x1e\x7f\x21\x00\x2c\x00\x14\x20\x00\x46\x32\x3c\x46\x32\x10\x00\x30\x50\x46\x46"
+    "\x60\x05\x05\x10\x00\x32\x28\x28\x32\x20\x05\x12\x30\xa0\x03\x41\x46\x46\x28\x3c\x00\x0a\x03\x10\x00\x50\x5a\x64\x3c\x5a\x3c\x70"
+    "\x05\x03\x10\x00\x61\x28\x37\x1e\x1e\x1e\x55\xe0\x01\x13\x71\x50\x01\x36\x32\x32\x7d\x10\x00\x61\x28\x1e\x1e\x37\x1e\x55\x00\x10"
+    "\x01\xd0\x0c\x66\x3c\x32\x64\x55\x46\x41\x10\x00\xa2\x1c\x19\x19\x2d\x23\x28\x7f\x1c\x00\x24\xe0\x04\x66\x26\x23\x23\x41\x37\x32"
+    "\x10\x00\x66\x44\x41\x41\x7d\x73\x50\x10\x00\x61\x28\x1e\x20\x32\x34\x41\xa0\x09\x01\x40\x00\x61\x46\x3c\x3e\x50\x52\x3c\xa0\x09"
+    "\x02\x50\x10\x00\xaf\x00\x52\x23\x7f\x1b\x00\x5a\x50\x01\x30\x3c\x82\x50\x80\x01\x00\x10\x00\x01\x40\x0a\x90\x3c\x3c\x3c\x23\x23"
+    "\x1e\x7f\x36\x00\x02\x00\x01\x80\x0c\x70\x50\x37\x37\x5a\x7f\x48\x00\x02\x00\x96\x01\x00\x00\x96\xa0\x64\x5f\x41\x64\x20\x00\x61"
+    "\x1f\x2d\x5a\x1e\x1e\x28\x60\x11\x01\x90\x01\xa2\x3d\x5a\x2d\x32\x32\xa0\x7f\x03\x00\x03\x60\x06\x90\x01\x5a\x2d\x1e\x1e\x28\xff"
+    "\x19\x00\x02\x00\xd2\x01\x00\x00\x40\x33\x17\x33\x17\x1c\x7f\x2b\x00\x2b\x00\x02\x61\x54\x47\x2b\x47\x2b\x30\x10\x00\x01\x10\x01"
+    "\x66\x68\x5b\x3f\x5b\x3f\x44\x10\x00\xa2\x48\x3c\x1e\x14\x1e\x19\x3f\x2f\x00\x3e\x80\x05\x66\x90\x78\x3c\x28\x3c\x32\x10\x00\x75"
+    "\x32\x14\x28\x14\x28\x14\xbf\x20\x07\x50\x1e\x2d\x87\x2d\x5a\x20\x07\x12\x2a\x80\x0f\xa2\x32\x2d\x2d\x23\x23\x32\xbf\x38\x00\x60"
+    "\xb0\x0f\x66\x46\x41\x41\x37\x37\x46\x10\x00\xa2\x32\x4b\x4b\x41\x41\x32\x7f\x33\x00\x64\x80\x06\x50\x32\x55\x55\x37\x37\xd0\x0c"
+    "\x13\x16\x60\x00\x20\x46\x64\x90\x08\x00\x70\x07\x11\x86\x20\x01\x20\x5a\x8c\x90\x05\x05\x10\x00\x32\x46\x6e\xb4\xa0\x04\x03\x10"
+    "\x00\xa2\x1e\x28\x37\x28\x37\x3c\x7f\x4a\x00\x4a\x90\x01\x66\x3c\x3c\x4b\x3c\x4b\x50\x10\x00\x70\x28\x2d\x28\x41\x28\x41\x7f\x8e"
+    "\x08\x11\x3a\x40\x00\x56\x4b\x3c\x69\x3c\x69\x10\x00\x90\x3c\x32\x28\x55\x4b\x5f\x7f\x39\x00\x02\x00\x01\xb0\x01\x70\x32\x4b\x55"
+    "\x5f\x7f\x3a\x00\x02\x00\x00\x60\x05\x92\x49\x37\x2f\x4b\x55\x00\x23\x00\x44\xb0\x00\xa3\x41\x2f\x37\x49\x4b\x55\xfe\x0c\x00\x6e"
+    "\xc0\x00\x92\x3c\x2d\x64\x50\x41\x7f\x1e\x00\x26\x10\x0a\xa2\x46\x2b\x35\x2b\x35\x28\x7f\x40\x00\x3c\xd0\x0a\x66\x64\x49\x53\x49"
+    "\x53\x37\x10\x00\xa2\x2d\x5a\x14\x41\x14\x41\x7f\x18\x00\x18\xd0\x03\x66\x46\x78\x28\x5f\x28\x5f\x10\x00\xc0\x82\x46\x23\x46\x23"
+    "\x3c\x7f\x29\x00\x0c\x00\x2e\x10\x00\x57\xaa\x5a\x2d\x5a\x2d\x10\x00\x21\x3c\x3c\xf0\x08\x32\x0c\x00\x56\x20\x03\xc1\x46\x64\x46"
+    "\x69\x4b\x28\x7f\x28\x00\x74\x00\x53\x10\x00\xb1\x55\x8c\x55\x46\x14\x7f\x49\x00\x49\x00\x4b\x30\x00\x93\x19\x23\x46\x50\x3c\x7f"
+    "\x2f\x00\x14\xf0\x0f\x56\x2d\x41\x5a\x6e\x50\x10\x00\x11\x3c\x01\x00\x42\x7f\x14\x00\x4d\x20\x07\xa4\x2d\x64\x2d\x2d\x2d\x0a\x7f"
+    "\x34\x00\x47\x90\x01\x47\x32\x32\x32\x46\xb0\x0d\x56\x64\x50\x50\x50\x64\x10\x00\x61\x32\x55\x28\x55\x28\x23\xf0\x12\x01\x60\x05"
+    "\x66\x46\x73\x3c\x73\x3c\x37\x10\x00\x70\x2d\x28\x3c\x28\x4b\x32\x7f\x1e\x05\x01\x10\x0e\x66\x4b\x46\x5a\x46\x69\x50\x10\x00\xc1"
+    "\x49\x73\x3c\x3c\x3c\x5a\x7f\x11\x00\x11\x00\x89\x10\x00\x51\x64\x3c\x64\x3c\x41\x40\x04\x01\xd0\x02\x63\x46\x37\x41\x5f\x55\x46"
+    "\x80\x08\x00\x10\x00\x47\x5f\x55\x37\x41\x10\x00\xa2\x32\x30\x2b\x2e\x29\x3c\x7f\x0c\x00\x6b\x50\x06\x57\x6e\x4e\x49\x4c\x47\x10"
+    "\x00\x61\x2b\x50\x41\x32\x23\x23\x20\x0f\x10\x5b\x10\x00\x66\x3f\x78\x55\x5a\x37\x37\x10\x00\x66\x28\x28\x37\x28\x46\x37\x50\x00"
+    "\x66\x3c\x46\x69\x46\x78\x4b\x10\x00\xc0\x42\x29\x4d\x3d\x57\x17\x1f\x15\x00\x15\x00\x72\x10\x00\x66\x56\x51\x61\x51\x6b\x2b\x10"
+    "\x00\xa2\x2d\x5f\x32\x28\x32\x4b\x1f\x04\x00\x04\xd0\x11\x66\x4b\x7d\x64\x46\x50\x2d\x10\x00\x52\x14\x0f\x14\x0a\x37\xc0\x0d\x01"
+    "\x70\x00\xc1\x5f\x3c\x4f\x64\x7d\x51\x7f\x3f\x00\x3f\x00\x38\xd0\x00\x01\x01\x00\x30\x7f\x3b\x00\x02\x00\xc0\x04\xb9\x02\x3c\x5a"
+    "\x46\x3c\x78\x28\x7f\x10\x00\x02\x00\x00\xa0\x15\xb0\x4b\x23\x3f\x21\x2d\x7f\x0f\x00\x77\x00\x82\x10\x00\x66\x40\x73\x41\x53\x3f"
+    "\x41\x10\x00\x66\x14\x28\x5a\x1e\x5a\x19\x90\x01\x70\x28\x46\x82\x3c\x82\x19\x7f\xa0\x06\x01\x30\x02\x61\x63\x44\x53\x48\x57\x33"
+    "\x50\x0a\x01\xe0\x0f\x67\x41\x32\x46\x5f\x50\x41\x90\x0f\x10\x82\x31\x03\x42\x7f\x2e\x00\x69\xc0\x12\x66\x5f\x17\x30\x17\x30\x17"
+    "\xe0\x09\x11\x32\x01\x00\x42\x7f\x27\x00\x73\xe0\x07\x11\x50\x01\x00\x06\x10\x00\xc0\x46\x28\x32\x37\x32\x19\x7f\x2f\x00\x73\x00"
+    "\x0c\x10\x00\x41\x5a\x3c\x46\x4b\x60\x11\x03\x10\x00\x66\x6e\x50\x5a\x5f\x5a\x41\x10\x00\xa3\x23\x40\x55\x4a\x37\x20\x7f\x4b\x00"
+    "\x4b\x90\x0c\x51\x68\x69\x5e\x4b\x34\x20\x01\x01\xd0\x08\x43\x37\x54\x69\x72\x10\x00\x01\xc0\x01\x30\x64\x5a\x82\xc0\x0e\x20\x21"
+    "\x00\x12\x0a\x00\xd0\x01\x65\x1e\x37\x28\x41\x61\xbf\x20\x00\xa3\x2d\x4b\x3c\x28\x1e\x32\x7f\x45\x00\x45\x50\x0d\x42\x5f\x64\x3c"
+    "\x32\x10\x00\x01\x70\x0a\x66\x5f\x87\x50\x6e\x50\x64\x30\x0f\xa2\x28\x37\x50\x23\x3c\x1e\xff\x1d\x00\x1d\x20\x0a\x66\x3c\x4b\x64"
+    "\x37\x50\x32\x10\x00\x67\x50\x87\x82\x5f\x5a\x46\x10\x00\x42\x64\xc8\x32\x64\x20\x00\x01\x80\x00\x52\x50\x32\x64\x64\xc8\x10\x00"
+    "\x02\x30\x12\x48\x4b\x96\x4b\x96\x40\x00\x66\x50\x5a\x6e\x82\x6e\xfe\x30\x03\x51\x5a\x50\x82\x6e\x6e\x0e\x00\x01\x10\x00\x90\x64"
+    "\x64\x5a\x96\x8c\x5a\xff\x02\x00\x02\x00\x00\x10\x00\x80\x96\x8c\x64\x5a\x5a\xff\x46\x00\x02\x00\x00\xd0\x10\x80\x96\x5a\x96\x5a"
+    "\x5f\xff\x4c\x00\x02\x00\x06\x60\x08\x20\x20\x00\x02\x00\x00\x90\x01\x10\x96\x02\x00\x01\x80\x08\xb1\x2e\x00\x04\xad\x02\x37\x44"
+    "\x40\x2d\x37\x1f\x50\x08\x01\xf0\x03\x66\x4b\x59\x55\x37\x41\x24\x10\x00\x66\x5f\x6d\x69\x4b\x55\x38\x10\x00\x61\x2c\x3a\x2c\x3a"
+    "\x2c\x3d\x50\x08\x01\x00\x0e\x66\x40\x4e\x34\x4e\x34\x51\x10\x00\x66\x4c\x68\x47\x68\x47\x6c\x10\x00\x52\x35\x33\x35\x3d\x38\x70"
+    "\x08\x01\x60\x13\x52\x40\x42\x44\x51\x4c\x70\x08\x01\x10\x00\x52\x54\x56\x58\x6f\x65\x70\x08\x01\x10\x00\x01\x80\x07\x00\x90\x13"
+    "\x00\x02\x00\x00\xd0\x01\x40\x4b\x32\x28\x28\x50\x17\x12\x16\xd0\x11\x52\x55\x78\x46\x32\x32\x90\x01\x01\x10\x00\xa2\x3b\x2d\x28"
+    "\x23\x28\x1f\x7f\x56\x00\x6d\x50\x02\x66\x4f\x55\x3c\x37\x3c\x47\x10\x00\x61\x25\x19\x29\x19\x29\x19\x10\x04\x01\xf0\x06\x52\x4d"
+    "\x55\x33\x37\x33\x70\x08\x01\x40\x07\xa2\x2d\x41\x22\x28\x22\x2d\x7f\x4f\x00\x16\xb0\x10\x66\x3c\x55\x31\x3c\x31\x3c\x10\x00\x66"
+    "\x50\x78\x4f\x5f\x4f\x46\x10\x00\x66\x28\x1e\x23\x32\x46\x37\xb0\x05\x61\x3c\x46\x37\x7d\x69\x5a\x10\x00\x01\x50\x00\xa2\x43\x7d"
+    "\x28\x1e\x1e\x3a\x1f\x68\x00\x68\x50\x02\x57\x61\xa5\x3c\x41\x32\x10\x00\x70\x1e\x2a\x76\x2a\x58\x1e\x1f\x20\x0b\x11\x2b\x40\x00"
+    "\x47\x34\xa8\x2f\x8a\x10\x00\x61\x28\x1d\x2d\x1d\x2d\x24\xb0\x00\xf0\x00\x8e\x00\x03\x00\x00\x3c\x3b\x55\x4f\x69\x24\xfe\x6b\x00"
+    "\x6b\x10\x00\x90\xb0\x02\x46\x5e\x32\x5e\x32\x42\x00\xc0\x00\x01\xa0\x0f\xa3\x1e\x1e\x2a\x1e\x2a\x46\x1f\x76\x00\x76\x20\x18\x65"
+    "\x50\x66\x50\x66\x28\xfe\xa0\x10\x61\x3c\x2d\x46\x2d\x5a\x5f\x30\x0e\x01\xe0\x0a\x50\x37\x41\x23\x3c\x1e\xc0\x0b\x03\x30\x03\x66"
+    "\x55\x69\x37\x55\x32\x73\x10\x00\x61\x2d\x23\x2d\x3e\x35\x23\xe0\x0e\x01\x10\x1a\x90\x46\x3c\x46\x57\x4e\x55\x7f\x7a\x00\x02\x00"
+    "\xf0\x00\x02\x00\x00\x4c\x30\x30\x39\x3e\x22\x7f\x3c\x00\x72\x00\x9f\x10\x00\x66\x6f\x53\x44\x5c\x52\x27\x10\x00\x84\x4b\x64\x42"
+    "\x3c\x42\x73\x7f\x65\xa0\x0e\xc0\x5a\x32\x22\x3c\x2c\x46\x7f\x6a\x00\x54\x00\x8a\x10\x00\x66\x96\x50\x2c\x5a\x36\x50\x10\x00\x50"
+    "\x37\x42\x2c\x2c\x38\xd0\x0e\x30\x67\x00\x07\x10\x00\x84\x41\x4c\x54\x36\x60\x69\x7f\x38\x10\x00\x66\x3c\x3c\x3c\x69\x69\x69\x70"
+    "\x04\x61\x64\x7d\x34\x69\x34\x47\x80\x0e\x01\x90\x03\xa2\x31\x37\x2a\x2a\x25\x55\xbf\x07\x00\x14\x30\x02\x70\x47\x52\x40\x40\x3b"
+    "\x70\xbf\xa0\x06\x01\x50\x02\x66\x2d\x1e\x32\x41\x32\x2d\x40\x00\xa2\x3f\x3f\x2f\x29\x29\x4a\x7f\x01\x00\x6a\x30\x00\x66\x67\x5d"
+    "\x43\x47\x3d\x54\x10\x00\xa2\x39\x18\x56\x18\x56\x17\xff\x1a\x00\x55\x20\x08\x66\x43\x59\x74\x4f\x74\x21\x10\x00\x66\x32\x50\x5f"
+    "\x0a\x2d\x0a\xd0\x0f\x66\x14\x19\x2d\x46\x5a\x3c\xd0\x13\x61\x64\x05\x05\x0f\x41\x1e\x60\x0c\x01\xa0\x10\x57\x4c\x41\x2d\x5c\x2a"
+    "\x70\x1a\x61\x32\x5c\x6c\x5c\x6c\x23\x60\x05\x01\xa0\x06\x61\x3a\x46\x2d\x28\x2d\x2a\xf0\x06\x10\x18\x10\x00\x66\x44\x5a\x41\x32"
+    "\x37\x52\x10\x00\x66\x6c\x82\x5f\x50\x55\x66\x10\x00\x84\x87\x55\x28\x28\x55\x05\x1f\x35\xf0\x12\xa2\x28\x46\x28\x23\x28\x3c\x1f"
+    "\x50\x00\x27\x50\x08\x61\x46\x6e\x46\x73\x46\x5a\x10\x00\x01\x90\x05\x61\x44\x48\x4e\x26\x2a\x20\x90\x0c\x01\x60\x09\x66\x6c\x70"
+    "\x76\x44\x48\x2f\x10\x00\xa2\x28\x32\x5a\x1e\x37\x41\x7f\x04\x00\x61\x00\x01\x66\x46\x5a\x6e\x3c\x4b\x5f\x10\x00\xa2\x30\x3d\x28"
+    "\x3d\x28\x32\x7f\x6b\x00\x57\xc0\x16\x66\x53\x6a\x41\x56\x41\x55\x10\x00\x66\x4a\x64\x48\x5a\x48\x2e\x60\x01\xa2\x31\x31\x38\x31"
+    "\x3d\x42\x7f\x21\x00\x72\x50\x02\x66\x45\x45\x4c\x45\x56\x5b\x10\x00\x50\x2d\x14\x32\x3c\x78\xb0\x0b\x03\x80\x0e\xa2\x3c\x3e\x32"
+    "\x3e\x3c\x28\x7f\x75\x00\x75\x00\x03\x66\x5a\x5c\x4b\x5c\x55\x3c\x10\x00\x61\x46\x78\x41\x2d\x55\x7d\x30\x01\x03\xc0\x0b\x46\x73"
+    "\x82\x5a\x3c\xc0\x17\x66\x6e\x55\x5f\x50\x5f\x32\x30\x16\x50\x73\x8c\x82\x37\x37\x00\x16\x12\x74\x20\x04\x52\x64\x64\x7d\x6e\x32"
+    "\x60\x11\x01\x70\x0d\xa2\x4b\x7b\x43\x5f\x55\x5f\x3f\x4e\x00\x4e\x20\x0b\x57\x4b\x5f\x43\x7d\x5f\x30\x0e\x66\x55\x32\x5f\x78\x73"
+    "\x50\x40\x12\x50\x56\x4c\x56\x74\x38\x40\x11\x12\x6e\x40\x11\xa2\x41\x6e\x82\x3c\x41\x5f\x1f\x66\x00\x66\x20\x03\xa2\x41\x3c\x6e"
+    "\x82\x5f\x41\x1f\x51\x00\x51\xd0\x05\x61\x4b\x5f\x7d\x2d\x4b\x5f\x90\x10\x11\x5a\xa0\x00\x56\x82\x50\x46\x3c\x50\xc0\x0f\x84\x55"
+    "\x50\x46\x87\x4b\x5a\xff\x5b\x10\x0f\x70\x44\x7d\x41\x41\x73\x50\x00\x02\x00\x01\xb0\x01\x50\x3c\x37\x91\x4b\x96\xb0\x0a\x03\x10"
+    "\x0b\x66\x2d\x64\x87\x41\x87\x2d\x90\x07\x70\x46\x50\x46\x50\x46\x6e\xfe\x70\x00\x01\xc0\x07\x63\x32\x32\x4d\x5f\x4d\x5b\x70\x08"
+    "\x96\x06\xb4\x02\x4b\x4b\x82\x4b\x82\x5f\x80\x08\x66\x50\x69\x69\x69\x69\x50\x10\x00\x66\x4b\x7d\x46\x7d\x46\x73\x10\x00\x52\x64"
+    "\x78\x78\x96\x64\x90\x0e\x01\xb0\x07\x52\x5a\x78\x64\x96\x78\x00\x0f\x01\x10\x00\x70\x5b\x5a\x6a\x82\x6a\x4d\x7f\xd0\x15\x01\x30"
+    "\x15\x90\x6e\xa0\x6e\x50\x6e\x64\xff\x70\x00\x02\x00\x00\xd0\x03\x44\x64\x78\x64\x78\x40\x00\x97\x02\xb3\x02\x78\x46\x78\x4b\x82"
+    "\x55\xc0\x06\x01\x01\x00\x30\xff\x5d\x00\x02\x00\x06\x90\x06\x05\x10\x00\x90\x46\x5a\x5a\x87\x5a\x7d\xff\x7b\x00\x02\x00\x0c\x10"
+    "\x0f\x41\x02\xb2\x02\x78\x01\x00\x30\xff\x79\x00\x02\x00\x15\x11\x20\x00\x20\xa2\x00\x02\x00\x01\x60\x0e\x41\x37\x2d\x37\x3f\xa0"
+    "\x06\x01\x80\x0a\x01\xc0\x0b\x16\x53\x10\x00\x66\x4b\x4b\x5f\x4b\x5f\x71\x10\x00\x52\x41\x3f\x2d\x2d\x2d\x30\x0f\x01\x90\x01\x52"
+    "\x5a\x5d\x37\x46\x37\x30\x0f\x01\x10\x00\x52\x6e\x7b\x41\x64\x41\x90\x15\x01\x40\x02\x61\x37\x37\x2d\x3f\x2d\x2d\xa0\x06\x02\x20"
+    "\x07\x42\x4b\x3c\x53\x3c\xb0\x06\x02\x20\x07\x56\x64\x55\x6c\x46\x46\x10\x00\x61\x2d\x37\x27\x23\x27\x2a\x60\x15\x02\x00\x18\x74"
+    "\x55\x45\x3c\x45\x4d\x7f\x23\x10\x00\xa2\x2d\x3c\x2d\x19\x2d\x37\x7f\x48\x00\x35\x90\x06\x50\x41\x50\x41\x23\x41\xf0\x0d\x12\x92"
+    "\x40\x0d\x50\x55\x64\x5a\x2d\x5a\xf0\x06\x03\x10\x00\xa2\x29\x32\x25\x32\x25\x42\x7f\x07\x00\x54\xe0\x03\x66\x40\x58\x32\x58\x32"
+    "\x6a\x10\x00\xc1\x32\x35\x30\x35\x30\x40\x1f\x52\x00\x52\x00\x41\xa0\x00\x56\x62\x3f\x62\x3f\x65\x10\x00\x07\x20\x00\x1b\x42\x20"
+    "\x00\x01\x10\x00\x07\x20\x00\x1b\x43\x20\x00\x01\x10\x00\xa2\x4c\x19\x2d\x43\x37\x18\x7f\x6c\x00\x1c\x10\x02\x66\x74\x37\x55\x6b"
+    "\x5f\x1d\x10\x00\xa2\x32\x37\x32\x24\x1e\x2b\x7f\x91\x00\x69\xc0\x0f\x66\x3e\x4d\x3e\x32\x2a\x41\x10\x00\x66\x50\x69\x50\x41\x37"
+    "\x5d\x10\x00\xa2\x2d\x3c\x20\x32\x20\x4c\x7f\x1f\x00\x4e\x00\x0e\x66\x4b\x64\x3f\x50\x3f\x74\x10\x00\x30\x37\x4b\x55\x00\x10\x00"
+    "\x10\x07\x01\x00\x03\x66\x46\x69\x69\x32\x28\x14\x10\x00\x66\x55\x87\x82\x3c\x46\x19\x10\x00\xc0\x37\x2d\x2b\x37\x2b\x48\x7f\x6d"
+    "\x00\x67\x00\x56\x10\x00\x66\x43\x39\x37\x4d\x37\x72\x10\x00\xc1\x3c\x55\x28\x1e\x2d\x44\x7f\x92\x00\x9f\x00\x68\xe0\x01\x56\x87"
+    "\x3c\x32\x41\x58\x10\x00\xc1\x67\x3c\x56\x3c\x56\x32\x7f\x83\x00\x90\x00\x67\x90\x00\x31\x50\x37\x19\x20\x1d\x12\x7d\xc0\x08\x66"
+    "\x55\x69\x55\x28\x32\x28\x10\x00\x50\x69\x8c\x5f\x37\x41\x30\x1d\x03\x10\x00\x70\x32\x32\x28\x32\x28\x40\x7f\x4e\x0a\x01\xb0\x0c"
+    "\x66\x4b\x41\x37\x41\x37\x45\x10\x00\xa2\x69\x55\x4b\x55\x4b\x4a\x7f\x21\x00\x8f\x10\x00\xa2\x78\x64\x55\x1e\x55\x2d\x00\x3e\x00"
+    "\x27\x80\x00\x84\x4b\x7d\x4b\x1e\x4b\x55\x00\x05\x10\x00\xa2\x2d\x35\x46\x28\x3c\x2a\x7f\x44\x00\x22\x80\x0a\x70\x37\x3f\x5a\x32"
+    "\x50\x2a\x7f\x6e\x04\x02\x10\x15\x56\x67\x50\x46\x46\x5c\x20\x00\xa2\x1e\x2d\x3b\x1e\x27\x39\x7f\x26\x00\x44\x20\x10\x66\x28\x37"
+    "\x63\x28\x4f\x2f\x10\x00\x67\x3c\x5a\x59\x37\x45\x70\x20\x00\x93\x1b\x3c\x25\x32\x42\x7f\x9e\x00\x97\x10\x22\x56\x43\x55\x4d\x4b"
+    "\x74\x10\x00\xa3\x2d\x23\x32\x46\x32\x1e\xfe\x22\x00\x14\x90\x0e\x57\x3c\x4b\x6e\x4b\x5a\x10\x00\xf0\x07\x5c\x41\x50\x37\x62\x7f"
+    "\x78\x00\x5b\x00\x68\x00\x02\xbc\x02\x32\x48\x23\x23\x23\x41\x7f\x1e\x0b\x01\x40\x0e\x66\x3c\x52\x2d\x2d\x2d\x4a\x10\x00\x66\x5f"
+    "\x75\x46\x41\x46\x5c\x10\x00\xa2\x46\x5a\x2d\x0f\x2d\x32\x7f\x37\x00\x37\x50\x16\xf0\x06\x69\x8c\x37\x1e\x37\x5f\x7f\x7d\x00\x7d"
+    "\x00\xa1\x00\x02\xbd\x02\x4b\x56\x43\x6a\x43\x90\x1a\x12\x22\x20\x0d\x85\x32\x41\x55\x23\x23\x37\x7f\x05\x30\x1a\x56\x5f\x7d\x41"
+    "\x4b\x2d\x10\x00\xa2\x32\x4b\x46\x23\x46\x30\x7f\x3d\x00\x99\xc0\x15\x66\x41\x5a\x73\x2d\x73\x3a\x10\x00\xa2\x48\x3a\x50\x67\x50"
+    "\x61\x7f\x93\x00\x62\x30\x09\x30\x26\x1e\x55\x20\x16\x20\x98\x00\x02\x00\x00\x80\x07\x47\x32\x91\x5f\x69\x10\x00\xa2\x36\x4e\x67"
+    "\x35\x2d\x16\x1f\x74\x00\x05\x80\x0d\x66\x4a\x6c\x85\x53\x41\x20\x10\x00\x90\x37\x70\x2d\x4a\x2d\x46\x1f\x81\x00\x02\x00\x00\x90"
+    "\x01\x56\x8c\x41\x70\x41\x6e\x10\x00\x61\x32\x32\x3e\x28\x3e\x41\xf0\x1d\x01\x30\x1d\xa2\x50\x5f\x52\x3c\x52\x4b\x7f\x01\x00\x85"
+    "\x10\x00\x90\x28\x41\x28\x50\x28\x41\x1f\x95\x00\x02\x00\x00\x30\x01\x56\x69\x3c\x78\x3c\x69\x10\x00\x10\x37\x00\x20\x52\x4b\xbf"
+    "\x38\x00\x65\x40\x09\x66\x4b\x5f\x3c\x41\x3c\x73\x10\x00\xc1\x2d\x1e\x32\x37\x41\x2d\xbf\x77\x00\x77\x00\x17\x40\x00\x56\x2d\x46"
+    "\x4b\x55\x37\x10\x00\x66\x46\x37\x5f\x5f\x6e\x41\x10\x00\xa2\x2d\x1e\x28\x69\x32\x14\x7f\x8e\x00\x62\x00\x07\x66\x41\x28\x32\x7d"
+    "\x3c\x1e\x10\x00\x57\x6e\x41\x4b\x7d\x55\x10\x00\xa2\x3e\x2c\x32\x2c\x32\x37\x7f\x33\x00\x91\xa0\x05\x66\x4b\x57\x3f\x57\x3f\x62"
+    "\x10\x00\xa2\x24\x32\x32\x41\x3c\x2c\x7f\x73\x00\x73\x80\x01\x66\x33\x41\x41\x50\x4b\x3b\x10\x00\x66\x47\x5f\x55\x6e\x5f\x4f\x10"
+    "\x00\x20\x3c\x3c\xe0\x0e\x81\x7f\x22\x00\x9d\x00\x20\x00\x04\x70\x20\x00\x10\x21\x05\x10\x00\x00\xef\x1d\x21\x3c\x67\x60\x19\x12"
+    "\x4e\xd0\x01\xa1\x2d\x28\x2d\x3c\x7f\x44\x00\x3d\x00\x63\xd0\x00\x92\x87\x69\x3c\x69\x14\x7f\x44\x00\x4b\xf0\x02\xa2\x45\x37\x2d"
+    "\x37\x37\x0f\x7f\x1b\x00\x1b\xb0\x00\x41\x72\x55\x46\x55\x00\x22\x03\x10\x00\xa3\x37\x28\x32\x41\x55\x28\x7f\x0b\x00\x82\xd0\x14"
+    "\x40\x3c\x46\x55\x69\x50\x02\x03\x10\x00\xa2\xa5\x4b\x50\x28\x2d\x41\x7f\x83\x00\x5d\x30\x00\xc1\x32\x2f\x32\x39\x32\x41\x7f\x0e"
+    "\x00\x7f\x00\x44\x70\x00\x56\x4d\x3c\x61\x3c\x6c\x10\x00\x90\x2c\x32\x5b\x18\x56\x0a\x7f\xa0\x00\x02\x00\x00\x10\x02\x56\x5e\x83"
+    "\x36\x74\x14\x10\x00\xc1\x28\x37\x46\x2d\x3c\x1e\xff\x39\x00\x3a\x00\x1d\xf0\x00\x57\x50\x5f\x46\x55\x32\x10\x00\x56\x64\x73\x46"
+    "\x55\x5a\x10\x00\x57\x23\x37\x28\x2d\x28\xc0\x1e\x66\x41\x55\x46\x4b\x46\x28\x10\x00\x66\x55\x73\x50\x69\x50\x32\x10\x00\xa2\x37"
+    "\x37\x37\x55\x37\x1e\x7f\x8c\x00\x1c\x40\x06\x66\x4b\x4b\x4b\x7d\x5f\x28\x10\x00\x70\x32\x1e\x37\x41\x37\x14\x7f\x9e\x07\x02\x10"
+    "\x02\x57\x28\x3c\x5f\x3c\x37\x10\x00\x56\x37\x5a\x91\x5a\x50\x10\x00\xa2\x2e\x57\x3c\x1e\x28\x39\x7f\x4f\x00\x68\x20\x0c\x66\x42"
+    "\x75\x46\x28\x32\x43\x10\x00\x66\x4c\x93\x5a\x3c\x46\x61\x10\x00\x10\x37\x30\x15\x20\x28\x7f\x70\x08\x02\x40\x1e\x51\x6e\x50\x46"
+    "\x50\x32\x10\x00\x01\x10\x03\x67\x46\x32\x1e\x5f\x87\x69\x50\x11\x74\x28\x55\x28\x41\x19\x7f\x5d\xb0\x01\xa2\x50\x46\x28\x64\x3c"
+    "\x91\x7f\x5d\x00\x3c\xb0\x16\xa2\x6d\x42\x54\x51\x63\x20\x7f\x09\x00\x07\x40\x17\xa2\x2d\x55\x32\x37\x32\x41\x7f\x27\x00\x90\x70"
+    "\x07\x66\x41\x7d\x3c\x5f\x3c\x69\x10\x00\xa2\x4d\x78\x5a\x3c\x5a\x30\x7f\x18\x00\x7d\x20\x05\xa2\x3b\x4a\x32\x23\x32\x23\xff\x59"
+    "\x00\x67\x20\x02\x66\x59\x7c\x50\x37\x50\x37\x10\x00\xa2\x2d\x55\x46\x28\x28\x3c\x7f\x80\x00\x27\x30\x09\x66\x41\x7d\x64\x3c\x46"
+    "\x46\x10\x00\xa3\x5f\x6e\x5f\x28\x5f\x37\x7f\x78\x00\x9d\x60\x0a\x92\x53\x32\x25\x32\x3c\x00\x33\x00\x7d\x40\x0d\x61\x64\x7b\x4b"
+    "\x39\x4b\x50\x10\x00\x01\x40\x0c\xa2\x46\x37\x4b\x2d\x41\x3c\xfe\x91\x00\x8e\xd0\x02\x66\x6e\x41\x69\x37\x5f\x50\x10\x00\xc0\x55"
+    "\x61\x42\x69\x42\x41\x7f\x52\x00\x12\x00\x49\x10\x00\xa2\x3a\x6d\x70\x30\x30\x6d\x7f\x44\x00\x37\x70\x15\x61\x34\x41\x32\x2d\x32"
+    "\x26\xf0\x04\x01\x60\x00\x66\x48\x55\x46\x41\x46\x3a\x10\x00\x67\x5c\x69\x5a\x7d\x5a\x62\xf0\x01\x60\x55\x37\x32\x37\x3c\x7f\x90"
+    "\x0a\x01\x80\x02\x66\x55\x3c\x41\x87\x69\x64\x10\x00\x90\x5b\x5a\x81\x5a\x48\x6c\xff\x9a\x00\x02\x00\x00\x10\x00\x48\x81\x5a\x48"
+    "\x5a\x10\x00\x47\x5a\x48\x5a\x81\x10\x00\xfa\x01\x4f\x73\x46\x7d\x50\x6f\x00\x9e\x00\x9e\x00\x80\x00\x02\xc2\x02\x10\x00\x30\xc3"
+    "\x02\x64\xf0\x09\x40\x5a\xff\xa3\x00\x02\x00\x01\x50\x10\x70\x78\x78\x64\x5a\xff\xa4\x00\x02\x00\x00\x60\x01\xf3\x06\x7d\x5a\x73"
+    "\x50\x65\x00\x9f\x00\x9f\x00\x7d\x00\x02\xc4\x02\x7d\x82\x5a\x82\x5a\x5f\x40\x10\x75\x03\xbf\x02\x5b\x48\x5a\x81\x80\x00\x93\x02"
+    "\xc1\x02\x64\x4d\x4d\x80\x80\x5a\x70\x10\xc0\x02\xbe\x02\x47\x78\x5f\x78\x5f\x63\xff\x58\x00\x02\x00\x15\x05\xc0\x10\x02\x9d\x28"
+    "\x0f\xd0\x10\x01\x02\xe0\x09\x07\xf0\x10\x00\x01\x00\x08\x00\x11\x01\x20\x00\x20\x94\x00\x02\x00\x06\x10\x00\x00\xa0\x0a\x02\xb0"
+    "\x19\x02\x10\x00\x00\xe0\x0b\x01\x50\x04\x02\x10\x00\x30\xfe\x25\x00\x02\x00\x05\x10\x00\x30\x7f\x0f\x00\x02\x00\x06\x30\x00\x05"
+    "\x60\x0b\x03\x10\x00\x00\xd0\x20\x01\x30\x0f\x03\x10\x00\x05\x10\x17\x03\x90\x00\x00\x20\x0a\x01\x40\x09\x03\x60\x00\x20\x30\x00"
+    "\x02\x00\x0f\xc0\x00\x06\x0f\xd0\x00\x4d\x0f\xe0\x00\x1e\x0f\xd0\x00\x1d\x0c\x10\x01\x20\x78\x00\x02\x00\x06\x40\x00\x0b\x80\x00"
+    "\x0c\xf0\x00\x0c\xa0\x00\x0f\x40\x00\x07\x0c\x10\x1c\x55\x32\xb4\x14\xb4\x14\xb0\x12\x00\x50\x16\x32\xa0\x46\xa0\x70\x0c\x02\x10"
+    "\x00\x56\x5f\x5a\x5f\x5a\xb4\x10\x00\x55\x3c\x4f\x69\x3b\x55\x30\x11\x77\x00\x00\x3c\x45\x5f\x45\x5f\x10\x00\x64\x64\x67\x4b\x78"
+    "\x4b\x7f\xa0\x02\x50\x00\x00\x96\x78\x64\xf0\x02\x02\xb0\x00\x10\x02\x70\x08\x44\x6b\x69\x6b\x56\x50\x0d\x0f\x10\x00\x2f\x0a\xa0"
+    "\x15\x0f\x10\x00\x10\x02\x60\x09\x12\x45\x60\x09\x84\x00\x00\x69\x1e\x69\x8c\x69\x37\x20\x09\x86\x00\x00\x64\x80\x5a\x4d\x4d\x80"
+    "\xc0\x00\x63\x7d\x78\x5a\xaa\x64\x5f\xc0\x03\x93\x03\x00\x00\x7d\xaa\x64\x78\x5a\x5f\xc0\x03\x3a\x03\x00\x00\xa0\x03\xa1\x00\x00"
+    "\x4f\x64\x50\x6e\x5a\x79\x00\x90\x02\x00\x00\x10\x00\x51\x69\x46\x91\x50\x65\xde\x01\x10\x0a\x10\x00\x70\x59\x91\x5a\x69\x50\x5b"
+    "\x00\x60\x13\x10\x16\x10\x00\x00",
+    7592, 11344);
+
@@ -1,27 +1,94 @@
 import glob
 import os
+import struct
+
+
+def compress(data):
+    # LZ77 style compression matching Resource::decompress
+    # Each sequence is a token (literal count << 4 | match length - 4), the literals,
+    # and a 16 bit backwards offset with the match. The final sequence only has literals.
+    out = bytearray()
+    size = len(data)
+    chains = {}
+
+    def write_length(value):
+        while value >= 255:
+            out.append(255)
+            value -= 255
+        out.append(value)
+
+    def write_sequence(literals, offset, length):
+        token = min(len(literals), 15) << 4
+        if offset != 0:
+            token |= min(length - 4, 15)
+        out.append(token)
+
+        if len(literals) >= 15:
+            write_length(len(literals) - 15)
+        out.extend(literals)
+
+        if offset != 0:
+            out.append(offset & 0xff)
+            out.append(offset >> 8)
+            if length - 4 >= 15:
+                write_length(length - 4 - 15)
+
+    i = 0
+    anchor = 0
+    while i + 4 <= size:
+        candidates = chains.setdefault(data[i:i+4], [])
+
+        best_length = 0
+        best_offset = 0
+        for candidate in reversed(candidates[-32:]):
+            if i - candidate > 0xffff:
+                break
+
+            length = 4
+            while i + length < size and data[candidate + length] == data[i + length]:
+                length += 1
+
+            if length > best_length:
+                best_length = length
+                best_offset = i - candidate
+
+        candidates.append(i)
+
+        if best_length != 0:
+            write_sequence(data[anchor:i], best_offset, best_length)
+            for j in range(i + 1, min(i + best_length, size - 3)):
+                chains.setdefault(data[j:j+4], []).append(j)
+            i += best_length
+            anchor = i
+        else:
+            i += 1
+
+    write_sequence(data[anchor:], 0, 0)
+    return bytes(out)
+
+
+def embed(name, data, indent):
+    compressed = compress(data)
+    if len(compressed) > 0xffff:
+        raise ValueError(f"{name} is too large to embed as a single string literal")
+
+    lines = []
+    for i in range(0, len(compressed), 32):
+        lines.append(f"{indent}\"" + "".join(f"\\x{x:02x}" for x in compressed[i:i+32]) + "\"")
+
+    return "\n".join(lines) + f",\n{indent}{len(compressed)}, {len(data)}"
 
 
 def embed_encounters():
     arrays = []
 
-    files = glob.glob("Encounters/**/*.bin", recursive=True)
+    files = sorted(glob.glob(os.path.join("Encounters", "**", "*.bin"), recursive=True))
     for file in files:
         with open(file, "rb") as f:
             data = f.read()
 
         name = os.path.basename(f.name).replace(".bin", "")
-
-        string = f"constexpr std::array<u8, {len(data)}> {name} ="
-        string += " { "
-
-        for i in range(len(data)):
-            string += str(data[i])
-            if i != len(data) - 1:
-                string += ", "
-
-        string += " };"
-        arrays.append(string)
+        arrays.append((name, embed(name, data, "    ")))
 
     return arrays
 
@@ -30,7 +97,7 @@ def embed_personal():
     arrays = []
 
     for index in ("3", "4", "5"):
-        file = f"Personal/Gen{index}/personal{index}.bin"
+        file = os.path.join("Personal", f"Gen{index}", f"personal{index}.bin")
         with open(file, "rb") as f:
             data = f.read()
             size = len(data)
@@ -38,9 +105,8 @@ def embed_personal():
 
         name = os.path.basename(f.name).replace(".bin", "")
 
-        string = f"constexpr std::array<PersonalInfo, {int(size/offset)}> {name} ="
-        string += " { "
-
+        # Packed as the PersonalInfo constructor arguments, see PersonalLoader
+        personal = bytearray()
         for i in range(0, size, offset):
             hp = data[i]
             atk = data[i+0x1]
@@ -71,82 +137,116 @@ def embed_personal():
                 abilityH = data[i+0x1a]
                 form_stat_index = (data[i+0x1d] << 8) | data[i+0x1c]
 
-            personal = f"PersonalInfo({hp}, {atk}, {defense}, {spa}, {spd}, {spe}, {gender}, {ability1}, {ability2}, {abilityH}, {form_count}, {form_stat_index})"
-            string += personal
-            if i != size - offset:
-                string += ", "
+            personal += struct.pack("<7B3HBH", hp, atk, defense, spa, spd, spe, gender,
+                                    ability1, ability2, abilityH, form_count, form_stat_index)
 
-        string += " };"
-        arrays.append(string)
+        arrays.append((name, embed(name, bytes(personal), "    ")))
 
     return arrays
 
 
-def embed_strings(paths):
-    arrays = []
-    for path in paths:
-        mapping = {}
+def embed_string_table(strings):
+    # Precomputed table: string count, offset of every string plus the end offset, then the null terminated strings
+    header = struct.pack("<I", len(strings))
+    offset = 4 + 4 * (len(strings) + 1)
+
+    body = bytearray()
+    for string in strings:
+        header += struct.pack("<I", offset + len(body))
+        body += bytearray(string, encoding="utf-8")
+        body.append(0)
+    header += struct.pack("<I", offset + len(body))
+
+    return header + body
 
-        files = glob.glob(f"{path}/**/*.txt", recursive=True)
+
+def embed_strings(languages, files):
+    tables = []
+    for language in languages:
+        table = []
         for file in files:
-            with open(file, "r", encoding="utf-8") as f:
-                data = f.read().split("\n")
+            with open(os.path.join("i18n", language, f"{file}_{language}.txt"), "r", encoding="utf-8-sig") as f:
+                lines = [line.replace("\r", "") for line in f.read().split("\n")]
+
+            # Location files are stored indexed by the location number
+            if file in ("dppt", "frlg", "hgss", "rse"):
+                entries = [line.split(",", 1) for line in lines if line != ""]
+                strings = [""] * (max(int(entry[0]) for entry in entries) + 1)
+                for entry in entries:
+                    strings[int(entry[0])] = entry[1]
+            else:
+                strings = lines
 
-            name = os.path.basename(f.name).replace(".txt", "")
+            name = f"{file}_{language}"
+            table.append(f"        // {name}\n        {{\n{embed(name, embed_string_table(strings), '            ')}\n        }}")
+        tables.append(table)
 
-            string_data = []
-            for line in data:
-                line = line.replace('\r', '').replace('\n', '')
+    write_strings(languages, files, tables)
 
-                for x in [int(y) for y in bytearray(line, encoding="utf-8")]:
-                    string_data.append(x)
-                string_data.append(0)
 
-            string = f"constexpr std::array<u8, {len(string_data)}> {name} ="
-            string += " { "
+def write_resources(name, arrays):
+    guard = f"{name.upper()}_HPP"
 
-            for i in range(len(string_data)):
-                string += str(string_data[i])
-                if i != len(string_data) - 1:
-                    string += ", "
+    with open(f"{name}.hpp", "w", encoding="utf-8", newline="\n") as f:
+        f.write(f"#ifndef {guard}\n")
+        f.write(f"#define {guard}\n\n")
+        f.write("#include <Core/Resources/Resource.hpp>\n\n")
 
-            string += " };"
-            mapping[name] = string
+        for array, _ in arrays:
+            f.write(f"extern const Resource {array};\n")
 
-        arrays.append(mapping)
+        f.write(f"\n#endif // {guard}\n")
 
-    write_strings(arrays)
+    with open(f"{name}.cpp", "w", encoding="utf-8", newline="\n") as f:
+        f.write(f"#include \"{name}.hpp\"\n\n")
 
+        for array, string in arrays:
+            f.write(f"const Resource {array}(\n{string});\n\n")
 
-def write_data(arrays):
-    f = open("Resources.hpp", "w")
 
-    f.write("#include <Core/Parents/PersonalInfo.hpp>\n")
-    f.write("#include <Core/Util/Global.hpp>\n")
-    f.write("#include <array>\n\n")
+def write_strings(languages, files, tables):
+    language_names = {"de": "German", "en": "English", "es": "Spanish", "fr": "French",
+                      "it": "Italian", "ja": "Japanese", "ko": "Korean", "zh": "Chinese"}
+    file_names = {"characteristic": "Characteristic", "dppt": "DPPt", "frlg": "FRLG", "hgss": "HGSS",
+                  "natures": "Natures", "powers": "Powers", "rse": "RSE", "species": "Species"}
 
-    for array in arrays:
-        f.write(f"{array}\n\n")
+    with open("I18n.hpp", "w", encoding="utf-8", newline="\n") as f:
+        f.write("#ifndef I18N_HPP\n")
+        f.write("#define I18N_HPP\n\n")
+        f.write("#include <Core/Resources/Resource.hpp>\n\n")
 
+        f.write("enum class Locale : u8\n{\n")
+        f.write(",\n".join(f"    {language_names[language]}" for language in languages))
+        f.write("\n};\n\n")
 
-def write_strings(maps):
-    f = open("I18n.hpp", "w", encoding="utf-8")
+        f.write("enum class Translation : u8\n{\n")
+        f.write(",\n".join(f"    {file_names[file]}" for file in files))
+        f.write("\n};\n\n")
 
-    f.write("#include <Core/Util/Global.hpp>\n")
-    f.write("#include <array>\n\n")
+        f.write(f"extern const Resource i18n[{len(languages)}][{len(files)}];\n")
+        f.write("\n#endif // I18N_HPP\n")
 
-    for map in maps:
-        for string in map.values():
-            f.write(f"{string}\n\n")
+    with open("I18n.cpp", "w", encoding="utf-8", newline="\n") as f:
+        f.write("#include \"I18n.hpp\"\n\n")
+        f.write(f"const Resource i18n[{len(languages)}][{len(files)}] = {{\n")
+        for language, table in zip(languages, tables):
+            f.write(f"    // {language_names[language]}\n")
+            f.write("    {\n")
+            for string in table:
+                f.write(f"{string},\n")
+            f.write("    },\n")
+        f.write("};\n")
 
 
 def main():
+    os.chdir(os.path.dirname(os.path.abspath(__file__)))
+
     encounters = embed_encounters()
     personal = embed_personal()
-    write_data(encounters + personal)
+    write_resources("Resources", encounters + personal)
 
-    embed_strings(["i18n\de", "i18n\en", "i18n\es", "i18n\\fr",
-                   "i18n\it", "i18n\ja", "i18n\ko", "i18n\zh", ])
+    embed_strings(["de", "en", "es", "fr", "it", "ja", "ko", "zh"],
+                  ["characteristic", "dppt", "frlg", "hgss", "natures", "powers", "rse", "species"])
 
 
 if __name__ == "__main__":
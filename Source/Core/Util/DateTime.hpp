@@ -124,6 +124,18 @@ public:
     {
     }
     DateTime(int year, int month, int day, int hour = 0, int minute = 0, int second = 0);
+
+    // Seconds since Jan 1, 2000, the bound date range fits in 32 bits
+    static constexpr DateTime fromSeconds(u32 seconds)
+    {
+        return DateTime(2451545 + seconds / 86400, seconds % 86400);
+    }
+
+    constexpr u32 toSeconds() const
+    {
+        return static_cast<u32>(date.jd - 2451545) * 86400 + time.md;
+    }
+
     void addSeconds(int seconds);
     DateTime addSecs(int seconds);
     Date getDate() const;
@@ -0,0 +1,138 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Exporter.hpp"
+
+Exporter::Exporter(const std::string &fileName, bool csv, const std::vector<std::string> &header) :
+    header(header), writer(fileName, csv ? ',' : '\t'), pending(0), done(false), exporting(false), finished(false), progress(0)
+{
+}
+
+Exporter::~Exporter()
+{
+    cancelExport();
+}
+
+bool Exporter::isOpen() const
+{
+    return writer.isOpen();
+}
+
+void Exporter::startExport()
+{
+    exporting = true;
+    thread = std::thread([this] { run(); });
+}
+
+void Exporter::addRows(std::vector<std::string> &&cells)
+{
+    std::lock_guard<std::mutex> guard(mutex);
+    pending += cells.size() / header.size();
+    queue.emplace_back(std::move(cells));
+    condition.notify_one();
+}
+
+void Exporter::finishExport()
+{
+    std::lock_guard<std::mutex> guard(mutex);
+    done = true;
+    condition.notify_one();
+}
+
+void Exporter::cancelExport()
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        exporting = false;
+        condition.notify_one();
+    }
+
+    if (thread.joinable())
+    {
+        thread.join();
+    }
+}
+
+size_t Exporter::getPending()
+{
+    std::lock_guard<std::mutex> guard(mutex);
+    return pending;
+}
+
+size_t Exporter::getProgress() const
+{
+    return progress;
+}
+
+bool Exporter::isFinished() const
+{
+    return finished;
+}
+
+bool Exporter::hasError() const
+{
+    return writer.hasError();
+}
+
+void Exporter::run()
+{
+    for (const auto &column : header)
+    {
+        writer.writeString(column);
+    }
+    writer.nextRow();
+
+    while (true)
+    {
+        std::vector<std::string> cells;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this] { return !queue.empty() || !exporting || done; });
+            if (!exporting || queue.empty())
+            {
+                break;
+            }
+
+            cells = std::move(queue.front());
+            queue.pop_front();
+        }
+
+        for (size_t i = 0; i < cells.size(); i++)
+        {
+            writer.writeString(cells[i]);
+            if ((i + 1) % header.size() == 0)
+            {
+                writer.nextRow();
+            }
+        }
+
+        size_t rows = cells.size() / header.size();
+        progress += rows;
+
+        std::lock_guard<std::mutex> guard(mutex);
+        pending -= rows;
+        if (writer.hasError())
+        {
+            break;
+        }
+    }
+
+    writer.flush();
+    finished = true;
+}
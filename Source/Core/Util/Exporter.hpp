@@ -0,0 +1,73 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef EXPORTER_HPP
+#define EXPORTER_HPP
+
+#include <Core/Util/TextWriter.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// Writes rows of already formatted cells to a CSV/TXT file on a worker thread
+class Exporter
+{
+public:
+    Exporter(const std::string &fileName, bool csv, const std::vector<std::string> &header);
+
+    ~Exporter();
+
+    bool isOpen() const;
+
+    void startExport();
+
+    // Cells of whole rows, row after row
+    void addRows(std::vector<std::string> &&cells);
+
+    void finishExport();
+
+    void cancelExport();
+
+    size_t getPending();
+
+    size_t getProgress() const;
+
+    bool isFinished() const;
+
+    bool hasError() const;
+
+private:
+    std::deque<std::vector<std::string>> queue;
+    std::vector<std::string> header;
+    std::condition_variable condition;
+    std::mutex mutex;
+    std::thread thread;
+    TextWriter writer;
+    size_t pending;
+    bool done;
+    bool exporting;
+    std::atomic<bool> finished;
+    std::atomic<size_t> progress;
+
+    void run();
+};
+
+#endif // EXPORTER_HPP
@@ -0,0 +1,255 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "JobScheduler.hpp"
+#include <algorithm>
+
+Job::Job(JobScheduler *scheduler, u32 tasks, int concurrency, int priority, bool paused, std::function<void(u32, u32)> task) :
+    scheduler(scheduler),
+    task(std::move(task)),
+    busySlots(static_cast<size_t>(std::max(concurrency, 1))),
+    tasks(tasks),
+    priority(priority),
+    paused(paused)
+{
+}
+
+void Job::pause()
+{
+    std::lock_guard<std::mutex> lock(scheduler->mutex);
+    paused = true;
+}
+
+void Job::resume()
+{
+    {
+        std::lock_guard<std::mutex> lock(scheduler->mutex);
+        paused = false;
+    }
+    scheduler->available.notify_all();
+}
+
+void Job::cancel()
+{
+    std::lock_guard<std::mutex> lock(scheduler->mutex);
+    if (!finished)
+    {
+        cancelled = true;
+        if (running == 0)
+        {
+            scheduler->finish(this);
+        }
+    }
+}
+
+void Job::setPriority(int priority)
+{
+    {
+        std::lock_guard<std::mutex> lock(scheduler->mutex);
+        this->priority = priority;
+    }
+    scheduler->available.notify_all();
+}
+
+void Job::wait()
+{
+    std::unique_lock<std::mutex> lock(scheduler->mutex);
+    done.wait(lock, [this] { return finished; });
+}
+
+u32 Job::getCompleted() const
+{
+    std::lock_guard<std::mutex> lock(scheduler->mutex);
+    return completed;
+}
+
+JobScheduler::JobScheduler(int threads)
+{
+    for (int i = 0; i < std::max(threads, 1); i++)
+    {
+        workers.emplace_back([this] { run(); });
+    }
+}
+
+JobScheduler::~JobScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        while (!jobs.empty())
+        {
+            finish(jobs.back().get());
+        }
+    }
+    available.notify_all();
+
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+JobScheduler &JobScheduler::getInstance()
+{
+    static JobScheduler scheduler(static_cast<int>(std::thread::hardware_concurrency()));
+    return scheduler;
+}
+
+std::shared_ptr<Job> JobScheduler::submit(u32 tasks, int concurrency, int priority, std::function<void(u32, u32)> task, bool paused)
+{
+    std::shared_ptr<Job> job(new Job(this, tasks, concurrency, priority, paused, std::move(task)));
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (tasks == 0 || stopping)
+        {
+            job->finished = true;
+            return job;
+        }
+        jobs.emplace_back(job);
+    }
+    available.notify_all();
+    return job;
+}
+
+void JobScheduler::finish(Job *job)
+{
+    job->finished = true;
+    jobs.erase(std::find_if(jobs.begin(), jobs.end(), [job](const auto &other) { return other.get() == job; }));
+    job->done.notify_all();
+}
+
+std::shared_ptr<Job> JobScheduler::pick() const
+{
+    // Highest priority first, the job that least recently started a task breaks ties so equal jobs take turns
+    std::shared_ptr<Job> best;
+    for (const auto &job : jobs)
+    {
+        if (job->paused || job->cancelled || job->next == job->tasks || job->running == job->busySlots.size())
+        {
+            continue;
+        }
+
+        if (!best || job->priority > best->priority || (job->priority == best->priority && job->turn < best->turn))
+        {
+            best = job;
+        }
+    }
+    return best;
+}
+
+void JobScheduler::run()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        std::shared_ptr<Job> job;
+        available.wait(lock, [this, &job] { return stopping || (job = pick()) != nullptr; });
+        if (stopping)
+        {
+            return;
+        }
+
+        u32 index = job->next++;
+        auto slot = static_cast<u32>(std::find(job->busySlots.begin(), job->busySlots.end(), false) - job->busySlots.begin());
+        job->busySlots[slot] = true;
+        job->running++;
+        job->turn = ++turn;
+
+        lock.unlock();
+        job->task(index, slot);
+        lock.lock();
+
+        job->busySlots[slot] = false;
+        job->running--;
+        job->completed++;
+        if ((job->next == job->tasks || job->cancelled) && job->running == 0 && !job->finished)
+        {
+            finish(job.get());
+        }
+    }
+}
+
+void JobControl::setPriority(int priority)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    this->priority = priority;
+    if (job)
+    {
+        job->setPriority(priority);
+    }
+}
+
+void JobControl::pause()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    paused = true;
+    if (job)
+    {
+        job->pause();
+    }
+}
+
+void JobControl::resume()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    paused = false;
+    if (job)
+    {
+        job->resume();
+    }
+}
+
+void JobControl::start()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    generation++;
+}
+
+void JobControl::cancel()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (job)
+    {
+        job->cancel();
+    }
+    else
+    {
+        // Only the run started last sees this, a cancel while nothing is running is forgotten by the next start()
+        cancelled = generation;
+    }
+}
+
+void JobControl::run(u32 tasks, int concurrency, std::function<void(u32, u32)> task)
+{
+    std::shared_ptr<Job> current;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (cancelled == generation)
+        {
+            return;
+        }
+        job = JobScheduler::getInstance().submit(tasks, concurrency, priority, std::move(task), paused);
+        current = job;
+    }
+
+    current->wait();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    job.reset();
+}
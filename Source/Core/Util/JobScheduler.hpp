@@ -0,0 +1,128 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef JOBSCHEDULER_HPP
+#define JOBSCHEDULER_HPP
+
+#include <Core/Util/Global.hpp>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class JobScheduler;
+
+class Job
+{
+public:
+    void pause();
+    void resume();
+    // Drops the tasks that have not started, tasks that are running finish
+    void cancel();
+    void setPriority(int priority);
+    // Waits until every task ran or the job was cancelled and no task is running
+    void wait();
+    u32 getCompleted() const;
+
+private:
+    friend class JobScheduler;
+
+    JobScheduler *scheduler;
+    std::function<void(u32, u32)> task;
+    std::vector<bool> busySlots;
+    std::condition_variable done;
+    u64 turn = 0;
+    u32 tasks;
+    u32 next = 0;
+    u32 running = 0;
+    u32 completed = 0;
+    int priority;
+    bool paused;
+    bool cancelled = false;
+    bool finished = false;
+
+    Job(JobScheduler *scheduler, u32 tasks, int concurrency, int priority, bool paused, std::function<void(u32, u32)> task);
+};
+
+// Pool of worker threads shared by every search of the process. Idle workers start the next task of the runnable job
+// with the highest priority, jobs of the same priority take turns task by task. A job never runs more tasks at the same
+// time than its concurrency.
+class JobScheduler
+{
+public:
+    explicit JobScheduler(int threads);
+
+    ~JobScheduler();
+
+    JobScheduler(const JobScheduler &) = delete;
+
+    JobScheduler &operator=(const JobScheduler &) = delete;
+
+    static JobScheduler &getInstance();
+
+    int getThreads() const
+    {
+        return static_cast<int>(workers.size());
+    }
+
+    // Calls task for every task index below tasks with a slot that is unique among the running tasks of the job and
+    // less than concurrency, for per worker state such as counters
+    std::shared_ptr<Job> submit(u32 tasks, int concurrency, int priority, std::function<void(u32, u32)> task, bool paused = false);
+
+private:
+    friend class Job;
+
+    std::vector<std::shared_ptr<Job>> jobs;
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable available;
+    u64 turn = 0;
+    bool stopping = false;
+
+    void finish(Job *job);
+    std::shared_ptr<Job> pick() const;
+    void run();
+};
+
+// Job of a searcher on the process wide scheduler. Keeps the priority and pause requests made before the job is
+// submitted, so they can be called from another thread at any time during the search.
+class JobControl
+{
+public:
+    void setPriority(int priority);
+    void pause();
+    void resume();
+    // Starts a search, a cancel made from now until its run() submits the job stops that run
+    void start();
+    void cancel();
+    // Submits the job to JobScheduler::getInstance() and waits for it
+    void run(u32 tasks, int concurrency, std::function<void(u32, u32)> task);
+
+private:
+    std::shared_ptr<Job> job;
+    std::mutex mutex;
+    u64 generation = 1;
+    u64 cancelled = 0; // Generation a cancel was made in before its job was submitted
+    int priority = 0;
+    bool paused = false;
+};
+
+#endif // JOBSCHEDULER_HPP
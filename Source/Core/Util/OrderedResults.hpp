@@ -0,0 +1,137 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef ORDEREDRESULTS_HPP
+#define ORDEREDRESULTS_HPP
+
+#include <Core/Util/Global.hpp>
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <queue>
+#include <vector>
+
+// Collects the results of chunks [first, last) finished in any order and releases them group by group once every
+// earlier chunk is in. Chunks of a group are merged by compare, ties keep the chunk order. Not synchronized.
+template <class Result>
+class OrderedResults
+{
+public:
+    using Compare = bool (*)(const Result &, const Result &);
+
+    OrderedResults() = default;
+
+    OrderedResults(u32 first, u32 last, u32 groupSize = 1, Compare compare = nullptr) :
+        first(first), next(first), last(last), groupSize(groupSize), compare(compare)
+    {
+    }
+
+    void add(u32 chunk, std::vector<Result> &&results)
+    {
+        pending[chunk] = std::move(results);
+
+        while (next < last)
+        {
+            u32 end = std::min(next + groupSize, last);
+            auto begin = pending.lower_bound(next);
+            if (static_cast<u32>(std::distance(begin, pending.lower_bound(end))) != end - next)
+            {
+                break;
+            }
+            release(end);
+        }
+    }
+
+    // Releases the remaining groups even though they are missing chunks, used once a search is cancelled
+    void finish()
+    {
+        while (!pending.empty())
+        {
+            u32 chunk = pending.begin()->first;
+            next = std::max(next, first + (chunk - first) / groupSize * groupSize);
+            release(next + groupSize);
+        }
+        next = last;
+    }
+
+    std::vector<Result> take()
+    {
+        auto data = std::move(released);
+        released.clear();
+        return data;
+    }
+
+private:
+    std::map<u32, std::vector<Result>> pending;
+    std::vector<Result> released;
+    u32 first = 0;
+    u32 next = 0;
+    u32 last = 0;
+    u32 groupSize = 1;
+    Compare compare = nullptr;
+
+    void release(u32 end)
+    {
+        std::vector<std::vector<Result>> runs;
+        for (auto it = pending.lower_bound(next); it != pending.end() && it->first < end; it = pending.erase(it))
+        {
+            if (!it->second.empty())
+            {
+                runs.emplace_back(std::move(it->second));
+            }
+        }
+        next = end;
+
+        if (runs.size() == 1 || compare == nullptr)
+        {
+            for (auto &run : runs)
+            {
+                released.insert(released.end(), run.begin(), run.end());
+            }
+            return;
+        }
+
+        // Heap of the next result of each run, the earlier run goes first on ties
+        using Cursor = std::pair<size_t, size_t>;
+        auto later = [&](const Cursor &left, const Cursor &right) {
+            const auto &a = runs[left.first][left.second];
+            const auto &b = runs[right.first][right.second];
+            return compare(b, a) || (!compare(a, b) && left.first > right.first);
+        };
+        std::priority_queue<Cursor, std::vector<Cursor>, decltype(later)> heads(later);
+        for (size_t i = 0; i < runs.size(); i++)
+        {
+            heads.emplace(i, 0);
+        }
+
+        while (!heads.empty())
+        {
+            auto cursor = heads.top();
+            heads.pop();
+
+            released.emplace_back(runs[cursor.first][cursor.second]);
+            if (++cursor.second < runs[cursor.first].size())
+            {
+                heads.push(cursor);
+            }
+        }
+    }
+};
+
+#endif // ORDEREDRESULTS_HPP
@@ -0,0 +1,223 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef RESULTSTORE_HPP
+#define RESULTSTORE_HPP
+
+#include <Core/Util/Global.hpp>
+#include <Core/Util/SpillFile.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+enum class ResultPolicy : u8
+{
+    Spill, // Write them to the spill file
+    Block, // Wait until results are taken
+    Drop // Throw them away
+};
+
+struct ResultBudget
+{
+    size_t maxResults = 0; // 0 is unbounded
+    ResultPolicy policy = ResultPolicy::Spill;
+    std::string spillFile; // Empty uses a temporary file
+};
+
+// Thread safe queue of the results of a search that holds at most the budget in memory. Results are taken in the order
+// they were added, with a spill file a take returns at most the budget and an empty take means nothing is pending.
+template <class Result>
+class ResultStore
+{
+    static_assert(std::is_trivially_copyable_v<Result>, "Results must be trivially copyable");
+
+public:
+    void setBudget(const ResultBudget &budget)
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        this->budget = budget;
+    }
+
+    void add(const std::vector<Result> &results)
+    {
+        if (results.empty())
+        {
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        if (budget.maxResults != 0 && budget.policy == ResultPolicy::Block)
+        {
+            // Only the free part of the budget is filled at a time, a cancelled search adds the rest at once
+            for (auto it = results.begin(); it != results.end();)
+            {
+                drained.wait(lock, [this] { return cancelled || memory.size() < budget.maxResults; });
+                size_t free = cancelled ? results.end() - it : budget.maxResults - memory.size();
+                size_t count = std::min<size_t>(free, results.end() - it);
+                memory.insert(memory.end(), it, it + count);
+                it += count;
+            }
+            return;
+        }
+
+        insert(results);
+    }
+
+    // Adds results without waiting for ResultPolicy::Block, for callers that hold a lock. Call wait() once it is
+    // released so the search still stops while the budget is full.
+    void append(const std::vector<Result> &results)
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        if (budget.maxResults != 0 && budget.policy == ResultPolicy::Block)
+        {
+            memory.insert(memory.end(), results.begin(), results.end());
+        }
+        else
+        {
+            insert(results);
+        }
+    }
+
+    // Waits until the budget has room again with ResultPolicy::Block
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        drained.wait(lock, [this] {
+            return cancelled || budget.maxResults == 0 || budget.policy != ResultPolicy::Block || memory.size() < budget.maxResults;
+        });
+    }
+
+    // Returns the results held in memory and pages in the next results from the spill file
+    std::vector<Result> take()
+    {
+        std::vector<Result> data;
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+            data = std::move(memory);
+            memory.clear();
+
+            u64 pending = spill.getPending() / sizeof(Result);
+            if (pending != 0)
+            {
+                memory.resize(static_cast<size_t>(std::min<u64>(pending, budget.maxResults)));
+                if (!spill.read(memory.data(), memory.size() * sizeof(Result)))
+                {
+                    memory.clear();
+                    dropped += pending;
+                    spill.close();
+                }
+            }
+
+            // Results that could not be spilled come after everything that was
+            if (spill.getPending() == 0)
+            {
+                memory.insert(memory.end(), overflow.begin(), overflow.end());
+                overflow.clear();
+            }
+        }
+        drained.notify_all();
+        return data;
+    }
+
+    void cancel()
+    {
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+            cancelled = true;
+        }
+        drained.notify_all();
+    }
+
+    u64 getSpilled() const
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        return spilled;
+    }
+
+    u64 getDropped() const
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        return dropped;
+    }
+
+private:
+    ResultBudget budget;
+    std::vector<Result> memory;
+    std::vector<Result> overflow;
+    SpillFile spill;
+    mutable std::mutex mutex;
+    std::condition_variable drained;
+    u64 spilled = 0;
+    u64 dropped = 0;
+    bool cancelled = false;
+    bool spillFailed = false;
+
+    void insert(const std::vector<Result> &results)
+    {
+        if (budget.maxResults == 0)
+        {
+            memory.insert(memory.end(), results.begin(), results.end());
+            return;
+        }
+
+        // Everything after the first spilled result has to go behind it as well to keep the order
+        bool behind = spill.getPending() != 0 || !overflow.empty();
+        size_t count = std::min(results.size(), behind ? 0 : budget.maxResults - std::min(memory.size(), budget.maxResults));
+        memory.insert(memory.end(), results.begin(), results.begin() + count);
+
+        size_t remaining = results.size() - count;
+        if (remaining == 0)
+        {
+            return;
+        }
+
+        if (budget.policy == ResultPolicy::Drop)
+        {
+            dropped += remaining;
+        }
+        else if (overflow.empty() && openSpill() && spill.write(results.data() + count, remaining * sizeof(Result)))
+        {
+            spilled += remaining;
+        }
+        else if (spill.getPending() == 0)
+        {
+            // Results are never lost because the spill file is unusable, they stay in memory instead
+            memory.insert(memory.end(), results.begin() + count, results.end());
+        }
+        else
+        {
+            // Older results are still in the spill file, these wait until it is read back
+            overflow.insert(overflow.end(), results.begin() + count, results.end());
+        }
+    }
+
+    bool openSpill()
+    {
+        if (!spill.isOpen() && !spillFailed)
+        {
+            spillFailed = !spill.open(budget.spillFile);
+        }
+        return spill.isOpen();
+    }
+};
+
+#endif // RESULTSTORE_HPP
@@ -0,0 +1,168 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SearchCheckpoint.hpp"
+#include <algorithm>
+#include <filesystem>
+
+constexpr u32 checkpointMagic = 0x4b434650; // PFCK
+constexpr u32 checkpointVersion = 2;
+constexpr u32 checkpointByteOrder = 0x01020304;
+constexpr auto flushInterval = std::chrono::seconds(10);
+
+SearchCheckpoint::SearchCheckpoint(const std::string &fileName, const std::vector<u64> &parameters, u32 chunks, u32 resultSize) :
+    completed(chunks), lastFlush(std::chrono::steady_clock::now()), resultSize(resultSize)
+{
+    if (fileName.empty())
+    {
+        completed.clear();
+        return;
+    }
+
+    if (load(fileName, parameters, chunks))
+    {
+        file = std::fopen(fileName.c_str(), "ab");
+    }
+    else
+    {
+        std::fill(completed.begin(), completed.end(), 0);
+        restored.clear();
+        records.clear();
+
+        file = std::fopen(fileName.c_str(), "wb");
+        if (file)
+        {
+            u32 header[7] = { checkpointMagic, checkpointVersion, checkpointByteOrder, sizeof(u32) * 2, resultSize, chunks,
+                              static_cast<u32>(parameters.size()) };
+            if (std::fwrite(header, sizeof(header), 1, file) != 1
+                || std::fwrite(parameters.data(), sizeof(u64), parameters.size(), file) != parameters.size() || std::fflush(file) != 0)
+            {
+                std::fclose(file);
+                file = nullptr;
+            }
+        }
+    }
+
+    if (!file)
+    {
+        completed.clear();
+        restored.clear();
+        records.clear();
+    }
+}
+
+SearchCheckpoint::~SearchCheckpoint()
+{
+    flush();
+    if (file)
+    {
+        std::fclose(file);
+    }
+}
+
+bool SearchCheckpoint::isOpen() const
+{
+    return file != nullptr;
+}
+
+void SearchCheckpoint::flush()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (file && !buffer.empty())
+    {
+        // Checkpointing stops at the first failed write, the partial record it may leave is dropped on load
+        if (std::fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size() || std::fflush(file) != 0)
+        {
+            std::fclose(file);
+            file = nullptr;
+        }
+        buffer.clear();
+    }
+    lastFlush = std::chrono::steady_clock::now();
+}
+
+void SearchCheckpoint::complete(u32 chunk, const void *results, u32 count)
+{
+    bool expired;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!file)
+        {
+            return;
+        }
+
+        u32 record[2] = { chunk, count };
+        auto data = reinterpret_cast<const char *>(results);
+        buffer.insert(buffer.end(), reinterpret_cast<const char *>(record), reinterpret_cast<const char *>(record) + sizeof(record));
+        buffer.insert(buffer.end(), data, data + static_cast<size_t>(count) * resultSize);
+
+        expired = std::chrono::steady_clock::now() - lastFlush >= flushInterval;
+    }
+
+    if (expired)
+    {
+        flush();
+    }
+}
+
+bool SearchCheckpoint::load(const std::string &fileName, const std::vector<u64> &parameters, u32 chunks)
+{
+    FILE *read = std::fopen(fileName.c_str(), "rb");
+    if (!read)
+    {
+        return false;
+    }
+
+    // Records are raw result bytes, so a different layout, size or byte order starts the journal over
+    u32 header[7];
+    std::vector<u64> stored(parameters.size());
+    if (std::fread(header, sizeof(header), 1, read) != 1 || header[0] != checkpointMagic || header[1] != checkpointVersion
+        || header[2] != checkpointByteOrder || header[3] != sizeof(u32) * 2 || header[4] != resultSize || header[5] != chunks
+        || header[6] != parameters.size()
+        || std::fread(stored.data(), sizeof(u64), stored.size(), read) != stored.size() || stored != parameters)
+    {
+        std::fclose(read);
+        return false;
+    }
+
+    // Keep every complete record, anything after the last one was cut short and is truncated away
+    auto size = static_cast<std::uintmax_t>(sizeof(header) + sizeof(u64) * parameters.size());
+    u32 record[2];
+    while (std::fread(record, sizeof(record), 1, read) == 1 && record[0] < chunks)
+    {
+        size_t length = static_cast<size_t>(record[1]) * resultSize;
+        size_t offset = restored.size();
+
+        restored.resize(offset + length);
+        if (std::fread(restored.data() + offset, 1, length, read) != length)
+        {
+            restored.resize(offset);
+            break;
+        }
+
+        completed[record[0]] = 1;
+        records[record[0]] = { offset, record[1] };
+        size += sizeof(record) + length;
+    }
+    std::fclose(read);
+
+    std::error_code error;
+    std::filesystem::resize_file(fileName, size, error);
+    return !error;
+}
@@ -0,0 +1,110 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEARCHCHECKPOINT_HPP
+#define SEARCHCHECKPOINT_HPP
+
+#include <Core/Util/Global.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// Journal of the completed chunks of a search and their results. Records are appended every few seconds, a file made
+// with other parameters is started over and a record cut short by the process dying is dropped on load.
+class SearchCheckpoint
+{
+public:
+    // An empty fileName gives a disabled checkpoint
+    SearchCheckpoint(const std::string &fileName, const std::vector<u64> &parameters, u32 chunks, u32 resultSize);
+
+    ~SearchCheckpoint();
+
+    SearchCheckpoint(const SearchCheckpoint &) = delete;
+
+    SearchCheckpoint &operator=(const SearchCheckpoint &) = delete;
+
+    // False once a write failed, nothing more is recorded then
+    bool isOpen() const;
+
+    bool isCompleted(u32 chunk) const
+    {
+        return !completed.empty() && completed[chunk];
+    }
+
+    template <class Result>
+    std::vector<Result> getResults() const
+    {
+        static_assert(std::is_trivially_copyable_v<Result>, "Results must be trivially copyable");
+
+        std::vector<Result> results(restored.size() / sizeof(Result));
+        if (!results.empty())
+        {
+            std::memcpy(results.data(), restored.data(), restored.size());
+        }
+        return results;
+    }
+
+    template <class Result>
+    std::vector<Result> getResults(u32 chunk) const
+    {
+        static_assert(std::is_trivially_copyable_v<Result>, "Results must be trivially copyable");
+
+        auto record = records.find(chunk);
+        if (record == records.end())
+        {
+            return {};
+        }
+
+        std::vector<Result> results(record->second.second);
+        if (!results.empty())
+        {
+            std::memcpy(results.data(), restored.data() + record->second.first, results.size() * sizeof(Result));
+        }
+        return results;
+    }
+
+    template <class Result>
+    void complete(u32 chunk, const std::vector<Result> &results)
+    {
+        static_assert(std::is_trivially_copyable_v<Result>, "Results must be trivially copyable");
+        complete(chunk, results.data(), static_cast<u32>(results.size()));
+    }
+
+    void flush();
+
+private:
+    std::vector<u8> completed;
+    std::vector<char> buffer;
+    std::vector<char> restored;
+    std::unordered_map<u32, std::pair<size_t, u32>> records; // Offset and count of the restored results of each chunk
+    std::mutex mutex;
+    std::chrono::steady_clock::time_point lastFlush;
+    FILE *file = nullptr;
+    u32 resultSize = 0;
+
+    void complete(u32 chunk, const void *results, u32 count);
+    bool load(const std::string &fileName, const std::vector<u64> &parameters, u32 chunks);
+};
+
+#endif // SEARCHCHECKPOINT_HPP
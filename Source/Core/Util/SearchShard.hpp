@@ -0,0 +1,42 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEARCHSHARD_HPP
+#define SEARCHSHARD_HPP
+
+#include <Core/Util/Global.hpp>
+#include <utility>
+
+// Deterministic split of a search space into equal contiguous shards. Shards of the same count cover the whole space
+// in its original order when taken in index order.
+struct SearchShard
+{
+    u32 index = 0;
+    u32 count = 1;
+
+    // Returns the part of [begin, end) that belongs to this shard
+    template <class Integer>
+    std::pair<Integer, Integer> getRange(Integer begin, Integer end) const
+    {
+        u64 size = static_cast<u64>(end - begin);
+        return { static_cast<Integer>(begin + size * index / count), static_cast<Integer>(begin + size * (index + 1) / count) };
+    }
+};
+
+#endif // SEARCHSHARD_HPP
@@ -0,0 +1,134 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SearchStats.hpp"
+#include <cstdio>
+
+std::string SearchStats::toJSON() const
+{
+    char buffer[512];
+    int length = std::snprintf(buffer, sizeof(buffer),
+                               "{\"elapsed\":%.3f,\"rate\":%.1f,\"eta\":%.1f,\"workers\":%d,\"total\":%llu,\"skipped\":%llu,"
+                               "\"stages\":{\"hashed\":%llu,\"loaded\":%llu,\"advanced\":%llu,\"generated\":%llu,\"passed\":%llu},"
+                               "\"lockWait\":%.6f}",
+                               elapsed, rate, eta, workers, static_cast<unsigned long long>(total),
+                               static_cast<unsigned long long>(skipped), static_cast<unsigned long long>(hashed),
+                               static_cast<unsigned long long>(loaded), static_cast<unsigned long long>(advanced),
+                               static_cast<unsigned long long>(generated), static_cast<unsigned long long>(passed), lockWait);
+    return std::string(buffer, length);
+}
+
+void SearchCounters::start(u64 total, int workers)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    counters = std::make_unique<Counters[]>(workers);
+    begin = std::chrono::steady_clock::now();
+    end = begin;
+    skipped = 0;
+    active = 0;
+    scheduled = false;
+    next = 0;
+    this->total = total;
+    this->workers = workers;
+}
+
+SearchCounters::Worker SearchCounters::addWorker()
+{
+    return Worker(&counters[next++ % workers], this);
+}
+
+SearchCounters::Worker SearchCounters::addWorker(u32 slot)
+{
+    return Worker(&counters[slot % workers], this);
+}
+
+void SearchCounters::addSkipped(u64 count)
+{
+    skipped += count;
+}
+
+SearchStats SearchCounters::getStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    SearchStats stats;
+    if (!counters)
+    {
+        return stats;
+    }
+
+    u64 lockWait = 0;
+    for (int i = 0; i < workers; i++)
+    {
+        stats.hashed += counters[i].hashed.load(std::memory_order_relaxed);
+        stats.loaded += counters[i].loaded.load(std::memory_order_relaxed);
+        stats.advanced += counters[i].advanced.load(std::memory_order_relaxed);
+        stats.generated += counters[i].generated.load(std::memory_order_relaxed);
+        stats.passed += counters[i].passed.load(std::memory_order_relaxed);
+        lockWait += counters[i].lockWait.load(std::memory_order_relaxed);
+    }
+
+    bool running = active != 0 || scheduled;
+    stats.workers = active;
+    stats.total = total;
+    stats.skipped = skipped;
+    stats.lockWait = lockWait / 1e9;
+    stats.elapsed = std::chrono::duration<double>((running ? std::chrono::steady_clock::now() : end) - begin).count();
+
+    if (!running)
+    {
+        stats.eta = 0;
+    }
+    if (stats.elapsed > 0)
+    {
+        stats.rate = (stats.hashed + stats.loaded) / stats.elapsed;
+        if (running && stats.rate > 0)
+        {
+            u64 searched = stats.hashed + stats.loaded + stats.skipped;
+            stats.eta = searched < total ? (total - searched) / stats.rate : 0;
+        }
+    }
+
+    return stats;
+}
+
+void SearchCounters::startJob()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    scheduled = true;
+}
+
+void SearchCounters::finishJob()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    scheduled = false;
+    if (active == 0)
+    {
+        end = std::chrono::steady_clock::now();
+    }
+}
+
+void SearchCounters::finishWorker()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (--active == 0 && !scheduled)
+    {
+        end = std::chrono::steady_clock::now();
+    }
+}
@@ -0,0 +1,152 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEARCHSTATS_HPP
+#define SEARCHSTATS_HPP
+
+#include <Core/Util/Global.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+
+// Snapshot of the progress and throughput of a search. Seeds are produced (hashed in Gen 5 or loaded from a seed
+// database), advanced, generated into states, and the states that pass the filter become results. Searchers without
+// a stage leave it at 0.
+struct SearchStats
+{
+    double elapsed = 0; // Seconds since the search started
+    double rate = 0; // Seeds searched per second
+    double eta = -1; // Seconds until the search finishes, negative when unknown
+    double lockWait = 0; // Seconds workers spent waiting on the results lock
+    u64 total = 0; // Seeds in the search
+    u64 skipped = 0; // Seeds skipped because a checkpoint already covered them
+    u64 hashed = 0;
+    u64 loaded = 0; // Seeds read from a seed database instead of hashed
+    u64 advanced = 0;
+    u64 generated = 0;
+    u64 passed = 0;
+    int workers = 0; // Workers still running
+
+    std::string toJSON() const;
+};
+
+// Per worker counters aggregated into a SearchStats snapshot on read, each worker only writes its own cache line
+class SearchCounters
+{
+    struct alignas(64) Counters
+    {
+        std::atomic<u64> hashed { 0 };
+        std::atomic<u64> loaded { 0 };
+        std::atomic<u64> advanced { 0 };
+        std::atomic<u64> generated { 0 };
+        std::atomic<u64> passed { 0 };
+        std::atomic<u64> lockWait { 0 };
+    };
+
+public:
+    // The worker is counted as finished when this is destroyed
+    class Worker
+    {
+    public:
+        Worker(Counters *counters, SearchCounters *parent) : counters(counters), parent(parent)
+        {
+            parent->active++;
+        }
+
+        ~Worker()
+        {
+            parent->finishWorker();
+        }
+
+        Worker(const Worker &) = delete;
+
+        Worker &operator=(const Worker &) = delete;
+
+        void addHashed(u64 count)
+        {
+            add(counters->hashed, count);
+        }
+
+        void addLoaded(u64 count)
+        {
+            add(counters->loaded, count);
+        }
+
+        void addAdvanced(u64 count)
+        {
+            add(counters->advanced, count);
+        }
+
+        void addGenerated(u64 count)
+        {
+            add(counters->generated, count);
+        }
+
+        void addPassed(u64 count)
+        {
+            add(counters->passed, count);
+        }
+
+        // Locks mutex, counting the time spent waiting for it
+        std::unique_lock<std::mutex> lock(std::mutex &mutex)
+        {
+            auto begin = std::chrono::steady_clock::now();
+            std::unique_lock<std::mutex> guard(mutex);
+            add(counters->lockWait, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count());
+            return guard;
+        }
+
+    private:
+        Counters *counters;
+        SearchCounters *parent;
+
+        static void add(std::atomic<u64> &counter, u64 count)
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+        }
+    };
+
+    void start(u64 total, int workers);
+    Worker addWorker();
+    // Counters of a task of a scheduled job, tasks of the same slot never run at the same time
+    Worker addWorker(u32 slot);
+    void addSkipped(u64 count);
+    SearchStats getStats() const;
+    // Keeps a scheduled job counted as running between its tasks, from before it is submitted until it was waited on
+    void startJob();
+    void finishJob();
+
+private:
+    std::unique_ptr<Counters[]> counters;
+    std::chrono::steady_clock::time_point begin;
+    std::chrono::steady_clock::time_point end;
+    mutable std::mutex mutex;
+    std::atomic<u64> skipped { 0 };
+    std::atomic<int> active { 0 };
+    std::atomic<int> next { 0 };
+    u64 total = 0;
+    int workers = 0;
+    bool scheduled = false;
+
+    void finishWorker();
+};
+
+#endif // SEARCHSTATS_HPP
@@ -0,0 +1,81 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SpillFile.hpp"
+
+SpillFile::~SpillFile()
+{
+    close();
+}
+
+bool SpillFile::open(const std::string &fileName)
+{
+    close();
+    file = fileName.empty() ? std::tmpfile() : std::fopen(fileName.c_str(), "w+b");
+    return file != nullptr;
+}
+
+bool SpillFile::write(const void *data, size_t size)
+{
+    if (!file || !seek(writeOffset) || std::fwrite(data, 1, size, file) != size)
+    {
+        return false;
+    }
+
+    writeOffset += size;
+    return true;
+}
+
+bool SpillFile::read(void *data, size_t size)
+{
+    if (!file || size > getPending() || !seek(readOffset) || std::fread(data, 1, size, file) != size)
+    {
+        return false;
+    }
+
+    // Start over once the queue is empty so the file only grows to the largest backlog
+    readOffset += size;
+    if (readOffset == writeOffset)
+    {
+        readOffset = 0;
+        writeOffset = 0;
+    }
+    return true;
+}
+
+void SpillFile::close()
+{
+    if (file)
+    {
+        std::fclose(file);
+        file = nullptr;
+    }
+    readOffset = 0;
+    writeOffset = 0;
+}
+
+bool SpillFile::seek(u64 offset)
+{
+    // A stream opened for update has to be positioned between reads and writes, which also covers files past 2 GiB
+#ifdef _WIN32
+    return _fseeki64(file, static_cast<__int64>(offset), SEEK_SET) == 0;
+#else
+    return fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+}
@@ -0,0 +1,69 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SPILLFILE_HPP
+#define SPILLFILE_HPP
+
+#include <Core/Util/Global.hpp>
+#include <cstdio>
+#include <string>
+
+// First in first out byte queue kept in a file for the results that do not fit in the memory budget of a search. Once
+// everything written was read the file is reused from the start.
+class SpillFile
+{
+public:
+    SpillFile() = default;
+
+    ~SpillFile();
+
+    SpillFile(const SpillFile &) = delete;
+
+    SpillFile &operator=(const SpillFile &) = delete;
+
+    // Discards what the file contained, an empty name opens a temporary file that is removed when it is closed
+    bool open(const std::string &fileName);
+
+    bool isOpen() const
+    {
+        return file != nullptr;
+    }
+
+    bool write(const void *data, size_t size);
+
+    // Fails if the queue holds less than size bytes
+    bool read(void *data, size_t size);
+
+    // Bytes written but not read yet
+    u64 getPending() const
+    {
+        return writeOffset - readOffset;
+    }
+
+    void close();
+
+private:
+    FILE *file = nullptr;
+    u64 readOffset = 0;
+    u64 writeOffset = 0;
+
+    bool seek(u64 offset);
+};
+
+#endif // SPILLFILE_HPP
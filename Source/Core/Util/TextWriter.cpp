@@ -0,0 +1,123 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "TextWriter.hpp"
+#include <cstring>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+constexpr size_t bufferSize = 1 << 20;
+
+static FILE *openFile(const std::string &fileName)
+{
+#ifdef _WIN32
+    // fopen interprets the name in the ANSI code page, so go through the wide API for non-ASCII paths
+    int size = MultiByteToWideChar(CP_UTF8, 0, fileName.c_str(), -1, nullptr, 0);
+    if (size == 0)
+    {
+        return nullptr;
+    }
+
+    std::wstring wide(size, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, fileName.c_str(), -1, wide.data(), size);
+    return _wfopen(wide.c_str(), L"wb");
+#else
+    return std::fopen(fileName.c_str(), "wb");
+#endif
+}
+
+TextWriter::TextWriter(const std::string &fileName, char delimiter) :
+    buffer(bufferSize), file(openFile(fileName)), length(0), delimiter(delimiter), column(false), failed(false)
+{
+}
+
+TextWriter::~TextWriter()
+{
+    if (file)
+    {
+        flush();
+        std::fclose(file);
+    }
+}
+
+bool TextWriter::hasError() const
+{
+    return failed;
+}
+
+bool TextWriter::isOpen() const
+{
+    return file != nullptr;
+}
+
+void TextWriter::writeString(std::string_view string)
+{
+    if (string.empty())
+    {
+        string = "-";
+    }
+
+    char *out = reserve(string.size());
+    std::memcpy(out, string.data(), string.size());
+}
+
+void TextWriter::nextRow()
+{
+    column = false;
+    if (length == buffer.size())
+    {
+        flush();
+    }
+    buffer[length++] = '\n';
+}
+
+void TextWriter::flush()
+{
+    if (file && !failed && length != 0)
+    {
+        failed = std::fwrite(buffer.data(), 1, length, file) != length || std::fflush(file) != 0;
+    }
+    length = 0;
+}
+
+char *TextWriter::reserve(size_t size)
+{
+    // One extra character for the delimiter
+    if (length + size + 1 > buffer.size())
+    {
+        flush();
+        if (size + 1 > buffer.size())
+        {
+            buffer.resize(size + 1);
+        }
+    }
+
+    if (column)
+    {
+        buffer[length++] = delimiter;
+    }
+    column = true;
+
+    char *out = &buffer[length];
+    length += size;
+    return out;
+}
@@ -0,0 +1,61 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TEXTWRITER_HPP
+#define TEXTWRITER_HPP
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Buffered writer for delimited text, every write starts a new column of the current row
+class TextWriter
+{
+public:
+    TextWriter(const std::string &fileName, char delimiter);
+
+    ~TextWriter();
+
+    TextWriter(const TextWriter &) = delete;
+
+    TextWriter &operator=(const TextWriter &) = delete;
+
+    bool hasError() const;
+
+    bool isOpen() const;
+
+    void writeString(std::string_view string);
+
+    void nextRow();
+
+    void flush();
+
+private:
+    std::vector<char> buffer;
+    FILE *file;
+    size_t length;
+    char delimiter;
+    bool column;
+    bool failed;
+
+    char *reserve(size_t size);
+};
+
+#endif // TEXTWRITER_HPP
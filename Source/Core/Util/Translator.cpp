@@ -21,378 +21,47 @@
 #include <Core/Enum/Game.hpp>
 #include <Core/Resources/I18n.hpp>
 #include <algorithm>
-#include <map>
-#include <sstream>
+#include <iterator>
 
 namespace
 {
-    std::string language;
-    std::vector<std::string> characteristics;
-    std::vector<std::string> natures;
-    std::vector<std::string> hiddenPowers;
-    std::vector<std::string> species;
-    const std::vector<std::string> genders = { "♂", "♀", "-" };
-    const std::vector<std::string> buttons = { "R", "L", "X", "Y", "A", "B", "Select", "Start", "Right", "Left", "Up", "Down" };
+    Locale language = Locale::English;
+    constexpr std::string_view genders[3] = { "♂", "♀", "-" };
+    constexpr std::string_view buttons[12] = { "R", "L", "X", "Y", "A", "B", "Select", "Start", "Right", "Left", "Up", "Down" };
 
-    std::vector<std::string> readFile(const std::string &name)
+    constexpr std::pair<std::string_view, Locale> locales[8]
+        = { { "de", Locale::German },   { "en", Locale::English },  { "es", Locale::Spanish }, { "fr", Locale::French },
+            { "it", Locale::Italian },  { "ja", Locale::Japanese }, { "ko", Locale::Korean },  { "zh", Locale::Chinese } };
+
+    u32 getValue(const u8 *data, u32 offset)
     {
-        const u8 *data;
-        size_t size = 0;
+        return static_cast<u32>(data[offset]) | (data[offset + 1] << 8) | (data[offset + 2] << 16) | (data[offset + 3] << 24);
+    }
 
-        if (language == "de")
-        {
-            if (name == "characteristic")
-            {
-                data = characteristic_de.data();
-                size = characteristic_de.size();
-            }
-            else if (name == "natures")
-            {
-                data = natures_de.data();
-                size = natures_de.size();
-            }
-            else if (name == "powers")
-            {
-                data = powers_de.data();
-                size = powers_de.size();
-            }
-            else if (name == "species")
-            {
-                data = species_de.data();
-                size = species_de.size();
-            }
-            else if (name == "frlg")
-            {
-                data = frlg_de.data();
-                size = frlg_de.size();
-            }
-            else if (name == "rse")
-            {
-                data = rse_de.data();
-                size = rse_de.size();
-            }
-            else if (name == "dppt")
-            {
-                data = dppt_de.data();
-                size = dppt_de.size();
-            }
-            else if (name == "hgss")
-            {
-                data = hgss_de.data();
-                size = hgss_de.size();
-            }
-        }
-        else if (language == "en")
-        {
-            if (name == "characteristic")
-            {
-                data = characteristic_en.data();
-                size = characteristic_en.size();
-            }
-            else if (name == "natures")
-            {
-                data = natures_en.data();
-                size = natures_en.size();
-            }
-            else if (name == "powers")
-            {
-                data = powers_en.data();
-                size = powers_en.size();
-            }
-            else if (name == "species")
-            {
-                data = species_en.data();
-                size = species_en.size();
-            }
-            else if (name == "frlg")
-            {
-                data = frlg_en.data();
-                size = frlg_en.size();
-            }
-            else if (name == "rse")
-            {
-                data = rse_en.data();
-                size = rse_en.size();
-            }
-            else if (name == "dppt")
-            {
-                data = dppt_en.data();
-                size = dppt_en.size();
-            }
-            else if (name == "hgss")
-            {
-                data = hgss_en.data();
-                size = hgss_en.size();
-            }
-        }
-        else if (language == "es")
-        {
-            if (name == "characteristic")
-            {
-                data = characteristic_es.data();
-                size = characteristic_es.size();
-            }
-            else if (name == "natures")
-            {
-                data = natures_es.data();
-                size = natures_es.size();
-            }
-            else if (name == "powers")
-            {
-                data = powers_es.data();
-                size = powers_es.size();
-            }
-            else if (name == "species")
-            {
-                data = species_es.data();
-                size = species_es.size();
-            }
-            else if (name == "frlg")
-            {
-                data = frlg_es.data();
-                size = frlg_es.size();
-            }
-            else if (name == "rse")
-            {
-                data = rse_es.data();
-                size = rse_es.size();
-            }
-            else if (name == "dppt")
-            {
-                data = dppt_es.data();
-                size = dppt_es.size();
-            }
-            else if (name == "hgss")
-            {
-                data = hgss_es.data();
-                size = hgss_es.size();
-            }
-        }
-        else if (language == "fr")
-        {
-            if (name == "characteristic")
-            {
-                data = characteristic_fr.data();
-                size = characteristic_fr.size();
-            }
-            else if (name == "natures")
-            {
-                data = natures_fr.data();
-                size = natures_fr.size();
-            }
-            else if (name == "powers")
-            {
-                data = powers_fr.data();
-                size = powers_fr.size();
-            }
-            else if (name == "species")
-            {
-                data = species_fr.data();
-                size = species_fr.size();
-            }
-            else if (name == "frlg")
-            {
-                data = frlg_fr.data();
-                size = frlg_fr.size();
-            }
-            else if (name == "rse")
-            {
-                data = rse_fr.data();
-                size = rse_fr.size();
-            }
-            else if (name == "dppt")
-            {
-                data = dppt_fr.data();
-                size = dppt_fr.size();
-            }
-            else if (name == "hgss")
-            {
-                data = hgss_fr.data();
-                size = hgss_fr.size();
-            }
-        }
-        else if (language == "it")
-        {
-            if (name == "characteristic")
-            {
-                data = characteristic_it.data();
-                size = characteristic_it.size();
-            }
-            else if (name == "natures")
-            {
-                data = natures_it.data();
-                size = natures_it.size();
-            }
-            else if (name == "powers")
-            {
-                data = powers_it.data();
-                size = powers_it.size();
-            }
-            else if (name == "species")
-            {
-                data = species_it.data();
-                size = species_it.size();
-            }
-            else if (name == "frlg")
-            {
-                data = frlg_it.data();
-                size = frlg_it.size();
-            }
-            else if (name == "rse")
-            {
-                data = rse_it.data();
-                size = rse_it.size();
-            }
-            else if (name == "dppt")
-            {
-                data = dppt_it.data();
-                size = dppt_it.size();
-            }
-            else if (name == "hgss")
-            {
-                data = hgss_it.data();
-                size = hgss_it.size();
-            }
-        }
-        else if (language == "ja")
-        {
-            if (name == "characteristic")
-            {
-                data = characteristic_ja.data();
-                size = characteristic_ja.size();
-            }
-            else if (name == "natures")
-            {
-                data = natures_ja.data();
-                size = natures_ja.size();
-            }
-            else if (name == "powers")
-            {
-                data = powers_ja.data();
-                size = powers_ja.size();
-            }
-            else if (name == "species")
-            {
-                data = species_ja.data();
-                size = species_ja.size();
-            }
-            else if (name == "frlg")
-            {
-                data = frlg_ja.data();
-                size = frlg_ja.size();
-            }
-            else if (name == "rse")
-            {
-                data = rse_ja.data();
-                size = rse_ja.size();
-            }
-            else if (name == "dppt")
-            {
-                data = dppt_ja.data();
-                size = dppt_ja.size();
-            }
-            else if (name == "hgss")
-            {
-                data = hgss_ja.data();
-                size = hgss_ja.size();
-            }
-        }
-        else if (language == "ko")
-        {
-            if (name == "characteristic")
-            {
-                data = characteristic_ko.data();
-                size = characteristic_ko.size();
-            }
-            else if (name == "natures")
-            {
-                data = natures_ko.data();
-                size = natures_ko.size();
-            }
-            else if (name == "powers")
-            {
-                data = powers_ko.data();
-                size = powers_ko.size();
-            }
-            else if (name == "species")
-            {
-                data = species_ko.data();
-                size = species_ko.size();
-            }
-            else if (name == "frlg")
-            {
-                data = frlg_ko.data();
-                size = frlg_ko.size();
-            }
-            else if (name == "rse")
-            {
-                data = rse_ko.data();
-                size = rse_ko.size();
-            }
-            else if (name == "dppt")
-            {
-                data = dppt_ko.data();
-                size = dppt_ko.size();
-            }
-            else if (name == "hgss")
-            {
-                data = hgss_ko.data();
-                size = hgss_ko.size();
-            }
-        }
-        else if (language == "zh")
-        {
-            if (name == "characteristic")
-            {
-                data = characteristic_zh.data();
-                size = characteristic_zh.size();
-            }
-            else if (name == "natures")
-            {
-                data = natures_zh.data();
-                size = natures_zh.size();
-            }
-            else if (name == "powers")
-            {
-                data = powers_zh.data();
-                size = powers_zh.size();
-            }
-            else if (name == "species")
-            {
-                data = species_zh.data();
-                size = species_zh.size();
-            }
-            else if (name == "frlg")
-            {
-                data = frlg_zh.data();
-                size = frlg_zh.size();
-            }
-            else if (name == "rse")
-            {
-                data = rse_zh.data();
-                size = rse_zh.size();
-            }
-            else if (name == "dppt")
-            {
-                data = dppt_zh.data();
-                size = dppt_zh.size();
-            }
-            else if (name == "hgss")
-            {
-                data = hgss_zh.data();
-                size = hgss_zh.size();
-            }
-        }
+    // Tables are generated by embed.py as the string count, the offset of each string and the end offset, followed by the strings
+    u32 getCount(Translation file)
+    {
+        return getValue(i18n[static_cast<u8>(language)][static_cast<u8>(file)].data(), 0);
+    }
+
+    std::string_view getString(Translation file, u32 index)
+    {
+        const u8 *data = i18n[static_cast<u8>(language)][static_cast<u8>(file)].data();
+
+        u32 start = getValue(data, 4 + index * 4);
+        u32 end = getValue(data, 8 + index * 4);
+        return std::string_view(reinterpret_cast<const char *>(data + start), end - start - 1);
+    }
+
+    std::vector<std::string_view> getStrings(Translation file)
+    {
+        u32 count = getCount(file);
 
-        std::vector<std::string> strings;
-        size_t start = 0;
-        for (size_t i = 0; i < size; i++)
+        std::vector<std::string_view> strings;
+        strings.reserve(count);
+        for (u32 i = 0; i < count; i++)
         {
-            if (data[i] == 0)
-            {
-                strings.emplace_back((const char *)&data[start], i - start);
-                start = i + 1;
-            }
+            strings.emplace_back(getString(file, i));
         }
 
         return strings;
@@ -403,103 +72,88 @@ namespace Translator
 {
     void init(const std::string &locale)
     {
-        language = locale;
-
-        characteristics = readFile("characteristic");
-        natures = readFile("natures");
-        hiddenPowers = readFile("powers");
-        species = readFile("species");
+        auto it = std::find_if(std::begin(locales), std::end(locales), [&locale](const auto &entry) { return entry.first == locale; });
+        language = it != std::end(locales) ? it->second : Locale::English;
     }
 
-    std::vector<std::string> getCharacteristic()
+    std::vector<std::string_view> getCharacteristic()
     {
-        return characteristics;
+        return getStrings(Translation::Characteristic);
     }
 
-    std::vector<std::string> getNatures()
+    std::vector<std::string_view> getNatures()
     {
-        return natures;
+        return getStrings(Translation::Natures);
     }
 
-    std::string getNature(u8 nature)
+    std::string_view getNature(u8 nature)
     {
-        return natures[nature];
+        return getString(Translation::Natures, nature);
     }
 
-    std::vector<std::string> getHiddenPowers()
+    std::vector<std::string_view> getHiddenPowers()
     {
-        return hiddenPowers;
+        return getStrings(Translation::Powers);
     }
 
-    std::string getHiddenPower(u8 power)
+    std::string_view getHiddenPower(u8 power)
     {
-        return hiddenPowers[power];
+        return getString(Translation::Powers, power);
     }
 
-    std::string getSpecies(u16 specie)
+    std::string_view getSpecies(u16 specie)
     {
-        return species[specie - 1];
+        return getString(Translation::Species, specie - 1);
     }
 
-    std::vector<std::string> getSpecies(const std::vector<u16> &nums)
+    std::vector<std::string_view> getSpecies(const std::vector<u16> &nums)
     {
-        std::vector<std::string> s;
-        std::transform(nums.begin(), nums.end(), std::back_inserter(s), [](u16 num) { return species[num - 1]; });
+        std::vector<std::string_view> s;
+        std::transform(nums.begin(), nums.end(), std::back_inserter(s), [](u16 num) { return getString(Translation::Species, num - 1); });
         return s;
     }
 
-    std::string getGender(u8 gender)
+    std::string_view getGender(u8 gender)
     {
         return genders[gender];
     }
 
-    std::vector<std::string> getGenders()
+    std::vector<std::string_view> getGenders()
     {
-        return genders;
+        return std::vector<std::string_view>(std::begin(genders), std::end(genders));
     }
 
-    std::vector<std::string> getLocations(const std::vector<u8> &nums, Game game)
+    std::vector<std::string_view> getLocations(const std::vector<u8> &nums, Game game)
     {
-        std::vector<std::string> strings;
+        Translation file;
         if (game & Game::FRLG)
         {
-            strings = readFile("frlg");
+            file = Translation::FRLG;
         }
         else if (game & Game::RSE)
         {
-            strings = readFile("rse");
+            file = Translation::RSE;
         }
         else if (game & Game::DPPt)
         {
-            strings = readFile("dppt");
+            file = Translation::DPPt;
         }
         else
         {
-            strings = readFile("hgss");
+            file = Translation::HGSS;
         }
 
-        std::map<int, std::string> map;
-        for (const std::string &string : strings)
-        {
-            std::vector<std::string> entry;
-
-            std::string token;
-            std::istringstream stream(string);
-            while (std::getline(stream, token, ','))
-            {
-                entry.emplace_back(token);
-            }
-
-            map.emplace(std::stoi(entry[0]), entry[1]);
-        }
+        // Location tables are indexed directly by the location number
+        u32 count = getCount(file);
 
-        std::vector<std::string> locations;
-        std::transform(nums.begin(), nums.end(), std::back_inserter(locations), [&map](u8 num) { return map[num]; });
+        std::vector<std::string_view> locations;
+        std::transform(nums.begin(), nums.end(), std::back_inserter(locations),
+                       [file, count](u8 num) { return num < count ? getString(file, num) : std::string_view(); });
 
         return locations;
     }
 
-    std::string getKeypress(u8 keypress)
+    std::string_view getKeypress(u8 keypress)
     {
         return buttons[keypress];
     }
@@ -22,6 +22,7 @@
 
 #include <Core/Util/Global.hpp>
 #include <string>
+#include <string_view>
 #include <vector>
 
 enum Game : u16;
@@ -29,17 +30,17 @@ enum Game : u16;
 namespace Translator
 {
     void init(const std::string &locale);
-    std::vector<std::string> getCharacteristic();
-    std::vector<std::string> getNatures();
-    std::string getNature(u8 nature);
-    std::vector<std::string> getHiddenPowers();
-    std::string getHiddenPower(u8 power);
-    std::string getSpecies(u16 specie);
-    std::vector<std::string> getSpecies(const std::vector<u16> &nums);
-    std::string getGender(u8 gender);
-    std::vector<std::string> getGenders();
-    std::vector<std::string> getLocations(const std::vector<u8> &nums, Game game);
-    std::string getKeypress(u8 keypress);
+    std::vector<std::string_view> getCharacteristic();
+    std::vector<std::string_view> getNatures();
+    std::string_view getNature(u8 nature);
+    std::vector<std::string_view> getHiddenPowers();
+    std::string_view getHiddenPower(u8 power);
+    std::string_view getSpecies(u16 specie);
+    std::vector<std::string_view> getSpecies(const std::vector<u16> &nums);
+    std::string_view getGender(u8 gender);
+    std::vector<std::string_view> getGenders();
+    std::vector<std::string_view> getLocations(const std::vector<u8> &nums, Game game);
+    std::string_view getKeypress(u8 keypress);
     std::string getKeypresses(u16 keypresses);
 }
 
@@ -22,6 +22,8 @@
 #include <Core/RNG/LCRNG.hpp>
 #include <Core/RNG/LCRNG64.hpp>
 #include <Core/RNG/MT.hpp>
+#include <algorithm>
+#include <iterator>
 
 namespace
 {
@@ -80,6 +82,131 @@ namespace
         return count;
     }
 
+    // Number of seeds evaluated side by side by the batched initial advance calculations
+    constexpr size_t lanes = 8;
+
+    // Lane parallel version of advanceProbabilityTable. Every lane executes the same instructions with the
+    // data dependent branches replaced by all ones/all zeros masks so the compiler is free to vectorize the lanes.
+    struct BWRNGLanes
+    {
+        u64 seed[lanes];
+        u32 count[lanes];
+
+        BWRNGLanes(const u64 *seeds, size_t size) : seed {}, count {}
+        {
+            std::copy(seeds, seeds + size, seed);
+        }
+
+        // Advances every lane whose mask is set and stores the drawn value in rand
+        void next(const u64 *mask, u32 max, u32 *rand)
+        {
+            for (size_t i = 0; i < lanes; i++)
+            {
+                u64 next = seed[i] * 0x5d588b656c078965 + 0x269ec3;
+                seed[i] ^= (seed[i] ^ next) & mask[i];
+                rand[i] = ((next >> 32) * max) >> 32;
+            }
+        }
+
+        void advance(u32 advances)
+        {
+            for (u32 advance = 0; advance < advances; advance++)
+            {
+                for (u64 &s : seed)
+                {
+                    s = s * 0x5d588b656c078965 + 0x269ec3;
+                }
+            }
+        }
+
+        // Each round of the table adds one advance, then keeps drawing while the draw passes every threshold
+        // and finally advances once more if all draws passed
+        template <size_t size>
+        void round(const u32 (&thresholds)[size])
+        {
+            u64 active[lanes];
+            u32 rand[lanes];
+            for (size_t i = 0; i < lanes; i++)
+            {
+                active[i] = ~0ull;
+                count[i]++;
+            }
+
+            for (u32 threshold : thresholds)
+            {
+                next(active, 101, rand);
+                for (size_t i = 0; i < lanes; i++)
+                {
+                    active[i] &= 0ull - (rand[i] > threshold);
+                    count[i] += active[i] & 1;
+                }
+            }
+
+            next(active, 0, rand);
+        }
+
+        void advanceProbabilityTable()
+        {
+            // Round 1 has no draws and the thresholds of the remaining rounds match the scalar version
+            for (size_t i = 0; i < lanes; i++)
+            {
+                count[i]++;
+            }
+            advance(1);
+
+            round({ 50 });
+            round({ 30 });
+            round({ 25, 30 });
+            round({ 20, 25, 33 });
+        }
+
+        // Draws three values per round until they are all unique or 100 rounds have passed
+        void uniqueDraws()
+        {
+            u64 active[lanes];
+            std::fill(std::begin(active), std::end(active), ~0ull);
+
+            for (u8 limit = 0; limit < 100; limit++)
+            {
+                u32 rand1[lanes], rand2[lanes], rand3[lanes];
+                next(active, 15, rand1);
+                next(active, 15, rand2);
+                next(active, 15, rand3);
+
+                u64 remaining = 0;
+                for (size_t i = 0; i < lanes; i++)
+                {
+                    count[i] += active[i] & 3;
+                    active[i] &= 0ull - (rand1[i] == rand2[i] || rand1[i] == rand3[i] || rand2[i] == rand3[i]);
+                    remaining |= active[i];
+                }
+
+                if (remaining == 0)
+                {
+                    break;
+                }
+            }
+        }
+    };
+
+    template <class Function>
+    std::vector<u32> initialAdvancesLanes(const std::vector<u64> &seeds, u32 count, Function function)
+    {
+        std::vector<u32> advances(seeds.size());
+        for (size_t i = 0; i < seeds.size(); i += lanes)
+        {
+            size_t size = std::min(lanes, seeds.size() - i);
+
+            BWRNGLanes rng(&seeds[i], size);
+            function(rng);
+            for (size_t j = 0; j < size; j++)
+            {
+                advances[i + j] = rng.count[j] + count;
+            }
+        }
+        return advances;
+    }
+
     std::string getPitch(u8 result)
     {
         std::string pitch;
@@ -288,6 +415,62 @@ namespace Utilities
         return count;
     }
 
+    std::vector<u32> initialAdvancesBW(const std::vector<u64> &seeds)
+    {
+        return initialAdvancesLanes(seeds, 0, [](BWRNGLanes &rng) {
+            for (u8 i = 0; i < 5; i++)
+            {
+                rng.advanceProbabilityTable();
+            }
+        });
+    }
+
+    std::vector<u32> initialAdvancesBW2(const std::vector<u64> &seeds, bool memory)
+    {
+        return initialAdvancesLanes(seeds, memory ? 2 : 3, [memory](BWRNGLanes &rng) {
+            for (u8 i = 0; i < 5; i++)
+            {
+                rng.advanceProbabilityTable();
+
+                if (i == 0)
+                {
+                    rng.advance(memory ? 2 : 3);
+                }
+            }
+
+            rng.uniqueDraws();
+        });
+    }
+
+    std::vector<u32> initialAdvancesBWID(const std::vector<u64> &seeds)
+    {
+        return initialAdvancesLanes(seeds, 2, [](BWRNGLanes &rng) {
+            for (u8 i = 0; i < 3; i++)
+            {
+                rng.advanceProbabilityTable();
+            }
+        });
+    }
+
+    std::vector<u32> initialAdvancesBW2ID(const std::vector<u64> &seeds)
+    {
+        return initialAdvancesLanes(seeds, 10, [](BWRNGLanes &rng) {
+            for (u8 i = 0; i < 3; i++)
+            {
+                rng.advanceProbabilityTable();
+
+                if (i == 0)
+                {
+                    rng.advance(2);
+                }
+                else if (i == 1)
+                {
+                    rng.advance(4);
+                }
+            }
+        });
+    }
+
     u32 forceGender(u32 pid, u64 rand, u8 gender, u8 genderRatio)
     {
         pid &= 0xffffff00;
@@ -23,6 +23,7 @@
 #include <Core/Util/DateTime.hpp>
 #include <Core/Util/Global.hpp>
 #include <string>
+#include <vector>
 
 class HGSSRoamer;
 
@@ -38,6 +39,10 @@ namespace Utilities
     u32 initialAdvancesBW2(u64 seed, bool memory);
     u32 initialAdvancesBWID(u64 seed);
     u32 initialAdvancesBW2ID(u64 seed);
+    std::vector<u32> initialAdvancesBW(const std::vector<u64> &seeds);
+    std::vector<u32> initialAdvancesBW2(const std::vector<u64> &seeds, bool memory);
+    std::vector<u32> initialAdvancesBWID(const std::vector<u64> &seeds);
+    std::vector<u32> initialAdvancesBW2ID(const std::vector<u64> &seeds);
     u32 forceGender(u32 pid, u64 rand, u8 gender, u8 genderRatio);
 }
 
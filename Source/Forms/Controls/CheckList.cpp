@@ -37,14 +37,14 @@ CheckList::CheckList(QWidget *parent) : QComboBox(parent)
     connect(model, &QAbstractItemModel::dataChanged, this, &CheckList::modelDataChanged);
 }
 
-void CheckList::setup(const std::vector<std::string> &items)
+void CheckList::setup(const std::vector<std::string_view> &items)
 {
     if (!items.empty())
     {
         clear();
-        for (const std::string &item : items)
+        for (std::string_view item : items)
         {
-            addItem(QString::fromStdString(item));
+            addItem(QString::fromUtf8(item));
         }
     }
 
@@ -21,6 +21,7 @@
 #define CHECKLIST
 
 #include <QComboBox>
+#include <string_view>
 
 class QStandardItemModel;
 
@@ -29,7 +30,7 @@ class CheckList : public QComboBox
     Q_OBJECT
 public:
     explicit CheckList(QWidget *parent = nullptr);
-    void setup(const std::vector<std::string> &items = std::vector<std::string>());
+    void setup(const std::vector<std::string_view> &items = std::vector<std::string_view>());
     std::vector<bool> getChecked() const;
     void setChecks(std::vector<bool> flags);
 
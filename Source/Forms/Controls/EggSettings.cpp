@@ -196,19 +196,19 @@ bool EggSettings::reorderParents()
 
 void EggSettings::setupModels()
 {
-    for (const std::string &nature : Translator::getNatures())
+    for (std::string_view nature : Translator::getNatures())
     {
-        ui->comboBoxParentANature->addItem(QString::fromStdString(nature));
-        ui->comboBoxParentBNature->addItem(QString::fromStdString(nature));
+        ui->comboBoxParentANature->addItem(QString::fromUtf8(nature));
+        ui->comboBoxParentBNature->addItem(QString::fromUtf8(nature));
     }
 
     for (u8 i = 0; i < 3; i++)
     {
-        ui->comboBoxParentAGender->addItem(QString::fromStdString(Translator::getGender(i)));
-        ui->comboBoxParentBGender->addItem(QString::fromStdString(Translator::getGender(i)));
+        ui->comboBoxParentAGender->addItem(QString::fromUtf8(Translator::getGender(i)));
+        ui->comboBoxParentBGender->addItem(QString::fromUtf8(Translator::getGender(i)));
     }
-    ui->comboBoxParentAGender->addItem(QString::fromStdString(Translator::getSpecies(132)));
-    ui->comboBoxParentBGender->addItem(QString::fromStdString(Translator::getSpecies(132)));
+    ui->comboBoxParentAGender->addItem(QString::fromUtf8(Translator::getSpecies(132)));
+    ui->comboBoxParentBGender->addItem(QString::fromUtf8(Translator::getSpecies(132)));
 
     ui->comboBoxParentAAbility->addItem("1");
     ui->comboBoxParentAAbility->addItem("2");
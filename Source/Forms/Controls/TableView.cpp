@@ -18,6 +18,7 @@
  */
 
 #include "TableView.hpp"
+#include <Forms/Models/TableModel.hpp>
 #include <QApplication>
 #include <QClipboard>
 #include <QFileDialog>
@@ -64,10 +65,21 @@ void TableView::outputModel(bool csv) const
         return;
     }
 
+    // Table models write their rows on a worker thread
+    if (auto *exportModel = dynamic_cast<ExportModel *>(this->model()))
+    {
+        exportModel->exportModel(fileName, csv);
+        return;
+    }
+
     QFile file(fileName);
     if (file.open(QIODevice::WriteOnly))
     {
         QAbstractItemModel *model = this->model();
+        while (model->canFetchMore(QModelIndex()))
+        {
+            model->fetchMore(QModelIndex());
+        }
 
         QTextStream ts(&file);
         int rows = model->rowCount();
@@ -75,7 +75,7 @@ std::vector<bool> UnownFilter::getLetters()
     return ui->checkListLetter->getChecked();
 }
 
-void UnownFilter::setLetters(const std::vector<std::string> &letters) const
+void UnownFilter::setLetters(const std::vector<std::string_view> &letters) const
 {
     ui->checkListLetter->setup(letters);
 }
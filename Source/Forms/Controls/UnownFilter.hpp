@@ -42,7 +42,7 @@ public:
     u8 getGender() const;
     u8 getGenderRatio() const;
     std::vector<bool> getLetters();
-    void setLetters(const std::vector<std::string> &letters) const;
+    void setLetters(const std::vector<std::string_view> &letters) const;
     void toggleLetters(const std::vector<bool> &letters) const;
     void resetLetters() const;
     std::vector<bool> getHiddenPowers();
@@ -249,13 +249,13 @@ void GameCube::generatorMethodIndexChanged(int index)
 
         if (method == Method::XD)
         {
-            std::vector<std::string> species = Translator::getSpecies(
+            std::vector<std::string_view> species = Translator::getSpecies(
                 { 334, 24,  354, 12,  113, 301, 85,  149, 51,  355, 125, 83,  55,  88,  58,  316, 316, 316, 107, 106, 97, 115, 131, 165,
                   108, 337, 219, 126, 82,  296, 310, 105, 303, 52,  122, 177, 299, 322, 46,  17,  204, 127, 62,  261, 57, 280, 78,  20,
                   315, 302, 373, 123, 273, 273, 273, 86,  285, 143, 361, 338, 21,  363, 363, 363, 167, 121, 220, 114, 49, 100, 37,  70 });
             for (size_t i = 0; i < species.size(); i++)
             {
-                QString specie = QString::fromStdString(species[i]);
+                QString specie = QString::fromUtf8(species[i]);
                 if (i == 15 || i == 52 || i == 61)
                 {
                     specie += tr(" (Citadark)");
@@ -282,10 +282,10 @@ void GameCube::generatorMethodIndexChanged(int index)
         }
         else if (method == Method::Colo)
         {
-            std::vector<std::string> species = Translator::getSpecies({ 207, 214, 296, 179, 198, 212, 175, 217 });
+            std::vector<std::string_view> species = Translator::getSpecies({ 207, 214, 296, 179, 198, 212, 175, 217 });
             for (size_t i = 0; i < species.size(); i++)
             {
-                QString specie = QString::fromStdString(species[i]);
+                QString specie = QString::fromUtf8(species[i]);
                 if (i == 3 || i == 5 || i == 6)
                 {
                     specie += tr(" (E-Reader)");
@@ -338,13 +338,13 @@ void GameCube::searcherMethodIndexChanged(int index)
 
         if (method == Method::XD)
         {
-            std::vector<std::string> species = Translator::getSpecies(
+            std::vector<std::string_view> species = Translator::getSpecies(
                 { 334, 24,  354, 12,  113, 301, 85,  149, 51,  355, 125, 83,  55,  88,  58,  316, 316, 316, 107, 106, 97, 115, 131, 165,
                   108, 337, 219, 126, 82,  296, 310, 105, 303, 52,  122, 177, 299, 322, 46,  17,  204, 127, 62,  261, 57, 280, 78,  20,
                   315, 302, 373, 123, 273, 273, 273, 86,  285, 143, 361, 338, 21,  363, 363, 363, 167, 121, 220, 114, 49, 100, 37,  70 });
             for (size_t i = 0; i < species.size(); i++)
             {
-                QString specie = QString::fromStdString(species[i]);
+                QString specie = QString::fromUtf8(species[i]);
                 if (i == 15 || i == 52 || i == 61)
                 {
                     specie += tr(" (Citadark)");
@@ -365,10 +365,10 @@ void GameCube::searcherMethodIndexChanged(int index)
         }
         else if (method == Method::Colo)
         {
-            std::vector<std::string> species = Translator::getSpecies({ 207, 214, 296, 179, 198, 212, 175, 217 });
+            std::vector<std::string_view> species = Translator::getSpecies({ 207, 214, 296, 179, 198, 212, 175, 217 });
             for (size_t i = 0; i < species.size(); i++)
             {
-                QString specie = QString::fromStdString(species[i]);
+                QString specie = QString::fromUtf8(species[i]);
                 if (i == 3 || i == 5 || i == 6)
                 {
                     specie += tr(" (E-Reader)");
@@ -122,7 +122,7 @@ void JirachiChecksum::generateJirachi(QList<QStandardItem *> *row, u16 seed) con
     state.setIVs(iv1, iv2);
     *row << new QStandardItem(QString::number(state.getPID(),16).toUpper());
     *row << new QStandardItem(state.getShiny() == 2 ? tr("Square") : state.getShiny() == 1 ? tr("Star") : tr("No"));
-    *row << new QStandardItem(QString::fromStdString(Translator::getNature(state.getNature())));
+    *row << new QStandardItem(QString::fromUtf8(Translator::getNature(state.getNature())));
     *row << new QStandardItem(QString::number(state.getIV(0)));
     *row << new QStandardItem(QString::number(state.getIV(1)));
     *row << new QStandardItem(QString::number(state.getIV(2)));
@@ -152,7 +152,7 @@ void Wild3::updateLocationsGenerator()
     std::transform(encounterGenerator.begin(), encounterGenerator.end(), std::back_inserter(locs),
                    [](const EncounterArea3 &area) { return area.getLocation(); });
 
-    std::vector<std::string> locations = Translator::getLocations(locs, currentProfile.getVersion());
+    std::vector<std::string_view> locations = Translator::getLocations(locs, currentProfile.getVersion());
     std::vector<int> indices(locations.size());
     std::iota(indices.begin(), indices.end(), 0);
     std::sort(indices.begin(), indices.end(), [&locations](int i, int j) { return locations[i] < locations[j]; });
@@ -160,7 +160,7 @@ void Wild3::updateLocationsGenerator()
     ui->comboBoxGeneratorLocation->clear();
     for (int index : indices)
     {
-        ui->comboBoxGeneratorLocation->addItem(QString::fromStdString(locations[index]), index);
+        ui->comboBoxGeneratorLocation->addItem(QString::fromUtf8(locations[index]), index);
     }
 }
 
@@ -173,7 +173,7 @@ void Wild3::updateLocationsSearcher()
     std::transform(encounterSearcher.begin(), encounterSearcher.end(), std::back_inserter(locs),
                    [](const EncounterArea3 &area) { return area.getLocation(); });
 
-    std::vector<std::string> locations = Translator::getLocations(locs, currentProfile.getVersion());
+    std::vector<std::string_view> locations = Translator::getLocations(locs, currentProfile.getVersion());
     std::vector<int> indices(locations.size());
     std::iota(indices.begin(), indices.end(), 0);
     std::sort(indices.begin(), indices.end(), [&locations](int i, int j) { return locations[i] < locations[j]; });
@@ -181,7 +181,7 @@ void Wild3::updateLocationsSearcher()
     ui->comboBoxSearcherLocation->clear();
     for (int index : indices)
     {
-        ui->comboBoxSearcherLocation->addItem(QString::fromStdString(locations[index]), index);
+        ui->comboBoxSearcherLocation->addItem(QString::fromUtf8(locations[index]), index);
     }
 }
 
@@ -190,13 +190,13 @@ void Wild3::updatePokemonGenerator()
     auto area = encounterGenerator[ui->comboBoxGeneratorLocation->currentData().toInt()];
     std::vector<u16> species = area.getUniqueSpecies();
 
-    std::vector<std::string> names = area.getSpecieNames();
+    std::vector<std::string_view> names = area.getSpecieNames();
 
     ui->comboBoxGeneratorPokemon->clear();
     ui->comboBoxGeneratorPokemon->addItem("-");
     for (size_t i = 0; i < species.size(); i++)
     {
-        ui->comboBoxGeneratorPokemon->addItem(QString::fromStdString(names[i]), species[i]);
+        ui->comboBoxGeneratorPokemon->addItem(QString::fromUtf8(names[i]), species[i]);
     }
 }
 
@@ -205,13 +205,13 @@ void Wild3::updatePokemonSearcher()
     auto area = encounterSearcher[ui->comboBoxSearcherLocation->currentData().toInt()];
     std::vector<u16> species = area.getUniqueSpecies();
 
-    std::vector<std::string> names = area.getSpecieNames();
+    std::vector<std::string_view> names = area.getSpecieNames();
 
     ui->comboBoxSearcherPokemon->clear();
     ui->comboBoxSearcherPokemon->addItem("-");
     for (size_t i = 0; i < species.size(); i++)
     {
-        ui->comboBoxSearcherPokemon->addItem(QString::fromStdString(names[i]), species[i]);
+        ui->comboBoxSearcherPokemon->addItem(QString::fromUtf8(names[i]), species[i]);
     }
 }
 
@@ -405,9 +405,9 @@ void Wild3::generatorLead()
         ui->pushButtonGeneratorLead->setText(tr("Synchronize"));
 
         ui->comboBoxGeneratorLead->addItem(tr("None"));
-        for (const std::string &nature : Translator::getNatures())
+        for (std::string_view nature : Translator::getNatures())
         {
-            ui->comboBoxGeneratorLead->addItem(QString::fromStdString(nature));
+            ui->comboBoxGeneratorLead->addItem(QString::fromUtf8(nature));
         }
     }
 }
@@ -26,6 +26,7 @@
 #include <QSettings>
 #include <QThread>
 #include <QTimer>
+#include <memory>
 
 IDs4::IDs4(QWidget *parent) : QWidget(parent), ui(new Ui::IDs4)
 {
@@ -108,15 +109,23 @@ void IDs4::shinyPIDSearch()
     ui->progressBarShinyPID->setValue(0);
     ui->progressBarShinyPID->setMaximum(static_cast<int>(256 * 24 * (infinite ? 0xE8FFFF : (maxDelay - minDelay + 1))));
 
-    auto *searcher = new IDSearcher4(filter);
+    // Infinite searches find more results than one update can add, the rest wait in the spill file for later pages
+    auto searcher = std::make_shared<IDSearcher4>(filter);
+    searcher->setResultBudget({ 10000, ResultPolicy::Spill, "" });
+    shinyPID->setPager([searcher] { return searcher->getResults(); });
 
     auto *thread = QThread::create([=] { searcher->startSearch(infinite, year, minDelay, maxDelay); });
     connect(thread, &QThread::finished, thread, &QThread::deleteLater);
-    connect(ui->pushButtonShinyPIDCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
+    connect(ui->pushButtonShinyPIDCancel, &QPushButton::clicked, [weak = std::weak_ptr<IDSearcher4>(searcher)] {
+        if (auto searcher = weak.lock())
+        {
+            searcher->cancelSearch();
+        }
+    });
 
     auto *timer = new QTimer();
     connect(timer, &QTimer::timeout, [=] {
-        shinyPID->addItems(searcher->getResults());
+        shinyPID->fetchPages();
         ui->progressBarShinyPID->setValue(searcher->getProgress());
     });
     connect(thread, &QThread::finished, timer, &QTimer::stop);
@@ -124,9 +133,8 @@ void IDs4::shinyPIDSearch()
     connect(timer, &QTimer::destroyed, [=] {
         ui->pushButtonShinyPIDSearch->setEnabled(true);
         ui->pushButtonShinyPIDCancel->setEnabled(false);
-        shinyPID->addItems(searcher->getResults());
+        shinyPID->fetchPages();
         ui->progressBarShinyPID->setValue(searcher->getProgress());
-        delete searcher;
     });
 
     thread->start();
@@ -158,15 +166,22 @@ void IDs4::tidSIDSearch()
     ui->progressBarTIDSID->setValue(0);
     ui->progressBarTIDSID->setMaximum(static_cast<int>(256 * 24 * (infinite ? 0xE8FFFF : (maxDelay - minDelay + 1))));
 
-    auto *searcher = new IDSearcher4(filter);
+    auto searcher = std::make_shared<IDSearcher4>(filter);
+    searcher->setResultBudget({ 10000, ResultPolicy::Spill, "" });
+    tidSID->setPager([searcher] { return searcher->getResults(); });
 
     auto *thread = QThread::create([=] { searcher->startSearch(infinite, year, minDelay, maxDelay); });
     connect(thread, &QThread::finished, thread, &QThread::deleteLater);
-    connect(ui->pushButtonTIDSIDCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
+    connect(ui->pushButtonTIDSIDCancel, &QPushButton::clicked, [weak = std::weak_ptr<IDSearcher4>(searcher)] {
+        if (auto searcher = weak.lock())
+        {
+            searcher->cancelSearch();
+        }
+    });
 
     auto *timer = new QTimer();
     connect(timer, &QTimer::timeout, [=] {
-        tidSID->addItems(searcher->getResults());
+        tidSID->fetchPages();
         ui->progressBarTIDSID->setValue(searcher->getProgress());
     });
     connect(thread, &QThread::finished, timer, &QTimer::stop);
@@ -174,9 +189,8 @@ void IDs4::tidSIDSearch()
     connect(timer, &QTimer::destroyed, [=] {
         ui->pushButtonTIDSIDSearch->setEnabled(true);
         ui->pushButtonTIDSIDCancel->setEnabled(false);
-        tidSID->addItems(searcher->getResults());
+        tidSID->fetchPages();
         ui->progressBarTIDSID->setValue(searcher->getProgress());
-        delete searcher;
     });
 
     thread->start();
@@ -232,8 +232,11 @@ void PokeWalker::search()
 
     auto *searcher = new PokeWalkerSearcher(tid, sid, genderRatio, methodModel, filter);
 
+    QSettings settings;
+    int threads = settings.value("settings/threads").toInt();
+
     auto *thread = QThread::create(
-        [=] { searcher->startSearch(minDelay, maxDelay, ui->comboBoxSearcherMethod->currentIndex(), generatorIV, generatorPID); });
+        [=] { searcher->startSearch(minDelay, maxDelay, ui->comboBoxSearcherMethod->currentIndex(), generatorIV, generatorPID, threads); });
     connect(thread, &QThread::finished, thread, &QThread::deleteLater);
     connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
 
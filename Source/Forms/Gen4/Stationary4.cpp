@@ -298,9 +298,9 @@ void Stationary4::generatorLead()
         ui->pushButtonGeneratorLead->setText(tr("Synchronize"));
 
         ui->comboBoxGeneratorLead->addItem(tr("None"));
-        for (const std::string &nature : Translator::getNatures())
+        for (std::string_view nature : Translator::getNatures())
         {
-            ui->comboBoxGeneratorLead->addItem(QString::fromStdString(nature));
+            ui->comboBoxGeneratorLead->addItem(QString::fromUtf8(nature));
         }
     }
 }
@@ -49,9 +49,9 @@ void ChainedSID::setupModels()
     ui->tableView->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
 
     ui->textBoxTID->setValues(InputType::TIDSID);
-    for (const std::string &nature : Translator::getNatures())
+    for (std::string_view nature : Translator::getNatures())
     {
-        ui->comboBoxNature->addItem(QString::fromStdString(nature));
+        ui->comboBoxNature->addItem(QString::fromUtf8(nature));
     }
 
     connect(ui->pushButtonCalculate, &QPushButton::clicked, this, &ChainedSID::calculate);
@@ -84,7 +84,7 @@ void ChainedSID::calculate()
 
     QList<QStandardItem *> row;
     row << new QStandardItem(QString("%1.%2.%3.%4.%5.%6").arg(hp).arg(atk).arg(def).arg(spa).arg(spd).arg(spe));
-    row << new QStandardItem(QString::fromStdString(Translator::getNature(nature)));
+    row << new QStandardItem(QString::fromUtf8(Translator::getNature(nature)));
     row << new QStandardItem(ui->comboBoxAbility->currentText());
     row << new QStandardItem(ui->comboBoxGender->currentText());
     model->appendRow(row);
@@ -28,10 +28,10 @@ RoamerMap::RoamerMap(QWidget *parent) : QDialog(parent), ui(new Ui::RoamerMap)
     setAttribute(Qt::WA_DeleteOnClose);
     setWindowFlags(Qt::Widget | Qt::MSWindowsFixedSizeDialogHint);
 
-    std::vector<std::string> roamers = Translator::getSpecies({ 244, 243, 380, 381 });
-    ui->labelEntei->setText(QString::fromStdString(roamers[0]));
-    ui->labelRaikou->setText(QString::fromStdString(roamers[1]));
-    ui->labelLatiasLatios->setText(QString::fromStdString(roamers[2]) + "/" + QString::fromStdString(roamers[3]));
+    std::vector<std::string_view> roamers = Translator::getSpecies({ 244, 243, 380, 381 });
+    ui->labelEntei->setText(QString::fromUtf8(roamers[0]));
+    ui->labelRaikou->setText(QString::fromUtf8(roamers[1]));
+    ui->labelLatiasLatios->setText(QString::fromUtf8(roamers[2]) + "/" + QString::fromUtf8(roamers[3]));
 }
 
 RoamerMap::~RoamerMap()
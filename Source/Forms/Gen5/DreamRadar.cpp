@@ -112,48 +112,48 @@ void DreamRadar::setupModels()
 
     std::vector<u16> species = { 641, 642, 645, 483, 484, 487, 249, 250, 79,  120, 137, 163, 174,
                                  175, 213, 238, 280, 333, 374, 425, 436, 442, 447, 479, 517, 561 };
-    std::vector<std::string> names = Translator::getSpecies(species);
+    std::vector<std::string_view> names = Translator::getSpecies(species);
 
     for (size_t i = 0; i < species.size(); i++)
     {
         if (i < 3)
         {
-            ui->comboBoxGeneratorSpecies1->addItem(QString::fromStdString(names[i]), species[i]);
-            ui->comboBoxSearcherSpecies1->addItem(QString::fromStdString(names[i]), species[i]);
+            ui->comboBoxGeneratorSpecies1->addItem(QString::fromUtf8(names[i]), species[i]);
+            ui->comboBoxSearcherSpecies1->addItem(QString::fromUtf8(names[i]), species[i]);
         }
         else
         {
-            ui->comboBoxGeneratorSpecies1->addItem(QString::fromStdString(names[i]), species[i]);
-            ui->comboBoxGeneratorSpecies2->addItem(QString::fromStdString(names[i]), species[i]);
-            ui->comboBoxGeneratorSpecies3->addItem(QString::fromStdString(names[i]), species[i]);
-            ui->comboBoxGeneratorSpecies4->addItem(QString::fromStdString(names[i]), species[i]);
-            ui->comboBoxGeneratorSpecies5->addItem(QString::fromStdString(names[i]), species[i]);
-            ui->comboBoxGeneratorSpecies6->addItem(QString::fromStdString(names[i]), species[i]);
-
-            ui->comboBoxSearcherSpecies1->addItem(QString::fromStdString(names[i]), species[i]);
-            ui->comboBoxSearcherSpecies2->addItem(QString::fromStdString(names[i]), species[i]);
-            ui->comboBoxSearcherSpecies3->addItem(QString::fromStdString(names[i]), species[i]);
-            ui->comboBoxSearcherSpecies4->addItem(QString::fromStdString(names[i]), species[i]);
-            ui->comboBoxSearcherSpecies5->addItem(QString::fromStdString(names[i]), species[i]);
-            ui->comboBoxSearcherSpecies6->addItem(QString::fromStdString(names[i]), species[i]);
+            ui->comboBoxGeneratorSpecies1->addItem(QString::fromUtf8(names[i]), species[i]);
+            ui->comboBoxGeneratorSpecies2->addItem(QString::fromUtf8(names[i]), species[i]);
+            ui->comboBoxGeneratorSpecies3->addItem(QString::fromUtf8(names[i]), species[i]);
+            ui->comboBoxGeneratorSpecies4->addItem(QString::fromUtf8(names[i]), species[i]);
+            ui->comboBoxGeneratorSpecies5->addItem(QString::fromUtf8(names[i]), species[i]);
+            ui->comboBoxGeneratorSpecies6->addItem(QString::fromUtf8(names[i]), species[i]);
+
+            ui->comboBoxSearcherSpecies1->addItem(QString::fromUtf8(names[i]), species[i]);
+            ui->comboBoxSearcherSpecies2->addItem(QString::fromUtf8(names[i]), species[i]);
+            ui->comboBoxSearcherSpecies3->addItem(QString::fromUtf8(names[i]), species[i]);
+            ui->comboBoxSearcherSpecies4->addItem(QString::fromUtf8(names[i]), species[i]);
+            ui->comboBoxSearcherSpecies5->addItem(QString::fromUtf8(names[i]), species[i]);
+            ui->comboBoxSearcherSpecies6->addItem(QString::fromUtf8(names[i]), species[i]);
         }
     }
 
-    for (const std::string &gender : Translator::getGenders())
+    for (std::string_view gender : Translator::getGenders())
     {
-        ui->comboBoxGeneratorGender1->addItem(QString::fromStdString(gender));
-        ui->comboBoxGeneratorGender2->addItem(QString::fromStdString(gender));
-        ui->comboBoxGeneratorGender3->addItem(QString::fromStdString(gender));
-        ui->comboBoxGeneratorGender4->addItem(QString::fromStdString(gender));
-        ui->comboBoxGeneratorGender5->addItem(QString::fromStdString(gender));
-        ui->comboBoxGeneratorGender6->addItem(QString::fromStdString(gender));
-
-        ui->comboBoxSearcherGender1->addItem(QString::fromStdString(gender));
-        ui->comboBoxSearcherGender2->addItem(QString::fromStdString(gender));
-        ui->comboBoxSearcherGender3->addItem(QString::fromStdString(gender));
-        ui->comboBoxSearcherGender4->addItem(QString::fromStdString(gender));
-        ui->comboBoxSearcherGender5->addItem(QString::fromStdString(gender));
-        ui->comboBoxSearcherGender6->addItem(QString::fromStdString(gender));
+        ui->comboBoxGeneratorGender1->addItem(QString::fromUtf8(gender));
+        ui->comboBoxGeneratorGender2->addItem(QString::fromUtf8(gender));
+        ui->comboBoxGeneratorGender3->addItem(QString::fromUtf8(gender));
+        ui->comboBoxGeneratorGender4->addItem(QString::fromUtf8(gender));
+        ui->comboBoxGeneratorGender5->addItem(QString::fromUtf8(gender));
+        ui->comboBoxGeneratorGender6->addItem(QString::fromUtf8(gender));
+
+        ui->comboBoxSearcherGender1->addItem(QString::fromUtf8(gender));
+        ui->comboBoxSearcherGender2->addItem(QString::fromUtf8(gender));
+        ui->comboBoxSearcherGender3->addItem(QString::fromUtf8(gender));
+        ui->comboBoxSearcherGender4->addItem(QString::fromUtf8(gender));
+        ui->comboBoxSearcherGender5->addItem(QString::fromUtf8(gender));
+        ui->comboBoxSearcherGender6->addItem(QString::fromUtf8(gender));
     }
 
     ui->tableViewGenerator->setModel(generatorModel);
@@ -33,6 +33,7 @@
 #include <QSettings>
 #include <QThread>
 #include <QTimer>
+#include <memory>
 
 Eggs5::Eggs5(QWidget *parent) : QWidget(parent), ui(new Ui::Eggs5)
 {
@@ -190,6 +191,7 @@ void Eggs5::search()
     Method method = (currentProfile.getVersion() & Game::BW) ? Method::BWBred : Method::BW2Bred;
 
     ui->pushButtonSearch->setEnabled(false);
+    ui->pushButtonPause->setEnabled(true);
     ui->pushButtonCancel->setEnabled(true);
 
     u32 maxAdvances = ui->textBoxSearcherMaxAdvances->getUInt();
@@ -205,7 +207,9 @@ void Eggs5::search()
                             currentProfile.getShinyCharm());
     generator.setOffset(0);
 
-    auto *searcher = new EggSearcher5(currentProfile);
+    auto searcher = std::make_shared<EggSearcher5>(currentProfile);
+    searcher->setResultBudget({ 10000, ResultPolicy::Spill, "" });
+    searcherModel->setPager([searcher] { return searcher->getResults(); });
 
     Date start = ui->dateEditSearcherStartDate->getDate();
     Date end = ui->dateEditSearcherEndDate->getDate();
@@ -220,21 +224,41 @@ void Eggs5::search()
 
     auto *thread = QThread::create([=] { searcher->startSearch(generator, threads, start, end); });
     connect(thread, &QThread::finished, thread, &QThread::deleteLater);
-    connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
+    connect(ui->pushButtonCancel, &QPushButton::clicked, [weak = std::weak_ptr<EggSearcher5>(searcher)] {
+        if (auto searcher = weak.lock())
+        {
+            searcher->cancelSearch();
+        }
+    });
+    connect(ui->pushButtonPause, &QPushButton::toggled, [weak = std::weak_ptr<EggSearcher5>(searcher)](bool checked) {
+        if (auto searcher = weak.lock())
+        {
+            if (checked)
+            {
+                searcher->pauseSearch();
+            }
+            else
+            {
+                searcher->resumeSearch();
+            }
+        }
+    });
 
     auto *timer = new QTimer();
     connect(timer, &QTimer::timeout, [=] {
-        searcherModel->addItems(searcher->getResults());
+        searcherModel->fetchPages();
         ui->progressBar->setValue(searcher->getProgress());
+        searcher->setPriority(isActiveWindow() ? 1 : 0);
     });
     connect(thread, &QThread::finished, timer, &QTimer::stop);
     connect(thread, &QThread::finished, timer, &QTimer::deleteLater);
     connect(timer, &QTimer::destroyed, [=] {
         ui->pushButtonSearch->setEnabled(true);
+        ui->pushButtonPause->setChecked(false);
+        ui->pushButtonPause->setEnabled(false);
         ui->pushButtonCancel->setEnabled(false);
-        searcherModel->addItems(searcher->getResults());
+        searcherModel->fetchPages();
         ui->progressBar->setValue(searcher->getProgress());
-        delete searcher;
     });
 
     thread->start();
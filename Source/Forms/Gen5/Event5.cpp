@@ -36,6 +36,7 @@
 #include <QSettings>
 #include <QThread>
 #include <QTimer>
+#include <memory>
 
 Event5::Event5(QWidget *parent) : QWidget(parent), ui(new Ui::Event5)
 {
@@ -103,10 +104,10 @@ void Event5::setupModels()
     ui->textBoxSearcherEventTID->setValues(InputType::TIDSID);
     ui->textBoxSearcherEventSID->setValues(InputType::TIDSID);
 
-    for (const std::string &nature : Translator::getNatures())
+    for (std::string_view nature : Translator::getNatures())
     {
-        ui->comboBoxGeneratorNature->addItem(QString::fromStdString(nature));
-        ui->comboBoxSearcherNature->addItem(QString::fromStdString(nature));
+        ui->comboBoxGeneratorNature->addItem(QString::fromUtf8(nature));
+        ui->comboBoxSearcherNature->addItem(QString::fromUtf8(nature));
     }
 
     ui->filterGenerator->disableControls(Controls::EncounterSlots);
@@ -117,10 +118,10 @@ void Event5::setupModels()
 
     std::vector<u16> species(649);
     std::iota(species.begin(), species.end(), 1);
-    for (const std::string &specie : Translator::getSpecies(species))
+    for (std::string_view specie : Translator::getSpecies(species))
     {
-        ui->comboBoxGeneratorSpecies->addItem(QString::fromStdString(specie));
-        ui->comboBoxSearcherSpecies->addItem(QString::fromStdString(specie));
+        ui->comboBoxGeneratorSpecies->addItem(QString::fromUtf8(specie));
+        ui->comboBoxSearcherSpecies->addItem(QString::fromUtf8(specie));
     }
 
     QAction *outputTXTGenerator = generatorMenu->addAction(tr("Output Results to TXT"));
@@ -215,6 +216,7 @@ void Event5::search()
     searcherModel->clearModel();
 
     ui->pushButtonSearch->setEnabled(false);
+    ui->pushButtonPause->setEnabled(true);
     ui->pushButtonCancel->setEnabled(true);
 
     u32 maxAdvances = ui->textBoxSearcherMaxAdvances->getUInt();
@@ -229,7 +231,9 @@ void Event5::search()
     EventGenerator5 generator(0, maxAdvances, tid, sid, genderRatio, Method::Method5Event, filter, getSearcherParameters());
     generator.setOffset(0);
 
-    auto *searcher = new EventSearcher5(currentProfile);
+    auto searcher = std::make_shared<EventSearcher5>(currentProfile);
+    searcher->setResultBudget({ 10000, ResultPolicy::Spill, "" });
+    searcherModel->setPager([searcher] { return searcher->getResults(); });
 
     Date start = ui->dateEditSearcherStartDate->getDate();
     Date end = ui->dateEditSearcherEndDate->getDate();
@@ -244,21 +248,41 @@ void Event5::search()
 
     auto *thread = QThread::create([=] { searcher->startSearch(generator, threads, start, end); });
     connect(thread, &QThread::finished, thread, &QThread::deleteLater);
-    connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
+    connect(ui->pushButtonCancel, &QPushButton::clicked, [weak = std::weak_ptr<EventSearcher5>(searcher)] {
+        if (auto searcher = weak.lock())
+        {
+            searcher->cancelSearch();
+        }
+    });
+    connect(ui->pushButtonPause, &QPushButton::toggled, [weak = std::weak_ptr<EventSearcher5>(searcher)](bool checked) {
+        if (auto searcher = weak.lock())
+        {
+            if (checked)
+            {
+                searcher->pauseSearch();
+            }
+            else
+            {
+                searcher->resumeSearch();
+            }
+        }
+    });
 
     auto *timer = new QTimer();
     connect(timer, &QTimer::timeout, [=] {
-        searcherModel->addItems(searcher->getResults());
+        searcherModel->fetchPages();
         ui->progressBar->setValue(searcher->getProgress());
+        searcher->setPriority(isActiveWindow() ? 1 : 0);
     });
     connect(thread, &QThread::finished, timer, &QTimer::stop);
     connect(thread, &QThread::finished, timer, &QTimer::deleteLater);
     connect(timer, &QTimer::destroyed, [=] {
         ui->pushButtonSearch->setEnabled(true);
+        ui->pushButtonPause->setChecked(false);
+        ui->pushButtonPause->setEnabled(false);
         ui->pushButtonCancel->setEnabled(false);
-        searcherModel->addItems(searcher->getResults());
+        searcherModel->fetchPages();
         ui->progressBar->setValue(searcher->getProgress());
-        delete searcher;
     });
 
     thread->start();
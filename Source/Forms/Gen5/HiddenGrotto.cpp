@@ -34,6 +34,7 @@
 #include <QSettings>
 #include <QThread>
 #include <QTimer>
+#include <memory>
 
 HiddenGrotto::HiddenGrotto(QWidget *parent) : QWidget(parent), ui(new Ui::HiddenGrotto)
 {
@@ -178,6 +179,7 @@ void HiddenGrotto::search()
 {
     searcherModel->clearModel();
     ui->pushButtonSearch->setEnabled(false);
+    ui->pushButtonPause->setEnabled(true);
     ui->pushButtonCancel->setEnabled(true);
 
     u32 maxAdvances = ui->textBoxSearcherMaxAdvances->getUInt();
@@ -188,7 +190,9 @@ void HiddenGrotto::search()
                               ui->checkListSearcherGender->getChecked());
 
     HiddenGrottoGenerator generator(0, maxAdvances, genderRatio, powerLevel, filter);
-    auto *searcher = new HiddenGrottoSearcher(currentProfile);
+    auto searcher = std::make_shared<HiddenGrottoSearcher>(currentProfile);
+    searcher->setResultBudget({ 10000, ResultPolicy::Spill, "" });
+    searcherModel->setPager([searcher] { return searcher->getResults(); });
 
     Date start = ui->dateEditSearcherStartDate->getDate();
     Date end = ui->dateEditSearcherEndDate->getDate();
@@ -203,14 +207,37 @@ void HiddenGrotto::search()
 
     auto *thread = QThread::create([=] { searcher->startSearch(generator, threads, start, end); });
     connect(thread, &QThread::finished, thread, &QThread::deleteLater);
-    connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
+    connect(ui->pushButtonCancel, &QPushButton::clicked,
+            [weak = std::weak_ptr<HiddenGrottoSearcher>(searcher)]
+            {
+                if (auto searcher = weak.lock())
+                {
+                    searcher->cancelSearch();
+                }
+            });
+    connect(ui->pushButtonPause, &QPushButton::toggled,
+            [weak = std::weak_ptr<HiddenGrottoSearcher>(searcher)](bool checked)
+            {
+                if (auto searcher = weak.lock())
+                {
+                    if (checked)
+                    {
+                        searcher->pauseSearch();
+                    }
+                    else
+                    {
+                        searcher->resumeSearch();
+                    }
+                }
+            });
 
     auto *timer = new QTimer();
     connect(timer, &QTimer::timeout,
             [=]
             {
-                searcherModel->addItems(searcher->getResults());
+                searcherModel->fetchPages();
                 ui->progressBar->setValue(searcher->getProgress());
+                searcher->setPriority(isActiveWindow() ? 1 : 0);
             });
 
     connect(thread, &QThread::finished, timer, &QTimer::stop);
@@ -219,10 +246,11 @@ void HiddenGrotto::search()
             [=]
             {
                 ui->pushButtonSearch->setEnabled(true);
+                ui->pushButtonPause->setChecked(false);
+                ui->pushButtonPause->setEnabled(false);
                 ui->pushButtonCancel->setEnabled(false);
-                searcherModel->addItems(searcher->getResults());
+                searcherModel->fetchPages();
                 ui->progressBar->setValue(searcher->getProgress());
-                delete searcher;
             });
 
     thread->start();
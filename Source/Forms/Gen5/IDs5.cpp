@@ -33,6 +33,7 @@
 #include <QSettings>
 #include <QThread>
 #include <QTimer>
+#include <memory>
 
 IDs5::IDs5(QWidget *parent) : QWidget(parent), ui(new Ui::IDs5)
 {
@@ -128,6 +129,7 @@ void IDs5::search()
 
     ui->pushButtonSearch->setEnabled(false);
     ui->pushButtonFind->setEnabled(false);
+    ui->pushButtonPause->setEnabled(true);
     ui->pushButtonCancel->setEnabled(true);
 
     u32 pid = ui->textBoxPID->getUInt();
@@ -152,7 +154,9 @@ void IDs5::search()
     IDFilter filter(tid, sid, {});
     IDGenerator5 generator(0, ui->textBoxMaxAdvances->getUInt(), filter);
 
-    auto *searcher = new IDSearcher5(currentProfile, usePID, useXOR, pid);
+    auto searcher = std::make_shared<IDSearcher5>(currentProfile, usePID, useXOR, pid);
+    searcher->setResultBudget({ 10000, ResultPolicy::Spill, "" });
+    model->setPager([searcher] { return searcher->getResults(); });
 
     int maxProgress = Keypresses::getKeyPresses(currentProfile.getKeypresses(), currentProfile.getSkipLR()).size();
     maxProgress *= (start.daysTo(end) + 1);
@@ -163,22 +167,42 @@ void IDs5::search()
 
     auto *thread = QThread::create([=] { searcher->startSearch(generator, threads, start, end); });
     connect(thread, &QThread::finished, thread, &QThread::deleteLater);
-    connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
+    connect(ui->pushButtonCancel, &QPushButton::clicked, [weak = std::weak_ptr<IDSearcher5>(searcher)] {
+        if (auto searcher = weak.lock())
+        {
+            searcher->cancelSearch();
+        }
+    });
+    connect(ui->pushButtonPause, &QPushButton::toggled, [weak = std::weak_ptr<IDSearcher5>(searcher)](bool checked) {
+        if (auto searcher = weak.lock())
+        {
+            if (checked)
+            {
+                searcher->pauseSearch();
+            }
+            else
+            {
+                searcher->resumeSearch();
+            }
+        }
+    });
 
     auto *timer = new QTimer();
     connect(timer, &QTimer::timeout, [=] {
-        model->addItems(searcher->getResults());
+        model->fetchPages();
         ui->progressBar->setValue(searcher->getProgress());
+        searcher->setPriority(isActiveWindow() ? 1 : 0);
     });
     connect(thread, &QThread::finished, timer, &QTimer::stop);
     connect(thread, &QThread::finished, timer, &QTimer::deleteLater);
     connect(timer, &QTimer::destroyed, [=] {
         ui->pushButtonSearch->setEnabled(true);
         ui->pushButtonFind->setEnabled(true);
+        ui->pushButtonPause->setChecked(false);
+        ui->pushButtonPause->setEnabled(false);
         ui->pushButtonCancel->setEnabled(false);
-        model->addItems(searcher->getResults());
+        model->fetchPages();
         ui->progressBar->setValue(searcher->getProgress());
-        delete searcher;
     });
 
     thread->start();
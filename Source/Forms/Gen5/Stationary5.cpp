@@ -34,6 +34,7 @@
 #include <QSettings>
 #include <QThread>
 #include <QTimer>
+#include <memory>
 
 Stationary5::Stationary5(QWidget *parent) : QWidget(parent), ui(new Ui::Stationary5)
 {
@@ -107,9 +108,9 @@ void Stationary5::setupModels()
     ui->comboBoxSearcherLead->setup({ Lead::Search, Lead::Synchronize, Lead::CuteCharm, Lead::None });
 
     ui->comboBoxGeneratorLead->addItem(tr("None"));
-    for (const std::string &nature : Translator::getNatures())
+    for (std::string_view nature : Translator::getNatures())
     {
-        ui->comboBoxGeneratorLead->addItem(QString::fromStdString(nature));
+        ui->comboBoxGeneratorLead->addItem(QString::fromUtf8(nature));
     }
 
     ui->filterGenerator->disableControls(Controls::EncounterSlots | Controls::Ability | Controls::Shiny | Controls::Gender
@@ -215,6 +216,7 @@ void Stationary5::search()
     searcherModel->setMethod(method);
 
     ui->pushButtonSearch->setEnabled(false);
+    ui->pushButtonPause->setEnabled(true);
     ui->pushButtonCancel->setEnabled(true);
 
     u32 maxAdvances = ui->textBoxSearcherMaxAdvances->getUInt();
@@ -235,7 +237,9 @@ void Stationary5::search()
         generator.setInitialAdvances(ui->textBoxSearcherMinAdvances->getUInt());
     }
 
-    auto *searcher = new StationarySearcher5(currentProfile, method);
+    auto searcher = std::make_shared<StationarySearcher5>(currentProfile, method);
+    searcher->setResultBudget({ 10000, ResultPolicy::Spill, "" });
+    searcherModel->setPager([searcher] { return searcher->getResults(); });
 
     Date start = ui->dateEditSearcherStartDate->getDate();
     Date end = ui->dateEditSearcherEndDate->getDate();
@@ -250,14 +254,37 @@ void Stationary5::search()
 
     auto *thread = QThread::create([=] { searcher->startSearch(generator, threads, start, end); });
     connect(thread, &QThread::finished, thread, &QThread::deleteLater);
-    connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
+    connect(ui->pushButtonCancel, &QPushButton::clicked,
+            [weak = std::weak_ptr<StationarySearcher5>(searcher)]
+            {
+                if (auto searcher = weak.lock())
+                {
+                    searcher->cancelSearch();
+                }
+            });
+    connect(ui->pushButtonPause, &QPushButton::toggled,
+            [weak = std::weak_ptr<StationarySearcher5>(searcher)](bool checked)
+            {
+                if (auto searcher = weak.lock())
+                {
+                    if (checked)
+                    {
+                        searcher->pauseSearch();
+                    }
+                    else
+                    {
+                        searcher->resumeSearch();
+                    }
+                }
+            });
 
     auto *timer = new QTimer();
     connect(timer, &QTimer::timeout,
             [=]
             {
-                searcherModel->addItems(searcher->getResults());
+                searcherModel->fetchPages();
                 ui->progressBar->setValue(searcher->getProgress());
+                searcher->setPriority(isActiveWindow() ? 1 : 0);
             });
     connect(thread, &QThread::finished, timer, &QTimer::stop);
     connect(thread, &QThread::finished, timer, &QTimer::deleteLater);
@@ -265,10 +292,11 @@ void Stationary5::search()
             [=]
             {
                 ui->pushButtonSearch->setEnabled(true);
+                ui->pushButtonPause->setChecked(false);
+                ui->pushButtonPause->setEnabled(false);
                 ui->pushButtonCancel->setEnabled(false);
-                searcherModel->addItems(searcher->getResults());
+                searcherModel->fetchPages();
                 ui->progressBar->setValue(searcher->getProgress());
-                delete searcher;
             });
 
     thread->start();
@@ -324,9 +352,9 @@ void Stationary5::generatorLead()
         ui->comboBoxGeneratorLead->setEnabled(true);
 
         ui->comboBoxGeneratorLead->addItem("None");
-        for (const std::string &nature : Translator::getNatures())
+        for (std::string_view nature : Translator::getNatures())
         {
-            ui->comboBoxGeneratorLead->addItem(QString::fromStdString(nature));
+            ui->comboBoxGeneratorLead->addItem(QString::fromUtf8(nature));
         }
     }
 }
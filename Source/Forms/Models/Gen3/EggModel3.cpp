@@ -75,7 +75,7 @@ QVariant EggModel3::data(const QModelIndex &index, int role) const
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 6:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 7:
             return state.getAbility();
         case 8:
@@ -94,11 +94,11 @@ QVariant EggModel3::data(const QModelIndex &index, int role) const
             }
             return state.getIV(static_cast<u8>(column - 8));
         case 14:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 15:
             return state.getPower();
         case 16:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
 
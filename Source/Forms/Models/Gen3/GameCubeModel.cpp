@@ -48,7 +48,7 @@ QVariant GameCubeGeneratorModel::data(const QModelIndex &index, int role) const
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 3:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 4:
             return state.getAbility();
         case 5:
@@ -59,11 +59,11 @@ QVariant GameCubeGeneratorModel::data(const QModelIndex &index, int role) const
         case 10:
             return state.getIV(static_cast<u8>(column - 5));
         case 11:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 12:
             return state.getPower();
         case 13:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
     return QVariant();
@@ -97,77 +97,77 @@ void GameCubeSearcherModel::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
+            model.sort([flag](const GameCubeState &state1, const GameCubeState &state2) {
                 return flag ? state1.getSeed() < state2.getSeed() : state1.getSeed() > state2.getSeed();
             });
             break;
         case 1:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
+            model.sort([flag](const GameCubeState &state1, const GameCubeState &state2) {
                 return flag ? state1.getPID() < state2.getPID() : state1.getPID() > state2.getPID();
             });
             break;
         case 2:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
+            model.sort([flag](const GameCubeState &state1, const GameCubeState &state2) {
                 return flag ? state1.getShiny() < state2.getShiny() : state1.getShiny() > state2.getShiny();
             });
             break;
         case 3:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
+            model.sort([flag](const GameCubeState &state1, const GameCubeState &state2) {
                 return flag ? state1.getNature() < state2.getNature() : state1.getNature() > state2.getNature();
             });
             break;
         case 4:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
+            model.sort([flag](const GameCubeState &state1, const GameCubeState &state2) {
                 return flag ? state1.getAbility() < state2.getAbility() : state1.getAbility() > state2.getAbility();
             });
             break;
         case 5:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
+            model.sort([flag](const GameCubeState &state1, const GameCubeState &state2) {
                 return flag ? state1.getIV(0) < state2.getIV(0) : state1.getIV(0) > state2.getIV(0);
             });
             break;
         case 6:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
+            model.sort([flag](const GameCubeState &state1, const GameCubeState &state2) {
                 return flag ? state1.getIV(1) < state2.getIV(1) : state1.getIV(1) > state2.getIV(1);
             });
             break;
         case 7:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
+            model.sort([flag](const GameCubeState &state1, const GameCubeState &state2) {
                 return flag ? state1.getIV(2) < state2.getIV(2) : state1.getIV(2) > state2.getIV(2);
             });
             break;
         case 8:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
+            model.sort([flag](const GameCubeState &state1, const GameCubeState &state2) {
                 return flag ? state1.getIV(3) < state2.getIV(3) : state1.getIV(3) > state2.getIV(3);
             });
             break;
         case 9:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
+            model.sort([flag](const GameCubeState &state1, const GameCubeState &state2) {
                 return flag ? state1.getIV(4) < state2.getIV(4) : state1.getIV(4) > state2.getIV(4);
             });
             break;
         case 10:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
+            model.sort([flag](const GameCubeState &state1, const GameCubeState &state2) {
                 return flag ? state1.getIV(5) < state2.getIV(5) : state1.getIV(5) > state2.getIV(5);
             });
             break;
         case 11:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
+            model.sort([flag](const GameCubeState &state1, const GameCubeState &state2) {
                 return flag ? state1.getHidden() < state2.getHidden() : state1.getHidden() > state2.getHidden();
             });
             break;
         case 12:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
+            model.sort([flag](const GameCubeState &state1, const GameCubeState &state2) {
                 return flag ? state1.getPower() < state2.getPower() : state1.getPower() > state2.getPower();
             });
             break;
         case 13:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
+            model.sort([flag](const GameCubeState &state1, const GameCubeState &state2) {
                 return flag ? state1.getGender() < state2.getGender() : state1.getGender() > state2.getGender();
             });
             break;
         case 14:
-            std::sort(model.begin(), model.end(), [flag](const GameCubeState &state1, const GameCubeState &state2) {
+            model.sort([flag](const GameCubeState &state1, const GameCubeState &state2) {
                 return flag ? state1.getInfo() < state2.getInfo() : state1.getInfo() > state2.getInfo();
             });
             break;
@@ -204,7 +204,7 @@ QVariant GameCubeSearcherModel::data(const QModelIndex &index, int role) const
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 3:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 4:
             return state.getAbility();
         case 5:
@@ -220,11 +220,11 @@ QVariant GameCubeSearcherModel::data(const QModelIndex &index, int role) const
         case 10:
             return state.getIV(5);
         case 11:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 12:
             return state.getPower();
         case 13:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         case 14:
             switch (state.getInfo())
             {
@@ -47,7 +47,7 @@ QVariant StationaryGeneratorModel3::data(const QModelIndex &index, int role) con
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 3:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 4:
             return state.getAbility();
         case 5:
@@ -58,11 +58,11 @@ QVariant StationaryGeneratorModel3::data(const QModelIndex &index, int role) con
         case 10:
             return state.getIV(static_cast<u8>(column - 5));
         case 11:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 12:
             return state.getPower();
         case 13:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
     return QVariant();
@@ -90,27 +90,27 @@ void StationarySearcherModel3::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(), [flag](const State &state1, const State &state2) {
+            model.sort([flag](const State &state1, const State &state2) {
                 return flag ? state1.getSeed() < state2.getSeed() : state1.getSeed() > state2.getSeed();
             });
             break;
         case 1:
-            std::sort(model.begin(), model.end(), [flag](const State &state1, const State &state2) {
+            model.sort([flag](const State &state1, const State &state2) {
                 return flag ? state1.getPID() < state2.getPID() : state1.getPID() > state2.getPID();
             });
             break;
         case 2:
-            std::sort(model.begin(), model.end(), [flag](const State &state1, const State &state2) {
+            model.sort([flag](const State &state1, const State &state2) {
                 return flag ? state1.getShiny() < state2.getShiny() : state1.getShiny() > state2.getShiny();
             });
             break;
         case 3:
-            std::sort(model.begin(), model.end(), [flag](const State &state1, const State &state2) {
+            model.sort([flag](const State &state1, const State &state2) {
                 return flag ? state1.getNature() < state2.getNature() : state1.getNature() > state2.getNature();
             });
             break;
         case 4:
-            std::sort(model.begin(), model.end(), [flag](const State &state1, const State &state2) {
+            model.sort([flag](const State &state1, const State &state2) {
                 return flag ? state1.getAbility() < state2.getAbility() : state1.getAbility() > state2.getAbility();
             });
             break;
@@ -120,23 +120,23 @@ void StationarySearcherModel3::sort(int column, Qt::SortOrder order)
         case 8:
         case 9:
         case 10:
-            std::sort(model.begin(), model.end(), [flag, column](const State &state1, const State &state2) {
+            model.sort([flag, column](const State &state1, const State &state2) {
                 return flag ? state1.getIV(static_cast<u8>(column - 5)) < state2.getIV(static_cast<u8>(column - 5))
                             : state1.getIV(static_cast<u8>(column - 5)) > state2.getIV(static_cast<u8>(column - 5));
             });
             break;
         case 11:
-            std::sort(model.begin(), model.end(), [flag](const State &state1, const State &state2) {
+            model.sort([flag](const State &state1, const State &state2) {
                 return flag ? state1.getHidden() < state2.getHidden() : state1.getHidden() > state2.getHidden();
             });
             break;
         case 12:
-            std::sort(model.begin(), model.end(), [flag](const State &state1, const State &state2) {
+            model.sort([flag](const State &state1, const State &state2) {
                 return flag ? state1.getPower() < state2.getPower() : state1.getPower() > state2.getPower();
             });
             break;
         case 13:
-            std::sort(model.begin(), model.end(), [flag](const State &state1, const State &state2) {
+            model.sort([flag](const State &state1, const State &state2) {
                 return flag ? state1.getGender() < state2.getGender() : state1.getGender() > state2.getGender();
             });
             break;
@@ -170,7 +170,7 @@ QVariant StationarySearcherModel3::data(const QModelIndex &index, int role) cons
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 3:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 4:
             return state.getAbility();
         case 5:
@@ -181,11 +181,11 @@ QVariant StationarySearcherModel3::data(const QModelIndex &index, int role) cons
         case 10:
             return state.getIV(static_cast<u8>(column - 5));
         case 11:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 12:
             return state.getPower();
         case 13:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
     return QVariant();
@@ -50,7 +50,7 @@ QVariant UnownGeneratorModel3::data(const QModelIndex &index, int role) const
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 4:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 5:
             return state.getAbility();
         case 6:
@@ -61,11 +61,11 @@ QVariant UnownGeneratorModel3::data(const QModelIndex &index, int role) const
         case 11:
             return state.getIV(static_cast<u8>(column - 6));
         case 12:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 13:
             return state.getPower();
         case 14:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
     return QVariant();
@@ -93,42 +93,42 @@ void UnownSearcherModel3::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(), [flag](const UnownState &state1, const UnownState &state2) {
+            model.sort([flag](const UnownState &state1, const UnownState &state2) {
                 return flag ? state1.getSeed() < state2.getSeed() : state1.getSeed() > state2.getSeed();
             });
             break;
         case 1:
-            std::sort(model.begin(), model.end(), [flag](const UnownState &state1, const UnownState &state2) {
+            model.sort([flag](const UnownState &state1, const UnownState &state2) {
                 return flag ? state1.getLevel() < state2.getLevel() : state1.getLevel() > state2.getLevel();
             });
             break;
         case 2:
-            std::sort(model.begin(), model.end(), [flag](const UnownState &state1, const UnownState &state2) {
+            model.sort([flag](const UnownState &state1, const UnownState &state2) {
                 return flag ? state1.getLevel() < state2.getLevel() : state1.getLevel() > state2.getLevel();
             });
             break;
         case 3:
-            std::sort(model.begin(), model.end(), [flag](const UnownState &state1, const UnownState &state2) {
+            model.sort([flag](const UnownState &state1, const UnownState &state2) {
                 return flag ? state1.getLevel() < state2.getLevel() : state1.getLevel() > state2.getLevel();
             });
             break;
         case 4:
-            std::sort(model.begin(), model.end(), [flag](const UnownState &state1, const UnownState &state2) {
+            model.sort([flag](const UnownState &state1, const UnownState &state2) {
                 return flag ? state1.getPID() < state2.getPID() : state1.getPID() > state2.getPID();
             });
             break;
         case 5:
-            std::sort(model.begin(), model.end(), [flag](const UnownState &state1, const UnownState &state2) {
+            model.sort([flag](const UnownState &state1, const UnownState &state2) {
                 return flag ? state1.getShiny() < state2.getShiny() : state1.getShiny() > state2.getShiny();
             });
             break;
         case 6:
-            std::sort(model.begin(), model.end(), [flag](const UnownState &state1, const UnownState &state2) {
+            model.sort([flag](const UnownState &state1, const UnownState &state2) {
                 return flag ? state1.getNature() < state2.getNature() : state1.getNature() > state2.getNature();
             });
             break;
         case 7:
-            std::sort(model.begin(), model.end(), [flag](const UnownState &state1, const UnownState &state2) {
+            model.sort([flag](const UnownState &state1, const UnownState &state2) {
                 return flag ? state1.getAbility() < state2.getAbility() : state1.getAbility() > state2.getAbility();
             });
             break;
@@ -138,23 +138,23 @@ void UnownSearcherModel3::sort(int column, Qt::SortOrder order)
         case 11:
         case 12:
         case 13:
-            std::sort(model.begin(), model.end(), [flag, column](const UnownState &state1, const UnownState &state2) {
+            model.sort([flag, column](const UnownState &state1, const UnownState &state2) {
                 return flag ? state1.getIV(static_cast<u8>(column - 8)) < state2.getIV(static_cast<u8>(column - 8))
                             : state1.getIV(static_cast<u8>(column - 8)) > state2.getIV(static_cast<u8>(column - 8));
             });
             break;
         case 14:
-            std::sort(model.begin(), model.end(), [flag](const UnownState &state1, const UnownState &state2) {
+            model.sort([flag](const UnownState &state1, const UnownState &state2) {
                 return flag ? state1.getHidden() < state2.getHidden() : state1.getHidden() > state2.getHidden();
             });
             break;
         case 15:
-            std::sort(model.begin(), model.end(), [flag](const UnownState &state1, const UnownState &state2) {
+            model.sort([flag](const UnownState &state1, const UnownState &state2) {
                 return flag ? state1.getPower() < state2.getPower() : state1.getPower() > state2.getPower();
             });
             break;
         case 16:
-            std::sort(model.begin(), model.end(), [flag](const UnownState &state1, const UnownState &state2) {
+            model.sort([flag](const UnownState &state1, const UnownState &state2) {
                 return flag ? state1.getGender() < state2.getGender() : state1.getGender() > state2.getGender();
             });
             break;
@@ -190,7 +190,7 @@ QVariant UnownSearcherModel3::data(const QModelIndex &index, int role) const
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 4:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 5:
             return state.getAbility();
         case 6:
@@ -201,11 +201,11 @@ QVariant UnownSearcherModel3::data(const QModelIndex &index, int role) const
         case 11:
             return state.getIV(static_cast<u8>(column - 6));
         case 12:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 13:
             return state.getPower();
         case 14:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
 
     }
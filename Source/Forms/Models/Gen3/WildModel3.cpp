@@ -52,7 +52,7 @@ QVariant WildGeneratorModel3::data(const QModelIndex &index, int role) const
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 5:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 6:
             return state.getAbility();
         case 7:
@@ -63,11 +63,11 @@ QVariant WildGeneratorModel3::data(const QModelIndex &index, int role) const
         case 12:
             return state.getIV(static_cast<u8>(column - 7));
         case 13:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 14:
             return state.getPower();
         case 15:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
     return QVariant();
@@ -95,42 +95,42 @@ void WildSearcherModel3::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getSeed() < state2.getSeed() : state1.getSeed() > state2.getSeed();
             });
             break;
         case 1:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getLead() < state2.getLead() : state1.getLead() > state2.getLead();
             });
             break;
         case 2:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getEncounterSlot() < state2.getEncounterSlot() : state1.getEncounterSlot() > state2.getEncounterSlot();
             });
             break;
         case 3:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getLevel() < state2.getLevel() : state1.getLevel() > state2.getLevel();
             });
             break;
         case 4:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getPID() < state2.getPID() : state1.getPID() > state2.getPID();
             });
             break;
         case 5:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getShiny() < state2.getShiny() : state1.getShiny() > state2.getShiny();
             });
             break;
         case 6:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getNature() < state2.getNature() : state1.getNature() > state2.getNature();
             });
             break;
         case 7:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getAbility() < state2.getAbility() : state1.getAbility() > state2.getAbility();
             });
             break;
@@ -140,23 +140,23 @@ void WildSearcherModel3::sort(int column, Qt::SortOrder order)
         case 11:
         case 12:
         case 13:
-            std::sort(model.begin(), model.end(), [flag, column](const WildState &state1, const WildState &state2) {
+            model.sort([flag, column](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getIV(static_cast<u8>(column - 8)) < state2.getIV(static_cast<u8>(column - 8))
                             : state1.getIV(static_cast<u8>(column - 8)) > state2.getIV(static_cast<u8>(column - 8));
             });
             break;
         case 14:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getHidden() < state2.getHidden() : state1.getHidden() > state2.getHidden();
             });
             break;
         case 15:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getPower() < state2.getPower() : state1.getPower() > state2.getPower();
             });
             break;
         case 16:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getGender() < state2.getGender() : state1.getGender() > state2.getGender();
             });
             break;
@@ -199,7 +199,7 @@ QVariant WildSearcherModel3::data(const QModelIndex &index, int role) const
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 6:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 7:
             return state.getAbility();
         case 8:
@@ -210,11 +210,11 @@ QVariant WildSearcherModel3::data(const QModelIndex &index, int role) const
         case 13:
             return state.getIV(static_cast<u8>(column - 8));
         case 14:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 15:
             return state.getPower();
         case 16:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
     return QVariant();
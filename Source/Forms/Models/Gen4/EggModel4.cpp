@@ -77,7 +77,7 @@ QVariant EggGeneratorModel4::data(const QModelIndex &index, int role) const
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 5:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 6:
             return state.getAbility();
         case 7:
@@ -96,11 +96,11 @@ QVariant EggGeneratorModel4::data(const QModelIndex &index, int role) const
             }
             return state.getIV(static_cast<u8>(column - 7));
         case 13:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 14:
             return state.getPower();
         case 15:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
 
@@ -160,39 +160,39 @@ void EggSearcherModel4::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
+            model.sort([flag](const EggState4 &state1, const EggState4 &state2) {
                 return flag ? state1.getInitialSeed() < state2.getInitialSeed() : state1.getInitialSeed() > state2.getInitialSeed();
             });
             break;
         case 1:
         case 2:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
+            model.sort([flag](const EggState4 &state1, const EggState4 &state2) {
                 return flag ? state1.getAdvances() < state2.getAdvances() : state1.getAdvances() > state2.getAdvances();
             });
             break;
         case 3:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
+            model.sort([flag](const EggState4 &state1, const EggState4 &state2) {
                 return flag ? state1.getSecondaryAdvance() < state2.getSecondaryAdvance()
                             : state1.getSecondaryAdvance() > state2.getSecondaryAdvance();
             });
             break;
         case 4:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
+            model.sort([flag](const EggState4 &state1, const EggState4 &state2) {
                 return flag ? state1.getPID() < state2.getPID() : state1.getPID() > state2.getPID();
             });
             break;
         case 5:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
+            model.sort([flag](const EggState4 &state1, const EggState4 &state2) {
                 return flag ? state1.getShiny() < state2.getShiny() : state1.getShiny() > state2.getShiny();
             });
             break;
         case 6:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
+            model.sort([flag](const EggState4 &state1, const EggState4 &state2) {
                 return flag ? state1.getNature() < state2.getNature() : state1.getNature() > state2.getNature();
             });
             break;
         case 7:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
+            model.sort([flag](const EggState4 &state1, const EggState4 &state2) {
                 return flag ? state1.getAbility() < state2.getAbility() : state1.getAbility() > state2.getAbility();
             });
             break;
@@ -202,23 +202,23 @@ void EggSearcherModel4::sort(int column, Qt::SortOrder order)
         case 11:
         case 12:
         case 13:
-            std::sort(model.begin(), model.end(), [flag, column](const EggState4 &state1, const EggState4 &state2) {
+            model.sort([flag, column](const EggState4 &state1, const EggState4 &state2) {
                 return flag ? state1.getIV(static_cast<u8>(column - 8)) < state2.getIV(static_cast<u8>(column - 8))
                             : state1.getIV(static_cast<u8>(column - 8)) > state2.getIV(static_cast<u8>(column - 8));
             });
             break;
         case 14:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
+            model.sort([flag](const EggState4 &state1, const EggState4 &state2) {
                 return flag ? state1.getHidden() < state2.getHidden() : state1.getHidden() > state2.getHidden();
             });
             break;
         case 15:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
+            model.sort([flag](const EggState4 &state1, const EggState4 &state2) {
                 return flag ? state1.getPower() < state2.getPower() : state1.getPower() > state2.getPower();
             });
             break;
         case 16:
-            std::sort(model.begin(), model.end(), [flag](const EggState4 &state1, const EggState4 &state2) {
+            model.sort([flag](const EggState4 &state1, const EggState4 &state2) {
                 return flag ? state1.getGender() < state2.getGender() : state1.getGender() > state2.getGender();
             });
             break;
@@ -269,7 +269,7 @@ QVariant EggSearcherModel4::data(const QModelIndex &index, int role) const
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 6:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 7:
             return state.getAbility();
         case 8:
@@ -288,11 +288,11 @@ QVariant EggSearcherModel4::data(const QModelIndex &index, int role) const
             }
             return state.getIV(static_cast<u8>(column - 8));
         case 14:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 15:
             return state.getPower();
         case 16:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
     return QVariant();
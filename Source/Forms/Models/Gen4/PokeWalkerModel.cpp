@@ -74,7 +74,7 @@ QVariant PokeWalkerGeneratorModel::data(const QModelIndex &index, int role) cons
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 5:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 6:
             return state.getAbility();
         case 7:
@@ -85,11 +85,11 @@ QVariant PokeWalkerGeneratorModel::data(const QModelIndex &index, int role) cons
         case 12:
             return state.getIV(static_cast<u8>(column - 7));
         case 13:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 14:
             return state.getPower();
         case 15:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
 
@@ -146,39 +146,39 @@ void PokeWalkerSearcherModel::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(), [flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
+            model.sort([flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
                 return flag ? state1.getInitialSeed() < state2.getInitialSeed() : state1.getInitialSeed() > state2.getInitialSeed();
             });
             break;
         case 1:
         case 2:
-            std::sort(model.begin(), model.end(), [flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
+            model.sort([flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
                 return flag ? state1.getAdvances() < state2.getAdvances() : state1.getAdvances() > state2.getAdvances();
             });
             break;
         case 3:
-            std::sort(model.begin(), model.end(), [flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
+            model.sort([flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
                 return flag ? state1.getSecondaryAdvance() < state2.getSecondaryAdvance()
                             : state1.getSecondaryAdvance() > state2.getSecondaryAdvance();
             });
             break;
         case 4:
-            std::sort(model.begin(), model.end(), [flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
+            model.sort([flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
                 return flag ? state1.getPID() < state2.getPID() : state1.getPID() > state2.getPID();
             });
             break;
         case 5:
-            std::sort(model.begin(), model.end(), [flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
+            model.sort([flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
                 return flag ? state1.getShiny() < state2.getShiny() : state1.getShiny() > state2.getShiny();
             });
             break;
         case 6:
-            std::sort(model.begin(), model.end(), [flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
+            model.sort([flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
                 return flag ? state1.getNature() < state2.getNature() : state1.getNature() > state2.getNature();
             });
             break;
         case 7:
-            std::sort(model.begin(), model.end(), [flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
+            model.sort([flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
                 return flag ? state1.getAbility() < state2.getAbility() : state1.getAbility() > state2.getAbility();
             });
             break;
@@ -188,23 +188,23 @@ void PokeWalkerSearcherModel::sort(int column, Qt::SortOrder order)
         case 11:
         case 12:
         case 13:
-            std::sort(model.begin(), model.end(), [flag, column](const PokeWalkerState &state1, const PokeWalkerState &state2) {
+            model.sort([flag, column](const PokeWalkerState &state1, const PokeWalkerState &state2) {
                 return flag ? state1.getIV(static_cast<u8>(column - 8)) < state2.getIV(static_cast<u8>(column - 8))
                             : state1.getIV(static_cast<u8>(column - 8)) > state2.getIV(static_cast<u8>(column - 8));
             });
             break;
         case 14:
-            std::sort(model.begin(), model.end(), [flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
+            model.sort([flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
                 return flag ? state1.getHidden() < state2.getHidden() : state1.getHidden() > state2.getHidden();
             });
             break;
         case 15:
-            std::sort(model.begin(), model.end(), [flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
+            model.sort([flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
                 return flag ? state1.getPower() < state2.getPower() : state1.getPower() > state2.getPower();
             });
             break;
         case 16:
-            std::sort(model.begin(), model.end(), [flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
+            model.sort([flag](const PokeWalkerState &state1, const PokeWalkerState &state2) {
                 return flag ? state1.getGender() < state2.getGender() : state1.getGender() > state2.getGender();
             });
             break;
@@ -253,7 +253,7 @@ QVariant PokeWalkerSearcherModel::data(const QModelIndex &index, int role) const
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 6:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 7:
             return state.getAbility();
         case 8:
@@ -264,11 +264,11 @@ QVariant PokeWalkerSearcherModel::data(const QModelIndex &index, int role) const
         case 13:
             return state.getIV(static_cast<u8>(column - 8));
         case 14:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 15:
             return state.getPower();
         case 16:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
     return QVariant();
@@ -78,7 +78,7 @@ QVariant StationaryGeneratorModel4::data(const QModelIndex &index, int role) con
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 5:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 6:
             return state.getAbility();
         case 7:
@@ -89,11 +89,11 @@ QVariant StationaryGeneratorModel4::data(const QModelIndex &index, int role) con
         case 12:
             return state.getIV(static_cast<u8>(column - 7));
         case 13:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 14:
             return state.getPower();
         case 15:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
     return QVariant();
@@ -147,37 +147,37 @@ void StationarySearcherModel4::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
+            model.sort([flag](const StationaryState &state1, const StationaryState &state2) {
                 return flag ? state1.getSeed() < state2.getSeed() : state1.getSeed() > state2.getSeed();
             });
             break;
         case 1:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
+            model.sort([flag](const StationaryState &state1, const StationaryState &state2) {
                 return flag ? state1.getAdvances() < state2.getAdvances() : state1.getAdvances() > state2.getAdvances();
             });
             break;
         case 2:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
+            model.sort([flag](const StationaryState &state1, const StationaryState &state2) {
                 return flag ? state1.getLead() < state2.getLead() : state1.getLead() > state2.getLead();
             });
             break;
         case 3:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
+            model.sort([flag](const StationaryState &state1, const StationaryState &state2) {
                 return flag ? state1.getPID() < state2.getPID() : state1.getPID() > state2.getPID();
             });
             break;
         case 4:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
+            model.sort([flag](const StationaryState &state1, const StationaryState &state2) {
                 return flag ? state1.getShiny() < state2.getShiny() : state1.getShiny() > state2.getShiny();
             });
             break;
         case 5:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
+            model.sort([flag](const StationaryState &state1, const StationaryState &state2) {
                 return flag ? state1.getNature() < state2.getNature() : state1.getNature() > state2.getNature();
             });
             break;
         case 6:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
+            model.sort([flag](const StationaryState &state1, const StationaryState &state2) {
                 return flag ? state1.getAbility() < state2.getAbility() : state1.getAbility() > state2.getAbility();
             });
             break;
@@ -187,23 +187,23 @@ void StationarySearcherModel4::sort(int column, Qt::SortOrder order)
         case 10:
         case 11:
         case 12:
-            std::sort(model.begin(), model.end(), [flag, column](const StationaryState &state1, const StationaryState &state2) {
+            model.sort([flag, column](const StationaryState &state1, const StationaryState &state2) {
                 return flag ? state1.getIV(static_cast<u8>(column - 7)) < state2.getIV(static_cast<u8>(column - 7))
                             : state1.getIV(static_cast<u8>(column - 7)) > state2.getIV(static_cast<u8>(column - 7));
             });
             break;
         case 13:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
+            model.sort([flag](const StationaryState &state1, const StationaryState &state2) {
                 return flag ? state1.getHidden() < state2.getHidden() : state1.getHidden() > state2.getHidden();
             });
             break;
         case 14:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
+            model.sort([flag](const StationaryState &state1, const StationaryState &state2) {
                 return flag ? state1.getPower() < state2.getPower() : state1.getPower() > state2.getPower();
             });
             break;
         case 15:
-            std::sort(model.begin(), model.end(), [flag](const StationaryState &state1, const StationaryState &state2) {
+            model.sort([flag](const StationaryState &state1, const StationaryState &state2) {
                 return flag ? state1.getGender() < state2.getGender() : state1.getGender() > state2.getGender();
             });
             break;
@@ -272,7 +272,7 @@ QVariant StationarySearcherModel4::data(const QModelIndex &index, int role) cons
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 5:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 6:
             return state.getAbility();
         case 7:
@@ -283,11 +283,11 @@ QVariant StationarySearcherModel4::data(const QModelIndex &index, int role) cons
         case 12:
             return state.getIV(static_cast<u8>(column - 7));
         case 13:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 14:
             return state.getPower();
         case 15:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
     return QVariant();
@@ -70,7 +70,7 @@ QVariant UnownGeneratorModel4::data(const QModelIndex &index, int role) const
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 7:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 8:
             return state.getAbility();
         case 9:
@@ -81,11 +81,11 @@ QVariant UnownGeneratorModel4::data(const QModelIndex &index, int role) const
         case 14:
             return state.getIV(static_cast<u8>(column - 9));
         case 15:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 16:
             return state.getPower();
         case 17:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
     return QVariant();
@@ -135,39 +135,39 @@ void UnownSearcherModel4::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(), [flag](const UnownState4 &state1, const UnownState4 &state2) {
+            model.sort([flag](const UnownState4 &state1, const UnownState4 &state2) {
                 return flag ? state1.getSeed() < state2.getSeed() : state1.getSeed() > state2.getSeed();
             });
             break;
         case 1:
-            std::sort(model.begin(), model.end(), [flag](const UnownState4 &state1, const UnownState4 &state2) {
+            model.sort([flag](const UnownState4 &state1, const UnownState4 &state2) {
                 return flag ? state1.getAdvances() < state2.getAdvances() : state1.getAdvances() > state2.getAdvances();
             });
             break;
         case 2:
-            std::sort(model.begin(), model.end(), [flag](const UnownState4 &state1, const UnownState4 &state2) {
+            model.sort([flag](const UnownState4 &state1, const UnownState4 &state2) {
                 return flag ? state1.getLead() < state2.getLead() : state1.getLead() > state2.getLead();
             });
             break;
         case 3:
             break;
         case 4:
-            std::sort(model.begin(), model.end(), [flag](const UnownState4 &state1, const UnownState4 &state2) {
+            model.sort([flag](const UnownState4 &state1, const UnownState4 &state2) {
                 return flag ? state1.getPID() < state2.getPID() : state1.getPID() > state2.getPID();
             });
             break;
         case 5:
-            std::sort(model.begin(), model.end(), [flag](const UnownState4 &state1, const UnownState4 &state2) {
+            model.sort([flag](const UnownState4 &state1, const UnownState4 &state2) {
                 return flag ? state1.getShiny() < state2.getShiny() : state1.getShiny() > state2.getShiny();
             });
             break;
         case 6:
-            std::sort(model.begin(), model.end(), [flag](const UnownState4 &state1, const UnownState4 &state2) {
+            model.sort([flag](const UnownState4 &state1, const UnownState4 &state2) {
                 return flag ? state1.getNature() < state2.getNature() : state1.getNature() > state2.getNature();
             });
             break;
         case 7:
-            std::sort(model.begin(), model.end(), [flag](const UnownState4 &state1, const UnownState4 &state2) {
+            model.sort([flag](const UnownState4 &state1, const UnownState4 &state2) {
                 return flag ? state1.getAbility() < state2.getAbility() : state1.getAbility() > state2.getAbility();
             });
             break;
@@ -177,23 +177,23 @@ void UnownSearcherModel4::sort(int column, Qt::SortOrder order)
         case 11:
         case 12:
         case 13:
-            std::sort(model.begin(), model.end(), [flag, column](const UnownState4 &state1, const UnownState4 &state2) {
+            model.sort([flag, column](const UnownState4 &state1, const UnownState4 &state2) {
                 return flag ? state1.getIV(static_cast<u8>(column - 8)) < state2.getIV(static_cast<u8>(column - 8))
                             : state1.getIV(static_cast<u8>(column - 8)) > state2.getIV(static_cast<u8>(column - 8));
             });
             break;
         case 14:
-            std::sort(model.begin(), model.end(), [flag](const UnownState4 &state1, const UnownState4 &state2) {
+            model.sort([flag](const UnownState4 &state1, const UnownState4 &state2) {
                 return flag ? state1.getHidden() < state2.getHidden() : state1.getHidden() > state2.getHidden();
             });
             break;
         case 15:
-            std::sort(model.begin(), model.end(), [flag](const UnownState4 &state1, const UnownState4 &state2) {
+            model.sort([flag](const UnownState4 &state1, const UnownState4 &state2) {
                 return flag ? state1.getPower() < state2.getPower() : state1.getPower() > state2.getPower();
             });
             break;
         case 16:
-            std::sort(model.begin(), model.end(), [flag](const UnownState4 &state1, const UnownState4 &state2) {
+            model.sort([flag](const UnownState4 &state1, const UnownState4 &state2) {
                 return flag ? state1.getGender() < state2.getGender() : state1.getGender() > state2.getGender();
             });
             break;
@@ -252,7 +252,7 @@ QVariant UnownSearcherModel4::data(const QModelIndex &index, int role) const
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 6:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 7:
             return state.getAbility();
         case 8:
@@ -263,11 +263,11 @@ QVariant UnownSearcherModel4::data(const QModelIndex &index, int role) const
         case 13:
             return state.getIV(static_cast<u8>(column - 8));
         case 14:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 15:
             return state.getPower();
         case 16:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
     return QVariant();
@@ -87,7 +87,7 @@ QVariant WildGeneratorModel4::data(const QModelIndex &index, int role) const
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 9:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 10:
             return state.getAbility();
         case 11:
@@ -98,11 +98,11 @@ QVariant WildGeneratorModel4::data(const QModelIndex &index, int role) const
         case 16:
             return state.getIV(static_cast<u8>(column - 11));
         case 17:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 18:
             return state.getPower();
         case 19:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
     return QVariant();
@@ -152,52 +152,52 @@ void WildSearcherModel4::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getSeed() < state2.getSeed() : state1.getSeed() > state2.getSeed();
             });
             break;
         case 1:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getAdvances() < state2.getAdvances() : state1.getAdvances() > state2.getAdvances();
             });
             break;
         case 2:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getLead() < state2.getLead() : state1.getLead() > state2.getLead();
             });
             break;
         case 3:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getItem() > state2.getItem() : state1.getItem() < state2.getItem();
             });
             break;
         case 4:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getEncounterSlot() < state2.getEncounterSlot() : state1.getEncounterSlot() > state2.getEncounterSlot();
             });
             break;
         case 5:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getLevel() < state2.getLevel() : state1.getLevel() > state2.getLevel();
             });
             break;
         case 6:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getPID() < state2.getPID() : state1.getPID() > state2.getPID();
             });
             break;
         case 7:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getShiny() < state2.getShiny() : state1.getShiny() > state2.getShiny();
             });
             break;
         case 8:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getNature() < state2.getNature() : state1.getNature() > state2.getNature();
             });
             break;
         case 9:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getAbility() < state2.getAbility() : state1.getAbility() > state2.getAbility();
             });
             break;
@@ -207,23 +207,23 @@ void WildSearcherModel4::sort(int column, Qt::SortOrder order)
         case 13:
         case 14:
         case 15:
-            std::sort(model.begin(), model.end(), [flag, column](const WildState &state1, const WildState &state2) {
+            model.sort([flag, column](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getIV(static_cast<u8>(column - 10)) < state2.getIV(static_cast<u8>(column - 10))
                             : state1.getIV(static_cast<u8>(column - 10)) > state2.getIV(static_cast<u8>(column - 10));
             });
             break;
         case 16:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getHidden() < state2.getHidden() : state1.getHidden() > state2.getHidden();
             });
             break;
         case 17:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getPower() < state2.getPower() : state1.getPower() > state2.getPower();
             });
             break;
         case 18:
-            std::sort(model.begin(), model.end(), [flag](const WildState &state1, const WildState &state2) {
+            model.sort([flag](const WildState &state1, const WildState &state2) {
                 return flag ? state1.getGender() < state2.getGender() : state1.getGender() > state2.getGender();
             });
             break;
@@ -298,7 +298,7 @@ QVariant WildSearcherModel4::data(const QModelIndex &index, int role) const
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 8:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 9:
             return state.getAbility();
         case 10:
@@ -309,11 +309,11 @@ QVariant WildSearcherModel4::data(const QModelIndex &index, int role) const
         case 15:
             return state.getIV(static_cast<u8>(column - 10));
         case 16:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 17:
             return state.getPower();
         case 18:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
     return QVariant();
@@ -51,7 +51,7 @@ QVariant EggGeneratorModel5::data(const QModelIndex &index, int role) const
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 4:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 5:
         {
             u8 ability = state.getAbility();
@@ -69,11 +69,11 @@ QVariant EggGeneratorModel5::data(const QModelIndex &index, int role) const
         case 11:
             return state.getIV(static_cast<u8>(column - 6));
         case 12:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 13:
             return state.getPower();
         case 14:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
 
@@ -142,12 +142,11 @@ void EggSearcherModel5::sort(int column, Qt::SortOrder order)
         case 9:
         case 10:
         case 11:
-            std::sort(model.begin(), model.end(),
-                      [flag, column](const SearcherState5<EggState> &state1, const SearcherState5<EggState> &state2) {
-                          return flag
-                              ? state1.getState().getIV(static_cast<u8>(column - 6)) < state2.getState().getIV(static_cast<u8>(column - 6))
-                              : state1.getState().getIV(static_cast<u8>(column - 6)) > state2.getState().getIV(static_cast<u8>(column - 6));
-                      });
+            model.sort([flag, column](const SearcherState5<EggState> &state1, const SearcherState5<EggState> &state2) {
+                return flag
+                    ? state1.getState().getIV(static_cast<u8>(column - 6)) < state2.getState().getIV(static_cast<u8>(column - 6))
+                    : state1.getState().getIV(static_cast<u8>(column - 6)) > state2.getState().getIV(static_cast<u8>(column - 6));
+            });
             break;
         case 12:
             std::sort(model.begin(), model.end(), [flag](const SearcherState5<EggState> &state1, const SearcherState5<EggState> &state2) {
@@ -213,7 +212,7 @@ QVariant EggSearcherModel5::data(const QModelIndex &index, int role) const
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 4:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 5:
         {
             u8 ability = state.getAbility();
@@ -231,11 +230,11 @@ QVariant EggSearcherModel5::data(const QModelIndex &index, int role) const
         case 11:
             return state.getIV(static_cast<u8>(column - 6));
         case 12:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 13:
             return state.getPower();
         case 14:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         case 15:
             return QString::fromStdString(display.getDateTime().toString());
         case 16:
@@ -51,7 +51,7 @@ QVariant EventGeneratorModel5::data(const QModelIndex &index, int role) const
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 4:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 5:
         {
             u8 ability = state.getAbility();
@@ -69,11 +69,11 @@ QVariant EventGeneratorModel5::data(const QModelIndex &index, int role) const
         case 11:
             return state.getIV(static_cast<u8>(column - 6));
         case 12:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 13:
             return state.getPower();
         case 14:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
 
@@ -102,36 +102,36 @@ void EventSearcherModel5::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
+            model.sort([flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
                 return flag ? state1.getInitialSeed() < state2.getInitialSeed() : state1.getInitialSeed() > state2.getInitialSeed();
             });
             break;
         case 1:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
+            model.sort([flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
                 return flag ? state1.getState().getAdvances() < state2.getState().getAdvances()
                             : state1.getState().getAdvances() > state2.getState().getAdvances();
             });
             break;
         case 2:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
+            model.sort([flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
                 return flag ? state1.getState().getPID() < state2.getState().getPID()
                             : state1.getState().getPID() > state2.getState().getPID();
             });
             break;
         case 3:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
+            model.sort([flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
                 return flag ? state1.getState().getShiny() < state2.getState().getShiny()
                             : state1.getState().getShiny() > state2.getState().getShiny();
             });
             break;
         case 4:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
+            model.sort([flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
                 return flag ? state1.getState().getNature() < state2.getState().getNature()
                             : state1.getState().getNature() > state2.getState().getNature();
             });
             break;
         case 5:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
+            model.sort([flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
                 return flag ? state1.getState().getAbility() < state2.getState().getAbility()
                             : state1.getState().getAbility() > state2.getState().getAbility();
             });
@@ -142,41 +142,41 @@ void EventSearcherModel5::sort(int column, Qt::SortOrder order)
         case 9:
         case 10:
         case 11:
-            std::sort(model.begin(), model.end(), [flag, column](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
+            model.sort([flag, column](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
                 return flag ? state1.getState().getIV(static_cast<u8>(column - 6)) < state2.getState().getIV(static_cast<u8>(column - 6))
                             : state1.getState().getIV(static_cast<u8>(column - 6)) > state2.getState().getIV(static_cast<u8>(column - 6));
             });
             break;
         case 12:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
+            model.sort([flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
                 return flag ? state1.getState().getHidden() < state2.getState().getHidden()
                             : state1.getState().getHidden() > state2.getState().getHidden();
             });
             break;
         case 13:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
+            model.sort([flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
                 return flag ? state1.getState().getPower() < state2.getState().getPower()
                             : state1.getState().getPower() > state2.getState().getPower();
             });
             break;
         case 14:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
+            model.sort([flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
                 return flag ? state1.getState().getGender() < state2.getState().getGender()
                             : state1.getState().getGender() > state2.getState().getGender();
             });
             break;
         case 15:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
+            model.sort([flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
                 return flag ? state1.getDateTime() < state2.getDateTime() : state1.getDateTime() > state2.getDateTime();
             });
             break;
         case 16:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
+            model.sort([flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
                 return flag ? state1.getTimer0() < state2.getTimer0() : state1.getTimer0() > state2.getTimer0();
             });
             break;
         case 17:
-            std::sort(model.begin(), model.end(), [flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
+            model.sort([flag](const SearcherState5<State> &state1, const SearcherState5<State> &state2) {
                 return flag ? state1.getButtons() < state2.getButtons() : state1.getButtons() > state2.getButtons();
             });
             break;
@@ -211,7 +211,7 @@ QVariant EventSearcherModel5::data(const QModelIndex &index, int role) const
             return shiny == 2 ? tr("Square") : shiny == 1 ? tr("Star") : tr("No");
         }
         case 4:
-            return QString::fromStdString(Translator::getNature(state.getNature()));
+            return QString::fromUtf8(Translator::getNature(state.getNature()));
         case 5:
         {
             u8 ability = state.getAbility();
@@ -229,11 +229,11 @@ QVariant EventSearcherModel5::data(const QModelIndex &index, int role) const
         case 11:
             return state.getIV(static_cast<u8>(column - 6));
         case 12:
-            return QString::fromStdString(Translator::getHiddenPower(state.getHidden()));
+            return QString::fromUtf8(Translator::getHiddenPower(state.getHidden()));
         case 13:
             return state.getPower();
         case 14:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         case 15:
             return QString::fromStdString(display.getDateTime().toString());
         case 16:
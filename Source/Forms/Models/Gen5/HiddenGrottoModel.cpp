@@ -48,7 +48,7 @@ QVariant HiddenGrottoGeneratorModel5::data(const QModelIndex &index, int role) c
         case 3:
             return state.getSlot();
         case 4:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         }
     }
     return QVariant();
@@ -76,57 +76,49 @@ void HiddenGrottoSearcherModel5::sort(int column, Qt::SortOrder order)
         switch (column)
         {
         case 0:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2) {
-                          return flag ? state1.getInitialSeed() < state2.getInitialSeed()
-                                      : state1.getInitialSeed() > state2.getInitialSeed();
-                      });
+            model.sort([flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2) {
+                return flag ? state1.getInitialSeed() < state2.getInitialSeed()
+                            : state1.getInitialSeed() > state2.getInitialSeed();
+            });
             break;
         case 1:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2)
-                      {
-                          return flag ? state1.getState().getAdvances() < state2.getState().getAdvances()
-                                      : state1.getState().getAdvances() > state2.getState().getAdvances();
-                      });
+            model.sort([flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2)
+            {
+                return flag ? state1.getState().getAdvances() < state2.getState().getAdvances()
+                            : state1.getState().getAdvances() > state2.getState().getAdvances();
+            });
             break;
         case 2:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2)
-                      {
-                          return flag ? state1.getState().getGroup() < state2.getState().getGroup()
-                                      : state1.getState().getGroup() > state2.getState().getGroup();
-                      });
+            model.sort([flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2)
+            {
+                return flag ? state1.getState().getGroup() < state2.getState().getGroup()
+                            : state1.getState().getGroup() > state2.getState().getGroup();
+            });
             break;
         case 3:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2) {
-                          return flag ? state1.getState().getSlot() < state2.getState().getSlot()
-                                      : state1.getState().getSlot() > state2.getState().getSlot();
-                      });
+            model.sort([flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2) {
+                return flag ? state1.getState().getSlot() < state2.getState().getSlot()
+                            : state1.getState().getSlot() > state2.getState().getSlot();
+            });
             break;
         case 4:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2)
-                      {
-                          return flag ? state1.getState().getGender() < state2.getState().getGender()
-                                      : state1.getState().getGender() > state2.getState().getGender();
-                      });
+            model.sort([flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2)
+            {
+                return flag ? state1.getState().getGender() < state2.getState().getGender()
+                            : state1.getState().getGender() > state2.getState().getGender();
+            });
             break;
         case 5:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2)
-                      { return flag ? state1.getDateTime() < state2.getDateTime() : state1.getDateTime() > state2.getDateTime(); });
+            model.sort([flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2)
+            { return flag ? state1.getDateTime() < state2.getDateTime() : state1.getDateTime() > state2.getDateTime(); });
             break;
         case 6:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2)
-                      { return flag ? state1.getTimer0() < state2.getTimer0() : state1.getTimer0() > state2.getTimer0(); });
+            model.sort([flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2)
+            { return flag ? state1.getTimer0() < state2.getTimer0() : state1.getTimer0() > state2.getTimer0(); });
             break;
         case 7:
-            std::sort(model.begin(), model.end(),
-                      [flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2)
-                      { return flag ? state1.getButtons() < state2.getButtons() : state1.getButtons() > state2.getButtons(); });
+            model.sort([flag](const SearcherState5<HiddenGrottoState> &state1, const SearcherState5<HiddenGrottoState> &state2)
+            { return flag ? state1.getButtons() < state2.getButtons() : state1.getButtons() > state2.getButtons(); });
             break;
         }
     }
@@ -156,7 +148,7 @@ QVariant HiddenGrottoSearcherModel5::data(const QModelIndex &index, int role) co
         case 3:
             return state.getSlot();
         case 4:
-            return QString::fromStdString(Translator::getGender(state.getGender()));
+            return QString::fromUtf8(Translator::getGender(state.getGender()));
         case 5:
             return QString::fromStdString(display.getDateTime().toString());
         case 6:
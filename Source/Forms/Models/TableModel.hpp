@@ -20,46 +20,72 @@
 #ifndef TABLEMODEL_HPP
 #define TABLEMODEL_HPP
 
+#include <Core/Util/Exporter.hpp>
+#include <Forms/Models/TableStorage.hpp>
 #include <QAbstractTableModel>
+#include <QMessageBox>
+#include <QProgressDialog>
+#include <QTimer>
+#include <functional>
+#include <memory>
+
+// Lets TableView export a model without knowing its row type
+class ExportModel
+{
+public:
+    virtual ~ExportModel() = default;
+
+    virtual void exportModel(const QString &fileName, bool csv) = 0;
+};
 
 template <class Item>
-class TableModel : public QAbstractTableModel
+class TableModel : public QAbstractTableModel, public ExportModel
 {
+    static constexpr size_t fetchSize = 10000;
+
 public:
     TableModel(QObject *parent = nullptr) : QAbstractTableModel(parent)
     {
+        // Failures can happen while the view paints, so the message is shown once control is back in the event loop
+        model.setErrorHandler([this] {
+            QTimer::singleShot(0, this, [] {
+                QMessageBox error;
+                error.setText(tr("The temporary file holding results failed, rows that could not be read back are shown empty."));
+                error.exec();
+            });
+        });
     }
 
-    void addItems(const std::vector<Item> &items)
+    void addItems(std::vector<Item> items)
     {
         if (!items.empty())
         {
-            int i = rowCount();
-            emit beginInsertRows(QModelIndex(), i, i + static_cast<int>(items.size()) - 1);
-            model.insert(model.end(), items.begin(), items.end());
-            emit endInsertRows();
+            model.append(std::move(items));
+
+            // Rows are exposed to the view in batches through fetchMore once the first batch is shown
+            if (fetched < fetchSize)
+            {
+                fetchMore(QModelIndex());
+            }
         }
     }
 
     void addItem(const Item &item)
     {
-        int i = rowCount();
-        emit beginInsertRows(QModelIndex(), i, i);
-        model.emplace_back(item);
-        emit endInsertRows();
+        addItems({ item });
     }
 
     void updateItem(const Item &item, int row)
     {
-        model[row] = item;
+        model.at(row) = item;
         emit dataChanged(index(row, 0), index(row, columnCount()));
     }
 
     void removeItem(int row)
     {
         emit beginRemoveRows(QModelIndex(), row, row);
-        model.erase(model.begin() + row);
-        model.shrink_to_fit();
+        model.erase(row);
+        fetched--;
         emit endRemoveRows();
     }
 
@@ -70,28 +96,160 @@ public:
 
     std::vector<Item> getModel() const
     {
-        return model;
+        return model.toVector();
     }
 
     void clearModel()
     {
+        pager = nullptr;
         if (!model.empty())
         {
             emit beginRemoveRows(QModelIndex(), 0, rowCount() - 1);
             model.clear();
-            model.shrink_to_fit();
+            fetched = 0;
             emit endRemoveRows();
         }
     }
 
+    void setMemoryLimit(size_t limit)
+    {
+        model.setMemoryLimit(limit);
+    }
+
+    // Rows come from the pager once every stored row is shown, e.g. the result store of a searcher
+    void setPager(std::function<std::vector<Item>()> pager)
+    {
+        this->pager = std::move(pager);
+    }
+
+    void fetchPages()
+    {
+        while (fetched < fetchSize && canFetchMore(QModelIndex()))
+        {
+            size_t previous = fetched;
+            fetchMore(QModelIndex());
+            if (fetched == previous)
+            {
+                break;
+            }
+        }
+    }
+
+    void exportModel(const QString &fileName, bool csv) override
+    {
+        // Pages still waiting in the pager are written as well, rows past the memory limit go to the temporary file
+        if (pager)
+        {
+            for (auto items = pager(); !items.empty(); items = pager())
+            {
+                model.append(std::move(items));
+            }
+        }
+
+        int columns = columnCount(QModelIndex());
+        std::vector<std::string> header;
+        for (int column = 0; column < columns; column++)
+        {
+            header.emplace_back(headerData(column, Qt::Horizontal, Qt::DisplayRole).toString().toStdString());
+        }
+
+        auto exporter = std::make_shared<Exporter>(fileName.toStdString(), csv, header);
+        if (!exporter->isOpen())
+        {
+            return;
+        }
+        exporter->startExport();
+
+        // Rows present when the export starts are written, even if a search is still adding more
+        size_t total = model.size();
+        auto *dialog = new QProgressDialog(tr("Exporting results"), tr("Cancel"), 0, 1000);
+        dialog->setAttribute(Qt::WA_DeleteOnClose);
+        dialog->setMinimumDuration(500);
+
+        auto *timer = new QTimer(dialog);
+        connect(timer, &QTimer::timeout, this, [=, offset = size_t(0)]() mutable {
+            // Cells are formatted by data() in small batches on this thread, the worker only writes them out
+            if (offset < total && exporter->getPending() < fetchSize)
+            {
+                // Rows removed since the export started are skipped
+                total = std::min(total, model.size());
+                size_t end = std::min(offset + fetchSize / 10, total);
+                if (offset < end)
+                {
+                    std::vector<std::string> cells;
+                    cells.reserve((end - offset) * header.size());
+                    for (; offset < end; offset++)
+                    {
+                        for (int column = 0; column < columns; column++)
+                        {
+                            QModelIndex cell = createIndex(static_cast<int>(offset), column);
+                            cells.emplace_back(data(cell, Qt::DisplayRole).toString().toStdString());
+                        }
+                    }
+                    exporter->addRows(std::move(cells));
+                }
+            }
+
+            if (offset >= total)
+            {
+                exporter->finishExport();
+            }
+
+            size_t progress = total == 0 ? 1000 : exporter->getProgress() * 1000 / total;
+            dialog->setValue(static_cast<int>(std::min(progress, size_t(1000))));
+            if (exporter->isFinished())
+            {
+                timer->stop();
+                dialog->close();
+                if (exporter->hasError())
+                {
+                    QMessageBox error;
+                    error.setText(tr("Writing the export file failed, the file is incomplete."));
+                    error.exec();
+                }
+            }
+        });
+        connect(dialog, &QProgressDialog::canceled, dialog, [=] {
+            timer->stop();
+            exporter->cancelExport();
+            dialog->close();
+        });
+        connect(this, &QObject::destroyed, dialog, &QProgressDialog::cancel);
+
+        timer->start(10);
+    }
+
+    bool canFetchMore(const QModelIndex &parent) const override
+    {
+        return !parent.isValid() && (fetched < model.size() || pager);
+    }
+
+    void fetchMore(const QModelIndex &parent) override
+    {
+        if (!parent.isValid() && fetched == model.size() && pager)
+        {
+            model.append(pager());
+        }
+
+        if (!parent.isValid() && fetched < model.size())
+        {
+            size_t count = std::min(fetchSize, model.size() - fetched);
+            emit beginInsertRows(QModelIndex(), static_cast<int>(fetched), static_cast<int>(fetched + count) - 1);
+            fetched += count;
+            emit endInsertRows();
+        }
+    }
+
     int rowCount(const QModelIndex &parent = QModelIndex()) const override
     {
         (void)parent;
-        return static_cast<int>(model.size());
+        return static_cast<int>(fetched);
     }
 
 protected:
-    std::vector<Item> model;
+    TableStorage<Item> model;
+    std::function<std::vector<Item>()> pager;
+    size_t fetched = 0;
 };
 
 #endif // TABLEMODEL_HPP
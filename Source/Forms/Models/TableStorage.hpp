@@ -0,0 +1,453 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2021 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TABLESTORAGE_HPP
+#define TABLESTORAGE_HPP
+
+#include <QTemporaryFile>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// Rows are kept in fixed size chunks so appending never reallocates. Past the memory limit the oldest full chunks of
+// trivially copyable rows are written to a temporary file and reloaded on demand, failures are reported once.
+template <class Item>
+class TableStorage
+{
+    static constexpr size_t chunkSize = 4096;
+    static constexpr size_t cacheSize = 4;
+    static constexpr bool spillable = std::is_trivially_copyable_v<Item>;
+
+    struct Chunk
+    {
+        std::vector<Item> items;
+        bool resident = true;
+        bool dirty = true;
+    };
+
+public:
+    class iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Item;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Item *;
+        using reference = Item &;
+
+        iterator() = default;
+
+        iterator(TableStorage *storage, difference_type index) : storage(storage), index(index)
+        {
+        }
+
+        reference operator*() const
+        {
+            return storage->at(index);
+        }
+
+        pointer operator->() const
+        {
+            return &storage->at(index);
+        }
+
+        reference operator[](difference_type n) const
+        {
+            return storage->at(index + n);
+        }
+
+        iterator &operator++()
+        {
+            index++;
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator it = *this;
+            index++;
+            return it;
+        }
+
+        iterator &operator--()
+        {
+            index--;
+            return *this;
+        }
+
+        iterator operator--(int)
+        {
+            iterator it = *this;
+            index--;
+            return it;
+        }
+
+        iterator &operator+=(difference_type n)
+        {
+            index += n;
+            return *this;
+        }
+
+        iterator &operator-=(difference_type n)
+        {
+            index -= n;
+            return *this;
+        }
+
+        iterator operator+(difference_type n) const
+        {
+            return iterator(storage, index + n);
+        }
+
+        friend iterator operator+(difference_type n, const iterator &it)
+        {
+            return it + n;
+        }
+
+        iterator operator-(difference_type n) const
+        {
+            return iterator(storage, index - n);
+        }
+
+        difference_type operator-(const iterator &other) const
+        {
+            return index - other.index;
+        }
+
+        bool operator==(const iterator &other) const
+        {
+            return index == other.index;
+        }
+
+        bool operator!=(const iterator &other) const
+        {
+            return index != other.index;
+        }
+
+        bool operator<(const iterator &other) const
+        {
+            return index < other.index;
+        }
+
+        bool operator>(const iterator &other) const
+        {
+            return index > other.index;
+        }
+
+        bool operator<=(const iterator &other) const
+        {
+            return index <= other.index;
+        }
+
+        bool operator>=(const iterator &other) const
+        {
+            return index >= other.index;
+        }
+
+    private:
+        TableStorage *storage = nullptr;
+        difference_type index = 0;
+    };
+
+    iterator begin()
+    {
+        return iterator(this, 0);
+    }
+
+    iterator end()
+    {
+        return iterator(this, static_cast<std::ptrdiff_t>(count));
+    }
+
+    const Item &operator[](size_t index) const
+    {
+        return load(index / chunkSize).items[index % chunkSize];
+    }
+
+    Item &at(size_t index)
+    {
+        Chunk &chunk = load(index / chunkSize);
+        chunk.dirty = true;
+        return chunk.items[index % chunkSize];
+    }
+
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    size_t size() const
+    {
+        return count;
+    }
+
+    size_t getResident() const
+    {
+        size_t resident = 0;
+        for (const auto &chunk : chunks)
+        {
+            resident += chunk.resident ? chunk.items.size() : 0;
+        }
+        return resident;
+    }
+
+    // Rows kept in memory before older rows are written to disk, 0 never spills
+    void setMemoryLimit(size_t limit)
+    {
+        memoryLimit = limit;
+        spill();
+    }
+
+    void setErrorHandler(std::function<void()> handler)
+    {
+        onError = std::move(handler);
+    }
+
+    void append(std::vector<Item> &&items)
+    {
+        auto it = std::make_move_iterator(items.begin());
+        auto end = std::make_move_iterator(items.end());
+        while (it != end)
+        {
+            if (chunks.empty() || chunks.back().items.size() == chunkSize)
+            {
+                chunks.emplace_back();
+                chunks.back().items.reserve(chunkSize);
+            }
+
+            auto &chunk = chunks.back().items;
+            size_t length = std::min(chunkSize - chunk.size(), static_cast<size_t>(std::distance(it, end)));
+            chunk.insert(chunk.end(), it, it + length);
+            it += length;
+            count += length;
+        }
+
+        spill();
+    }
+
+    void erase(size_t index)
+    {
+        // Rows are shifted a chunk at a time through the cache so spilled chunks stay on disk. The first row of the
+        // next chunk is read before the current chunk loses a row so an evicted chunk is always full.
+        for (size_t i = index / chunkSize, row = index % chunkSize; i < chunks.size(); i++, row = 0)
+        {
+            bool next = i + 1 < chunks.size();
+            Item item = next ? load(i + 1).items.front() : Item();
+
+            Chunk &chunk = load(i);
+            chunk.items.erase(chunk.items.begin() + static_cast<std::ptrdiff_t>(row));
+            if (next)
+            {
+                chunk.items.emplace_back(std::move(item));
+            }
+            chunk.dirty = true;
+        }
+
+        if (chunks.back().items.empty())
+        {
+            chunks.pop_back();
+            keepLast();
+        }
+        count--;
+    }
+
+    // Spilled rows are loaded back for the sort and spilled again afterwards
+    template <class Compare>
+    void sort(Compare compare)
+    {
+        restore();
+        std::sort(begin(), end(), compare);
+        spill();
+    }
+
+    void clear()
+    {
+        chunks.clear();
+        cache.clear();
+        file.reset();
+        count = 0;
+        failed = false;
+    }
+
+    std::vector<Item> toVector() const
+    {
+        std::vector<Item> items;
+        items.reserve(count);
+        for (size_t i = 0; i < chunks.size(); i++)
+        {
+            const auto &chunk = load(i).items;
+            items.insert(items.end(), chunk.begin(), chunk.end());
+        }
+        return items;
+    }
+
+private:
+    mutable std::vector<Chunk> chunks;
+    mutable std::vector<size_t> cache;
+    mutable std::unique_ptr<QTemporaryFile> file;
+    std::function<void()> onError;
+    size_t count = 0;
+    size_t memoryLimit = 1 << 20;
+    mutable bool failed = false;
+
+    Chunk &load(size_t index) const
+    {
+        Chunk &chunk = chunks[index];
+        if constexpr (spillable)
+        {
+            if (!chunk.resident)
+            {
+                // A chunk that could not be written back stays resident and out of the cache
+                if (cache.size() == cacheSize)
+                {
+                    evict(cache.front());
+                    cache.erase(cache.begin());
+                }
+
+                read(index);
+                cache.emplace_back(index);
+            }
+        }
+        return chunk;
+    }
+
+    void read(size_t index) const
+    {
+        if constexpr (spillable)
+        {
+            Chunk &chunk = chunks[index];
+            chunk.items.resize(chunkSize);
+            auto size = static_cast<qint64>(chunkSize * sizeof(Item));
+            if (!file->seek(static_cast<qint64>(index * chunkSize * sizeof(Item)))
+                || file->read(reinterpret_cast<char *>(chunk.items.data()), size) != size)
+            {
+                chunk.items.assign(chunkSize, Item());
+                fail();
+            }
+            chunk.resident = true;
+            chunk.dirty = false;
+        }
+    }
+
+    bool evict(size_t index) const
+    {
+        if constexpr (spillable)
+        {
+            Chunk &chunk = chunks[index];
+            if (chunk.dirty)
+            {
+                auto size = static_cast<qint64>(chunkSize * sizeof(Item));
+                if (!file->seek(static_cast<qint64>(index * chunkSize * sizeof(Item)))
+                    || file->write(reinterpret_cast<const char *>(chunk.items.data()), size) != size)
+                {
+                    fail();
+                    return false;
+                }
+                chunk.dirty = false;
+            }
+
+            chunk.items.clear();
+            chunk.items.shrink_to_fit();
+            chunk.resident = false;
+        }
+        return true;
+    }
+
+    void fail() const
+    {
+        if (!failed)
+        {
+            failed = true;
+            if (onError)
+            {
+                onError();
+            }
+        }
+    }
+
+    void keepLast()
+    {
+        // Rows are appended to the last chunk, so it has to stay resident and out of the cache
+        if (!chunks.empty())
+        {
+            size_t last = chunks.size() - 1;
+            if (!chunks[last].resident)
+            {
+                read(last);
+            }
+            cache.erase(std::remove(cache.begin(), cache.end(), last), cache.end());
+        }
+    }
+
+    void restore()
+    {
+        for (size_t i = 0; i < chunks.size(); i++)
+        {
+            if (!chunks[i].resident)
+            {
+                read(i);
+            }
+        }
+        cache.clear();
+    }
+
+    void spill()
+    {
+        if constexpr (spillable)
+        {
+            if (memoryLimit == 0 || failed)
+            {
+                return;
+            }
+
+            size_t resident = getResident();
+
+            // Only full chunks are spilled so every chunk has a fixed position in the file
+            for (size_t i = 0; resident > memoryLimit && i + 1 < chunks.size(); i++)
+            {
+                if (chunks[i].resident)
+                {
+                    if (!file)
+                    {
+                        file = std::make_unique<QTemporaryFile>();
+                        if (!file->open())
+                        {
+                            file.reset();
+                            fail();
+                            return;
+                        }
+                    }
+
+                    if (!evict(i))
+                    {
+                        break;
+                    }
+                    resident -= chunkSize;
+                }
+            }
+            cache.erase(std::remove_if(cache.begin(), cache.end(), [this](size_t i) { return !chunks[i].resident; }),
+                        cache.end());
+        }
+    }
+};
+
+#endif // TABLESTORAGE_HPP
@@ -185,11 +185,15 @@ QModelIndex ResearcherModel::search(const QString &string, u64 result, int row)
         getResult = [](const ResearcherState &state) { return state.getCustom(9); };
     }
 
-    for (; row < rowCount(); row++)
+    for (; row < static_cast<int>(model.size()); row++)
     {
         u64 value = getResult(model[row]);
         if (value == result)
         {
+            while (row >= rowCount())
+            {
+                fetchMore(QModelIndex());
+            }
             return index(row, column, QModelIndex());
         }
     }
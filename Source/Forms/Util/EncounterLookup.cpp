@@ -94,10 +94,10 @@ std::set<std::pair<u8, QString>> EncounterLookup::getEncounters3(Game game, u16
 
     for (const auto &type : types)
     {
-        auto areas = Encounters3::getEncounters(type, profile);
+        const auto &areas = Encounters3::getEncounters(type, profile);
         for (const auto &area : areas)
         {
-            std::vector<Slot> pokemon = area.getPokemon();
+            const auto &pokemon = area.getPokemon();
             if (std::any_of(pokemon.begin(), pokemon.end(), [specie](const auto &entry) { return entry.getSpecie() == specie; }))
             {
                 QString info = getEncounterString(type);
@@ -151,10 +151,10 @@ std::set<std::pair<u8, QString>> EncounterLookup::getEncounters4(Game game, u16
         {
             for (const auto &time : { 0, 1, 2 })
             {
-                auto areas = Encounters4::getEncounters(type, time, profile);
+                const auto &areas = Encounters4::getEncounters(type, time, profile);
                 for (const auto &area : areas)
                 {
-                    auto pokemon = area.getPokemon();
+                    const auto &pokemon = area.getPokemon();
                     if (std::any_of(pokemon.begin(), pokemon.end(), [specie](const auto &entry) { return entry.getSpecie() == specie; }))
                     {
                         QString info = getEncounterString(type);
@@ -200,7 +200,7 @@ void EncounterLookup::find()
     Game game = static_cast<Game>(ui->comboBoxGame->currentData().toInt());
     u16 specie = static_cast<u16>(ui->comboBoxPokemon->currentIndex() + 1);
     std::set<std::pair<u8, QString>> encounters;
-    std::vector<std::string> locationNames;
+    std::vector<std::string_view> locationNames;
 
     if (game & Game::FRLG || game & Game::RSE)
     {
@@ -221,7 +221,7 @@ void EncounterLookup::find()
     {
         QList<QStandardItem *> row;
         QStringList split = encounter.second.split('/');
-        row << new QStandardItem(QString::fromStdString(locationNames[i++])) << new QStandardItem(split[0]) << new QStandardItem(split[1]);
+        row << new QStandardItem(QString::fromUtf8(locationNames[i++])) << new QStandardItem(split[0]) << new QStandardItem(split[1]);
         model->appendRow(row);
     }
 }
@@ -251,9 +251,9 @@ void EncounterLookup::gameIndexChanged(int index)
         int oldIndex = ui->comboBoxPokemon->currentIndex();
 
         ui->comboBoxPokemon->clear();
-        for (const std::string &specie : Translator::getSpecies(nums))
+        for (std::string_view specie : Translator::getSpecies(nums))
         {
-            ui->comboBoxPokemon->addItem(QString::fromStdString(specie));
+            ui->comboBoxPokemon->addItem(QString::fromUtf8(specie));
         }
 
         if (oldIndex >= 0 && oldIndex < nums.size())
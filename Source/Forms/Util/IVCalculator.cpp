@@ -47,17 +47,17 @@ IVCalculator::~IVCalculator()
 
 void IVCalculator::setupModels()
 {
-    for (const std::string &nature : Translator::getNatures())
+    for (std::string_view nature : Translator::getNatures())
     {
-        ui->comboBoxNature->addItem(QString::fromStdString(nature));
+        ui->comboBoxNature->addItem(QString::fromUtf8(nature));
     }
-    for (const std::string &hiddenPower : Translator::getHiddenPowers())
+    for (std::string_view hiddenPower : Translator::getHiddenPowers())
     {
-        ui->comboBoxHiddenPower->addItem(QString::fromStdString(hiddenPower));
+        ui->comboBoxHiddenPower->addItem(QString::fromUtf8(hiddenPower));
     }
-    for (const std::string &characteristic : Translator::getCharacteristic())
+    for (std::string_view characteristic : Translator::getCharacteristic())
     {
-        ui->comboBoxCharacteristic->addItem(QString::fromStdString(characteristic));
+        ui->comboBoxCharacteristic->addItem(QString::fromUtf8(characteristic));
     }
 
     ui->comboBoxPokemon->setEditable(true);
@@ -295,9 +295,9 @@ void IVCalculator::generationIndexChanged(int index)
         std::iota(species.begin(), species.end(), 1);
 
         ui->comboBoxPokemon->clear();
-        for (const std::string &specie : Translator::getSpecies(species))
+        for (std::string_view specie : Translator::getSpecies(species))
         {
-            ui->comboBoxPokemon->addItem(QString::fromStdString(specie));
+            ui->comboBoxPokemon->addItem(QString::fromUtf8(specie));
         }
     }
 }
@@ -53,9 +53,9 @@ void IVtoPID::setupModels()
     ui->tableView->setModel(model);
 
     ui->textBoxTID->setValues(InputType::TIDSID);
-    for (const std::string &nature : Translator::getNatures())
+    for (std::string_view nature : Translator::getNatures())
     {
-        ui->comboBoxNature->addItem(QString::fromStdString(nature));
+        ui->comboBoxNature->addItem(QString::fromUtf8(nature));
     }
 
     connect(ui->pushButtonFind, &QPushButton::clicked, this, &IVtoPID::find);
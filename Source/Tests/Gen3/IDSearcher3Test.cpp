@@ -0,0 +1,112 @@
+#include "IDSearcher3Test.hpp"
+#include <Core/Enum/Game.hpp>
+#include <Core/Gen3/Generators/IDGenerator3.hpp>
+#include <Core/Gen3/Searchers/IDSearcher3.hpp>
+#include <QTest>
+#include <QVector>
+
+static std::vector<IDState3> searchIDs(const QVector<u16> &tids, const QVector<u16> &sids, const QVector<u16> &tsvs, Game version,
+                                       int threads, u32 initialAdvances = 0, u32 maxAdvances = 0)
+{
+    IDSearcher3 searcher(std::vector<u16>(tids.begin(), tids.end()), std::vector<u16>(sids.begin(), sids.end()),
+                         std::vector<u16>(tsvs.begin(), tsvs.end()), version);
+    searcher.startSearch(threads, initialAdvances, maxAdvances);
+    return searcher.getResults();
+}
+
+void IDSearcher3Test::searchRS_data()
+{
+    QTest::addColumn<QVector<u16>>("tids");
+    QTest::addColumn<QVector<u16>>("sids");
+    QTest::addColumn<QVector<u16>>("tsvs");
+    QTest::addColumn<u32>("initialAdvances");
+    QTest::addColumn<u32>("maxAdvances");
+
+    QTest::newRow("TID") << QVector<u16>(1, 40122) << QVector<u16>() << QVector<u16>() << 5U << 300U;
+    QTest::newRow("SID") << QVector<u16>() << QVector<u16>(1, 12345) << QVector<u16>() << 0U << 200U;
+    QTest::newRow("TSV") << QVector<u16>() << QVector<u16>() << QVector<u16>({ 0, 1000 }) << 100U << 50U;
+}
+
+void IDSearcher3Test::searchRS()
+{
+    QFETCH(QVector<u16>, tids);
+    QFETCH(QVector<u16>, sids);
+    QFETCH(QVector<u16>, tsvs);
+    QFETCH(u32, initialAdvances);
+    QFETCH(u32, maxAdvances);
+
+    IDFilter filter(std::vector<u16>(tids.begin(), tids.end()), std::vector<u16>(sids.begin(), sids.end()),
+                    std::vector<u16>(tsvs.begin(), tsvs.end()));
+    IDGenerator3 generator(initialAdvances, maxAdvances, filter);
+    std::vector<std::pair<u32, IDState3>> expected;
+    for (u32 seed = 0; seed < 0x10000; seed++)
+    {
+        for (const auto &state : generator.generateRS(seed))
+        {
+            expected.emplace_back(seed, state);
+        }
+    }
+    QVERIFY(!expected.empty());
+
+    // The order of the results must not depend on the number of threads
+    for (int threads : { 1, 4 })
+    {
+        auto results = searchIDs(tids, sids, tsvs, Game::RS, threads, initialAdvances, maxAdvances);
+        QCOMPARE(results.size(), expected.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            QCOMPARE(results[i].getSeed(), expected[i].first);
+            QCOMPARE(results[i].getAdvances(), expected[i].second.getAdvances());
+            QCOMPARE(results[i].getTID(), expected[i].second.getTID());
+            QCOMPARE(results[i].getSID(), expected[i].second.getSID());
+        }
+    }
+}
+
+void IDSearcher3Test::searchXDColo_data()
+{
+    QTest::addColumn<QVector<u16>>("tids");
+    QTest::addColumn<QVector<u16>>("sids");
+    QTest::addColumn<QVector<u16>>("tsvs");
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("TID") << QVector<u16>(1, 12345) << QVector<u16>() << QVector<u16>() << 0x10000;
+    QTest::newRow("TIDs") << QVector<u16>({ 0, 65535 }) << QVector<u16>() << QVector<u16>() << 0x20000;
+    QTest::newRow("TID and SID") << QVector<u16>(1, 12345) << QVector<u16>({ 0, 54321 }) << QVector<u16>() << -1;
+    QTest::newRow("TID and TSV") << QVector<u16>(1, 12345) << QVector<u16>() << QVector<u16>({ 100, 8191 }) << -1;
+    QTest::newRow("No filter") << QVector<u16>() << QVector<u16>() << QVector<u16>() << 0;
+}
+
+void IDSearcher3Test::searchXDColo()
+{
+    QFETCH(QVector<u16>, tids);
+    QFETCH(QVector<u16>, sids);
+    QFETCH(QVector<u16>, tsvs);
+    QFETCH(int, count);
+
+    IDFilter filter(std::vector<u16>(tids.begin(), tids.end()), std::vector<u16>(sids.begin(), sids.end()),
+                    std::vector<u16>(tsvs.begin(), tsvs.end()));
+    auto results = searchIDs(tids, sids, tsvs, Game::GC, 1);
+
+    // Pairs are reversed, so they have to be every result of the TID search that passes the filter
+    if (count == -1)
+    {
+        count = 0;
+        for (const auto &state : searchIDs(tids, {}, {}, Game::GC, 1))
+        {
+            count += filter.compare(state) ? 1 : 0;
+        }
+        QVERIFY(count != 0);
+    }
+    QCOMPARE(static_cast<int>(results.size()), count);
+
+    // Every result has to be generated by its seed
+    IDGenerator3 generator(0, 0, filter);
+    for (const auto &result : results)
+    {
+        auto states = generator.generateXDColo(result.getSeed());
+        QCOMPARE(states.size(), size_t(1));
+        QCOMPARE(states[0].getTID(), result.getTID());
+        QCOMPARE(states[0].getSID(), result.getSID());
+    }
+}
@@ -0,0 +1,17 @@
+#ifndef IDSEARCHER3TEST_HPP
+#define IDSEARCHER3TEST_HPP
+
+#include <QObject>
+
+class IDSearcher3Test : public QObject
+{
+    Q_OBJECT
+private slots:
+    void searchRS_data();
+    void searchRS();
+
+    void searchXDColo_data();
+    void searchXDColo();
+};
+
+#endif // IDSEARCHER3TEST_HPP
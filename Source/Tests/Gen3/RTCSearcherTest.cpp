@@ -0,0 +1,72 @@
+#include "RTCSearcherTest.hpp"
+#include <Core/Gen3/Searchers/RTCSearcher.hpp>
+#include <QTest>
+#include <QVector>
+
+Q_DECLARE_METATYPE(Date)
+Q_DECLARE_METATYPE(std::string)
+
+enum class RTCMode
+{
+    XD,
+    Box,
+    Ageto,
+    Rumble,
+    Channel
+};
+
+Q_DECLARE_METATYPE(RTCMode)
+
+void RTCSearcherTest::search_data()
+{
+    QTest::addColumn<RTCMode>("mode");
+    QTest::addColumn<u32>("targetSeed");
+    QTest::addColumn<u32>("initialAdvances");
+    QTest::addColumn<u32>("maxAdvances");
+    QTest::addColumn<Date>("end");
+    QTest::addColumn<QVector<std::string>>("dateTimes");
+    QTest::addColumn<QVector<u32>>("seeds");
+    QTest::addColumn<QVector<u32>>("advances");
+
+    QTest::newRow("XD") << RTCMode::XD << 0x158EAD20U << 500U << 2000U << Date(2000, 1, 20)
+                        << QVector<std::string>({ "2000-01-01 13:53:20", "2000-01-07 10:56:10" })
+                        << QVector<u32>({ 0x8D9C3078, 0xA45ABDB8 }) << QVector<u32>({ 1000, 2216 });
+    QTest::newRow("Box") << RTCMode::Box << 0x37855E78U << 0U << 0U << Date(2006, 1, 1)
+                         << QVector<std::string>({ "2000-01-02 10:17:36", "2004-04-03 20:59:44" })
+                         << QVector<u32>({ 0x37855E78, 0x37855E78 }) << QVector<u32>({ 0, 0 });
+    QTest::newRow("Ageto") << RTCMode::Ageto << 0xB8786308U << 0U << 20000U << Date(2000, 1, 20)
+                           << QVector<std::string>(1, "2000-01-01 00:16:40") << QVector<u32>(1, 0x80314B78) << QVector<u32>(1, 38672);
+    QTest::newRow("Rumble") << RTCMode::Rumble << 0x872A6E1CU << 100U << 400U << Date(2000, 1, 20)
+                            << QVector<std::string>(1, "2000-01-01 19:26:40") << QVector<u32>(1, 0x2EF4D378) << QVector<u32>(1, 300);
+    QTest::newRow("Channel 5") << RTCMode::Channel << 0x40D8AE29U << 0U << 40U << Date(2000, 2, 1)
+                               << QVector<std::string>(1, "2000-01-01 00:12:57") << QVector<u32>(1, 0x65DF8A98) << QVector<u32>(1, 5);
+    QTest::newRow("Channel 8") << RTCMode::Channel << 0xB73C82F9U << 0U << 40U << Date(2000, 2, 1)
+                               << QVector<std::string>(1, "2000-01-01 00:29:37") << QVector<u32>(1, 0xD3DC7F98) << QVector<u32>(1, 8);
+    QTest::newRow("Channel invalid") << RTCMode::Channel << 0x00000000U << 0U << 40U << Date(2000, 2, 1) << QVector<std::string>()
+                                     << QVector<u32>() << QVector<u32>();
+}
+
+void RTCSearcherTest::search()
+{
+    QFETCH(RTCMode, mode);
+    QFETCH(u32, targetSeed);
+    QFETCH(u32, initialAdvances);
+    QFETCH(u32, maxAdvances);
+    QFETCH(Date, end);
+    QFETCH(QVector<std::string>, dateTimes);
+    QFETCH(QVector<u32>, seeds);
+    QFETCH(QVector<u32>, advances);
+
+    RTCSearcher searcher;
+    searcher.startSearch(0x12345678, targetSeed, initialAdvances, maxAdvances, end, mode == RTCMode::Box, mode == RTCMode::Ageto,
+                         mode == RTCMode::Rumble, mode == RTCMode::Channel);
+
+    auto results = searcher.getResults();
+    QCOMPARE(results.size(), static_cast<size_t>(seeds.size()));
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        QCOMPARE(results[i].getDateTime(), dateTimes[i]);
+        QCOMPARE(results[i].getSeed(), seeds[i]);
+        QCOMPARE(results[i].getAdvances(), advances[i]);
+    }
+}
@@ -0,0 +1,14 @@
+#ifndef RTCSEARCHERTEST_HPP
+#define RTCSEARCHERTEST_HPP
+
+#include <QObject>
+
+class RTCSearcherTest : public QObject
+{
+    Q_OBJECT
+private slots:
+    void search_data();
+    void search();
+};
+
+#endif // RTCSEARCHERTEST_HPP
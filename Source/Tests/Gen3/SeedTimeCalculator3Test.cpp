@@ -0,0 +1,72 @@
+#include "SeedTimeCalculator3Test.hpp"
+#include <Core/Gen3/Tools/SeedTimeCalculator3.hpp>
+#include <QTest>
+#include <QVector>
+
+Q_DECLARE_METATYPE(std::string)
+
+void SeedTimeCalculator3Test::calculateTimes_data()
+{
+    QTest::addColumn<u32>("seed");
+    QTest::addColumn<u16>("year");
+    QTest::addColumn<int>("count");
+    QTest::addColumn<std::string>("first");
+    QTest::addColumn<std::string>("last");
+
+    QTest::newRow("2000") << 0x5A0U << u16(2000) << 8 << std::string("2000-01-01 00:00:00") << std::string("2000-12-30 02:10:00");
+    QTest::newRow("2004") << 0xE5FU << u16(2004) << 15 << std::string("2004-02-14 07:22:00") << std::string("2004-12-28 16:17:00");
+    QTest::newRow("2015") << 0x1234U << u16(2015) << 12 << std::string("2015-02-01 17:41:00") << std::string("2015-11-02 01:27:00");
+    QTest::newRow("Max seed") << 0xFFFFU << u16(2000) << 3 << std::string("2000-06-29 19:00:00") << std::string("2000-12-29 02:00:00");
+    QTest::newRow("Zero seed") << 0x0U << u16(2037) << 8 << std::string("2037-01-03 15:35:00") << std::string("2037-11-17 23:34:00");
+}
+
+void SeedTimeCalculator3Test::calculateTimes()
+{
+    QFETCH(u32, seed);
+    QFETCH(u16, year);
+    QFETCH(int, count);
+    QFETCH(std::string, first);
+    QFETCH(std::string, last);
+
+    auto times = SeedTimeCalculator3::calculateTimes(seed, 10, year);
+    QCOMPARE(static_cast<int>(times.size()), count);
+    QCOMPARE(times.front().getDateTime(), first);
+    QCOMPARE(times.back().getDateTime(), last);
+    QCOMPARE(times.front().getAdvances(), 10U);
+}
+
+void SeedTimeCalculator3Test::calculateTimesBatch_data()
+{
+    QTest::addColumn<u16>("year");
+    QTest::addColumn<QVector<u32>>("seeds");
+
+    QTest::newRow("Single") << u16(2000) << QVector<u32>(1, 0x5A0);
+    QTest::newRow("Many") << u16(2004) << QVector<u32>({ 0xE5F, 0x1234, 0xFFFF, 0x0, 0x5A0, 0x7FFF });
+    QTest::newRow("Duplicates") << u16(2015) << QVector<u32>({ 0x1234, 0x1234, 0xABCD, 0x1234 });
+    QTest::newRow("Upper bits") << u16(2010) << QVector<u32>({ 0x12345678, 0x5678, 0xFFFF0001 });
+}
+
+void SeedTimeCalculator3Test::calculateTimesBatch()
+{
+    QFETCH(u16, year);
+    QFETCH(QVector<u32>, seeds);
+
+    std::vector<std::pair<u32, u32>> targets;
+    for (u32 seed : seeds)
+    {
+        targets.emplace_back(seed, static_cast<u32>(targets.size()));
+    }
+
+    auto batch = SeedTimeCalculator3::calculateTimes(targets, year);
+    QCOMPARE(batch.size(), targets.size());
+    for (size_t i = 0; i < targets.size(); i++)
+    {
+        auto single = SeedTimeCalculator3::calculateTimes(targets[i].first, targets[i].second, year);
+        QCOMPARE(batch[i].size(), single.size());
+        for (size_t j = 0; j < single.size(); j++)
+        {
+            QCOMPARE(batch[i][j].getDateTime(), single[j].getDateTime());
+            QCOMPARE(batch[i][j].getAdvances(), single[j].getAdvances());
+        }
+    }
+}
@@ -0,0 +1,17 @@
+#ifndef SEEDTIMECALCULATOR3TEST_HPP
+#define SEEDTIMECALCULATOR3TEST_HPP
+
+#include <QObject>
+
+class SeedTimeCalculator3Test : public QObject
+{
+    Q_OBJECT
+private slots:
+    void calculateTimes_data();
+    void calculateTimes();
+
+    void calculateTimesBatch_data();
+    void calculateTimesBatch();
+};
+
+#endif // SEEDTIMECALCULATOR3TEST_HPP
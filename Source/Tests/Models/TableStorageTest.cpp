@@ -0,0 +1,80 @@
+#include "TableStorageTest.hpp"
+#include <Core/Util/Global.hpp>
+#include <Forms/Models/TableStorage.hpp>
+#include <QTest>
+#include <numeric>
+
+// Four cached chunks and the last chunk can be resident on top of the memory limit
+static constexpr size_t slack = 5 * 4096;
+
+static TableStorage<u32> fill(u32 rows, u32 limit)
+{
+    TableStorage<u32> storage;
+    storage.setMemoryLimit(limit);
+
+    std::vector<u32> items(rows);
+    std::iota(items.begin(), items.end(), 0);
+    storage.append(std::move(items));
+    return storage;
+}
+
+void TableStorageTest::erase_data()
+{
+    QTest::addColumn<u32>("rows");
+    QTest::addColumn<u32>("limit");
+    QTest::addColumn<u32>("index");
+
+    QTest::newRow("First row") << 100000U << 8192U << 0U;
+    QTest::newRow("Spilled row") << 100000U << 8192U << 5000U;
+    QTest::newRow("Resident row") << 100000U << 8192U << 99000U;
+    QTest::newRow("Last chunk emptied") << 40961U << 4096U << 40960U;
+    QTest::newRow("No limit") << 20000U << 0U << 12345U;
+}
+
+void TableStorageTest::erase()
+{
+    QFETCH(u32, rows);
+    QFETCH(u32, limit);
+    QFETCH(u32, index);
+
+    auto storage = fill(rows, limit);
+    storage.erase(index);
+
+    QCOMPARE(storage.size(), static_cast<size_t>(rows - 1));
+    if (limit != 0)
+    {
+        QVERIFY(storage.getResident() <= limit + slack);
+    }
+
+    for (u32 i = 0; i < rows - 1; i++)
+    {
+        QCOMPARE(storage[i], i < index ? i : i + 1);
+    }
+
+    storage.append({ rows });
+    QCOMPARE(storage[rows - 1], rows);
+}
+
+void TableStorageTest::sort_data()
+{
+    QTest::addColumn<u32>("rows");
+    QTest::addColumn<u32>("limit");
+
+    QTest::newRow("Spilled") << 100000U << 8192U;
+    QTest::newRow("Resident") << 5000U << 8192U;
+}
+
+void TableStorageTest::sort()
+{
+    QFETCH(u32, rows);
+    QFETCH(u32, limit);
+
+    auto storage = fill(rows, limit);
+    storage.sort([](u32 left, u32 right) { return left > right; });
+
+    QVERIFY(storage.getResident() <= limit + 4096);
+    for (u32 i = 0; i < rows; i++)
+    {
+        QCOMPARE(storage[i], rows - 1 - i);
+    }
+}
@@ -0,0 +1,17 @@
+#ifndef TABLESTORAGETEST_HPP
+#define TABLESTORAGETEST_HPP
+
+#include <QObject>
+
+class TableStorageTest : public QObject
+{
+    Q_OBJECT
+private slots:
+    void erase_data();
+    void erase();
+
+    void sort_data();
+    void sort();
+};
+
+#endif // TABLESTORAGETEST_HPP
@@ -0,0 +1,136 @@
+#include "JobSchedulerTest.hpp"
+#include <Core/Util/JobScheduler.hpp>
+#include <QTest>
+#include <QVector>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+
+Q_DECLARE_METATYPE(std::string)
+
+void JobSchedulerTest::priority_data()
+{
+    QTest::addColumn<int>("priorityA");
+    QTest::addColumn<int>("priorityB");
+    QTest::addColumn<std::string>("order");
+
+    QTest::newRow("Higher first") << 0 << 5 << std::string("BBBAAA");
+    QTest::newRow("Lower last") << 5 << 0 << std::string("AAABBB");
+    QTest::newRow("Equal take turns") << 0 << 0 << std::string("ABABAB");
+}
+
+void JobSchedulerTest::priority()
+{
+    QFETCH(int, priorityA);
+    QFETCH(int, priorityB);
+    QFETCH(std::string, order);
+
+    // The only worker is kept busy until both jobs are queued
+    JobScheduler scheduler(1);
+    std::promise<void> release;
+    auto blocker = scheduler.submit(1, 1, 100, [future = release.get_future().share()](u32, u32) { future.wait(); });
+
+    std::mutex mutex;
+    std::string ran;
+    auto a = scheduler.submit(3, 1, priorityA, [&](u32, u32) {
+        std::lock_guard<std::mutex> lock(mutex);
+        ran += 'A';
+    });
+    auto b = scheduler.submit(3, 1, priorityB, [&](u32, u32) {
+        std::lock_guard<std::mutex> lock(mutex);
+        ran += 'B';
+    });
+
+    release.set_value();
+    blocker->wait();
+    a->wait();
+    b->wait();
+
+    QCOMPARE(ran, order);
+}
+
+void JobSchedulerTest::pause()
+{
+    JobScheduler scheduler(2);
+    std::atomic<int> ran { 0 };
+    auto job = scheduler.submit(4, 2, 0, [&](u32, u32) { ran++; }, true);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    QCOMPARE(ran.load(), 0);
+    QCOMPARE(job->getCompleted(), 0U);
+
+    job->resume();
+    job->wait();
+    QCOMPARE(ran.load(), 4);
+    QCOMPARE(job->getCompleted(), 4U);
+}
+
+void JobSchedulerTest::cancel()
+{
+    JobScheduler scheduler(1);
+
+    // Cancelling a job that never started finishes it right away
+    auto paused = scheduler.submit(4, 1, 0, [](u32, u32) {}, true);
+    paused->cancel();
+    paused->wait();
+    QCOMPARE(paused->getCompleted(), 0U);
+
+    // The running task finishes, the tasks that did not start are dropped
+    std::promise<void> started;
+    std::promise<void> release;
+    auto future = release.get_future().share();
+    auto job = scheduler.submit(10, 1, 0, [&](u32 index, u32) {
+        if (index == 0)
+        {
+            started.set_value();
+            future.wait();
+        }
+    });
+
+    started.get_future().wait();
+    job->cancel();
+    release.set_value();
+    job->wait();
+    QCOMPARE(job->getCompleted(), 1U);
+}
+
+void JobSchedulerTest::jobControlCancel_data()
+{
+    QTest::addColumn<bool>("cancelBeforeStart");
+    QTest::addColumn<bool>("cancelAfterStart");
+    QTest::addColumn<int>("tasks");
+
+    QTest::newRow("No cancel") << false << false << 8;
+    QTest::newRow("Cancel while idle") << true << false << 8;
+    QTest::newRow("Cancel before submit") << false << true << 0;
+}
+
+void JobSchedulerTest::jobControlCancel()
+{
+    QFETCH(bool, cancelBeforeStart);
+    QFETCH(bool, cancelAfterStart);
+    QFETCH(int, tasks);
+
+    JobControl control;
+    if (cancelBeforeStart)
+    {
+        control.cancel();
+    }
+    control.start();
+    if (cancelAfterStart)
+    {
+        control.cancel();
+    }
+
+    std::atomic<int> ran { 0 };
+    control.run(8, 2, [&](u32, u32) { ran++; });
+    QCOMPARE(ran.load(), tasks);
+
+    // A cancel never carries over to the next search
+    control.start();
+    ran = 0;
+    control.run(8, 2, [&](u32, u32) { ran++; });
+    QCOMPARE(ran.load(), 8);
+}
@@ -0,0 +1,21 @@
+#ifndef JOBSCHEDULERTEST_HPP
+#define JOBSCHEDULERTEST_HPP
+
+#include <QObject>
+
+class JobSchedulerTest : public QObject
+{
+    Q_OBJECT
+private slots:
+    void priority_data();
+    void priority();
+
+    void pause();
+
+    void cancel();
+
+    void jobControlCancel_data();
+    void jobControlCancel();
+};
+
+#endif // JOBSCHEDULERTEST_HPP
@@ -0,0 +1,115 @@
+#include "OrderedResultsTest.hpp"
+#include <Core/Util/OrderedResults.hpp>
+#include <QTest>
+#include <QVector>
+
+using Result = std::pair<u32, u32>;
+
+static bool compareFirst(const Result &left, const Result &right)
+{
+    return left.first < right.first;
+}
+
+// Chunk c holds (c * 10, c) and (c * 10 + 1, c)
+static std::vector<Result> chunkResults(u32 chunk)
+{
+    return { { chunk * 10, chunk }, { chunk * 10 + 1, chunk } };
+}
+
+void OrderedResultsTest::add_data()
+{
+    QTest::addColumn<QVector<u32>>("order");
+    QTest::addColumn<QVector<u32>>("released");
+
+    QTest::newRow("In order") << QVector<u32>({ 0, 1, 2, 3 }) << QVector<u32>({ 2, 2, 2, 2 });
+    QTest::newRow("Reversed") << QVector<u32>({ 3, 2, 1, 0 }) << QVector<u32>({ 0, 0, 0, 8 });
+    QTest::newRow("Shuffled") << QVector<u32>({ 1, 0, 3, 2 }) << QVector<u32>({ 0, 4, 0, 4 });
+}
+
+void OrderedResultsTest::add()
+{
+    QFETCH(QVector<u32>, order);
+    QFETCH(QVector<u32>, released);
+
+    OrderedResults<Result> ordered(0, 4);
+    std::vector<Result> results;
+    for (int i = 0; i < order.size(); i++)
+    {
+        ordered.add(order[i], chunkResults(order[i]));
+        auto data = ordered.take();
+        QCOMPARE(data.size(), static_cast<size_t>(released[i]));
+        results.insert(results.end(), data.begin(), data.end());
+    }
+
+    std::vector<Result> expected;
+    for (u32 chunk = 0; chunk < 4; chunk++)
+    {
+        auto data = chunkResults(chunk);
+        expected.insert(expected.end(), data.begin(), data.end());
+    }
+    QVERIFY(results == expected);
+}
+
+void OrderedResultsTest::merge_data()
+{
+    QTest::addColumn<QVector<u32>>("order");
+
+    QTest::newRow("In order") << QVector<u32>({ 0, 1, 2, 3 });
+    QTest::newRow("Reversed") << QVector<u32>({ 3, 2, 1, 0 });
+    QTest::newRow("Shuffled") << QVector<u32>({ 2, 0, 3, 1 });
+}
+
+void OrderedResultsTest::merge()
+{
+    QFETCH(QVector<u32>, order);
+
+    // Chunk c holds the values c, c + 4 and 8, so every group interleaves and ends in a tie
+    OrderedResults<Result> ordered(0, 4, 2, compareFirst);
+    std::vector<Result> results;
+    for (u32 chunk : order)
+    {
+        ordered.add(chunk, { { chunk, chunk }, { chunk + 4, chunk }, { 8, chunk } });
+        auto data = ordered.take();
+        results.insert(results.end(), data.begin(), data.end());
+    }
+
+    std::vector<Result> expected = { { 0, 0 }, { 1, 1 }, { 4, 0 }, { 5, 1 }, { 8, 0 }, { 8, 1 },
+                                     { 2, 2 }, { 3, 3 }, { 6, 2 }, { 7, 3 }, { 8, 2 }, { 8, 3 } };
+    QVERIFY(results == expected);
+}
+
+void OrderedResultsTest::finish_data()
+{
+    QTest::addColumn<QVector<u32>>("chunks");
+    QTest::addColumn<u32>("groupSize");
+    QTest::addColumn<QVector<u32>>("expected");
+
+    QTest::newRow("Missing first") << QVector<u32>({ 3, 1 }) << 1U << QVector<u32>({ 1, 3 });
+    QTest::newRow("Missing middle") << QVector<u32>({ 4, 0, 2 }) << 1U << QVector<u32>({ 0, 2, 4 });
+    QTest::newRow("Partial groups") << QVector<u32>({ 5, 0, 3 }) << 2U << QVector<u32>({ 0, 3, 5 });
+}
+
+void OrderedResultsTest::finish()
+{
+    QFETCH(QVector<u32>, chunks);
+    QFETCH(u32, groupSize);
+    QFETCH(QVector<u32>, expected);
+
+    OrderedResults<Result> ordered(0, 6, groupSize, compareFirst);
+    std::vector<Result> results;
+    for (u32 chunk : chunks)
+    {
+        ordered.add(chunk, { { chunk, chunk } });
+        auto data = ordered.take();
+        results.insert(results.end(), data.begin(), data.end());
+    }
+    ordered.finish();
+    auto data = ordered.take();
+    results.insert(results.end(), data.begin(), data.end());
+
+    QCOMPARE(results.size(), static_cast<size_t>(expected.size()));
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        QCOMPARE(results[i].first, expected[i]);
+    }
+}
@@ -0,0 +1,20 @@
+#ifndef ORDEREDRESULTSTEST_HPP
+#define ORDEREDRESULTSTEST_HPP
+
+#include <QObject>
+
+class OrderedResultsTest : public QObject
+{
+    Q_OBJECT
+private slots:
+    void add_data();
+    void add();
+
+    void merge_data();
+    void merge();
+
+    void finish_data();
+    void finish();
+};
+
+#endif // ORDEREDRESULTSTEST_HPP
@@ -0,0 +1,127 @@
+#include "ResultStoreTest.hpp"
+#include <Core/Util/ResultStore.hpp>
+#include <QTest>
+#include <QVector>
+#include <filesystem>
+#include <numeric>
+#include <thread>
+
+Q_DECLARE_METATYPE(ResultPolicy)
+
+static std::vector<u32> sequence(u32 first, u32 count)
+{
+    std::vector<u32> values(count);
+    std::iota(values.begin(), values.end(), first);
+    return values;
+}
+
+static std::vector<u32> takeAll(ResultStore<u32> &store, size_t maxTake)
+{
+    std::vector<u32> results;
+    for (auto data = store.take(); !data.empty(); data = store.take())
+    {
+        if (data.size() > maxTake)
+        {
+            return {};
+        }
+        results.insert(results.end(), data.begin(), data.end());
+    }
+    return results;
+}
+
+void ResultStoreTest::policy_data()
+{
+    QTest::addColumn<ResultPolicy>("policy");
+    QTest::addColumn<u32>("kept");
+    QTest::addColumn<u64>("spilled");
+    QTest::addColumn<u64>("dropped");
+
+    QTest::newRow("Spill") << ResultPolicy::Spill << 100U << 96ULL << 0ULL;
+    QTest::newRow("Drop") << ResultPolicy::Drop << 4U << 0ULL << 96ULL;
+}
+
+void ResultStoreTest::policy()
+{
+    QFETCH(ResultPolicy, policy);
+    QFETCH(u32, kept);
+    QFETCH(u64, spilled);
+    QFETCH(u64, dropped);
+
+    ResultStore<u32> store;
+    store.setBudget({ 4, policy, "" });
+    for (u32 i = 0; i < 100; i += 5)
+    {
+        store.add(sequence(i, 5));
+    }
+
+    QCOMPARE(store.getSpilled(), spilled);
+    QCOMPARE(store.getDropped(), dropped);
+    QVERIFY(takeAll(store, 4) == sequence(0, kept));
+
+    // The spill file is reused once it was read back
+    store.add(sequence(100, 10));
+    auto results = takeAll(store, 4);
+    QCOMPARE(results.size(), static_cast<size_t>(policy == ResultPolicy::Spill ? 10 : 4));
+    QCOMPARE(results.front(), 100U);
+}
+
+void ResultStoreTest::block()
+{
+    ResultStore<u32> store;
+    store.setBudget({ 4, ResultPolicy::Block, "" });
+
+    std::thread producer([&store] {
+        for (u32 i = 0; i < 100; i += 10)
+        {
+            store.add(sequence(i, 10));
+        }
+    });
+
+    std::vector<u32> results;
+    while (results.size() < 100)
+    {
+        auto data = store.take();
+        QVERIFY(data.size() <= 4);
+        results.insert(results.end(), data.begin(), data.end());
+        std::this_thread::yield();
+    }
+    producer.join();
+
+    QVERIFY(results == sequence(0, 100));
+    QCOMPARE(store.getSpilled(), 0ULL);
+    QCOMPARE(store.getDropped(), 0ULL);
+}
+
+void ResultStoreTest::append()
+{
+    ResultStore<u32> store;
+    store.setBudget({ 4, ResultPolicy::Block, "" });
+
+    // Appending never waits, wait() does until the results were taken
+    store.append(sequence(0, 10));
+    std::thread waiter([&store] { store.wait(); });
+    QVERIFY(store.take() == sequence(0, 10));
+    waiter.join();
+
+    store.append(sequence(10, 10));
+    store.cancel();
+    store.wait();
+    QVERIFY(store.take() == sequence(10, 10));
+}
+
+void ResultStoreTest::unusableSpill()
+{
+    auto fileName = (std::filesystem::temp_directory_path() / "ResultStoreTest" / "missing" / "spill.bin").string();
+
+    ResultStore<u32> store;
+    store.setBudget({ 4, ResultPolicy::Spill, fileName });
+    for (u32 i = 0; i < 20; i += 5)
+    {
+        store.add(sequence(i, 5));
+    }
+
+    // Results stay in memory when the spill file can not be opened
+    QCOMPARE(store.getSpilled(), 0ULL);
+    QCOMPARE(store.getDropped(), 0ULL);
+    QVERIFY(store.take() == sequence(0, 20));
+}
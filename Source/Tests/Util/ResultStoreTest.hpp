@@ -0,0 +1,20 @@
+#ifndef RESULTSTORETEST_HPP
+#define RESULTSTORETEST_HPP
+
+#include <QObject>
+
+class ResultStoreTest : public QObject
+{
+    Q_OBJECT
+private slots:
+    void policy_data();
+    void policy();
+
+    void block();
+
+    void append();
+
+    void unusableSpill();
+};
+
+#endif // RESULTSTORETEST_HPP
@@ -0,0 +1,152 @@
+#include "SearchCheckpointTest.hpp"
+#include <Core/Gen4/Searchers/IDSearcher4.hpp>
+#include <Core/Util/SearchCheckpoint.hpp>
+#include <QTest>
+#include <QVector>
+#include <cstring>
+#include <filesystem>
+
+static std::string journal()
+{
+    auto path = std::filesystem::temp_directory_path() / "SearchCheckpointTest.bin";
+    std::filesystem::remove(path);
+    return path.string();
+}
+
+void SearchCheckpointTest::resume_data()
+{
+    QTest::addColumn<QVector<u64>>("parameters");
+    QTest::addColumn<u32>("resultSize");
+    QTest::addColumn<bool>("resumed");
+
+    QTest::newRow("Same search") << QVector<u64>({ 1, 2, 3 }) << 4U << true;
+    QTest::newRow("Other parameters") << QVector<u64>({ 1, 2, 4 }) << 4U << false;
+    QTest::newRow("Other result size") << QVector<u64>({ 1, 2, 3 }) << 8U << false;
+}
+
+void SearchCheckpointTest::resume()
+{
+    QFETCH(QVector<u64>, parameters);
+    QFETCH(u32, resultSize);
+    QFETCH(bool, resumed);
+
+    std::string fileName = journal();
+    {
+        SearchCheckpoint checkpoint(fileName, { 1, 2, 3 }, 8, sizeof(u32));
+        QVERIFY(checkpoint.isOpen());
+        checkpoint.complete(5, std::vector<u32>({ 50, 51 }));
+        checkpoint.complete(2, std::vector<u32>());
+        checkpoint.complete(0, std::vector<u32>({ 1 }));
+    }
+
+    SearchCheckpoint checkpoint(fileName, std::vector<u64>(parameters.begin(), parameters.end()), 8, resultSize);
+    for (u32 chunk = 0; chunk < 8; chunk++)
+    {
+        QCOMPARE(checkpoint.isCompleted(chunk), resumed && (chunk == 0 || chunk == 2 || chunk == 5));
+    }
+
+    if (resumed)
+    {
+        QCOMPARE(checkpoint.getResults<u32>(5), std::vector<u32>({ 50, 51 }));
+        QCOMPARE(checkpoint.getResults<u32>(2), std::vector<u32>());
+        QCOMPARE(checkpoint.getResults<u32>(0), std::vector<u32>({ 1 }));
+    }
+    else
+    {
+        QVERIFY(checkpoint.getResults<u32>().empty());
+    }
+}
+
+void SearchCheckpointTest::truncated()
+{
+    std::string fileName = journal();
+    {
+        SearchCheckpoint checkpoint(fileName, { 7 }, 4, sizeof(u32));
+        checkpoint.complete(0, std::vector<u32>({ 1, 2 }));
+        checkpoint.complete(1, std::vector<u32>({ 3, 4 }));
+    }
+
+    // Cut the last record short, as if the process died while writing it
+    std::filesystem::resize_file(fileName, std::filesystem::file_size(fileName) - sizeof(u32));
+    {
+        SearchCheckpoint checkpoint(fileName, { 7 }, 4, sizeof(u32));
+        QVERIFY(checkpoint.isCompleted(0));
+        QVERIFY(!checkpoint.isCompleted(1));
+        QCOMPARE(checkpoint.getResults<u32>(), std::vector<u32>({ 1, 2 }));
+        checkpoint.complete(1, std::vector<u32>({ 5 }));
+    }
+
+    SearchCheckpoint checkpoint(fileName, { 7 }, 4, sizeof(u32));
+    QVERIFY(checkpoint.isCompleted(1));
+    QCOMPARE(checkpoint.getResults<u32>(), std::vector<u32>({ 1, 2, 5 }));
+}
+
+void SearchCheckpointTest::searcher_data()
+{
+    QTest::addColumn<u32>("minDelay");
+    QTest::addColumn<u32>("maxDelay");
+    QTest::addColumn<u32>("skip");
+
+    QTest::newRow("All chunks restored") << 5000U << 5100U << 0U;
+    QTest::newRow("Last chunks restored") << 5000U << 5100U << 1U;
+    QTest::newRow("No chunks restored") << 5000U << 5100U << 2U;
+}
+
+void SearchCheckpointTest::searcher()
+{
+    QFETCH(u32, minDelay);
+    QFETCH(u32, maxDelay);
+    QFETCH(u32, skip);
+
+    IDFilter filter({}, {}, { 0, 1, 2, 3, 4, 5, 6, 7 });
+
+    IDSearcher4 full(filter);
+    full.startSearch(false, 2010, minDelay, maxDelay);
+    auto expected = full.getResults();
+    QVERIFY(!expected.empty());
+
+    std::string fileName = journal();
+    IDSearcher4 first(filter);
+    first.setCheckpoint(fileName);
+    first.startSearch(false, 2010, minDelay, maxDelay);
+    QCOMPARE(first.getResults().size(), expected.size());
+
+    // Drop the records of the first chunks, the resumed search has to place the restored results after them
+    {
+        FILE *file = std::fopen(fileName.c_str(), "rb");
+        QVERIFY(file);
+        std::vector<char> data(static_cast<size_t>(std::filesystem::file_size(fileName)));
+        QCOMPARE(std::fread(data.data(), 1, data.size(), file), data.size());
+        std::fclose(file);
+
+        // Seven header words and the parameters, then every record is a chunk and a count word followed by the results
+        u32 parameters;
+        std::memcpy(&parameters, data.data() + 6 * sizeof(u32), sizeof(u32));
+        size_t header = 7 * sizeof(u32) + parameters * sizeof(u64);
+        size_t offset = header;
+        for (u32 i = 0; i < skip; i++)
+        {
+            u32 count;
+            std::memcpy(&count, data.data() + offset + sizeof(u32), sizeof(u32));
+            offset += 2 * sizeof(u32) + count * sizeof(IDState4);
+        }
+        data.erase(data.begin() + static_cast<std::ptrdiff_t>(header), data.begin() + static_cast<std::ptrdiff_t>(offset));
+
+        file = std::fopen(fileName.c_str(), "wb");
+        QVERIFY(file);
+        QCOMPARE(std::fwrite(data.data(), 1, data.size(), file), data.size());
+        std::fclose(file);
+    }
+
+    IDSearcher4 resumed(filter);
+    resumed.setCheckpoint(fileName);
+    resumed.startSearch(false, 2010, minDelay, maxDelay);
+    auto results = resumed.getResults();
+
+    QCOMPARE(results.size(), expected.size());
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        QCOMPARE(results[i].getSeed(), expected[i].getSeed());
+        QCOMPARE(results[i].getDelay(), expected[i].getDelay());
+    }
+}
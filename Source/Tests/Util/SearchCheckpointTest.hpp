@@ -0,0 +1,19 @@
+#ifndef SEARCHCHECKPOINTTEST_HPP
+#define SEARCHCHECKPOINTTEST_HPP
+
+#include <QObject>
+
+class SearchCheckpointTest : public QObject
+{
+    Q_OBJECT
+private slots:
+    void resume_data();
+    void resume();
+
+    void truncated();
+
+    void searcher_data();
+    void searcher();
+};
+
+#endif // SEARCHCHECKPOINTTEST_HPP
@@ -0,0 +1,77 @@
+#include "SpillFileTest.hpp"
+#include <Core/Util/SpillFile.hpp>
+#include <QTest>
+#include <QVector>
+#include <filesystem>
+
+void SpillFileTest::roundTrip_data()
+{
+    QTest::addColumn<bool>("temporary");
+
+    QTest::newRow("Temporary file") << true;
+    QTest::newRow("Named file") << false;
+}
+
+void SpillFileTest::roundTrip()
+{
+    QFETCH(bool, temporary);
+
+    auto path = std::filesystem::temp_directory_path() / "SpillFileTest.bin";
+    SpillFile spill;
+    QVERIFY(spill.open(temporary ? "" : path.string()));
+    QVERIFY(spill.isOpen());
+
+    // Writes and reads are interleaved, each read continues where the last one stopped
+    u32 written = 0;
+    u32 read = 0;
+    for (int round = 0; round < 10; round++)
+    {
+        std::vector<u32> data(1000);
+        for (u32 &value : data)
+        {
+            value = written++;
+        }
+        QVERIFY(spill.write(data.data(), data.size() * sizeof(u32)));
+
+        std::vector<u32> back(700);
+        QVERIFY(spill.read(back.data(), back.size() * sizeof(u32)));
+        for (u32 value : back)
+        {
+            QCOMPARE(value, read++);
+        }
+    }
+    QCOMPARE(spill.getPending(), static_cast<u64>(written - read) * sizeof(u32));
+
+    // Reading more than is pending fails without consuming anything
+    std::vector<u32> back(written - read + 1);
+    QVERIFY(!spill.read(back.data(), back.size() * sizeof(u32)));
+    QVERIFY(spill.read(back.data(), (back.size() - 1) * sizeof(u32)));
+    QCOMPARE(back.front(), read);
+    QCOMPARE(back[back.size() - 2], written - 1);
+    QCOMPARE(spill.getPending(), 0ULL);
+
+    spill.close();
+    QVERIFY(!spill.isOpen());
+    std::filesystem::remove(path);
+}
+
+void SpillFileTest::reuse()
+{
+    auto path = std::filesystem::temp_directory_path() / "SpillFileTest.bin";
+    SpillFile spill;
+    QVERIFY(spill.open(path.string()));
+
+    // A drained queue starts over at the front of the file, so it only grows to the largest backlog
+    std::vector<u32> data(4096, 0x12345678);
+    for (int round = 0; round < 10; round++)
+    {
+        QVERIFY(spill.write(data.data(), data.size() * sizeof(u32)));
+        std::vector<u32> back(data.size());
+        QVERIFY(spill.read(back.data(), back.size() * sizeof(u32)));
+        QVERIFY(back == data);
+    }
+    spill.close();
+
+    QCOMPARE(std::filesystem::file_size(path), static_cast<std::uintmax_t>(data.size() * sizeof(u32)));
+    std::filesystem::remove(path);
+}
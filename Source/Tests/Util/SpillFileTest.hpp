@@ -0,0 +1,16 @@
+#ifndef SPILLFILETEST_HPP
+#define SPILLFILETEST_HPP
+
+#include <QObject>
+
+class SpillFileTest : public QObject
+{
+    Q_OBJECT
+private slots:
+    void roundTrip_data();
+    void roundTrip();
+
+    void reuse();
+};
+
+#endif // SPILLFILETEST_HPP
@@ -1,5 +1,9 @@
 #include <QDebug>
 #include <QTest>
+#include <Tests/Gen3/IDSearcher3Test.hpp>
+#include <Tests/Gen3/RTCSearcherTest.hpp>
+#include <Tests/Gen3/SeedTimeCalculator3Test.hpp>
+#include <Tests/Models/TableStorageTest.hpp>
 #include <Tests/RNG/LCRNG64Test.hpp>
 #include <Tests/RNG/LCRNGTest.hpp>
 #include <Tests/RNG/MTTest.hpp>
@@ -8,6 +12,11 @@
 #include <Tests/RNG/SFMTTest.hpp>
 #include <Tests/RNG/SHA1Test.hpp>
 #include <Tests/RNG/TinyMTTest.hpp>
+#include <Tests/Util/JobSchedulerTest.hpp>
+#include <Tests/Util/OrderedResultsTest.hpp>
+#include <Tests/Util/ResultStoreTest.hpp>
+#include <Tests/Util/SearchCheckpointTest.hpp>
+#include <Tests/Util/SpillFileTest.hpp>
 
 template <class Testname>
 int runTest(QStringList &fails)
@@ -28,6 +37,14 @@ int main()
     int status = 0;
     QStringList fails;
 
+    // Gen 3 Tests
+    status += runTest<IDSearcher3Test>(fails);
+    status += runTest<RTCSearcherTest>(fails);
+    status += runTest<SeedTimeCalculator3Test>(fails);
+
+    // Model Tests
+    status += runTest<TableStorageTest>(fails);
+
     // RNG Tests
     status += runTest<LCRNGTest>(fails);
     status += runTest<LCRNG64Test>(fails);
@@ -38,6 +55,13 @@ int main()
     status += runTest<SHA1Test>(fails);
     status += runTest<TinyMTTest>(fails);
 
+    // Util Tests
+    status += runTest<JobSchedulerTest>(fails);
+    status += runTest<OrderedResultsTest>(fails);
+    status += runTest<ResultStoreTest>(fails);
+    status += runTest<SearchCheckpointTest>(fails);
+    status += runTest<SpillFileTest>(fails);
+
     qDebug() << "";
     // Summary of failures at end for easy viewing
     for (const QString &fail : fails)